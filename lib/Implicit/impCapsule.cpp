@@ -19,6 +19,7 @@
  */
 
 #include "impCapsule.h"
+#include "impSimd.h"
 
 float
 impCapsule::value(float* position)
@@ -40,3 +41,33 @@ impCapsule::value(float* position)
 
 	return thicknessSquared / (tx * tx + ty * ty + sz * sz + IMP_MIN_DIVISOR);
 }
+
+void
+impCapsule::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv ts(impSet1(thicknessSquared));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	const impFloatv len(impSet1(length));
+	const impFloatv zero(impSet1(0.0f));
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		impFloatv tx, ty, tz;
+		impTransform(invtrmat, impLoad(xs + i), impLoad(ys + i), impLoad(zs + i), tx, ty, tz);
+		const impFloatv zz(impSub(impAbs(tz), len));
+		const impFloatv sz(impAnd(impLess(zero, zz), zz));
+		const impFloatv v(impDiv(ts, impAdd(impAdd(impAdd(impMul(tx, tx), impMul(ty, ty)), impMul(sz, sz)), mindiv)));
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
+void
+impCapsule::getBounds(float cutoff, float* min, float* max)
+{
+	const float d(falloffDistance(thicknessSquared, cutoff));
+	const float size[3] = {d, d, length + d};
+	transformBounds(size, min, max);
+}
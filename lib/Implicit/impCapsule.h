@@ -34,6 +34,8 @@ public:
 
 	void setLength(float l) { length = l; }
 	virtual float value(float* position);
+	virtual void addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+	virtual void getBounds(float cutoff, float* min, float* max);
 };
 
 #endif
@@ -20,9 +20,11 @@
 
 #include "impCubeVolume.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include <rsMath/rsMath.h>
+#include <rsThreads/rsWorkerPool.h>
 
 impCubeVolume::impCubeVolume(void* base/* = nullptr*/) : base(base)
 {
@@ -36,6 +38,19 @@ impCubeVolume::impCubeVolume(void* base/* = nullptr*/) : base(base)
 			crawlDirections[i][j] = cubeTables.crawlDirections[i][j];
 	}
 
+	frame = 0;
+	usethreads = true;
+	numPages = 0;
+	pagesUsed = 0;
+	sparse = false;
+	shapetolerance = 0.0f;
+	shapecutoff = 0.01f;
+	bricksvalid = false;
+	brickbase = nullptr;
+	brickfunction = nullptr;
+	brickbatchfunction = nullptr;
+	bricksurfacevalue = 0.0f;
+	brickfastnormals = false;
 	surface = new impSurface;
 	init(4, 4, 4, 0.2f);
 	surfacevalue = 0.5f;
@@ -46,17 +61,14 @@ impCubeVolume::impCubeVolume(void* base/* = nullptr*/) : base(base)
 
 impCubeVolume::~impCubeVolume()
 {
-	cubes.clear();
-	cubeIndices.clear();
+	slabs.clear();
 	sortableCubes.clear();
 }
 
 void
 impCubeVolume::init(unsigned int width, unsigned int height, unsigned int length, float cw)
 {
-	unsigned int i, j, k;
-
-	cubes.clear();
+	unsigned int i;
 
 	// frequently used values
 	w = width;
@@ -74,562 +86,1067 @@ impCubeVolume::init(unsigned int width, unsigned int height, unsigned int length
 	lbf[1] = -float(h) * cubewidth * 0.5f;
 	lbf[2] = -float(l) * cubewidth * 0.5f;
 
-	// allocate cubedata memory and set cube positions
-	cubes.resize(w_1xh_1xl_1);
+	// corner positions along each axis
+	cornerX.resize(w_1);
 	for (i = 0; i < w_1; ++i)
+		cornerX[i] = lbf[0] + (cubewidth * float(i));
+	cornerY.resize(h_1);
+	for (i = 0; i < h_1; ++i)
+		cornerY[i] = lbf[1] + (cubewidth * float(i));
+	cornerZ.resize(l_1);
+	for (i = 0; i < l_1; ++i)
+		cornerZ[i] = lbf[2] + (cubewidth * float(i));
+
+	// allocate corner data
+	numPages = (w_1xh_1xl_1 + IMP_PAGE_SIZE - 1) >> IMP_PAGE_SHIFT;
+	pageTable.reset(new std::atomic<page*>[numPages]);
+	pageChunks.clear();
+	pagesUsed = 0;
+	resetPages();
+
+	makeSlabs();
+
+	// bricks are made when they are first needed
+	bricks.clear();
+	bricksvalid = false;
+}
+
+void
+impCubeVolume::nextFrame()
+{
+	// Done flags are only 8 bits to keep the volume small, so clear them
+	// whenever the frame number wraps around.
+	++frame;
+	if (frame == 0)
 	{
-		for (j = 0; j < h_1; ++j)
+		for (unsigned int n = 0; n < pagesUsed; ++n)
 		{
-			for (k = 0; k < l_1; ++k)
-			{
-				const unsigned int index(cubeindex(i, j, k));
-				cubes[index].x = lbf[0] + (cubewidth * float(i));
-				cubes[index].y = lbf[1] + (cubewidth * float(j));
-				cubes[index].z = lbf[2] + (cubewidth * float(k));
-#ifdef __SSE__
-				cubes[index].w = 1.0f;
-#endif
-				cubes[index].cube_frame = 0;
-				cubes[index].corner_frame = 0;
-				cubes[index].x_vertex_frame = 0;
-				cubes[index].y_vertex_frame = 0;
-				cubes[index].z_vertex_frame = 0;
-			}
+			page& p(pageChunks[n / IMP_PAGE_CHUNK][n % IMP_PAGE_CHUNK]);
+			std::fill(p.cubeFrames, p.cubeFrames + IMP_PAGE_SIZE, 0);
+			std::fill(p.cornerFrames, p.cornerFrames + IMP_PAGE_SIZE, 0);
+			std::fill(&(p.edgeVertexFrames[0][0]), &(p.edgeVertexFrames[0][0]) + 3 * IMP_PAGE_SIZE, 0);
 		}
+		frame = 1;
 	}
 }
 
 void
-impCubeVolume::makeSurface()
+impCubeVolume::startFrame()
 {
-	unsigned int i, j, k;
+	nextFrame();
+	// corner values are not kept up to date for the bricks
+	bricksvalid = false;
+	if (sparse)
+		resetPages();
+}
 
-	frame++;
+void
+impCubeVolume::useSparseStorage(bool val)
+{
+	sparse = val;
+	resetPages();
+	bricksvalid = false;
+}
 
-	surface->reset();
+size_t
+impCubeVolume::getStorageSize() const
+{
+	return pageChunks.size() * IMP_PAGE_CHUNK * sizeof(page) + numPages * sizeof(std::atomic<page*>);
+}
 
-	// find gradient value at every corner
-	for (i = 0; i <= w; ++i)
+void
+impCubeVolume::resetPages()
+{
+	for (unsigned int n = 0; n < numPages; ++n)
+		pageTable[n].store(nullptr, std::memory_order_relaxed);
+	// keep only as many pages as the last frame needed
+	const size_t chunks((pagesUsed + IMP_PAGE_CHUNK - 1) / IMP_PAGE_CHUNK);
+	if (pageChunks.size() > chunks)
+		pageChunks.resize(chunks);
+	pagesUsed = 0;
+
+	if (!sparse)
+	{
+		for (unsigned int n = 0; n < numPages; ++n)
+			allocatePage(n);
+	}
+}
+
+impCubeVolume::page*
+impCubeVolume::allocatePage(unsigned int n)
+{
+	// Several slabs can reach the same page at once, so only one of them
+	// may hand it out.
+	std::lock_guard<std::mutex> lock(pageMutex);
+	page* p(pageTable[n].load(std::memory_order_relaxed));
+	if (p)
+		return p;
+
+	if (pagesUsed == pageChunks.size() * IMP_PAGE_CHUNK)
+		pageChunks.emplace_back(new page[IMP_PAGE_CHUNK]);
+	p = &(pageChunks[pagesUsed / IMP_PAGE_CHUNK][pagesUsed % IMP_PAGE_CHUNK]);
+	++pagesUsed;
+
+	// pages are reused, so nothing on them has been done this frame
+	std::fill(p->cubeFrames, p->cubeFrames + IMP_PAGE_SIZE, 0);
+	std::fill(p->cornerFrames, p->cornerFrames + IMP_PAGE_SIZE, 0);
+	std::fill(&(p->edgeVertexFrames[0][0]), &(p->edgeVertexFrames[0][0]) + 3 * IMP_PAGE_SIZE, 0);
+
+	pageTable[n].store(p, std::memory_order_release);
+	return p;
+}
+
+void
+impCubeVolume::storeValues(unsigned int first, const float* values, unsigned int count)
+{
+	while (count)
 	{
-		for (j = 0; j <= h; ++j)
+		page& p(pageOf(first));
+		const unsigned int offset(first & IMP_PAGE_MASK);
+		const unsigned int run(std::min(IMP_PAGE_SIZE - offset, count));
+		std::copy(values, values + run, p.cornerValues + offset);
+		std::fill(p.cornerFrames + offset, p.cornerFrames + offset + run, frame);
+		first += run;
+		values += run;
+		count -= run;
+	}
+}
+
+void
+impCubeVolume::useThreads(bool val)
+{
+	usethreads = val;
+	makeSlabs();
+}
+
+void
+impCubeVolume::makeSlabs()
+{
+	unsigned int n(1);
+	if (usethreads)
+	{
+		// Only every other slab can be worked on at a time, so make
+		// twice as many slabs as there are threads.
+		const unsigned int threads(rsWorkerPool::shared().getNumThreads());
+		if (threads > 1)
+			n = threads * 2;
+		if (n > l / IMP_MIN_SLAB_THICKNESS)
+			n = l / IMP_MIN_SLAB_THICKNESS;
+		if (n > IMP_MAX_SLABS)
+			n = IMP_MAX_SLABS;
+		if (n < 1)
+			n = 1;
+	}
+
+	slabs.clear();
+	slabs.resize(n);
+	for (unsigned int s = 0; s < n; ++s)
+	{
+		slabs[s].number = s;
+		slabs[s].kmin = (l * s) / n;
+		slabs[s].kmax = (l * (s + 1)) / n;
+		slabs[s].rowy.resize(w_1);
+		slabs[s].rowz.resize(w_1);
+		slabs[s].rowvalues.resize(w_1);
+		// every cube in the slab can be queued at most once per crawl
+		slabs[s].frontier.reserve(w * h * (slabs[s].kmax - slabs[s].kmin));
+	}
+}
+
+void
+impCubeVolume::makeBricks()
+{
+	bw = (w + IMP_BRICK_SIZE - 1) / IMP_BRICK_SIZE;
+	bh = (h + IMP_BRICK_SIZE - 1) / IMP_BRICK_SIZE;
+	bl = (l + IMP_BRICK_SIZE - 1) / IMP_BRICK_SIZE;
+
+	bricks.clear();
+	bricks.resize(bw * bh * bl);
+	for (unsigned int k = 0; k < bl; ++k)
+	{
+		for (unsigned int j = 0; j < bh; ++j)
 		{
-			for (k = 0; k <= l; ++k)
+			for (unsigned int i = 0; i < bw; ++i)
 			{
-				const unsigned int ci(cubeindex(i, j, k));
-				cubes[ci].value = function(base, &(cubes[ci].x));
+				brick& b(bricks[(k * bh + j) * bw + i]);
+				b.imin = i * IMP_BRICK_SIZE;
+				b.jmin = j * IMP_BRICK_SIZE;
+				b.kmin = k * IMP_BRICK_SIZE;
+				b.imax = std::min(b.imin + IMP_BRICK_SIZE, w);
+				b.jmax = std::min(b.jmin + IMP_BRICK_SIZE, h);
+				b.kmax = std::min(b.kmin + IMP_BRICK_SIZE, l);
+				b.dirty = true;
 			}
 		}
 	}
+	bricksvalid = false;
+}
 
-	// polygonize surface
-	currentVertexIndex = 0;
-	for (i = 0; i < w; ++i)
+void
+impCubeVolume::setShapes(impShape* const* shapeList, unsigned int count)
+{
+	shapes.assign(shapeList, shapeList + count);
+}
+
+void
+impCubeVolume::resetSlabs()
+{
+	for (unsigned int n = 0; n < slabs.size(); ++n)
 	{
-		for (j = 0; j < h; ++j)
+		slab& s(slabs[n]);
+		// A single slab can write straight into the surface.
+		s.surface = (slabs.size() == 1) ? surface : &(s.fragment);
+		s.surface->reset();
+		s.currentVertexIndex = 0;
+		s.crawlStarts.clear();
+		s.cubeIndices.clear();
+		s.numPolygonized = 0;
+		s.fromBelow.clear();
+		s.fromAbove.clear();
+		s.sortableCubes.clear();
+	}
+}
+
+void
+impCubeVolume::forEachSlab(const std::function<void(slab& s)>& func)
+{
+	const unsigned int n(slabs.size());
+	for (unsigned int parity = 0; parity < 2; ++parity)
+	{
+		rsWorkerPool::shared().parallelFor((n + 1 - parity) / 2, [&](unsigned int i)
 		{
-			for (k = 0; k < l; ++k)
-			{
-				const unsigned int ci(cubeindex(i, j, k));
-				cubes[ci].mask = calculateCornerMask(i, j, k);
-				polygonize(ci);
-			}
-		}
+			func(slabs[i * 2 + parity]);
+		});
+	}
+}
+
+bool
+impCubeVolume::slabsHaveHandovers()
+{
+	for (unsigned int n = 0; n < slabs.size(); ++n)
+	{
+		if (!slabs[n].fromBelow.empty() || !slabs[n].fromAbove.empty())
+			return true;
 	}
+	return false;
 }
 
 void
-impCubeVolume::makeSurface(float eyex, float eyey, float eyez)
+impCubeVolume::mergeSlabs()
 {
-	unsigned int i, j, k;
+	if (slabs.size() == 1)
+		return;
+
+	// where each slab's vertices start in the merged surface
+	unsigned int vertexBase[IMP_MAX_SLABS];
+	unsigned int numVertices(0);
+	unsigned int numIndices(0);
+	for (unsigned int n = 0; n < slabs.size(); ++n)
+	{
+		vertexBase[n] = numVertices;
+		numVertices += slabs[n].fragment.getNumVertices();
+		numIndices += slabs[n].fragment.getNumIndices();
+	}
+	surface->reserve(numVertices, numIndices);
+
+	for (unsigned int n = 0; n < slabs.size(); ++n)
+	{
+		const impSurface& fragment(slabs[n].fragment);
+
+		surface->appendVertices(fragment.getVertices(), fragment.getNumVertices());
+
+		const unsigned int* indices(fragment.getIndices());
+		const unsigned int count(fragment.getNumIndices());
+		if (rebasedIndices.size() < count)
+			rebasedIndices.resize(count);
+		for (unsigned int i = 0; i < count; ++i)
+			rebasedIndices[i] = vertexBase[indices[i] >> IMP_SLAB_SHIFT] + (indices[i] & IMP_SLAB_LOCAL_MASK);
+		surface->appendIndices(rebasedIndices.data(), count);
+
+#if USE_TRIANGLE_STRIPS
+		const unsigned int* lengths(fragment.getTriStripLengths());
+		for (unsigned int t = 0; t < fragment.getNumTriStrips(); ++t)
+			surface->addTriStripLength(lengths[t]);
+#endif
+	}
+}
+
+void
+impCubeVolume::makeSurface()
+{
+	if (!shapes.empty())
+	{
+		makeBrickSurface();
+		return;
+	}
 
-	frame++;
+	startFrame();
 
 	surface->reset();
+	resetSlabs();
 
 	// find gradient value at every corner
-	for (i = 0; i <= w; ++i)
+	rsWorkerPool::shared().parallelFor(slabs.size(), [this](unsigned int n)
+	{
+		findslabvalues(slabs[n]);
+	});
+
+	// polygonize surface
+	forEachSlab([this](slab& s)
 	{
-		for (j = 0; j <= h; ++j)
+		for (unsigned int k = s.kmin; k < s.kmax; ++k)
 		{
-			for (k = 0; k <= l; ++k)
+			for (unsigned int j = 0; j < h; ++j)
 			{
-				const unsigned int ci(cubeindex(i, j, k));
-				cubes[ci].value = function(base, &(cubes[ci].x));
+				for (unsigned int i = 0; i < w; ++i)
+				{
+					const unsigned int ci(cubeindex(i, j, k));
+					cubeMaskAt(ci) = calculateCornerMask(i, j, k);
+					polygonize(s, ci);
+				}
 			}
 		}
-	}
+	});
 
-	// erase list from last frame
-	sortableCubes.clear();
+	mergeSlabs();
+}
+
+void
+impCubeVolume::makeSurface(float eyex, float eyey, float eyez)
+{
+	startFrame();
+
+	surface->reset();
+	resetSlabs();
+
+	// find gradient value at every corner
+	rsWorkerPool::shared().parallelFor(slabs.size(), [this](unsigned int n)
+	{
+		findslabvalues(slabs[n]);
+	});
 
 	// collect list of cubes
-	sortableCube* sc;
-	unsigned int mask;
-	for (i = 0; i < w; ++i)
+	rsWorkerPool::shared().parallelFor(slabs.size(), [&](unsigned int n)
 	{
-		for (j = 0; j < h; ++j)
+		slab& s(slabs[n]);
+		for (unsigned int k = s.kmin; k < s.kmax; ++k)
 		{
-			for (k = 0; k < l; ++k)
+			for (unsigned int j = 0; j < h; ++j)
 			{
-				const unsigned int ci(cubeindex(i, j, k));
-				mask = calculateCornerMask(i, j, k);
-				if (mask != 0 && mask != 255)
+				for (unsigned int i = 0; i < w; ++i)
 				{
-					cubes[ci].mask = mask;
-					sortableCubes.push_back(sortableCube(ci));
-					sc = &(sortableCubes.back());
-					const float xdist(cubes[ci].x - eyex);
-					const float ydist(cubes[ci].y - eyey);
-					const float zdist(cubes[ci].z - eyez);
-					sc->depth = xdist * xdist + ydist * ydist + zdist * zdist;
+					const unsigned int ci(cubeindex(i, j, k));
+					const unsigned int mask(calculateCornerMask(i, j, k));
+					if (mask != 0 && mask != 255)
+					{
+						cubeMaskAt(ci) = mask;
+						s.sortableCubes.push_back(sortableCube(ci));
+						sortableCube& sc(s.sortableCubes.back());
+						const float xdist(cornerX[i] - eyex);
+						const float ydist(cornerY[j] - eyey);
+						const float zdist(cornerZ[k] - eyez);
+						sc.depth = xdist * xdist + ydist * ydist + zdist * zdist;
+					}
 				}
 			}
 		}
-	}
+	});
+
+	// erase list from last frame and gather the slabs' lists
+	sortableCubes.clear();
+	for (unsigned int n = 0; n < slabs.size(); ++n)
+		sortableCubes.splice(sortableCubes.end(), slabs[n].sortableCubes);
 
 	// sort list of cubes
 	sortableCubes.sort();
 
-	// polygonize
-	currentVertexIndex = 0;
-	for (std::list<sortableCube>::iterator c = sortableCubes.begin(); c != sortableCubes.end(); ++c)
-		polygonize(c->index);
+	polygonizeSorted();
 }
 
 void
 impCubeVolume::makeSurface(impCrawlPointVector& cpv)
 {
-	unsigned int i, j, k;
-	bool crawlpointexit;
-	unsigned int mask;
+	if (!shapes.empty())
+	{
+		makeBrickSurface();
+		return;
+	}
 
-	frame++;
+	startFrame();
 
 	surface->reset();
+	resetSlabs();
 
-	currentCubeIndex = 0;
+	assignCrawlPoints(cpv);
 
-	// crawl from every crawl point to create the surface
-	for (unsigned int cp = 0; cp < cpv.size(); ++cp)
+	// Crawl and polygonize until no slab hands any more cubes over to its neighbors.
+	bool firstRound(true);
+	do
 	{
-		// find cube corresponding to crawl point
-		i = int((cpv[cp].position[0] - lbf[0]) / cubewidth);
-		if (i < 0)
-			i = 0;
-		if (i >= int(w))
-			i = int(w) - 1;
-		j = int((cpv[cp].position[1] - lbf[1]) / cubewidth);
-		if (j < 0)
-			j = 0;
-		if (j >= int(h))
-			j = int(h) - 1;
-		k = int((cpv[cp].position[2] - lbf[2]) / cubewidth);
-		if (k < 0)
-			k = 0;
-		if (k >= int(l))
-			k = int(l) - 1;
-
-		// escape if starting on a finished cube
-		crawlpointexit = false;
-		while (!crawlpointexit)
+		forEachSlab([&](slab& s)
 		{
-			const unsigned int ci(cubeindex(i, j, k));
-			if (cubes[ci].cube_frame == frame)
-				crawlpointexit = true;  // escape if starting on a finished cube
-			else
+			if (firstRound)
 			{
-				// find index for this cube
-				findcornervalues(i, j, k);
-				mask = calculateCornerMask(i, j, k);
-				// save index for polygonizing
-				cubes[ci].mask = mask;
-				if (mask == 255)  // escape if outside surface
-					crawlpointexit = true;
-				else
+				// crawl from every crawl point to create the surface
+				for (unsigned int cp = 0; cp < s.crawlStarts.size(); ++cp)
 				{
-					if (mask == 0)
-					{
-						// this cube is inside volume
-						cubes[ci].cube_frame = frame;
-						++i;  // step to an adjacent cube and start over
-						if (i >= w)  // escape if you step outside of volume
-							crawlpointexit = true;
-					}
-					else
-					{
-						crawl_nosort(i, j, k);
-						crawlpointexit = true;
-					}
+					const unsigned int ci(s.crawlStarts[cp]);
+					crawlFromPoint(s, ci % w_1, (ci / w_1) % h_1, ci / w_1xh_1, false);
 				}
+
+				if (crawlfromsides)
+					crawlFromSlabSides(s, false);
 			}
-		}
-	}
 
-	if (crawlfromsides)
+			crawlHandovers(s, false);
+
+			// polygonize
+			polygonizeCrawled(s);
+		});
+		firstRound = false;
+	} while (slabsHaveHandovers());
+
+	mergeSlabs();
+}
+
+void
+impCubeVolume::makeSurface(float eyex, float eyey, float eyez, impCrawlPointVector& cpv)
+{
+	startFrame();
+
+	surface->reset();
+	resetSlabs();
+
+	assignCrawlPoints(cpv);
+
+	// Crawl until no slab hands any more cubes over to its neighbors.
+	bool firstRound(true);
+	do
 	{
-		for (j = 0; j <= h; ++j)
+		forEachSlab([&](slab& s)
 		{
-			for (i = j % 2; i <= w; i += 2)
+			if (firstRound)
 			{
-				// left side of volume
-				cubedata& cube0(cubes[cubeindex(i, j, 0)]);
-				if (cube0.corner_frame != frame)
-				{
-					cube0.corner_frame = frame;
-					cube0.value = function(base, &(cube0.x));
-				}
-				if (cube0.value >= surfacevalue)
+				// crawl from every crawl point to create the surface
+				for (unsigned int cp = 0; cp < s.crawlStarts.size(); ++cp)
 				{
-					if (i != 0 && j != 0)
-						crawl_nosort(i - 1, j - 1, 0);
-					if (i != w && j != 0)
-						crawl_nosort(i, j - 1, 0);
-					if (i != 0 && j != h)
-						crawl_nosort(i - 1, j, 0);
-					if (i != w && j != h)
-						crawl_nosort(i, j, 0);
+					const unsigned int ci(s.crawlStarts[cp]);
+					crawlFromPoint(s, ci % w_1, (ci / w_1) % h_1, ci / w_1xh_1, true);
 				}
 
-				// right side of volume
-				cubedata& cube1(cubes[cubeindex(i, j, l)]);
-				if (cube1.corner_frame != frame)
-				{
-					cube1.corner_frame = frame;
-					cube1.value = function(base, &(cube1.x));
-				}
-
-				if (cube1.value >= surfacevalue)
-				{
-					if (i != 0 && j != 0)
-						crawl_nosort(i - 1, j - 1, l - 1);
-					if (i != w && j != 0)
-						crawl_nosort(i, j - 1, l - 1);
-					if (i != 0 && j != h)
-						crawl_nosort(i - 1, j, l - 1);
-					if (i != w && j != h)
-						crawl_nosort(i, j, l - 1);
-				}
+				if (crawlfromsides)
+					crawlFromSlabSides(s, true);
 			}
+
+			crawlHandovers(s, true);
+		});
+		firstRound = false;
+	} while (slabsHaveHandovers());
+
+	// erase list from last frame and gather the slabs' lists
+	sortableCubes.clear();
+	for (unsigned int n = 0; n < slabs.size(); ++n)
+		sortableCubes.splice(sortableCubes.end(), slabs[n].sortableCubes);
+
+	// find depths of cubes for sorting
+	for (std::list<sortableCube>::iterator c = sortableCubes.begin(); c != sortableCubes.end(); ++c)
+	{
+		unsigned int i, j, k;
+		cubecoords(c->index, i, j, k);
+		const float xdist(cornerX[i] - eyex);
+		const float ydist(cornerY[j] - eyey);
+		const float zdist(cornerZ[k] - eyez);
+		c->depth = xdist * xdist + ydist * ydist + zdist * zdist;
+	}
+
+	// sort list of cubes
+	sortableCubes.sort();
+
+	polygonizeSorted();
+}
+
+void
+impCubeVolume::findslabvalues(slab& s)
+{
+	// the last slab also does the top layer of corners
+	const unsigned int kmax((s.kmax == l) ? l_1 : s.kmax);
+	for (unsigned int k = s.kmin; k < kmax; ++k)
+	{
+		for (unsigned int j = 0; j <= h; ++j)
+		{
+			// evaluate a whole row of corners at once
+			const unsigned int row(cubeindex(0, j, k));
+			std::fill(s.rowy.begin(), s.rowy.end(), cornerY[j]);
+			std::fill(s.rowz.begin(), s.rowz.end(), cornerZ[k]);
+			evaluate(&(cornerX[0]), &(s.rowy[0]), &(s.rowz[0]), &(s.rowvalues[0]), w_1);
+			storeValues(row, &(s.rowvalues[0]), w_1);
 		}
-		for (k = 1; k < l; ++k)
+	}
+}
+
+void
+impCubeVolume::makeBrickSurface()
+{
+	nextFrame();
+
+	if (bricks.empty())
+		makeBricks();
+	if (base != brickbase || function != brickfunction || batchfunction != brickbatchfunction
+	    || surfacevalue != bricksurfacevalue || fastnormals != brickfastnormals)
+	{
+		bricksvalid = false;
+		brickbase = base;
+		brickfunction = function;
+		brickbatchfunction = batchfunction;
+		bricksurfacevalue = surfacevalue;
+		brickfastnormals = fastnormals;
+	}
+
+	// evaluate the corners of bricks overlapped by shapes that moved
+	findDirtyBricks();
+	listBrickShapes();
+	forEachListedBrick([this](brick& b)
+	{
+		findbrickvalues(b);
+	});
+
+	// Every corner value is current now, either from this frame or from the
+	// frame in which its brick was last evaluated.
+	for (unsigned int n = 0; n < pagesUsed; ++n)
+	{
+		page& p(pageChunks[n / IMP_PAGE_CHUNK][n % IMP_PAGE_CHUNK]);
+		std::fill(p.cornerFrames, p.cornerFrames + IMP_PAGE_SIZE, frame);
+	}
+
+	// A brick's cubes also use the corners just past its far sides, so
+	// polygonize the bricks that are dirty or have a dirty neighbor there.
+	brickList.clear();
+	for (unsigned int k = 0; k < bl; ++k)
+	{
+		for (unsigned int j = 0; j < bh; ++j)
 		{
-			for (i = k % 2; i <= w; i += 2)
+			for (unsigned int i = 0; i < bw; ++i)
 			{
-				// bottom of volume
-				cubedata& cube0(cubes[cubeindex(i, 0, k)]);
-				if (cube0.corner_frame != frame)
+				bool changed(false);
+				for (unsigned int n = 0; n < 8 && !changed; ++n)
 				{
-					cube0.corner_frame = frame;
-					cube0.value = function(base, &(cube0.x));
+					const unsigned int bi(i + (n & 1));
+					const unsigned int bj(j + ((n >> 1) & 1));
+					const unsigned int bk(k + (n >> 2));
+					if (bi < bw && bj < bh && bk < bl)
+						changed = bricks[(bk * bh + bj) * bw + bi].dirty;
 				}
+				if (changed)
+					brickList.push_back((k * bh + j) * bw + i);
+			}
+		}
+	}
+	forEachListedBrick([this](brick& b)
+	{
+		polygonizeBrick(b);
+	});
 
-				if (cube0.value >= surfacevalue)
-				{
-					if (i != 0)
-					{
-						crawl_nosort(i - 1, 0, k - 1);
-						crawl_nosort(i - 1, 0, k);
-					}
-					if (i != w)
-					{
-						crawl_nosort(i, 0, k - 1);
-						crawl_nosort(i, 0, k);
-					}
-				}
+	for (unsigned int n = 0; n < bricks.size(); ++n)
+		bricks[n].dirty = false;
 
-				// top of volume
-				cubedata& cube1(cubes[cubeindex(i, h, k)]);
-				if (cube1.corner_frame != frame)
-				{
-					cube1.corner_frame = frame;
-					cube1.value = function(base, &(cube1.x));
-				}
-				if (cube1.value >= surfacevalue)
-				{
-					if (i != 0)
-					{
-						crawl_nosort(i - 1, h - 1, k - 1);
-						crawl_nosort(i - 1, h - 1, k);
-					}
+	mergeBricks();
+}
 
-					if (i != w)
-					{
-						crawl_nosort(i, h - 1, k - 1);
-						crawl_nosort(i, h - 1, k);
-					}
-				}
-			}
-		}
-		for (k = 1; k < l; ++k)
+// true if a and b are further apart than tolerance
+static inline bool
+differs(float a, float b, float tolerance)
+{
+	// a == b also catches unbounded bounds, whose difference is not a number
+	return a != b && !(fabsf(a - b) <= tolerance);
+}
+
+void
+impCubeVolume::findDirtyBricks()
+{
+	shapebounds.resize(shapes.size() * 6);
+	for (unsigned int n = 0; n < shapes.size(); ++n)
+		shapes[n]->getBounds(shapecutoff, &(shapebounds[n * 6]), &(shapebounds[n * 6 + 3]));
+
+	if (!bricksvalid || shapestates.size() != shapes.size())
+	{
+		// start over with every brick
+		for (unsigned int n = 0; n < bricks.size(); ++n)
+			bricks[n].dirty = true;
+		shapestates.resize(shapes.size());
+		for (unsigned int n = 0; n < shapes.size(); ++n)
+			saveShapeState(shapestates[n], shapes[n], &(shapebounds[n * 6]), &(shapebounds[n * 6 + 3]));
+		bricksvalid = true;
+	}
+	else
+	{
+		for (unsigned int n = 0; n < shapes.size(); ++n)
 		{
-			for (j = (k % 2) + 1; j < h; j += 2)
+			shapestate& st(shapestates[n]);
+			const float* min(&(shapebounds[n * 6]));
+			const float* max(&(shapebounds[n * 6 + 3]));
+			if (shapeMoved(st, shapes[n], min, max))
 			{
-				// back of volume
-				cubedata& cube0(cubes[cubeindex(0, j, k)]);
-				if (cube0.corner_frame != frame)
-				{
-					cube0.corner_frame = frame;
-					cube0.value = function(base, &(cube0.x));
-				}
+				// the field changed both where the shape was and where it is now
+				dirtyBricks(st.min, st.max);
+				dirtyBricks(min, max);
+				saveShapeState(st, shapes[n], min, max);
+			}
+		}
+	}
 
-				if (cube0.value >= surfacevalue)
-				{
-					crawl_nosort(0, j - 1, k - 1);
-					crawl_nosort(0, j, k - 1);
-					crawl_nosort(0, j - 1, k);
-					crawl_nosort(0, j, k);
-				}
+	brickList.clear();
+	for (unsigned int n = 0; n < bricks.size(); ++n)
+	{
+		if (bricks[n].dirty)
+			brickList.push_back(n);
+	}
+}
 
-				// front of volume
-				cubedata& cube1(cubes[cubeindex(w, j, k)]);
-				if (cube1.corner_frame != frame)
-				{
-					cube1.corner_frame = frame;
-					cube1.value = function(base, &(cube1.x));
-				}
+bool
+impCubeVolume::shapeMoved(const shapestate& st, const impShape* shape, const float* min, const float* max)
+{
+	if (st.shape != shape)
+		return true;
 
-				if (cube1.value >= surfacevalue)
+	for (unsigned int i = 0; i < 16; ++i)
+	{
+		if (differs(st.mat[i], shape->mat[i], shapetolerance))
+			return true;
+	}
+	if (differs(st.thickness, shape->thickness, shapetolerance))
+		return true;
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		if (differs(st.min[i], min[i], shapetolerance) || differs(st.max[i], max[i], shapetolerance))
+			return true;
+	}
+
+	return false;
+}
+
+void
+impCubeVolume::saveShapeState(shapestate& st, const impShape* shape, const float* min, const float* max)
+{
+	st.shape = shape;
+	std::copy(shape->mat, shape->mat + 16, st.mat);
+	st.thickness = shape->thickness;
+	std::copy(min, min + 3, st.min);
+	std::copy(max, max + 3, st.max);
+}
+
+bool
+impCubeVolume::findBrickRange(const float* min, const float* max, unsigned int* bmin, unsigned int* bmax)
+{
+	const unsigned int corners[3] = {w, h, l};
+	const unsigned int counts[3] = {bw, bh, bl};
+
+	for (unsigned int a = 0; a < 3; ++a)
+	{
+		// range of corners inside the box along this axis
+		float lo((min[a] - lbf[a]) / cubewidth);
+		float hi((max[a] - lbf[a]) / cubewidth);
+		if (!(hi >= 0.0f) || !(lo <= float(corners[a])))
+			return false;  // box misses the volume
+		lo = ceilf((lo < 0.0f) ? 0.0f : lo);
+		hi = floorf((hi > float(corners[a])) ? float(corners[a]) : hi);
+		if (lo > hi)
+			return false;  // box fits between two corners
+
+		// The last brick on each axis also holds the corners on the far side
+		// of the volume.
+		bmin[a] = std::min((unsigned int)(lo) / IMP_BRICK_SIZE, counts[a] - 1);
+		bmax[a] = std::min((unsigned int)(hi) / IMP_BRICK_SIZE, counts[a] - 1);
+	}
+
+	return true;
+}
+
+void
+impCubeVolume::dirtyBricks(const float* min, const float* max)
+{
+	unsigned int bmin[3], bmax[3];
+	if (!findBrickRange(min, max, bmin, bmax))
+		return;
+
+	for (unsigned int k = bmin[2]; k <= bmax[2]; ++k)
+	{
+		for (unsigned int j = bmin[1]; j <= bmax[1]; ++j)
+		{
+			for (unsigned int i = bmin[0]; i <= bmax[0]; ++i)
+				bricks[(k * bh + j) * bw + i].dirty = true;
+		}
+	}
+}
+
+void
+impCubeVolume::listBrickShapes()
+{
+	for (unsigned int n = 0; n < brickList.size(); ++n)
+		bricks[brickList[n]].shapes.clear();
+
+	// Shapes are listed in their original order, so that the sums come out
+	// the same as adding up all shapes when none are left out.
+	unsigned int bmin[3], bmax[3];
+	for (unsigned int n = 0; n < shapes.size(); ++n)
+	{
+		if (!findBrickRange(&(shapebounds[n * 6]), &(shapebounds[n * 6 + 3]), bmin, bmax))
+			continue;
+		for (unsigned int k = bmin[2]; k <= bmax[2]; ++k)
+		{
+			for (unsigned int j = bmin[1]; j <= bmax[1]; ++j)
+			{
+				for (unsigned int i = bmin[0]; i <= bmax[0]; ++i)
 				{
-					crawl_nosort(w - 1, j - 1, k - 1);
-					crawl_nosort(w - 1, j, k - 1);
-					crawl_nosort(w - 1, j - 1, k);
-					crawl_nosort(w - 1, j, k);
+					brick& b(bricks[(k * bh + j) * bw + i]);
+					if (b.dirty)
+						b.shapes.push_back(shapes[n]);
 				}
 			}
 		}
 	}
+}
 
-	// polygonize
-	currentVertexIndex = 0;
-	for (unsigned int c = 0; c < currentCubeIndex; ++c)
-		polygonize(cubeIndices[c]);
+void
+impCubeVolume::forEachListedBrick(const std::function<void(brick& b)>& func)
+{
+	if (!usethreads)
+	{
+		for (unsigned int n = 0; n < brickList.size(); ++n)
+			func(bricks[brickList[n]]);
+		return;
+	}
+
+	rsWorkerPool::shared().parallelFor(brickList.size(), [&](unsigned int n)
+	{
+		func(bricks[brickList[n]]);
+	});
 }
 
 void
-impCubeVolume::makeSurface(float eyex, float eyey, float eyez, impCrawlPointVector& cpv)
+impCubeVolume::findbrickvalues(brick& b)
 {
-	int i, j, k;
-	bool crawlpointexit;
-	unsigned int mask;
+	// bricks at the far sides of the volume also do the last layer of corners
+	const unsigned int imax((b.imax == w) ? w_1 : b.imax);
+	const unsigned int jmax((b.jmax == h) ? h_1 : b.jmax);
+	const unsigned int kmax((b.kmax == l) ? l_1 : b.kmax);
+	const unsigned int n(imax - b.imin);
+	float ys[IMP_BRICK_SIZE + 1], zs[IMP_BRICK_SIZE + 1], values[IMP_BRICK_SIZE + 1];
+	for (unsigned int k = b.kmin; k < kmax; ++k)
+	{
+		std::fill(zs, zs + n, cornerZ[k]);
+		for (unsigned int j = b.jmin; j < jmax; ++j)
+		{
+			// sum the shapes reaching this brick over a row of corners at once
+			std::fill(values, values + n, 0.0f);
+			std::fill(ys, ys + n, cornerY[j]);
+			for (unsigned int s = 0; s < b.shapes.size(); ++s)
+				b.shapes[s]->addValues(&(cornerX[b.imin]), ys, zs, values, n);
+			storeValues(cubeindex(b.imin, j, k), values, n);
+		}
+	}
+}
 
-	frame++;
+void
+impCubeVolume::polygonizeBrick(brick& b)
+{
+	brickwork work;
+	work.surface = &(b.mesh);
+	work.imin = b.imin;
+	work.jmin = b.jmin;
+	work.kmin = b.kmin;
+	work.currentVertexIndex = 0;
+	std::fill(&(work.edgeVertexIndices[0][0]), &(work.edgeVertexIndices[0][0]) + 3 * IMP_BRICK_CORNERS, ~0u);
+
+	b.mesh.reset();
+	for (unsigned int k = b.kmin; k < b.kmax; ++k)
+	{
+		for (unsigned int j = b.jmin; j < b.jmax; ++j)
+		{
+			for (unsigned int i = b.imin; i < b.imax; ++i)
+			{
+				const unsigned int ci(cubeindex(i, j, k));
+				cubeMaskAt(ci) = calculateCornerMask(i, j, k);
+				polygonize(work, ci);
+			}
+		}
+	}
+}
 
+void
+impCubeVolume::mergeBricks()
+{
+	unsigned int numVertices(0);
+	unsigned int numIndices(0);
+	for (unsigned int n = 0; n < bricks.size(); ++n)
+	{
+		numVertices += bricks[n].mesh.getNumVertices();
+		numIndices += bricks[n].mesh.getNumIndices();
+	}
 	surface->reset();
+	surface->reserve(numVertices, numIndices);
 
-	// erase list from last frame
-	sortableCubes.clear();
+	unsigned int vertexBase(0);
+	for (unsigned int n = 0; n < bricks.size(); ++n)
+	{
+		const impSurface& mesh(bricks[n].mesh);
+		if (mesh.getNumVertices() == 0)
+			continue;
+
+		surface->appendVertices(mesh.getVertices(), mesh.getNumVertices());
+
+		const unsigned int* indices(mesh.getIndices());
+		const unsigned int count(mesh.getNumIndices());
+		if (rebasedIndices.size() < count)
+			rebasedIndices.resize(count);
+		for (unsigned int i = 0; i < count; ++i)
+			rebasedIndices[i] = vertexBase + indices[i];
+		surface->appendIndices(rebasedIndices.data(), count);
 
-	// crawl from every crawl point to create the surface
+#if USE_TRIANGLE_STRIPS
+		const unsigned int* lengths(mesh.getTriStripLengths());
+		for (unsigned int t = 0; t < mesh.getNumTriStrips(); ++t)
+			surface->addTriStripLength(lengths[t]);
+#endif
+
+		vertexBase += mesh.getNumVertices();
+	}
+}
+
+void
+impCubeVolume::evaluate(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	if (batchfunction)
+	{
+		batchfunction(base, xs, ys, zs, values, n);
+		return;
+	}
+
+	float position[3];
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		position[0] = xs[i];
+		position[1] = ys[i];
+		position[2] = zs[i];
+		values[i] = function(base, position);
+	}
+}
+
+void
+impCubeVolume::assignCrawlPoints(impCrawlPointVector& cpv)
+{
 	for (unsigned int cp = 0; cp < cpv.size(); ++cp)
 	{
 		// find cube corresponding to crawl point
-		i = int((cpv[cp].position[0] - lbf[0]) / cubewidth);
+		int i = int((cpv[cp].position[0] - lbf[0]) / cubewidth);
 		if (i < 0)
 			i = 0;
 		if (i >= int(w))
 			i = int(w) - 1;
-		j = int((cpv[cp].position[1] - lbf[1]) / cubewidth);
+		int j = int((cpv[cp].position[1] - lbf[1]) / cubewidth);
 		if (j < 0)
 			j = 0;
 		if (j >= int(h))
 			j = int(h) - 1;
-		k = int((cpv[cp].position[2] - lbf[2]) / cubewidth);
+		int k = int((cpv[cp].position[2] - lbf[2]) / cubewidth);
 		if (k < 0)
 			k = 0;
 		if (k >= int(l))
 			k = int(l) - 1;
 
-		// escape if starting on a finished cube
-		crawlpointexit = false;
-		while (!crawlpointexit)
+		// hand crawl point to the slab containing it
+		unsigned int n(0);
+		while ((unsigned int)(k) >= slabs[n].kmax)
+			++n;
+		slabs[n].crawlStarts.push_back(cubeindex(i, j, k));
+	}
+}
+
+void
+impCubeVolume::crawlFromPoint(slab& s, int i, int j, int k, bool sort)
+{
+	// escape if starting on a finished cube
+	bool crawlpointexit = false;
+	while (!crawlpointexit)
+	{
+		const unsigned int ci(cubeindex(i, j, k));
+		if (cubeFrameAt(ci) == frame)
+			crawlpointexit = true;  // escape if starting on a finished cube
+		else
 		{
-			const unsigned int ci(cubeindex(i, j, k));
-			if (cubes[ci].cube_frame == frame)
-				crawlpointexit = true;  // escape if starting on a finished cube
+			// find index for this cube
+			findcornervalues(i, j, k);
+			const unsigned int mask(calculateCornerMask(i, j, k));
+			// save index for polygonizing
+			cubeMaskAt(ci) = mask;
+			if (mask == 255)  // escape if outside surface
+				crawlpointexit = true;
 			else
 			{
-				// find index for this cube
-				findcornervalues(i, j, k);
-				mask = calculateCornerMask(i, j, k);
-				// save index for polygonizing
-				cubes[ci].mask = mask;
-				if (mask == 255)  // escape if outside surface
-					crawlpointexit = true;
-				else
+				if (mask == 0)
 				{
-					if (mask == 0)
+					// this cube is inside volume
+					cubeFrameAt(ci) = frame;
+					// step to an adjacent cube and start over
+					// escape if you step outside of volume
+					if (sort)
 					{
-						// this cube is inside volume
-						cubes[ci].cube_frame = frame;
-						--i;  // step to an adjacent cube and start over
-						if (i < 0)  // escape if you step outside of volume
+						--i;
+						if (i < 0)
 							crawlpointexit = true;
 					}
 					else
 					{
-						crawl_sort(i, j, k);
-						crawlpointexit = true;
+						++i;
+						if (i >= int(w))
+							crawlpointexit = true;
 					}
 				}
+				else
+				{
+					crawl(s, i, j, k, sort);
+					crawlpointexit = true;
+				}
 			}
 		}
 	}
+}
+
+void
+impCubeVolume::crawlFromSlabSides(slab& s, bool sort)
+{
+	unsigned int i, j, k;
 
-	if (crawlfromsides)
+	for (j = 0; j <= h; ++j)
 	{
-		for (j = 0; j <= int(h); ++j)
+		for (i = j % 2; i <= w; i += 2)
 		{
-			for (i = j % 2; i <= int(w); i += 2)
+			// left side of volume
+			if (s.kmin == 0 && cornervalue(cubeindex(i, j, 0)) >= surfacevalue)
 			{
-				// left side of volume
-				cubedata& cube0(cubes[cubeindex(i, j, 0)]);
-				if (cube0.corner_frame != frame)
-				{
-					cube0.corner_frame = frame;
-					cube0.value = function(base, &(cube0.x));
-				}
-
-				if (cube0.value >= surfacevalue)
-				{
-					if (i != 0 && j != 0)
-						crawl_sort(i - 1, j - 1, 0);
-					if (i != w && j != 0)
-						crawl_sort(i, j - 1, 0);
-					if (i != 0 && j != h)
-						crawl_sort(i - 1, j, 0);
-					if (i != w && j != h)
-						crawl_sort(i, j, 0);
-				}
-
-				// right side of volume
-				cubedata& cube1(cubes[cubeindex(i, j, l)]);
-				if (cube1.corner_frame != frame)
-				{
-					cube1.corner_frame = frame;
-					cube1.value = function(base, &(cube1.x));
-				}
+				if (i != 0 && j != 0)
+					crawl(s, i - 1, j - 1, 0, sort);
+				if (i != w && j != 0)
+					crawl(s, i, j - 1, 0, sort);
+				if (i != 0 && j != h)
+					crawl(s, i - 1, j, 0, sort);
+				if (i != w && j != h)
+					crawl(s, i, j, 0, sort);
+			}
 
-				if (cube1.value >= surfacevalue)
-				{
-					if (i != 0 && j != 0)
-						crawl_sort(i - 1, j - 1, l - 1);
-					if (i != w && j != 0)
-						crawl_sort(i, j - 1, l - 1);
-					if (i != 0 && j != h)
-						crawl_sort(i - 1, j, l - 1);
-					if (i != w && j != h)
-						crawl_sort(i, j, l - 1);
-				}
+			// right side of volume
+			if (s.kmax == l && cornervalue(cubeindex(i, j, l)) >= surfacevalue)
+			{
+				if (i != 0 && j != 0)
+					crawl(s, i - 1, j - 1, l - 1, sort);
+				if (i != w && j != 0)
+					crawl(s, i, j - 1, l - 1, sort);
+				if (i != 0 && j != h)
+					crawl(s, i - 1, j, l - 1, sort);
+				if (i != w && j != h)
+					crawl(s, i, j, l - 1, sort);
 			}
 		}
+	}
 
-		for (k = 1; k < int(l); ++k)
+	// Remaining sides, for the corner layers belonging to this slab.
+	// Crawls into layer k - 1 may be handed over to the slab below.
+	const unsigned int kmin((s.kmin == 0) ? 1 : s.kmin);
+	for (k = kmin; k < s.kmax; ++k)
+	{
+		for (i = k % 2; i <= w; i += 2)
 		{
-			for (i = k % 2; i <= int(w); i += 2)
+			// bottom of volume
+			if (cornervalue(cubeindex(i, 0, k)) >= surfacevalue)
 			{
-				// bottom of volume
-				cubedata& cube0(cubes[cubeindex(i, 0, k)]);
-				if (cube0.corner_frame != frame)
+				if (i != 0)
 				{
-					cube0.corner_frame = frame;
-					cube0.value = function(base, &(cube0.x));
+					crawl(s, i - 1, 0, k - 1, sort);
+					crawl(s, i - 1, 0, k, sort);
 				}
-
-				if (cube0.value >= surfacevalue)
+				if (i != w)
 				{
-					if (i != 0)
-					{
-						crawl_sort(i - 1, 0, k - 1);
-						crawl_sort(i - 1, 0, k);
-					}
-
-					if (i != w)
-					{
-						crawl_sort(i, 0, k - 1);
-						crawl_sort(i, 0, k);
-					}
+					crawl(s, i, 0, k - 1, sort);
+					crawl(s, i, 0, k, sort);
 				}
-				// top of volume
-				cubedata& cube1(cubes[cubeindex(i, h, k)]);
-				if (cube1.corner_frame != frame)
+			}
+
+			// top of volume
+			if (cornervalue(cubeindex(i, h, k)) >= surfacevalue)
+			{
+				if (i != 0)
 				{
-					cube1.corner_frame = frame;
-					cube1.value = function(base, &(cube1.x));
+					crawl(s, i - 1, h - 1, k - 1, sort);
+					crawl(s, i - 1, h - 1, k, sort);
 				}
-
-				if (cube1.value >= surfacevalue)
+				if (i != w)
 				{
-					if (i != 0)
-					{
-						crawl_sort(i - 1, h - 1, k - 1);
-						crawl_sort(i - 1, h - 1, k);
-					}
-
-					if (i != w)
-					{
-						crawl_sort(i, h - 1, k - 1);
-						crawl_sort(i, h - 1, k);
-					}
+					crawl(s, i, h - 1, k - 1, sort);
+					crawl(s, i, h - 1, k, sort);
 				}
 			}
 		}
-
-		for (k = 1; k < int(l); ++k)
+	}
+	for (k = kmin; k < s.kmax; ++k)
+	{
+		for (j = (k % 2) + 1; j < h; j += 2)
 		{
-			for (j = (k % 2) + 1; j < int(h); j += 2)
+			// back of volume
+			if (cornervalue(cubeindex(0, j, k)) >= surfacevalue)
 			{
-				// back of volume
-				cubedata& cube0(cubes[cubeindex(0, j, k)]);
-				if (cube0.corner_frame != frame)
-				{
-					cube0.corner_frame = frame;
-					cube0.value = function(base, &(cube0.x));
-				}
-
-				if (cube0.value >= surfacevalue)
-				{
-					crawl_sort(0, j - 1, k - 1);
-					crawl_sort(0, j, k - 1);
-					crawl_sort(0, j - 1, k);
-					crawl_sort(0, j, k);
-				}
-
-				// front of volume
-				cubedata& cube1(cubes[cubeindex(w, j, k)]);
-				if (cube1.corner_frame != frame)
-				{
-					cube1.corner_frame = frame;
-					cube1.value = function(base, &(cube1.x));
-				}
+				crawl(s, 0, j - 1, k - 1, sort);
+				crawl(s, 0, j, k - 1, sort);
+				crawl(s, 0, j - 1, k, sort);
+				crawl(s, 0, j, k, sort);
+			}
 
-				if (cube1.value >= surfacevalue)
-				{
-					crawl_sort(w - 1, j - 1, k - 1);
-					crawl_sort(w - 1, j, k - 1);
-					crawl_sort(w - 1, j - 1, k);
-					crawl_sort(w - 1, j, k);
-				}
+			// front of volume
+			if (cornervalue(cubeindex(w, j, k)) >= surfacevalue)
+			{
+				crawl(s, w - 1, j - 1, k - 1, sort);
+				crawl(s, w - 1, j, k - 1, sort);
+				crawl(s, w - 1, j - 1, k, sort);
+				crawl(s, w - 1, j, k, sort);
 			}
 		}
 	}
+}
 
-	// find depths of cubes for sorting
-	for (std::list<sortableCube>::iterator c = sortableCubes.begin(); c != sortableCubes.end(); ++c)
+void
+impCubeVolume::crawlHandovers(slab& s, bool sort)
+{
+	// Neighbors are idle while this slab works, so these lists stay put.
+	for (unsigned int n = 0; n < s.fromBelow.size(); ++n)
 	{
-		const unsigned int ci(c->index);
-		const float xdist(cubes[ci].x - eyex);
-		const float ydist(cubes[ci].y - eyey);
-		const float zdist(cubes[ci].z - eyez);
-		c->depth = xdist * xdist + ydist * ydist + zdist * zdist;
+		const unsigned int ci(s.fromBelow[n]);
+		crawl(s, ci % w_1, (ci / w_1) % h_1, ci / w_1xh_1, sort);
 	}
+	s.fromBelow.clear();
 
-	// sort list of cubes
-	sortableCubes.sort();
+	for (unsigned int n = 0; n < s.fromAbove.size(); ++n)
+	{
+		const unsigned int ci(s.fromAbove[n]);
+		crawl(s, ci % w_1, (ci / w_1) % h_1, ci / w_1xh_1, sort);
+	}
+	s.fromAbove.clear();
+}
+
+void
+impCubeVolume::polygonizeCrawled(slab& s)
+{
+	for (; s.numPolygonized < s.cubeIndices.size(); ++s.numPolygonized)
+		polygonize(s, s.cubeIndices[s.numPolygonized]);
+}
 
-	// polygonize
-	currentVertexIndex = 0;
+void
+impCubeVolume::polygonizeSorted()
+{
+	// Depth order has to be kept, so this is done on one thread straight into
+	// the surface.  Nothing has been polygonized yet this frame, so all vertex
+	// indices belong to the first slab and need no rebasing.
+	slab& s(slabs[0]);
+	s.surface = surface;
 	for (std::list<sortableCube>::iterator c = sortableCubes.begin(); c != sortableCubes.end(); ++c)
-		polygonize(c->index);
+		polygonize(s, c->index);
 }
 
 // calculate index into cube table
@@ -637,98 +1154,101 @@ const unsigned int
 impCubeVolume::calculateCornerMask(const unsigned int& x, const unsigned int& y, const unsigned int& z)
 {
 	const unsigned int index(cubeindex(x, y, z));
-	return ((cubes[index].value < surfacevalue) ? LBF : 0)
-	    + ((cubes[index + 1].value < surfacevalue) ? RBF : 0)
-	    + ((cubes[index + w_1].value < surfacevalue) ? LTF : 0)
-	    + ((cubes[index + 1 + w_1].value < surfacevalue) ? RTF : 0)
-	    + ((cubes[index + w_1xh_1].value < surfacevalue) ? LBN : 0)
-	    + ((cubes[index + 1 + w_1xh_1].value < surfacevalue) ? RBN : 0)
-	    + ((cubes[index + w_1 + w_1xh_1].value < surfacevalue) ? LTN : 0)
-	    + ((cubes[index + 1 + w_1 + w_1xh_1].value < surfacevalue) ? RTN : 0);
+	return ((valueAt(index) < surfacevalue) ? LBF : 0)
+	    + ((valueAt(index + 1) < surfacevalue) ? RBF : 0)
+	    + ((valueAt(index + w_1) < surfacevalue) ? LTF : 0)
+	    + ((valueAt(index + 1 + w_1) < surfacevalue) ? RTF : 0)
+	    + ((valueAt(index + w_1xh_1) < surfacevalue) ? LBN : 0)
+	    + ((valueAt(index + 1 + w_1xh_1) < surfacevalue) ? RBN : 0)
+	    + ((valueAt(index + w_1 + w_1xh_1) < surfacevalue) ? LTN : 0)
+	    + ((valueAt(index + 1 + w_1 + w_1xh_1) < surfacevalue) ? RTN : 0);
+}
+
+bool
+impCubeVolume::inSlab(slab& s, unsigned int index, unsigned int z)
+{
+	if (z < s.kmin)
+	{
+		if (cubeFrameAt(index) != frame)
+			slabs[s.number - 1].fromAbove.push_back(index);
+		return false;
+	}
+	if (z >= s.kmax)
+	{
+		if (cubeFrameAt(index) != frame)
+			slabs[s.number + 1].fromBelow.push_back(index);
+		return false;
+	}
+	return true;
 }
 
+// Crawl the surface starting at this cube.  Instead of recursing into each
+// adjacent cube, cubes are queued on the slab's frontier and visited in FIFO
+// order, so stack use does not grow with the size of the surface.
 void
-impCubeVolume::crawl_nosort(unsigned int x, unsigned int y, unsigned int z)
+impCubeVolume::crawl(slab& s, unsigned int x, unsigned int y, unsigned int z, bool sort)
 {
-	// quit if this cube has been done
-	const unsigned int ci(cubeindex(x, y, z));
-	cubedata& cube(cubes[ci]);
-	if (cube.cube_frame == frame)
-		return;
+	enqueue(s, x, y, z);
+
+	for (unsigned int f = 0; f < s.frontier.size(); ++f)
+	{
+		const unsigned int ci(s.frontier[f]);
+		unsigned int i, j, k;
+		cubecoords(ci, i, j, k);
+
+		findcornervalues(i, j, k);
+		const unsigned int mask(calculateCornerMask(i, j, k));
+
+		// add this cube to list of crawled cubes, or to list
+		// of cubes to be sorted later
+		if (sort)
+			s.sortableCubes.push_back(sortableCube(ci));
+		else
+			s.cubeIndices.push_back(ci);
+
+		// save index for polygonizing
+		cubeMaskAt(ci) = mask;
+
+		// crawl to adjacent cubes
+		if (crawlDirections[mask][0] && i > 0)
+			enqueue(s, i - 1, j, k);
+		if (crawlDirections[mask][1] && i < w - 1)
+			enqueue(s, i + 1, j, k);
+		if (crawlDirections[mask][2] && j > 0)
+			enqueue(s, i, j - 1, k);
+		if (crawlDirections[mask][3] && j < h - 1)
+			enqueue(s, i, j + 1, k);
+		if (crawlDirections[mask][4] && k > 0)
+			enqueue(s, i, j, k - 1);
+		if (crawlDirections[mask][5] && k < l - 1)
+			enqueue(s, i, j, k + 1);
+	}
 
-	findcornervalues(x, y, z);
-	const unsigned int mask(calculateCornerMask(x, y, z));
-
-	// add this cube to list of crawled cubes, resizing vector if necessary
-	const size_t tslsize(cubeIndices.size());
-	if (currentCubeIndex == tslsize)
-		cubeIndices.resize(tslsize + 1000);
-
-	cubeIndices[currentCubeIndex++] = ci;
-
-	// save index for polygonizing
-	cube.mask = mask;
-
-	// mark this cube as completed
-	cube.cube_frame = frame;
-
-	// crawl to adjacent cubes
-	if (crawlDirections[mask][0] && x > 0)
-		crawl_nosort(x - 1, y, z);
-	if (crawlDirections[mask][1] && x < w - 1)
-		crawl_nosort(x + 1, y, z);
-	if (crawlDirections[mask][2] && y > 0)
-		crawl_nosort(x, y - 1, z);
-	if (crawlDirections[mask][3] && y < h - 1)
-		crawl_nosort(x, y + 1, z);
-	if (crawlDirections[mask][4] && z > 0)
-		crawl_nosort(x, y, z - 1);
-	if (crawlDirections[mask][5] && z < l - 1)
-		crawl_nosort(x, y, z + 1);
+	s.frontier.clear();
 }
 
 void
-impCubeVolume::crawl_sort(unsigned int x, unsigned int y, unsigned int z)
+impCubeVolume::enqueue(slab& s, unsigned int x, unsigned int y, unsigned int z)
 {
-	// quit if this cube has been done
+	// quit if this cube belongs to another slab or has been queued already
 	const unsigned int ci(cubeindex(x, y, z));
-	cubedata& cube(cubes[ci]);
-	if (cube.cube_frame == frame)
+	if (!inSlab(s, ci, z))
+		return;
+	if (cubeFrameAt(ci) == frame)
 		return;
 
-	findcornervalues(x, y, z);
-	const int mask(calculateCornerMask(x, y, z));
-
-	// add cube to list
-	sortableCubes.push_back(sortableCube(ci));
-
-	// save index for polygonizing
-	cube.mask = mask;
-
-	// mark this cube as completed
-	cube.cube_frame = frame;
-
-	// crawl to adjacent cubes
-	if (crawlDirections[mask][0] && x > 0)
-		crawl_sort(x - 1, y, z);
-	if (crawlDirections[mask][1] && x < w - 1)
-		crawl_sort(x + 1, y, z);
-	if (crawlDirections[mask][2] && y > 0)
-		crawl_sort(x, y - 1, z);
-	if (crawlDirections[mask][3] && y < h - 1)
-		crawl_sort(x, y + 1, z);
-	if (crawlDirections[mask][4] && z > 0)
-		crawl_sort(x, y, z - 1);
-	if (crawlDirections[mask][5] && z < l - 1)
-		crawl_sort(x, y, z + 1);
+	// mark this cube as completed so it is queued only once
+	cubeFrameAt(ci) = frame;
+	s.frontier.push_back(ci);
 }
 
 // polygonize an individual cube
+template <class target>
 void
-impCubeVolume::polygonize(unsigned int index)
+impCubeVolume::polygonize(target& t, unsigned int index)
 {
 	// find index into cubetable
-	const unsigned int mask(cubes[index].mask);
+	const unsigned int mask(cubeMaskAt(index));
 
 	unsigned int counter = 0;
 	unsigned int nedges = triStripPatterns[mask][counter];
@@ -736,7 +1256,7 @@ impCubeVolume::polygonize(unsigned int index)
 	while (nedges != 0)
 	{
 #if USE_TRIANGLE_STRIPS
-		surface->addTriStripLength(nedges);
+		t.surface->addTriStripLength(nedges);
 		for (unsigned int i = 1; i <= nedges; ++i)
 		{
 			switch (triStripPatterns[mask][counter + i])
@@ -756,40 +1276,40 @@ impCubeVolume::polygonize(unsigned int index)
 #endif
 				// generate vertex position and normal data
 				case 0:
-					addVertexToSurface(2, index);
+					addVertexToSurface(t, 2, index);
 					break;
 				case 1:
-					addVertexToSurface(1, index);
+					addVertexToSurface(t, 1, index);
 					break;
 				case 2:
-					addVertexToSurface(1, index + w_1xh_1);
+					addVertexToSurface(t, 1, index + w_1xh_1);
 					break;
 				case 3:
-					addVertexToSurface(2, index + w_1);
+					addVertexToSurface(t, 2, index + w_1);
 					break;
 				case 4:
-					addVertexToSurface(0, index);
+					addVertexToSurface(t, 0, index);
 					break;
 				case 5:
-					addVertexToSurface(0, index + w_1xh_1);
+					addVertexToSurface(t, 0, index + w_1xh_1);
 					break;
 				case 6:
-					addVertexToSurface(0, index + w_1);
+					addVertexToSurface(t, 0, index + w_1);
 					break;
 				case 7:
-					addVertexToSurface(0, index + w_1 + w_1xh_1);
+					addVertexToSurface(t, 0, index + w_1 + w_1xh_1);
 					break;
 				case 8:
-					addVertexToSurface(2, index + 1);
+					addVertexToSurface(t, 2, index + 1);
 					break;
 				case 9:
-					addVertexToSurface(1, index + 1);
+					addVertexToSurface(t, 1, index + 1);
 					break;
 				case 10:
-					addVertexToSurface(1, index + 1 + w_1xh_1);
+					addVertexToSurface(t, 1, index + 1 + w_1xh_1);
 					break;
 				case 11:
-					addVertexToSurface(2, index + 1 + w_1);
+					addVertexToSurface(t, 2, index + 1 + w_1);
 					break;
 			}
 #if USE_TRIANGLE_STRIPS
@@ -802,81 +1322,66 @@ impCubeVolume::polygonize(unsigned int index)
 	}
 }
 
-// find value at all corners of this cube
-void
-impCubeVolume::findcornervalues(unsigned int x, unsigned int y, unsigned int z)
+float
+impCubeVolume::evaluate(float x, float y, float z)
 {
+	if (function)
 	{
-		cubedata& cube(cubes[cubeindex(x, y, z)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
-	}
-
-	{
-		cubedata& cube(cubes[cubeindex(x + 1, y, z)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
-	}
-
-	{
-		cubedata& cube(cubes[cubeindex(x, y + 1, z)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
+		float position[3] = {x, y, z};
+		return function(base, position);
 	}
 
-	{
-		cubedata& cube(cubes[cubeindex(x + 1, y + 1, z)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
-	}
+	float value;
+	batchfunction(base, &x, &y, &z, &value, 1);
+	return value;
+}
 
+// find value at all corners of this cube
+void
+impCubeVolume::findcornervalues(unsigned int x, unsigned int y, unsigned int z)
+{
+	// gather the corners that have not been computed yet and evaluate them together
+	unsigned int todo[8];
+	float xs[8], ys[8], zs[8], values[8];
+	unsigned int n(0);
+	for (unsigned int c = 0; c < 8; ++c)
 	{
-		cubedata& cube(cubes[cubeindex(x, y, z + 1)]);
-		if (cube.corner_frame != frame)
+		const unsigned int i(x + (c & 1));
+		const unsigned int j(y + ((c >> 1) & 1));
+		const unsigned int k(z + (c >> 2));
+		const unsigned int index(cubeindex(i, j, k));
+		if (cornerFrameAt(index) != frame)
 		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
+			todo[n] = index;
+			xs[n] = cornerX[i];
+			ys[n] = cornerY[j];
+			zs[n] = cornerZ[k];
+			++n;
 		}
 	}
+	if (n == 0)
+		return;
 
+	evaluate(xs, ys, zs, values, n);
+	for (unsigned int c = 0; c < n; ++c)
 	{
-		cubedata& cube(cubes[cubeindex(x + 1, y, z + 1)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
+		cornerFrameAt(todo[c]) = frame;
+		valueAt(todo[c]) = values[c];
 	}
+}
 
+float
+impCubeVolume::cornervalue(unsigned int index)
+{
+	if (cornerFrameAt(index) != frame)
 	{
-		cubedata& cube(cubes[cubeindex(x, y + 1, z + 1)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
+		unsigned int i, j, k;
+		cubecoords(index, i, j, k);
+		cornerFrameAt(index) = frame;
+		valueAt(index) = evaluate(cornerX[i], cornerY[j], cornerZ[k]);
 	}
 
-	{
-		cubedata& cube(cubes[cubeindex(x + 1, y + 1, z + 1)]);
-		if (cube.corner_frame != frame)
-		{
-			cube.corner_frame = frame;
-			cube.value = function(base, &(cube.x));
-		}
-	}
+	return valueAt(index);
 }
 
 float
@@ -887,24 +1392,13 @@ impCubeVolume::getXPlus1Value(unsigned int index)
 	// compute new value if index is at the edge of the volume
 	if ((indexPlus1 % w_1) == 0)
 	{
-		float* pos = &(cubes[index].x);
-		pos[0] += cubewidth;
-		const float value(function(base, pos));
-		pos[0] -= cubewidth;
-
-		return value;
+		unsigned int i, j, k;
+		cubecoords(index, i, j, k);
+		return evaluate(cornerX[i] + cubewidth, cornerY[j], cornerZ[k]);
 	}
 
-	// return already computed value
-	cubedata& cube(cubes[indexPlus1]);
-	if (cube.corner_frame == frame)
-		return cube.value;
-
-	// compute new value
-	cube.corner_frame = frame;
-	cube.value = function(base, &(cube.x));
-
-	return cube.value;
+	// return already computed value or compute new value
+	return cornervalue(indexPlus1);
 }
 
 float
@@ -915,24 +1409,13 @@ impCubeVolume::getYPlus1Value(unsigned int index)
 	// compute new value if index is at the edge of the volume
 	if (indexPlus1 % w_1xh_1 < w_1)
 	{
-		float* pos = &(cubes[index].x);
-		pos[1] += cubewidth;
-		const float value(function(base, pos));
-		pos[1] -= cubewidth;
-
-		return value;
+		unsigned int i, j, k;
+		cubecoords(index, i, j, k);
+		return evaluate(cornerX[i], cornerY[j] + cubewidth, cornerZ[k]);
 	}
 
-	// return already computed value
-	cubedata& cube(cubes[indexPlus1]);
-	if (cube.corner_frame == frame)
-		return cube.value;
-
-	// compute new value
-	cube.corner_frame = frame;
-	cube.value = function(base, &(cube.x));
-
-	return cube.value;
+	// return already computed value or compute new value
+	return cornervalue(indexPlus1);
 }
 
 float
@@ -943,143 +1426,122 @@ impCubeVolume::getZPlus1Value(unsigned int index)
 	// compute new value if index is at the edge of the volume
 	if (indexPlus1 >= w_1xh_1xl_1)
 	{
-		float* pos = &(cubes[index].x);
-		pos[2] += cubewidth;
-		const float value(function(base, pos));
-		pos[2] -= cubewidth;
+		unsigned int i, j, k;
+		cubecoords(index, i, j, k);
+		return evaluate(cornerX[i], cornerY[j], cornerZ[k] + cubewidth);
+	}
+
+	// return already computed value or compute new value
+	return cornervalue(indexPlus1);
+}
 
-		return value;
+void
+impCubeVolume::addVertexToSurface(slab& s, const unsigned int& axis, const unsigned int& index)
+{
+	if (edgeFrameAt(axis, index) == frame)
+	{
+		// Position and normal have already been computed for this edge.
+		s.surface->addIndex(edgeIndexAt(axis, index));
+		return;
 	}
 
-	// return already computed value
-	cubedata& cube(cubes[indexPlus1]);
-	if (cube.corner_frame == frame)
-		return cube.value;
+	edgeFrameAt(axis, index) = frame;
+	edgeIndexAt(axis, index) = (s.number << IMP_SLAB_SHIFT) | s.currentVertexIndex++;
+	s.surface->addIndex(edgeIndexAt(axis, index));
 
-	// compute new value
-	cube.corner_frame = frame;
-	cube.value = function(base, &(cube.x));
+	float data[6];
+	computeVertex(axis, index, data);
+	s.surface->addVertex(data);
+}
 
-	return cube.value;
+void
+impCubeVolume::addVertexToSurface(brickwork& b, const unsigned int& axis, const unsigned int& index)
+{
+	unsigned int i, j, k;
+	cubecoords(index, i, j, k);
+	unsigned int& vertex(b.edgeVertexIndices[axis][(((k - b.kmin) * (IMP_BRICK_SIZE + 1)) + (j - b.jmin)) * (IMP_BRICK_SIZE + 1) + (i - b.imin)]);
+	if (vertex == ~0u)
+	{
+		vertex = b.currentVertexIndex++;
+		float data[6];
+		computeVertex(axis, index, data);
+		b.surface->addVertex(data);
+	}
+	b.surface->addIndex(vertex);
 }
 
-// Here we compute a vertex position and normal and add it to the surface.
+// Here we compute a vertex position and normal.
 // If fastnormal is true, we use the difference between existing corner values as much as possible,
 // only computing new values when necessary.  Many different combinations and blends of value
 // differences were tried out.  The final algorithm used here is not only the simplest possible, but
 // also the best looking.  Using more data to compute the normals always made the normals look worse.
 void
-impCubeVolume::addVertexToSurface(const unsigned int& axis, const unsigned int& index)
+impCubeVolume::computeVertex(const unsigned int& axis, const unsigned int& index, float* data)
 {
-	float data[6];
+	unsigned int i, j, k;
+	cubecoords(index, i, j, k);
+	const float& val(valueAt(index));
+
+	data[3] = cornerX[i];
+	data[4] = cornerY[j];
+	data[5] = cornerZ[k];
 
 	// find position of vertex along this edge
 	switch (axis)
 	{
 		case 0:    // x-axis
 		{
-			if (cubes[index].x_vertex_frame == frame)
-			{
-				// Position and normal have already been computed for this edge.
-				surface->addIndex(cubes[index].x_vertex_index);
-				return;
-			}
-
-			cubes[index].x_vertex_frame = frame;
-			surface->addIndex(currentVertexIndex);
-			cubes[index].x_vertex_index = currentVertexIndex;
-			currentVertexIndex++;
-
 			// compute vertex position
-			const float t((surfacevalue - cubes[index].value) / (cubes[index + 1].value - cubes[index].value));
-			data[3] = cubes[index].x + (cubewidth * t);
-			data[4] = cubes[index].y;
-			data[5] = cubes[index].z;
+			const float& valp1(valueAt(index + 1));
+			const float t((surfacevalue - val) / (valp1 - val));
+			data[3] += cubewidth * t;
 
 			if (fastnormals)
 			{
 				// compute normal
 				const float one_minus_t(1.0f - t);
-				const float& val(cubes[index].value);
-				const float& valp1(cubes[index + 1].value);
 				data[0] = one_minus_t* (val - valp1) + t * (valp1 - getXPlus1Value(index + 1));
 				data[1] = one_minus_t* (val - getYPlus1Value(index)) + t * (valp1 - getYPlus1Value(index + 1));
 				data[2] = one_minus_t* (val - getZPlus1Value(index)) + t * (valp1 - getZPlus1Value(index + 1));
 				// For speed, do not normalize; use GL_NORMALIZE instead
-				// Add this vertex to surface
-				surface->addVertex(data);
 				return;
 			}
 			break;
 		}
 		case 1:    // y-axis
 		{
-			if (cubes[index].y_vertex_frame == frame)
-			{
-				// Position and normal have already been computed for this edge.
-				surface->addIndex(cubes[index].y_vertex_index);
-				return;
-			}
-			cubes[index].y_vertex_frame = frame;
-			surface->addIndex(currentVertexIndex);
-			cubes[index].y_vertex_index = currentVertexIndex;
-			currentVertexIndex++;
-
 			// compute vertex position
-			const float t((surfacevalue - cubes[index].value) / (cubes[index + w_1].value - cubes[index].value));
-			data[3] = cubes[index].x;
-			data[4] = cubes[index].y + (cubewidth * t);
-			data[5] = cubes[index].z;
+			const float& valp1(valueAt(index + w_1));
+			const float t((surfacevalue - val) / (valp1 - val));
+			data[4] += cubewidth * t;
 
 			if (fastnormals)
 			{
 				// compute normal
 				const float one_minus_t(1.0f - t);
-				const float& val(cubes[index].value);
-				const float& valp1(cubes[index + w_1].value);
 				data[0] = one_minus_t* (val - getXPlus1Value(index)) + t * (valp1 - getXPlus1Value(index + w_1));
 				data[1] = one_minus_t* (val - valp1) + t * (valp1 - getYPlus1Value(index + w_1));
 				data[2] = one_minus_t* (val - getZPlus1Value(index)) + t * (valp1 - getZPlus1Value(index + w_1));
 				// For speed, do not normalize; use GL_NORMALIZE instead
-				// Add this vertex to surface
-				surface->addVertex(data);
 				return;
 			}
 			break;
 		}
 		case 2:    // z-axis
 		{
-			if (cubes[index].z_vertex_frame == frame)
-			{
-				// Position and normal have already been computed for this edge.
-				surface->addIndex(cubes[index].z_vertex_index);
-				return;
-			}
-
-			cubes[index].z_vertex_frame = frame;
-			surface->addIndex(currentVertexIndex);
-			cubes[index].z_vertex_index = currentVertexIndex;
-			currentVertexIndex++;
-
 			// compute vertex position
-			const float t((surfacevalue - cubes[index].value) / (cubes[index + w_1xh_1].value - cubes[index].value));
-			data[3] = cubes[index].x;
-			data[4] = cubes[index].y;
-			data[5] = cubes[index].z + (cubewidth * t);
+			const float& valp1(valueAt(index + w_1xh_1));
+			const float t((surfacevalue - val) / (valp1 - val));
+			data[5] += cubewidth * t;
 
 			if (fastnormals)
 			{
 				// compute normal
 				const float one_minus_t(1.0f - t);
-				const float& val(cubes[index].value);
-				const float& valp1(cubes[index + w_1xh_1].value);
 				data[0] = one_minus_t* (val - getXPlus1Value(index)) + t * (valp1 - getXPlus1Value(index + w_1xh_1));
 				data[1] = one_minus_t* (val - getYPlus1Value(index)) + t * (valp1 - getYPlus1Value(index + w_1xh_1));
 				data[2] = one_minus_t* (val - valp1) + t * (valp1 - getZPlus1Value(index + w_1xh_1));
-
 				// For speed, do not normalize; use GL_NORMALIZE instead
-				// Add this vertex to surface
-				surface->addVertex(data);
 				return;
 			}
 			break;
@@ -1089,23 +1551,19 @@ impCubeVolume::addVertexToSurface(const unsigned int& axis, const unsigned int&
 	// Slow but accurate normals.
 	// These will be computed if fast normals were not computed above.
 	// Find normal vector at vertex along this edge
-	// First find normal vector origin value
-	float* pos = &(data[3]);
+	// First find normal vector origin value, then values at slight
+	// displacements, all in one batch
+	const float* pos = &(data[3]);
 	const float offset(cubewidth * 0.1f);
-	const float val(function(base, pos));
-
-	// then find values at slight displacements and subtract
-	pos[0] -= offset;
-	data[0] = function(base, pos) - val;
-	pos[0] += offset;
-	pos[1] -= offset;
-	data[1] = function(base, pos) - val;
-	pos[1] += offset;
-	pos[2] -= offset;
-	data[2] = function(base, pos) - val;
-	pos[2] += offset;
+	const float xs[4] = {pos[0], pos[0] - offset, pos[0], pos[0]};
+	const float ys[4] = {pos[1], pos[1], pos[1] - offset, pos[1]};
+	const float zs[4] = {pos[2], pos[2], pos[2], pos[2] - offset};
+	float values[4];
+	evaluate(xs, ys, zs, values, 4);
+
+	// subtract
+	data[0] = values[1] - values[0];
+	data[1] = values[2] - values[0];
+	data[2] = values[3] - values[0];
 	// For speed, do not normalize; use GL_NORMALIZE instead
-
-	// Add this vertex to surface
-	surface->addVertex(data);
 }
@@ -24,38 +24,17 @@
 
 #include <math.h>
 
+#include <atomic>
+#include <functional>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "impSurface.h"
 #include "impCubeTables.h"
 #include "impCrawlPoint.h"
-
-
-struct cubedata
-{
-	// corner mask which describes how cube is polygonized
-	unsigned int mask;
-	// position left-lower-far corner (-x, -y, -z)
-	float x;
-	float y;
-	float z;
-#ifdef __SSE__
-	float w;  // must have a 1.0f here for SSE dot product computations
-#endif
-	// field value at this corner
-	float value;
-	// edge vertex indices for surfaces
-	unsigned int x_vertex_index;
-	unsigned int y_vertex_index;
-	unsigned int z_vertex_index;
-	// done flags
-	unsigned short cube_frame;
-	unsigned short corner_frame;
-	unsigned short x_vertex_frame;
-	unsigned short y_vertex_frame;
-	unsigned short z_vertex_frame;
-};
+#include "impShape.h"
 
 
 // For making a list of cubes to be polygonized.
@@ -93,13 +72,113 @@ public:
 };
 
 
+// Vertex indices stored while polygonizing carry the number of the slab that
+// created the vertex in their upper bits.  They are rebased when the slabs'
+// surface fragments are merged.
+#define IMP_SLAB_SHIFT 24
+#define IMP_SLAB_LOCAL_MASK ((1u << IMP_SLAB_SHIFT) - 1)
+#define IMP_MAX_SLABS 256
+// Adjacent slabs are never processed at the same time, but a slab still
+// reaches two corner layers past its own top, so slabs need at least two cube
+// layers.  A few more keep the hand-overs between slabs cheap.
+#define IMP_MIN_SLAB_THICKNESS 4
+
+// Cubes along each side of the bricks that keep their geometry from frame to
+// frame when the volume is given the shapes making up its field.
+#define IMP_BRICK_SIZE 8
+#define IMP_BRICK_CORNERS ((IMP_BRICK_SIZE + 1) * (IMP_BRICK_SIZE + 1) * (IMP_BRICK_SIZE + 1))
+
+// Corner data is stored in pages of IMP_PAGE_SIZE corners that follow each
+// other in cubeindex() order.  Pages are handed out IMP_PAGE_CHUNK at a time.
+#define IMP_PAGE_SHIFT 4
+#define IMP_PAGE_SIZE (1u << IMP_PAGE_SHIFT)
+#define IMP_PAGE_MASK (IMP_PAGE_SIZE - 1)
+#define IMP_PAGE_CHUNK 256
+
+
 class impCubeVolume
 {
 public:
     void* base = nullptr;
-	float (*function)(void* base, float* position);
+	// Must be safe to call from several threads at once
+	float (*function)(void* base, float* position) = nullptr;
+	// Optional.  Stores the field values at "n" positions in "values".  When
+	// set, corners are evaluated a row at a time with this instead of with
+	// "function", so shapes can use impShape::addValues().  Must also be safe
+	// to call from several threads at once.
+	void (*batchfunction)(void* base, const float* xs, const float* ys, const float* zs, float* values, unsigned int n) = nullptr;
 
 private:
+	// The volume is split into slabs of cube layers along the z-axis.  Each slab
+	// is crawled and polygonized by one thread into its own surface fragment.
+	// Even and odd slabs take turns, so no two threads ever touch the same
+	// corners or edges.
+	struct slab
+	{
+		unsigned int number;
+		unsigned int kmin, kmax;  // cube layers [kmin, kmax) belong to this slab
+		impSurface fragment;
+		impSurface* surface;  // either &fragment or the volume's surface
+		unsigned int currentVertexIndex;
+		std::vector<unsigned int> crawlStarts;  // crawl points that start in this slab
+		std::vector<unsigned int> frontier;  // cubes queued by the current crawl
+		std::vector<unsigned int> cubeIndices;  // cubes crawled during this frame
+		unsigned int numPolygonized;  // how many of cubeIndices are polygonized
+		std::vector<unsigned int> fromBelow;  // cubes handed over by the slab below
+		std::vector<unsigned int> fromAbove;  // cubes handed over by the slab above
+		std::list<sortableCube> sortableCubes;
+		// scratch space for evaluating a row of corners
+		std::vector<float> rowy, rowz, rowvalues;
+	};
+
+	// Data for a run of corners (and the cubes and edges starting at them).
+	// Each kind of data is kept in its own array so that sweeps over one kind
+	// do not drag the others through the cache.
+	struct page
+	{
+		float cornerValues[IMP_PAGE_SIZE];  // field value at each corner
+		unsigned char cubeMasks[IMP_PAGE_SIZE];  // corner mask which describes how cube is polygonized
+		unsigned int edgeVertexIndices[3][IMP_PAGE_SIZE];  // surface vertex on x-, y-, and z-edges
+		// done flags
+		unsigned char cubeFrames[IMP_PAGE_SIZE];
+		unsigned char cornerFrames[IMP_PAGE_SIZE];
+		unsigned char edgeVertexFrames[3][IMP_PAGE_SIZE];
+	};
+
+	// When the shapes making up the field are known, the volume is also split
+	// into bricks of IMP_BRICK_SIZE^3 cubes.  A brick's corner values and
+	// triangles are kept from frame to frame and only computed again when a
+	// shape overlapping the brick has moved.
+	struct brick
+	{
+		unsigned int imin, jmin, kmin;  // first cube in this brick
+		unsigned int imax, jmax, kmax;  // one past the last cube in this brick
+		bool dirty;  // corner values have to be evaluated again
+		impSurface mesh;  // triangles of this brick's cubes with their own vertices
+		// Shapes whose bounds contain corners of this brick.  Only these are
+		// summed when the brick's corners are evaluated.  Kept up to date for
+		// dirty bricks.
+		std::vector<impShape*> shapes;
+	};
+	// A shape as it was when the bricks it overlaps were last computed
+	struct shapestate
+	{
+		const impShape* shape;
+		float mat[16];
+		float thickness;
+		float min[3], max[3];  // bounds from impShape::getBounds()
+	};
+	// Scratch space for polygonizing one brick.  Vertices on the brick's
+	// edges are looked up here instead of in edgeVertexIndices, so that bricks
+	// can be polygonized at the same time.
+	struct brickwork
+	{
+		impSurface* surface;
+		unsigned int imin, jmin, kmin;
+		unsigned int currentVertexIndex;
+		unsigned int edgeVertexIndices[3][IMP_BRICK_CORNERS];
+	};
+
 	float lbf[3];  // left-bottom-far corner of volume
 	float cubewidth;
 	unsigned int w, h, l, w_1, h_1, l_1, w_1xh_1, w_1xh_1xl_1;
@@ -107,14 +186,43 @@ private:
 	bool crawlDirections[256][6];
 	// Frame number to mark corners, edges, and cubes so we know if they
 	// have been computed during the current frame.
-	unsigned short frame;
-	unsigned int currentVertexIndex;
-	std::vector<cubedata> cubes;
-	std::vector<unsigned int> cubeIndices;
+	unsigned char frame;
+	// Corner positions are not stored; they are looked up per axis in cornerX,
+	// cornerY, and cornerZ.
+	std::vector<float> cornerX, cornerY, cornerZ;
+	// Page holding each run of IMP_PAGE_SIZE corners, or nullptr if that run
+	// has not been touched yet.  With sparse storage, pages are given back at
+	// the start of every frame and handed out again as the crawl reaches them,
+	// so memory grows with the size of the surface instead of the volume.
+	std::unique_ptr<std::atomic<page*>[]> pageTable;
+	unsigned int numPages;
+	std::vector<std::unique_ptr<page[]>> pageChunks;
+	unsigned int pagesUsed;  // pages handed out from pageChunks
+	std::mutex pageMutex;
+	bool sparse;
+	std::vector<slab> slabs;
+	std::vector<unsigned int> rebasedIndices;  // scratch space for mergeSlabs()
 	std::list<sortableCube> sortableCubes;
-	unsigned int currentCubeIndex;
+	unsigned int bw, bh, bl;  // number of bricks along each axis
+	std::vector<brick> bricks;
+	std::vector<unsigned int> brickList;  // scratch space for listing bricks
+	std::vector<impShape*> shapes;
+	std::vector<shapestate> shapestates;
+	std::vector<float> shapebounds;  // current min and max of each shape, 6 floats per shape
+	float shapetolerance;
+	float shapecutoff;
+	// False when no brick can be trusted, e.g. after a frame without bricks.
+	// The field functions and settings the bricks were computed with are
+	// remembered so that changing any of them also starts over.
+	bool bricksvalid;
+	void* brickbase;
+	float (*brickfunction)(void* base, float* position);
+	void (*brickbatchfunction)(void* base, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+	float bricksurfacevalue;
+	bool brickfastnormals;
 	bool fastnormals;
 	bool crawlfromsides;
+	bool usethreads;
 	float surfacevalue;  // surface's position on gradient
 	impSurface* surface;
 
@@ -126,11 +234,40 @@ public:
 	void init(unsigned int width, unsigned int height, unsigned int length, float cw);
 	void useFastNormals(bool val) { fastnormals = val; }
 	void setCrawlFromSides(bool val) { crawlfromsides = val; }
+	// Split the work across rsWorkerPool::shared().  On by default.
+	void useThreads(bool val);
+	// Only store data for corners that are reached while crawling, instead of
+	// for the whole volume.  This saves a lot of memory at high resolutions.
+	// Sweeps over every cube and temporal coherence still touch every corner.
+	// Off by default.
+	void useSparseStorage(bool val);
+	// bytes currently used for corner data
+	size_t getStorageSize() const;
 	void setSurfaceValue(float sv) { surfacevalue = sv; }
 	float getSurfaceValue() { return surfacevalue; }
 	void setSurface(impSurface* s) { surface = s; }
 	impSurface* getSurface() { return surface; }
 
+	// Temporal coherence and culling.  If the field is just the sum of some
+	// shapes, pass them here whenever they change.  makeSurface() and
+	// makeSurface(cpv) will then only evaluate and polygonize the bricks
+	// overlapped by shapes that moved since the last frame, and reuse the
+	// triangles of the rest.  Corners are evaluated by summing only the shapes
+	// whose bounds reach their brick instead of calling function or
+	// batchfunction, which are still used for normals.  Crawl points are not
+	// needed in this mode.  Pass no shapes to go back to computing the whole
+	// surface every frame.
+	void setShapes(impShape* const* shapeList, unsigned int count);
+	// A shape has moved once any entry of its matrix, its thickness, or its
+	// bounds differs by more than "tolerance" from when its bricks were last
+	// computed.  Defaults to 0.
+	void setShapeTolerance(float tolerance) { shapetolerance = tolerance; }
+	// Shape bounds leave out contributions to the field below "cutoff".
+	// Larger cutoffs give smaller bounds, fewer bricks to recompute, and fewer
+	// shapes per brick, but leave more small errors in the field.  Defaults
+	// to 0.01.
+	void setShapeCutoff(float cutoff) { shapecutoff = cutoff; bricksvalid = false; }
+
 	// These routines compute geometry and store it in "surface"
 	// Providing an eyepoint indicates that you want to sort the surface
 	// so that transparent surfaces will be drawn back-to-front.
@@ -145,31 +282,121 @@ public:
 	void makeSurface(float eyex, float eyey, float eyez, impCrawlPointVector& cpv);
 
 private:
+	// advance frame number, clearing done flags when it wraps around
+	void nextFrame();
+	// nextFrame() for everything but makeBrickSurface()
+	void startFrame();
+	// drop all pages, then hand out every page again unless storage is sparse
+	void resetPages();
+	page* allocatePage(unsigned int n);
+	inline page& pageOf(unsigned int index)
+	{
+		page* p(pageTable[index >> IMP_PAGE_SHIFT].load(std::memory_order_acquire));
+		return p ? *p : *allocatePage(index >> IMP_PAGE_SHIFT);
+	}
+	// per-corner data, allocating the page holding it if necessary
+	inline float& valueAt(unsigned int index) { return pageOf(index).cornerValues[index & IMP_PAGE_MASK]; }
+	inline unsigned char& cubeMaskAt(unsigned int index) { return pageOf(index).cubeMasks[index & IMP_PAGE_MASK]; }
+	inline unsigned char& cubeFrameAt(unsigned int index) { return pageOf(index).cubeFrames[index & IMP_PAGE_MASK]; }
+	inline unsigned char& cornerFrameAt(unsigned int index) { return pageOf(index).cornerFrames[index & IMP_PAGE_MASK]; }
+	inline unsigned int& edgeIndexAt(unsigned int axis, unsigned int index) { return pageOf(index).edgeVertexIndices[axis][index & IMP_PAGE_MASK]; }
+	inline unsigned char& edgeFrameAt(unsigned int axis, unsigned int index) { return pageOf(index).edgeVertexFrames[axis][index & IMP_PAGE_MASK]; }
+	// store "count" values for the corners starting at "first" and mark them as computed
+	void storeValues(unsigned int first, const float* values, unsigned int count);
+	// (re)divide the volume into slabs
+	void makeSlabs();
+	// (re)divide the volume into bricks
+	void makeBricks();
+	// prepare slabs for a new frame
+	void resetSlabs();
+	// run func on every even slab, then on every odd slab
+	void forEachSlab(const std::function<void(slab& s)>& func);
+	bool slabsHaveHandovers();
+	// copy the slabs' surface fragments into surface and rebase their indices
+	void mergeSlabs();
+
+	// evaluate every corner in this slab's layers
+	void findslabvalues(slab& s);
+
+	// makeSurface() and makeSurface(cpv) when shapes are known
+	void makeBrickSurface();
+	// decide which bricks have to be evaluated again and list them in brickList
+	void findDirtyBricks();
+	bool shapeMoved(const shapestate& st, const impShape* shape, const float* min, const float* max);
+	void saveShapeState(shapestate& st, const impShape* shape, const float* min, const float* max);
+	// find the range of bricks holding corners inside a box, false if there are none
+	bool findBrickRange(const float* min, const float* max, unsigned int* bmin, unsigned int* bmax);
+	// mark the bricks containing corners inside this box as dirty
+	void dirtyBricks(const float* min, const float* max);
+	// list the shapes reaching each dirty brick
+	void listBrickShapes();
+	// run func on every brick in brickList
+	void forEachListedBrick(const std::function<void(brick& b)>& func);
+	// evaluate every corner belonging to this brick
+	void findbrickvalues(brick& b);
+	void polygonizeBrick(brick& b);
+	// copy the bricks' meshes into surface
+	void mergeBricks();
+	// give each crawl point to the slab that contains it
+	void assignCrawlPoints(impCrawlPointVector& cpv);
+	// walk from a crawl point to the surface and crawl from there
+	void crawlFromPoint(slab& s, int i, int j, int k, bool sort);
+	// start crawls from surface found on the sides of the volume
+	void crawlFromSlabSides(slab& s, bool sort);
+	// crawl from cubes handed over by neighboring slabs
+	void crawlHandovers(slab& s, bool sort);
+	// polygonize cubes crawled since the last call
+	void polygonizeCrawled(slab& s);
+	// polygonize sortableCubes in order
+	void polygonizeSorted();
+
 	// x, y, and z define position of cube in this volume
 	inline const unsigned int calculateCornerMask(const unsigned int& x, const unsigned int& y, const unsigned int& z);
 
-	// Crawl the cube starting at this location
-	inline void crawl_nosort(unsigned int x, unsigned int y, unsigned int z);
-	// Same as above, but store the cubes containing surface for sorting later
-	inline void crawl_sort(unsigned int x, unsigned int y, unsigned int z);
+	// Crawl the surface starting at this location.  If sort is true, store the
+	// cubes containing surface for sorting later.
+	void crawl(slab& s, unsigned int x, unsigned int y, unsigned int z, bool sort);
+	// add a cube to the frontier of cubes to be crawled
+	inline void enqueue(slab& s, unsigned int x, unsigned int y, unsigned int z);
+	// returns false and hands cube over to neighboring slab if z is outside of this slab
+	inline bool inSlab(slab& s, unsigned int index, unsigned int z);
+
+	// polygonize a cube into a slab's surface or a brick's mesh
+	template <class target>
+	inline void polygonize(target& t, unsigned int index);
 
-	inline void polygonize(unsigned int index);
+	// evaluate the field at "n" positions using batchfunction if there is one
+	void evaluate(const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+	inline float evaluate(float x, float y, float z);
 
 	inline void findcornervalues(unsigned int x, unsigned int y, unsigned int z);
+	// value at a corner, computed if it has not been computed yet during this frame
+	inline float cornervalue(unsigned int index);
 
 	// functions for retrieving values that may or may not have been computed already
 	inline float getXPlus1Value(unsigned int index);
 	inline float getYPlus1Value(unsigned int index);
 	inline float getZPlus1Value(unsigned int index);
 
-	// compute an actual vertex position and normal and add it to the surface
-	inline void addVertexToSurface(const unsigned int& axis, const unsigned int& index);
+	// add the vertex on an edge to the surface, computing it if necessary
+	inline void addVertexToSurface(slab& s, const unsigned int& axis, const unsigned int& index);
+	inline void addVertexToSurface(brickwork& b, const unsigned int& axis, const unsigned int& index);
+	// compute an actual vertex position and normal
+	inline void computeVertex(const unsigned int& axis, const unsigned int& index, float* data);
 
 	// utility function for converting 3D cube coordinates to a cube index
 	inline const unsigned int cubeindex(const unsigned int& i, const unsigned int& j, const unsigned int& k)
 	{
 		return (((k * h_1) + j) * w_1) + i;
 	}
+
+	// utility function for converting a cube index back to 3D cube coordinates
+	inline void cubecoords(const unsigned int& index, unsigned int& i, unsigned int& j, unsigned int& k)
+	{
+		i = index % w_1;
+		j = (index / w_1) % h_1;
+		k = index / w_1xh_1;
+	}
 };
 
 #endif
@@ -19,6 +19,7 @@
  */
 
 #include "impEllipsoid.h"
+#include "impSimd.h"
 
 float
 impEllipsoid::value(float* position)
@@ -33,3 +34,29 @@ impEllipsoid::value(float* position)
 
 	return thicknessSquared / (tx * tx + ty * ty + tz * tz + IMP_MIN_DIVISOR);
 }
+
+void
+impEllipsoid::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv ts(impSet1(thicknessSquared));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		impFloatv tx, ty, tz;
+		impTransform(invtrmat, impLoad(xs + i), impLoad(ys + i), impLoad(zs + i), tx, ty, tz);
+		const impFloatv v(impDiv(ts, impAdd(impAdd(impAdd(impMul(tx, tx), impMul(ty, ty)), impMul(tz, tz)), mindiv)));
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
+void
+impEllipsoid::getBounds(float cutoff, float* min, float* max)
+{
+	const float d(falloffDistance(thicknessSquared, cutoff));
+	const float size[3] = {d, d, d};
+	transformBounds(size, min, max);
+}
@@ -30,6 +30,8 @@ public:
 	~impEllipsoid() {};
 
 	virtual float value(float* position);
+	virtual void addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+	virtual void getBounds(float cutoff, float* min, float* max);
 };
 
 #endif
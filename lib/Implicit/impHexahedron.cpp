@@ -19,6 +19,7 @@
  */
 
 #include "impHexahedron.h"
+#include "impSimd.h"
 
 float
 impHexahedron::value(float* position)
@@ -40,3 +41,33 @@ impHexahedron::value(float* position)
 	else
 		return (yy < zz) ? yy : zz;
 }
+
+void
+impHexahedron::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv one(impSet1(1.0f));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		impFloatv tx, ty, tz;
+		impTransform(invtrmat, impLoad(xs + i), impLoad(ys + i), impLoad(zs + i), tx, ty, tz);
+		const impFloatv xx(impDiv(one, impAdd(impMul(tx, tx), mindiv)));
+		const impFloatv yy(impDiv(one, impAdd(impMul(ty, ty), mindiv)));
+		const impFloatv zz(impDiv(one, impAdd(impMul(tz, tz), mindiv)));
+		const impFloatv v(impMin(impMin(xx, yy), zz));
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
+void
+impHexahedron::getBounds(float cutoff, float* min, float* max)
+{
+	// value() is the smallest of the falloffs along the three axes
+	const float d(falloffDistance(1.0f, cutoff));
+	const float size[3] = {d, d, d};
+	transformBounds(size, min, max);
+}
@@ -19,6 +19,7 @@
  */
 
 #include "impKnot.h"
+#include "impSimd.h"
 
 #include <rsMath/rsMath.h>
 
@@ -48,6 +49,45 @@ impKnot::value(float* position)
 	return retval;
 }
 
+void
+impKnot::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv ts(impSet1(thicknessSquared));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	const impFloatv r1(impSet1(radius1));
+	const impFloatv r2(impSet1(radius2));
+	const impFloatv toc(impSet1(twistsOverCoils));
+	float lons[IMP_SIMD_WIDTH], coss[IMP_SIMD_WIDTH], sins[IMP_SIMD_WIDTH];
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		impFloatv tx, ty, tz;
+		impTransform(invtrmat, impLoad(xs + i), impLoad(ys + i), impLoad(zs + i), tx, ty, tz);
+		const impFloatv temp(impSub(impSqrt(impAdd(impMul(tx, tx), impMul(ty, ty))), r1));
+		const impFloatv lat(impMul(impRsAtan2(ty, tx), toc));
+		impFloatv v(impSet1(0.0f));
+
+		for (int c = 0; c < coils; ++c)
+		{
+			// rsCosf() and rsSinf() are table lookups, so they are done one lane at a time.
+			impStore(lons, impAdd(lat, impSet1(lat_offset * float(c))));
+			for (unsigned int j = 0; j < IMP_SIMD_WIDTH; ++j)
+			{
+				coss[j] = rsCosf(lons[j]);
+				sins[j] = rsSinf(lons[j]);
+			}
+			const impFloatv hor(impSub(temp, impMul(impLoad(coss), r2)));
+			const impFloatv ver(impSub(tz, impMul(impLoad(sins), r2)));
+			v = impAdd(v, impDiv(ts, impAdd(impAdd(impMul(hor, hor), impMul(ver, ver)), mindiv)));
+		}
+
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
 // Finding a point inside a knot is trickier than
 // finding a point inside a sphere or ellipsoid.
 void
@@ -71,3 +111,13 @@ impKnot::addCrawlPoint(impCrawlPointVector& cpv)
 		        mat[2] * x + mat[10] * z + mat[14]));
 	}
 }
+
+void
+impKnot::getBounds(float cutoff, float* min, float* max)
+{
+	// Wherever the sum over all coils reaches the cutoff, at least one coil
+	// reaches cutoff / coils.
+	const float d(falloffDistance(thicknessSquared * coilsf, cutoff));
+	const float size[3] = {radius1 + radius2 + d, radius1 + radius2 + d, radius2 + d};
+	transformBounds(size, min, max);
+}
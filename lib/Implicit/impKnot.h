@@ -72,6 +72,8 @@ public:
 	int getNumTwists() { return twists; }
 
 	virtual float value(float* position);
+	virtual void addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+	virtual void getBounds(float cutoff, float* min, float* max);
 	virtual void center(float* position);
 	virtual void addCrawlPoint(impCrawlPointVector& cpv);
 };
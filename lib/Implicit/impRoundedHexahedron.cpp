@@ -19,6 +19,7 @@
  */
 
 #include "impRoundedHexahedron.h"
+#include "impSimd.h"
 
 float
 impRoundedHexahedron::value(float* position)
@@ -49,3 +50,39 @@ impRoundedHexahedron::value(float* position)
 
 	return thicknessSquared / (sx * sx + sy * sy + sz * sz + IMP_MIN_DIVISOR);
 }
+
+void
+impRoundedHexahedron::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv ts(impSet1(thicknessSquared));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	const impFloatv w(impSet1(width));
+	const impFloatv h(impSet1(height));
+	const impFloatv l(impSet1(length));
+	const impFloatv zero(impSet1(0.0f));
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		impFloatv tx, ty, tz;
+		impTransform(invtrmat, impLoad(xs + i), impLoad(ys + i), impLoad(zs + i), tx, ty, tz);
+		const impFloatv xx(impSub(impAbs(tx), w));
+		const impFloatv yy(impSub(impAbs(ty), h));
+		const impFloatv zz(impSub(impAbs(tz), l));
+		const impFloatv sx(impAnd(impLess(zero, xx), xx));
+		const impFloatv sy(impAnd(impLess(zero, yy), yy));
+		const impFloatv sz(impAnd(impLess(zero, zz), zz));
+		const impFloatv v(impDiv(ts, impAdd(impAdd(impAdd(impMul(sx, sx), impMul(sy, sy)), impMul(sz, sz)), mindiv)));
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
+void
+impRoundedHexahedron::getBounds(float cutoff, float* min, float* max)
+{
+	const float d(falloffDistance(thicknessSquared, cutoff));
+	const float size[3] = {width + d, height + d, length + d};
+	transformBounds(size, min, max);
+}
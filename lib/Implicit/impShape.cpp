@@ -20,6 +20,7 @@
 
 #include "impShape.h"
 
+#include <float.h>
 #include <string.h>
 
 impShape::impShape()
@@ -158,6 +159,46 @@ impShape::value(float* position)
 	return 0.0f;
 }
 
+void
+impShape::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	float position[3];
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		position[0] = xs[i];
+		position[1] = ys[i];
+		position[2] = zs[i];
+		values[i] += value(position);
+	}
+}
+
+void
+impShape::getBounds(float cutoff, float* min, float* max)
+{
+	min[0] = min[1] = min[2] = -FLT_MAX;
+	max[0] = max[1] = max[2] = FLT_MAX;
+}
+
+float
+impShape::falloffDistance(float strengthSquared, float cutoff)
+{
+	if (cutoff <= 0.0f)
+		return FLT_MAX;
+	// strengthSquared / (distance^2 + IMP_MIN_DIVISOR) < cutoff
+	return sqrtf(strengthSquared / cutoff);
+}
+
+void
+impShape::transformBounds(const float* size, float* min, float* max)
+{
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		const float extent(fabsf(mat[i]) * size[0] + fabsf(mat[4 + i]) * size[1] + fabsf(mat[8 + i]) * size[2]);
+		min[i] = mat[12 + i] - extent;
+		max[i] = mat[12 + i] + extent;
+	}
+}
+
 void
 impShape::center(float* position)
 {
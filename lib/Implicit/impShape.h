@@ -80,12 +80,32 @@ public:
 	// "position" is an array of 3 floats
 	virtual float value(float* position);
 
+	// Adds the value of this shape at "n" positions to "values".  Positions are
+	// passed as separate arrays of x, y, and z coordinates so that derived
+	// shapes can evaluate several of them at once with SIMD instructions.
+	// The default implementation calls value() for each position.
+	virtual void addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+
+	// Assigns the corners of a world space box to "min" and "max" outside of
+	// which this shape's value is always less than "cutoff".  The default box
+	// is unbounded.
+	virtual void getBounds(float cutoff, float* min, float* max);
+
 	// assigns a center of the element's volume to "position"
 	virtual void center(float* position);
 
 	// adds surface crawler start position(s) to given crawlPointVector
 	virtual void addCrawlPoint(impCrawlPointVector& cpv);
 
+protected:
+	// Distance at which an inverse square falloff with this squared strength
+	// drops below "cutoff".  Unbounded if "cutoff" is not positive.
+	static float falloffDistance(float strengthSquared, float cutoff);
+	// Transforms the box from -"size" to "size" in this shape's own coordinates
+	// (those produced by invtrmat) into a world space box.
+	void transformBounds(const float* size, float* min, float* max);
+
+public:
 	// When using SSE, __m128 will not be byte aligned when used in a class.  Overriding
 	// new and delete ensures this whole class gets aligned to a 16-byte boundary.
 #ifdef __SSE__
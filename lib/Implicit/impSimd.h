@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#ifndef IMPSIMD_H
+#define IMPSIMD_H
+
+// Thin wrappers around SSE or AVX intrinsics so that each impShape needs only
+// one kernel for evaluating several positions at once.  IMP_SIMD_WIDTH is the
+// number of positions handled per step.  Without SSE2 IMP_SIMD is 0 and the
+// shapes fall back to calling value() for every position.
+
+#if defined(__AVX__)
+#include <immintrin.h>
+
+#define IMP_SIMD 1
+#define IMP_SIMD_WIDTH 8
+
+typedef __m256 impFloatv;
+
+inline impFloatv impLoad(const float* p) { return _mm256_loadu_ps(p); }
+inline void impStore(float* p, impFloatv a) { _mm256_storeu_ps(p, a); }
+inline impFloatv impSet1(float a) { return _mm256_set1_ps(a); }
+inline impFloatv impAdd(impFloatv a, impFloatv b) { return _mm256_add_ps(a, b); }
+inline impFloatv impSub(impFloatv a, impFloatv b) { return _mm256_sub_ps(a, b); }
+inline impFloatv impMul(impFloatv a, impFloatv b) { return _mm256_mul_ps(a, b); }
+inline impFloatv impDiv(impFloatv a, impFloatv b) { return _mm256_div_ps(a, b); }
+inline impFloatv impSqrt(impFloatv a) { return _mm256_sqrt_ps(a); }
+inline impFloatv impMin(impFloatv a, impFloatv b) { return _mm256_min_ps(a, b); }
+inline impFloatv impMax(impFloatv a, impFloatv b) { return _mm256_max_ps(a, b); }
+inline impFloatv impAnd(impFloatv a, impFloatv b) { return _mm256_and_ps(a, b); }
+inline impFloatv impAndNot(impFloatv a, impFloatv b) { return _mm256_andnot_ps(a, b); }
+inline impFloatv impOr(impFloatv a, impFloatv b) { return _mm256_or_ps(a, b); }
+inline impFloatv impLess(impFloatv a, impFloatv b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+
+#define IMP_SIMD 1
+#define IMP_SIMD_WIDTH 4
+
+typedef __m128 impFloatv;
+
+inline impFloatv impLoad(const float* p) { return _mm_loadu_ps(p); }
+inline void impStore(float* p, impFloatv a) { _mm_storeu_ps(p, a); }
+inline impFloatv impSet1(float a) { return _mm_set1_ps(a); }
+inline impFloatv impAdd(impFloatv a, impFloatv b) { return _mm_add_ps(a, b); }
+inline impFloatv impSub(impFloatv a, impFloatv b) { return _mm_sub_ps(a, b); }
+inline impFloatv impMul(impFloatv a, impFloatv b) { return _mm_mul_ps(a, b); }
+inline impFloatv impDiv(impFloatv a, impFloatv b) { return _mm_div_ps(a, b); }
+inline impFloatv impSqrt(impFloatv a) { return _mm_sqrt_ps(a); }
+inline impFloatv impMin(impFloatv a, impFloatv b) { return _mm_min_ps(a, b); }
+inline impFloatv impMax(impFloatv a, impFloatv b) { return _mm_max_ps(a, b); }
+inline impFloatv impAnd(impFloatv a, impFloatv b) { return _mm_and_ps(a, b); }
+inline impFloatv impAndNot(impFloatv a, impFloatv b) { return _mm_andnot_ps(a, b); }
+inline impFloatv impOr(impFloatv a, impFloatv b) { return _mm_or_ps(a, b); }
+inline impFloatv impLess(impFloatv a, impFloatv b) { return _mm_cmplt_ps(a, b); }
+
+#else
+
+#define IMP_SIMD 0
+#define IMP_SIMD_WIDTH 1
+
+#endif
+
+#if IMP_SIMD
+
+// mask ? a : b
+inline impFloatv impSelect(impFloatv mask, impFloatv a, impFloatv b)
+{
+	return impOr(impAnd(mask, a), impAndNot(mask, b));
+}
+
+inline impFloatv impAbs(impFloatv a)
+{
+	return impAndNot(impSet1(-0.0f), a);
+}
+
+// Transform a position by the first three rows of an impShape's invtrmat.
+// Operations are done in the same order as in the scalar value() functions
+// so that both give identical results.
+inline void impTransform(const float* m, impFloatv x, impFloatv y, impFloatv z,
+    impFloatv& tx, impFloatv& ty, impFloatv& tz)
+{
+	tx = impAdd(impAdd(impAdd(impMul(x, impSet1(m[0])), impMul(y, impSet1(m[1]))), impMul(z, impSet1(m[2]))), impSet1(m[3]));
+	ty = impAdd(impAdd(impAdd(impMul(x, impSet1(m[4])), impMul(y, impSet1(m[5]))), impMul(z, impSet1(m[6]))), impSet1(m[7]));
+	tz = impAdd(impAdd(impAdd(impMul(x, impSet1(m[8])), impMul(y, impSet1(m[9]))), impMul(z, impSet1(m[10]))), impSet1(m[11]));
+}
+
+// Same approximation as rsAtan2f() in rsMath so that shapes using it give
+// the same result whether they are evaluated one at a time or in batches.
+inline impFloatv impRsAtan2(impFloatv y, impFloatv x)
+{
+	const impFloatv pio4(impSet1(0.785398163f));
+	const impFloatv zero(impSet1(0.0f));
+	const impFloatv abs_y(impAdd(impAbs(y), impSet1(0.000001f)));
+	const impFloatv pos(impSub(pio4, impMul(pio4, impDiv(impSub(x, abs_y), impAdd(x, abs_y)))));
+	const impFloatv neg(impSub(impSet1(2.35619449019f), impMul(pio4, impDiv(impAdd(x, abs_y), impSub(abs_y, x)))));
+	const impFloatv angle(impSelect(impLess(x, zero), neg, pos));
+	return impSelect(impLess(y, zero), impSub(zero, angle), angle);
+}
+
+#endif
+
+#endif
@@ -19,6 +19,7 @@
  */
 
 #include "impSphere.h"
+#include "impSimd.h"
 
 float
 impSphere::value(float* position)
@@ -32,3 +33,35 @@ impSphere::value(float* position)
 	// using an incomplete matrix.
 	return thicknessSquared / (tx * tx + ty * ty + tz * tz + IMP_MIN_DIVISOR);
 }
+
+void
+impSphere::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv ts(impSet1(thicknessSquared));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		const impFloatv tx(impAdd(impSet1(invmat[12]), impLoad(xs + i)));
+		const impFloatv ty(impAdd(impSet1(invmat[13]), impLoad(ys + i)));
+		const impFloatv tz(impAdd(impSet1(invmat[14]), impLoad(zs + i)));
+		const impFloatv v(impDiv(ts, impAdd(impAdd(impAdd(impMul(tx, tx), impMul(ty, ty)), impMul(tz, tz)), mindiv)));
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
+void
+impSphere::getBounds(float cutoff, float* min, float* max)
+{
+	// Only the translation in invmat is used by value(), so the bounds are a
+	// cube around it.
+	const float d(falloffDistance(thicknessSquared, cutoff));
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		min[i] = -invmat[12 + i] - d;
+		max[i] = -invmat[12 + i] + d;
+	}
+}
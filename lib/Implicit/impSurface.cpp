@@ -21,6 +21,7 @@
 #include "impSurface.h"
 
 #include <iostream>
+#include <math.h>
 #include <string.h>
 
 #include <rsMath/rsMath.h>
@@ -61,10 +62,15 @@ impSurface::impSurface()
 	index_offset = 0;
 	vertex_offset = 0;
 	num_tristrips = 0;
+	peak_vertices = 0;
+	peak_indices = 0;
 	triStripLengths.resize(0);
 	vertices.resize(0);
 	indices.resize(0);
 	vertex_data_size = sizeof(float) * 6;
+	vertex_format = IMP_VERTEX_FLOAT;
+	num_packed_vertices = 0;
+	num_short_indices = 0;
 /*
 	if (mUseVBOs)
 	{
@@ -130,22 +136,46 @@ impSurface::getProcAddr(char* name)
 void
 impSurface::reset()
 {
+	peak_vertices = getPeakNumVertices();
+	peak_indices = getPeakNumIndices();
+
 	num_tristrips = 0;
 	index_offset = 0;
 	vertex_offset = 0;
+	num_packed_vertices = 0;
+	num_short_indices = 0;
 
 	// New data is going to be created, so VBO or display list must be compiled again.
 	mCompile = true;
 }
 
+void
+impSurface::reserve(unsigned int numVertices, unsigned int numIndices)
+{
+	grow(vertices, size_t(numVertices) * 6);
+	grow(indices, numIndices);
+}
+
+unsigned int
+impSurface::getPeakNumVertices() const
+{
+	const unsigned int current(vertex_offset / 6);
+	return (current > peak_vertices) ? current : peak_vertices;
+}
+
+unsigned int
+impSurface::getPeakNumIndices() const
+{
+	return (index_offset > peak_indices) ? index_offset : peak_indices;
+}
+
 #ifdef USE_TRIANGLE_STRIPS
 void
 impSurface::addTriStripLength(unsigned char length)
 {
 	// make more tristrip storage if necessary
-	const size_t tslsize(triStripLengths.size());
-	if (num_tristrips == tslsize)
-		triStripLengths.resize(tslsize + 1000);
+	if (num_tristrips == triStripLengths.size())
+		grow(triStripLengths, num_tristrips + 1000);
 
 	triStripLengths[num_tristrips++] = length;
 }
@@ -154,30 +184,162 @@ impSurface::addTriStripLength(unsigned char length)
 void
 impSurface::addIndex(unsigned int index)
 {
-	// make more vertex data storage if necessary
-	const size_t datasize(indices.size());
-	if (index_offset == datasize)
-		indices.resize(datasize + 1000);
+	// make more index storage if necessary
+	if (index_offset == indices.size())
+		grow(indices, index_offset + 1000);
 
-#if USE_UNSIGNED_SHORT
-	indices[index_offset++] = static_cast<unsigned short>(index);
-#else
 	indices[index_offset++] = index;
-#endif
 }
 
 void
-impSurface::addVertex(float* data)
+impSurface::addVertex(const float* data)
 {
 	// make more vertex data storage if necessary
-	const size_t datasize(vertices.size());
-	if ((vertex_offset + 12) >= datasize)
-		vertices.resize(datasize + 1000);
+	if (vertex_offset + 6 > vertices.size())
+		grow(vertices, vertex_offset + 1000);
 
-	memcpy(&(vertices[vertex_offset]), data, 24);//vertex_data_size);
+	float* v(&(vertices[vertex_offset]));
+	v[0] = data[0];
+	v[1] = data[1];
+	v[2] = data[2];
+	v[3] = data[3];
+	v[4] = data[4];
+	v[5] = data[5];
 	vertex_offset += 6;
 }
 
+void
+impSurface::appendVertices(const float* data, unsigned int count)
+{
+	if (count == 0)
+		return;
+
+	grow(vertices, vertex_offset + size_t(count) * 6);
+	memcpy(&(vertices[vertex_offset]), data, count * vertex_data_size);
+	vertex_offset += count * 6;
+}
+
+void
+impSurface::appendIndices(const unsigned int* data, unsigned int count)
+{
+	if (count == 0)
+		return;
+
+	grow(indices, index_offset + size_t(count));
+	memcpy(&(indices[index_offset]), data, count * sizeof(unsigned int));
+	index_offset += count;
+}
+
+void
+impSurface::setVertexFormat(impVertexFormat format)
+{
+	vertex_format = format;
+	num_packed_vertices = 0;
+}
+
+unsigned int
+impSurface::getVertexSize() const
+{
+	switch (vertex_format)
+	{
+		case IMP_VERTEX_PACKED_10_10_10_2:
+			return 16;
+		case IMP_VERTEX_PACKED_HALF:
+			return 20;
+		default:
+			return 24;
+	}
+}
+
+// Scale a normal to unit length; zero-length normals stay zero.
+static void
+normalize3(float* n)
+{
+	const float length(sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]));
+	const float scale((length > 0.0f) ? 1.0f / length : 0.0f);
+	n[0] *= scale;
+	n[1] *= scale;
+	n[2] *= scale;
+}
+
+// Convert a value in [-1, 1] to a 10-bit signed normalized integer.
+static unsigned int
+packSnorm10(float f)
+{
+	int i(int(floorf(f * 511.0f + 0.5f)));
+	if (i < -511)
+		i = -511;
+	if (i > 511)
+		i = 511;
+	return static_cast<unsigned int>(i) & 0x3ff;
+}
+
+// Convert a float to a half float, rounding to nearest.  Values too small for
+// a normalized half float become zero, which is harmless for unit normals.
+static unsigned short
+packHalf(float f)
+{
+	unsigned int u;
+	memcpy(&u, &f, 4);
+	const unsigned int sign((u >> 16) & 0x8000);
+	const int exponent(int((u >> 23) & 0xff) - 127 + 15);
+	if (exponent <= 0)
+		return static_cast<unsigned short>(sign);
+	if (exponent >= 31)
+		return static_cast<unsigned short>(sign | 0x7c00);
+	const unsigned int mantissa(u & 0x7fffff);
+	unsigned int h(sign | (unsigned int)(exponent << 10) | (mantissa >> 13));
+	// round; a carry out of the mantissa correctly increments the exponent
+	if (mantissa & 0x1000)
+		++h;
+	return static_cast<unsigned short>(h);
+}
+
+const void*
+impSurface::getFormattedVertices()
+{
+	if (vertex_format == IMP_VERTEX_FLOAT)
+		return vertices.data();
+
+	// convert vertices added since the last call
+	const unsigned int numVertices(vertex_offset / 6);
+	const unsigned int words(getVertexSize() / 4);
+	grow(packedVertices, size_t(numVertices) * words);
+	for (unsigned int v = num_packed_vertices; v < numVertices; ++v)
+	{
+		const float* src(&(vertices[v * 6]));
+		unsigned int* dst(&(packedVertices[v * words]));
+		float normal[3] = {src[0], src[1], src[2]};
+		normalize3(normal);
+		memcpy(dst, &(src[3]), 12);
+		if (vertex_format == IMP_VERTEX_PACKED_10_10_10_2)
+			dst[3] = packSnorm10(normal[0]) | (packSnorm10(normal[1]) << 10) | (packSnorm10(normal[2]) << 20);
+		else
+		{
+			dst[3] = packHalf(normal[0]) | (static_cast<unsigned int>(packHalf(normal[1])) << 16);
+			dst[4] = packHalf(normal[2]);
+		}
+	}
+	num_packed_vertices = numVertices;
+
+	return packedVertices.data();
+}
+
+const unsigned short*
+impSurface::getShortIndices()
+{
+	if (vertex_offset / 6 > 65536)
+		return nullptr;
+
+	// convert indices added since the last call
+	grow(shortIndices, index_offset);
+	for (unsigned int i = num_short_indices; i < index_offset; ++i)
+		shortIndices[i] = static_cast<unsigned short>(indices[i]);
+	num_short_indices = index_offset;
+
+	return shortIndices.data();
+}
+
 void
 impSurface::draw(std::function<void(bool compile,
                                     const float* vertices, unsigned int vertex_offset,
@@ -195,11 +357,7 @@ impSurface::draw(std::function<void(bool compile,
 			if (vbo_index_offsets.size() < triStripLengths.size())
 				vbo_index_offsets.resize(triStripLengths.size());
 			unsigned int offset = 0;
-#if USE_UNSIGNED_SHORT
-			const unsigned int index_size(sizeof(GLushort));
-#else
 			const unsigned int index_size(sizeof(GLuint));
-#endif
 			for (unsigned int i = 0; i < triStripLengths.size(); ++i)
 			{
 				vbo_index_offsets[i] = (GLvoid*)(offset * index_size);
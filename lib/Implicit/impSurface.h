@@ -31,23 +31,39 @@
 
 #include <kodi/gui/gl/GL.h>
 
-#define USE_UNSIGNED_SHORT 0  // use short instead of int when passing indices to draw calls
 #define USE_TRIANGLE_STRIPS 0  // use triangle strips instead of triangles
 
+// Vertex layouts that a surface can hand out for drawing.  Vertices are always
+// built as 6 floats (normal, position).  The packed layouts put the position
+// first as 3 floats, followed by the normalized normal.
+enum impVertexFormat
+{
+	IMP_VERTEX_FLOAT,  // 24 bytes: normal and position as 6 floats
+	IMP_VERTEX_PACKED_10_10_10_2,  // 16 bytes: normal as signed normalized 10:10:10:2
+	IMP_VERTEX_PACKED_HALF  // 20 bytes: normal as 3 half floats plus padding
+};
+
 class impSurface
 {
 private:
 	unsigned int index_offset;
 	unsigned int vertex_offset;
 	unsigned int num_tristrips;
+	// largest vertex and index counts held since construction
+	unsigned int peak_vertices;
+	unsigned int peak_indices;
 	std::vector<unsigned int> triStripLengths;
 	std::vector<float> vertices;
 	size_t vertex_data_size;
-#if USE_UNSIGNED_SHORT
-	std::vector<unsigned short> indices;
-#else
 	std::vector<unsigned int> indices;
-#endif
+
+	// Packed copies of the data, converted when first asked for.  They only
+	// grow, so the counts say how much of them is up to date.
+	impVertexFormat vertex_format;
+	std::vector<unsigned int> packedVertices;
+	unsigned int num_packed_vertices;
+	std::vector<unsigned short> shortIndices;
+	unsigned int num_short_indices;
 
 	// display list
 	GLuint mDisplayList;
@@ -79,16 +95,51 @@ public:
 	// Set data counts to 0
 	void reset();
 
+	// Make room for at least this many vertices and indices without
+	// reallocating.  Storage is never released, so a surface that is reused
+	// every frame stops reallocating once it has seen its largest geometry.
+	void reserve(unsigned int numVertices, unsigned int numIndices);
+	unsigned int getPeakNumVertices() const;
+	unsigned int getPeakNumIndices() const;
+
 	// Add data to surface
 #ifdef USE_TRIANGLE_STRIPS
 	void addTriStripLength(unsigned char length);
 #endif
 	void addIndex(unsigned int index);
-	void addVertex(float* data);  // provide array of 6 floats (normal, position)
+	void addVertex(const float* data);  // provide array of 6 floats (normal, position)
+	void appendVertices(const float* data, unsigned int count);  // "count" vertices of 6 floats each
+	void appendIndices(const unsigned int* data, unsigned int count);
+
+	// Read back data added since the last reset()
+	unsigned int getNumVertices() const { return vertex_offset / 6; }
+	const float* getVertices() const { return vertices.data(); }
+	unsigned int getNumIndices() const { return index_offset; }
+	const unsigned int* getIndices() const { return indices.data(); }
+
+	// Layout returned by getFormattedVertices().  IMP_VERTEX_FLOAT by default.
+	void setVertexFormat(impVertexFormat format);
+	impVertexFormat getVertexFormat() const { return vertex_format; }
+	unsigned int getVertexSize() const;  // bytes per vertex in this layout
+	const void* getFormattedVertices();
+	// 16-bit copy of the indices, or nullptr if there are too many vertices
+	// for 16-bit indices
+	const unsigned short* getShortIndices();
+	unsigned int getNumTriStrips() const { return num_tristrips; }
+	const unsigned int* getTriStripLengths() const { return triStripLengths.data(); }
 
 	void draw(std::function<void( bool compile, const float* vertices, unsigned int vertex_offset,
                                                 const unsigned int* indices, unsigned int index_offset)>(cb));
 	//void draw_wireframe();
+
+private:
+	// grow storage geometrically so that it holds at least "size" elements
+	template <typename T>
+	static void grow(std::vector<T>& v, size_t size)
+	{
+		if (v.size() < size)
+			v.resize((size > v.size() * 2) ? size : v.size() * 2);
+	}
 };
 
 #endif
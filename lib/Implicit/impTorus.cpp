@@ -19,6 +19,7 @@
  */
 
 #include "impTorus.h"
+#include "impSimd.h"
 
 float
 impTorus::value(float* position)
@@ -62,6 +63,26 @@ impTorus::value(float* position)
 	//#endif
 }
 
+void
+impTorus::addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+	unsigned int i(0);
+#if IMP_SIMD
+	const impFloatv ts(impSet1(thicknessSquared));
+	const impFloatv mindiv(impSet1(IMP_MIN_DIVISOR));
+	const impFloatv r(impSet1(radius));
+	for (; i + IMP_SIMD_WIDTH <= n; i += IMP_SIMD_WIDTH)
+	{
+		impFloatv tx, ty, tz;
+		impTransform(invtrmat, impLoad(xs + i), impLoad(ys + i), impLoad(zs + i), tx, ty, tz);
+		const impFloatv temp(impSub(impSqrt(impAdd(impMul(tx, tx), impMul(ty, ty))), r));
+		const impFloatv v(impDiv(ts, impAdd(impAdd(impMul(temp, temp), impMul(tz, tz)), mindiv)));
+		impStore(values + i, impAdd(impLoad(values + i), v));
+	}
+#endif
+	impShape::addValues(xs + i, ys + i, zs + i, values + i, n - i);
+}
+
 // Finding a point inside a torus is trickier than
 // finding a point inside a sphere or ellipsoid.
 void
@@ -79,3 +100,11 @@ impTorus::addCrawlPoint(impCrawlPointVector& cpv)
 	        mat[1] * radius + mat[13],
 	        mat[2] * radius + mat[14]));
 }
+
+void
+impTorus::getBounds(float cutoff, float* min, float* max)
+{
+	const float d(falloffDistance(thicknessSquared, cutoff));
+	const float size[3] = {radius + d, radius + d, d};
+	transformBounds(size, min, max);
+}
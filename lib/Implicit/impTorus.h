@@ -38,6 +38,8 @@ public:
 	// position is an array of 3 floats
 	// returns the field strenth of this sphere at a given position
 	virtual float value(float* position);
+	virtual void addValues(const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+	virtual void getBounds(float cutoff, float* min, float* max);
 	virtual void center(float* position);
 	virtual void addCrawlPoint(impCrawlPointVector& cpv);
 };
@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "PixelUnpackRing.h"
+
+#include <stdio.h>
+
+namespace kodi
+{
+namespace gui
+{
+namespace gl
+{
+
+void GetVersion(int& major, int& minor)
+{
+  major = 0;
+  minor = 0;
+
+  const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+  if (!version)
+    return;
+
+#if defined(HAS_GLES)
+  sscanf(version, "OpenGL ES %d.%d", &major, &minor);
+#else
+  sscanf(version, "%d.%d", &major, &minor);
+#endif
+}
+
+bool CPixelUnpackRing::Create(size_t size)
+{
+  Destroy();
+
+#if defined(HAS_GL) || (defined(HAS_GLES) && HAS_GLES == 3)
+  int major;
+  int minor;
+  GetVersion(major, minor);
+  if (major >= 3)
+  {
+    glGenBuffers(COUNT, m_pbo);
+    for (int i = 0; i < COUNT; i++)
+    {
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbo[i]);
+      glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    m_size = size;
+  }
+#endif
+
+  return m_size > 0;
+}
+
+void CPixelUnpackRing::Destroy()
+{
+  if (m_size > 0)
+  {
+    glDeleteBuffers(COUNT, m_pbo);
+    for (int i = 0; i < COUNT; i++)
+      m_pbo[i] = 0;
+    m_size = 0;
+  }
+  m_index = 0;
+  m_mapped = false;
+}
+
+void* CPixelUnpackRing::Map()
+{
+  void* buffer = nullptr;
+
+#if defined(HAS_GL) || (defined(HAS_GLES) && HAS_GLES == 3)
+  if (m_size > 0)
+  {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbo[m_index]);
+    buffer = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, m_size,
+                              GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (!buffer)
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  }
+#endif
+
+  m_mapped = buffer != nullptr;
+  return buffer;
+}
+
+void CPixelUnpackRing::Upload(GLsizei width, GLsizei height, const void* pixels)
+{
+#if defined(HAS_GL) || (defined(HAS_GLES) && HAS_GLES == 3)
+  if (m_mapped)
+  {
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, BUFFER_OFFSET(0));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    m_index = (m_index + 1) % COUNT;
+    m_mapped = false;
+    return;
+  }
+#endif
+
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+}
+
+}
+}
+}
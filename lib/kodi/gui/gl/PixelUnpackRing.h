@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include <kodi/gui/gl/GL.h>
+
+#include <stddef.h>
+
+namespace kodi
+{
+namespace gui
+{
+namespace gl
+{
+
+  // Major and minor number of the context's GL or GLES version, 0.0 if it
+  // can't be read
+  void GetVersion(int& major, int& minor);
+
+  // Ring of pixel unpack buffers to stream RGBA8 texture updates through.
+  // They need GL 3.0 or GLES 3.0, on anything older Map() returns nullptr
+  // and Upload() takes the pixels from client memory.
+  class CPixelUnpackRing
+  {
+  public:
+    static const int COUNT = 3;
+
+    // Creates the buffers, size bytes each, if the context can use them
+    bool Create(size_t size);
+    void Destroy();
+
+    // Binds and maps the next buffer of the ring for writing
+    void* Map();
+
+    // Updates the bound GL_TEXTURE_2D from the buffer Map() returned, or
+    // from pixels if nothing is mapped
+    void Upload(GLsizei width, GLsizei height, const void* pixels);
+
+  private:
+    GLuint m_pbo[COUNT] = {0};
+    unsigned int m_index = 0;
+    size_t m_size = 0;
+    bool m_mapped = false;
+  };
+
+}
+}
+}
@@ -0,0 +1,52 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "rsAsset.h"
+
+#include <bzlib.h>
+#include <stdlib.h>
+
+rsAsset::rsAsset(const uint8_t* packed, unsigned int packedSize, unsigned int size)
+	: packed(packed), packedSize(packedSize), unpackedSize(size), data(nullptr), users(0)
+{
+}
+
+rsAsset::~rsAsset()
+{
+	free(data);
+}
+
+const unsigned char* rsAsset::acquire()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	++users;
+	if (!data)
+	{
+		data = (unsigned char*)malloc(unpackedSize);
+		unsigned int size = unpackedSize;
+		if (data && (BZ2_bzBuffToBuffDecompress((char*)data, &size, (char*)packed, packedSize, 0, 0) != BZ_OK
+			|| size != unpackedSize))
+		{
+			free(data);
+			data = nullptr;
+		}
+	}
+
+	return data;
+}
+
+void rsAsset::release()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (users && !--users)
+	{
+		free(data);
+		data = nullptr;
+	}
+}
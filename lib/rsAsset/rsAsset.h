@@ -0,0 +1,46 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#ifndef RSASSET_H
+#define RSASSET_H
+
+#include <mutex>
+#include <stdint.h>
+
+// A texture or sound embedded in the add-on as a bzip2 compressed blob, as
+// written by rsAssetPack.cmake.  Only the compressed bytes are part of the
+// library's image; the data is decompressed into the heap by the first
+// acquire() and freed again when the last user calls release(), e.g. right
+// after uploading a texture to GL.
+class rsAsset
+{
+public:
+	rsAsset(const uint8_t* packed, unsigned int packedSize, unsigned int size);
+	~rsAsset();
+
+	rsAsset(const rsAsset&) = delete;
+	rsAsset& operator=(const rsAsset&) = delete;
+
+	// Decompressed data, or nullptr if the blob is damaged.  Every call,
+	// successful or not, must be matched by a call to release().
+	const unsigned char* acquire();
+	void release();
+
+	// Size of the decompressed data in bytes
+	unsigned int size() const { return unpackedSize; }
+
+private:
+	const uint8_t* packed;
+	unsigned int packedSize;
+	unsigned int unpackedSize;
+
+	std::mutex mutex;
+	unsigned char* data;
+	unsigned int users;
+};
+
+#endif
@@ -0,0 +1,86 @@
+# Packs binary files into a header of bzip2 compressed rsAsset blobs.
+#
+#   cmake -DOUTPUT=<header> -DINPUTS=<file;...> -DNAMES=<name;...>
+#         [-DPREAMBLE=<file>] [-DDEFINITIONS=<NAME=value;...>]
+#         -P rsAssetPack.cmake
+#
+# Each of INPUTS becomes a "static rsAsset <name>" in OUTPUT, in the order
+# given by NAMES.  The text of PREAMBLE (e.g. a license comment) is copied to
+# the top of the header unchanged and each of DEFINITIONS becomes a #define,
+# for things like texture sizes that belong next to the data.  Packing needs
+# libarchive's bzip2 support from CMake 3.19 or newer; building the add-ons
+# only needs the headers.
+#
+# No build target runs this.  The rsAsset headers under src/ (euphoria's
+# texture.h, helios' spheremap.h, hyperspace's nebulamap.h, matrixview's
+# fonts.h and images.h and skyrocket's *sound.h and *tex.h) were generated
+# with it and are checked in.  Their raw inputs, named in each "data from"
+# comment, are not kept in the tree: they were dumped from the uncompressed
+# arrays of the original headers in the git history.  To change an asset,
+# bunzip2 the <name>_packed bytes of its header back into the raw file,
+# edit that, and pack it again.
+
+cmake_minimum_required(VERSION 3.19)
+
+if(NOT OUTPUT OR NOT INPUTS OR NOT NAMES)
+  message(FATAL_ERROR "rsAssetPack: OUTPUT, INPUTS and NAMES are required")
+endif()
+
+list(LENGTH INPUTS input_count)
+list(LENGTH NAMES name_count)
+if(NOT input_count EQUAL name_count)
+  message(FATAL_ERROR "rsAssetPack: INPUTS and NAMES differ in length")
+endif()
+
+set(text "")
+if(PREAMBLE)
+  file(READ ${PREAMBLE} text)
+endif()
+string(APPEND text "#pragma once\n\n#include <rsAsset/rsAsset.h>\n")
+if(DEFINITIONS)
+  string(APPEND text "\n")
+  foreach(definition ${DEFINITIONS})
+    string(REGEX REPLACE "^([^=]+)=(.*)$" "#define \\1 \\2" definition "${definition}")
+    string(APPEND text "${definition}\n")
+  endforeach()
+endif()
+
+get_filename_component(output_name ${OUTPUT} NAME)
+set(work ${CMAKE_CURRENT_BINARY_DIR}/${output_name}.rsAssetPack)
+file(MAKE_DIRECTORY ${work})
+
+math(EXPR last "${input_count} - 1")
+foreach(i RANGE ${last})
+  list(GET INPUTS ${i} input)
+  list(GET NAMES ${i} name)
+  get_filename_component(input_name ${input} NAME)
+
+  file(SIZE ${input} size)
+  file(ARCHIVE_CREATE OUTPUT ${work}/${name}.bz2 PATHS ${input}
+       FORMAT raw COMPRESSION BZip2 COMPRESSION_LEVEL 9)
+  file(SIZE ${work}/${name}.bz2 packed_size)
+
+  # 24 bytes per line, written in decimal like the rest of the embedded data
+  file(READ ${work}/${name}.bz2 hex HEX)
+  string(REGEX REPLACE "([0-9a-f][0-9a-f])" "x\\1," hex "${hex}")
+  string(REPEAT "x[0-9a-f][0-9a-f]," 24 line)
+  string(REGEX REPLACE "(${line})" "\\1\n" hex "${hex}")
+  foreach(byte RANGE 255)
+    math(EXPR digits "${byte}" OUTPUT_FORMAT HEXADECIMAL)
+    string(REGEX REPLACE "^0x" "" digits "${digits}")
+    string(LENGTH "${digits}" length)
+    if(length EQUAL 1)
+      set(digits "0${digits}")
+    endif()
+    string(REPLACE "x${digits}," "${byte}," hex "${hex}")
+  endforeach()
+  string(STRIP "${hex}" hex)
+  string(REGEX REPLACE ",$" "" hex "${hex}")
+
+  string(APPEND text "\n/* data from ${input_name}, ${size} bytes */\n\n")
+  string(APPEND text "static const uint8_t ${name}_packed[] = {\n${hex}\n};\n\n")
+  string(APPEND text "static rsAsset ${name}(${name}_packed, ${packed_size}, ${size});\n")
+endforeach()
+
+file(REMOVE_RECURSE ${work})
+file(WRITE ${OUTPUT} "${text}")
@@ -0,0 +1,36 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "rsFile.h"
+
+#include <kodi/Filesystem.h>
+
+bool rsWriteFile(const std::string& file, std::initializer_list<rsFileBlock> blocks)
+{
+	const std::string tempFile = file + ".tmp";
+	kodi::vfs::CFile out;
+	if (!out.OpenFileForWrite(tempFile, true))
+		return false;
+
+	bool written = true;
+	for (const rsFileBlock& block : blocks)
+	{
+		if (out.Write(block.data, block.size) != ssize_t(block.size))
+		{
+			written = false;
+			break;
+		}
+	}
+	out.Close();
+
+	if (!written || !kodi::vfs::RenameFile(tempFile, file))
+	{
+		kodi::vfs::DeleteFile(tempFile);
+		return false;
+	}
+	return true;
+}
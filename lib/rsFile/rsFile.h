@@ -0,0 +1,30 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#ifndef RSFILE_H
+#define RSFILE_H
+
+#include <initializer_list>
+#include <stddef.h>
+#include <string>
+
+// One piece of the data rsWriteFile() writes
+struct rsFileBlock
+{
+	const void* data;
+	size_t size;
+};
+
+// Writes blocks one after the other to file, through Kodi's VFS.  They are
+// written to file + ".tmp" first, which is then renamed into place, so an
+// interrupted write never leaves a broken file behind for the next start to
+// read.  Callers writing the same file from several threads must keep them
+// apart, as they share the temporary name.  Returns false, with the
+// temporary file removed, if anything fails.
+bool rsWriteFile(const std::string& file, std::initializer_list<rsFileBlock> blocks);
+
+#endif
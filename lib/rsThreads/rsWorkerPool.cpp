@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "rsWorkerPool.h"
+
+#include <algorithm>
+
+rsWorkerPool::rsWorkerPool(unsigned int numThreads/* = 0*/)
+{
+	stop = false;
+
+	if (numThreads == 0)
+	{
+		const unsigned int hw(std::thread::hardware_concurrency());
+		numThreads = (hw > 1) ? hw - 1 : 0;
+	}
+
+	for (unsigned int i = 0; i < numThreads; ++i)
+		threads.emplace_back(&rsWorkerPool::workerMain, this);
+}
+
+rsWorkerPool::~rsWorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	wake.notify_all();
+
+	for (auto& thread : threads)
+	{
+		if (thread.joinable())
+			thread.join();
+	}
+}
+
+rsWorkerPool&
+rsWorkerPool::shared()
+{
+	static rsWorkerPool pool;
+	return pool;
+}
+
+void
+rsWorkerPool::parallelFor(unsigned int count, const std::function<void(unsigned int)>& func)
+{
+	// nothing to share
+	if (count == 1 || threads.empty())
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			func(i);
+		return;
+	}
+	if (count == 0)
+		return;
+
+	job j;
+	j.func = &func;
+	j.count = count;
+	j.next = 0;
+	j.done = 0;
+	j.workers = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.push_back(&j);
+	}
+	wake.notify_all();
+
+	runJob(j);
+
+	// Every piece has been claimed.  Wait for the workers still busy with
+	// their pieces before the job goes out of scope.
+	std::unique_lock<std::mutex> lock(mutex);
+	const auto it(std::find(jobs.begin(), jobs.end(), &j));
+	if (it != jobs.end())
+		jobs.erase(it);
+	finished.wait(lock, [&j] { return j.workers == 0 && j.done == j.count; });
+}
+
+void
+rsWorkerPool::runJob(job& j)
+{
+	unsigned int i;
+	while ((i = j.next.fetch_add(1)) < j.count)
+	{
+		(*j.func)(i);
+		j.done.fetch_add(1);
+	}
+}
+
+void
+rsWorkerPool::workerMain()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		wake.wait(lock, [this] { return stop || !jobs.empty(); });
+		if (stop)
+			return;
+
+		job* j = jobs.front();
+		if (j->next >= j->count)
+		{
+			// all pieces are claimed; the submitting thread waits for the rest
+			jobs.pop_front();
+			continue;
+		}
+
+		++j->workers;
+		lock.unlock();
+		runJob(*j);
+		lock.lock();
+		--j->workers;
+		finished.notify_all();
+	}
+}
@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: LGPL-2.1-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#ifndef RSWORKERPOOL_H
+#define RSWORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small pool of worker threads for splitting per-frame work into
+// independent pieces.  The thread calling parallelFor() always works on its
+// own job as well, so jobs may be submitted from several threads at once (or
+// from inside another job) without deadlocking.
+class rsWorkerPool
+{
+public:
+	// A numThreads of 0 creates one worker less than the number of hardware
+	// threads, because the calling thread takes part in every job.
+	rsWorkerPool(unsigned int numThreads = 0);
+	~rsWorkerPool();
+
+	// Pool shared by everything in this module
+	static rsWorkerPool& shared();
+
+	// Number of threads that can work on a job at the same time,
+	// including the calling thread
+	unsigned int getNumThreads() const { return (unsigned int)(threads.size()) + 1; }
+
+	// Call func(i) for every i in [0, count) and return when all calls are done.
+	void parallelFor(unsigned int count, const std::function<void(unsigned int)>& func);
+
+private:
+	struct job
+	{
+		const std::function<void(unsigned int)>* func;
+		unsigned int count;
+		std::atomic<unsigned int> next;
+		std::atomic<unsigned int> done;
+		unsigned int workers;  // worker threads currently holding this job, guarded by mutex
+	};
+
+	void runJob(job& j);
+	void workerMain();
+
+	std::vector<std::thread> threads;
+	std::deque<job*> jobs;
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable finished;
+	bool stop;
+};
+
+#endif
@@ -41,6 +41,7 @@ in vec4 v_ambientAndEmission;
 in vec3 v_light0Vector;
 in vec3 v_light0HalfVector;
 in vec2 v_texCoord0;
+in vec4 v_color;
 
 float calcSpotFactor(Light light, vec3 lightVector)
 {
@@ -139,14 +140,14 @@ void main()
 {
   if (u_textureUsed == 1)
   {
-    gl_FragColor = u_uniformColor;
+    gl_FragColor = u_uniformColor * v_color;
     gl_FragColor.rgb *= texture2D(u_texUnit, v_texCoord0).rrr;
   }
   else
   {
     if (u_lighting == 1)
-      gl_FragColor = calcPerFragmentLighting() * u_uniformColor;
+      gl_FragColor = calcPerFragmentLighting() * u_uniformColor * v_color;
     else
-      gl_FragColor = u_uniformColor;
+      gl_FragColor = u_uniformColor * v_color;
   }
 }
@@ -31,6 +31,7 @@ struct Material {
 in vec3 a_normal;
 in vec4 a_position;
 in vec2 a_coord;
+in vec4 a_color;
 
 // Uniforms
 uniform mat4 u_projectionMatrix;
@@ -47,6 +48,7 @@ out vec4 v_frontColor;
 out vec3 v_light0Vector;
 out vec3 v_light0HalfVector;
 out vec2 v_texCoord0;
+out vec4 v_color;
 
 // Shader variables
 vec4 vertexPositionInEye;
@@ -82,6 +84,7 @@ void main ()
   gl_Position = u_modelViewProjectionMatrix * a_position;
   v_normal = u_transposeAdjointModelViewMatrix * a_normal;
   v_texCoord0 = a_coord;
+  v_color = a_color;
   vertexPositionInEye = u_modelViewMatrix * a_position;
 
   calcLightingVaryingsForFragmentShader();
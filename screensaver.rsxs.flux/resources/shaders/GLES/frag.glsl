@@ -45,6 +45,7 @@ varying vec4 v_ambientAndEmission;
 varying vec3 v_light0Vector;
 varying vec3 v_light0HalfVector;
 varying vec2 v_texCoord0;
+varying vec4 v_color;
 
 float calcSpotFactor(Light light, vec3 lightVector)
 {
@@ -143,14 +144,14 @@ void main()
 {
   if (u_textureUsed == 1)
   {
-    gl_FragColor = u_uniformColor;
+    gl_FragColor = u_uniformColor * v_color;
     gl_FragColor.rgb *= texture2D(u_texUnit, v_texCoord0).rrr;
   }
   else
   {
     if (u_lighting == 1)
-      gl_FragColor = calcPerFragmentLighting() * u_uniformColor;
+      gl_FragColor = calcPerFragmentLighting() * u_uniformColor * v_color;
     else
-      gl_FragColor = u_uniformColor;
+      gl_FragColor = u_uniformColor * v_color;
   }
 }
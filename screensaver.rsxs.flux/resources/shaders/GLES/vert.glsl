@@ -35,6 +35,7 @@ struct Material {
 attribute vec3 a_normal;
 attribute vec4 a_position;
 attribute vec2 a_coord;
+attribute vec4 a_color;
 
 // Uniforms
 uniform mat4 u_projectionMatrix;
@@ -51,6 +52,7 @@ varying vec4 v_frontColor;
 varying vec3 v_light0Vector;
 varying vec3 v_light0HalfVector;
 varying vec2 v_texCoord0;
+varying vec4 v_color;
 
 // Shader variables
 vec4 vertexPositionInEye;
@@ -86,6 +88,7 @@ void main ()
   gl_Position = u_modelViewProjectionMatrix * a_position;
   v_normal = u_transposeAdjointModelViewMatrix * a_normal;
   v_texCoord0 = a_coord;
+  v_color = a_color;
   vertexPositionInEye = u_modelViewMatrix * a_position;
 
   calcLightingVaryingsForFragmentShader();
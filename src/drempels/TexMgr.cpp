@@ -20,9 +20,12 @@
 #include <dirent.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <string.h>
 #include <time.h>
+#include <kodi/Filesystem.h>
 #include <kodi/General.h>
 #include <Rgbhsl/Rgbhsl.h>
+#include <rsFile/rsFile.h>
 
 #include "noise1234.h"
 #define STB_IMAGE_IMPLEMENTATION
@@ -32,16 +35,26 @@
 
 using namespace std;
 
-TexMgr::TexMgr()
+// Images decoded ahead of the one on screen, and threads decoding them
+#define PREFETCH_IMAGES 3
+#define IMAGE_THREADS 2
+
+// Change when cached images come out differently for the same file, so
+// that old cache files are not used anymore
+#define IMAGE_CACHE_VERSION 1
+
+struct ImageCacheHeader
 {
-  srand((unsigned)time(nullptr));
-}
+  char magic[4];
+  uint32_t version;
+  uint32_t width;
+  uint32_t height;
+  uint32_t keyLength;
+};
 
-TexMgr::~TexMgr()
+TexMgr::TexMgr()
 {
-  delete m_imageThread;
-  delete [] m_curTex;
-  delete [] m_nextTex;
+  srand((unsigned)time(nullptr));
 }
 
 void TexMgr::setImageDir(const std::string& newDirName)
@@ -51,66 +64,49 @@ void TexMgr::setImageDir(const std::string& newDirName)
 
 void TexMgr::start()
 {
-  m_imageThread = new std::thread(&TexMgr::imageThreadMain, this);
+  m_exiting = false;
+  m_scanned = m_dirName.empty();
+
+  // The first thread scans the directory before it starts loading
+  for (int i = 0; i < IMAGE_THREADS; ++i)
+    m_imageThreads.push_back(std::thread(&TexMgr::imageThreadMain, this, i == 0 && !m_scanned));
 }
 
 void TexMgr::stop()
 {
-  m_exiting = true;
-
   {
     std::unique_lock<std::mutex> lck(m_nextTexMutex);
-    m_nextTexCond.notify_one();
+    m_exiting = true;
+    m_nextTexCond.notify_all();
   }
 
-  m_imageThread->join();
+  for (auto& thread : m_imageThreads)
+    thread.join();
+  m_imageThreads.clear();
 }
 
 bool TexMgr::getNext()
 {
-  bool ok = false;
-
   std::unique_lock<std::mutex> lck(m_nextTexMutex, std::defer_lock);
-  if (lck.try_lock())
-  {
-    if (m_ready)
-    {
-      m_ready = false;
-      ok = true;
-
-      {
-        uint32_t *tmp = m_prevTex;
-        uint32_t tmpW = m_prevW, tmpH = m_prevH;
-
-        m_prevTex = m_curTex;
-        m_prevW = m_curW; m_prevH = m_curH;
-
-        m_curTex = m_nextTex;
-        m_curW = m_nextW; m_curH = m_nextH;
+  if (!lck.try_lock() || m_readyImages.empty())
+    return false;
 
-        m_nextTex = tmp;
-        m_nextW = tmpW; m_nextH = tmpH;
-      }
+  m_prev = std::move(m_cur);
+  m_cur = std::move(m_readyImages.front());
+  m_readyImages.pop_front();
 
-      m_nextTexCond.notify_one();
-    }
-  }
-
-  return ok;
+  m_nextTexCond.notify_all();
+  return true;
 }
 
-void TexMgr::genTex()
+void TexMgr::genTex(Image& image)
 {
   const int blend_period = (rand() & 0x7) + 1;
   const int aorb_period = (rand() & 0x7) + 1;
 
-  if ((m_nextTex == nullptr) || (m_gw > m_nextW) || (m_gh > m_nextH))
-  {
-    delete [] m_nextTex;
-    m_nextTex = new uint32_t[m_gw * m_gh];
-    m_nextW = m_gw;
-    m_nextH = m_gh;
-  }
+  image.pixels.resize(m_gw * m_gh);
+  image.w = m_gw;
+  image.h = m_gh;
 
   const float gxo = rand() / (float)(RAND_MAX / 256);
   const float gyo = rand() / (float)(RAND_MAX / 256);
@@ -162,11 +158,9 @@ void TexMgr::genTex()
 
       hsl2rgb(h, s, l, r, g, b);
 
-      m_nextTex[uu++] = 0xff000000 + (uint32_t)(r * 255) + ((uint32_t)(g * 255) << 8) + ((uint32_t)(b * 255) << 16);
+      image.pixels[uu++] = 0xff000000 + (uint32_t)(r * 255) + ((uint32_t)(g * 255) << 8) + ((uint32_t)(b * 255) << 16);
     }
   }
-
-  m_ready = true;
 }
 
 static unsigned int computeDesiredSize(const unsigned int input, const int desired)
@@ -193,102 +187,219 @@ static unsigned int computeDesiredSize(const unsigned int input, const int desir
   return desired;
 }
 
-// Directory scanning + image loading code in a separate function callable either from loadNextImage or another thread if pthreads is available.
-void TexMgr::loadNextImageFromDisk()
+// Shrink an RGBA image to half its size with a box filter, in place
+static void halveImage(unsigned char *image, int &width, int &height)
 {
-  int dirLoop = 0;
-  bool imageLoaded = false;
-  int width, height, channels;
-  unsigned char *image = nullptr;
+  const int w = width / 2;
+  const int h = height / 2;
 
-  do 
+  for (int y = 0; y < h; ++y)
   {
-    struct dirent *file;
+    const unsigned char *row0 = image + (y * 2) * width * 4;
+    const unsigned char *row1 = row0 + width * 4;
+    unsigned char *out = image + y * w * 4;
 
-    if (!m_imageDir)
+    for (int x = 0; x < w * 4; ++x)
     {
-      if (dirLoop) 
-      {
-        m_dirName = "";
-        return;
-      }
-
-      m_imageDir = opendir (m_dirName.c_str());
-      dirLoop = 1;
+      const int c = (x / 4) * 8 + (x & 3);
+      out[x] = (row0[c] + row0[c + 4] + row1[c] + row1[c + 4] + 2) >> 2;
     }
+  }
 
-    file = readdir (m_imageDir);
-    if (file) 
-    {
-      struct stat fileStat;
-      string full_path_and_name = m_dirName + "/" + file->d_name;
+  width = w;
+  height = h;
+}
 
-      if (!stat(full_path_and_name.c_str(), (struct stat *)&fileStat)) 
-      {
-        if (S_ISREG(fileStat.st_mode)) 
-        {
-          image = stbi_load(full_path_and_name.c_str(),
-                            &width,
-                            &height,
-                            &channels,
-                            STBI_rgb_alpha);
-
-          if (!image) 
-            kodi::Log(ADDON_LOG_ERROR, "Error loading %s: %s", full_path_and_name.c_str(), stbi_failure_reason());
-          else 
-            imageLoaded = true;
-        }
-      }
-    } 
-    else 
-    {
-      closedir(m_imageDir);
-      m_imageDir = nullptr;
-    }
-  } while (!imageLoaded);
+// Lists the regular files of the image directory, once per start()
+std::vector<std::string> TexMgr::scanImageDir() const
+{
+  std::vector<std::string> files;
 
+  DIR *dir = opendir(m_dirName.c_str());
+  if (!dir)
+    return files;
 
-  if (image)
+  struct dirent *file;
+  while ((file = readdir(dir)))
   {
-    const uint32_t oww = computeDesiredSize(width, m_tw);
-    const uint32_t ohh = computeDesiredSize(height, m_th);
-  
-    if ((width != oww) || (height != ohh))
-    {
-      stbir_resize_uint8(image, width, height, 0, image, oww, ohh, 0, STBI_rgb_alpha);
-    }
+    struct stat fileStat;
+    string full_path_and_name = m_dirName + "/" + file->d_name;
 
-    if ((m_nextTex == nullptr) || (oww > m_nextW) || (ohh > m_nextH))
-    {
-      delete [] m_nextTex;
-      m_nextTex = new uint32_t[oww * ohh];
-      m_nextW = oww;
-      m_nextH = ohh;
-    }
-    
-    memcpy(m_nextTex, image, oww * ohh * sizeof(uint32_t));
-    stbi_image_free(image);
+    if (!stat(full_path_and_name.c_str(), &fileStat) && S_ISREG(fileStat.st_mode))
+      files.push_back(full_path_and_name);
   }
+  closedir(dir);
 
-  m_ready = true;
+  return files;
 }
 
-void TexMgr::imageThreadMain()
+bool TexMgr::loadImage(const std::string& path, Image& image) const
 {
-  do 
+  struct stat fileStat;
+  if (stat(path.c_str(), &fileStat))
+    return false;
+
+  // Resized images are cached by path, modification time and size, so a
+  // photo on slow storage is only read and decoded once
+  char stamp[64];
+  snprintf(stamp, sizeof(stamp), "|%lld|%lld|%d|%d", static_cast<long long>(fileStat.st_mtime),
+           static_cast<long long>(fileStat.st_size), m_tw, m_th);
+  const std::string key = path + stamp;
+
+  char name[64];
+  snprintf(name, sizeof(name), "images/%016llx.rgba",
+           static_cast<unsigned long long>(std::hash<std::string>()(key)));
+  const std::string cacheFile = kodi::GetBaseUserPath(name);
+
+  if (loadCachedImage(cacheFile, key, image))
+    return true;
+
+  int width, height, channels;
+  unsigned char *data = stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+  if (!data)
+  {
+    kodi::Log(ADDON_LOG_ERROR, "Error loading %s: %s", path.c_str(), stbi_failure_reason());
+    return false;
+  }
+
+  const uint32_t oww = computeDesiredSize(width, m_tw);
+  const uint32_t ohh = computeDesiredSize(height, m_th);
+
+  // stb_image can't scale while decoding like libjpeg can, so big photos
+  // are halved first and the filtered resize only sees about twice the
+  // pixels it puts out
+  while ((width / 2 >= static_cast<int>(oww * 2)) && (height / 2 >= static_cast<int>(ohh * 2)))
+    halveImage(data, width, height);
+
+  image.pixels.resize(oww * ohh);
+  image.w = oww;
+  image.h = ohh;
+
+  if ((width != oww) || (height != ohh))
+    stbir_resize_uint8(data, width, height, 0, reinterpret_cast<unsigned char*>(image.pixels.data()), oww, ohh, 0, STBI_rgb_alpha);
+  else
+    memcpy(image.pixels.data(), data, oww * ohh * sizeof(uint32_t));
+
+  stbi_image_free(data);
+
+  saveCachedImage(cacheFile, key, image);
+  return true;
+}
+
+bool TexMgr::loadCachedImage(const std::string& file, const std::string& key, Image& image) const
+{
+  kodi::vfs::CFile cache;
+  if (!kodi::vfs::FileExists(file) || !cache.OpenFile(file))
+    return false;
+
+  ImageCacheHeader header;
+  if ((cache.Read(&header, sizeof(header)) != sizeof(header))
+    || memcmp(header.magic, "RSDI", 4) || (header.version != IMAGE_CACHE_VERSION)
+    || (header.keyLength != key.size()))
+    return false;
+
+  std::string cachedKey(key.size(), '\0');
+  if ((cache.Read(&cachedKey[0], cachedKey.size()) != ssize_t(cachedKey.size())) || (cachedKey != key))
+    return false;
+
+  image.pixels.resize(header.width * header.height);
+  image.w = header.width;
+  image.h = header.height;
+
+  const ssize_t size = image.pixels.size() * sizeof(uint32_t);
+  return cache.Read(image.pixels.data(), size) == size;
+}
+
+void TexMgr::saveCachedImage(const std::string& file, const std::string& key, const Image& image) const
+{
+  kodi::vfs::CreateDirectory(kodi::GetBaseUserPath("images/"));
+
+  ImageCacheHeader header;
+  memcpy(header.magic, "RSDI", 4);
+  header.version = IMAGE_CACHE_VERSION;
+  header.width = image.w;
+  header.height = image.h;
+  header.keyLength = key.size();
+
+  // imageThreadMain() never lets two threads load the same file at once, so
+  // they don't share a temporary name
+  if (!rsWriteFile(file, {{&header, sizeof(header)},
+                          {key.data(), key.size()},
+                          {image.pixels.data(), image.pixels.size() * sizeof(uint32_t)}}))
+    kodi::Log(ADDON_LOG_WARNING, "Failed to write image cache '%s'", file.c_str());
+}
+
+void TexMgr::imageThreadMain(bool scan)
+{
+  if (scan)
   {
+    std::vector<std::string> files = scanImageDir();
+
     std::unique_lock<std::mutex> lck(m_nextTexMutex);
-    if (!m_dirName.empty())
+    m_files = std::move(files);
+    m_scanned = true;
+    m_nextTexCond.notify_all();
+  }
+
+  std::unique_lock<std::mutex> lck(m_nextTexMutex);
+  while (!m_exiting)
+  {
+    if (!m_scanned || (m_readyImages.size() + m_loading >= PREFETCH_IMAGES))
     {
-      loadNextImageFromDisk();
+      m_nextTexCond.wait(lck);
+      continue;
     }
-    else
+
+    // Without any loadable image, fall back to generated textures.  Skip
+    // files another thread is still loading, which happens with fewer files
+    // than images to prefetch, and wait for it if all of them are.
+    std::string path;
+    if (!m_files.empty())
     {
-      genTex();
+      size_t skip = 0;
+      while (skip < m_files.size() && m_loadingFiles.count(m_files[(m_nextFile + skip) % m_files.size()]))
+        ++skip;
+      if (skip == m_files.size())
+      {
+        m_nextTexCond.wait(lck);
+        continue;
+      }
+
+      path = m_files[(m_nextFile + skip) % m_files.size()];
+      m_nextFile = (m_nextFile + skip + 1) % m_files.size();
+      m_loadingFiles.insert(path);
     }
+    ++m_loading;
 
-    m_nextTexCond.wait(lck);
-  } while (!m_exiting);
+    lck.unlock();
+    Image image;
+    bool loaded = true;
+    if (path.empty())
+      genTex(image);
+    else
+      loaded = loadImage(path, image);
+    lck.lock();
 
-  return;
+    --m_loading;
+    if (!path.empty())
+    {
+      m_loadingFiles.erase(path);
+      m_nextTexCond.notify_all();
+    }
+    if (loaded)
+      m_readyImages.push_back(std::move(image));
+    else
+    {
+      // Don't try it again until the next start()
+      auto it = std::find(m_files.begin(), m_files.end(), path);
+      if (it != m_files.end())
+      {
+        if (static_cast<size_t>(it - m_files.begin()) < m_nextFile)
+          --m_nextFile;
+        m_files.erase(it);
+        if (m_nextFile >= m_files.size())
+          m_nextFile = 0;
+      }
+    }
+  }
 }
@@ -8,17 +8,18 @@
 #pragma once
 
 #include <condition_variable>
-#include <dirent.h>
+#include <deque>
 #include <stdlib.h>
 #include <string>
 #include <thread>
 #include <mutex>
+#include <set>
+#include <vector>
 
 class TexMgr
 {
   public:
     TexMgr();
-    ~TexMgr();
 
     void setImageDir(const std::string& newDirName);
     void setTexSize(const unsigned int &w, const unsigned int &h) { m_tw = w; m_th = h; }
@@ -28,31 +29,39 @@ class TexMgr
     void stop();
 
     bool getNext();
-    unsigned int *getCurTex() const { return m_curTex; }
-    unsigned int getCurW() const { return m_curW; }
-    unsigned int getCurH() const { return m_curH; }
-    unsigned int *getPrevTex() const { return m_prevTex; }
-    unsigned int getPrevW() const { return m_prevW; }
-    unsigned int getPrevH() const { return m_prevH; }
+    unsigned int *getCurTex() { return m_cur.pixels.empty() ? nullptr : m_cur.pixels.data(); }
+    unsigned int getCurW() const { return m_cur.w; }
+    unsigned int getCurH() const { return m_cur.h; }
+    unsigned int *getPrevTex() { return m_prev.pixels.empty() ? nullptr : m_prev.pixels.data(); }
+    unsigned int getPrevW() const { return m_prev.w; }
+    unsigned int getPrevH() const { return m_prev.h; }
 
   private:
+    struct Image
+    {
+      std::vector<unsigned int> pixels;
+      unsigned int w = 0;
+      unsigned int h = 0;
+    };
+
     int m_tw = -2;
     int m_th = -2;
-    unsigned int* m_prevTex = nullptr;
-    unsigned int m_prevW = 0;
-    unsigned int m_prevH = 0;
-    unsigned int* m_curTex = nullptr;
-    unsigned int m_curW = 0;
-    unsigned int m_curH = 0;
-    unsigned int* m_nextTex = nullptr;
-    unsigned int m_nextW = 0;
-    unsigned int m_nextH = 0;
-    bool m_ready = false;
+    Image m_prev;
+    Image m_cur;
 
     std::string m_dirName;
-    DIR* m_imageDir = nullptr;
 
-    std::thread* m_imageThread = nullptr;
+    // Everything below up to m_exiting is shared with the image threads and
+    // guarded by m_nextTexMutex.  The threads only take it to pick the next
+    // file and to hand over a finished image, never while decoding.
+    std::vector<std::string> m_files;
+    bool m_scanned = false;
+    size_t m_nextFile = 0;
+    unsigned int m_loading = 0;
+    std::set<std::string> m_loadingFiles;
+    std::deque<Image> m_readyImages;
+
+    std::vector<std::thread> m_imageThreads;
     std::mutex m_nextTexMutex;
     std::condition_variable m_nextTexCond;
     volatile bool m_exiting = false;
@@ -60,9 +69,12 @@ class TexMgr
     unsigned int m_gw = 256;
     unsigned int m_gh = 256;
 
-    void genTex();
+    void genTex(Image& image);
 
-    void loadNextImageFromDisk();
+    std::vector<std::string> scanImageDir() const;
+    bool loadImage(const std::string& path, Image& image) const;
+    bool loadCachedImage(const std::string& file, const std::string& key, Image& image) const;
+    void saveCachedImage(const std::string& file, const std::string& key, const Image& image) const;
 
-    void imageThreadMain();
+    void imageThreadMain(bool scan);
 };
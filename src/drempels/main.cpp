@@ -14,9 +14,10 @@
  */
 
 #include "main.h"
-#include "gpoly.h"
+#include "warp.h"
 
 #include <chrono>
+#include <vector>
 #include <kodi/Filesystem.h>
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
@@ -77,24 +78,6 @@ struct sDrempelsSettings
   int   motion_blur = 7;    // goes from 0 to 10
 } gSettings;
 
-//------------------------------------------------------------------------------
-
-inline uint32_t rgbScale(const uint32_t c, const unsigned char scale)
-{
-  const uint32_t lsb = (((c & 0x00ff00ff) * scale) >> 8) & 0x00ff00ff;
-  const uint32_t msb = (((c & 0xff00ff00) >> 8) * scale) & 0xff00ff00;
-
-  return lsb | msb;
-}
-
-inline uint32_t rgbLerp(const uint32_t &c0, const uint32_t &c1, const uint16_t &scale)
-{
-  uint32_t sc0 = rgbScale(c0, 255 - (scale & 0xFF));
-  uint32_t sc1 = rgbScale(c1, (scale & 0xFF));
-
-  return sc0 + sc1;
-}
-
 } /* namespace */
 //------------------------------------------------------------------------------
 
@@ -136,29 +119,32 @@ bool CScreensaverDrempels::Start()
 
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-  // Seamless source texture
+  const unsigned int FXW = m_cells * m_cellResolution;
+  const unsigned int FXH = m_cells * m_cellResolution;
+
+  // Seamless source texture, its storage never changes after this.
+  // Immutable storage needs GL 4.2 or GLES 3.0.
   glGenTextures(1, &m_tex);
   glBindTexture(GL_TEXTURE_2D, m_tex);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+#if (defined(HAS_GL) && !defined(TARGET_DARWIN)) || (defined(HAS_GLES) && HAS_GLES == 3)
+  int major;
+  int minor;
+  kodi::gui::gl::GetVersion(major, minor);
+#if defined(HAS_GLES)
+  if (major >= 3)
+#else
+  if (major > 4 || (major == 4 && minor >= 2))
+#endif
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, FXW, FXH);
+  else
+#endif
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, FXW, FXH, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 
-  // Current texture (for fading)
-  glGenTextures(1, &m_ctex);
-  glBindTexture(GL_TEXTURE_2D, m_ctex);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-  // Previous texture (for fading)
-  glGenTextures(1, &m_ptex);
-  glBindTexture(GL_TEXTURE_2D, m_ptex);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+  m_pixelRing.Create(FXW * FXH * sizeof(uint32_t));
 
   // Indirect texture coordinate texture
   glGenTextures(1, &m_uvtex);
@@ -168,7 +154,7 @@ bool CScreensaverDrempels::Start()
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-  // Blurred result texture
+  // Blurred result texture, black until the first frame is copied into it
   glGenTextures(1, &m_btex);
   glBindTexture(GL_TEXTURE_2D, m_btex);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -176,8 +162,8 @@ bool CScreensaverDrempels::Start()
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-  unsigned char buf = 0;
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RED, GL_UNSIGNED_BYTE, &buf);
+  const std::vector<unsigned char> black(((FXW * 3 + 3) & ~3) * FXH, 0);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, FXW, FXH, 0, GL_RGB, GL_UNSIGNED_BYTE, black.data());
 
   m_quad[0].coord = glm::vec2(0.0f, 0.0f);
   m_quad[0].vertex = glm::vec3(0.0f, 0.0f, 0.0f);
@@ -223,14 +209,12 @@ void CScreensaverDrempels::Stop()
   m_indexVBO = 0;
   glDeleteTextures(1, &m_tex);
   m_tex = 0;
-  glDeleteTextures(1, &m_ptex);
-  m_ptex = 0;
-  glDeleteTextures(1, &m_ctex);
-  m_ctex = 0;
   glDeleteTextures(1, &m_uvtex);
   m_uvtex = 0;
   glDeleteTextures(1, &m_btex);
   m_btex = 0;
+
+  m_pixelRing.Destroy();
 }
 
 void CScreensaverDrempels::Render()
@@ -273,45 +257,19 @@ void CScreensaverDrempels::Render()
     if (m_textureManager.getNext())
     {
       m_lastTexChange = currentTime;
-
-      glBindTexture(GL_TEXTURE_2D, m_ctex);
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_textureManager.getCurW(), m_textureManager.getCurH(), 0, GL_RGBA, GL_UNSIGNED_BYTE, m_textureManager.getCurTex());
-
-      if (m_textureManager.getPrevTex())
-      {
-        glBindTexture(GL_TEXTURE_2D, m_ptex);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_textureManager.getPrevW(), m_textureManager.getPrevH(), 0, GL_RGBA, GL_UNSIGNED_BYTE, m_textureManager.getPrevTex());
-      }
-
       m_fadeComplete = false;
     }
   }
 
   if (m_textureManager.getPrevTex()
-    && (currentTime < m_lastTexChange + gSettings.dTexFadeInterval)
-    // Can only fade if the window is large enough to render both textures...
-    && (m_textureManager.getPrevW() < static_cast<unsigned int>(Width()))
-    && (m_textureManager.getPrevH() < static_cast<unsigned int>(Height()))
-    && (m_textureManager.getCurW() < static_cast<unsigned int>(Width()))
-    && (m_textureManager.getCurH() < static_cast<unsigned int>(Height()))
-    )
+    && (currentTime < m_lastTexChange + gSettings.dTexFadeInterval))
   {
     const double blend = (currentTime - m_lastTexChange) / gSettings.dTexFadeInterval;
 
-    glViewport(0, 0, m_textureManager.getPrevW(), m_textureManager.getPrevH());
-
-    glEnable(GL_BLEND);
-
-    glBindTexture (GL_TEXTURE_2D, m_ptex);
-    DrawQuads(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-
-    glBindTexture (GL_TEXTURE_2D, m_ctex);
-    DrawQuads(glm::vec4(1.0f, 1.0f, 1.0f, blend));
-
-    glDisable (GL_BLEND);
-
-    glBindTexture(GL_TEXTURE_2D, m_tex);
-    glReadPixels(0, 0, 256, 256, GL_RGBA, GL_UNSIGNED_BYTE, m_fadeBuf);
+    // Both textures are in memory already, so cross-fade them here rather
+    // than drawing them and reading the result back
+    Fade(m_textureManager.getPrevTex(), m_textureManager.getCurTex(),
+         static_cast<unsigned char>(blend * 255.0), m_fadeBuf, 256 * 256);
   }
   else if (!m_fadeComplete)
   {
@@ -575,18 +533,18 @@ void CScreensaverDrempels::Render()
 
     if (m_buf == nullptr)
       m_buf = new unsigned short [FXW * FXH * 2];
-    for (unsigned int jj = 0; jj < UVCELLSY - 2; jj += 2)
-    {
-      for (unsigned int ii = 0; ii < UVCELLSX - 2; ii += 2)
-      {
-        const unsigned int x0 = ii * m_cellResolution;
-        const unsigned int y0 = jj * m_cellResolution;
-        const unsigned int x1 = (ii + 2) * m_cellResolution;
-        const unsigned int y1 = (jj + 2) * m_cellResolution;
 
-        Warp(CELL(ii,jj), CELL(ii + 2,jj), CELL(ii,jj + 2), CELL(ii + 2,jj + 2), x1 - x0, y1 - y0, &m_buf[(y0 * FXW + x0) * 2], FXW * 2);
-      }
-    }
+    // Warp the texture into the next pixel buffer of the ring, or into
+    // m_buf if there are none
+    uint32_t *pixels = static_cast<uint32_t*>(m_pixelRing.Map());
+    if (!pixels)
+      pixels = reinterpret_cast<uint32_t*>(m_buf);
+
+    uint32_t *texbuf = m_fadeComplete ? m_textureManager.getCurTex() : m_fadeBuf;
+    WarpAndGather(m_cell, UVCELLSX, UVCELLSY, m_cellResolution, texbuf, m_buf, pixels);
+
+    glBindTexture(GL_TEXTURE_2D, m_tex);
+    m_pixelRing.Upload(FXW, FXH, pixels);
 
     const float blurAmount = 0.97f*pow(gSettings.motion_blur*0.1f, 0.27f);
 
@@ -601,35 +559,12 @@ void CScreensaverDrempels::Render()
     glEnable(GL_BLEND);
     glBindTexture(GL_TEXTURE_2D, m_tex);
 
-    unsigned short *uvbuf = m_buf;
-    uint32_t *texbuf = m_fadeComplete ? m_textureManager.getCurTex() : m_fadeBuf;
-    uint32_t *outbuf = (uint32_t *)m_buf;
-    for (unsigned int ii = 0; ii < FXW * FXH; ++ii)
-    {
-      const uint16_t u0 = *uvbuf++;
-      const uint16_t v0 = *uvbuf++;
-      const uint16_t u1 = u0 + 256;
-      const uint16_t v1 = v0 + 256;
-
-      const uint32_t tl = texbuf[(v0 & 0xff00) | (u0 >> 8)];
-      const uint32_t tr = texbuf[(v0 & 0xff00) | (u1 >> 8)];
-      const uint32_t bl = texbuf[(v1 & 0xff00) | (u0 >> 8)];
-      const uint32_t br = texbuf[(v1 & 0xff00) | (u1 >> 8)];
-
-      const uint32_t l = rgbLerp(tl, bl, v0);
-      const uint32_t r = rgbLerp(tr, br, v0);
-
-      *outbuf++ = rgbLerp(l, r, u0);
-    }
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, FXW, FXH, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_buf);
-
     DrawQuads(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f - blurAmount));
 
     glDisable(GL_BLEND);
     glBindTexture(GL_TEXTURE_2D, m_btex);
 
-    glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 0, 0, FXW, FXH, 0);
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, FXW, FXH);
 
     glViewport(X(), Y(), Width(), Height());
 
@@ -19,6 +19,7 @@
 
 #include <kodi/addon-instance/Screensaver.h>
 #include <kodi/gui/gl/GL.h>
+#include <kodi/gui/gl/PixelUnpackRing.h>
 #include <kodi/gui/gl/Shader.h>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -77,7 +78,11 @@ private:
   glm::mat4 m_projMat;
   glm::mat4 m_modelMat;
 
-  GLuint m_tex, m_ptex, m_ctex, m_uvtex, m_btex;
+  GLuint m_tex, m_uvtex, m_btex;
+
+  // The warped image is streamed through this, so the buffer being
+  // written is never still in use by an earlier upload
+  kodi::gui::gl::CPixelUnpackRing m_pixelRing;
 
   GLint m_projMatLoc = -1;
   GLint m_modelViewMatLoc = -1;
@@ -872,8 +872,15 @@ static void    *stbi__pnm_load(stbi__context *s, int *x, int *y, int *comp, int
 static int      stbi__pnm_info(stbi__context *s, int *x, int *y, int *comp);
 #endif
 
-// this is not threadsafe
+// thread local where the compiler can do it (as in later stb_image
+// versions), so that images can be loaded on several threads at once
+#if defined(__cplusplus) && __cplusplus >= 201103L
+static thread_local const char *stbi__g_failure_reason;
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+static _Thread_local const char *stbi__g_failure_reason;
+#else
 static const char *stbi__g_failure_reason;
+#endif
 
 STBIDEF const char *stbi_failure_reason(void)
 {
@@ -0,0 +1,160 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "warp.h"
+
+#include <rsThreads/rsWorkerPool.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+inline uint32_t rgbScale(const uint32_t c, const unsigned char scale)
+{
+  const uint32_t lsb = (((c & 0x00ff00ff) * scale) >> 8) & 0x00ff00ff;
+  const uint32_t msb = (((c & 0xff00ff00) >> 8) * scale) & 0xff00ff00;
+
+  return lsb | msb;
+}
+
+inline uint32_t rgbLerp(const uint32_t &c0, const uint32_t &c1, const uint16_t &scale)
+{
+  uint32_t sc0 = rgbScale(c0, 255 - (scale & 0xFF));
+  uint32_t sc1 = rgbScale(c1, (scale & 0xFF));
+
+  return sc0 + sc1;
+}
+
+#if defined(__SSE2__)
+// rgbLerp() on two pixels with one channel in each 16 bit lane.  Neither
+// product can overflow and the sum stays below 255, just like in rgbLerp().
+inline __m128i rgbLerp(__m128i c0, __m128i c1, __m128i scale)
+{
+  const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), scale);
+  return _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(c0, inverse), 8),
+                       _mm_srli_epi16(_mm_mullo_epi16(c1, scale), 8));
+}
+#endif
+
+} // namespace
+
+void Gather(const unsigned short* uv, const uint32_t* texture, uint32_t* out, unsigned int count)
+{
+  unsigned int ii = 0;
+
+#if defined(__SSE2__)
+  // SSE2 has no gather, so the texels are fetched one by one and only the
+  // filtering is done four pixels at a time
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i lowByte = _mm_set1_epi16(0xff);
+  for (; ii + 4 <= count; ii += 4)
+  {
+    const __m128i pos = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv));
+
+    // Texel indices of the four corners, as the scalar loop computes them
+    unsigned int tl[4], tr[4], bl[4], br[4];
+    for (int p = 0; p < 4; ++p)
+    {
+      const uint16_t u0 = uv[p * 2];
+      const uint16_t v0 = uv[p * 2 + 1];
+      const uint16_t u1 = u0 + 256;
+      const uint16_t v1 = v0 + 256;
+
+      tl[p] = (v0 & 0xff00) | (u0 >> 8);
+      tr[p] = (v0 & 0xff00) | (u1 >> 8);
+      bl[p] = (v1 & 0xff00) | (u0 >> 8);
+      br[p] = (v1 & 0xff00) | (u1 >> 8);
+    }
+    uv += 8;
+
+    // Fractions of u and v, repeated for the four channels of each pixel
+    const __m128i frac = _mm_and_si128(pos, lowByte);
+    const __m128i uLo = _mm_shufflelo_epi16(frac, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128i vLo = _mm_shufflelo_epi16(frac, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i uHi = _mm_shufflehi_epi16(frac, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128i vHi = _mm_shufflehi_epi16(frac, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128i fu[2] = {_mm_unpacklo_epi32(uLo, uLo), _mm_unpackhi_epi32(uHi, uHi)};
+    const __m128i fv[2] = {_mm_unpacklo_epi32(vLo, vLo), _mm_unpackhi_epi32(vHi, vHi)};
+
+    const __m128i tl4 = _mm_set_epi32(texture[tl[3]], texture[tl[2]], texture[tl[1]], texture[tl[0]]);
+    const __m128i tr4 = _mm_set_epi32(texture[tr[3]], texture[tr[2]], texture[tr[1]], texture[tr[0]]);
+    const __m128i bl4 = _mm_set_epi32(texture[bl[3]], texture[bl[2]], texture[bl[1]], texture[bl[0]]);
+    const __m128i br4 = _mm_set_epi32(texture[br[3]], texture[br[2]], texture[br[1]], texture[br[0]]);
+
+    __m128i result[2];
+    for (int half = 0; half < 2; ++half)
+    {
+      const __m128i tlh = half ? _mm_unpackhi_epi8(tl4, zero) : _mm_unpacklo_epi8(tl4, zero);
+      const __m128i trh = half ? _mm_unpackhi_epi8(tr4, zero) : _mm_unpacklo_epi8(tr4, zero);
+      const __m128i blh = half ? _mm_unpackhi_epi8(bl4, zero) : _mm_unpacklo_epi8(bl4, zero);
+      const __m128i brh = half ? _mm_unpackhi_epi8(br4, zero) : _mm_unpacklo_epi8(br4, zero);
+
+      const __m128i l = rgbLerp(tlh, blh, fv[half]);
+      const __m128i r = rgbLerp(trh, brh, fv[half]);
+      result[half] = rgbLerp(l, r, fu[half]);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(result[0], result[1]));
+    out += 4;
+  }
+#endif
+
+  for (; ii < count; ++ii)
+  {
+    const uint16_t u0 = *uv++;
+    const uint16_t v0 = *uv++;
+    const uint16_t u1 = u0 + 256;
+    const uint16_t v1 = v0 + 256;
+
+    const uint32_t tl = texture[(v0 & 0xff00) | (u0 >> 8)];
+    const uint32_t tr = texture[(v0 & 0xff00) | (u1 >> 8)];
+    const uint32_t bl = texture[(v1 & 0xff00) | (u0 >> 8)];
+    const uint32_t br = texture[(v1 & 0xff00) | (u1 >> 8)];
+
+    const uint32_t l = rgbLerp(tl, bl, v0);
+    const uint32_t r = rgbLerp(tr, br, v0);
+
+    *out++ = rgbLerp(l, r, u0);
+  }
+}
+
+void WarpAndGather(const td_cellcornerinfo* cells, unsigned int cellsX, unsigned int cellsY,
+                   unsigned int cellResolution, const uint32_t* texture, unsigned short* buf,
+                   uint32_t* out)
+{
+  const unsigned int FXW = (cellsX - 2) * cellResolution;
+  const unsigned int rows = (cellsY - 2) / 2;
+
+#define CELL(i,j) cells[((i) * cellsX) + (j)]
+
+  rsWorkerPool::shared().parallelFor(rows, [&](unsigned int row) {
+    const unsigned int jj = row * 2;
+    const unsigned int y0 = jj * cellResolution;
+    const unsigned int y1 = (jj + 2) * cellResolution;
+
+    for (unsigned int ii = 0; ii < cellsX - 2; ii += 2)
+    {
+      const unsigned int x0 = ii * cellResolution;
+      const unsigned int x1 = (ii + 2) * cellResolution;
+
+      Warp(CELL(ii,jj), CELL(ii + 2,jj), CELL(ii,jj + 2), CELL(ii + 2,jj + 2), x1 - x0, y1 - y0, &buf[(y0 * FXW + x0) * 2], FXW * 2);
+    }
+
+    Gather(&buf[y0 * FXW * 2], texture, &out[y0 * FXW], (y1 - y0) * FXW);
+  });
+
+#undef CELL
+}
+
+void Fade(const uint32_t* from, const uint32_t* to, unsigned char amount, uint32_t* out, unsigned int count)
+{
+  for (unsigned int ii = 0; ii < count; ++ii)
+    out[ii] = rgbLerp(from[ii], to[ii], amount);
+}
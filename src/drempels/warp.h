@@ -0,0 +1,35 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include "gpoly.h"
+
+#include <stdint.h>
+
+// Warps the 256x256 texture into the effect buffer.  For every pixel,
+// Warp() interpolates the texture position between the cell corners,
+// then the texture is sampled there with bilinear filtering.  The cells
+// are (cellsX - 2) / 2 by (cellsY - 2) / 2 blocks of 2 * cellResolution
+// pixels, given as corners like Render() sets them up.
+//
+// buf holds two shorts per pixel for the texture position and the RGBA
+// result goes to out, which may be buf itself or e.g. a mapped pixel
+// buffer that is only written.  The work is split into rows of cells on
+// the shared worker pool, and each row is finished while it is still in
+// the cache.  Nothing here touches OpenGL, so it can also be run on its own.
+void WarpAndGather(const td_cellcornerinfo* cells, unsigned int cellsX, unsigned int cellsY,
+                   unsigned int cellResolution, const uint32_t* texture, unsigned short* buf,
+                   uint32_t* out);
+
+// Sample texture with bilinear filtering at the 8.8 fixed point positions
+// in uv for count pixels.  out may be the same memory as uv.
+void Gather(const unsigned short* uv, const uint32_t* texture, uint32_t* out, unsigned int count);
+
+// Cross-fade count pixels from one texture to another, amount 0 giving
+// from and 255 (nearly) to
+void Fade(const uint32_t* from, const uint32_t* to, unsigned char amount, uint32_t* out, unsigned int count);
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+// Standalone timing of WarpAndGather() at several effect sizes, built with
+// -DDREMPELS_WARP_BENCHMARK=ON.  The cell corners and the texture come from
+// fixed seeds, so the checksums printed can be compared between builds.
+//
+//   drempels-warpbench [frames]
+
+#include "warp.h"
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace
+{
+
+struct sEffectSize
+{
+  unsigned int cells;
+  unsigned int cellResolution;
+};
+
+const sEffectSize effectSizes[] = {{8, 16}, {16, 16}, {16, 32}, {32, 32}, {64, 32}};
+
+// Cell corners like Render() sets them up: a grid of (u, v) positions with
+// a random displacement, and the derivatives taken from the neighbours
+void MakeCells(const sEffectSize& size, std::mt19937& random, std::vector<td_cellcornerinfo>& cell)
+{
+  const unsigned int UVCELLSX = size.cells + 2;
+  const unsigned int UVCELLSY = size.cells + 2;
+  const unsigned int FXW = size.cells * size.cellResolution;
+  const unsigned int FXH = size.cells * size.cellResolution;
+  const float u_delta = 0.05f;
+  const float v_delta = 0.05f;
+  const float int_scalar = 256.0f * (INTFACTOR);
+  std::uniform_real_distribution<float> displacement(-0.1f, 0.1f);
+
+  cell.assign(UVCELLSX * UVCELLSY, td_cellcornerinfo());
+
+#define CELL(i,j) cell[((i) * UVCELLSX) + (j)]
+
+  for (unsigned int i = 0; i < UVCELLSX; i++)
+  for (unsigned int j = 0; j < UVCELLSY; j++)
+  {
+    float u = (i / 2 * 2) / (float)(UVCELLSX - 2);
+    float v = (j / 2 * 2) / (float)(UVCELLSY - 2);
+    if (i & 1) u += u_delta;
+    if (j & 1) v += v_delta;
+
+    CELL(i,j).u = (u + displacement(random)) * int_scalar;
+    CELL(i,j).v = (v + displacement(random)) * int_scalar;
+  }
+
+  for (unsigned int j = 0; j < UVCELLSY; j++)
+  for (unsigned int i = 0; i < UVCELLSX - 1; i += 2)
+  {
+    CELL(i,j).r = (CELL(i+1,j).u - CELL(i,j).u) / (u_delta * FXW);
+    CELL(i,j).s = (CELL(i+1,j).v - CELL(i,j).v) / (v_delta * FXW);
+  }
+
+  for (unsigned int j = 0; j < UVCELLSY - 1; j += 2)
+  for (unsigned int i = 0; i < UVCELLSX; i += 2)
+  {
+    CELL(i,j).dudy = (CELL(i,j+1).u - CELL(i,j).u) / (u_delta * FXH);
+    CELL(i,j).dvdy = (CELL(i,j+1).v - CELL(i,j).v) / (v_delta * FXH);
+    CELL(i,j).drdy = (CELL(i,j+1).r - CELL(i,j).r) / (u_delta * FXH);
+    CELL(i,j).dsdy = (CELL(i,j+1).s - CELL(i,j).s) / (v_delta * FXH);
+  }
+
+#undef CELL
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int frames = argc > 1 ? atoi(argv[1]) : 100;
+  if (frames < 1)
+  {
+    fprintf(stderr, "usage: %s [frames]\n", argv[0]);
+    return 1;
+  }
+
+  std::mt19937 random(20210101);
+
+  std::vector<uint32_t> texture(256 * 256);
+  for (auto& texel : texture)
+    texel = 0xff000000 | (random() & 0x00ffffff);
+
+  printf("%8s %10s %12s %10s\n", "size", "ms/frame", "Mpixel/s", "checksum");
+
+  for (const auto& size : effectSizes)
+  {
+    const unsigned int cellsX = size.cells + 2;
+    const unsigned int cellsY = size.cells + 2;
+    const unsigned int FXW = size.cells * size.cellResolution;
+    const unsigned int FXH = size.cells * size.cellResolution;
+
+    std::vector<td_cellcornerinfo> cells;
+    MakeCells(size, random, cells);
+
+    std::vector<unsigned short> buf(FXW * FXH * 2);
+    std::vector<uint32_t> out(FXW * FXH);
+
+    // One frame before timing, so the worker pool is up
+    WarpAndGather(cells.data(), cellsX, cellsY, size.cellResolution, texture.data(), buf.data(), out.data());
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+      WarpAndGather(cells.data(), cellsX, cellsY, size.cellResolution, texture.data(), buf.data(), out.data());
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t checksum = 0;
+    for (const auto pixel : out)
+      checksum = checksum * 31 + pixel;
+
+    char name[32];
+    snprintf(name, sizeof(name), "%ux%u", FXW, FXH);
+    printf("%8s %10.3f %12.1f %10.8x\n", name, seconds * 1000.0 / frames,
+           double(FXW) * FXH * frames / seconds / 1000000.0, checksum);
+  }
+
+  return 0;
+}
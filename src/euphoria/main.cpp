@@ -575,16 +575,23 @@ bool CScreensaverEuphoria::Start()
 
     // Initialize texture
     gli::texture Texture(gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8, gli::texture::extent_type(TEXSIZE, TEXSIZE, 1), 1, 1, 1);
+    rsAsset* map = nullptr;
     switch(whichtex)
     {
     case TEXTURE_PLASMA:
-      std::memcpy(Texture.data(), plasmamap, Texture.size());
+      map = &plasmamap;
       break;
     case TEXTURE_STRINGY:
-      std::memcpy(Texture.data(), stringymap, Texture.size());
+      map = &stringymap;
       break;
     case TEXTURE_LINES:
-      std::memcpy(Texture.data(), linesmap, Texture.size());
+      map = &linesmap;
+    }
+    if (map)
+    {
+      if (const unsigned char* data = map->acquire())
+        std::memcpy(Texture.data(), data, Texture.size());
+      map->release();
     }
     m_texture = kodi::gui::gl::Load(Texture);
   }
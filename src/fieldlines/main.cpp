@@ -25,6 +25,108 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 #include <rsMath/rsMath.h>
+#include <rsThreads/rsWorkerPool.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+// rsRandf() for the worker threads, a small generator per field line that
+// is seeded from rand() on the calling thread
+class CLineRandom
+{
+public:
+  explicit CLineRandom(unsigned int seed) : m_state(seed | 1) {}
+
+  float operator()(float x)
+  {
+    m_state ^= m_state << 13;
+    m_state ^= m_state >> 17;
+    m_state ^= m_state << 5;
+    return x * (float(m_state >> 8) / float(0xffffff));
+  }
+
+private:
+  uint32_t m_state;
+};
+
+// Add the field of count ions at xyz to dir, for a line leaving an ion with
+// the given charge.  Returns the last ion closer than stepSize, or -1.
+int AddField(const float* ionX, const float* ionY, const float* ionZ, const float* ionCharge,
+             int count, float charge, const float* xyz, float stepSize, float* dir)
+{
+  int nearest = -1;
+  int j = 0;
+
+#if defined(__SSE2__)
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 step = _mm_set1_ps(stepSize);
+  const __m128 c = _mm_set1_ps(charge);
+  const __m128 x = _mm_set1_ps(xyz[0]);
+  const __m128 y = _mm_set1_ps(xyz[1]);
+  const __m128 z = _mm_set1_ps(xyz[2]);
+  for (; j + 4 <= count; j += 4)
+  {
+    const __m128 tx = _mm_sub_ps(x, _mm_loadu_ps(ionX + j));
+    const __m128 ty = _mm_sub_ps(y, _mm_loadu_ps(ionY + j));
+    const __m128 tz = _mm_sub_ps(z, _mm_loadu_ps(ionZ + j));
+    __m128 distsquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, tx), _mm_mul_ps(ty, ty)), _mm_mul_ps(tz, tz));
+    const __m128 dist = _mm_sqrt_ps(distsquared);
+
+    const int mask = _mm_movemask_ps(_mm_cmplt_ps(dist, step));
+    for (int k = 3; k >= 0; k--)
+    {
+      if (mask & (1 << k))
+      {
+        nearest = j + k;
+        break;
+      }
+    }
+
+    // Keeps a NaN like the scalar comparison below does
+    distsquared = _mm_max_ps(one, distsquared);
+    const __m128 repulsion = _mm_mul_ps(c, _mm_loadu_ps(ionCharge + j));
+    float force[3][4];
+    _mm_storeu_ps(force[0], _mm_div_ps(_mm_mul_ps(_mm_div_ps(tx, dist), repulsion), distsquared));
+    _mm_storeu_ps(force[1], _mm_div_ps(_mm_mul_ps(_mm_div_ps(ty, dist), repulsion), distsquared));
+    _mm_storeu_ps(force[2], _mm_div_ps(_mm_mul_ps(_mm_div_ps(tz, dist), repulsion), distsquared));
+
+    // Summed in the order of the ions, which keeps the lines exactly as
+    // the scalar loop draws them
+    for (int k = 0; k < 4; k++)
+    {
+      dir[0] += force[0][k];
+      dir[1] += force[1][k];
+      dir[2] += force[2][k];
+    }
+  }
+#endif
+
+  for (; j < count; j++)
+  {
+    const float repulsion = charge * ionCharge[j];
+    float tempvec[3] = {xyz[0] - ionX[j], xyz[1] - ionY[j], xyz[2] - ionZ[j]};
+    float distsquared = tempvec[0] * tempvec[0] + tempvec[1] * tempvec[1] + tempvec[2] * tempvec[2];
+    const float dist = sqrtf(distsquared);
+    if (dist < stepSize)
+      nearest = j;
+    tempvec[0] /= dist;
+    tempvec[1] /= dist;
+    tempvec[2] /= dist;
+    if (distsquared < 1.0f)
+      distsquared = 1.0f;
+    dir[0] += tempvec[0] * repulsion / distsquared;
+    dir[1] += tempvec[1] * repulsion / distsquared;
+    dir[2] += tempvec[2] * repulsion / distsquared;
+  }
+
+  return nearest;
+}
+
+} // namespace
 
 bool CScreensaverFieldLines::Start()
 {
@@ -69,7 +171,16 @@ bool CScreensaverFieldLines::Start()
   m_projMat = glm::mat4(1.0f);
   m_modelMat = glm::scale(glm::mat4(1.0f), glm::vec3(1.0f/m_usedDeep/m_reduction, 1.0f/m_usedDeep/m_reduction, 1.0f/m_usedDeep/m_reduction));
 
-  m_packets = new PackedVertex[m_maxSteps * 4 + 2];
+  // Room for the longest possible line in every slot
+  const size_t lines = m_ions.size() * 8;
+  m_ionX.resize(m_ions.size());
+  m_ionY.resize(m_ions.size());
+  m_ionZ.resize(m_ions.size());
+  m_ionCharge.resize(m_ions.size());
+  m_packets.resize(lines * (m_maxSteps * 2 + 2));
+  m_lines.resize(lines);
+  m_firsts.resize(lines);
+  m_counts.resize(lines);
 
   m_startOK = true;
   m_lastTime = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
@@ -91,7 +202,7 @@ void CScreensaverFieldLines::Stop()
   glDeleteBuffers(1, &m_vertexVBO);
   m_vertexVBO = 0;
 
-  delete[] m_packets;
+  m_ions.clear();
 }
 
 void CScreensaverFieldLines::Render()
@@ -133,18 +244,67 @@ void CScreensaverFieldLines::Render()
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
   static float s = float(sqrt(float(m_stepSize) * float(m_stepSize) * 0.333f));
-  for (auto& ion : m_ions)
+  static const float directions[8][3] = {
+    { 1.0f,  1.0f,  1.0f}, { 1.0f,  1.0f, -1.0f}, { 1.0f, -1.0f,  1.0f}, { 1.0f, -1.0f, -1.0f},
+    {-1.0f,  1.0f,  1.0f}, {-1.0f,  1.0f, -1.0f}, {-1.0f, -1.0f,  1.0f}, {-1.0f, -1.0f, -1.0f}};
+
+  // All ions move first, so the lines of every ion see the same field
+  for (size_t j = 0; j < m_ions.size(); ++j)
+  {
+    m_ions[j].update(frameTime);
+    m_ionX[j] = m_ions[j].xyz[0];
+    m_ionY[j] = m_ions[j].xyz[1];
+    m_ionZ[j] = m_ions[j].xyz[2];
+    m_ionCharge[j] = m_ions[j].charge;
+  }
+
+  if (m_electric)
+  {
+    for (auto& line : m_lines)
+      line.seed = rand();
+  }
+
+  // Every line gets a slot of the arena that fits the longest line
+  const unsigned int slot = m_maxSteps * 2 + 2;
+  rsWorkerPool::shared().parallelFor(m_lines.size(), [&](unsigned int line) {
+    const float* dir = directions[line % 8];
+    m_firsts[line] = line * slot;
+    m_counts[line] = fieldline(m_ions[line / 8], dir[0] * s, dir[1] * s, dir[2] * s,
+                               m_lines[line], &m_packets[line * slot]);
+  });
+
+  // Close the gaps between the lines, so they go up in one piece
+  GLint used = 0;
+  for (size_t line = 0; line < m_lines.size(); ++line)
+  {
+    if (m_firsts[line] != used)
+      memmove(&m_packets[used], &m_packets[m_firsts[line]], sizeof(PackedVertex) * m_counts[line]);
+    m_firsts[line] = used;
+    used += m_counts[line];
+  }
+
+  glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * used, m_packets.data(), GL_STREAM_DRAW);
+
+  if (m_constwidth)
   {
-    ion.update(frameTime);
-
-    drawfieldline(ion, s, s, s);
-    drawfieldline(ion, s, s, -s);
-    drawfieldline(ion, s, -s, s);
-    drawfieldline(ion, s, -s, -s);
-    drawfieldline(ion, -s, s, s);
-    drawfieldline(ion, -s, s, -s);
-    drawfieldline(ion, -s, -s, s);
-    drawfieldline(ion, -s, -s, -s);
+#ifndef HAS_GLES
+    glMultiDrawArrays(GL_LINE_STRIP, m_firsts.data(), m_counts.data(), m_lines.size());
+#else
+    for (size_t line = 0; line < m_lines.size(); ++line)
+      glDrawArrays(GL_LINE_STRIP, m_firsts[line], m_counts[line]);
+#endif
+  }
+  else
+  {
+    // The width is GL state, so lines of their own width are drawn one by
+    // one, with the first segment drawn on its own first as before
+    for (size_t line = 0; line < m_lines.size(); ++line)
+    {
+      glLineWidth(m_lines[line].firstWidth);
+      glDrawArrays(GL_LINE_STRIP, m_firsts[line], 2);
+      glLineWidth(m_lines[line].width);
+      glDrawArrays(GL_LINE_STRIP, m_firsts[line], m_counts[line]);
+    }
   }
 
   DisableShader();
@@ -153,19 +313,19 @@ void CScreensaverFieldLines::Render()
   glDisableVertexAttribArray(m_hCol);
 }
 
-void CScreensaverFieldLines::drawfieldline(CIon& ion, float x, float y, float z)
+unsigned int CScreensaverFieldLines::fieldline(const CIon& ion, float x, float y, float z,
+                                               sFieldLine& line, PackedVertex* packets) const
 {
   float charge;
-  float repulsion;
-  float dist, distsquared, distrec;
+  float distsquared, distrec;
   float xyz[3];
   float lastxyz[3];
   float dir[3];
   float end[3];
-  float tempvec[3];
   float r, g, b;
   float lastr, lastg, lastb;
-  static float brightness = 10000.0f;
+  static const float brightness = 10000.0f;
+  CLineRandom random(line.seed);
 
   charge = ion.charge;
   lastxyz[0] = ion.xyz[0];
@@ -193,35 +353,29 @@ void CScreensaverFieldLines::drawfieldline(CIon& ion, float x, float y, float z)
   xyz[2] = lastxyz[2] + dir[2];
   if (m_electric)
   {
-    xyz[0] += rsRandf(float(m_stepSize) * 0.2f) - (float(m_stepSize) * 0.1f);
-    xyz[1] += rsRandf(float(m_stepSize) * 0.2f) - (float(m_stepSize) * 0.1f);
-    xyz[2] += rsRandf(float(m_stepSize) * 0.2f) - (float(m_stepSize) * 0.1f);
+    xyz[0] += random(float(m_stepSize) * 0.2f) - (float(m_stepSize) * 0.1f);
+    xyz[1] += random(float(m_stepSize) * 0.2f) - (float(m_stepSize) * 0.1f);
+    xyz[2] += random(float(m_stepSize) * 0.2f) - (float(m_stepSize) * 0.1f);
   }
 
   unsigned int ptr = 0;
 
-  m_packets[ptr].x = lastxyz[0];
-  m_packets[ptr].y = lastxyz[1];
-  m_packets[ptr].z = lastxyz[2];
-  m_packets[ptr].r = lastr;
-  m_packets[ptr].g = lastg;
-  m_packets[ptr].b = lastb;
+  packets[ptr].x = lastxyz[0];
+  packets[ptr].y = lastxyz[1];
+  packets[ptr].z = lastxyz[2];
+  packets[ptr].r = lastr;
+  packets[ptr].g = lastg;
+  packets[ptr].b = lastb;
   ptr++;
-  m_packets[ptr].x = xyz[0];
-  m_packets[ptr].y = xyz[1];
-  m_packets[ptr].z = xyz[2];
-  m_packets[ptr].r = r;
-  m_packets[ptr].g = g;
-  m_packets[ptr].b = b;
+  packets[ptr].x = xyz[0];
+  packets[ptr].y = xyz[1];
+  packets[ptr].z = xyz[2];
+  packets[ptr].r = r;
+  packets[ptr].g = g;
+  packets[ptr].b = b;
   ptr++;
 
-  if (!m_constwidth)
-  {
-    glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex)*ptr, &m_packets[0], GL_STATIC_DRAW);
-    glLineWidth((xyz[2] + 300.0f) * 0.000333f * float(m_width));
-    glDrawArrays(GL_LINE_STRIP, 0, ptr);
-//     ptr = 0; // Unused to prevent wrong size in middle
-  }
+  line.firstWidth = (xyz[2] + 300.0f) * 0.000333f * float(m_width);
 
   int i;
   for (i = 0; i < m_maxSteps; i++)
@@ -229,29 +383,14 @@ void CScreensaverFieldLines::drawfieldline(CIon& ion, float x, float y, float z)
     dir[0] = 0.0f;
     dir[1] = 0.0f;
     dir[2] = 0.0f;
-    for (int j = 0; j < m_ionsCnt; j++)
+    const int nearest = AddField(m_ionX.data(), m_ionY.data(), m_ionZ.data(), m_ionCharge.data(),
+                                 m_ionCharge.size(), charge, xyz, float(m_stepSize), dir);
+    if (nearest >= 0 && i > 2)
     {
-      repulsion = charge * m_ions[j].charge;
-      tempvec[0] = xyz[0] - m_ions[j].xyz[0];
-      tempvec[1] = xyz[1] - m_ions[j].xyz[1];
-      tempvec[2] = xyz[2] - m_ions[j].xyz[2];
-      distsquared = tempvec[0] * tempvec[0] + tempvec[1] * tempvec[1] + tempvec[2] * tempvec[2];
-      dist = float(sqrt(distsquared));
-      if (dist < float(m_stepSize) && i > 2)
-      {
-        end[0] = m_ions[j].xyz[0];
-        end[1] = m_ions[j].xyz[1];
-        end[2] = m_ions[j].xyz[2];
-        i = 10000;
-      }
-      tempvec[0] /= dist;
-      tempvec[1] /= dist;
-      tempvec[2] /= dist;
-      if (distsquared < 1.0f)
-        distsquared = 1.0f;
-      dir[0] += tempvec[0] * repulsion / distsquared;
-      dir[1] += tempvec[1] * repulsion / distsquared;
-      dir[2] += tempvec[2] * repulsion / distsquared;
+      end[0] = m_ionX[nearest];
+      end[1] = m_ionY[nearest];
+      end[2] = m_ionZ[nearest];
+      i = 10000;
     }
     lastr = r;
     lastg = g;
@@ -282,9 +421,9 @@ void CScreensaverFieldLines::drawfieldline(CIon& ion, float x, float y, float z)
     dir[2] *= distrec;
     if (m_electric)
     {
-      dir[0] += rsRandf(float(m_stepSize)) - (float(m_stepSize) * 0.5f);
-      dir[1] += rsRandf(float(m_stepSize)) - (float(m_stepSize) * 0.5f);
-      dir[2] += rsRandf(float(m_stepSize)) - (float(m_stepSize) * 0.5f);
+      dir[0] += random(float(m_stepSize)) - (float(m_stepSize) * 0.5f);
+      dir[1] += random(float(m_stepSize)) - (float(m_stepSize) * 0.5f);
+      dir[2] += random(float(m_stepSize)) - (float(m_stepSize) * 0.5f);
     }
     lastxyz[0] = xyz[0];
     lastxyz[1] = xyz[1];
@@ -293,51 +432,49 @@ void CScreensaverFieldLines::drawfieldline(CIon& ion, float x, float y, float z)
     xyz[1] += dir[1];
     xyz[2] += dir[2];
 
-    m_packets[ptr].r = lastr;
-    m_packets[ptr].g = lastg;
-    m_packets[ptr].b = lastb;
-    m_packets[ptr].x = lastxyz[0];
-    m_packets[ptr].y = lastxyz[1];
-    m_packets[ptr].z = lastxyz[2];
+    packets[ptr].r = lastr;
+    packets[ptr].g = lastg;
+    packets[ptr].b = lastb;
+    packets[ptr].x = lastxyz[0];
+    packets[ptr].y = lastxyz[1];
+    packets[ptr].z = lastxyz[2];
     ptr++;
 
     if (i != 10000)
     {
       if (i == (m_maxSteps - 1))
       {
-        m_packets[ptr].r = 0.0f;
-        m_packets[ptr].g = 0.0f;
-        m_packets[ptr].b = 0.0f;
+        packets[ptr].r = 0.0f;
+        packets[ptr].g = 0.0f;
+        packets[ptr].b = 0.0f;
       }
       else
       {
-        m_packets[ptr].r = r;
-        m_packets[ptr].g = g;
-        m_packets[ptr].b = b;
+        packets[ptr].r = r;
+        packets[ptr].g = g;
+        packets[ptr].b = b;
       }
-      m_packets[ptr].x = lastxyz[0];
-      m_packets[ptr].y = lastxyz[1];
-      m_packets[ptr].z = lastxyz[2];
+      packets[ptr].x = lastxyz[0];
+      packets[ptr].y = lastxyz[1];
+      packets[ptr].z = lastxyz[2];
       ptr++;
     }
   }
 
   if (i == 10001)
   {
-    m_packets[ptr].r = r;
-    m_packets[ptr].g = g;
-    m_packets[ptr].b = b;
-    m_packets[ptr].x = end[0];
-    m_packets[ptr].y = end[1];
-    m_packets[ptr].z = end[2];
+    packets[ptr].r = r;
+    packets[ptr].g = g;
+    packets[ptr].b = b;
+    packets[ptr].x = end[0];
+    packets[ptr].y = end[1];
+    packets[ptr].z = end[2];
     ptr++;
   }
 
-  if (!m_constwidth)
-    glLineWidth((xyz[2] + 300.0f) * 0.000333f * float(m_width));
+  line.width = (xyz[2] + 300.0f) * 0.000333f * float(m_width);
 
-  glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex)*ptr, &m_packets[0], GL_STATIC_DRAW);
-  glDrawArrays(GL_LINE_STRIP, 0, ptr);
+  return ptr;
 }
 
 void CScreensaverFieldLines::OnCompiledAndLinked()
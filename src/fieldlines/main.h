@@ -31,6 +31,14 @@ struct PackedVertex
   float r, g, b;
 };
 
+// What a frame needs to know about each field line besides its vertices
+struct sFieldLine
+{
+  unsigned int seed;  // for the random offsets of electric lines
+  float firstWidth;   // line width for the first segment
+  float width;        // line width for the whole line
+};
+
 class ATTR_DLL_LOCAL CScreensaverFieldLines
   : public kodi::addon::CAddonBase,
     public kodi::addon::CInstanceScreensaver,
@@ -52,12 +60,23 @@ public:
   inline float RenderDeep() const { return m_usedDeep; }
 
 private:
-  void drawfieldline(CIon& ion, float x, float y, float z);
+  unsigned int fieldline(const CIon& ion, float x, float y, float z, sFieldLine& line, PackedVertex* packets) const;
 
   double m_lastTime;
   std::vector<CIon> m_ions;
 
-  PackedVertex* m_packets = nullptr;
+  // Positions and charges of the ions, one array per component, so the
+  // field can be summed over several ions at once
+  std::vector<float> m_ionX;
+  std::vector<float> m_ionY;
+  std::vector<float> m_ionZ;
+  std::vector<float> m_ionCharge;
+
+  // All field lines of a frame, one after the other
+  std::vector<PackedVertex> m_packets;
+  std::vector<sFieldLine> m_lines;
+  std::vector<GLint> m_firsts;
+  std::vector<GLsizei> m_counts;
 
   unsigned int m_vertexVBO = 0;
 
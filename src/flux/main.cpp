@@ -21,470 +21,131 @@
 #include <glm/ext.hpp>
 #include <Rgbhsl/Rgbhsl.h>
 #include <rsMath/rsMath.h>
+#include <rsThreads/rsWorkerPool.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Override GL_RED if not present with GL_LUMINANCE, e.g. on Android GLES
 #ifndef GL_RED
 #define GL_RED GL_LUMINANCE
 #endif
 
-// Parameters edited in the dialog box
-
-#define PRESET_AUTO_SELECTION 0
-#define PRESET_REGULAR 1
-#define PRESET_HYPNOTIC 2
-#define PRESET_INSANE 3
-#define PRESET_SPARKLERS 4
-#define PRESET_PARADIGM 5
-#define PRESET_GALACTIC 6
-#define PRESET_ADVANCED_SETTINGS -1
-
-#define GEOMETRY_POINTS 0
-#define GEOMETRY_SPHERES 1
-#define GEOMETRY_LIGHTS 2
-
-namespace {
-
-int gWhichparticle;
-
-struct sFluxSettings
-{
-  sFluxSettings()
-  {
-    SetDefaults(PRESET_REGULAR);
-  }
-
-  void Load()
-  {
-    int type = PRESET_REGULAR;
-    kodi::addon::CheckSettingInt("general.type", type);
-    if (type == PRESET_AUTO_SELECTION)
-      SetDefaults(rsRandi(6) + 1);
-    else
-      SetDefaults(type);
-
-    if (type != PRESET_ADVANCED_SETTINGS &&
-        type != kodi::addon::GetSettingInt("general.lastType"))
-    {
-      kodi::addon::SetSettingInt("general.lastType", type);
-
-      kodi::addon::SetSettingInt("advanced.fluxes", dFluxes);
-      kodi::addon::SetSettingInt("advanced.particles", dParticles);
-      kodi::addon::SetSettingInt("advanced.trail", dTrail);
-      kodi::addon::SetSettingInt("advanced.geometry", dGeometry);
-      kodi::addon::SetSettingInt("advanced.size", dSize);
-      kodi::addon::SetSettingInt("advanced.complexity", dRandomize);
-      kodi::addon::SetSettingInt("advanced.randomize", dExpansion);
-      kodi::addon::SetSettingInt("advanced.expansion", dRotation);
-      kodi::addon::SetSettingInt("advanced.rotation", dWind);
-      kodi::addon::SetSettingInt("advanced.instability", dInstability);
-      kodi::addon::SetSettingInt("advanced.blur", dBlur);
-    }
-  }
-
-  void SetDefaults(int preset)
-  {
-    switch (preset)
-    {
-    case PRESET_REGULAR:  // Regular
-      dFluxes = 1;
-      dParticles = 20;
-      dTrail = 40;
-      dGeometry = GEOMETRY_LIGHTS;
-      dSize = 15;
-      dComplexity = 3;
-      dRandomize = 0;
-      dExpansion = 40;
-      dRotation = 30;
-      dWind = 20;
-      dInstability = 20;
-      dBlur = 0;
-      break;
-    case PRESET_HYPNOTIC:  // Hypnotic
-      dFluxes = 2;
-      dParticles = 10;
-      dTrail = 40;
-      dGeometry = GEOMETRY_LIGHTS;
-      dSize = 15;
-      dRandomize = 80;
-      dExpansion = 20;
-      dRotation = 0;
-      dWind = 40;
-      dInstability = 10;
-      dBlur = 30;
-      break;
-    case PRESET_INSANE:  // Insane
-      dFluxes = 4;
-      dParticles = 30;
-      dTrail = 8;
-      dGeometry = GEOMETRY_LIGHTS;
-      dSize = 25;
-      dRandomize = 0;
-      dExpansion = 80;
-      dRotation = 60;
-      dWind = 40;
-      dInstability = 100;
-      dBlur = 10;
-      break;
-    case PRESET_SPARKLERS:  // Sparklers
-      dFluxes = 3;
-      dParticles = 20;
-      dTrail = 6;
-      dGeometry = GEOMETRY_SPHERES;
-      dSize = 20;
-      dComplexity = 3;
-      dRandomize = 85;
-      dExpansion = 60;
-      dRotation = 30;
-      dWind = 20;
-      dInstability = 30;
-      dBlur = 0;
-      break;
-    case PRESET_PARADIGM:  // Paradigm
-      dFluxes = 1;
-      dParticles = 40;
-      dTrail = 40;
-      dGeometry = GEOMETRY_LIGHTS;
-      dSize = 5;
-      dRandomize = 90;
-      dExpansion = 30;
-      dRotation = 20;
-      dWind = 10;
-      dInstability = 5;
-      dBlur = 10;
-      break;
-    case PRESET_GALACTIC:  // Galactic
-      dFluxes = 3;
-      dParticles = 2;
-      dTrail = 1500;
-      dGeometry = GEOMETRY_LIGHTS;
-      dSize = 10;
-      dRandomize = 0;
-      dExpansion = 5;
-      dRotation = 25;
-      dWind = 0;
-      dInstability = 5;
-      dBlur = 0;
-      break;
-    case PRESET_ADVANCED_SETTINGS:  // Galactic
-      dFluxes = kodi::addon::GetSettingInt("advanced.fluxes");
-      dParticles = kodi::addon::GetSettingInt("advanced.particles");
-      dTrail = kodi::addon::GetSettingInt("advanced.trail");
-      dGeometry = kodi::addon::GetSettingInt("advanced.geometry");
-      dSize = kodi::addon::GetSettingInt("advanced.size");
-      dRandomize = kodi::addon::GetSettingInt("advanced.complexity");
-      dExpansion = kodi::addon::GetSettingInt("advanced.randomize");
-      dRotation = kodi::addon::GetSettingInt("advanced.expansion");
-      dWind = kodi::addon::GetSettingInt("advanced.rotation");
-      dInstability = kodi::addon::GetSettingInt("advanced.instability");
-      dBlur = kodi::addon::GetSettingInt("advanced.blur");
-    }
-  }
-
-  int dFluxes;
-  int dParticles;
-  int dTrail;
-  int dGeometry;
-  int dSize;
-  int dComplexity;
-  int dRandomize;
-  int dExpansion;
-  int dRotation;
-  int dWind;
-  int dInstability;
-  int dBlur;
-} gSettings;
-}
-
 //------------------------------------------------------------------------------
 
 
-// This class is poorly named.  It's actually a whole trail of particles.
-class CParticle
+// This class is a set of particle trails and constants that enter
+// into their equations of motion.
+//
+// The trails of all particles share one ring buffer in structure of arrays
+// form: slot s of particle i lives at index s * m_numParticles + i, so the
+// new heads and the expansion of every trail vertex are plain loops over
+// contiguous floats.  All trails advance together, so one counter marks the
+// newest slot for every particle.
+//
+// Particles are updated and drawn in jobs of neighbouring particles that
+// only touch their own part of the trails and of the batch, so the jobs of
+// a flux can run on the worker pool.  Everything that draws random numbers
+// stays on the calling thread, in the same order as before.
+class CFlux
 {
 public:
-  CParticle();
-  ~CParticle();
-  void update(float *c, CScreensaverFlux* base);
+  CFlux() = default;
+  void init(const sFluxSettings& settings);
+  void update(CScreensaverFlux* base);
 
 private:
-  float **m_vertices;
-  int m_counter;
-  float m_offset[3];
+  float updateHeads(int begin, int end);
+  void bringBack();
+  void draw(const CScreensaverFlux* base, int begin, int end, std::vector<sLight>& batch) const;
+  void expand();
 
-  float m_expander = 1.0f + 0.0005f * float(gSettings.dExpansion);
-  float m_blower = 0.001f * float(gSettings.dWind);
-  float m_otherxyz[3];
-};
+  int m_numParticles = 0;
+  int m_trail = 0;
+  int m_counter = 0;
+  int m_particlesPerJob = 1;
+
+  // trail vertices
+  std::vector<float> m_x, m_y, m_z;
+  // trail colors at full luminosity, dimmed by the age of each vertex
+  std::vector<float> m_r, m_g, m_b;
 
-CParticle::CParticle()
-{
   // Offsets are somewhat like default positions for the head of each
   // particle trail.  Offsets spread out the particle trails and keep
   // them from all overlapping.
-  m_offset[0] = cosf(2 * glm::pi<float>() * float(gWhichparticle) / float(gSettings.dParticles));
-  m_offset[1] = float(gWhichparticle) / float(gSettings.dParticles) - 0.5f;
-  m_offset[2] = sinf(2 * glm::pi<float>() * float(gWhichparticle) / float(gSettings.dParticles));
-  gWhichparticle++;
-
-  // Initialize memory and set initial positions out of view of the camera
-  m_vertices = new float*[gSettings.dTrail];
-  for (int i = 0; i < gSettings.dTrail; i++){
-    m_vertices[i] = new float[5];  // 0,1,2 = position, 3 = hue, 4 = saturation
-    m_vertices[i][0] = 0.0f;
-    m_vertices[i][1] = 3.0f;
-    m_vertices[i][2] = 0.0f;
-    m_vertices[i][3] = 0.0f;
-    m_vertices[i][4] = 0.0f;
-  }
+  std::vector<float> m_offsetX, m_offsetY, m_offsetZ;
 
-  m_counter = 0;
-}
+  float m_expander;
+  float m_blower;
 
-CParticle::~CParticle()
-{
-  for (int i = 0; i < gSettings.dTrail; i++)
-    delete[] m_vertices[i];
-  delete[] m_vertices;
-}
+  int m_randomize;
+  float m_c[NUMCONSTS];     // constants
+  float m_cv[NUMCONSTS];    // constants' change velocities
 
-void CParticle::update(float *c, CScreensaverFlux* base)
-{
-  int i, p, growth;
-  float rgb[3];
-  float cx, cy, cz;  // Containment variables
-  float luminosity;
-  float depth;
+  float m_orbitiness = 0.0f;
+  float m_prevOrbitiness = 0.0f;
 
-  // Record old position
-  int oldc = m_counter;
+  // results of each job, gathered in job order
+  std::vector<float> m_jobOrbitiness;
+  std::vector<std::vector<sLight>> m_jobBatches;
+  std::vector<sLight> m_batch;
+};
 
-  m_counter ++;
-  if (m_counter >= gSettings.dTrail)
-    m_counter = 0;
+void CFlux::init(const sFluxSettings& settings)
+{
+  int i;
 
-  // Here's the iterative math for calculating new vertex positions
-  // first calculate limiting terms which keep vertices from constantly
-  // flying off to infinity
-  cx = m_vertices[oldc][0] * (1.0f - 1.0f / (m_vertices[oldc][0] * m_vertices[oldc][0] + 1.0f));
-  cy = m_vertices[oldc][1] * (1.0f - 1.0f / (m_vertices[oldc][1] * m_vertices[oldc][1] + 1.0f));
-  cz = m_vertices[oldc][2] * (1.0f - 1.0f / (m_vertices[oldc][2] * m_vertices[oldc][2] + 1.0f));
-  // then calculate new positions
-  m_vertices[m_counter][0] = m_vertices[oldc][0] + c[6] * m_offset[0] - cx
-    + c[2] * m_vertices[oldc][1]
-    + c[5] * m_vertices[oldc][2];
-  m_vertices[m_counter][1] = m_vertices[oldc][1] + c[6] * m_offset[1] - cy
-    + c[1] * m_vertices[oldc][2]
-    + c[4] * m_vertices[oldc][0];
-  m_vertices[m_counter][2] = m_vertices[oldc][2] + c[6] * m_offset[2] - cz
-    + c[0] * m_vertices[oldc][0]
-    + c[3] * m_vertices[oldc][1];
-
-  // calculate "orbitiness" of particles
-  const float xdiff(m_vertices[m_counter][0] - m_vertices[oldc][0]);
-  const float ydiff(m_vertices[m_counter][1] - m_vertices[oldc][1]);
-  const float zdiff(m_vertices[m_counter][2] - m_vertices[oldc][2]);
-  const float distsq(m_vertices[m_counter][0] * m_vertices[m_counter][0]
-                   + m_vertices[m_counter][1] * m_vertices[m_counter][1]
-                   + m_vertices[m_counter][2] * m_vertices[m_counter][2]);
-  const float oldDistsq(m_vertices[oldc][0] * m_vertices[oldc][0]
-                      + m_vertices[oldc][1] * m_vertices[oldc][1]
-                      + m_vertices[oldc][2] * m_vertices[oldc][2]);
-  base->m_orbitiness += (xdiff * xdiff + ydiff * ydiff + zdiff * zdiff)
-                          / (2.0f - fabs(distsq - oldDistsq));
-
-  // Pick a hue
-  m_vertices[m_counter][3] = cx * cx + cy * cy + cz * cz;
-  if (m_vertices[m_counter][3] > 1.0f)
-    m_vertices[m_counter][3] = 1.0f;
-  m_vertices[m_counter][3] += c[7];
-  // Limit the hue (0 - 1)
-  if (m_vertices[m_counter][3] > 1.0f)
-    m_vertices[m_counter][3] -= 1.0f;
-  if (m_vertices[m_counter][3] < 0.0f)
-    m_vertices[m_counter][3] += 1.0f;
-  // Pick a saturation
-  m_vertices[m_counter][4] = c[0] + m_vertices[m_counter][3];
-  // Limit the saturation (0 - 1)
-  if (m_vertices[m_counter][4] < 0.0f)
-    m_vertices[m_counter][4] = -m_vertices[m_counter][4];
-  m_vertices[m_counter][4] -= float(int(m_vertices[m_counter][4]));
-  m_vertices[m_counter][4] = 1.0f - (m_vertices[m_counter][4] * m_vertices[m_counter][4]);
+  m_numParticles = settings.dParticles;
+  m_trail = settings.dTrail;
+  m_counter = 0;
+  m_expander = 1.0f + 0.0005f * float(settings.dExpansion);
+  m_blower = 0.001f * float(settings.dWind);
 
-  // Bring particles back if they escape
-  if (!m_counter)
-  {
-    if (m_vertices[m_counter][0] * m_vertices[m_counter][0]
-      + m_vertices[m_counter][1] * m_vertices[m_counter][1]
-      + m_vertices[m_counter][2] * m_vertices[m_counter][2] > 100000000.0f)
-    {
-      m_vertices[m_counter][0] = rsRandf(2.0f) - 1.0f;
-      m_vertices[m_counter][1] = rsRandf(2.0f) - 1.0f;
-      m_vertices[m_counter][2] = rsRandf(2.0f) - 1.0f;
-    }
-  }
+  // Hand roughly 2000 trail vertices to each job
+  m_particlesPerJob = std::max(1, 2048 / std::max(1, m_trail));
 
-  // Draw every vertex in particle trail
-  p = m_counter;
-  growth = 0;
-  luminosity = base->m_lumdiff;
-  for (i = 0; i < gSettings.dTrail; i++)
+  m_offsetX.resize(m_numParticles);
+  m_offsetY.resize(m_numParticles);
+  m_offsetZ.resize(m_numParticles);
+  for (i = 0; i < m_numParticles; i++)
   {
-    p ++;
-    if (p >= gSettings.dTrail)
-      p = 0;
-    growth++;
-
-    if (m_vertices[p][0] * m_vertices[p][0]
-      + m_vertices[p][1] * m_vertices[p][1]
-      + m_vertices[p][2] * m_vertices[p][2] < 40000.0f)
-    {
-      // assign color to particle
-      hsl2rgb(m_vertices[p][3], m_vertices[p][4], luminosity, rgb[0], rgb[1], rgb[2]);
-      base->m_uniformColor = glm::vec4(rgb[0], rgb[1], rgb[2], 1.0f);
-
-      glm::mat4 modelMatrix = base->m_modelMat;
-
-      switch(gSettings.dGeometry)
-      {
-        case GEOMETRY_POINTS:  // Points
-        {
-          depth = base->m_cosCameraAngle * m_vertices[p][2] - base->m_sinCameraAngle * m_vertices[p][0];
-          base->m_modelMat = glm::translate(base->m_modelMat, glm::vec3(base->m_cosCameraAngle * m_vertices[p][0] +
-                                                                        base->m_sinCameraAngle * m_vertices[p][2], m_vertices[p][1], depth));
-#if !defined(HAS_GLES)
-          switch(gSettings.dTrail - growth)
-          {
-          case 0:
-            glPointSize(float(gSettings.dSize * (depth + 200.0f) * 0.001036f));
-            break;
-          case 1:
-            glPointSize(float(gSettings.dSize * (depth + 200.0f) * 0.002f));
-            break;
-          case 2:
-            glPointSize(float(gSettings.dSize * (depth + 200.0f) * 0.002828f));
-            break;
-          case 3:
-            glPointSize(float(gSettings.dSize * (depth + 200.0f) * 0.003464f));
-            break;
-          case 4:
-            glPointSize(float(gSettings.dSize * (depth + 200.0f) * 0.003864f));
-            break;
-          default:
-            glPointSize(float(gSettings.dSize * (depth + 200.0f) * 0.004f));
-          }
-#endif
-          base->DrawPoint();
-          break;
-        }
-        case GEOMETRY_SPHERES:  // Spheres
-        {
-          base->m_modelMat = glm::translate(base->m_modelMat, glm::vec3(m_vertices[p][0], m_vertices[p][1], m_vertices[p][2]));
-          switch(gSettings.dTrail - growth)
-          {
-          case 0:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.259f, 0.259f, 0.259f));
-            break;
-          case 1:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.5, 0.5, 0.5));
-            break;
-          case 2:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.707f, 0.707f, 0.707f));
-            break;
-          case 3:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.866f, 0.866f, 0.866f));
-            break;
-          case 4:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.966f, 0.966f, 0.966f));
-          }
-          base->DrawSphere();
-          break;
-        }
-        case GEOMETRY_LIGHTS:  // Lights
-        {
-          depth = base->m_cosCameraAngle * m_vertices[p][2] - base->m_sinCameraAngle * m_vertices[p][0];
-          base->m_modelMat = glm::translate(base->m_modelMat, glm::vec3(base->m_cosCameraAngle * m_vertices[p][0] +
-                                                                        base->m_sinCameraAngle * m_vertices[p][2], m_vertices[p][1], depth));
-          switch(gSettings.dTrail - growth)
-          {
-          case 0:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.259f, 0.259f, 0.259f));
-            break;
-          case 1:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.5, 0.5, 0.5));
-            break;
-          case 2:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.707f, 0.707f, 0.707f));
-            break;
-          case 3:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.866f, 0.866f, 0.866f));
-            break;
-          case 4:
-            base->m_modelMat = glm::scale(base->m_modelMat, glm::vec3(0.966f, 0.966f, 0.966f));
-          }
-          base->DrawTriangles();
-        }
-      }
-      base->m_modelMat = modelMatrix;
-    }
-
-    m_vertices[p][0] *= m_expander;
-    m_vertices[p][1] *= m_expander;
-    m_vertices[p][2] *= m_expander;
-    m_vertices[p][2] += m_blower;
-    luminosity += base->m_lumdiff;
+    m_offsetX[i] = cosf(2 * glm::pi<float>() * float(i) / float(m_numParticles));
+    m_offsetY[i] = float(i) / float(m_numParticles) - 0.5f;
+    m_offsetZ[i] = sinf(2 * glm::pi<float>() * float(i) / float(m_numParticles));
   }
-}
-
-//------------------------------------------------------------------------------
-
-// This class is a set of particle trails and constants that enter
-// into their equations of motion.
-class CFlux
-{
-public:
-  CFlux();
-  ~CFlux();
-  void update(CScreensaverFlux* base);
-
-private:
-  CParticle *m_particles;
-  int m_randomize;
-  float m_c[NUMCONSTS];     // constants
-  float m_cv[NUMCONSTS];    // constants' change velocities
-};
-
-CFlux::CFlux()
-{
-  int i;
 
-  gWhichparticle = 0;
+  // Set initial positions out of view of the camera
+  const size_t size = size_t(m_numParticles) * m_trail;
+  m_x.assign(size, 0.0f);
+  m_y.assign(size, 3.0f);
+  m_z.assign(size, 0.0f);
+  m_r.assign(size, 1.0f);
+  m_g.assign(size, 1.0f);
+  m_b.assign(size, 1.0f);
 
-  m_particles = new CParticle[gSettings.dParticles];
   m_randomize = 1;
   for (i = 0; i < NUMCONSTS; i++)
   {
     m_c[i] = rsRandf(2.0f) - 1.0f;
-    m_cv[i] = rsRandf(0.000005f * float(gSettings.dInstability) * float(gSettings.dInstability))
-                    + 0.000001f * float(gSettings.dInstability) * float(gSettings.dInstability);
+    m_cv[i] = rsRandf(0.000005f * float(settings.dInstability) * float(settings.dInstability))
+                    + 0.000001f * float(settings.dInstability) * float(settings.dInstability);
   }
 }
 
-CFlux::~CFlux()
-{
-  delete[] m_particles;
-}
-
 void CFlux::update(CScreensaverFlux* base)
 {
   // randomize constants
-  if (gSettings.dRandomize)
+  if (base->Settings().dRandomize)
   {
     m_randomize --;
     if (m_randomize <= 0)
     {
       for (int i = 0; i < NUMCONSTS; i++)
         m_c[i] = rsRandf(2.0f) - 1.0f;
-      int temp = 101 - gSettings.dRandomize;
+      int temp = 101 - base->Settings().dRandomize;
       temp = temp * temp;
       m_randomize = temp + rsRandi(temp);
     }
@@ -504,27 +165,216 @@ void CFlux::update(CScreensaverFlux* base)
     }
   }
 
-  base->m_prevOrbitiness = base->m_orbitiness;
-  base->m_orbitiness = 0.0f;
+  // Record old position
+  m_counter ++;
+  if (m_counter >= m_trail)
+    m_counter = 0;
 
   // update all particles in this flux field
-  for (int i = 0; i < gSettings.dParticles; i++)
-    m_particles[i].update(m_c, base);
+  const int jobs = (m_numParticles + m_particlesPerJob - 1) / m_particlesPerJob;
+  m_jobOrbitiness.resize(jobs);
+  m_jobBatches.resize(jobs);
+
+  rsWorkerPool::shared().parallelFor(jobs, [&](unsigned int job) {
+    const int begin = job * m_particlesPerJob;
+    m_jobOrbitiness[job] = updateHeads(begin, std::min(begin + m_particlesPerJob, m_numParticles));
+  });
+
+  bringBack();
+
+  rsWorkerPool::shared().parallelFor(jobs, [&](unsigned int job) {
+    const int begin = job * m_particlesPerJob;
+    draw(base, begin, std::min(begin + m_particlesPerJob, m_numParticles), m_jobBatches[job]);
+  });
+
+  m_prevOrbitiness = m_orbitiness;
+  m_orbitiness = 0.0f;
+  m_batch.clear();
+  for (int job = 0; job < jobs; job++)
+  {
+    m_orbitiness += m_jobOrbitiness[job];
+    m_batch.insert(m_batch.end(), m_jobBatches[job].begin(), m_jobBatches[job].end());
+  }
+
+  base->DrawTrails(m_batch);
+  expand();
 
-  if (base->m_orbitiness < base->m_prevOrbitiness)
+  if (m_orbitiness < m_prevOrbitiness)
   {
     int i = rsRandi(NUMCONSTS - 1);
     m_cv[i] = -m_cv[i];
   }
 }
 
+float CFlux::updateHeads(int begin, int end)
+{
+  const float* c = m_c;
+  const int oldc = m_counter ? m_counter - 1 : m_trail - 1;
+  float orbitiness = 0.0f;
+
+  const float* oldx = &m_x[size_t(oldc) * m_numParticles];
+  const float* oldy = &m_y[size_t(oldc) * m_numParticles];
+  const float* oldz = &m_z[size_t(oldc) * m_numParticles];
+  float* x = &m_x[size_t(m_counter) * m_numParticles];
+  float* y = &m_y[size_t(m_counter) * m_numParticles];
+  float* z = &m_z[size_t(m_counter) * m_numParticles];
+  float* r = &m_r[size_t(m_counter) * m_numParticles];
+  float* g = &m_g[size_t(m_counter) * m_numParticles];
+  float* b = &m_b[size_t(m_counter) * m_numParticles];
+
+  for (int i = begin; i < end; i++)
+  {
+    // Here's the iterative math for calculating new vertex positions
+    // first calculate limiting terms which keep vertices from constantly
+    // flying off to infinity
+    const float cx(oldx[i] * (1.0f - 1.0f / (oldx[i] * oldx[i] + 1.0f)));
+    const float cy(oldy[i] * (1.0f - 1.0f / (oldy[i] * oldy[i] + 1.0f)));
+    const float cz(oldz[i] * (1.0f - 1.0f / (oldz[i] * oldz[i] + 1.0f)));
+    // then calculate new positions
+    x[i] = oldx[i] + c[6] * m_offsetX[i] - cx + c[2] * oldy[i] + c[5] * oldz[i];
+    y[i] = oldy[i] + c[6] * m_offsetY[i] - cy + c[1] * oldz[i] + c[4] * oldx[i];
+    z[i] = oldz[i] + c[6] * m_offsetZ[i] - cz + c[0] * oldx[i] + c[3] * oldy[i];
+
+    // calculate "orbitiness" of particles
+    const float xdiff(x[i] - oldx[i]);
+    const float ydiff(y[i] - oldy[i]);
+    const float zdiff(z[i] - oldz[i]);
+    const float distsq(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    const float oldDistsq(oldx[i] * oldx[i] + oldy[i] * oldy[i] + oldz[i] * oldz[i]);
+    orbitiness += (xdiff * xdiff + ydiff * ydiff + zdiff * zdiff)
+                  / (2.0f - fabs(distsq - oldDistsq));
+
+    // Pick a hue
+    float hue = cx * cx + cy * cy + cz * cz;
+    if (hue > 1.0f)
+      hue = 1.0f;
+    hue += c[7];
+    // Limit the hue (0 - 1)
+    if (hue > 1.0f)
+      hue -= 1.0f;
+    if (hue < 0.0f)
+      hue += 1.0f;
+    // Pick a saturation
+    float saturation = c[0] + hue;
+    // Limit the saturation (0 - 1)
+    if (saturation < 0.0f)
+      saturation = -saturation;
+    saturation -= float(int(saturation));
+    saturation = 1.0f - (saturation * saturation);
+
+    // Luminosity only scales the color, so the vertex keeps its color at
+    // full luminosity and draw() dims it as the vertex ages
+    hsl2rgb(hue, saturation, 1.0f, r[i], g[i], b[i]);
+  }
+
+  return orbitiness;
+}
+
+void CFlux::bringBack()
+{
+  // Bring particles back if they escape
+  if (m_counter)
+    return;
+
+  // the heads are in slot 0
+  float* x = m_x.data();
+  float* y = m_y.data();
+  float* z = m_z.data();
+  for (int i = 0; i < m_numParticles; i++)
+  {
+    if (x[i] * x[i] + y[i] * y[i] + z[i] * z[i] > 100000000.0f)
+    {
+      x[i] = rsRandf(2.0f) - 1.0f;
+      y[i] = rsRandf(2.0f) - 1.0f;
+      z[i] = rsRandf(2.0f) - 1.0f;
+    }
+  }
+}
+
+void CFlux::draw(const CScreensaverFlux* base, int begin, int end, std::vector<sLight>& batch) const
+{
+  // Vertices close to the head of a trail are drawn smaller
+  static const float growthScale[5] = {0.259f, 0.5f, 0.707f, 0.866f, 0.966f};
+
+  const std::vector<sLight>& shape = base->TrailShape();
+  const bool rotate = base->Settings().dGeometry != GEOMETRY_SPHERES;
+  const bool scale = base->Settings().dGeometry != GEOMETRY_POINTS;
+
+  batch.clear();
+
+  // Every vertex in every particle trail, oldest first
+  for (int i = begin; i < end; i++)
+  {
+    int p = m_counter;
+    float luminosity = base->m_lumdiff;
+    for (int growth = 1; growth <= m_trail; growth++)
+    {
+      p ++;
+      if (p >= m_trail)
+        p = 0;
+
+      const size_t v = size_t(p) * m_numParticles + i;
+      const float x(m_x[v]), y(m_y[v]), z(m_z[v]);
+      if (x * x + y * y + z * z < 40000.0f)
+      {
+        glm::vec3 pos(x, y, z);
+        if (rotate)
+          pos = glm::vec3(base->m_cosCameraAngle * x + base->m_sinCameraAngle * z, y,
+                          base->m_cosCameraAngle * z - base->m_sinCameraAngle * x);
+
+        const int age = m_trail - growth;
+        const float size = scale && age < 5 ? growthScale[age] : 1.0f;
+        const glm::vec4 color(m_r[v] * luminosity, m_g[v] * luminosity, m_b[v] * luminosity, 1.0f);
+
+        for (const sLight& corner : shape)
+        {
+          batch.push_back(corner);
+          sLight& vertex = batch.back();
+          vertex.vertex = pos + corner.vertex * size;
+          vertex.color = color;
+        }
+      }
+
+      luminosity += base->m_lumdiff;
+    }
+  }
+}
+
+void CFlux::expand()
+{
+  const size_t size = m_x.size();
+  float* x = m_x.data();
+  float* y = m_y.data();
+  float* z = m_z.data();
+  size_t i = 0;
+
+#if defined(__SSE2__)
+  const __m128 expander = _mm_set1_ps(m_expander);
+  const __m128 blower = _mm_set1_ps(m_blower);
+  for (; i + 4 <= size; i += 4)
+  {
+    _mm_storeu_ps(x + i, _mm_mul_ps(_mm_loadu_ps(x + i), expander));
+    _mm_storeu_ps(y + i, _mm_mul_ps(_mm_loadu_ps(y + i), expander));
+    _mm_storeu_ps(z + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(z + i), expander), blower));
+  }
+#endif
+
+  for (; i < size; i++)
+  {
+    x[i] *= m_expander;
+    y[i] *= m_expander;
+    z[i] *= m_expander;
+    z[i] += m_blower;
+  }
+}
+
 //------------------------------------------------------------------------------
 
 bool CScreensaverFlux::Start()
 {
   srand((unsigned)time(nullptr));
 
-  gSettings.Load();
+  m_settings.Load();
 
   std::string fraqShader = kodi::addon::GetAddonPath("resources/shaders/" GL_TYPE_STRING "/frag.glsl");
   std::string vertShader = kodi::addon::GetAddonPath("resources/shaders/" GL_TYPE_STRING "/vert.glsl");
@@ -540,16 +390,16 @@ bool CScreensaverFlux::Start()
   glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-  if (gSettings.dGeometry == GEOMETRY_SPHERES)  // Spheres and their lighting
+  if (m_settings.dGeometry == GEOMETRY_SPHERES)  // Spheres and their lighting
   {
-    Sphere(0.005f * float(gSettings.dSize), gSettings.dComplexity + 2, gSettings.dComplexity + 1);
+    Sphere(0.005f * float(m_settings.dSize), m_settings.dComplexity + 2, m_settings.dComplexity + 1);
     m_lightingEnabled = 1;
   }
   else
     m_lightingEnabled = 0;
 
-  if (gSettings.dGeometry == GEOMETRY_POINTS ||
-      gSettings.dGeometry == GEOMETRY_LIGHTS)  // Init lights or points
+  if (m_settings.dGeometry == GEOMETRY_POINTS ||
+      m_settings.dGeometry == GEOMETRY_LIGHTS)  // Init lights or points
   {
     m_textureUsed = 1;
 
@@ -574,32 +424,30 @@ bool CScreensaverFlux::Start()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, LIGHTSIZE, LIGHTSIZE, 0, GL_RED, GL_UNSIGNED_BYTE, m_lightTexture);
 
-    temp = float(gSettings.dSize) * 0.005f;
-    if (gSettings.dGeometry == GEOMETRY_POINTS)
+    temp = float(m_settings.dSize) * 0.005f;
+    sLight corner;
+    if (m_settings.dGeometry == GEOMETRY_POINTS)
     {
-      m_textureTriangles[0].vertex = glm::vec3(-temp, -temp, 0.0f);
-      m_textureTriangles[0].coord = glm::vec2(0.0f, 0.0f);
-      m_textureTriangles[1].vertex = glm::vec3(temp, -temp, 0.0f);
-      m_textureTriangles[1].coord = glm::vec2(1.0f, 0.0f);
-      m_textureTriangles[2].vertex = glm::vec3(-temp, temp, 0.0f);
-      m_textureTriangles[2].coord = glm::vec2(0.0f, 1.0f);
-      m_textureTriangles[3].vertex = glm::vec3(temp, temp, 0.0f);
-      m_textureTriangles[3].coord = glm::vec2(1.0f, 1.0f);
+      // the strip -temp,-temp / temp,-temp / -temp,temp / temp,temp as triangles
+      const float x[6] = {-temp, temp, -temp, -temp, temp, temp};
+      const float y[6] = {-temp, -temp, temp, temp, -temp, temp};
+      for (int i = 0; i < 6; i++)
+      {
+        corner.vertex = glm::vec3(x[i], y[i], 0.0f);
+        corner.coord = glm::vec2(x[i] > 0.0f ? 1.0f : 0.0f, y[i] > 0.0f ? 1.0f : 0.0f);
+        m_trailShape.push_back(corner);
+      }
     }
     else
     {
-      m_textureTriangles[0].coord = glm::vec2(0.0f, 0.0f);
-      m_textureTriangles[0].vertex = glm::vec3(-temp, -temp, 0.0f);
-      m_textureTriangles[1].coord = glm::vec2(1.0f, 0.0f);
-      m_textureTriangles[1].vertex = glm::vec3(temp, -temp, 0.0f);
-      m_textureTriangles[2].coord = glm::vec2(1.0f, 1.0f);
-      m_textureTriangles[2].vertex = glm::vec3(temp, temp, 0.0f);
-      m_textureTriangles[3].coord = glm::vec2(0.0f, 0.0f);
-      m_textureTriangles[3].vertex = glm::vec3(-temp, -temp, 0.0f);
-      m_textureTriangles[4].coord = glm::vec2(1.0f, 1.0f);
-      m_textureTriangles[4].vertex = glm::vec3(temp, temp, 0.0f);
-      m_textureTriangles[5].coord = glm::vec2(0.0f, 1.0f);
-      m_textureTriangles[5].vertex = glm::vec3(-temp, temp, 0.0f);
+      const float x[6] = {-temp, temp, temp, -temp, temp, -temp};
+      const float y[6] = {-temp, -temp, temp, -temp, temp, temp};
+      for (int i = 0; i < 6; i++)
+      {
+        corner.vertex = glm::vec3(x[i], y[i], 0.0f);
+        corner.coord = glm::vec2(x[i] > 0.0f ? 1.0f : 0.0f, y[i] > 0.0f ? 1.0f : 0.0f);
+        m_trailShape.push_back(corner);
+      }
     }
   }
   else
@@ -611,10 +459,12 @@ bool CScreensaverFlux::Start()
   m_blur[3].vertex = glm::vec3(1.0f, 1.0f, 0.0f);
 
   // Initialize luminosity difference
-  m_lumdiff = 1.0f / float(gSettings.dTrail);
+  m_lumdiff = 1.0f / float(m_settings.dTrail);
 
   // Initialize flux fields
-  m_fluxes = new CFlux[gSettings.dFluxes];
+  m_fluxes = new CFlux[m_settings.dFluxes];
+  for (int i = 0; i < m_settings.dFluxes; i++)
+    m_fluxes[i].init(m_settings);
 
   glGenBuffers(1, &m_vertexVBO);
   glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
@@ -635,8 +485,8 @@ void CScreensaverFlux::Stop()
   glDeleteBuffers(1, &m_vertexVBO);
   m_vertexVBO = 0;
 
-  if (gSettings.dGeometry == GEOMETRY_POINTS ||
-      gSettings.dGeometry == GEOMETRY_LIGHTS)
+  if (m_settings.dGeometry == GEOMETRY_POINTS ||
+      m_settings.dGeometry == GEOMETRY_LIGHTS)
   {
     glBindTexture(GL_TEXTURE_2D, 0);
     glDeleteTextures(1, &m_texture);
@@ -653,6 +503,7 @@ void CScreensaverFlux::Stop()
 
   // Free memory
   delete[] m_fluxes;
+  m_trailShape.clear();
 }
 
 void CScreensaverFlux::Render()
@@ -676,6 +527,9 @@ void CScreensaverFlux::Render()
   glVertexAttribPointer(m_hCoord, 2, GL_FLOAT, GL_TRUE, sizeof(sLight), BUFFER_OFFSET(offsetof(sLight, coord)));
   glEnableVertexAttribArray(m_hCoord);
 
+  glVertexAttribPointer(m_hColor, 4, GL_FLOAT, GL_FALSE, sizeof(sLight), BUFFER_OFFSET(offsetof(sLight, color)));
+  glEnableVertexAttribArray(m_hColor);
+
   glEnable(GL_CULL_FACE);
   glBindTexture(GL_TEXTURE_2D, m_texture);
 
@@ -688,13 +542,13 @@ void CScreensaverFlux::Render()
   //@}
 
   // clear the screen
-  if (gSettings.dBlur)  // partially
+  if (m_settings.dBlur)  // partially
   {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_BLEND);
     glDisable(GL_DEPTH_TEST);
 
-    m_uniformColor = glm::vec4(0.0f, 0.0f, 0.0f, 0.5f - (float(sqrtf(sqrtf(float(gSettings.dBlur)))) * 0.15495f));
+    m_uniformColor = glm::vec4(0.0f, 0.0f, 0.0f, 0.5f - (float(sqrtf(sqrtf(float(m_settings.dBlur)))) * 0.15495f));
     m_modelProjMat = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f, 1.0f, -1.0f) * glm::mat4(1.0f);
     EnableShader();
     glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*4, m_blur, GL_STATIC_DRAW);
@@ -707,10 +561,10 @@ void CScreensaverFlux::Render()
   m_modelMat = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -2.5f));
 
   // Rotate camera
-  m_cameraAngle += 0.01f * float(gSettings.dRotation);
+  m_cameraAngle += 0.01f * float(m_settings.dRotation);
   if (m_cameraAngle >= 360.0f)
     m_cameraAngle -= 360.0f;
-  if (gSettings.dGeometry == GEOMETRY_SPHERES)  // Only rotate for spheres
+  if (m_settings.dGeometry == GEOMETRY_SPHERES)  // Only rotate for spheres
     m_modelMat = glm::rotate(m_modelMat, glm::radians(m_cameraAngle), glm::vec3(0.0f, 1.0f, 0.0f));
   else
   {
@@ -719,7 +573,7 @@ void CScreensaverFlux::Render()
   }
 
   // set up state for rendering particles
-  switch (gSettings.dGeometry)
+  switch (m_settings.dGeometry)
   {
   case GEOMETRY_POINTS:  // Blending for points
     glBlendFunc(GL_SRC_ALPHA, GL_ONE);
@@ -738,44 +592,27 @@ void CScreensaverFlux::Render()
   }
 
   // Update particles
-  for (int i = 0; i < gSettings.dFluxes; i++)
+  for (int i = 0; i < m_settings.dFluxes; i++)
     m_fluxes[i].update(this);
 
   glDisable(GL_CULL_FACE);
+  glDisableVertexAttribArray(m_hColor);
   glDisableVertexAttribArray(m_hCoord);
   glDisableVertexAttribArray(m_hVertex);
   glDisableVertexAttribArray(m_hNormal);
 }
 
-void CScreensaverFlux::DrawPoint()
+void CScreensaverFlux::DrawTrails(const std::vector<sLight>& vertices)
 {
-  m_modelProjMat = m_projMat * m_modelMat;
-  m_normalMat = glm::transpose(glm::inverse(glm::mat3(m_modelMat)));
-  EnableShader();
-  glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*4, &m_textureTriangles[0], GL_DYNAMIC_DRAW);
-  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-  DisableShader();
-}
-
-void CScreensaverFlux::DrawTriangles()
-{
-  m_modelProjMat = m_projMat * m_modelMat;
-  m_normalMat = glm::transpose(glm::inverse(glm::mat3(m_modelMat)));
-  EnableShader();
-  glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*6, &m_textureTriangles[0], GL_DYNAMIC_DRAW);
-  glDrawArrays(GL_TRIANGLES, 0, 6);
-  DisableShader();
-}
+  if (vertices.empty())
+    return;
 
-void CScreensaverFlux::DrawSphere()
-{
+  m_uniformColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
   m_modelProjMat = m_projMat * m_modelMat;
   m_normalMat = glm::transpose(glm::inverse(glm::mat3(m_modelMat)));
   EnableShader();
-  glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*m_sphereTriangleFan1.size(), &m_sphereTriangleFan1[0], GL_DYNAMIC_DRAW);
-  glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(m_sphereTriangleFan1.size()));
-  glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*m_sphereTriangleFan2.size(), &m_sphereTriangleFan2[0], GL_DYNAMIC_DRAW);
-  glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(m_sphereTriangleFan2.size()));
+  glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*vertices.size(), vertices.data(), GL_DYNAMIC_DRAW);
+  glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
   DisableShader();
 }
 
@@ -831,14 +668,16 @@ void CScreensaverFlux::Sphere(GLfloat radius, GLint slices, GLint stacks)
   sintemp2 = sinCache2b[1];
   costemp3 = cosCache2b[1];
 
+  std::vector<sLight> fan1, fan2;
+
   light.normal = glm::vec3(sinCache2a[0] * sinCache2b[0], cosCache2a[0] * sinCache2b[0], cosCache2b[0]);
   light.vertex = glm::vec3(0.0, 0.0, radius);
-  m_sphereTriangleFan1.push_back(light);
+  fan1.push_back(light);
   for (i = slices; i >= 0; i--)
   {
     light.normal = glm::vec3(sinCache2a[i] * sintemp2, cosCache2a[i] * sintemp2, costemp3);
     light.vertex = glm::vec3(sintemp1 * sinCache1a[i], sintemp1 * cosCache1a[i], zHigh);
-    m_sphereTriangleFan1.push_back(light);
+    fan1.push_back(light);
   }
 
   /* High end next (j == stacks-1 iteration) */
@@ -849,12 +688,23 @@ void CScreensaverFlux::Sphere(GLfloat radius, GLint slices, GLint stacks)
 
   light.normal = glm::vec3(sinCache2a[stacks] * sinCache2b[stacks], cosCache2a[stacks] * sinCache2b[stacks], cosCache2b[stacks]);
   light.vertex = glm::vec3(0.0, 0.0, -radius);
-  m_sphereTriangleFan2.push_back(light);
+  fan2.push_back(light);
   for (i = 0; i <= slices; i++)
   {
     light.normal = glm::vec3(sinCache2a[i] * sintemp2, cosCache2a[i] * sintemp2, costemp3);
     light.vertex = glm::vec3(sintemp1 * sinCache1a[i], sintemp1 * cosCache1a[i], zHigh);
-    m_sphereTriangleFan2.push_back(light);
+    fan2.push_back(light);
+  }
+
+  // Both caps as a triangle list, so that spheres can be drawn in one batch
+  for (const std::vector<sLight>* fan : {&fan1, &fan2})
+  {
+    for (size_t k = 2; k < fan->size(); k++)
+    {
+      m_trailShape.push_back((*fan)[0]);
+      m_trailShape.push_back((*fan)[k - 1]);
+      m_trailShape.push_back((*fan)[k]);
+    }
   }
 }
 
@@ -887,6 +737,7 @@ void CScreensaverFlux::OnCompiledAndLinked()
   m_hNormal = glGetAttribLocation(ProgramHandle(), "a_normal");
   m_hVertex = glGetAttribLocation(ProgramHandle(), "a_position");
   m_hCoord = glGetAttribLocation(ProgramHandle(), "a_coord");
+  m_hColor = glGetAttribLocation(ProgramHandle(), "a_color");
 }
 
 bool CScreensaverFlux::OnEnabled()
@@ -21,19 +21,184 @@
 #include <kodi/gui/gl/Shader.h>
 
 #include <glm/gtc/type_ptr.hpp>
+#include <rsMath/rsMath.h>
+#include <vector>
 
 #define LIGHTSIZE 64
 #define NUMCONSTS 8
 
+// Parameters edited in the dialog box
+
+#define PRESET_AUTO_SELECTION 0
+#define PRESET_REGULAR 1
+#define PRESET_HYPNOTIC 2
+#define PRESET_INSANE 3
+#define PRESET_SPARKLERS 4
+#define PRESET_PARADIGM 5
+#define PRESET_GALACTIC 6
+#define PRESET_ADVANCED_SETTINGS -1
+
+#define GEOMETRY_POINTS 0
+#define GEOMETRY_SPHERES 1
+#define GEOMETRY_LIGHTS 2
+
+struct sFluxSettings
+{
+  sFluxSettings()
+  {
+    SetDefaults(PRESET_REGULAR);
+  }
+
+  void Load()
+  {
+    int type = PRESET_REGULAR;
+    kodi::addon::CheckSettingInt("general.type", type);
+    if (type == PRESET_AUTO_SELECTION)
+      SetDefaults(rsRandi(6) + 1);
+    else
+      SetDefaults(type);
+
+    if (type != PRESET_ADVANCED_SETTINGS &&
+        type != kodi::addon::GetSettingInt("general.lastType"))
+    {
+      kodi::addon::SetSettingInt("general.lastType", type);
+
+      kodi::addon::SetSettingInt("advanced.fluxes", dFluxes);
+      kodi::addon::SetSettingInt("advanced.particles", dParticles);
+      kodi::addon::SetSettingInt("advanced.trail", dTrail);
+      kodi::addon::SetSettingInt("advanced.geometry", dGeometry);
+      kodi::addon::SetSettingInt("advanced.size", dSize);
+      kodi::addon::SetSettingInt("advanced.complexity", dRandomize);
+      kodi::addon::SetSettingInt("advanced.randomize", dExpansion);
+      kodi::addon::SetSettingInt("advanced.expansion", dRotation);
+      kodi::addon::SetSettingInt("advanced.rotation", dWind);
+      kodi::addon::SetSettingInt("advanced.instability", dInstability);
+      kodi::addon::SetSettingInt("advanced.blur", dBlur);
+    }
+  }
+
+  void SetDefaults(int preset)
+  {
+    switch (preset)
+    {
+    case PRESET_REGULAR:  // Regular
+      dFluxes = 1;
+      dParticles = 20;
+      dTrail = 40;
+      dGeometry = GEOMETRY_LIGHTS;
+      dSize = 15;
+      dComplexity = 3;
+      dRandomize = 0;
+      dExpansion = 40;
+      dRotation = 30;
+      dWind = 20;
+      dInstability = 20;
+      dBlur = 0;
+      break;
+    case PRESET_HYPNOTIC:  // Hypnotic
+      dFluxes = 2;
+      dParticles = 10;
+      dTrail = 40;
+      dGeometry = GEOMETRY_LIGHTS;
+      dSize = 15;
+      dRandomize = 80;
+      dExpansion = 20;
+      dRotation = 0;
+      dWind = 40;
+      dInstability = 10;
+      dBlur = 30;
+      break;
+    case PRESET_INSANE:  // Insane
+      dFluxes = 4;
+      dParticles = 30;
+      dTrail = 8;
+      dGeometry = GEOMETRY_LIGHTS;
+      dSize = 25;
+      dRandomize = 0;
+      dExpansion = 80;
+      dRotation = 60;
+      dWind = 40;
+      dInstability = 100;
+      dBlur = 10;
+      break;
+    case PRESET_SPARKLERS:  // Sparklers
+      dFluxes = 3;
+      dParticles = 20;
+      dTrail = 6;
+      dGeometry = GEOMETRY_SPHERES;
+      dSize = 20;
+      dComplexity = 3;
+      dRandomize = 85;
+      dExpansion = 60;
+      dRotation = 30;
+      dWind = 20;
+      dInstability = 30;
+      dBlur = 0;
+      break;
+    case PRESET_PARADIGM:  // Paradigm
+      dFluxes = 1;
+      dParticles = 40;
+      dTrail = 40;
+      dGeometry = GEOMETRY_LIGHTS;
+      dSize = 5;
+      dRandomize = 90;
+      dExpansion = 30;
+      dRotation = 20;
+      dWind = 10;
+      dInstability = 5;
+      dBlur = 10;
+      break;
+    case PRESET_GALACTIC:  // Galactic
+      dFluxes = 3;
+      dParticles = 2;
+      dTrail = 1500;
+      dGeometry = GEOMETRY_LIGHTS;
+      dSize = 10;
+      dRandomize = 0;
+      dExpansion = 5;
+      dRotation = 25;
+      dWind = 0;
+      dInstability = 5;
+      dBlur = 0;
+      break;
+    case PRESET_ADVANCED_SETTINGS:  // Galactic
+      dFluxes = kodi::addon::GetSettingInt("advanced.fluxes");
+      dParticles = kodi::addon::GetSettingInt("advanced.particles");
+      dTrail = kodi::addon::GetSettingInt("advanced.trail");
+      dGeometry = kodi::addon::GetSettingInt("advanced.geometry");
+      dSize = kodi::addon::GetSettingInt("advanced.size");
+      dRandomize = kodi::addon::GetSettingInt("advanced.complexity");
+      dExpansion = kodi::addon::GetSettingInt("advanced.randomize");
+      dRotation = kodi::addon::GetSettingInt("advanced.expansion");
+      dWind = kodi::addon::GetSettingInt("advanced.rotation");
+      dInstability = kodi::addon::GetSettingInt("advanced.instability");
+      dBlur = kodi::addon::GetSettingInt("advanced.blur");
+    }
+  }
+
+  int dFluxes;
+  int dParticles;
+  int dTrail;
+  int dGeometry;
+  int dSize;
+  int dComplexity;
+  int dRandomize;
+  int dExpansion;
+  int dRotation;
+  int dWind;
+  int dInstability;
+  int dBlur;
+};
+
 struct sLight
 {
   glm::vec3 vertex;
   glm::vec3 normal;
   glm::vec2 coord;
+  glm::vec4 color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
 };
 
 class CFlux;
-class CParticle;
 
 class ATTR_DLL_LOCAL CScreensaverFlux
   : public kodi::addon::CAddonBase,
@@ -50,9 +215,13 @@ public:
   void OnCompiledAndLinked() override;
   bool OnEnabled() override;
 
-  void DrawPoint();
-  void DrawTriangles();
-  void DrawSphere();
+  // Draw a whole flux at once, as triangles built from TrailShape()
+  void DrawTrails(const std::vector<sLight>& vertices);
+
+  // Triangles drawn for one trail vertex around the origin
+  const std::vector<sLight>& TrailShape() const { return m_trailShape; }
+
+  ATTR_FORCEINLINE const sFluxSettings& Settings() const { return m_settings; }
 
   glm::vec4 m_uniformColor;
 
@@ -62,12 +231,11 @@ public:
   float m_lumdiff;
   float m_cosCameraAngle, m_sinCameraAngle;
 
-  float m_orbitiness = 0.0f;
-  float m_prevOrbitiness = 0.0f;
-
 private:
   void Sphere(GLfloat radius, GLint slices, GLint stacks);
 
+  sFluxSettings m_settings;
+
   GLint m_projMatLoc = -1;
   GLint m_modelViewMatLoc = -1;
   GLint m_modelViewProjectionMatrixLoc = -1;
@@ -94,6 +262,7 @@ private:
   GLint m_hNormal = -1;
   GLint m_hVertex = -1;
   GLint m_hCoord = -1;
+  GLint m_hColor = -1;
 
   GLuint m_vertexVBO = 0;
 
@@ -109,12 +278,10 @@ private:
 
   CFlux *m_fluxes;
 
-  std::vector<sLight> m_sphereTriangleFan1;
-  std::vector<sLight> m_sphereTriangleFan2;
+  std::vector<sLight> m_trailShape;
 
   GLuint m_textureUsed = 0;
   GLuint m_texture = 0;
-  sLight m_textureTriangles[6];
   unsigned char m_lightTexture[LIGHTSIZE][LIGHTSIZE];
 
   sLight m_blur[4];
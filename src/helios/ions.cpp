@@ -0,0 +1,232 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "ions.h"
+
+#include <math.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+// The force from one emitter or attracter along d is d normalized like
+// rsVec::normalize() does it (a zero vector becomes 0, 1, 0) and weighted
+// by the inverse distance beyond a distance of one.  Returns the distance.
+inline float AddForce(float dx, float dy, float dz, float& fx, float& fy, float& fz)
+{
+  const float length = sqrtf(dx * dx + dy * dy + dz * dz);
+  if (length == 0.0f)
+  {
+    fy += 1.0f;
+    return length;
+  }
+
+  const float normalizer = 1.0f / length;
+  const float weight = length <= 1.0f ? 1.0f : 1.0f / length;
+  fx += dx * normalizer * weight;
+  fy += dy * normalizer * weight;
+  fz += dz * normalizer * weight;
+  return length;
+}
+
+#if defined(__SSE2__)
+inline __m128 AddForce(__m128 dx, __m128 dy, __m128 dz, __m128& fx, __m128& fy, __m128& fz)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                                               _mm_mul_ps(dz, dz)));
+  const __m128 zero = _mm_cmpeq_ps(length, _mm_setzero_ps());
+  const __m128 near = _mm_cmple_ps(length, one);
+  const __m128 normalizer = _mm_div_ps(one, length);
+  const __m128 weight = _mm_or_ps(_mm_and_ps(near, one), _mm_andnot_ps(near, normalizer));
+
+  fx = _mm_add_ps(fx, _mm_andnot_ps(zero, _mm_mul_ps(_mm_mul_ps(dx, normalizer), weight)));
+  fy = _mm_add_ps(fy, _mm_or_ps(_mm_and_ps(zero, one),
+                                _mm_andnot_ps(zero, _mm_mul_ps(_mm_mul_ps(dy, normalizer), weight))));
+  fz = _mm_add_ps(fz, _mm_andnot_ps(zero, _mm_mul_ps(_mm_mul_ps(dz, normalizer), weight)));
+  return length;
+}
+#endif
+
+// Directions an ion can leave an emitter in
+const float startDirections[14][3] = {
+  { 1.0f,  0.0f,  0.0f}, {-1.0f,  0.0f,  0.0f},
+  { 0.0f,  1.0f,  0.0f}, { 0.0f, -1.0f,  0.0f},
+  { 0.0f,  0.0f,  1.0f}, { 0.0f,  0.0f, -1.0f},
+  { 1.0f,  1.0f,  1.0f}, {-1.0f,  1.0f,  1.0f},
+  { 1.0f, -1.0f,  1.0f}, {-1.0f, -1.0f,  1.0f},
+  { 1.0f,  1.0f, -1.0f}, {-1.0f,  1.0f, -1.0f},
+  { 1.0f, -1.0f, -1.0f}, {-1.0f, -1.0f, -1.0f}};
+
+} // namespace
+
+void CIons::Init(unsigned int count, int size, int speed)
+{
+  m_x.assign(count, 0.0f);
+  m_y.assign(count, 0.0f);
+  m_z.assign(count, 0.0f);
+  m_r.assign(count, 0.0f);
+  m_g.assign(count, 0.0f);
+  m_b.assign(count, 0.0f);
+  m_size.resize(count);
+  m_speed.resize(count);
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    const float temp = rsRandf(2.0f) + 0.4f;
+    m_size[i] = float(size) * temp;
+    m_speed[i] = float(speed) * 12.0f / temp;
+  }
+}
+
+void CIons::Start(unsigned int i, float frameTime, const glm::vec3& rgb,
+                  const float* emitters, int numEmitters)
+{
+  const float* emitter = &emitters[rsRandi(numEmitters) * 3];
+  const float offset = frameTime * m_speed[i];
+  const float* direction = startDirections[rsRandi(14)];
+  m_x[i] = emitter[0] + direction[0] * offset;
+  m_y[i] = emitter[1] + direction[1] * offset;
+  m_z[i] = emitter[2] + direction[2] * offset;
+
+  m_r[i] = rgb.r;
+  m_g[i] = rgb.g;
+  m_b[i] = rgb.b;
+}
+
+void CIons::Update(unsigned int begin, unsigned int end, float frameTime,
+                   const float* emitters, int numEmitters,
+                   const float* attracters, int numAttracters,
+                   unsigned char* startOver)
+{
+  float* x = m_x.data();
+  float* y = m_y.data();
+  float* z = m_z.data();
+  const float* speed = m_speed.data();
+  unsigned int i = begin;
+
+#if defined(__SSE2__)
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 farAway = _mm_set1_ps(11000.0f);
+  const __m128 ft = _mm_set1_ps(frameTime);
+  for (; i + 4 <= end; i += 4)
+  {
+    const __m128 px = _mm_loadu_ps(x + i);
+    const __m128 py = _mm_loadu_ps(y + i);
+    const __m128 pz = _mm_loadu_ps(z + i);
+    const __m128 sp = _mm_loadu_ps(speed + i);
+    __m128 fx = zero, fy = zero, fz = zero;
+    __m128 restart = zero;
+
+    // Start over when too far from an emitter...
+    for (int e = 0; e < numEmitters; ++e)
+    {
+      const float* emitter = &emitters[e * 3];
+      const __m128 length = AddForce(_mm_sub_ps(px, _mm_set1_ps(emitter[0])),
+                                     _mm_sub_ps(py, _mm_set1_ps(emitter[1])),
+                                     _mm_sub_ps(pz, _mm_set1_ps(emitter[2])), fx, fy, fz);
+      restart = _mm_or_ps(restart, _mm_cmpgt_ps(length, farAway));
+    }
+
+    // ...or when an attracter is less than a step away
+    const __m128 startOverDistance = _mm_mul_ps(sp, ft);
+    for (int a = 0; a < numAttracters; ++a)
+    {
+      const float* attracter = &attracters[a * 3];
+      const __m128 length = AddForce(_mm_sub_ps(_mm_set1_ps(attracter[0]), px),
+                                     _mm_sub_ps(_mm_set1_ps(attracter[1]), py),
+                                     _mm_sub_ps(_mm_set1_ps(attracter[2]), pz), fx, fy, fz);
+      restart = _mm_or_ps(restart, _mm_cmplt_ps(length, startOverDistance));
+    }
+
+    // Move one step along the normalized force.  Ions that start over get
+    // a new position from Start() anyway.
+    const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(fx, fx), _mm_mul_ps(fy, fy)),
+                                                 _mm_mul_ps(fz, fz)));
+    const __m128 zeroForce = _mm_cmpeq_ps(length, zero);
+    const __m128 normalizer = _mm_div_ps(one, length);
+    fx = _mm_andnot_ps(zeroForce, _mm_mul_ps(fx, normalizer));
+    fy = _mm_or_ps(_mm_and_ps(zeroForce, one), _mm_andnot_ps(zeroForce, _mm_mul_ps(fy, normalizer)));
+    fz = _mm_andnot_ps(zeroForce, _mm_mul_ps(fz, normalizer));
+    _mm_storeu_ps(x + i, _mm_add_ps(px, _mm_mul_ps(_mm_mul_ps(fx, ft), sp)));
+    _mm_storeu_ps(y + i, _mm_add_ps(py, _mm_mul_ps(_mm_mul_ps(fy, ft), sp)));
+    _mm_storeu_ps(z + i, _mm_add_ps(pz, _mm_mul_ps(_mm_mul_ps(fz, ft), sp)));
+
+    const int mask = _mm_movemask_ps(restart);
+    startOver[i] = mask & 1;
+    startOver[i + 1] = (mask >> 1) & 1;
+    startOver[i + 2] = (mask >> 2) & 1;
+    startOver[i + 3] = (mask >> 3) & 1;
+  }
+#endif
+
+  for (; i < end; ++i)
+  {
+    float fx = 0.0f, fy = 0.0f, fz = 0.0f;
+    bool restart = false;
+
+    for (int e = 0; e < numEmitters; ++e)
+    {
+      const float* emitter = &emitters[e * 3];
+      if (AddForce(x[i] - emitter[0], y[i] - emitter[1], z[i] - emitter[2], fx, fy, fz) > 11000.0f)
+        restart = true;
+    }
+
+    const float startOverDistance = speed[i] * frameTime;
+    for (int a = 0; a < numAttracters; ++a)
+    {
+      const float* attracter = &attracters[a * 3];
+      if (AddForce(attracter[0] - x[i], attracter[1] - y[i], attracter[2] - z[i], fx, fy, fz) < startOverDistance)
+        restart = true;
+    }
+
+    const float length = sqrtf(fx * fx + fy * fy + fz * fz);
+    if (length == 0.0f)
+      fy = 1.0f;
+    else
+    {
+      const float normalizer = 1.0f / length;
+      fx *= normalizer;
+      fy *= normalizer;
+      fz *= normalizer;
+    }
+    x[i] += fx * frameTime * speed[i];
+    y[i] += fy * frameTime * speed[i];
+    z[i] += fz * frameTime * speed[i];
+
+    startOver[i] = restart;
+  }
+}
+
+void CIons::Billboards(unsigned int begin, unsigned int end, const float* billboardMat,
+                       sLight* vertices) const
+{
+  static const float corners[6][2] = {{-0.5f, -0.5f}, {0.5f, -0.5f}, {0.5f, 0.5f},
+                                      {-0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, 0.5f}};
+  const float* b = billboardMat;
+
+  for (unsigned int i = begin; i < end; ++i)
+  {
+    // The ion is drawn in camera space, so rotate it like the camera
+    const glm::vec3 center(m_x[i] * b[0] + m_y[i] * b[4] + m_z[i] * b[8],
+                           m_x[i] * b[1] + m_y[i] * b[5] + m_z[i] * b[9],
+                           m_x[i] * b[2] + m_y[i] * b[6] + m_z[i] * b[10]);
+    const glm::vec4 color(m_r[i], m_g[i], m_b[i], 1.0f);
+
+    for (int c = 0; c < 6; ++c)
+    {
+      sLight& vertex = *vertices++;
+      vertex.vertex = center + glm::vec3(corners[c][0], corners[c][1], 0.0f) * m_size[i];
+      vertex.coord = glm::vec2(corners[c][0] + 0.5f, corners[c][1] + 0.5f);
+      vertex.color = color;
+    }
+  }
+}
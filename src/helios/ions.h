@@ -0,0 +1,50 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include "main.h"
+
+#include <vector>
+
+// All ions of Helios, kept as one array per component.  Every ion is pushed
+// away from each emitter and pulled towards each attracter, so the force
+// kernel moves several ions at once with the emitter or attracter position
+// shared by all of them.  Emitter and attracter positions are passed as
+// packed x, y, z triples.
+class ATTR_DLL_LOCAL CIons
+{
+public:
+  // Give count ions their random size and speed
+  void Init(unsigned int count, int size, int speed);
+  unsigned int Size() const { return static_cast<unsigned int>(m_x.size()); }
+
+  // Put ion i next to a random emitter and give it the current color
+  void Start(unsigned int i, float frameTime, const glm::vec3& rgb,
+             const float* emitters, int numEmitters);
+
+  // Move ions [begin, end) and set startOver[i] for each ion that has to
+  // start over.  Only touches these ions, so ranges can be moved on
+  // several threads at once.
+  void Update(unsigned int begin, unsigned int end, float frameTime,
+              const float* emitters, int numEmitters,
+              const float* attracters, int numAttracters,
+              unsigned char* startOver);
+
+  // Write six vertices (two triangles) for each ion in [begin, end),
+  // facing the camera described by billboardMat
+  void Billboards(unsigned int begin, unsigned int end, const float* billboardMat,
+                  sLight* vertices) const;
+
+  glm::vec3 Color(unsigned int i) const { return glm::vec3(m_r[i], m_g[i], m_b[i]); }
+
+private:
+  std::vector<float> m_x, m_y, m_z;
+  std::vector<float> m_r, m_g, m_b;
+  std::vector<float> m_size;
+  std::vector<float> m_speed;
+};
@@ -15,6 +15,7 @@
  */
 
 #include "main.h"
+#include "ions.h"
 #include "spheremap.h"
 
 #include <chrono>
@@ -26,41 +27,14 @@
 #include <Implicit/impCubeVolume.h>
 #include <Implicit/impCrawlPoint.h>
 #include <Implicit/impSphere.h>
+#include <rsThreads/rsWorkerPool.h>
 
-#define LIGHTSIZE 64
+#include <algorithm>
 
-// Parameters edited in the dialog box
-namespace
-{
-struct sHeliosSettings
-{
-  sHeliosSettings()
-  {
-    setDefaults();
-  }
-
-  void setDefaults()
-  {
-    dIons = 1500;
-    dSize = 10;
-    dEmitters = 3;
-    dAttracters = 3;
-    dSpeed = 10;
-    dCameraspeed = 10;
-    dSurface = true;
-    dBlur = 10;
-  }
+#define LIGHTSIZE 64
 
-  int dIons;
-  int dSize;
-  int dEmitters;
-  int dAttracters;
-  int dSpeed;
-  int dCameraspeed;
-  bool dSurface;
-  int dBlur;
-} gHeliosSettings;
-}
+// Ions moved by each job of the worker pool
+#define IONS_PER_JOB 256u
 
 class CParticle
 {
@@ -110,188 +84,11 @@ attracter::attracter(){
 
 // -----------------------------------------------------------------------------
 
-class ion : public CParticle
-{
-public:
-  float speed;
-
-  ion();
-  ~ion(){};
-  void start(float frameTime, const glm::vec3& newRgb, emitter* elist);
-  void update(float frameTime, const glm::vec3& newRgb, emitter* elist, attracter* alist);
-  void draw(std::function<void(const sLight* surface, rsVec pos, float size)>(cb));
-};
-
-ion::ion()
-{
-  float temp;
-
-  pos = rsVec(0.0f, 0.0f, 0.0f);
-  rgb = glm::vec3(0.0f, 0.0f, 0.0f);
-  temp = rsRandf(2.0f) + 0.4f;
-  size = float(gHeliosSettings.dSize) * temp;
-  speed = float(gHeliosSettings.dSpeed) * 12.0f / temp;
-}
-
-void ion::start(float frameTime, const glm::vec3& newRgb, emitter* elist)
-{
-  int i = rsRandi(gHeliosSettings.dEmitters);
-  pos = elist[i].pos;
-  float offset = frameTime * speed;
-  switch(rsRandi(14))
-  {
-  case 0:
-    pos[0] += offset;
-    break;
-  case 1:
-    pos[0] -= offset;
-    break;
-  case 2:
-    pos[1] += offset;
-    break;
-  case 3:
-    pos[1] -= offset;
-    break;
-  case 4:
-    pos[2] += offset;
-    break;
-  case 5:
-    pos[2] -= offset;
-    break;
-  case 6:
-    pos[0] += offset;
-    pos[1] += offset;
-    pos[2] += offset;
-    break;
-  case 7:
-    pos[0] -= offset;
-    pos[1] += offset;
-    pos[2] += offset;
-    break;
-  case 8:
-    pos[0] += offset;
-    pos[1] -= offset;
-    pos[2] += offset;
-    break;
-  case 9:
-    pos[0] -= offset;
-    pos[1] -= offset;
-    pos[2] += offset;
-    break;
-  case 10:
-    pos[0] += offset;
-    pos[1] += offset;
-    pos[2] -= offset;
-    break;
-  case 11:
-    pos[0] -= offset;
-    pos[1] += offset;
-    pos[2] -= offset;
-    break;
-  case 12:
-    pos[0] += offset;
-    pos[1] -= offset;
-    pos[2] -= offset;
-    break;
-  case 13:
-    pos[0] -= offset;
-    pos[1] -= offset;
-    pos[2] -= offset;
-  }
-
-  rgb = newRgb;
-}
-
-void ion::update(float frameTime, const glm::vec3& newRgb, emitter* elist, attracter* alist)
-{
-  int i;
-  int startOver = 0;
-  static float startOverDistance;
-  static rsVec force, tempvec;
-  static float length, temp;
-
-  force = rsVec(0.0f, 0.0f, 0.0f);
-  for (i = 0; i < gHeliosSettings.dEmitters; i++){
-    tempvec = pos - elist[i].pos;
-    length = tempvec.normalize();
-    if (length > 11000.0f)
-      startOver = 1;
-    if (length <= 1.0f)
-      temp = 1.0f;
-    else
-      temp = 1.0f / length;
-    tempvec *= temp;
-    force += tempvec;
-  }
-  startOverDistance = speed * frameTime;
-  for (i = 0; i < gHeliosSettings.dAttracters; i++){
-    tempvec = alist[i].pos - pos;
-    length = tempvec.normalize();
-    if (length < startOverDistance)
-      startOver = 1;
-    if (length <= 1.0f)
-      temp = 1.0f;
-    else
-      temp = 1.0f / length;
-    tempvec *= temp;
-    force += tempvec;
-  }
-
-  // Start this ion at an emitter if it gets too close to an attracter
-  // or too far from an emitter
-  if (startOver)
-    start(frameTime, newRgb, elist);
-  else{
-    force.normalize();
-    pos += (force * frameTime * speed);
-  }
-}
-
-void ion::draw(std::function<void(const sLight* surface, rsVec pos, float size)>(cb))
-{
-  sLight surface[6];
-  surface[0].color = glm::vec4(rgb, 1.0f);
-  surface[0].coord = glm::vec2(0.0f, 0.0f);
-  surface[0].vertex = glm::vec3(-0.5f, -0.5f, 0.0f);
-
-  surface[1].color = glm::vec4(rgb, 1.0f);
-  surface[1].coord = glm::vec2(1.0f, 0.0f);
-  surface[1].vertex = glm::vec3(0.5f, -0.5f, 0.0f);
-
-  surface[2].color = glm::vec4(rgb, 1.0f);
-  surface[2].coord = glm::vec2(1.0f, 1.0f);
-  surface[2].vertex = glm::vec3(0.5f, 0.5f, 0.0f);
-
-  surface[3].color = glm::vec4(rgb, 1.0f);
-  surface[3].coord = glm::vec2(0.0f, 0.0f);
-  surface[3].vertex = glm::vec3(-0.5f, -0.5f, 0.0f);
-
-  surface[4].color = glm::vec4(rgb, 1.0f);
-  surface[4].coord = glm::vec2(1.0f, 1.0f);
-  surface[4].vertex = glm::vec3(0.5f, 0.5f, 0.0f);
-
-  surface[5].color = glm::vec4(rgb, 1.0f);
-  surface[5].coord = glm::vec2(0.0f, 1.0f);
-  surface[5].vertex = glm::vec3(-0.5f, 0.5f, 0.0f);
-  cb(surface, pos, size);
-}
-
-// -----------------------------------------------------------------------------
-
 bool CScreensaverHelios::Start()
 {
   bool doingPreview = false;
 
-  gHeliosSettings.setDefaults();
-
-  kodi::addon::CheckSettingInt("general.ions", gHeliosSettings.dIons);
-  kodi::addon::CheckSettingInt("general.size", gHeliosSettings.dSize);
-  kodi::addon::CheckSettingInt("general.emitters", gHeliosSettings.dEmitters);
-  kodi::addon::CheckSettingInt("general.attractors", gHeliosSettings.dAttracters);
-  kodi::addon::CheckSettingInt("general.speed", gHeliosSettings.dSpeed);
-  kodi::addon::CheckSettingInt("general.cameraspeed", gHeliosSettings.dCameraspeed);
-  kodi::addon::CheckSettingBoolean("general.isosurface", gHeliosSettings.dSurface);
-  kodi::addon::CheckSettingInt("general.blur", gHeliosSettings.dBlur);
+  m_settings.Load();
 
   std::string fraqShader = kodi::addon::GetAddonPath("resources/shaders/" GL_TYPE_STRING "/frag.glsl");
   std::string vertShader = kodi::addon::GetAddonPath("resources/shaders/" GL_TYPE_STRING "/vert.glsl");
@@ -331,16 +128,26 @@ bool CScreensaverHelios::Start()
   m_texture_id[0] = kodi::gui::gl::Load(Texture1);
 
   gli::texture Texture2(gli::TARGET_2D, gli::FORMAT_RGB8_UNORM_PACK8, gli::texture::extent_type(TEXSIZE, TEXSIZE, 1), 1, 1, 1);
-  std::memcpy(Texture2.data(), spheremap, Texture2.size());
+  if (const unsigned char* data = spheremap.acquire())
+    std::memcpy(Texture2.data(), data, Texture2.size());
+  spheremap.release();
   m_texture_id[1] = kodi::gui::gl::Load(Texture2);
 
   // Initialize particles
-  m_elist = new emitter[gHeliosSettings.dEmitters];
-  m_alist = new attracter[gHeliosSettings.dAttracters];
-  m_ilist = new ion[gHeliosSettings.dIons];
+  m_elist = new emitter[m_settings.dEmitters];
+  m_alist = new attracter[m_settings.dAttracters];
+  m_ions = new CIons();
+  m_ions->Init(m_settings.dIons, m_settings.dSize, m_settings.dSpeed);
+  m_startOver.assign(m_settings.dIons, 0);
+  m_emitterPos.resize(m_settings.dEmitters * 3);
+  m_attracterPos.resize(m_settings.dAttracters * 3);
+  for (i = 0; i < m_settings.dEmitters; i++)
+    std::copy(m_elist[i].pos.v, m_elist[i].pos.v + 3, &m_emitterPos[i * 3]);
+  for (i = 0; i < m_settings.dAttracters; i++)
+    std::copy(m_alist[i].pos.v, m_alist[i].pos.v + 3, &m_attracterPos[i * 3]);
 
   // Initialize surface
-  if (gHeliosSettings.dSurface)
+  if (m_settings.dSurface)
   {
     m_volume = new impCubeVolume();
     // Preview takes to long to initialize because Windows sucks,
@@ -350,14 +157,15 @@ bool CScreensaverHelios::Start()
     else
       m_volume->init(70, 70, 70, 25.0f);
     m_volume->function = surfaceFunction;
+    m_volume->batchfunction = surfaceBatchFunction;
     m_volume->base = this;
     m_surface = m_volume->getSurface();
-    m_spheres = new impSphere[gHeliosSettings.dEmitters + gHeliosSettings.dAttracters];
-    float sphereScaleFactor = 1.0f / sqrtf(float(2 * gHeliosSettings.dEmitters + gHeliosSettings.dAttracters));
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    m_spheres = new impSphere[m_settings.dEmitters + m_settings.dAttracters];
+    float sphereScaleFactor = 1.0f / sqrtf(float(2 * m_settings.dEmitters + m_settings.dAttracters));
+    for (i = 0; i < m_settings.dEmitters; i++)
       m_spheres[i].setThickness(400.0f * sphereScaleFactor);
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
-      m_spheres[i + gHeliosSettings.dEmitters].setThickness(200.0f * sphereScaleFactor);
+    for (i = 0; i < m_settings.dAttracters; i++)
+      m_spheres[i + m_settings.dEmitters].setThickness(200.0f * sphereScaleFactor);
   }
 
   glGenBuffers(1, &m_vertexVBO);
@@ -398,8 +206,8 @@ void CScreensaverHelios::Stop()
   // Free memory
   delete[] m_elist;
   delete[] m_alist;
-  delete[] m_ilist;
-  if (gHeliosSettings.dSurface)
+  delete m_ions;
+  if (m_settings.dSurface)
   {
     delete[] m_spheres;
     delete m_surface;
@@ -444,7 +252,7 @@ void CScreensaverHelios::Render()
   // Camera movements
   // first do translation (distance from center)
   float cameraInterp;
-  m_preCameraInterp += float(gHeliosSettings.dCameraspeed) * m_frameTime * 0.01f;
+  m_preCameraInterp += float(m_settings.dCameraspeed) * m_frameTime * 0.01f;
   cameraInterp = 0.5f - (0.5f * cosf(m_preCameraInterp));
   m_cameraDistance = (1.0f - cameraInterp) * m_oldCameraDistance + cameraInterp * m_targetCameraDistance;
   if (m_preCameraInterp >= glm::pi<float>())
@@ -459,7 +267,7 @@ void CScreensaverHelios::Render()
   // then do rotation
   rsVec radialVelDiff = m_targetRadialVel - m_radialVel;
   float changeRemaining = radialVelDiff.normalize();
-  float change = float(gHeliosSettings.dCameraspeed) * 0.0002f * m_frameTime;
+  float change = float(m_settings.dCameraspeed) * 0.0002f * m_frameTime;
   if (changeRemaining > change)
   {
     radialVelDiff *= change;
@@ -472,7 +280,7 @@ void CScreensaverHelios::Render()
     {
       m_targetRadialVel = rsVec(rsRandf(1.0f), rsRandf(1.0f), rsRandf(1.0f));
       m_targetRadialVel.normalize();
-      m_targetRadialVel *= float(gHeliosSettings.dCameraspeed) * rsRandf(0.002f);
+      m_targetRadialVel *= float(m_settings.dCameraspeed) * rsRandf(0.002f);
     }
     else
       m_targetRadialVel = rsVec(0.0f, 0.0f, 0.0f);
@@ -492,13 +300,13 @@ void CScreensaverHelios::Render()
   m_colorInterp += m_frameTime * m_colorChange;
   if (m_colorInterp >= 1.0f)
   {
-    if (!rsRandi(3) && gHeliosSettings.dIons >= 100)  // change color suddenly
+    if (!rsRandi(3) && m_settings.dIons >= 100)  // change color suddenly
       m_newHsl = rsVec(rsRandf(1.0f), 1.0f - (rsRandf(1.0f) * rsRandf(1.0f)), 1.0f);
     m_oldHsl = m_newHsl;
     m_targetHsl = rsVec(rsRandf(1.0f), 1.0f - (rsRandf(1.0f) * rsRandf(1.0f)), 1.0f);
     m_colorInterp = 0.0f;
     // amount by which to change m_colorInterp each second
-    m_colorChange = rsRandf(0.005f * float(gHeliosSettings.dSpeed)) + (0.002f * float(gHeliosSettings.dSpeed));
+    m_colorChange = rsRandf(0.005f * float(m_settings.dSpeed)) + (0.002f * float(m_settings.dSpeed));
   }
   else
   {
@@ -517,15 +325,15 @@ void CScreensaverHelios::Render()
   }
 
   // Release ions
-  if (m_ionsReleased < gHeliosSettings.dIons)
+  if (m_ionsReleased < m_settings.dIons)
   {
     m_releaseTime -= m_frameTime;
-    while(m_ionsReleased < gHeliosSettings.dIons && m_releaseTime <= 0.0f)
+    while(m_ionsReleased < m_settings.dIons && m_releaseTime <= 0.0f)
     {
-      m_ilist[m_ionsReleased].start(m_frameTime, m_newRgb, m_elist);
+      m_ions->Start(m_ionsReleased, m_frameTime, m_newRgb, m_emitterPos.data(), m_settings.dEmitters);
       m_ionsReleased ++;
       // all ions released after 2 minutes
-      m_releaseTime += 120.0f / float(gHeliosSettings.dIons);
+      m_releaseTime += 120.0f / float(m_settings.dIons);
     }
   }
 
@@ -533,7 +341,7 @@ void CScreensaverHelios::Render()
   m_wait -= m_frameTime;
   if (m_wait <= 0.0f)
   {
-    m_preinterp += m_frameTime * float(gHeliosSettings.dSpeed) * m_interpconst;
+    m_preinterp += m_frameTime * float(m_settings.dSpeed) * m_interpconst;
     m_interp = 0.5f - (0.5f * cosf(m_preinterp));
   }
   if (m_preinterp >= glm::pi<float>())
@@ -553,29 +361,41 @@ void CScreensaverHelios::Render()
   }
 
   // Update particles
-  for (i = 0; i < gHeliosSettings.dEmitters; i++)
+  for (i = 0; i < m_settings.dEmitters; i++)
   {
     m_elist[i].interppos(m_interp);
     m_elist[i].update();
+    std::copy(m_elist[i].pos.v, m_elist[i].pos.v + 3, &m_emitterPos[i * 3]);
   }
-  for (i = 0; i < gHeliosSettings.dAttracters; i++)
+  for (i = 0; i < m_settings.dAttracters; i++)
   {
     m_alist[i].interppos(m_interp);
     m_alist[i].update();
-  }
+    std::copy(m_alist[i].pos.v, m_alist[i].pos.v + 3, &m_attracterPos[i * 3]);
+  }
+  const unsigned int ionJobs = (m_ionsReleased + IONS_PER_JOB - 1) / IONS_PER_JOB;
+  rsWorkerPool::shared().parallelFor(ionJobs, [&](unsigned int job) {
+    m_ions->Update(job * IONS_PER_JOB, std::min((job + 1) * IONS_PER_JOB, unsigned(m_ionsReleased)), m_frameTime,
+                   m_emitterPos.data(), m_settings.dEmitters, m_attracterPos.data(), m_settings.dAttracters,
+                   m_startOver.data());
+  });
+  // Restarting picks random emitters, so do it here in ion order
   for (i = 0; i < m_ionsReleased; i++)
-    m_ilist[i].update(m_frameTime, m_newRgb, m_elist, m_alist);
+  {
+    if (m_startOver[i])
+      m_ions->Start(i, m_frameTime, m_newRgb, m_emitterPos.data(), m_settings.dEmitters);
+  }
 
   // Calculate surface
-  if (gHeliosSettings.dSurface)
+  if (m_settings.dSurface)
   {
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    for (i = 0; i < m_settings.dEmitters; i++)
       m_spheres[i].setPosition(m_elist[i].pos[0], m_elist[i].pos[1], m_elist[i].pos[2]);
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
-      m_spheres[gHeliosSettings.dEmitters+i].setPosition(m_alist[i].pos[0], m_alist[i].pos[1], m_alist[i].pos[2]);
+    for (i = 0; i < m_settings.dAttracters; i++)
+      m_spheres[m_settings.dEmitters+i].setPosition(m_alist[i].pos[0], m_alist[i].pos[1], m_alist[i].pos[2]);
 
     impCrawlPointVector cpv;
-    for (i = 0; i < gHeliosSettings.dEmitters+gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dEmitters+m_settings.dAttracters; i++)
       m_spheres[i].addCrawlPoint(cpv);
     m_surface->reset();
     m_valuetrig += m_frameTime;
@@ -585,7 +405,7 @@ void CScreensaverHelios::Render()
 
   // Draw
   // clear the screen
-  if (gHeliosSettings.dBlur)  // partially
+  if (m_settings.dBlur)  // partially
   {
     glm::mat4 projMat = m_projMat;
     glm::mat4 modelMat = m_modelMat;
@@ -593,7 +413,7 @@ void CScreensaverHelios::Render()
     m_modelMat = glm::mat4(1.0f);
 
     sLight blur[4];
-    blur[0].color = blur[1].color = blur[2].color = blur[3].color = glm::vec4(0.0f, 0.0f, 0.0f, 0.5f - (float(sqrtf(sqrtf(float(gHeliosSettings.dBlur)))) * 0.15495f));
+    blur[0].color = blur[1].color = blur[2].color = blur[3].color = glm::vec4(0.0f, 0.0f, 0.0f, 0.5f - (float(sqrtf(sqrtf(float(m_settings.dBlur)))) * 0.15495f));
     blur[0].vertex = glm::vec3(0.0f, 0.0f, 0.0f);
     blur[1].vertex = glm::vec3(1.0f, 0.0f, 0.0f);
     blur[2].vertex = glm::vec3(0.0f, 1.0f, 0.0f);
@@ -613,47 +433,44 @@ void CScreensaverHelios::Render()
   else  // completely
     glClear(GL_COLOR_BUFFER_BIT);
 
-  // Draw ions
-  glBlendFunc(GL_ONE, GL_ONE);
-  glBindTexture(GL_TEXTURE_2D, m_texture_id[0]);
-  for (i = 0; i < m_ionsReleased; i++)
+  // Draw ions, all at once from one buffer streamed every frame
+  if (m_ionsReleased)
   {
-    m_ilist[i].draw([&](const sLight* surface, rsVec pos, float size)
-    {
-      // draw the surface
-      glm::mat4 modelMat = m_modelMat;
-      m_modelMat = glm::translate(modelMat, glm::vec3(pos[0] * m_billboardMat[0] + pos[1] * m_billboardMat[4] + pos[2] * m_billboardMat[8],
-                                                      pos[0] * m_billboardMat[1] + pos[1] * m_billboardMat[5] + pos[2] * m_billboardMat[9],
-                                                      pos[0] * m_billboardMat[2] + pos[1] * m_billboardMat[6] + pos[2] * m_billboardMat[10]));
-      m_modelMat = glm::scale(m_modelMat, glm::vec3(size, size, size));
-      EnableShader();
-      glUniform1i(m_hType, 2);
-      glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*6, surface, GL_DYNAMIC_DRAW);
-      glDrawArrays(GL_TRIANGLES, 0, 6);
-      DisableShader();
-      m_modelMat = modelMat;
+    m_ionVertices.resize(m_ionsReleased * 6);
+    rsWorkerPool::shared().parallelFor(ionJobs, [&](unsigned int job) {
+      m_ions->Billboards(job * IONS_PER_JOB, std::min((job + 1) * IONS_PER_JOB, unsigned(m_ionsReleased)),
+                         m_billboardMat, &m_ionVertices[job * IONS_PER_JOB * 6]);
     });
+
+    glBlendFunc(GL_ONE, GL_ONE);
+    glBindTexture(GL_TEXTURE_2D, m_texture_id[0]);
+    EnableShader();
+    glUniform1i(m_hType, 2);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*m_ionVertices.size(), m_ionVertices.data(), GL_STREAM_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_ionVertices.size()));
+    DisableShader();
   }
 
   // Draw surfaces
   float brightFactor;
   float surfaceColor[3] = {0.0f, 0.0f, 0.0f};
-  if (gHeliosSettings.dSurface)
+  if (m_settings.dSurface)
   {
     // find color for surfaces
-    if (gHeliosSettings.dIons >= 100)
+    if (m_settings.dIons >= 100)
     {
-      brightFactor = 4.0f / (float(gHeliosSettings.dBlur + 30) * float(gHeliosSettings.dBlur + 30));
+      brightFactor = 4.0f / (float(m_settings.dBlur + 30) * float(m_settings.dBlur + 30));
       for (i = 0; i < 100; i++)
       {
-        surfaceColor[0] += m_ilist[i].rgb[0] * brightFactor;
-        surfaceColor[1] += m_ilist[i].rgb[1] * brightFactor;
-        surfaceColor[2] += m_ilist[i].rgb[2] * brightFactor;
+        const glm::vec3 rgb = m_ions->Color(i);
+        surfaceColor[0] += rgb[0] * brightFactor;
+        surfaceColor[1] += rgb[1] * brightFactor;
+        surfaceColor[2] += rgb[2] * brightFactor;
       }
     }
     else
     {
-      brightFactor = 400.0f / (float(gHeliosSettings.dBlur + 30) * float(gHeliosSettings.dBlur + 30));
+      brightFactor = 400.0f / (float(m_settings.dBlur + 30) * float(m_settings.dBlur + 30));
       surfaceColor[0] = m_newRgb.r * brightFactor;
       surfaceColor[1] = m_newRgb.g * brightFactor;
       surfaceColor[2] = m_newRgb.b * brightFactor;
@@ -738,20 +555,20 @@ void CScreensaverHelios::setTargets(int whichTarget)
   switch (whichTarget)
   {
   case 0:  // random
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    for (i = 0; i < m_settings.dEmitters; i++)
       m_elist[i].settargetpos(rsVec(rsRandf(1000.0f) - 500.0f, rsRandf(1000.0f) - 500.0f, rsRandf(1000.0f) - 500.0f));
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
       m_alist[i].settargetpos(rsVec(rsRandf(1000.0f) - 500.0f, rsRandf(1000.0f) - 500.0f, rsRandf(1000.0f) - 500.0f));
     break;
   case 1:  // line (all emitters on one side, all attracters on the other)
   {
-    float position = -500.0f, change = 1000.0f / float(gHeliosSettings.dEmitters + gHeliosSettings.dAttracters - 1);
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    float position = -500.0f, change = 1000.0f / float(m_settings.dEmitters + m_settings.dAttracters - 1);
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       m_elist[i].settargetpos(rsVec(position, position * 0.5f, 0.0f));
       position += change;
     }
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       m_alist[i].settargetpos(rsVec(position, position * 0.5f, 0.0f));
       position += change;
@@ -761,18 +578,18 @@ void CScreensaverHelios::setTargets(int whichTarget)
   case 2:  // line (emitters and attracters staggered)
   {
     float change;
-    if (gHeliosSettings.dEmitters > gHeliosSettings.dAttracters)
-      change = 1000.0f / float(gHeliosSettings.dEmitters * 2 - 1);
+    if (m_settings.dEmitters > m_settings.dAttracters)
+      change = 1000.0f / float(m_settings.dEmitters * 2 - 1);
     else
-      change = 1000.0f / float(gHeliosSettings.dAttracters * 2 - 1);
+      change = 1000.0f / float(m_settings.dAttracters * 2 - 1);
     float position = -500.0f;
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       m_elist[i].settargetpos(rsVec(position, position * 0.5f, 0.0f));
       position += change * 2.0f;
     }
     position = -500.0f + change;
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       m_alist[i].settargetpos(rsVec(position, position * 0.5f, 0.0f));
       position += change * 2.0f;
@@ -781,18 +598,18 @@ void CScreensaverHelios::setTargets(int whichTarget)
   }
   case 3:  // 2 lines (parallel)
   {
-    float change = 1000.0f / float(gHeliosSettings.dEmitters * 2 - 1);
+    float change = 1000.0f / float(m_settings.dEmitters * 2 - 1);
     float position = -500.0f;
-    float height = -525.0f + float(gHeliosSettings.dEmitters * 25);
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    float height = -525.0f + float(m_settings.dEmitters * 25);
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       m_elist[i].settargetpos(rsVec(position, height, -50.0f));
       position += change * 2.0f;
     }
-    change = 1000.0f / float(gHeliosSettings.dAttracters * 2 - 1);
+    change = 1000.0f / float(m_settings.dAttracters * 2 - 1);
     position = -500.0f;
-    height = 525.0f - float(gHeliosSettings.dAttracters * 25);
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    height = 525.0f - float(m_settings.dAttracters * 25);
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       m_alist[i].settargetpos(rsVec(position, height, 50.0f));
       position += change * 2.0f;
@@ -801,18 +618,18 @@ void CScreensaverHelios::setTargets(int whichTarget)
   }
   case 4:  // 2 lines (skewed)
   {
-    float change = 1000.0f / float(gHeliosSettings.dEmitters * 2 - 1);
+    float change = 1000.0f / float(m_settings.dEmitters * 2 - 1);
     float position = -500.0f;
-    float height = -525.0f + float(gHeliosSettings.dEmitters * 25);
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    float height = -525.0f + float(m_settings.dEmitters * 25);
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       m_elist[i].settargetpos(rsVec(position, height, 0.0f));
       position += change * 2.0f;
     }
-    change = 1000.0f / float(gHeliosSettings.dAttracters * 2 - 1);
+    change = 1000.0f / float(m_settings.dAttracters * 2 - 1);
     position = -500.0f;
-    height = 525.0f - float(gHeliosSettings.dAttracters * 25);
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    height = 525.0f - float(m_settings.dAttracters * 25);
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       m_alist[i].settargetpos(rsVec(10.0f, height, position));
       position += change * 2.0f;
@@ -820,26 +637,26 @@ void CScreensaverHelios::setTargets(int whichTarget)
     break;
   }
   case 5:  // random distribution across a plane
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    for (i = 0; i < m_settings.dEmitters; i++)
       m_elist[i].settargetpos(rsVec(rsRandf(1000.0f) - 500.0f, 0.0f, rsRandf(1000.0f) - 500.0f));
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
       m_alist[i].settargetpos(rsVec(rsRandf(1000.0f) - 500.0f, 0.0f, rsRandf(1000.0f) - 500.0f));
     break;
   case 6:  // random distribution across 2 planes
   {
-    float height = -525.0f + float(gHeliosSettings.dEmitters * 25);
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    float height = -525.0f + float(m_settings.dEmitters * 25);
+    for (i = 0; i < m_settings.dEmitters; i++)
       m_elist[i].settargetpos(rsVec(rsRandf(1000.0f) - 500.0f, height, rsRandf(1000.0f) - 500.0f));
-    height = 525.0f - float(gHeliosSettings.dAttracters * 25);
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    height = 525.0f - float(m_settings.dAttracters * 25);
+    for (i = 0; i < m_settings.dAttracters; i++)
       m_alist[i].settargetpos(rsVec(rsRandf(1000.0f) - 500.0f, height, rsRandf(1000.0f) - 500.0f));
     break;
   }
   case 7:  // 2 rings (1 inside and 1 outside)
   {
     float angle = 0.5f, cosangle, sinangle;
-    float change = glm::pi<float>()*2 / float(gHeliosSettings.dEmitters);
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    float change = glm::pi<float>()*2 / float(m_settings.dEmitters);
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       angle += change;
       cosangle = cosf(angle) * 200.0f;
@@ -847,8 +664,8 @@ void CScreensaverHelios::setTargets(int whichTarget)
       m_elist[i].settargetpos(rsVec(cosangle, sinangle, 0.0f));
     }
     angle = 1.5f;
-    change = glm::pi<float>()*2 / float(gHeliosSettings.dAttracters);
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    change = glm::pi<float>()*2 / float(m_settings.dAttracters);
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       angle += change;
       cosangle = cosf(angle) * 500.0f;
@@ -860,15 +677,15 @@ void CScreensaverHelios::setTargets(int whichTarget)
   case 8:  // ring (all emitters on one side, all attracters on the other)
   {
     float angle = 0.5f, cosangle, sinangle;
-    float change = glm::pi<float>()*2 / float(gHeliosSettings.dEmitters + gHeliosSettings.dAttracters);
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    float change = glm::pi<float>()*2 / float(m_settings.dEmitters + m_settings.dAttracters);
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       angle += change;
       cosangle = cosf(angle) * 500.0f;
       sinangle = sinf(angle) * 500.0f;
       m_elist[i].settargetpos(rsVec(cosangle, sinangle, 0.0f));
     }
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       angle += change;
       cosangle = cosf(angle) * 500.0f;
@@ -880,12 +697,12 @@ void CScreensaverHelios::setTargets(int whichTarget)
   case 9:  // ring (emitters and attracters staggered)
   {
     float change;
-    if (gHeliosSettings.dEmitters > gHeliosSettings.dAttracters)
-      change = glm::pi<float>()*2 / float(gHeliosSettings.dEmitters * 2);
+    if (m_settings.dEmitters > m_settings.dAttracters)
+      change = glm::pi<float>()*2 / float(m_settings.dEmitters * 2);
     else
-      change = glm::pi<float>()*2 / float(gHeliosSettings.dAttracters * 2);
+      change = glm::pi<float>()*2 / float(m_settings.dAttracters * 2);
     float angle = 0.5f, cosangle, sinangle;
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    for (i = 0; i < m_settings.dEmitters; i++)
     {
       cosangle = cosf(angle) * 500.0f;
       sinangle = sinf(angle) * 500.0f;
@@ -893,7 +710,7 @@ void CScreensaverHelios::setTargets(int whichTarget)
       angle += change * 2.0f;
     }
     angle = 0.5f + change;
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
     {
       cosangle = cosf(angle) * 500.0f;
       sinangle = sinf(angle) * 500.0f;
@@ -903,9 +720,9 @@ void CScreensaverHelios::setTargets(int whichTarget)
     break;
   }
   case 10:  // 2 points
-    for (i = 0; i < gHeliosSettings.dEmitters; i++)
+    for (i = 0; i < m_settings.dEmitters; i++)
       m_elist[i].settargetpos(rsVec(500.0f, 100.0f, 50.0f));
-    for (i = 0; i < gHeliosSettings.dAttracters; i++)
+    for (i = 0; i < m_settings.dAttracters; i++)
       m_alist[i].settargetpos(rsVec(-500.0f, -100.0f, -50.0f));
     break;
   }
@@ -913,13 +730,25 @@ void CScreensaverHelios::setTargets(int whichTarget)
 
 float CScreensaverHelios::surfaceFunction(void* base, float* position)
 {
-  int points = gHeliosSettings.dEmitters + gHeliosSettings.dAttracters;
+  CScreensaverHelios* helios = static_cast<CScreensaverHelios*>(base);
+  int points = helios->m_settings.dEmitters + helios->m_settings.dAttracters;
 
   float value = 0.0f;
   for (int i = 0; i < points; i++)
-    value += static_cast<CScreensaverHelios*>(base)->m_spheres[i].value(position);
+    value += helios->m_spheres[i].value(position);
 
   return(value);
 }
 
+void CScreensaverHelios::surfaceBatchFunction(void* base, const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+  CScreensaverHelios* helios = static_cast<CScreensaverHelios*>(base);
+  int points = helios->m_settings.dEmitters + helios->m_settings.dAttracters;
+
+  for (unsigned int i = 0; i < n; i++)
+    values[i] = 0.0f;
+  for (int i = 0; i < points; i++)
+    helios->m_spheres[i].addValues(xs, ys, zs, values, n);
+}
+
 ADDONCREATOR(CScreensaverHelios);
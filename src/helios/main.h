@@ -28,7 +28,50 @@ class impSurface;
 class impSphere;
 class emitter;
 class attracter;
-class ion;
+class CIons;
+
+// Parameters edited in the dialog box
+struct sHeliosSettings
+{
+  sHeliosSettings()
+  {
+    SetDefaults();
+  }
+
+  void SetDefaults()
+  {
+    dIons = 1500;
+    dSize = 10;
+    dEmitters = 3;
+    dAttracters = 3;
+    dSpeed = 10;
+    dCameraspeed = 10;
+    dSurface = true;
+    dBlur = 10;
+  }
+
+  void Load()
+  {
+    SetDefaults();
+    kodi::addon::CheckSettingInt("general.ions", dIons);
+    kodi::addon::CheckSettingInt("general.size", dSize);
+    kodi::addon::CheckSettingInt("general.emitters", dEmitters);
+    kodi::addon::CheckSettingInt("general.attractors", dAttracters);
+    kodi::addon::CheckSettingInt("general.speed", dSpeed);
+    kodi::addon::CheckSettingInt("general.cameraspeed", dCameraspeed);
+    kodi::addon::CheckSettingBoolean("general.isosurface", dSurface);
+    kodi::addon::CheckSettingInt("general.blur", dBlur);
+  }
+
+  int dIons;
+  int dSize;
+  int dEmitters;
+  int dAttracters;
+  int dSpeed;
+  int dCameraspeed;
+  bool dSurface;
+  int dBlur;
+};
 
 struct sLight
 {
@@ -56,6 +99,9 @@ public:
 private:
   void setTargets(int whichTarget);
   static float surfaceFunction(void* base, float* position);
+  static void surfaceBatchFunction(void* base, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+
+  sHeliosSettings m_settings;
 
   double m_lastTime;;
   float m_frameTime = 0.0f;
@@ -88,8 +134,13 @@ private:
 
   emitter *m_elist = nullptr;
   attracter *m_alist = nullptr;
-  ion *m_ilist = nullptr;
+  CIons* m_ions = nullptr;
 
+  // packed x, y, z of every emitter and attracter for the ion kernel
+  std::vector<float> m_emitterPos;
+  std::vector<float> m_attracterPos;
+  std::vector<unsigned char> m_startOver;
+  std::vector<sLight> m_ionVertices;
   int m_ionsReleased = 0;
   float m_releaseTime = 0.0f;
 
@@ -5,4115 +5,3822 @@
  *  See LICENSE.md for more information.
  */
 
+#pragma once
 
-#ifndef TEXTURE_H
-#define TEXTURE_H
-
-
+#include <rsAsset/rsAsset.h>
 
 #define TEXSIZE 256
 
+/* data from spheremap.raw, 196608 bytes */
 
-
-unsigned char spheremap[TEXSIZE][TEXSIZE][3] = {
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,6,4,3,11,8,6,14,10,7,22,14,9,
-22,14,10,6,12,8,1,12,8,4,16,10,8,21,14,11,24,16,13,26,18,17,28,20,21,31,22,25,35,24,24,37,26,16,38,26,10,41,28,8,38,27,9,40,28,9,44,33,
-9,45,36,10,45,37,12,45,35,12,46,37,13,48,39,13,48,39,12,46,38,12,46,38,12,45,36,11,44,36,12,42,34,11,39,32,9,36,29,8,31,24,8,30,23,7,24,19,
-6,20,16,4,17,13,4,16,12,3,12,10,2,8,6,1,3,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,1,8,1,1,16,3,3,28,5,6,35,6,7,48,13,12,57,19,16,72,27,23,79,34,27,88,39,31,
-97,44,35,78,42,32,72,43,32,83,50,37,92,55,41,97,58,43,104,60,45,113,63,48,115,65,50,105,64,49,92,60,47,68,57,43,45,52,38,34,49,37,36,49,37,34,49,39,
-34,48,40,27,48,39,10,45,37,10,46,38,10,47,40,10,47,41,9,47,42,10,49,43,10,48,43,11,49,44,13,50,45,14,50,45,14,50,45,13,48,44,12,47,41,11,45,39,
-11,44,37,11,42,36,11,39,33,10,38,31,9,36,29,7,28,23,5,21,18,4,15,13,3,11,10,2,8,7,1,4,4,0,2,2,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,2,0,0,9,2,2,20,4,4,28,6,6,38,8,8,61,13,13,73,17,17,89,22,22,104,31,29,109,37,31,118,44,36,128,52,42,137,61,48,143,65,53,148,67,54,
-152,71,59,153,70,61,157,72,64,162,72,67,166,72,72,166,73,74,169,74,78,170,75,86,168,74,88,159,71,86,152,69,85,142,66,84,125,61,80,121,61,82,122,61,85,120,61,85,
-119,62,84,107,60,82,84,57,79,70,54,74,64,53,73,59,53,72,52,53,68,46,52,65,37,51,60,25,50,55,16,50,51,12,50,50,13,51,51,14,51,51,15,52,53,14,52,52,
-14,52,51,15,52,51,15,52,50,14,51,48,14,50,47,14,49,46,13,46,42,11,42,37,11,39,34,8,34,29,7,28,24,6,23,19,4,16,14,2,9,9,1,5,5,1,3,3,
-0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,12,2,2,30,6,6,
-51,11,11,70,16,16,97,23,23,109,25,26,115,28,28,132,34,33,152,42,40,160,51,46,166,58,51,163,63,52,160,66,59,167,70,69,175,75,79,178,77,88,179,76,93,178,76,100,
-182,76,107,185,77,110,187,77,117,188,77,118,190,77,122,185,74,122,177,72,123,176,72,125,177,70,126,178,71,129,175,73,126,175,73,127,175,74,130,172,73,127,166,72,129,165,76,131,
-162,77,129,167,79,138,149,76,125,136,73,117,135,74,120,138,75,124,135,75,123,131,75,122,124,73,118,93,66,97,59,60,75,29,55,58,19,54,53,17,54,54,15,54,54,14,54,54,
-15,54,54,16,55,55,16,55,56,16,55,56,16,55,56,16,55,56,16,55,55,16,55,54,15,53,52,14,50,49,13,48,46,12,44,41,10,39,35,8,33,29,7,27,25,5,21,19,
-4,15,13,1,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,1,23,5,5,46,10,10,73,17,17,108,25,25,136,34,34,
-157,39,39,174,45,45,186,49,49,187,53,51,186,60,54,187,65,55,192,70,59,185,72,59,181,74,61,182,76,74,190,79,101,198,81,120,203,81,129,201,80,131,194,75,127,188,71,123,
-188,69,122,193,69,121,194,73,120,194,75,121,187,72,111,179,73,106,171,72,111,163,73,101,164,74,102,163,76,104,158,78,99,155,77,98,156,77,99,152,76,101,137,72,95,131,72,91,
-130,73,90,147,78,110,138,76,100,120,72,84,117,72,85,118,73,87,120,74,91,126,74,97,129,75,100,120,73,97,101,69,84,77,64,69,56,59,57,55,60,58,47,58,56,35,56,54,
-27,55,54,18,55,54,16,54,54,16,54,54,16,55,55,17,55,56,17,56,56,17,56,56,17,56,56,17,56,57,17,56,56,17,55,56,16,54,54,15,52,52,14,49,47,12,44,42,
-10,37,33,7,26,22,4,17,14,3,11,8,1,3,3,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,2,2,26,5,5,60,13,13,100,24,24,145,37,37,178,47,47,193,52,52,202,56,56,206,58,57,
-206,59,57,206,62,58,204,66,59,200,73,62,195,78,66,187,77,68,185,77,69,184,76,74,185,74,77,190,71,88,195,70,102,197,69,107,197,68,105,190,66,96,180,64,87,176,65,83,
-175,67,83,175,71,85,166,72,79,160,72,80,157,72,78,151,72,78,148,73,86,143,74,83,144,73,83,138,71,83,121,68,78,102,62,70,102,59,71,99,57,70,98,56,69,103,58,75,
-98,59,72,102,61,74,101,60,74,99,59,72,89,58,64,76,57,56,74,56,52,76,57,52,77,57,53,71,56,52,51,53,49,48,53,48,51,53,47,56,56,51,61,56,51,63,56,51,
-47,54,49,26,52,48,15,51,48,14,51,49,15,51,49,15,53,51,16,53,52,17,54,54,17,55,55,17,56,56,17,56,56,17,57,56,17,57,57,17,57,57,17,57,57,17,56,56,
-16,55,55,15,52,51,13,47,45,10,40,37,7,28,26,4,14,14,1,4,4,0,0,0,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,8,2,2,31,6,6,69,16,16,110,27,27,150,38,38,184,49,49,205,57,57,216,61,61,220,63,64,218,64,63,213,66,62,207,68,61,
-200,69,60,197,73,62,196,76,65,195,78,78,190,75,86,186,70,82,186,64,76,187,61,77,185,58,74,184,57,70,186,60,71,182,65,72,177,70,71,173,73,67,173,76,72,171,78,75,
-167,78,70,157,76,67,143,71,70,141,68,83,142,66,92,143,67,95,144,66,99,148,68,100,148,67,100,139,65,99,125,63,99,114,59,99,112,57,97,114,56,96,124,59,104,121,60,108,
-110,59,110,107,58,107,103,54,104,104,53,103,97,52,98,90,50,94,90,51,92,91,52,89,88,52,85,79,50,79,48,44,67,34,41,58,31,39,52,24,39,47,26,38,42,25,38,37,
-21,38,34,15,39,33,8,38,33,10,40,36,10,42,38,11,42,38,11,42,39,12,44,42,13,47,44,14,50,47,15,52,51,16,54,53,17,55,54,17,56,56,17,56,56,17,56,57,
-17,57,57,17,57,57,17,57,57,17,56,56,16,54,53,13,47,47,10,35,35,5,20,20,2,8,8,0,2,2,0,0,0,1,2,2,1,2,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,3,0,0,29,5,5,66,15,15,111,27,27,160,41,41,195,52,52,209,58,58,217,62,62,219,63,63,218,62,62,215,62,62,209,62,60,202,65,59,197,70,60,190,69,58,
-186,66,58,181,63,56,180,58,54,180,55,60,177,52,59,179,52,61,177,57,66,171,60,62,168,66,64,165,68,62,169,73,62,167,74,62,163,73,60,160,73,58,159,72,58,156,72,59,
-155,71,59,150,69,59,145,67,68,155,67,95,159,67,109,160,68,111,165,71,114,166,71,112,164,71,110,164,73,112,162,74,110,157,72,109,160,73,112,160,72,112,161,73,114,145,69,111,
-135,65,111,129,62,108,128,60,108,130,61,109,114,57,104,99,54,104,87,52,104,86,51,105,85,50,106,87,47,104,84,44,102,79,40,97,77,35,94,69,33,87,67,33,84,60,33,77,
-50,35,69,42,36,62,26,33,44,13,32,30,9,33,30,7,33,28,6,31,27,6,33,29,8,34,30,8,36,31,10,39,35,11,43,39,12,47,44,14,49,48,15,52,50,16,54,53,
-17,55,54,17,56,56,17,56,56,17,57,57,17,57,57,17,57,57,17,57,57,16,53,54,13,46,46,9,34,34,5,19,19,2,10,10,1,7,7,1,6,6,1,4,4,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-29,7,7,96,24,24,157,41,41,193,53,53,216,61,61,222,65,65,222,65,65,219,63,63,216,62,62,212,62,62,205,62,60,197,61,58,187,60,55,182,61,54,184,59,54,179,54,51,
-168,48,46,165,46,43,164,48,44,159,51,44,157,56,45,158,61,49,155,66,53,155,70,55,156,72,56,152,70,54,152,68,54,150,66,53,146,65,54,147,66,56,152,67,59,149,66,59,
-151,66,60,153,67,62,152,67,67,159,70,80,158,70,81,156,71,79,157,74,78,156,74,75,152,72,71,151,73,70,152,74,69,144,71,69,153,72,83,165,74,96,164,74,96,155,70,94,
-148,65,92,145,61,89,145,60,89,147,60,90,136,57,88,130,56,90,114,52,90,110,52,90,104,47,86,100,43,85,93,36,82,85,32,80,70,27,78,68,27,81,69,26,83,70,27,83,
-76,31,92,72,29,82,54,27,59,31,24,31,35,26,34,34,25,34,21,23,26,17,23,25,10,25,23,7,28,24,5,26,20,5,28,23,6,33,27,9,35,31,9,38,34,10,39,36,
-11,41,40,13,45,45,15,51,51,16,54,54,17,56,56,17,56,56,17,57,57,17,57,57,17,57,57,17,57,57,15,53,53,12,44,44,9,33,33,5,22,22,2,11,12,2,6,6,
-1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,43,10,10,111,28,28,
-178,49,49,217,62,62,227,67,67,225,67,67,224,67,67,222,65,65,217,63,63,210,61,60,200,61,58,192,61,57,185,59,54,180,55,51,177,52,49,176,50,47,170,49,46,161,50,44,
-153,52,43,154,58,46,150,62,47,144,63,48,139,63,47,132,62,46,145,64,49,143,61,48,141,56,47,140,54,46,135,54,46,131,56,50,130,60,53,141,66,58,148,68,60,147,69,62,
-147,70,63,146,70,64,145,70,64,142,69,64,147,72,69,150,74,75,152,75,79,151,74,81,152,74,85,154,74,88,157,75,92,153,73,104,155,72,111,163,71,120,158,69,116,156,67,115,
-154,62,112,147,58,105,143,55,99,143,53,97,139,49,92,144,50,98,151,53,108,150,53,107,147,50,100,141,48,95,141,48,95,130,46,91,104,40,82,93,35,78,88,34,78,80,32,76,
-71,29,71,61,25,61,42,18,37,27,14,21,24,7,13,26,6,14,20,6,12,29,10,19,33,11,25,34,15,28,23,15,19,18,19,18,14,24,19,8,27,18,7,29,21,7,28,22,
-6,24,19,6,26,23,8,33,31,11,42,40,13,46,46,14,49,49,15,53,53,17,55,55,17,56,56,17,57,57,17,57,57,17,57,57,17,56,56,15,51,52,11,40,40,7,27,27,
-5,17,17,2,10,10,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,2,2,72,18,18,148,40,40,202,57,57,227,67,67,
-229,68,68,226,67,67,223,66,66,219,64,64,212,61,61,205,58,58,197,54,54,187,50,50,177,52,49,167,49,46,160,45,42,160,44,41,157,47,41,149,53,42,130,53,39,115,55,39,
-114,56,39,117,55,39,111,53,39,99,49,37,91,43,33,89,40,30,112,42,34,124,42,37,116,44,36,117,52,43,115,56,48,121,63,61,125,67,68,135,70,76,142,72,82,144,72,88,
-152,74,101,155,73,107,156,73,110,162,75,115,168,78,121,171,78,123,175,79,131,177,78,134,175,75,131,173,72,127,176,72,133,179,72,149,180,70,157,182,69,162,178,67,154,177,66,153,
-178,65,154,181,67,151,175,64,141,174,60,141,173,56,137,174,56,139,176,56,139,174,56,136,174,56,137,164,53,125,157,54,117,151,55,114,143,52,111,137,51,106,130,49,101,122,48,96,
-118,42,91,113,37,87,106,36,82,92,29,68,75,21,53,61,16,43,45,11,30,34,7,21,22,5,13,20,3,11,24,5,13,28,8,17,32,10,21,12,10,11,2,12,7,5,16,10,
-5,20,12,6,22,14,6,25,17,7,27,20,7,30,24,7,30,27,8,32,32,11,40,40,14,49,49,16,54,54,17,56,56,17,56,56,17,57,57,17,57,57,17,57,57,16,54,54,
-13,47,47,10,39,39,6,25,25,2,9,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,6,6,93,24,24,171,46,46,218,63,63,232,69,69,229,69,69,225,68,68,
-222,66,66,217,63,63,206,58,58,193,52,52,178,47,47,169,43,44,159,40,40,147,38,37,133,36,33,115,34,28,106,36,26,108,40,27,97,43,28,76,45,29,45,38,22,32,31,17,
-46,27,17,69,28,20,76,31,23,77,33,25,79,36,28,96,45,36,110,50,46,115,55,52,112,59,57,115,64,68,118,66,75,135,71,96,139,71,102,135,69,101,135,69,103,133,66,103,
-138,68,108,137,68,110,136,68,109,142,70,109,144,68,104,140,65,100,137,62,101,133,57,95,133,52,91,136,48,86,138,47,91,145,48,104,147,47,112,150,50,114,147,48,111,145,47,111,
-153,50,113,159,52,115,151,50,108,148,48,102,148,47,103,139,44,98,132,42,89,139,44,99,147,46,107,149,47,108,149,46,108,154,43,110,161,46,118,165,49,126,158,47,117,149,46,107,
-142,40,98,132,35,94,120,33,91,124,36,94,125,37,94,120,37,92,114,34,87,105,29,79,93,28,68,72,22,53,46,13,33,18,5,12,3,1,2,0,0,0,0,0,0,0,0,0,
-1,3,2,2,7,4,3,13,8,5,17,10,5,21,13,6,24,15,5,20,13,5,20,16,6,26,24,9,34,34,12,44,44,14,50,51,17,54,55,17,56,56,17,57,57,17,57,57,
-17,57,57,17,56,57,15,51,51,11,40,40,6,22,22,1,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,7,7,108,28,28,185,52,52,225,66,66,232,69,69,229,69,69,225,68,68,220,65,65,211,60,60,
-198,54,54,181,48,48,165,42,42,154,38,38,144,37,36,130,39,32,112,36,28,89,31,22,65,29,16,43,26,12,29,22,8,27,23,10,17,22,10,10,19,9,14,12,7,30,13,8,
-59,20,14,81,35,24,101,49,42,113,57,56,126,64,71,119,65,70,112,63,70,113,63,78,111,63,80,113,63,85,116,63,88,122,64,93,120,62,93,116,60,88,116,59,85,112,57,81,
-112,57,77,113,57,71,115,56,73,115,54,66,117,52,67,115,48,64,115,46,61,116,43,60,125,42,62,141,44,64,144,45,68,146,46,70,146,50,73,147,53,75,147,53,73,145,52,71,
-147,53,71,146,53,70,144,51,73,144,47,81,136,42,77,114,36,64,101,33,53,99,32,51,100,33,55,98,32,52,92,30,50,93,27,52,101,29,59,111,31,68,118,32,74,127,34,82,
-133,35,86,129,33,89,122,30,93,120,29,96,112,28,86,107,27,82,112,29,86,117,30,89,114,32,86,105,32,81,90,28,70,58,20,45,30,15,23,18,10,15,8,5,6,0,2,1,
-0,0,0,0,0,0,0,0,0,0,1,0,1,5,3,3,9,6,4,15,8,5,19,11,5,19,11,6,21,15,7,28,24,8,33,32,10,40,39,13,46,47,15,53,53,17,56,56,
-17,56,56,17,56,57,17,57,57,17,57,57,16,53,53,12,42,42,6,23,23,1,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,9,9,121,32,32,193,54,54,229,67,67,232,69,69,228,68,68,225,68,68,220,65,65,205,58,57,184,50,48,168,43,46,
-147,36,37,120,29,29,105,27,25,108,32,26,97,35,24,72,34,19,49,29,13,28,23,8,12,18,5,5,13,3,2,7,1,0,4,1,21,8,5,49,19,11,76,31,22,92,41,34,
-96,49,40,92,54,42,93,58,53,84,56,53,84,56,60,83,56,64,80,55,63,101,58,79,115,62,85,113,61,76,106,58,65,99,54,52,102,53,55,109,55,64,110,51,62,109,50,62,
-108,48,60,117,48,60,133,51,71,133,51,71,128,49,69,127,46,68,128,46,75,123,44,70,123,46,70,130,49,71,136,50,76,133,50,73,134,50,73,142,52,75,149,53,76,151,53,75,
-152,53,79,151,52,74,153,51,81,158,47,93,163,45,113,160,43,116,149,40,104,142,38,93,140,38,92,135,37,82,121,33,73,108,30,68,107,31,72,100,30,65,89,27,54,77,24,46,
-84,26,52,88,27,64,92,29,68,93,27,68,95,28,72,98,27,76,103,27,80,102,26,80,91,22,68,75,17,49,57,13,30,50,13,28,53,15,36,48,16,33,49,18,36,33,13,24,
-24,12,18,13,8,9,1,5,2,0,2,1,0,0,0,0,0,0,0,0,0,1,3,2,2,9,5,4,17,11,6,24,17,7,28,21,7,30,24,7,31,28,9,36,35,12,45,45,
-15,52,52,17,55,55,17,56,56,17,56,57,17,57,57,17,57,58,16,55,55,12,42,43,6,21,21,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,30,7,7,121,32,32,203,57,57,232,68,68,231,69,69,227,68,68,225,68,68,220,64,64,204,57,56,179,48,46,159,40,46,139,34,45,133,33,54,
-94,26,34,48,17,12,34,14,7,41,18,10,26,18,7,14,19,5,6,14,3,3,9,2,2,4,1,2,2,1,6,6,2,14,12,4,40,24,10,57,35,18,70,44,33,66,46,36,
-49,43,32,32,40,22,24,38,16,26,39,17,38,41,27,55,47,39,55,47,34,74,49,35,85,50,33,82,44,28,77,41,28,74,40,31,79,40,43,97,44,65,91,42,61,85,41,61,
-84,42,62,86,45,60,90,48,58,86,49,55,78,48,53,71,44,46,69,40,47,68,40,45,66,39,41,71,41,40,94,46,46,99,44,46,100,39,41,110,35,42,124,35,46,135,37,49,
-135,37,49,133,36,47,134,35,51,142,36,73,149,38,95,148,37,95,140,35,88,137,34,86,138,34,89,139,34,92,141,35,99,147,37,114,153,39,129,153,39,128,141,35,121,121,30,109,
-110,27,104,111,29,107,108,29,105,101,27,94,94,28,83,81,24,69,65,22,61,67,23,62,65,22,53,59,19,28,52,13,9,52,11,7,49,10,11,46,10,14,49,11,24,42,11,27,
-53,14,38,54,16,38,39,16,29,14,11,12,4,8,5,1,5,3,0,2,1,0,0,0,0,0,0,0,0,0,1,3,2,3,10,7,5,19,14,6,25,19,7,28,22,7,30,27,
-9,36,35,11,44,43,14,49,49,16,54,54,17,56,56,17,56,57,17,57,57,17,57,58,16,55,55,11,41,41,5,17,17,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,25,5,5,106,27,27,193,54,54,232,69,69,231,69,69,227,68,68,225,68,68,220,64,64,205,58,57,172,45,44,134,32,38,113,26,40,114,28,49,102,28,48,59,20,28,
-25,12,11,0,4,0,0,1,0,2,3,1,1,6,1,2,6,1,2,2,1,5,4,1,11,11,3,16,19,5,17,23,8,16,25,11,16,26,13,17,30,16,19,34,17,16,34,13,
-18,35,12,22,36,10,25,37,10,28,39,10,29,38,10,25,36,9,23,34,9,29,33,10,45,33,24,64,35,45,62,36,47,58,37,47,54,39,45,49,42,42,43,42,39,34,40,32,
-30,40,29,23,36,24,24,34,22,35,33,27,41,33,30,40,27,29,59,28,34,75,30,33,77,29,33,85,30,36,101,34,41,101,32,39,102,28,39,115,29,42,132,31,49,141,34,56,
-141,35,56,143,36,57,141,37,53,143,38,58,144,38,60,146,38,64,143,38,61,141,37,60,138,37,60,138,35,60,137,35,65,140,36,81,143,36,96,145,37,104,146,36,112,142,35,120,
-140,35,127,142,35,134,141,35,138,138,35,137,134,33,134,123,31,127,98,28,116,77,26,104,60,22,86,45,18,62,37,12,36,37,8,19,44,10,11,51,11,9,31,6,2,10,1,1,
-12,2,6,29,6,19,42,9,28,29,8,21,7,6,5,1,7,3,2,7,5,2,7,4,1,4,3,0,0,0,0,0,0,0,0,0,0,0,0,1,5,4,3,11,8,4,16,12,
-6,22,17,6,28,24,8,34,31,10,41,40,14,48,48,16,53,53,17,56,56,17,57,57,17,57,57,17,58,58,16,55,55,10,37,37,3,12,12,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,2,2,
-94,23,23,186,52,52,229,67,67,232,69,69,227,68,68,226,68,68,221,66,65,204,57,57,169,44,43,133,32,40,101,23,39,80,20,41,66,19,37,40,15,19,19,10,8,1,3,0,
-0,0,0,0,0,0,0,0,0,0,1,0,3,2,1,7,7,1,13,14,4,18,23,7,18,25,10,14,25,12,10,25,13,9,24,12,12,27,12,18,33,12,23,36,11,28,39,10,
-30,40,10,29,38,10,25,34,8,21,29,7,17,27,8,15,30,11,15,32,15,16,35,17,21,37,22,35,42,31,32,44,29,28,44,25,22,41,21,19,39,17,15,34,13,11,26,9,
-7,18,6,4,14,4,9,10,5,16,10,9,19,11,10,22,12,12,26,12,12,43,16,14,47,17,15,47,19,18,59,22,37,67,23,55,66,17,54,74,20,55,95,26,70,110,30,90,
-117,30,98,119,30,99,121,36,100,122,37,97,125,38,95,138,41,95,143,43,91,146,43,91,149,46,90,146,43,79,145,43,72,145,44,68,144,42,63,143,41,63,144,41,65,139,38,63,
-135,36,66,134,36,75,136,35,89,137,35,102,140,35,116,141,34,125,140,34,136,141,38,152,137,39,157,122,37,149,101,33,133,75,26,107,54,19,79,39,13,49,24,7,23,3,1,5,
-0,0,0,0,0,0,2,0,0,4,1,2,0,0,0,0,0,0,1,1,1,1,4,3,1,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,4,3,3,11,8,5,19,15,6,26,21,8,32,29,10,38,38,13,46,46,15,53,53,17,55,55,17,56,56,17,57,57,17,58,58,15,52,52,9,32,32,2,8,8,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,63,15,15,165,45,45,
-225,65,65,231,69,69,227,68,68,225,67,67,221,66,65,204,57,56,170,45,45,128,31,37,102,24,42,83,20,45,61,19,35,31,13,17,9,7,4,2,3,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,3,0,10,10,3,17,19,6,18,24,9,17,26,11,12,21,10,8,18,9,9,22,11,16,29,12,23,35,11,28,39,10,31,40,10,32,41,10,30,40,11,
-24,35,9,18,29,7,13,25,7,14,27,11,17,34,17,23,42,25,26,45,25,27,46,23,27,45,21,23,41,16,20,36,12,18,31,10,14,25,6,12,21,5,9,16,3,6,11,2,
-3,7,2,5,9,3,4,10,4,4,12,4,3,15,5,3,17,6,2,17,7,2,18,8,3,18,8,3,19,9,14,23,28,26,24,46,25,20,44,26,19,43,34,23,54,58,28,84,
-64,24,90,69,21,95,72,23,96,75,25,101,80,25,102,93,26,102,114,30,111,124,34,122,135,37,130,144,40,129,148,41,129,147,42,125,148,42,118,148,43,111,144,42,99,142,42,88,
-137,41,73,135,41,63,132,40,53,123,36,47,113,33,48,118,34,57,119,33,74,120,32,96,123,33,120,135,35,139,137,38,153,131,40,159,122,40,157,108,36,144,87,29,121,59,21,90,
-34,13,56,15,6,26,1,1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,2,1,2,9,6,5,18,14,6,27,24,8,34,31,10,39,38,13,46,46,16,52,52,17,55,55,17,56,56,17,57,57,17,58,58,14,49,49,7,25,25,
-1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,8,8,134,35,35,213,60,60,232,69,69,
-227,68,68,225,68,68,221,65,65,204,58,57,167,43,42,128,31,37,101,23,42,76,18,40,55,16,32,28,14,15,10,9,2,0,2,0,0,0,0,0,0,0,0,0,0,1,1,0,
-5,5,1,12,13,4,17,19,9,19,25,11,15,25,11,7,18,9,5,13,7,8,14,5,16,22,7,24,32,9,29,38,10,32,42,11,30,41,12,27,39,14,24,38,17,23,36,18,
-20,35,16,21,37,18,24,42,25,28,46,28,31,48,30,30,46,27,27,43,20,24,37,12,19,30,8,14,22,5,9,15,3,8,13,3,7,14,4,7,15,6,7,18,8,7,20,9,
-9,23,11,10,26,13,11,27,14,10,25,13,7,22,11,6,18,10,12,17,13,12,15,13,11,13,11,13,12,12,14,12,12,14,10,12,13,9,11,13,8,12,15,9,16,20,10,22,
-22,8,27,30,9,41,38,12,54,42,13,59,41,13,61,42,13,61,47,14,64,63,19,82,83,23,98,104,26,104,125,30,115,129,33,121,132,33,125,136,34,128,142,36,133,147,38,140,
-153,40,145,155,41,144,151,41,131,139,38,115,123,35,94,117,33,74,105,31,53,91,27,36,85,28,37,85,26,50,83,26,71,78,27,98,92,33,125,114,38,146,125,40,158,122,39,155,
-104,35,138,78,26,109,54,20,83,31,12,51,12,5,24,2,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,3,13,11,6,26,22,9,33,30,10,37,35,11,42,41,14,48,48,15,52,52,17,55,55,17,56,56,18,57,57,17,57,57,
-12,43,44,5,18,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,4,4,95,24,24,193,54,54,232,68,68,229,68,68,226,68,68,
-224,67,66,211,60,59,175,46,46,131,32,36,99,22,37,92,22,52,74,19,46,32,13,16,9,8,2,2,4,1,2,2,7,1,1,3,0,0,1,0,0,0,5,4,1,11,12,4,
-18,19,10,17,21,15,11,14,16,6,11,10,4,10,5,6,9,3,15,16,4,23,26,6,27,34,8,27,38,10,26,39,14,24,37,16,23,37,20,24,39,24,28,43,29,32,46,31,
-30,47,30,30,47,29,30,46,26,27,42,21,25,36,15,18,27,8,14,22,6,11,18,4,9,17,5,9,18,7,12,22,10,15,26,12,17,29,14,17,31,15,14,29,14,12,28,13,
-13,28,12,13,26,11,12,24,9,9,19,7,4,10,4,10,6,8,26,6,16,30,7,19,34,8,22,33,7,21,30,6,18,26,5,16,30,6,18,30,6,17,28,6,16,31,6,18,
-21,4,10,33,7,23,36,8,30,38,8,32,43,10,37,53,12,40,58,14,41,59,14,44,69,16,49,91,21,60,94,22,64,97,23,67,99,24,74,104,25,85,110,27,97,116,29,108,
-122,31,118,132,33,130,141,36,141,146,37,146,152,40,154,157,42,157,149,39,145,129,34,114,117,30,88,102,27,64,67,20,37,26,12,18,13,13,25,28,18,51,55,26,84,79,28,108,
-87,29,117,91,30,122,97,32,130,92,30,125,75,26,107,50,18,77,26,9,42,9,4,17,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,5,5,4,15,14,6,25,23,8,31,30,9,36,36,12,43,43,14,48,48,16,52,53,17,56,56,17,56,57,
-16,57,58,16,55,55,10,36,36,3,11,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,1,4,70,17,17,168,45,44,224,65,65,230,69,69,227,68,68,226,68,67,216,62,62,
-178,48,48,125,31,35,99,23,35,97,22,51,86,22,54,58,19,34,22,10,11,3,4,1,1,2,4,2,2,9,1,2,8,2,2,1,5,5,1,11,11,4,16,16,9,13,14,15,
-9,10,14,4,5,10,4,4,5,8,8,3,16,16,3,22,25,6,24,32,8,24,35,11,23,37,17,23,39,23,24,39,26,28,41,28,31,43,29,33,46,29,33,46,29,29,44,25,
-26,40,19,25,36,14,24,32,9,22,28,6,20,26,7,16,23,8,15,24,11,16,27,13,18,31,15,19,32,15,19,31,14,18,30,12,15,26,10,13,24,9,11,20,6,9,16,5,
-8,14,3,7,11,3,5,8,2,3,5,1,1,2,0,3,1,2,5,0,2,4,1,2,4,1,2,5,1,2,3,1,2,1,0,1,2,1,1,2,1,1,2,1,1,3,1,1,
-1,0,1,4,1,2,4,1,0,4,1,2,21,6,21,44,11,39,62,15,37,67,15,34,72,16,37,76,18,38,75,17,37,79,19,40,81,19,44,88,21,52,98,24,71,104,25,85,
-105,26,87,102,25,86,99,24,87,105,25,95,119,30,117,141,37,144,151,41,156,153,41,157,155,40,155,150,39,148,130,33,127,98,24,90,54,13,43,25,7,16,9,7,8,5,5,13,
-10,5,23,27,10,45,52,18,76,76,25,106,93,31,125,97,32,130,88,29,120,66,22,94,33,12,52,13,5,24,2,1,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,5,5,3,13,13,6,25,25,9,34,34,10,38,38,11,43,43,14,49,49,16,53,54,
-16,55,55,16,56,56,17,56,57,13,49,49,7,27,27,2,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,2,5,62,14,32,144,37,53,210,59,59,231,69,69,227,68,68,225,67,67,219,64,63,188,51,50,128,32,32,
-72,16,27,68,15,42,82,20,50,66,20,41,34,14,18,7,7,2,0,2,3,2,2,8,2,2,7,2,2,6,6,6,5,11,11,6,15,15,9,12,14,14,9,9,14,5,4,12,
-4,3,5,10,10,3,16,17,3,21,26,5,24,33,8,23,35,12,21,36,19,22,37,26,26,42,34,31,46,38,34,47,35,33,45,29,30,43,23,25,38,17,23,33,12,23,29,8,
-23,29,7,25,28,7,24,29,8,26,33,14,29,37,20,27,37,21,23,34,18,18,30,12,17,28,10,15,26,8,15,25,9,15,26,10,12,23,10,7,15,7,4,7,3,2,2,1,
-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,2,1,4,14,4,15,23,5,18,27,6,20,31,6,25,35,8,26,43,10,29,48,11,32,54,12,37,66,15,45,73,17,55,83,20,66,
-92,22,76,88,21,74,82,19,68,83,19,67,87,20,74,99,24,92,108,26,107,117,29,116,128,33,130,138,36,141,147,39,147,145,37,143,134,33,126,120,29,107,96,22,82,61,13,48,
-27,6,18,2,0,1,0,0,2,10,5,21,32,11,51,58,20,85,81,26,111,88,28,118,69,23,97,52,18,77,38,14,58,19,7,33,5,3,12,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,4,12,13,7,26,26,7,33,33,9,35,35,11,41,41,13,48,48,
-14,50,50,16,53,53,16,54,55,15,55,55,15,55,55,11,41,41,4,18,18,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,9,2,0,34,7,13,111,26,51,193,53,76,227,67,75,228,68,69,225,68,68,223,66,66,206,58,56,149,38,36,83,19,26,58,12,32,
-69,16,47,68,19,44,42,15,22,9,7,3,0,2,1,1,2,5,2,2,9,2,2,7,2,2,7,11,12,17,16,17,20,14,15,18,9,10,15,6,4,13,8,3,14,15,11,12,
-17,18,6,20,25,5,21,30,8,21,33,13,20,35,21,23,38,29,27,41,34,33,45,37,35,47,37,33,46,33,28,41,24,24,34,14,22,28,7,21,24,7,25,27,9,28,33,15,
-29,35,18,29,35,18,29,35,20,30,37,24,31,38,26,26,34,22,19,29,13,14,25,9,15,26,10,15,27,12,14,26,13,11,21,9,7,13,5,2,4,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,0,3,1,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,5,1,5,9,2,8,14,3,12,21,4,17,32,7,27,
-56,14,57,77,19,81,79,20,82,81,19,79,79,19,72,79,18,69,79,18,68,83,19,71,90,21,82,102,25,100,111,27,112,118,29,117,124,31,121,132,34,130,138,35,136,138,35,130,
-119,30,112,76,20,79,32,10,45,5,3,13,0,0,0,1,1,7,16,6,29,30,11,46,34,12,54,46,16,70,58,19,84,56,19,83,36,13,57,8,3,16,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,6,4,15,15,6,23,23,7,28,28,9,35,35,11,43,43,
-12,46,46,13,47,48,14,50,50,15,53,53,15,55,55,15,54,55,14,50,50,8,31,32,3,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,0,0,27,6,7,87,20,34,159,41,64,215,61,76,229,68,71,225,68,67,224,67,67,218,63,63,189,51,50,130,32,38,91,21,51,79,18,58,71,18,49,
-49,16,29,16,9,6,1,3,0,0,2,4,2,2,9,2,2,7,2,2,6,3,4,13,7,8,23,13,16,27,10,13,23,6,6,16,6,2,14,9,4,15,14,12,14,22,25,12,
-22,31,10,20,35,17,21,38,28,24,39,31,29,42,35,34,45,37,35,46,35,31,44,28,25,37,19,22,31,11,21,25,7,23,26,7,26,29,13,29,33,19,31,37,25,32,39,29,
-33,39,28,31,37,25,30,36,25,29,37,25,29,36,24,24,33,19,16,28,15,13,25,14,12,24,15,11,23,16,9,19,14,5,10,6,2,3,1,0,1,0,0,2,1,1,4,3,
-1,5,3,2,8,4,2,9,6,3,10,7,3,11,7,1,6,4,0,1,1,0,2,1,1,2,2,1,4,3,1,4,3,1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,3,
-26,8,37,51,15,66,60,18,77,68,19,81,73,20,88,78,23,97,79,25,100,80,23,91,88,23,90,100,25,99,105,25,106,102,24,101,103,25,102,99,24,100,105,27,108,118,30,119,
-130,33,132,131,35,137,113,31,124,77,22,92,40,13,58,16,6,29,1,1,5,0,0,0,0,0,0,8,3,15,22,8,37,43,15,65,53,17,76,33,11,51,9,4,19,0,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,2,8,8,4,17,17,6,24,24,8,33,33,
-10,41,41,11,45,45,12,46,46,13,48,48,15,52,52,15,54,54,15,55,55,14,51,52,11,41,41,5,21,21,1,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,4,1,0,49,10,14,127,31,53,192,52,77,224,66,75,227,68,67,225,68,66,221,65,65,202,56,54,166,43,43,124,30,44,99,24,64,100,25,78,71,20,49,26,10,12,
-7,11,6,0,7,8,5,6,13,8,3,11,2,1,6,2,3,10,5,6,19,8,10,27,8,13,30,9,15,28,10,11,22,10,6,16,12,9,13,16,19,10,18,28,11,20,35,18,
-21,39,30,24,42,38,30,45,42,34,47,41,33,46,34,30,42,25,24,35,16,21,27,8,22,25,6,25,27,10,29,32,17,31,36,23,32,39,28,33,39,30,33,39,30,36,41,30,
-36,41,27,33,39,24,27,35,20,22,33,18,18,30,17,14,25,17,10,23,18,7,20,18,6,18,17,5,16,17,4,14,14,3,11,10,2,11,8,4,15,12,5,18,15,4,16,12,
-4,17,11,5,18,12,5,19,14,5,19,14,4,16,11,3,13,8,3,12,8,3,14,9,3,15,10,5,16,11,4,16,10,2,10,6,1,5,3,1,3,2,1,3,2,1,3,3,
-1,3,2,1,5,3,1,4,3,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,8,3,13,12,4,21,8,3,14,4,2,8,0,1,3,
-3,1,8,14,5,24,22,8,35,31,10,46,41,15,66,57,23,98,65,28,114,71,29,116,83,31,123,100,33,131,110,33,133,110,31,125,109,29,116,104,25,105,97,24,96,94,22,93,
-98,24,97,106,27,110,114,29,118,109,28,113,90,26,107,73,23,97,52,18,77,28,10,45,9,3,17,0,0,0,0,0,0,5,2,9,19,7,33,34,12,52,36,12,55,23,8,38,
-10,4,18,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,3,3,10,10,5,19,19,
-7,27,27,9,36,36,11,42,42,11,45,45,13,47,47,14,50,51,15,53,53,16,54,54,15,53,53,12,44,44,7,28,28,3,11,12,0,2,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-23,5,5,79,18,34,152,38,65,207,58,79,226,67,71,225,68,68,224,67,75,217,64,69,183,50,53,136,34,41,114,28,56,106,26,73,88,24,65,42,15,27,13,12,5,2,12,9,
-5,16,21,19,16,27,35,12,30,19,6,18,4,5,15,7,9,25,8,12,30,9,14,30,11,18,29,14,19,28,14,17,23,13,17,11,16,26,10,20,35,18,22,40,30,25,43,38,
-29,45,42,31,46,41,30,45,35,27,40,25,26,35,15,24,29,12,25,26,12,26,30,18,32,36,26,34,38,31,35,40,31,36,41,31,36,42,31,37,43,30,37,43,30,34,41,29,
-27,35,20,20,31,18,16,29,19,14,27,20,11,25,20,8,23,20,7,24,21,8,24,21,9,23,19,11,25,20,9,24,20,7,25,22,7,26,24,7,29,26,8,29,27,7,26,23,
-7,26,22,6,26,22,6,26,23,6,24,20,5,21,15,5,20,13,5,20,13,5,20,13,5,19,13,5,18,13,4,18,12,3,13,9,2,9,5,2,7,4,2,8,5,2,7,5,
-2,7,4,2,7,5,1,6,4,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,2,11,28,9,39,46,15,63,44,14,61,39,13,56,33,11,49,
-25,9,38,16,6,27,9,4,19,5,3,13,6,4,19,15,9,43,25,14,62,36,19,80,51,24,100,63,28,114,75,31,124,87,33,131,101,35,136,110,35,136,112,32,128,105,28,114,
-92,23,98,81,22,91,84,22,93,82,22,93,73,23,98,69,25,106,74,26,109,75,25,104,61,21,87,37,13,57,14,6,25,1,0,2,0,0,0,4,2,9,18,7,30,33,11,50,
-39,13,57,26,9,40,8,3,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,5,
-3,13,13,6,26,26,9,35,35,11,41,41,11,44,44,12,46,45,13,47,47,14,50,50,15,53,53,15,52,52,13,46,47,8,33,33,5,18,18,2,7,7,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,6,6,
-118,29,56,190,51,94,216,62,77,226,67,68,225,68,68,224,67,83,213,62,89,178,51,81,134,38,68,115,31,78,101,25,78,65,18,47,31,16,17,3,10,5,3,15,15,17,20,30,
-36,23,41,42,19,39,22,9,25,8,8,23,8,11,30,10,15,33,11,17,31,14,19,29,17,20,29,15,18,20,12,20,10,14,26,15,21,37,31,28,43,41,29,44,43,29,45,41,
-27,41,34,23,35,22,23,29,13,28,30,13,32,33,21,34,36,30,34,38,35,34,39,38,37,41,39,40,43,38,42,45,35,42,45,32,39,44,30,35,42,30,29,39,28,22,35,26,
-16,31,25,12,31,27,12,31,28,10,30,26,10,29,24,13,31,25,17,34,27,19,35,28,19,34,28,19,33,28,14,32,29,9,32,29,8,31,29,8,31,28,8,31,28,8,29,26,
-7,27,24,6,26,22,6,24,21,5,21,16,4,15,10,3,13,9,3,11,8,3,10,7,2,9,6,2,8,6,2,9,7,2,5,4,1,2,2,1,1,1,1,1,1,1,1,1,
-1,1,1,0,0,0,0,0,0,0,1,1,4,2,6,10,4,15,6,3,11,5,2,8,3,1,6,3,1,5,3,1,5,18,6,27,34,11,48,38,13,54,44,14,59,47,15,64,
-47,15,64,50,16,68,47,15,64,40,13,57,39,13,56,39,13,59,24,10,45,15,8,37,12,8,37,16,11,48,26,15,66,46,23,93,73,30,122,95,37,140,101,37,143,100,36,137,
-91,31,125,79,28,114,76,26,107,74,23,97,67,21,91,57,22,92,55,22,95,61,24,101,71,26,109,76,26,108,65,21,89,28,10,44,3,2,8,0,0,0,0,0,0,3,2,8,
-17,7,29,33,11,49,25,8,39,8,3,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,2,2,3,14,14,7,29,29,9,35,35,11,40,40,12,44,44,12,45,45,15,46,47,12,47,47,14,51,50,14,51,51,13,46,46,10,35,35,5,21,21,2,7,7,1,2,2,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,53,12,19,135,33,67,
-201,56,103,221,64,77,224,67,65,225,67,73,222,66,85,204,58,92,173,50,97,153,46,103,133,38,97,90,23,70,44,13,30,12,10,6,4,14,9,10,18,24,27,23,36,36,21,37,
-29,14,29,8,7,20,7,10,27,11,13,34,11,17,35,13,20,33,16,20,30,19,20,27,19,20,21,15,25,17,17,33,26,24,39,39,30,43,45,32,44,44,29,41,38,24,34,27,
-22,28,14,26,28,13,33,33,21,36,38,32,36,39,38,36,40,41,37,40,40,40,42,39,43,45,38,44,46,35,42,45,33,39,43,30,34,41,29,29,39,30,21,36,30,13,33,30,
-11,33,31,14,35,32,17,36,32,19,36,30,19,37,30,21,36,30,20,37,31,17,35,31,14,34,31,12,33,30,10,32,29,8,31,27,7,27,24,6,24,20,5,21,17,4,18,14,
-4,16,12,3,13,10,3,10,8,2,8,7,2,8,8,2,9,10,2,9,9,2,8,9,3,9,10,3,10,11,3,10,11,2,6,7,1,2,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,9,3,13,20,6,30,17,6,27,17,6,27,19,7,29,20,7,31,14,6,24,15,5,24,15,5,26,15,6,26,15,6,27,18,7,32,
-23,8,36,28,9,42,35,11,50,44,14,60,58,19,79,74,23,97,75,24,99,68,22,91,57,21,87,38,17,71,22,12,51,18,10,46,39,17,71,63,25,101,79,31,120,90,35,134,
-94,37,141,91,37,140,88,37,140,84,34,131,79,29,118,75,25,104,67,22,93,59,21,89,53,22,93,55,24,97,66,24,101,56,19,83,39,13,56,18,6,30,4,2,8,0,0,0,
-0,0,0,4,2,8,9,3,15,6,2,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,2,2,3,13,14,6,26,26,8,34,34,9,39,38,12,43,43,27,46,53,30,47,55,17,47,48,12,50,50,14,50,50,13,47,47,9,34,34,4,16,16,2,8,8,
-1,4,4,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,3,0,69,16,27,161,41,86,211,59,102,
-223,66,77,224,66,66,223,66,76,217,63,87,192,55,92,163,48,98,154,47,109,138,39,99,84,21,62,25,7,22,3,7,5,0,14,12,18,20,30,38,23,41,34,17,33,10,8,17,
-5,8,21,12,12,32,18,18,40,18,21,38,17,21,33,18,20,29,19,20,23,19,24,22,20,31,29,25,38,40,30,41,45,31,42,45,28,37,41,25,31,33,26,30,26,30,33,25,
-34,37,29,34,37,34,34,38,38,36,40,41,37,40,39,40,42,39,43,44,38,43,45,36,41,44,32,38,43,29,35,42,30,30,40,30,25,38,31,19,37,33,18,36,33,20,38,34,
-24,39,34,27,40,35,28,40,34,24,38,33,19,36,32,17,36,32,13,33,31,9,32,30,8,31,27,7,28,23,6,24,19,5,21,17,4,19,15,4,18,14,4,16,13,5,17,14,
-5,20,17,5,20,19,4,17,18,4,16,18,4,17,18,3,14,16,2,9,9,2,8,8,2,7,7,2,7,6,2,6,5,2,3,3,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,2,1,3,3,1,5,5,2,8,7,2,13,10,3,16,11,4,18,16,6,25,17,6,27,20,7,31,
-20,7,31,16,6,27,12,5,23,15,6,26,20,7,35,28,11,45,43,14,62,56,18,78,71,25,100,80,29,113,78,28,113,65,25,101,50,21,85,38,17,73,38,17,72,60,23,95,
-85,31,122,97,36,138,100,40,148,98,42,153,92,40,148,87,37,139,82,32,125,78,27,109,67,22,92,42,15,68,33,14,64,44,19,81,56,21,89,54,19,80,39,13,58,18,7,28,
-2,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
-1,4,4,1,5,5,0,1,1,2,7,7,5,19,19,7,30,30,9,36,36,17,41,44,40,48,62,39,49,61,19,48,50,12,49,47,13,49,49,12,45,45,9,35,35,5,21,21,
-2,9,9,1,6,6,1,4,4,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,4,2,85,20,35,174,45,91,213,60,94,222,65,72,
-224,66,66,222,66,84,209,60,93,176,51,90,148,46,96,145,43,103,121,33,87,62,15,47,15,5,18,3,9,13,8,17,22,26,23,37,44,24,46,23,13,28,6,6,18,8,9,28,
-16,16,38,20,21,40,21,23,39,18,19,33,15,12,24,15,15,21,18,27,25,23,37,36,30,41,45,34,41,46,32,36,43,25,27,35,23,24,28,29,29,28,35,38,34,36,41,39,
-33,40,42,33,39,41,36,41,41,42,44,40,43,44,38,44,45,38,42,45,37,39,44,34,36,42,32,28,39,31,21,36,31,19,37,33,23,38,34,29,40,35,35,42,36,35,41,35,
-31,40,34,27,39,34,23,37,33,18,36,32,15,34,30,13,32,28,8,27,24,6,24,21,5,23,19,5,22,19,6,23,21,7,26,25,9,28,27,11,29,28,10,29,26,7,26,23,
-6,25,22,6,23,20,4,15,14,3,12,11,2,11,9,2,10,8,1,8,5,2,8,5,2,9,6,2,9,6,2,5,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,3,1,6,
-7,2,12,16,6,26,24,9,39,25,9,39,21,8,34,12,5,23,12,5,23,15,5,27,30,12,48,61,20,84,77,26,104,82,28,112,81,29,114,78,28,113,66,25,102,64,25,101,
-69,25,104,76,27,110,85,31,121,95,36,136,101,40,147,99,42,152,95,42,152,89,38,143,80,32,126,63,23,95,44,14,64,33,12,53,33,14,63,44,18,79,54,21,90,37,14,62,
-9,3,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
-2,6,6,4,13,14,3,10,10,0,2,2,1,4,4,5,19,19,7,29,29,8,35,35,13,39,42,35,47,59,41,51,63,24,49,52,11,45,44,12,47,47,12,46,46,10,39,39,
-6,24,24,3,12,12,2,8,8,2,5,5,1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,4,10,16,3,9,35,8,12,118,28,61,185,49,96,217,62,91,223,65,68,223,66,70,
-220,66,94,206,59,103,169,49,99,141,44,92,129,38,85,97,26,68,42,10,35,8,5,14,3,11,16,16,20,29,43,26,46,43,22,43,20,12,29,10,8,26,12,13,35,19,19,43,
-22,22,41,20,22,36,17,16,30,14,8,22,12,11,20,17,27,31,26,39,42,33,42,46,35,38,44,27,27,37,23,22,30,28,29,31,34,38,35,36,41,39,34,42,42,33,40,42,
-36,41,42,41,43,41,43,45,38,43,45,37,41,45,37,40,44,37,37,43,37,33,41,35,26,38,33,21,36,32,24,38,33,33,41,36,37,42,35,38,42,35,36,41,34,30,38,33,
-24,37,32,21,37,31,18,34,29,13,29,25,7,24,21,5,23,20,6,24,22,7,26,24,9,29,28,12,31,30,15,32,31,18,32,29,20,31,28,20,30,23,14,24,18,6,17,12,
-4,14,9,3,13,8,3,11,7,2,12,8,2,11,7,2,11,7,2,10,6,2,10,6,2,9,6,2,9,6,2,7,5,1,4,2,1,3,3,1,3,3,1,4,4,1,4,4,
-1,3,3,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,4,1,7,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,3,2,6,14,5,23,19,7,30,20,7,32,24,9,38,30,11,47,26,10,42,27,10,43,43,14,61,57,19,78,62,20,84,69,25,99,77,28,113,84,31,122,84,31,123,
-83,31,120,78,29,115,74,27,110,73,27,109,80,29,116,91,33,128,100,39,143,100,41,152,97,43,155,90,39,146,71,30,119,57,21,88,45,14,64,34,12,54,30,14,59,16,12,52,
-9,8,34,2,2,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,4,4,4,13,12,5,20,19,4,14,14,3,9,9,4,16,16,6,22,23,7,29,30,7,33,34,11,38,40,27,46,54,50,54,69,33,49,57,11,44,44,12,45,45,12,45,45,
-10,39,39,7,26,25,3,14,13,2,9,9,2,7,7,1,5,5,1,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,21,5,13,28,6,16,60,13,26,146,37,87,201,55,116,221,64,92,223,65,65,222,66,74,217,64,97,
-200,58,109,165,49,100,142,46,93,133,40,83,90,25,57,28,8,27,5,6,13,6,14,18,25,23,36,44,26,47,31,18,36,13,9,27,11,10,30,16,16,39,21,22,43,22,23,39,
-19,20,33,16,12,28,15,7,24,14,14,25,17,29,34,29,40,44,35,40,45,33,32,43,25,21,35,23,22,30,31,36,35,37,44,42,34,42,43,33,40,43,35,41,42,39,42,40,
-43,44,38,42,44,36,41,44,36,39,44,37,37,43,37,32,41,35,27,38,34,25,38,33,29,39,33,35,41,33,39,42,34,39,42,35,35,41,35,31,39,35,26,38,34,21,36,32,
-20,33,26,18,32,23,17,30,23,13,28,24,9,27,25,11,30,29,14,32,31,17,32,30,20,31,28,21,31,25,22,29,23,21,28,19,18,24,13,16,22,11,9,18,11,4,13,10,
-4,14,11,4,15,12,4,16,14,4,16,15,3,14,12,3,11,9,3,11,9,3,12,10,3,12,10,3,11,9,3,11,9,2,9,8,2,9,8,2,9,8,2,10,8,2,10,8,
-2,9,7,2,7,5,1,5,3,1,5,3,1,6,3,1,6,4,1,4,2,0,1,0,8,3,12,18,6,28,19,6,29,15,5,25,13,5,21,10,4,17,6,3,11,4,1,7,
-1,1,3,0,0,1,0,0,0,0,0,1,2,1,4,6,3,11,25,9,38,37,13,56,36,13,57,40,14,61,40,15,63,45,15,66,54,20,83,61,25,101,68,29,113,76,31,120,
-81,32,122,87,32,124,84,31,122,81,30,118,74,28,111,68,25,102,76,28,112,90,35,133,102,42,151,101,44,157,82,40,148,62,34,132,55,27,109,54,20,85,45,14,63,31,10,47,
-15,9,41,7,8,35,4,5,23,1,1,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,4,3,4,14,11,5,21,18,4,18,18,4,18,18,4,19,19,5,23,23,7,27,27,7,32,31,8,37,37,28,46,54,45,52,66,31,50,57,12,44,44,11,44,44,
-11,43,43,9,36,36,7,24,24,4,14,14,2,9,9,2,7,7,2,8,8,1,5,5,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,5,15,36,8,21,64,14,27,151,38,92,201,55,114,217,63,82,222,65,63,219,64,72,214,63,105,197,57,118,
-165,50,104,139,44,91,133,41,82,90,25,54,32,10,26,6,8,16,11,17,24,35,25,43,45,25,46,23,14,31,13,9,29,14,14,37,19,19,43,21,22,42,21,22,37,18,17,31,
-16,9,26,17,10,26,19,20,33,21,31,39,27,36,44,34,36,45,29,25,38,24,19,34,25,28,34,28,37,38,28,40,42,30,39,42,34,40,42,39,43,41,42,43,39,41,43,35,
-39,42,34,38,42,36,36,42,36,31,40,35,26,38,34,25,38,32,29,39,33,35,40,31,38,41,30,38,41,32,37,41,36,32,40,36,25,38,34,21,36,32,21,35,29,22,33,26,
-18,30,23,16,30,26,17,32,30,16,32,31,18,32,30,20,32,28,21,31,25,21,28,21,20,27,18,17,25,17,15,23,16,11,22,15,8,19,13,6,17,15,5,18,17,5,19,18,
-6,20,20,6,21,21,6,23,22,6,23,22,6,22,19,5,21,17,6,22,17,6,23,17,6,22,16,5,19,13,4,17,12,3,13,9,2,12,8,3,12,8,3,13,8,3,11,7,
-2,10,6,2,10,6,2,9,6,2,10,6,2,10,6,2,9,6,2,6,4,1,2,1,1,1,2,2,1,5,6,2,11,8,3,13,10,4,17,13,5,22,15,6,25,18,6,28,
-18,6,28,14,5,22,10,3,17,7,3,12,3,1,5,0,0,0,1,1,2,7,3,12,16,6,25,25,8,38,31,11,49,38,13,59,38,15,62,39,17,70,37,19,78,56,23,96,
-77,29,115,90,34,129,88,34,129,86,33,125,76,29,114,57,24,97,53,23,92,64,26,105,89,33,129,100,39,143,92,40,146,83,40,147,70,38,142,58,32,128,56,26,106,54,19,81,
-45,15,63,27,11,47,11,8,36,7,7,32,4,4,18,1,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,2,8,7,4,16,14,5,20,19,4,22,21,4,19,20,5,22,22,6,28,28,7,32,32,7,36,35,20,43,48,43,52,65,38,51,61,16,47,46,
-12,47,44,10,42,42,9,33,33,7,26,26,4,16,17,2,9,9,2,7,7,2,7,7,2,7,7,2,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,3,1,1,25,5,16,33,7,17,74,17,35,160,41,98,202,56,116,214,62,77,219,64,63,218,64,77,211,62,104,196,58,128,174,54,119,
-147,47,94,130,39,81,80,22,51,24,7,22,7,10,18,24,21,37,47,29,54,44,24,48,18,12,28,11,9,30,16,16,41,21,22,45,22,23,42,20,21,35,18,15,31,16,8,26,
-19,13,30,21,26,37,23,33,42,27,33,44,28,26,43,26,20,37,24,23,34,26,33,37,27,38,40,23,36,40,25,35,38,34,38,37,41,42,38,42,43,36,39,41,33,36,39,30,
-34,40,31,31,40,33,26,38,33,25,37,31,29,37,28,36,40,28,38,40,28,37,40,29,35,40,31,30,39,34,25,38,34,22,36,31,22,34,27,25,34,26,26,34,27,22,32,27,
-16,30,28,17,30,28,19,32,28,22,31,26,22,30,23,19,27,21,16,25,19,12,22,16,9,20,16,6,18,16,5,18,17,5,19,18,5,21,20,6,22,21,6,24,23,7,25,22,
-7,26,21,7,26,21,7,25,20,7,26,20,6,25,19,6,24,18,6,24,18,6,24,19,6,23,18,6,22,17,4,19,15,4,15,10,3,14,9,3,14,9,3,12,8,2,7,5,
-1,3,1,1,2,1,1,1,1,1,2,1,1,2,1,1,2,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,3,1,5,
-6,2,10,9,3,14,13,5,22,18,6,27,19,6,29,14,5,23,8,3,15,4,1,7,0,0,1,0,0,0,3,1,6,11,4,17,24,8,36,34,12,52,36,14,58,38,15,62,
-53,20,81,71,25,100,83,30,116,90,34,127,84,32,124,66,28,110,57,25,100,60,24,100,81,28,114,92,31,123,96,34,130,106,38,141,110,41,150,90,40,148,68,36,135,53,27,111,
-51,20,86,51,16,72,31,10,44,9,5,22,4,5,23,7,7,31,3,3,15,0,0,1,0,0,0,0,0,0,4,1,3,17,4,13,20,4,15,1,0,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,4,3,5,18,14,6,26,21,5,21,20,4,21,21,6,27,27,7,31,31,8,32,32,6,35,34,16,41,43,41,50,63,45,54,66,
-19,50,50,12,48,45,11,43,42,10,35,35,6,27,27,5,17,17,3,9,10,2,7,7,2,7,7,2,5,5,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,0,0,26,6,15,42,9,23,73,17,32,157,40,93,203,55,108,214,62,77,218,64,68,217,65,87,213,63,114,200,59,135,177,57,125,151,48,93,
-122,35,73,75,20,51,19,7,21,7,12,20,31,24,41,55,30,58,41,22,46,17,10,30,12,11,32,22,19,45,22,23,45,22,23,39,20,19,34,18,13,32,17,10,30,28,19,37,
-28,29,42,25,34,43,28,31,44,26,22,40,24,19,35,24,29,35,26,37,38,24,37,41,23,35,39,27,35,36,34,37,32,39,40,33,39,41,33,37,40,31,34,38,28,31,37,27,
-28,37,29,28,38,31,30,38,28,35,37,21,36,37,18,37,39,23,37,40,30,32,40,32,28,38,31,25,36,29,25,35,27,26,34,26,24,33,26,22,33,28,20,32,28,20,30,28,
-21,30,25,21,29,23,19,29,21,16,26,19,11,22,16,7,19,15,5,16,15,4,16,16,4,20,19,5,22,21,6,23,22,6,24,20,5,23,19,6,23,18,7,24,19,7,24,18,
-6,24,19,6,24,19,6,24,19,6,23,19,6,23,19,6,23,19,6,22,19,6,23,19,6,23,18,6,22,18,6,21,16,6,20,15,5,19,13,4,18,12,4,16,12,3,14,9,
-3,11,7,3,11,8,3,11,7,3,10,8,3,10,7,3,10,7,2,9,6,2,7,5,2,6,4,2,5,3,2,4,3,2,4,3,1,3,2,1,3,1,1,3,1,0,2,0,
-0,0,0,0,0,0,0,0,0,1,1,3,3,1,7,7,3,13,12,5,20,15,5,24,18,6,27,12,5,21,8,3,13,1,1,4,0,0,0,15,5,24,38,12,54,45,16,67,
-41,16,67,39,15,65,47,18,73,62,23,91,79,28,112,86,32,122,87,33,125,85,33,125,79,32,119,78,31,114,85,30,115,97,33,126,109,37,137,116,40,146,108,40,148,83,35,134,
-59,28,113,47,22,94,25,12,55,3,2,11,0,0,0,3,3,16,6,6,26,2,2,5,0,0,0,0,0,0,2,1,1,24,6,19,51,11,39,34,8,25,7,1,4,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,7,4,5,19,14,5,24,19,6,24,22,7,26,26,8,32,33,8,33,33,8,32,32,7,34,33,11,40,41,35,49,59,
-36,52,61,19,52,49,13,50,46,11,44,43,9,35,36,8,27,28,5,20,20,3,12,12,2,5,5,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,1,1,26,6,17,64,14,39,104,25,55,171,45,110,201,55,107,212,60,71,216,64,69,215,66,95,212,64,122,202,62,137,185,59,132,157,50,102,124,36,77,
-84,22,60,33,11,32,15,16,27,39,28,48,54,31,57,36,19,42,13,9,28,17,11,34,41,23,56,39,28,55,23,22,38,19,17,33,17,12,32,22,12,33,39,22,43,51,30,54,
-41,31,51,27,26,42,25,19,37,24,23,34,25,32,36,23,34,38,21,33,39,24,33,38,31,35,35,37,39,32,37,39,31,36,39,30,34,38,28,31,37,26,27,35,26,27,36,28,
-31,38,27,36,39,22,38,39,18,37,38,20,36,39,26,34,39,31,32,39,31,31,38,29,31,37,28,32,37,29,29,35,27,22,31,25,19,30,26,20,30,26,20,28,22,19,25,19,
-15,21,16,12,20,14,8,19,16,5,17,15,4,16,16,4,18,17,5,19,17,6,21,19,6,23,19,6,22,18,5,20,16,5,20,15,5,20,16,5,22,17,6,23,19,6,23,20,
-6,23,20,6,22,18,6,22,18,6,22,17,6,22,17,6,22,18,7,23,18,6,24,18,6,25,19,7,24,19,6,24,19,6,23,18,6,22,17,5,21,17,5,21,17,5,21,17,
-5,21,16,6,21,17,6,21,17,5,19,16,4,16,13,3,14,9,3,11,7,2,6,4,1,4,2,1,4,3,2,5,3,2,6,4,2,6,4,2,6,4,2,7,5,2,7,4,
-1,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,4,2,8,11,4,18,15,5,24,17,6,27,13,5,22,20,6,30,38,12,51,48,15,64,
-47,15,65,43,15,63,43,15,66,42,16,68,49,21,84,61,26,101,76,30,114,90,34,125,94,36,130,89,36,128,81,33,120,78,32,115,87,33,119,97,35,127,110,39,141,116,40,147,
-104,39,143,76,32,126,48,24,99,27,14,61,3,4,18,0,0,0,0,0,0,1,1,2,0,0,0,0,0,0,0,0,0,5,2,7,26,7,28,52,13,43,48,11,36,17,4,13,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,7,4,3,14,8,4,17,12,5,24,18,6,26,23,7,29,28,8,33,33,9,34,34,8,32,32,8,35,35,12,41,43,
-26,46,52,41,52,63,23,52,51,12,49,44,11,42,41,9,36,36,8,29,30,5,17,17,2,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,32,8,21,66,15,38,112,27,62,178,47,114,200,55,114,209,59,74,215,64,72,214,66,97,209,64,125,199,62,141,181,59,129,151,48,95,123,35,78,77,20,54,
-49,16,45,50,24,52,53,32,58,51,29,54,27,16,37,11,9,28,24,14,40,48,24,58,48,31,59,28,24,43,21,17,36,18,11,33,24,15,36,50,26,52,51,29,53,37,25,46,
-26,17,38,24,18,34,24,27,35,24,34,37,21,31,37,19,28,35,24,30,34,31,34,33,36,38,32,36,39,31,34,38,30,31,36,26,27,32,23,25,31,24,29,35,25,33,37,22,
-35,37,18,37,39,18,38,39,25,37,40,31,33,40,33,32,38,29,32,37,27,32,36,27,30,34,27,27,33,27,23,30,24,20,28,22,19,26,19,17,23,15,16,21,13,12,18,13,
-5,13,12,4,14,14,3,17,17,5,19,18,6,22,19,5,21,17,6,21,16,5,20,15,5,20,15,5,21,17,5,22,19,6,23,19,6,23,20,6,23,21,7,24,21,7,25,22,
-7,24,20,7,24,19,7,24,20,7,25,21,7,26,21,7,25,21,7,25,20,6,24,19,6,23,18,5,20,16,4,19,15,4,18,14,4,17,14,4,17,13,4,16,12,4,16,12,
-4,16,12,4,16,13,3,16,12,3,13,11,2,10,8,2,8,6,2,7,4,1,4,3,1,3,2,1,2,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,2,1,
-1,2,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,2,0,3,1,1,4,0,1,3,2,1,5,9,4,16,17,6,27,27,10,43,40,13,57,
-43,14,59,48,15,66,48,16,70,47,17,71,48,18,77,47,21,86,49,24,94,55,25,101,73,29,112,88,33,125,93,35,131,88,36,129,80,33,120,68,29,105,82,29,104,107,34,125,
-116,40,144,114,41,148,107,39,143,93,33,129,53,22,90,16,9,41,0,2,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,8,15,6,21,42,11,38,48,11,38,
-28,6,21,3,1,2,0,0,0,0,0,0,0,0,0,1,1,1,1,8,5,4,18,11,4,20,13,4,22,16,5,26,22,7,29,28,8,31,31,8,33,33,8,33,34,8,36,36,
-10,41,40,35,47,58,50,52,68,27,51,51,12,46,40,10,41,39,9,36,36,7,27,27,3,11,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,0,27,6,16,63,14,40,101,24,56,186,49,125,204,56,122,209,60,83,212,62,69,213,65,99,210,65,127,202,63,143,180,59,127,140,45,87,115,33,73,72,19,52,45,16,39,
-68,30,63,73,37,72,56,29,59,25,15,36,12,10,31,31,17,46,56,29,65,45,30,57,26,22,41,23,16,38,21,12,37,31,20,42,52,28,55,45,28,51,29,21,41,23,14,35,
-24,20,33,25,32,36,23,35,38,19,29,36,21,27,34,25,28,32,31,33,30,35,37,31,35,38,31,32,36,26,26,31,22,24,29,22,35,40,24,50,53,23,40,41,17,35,37,17,
-37,39,24,37,40,30,35,40,31,35,38,28,34,37,26,32,35,25,28,32,24,24,28,22,22,27,21,20,26,20,18,25,18,16,22,15,16,21,14,17,22,16,15,22,18,10,19,19,
-5,17,17,4,18,16,5,20,16,6,21,16,5,19,14,4,17,14,5,18,16,6,22,18,6,23,20,6,23,20,6,24,21,6,23,20,6,23,20,7,24,21,7,25,22,7,27,23,
-7,27,23,7,25,21,6,24,20,6,22,18,6,20,16,5,19,14,4,17,13,4,16,11,4,15,11,4,15,10,4,15,10,4,16,11,4,16,11,4,15,11,4,15,10,4,15,10,
-4,15,10,4,15,10,3,14,9,3,13,8,3,13,8,3,13,9,3,13,9,3,12,8,2,7,5,1,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,1,4,10,4,16,11,4,19,9,3,14,19,5,20,30,7,30,33,9,38,25,8,34,12,4,19,3,2,7,0,0,1,3,1,6,15,6,24,
-18,7,30,21,10,41,36,16,68,48,21,85,51,20,85,50,19,79,49,19,79,45,21,84,45,23,90,54,25,99,72,29,112,93,34,126,97,36,132,82,33,123,71,28,102,81,26,93,
-96,29,104,110,35,126,120,41,147,124,43,152,111,39,143,72,27,108,27,13,59,5,5,23,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,6,3,13,28,9,30,
-49,12,42,38,9,28,9,2,7,0,0,0,0,0,0,0,0,0,2,4,5,3,15,11,8,24,16,17,25,18,10,22,17,5,25,20,7,28,26,8,30,31,9,33,34,9,34,34,
-8,35,35,10,40,39,29,46,54,44,51,64,24,50,49,12,46,39,10,42,39,9,36,36,8,27,28,3,10,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-22,5,14,58,13,34,110,26,61,189,50,135,209,58,140,203,56,77,208,60,67,213,66,103,210,65,132,206,65,143,188,62,126,140,44,82,98,28,60,69,19,54,53,18,49,77,33,72,
-96,42,87,53,28,55,19,13,33,13,11,33,36,20,51,56,31,67,41,29,54,25,21,40,22,15,37,23,12,37,43,23,50,49,28,52,40,27,48,25,18,38,23,14,34,24,25,34,
-25,35,37,21,33,38,19,28,35,21,27,34,26,27,30,30,30,25,32,33,26,31,35,27,27,29,18,22,24,13,31,34,19,49,51,24,58,58,21,50,51,17,40,42,20,37,40,27,
-37,40,31,35,38,28,33,36,22,31,33,17,27,29,16,22,25,18,20,24,19,19,24,17,16,22,16,15,19,12,14,17,9,16,19,11,20,24,19,17,23,21,8,18,18,4,13,13,
-3,10,9,3,13,9,4,14,10,4,16,13,4,16,15,4,17,15,5,19,17,6,22,19,6,23,20,6,23,20,6,23,19,6,23,20,7,24,21,6,23,20,5,20,16,4,17,13,
-4,14,10,4,13,10,4,15,10,3,16,11,4,16,11,4,17,12,5,19,13,5,19,14,5,20,15,5,21,15,5,21,15,5,21,16,5,21,15,5,19,14,4,18,13,5,18,13,
-4,18,13,4,17,12,4,14,9,3,12,9,3,12,8,3,12,8,3,12,8,3,10,7,1,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,1,4,12,4,20,24,8,37,30,10,44,46,14,56,58,16,63,62,16,66,57,14,61,48,12,53,40,11,47,34,9,38,32,7,32,32,7,29,
-17,4,14,6,3,15,10,10,42,25,17,70,40,23,91,61,26,101,72,24,97,63,20,84,51,19,79,41,19,79,35,19,79,67,27,102,96,33,123,103,36,132,95,35,131,85,33,120,
-76,27,96,87,26,86,111,32,112,126,41,141,121,43,149,106,38,139,78,28,114,44,18,78,15,9,39,5,2,12,21,5,18,16,3,12,1,0,0,2,1,1,14,3,11,17,5,18,
-27,8,29,49,13,44,49,12,38,17,4,11,0,0,0,0,0,0,13,4,10,17,15,21,24,21,24,49,31,25,54,33,27,23,28,22,5,29,22,6,29,26,9,33,33,8,35,35,
-11,35,36,10,35,36,9,39,38,24,44,51,39,50,61,26,51,51,11,47,40,10,42,39,9,37,37,8,28,28,3,11,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,5,13,
-59,14,41,106,26,62,183,49,129,206,57,141,202,56,90,201,57,65,207,62,99,212,67,142,208,66,153,189,62,123,147,48,81,102,30,64,68,19,57,55,19,53,87,36,80,92,41,81,
-54,28,55,19,13,34,15,11,35,37,21,52,50,31,63,29,27,46,20,19,38,21,14,37,25,12,38,50,21,52,50,27,53,34,24,43,23,16,36,23,16,34,25,28,35,23,34,36,
-17,30,35,15,24,32,19,23,32,25,24,27,27,25,22,27,27,20,28,30,19,30,30,12,24,23,6,39,39,10,61,62,20,56,57,18,41,42,18,36,38,22,35,39,25,34,38,25,
-34,36,22,32,34,18,30,30,14,23,25,9,16,20,10,11,18,14,14,20,16,15,19,12,15,16,7,15,16,6,17,18,10,16,19,14,15,20,15,17,23,14,21,25,9,9,10,3,
-1,2,1,2,7,4,3,11,9,4,15,14,4,16,15,5,19,17,6,21,18,6,22,18,6,22,18,5,20,17,4,17,15,4,15,13,4,13,11,3,10,8,2,8,5,2,9,6,
-4,14,9,5,18,14,6,21,16,6,21,15,5,21,15,5,21,15,5,20,14,5,19,14,4,18,13,4,17,12,4,16,12,4,16,11,4,16,11,4,15,9,3,14,10,3,14,9,
-3,14,9,3,14,10,3,13,9,3,10,6,2,7,5,2,7,4,2,7,4,1,5,3,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,2,1,4,9,2,13,18,5,25,28,9,37,44,15,54,57,19,68,65,20,74,65,19,73,66,19,73,72,19,77,79,20,79,78,20,76,
-65,16,64,45,11,47,31,11,47,31,14,61,32,17,71,37,21,82,60,25,100,76,27,106,76,25,99,65,21,86,56,20,85,49,21,85,59,24,93,81,29,111,100,34,127,104,37,133,
-92,35,128,80,29,107,96,29,97,118,35,110,124,38,129,119,40,142,113,39,142,92,33,127,60,24,96,32,14,60,38,11,49,47,11,44,27,5,21,14,3,10,42,9,32,60,14,46,
-46,11,37,28,8,29,42,11,40,50,12,41,22,5,17,1,0,0,15,6,13,47,22,40,53,24,46,61,29,36,80,38,37,65,39,34,26,32,25,6,30,22,7,33,31,7,36,35,
-28,40,49,38,39,53,16,35,37,7,38,36,28,44,53,47,51,65,28,51,53,11,47,39,10,42,39,9,37,36,8,28,29,3,11,11,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,4,11,56,13,36,
-101,24,59,175,47,121,208,58,151,199,55,99,192,54,59,202,60,95,210,65,141,212,68,161,193,64,130,149,48,84,103,30,67,64,18,54,58,20,57,80,35,74,106,45,86,80,33,60,
-28,13,33,17,11,36,46,23,59,48,30,61,24,25,43,18,18,35,19,12,36,30,13,41,50,16,49,47,18,47,27,16,38,24,14,36,23,18,32,24,31,34,21,31,34,12,24,28,
-7,19,26,9,14,23,16,14,21,19,17,20,20,21,18,32,32,14,52,52,13,59,58,13,58,58,14,57,56,14,46,46,16,36,39,21,34,38,24,33,38,23,33,36,19,33,33,16,
-30,31,14,26,28,12,22,25,10,16,21,11,11,18,15,8,14,10,14,17,9,20,19,8,19,20,10,15,17,9,14,16,7,20,21,7,31,32,8,34,34,8,26,25,6,5,7,3,
-1,5,5,3,10,9,4,14,13,4,17,15,5,19,17,6,22,18,5,20,16,4,16,13,3,11,10,2,8,7,2,7,5,2,9,6,3,11,8,3,14,10,4,17,12,5,19,14,
-6,21,16,6,21,16,5,20,15,4,17,12,4,15,10,4,15,10,4,14,10,4,14,10,4,15,11,4,15,12,4,16,12,4,17,12,4,17,13,4,18,13,5,18,13,5,18,14,
-5,18,14,5,19,14,5,19,14,5,18,13,4,15,11,3,14,10,3,13,10,3,11,8,2,8,6,1,6,4,1,5,3,1,4,3,1,4,3,0,2,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,6,1,5,26,6,23,36,8,33,33,8,31,27,9,31,26,11,37,33,14,45,45,18,57,58,20,70,70,23,83,76,25,89,83,26,91,
-90,27,96,87,25,93,75,21,82,64,18,75,55,18,74,46,18,74,39,21,81,44,25,94,68,28,107,87,30,113,89,28,109,82,26,102,68,25,95,53,24,87,63,25,94,98,33,120,
-113,36,131,97,34,125,83,31,115,94,32,107,112,34,105,129,39,123,135,42,140,126,41,143,100,35,131,72,27,106,47,17,67,44,12,46,51,13,49,41,10,36,51,12,43,77,20,65,
-84,21,70,58,14,47,29,7,26,34,10,35,56,14,45,40,9,27,1,1,3,20,11,24,52,25,49,62,28,54,73,32,49,85,40,45,70,40,36,31,33,26,7,31,22,7,34,29,
-18,38,41,47,44,61,49,41,59,18,36,40,8,35,34,29,40,49,48,50,66,24,50,50,10,45,36,9,39,35,9,36,37,8,29,29,3,11,11,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,3,8,51,12,31,93,22,53,
-158,41,104,204,57,151,196,54,103,190,53,63,200,59,97,208,64,134,212,68,162,193,64,132,151,48,85,125,36,84,84,23,68,60,21,57,84,35,77,106,44,85,92,36,60,53,18,40,
-27,12,38,44,22,57,46,30,60,23,24,43,17,17,35,22,13,36,34,13,43,49,15,48,38,12,38,23,10,34,22,10,34,17,16,32,15,27,31,13,27,28,10,19,23,5,13,18,
-4,8,16,8,6,14,10,10,17,17,18,16,39,39,14,67,66,16,89,89,22,84,84,21,57,57,17,39,39,18,34,37,23,33,38,24,33,37,20,33,34,17,32,32,15,30,30,13,
-24,26,10,17,22,10,15,19,10,24,27,10,36,39,13,27,27,9,22,22,11,20,21,11,19,20,9,26,27,7,33,32,7,32,32,7,21,21,6,10,12,6,3,8,7,2,9,9,
-3,12,11,4,16,15,5,19,17,5,18,16,4,16,14,3,11,10,2,7,6,1,6,4,2,7,4,2,10,6,3,14,10,5,18,13,5,19,13,4,17,12,5,16,11,3,15,11,
-4,15,11,4,15,11,3,15,11,3,15,11,4,16,12,4,17,14,5,19,15,6,20,17,6,21,18,6,21,18,6,21,18,6,21,17,6,20,16,6,20,16,6,20,16,6,20,16,
-6,20,16,6,20,16,6,20,16,5,20,15,5,19,14,5,18,13,4,17,12,4,17,12,4,15,10,3,13,9,3,12,8,2,12,7,2,11,7,2,9,6,1,4,3,0,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,3,1,3,24,6,23,42,11,43,49,13,49,49,12,50,44,13,51,36,12,49,27,10,39,25,10,37,34,14,46,50,19,63,67,24,80,
-88,31,99,94,32,105,92,30,102,90,28,99,87,26,96,85,25,94,73,24,93,56,24,94,49,26,99,66,29,107,93,33,117,107,34,121,103,32,117,84,26,102,60,23,86,69,24,91,
-97,31,110,115,35,123,102,33,123,87,32,120,84,30,109,110,34,106,135,42,120,141,45,133,125,38,134,103,34,128,80,27,104,52,17,61,41,13,42,48,13,48,59,15,55,80,22,73,
-104,28,90,108,29,87,82,20,61,33,9,29,42,11,37,77,20,55,44,10,31,1,2,7,16,11,24,52,24,51,64,32,58,72,38,51,85,40,45,73,40,39,32,33,27,6,31,22,
-6,34,29,22,39,47,60,47,72,52,44,62,19,37,37,8,34,32,25,40,47,45,48,64,24,47,47,9,42,32,9,38,33,9,36,37,7,27,27,2,10,10,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,2,5,48,10,30,86,20,49,155,40,102,
-202,56,154,193,53,109,184,51,63,196,57,90,210,64,139,212,67,160,195,65,133,151,50,86,129,38,82,116,32,79,79,25,60,83,35,76,100,42,79,91,36,59,60,19,40,31,12,39,
-46,20,56,47,26,59,20,22,40,18,16,34,22,12,36,36,14,43,50,15,48,33,10,36,22,9,33,21,9,34,15,18,31,9,24,28,5,20,22,4,15,17,3,11,16,4,6,13,
-18,16,16,21,21,19,28,29,17,52,51,14,79,79,19,92,92,24,85,85,22,61,62,19,44,52,23,38,46,26,33,37,23,32,35,18,33,33,17,31,31,14,28,29,10,24,26,11,
-18,21,11,23,25,9,40,40,11,56,56,16,53,53,17,29,30,13,19,20,9,27,28,7,34,34,8,29,29,6,16,17,5,6,9,5,2,7,7,1,8,10,3,12,11,4,14,13,
-4,14,13,4,15,13,3,12,11,2,7,6,0,3,2,0,3,2,2,8,5,3,13,8,3,13,9,3,13,9,3,11,8,3,11,7,3,11,7,2,11,7,2,11,9,3,12,9,
-3,15,12,5,17,14,7,20,16,9,23,17,8,21,16,5,18,15,5,19,16,5,19,15,5,19,15,5,19,15,5,19,14,5,18,14,4,17,12,4,17,12,5,17,13,4,16,12,
-4,17,12,5,18,13,5,18,13,4,17,12,4,16,11,4,16,11,4,16,11,4,16,11,4,16,11,5,16,11,8,17,19,8,17,18,6,14,14,4,13,11,3,10,7,1,5,2,
-0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,4,2,6,14,7,18,23,10,28,35,12,40,46,16,58,55,19,72,56,19,74,49,16,65,35,12,47,25,9,35,31,11,42,
-54,20,64,76,27,86,88,31,99,93,33,104,98,34,107,104,34,110,102,33,110,92,29,105,76,28,104,60,28,103,59,29,105,81,33,113,102,36,121,112,36,123,104,32,117,81,27,102,
-71,25,92,89,29,101,110,34,118,113,34,124,94,31,115,81,27,100,107,33,107,137,44,120,141,46,124,131,40,129,123,37,132,103,31,118,66,19,77,42,14,45,51,15,51,76,21,74,
-101,28,92,125,36,99,133,37,98,104,26,76,70,17,58,54,15,45,82,21,58,57,14,40,14,4,15,25,10,28,47,24,48,65,35,61,74,40,55,83,40,45,74,39,38,40,37,31,
-10,34,25,5,34,30,25,40,49,58,48,70,50,48,59,20,41,37,9,36,32,28,39,48,42,47,61,22,46,44,9,42,31,9,38,33,9,32,32,6,21,22,2,7,7,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,2,43,9,28,75,17,41,138,35,84,195,53,147,
-199,56,132,177,48,73,186,53,83,204,62,131,213,68,163,196,65,139,152,49,88,133,39,82,129,35,82,105,32,66,88,37,73,90,41,74,91,36,60,56,18,40,27,11,36,46,20,56,
-43,19,55,15,11,32,17,13,32,24,12,38,39,14,44,42,12,40,29,9,33,23,8,34,21,10,34,14,19,30,8,25,28,5,19,20,4,14,16,2,10,16,3,5,8,24,24,12,
-56,57,25,67,67,24,69,68,17,91,91,22,91,91,23,69,68,18,46,50,13,49,64,24,51,70,30,39,49,23,29,30,15,30,31,15,30,30,12,27,30,8,28,36,9,31,37,12,
-41,42,12,56,56,15,55,55,18,40,40,17,29,30,12,34,35,9,43,44,10,30,30,7,14,14,3,7,8,3,2,8,8,1,9,10,2,11,11,3,12,11,4,13,12,3,12,11,
-2,7,7,1,4,3,0,2,2,0,3,2,1,5,3,1,8,5,2,10,7,3,11,7,5,11,5,4,7,3,1,3,2,1,4,3,3,8,6,7,14,10,11,20,13,15,24,15,
-19,26,15,21,28,16,22,29,15,23,28,15,15,21,11,5,14,9,3,13,10,3,13,9,4,14,11,4,16,11,4,16,12,4,15,11,4,15,11,4,14,11,3,14,11,3,13,9,
-3,12,9,3,13,10,3,13,10,3,13,10,3,13,9,3,13,10,3,13,10,4,13,10,4,13,9,4,13,9,8,15,18,12,17,25,12,17,26,13,17,25,12,16,23,9,12,17,
-5,9,12,3,8,7,1,6,4,1,5,2,1,3,2,8,4,9,15,6,16,8,5,12,6,5,12,12,7,19,30,14,44,50,21,71,62,25,84,63,24,84,55,20,74,42,15,57,
-30,11,43,30,12,42,48,18,58,70,26,82,87,32,97,97,36,106,104,38,111,106,36,112,103,34,111,93,32,108,76,29,105,59,30,104,61,32,106,92,36,117,117,40,128,118,38,130,
-99,33,117,78,27,100,78,28,96,100,32,109,114,34,116,101,29,106,88,26,99,109,32,112,136,43,124,143,46,124,142,45,130,136,42,139,118,34,129,87,25,97,64,18,65,66,20,66,
-85,25,85,114,33,98,136,40,106,142,40,108,130,35,101,83,21,69,57,15,48,75,20,56,72,18,56,55,13,44,35,11,34,48,22,49,62,34,60,71,38,53,93,41,52,101,46,49,
-62,43,40,10,35,26,4,34,29,25,39,48,66,52,75,54,50,61,22,41,38,10,36,32,30,39,50,46,46,63,19,46,42,10,41,32,9,35,31,7,25,25,3,13,13,0,2,2,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,7,18,69,15,36,130,32,78,187,51,135,194,53,133,
-175,47,94,179,50,99,193,57,124,208,66,162,202,67,152,158,52,97,132,40,85,142,39,90,127,36,81,106,39,82,82,38,66,77,33,50,58,19,42,34,13,41,39,18,53,34,17,49,
-14,7,30,16,9,30,25,13,38,44,15,48,43,12,38,21,7,25,17,7,30,18,9,31,12,17,28,23,39,28,25,38,23,6,14,16,2,8,15,7,8,7,30,30,7,59,62,19,
-80,84,24,85,86,21,97,97,25,85,84,22,54,55,14,45,54,14,50,68,19,47,64,20,41,48,18,31,31,15,28,28,13,28,28,10,28,35,8,35,46,11,47,56,13,58,60,16,
-58,58,18,45,45,18,30,30,12,33,33,10,49,49,12,59,59,14,47,47,12,19,19,4,18,18,4,26,28,10,9,17,12,2,11,11,2,10,10,2,8,9,0,4,5,0,2,2,
-0,1,1,0,3,3,1,6,4,1,8,6,4,10,5,9,12,5,16,17,5,23,23,7,30,28,10,23,24,10,14,17,10,17,20,11,20,23,12,21,25,13,21,26,12,19,24,11,
-16,21,10,12,17,8,9,15,8,7,14,9,4,11,8,2,9,8,2,8,7,1,7,6,2,7,6,2,8,6,2,8,6,2,6,4,1,5,4,1,5,4,1,5,3,1,5,3,
-1,4,3,1,4,3,1,4,3,1,4,3,1,4,3,1,4,3,2,5,4,1,4,3,1,4,3,1,5,3,2,6,5,3,10,8,5,13,12,6,14,15,8,15,18,12,14,23,
-20,15,30,22,14,31,16,14,26,10,11,18,9,11,15,21,12,22,33,13,32,32,9,29,25,6,22,16,4,15,11,6,17,21,15,38,40,23,60,50,25,71,59,27,81,63,26,86,
-61,23,82,48,18,66,34,13,49,31,15,53,46,20,69,70,27,84,92,34,100,103,38,109,106,38,111,107,37,113,108,36,115,97,32,112,72,29,106,59,30,105,74,34,112,104,39,123,
-122,41,132,117,39,129,95,31,112,76,26,96,86,29,99,110,33,110,112,33,111,103,30,105,106,31,108,129,40,121,142,47,125,144,48,130,141,45,139,133,40,140,117,33,120,98,28,92,
-78,24,76,82,25,83,113,33,100,136,40,107,145,43,113,137,39,110,94,24,78,60,15,51,84,22,66,110,29,88,79,19,65,35,10,34,46,20,45,76,37,64,89,45,62,113,49,60,
-115,50,55,60,46,43,16,39,34,18,36,38,29,40,51,64,51,74,55,51,62,18,41,36,10,35,33,32,40,50,43,46,62,16,44,39,8,41,31,7,31,27,4,16,16,1,4,4,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,6,14,64,15,40,99,23,56,176,47,126,193,53,139,173,46,101,
-169,47,106,191,56,136,206,64,161,201,65,155,167,55,106,139,42,87,144,40,94,147,41,98,126,38,93,96,36,70,80,32,52,69,23,46,57,18,54,54,21,59,35,17,49,12,6,29,
-23,23,30,39,40,41,51,30,50,38,11,33,17,5,22,14,6,25,12,7,23,10,14,21,26,36,22,37,45,20,16,20,13,1,2,10,10,11,6,39,38,8,66,67,16,88,96,24,
-101,113,29,100,105,27,73,73,18,43,46,11,45,58,16,49,70,18,43,55,14,42,44,13,52,51,18,42,42,15,29,33,9,32,41,10,42,52,12,55,59,14,63,62,18,52,52,18,
-35,35,15,33,34,11,50,50,12,65,66,17,63,66,17,50,51,13,39,39,10,40,40,10,45,47,14,28,33,14,6,13,10,1,7,8,0,3,4,1,3,2,7,9,3,12,15,6,
-9,15,7,7,13,7,9,14,5,18,19,6,27,26,8,36,33,11,42,40,15,42,42,16,40,38,16,30,30,13,19,20,9,14,15,6,10,13,6,6,12,7,4,10,5,2,7,5,
-1,5,3,0,3,2,0,3,2,0,2,3,0,2,2,0,1,1,0,1,1,0,1,1,1,2,2,1,4,2,2,5,3,2,6,4,2,7,4,3,9,6,3,11,7,3,11,8,
-3,12,8,3,12,8,3,12,9,3,12,8,3,12,8,3,12,8,3,12,8,3,9,6,2,8,5,2,7,5,2,7,4,2,7,4,2,7,4,1,8,4,3,8,8,11,10,17,
-26,14,33,36,16,40,36,16,40,32,16,38,27,16,35,25,16,35,26,15,35,28,12,34,31,9,33,33,8,32,31,8,28,28,12,29,35,18,41,39,22,50,39,23,57,49,26,71,
-62,30,85,69,30,92,67,26,88,54,21,77,40,17,67,34,17,62,52,21,72,81,31,92,99,36,105,105,39,111,108,41,116,113,41,120,111,38,118,93,33,113,67,31,108,59,31,106,
-88,37,117,120,43,130,127,42,135,110,36,124,77,26,96,72,25,88,98,31,105,108,33,107,100,29,97,97,28,98,118,36,116,140,45,126,145,49,129,144,47,137,143,45,141,134,40,126,
-113,32,101,83,25,78,78,24,79,107,32,97,131,39,105,145,44,115,141,41,115,120,32,101,93,24,78,110,31,92,121,34,102,75,19,65,41,11,34,78,29,56,108,49,76,108,53,72,
-117,51,62,114,51,58,72,50,57,53,46,60,27,39,44,22,39,46,73,54,77,67,53,64,19,41,36,12,35,32,29,35,45,30,39,49,19,45,40,12,40,31,5,26,22,2,10,10,
-0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,5,12,65,15,43,76,17,46,146,38,108,191,52,140,168,45,105,161,44,107,
-183,53,130,203,62,156,204,67,161,170,57,111,136,41,85,141,40,90,147,41,95,136,37,100,100,28,69,78,26,48,64,20,44,65,20,59,70,25,70,39,18,50,13,6,28,20,21,26,
-46,58,42,68,62,54,44,21,33,12,4,17,13,6,25,10,7,20,6,14,16,29,36,16,34,36,12,10,11,9,0,0,6,19,19,6,55,60,13,79,86,20,94,105,26,110,125,33,
-104,118,32,70,74,19,42,48,11,52,71,19,55,78,20,41,49,13,45,46,16,62,62,22,62,63,19,46,53,13,40,51,12,52,58,14,62,62,17,67,66,21,64,64,23,54,54,17,
-49,50,13,62,63,16,79,83,21,77,84,22,58,65,17,49,50,13,52,52,15,56,59,20,48,51,21,25,28,13,4,7,6,2,3,2,12,14,3,27,30,9,41,45,14,46,50,15,
-40,43,13,34,33,10,36,33,9,41,36,10,42,38,11,37,36,14,28,29,12,18,19,8,9,10,4,3,5,2,0,4,2,0,3,2,0,3,3,0,3,2,0,2,2,0,0,0,
-0,0,0,1,2,1,3,4,2,4,6,3,7,10,4,10,12,5,12,14,6,14,16,7,15,19,8,16,22,11,17,23,12,17,23,12,18,24,11,13,20,11,4,14,10,4,14,11,
-4,15,11,4,15,11,4,15,10,4,15,11,4,16,12,4,16,12,4,16,12,4,16,11,4,15,11,4,15,10,4,14,9,3,13,9,3,13,9,3,12,8,8,12,16,15,13,29,
-24,15,41,31,16,44,33,15,43,36,14,44,38,15,44,37,16,42,33,16,40,30,17,39,26,15,37,25,14,35,28,13,35,32,12,35,36,13,37,40,16,41,39,18,42,42,21,51,
-53,28,71,62,33,83,67,34,89,70,32,92,67,28,90,58,23,80,46,19,71,42,21,73,61,27,88,85,33,99,100,37,106,107,41,113,114,43,120,117,42,123,108,39,121,83,33,113,
-61,30,106,70,34,110,105,42,123,128,45,135,117,38,127,79,25,95,64,21,81,86,28,98,105,33,107,102,30,99,96,28,97,117,35,116,141,45,130,145,48,128,146,49,128,147,47,134,
-142,44,132,126,37,113,98,29,90,80,24,80,103,30,96,138,41,109,149,46,116,151,45,127,137,38,119,104,28,92,111,32,95,120,34,103,84,22,72,65,17,46,103,37,68,118,53,82,
-113,55,72,117,52,63,116,52,63,88,53,72,55,48,64,20,37,39,38,41,54,94,58,86,65,53,64,14,37,31,11,27,25,40,33,48,51,46,56,34,48,42,14,39,29,5,24,20,
-2,9,9,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,2,5,48,11,30,75,17,46,133,33,97,181,49,137,173,47,114,156,42,106,169,48,122,
-196,59,147,204,66,159,178,60,122,143,44,90,141,40,91,147,41,94,138,38,97,103,29,73,75,20,45,62,17,42,63,19,56,68,23,68,36,16,48,13,7,29,20,21,27,45,58,40,
-63,59,48,42,24,30,9,2,12,9,4,20,9,6,18,6,13,14,28,36,15,37,42,12,17,26,12,5,7,8,26,27,7,68,78,18,96,114,28,108,124,32,113,129,35,99,112,30,
-61,68,17,42,52,13,57,81,22,63,89,24,53,65,18,54,54,19,64,64,22,57,59,17,50,59,15,59,67,17,72,74,19,70,69,20,69,69,24,74,75,25,77,78,22,77,78,19,
-79,82,22,81,87,24,80,85,23,70,72,19,58,58,15,55,55,14,58,60,20,52,55,19,38,39,13,23,23,6,19,19,4,31,31,7,46,47,13,57,59,17,62,62,18,60,58,16,
-59,56,14,57,52,14,41,37,9,25,23,6,13,12,3,5,6,3,1,2,1,0,0,0,0,0,0,0,2,1,3,5,2,7,8,3,14,12,4,15,14,3,9,8,2,11,9,2,
-14,13,3,16,16,6,18,20,8,17,20,8,17,20,8,16,20,9,15,18,8,13,15,7,12,14,6,10,14,6,10,13,6,10,13,6,9,12,6,5,9,5,1,7,4,2,7,4,
-2,7,5,2,7,4,2,7,4,2,8,5,4,11,9,4,11,10,4,12,10,3,12,9,3,11,8,2,12,7,3,12,7,3,12,8,3,13,8,3,13,9,7,14,15,13,17,27,
-20,20,39,22,21,43,25,20,45,30,18,50,37,18,56,39,16,56,40,15,51,39,14,46,38,15,44,34,16,41,29,16,39,27,16,38,28,15,37,29,14,36,33,13,37,40,15,42,
-47,21,54,54,29,66,58,32,75,61,34,82,65,35,88,71,34,92,76,31,93,66,26,86,49,24,84,45,25,84,61,26,87,83,31,93,99,38,105,108,43,115,114,43,121,116,42,123,
-100,37,118,71,31,109,60,31,106,88,38,116,117,43,128,120,41,129,96,30,108,68,21,83,77,25,91,101,32,106,106,32,102,100,29,98,116,35,113,136,43,125,145,48,121,147,48,118,
-151,49,132,148,47,137,137,41,125,108,31,98,80,25,80,105,32,96,140,42,109,151,47,119,154,48,132,139,41,124,107,30,94,109,32,94,122,35,105,92,28,80,78,25,58,109,39,72,
-129,55,87,118,56,74,117,52,63,114,53,66,84,54,75,58,49,65,19,36,37,52,48,61,105,70,89,56,55,57,9,33,26,24,28,31,77,42,60,88,53,62,44,47,40,8,35,25,
-5,21,19,2,6,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,1,2,42,9,27,54,12,31,122,30,88,182,49,143,168,44,127,149,40,111,158,45,116,183,54,129,
-197,62,147,178,60,124,153,49,98,148,44,100,147,42,94,138,38,98,104,29,72,82,23,48,68,19,44,58,19,52,62,21,63,41,20,50,14,11,27,20,20,25,45,58,40,68,63,54,
-38,23,28,2,0,8,11,8,20,12,11,16,9,10,7,28,30,10,42,49,14,33,54,19,28,55,17,41,51,12,74,85,20,102,123,31,116,137,36,118,136,37,92,104,28,54,60,14,
-58,68,18,74,98,27,63,87,23,54,65,18,60,61,22,64,64,20,52,58,15,57,65,16,81,85,22,91,91,25,83,85,27,78,82,28,82,83,26,88,88,24,89,90,24,86,91,25,
-81,87,24,74,77,21,66,67,17,63,62,15,58,56,14,51,50,13,41,41,12,32,33,8,38,38,9,52,53,13,62,62,16,63,62,16,65,63,17,66,64,17,59,56,15,53,48,13,
-49,45,12,37,34,9,13,13,3,2,2,1,7,6,1,16,15,4,23,21,5,24,23,6,23,22,6,24,23,6,29,26,7,35,32,8,39,35,9,34,31,9,22,20,5,14,12,3,
-10,9,2,7,8,3,5,7,3,3,4,2,2,2,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,4,4,2,7,6,2,7,6,2,8,7,3,9,7,2,9,7,
-2,8,7,2,8,6,2,9,6,2,9,6,7,12,15,10,14,21,10,14,21,9,14,20,8,14,19,8,13,17,7,13,16,5,12,13,5,12,11,4,12,10,3,11,8,4,12,10,
-5,13,14,8,15,20,12,17,27,19,20,37,27,23,50,33,23,56,35,22,58,38,19,58,42,18,59,45,17,59,44,16,53,41,15,48,44,17,48,36,17,45,29,16,37,26,14,31,
-31,14,35,39,19,45,46,23,54,53,28,64,57,32,74,61,34,81,67,35,88,75,35,94,77,33,96,65,29,92,45,24,83,41,23,79,64,28,87,85,33,97,96,37,106,109,41,116,
-116,42,121,111,40,121,87,34,114,59,30,105,71,33,109,109,41,124,127,45,133,115,37,121,85,25,94,80,23,88,96,30,98,106,33,98,100,30,94,104,31,98,131,41,117,147,48,121,
-150,49,119,150,49,129,146,47,133,139,42,127,113,32,102,81,24,80,103,32,94,138,42,108,149,46,118,155,48,133,140,42,125,107,29,94,111,32,95,120,37,106,87,30,78,76,25,56,
-117,40,77,138,57,89,123,57,76,121,54,68,112,53,68,87,55,78,52,47,61,31,46,39,97,77,74,116,85,90,44,50,51,9,33,26,55,34,45,106,49,71,88,53,60,35,44,36,
-6,34,24,8,20,16,11,12,6,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,36,8,22,57,13,35,84,20,54,174,46,138,174,46,135,148,39,127,152,43,125,176,52,125,194,60,144,
-175,55,123,151,47,100,160,47,116,159,46,103,145,40,104,113,31,80,92,25,50,74,20,43,59,18,51,64,21,63,36,16,45,24,35,29,36,52,31,47,60,40,65,60,52,42,25,31,
-2,0,5,10,10,18,28,41,22,29,44,13,39,44,9,39,43,10,35,60,20,41,73,23,61,82,20,84,98,23,105,125,31,115,136,36,116,133,36,83,92,24,53,58,15,77,88,23,
-96,114,31,77,93,25,56,62,16,59,58,17,62,65,20,52,61,16,67,75,19,96,98,26,103,102,29,98,101,33,92,100,33,91,96,28,97,98,27,97,100,28,87,92,26,77,81,22,
-69,70,19,68,68,18,73,72,19,70,70,18,58,57,15,44,44,11,42,42,10,60,60,15,73,74,19,77,77,20,74,73,19,67,65,18,59,56,15,47,44,11,34,30,8,24,21,6,
-16,15,4,13,13,3,19,19,4,29,28,7,41,38,10,48,45,12,49,46,13,42,40,10,37,33,9,38,35,9,37,35,9,33,32,8,30,30,7,27,27,7,20,20,5,7,7,1,
-2,3,0,4,4,1,1,1,0,0,0,0,1,0,0,1,1,0,3,3,1,3,4,2,1,3,2,3,5,8,8,9,17,9,12,19,9,11,18,9,10,18,9,10,18,8,11,18,
-8,11,18,8,11,18,8,10,18,7,10,17,9,12,19,10,14,22,12,15,25,12,15,25,10,15,23,10,14,23,10,14,22,9,14,22,13,15,26,16,16,31,16,16,30,12,13,23,
-7,10,15,4,9,11,2,10,8,5,12,13,14,18,29,22,22,42,25,23,48,29,24,52,35,25,58,41,25,64,46,24,67,47,21,64,49,19,61,49,16,56,45,16,49,34,14,36,
-24,11,24,23,9,24,29,12,33,39,18,48,47,23,56,53,27,64,58,32,76,62,36,85,69,38,92,77,38,99,71,34,96,42,24,84,26,21,79,51,26,88,79,31,96,90,34,104,
-102,39,113,114,43,120,115,41,121,98,38,117,67,30,107,73,32,109,105,40,122,125,45,131,125,41,128,104,30,106,82,22,83,91,27,82,106,33,94,99,31,92,101,30,95,129,40,119,
-149,49,127,150,49,119,149,48,126,148,48,135,141,43,129,116,33,105,80,24,80,99,30,94,136,41,108,150,46,118,155,48,133,143,42,128,110,30,96,114,32,94,120,36,105,89,31,81,
-83,30,62,135,47,85,152,62,94,131,62,79,120,56,67,114,55,71,97,59,82,55,50,61,41,50,41,109,83,80,112,80,87,39,46,47,15,34,29,76,39,60,112,52,76,75,49,52,
-23,41,31,17,38,22,47,42,15,23,18,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,5,12,55,13,34,73,16,46,144,36,109,183,50,146,157,41,131,149,41,129,170,50,123,194,59,141,178,54,126,
-145,43,93,156,46,111,164,47,112,159,45,114,129,35,91,110,30,58,109,30,52,80,23,55,64,20,62,38,15,45,24,31,30,46,70,35,60,84,44,67,65,51,47,27,35,4,0,6,
-5,7,10,28,45,16,45,76,20,59,80,17,44,53,13,32,56,19,48,79,23,70,89,21,89,104,25,105,126,32,116,137,36,116,130,35,79,87,22,56,63,16,84,97,26,101,119,33,
-89,101,26,69,71,18,64,62,16,65,74,19,67,86,23,83,93,24,101,101,27,103,103,30,100,105,31,98,104,32,100,104,30,100,103,29,95,100,29,84,90,26,72,75,21,69,69,18,
-73,72,19,76,75,20,71,71,19,62,62,16,63,63,16,73,73,19,83,83,22,84,84,23,76,75,20,67,65,17,59,57,15,50,51,13,37,38,10,20,18,4,12,11,3,17,16,4,
-32,30,7,48,46,12,56,54,15,53,50,14,46,43,12,39,37,9,32,30,8,27,26,7,26,26,6,26,26,6,26,26,6,26,26,6,25,26,6,26,27,6,26,27,6,24,24,6,
-25,25,6,23,22,6,15,14,4,14,13,3,17,15,4,19,17,4,21,20,6,15,15,5,3,5,2,2,3,5,4,6,10,4,6,10,4,6,10,4,7,10,4,8,10,5,10,12,
-5,11,13,6,11,14,6,12,14,6,12,15,8,13,17,13,15,26,20,18,36,22,19,39,21,19,38,21,19,38,20,18,35,17,17,32,17,16,32,18,17,34,18,17,36,19,17,37,
-19,15,36,19,13,34,16,12,29,11,12,22,10,13,23,13,16,28,16,18,32,22,20,39,26,22,44,28,23,50,32,26,56,38,27,62,43,27,66,47,25,66,48,22,63,49,17,56,
-45,13,46,34,9,33,25,7,25,24,9,32,32,13,44,39,17,51,48,23,61,56,30,75,60,35,82,64,38,91,66,39,96,59,35,95,46,27,89,36,24,86,50,26,91,72,30,96,
-85,33,100,96,37,108,106,40,115,112,41,119,98,38,117,78,32,111,75,32,111,94,36,114,119,42,124,128,43,130,111,33,113,84,23,82,87,25,78,104,33,93,103,32,94,100,31,94,
-126,40,117,148,48,128,150,49,120,149,48,122,148,48,129,142,43,129,117,33,107,86,26,84,102,32,95,136,41,107,150,46,118,159,51,136,151,45,129,120,33,99,117,33,98,133,44,118,
-89,39,83,98,36,69,153,52,93,159,67,99,129,64,80,122,58,68,122,60,79,97,61,84,52,49,57,58,58,47,124,88,90,101,72,81,25,41,37,21,30,29,72,37,52,91,48,56,
-63,48,45,20,39,26,47,49,22,55,41,15,12,10,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,2,6,52,11,33,65,14,40,115,28,82,171,45,133,160,43,133,144,39,129,164,48,126,191,58,138,190,58,140,156,47,103,
-151,44,103,162,47,107,163,46,115,152,42,121,123,34,84,114,31,53,86,24,51,76,23,67,57,19,57,35,30,37,44,67,32,59,84,39,67,68,51,51,30,39,6,1,6,4,7,8,
-25,43,14,44,77,17,63,86,20,50,63,15,35,60,20,60,87,26,93,108,27,105,117,30,110,130,34,116,137,36,116,130,35,86,92,23,67,77,19,94,114,31,104,122,34,86,95,25,
-69,70,17,65,66,17,67,80,20,79,100,27,99,112,31,105,108,30,101,104,30,98,104,30,95,101,28,101,104,29,103,106,30,94,98,29,78,80,23,70,70,19,76,75,20,83,83,22,
-76,75,20,65,65,17,64,65,16,75,75,20,85,85,23,88,88,24,84,83,23,70,69,18,58,56,15,48,49,12,36,40,9,23,26,6,16,17,3,23,21,5,40,38,10,55,53,15,
-61,59,16,58,56,15,50,48,12,42,40,10,35,34,9,27,27,6,25,25,6,25,25,6,26,26,6,27,28,6,29,29,7,33,32,8,36,35,9,38,37,10,39,37,10,40,37,10,
-36,34,9,29,26,7,22,20,5,20,19,5,19,18,5,17,16,5,15,16,5,9,10,4,3,4,2,1,4,3,1,5,4,1,6,4,1,6,4,1,6,4,2,7,5,2,8,5,
-2,8,5,2,8,5,2,10,6,2,10,6,3,11,8,6,13,14,13,16,25,17,17,32,19,18,35,24,20,41,28,22,46,28,22,46,28,22,46,24,21,42,20,20,37,18,19,34,
-20,19,35,28,20,41,33,19,44,31,18,43,27,17,40,21,16,36,17,16,33,24,17,34,31,18,40,30,19,41,27,19,43,26,21,45,29,24,51,36,27,59,41,28,64,45,27,66,
-48,24,65,49,19,59,45,15,48,36,10,35,25,7,28,24,9,34,33,13,47,43,20,60,53,26,72,60,33,81,61,37,88,57,39,93,57,39,98,53,33,94,41,26,86,41,25,86,
-61,28,93,80,30,97,89,34,102,98,38,110,106,40,116,101,39,117,86,34,113,72,29,106,82,30,103,111,39,114,127,44,126,115,36,117,87,24,86,84,23,76,101,31,90,103,33,95,
-98,31,94,122,38,114,146,47,128,150,48,118,148,49,116,149,48,128,142,44,130,127,37,116,102,29,95,107,33,99,136,41,107,155,49,120,168,56,138,156,50,130,117,32,96,123,37,106,
-125,45,114,90,41,84,113,43,77,159,59,100,155,67,97,129,63,80,122,60,70,121,63,80,94,61,83,71,55,58,88,70,60,125,90,91,80,65,70,14,34,26,28,27,28,78,40,50,
-88,48,54,48,41,39,22,35,25,59,52,26,47,36,12,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,6,1,3,42,9,26,61,13,37,97,23,65,159,41,120,160,43,131,143,40,133,146,42,116,179,53,124,195,60,147,173,52,126,157,47,111,
-162,47,108,162,46,108,161,45,135,140,39,115,123,34,71,85,23,45,64,20,57,71,21,64,72,38,65,74,68,54,63,84,41,61,69,44,49,30,36,5,0,3,17,29,8,34,56,17,
-44,76,17,63,87,20,49,62,15,34,59,19,60,88,26,106,119,30,125,135,36,121,138,37,115,136,36,110,124,33,84,90,22,77,89,23,103,126,35,106,130,36,87,98,26,67,67,16,
-65,68,17,68,85,22,84,104,28,106,115,32,108,111,32,101,105,31,95,103,29,95,100,27,101,103,29,105,107,32,97,100,30,78,80,22,72,71,20,82,81,22,89,88,24,79,78,21,
-66,65,17,72,72,19,84,84,23,86,86,24,82,82,22,78,77,22,68,67,18,52,53,14,39,41,10,25,27,7,17,19,4,28,27,6,46,45,12,61,58,16,65,63,17,56,53,15,
-45,44,11,43,41,11,44,44,11,46,46,12,43,43,11,36,36,9,31,30,7,36,36,9,42,41,11,46,45,12,47,45,13,49,45,13,49,45,13,43,39,12,33,30,9,24,22,6,
-17,17,4,10,11,3,7,9,3,4,7,3,3,5,2,1,4,2,0,2,2,0,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,3,0,0,4,1,1,5,2,2,7,5,4,9,9,5,10,13,6,11,16,10,14,22,15,16,30,19,18,35,22,19,38,24,20,41,26,21,43,26,21,43,
-26,21,43,29,21,43,31,21,43,33,20,42,34,20,43,34,20,44,31,19,43,30,18,43,29,18,39,30,15,37,31,15,38,31,16,40,29,17,41,26,20,43,28,22,48,33,25,56,
-41,28,64,45,28,66,47,26,65,47,20,57,39,13,41,22,6,22,17,5,20,26,9,35,46,17,58,58,23,71,58,27,75,59,33,83,59,38,92,57,40,97,56,38,96,45,28,84,
-38,24,83,51,26,90,74,30,96,85,31,98,90,35,104,100,38,111,104,38,116,88,36,113,65,28,100,67,25,92,102,34,106,121,42,121,115,37,118,91,25,91,82,22,75,98,30,87,
-98,31,89,92,29,88,118,37,111,144,47,129,145,47,117,148,48,116,149,48,128,144,45,133,132,39,121,103,30,97,108,33,98,138,41,109,158,53,125,169,60,139,153,49,127,115,32,96,
-122,38,107,123,46,114,84,42,79,118,50,81,162,63,102,151,66,95,126,64,76,133,67,75,128,65,87,108,63,86,91,62,60,116,90,71,133,98,93,60,52,54,11,31,22,41,30,34,
-86,43,52,85,47,51,34,35,33,30,41,26,60,51,24,35,26,8,14,4,3,5,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,0,0,28,6,17,58,13,36,79,18,50,142,35,105,155,41,131,146,40,135,143,40,129,158,47,115,190,58,140,176,53,133,163,49,122,164,49,116,
-161,46,108,163,45,135,147,41,127,130,36,89,91,25,48,66,20,54,79,23,71,80,34,70,93,78,69,76,94,49,54,74,38,40,31,29,10,1,6,16,26,4,48,81,19,58,95,22,
-66,90,21,51,64,14,34,58,14,61,89,25,106,119,30,127,136,35,127,143,38,115,136,36,109,126,33,83,92,23,77,91,23,105,130,36,107,130,36,86,97,25,66,66,16,65,70,18,
-70,88,24,90,108,30,108,115,32,106,108,31,100,104,30,95,101,29,96,100,28,104,107,31,104,107,32,91,94,28,78,79,23,77,77,21,87,87,24,85,85,23,72,72,19,70,70,18,
-80,81,22,87,87,24,82,83,22,74,74,20,66,66,17,58,58,15,46,49,13,29,31,8,21,21,5,32,31,8,54,52,14,67,66,19,66,65,18,57,55,15,47,46,12,43,42,11,
-44,44,11,47,47,12,46,46,12,45,46,11,44,44,11,47,46,12,51,49,14,56,54,16,55,53,15,51,47,14,45,41,12,39,36,10,32,29,8,22,20,6,11,11,3,9,8,2,
-11,10,3,13,12,4,10,10,4,2,3,1,1,1,1,3,3,2,5,4,3,7,6,5,9,7,6,8,6,7,6,4,7,6,3,7,6,4,7,6,4,8,7,5,9,7,4,9,
-5,3,9,3,1,7,3,1,6,2,1,4,2,1,3,1,1,3,1,3,3,0,5,3,0,6,4,1,7,6,5,9,13,9,12,21,11,13,24,12,14,25,14,15,28,17,17,32,
-20,18,36,23,19,40,26,21,43,28,21,45,30,21,44,31,21,43,32,20,42,32,19,42,31,18,40,29,17,38,27,16,37,28,14,36,30,14,37,31,15,39,29,16,40,28,18,42,
-35,22,51,40,26,58,39,27,61,38,26,60,33,21,52,24,12,36,22,7,23,17,4,17,25,7,27,38,13,47,41,15,56,47,20,64,57,28,78,60,36,89,57,40,95,51,38,94,
-44,30,84,36,23,79,43,24,86,64,28,93,72,28,91,76,28,93,92,34,105,105,39,114,91,36,111,61,28,99,59,24,89,92,30,98,117,40,117,119,40,122,94,27,93,78,21,69,
-87,25,73,88,26,74,88,27,83,116,36,109,140,44,127,142,45,115,146,48,115,148,48,127,136,43,126,123,36,113,103,29,96,107,32,99,139,43,111,159,54,125,170,61,140,152,48,128,
-112,32,94,113,38,98,111,45,101,88,44,79,127,54,86,164,65,103,150,73,94,141,82,79,145,74,81,124,64,91,115,67,86,116,82,63,144,108,85,127,88,93,40,43,43,10,28,20,
-58,36,40,115,65,57,91,59,50,30,40,30,40,47,27,68,51,24,54,23,14,34,7,11,4,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,18,4,11,52,12,34,64,14,40,124,30,88,157,40,129,131,36,130,145,42,142,162,48,127,186,56,141,182,55,140,159,48,125,166,50,130,165,47,111,
-168,48,140,161,45,150,138,38,107,105,29,58,71,20,49,70,18,58,77,29,68,98,81,74,94,120,57,69,108,43,29,42,23,4,1,4,13,21,3,49,78,18,64,102,25,73,99,24,
-56,71,16,40,63,14,69,101,25,110,127,32,128,136,36,126,142,38,118,137,36,111,129,35,92,108,28,85,102,27,105,129,35,105,127,35,85,96,24,67,69,17,62,69,18,68,89,23,
-92,109,30,109,114,32,103,105,30,98,104,30,95,101,28,99,102,28,107,108,32,106,109,34,89,91,26,76,75,21,82,82,23,89,89,25,79,80,21,68,68,17,75,75,20,86,87,25,
-86,86,24,77,77,21,67,67,18,61,63,16,51,53,14,31,34,8,21,22,5,31,30,7,53,51,13,67,65,18,68,67,19,58,57,16,47,47,12,44,44,11,46,46,11,48,49,13,
-50,50,13,47,47,12,46,46,12,50,48,13,54,53,15,56,53,16,54,51,15,48,45,13,39,36,10,28,26,7,22,20,5,19,17,4,18,17,4,20,17,5,22,19,5,26,23,6,
-30,26,8,31,28,8,28,25,7,26,23,9,29,26,17,33,30,22,35,30,23,35,31,24,35,29,24,31,27,23,26,21,22,20,16,20,19,17,22,20,18,25,24,19,30,25,20,32,
-20,15,30,16,11,29,16,12,28,15,11,27,14,10,26,12,9,24,10,9,19,5,8,10,3,7,7,3,7,5,5,8,10,9,10,18,10,11,21,10,11,21,11,11,21,10,11,22,
-10,12,22,11,13,24,14,14,28,17,16,33,22,18,39,25,20,42,28,20,44,29,20,44,30,19,42,29,17,37,29,17,37,29,16,38,28,15,37,27,14,36,30,14,37,31,15,38,
-32,16,42,35,19,46,34,21,48,31,21,47,28,21,48,27,21,51,25,17,45,23,11,33,20,7,24,19,7,24,21,8,30,35,12,49,48,17,65,55,24,73,58,31,83,53,37,91,
-45,36,91,45,30,89,40,24,82,38,23,83,53,26,90,64,25,89,70,25,88,88,32,101,101,37,111,85,33,107,53,26,93,51,19,78,81,25,82,110,37,110,116,39,119,91,27,90,
-70,19,61,76,20,60,83,24,70,89,27,83,115,36,108,139,44,126,140,45,113,146,47,112,144,47,123,134,42,124,123,36,112,101,29,95,110,34,100,142,43,111,161,54,126,170,60,142,
-144,46,121,101,33,83,122,45,97,118,49,102,93,47,80,138,59,91,168,75,106,160,92,98,152,90,82,139,70,84,136,68,100,137,76,91,136,93,72,147,108,90,104,75,80,26,35,32,
-25,34,24,96,61,51,135,85,63,99,75,51,32,44,28,51,51,26,80,48,28,65,19,23,23,3,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,0,37,8,23,55,12,34,81,18,52,145,36,112,138,37,130,138,40,143,155,45,132,175,53,130,186,56,142,161,47,124,163,48,132,165,47,114,167,47,130,
-169,49,160,157,54,142,121,36,80,75,20,47,66,18,55,78,24,67,93,70,74,100,122,57,82,126,43,47,75,29,3,5,4,9,14,2,46,72,17,63,101,24,76,104,25,71,93,22,
-47,76,18,72,105,26,119,140,37,134,148,40,129,145,39,114,134,35,110,128,34,93,109,29,91,109,28,107,131,36,103,124,33,82,93,23,72,78,20,68,81,21,66,88,23,85,102,27,
-98,103,28,101,103,29,97,103,30,96,101,29,101,104,29,107,110,33,104,106,33,87,88,26,77,76,22,87,86,25,87,87,24,73,73,19,69,68,18,82,82,23,91,91,28,86,87,26,
-72,72,19,62,62,16,60,62,16,48,49,13,26,27,7,28,26,7,50,47,13,66,65,17,64,63,17,49,49,13,39,39,10,40,40,10,46,47,11,47,48,12,47,48,12,50,50,13,
-51,51,14,52,50,14,52,50,14,50,47,14,45,42,12,39,36,10,29,27,7,22,20,5,19,17,4,20,18,5,23,21,6,27,24,7,31,28,8,35,31,10,39,35,11,40,38,11,
-42,40,12,42,39,12,41,38,12,39,36,14,39,36,20,38,35,21,35,32,19,32,30,18,30,28,16,24,23,14,15,16,11,7,12,12,7,14,17,8,16,20,12,17,24,14,18,26,
-13,18,28,13,18,28,14,18,29,14,19,29,15,18,31,17,19,33,17,18,31,14,16,27,12,15,24,11,14,22,10,12,19,9,12,18,8,11,18,9,11,18,9,11,18,10,11,20,
-10,11,21,11,11,22,10,11,21,10,11,21,11,12,22,13,13,25,18,15,32,21,17,38,22,18,39,20,16,34,20,14,29,24,13,31,28,14,35,29,15,38,28,15,38,26,14,35,
-28,14,34,31,15,38,32,16,42,31,17,41,30,16,40,28,18,43,26,20,46,21,18,42,20,14,39,24,12,42,23,9,33,19,7,27,29,11,42,45,16,61,52,20,69,54,26,78,
-45,31,85,43,35,92,46,35,94,43,27,86,37,23,82,47,25,88,63,25,89,69,25,87,80,29,95,88,32,103,78,30,101,48,21,81,41,14,58,66,18,66,98,31,99,108,36,113,
-84,25,83,63,17,55,75,20,59,83,24,68,86,26,80,113,35,107,136,43,123,134,41,102,141,44,102,145,46,123,132,41,122,121,35,110,100,29,93,113,34,99,144,44,113,163,55,131,
-170,60,141,139,45,117,117,40,88,143,53,105,117,52,102,95,52,80,149,65,96,172,82,109,161,95,95,150,86,80,146,71,90,152,74,107,147,81,89,139,98,74,145,107,95,102,63,72,
-42,32,24,52,40,33,121,76,61,143,95,67,78,68,46,26,38,22,68,52,32,85,44,37,65,21,23,13,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,5,1,3,33,7,21,48,10,27,117,28,82,144,38,127,135,38,139,151,45,140,155,46,118,176,53,131,166,48,126,157,45,125,167,48,120,166,46,117,169,45,156,
-157,61,149,138,77,111,87,35,60,47,13,43,62,17,53,90,58,77,104,116,68,88,129,46,54,87,30,20,15,13,26,12,15,46,63,18,60,99,23,71,101,24,77,99,24,61,93,22,
-76,110,27,117,140,37,137,151,41,131,147,40,117,137,37,108,126,33,89,106,27,90,109,29,107,131,36,103,123,33,83,93,23,71,77,19,68,82,21,68,92,24,84,101,26,92,98,26,
-94,98,28,96,102,29,96,102,29,104,109,32,109,113,35,97,99,31,78,79,23,79,78,22,89,89,25,84,84,23,66,66,17,67,66,18,83,82,24,88,88,27,82,83,25,71,72,19,
-62,64,16,55,57,15,34,36,10,22,21,5,40,38,10,62,60,16,66,64,17,51,51,13,33,33,8,28,29,6,32,33,8,40,40,10,44,44,11,43,43,11,48,46,13,53,50,14,
-52,49,14,47,44,13,38,35,10,29,27,7,21,20,5,19,18,4,20,18,5,24,21,6,29,25,8,34,30,9,37,34,10,40,37,11,41,38,11,42,40,12,42,39,12,38,36,11,
-35,33,10,32,29,8,29,26,7,26,24,7,24,23,9,18,18,7,12,14,6,11,12,8,10,11,10,9,8,10,6,5,9,4,3,9,4,5,11,5,7,13,5,8,14,6,9,15,
-7,12,19,8,15,22,8,16,22,8,17,22,9,17,23,13,19,28,16,20,31,17,20,32,17,20,32,16,20,32,16,19,31,15,19,30,14,17,29,13,16,26,11,14,22,10,13,19,
-7,12,15,6,11,15,8,12,17,10,12,21,11,12,22,10,11,21,10,11,21,11,12,21,11,12,23,11,11,24,12,11,24,13,11,25,15,10,22,20,11,24,27,14,33,29,14,36,
-22,10,27,19,8,22,26,11,30,31,14,39,32,16,42,31,16,41,28,16,38,22,14,33,16,14,33,18,16,43,24,15,49,25,13,41,19,8,28,23,9,33,39,14,54,49,17,66,
-43,20,70,43,28,82,44,35,93,45,35,96,42,30,87,36,22,80,43,24,86,60,25,87,65,24,84,71,26,90,83,30,99,81,28,98,50,20,76,38,13,54,56,15,57,85,27,88,
-101,32,107,83,24,83,63,16,54,59,16,46,58,16,46,76,22,69,117,36,109,131,40,115,129,39,92,142,45,104,144,45,124,132,41,123,120,34,110,97,28,92,114,35,99,148,45,113,
-166,56,134,167,58,140,143,45,115,136,48,96,144,59,110,103,52,95,104,56,82,157,69,102,170,85,107,156,94,87,150,83,82,145,70,96,152,74,107,148,88,83,149,109,81,159,99,100,
-104,52,59,42,30,23,69,48,41,139,88,68,130,90,63,50,48,33,31,33,19,84,56,34,101,56,38,47,15,18,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,19,4,12,43,9,26,88,21,57,145,36,119,135,38,136,147,43,145,148,44,117,162,48,118,166,49,125,154,44,123,164,47,124,165,46,111,170,46,150,162,53,155,
-147,82,128,99,59,69,53,19,46,47,11,42,82,42,73,119,111,96,107,135,73,66,102,42,20,26,12,41,9,27,75,66,47,66,102,31,70,103,25,79,102,24,61,92,22,72,108,26,
-114,138,36,134,150,40,124,143,39,108,132,34,107,126,33,88,106,27,88,108,28,107,131,36,103,124,33,83,93,23,70,77,19,65,80,20,68,91,24,86,102,26,91,96,26,94,97,28,
-96,103,29,91,98,26,99,106,31,109,114,35,91,93,28,67,66,18,78,78,22,91,90,26,80,80,22,64,62,17,69,68,19,80,80,23,81,83,24,70,72,20,62,63,17,59,61,15,
-45,47,12,21,22,6,19,19,4,44,43,11,61,60,16,52,52,14,36,36,9,28,28,6,32,32,8,36,36,8,38,38,9,39,39,10,42,40,10,46,43,12,49,46,14,45,41,12,
-35,31,9,24,23,6,19,18,4,20,18,5,23,19,6,26,22,6,32,28,8,37,34,10,41,39,12,42,40,11,41,39,11,39,38,11,37,35,11,34,33,10,31,29,8,25,24,6,
-22,21,5,21,21,5,20,19,5,18,18,5,16,16,4,10,9,3,6,4,2,10,5,8,13,7,15,13,5,16,13,5,16,14,7,16,15,8,16,15,8,16,13,7,16,12,7,16,
-14,8,17,14,9,18,13,9,18,13,11,21,13,12,23,14,13,26,15,15,27,15,16,28,15,17,29,14,18,28,14,18,28,14,19,29,15,20,31,16,21,31,15,18,28,13,14,24,
-8,12,17,3,10,9,2,10,7,4,10,9,6,11,12,8,12,17,10,12,21,11,13,23,11,12,21,9,10,18,8,7,16,7,6,15,3,4,8,2,3,3,8,5,9,18,9,20,
-23,8,24,21,7,23,19,6,19,20,8,22,27,12,32,32,15,40,32,16,42,26,12,33,19,8,22,14,9,25,16,14,38,22,18,51,25,15,49,22,9,34,19,8,26,33,12,46,
-47,19,66,46,25,75,43,27,82,38,31,88,35,32,91,38,26,86,36,21,78,38,21,76,56,23,82,64,24,83,62,25,84,77,28,95,82,30,99,53,21,78,37,13,56,51,14,53,
-80,24,82,98,31,105,81,24,80,47,13,41,27,8,17,44,12,35,93,26,84,122,38,113,129,40,113,125,37,87,138,43,100,140,44,122,131,41,122,115,33,107,86,25,82,108,32,87,
-150,46,116,166,57,134,164,56,138,140,47,112,140,56,99,143,61,111,95,53,88,115,58,84,165,73,105,167,90,103,156,94,86,149,81,84,148,69,102,152,76,101,141,93,76,163,116,97,
-159,88,102,89,43,49,38,31,22,96,59,50,145,88,66,108,76,53,27,29,19,49,34,21,103,65,43,94,45,36,29,10,11,2,2,0,1,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,9,2,4,27,6,14,61,13,36,141,34,108,139,37,131,138,41,146,139,41,126,146,43,108,168,49,125,157,45,124,157,44,122,162,46,107,169,47,137,166,48,160,156,78,140,
-121,73,95,68,25,59,39,8,37,69,26,54,130,98,107,135,140,107,88,117,64,26,38,15,32,6,19,79,62,54,81,120,69,76,122,57,79,105,30,62,91,22,66,101,24,107,133,35,
-135,150,41,121,141,38,87,118,30,86,113,28,83,102,26,87,106,27,106,130,35,102,124,33,89,101,26,75,86,21,58,73,17,57,80,20,84,99,26,92,97,26,94,99,28,94,102,28,
-90,97,26,96,103,29,103,108,33,82,85,26,52,51,14,71,69,19,90,90,25,84,83,23,69,66,18,75,72,21,80,80,24,75,77,22,63,65,18,49,53,13,42,47,11,30,31,8,
-17,17,4,29,29,7,50,50,13,52,52,13,38,38,9,29,29,7,31,31,8,36,36,9,38,38,9,37,37,9,38,37,9,44,42,12,48,44,12,42,38,11,30,28,8,18,17,5,
-16,15,4,21,19,5,26,21,6,28,23,7,31,27,8,34,31,9,38,36,11,39,38,11,39,37,11,37,34,10,33,31,9,29,28,8,27,26,7,25,25,6,24,24,6,24,24,6,
-25,25,6,27,24,7,26,23,7,24,21,6,25,21,7,26,21,7,26,21,7,27,22,10,25,20,14,22,18,13,21,16,12,21,17,12,21,17,13,18,14,14,12,9,13,10,7,11,
-11,7,11,11,7,12,11,8,12,11,8,17,11,9,21,12,11,22,13,11,23,14,11,24,13,12,24,12,12,22,9,12,19,9,12,20,10,14,21,11,15,23,12,17,26,14,17,27,
-16,16,27,14,14,22,10,11,17,6,9,10,3,9,7,3,9,6,4,10,9,6,12,13,9,13,19,11,13,22,11,11,22,9,8,19,5,4,10,0,1,2,0,0,0,1,1,1,
-8,3,8,17,6,18,23,7,23,18,6,19,11,4,13,20,7,22,28,12,33,27,12,32,22,8,24,20,5,19,16,6,21,12,10,27,10,11,35,18,12,46,20,10,37,9,6,21,
-25,11,38,46,22,67,49,26,76,34,24,75,24,24,80,25,24,87,35,24,86,35,20,75,35,19,70,50,22,79,49,20,75,46,19,74,73,27,93,80,29,97,45,19,74,37,14,57,
-50,13,53,65,19,71,86,27,90,76,23,72,32,9,27,10,3,8,58,16,52,104,30,95,125,38,115,121,37,103,112,32,75,131,40,98,137,43,121,131,40,121,101,29,94,64,17,55,
-112,31,85,154,48,118,166,58,134,157,55,132,134,50,102,146,61,102,136,61,112,89,52,84,130,62,89,172,80,109,170,103,101,162,107,87,148,77,87,148,67,103,149,80,96,145,102,81,
-170,114,107,150,75,92,78,40,38,59,44,29,125,74,56,148,93,64,77,56,40,19,18,11,79,50,32,123,69,50,94,46,33,54,35,13,9,9,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,1,1,30,6,18,54,12,33,112,26,79,143,36,123,136,40,142,132,40,137,120,36,102,155,45,123,166,48,139,155,45,130,154,45,105,160,45,117,165,44,155,164,68,153,155,89,132,
-103,48,95,54,13,60,58,18,48,121,86,93,146,141,110,107,131,76,45,60,31,31,8,22,74,54,48,94,132,75,87,147,91,95,137,83,72,102,33,65,99,22,101,129,33,133,149,40,
-125,144,38,90,120,30,81,111,28,73,96,23,73,91,22,100,123,33,104,125,33,89,102,26,80,91,23,60,75,19,52,73,17,79,93,24,89,95,25,93,97,27,94,101,28,88,96,26,
-92,98,28,101,105,32,77,80,24,46,45,12,63,62,17,81,81,22,79,79,21,74,72,20,79,77,23,80,81,24,68,70,20,53,55,15,44,49,12,34,40,10,17,18,5,12,12,3,
-37,37,9,55,55,14,44,44,11,30,30,7,30,30,7,36,36,9,37,37,9,35,35,8,35,34,9,34,33,8,38,35,10,41,38,10,34,32,9,17,16,4,3,3,1,5,5,2,
-18,15,5,26,21,6,30,26,8,31,29,8,34,32,9,32,31,8,29,27,8,28,27,7,27,26,7,26,25,6,25,24,6,25,24,6,26,25,6,28,26,7,29,27,8,31,29,8,
-32,30,9,32,31,10,33,30,11,31,29,12,31,29,13,31,29,14,30,28,16,29,26,17,25,24,18,22,21,17,20,20,17,22,22,18,24,23,22,21,20,24,17,17,23,14,14,19,
-15,14,20,15,16,22,14,16,22,14,15,22,14,16,22,13,15,21,12,14,21,12,12,20,11,11,19,11,10,19,9,10,18,8,9,17,9,9,17,8,10,17,9,11,18,11,12,19,
-17,14,25,22,17,29,21,15,28,18,12,24,14,10,20,9,10,15,5,9,9,1,8,6,2,9,6,5,11,10,7,12,15,10,12,21,10,10,20,3,5,8,0,1,1,0,0,0,
-0,0,0,2,0,1,9,3,8,13,4,13,3,1,5,3,2,9,12,5,19,21,7,24,25,8,26,23,8,23,20,6,20,15,4,15,5,2,6,4,5,19,10,10,41,10,11,44,
-6,6,27,17,7,29,42,18,59,47,24,74,29,21,70,19,20,74,23,23,85,34,24,87,34,20,75,27,17,67,42,20,72,41,18,66,43,17,67,68,23,83,66,24,84,38,18,68,
-36,14,57,42,11,46,57,16,55,86,26,83,76,23,71,27,8,26,15,5,18,65,18,61,107,31,98,123,37,114,106,31,88,99,28,63,130,39,98,136,42,120,128,39,119,88,25,82,
-68,17,56,120,34,91,150,47,111,159,54,123,148,53,121,131,51,95,148,63,106,123,58,105,98,55,82,154,70,99,176,91,111,175,118,99,165,105,85,148,68,93,150,69,106,148,87,85,
-155,112,88,180,110,113,147,69,80,83,54,35,88,68,38,158,103,65,137,91,62,42,34,27,34,24,16,122,68,50,140,72,55,98,55,34,36,27,8,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-12,3,7,34,8,19,83,19,54,147,36,116,136,38,134,137,41,145,116,34,111,136,39,109,167,49,144,171,48,154,161,59,131,152,55,103,153,40,137,155,53,147,165,88,143,138,78,125,
-89,46,100,56,18,55,103,64,74,155,150,115,130,153,91,66,86,44,44,20,36,86,60,72,99,130,83,93,156,90,97,144,90,77,111,49,61,96,22,92,122,30,129,147,39,128,145,39,
-97,125,32,86,119,30,86,115,29,75,95,23,89,109,27,99,121,32,90,103,26,79,91,23,60,75,18,51,73,17,79,94,23,89,94,25,89,94,25,91,99,27,88,96,26,88,95,27,
-91,97,28,75,81,24,51,54,15,65,64,18,79,79,21,71,71,18,66,63,18,71,70,20,74,75,23,63,65,19,50,52,14,42,48,11,28,32,8,13,13,4,18,18,4,35,35,9,
-42,42,10,29,29,7,21,21,5,31,31,8,40,39,10,35,35,9,25,24,6,27,25,7,33,31,8,31,29,8,22,21,5,13,12,3,4,4,1,0,0,0,0,0,0,3,3,1,
-21,19,5,33,31,9,35,33,9,29,28,7,25,24,6,23,23,6,23,22,6,24,24,6,26,26,7,29,27,7,29,28,8,30,28,8,31,30,9,32,31,10,33,31,13,32,30,14,
-32,30,16,31,29,16,30,28,16,28,26,15,27,25,14,24,23,14,20,21,16,15,17,15,12,14,13,9,12,12,8,11,11,10,13,11,12,14,15,14,14,19,14,13,19,13,13,19,
-14,14,20,14,16,21,15,17,23,16,18,23,16,19,24,18,20,25,19,21,25,18,19,24,16,17,23,16,17,23,15,16,22,13,14,21,11,12,20,9,11,19,9,10,17,9,10,17,
-11,10,19,14,11,21,16,11,22,19,11,24,21,11,25,20,11,26,16,11,22,8,8,13,3,7,5,1,7,3,1,8,4,4,9,8,5,11,11,3,9,7,1,5,3,1,3,2,
-0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,4,3,3,12,8,4,18,17,6,21,20,6,21,11,5,17,13,6,23,17,6,20,9,2,6,3,3,13,10,10,42,
-13,13,53,7,8,33,12,6,24,36,15,53,49,24,72,33,22,70,19,19,72,22,23,85,28,24,88,18,18,71,21,14,57,38,16,60,40,16,59,41,15,61,54,17,67,48,18,67,
-27,13,52,36,12,50,41,11,45,55,15,53,77,24,74,63,19,59,22,7,23,18,6,22,71,20,65,109,32,100,115,34,106,93,27,73,102,29,64,131,39,102,131,40,120,124,37,116,
-78,22,72,74,19,59,122,35,85,141,43,96,155,55,117,141,53,112,135,54,96,149,64,111,120,65,101,126,73,88,160,75,100,176,100,105,180,122,94,152,90,81,136,62,95,149,73,100,
-144,93,80,169,116,103,186,101,115,141,77,70,80,67,31,127,89,53,165,108,69,106,71,52,21,22,15,68,41,32,141,73,62,128,61,52,76,46,25,24,21,5,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-7,2,4,28,6,15,111,26,81,138,36,125,138,42,147,125,37,127,121,35,100,159,47,133,171,49,156,166,53,148,157,72,116,153,55,126,146,41,137,162,78,145,157,89,141,120,81,133,
-71,58,92,83,45,61,149,133,110,152,170,110,94,128,59,54,36,45,85,51,78,116,138,111,98,159,101,97,150,96,88,126,70,62,99,28,79,113,27,114,138,36,127,145,39,101,128,33,
-87,120,30,95,126,33,85,112,28,90,110,28,96,119,30,81,97,24,74,86,21,62,77,18,50,72,17,77,93,23,85,90,23,71,79,20,77,86,23,85,93,24,87,94,26,87,93,27,
-69,77,22,54,60,16,70,70,19,80,80,21,73,73,19,64,62,17,63,62,19,65,68,20,56,58,16,44,45,11,36,40,9,23,25,6,13,12,3,25,25,6,41,41,10,32,32,8,
-10,10,2,2,2,1,19,18,5,33,33,9,28,28,7,11,11,3,16,14,4,29,27,7,23,23,6,9,9,3,0,1,0,0,0,0,0,0,0,2,2,0,11,11,3,24,23,6,
-31,30,8,28,26,7,19,18,4,17,17,4,23,23,6,26,25,6,28,27,7,30,28,8,32,31,9,32,31,9,32,30,9,30,28,8,30,28,9,30,28,14,28,26,15,25,24,13,
-21,20,11,17,17,9,13,13,7,9,10,5,6,7,3,3,4,2,1,4,2,0,2,2,0,2,1,0,2,1,0,1,0,0,1,0,0,2,2,1,3,5,1,4,5,1,4,6,
-2,4,6,2,5,6,3,5,7,4,6,8,4,6,9,5,8,11,8,9,13,9,10,15,11,11,16,13,13,18,15,16,21,16,17,22,14,15,23,10,14,21,7,12,17,5,11,13,
-6,10,14,8,10,16,9,10,18,11,10,19,13,10,19,14,11,19,17,10,20,16,9,18,13,7,13,8,6,9,3,5,4,1,5,3,1,6,3,2,8,5,2,8,5,2,7,4,
-1,4,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,8,4,4,15,8,4,16,5,2,8,2,3,11,11,6,23,18,7,24,15,6,19,7,5,22,
-10,11,42,13,14,53,9,11,41,11,9,32,33,14,49,48,23,70,36,23,69,21,22,74,23,27,87,24,25,89,16,17,66,16,9,40,36,14,53,41,17,61,33,13,55,38,13,52,
-37,12,46,23,8,32,36,11,46,39,11,42,42,12,39,62,18,57,59,16,55,18,6,20,23,7,25,74,21,68,98,29,91,99,29,90,87,25,62,102,28,65,121,35,99,124,37,114,
-116,35,109,67,18,62,74,20,53,109,30,63,137,43,88,154,58,119,137,53,106,140,57,98,147,70,114,123,77,99,132,72,81,161,77,89,178,110,98,163,112,85,125,70,75,140,62,98,
-149,77,93,148,103,83,184,125,113,180,100,105,116,71,51,88,72,38,152,101,64,152,100,65,70,53,38,31,27,17,108,63,51,147,75,65,113,59,44,73,57,20,15,15,3,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,63,14,42,130,32,110,133,39,138,136,41,142,109,32,102,135,39,115,167,49,152,169,50,156,161,69,125,153,61,117,149,51,144,158,77,147,164,91,145,143,85,150,98,77,125,
-78,47,78,135,105,99,159,168,119,117,150,76,58,59,38,75,36,67,113,120,109,104,163,110,95,153,98,93,137,90,73,121,69,78,117,39,105,132,32,114,137,36,100,128,33,86,120,30,
-95,127,33,88,117,30,92,114,29,97,119,31,81,99,24,54,69,16,46,64,15,47,69,16,75,92,23,84,91,23,69,77,20,56,69,17,66,77,19,85,92,25,88,93,27,65,74,21,
-47,55,14,64,64,17,76,76,21,67,65,18,59,56,16,57,57,17,63,65,20,55,57,16,41,40,10,27,27,7,15,15,4,14,13,4,31,30,8,40,39,10,25,25,6,3,3,1,
-1,1,0,11,11,3,20,20,5,14,14,3,6,6,2,10,10,3,17,17,4,12,12,3,2,2,0,0,0,0,0,0,0,1,1,0,10,10,3,22,22,6,30,29,8,27,25,7,
-17,16,5,11,10,3,14,12,3,21,19,5,27,25,7,29,27,8,31,28,8,30,28,8,30,28,9,28,26,8,25,22,7,21,18,5,18,17,4,14,14,6,9,10,5,4,6,3,
-1,3,2,0,1,1,0,0,0,0,0,0,1,0,0,2,0,1,4,1,1,6,2,2,7,3,2,7,3,2,9,4,3,10,6,7,11,8,8,10,8,8,7,7,8,5,7,8,
-4,6,7,4,6,6,3,5,6,2,5,5,2,4,4,1,4,3,1,3,3,1,3,3,1,2,3,2,3,5,3,4,6,5,5,10,7,7,12,6,8,13,4,8,10,3,8,9,
-4,10,10,4,10,11,4,8,9,6,9,11,6,9,11,4,9,8,6,8,9,11,8,12,14,9,15,16,8,17,14,6,14,8,3,8,3,1,3,1,3,2,1,5,2,1,6,3,
-1,5,3,1,4,2,1,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,4,2,3,13,3,3,13,1,2,5,1,2,6,7,5,20,19,8,33,20,10,37,
-12,9,34,9,9,38,14,15,55,14,17,57,12,13,42,27,11,41,46,21,62,39,25,72,23,26,78,24,28,87,23,25,87,13,13,53,14,8,33,36,14,53,41,17,61,30,13,52,
-35,11,42,27,8,26,17,6,24,38,12,49,35,10,38,35,10,31,62,17,57,54,15,51,15,5,18,27,8,29,63,17,58,85,23,77,93,26,82,84,23,56,97,27,61,115,33,95,
-122,37,113,102,31,98,47,14,44,56,14,29,98,26,52,133,43,93,147,55,117,132,51,100,136,60,101,137,72,112,118,74,89,139,69,80,168,85,91,172,114,93,140,95,74,122,60,79,
-151,71,104,146,86,86,161,122,93,194,130,119,164,89,87,92,65,38,110,83,48,166,109,69,139,97,62,70,57,28,67,48,27,132,75,64,135,68,57,105,68,37,59,50,14,7,7,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-24,5,13,106,25,79,123,33,120,139,43,146,122,36,120,113,33,102,146,42,138,164,46,156,163,57,139,154,74,109,155,60,137,161,99,161,167,112,157,152,88,150,118,83,142,82,51,97,
-127,80,105,170,162,135,136,163,93,71,89,45,60,25,52,106,94,97,108,158,113,94,157,99,96,142,94,82,131,81,80,130,62,99,130,39,112,135,34,95,121,30,80,113,28,93,126,33,
-91,119,31,89,111,28,97,120,31,85,103,27,55,71,17,39,58,13,38,61,14,63,82,20,77,84,21,66,72,18,55,68,17,57,69,17,81,88,24,88,93,27,66,76,22,44,51,14,
-52,53,13,63,63,17,54,52,14,41,38,11,42,43,14,53,57,17,53,54,15,42,41,11,28,27,7,12,11,3,17,16,4,31,30,8,31,28,8,16,13,4,1,1,0,3,3,1,
-15,15,4,17,17,4,8,8,2,7,7,1,14,14,4,13,13,3,4,4,1,0,0,0,0,0,0,0,0,0,8,8,2,18,18,4,21,22,6,20,19,5,15,13,4,6,6,2,
-5,5,1,17,14,4,26,23,7,27,24,7,24,22,6,23,21,6,23,21,6,21,19,6,19,17,5,14,13,4,8,7,2,4,4,1,1,1,0,0,1,1,0,1,1,3,1,1,
-6,3,1,8,4,2,10,4,3,13,5,3,15,7,4,16,9,4,17,10,5,18,13,7,19,12,8,19,13,8,19,13,10,20,14,14,20,15,15,19,15,15,17,14,15,13,11,14,
-12,10,13,11,10,13,11,10,13,10,10,13,9,10,12,8,10,12,8,9,10,7,8,10,5,7,9,4,6,7,2,5,5,1,3,2,1,2,1,1,2,2,0,1,1,0,0,0,
-1,3,2,1,4,4,1,4,2,1,5,3,2,6,4,2,6,5,2,7,4,3,7,4,5,8,7,9,9,11,14,9,14,16,8,16,14,5,15,9,2,8,3,1,3,1,1,1,
-0,1,1,0,2,1,1,3,2,1,3,2,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,9,4,4,15,2,2,8,0,1,4,5,4,19,18,11,40,
-24,12,45,14,9,36,9,8,36,14,14,55,16,21,65,13,15,46,24,9,36,45,19,59,40,24,70,22,23,71,22,27,85,22,22,81,11,12,49,13,7,32,35,13,51,36,14,49,
-24,10,42,16,6,26,4,1,4,15,5,20,40,12,49,33,10,36,37,10,32,65,17,59,49,14,47,12,4,16,30,9,32,66,18,60,89,25,80,93,27,80,84,22,51,101,27,67,
-108,31,93,111,33,104,79,24,77,29,8,24,47,12,22,81,25,51,129,46,97,138,53,108,125,52,93,140,64,107,137,82,110,125,78,85,150,71,83,171,96,93,162,113,87,132,83,69,
-146,79,95,158,84,103,148,103,82,183,144,107,188,115,112,133,74,63,83,68,34,138,95,60,166,111,69,128,88,49,63,50,19,94,59,43,145,76,66,121,64,50,101,76,32,55,48,12,
-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-49,11,31,110,28,96,134,39,141,132,40,137,97,29,90,126,37,118,156,44,153,165,50,151,157,70,113,153,60,121,158,85,157,167,133,167,160,120,157,137,98,150,88,66,112,107,56,96,
-176,149,151,165,178,134,96,132,73,56,43,51,97,70,86,114,148,115,95,162,103,91,144,93,88,134,85,82,134,70,101,138,49,112,136,35,98,121,31,66,91,21,81,112,28,91,121,32,
-88,110,28,90,110,28,87,105,27,59,74,18,40,57,14,32,54,12,50,74,17,62,73,18,51,53,12,44,51,12,45,59,14,69,79,21,88,93,27,69,77,22,43,51,13,50,50,13,
-58,57,15,46,45,12,34,30,9,33,35,11,42,46,14,48,49,14,41,40,11,27,26,6,11,11,3,10,9,2,25,24,6,25,21,7,10,5,3,1,0,1,4,3,1,9,9,2,
-12,12,3,6,6,2,10,10,3,15,15,4,7,7,2,1,1,0,0,0,0,0,0,0,5,5,1,16,16,4,22,22,5,15,15,4,5,5,1,0,0,0,2,2,0,6,6,1,
-15,13,3,22,20,5,22,20,5,14,13,4,8,8,2,8,7,2,9,8,2,8,7,2,3,3,1,2,2,0,2,2,1,1,1,0,3,2,0,9,5,3,14,9,4,18,13,5,
-20,15,5,20,14,5,19,14,6,20,15,7,21,17,8,20,17,11,21,18,14,20,20,16,20,19,17,19,17,17,17,15,17,16,14,18,16,14,18,15,14,17,13,13,17,11,11,16,
-9,8,14,9,8,14,9,9,14,9,9,13,9,10,13,11,10,13,13,10,12,13,9,10,12,9,10,10,9,11,10,9,11,7,7,7,2,3,2,0,2,1,0,2,1,0,2,1,
-0,2,1,0,1,0,0,0,0,0,1,0,0,1,1,1,2,1,1,4,3,1,6,3,2,7,4,2,7,4,4,8,6,8,8,9,14,9,14,16,8,16,14,5,14,9,2,8,
-2,0,2,0,0,0,0,1,0,1,2,1,1,3,2,1,3,2,1,1,1,1,1,3,0,0,1,0,0,0,0,0,0,1,1,5,4,4,14,3,3,11,1,1,3,4,3,14,
-15,9,36,21,12,43,10,9,34,8,8,34,14,14,53,17,21,67,12,16,48,21,8,34,43,17,55,39,22,63,21,21,67,20,25,79,20,21,77,11,11,47,12,5,24,25,8,28,
-15,6,23,2,2,11,0,0,0,0,0,0,18,6,23,42,12,51,31,9,32,42,10,36,61,17,56,37,11,37,12,4,16,39,12,39,73,20,66,91,25,82,84,24,68,82,22,48,
-95,26,65,93,26,81,88,26,85,54,15,54,23,6,15,40,17,22,86,35,61,126,48,93,125,49,94,130,58,95,148,81,114,144,104,105,134,81,79,159,76,86,172,108,96,158,113,81,
-146,94,79,163,93,109,155,88,94,160,127,86,185,138,98,165,89,80,104,68,44,100,83,43,161,109,67,157,104,66,94,66,34,65,49,22,125,69,58,139,68,61,126,83,48,100,82,30,
-23,21,5,8,8,2,6,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,1,2,
-74,17,56,120,34,123,144,44,150,94,28,97,85,25,82,144,42,141,160,45,154,155,61,124,150,64,106,156,62,148,169,124,172,167,143,167,152,129,157,120,108,143,91,52,94,156,116,132,
-181,185,162,129,169,118,69,92,83,87,74,83,125,146,115,109,166,109,91,151,95,75,129,85,79,132,74,91,134,52,108,134,36,105,129,33,69,92,22,69,92,22,86,117,29,87,111,28,
-89,108,28,81,97,24,62,76,19,41,58,14,34,55,13,35,63,15,37,54,13,26,28,6,25,25,6,33,40,9,58,70,18,81,88,25,69,77,22,39,47,13,45,45,11,58,57,14,
-48,46,12,33,29,9,33,35,11,33,37,12,31,32,9,35,34,9,22,21,5,8,7,2,7,7,2,9,6,3,12,7,4,7,3,2,2,1,1,5,5,2,7,6,2,4,4,1,
-5,5,2,13,13,4,13,13,3,4,4,1,0,0,0,0,0,0,0,0,0,8,8,2,20,20,5,18,18,5,7,7,2,0,0,0,0,0,0,5,5,1,12,11,3,16,13,4,
-14,13,4,10,9,2,4,4,1,0,0,0,0,0,0,0,0,0,1,1,0,2,2,1,5,5,2,9,8,2,11,10,3,11,10,3,14,11,3,19,15,5,20,17,5,21,19,8,
-21,19,10,20,19,12,18,17,13,18,17,13,17,16,13,16,16,15,16,15,16,15,14,16,13,14,16,10,11,15,8,9,15,9,8,16,10,9,16,9,9,16,9,8,15,8,8,15,
-8,7,14,8,7,14,8,7,15,8,6,14,9,7,14,10,6,12,12,6,11,13,6,9,14,5,8,14,5,8,14,7,8,13,7,7,10,6,4,6,4,3,3,4,3,3,4,2,
-2,5,2,2,4,2,1,3,2,0,2,1,0,1,0,0,0,0,0,0,0,0,0,1,1,2,1,1,3,2,1,5,3,1,5,3,3,6,4,7,7,8,13,8,13,16,8,16,
-12,5,13,3,1,4,0,0,0,0,0,0,0,1,1,0,2,1,1,1,1,2,2,7,3,3,11,2,2,4,0,0,0,0,0,0,1,1,3,3,3,11,3,3,13,2,2,7,
-4,5,19,9,9,34,9,9,37,7,7,32,7,7,32,13,13,51,17,20,67,13,16,50,20,9,32,38,15,50,31,20,58,16,21,61,20,25,78,18,19,71,7,7,34,3,1,6,
-1,0,1,0,0,0,0,0,0,0,0,0,1,0,1,23,7,30,41,12,48,25,7,25,22,6,21,43,11,39,27,8,27,12,4,15,50,14,47,74,21,68,74,20,66,73,19,50,
-82,22,45,84,23,61,76,22,69,79,22,75,40,11,40,26,10,15,53,26,34,96,39,66,124,49,91,125,55,94,135,67,101,151,98,112,129,97,80,143,75,79,167,87,92,173,121,93,
-160,117,78,155,98,94,158,84,107,151,98,85,170,139,86,180,119,87,145,80,66,106,88,40,144,112,58,167,111,70,135,90,56,73,56,22,98,67,39,146,77,65,126,67,54,124,94,46,
-75,64,20,37,30,8,24,18,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,6,16,
-98,25,92,139,41,147,124,37,127,75,23,74,116,34,115,155,43,152,147,47,134,141,65,98,151,57,130,166,96,170,172,146,175,158,141,159,144,139,156,103,84,117,129,78,109,182,172,160,
-155,186,147,87,137,110,78,90,99,125,133,114,126,174,123,104,163,101,83,137,90,73,127,78,87,136,61,103,132,37,102,124,30,71,92,22,59,81,19,81,111,27,83,111,28,86,107,27,
-82,99,25,65,78,19,46,63,15,35,56,13,40,68,16,39,65,16,11,15,4,0,0,0,16,21,4,47,59,14,80,86,23,71,79,21,36,44,11,25,26,7,45,44,11,47,45,12,
-33,29,8,32,33,11,33,38,12,28,28,8,28,26,7,19,18,4,3,3,0,6,4,1,11,6,3,10,3,2,7,1,1,4,2,1,6,6,2,7,6,2,5,5,1,9,9,2,
-15,15,4,9,9,3,1,1,0,0,0,0,0,0,0,3,3,1,10,10,2,13,13,4,9,9,3,1,1,1,0,0,0,4,4,1,11,10,3,15,14,4,14,12,3,8,7,2,
-3,2,1,0,0,0,0,0,0,0,0,0,1,1,0,4,4,1,8,7,2,11,11,3,13,12,3,14,13,4,15,15,4,16,15,4,16,15,4,17,16,6,16,15,8,16,15,10,
-14,14,12,12,12,10,9,10,9,7,9,8,6,8,9,6,8,11,6,8,12,5,9,12,5,9,12,5,8,12,5,9,12,6,9,12,6,9,12,5,9,13,5,9,13,5,9,13,
-6,9,13,8,8,12,8,7,11,7,5,9,7,4,9,6,4,8,6,3,8,7,3,8,8,4,10,9,4,10,11,4,9,11,5,6,12,6,5,13,6,5,13,6,5,11,6,5,
-8,6,4,5,6,4,4,5,4,2,5,2,2,4,1,1,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,1,3,2,1,4,2,2,5,3,8,7,8,
-11,7,11,5,5,5,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,2,2,8,3,3,13,2,2,6,0,0,0,0,0,0,0,0,1,2,2,9,5,5,19,
-6,9,24,7,10,29,9,10,38,9,9,37,7,7,33,7,7,31,13,13,50,19,22,69,14,18,52,13,7,27,20,11,37,19,18,50,16,20,62,19,23,74,14,15,58,5,5,26,
-0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,2,1,3,22,7,33,18,7,30,0,1,3,15,4,12,25,7,24,6,3,9,19,6,20,55,16,52,66,18,60,67,18,57,
-70,19,45,66,18,40,61,16,51,69,19,64,67,19,65,28,8,25,33,15,18,64,30,43,110,44,77,123,53,92,120,57,88,136,74,98,129,98,80,125,86,70,155,74,85,173,103,94,
-169,123,88,153,104,77,159,91,101,156,84,99,153,116,80,177,138,88,173,105,82,145,101,59,131,114,48,164,122,67,165,112,70,106,73,41,86,69,25,135,87,59,139,71,62,137,89,55,
-134,110,44,69,57,17,43,33,12,10,8,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,1,3,55,12,45,
-118,34,125,142,43,149,91,28,93,87,26,84,147,41,145,151,42,147,127,56,105,133,58,107,160,73,160,172,131,177,165,143,166,152,141,158,124,127,147,110,73,109,169,142,146,172,189,161,
-113,162,126,71,106,108,118,127,123,148,174,146,124,173,122,94,149,98,74,127,81,83,135,69,101,136,43,103,124,30,70,81,19,45,58,13,77,104,26,80,110,28,67,95,23,75,100,24,
-67,82,20,46,62,15,28,43,10,29,52,12,41,69,17,21,32,8,0,0,0,6,10,2,30,44,10,65,75,20,72,81,23,40,49,13,20,21,6,32,32,7,44,42,11,33,30,9,
-31,32,10,32,37,12,26,25,8,26,25,6,19,18,4,5,5,1,5,5,1,10,5,3,12,3,3,9,2,2,8,3,1,10,7,2,8,6,2,7,6,2,12,12,3,15,15,4,
-6,6,2,0,0,0,0,0,0,0,0,0,6,6,2,12,12,3,9,9,3,2,2,1,0,0,0,0,0,0,6,5,2,14,12,3,15,13,4,9,8,2,3,3,1,0,0,0,
-0,0,0,0,0,0,2,2,0,5,5,2,10,9,3,13,12,3,13,12,3,12,10,3,10,9,3,11,12,3,13,13,4,13,13,3,11,11,3,9,9,6,7,7,6,5,5,4,
-3,3,3,1,3,2,2,5,4,4,7,9,5,9,10,6,10,12,8,11,12,9,12,13,11,12,13,11,12,14,11,13,14,11,13,14,11,13,13,9,11,13,8,10,13,8,10,13,
-8,10,13,9,9,12,8,7,10,6,4,7,5,3,6,6,3,5,6,2,4,5,2,3,6,3,4,5,3,5,5,2,6,4,3,3,4,2,2,6,3,3,9,4,3,11,5,4,
-13,6,5,13,6,5,11,6,5,8,6,4,4,6,4,3,5,2,3,5,2,2,4,2,2,3,1,0,1,0,0,0,0,0,0,0,0,0,0,0,2,1,1,3,2,1,4,2,
-2,5,3,2,4,2,2,3,1,2,3,1,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,6,3,3,12,2,2,9,0,0,1,0,0,0,0,0,0,2,2,8,
-6,7,22,7,11,30,8,11,34,9,10,39,9,9,37,7,7,32,7,7,32,15,16,55,20,25,72,13,18,51,6,5,22,17,10,34,19,17,50,16,20,61,17,20,67,13,13,53,
-4,4,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,5,3,3,14,0,1,1,0,0,0,4,1,3,1,1,1,1,0,1,29,8,28,61,17,57,65,18,59,
-60,17,48,32,9,26,31,8,27,41,12,39,50,14,47,47,13,45,23,7,17,24,16,16,68,32,45,111,47,76,105,52,75,106,56,71,129,84,84,121,96,67,138,79,76,162,81,88,
-172,114,92,154,115,75,139,92,77,157,86,104,150,89,86,163,132,82,180,125,87,165,101,75,140,118,53,157,138,60,175,130,72,142,97,61,101,78,34,116,85,43,145,77,64,133,68,56,
-152,117,57,108,89,33,57,43,17,30,23,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,4,12,90,24,91,
-142,42,149,118,35,121,73,22,74,124,36,123,155,41,151,132,46,123,106,57,88,139,54,136,170,108,175,171,150,174,152,142,158,137,138,159,111,108,139,149,121,140,183,183,173,133,177,147,
-75,125,116,96,112,116,146,163,145,145,179,149,114,161,121,74,126,86,65,117,67,90,131,53,104,128,33,81,94,22,37,41,9,61,80,19,83,115,29,66,95,24,53,86,21,48,72,17,
-42,62,14,21,33,8,10,16,3,26,44,10,22,35,9,1,1,0,4,6,2,23,37,9,50,63,16,64,73,20,43,53,14,22,23,6,30,29,7,43,42,11,34,30,9,31,32,10,
-34,38,12,24,23,8,13,11,3,13,12,3,8,7,2,9,9,2,12,7,3,12,3,3,9,2,3,7,4,2,10,7,3,9,7,2,7,6,2,14,14,3,14,14,4,4,4,1,
-0,0,0,0,0,0,2,1,1,9,9,2,12,12,3,6,6,2,0,0,0,0,0,0,0,0,0,0,0,0,5,4,1,9,8,2,4,4,1,0,0,0,0,0,0,0,0,0,
-2,2,1,6,6,2,11,10,3,13,12,3,13,12,3,11,10,3,7,7,2,4,3,1,2,2,0,5,5,1,6,6,1,5,5,1,2,2,1,1,1,1,1,3,2,3,4,2,
-4,4,1,5,6,3,8,9,6,11,11,11,12,13,12,13,13,12,14,13,12,14,13,13,14,13,14,14,13,14,14,13,14,14,13,13,14,13,13,13,12,13,13,12,13,12,12,13,
-12,12,13,12,11,12,10,10,11,8,8,9,7,6,8,6,4,8,4,3,6,2,1,2,2,0,0,3,0,0,4,1,1,5,1,1,5,1,1,5,1,1,4,1,0,3,1,1,
-5,2,2,8,3,3,11,4,4,13,5,5,10,6,5,6,5,4,3,5,3,3,5,3,3,5,3,3,5,2,2,4,1,1,2,0,1,1,0,0,0,0,0,2,1,1,3,1,
-1,2,1,0,2,1,0,1,0,1,2,1,2,3,1,2,3,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,3,3,3,11,4,4,15,2,2,7,0,0,0,0,0,0,
-2,1,6,5,6,21,7,10,30,10,13,37,11,11,42,10,9,37,9,9,35,10,11,43,16,19,59,20,26,71,12,17,49,7,5,21,13,10,31,12,16,44,15,20,61,17,19,66,
-12,12,50,4,4,18,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,2,4,41,11,39,66,19,60,
-55,20,49,15,8,15,8,2,7,28,7,25,27,7,27,49,13,44,37,9,36,2,3,6,23,18,17,76,34,44,89,44,54,87,47,54,112,63,72,128,95,77,122,91,67,139,71,78,
-158,90,87,161,118,82,133,102,64,144,88,90,156,79,100,153,108,80,176,140,87,175,110,84,156,108,67,148,138,55,179,149,71,169,121,71,125,88,51,110,91,37,135,90,57,140,69,62,
-137,90,57,144,117,53,76,61,22,42,31,11,11,9,2,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,43,11,42,122,36,130,
-143,42,147,83,32,91,78,32,88,138,37,138,154,53,146,107,72,94,102,59,95,154,79,162,174,138,178,161,155,169,133,148,160,115,128,151,130,115,141,182,171,173,169,189,175,95,152,140,
-79,115,119,138,152,136,154,182,155,127,169,134,82,137,95,55,110,72,66,107,51,94,120,34,93,110,26,49,54,13,47,61,14,83,113,28,71,101,25,53,85,20,46,76,18,35,53,12,
-26,44,10,6,10,2,10,18,4,16,26,6,2,2,1,2,2,1,19,30,7,44,58,15,61,71,19,42,53,14,22,25,6,28,26,7,43,42,11,33,29,8,23,19,7,30,32,11,
-26,25,8,13,9,3,6,5,1,6,6,1,11,9,3,15,9,4,13,5,3,9,2,3,8,3,2,10,7,3,10,7,3,5,4,1,4,5,1,9,9,2,3,3,1,0,0,0,
-0,0,0,0,0,0,4,4,1,8,8,3,3,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,5,5,2,
-8,7,2,9,9,2,11,10,3,10,9,3,7,6,2,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,7,6,2,8,8,2,
-8,8,3,9,9,4,10,10,7,12,12,10,13,13,11,14,13,12,14,13,11,13,13,11,13,12,10,12,11,9,12,11,9,12,10,8,12,10,8,12,10,7,12,9,7,12,9,7,
-12,10,7,12,10,7,11,10,7,9,9,5,8,7,4,5,4,4,2,2,2,0,1,1,0,0,0,0,0,0,0,1,0,1,0,0,2,1,1,3,1,1,5,2,1,5,2,1,
-2,1,0,0,0,0,2,0,1,5,2,1,6,2,2,5,3,2,2,4,2,2,5,3,3,5,3,3,5,3,3,5,3,3,5,2,2,3,1,1,2,0,0,1,1,0,1,0,
-0,2,1,0,2,1,0,1,1,0,0,0,1,1,0,2,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,4,4,14,5,5,22,3,3,10,0,0,0,
-0,0,0,1,1,4,5,6,21,10,15,38,12,19,44,11,13,43,10,10,40,11,11,46,12,12,46,15,18,56,18,24,67,11,15,46,3,3,16,5,8,22,11,15,44,16,21,64,
-16,18,63,10,10,42,2,2,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,3,11,52,14,48,
-65,20,59,35,15,31,1,2,0,14,3,11,19,5,18,28,7,26,53,14,48,22,6,24,0,6,3,41,23,25,79,36,43,82,44,50,96,51,60,121,75,77,119,96,66,109,74,63,
-131,67,75,159,105,84,150,117,70,133,93,70,156,86,99,154,94,83,165,135,81,179,127,88,167,101,78,149,123,59,165,151,62,181,140,74,154,112,65,126,110,45,123,97,43,145,82,65,
-133,69,58,150,114,59,114,93,35,49,38,14,37,29,10,14,12,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,55,18,70,138,41,143,
-119,37,122,66,50,90,102,64,127,143,44,143,140,85,126,93,99,79,124,79,130,167,114,175,170,153,173,149,159,171,122,141,165,112,111,140,164,147,159,187,189,184,140,175,166,81,126,134,
-117,136,126,158,180,153,139,176,143,100,150,109,60,117,78,55,103,59,80,109,38,96,115,28,66,74,17,34,41,9,71,100,25,73,105,26,48,74,17,40,70,17,35,54,13,32,51,12,
-9,14,3,6,10,3,17,28,6,4,6,1,0,0,0,13,22,5,29,46,11,51,62,16,46,58,15,21,26,7,22,22,5,43,42,11,36,33,9,18,11,5,18,10,6,20,16,6,
-14,11,4,7,6,1,6,5,1,11,10,3,15,9,4,15,6,4,12,3,3,8,3,2,10,7,2,10,7,2,7,6,1,4,4,1,1,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,4,4,1,8,7,2,7,6,2,
-3,3,1,1,1,0,3,3,1,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,0,5,6,2,8,8,5,9,9,5,
-9,9,6,8,9,7,9,9,8,10,9,8,10,9,9,9,9,8,9,9,8,8,9,7,7,8,7,7,8,7,9,8,7,9,7,7,9,7,7,8,7,7,8,5,4,8,4,2,
-8,5,2,8,5,2,8,5,2,7,5,2,7,4,2,5,3,1,3,1,0,2,1,1,1,2,1,0,2,1,0,1,1,0,1,1,0,1,1,0,2,1,1,2,1,2,2,1,
-1,2,1,0,2,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,1,2,4,3,2,5,3,2,5,2,2,4,2,3,4,1,2,4,1,0,1,0,
-0,0,0,0,1,1,0,2,1,0,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,3,12,5,5,22,3,3,11,
-0,0,0,0,0,0,1,1,5,6,10,28,12,20,45,12,21,47,12,13,45,11,11,44,11,11,47,11,11,45,14,18,54,17,23,66,11,13,42,3,3,14,6,8,25,13,18,50,
-16,22,63,13,15,54,4,3,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,6,22,
-60,17,56,58,20,53,20,10,17,0,1,0,4,1,3,5,1,3,41,10,35,47,13,44,9,3,12,10,12,10,61,30,34,82,41,46,86,47,54,105,57,67,126,91,77,107,89,58,
-109,62,64,143,80,78,160,118,81,138,106,66,132,84,75,144,82,77,156,115,74,174,141,87,176,112,84,156,106,68,152,137,57,178,151,71,174,130,73,142,116,58,122,107,41,134,90,55,
-140,70,63,138,91,58,146,118,53,68,55,20,50,40,15,40,33,10,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,4,18,85,27,100,127,36,123,
-83,38,90,73,76,114,130,76,154,148,61,142,111,104,89,105,101,97,151,99,164,174,143,180,162,167,176,134,155,171,117,126,156,139,122,146,186,178,179,168,187,181,105,154,157,94,126,130,
-151,167,143,146,178,151,109,153,122,68,123,86,53,106,63,64,103,44,86,109,27,82,96,23,36,40,9,45,70,16,62,100,25,43,63,16,25,40,9,27,43,10,32,49,11,17,29,6,
-4,7,2,15,25,6,8,13,3,0,0,0,10,16,3,23,40,9,35,49,12,40,53,14,25,32,8,17,17,4,39,38,9,39,37,10,19,14,5,13,5,3,13,7,3,13,10,3,
-8,6,2,6,5,1,11,9,3,15,10,4,15,6,4,13,3,4,9,3,3,11,7,3,10,7,2,7,6,1,6,5,1,5,4,1,1,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,6,6,1,8,7,2,4,4,1,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,3,3,1,6,6,4,7,8,5,8,8,6,8,8,7,7,8,7,
-6,8,8,6,7,9,5,6,9,5,7,9,4,6,8,2,6,7,2,5,7,2,5,7,2,5,7,3,6,8,5,7,9,6,7,9,6,7,9,5,7,8,5,5,6,4,3,4,
-4,3,4,5,3,4,5,3,4,5,3,4,6,3,4,6,3,4,6,3,3,6,3,3,5,4,2,3,4,1,2,2,1,1,2,1,1,1,1,0,2,1,0,2,1,0,2,1,
-0,2,1,1,2,1,1,3,1,1,3,2,0,2,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,1,1,3,2,3,4,2,2,4,2,2,4,1,
-0,1,0,0,0,0,0,1,0,0,1,1,0,2,1,0,2,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,2,5,1,1,3,0,0,0,3,3,9,5,5,22,
-3,3,13,0,0,0,0,0,0,1,1,5,8,10,30,12,21,44,14,23,50,13,16,49,13,12,48,12,12,47,11,11,44,14,18,53,17,22,63,9,12,38,3,3,13,8,11,31,
-13,21,55,14,21,58,6,8,26,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,2,
-39,10,36,63,18,59,49,18,44,9,6,7,0,1,0,1,4,0,18,7,14,51,14,44,34,9,34,1,3,6,31,22,19,77,39,41,88,46,53,91,49,56,119,71,76,121,96,69,
-103,75,58,111,60,66,149,98,77,153,121,74,126,91,61,134,77,72,150,91,72,165,132,80,174,128,84,163,100,75,149,120,59,165,150,63,183,142,76,160,121,68,134,117,48,130,108,46,
-150,93,65,138,80,60,147,114,57,113,93,36,72,56,21,67,52,20,19,16,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,15,59,116,34,119,109,34,100,
-65,53,89,100,82,137,143,55,149,135,84,119,94,111,75,131,96,140,169,120,178,171,164,181,150,174,183,120,147,166,118,113,143,168,150,163,189,191,190,137,176,173,87,141,148,129,152,143,
-156,179,161,117,156,133,72,123,95,50,105,70,52,98,49,63,94,29,76,97,23,46,51,12,36,51,12,58,97,23,49,78,18,22,34,8,16,25,6,26,41,9,26,41,10,4,6,1,
-14,23,5,13,23,5,0,1,0,4,7,2,20,35,8,30,46,11,36,50,12,28,38,10,16,16,4,34,35,8,41,40,10,22,17,6,13,5,3,11,6,2,11,10,3,11,7,3,
-8,5,2,10,9,2,15,10,4,15,6,4,14,3,4,9,3,2,10,7,3,10,8,3,7,6,1,6,6,1,6,4,1,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,4,4,1,1,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,6,6,1,8,8,5,8,8,7,7,7,6,6,5,6,4,4,6,3,5,7,
-3,6,9,3,5,9,2,5,8,2,5,8,3,5,7,4,5,7,4,5,7,5,5,7,5,5,7,6,5,7,5,5,7,5,5,7,5,5,7,5,5,7,5,4,6,4,2,5,
-4,2,5,4,2,5,3,2,4,2,2,2,3,3,3,4,4,4,5,3,4,6,4,4,5,3,2,4,3,1,4,3,1,4,3,1,4,3,1,3,2,1,2,2,1,1,2,1,
-0,1,1,1,1,1,1,3,1,2,3,2,2,3,2,2,3,2,1,3,2,1,2,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,1,2,1,2,3,2,2,4,2,
-2,3,1,1,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,2,1,0,1,1,0,1,0,0,0,0,0,0,1,3,5,11,3,5,13,1,1,4,0,0,0,2,2,8,
-6,7,24,5,5,17,0,0,2,0,0,0,1,1,5,6,9,24,12,22,44,14,25,54,15,17,53,13,12,50,12,12,47,11,11,42,14,18,52,16,22,62,7,9,31,3,3,14,
-7,12,31,12,19,48,10,16,41,3,3,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-11,2,9,51,14,46,66,19,61,34,16,30,3,5,2,3,8,1,7,12,3,31,12,24,40,10,38,7,2,11,6,8,5,55,32,30,81,43,44,83,47,51,104,57,66,128,88,80,
-113,93,61,99,59,57,119,70,66,158,116,78,142,111,66,126,81,64,143,80,73,158,114,73,169,139,82,167,113,77,157,112,68,150,138,57,179,151,71,174,129,73,143,116,58,138,127,45,
-157,126,61,147,88,63,136,93,57,154,127,54,105,84,31,73,56,22,39,30,10,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,5,23,75,26,95,116,31,113,83,39,87,
-74,74,113,125,69,147,147,59,141,108,105,86,106,104,103,158,105,179,175,146,182,163,175,184,140,168,185,118,126,159,141,114,152,186,174,182,168,186,185,104,159,163,104,145,145,155,175,159,
-138,171,153,86,131,111,51,105,77,52,103,62,54,93,40,45,77,17,34,49,11,20,26,5,48,80,19,55,92,22,31,47,11,17,29,6,18,30,7,26,44,10,8,12,3,8,12,3,
-15,25,6,3,5,1,0,0,0,6,11,2,22,36,8,35,49,12,32,44,11,17,19,5,28,28,6,44,43,11,27,23,7,14,6,3,12,5,2,11,10,3,11,8,3,8,6,2,
-9,9,2,14,10,4,15,7,4,14,3,4,9,2,2,9,6,2,11,8,3,9,6,2,7,6,2,6,4,1,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,
-1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,3,2,6,6,4,5,4,5,4,3,5,2,2,4,1,1,3,0,1,2,1,2,3,
-2,4,6,2,5,6,1,5,5,1,4,5,4,5,7,6,5,7,6,5,7,6,5,7,6,5,7,6,3,6,5,3,5,5,3,6,5,2,5,5,2,4,4,2,4,4,2,5,
-5,2,5,5,2,5,4,2,3,2,0,0,2,0,0,2,0,0,2,0,1,2,1,1,3,1,1,3,1,1,4,1,1,4,2,1,4,2,1,4,3,1,4,3,1,4,3,1,
-3,3,1,2,2,1,2,2,1,1,2,1,1,3,1,2,3,2,2,3,2,2,3,1,2,3,1,1,2,1,0,2,1,0,1,1,0,0,0,0,0,0,0,0,0,1,1,0,
-2,2,1,2,3,1,1,2,1,1,1,0,0,0,0,0,0,0,0,1,1,0,2,1,0,2,1,0,0,0,0,0,0,1,2,6,3,6,14,4,6,14,1,2,5,0,0,0,
-4,4,13,8,10,31,5,5,19,0,0,2,0,0,1,2,2,8,6,9,26,12,22,45,15,25,54,14,16,53,13,12,50,12,12,47,10,11,41,15,19,56,15,21,58,5,7,25,
-1,2,5,4,5,17,10,16,42,8,13,34,2,2,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,
-0,0,0,25,6,22,62,17,57,56,19,52,18,12,16,4,10,1,8,16,3,14,14,7,10,4,9,3,1,4,0,2,0,24,21,15,56,35,32,61,40,39,79,45,49,114,68,71,
-121,96,67,103,76,53,92,51,56,132,91,68,154,121,73,127,89,58,132,74,68,150,90,72,164,131,78,174,140,81,169,117,76,149,121,61,164,148,62,179,140,72,154,119,64,143,128,51,
-153,134,54,158,110,67,136,79,59,157,123,61,124,100,43,82,64,26,57,44,17,12,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,40,15,60,91,27,103,103,37,100,63,58,89,
-98,82,136,135,54,145,121,77,108,94,111,73,135,100,153,169,123,188,169,169,184,151,179,187,132,153,178,129,116,158,170,143,173,188,185,193,138,176,178,88,145,151,136,159,149,152,179,159,
-116,153,136,78,120,106,55,105,77,56,101,50,46,82,24,33,59,12,11,16,3,25,43,10,44,77,18,35,55,13,19,29,6,16,26,5,18,29,7,9,14,3,3,5,1,16,28,6,
-7,11,3,0,0,0,0,0,0,4,6,1,25,35,9,33,47,12,20,24,6,9,9,2,31,31,8,29,27,7,14,9,3,11,3,2,10,7,3,12,10,3,9,6,3,8,7,2,
-13,10,4,15,8,4,15,4,4,10,2,2,7,3,2,10,6,2,10,6,2,9,6,2,6,5,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,2,1,3,
-1,1,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,3,3,2,4,3,2,4,1,1,3,0,1,1,0,1,1,0,0,0,0,1,1,1,2,2,
-2,4,4,2,4,5,2,4,5,2,4,5,4,4,6,5,4,7,5,4,6,4,3,6,4,3,7,4,3,6,4,2,5,3,2,5,3,2,4,3,3,1,4,3,1,4,3,2,
-5,3,2,6,3,2,6,3,2,6,3,1,5,3,1,4,2,1,4,2,1,3,1,1,2,1,0,2,1,1,2,0,0,2,0,1,3,0,0,3,1,1,3,1,1,4,2,1,
-4,3,1,4,3,1,4,3,1,3,3,1,2,3,1,1,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,1,3,1,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,1,2,1,2,3,1,2,3,1,1,2,1,0,0,0,0,0,0,1,1,2,2,3,6,1,2,3,0,1,0,0,0,0,1,1,4,3,5,13,4,6,15,1,2,5,
-0,0,2,4,6,17,8,11,31,5,6,21,3,5,13,4,9,17,4,7,19,7,10,28,12,23,47,15,23,54,13,14,50,12,12,47,11,11,45,10,12,42,14,20,56,12,17,47,
-3,4,13,0,0,0,5,7,22,10,17,45,7,9,26,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,2,
-2,6,1,4,1,3,42,11,37,65,18,60,42,16,39,8,9,6,7,13,2,8,16,3,5,8,2,0,1,1,3,6,1,7,14,5,18,26,16,20,28,22,43,34,31,90,51,52,
-111,80,60,111,91,54,69,49,44,79,58,51,141,110,69,143,109,63,123,73,56,139,75,70,155,108,73,164,136,78,170,124,76,158,113,68,148,138,55,169,146,64,154,124,60,142,123,53,
-158,144,54,166,133,66,145,86,62,146,105,59,150,125,57,101,79,33,71,53,22,26,19,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,5,21,64,21,85,104,45,112,90,78,101,74,95,118,
-121,73,147,125,50,126,81,97,68,101,112,111,156,113,184,164,149,186,148,181,184,139,171,186,129,135,171,151,135,169,190,178,193,179,189,195,117,167,174,107,147,146,150,170,156,130,163,148,
-108,142,136,85,120,114,60,103,74,43,81,29,34,66,14,21,33,7,15,23,5,36,65,15,33,58,13,21,33,7,17,29,6,19,32,6,12,18,4,1,1,0,13,21,5,12,20,5,
-1,1,0,0,0,0,0,0,0,12,17,4,31,45,11,26,33,9,7,6,1,8,7,2,18,16,5,13,11,3,7,3,1,5,3,2,9,8,3,10,7,3,8,6,2,12,10,3,
-15,8,4,15,4,4,10,2,3,7,3,1,9,6,2,10,6,2,9,6,2,6,5,2,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,2,0,1,1,0,0,0,0,0,0,0,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,3,2,1,3,1,1,2,
-1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,3,2,1,3,1,1,2,0,1,1,0,0,0,0,1,1,1,1,2,1,1,3,1,3,4,2,3,5,
-3,3,5,3,3,6,4,4,6,4,4,6,4,4,6,4,4,7,4,4,6,5,4,6,4,4,6,4,4,6,4,2,5,4,2,4,4,2,2,5,3,1,5,3,1,5,3,1,
-5,3,1,5,3,1,5,3,1,5,3,1,5,4,1,6,4,1,6,4,1,6,3,1,5,3,1,5,3,1,4,2,1,3,1,1,2,0,0,2,1,1,2,0,0,3,0,0,
-3,1,1,3,2,1,3,2,1,3,3,1,4,3,1,2,2,1,1,1,1,1,3,1,2,3,1,2,3,1,2,3,1,2,3,1,1,2,1,1,2,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,1,1,1,1,2,1,1,1,0,1,1,0,0,0,1,2,2,6,2,4,8,1,3,4,0,1,1,0,0,0,1,1,4,4,5,13,3,6,14,
-2,2,6,1,1,4,5,6,18,8,11,32,7,10,27,6,12,25,7,13,26,5,7,20,8,12,30,13,25,48,14,21,52,12,13,47,12,12,48,11,11,44,9,12,38,13,20,50,
-10,13,39,2,2,7,0,0,1,7,10,30,10,16,43,4,5,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,0,
-5,8,2,1,4,0,16,4,13,57,15,50,61,18,56,25,12,24,4,8,1,9,16,4,9,15,3,3,5,1,5,8,2,9,16,4,13,23,9,11,25,14,19,28,22,68,42,40,
-99,63,54,115,94,59,81,69,43,42,37,36,109,84,55,152,119,69,122,86,53,115,62,55,145,80,66,157,120,74,169,130,75,167,114,72,154,130,61,158,150,54,154,130,57,140,119,51,
-164,151,57,175,155,63,161,113,70,137,89,58,156,132,61,132,108,46,80,61,24,51,37,16,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,4,23,8,36,72,27,80,109,82,118,80,109,112,100,112,146,
-130,63,147,106,74,101,69,111,68,118,122,157,164,145,195,152,170,183,139,181,186,126,151,176,122,126,162,167,163,181,194,191,200,152,182,188,97,152,158,134,157,149,137,166,154,110,146,139,
-102,132,133,78,112,102,46,83,49,20,39,10,19,38,8,10,15,3,29,49,11,36,66,15,24,39,8,18,31,7,17,27,6,15,26,5,2,3,0,7,11,3,16,26,6,3,5,1,
-0,0,0,0,0,0,4,6,2,23,36,8,27,40,10,10,12,3,5,4,1,11,9,3,11,9,3,4,3,1,2,1,0,7,7,2,10,8,2,8,6,2,9,7,2,14,8,4,
-15,5,4,12,3,3,7,2,1,9,6,2,10,6,2,10,6,2,8,5,2,3,3,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,
-3,3,1,2,2,0,0,1,0,1,0,1,2,0,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,2,1,3,2,1,3,1,1,2,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,1,2,2,1,2,3,1,2,3,2,3,4,3,4,6,
-4,4,7,4,4,7,4,5,7,4,5,6,4,4,6,5,4,6,5,4,6,5,4,6,5,4,6,4,3,4,3,2,3,4,1,2,4,1,2,4,2,2,4,2,2,4,2,2,
-4,2,2,4,2,2,4,2,2,2,2,2,2,2,2,3,2,2,4,2,1,4,3,1,5,3,1,5,3,1,4,2,1,4,1,1,4,1,1,3,1,1,1,0,0,0,0,0,
-1,0,0,1,1,0,1,1,0,1,1,0,2,2,1,2,1,1,0,0,0,1,1,1,1,2,1,1,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,1,2,1,
-0,1,0,0,0,0,0,0,0,1,0,0,1,1,0,1,2,0,1,2,0,0,1,0,0,0,0,1,2,5,2,3,9,1,3,4,0,2,1,0,0,0,1,1,3,3,5,13,
-5,7,17,4,5,13,2,3,10,5,6,19,9,11,32,8,12,31,7,14,27,6,12,25,4,6,20,8,13,33,15,26,51,15,22,54,12,13,48,11,11,44,8,8,34,9,12,37,
-13,19,52,8,10,30,0,0,2,2,2,7,10,14,39,9,13,37,2,2,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,4,2,4,7,1,2,3,1,35,9,28,66,18,60,49,17,47,11,9,11,7,12,2,10,17,4,7,12,3,4,5,1,8,15,3,12,20,6,14,26,14,11,26,16,41,36,30,
-89,54,47,110,80,59,109,90,52,54,43,35,66,54,41,143,111,66,140,108,63,108,66,48,130,65,61,153,101,70,163,128,73,170,118,73,167,126,71,160,150,55,167,150,59,148,125,54,
-154,141,56,181,167,63,175,142,70,146,94,61,158,131,63,163,139,60,97,75,31,70,52,21,32,24,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,5,17,34,9,42,90,53,92,100,121,118,79,128,130,124,115,167,
-129,84,148,82,100,74,71,118,93,132,137,180,158,160,187,144,180,184,136,170,186,109,130,163,122,133,158,183,180,191,179,188,197,116,166,173,108,148,145,146,166,155,118,154,144,99,134,134,
-86,113,119,54,94,73,16,36,15,4,6,0,3,6,1,19,30,6,36,65,15,32,54,12,19,31,7,13,22,7,13,23,6,7,12,3,2,2,1,15,27,6,8,15,4,0,0,0,
-0,0,0,0,0,0,8,13,4,18,33,8,11,17,4,2,2,0,9,8,2,12,10,3,7,6,1,1,1,0,5,5,1,10,8,2,9,6,2,7,7,2,12,7,3,15,5,5,
-13,3,4,7,2,2,8,5,2,10,6,2,10,6,2,8,6,2,7,3,2,2,1,0,2,0,0,3,1,1,2,1,1,0,0,0,0,0,0,0,0,0,1,2,1,3,3,1,
-3,3,1,1,1,0,1,0,1,2,0,2,1,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,2,2,1,3,2,1,3,1,1,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,3,1,3,4,2,4,6,3,5,7,
-3,5,7,3,4,6,2,4,6,1,4,5,2,4,5,3,4,4,3,3,4,2,3,3,2,3,3,2,2,2,1,1,1,1,0,0,1,0,1,2,0,1,2,0,2,2,0,2,
-3,0,2,3,0,2,2,0,2,2,0,2,2,0,2,2,1,2,3,1,2,4,2,3,4,2,2,4,2,1,3,2,1,2,1,0,2,1,1,3,1,1,2,1,1,2,1,1,
-1,0,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,2,1,1,3,1,2,3,1,2,3,1,2,3,1,2,3,1,
-2,3,1,1,1,1,0,0,0,0,1,0,1,2,1,2,2,1,2,2,1,1,2,0,1,1,0,0,0,0,1,2,5,2,3,9,1,2,3,0,0,0,0,0,0,1,1,4,
-4,6,14,6,11,24,5,9,20,3,4,13,6,7,23,9,11,33,7,12,29,7,14,29,5,11,25,5,6,20,10,17,39,16,29,55,15,21,53,10,9,40,8,7,32,6,6,26,
-10,15,41,12,16,47,2,3,11,0,0,0,5,5,17,10,17,44,7,10,27,1,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,4,6,2,2,6,0,11,3,8,48,12,42,49,14,47,22,11,22,5,9,2,9,15,3,10,16,4,4,7,1,5,7,2,10,18,4,13,22,8,12,26,13,21,31,22,
-70,47,41,100,65,55,116,94,59,83,66,42,44,35,34,110,86,54,152,119,68,121,85,53,114,59,54,135,79,61,151,119,69,170,127,75,174,124,76,166,145,66,168,158,57,159,136,57,
-143,125,52,176,163,66,178,154,68,160,113,66,153,120,63,175,154,66,125,102,44,84,64,25,59,45,17,5,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,2,8,20,7,31,56,18,61,107,90,112,85,136,122,93,130,150,137,111,173,
-118,101,129,63,108,59,91,119,128,142,147,185,144,172,179,139,182,186,125,155,178,100,126,155,151,153,175,188,180,197,149,180,188,98,151,159,134,158,153,137,165,153,105,141,137,85,115,127,
-62,90,97,24,58,36,2,5,10,1,0,6,6,8,2,31,54,12,34,63,15,25,39,9,21,33,25,10,13,26,3,5,5,0,0,0,10,18,4,14,25,5,1,2,0,0,0,0,
-0,0,0,0,0,0,4,6,1,6,11,3,1,1,1,5,4,1,11,9,3,9,8,3,2,2,0,3,3,1,9,7,2,10,6,2,8,6,2,10,7,2,15,6,4,15,4,7,
-10,3,4,7,3,2,10,6,2,10,6,2,9,6,2,7,4,2,5,2,1,3,1,1,5,1,1,4,1,1,1,0,0,0,0,0,0,0,0,1,2,1,3,3,1,3,3,1,
-1,2,0,2,0,1,2,0,2,1,0,1,0,0,0,0,0,0,1,0,1,1,0,1,0,0,0,1,1,3,2,1,3,2,1,2,1,0,1,1,0,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,1,1,1,1,1,1,2,1,2,3,1,3,4,2,4,6,2,4,5,2,4,5,
-1,4,5,1,4,4,1,4,4,1,3,4,1,3,4,1,2,2,1,2,2,1,2,2,1,2,2,0,2,2,0,1,1,0,0,0,0,0,0,2,1,1,3,1,1,3,1,1,
-3,1,1,3,1,1,3,1,1,4,1,1,3,1,1,3,1,1,3,1,2,4,1,3,4,1,3,4,1,2,4,1,2,4,1,2,3,1,1,3,1,1,3,1,1,2,1,1,
-3,1,1,3,1,1,2,1,1,1,1,0,1,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,2,1,1,3,1,2,3,1,2,3,1,
-1,3,1,1,2,1,1,2,1,0,1,0,1,2,1,2,3,1,2,3,1,2,1,1,1,2,0,1,2,0,0,1,0,1,2,5,3,3,9,2,1,4,0,0,0,0,0,0,
-1,1,4,6,8,19,6,13,26,6,9,22,5,6,21,7,9,26,8,11,32,9,13,33,7,14,30,5,9,22,5,7,23,11,21,44,16,29,56,13,16,47,7,6,29,6,6,24,
-6,8,28,11,16,45,6,7,26,0,0,0,0,0,1,7,9,28,8,12,32,1,1,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,4,8,2,2,4,1,14,3,12,20,6,22,15,7,16,5,8,3,6,10,2,10,17,4,8,13,3,3,4,1,11,16,4,17,25,7,16,27,12,12,27,17,
-44,39,31,88,53,48,105,79,56,107,88,51,53,38,32,69,54,38,142,108,61,128,99,57,100,61,44,114,62,51,133,99,58,160,128,70,172,119,75,171,135,74,165,156,59,169,148,61,
-143,122,51,161,147,60,176,164,67,169,136,66,152,111,63,175,153,69,160,137,59,101,79,32,70,54,20,15,12,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,12,6,20,31,8,41,77,39,80,110,121,125,74,137,129,93,114,153,128,101,160,
-91,105,90,63,111,75,116,128,164,146,158,181,143,187,185,139,175,189,114,142,170,117,143,162,175,167,190,175,177,195,113,165,177,109,149,160,144,165,164,119,154,148,94,130,135,70,92,114,
-36,69,66,8,25,18,7,5,38,7,6,35,20,32,9,34,64,14,29,50,10,21,31,21,20,28,55,10,10,48,2,1,11,4,7,0,16,28,6,5,9,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,5,4,1,7,6,2,4,4,0,1,1,0,7,6,2,10,7,3,8,6,2,9,7,2,13,6,3,15,4,6,11,3,6,
-8,3,2,10,6,3,10,6,2,10,6,2,9,6,3,7,2,2,3,1,1,4,1,1,5,1,1,2,1,1,0,0,0,0,0,0,1,1,0,3,3,1,3,3,1,1,1,0,
-1,0,1,2,0,2,1,0,1,0,0,0,0,0,0,1,0,1,1,0,2,1,0,1,1,1,3,2,1,3,2,1,2,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,1,1,2,1,2,3,1,2,3,1,2,2,1,2,2,1,2,3,1,3,4,1,4,5,1,4,5,
-1,3,4,1,3,4,2,3,4,2,2,4,2,2,3,1,2,3,0,2,2,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,2,1,1,3,1,1,3,1,1,
-3,1,1,3,1,1,3,1,1,4,1,1,4,2,1,4,2,1,4,2,1,4,2,1,4,2,1,4,2,2,3,1,2,3,1,2,3,1,2,4,1,2,4,1,2,4,1,1,
-3,1,1,3,1,1,3,1,1,3,1,1,2,1,1,1,1,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,2,1,1,2,1,
-1,2,1,0,2,1,1,2,1,1,1,0,1,1,0,1,2,1,2,3,1,2,3,1,2,3,1,1,2,0,1,1,0,1,1,2,3,4,11,3,4,12,1,1,3,0,0,0,
-0,0,0,2,2,6,6,9,21,7,13,27,7,10,26,6,7,24,7,9,27,9,12,34,9,15,35,8,15,30,5,8,21,6,9,27,14,25,48,16,27,56,11,12,41,6,6,27,
-6,5,25,9,13,36,10,14,40,2,2,8,0,0,0,2,2,8,6,9,25,2,3,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,4,2,4,7,2,2,2,1,3,1,3,2,3,2,4,6,2,5,8,2,8,14,4,10,18,5,7,10,2,11,13,3,22,27,7,20,27,9,13,26,14,
-22,31,22,56,44,36,71,59,44,100,89,48,79,58,35,41,27,26,101,74,42,127,101,56,96,73,39,93,52,39,119,77,48,138,110,58,165,120,71,174,126,77,163,147,64,170,156,60,
-155,133,57,152,139,57,180,168,67,181,161,67,163,125,66,162,135,66,181,159,71,133,109,44,71,55,21,33,25,10,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,2,7,17,6,27,47,13,53,103,73,106,101,138,128,70,127,136,92,101,151,104,96,131,
-66,106,59,72,116,106,130,143,178,140,175,176,142,189,189,138,163,187,121,145,172,150,161,180,185,172,196,148,172,188,95,154,171,127,157,164,137,166,166,109,145,153,88,117,137,53,78,95,
-15,45,32,5,8,22,10,9,51,12,17,27,32,57,12,33,61,13,23,35,9,23,34,44,17,21,65,8,8,39,1,1,2,12,20,4,12,21,5,0,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,2,2,1,0,0,0,2,3,1,8,6,2,9,6,2,7,7,2,12,7,2,14,5,5,12,3,6,7,2,3,
-10,4,2,11,7,3,10,6,3,11,6,3,9,4,3,4,1,1,4,1,1,6,1,2,3,1,2,0,0,0,0,0,0,1,1,0,4,4,3,3,3,1,1,2,0,1,0,1,
-2,0,2,1,0,1,0,0,0,0,0,0,1,0,2,1,0,2,1,1,1,2,1,2,2,1,3,1,1,2,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,1,1,1,2,3,0,2,2,0,1,1,1,1,1,1,1,2,1,2,3,1,2,3,1,3,4,2,2,4,
-2,2,3,2,2,3,2,2,3,2,2,3,1,1,3,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,2,1,1,2,1,1,
-3,1,1,3,1,1,3,1,1,3,1,1,4,2,1,4,2,1,4,2,1,4,2,1,4,2,1,4,2,1,3,2,1,2,2,1,2,2,1,2,1,2,3,1,2,4,1,2,
-4,1,2,4,1,1,3,1,1,2,1,1,2,1,1,3,1,1,2,1,1,1,1,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,
-1,2,1,0,2,1,0,2,1,0,0,0,1,0,0,1,1,0,1,1,0,2,2,1,2,3,1,2,3,1,1,1,0,0,0,1,2,3,8,3,6,14,3,5,12,1,1,3,
-0,0,0,0,0,0,3,4,12,7,13,26,8,14,29,6,9,25,6,6,24,7,10,29,11,17,38,11,20,39,8,14,30,4,6,20,8,12,32,15,28,52,15,23,53,9,9,35,
-6,6,26,7,7,27,10,15,40,6,8,25,0,0,1,0,0,0,3,4,13,4,7,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,4,7,2,3,6,1,0,0,0,3,6,1,4,7,2,5,8,2,6,10,2,12,21,5,13,20,5,8,11,2,20,23,6,24,29,8,19,28,12,
-14,28,18,25,35,25,32,42,28,71,74,40,98,80,42,46,23,21,60,41,26,118,90,49,110,89,45,85,54,31,86,43,31,105,77,41,149,116,62,172,120,74,170,139,73,164,154,58,
-171,150,62,157,144,57,174,164,66,182,168,69,174,140,68,153,119,64,178,157,72,167,141,63,96,75,31,51,38,16,7,5,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,8,3,12,23,6,31,64,25,67,108,106,117,84,140,129,76,118,145,90,98,147,78,107,102,
-57,118,65,74,122,130,121,146,163,138,182,177,143,183,191,140,153,187,142,154,182,174,168,191,176,172,195,120,166,181,94,150,165,121,162,162,118,151,156,100,132,152,74,98,127,34,69,65,
-7,24,17,8,6,39,10,9,43,14,24,11,28,56,12,27,47,9,22,33,23,20,26,58,12,12,56,3,2,15,5,9,0,16,28,6,5,7,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,1,7,4,1,7,6,2,10,7,2,14,5,4,13,4,6,8,3,3,7,2,2,
-9,3,3,10,6,3,11,6,3,11,5,3,6,2,1,3,1,1,6,1,3,6,1,3,1,1,1,0,0,0,1,0,0,4,3,3,4,4,3,1,2,0,1,0,1,2,0,2,
-1,0,1,0,0,0,0,0,0,1,0,2,1,0,2,1,1,1,2,1,2,2,1,3,1,1,2,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,
-1,0,1,1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,2,2,1,2,3,1,2,3,1,1,2,2,1,3,2,2,3,2,2,3,
-2,2,3,2,2,3,2,2,3,1,2,2,0,1,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,2,1,1,
-2,1,1,2,1,1,2,0,0,2,1,1,2,1,1,3,1,1,3,1,1,3,2,1,4,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,2,1,1,
-3,1,1,3,1,2,3,1,1,1,1,1,0,1,0,2,1,1,3,1,1,3,1,1,2,1,1,1,1,1,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,
-1,2,1,1,2,1,1,1,1,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,2,2,1,2,3,1,2,3,1,0,1,0,0,0,2,2,4,9,3,6,14,3,5,11,
-0,1,2,0,0,0,2,3,7,6,10,22,8,16,30,8,14,30,6,8,25,6,7,25,10,15,34,12,22,42,11,20,38,7,11,26,5,6,19,10,15,36,15,26,52,12,16,45,
-7,6,29,6,6,25,7,10,31,10,15,39,3,4,13,0,0,0,1,0,2,4,6,18,3,4,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,3,1,4,8,2,2,2,1,2,2,1,4,8,2,5,8,2,5,8,2,12,18,4,15,25,6,10,13,3,13,15,3,24,29,7,24,32,10,
-19,32,17,18,32,21,21,36,24,42,54,30,95,87,44,72,43,29,40,20,18,97,72,39,117,95,50,85,66,33,61,36,21,63,47,23,121,100,45,169,121,70,174,132,76,162,149,61,
-169,153,59,156,143,57,166,158,62,183,171,70,178,154,70,156,117,63,171,152,67,186,162,72,126,100,42,66,49,22,19,14,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,2,7,11,4,17,35,13,47,63,51,79,84,128,114,76,146,140,86,122,155,84,101,135,64,123,91,
-60,139,112,90,135,154,120,150,154,136,185,182,143,172,193,139,152,186,154,164,186,179,171,194,154,172,188,98,158,173,105,152,161,121,157,156,108,135,150,91,109,142,61,82,109,24,53,44,
-5,9,21,11,10,50,6,6,24,8,14,2,16,31,6,18,30,9,23,33,43,17,19,65,8,8,37,1,1,1,13,23,4,11,19,4,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,3,6,1,3,7,4,1,8,7,2,12,6,3,14,4,6,10,3,5,7,1,2,8,2,2,
-8,3,2,11,6,3,11,6,3,8,3,2,3,1,1,5,1,2,6,1,3,2,1,1,0,0,0,1,0,0,4,3,3,5,4,3,3,2,1,1,0,0,2,0,2,2,0,1,
-0,0,0,0,0,0,1,0,2,1,0,2,1,1,1,2,1,3,2,1,3,1,1,2,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,
-1,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,1,1,3,1,1,3,2,1,3,2,1,3,2,2,3,2,2,3,2,2,3,
-1,2,3,1,2,3,1,2,3,1,2,3,1,2,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,
-1,0,0,1,0,0,1,0,0,2,0,0,2,0,0,2,0,0,2,0,0,2,1,0,3,1,0,3,1,1,2,1,1,3,2,1,3,2,1,3,2,1,3,2,1,2,2,1,
-1,1,0,1,0,1,1,0,1,1,0,1,0,0,0,0,1,0,1,1,0,2,1,1,3,2,1,3,2,1,2,1,1,0,1,1,0,1,0,1,1,0,0,1,0,0,1,0,
-1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,1,1,0,1,1,0,1,1,0,1,2,1,2,3,1,2,3,1,1,1,0,1,0,2,2,4,9,3,5,14,
-3,4,10,0,1,1,1,1,3,4,6,15,8,14,27,9,19,32,9,14,30,6,7,24,7,10,28,11,19,39,12,22,42,10,18,36,5,9,22,5,6,20,11,18,40,13,24,49,
-10,10,36,6,5,26,6,6,25,9,13,35,8,12,31,1,1,4,0,0,0,3,3,9,5,8,21,1,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,4,6,2,4,6,2,0,0,0,4,6,1,4,8,2,5,7,2,8,11,3,15,23,6,13,21,6,10,10,2,20,23,6,26,33,9,
-24,35,14,20,33,20,20,33,22,25,41,25,73,76,39,93,71,39,41,16,19,69,48,27,121,95,49,102,84,43,53,40,19,35,28,10,91,78,31,157,117,62,171,121,74,167,141,69,
-157,147,53,152,136,53,151,142,54,180,169,67,180,164,70,164,135,64,163,148,63,189,173,73,150,128,54,85,70,26,38,28,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,3,7,2,11,19,6,27,51,39,74,69,103,108,77,158,132,77,148,152,91,119,156,76,102,115,63,137,96,
-72,150,147,105,140,158,128,162,163,145,190,194,143,170,193,138,162,186,158,174,188,170,173,194,127,168,183,89,150,165,115,155,159,112,132,149,98,104,141,77,89,125,55,77,93,20,32,34,
-7,6,37,10,10,47,2,1,11,2,4,0,4,6,0,17,30,21,23,32,62,13,12,57,3,2,13,5,8,0,16,27,6,3,5,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,7,2,5,7,4,3,7,7,2,10,7,2,12,5,4,11,3,6,5,1,2,7,2,2,8,3,2,
-9,6,2,11,6,3,9,4,3,4,1,1,4,1,1,6,1,3,3,0,3,1,0,0,3,0,0,4,3,2,4,4,3,2,3,1,1,0,0,2,0,2,2,0,1,0,0,0,
-0,0,0,1,0,2,1,0,2,1,0,1,2,1,3,2,1,3,1,1,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,
-1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,1,1,1,2,1,3,2,2,3,2,2,3,1,3,3,1,3,3,1,2,3,
-1,2,3,1,2,2,1,2,2,1,1,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,3,1,1,3,2,1,3,2,1,3,2,1,
-2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,1,2,2,1,2,2,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
-1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,2,2,1,2,3,1,2,3,1,1,1,0,1,1,2,2,4,10,
-3,5,14,2,3,8,0,0,0,1,1,5,5,9,20,9,17,30,9,19,33,8,12,28,6,6,24,8,11,31,11,20,39,11,22,41,8,15,32,4,7,19,6,9,25,12,22,44,
-13,19,45,7,8,31,6,6,26,7,7,27,9,13,34,4,5,15,0,0,0,0,0,1,4,5,17,3,4,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,4,7,2,2,3,0,1,1,0,4,8,2,5,8,2,5,8,2,12,17,4,19,28,7,12,16,5,13,15,3,25,29,8,
-26,34,11,21,34,17,19,32,21,20,35,23,48,59,32,98,85,44,62,32,27,44,24,21,103,76,40,116,93,48,76,58,29,36,25,11,72,63,22,130,104,45,158,113,63,165,133,69,
-153,144,55,148,132,50,132,125,45,166,157,59,182,171,70,172,152,63,154,139,55,181,170,68,177,160,66,116,105,36,57,44,17,9,6,3,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,4,1,6,6,2,11,31,15,45,62,69,98,77,139,129,76,162,143,82,141,160,88,108,146,71,117,102,61,148,114,
-84,149,161,115,143,153,130,179,174,140,188,194,143,171,196,138,172,186,159,177,190,154,172,190,97,159,174,94,147,160,116,145,155,104,107,149,90,92,141,67,81,114,41,62,68,7,12,24,
-10,10,48,8,8,38,4,5,20,0,0,3,5,8,3,22,33,42,18,21,66,8,8,38,1,1,1,13,23,5,11,19,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,1,4,8,2,4,7,5,1,9,7,2,10,5,2,11,3,5,5,1,3,2,0,1,8,3,3,10,6,5,
-11,6,4,11,5,3,6,1,1,3,1,1,7,1,4,5,1,3,1,0,0,3,1,1,5,3,2,5,4,4,4,3,2,1,0,0,2,0,2,2,0,2,0,0,0,0,0,0,
-1,1,3,1,1,3,1,0,1,1,1,2,2,1,3,1,1,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,1,
-0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,1,1,2,1,3,3,1,3,3,1,3,3,1,3,3,1,2,3,1,1,2,
-0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,
-1,0,0,1,0,0,1,0,1,1,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,1,0,0,2,0,0,2,1,0,3,1,1,
-3,1,1,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,2,3,1,2,3,1,1,2,0,0,1,3,
-2,5,11,3,6,15,2,2,6,0,0,0,2,3,8,7,11,23,9,19,32,9,17,32,6,9,27,6,7,25,10,15,33,11,22,41,11,20,39,7,12,27,4,6,18,8,13,31,
-12,23,46,11,14,39,6,6,27,6,5,24,6,7,23,5,6,19,0,1,2,0,0,0,2,2,6,4,7,21,1,2,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,2,4,6,2,1,1,0,5,9,3,7,10,3,5,7,2,10,14,3,20,27,7,18,25,6,10,11,2,20,23,6,
-27,33,9,24,35,15,21,34,20,23,35,23,28,44,26,83,82,41,87,60,37,36,12,16,79,52,29,110,82,46,90,69,38,51,37,17,66,58,19,96,87,28,138,106,49,155,122,62,
-156,143,58,150,137,51,132,122,44,150,145,51,187,178,71,186,170,68,163,149,57,173,166,63,196,179,76,144,131,49,77,64,23,22,14,8,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,3,4,1,6,10,2,15,43,31,64,69,97,115,78,153,133,77,154,153,91,130,168,84,102,131,61,130,95,63,149,133,
-96,142,160,115,153,152,130,190,184,137,181,194,139,170,192,140,171,186,160,169,192,131,167,184,64,145,158,99,141,153,113,119,148,101,96,152,83,88,137,57,72,94,25,38,40,8,8,39,
-13,13,59,8,8,38,5,5,21,0,1,0,15,21,18,21,28,58,13,13,59,3,2,16,5,9,0,16,28,7,3,6,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,3,7,2,5,6,3,1,6,5,1,9,5,2,11,3,5,8,1,5,1,0,1,6,1,1,11,4,6,12,7,7,
-11,6,4,7,2,1,4,1,1,7,2,4,7,2,6,3,1,2,2,1,0,4,2,1,6,4,4,5,4,5,3,2,2,2,0,1,2,0,2,0,0,1,0,0,0,1,1,2,
-2,1,3,1,1,2,0,0,0,1,0,2,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,
-0,0,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,1,2,2,1,3,3,1,3,3,1,3,3,1,2,2,1,1,2,1,1,2,1,1,1,
-0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,2,0,1,2,0,2,2,1,2,2,1,1,2,1,1,1,0,1,1,0,0,1,0,0,1,0,0,2,0,0,
-2,0,0,2,1,1,2,0,0,2,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,0,1,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,2,3,1,2,3,1,1,2,1,
-2,2,9,4,6,15,4,5,14,1,1,4,0,0,0,3,4,12,7,14,26,9,19,32,9,15,31,6,8,25,7,8,27,10,18,36,11,23,41,10,18,37,5,9,23,4,5,16,
-8,13,31,11,17,42,8,9,32,4,4,18,2,2,8,3,5,16,3,4,9,0,0,0,0,0,0,4,5,15,4,5,16,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,4,7,2,2,3,1,4,6,2,8,13,3,7,10,3,11,17,4,17,23,6,21,29,8,13,16,4,16,19,5,
-26,32,8,25,34,11,21,35,18,23,34,23,22,37,24,59,66,34,90,77,40,31,16,15,45,25,18,89,62,37,91,73,38,65,49,25,68,53,21,86,80,25,118,99,35,144,109,52,
-160,139,62,153,143,53,140,125,48,142,139,47,190,184,70,198,182,76,178,162,65,171,168,60,194,183,74,165,148,61,99,87,32,40,29,13,1,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,3,2,0,3,19,5,25,55,51,85,74,121,125,77,162,138,80,150,165,93,119,163,73,114,120,62,152,116,79,156,160,
-95,142,151,96,169,152,119,192,186,133,174,190,136,169,188,143,163,187,152,157,191,96,157,174,60,137,148,107,131,145,105,103,145,102,93,155,71,56,112,42,44,58,9,13,22,15,14,68,
-17,17,72,9,9,39,1,1,8,4,7,1,22,34,39,18,20,64,9,8,42,0,0,2,6,12,2,9,16,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,6,2,5,7,2,4,2,2,1,5,2,1,9,3,3,10,3,5,3,1,2,4,1,1,9,3,4,12,6,7,12,7,6,
-10,4,3,4,1,1,6,1,4,9,2,7,6,2,6,3,1,2,4,1,1,6,3,4,7,4,5,5,3,5,3,0,3,2,0,2,1,0,1,0,0,0,0,1,1,2,1,3,
-1,1,2,0,0,0,0,0,0,0,0,1,1,0,1,2,0,2,2,0,2,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,
-1,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,1,2,1,2,3,1,2,2,1,2,3,1,1,2,1,1,1,1,1,2,1,2,2,1,2,2,
-1,1,2,0,1,1,0,1,1,0,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,2,0,1,2,0,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,1,1,0,1,1,0,1,
-1,0,0,2,0,0,2,0,0,2,0,0,2,0,0,1,1,0,1,1,0,0,1,0,0,1,0,1,1,0,0,1,0,0,1,0,0,0,0,1,0,0,1,1,1,0,1,1,
-1,1,1,1,1,1,1,1,0,0,1,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,1,1,2,1,2,4,0,1,2,0,0,0,2,3,1,3,3,3,
-3,3,8,4,5,15,4,6,17,4,5,12,0,0,1,0,1,2,5,7,18,9,18,30,9,20,33,8,13,29,6,7,24,8,11,29,11,21,39,12,24,43,9,16,32,4,5,15,
-3,2,10,9,14,33,10,14,38,5,5,21,0,0,1,1,2,7,4,5,16,1,0,3,0,0,0,1,1,4,4,7,20,2,2,7,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,1,2,1,0,0,0,0,0,0,0,0,0,3,5,1,3,6,2,2,2,1,7,11,3,9,13,3,11,19,4,15,23,5,21,28,8,19,26,7,15,19,5,
-25,31,8,28,35,10,23,35,15,20,33,20,23,35,24,36,49,27,75,72,34,36,27,16,14,7,5,48,35,20,70,62,28,75,60,28,62,46,22,78,68,24,102,94,28,130,102,43,
-149,127,57,154,145,56,145,129,51,134,129,46,181,178,65,202,188,80,187,171,71,171,168,60,194,189,71,187,171,71,126,113,41,57,44,18,5,2,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,3,0,4,31,17,46,63,74,102,79,145,135,76,168,153,67,136,158,79,111,142,72,145,129,67,166,143,91,159,173,
-91,153,146,84,183,159,107,179,179,138,167,191,135,167,186,149,155,189,135,153,186,68,148,163,79,135,147,109,118,139,105,99,152,104,85,152,69,31,98,26,17,35,7,8,33,19,20,84,
-17,15,68,15,9,42,5,3,17,14,22,22,25,35,58,14,14,61,5,5,20,0,0,0,1,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,3,1,3,8,2,5,4,1,1,0,0,0,3,1,1,8,2,4,7,1,4,2,0,0,7,2,2,10,4,6,11,5,7,11,4,3,
-6,1,1,4,1,2,9,2,8,8,2,8,5,2,4,4,1,2,6,3,3,7,4,5,6,4,5,4,2,4,2,0,2,1,0,1,1,1,1,2,1,2,3,1,3,2,1,2,
-0,0,0,0,0,0,0,0,0,1,1,2,2,1,2,2,0,2,2,0,2,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,
-1,0,0,0,0,0,0,0,1,0,0,1,0,1,1,1,1,2,1,1,2,1,1,2,1,1,2,1,1,1,1,2,2,1,1,2,1,2,2,1,2,2,1,2,2,1,2,2,
-0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,0,1,2,0,2,2,1,2,2,1,2,2,1,2,2,1,1,2,1,1,2,1,1,
-1,0,1,1,0,0,1,0,0,2,0,0,2,0,0,2,1,0,2,1,0,1,1,0,0,1,0,0,1,0,1,1,0,1,1,0,0,1,0,0,0,0,1,0,0,0,1,0,
-1,1,1,1,1,1,1,1,1,0,1,1,0,1,0,1,1,0,1,1,0,0,1,1,0,1,0,0,0,0,0,1,1,2,3,6,2,2,6,0,0,2,0,0,0,2,3,1,
-3,3,5,4,4,13,4,6,17,4,8,16,2,4,7,0,0,0,2,2,7,7,12,25,9,21,32,9,18,32,6,9,26,6,6,25,9,14,32,12,23,42,12,21,40,7,11,25,
-2,2,7,4,5,17,10,16,37,8,9,30,2,2,7,0,0,1,4,5,15,3,4,11,0,0,0,0,0,0,4,5,14,4,5,17,1,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,3,4,1,4,8,2,3,3,1,0,0,0,0,0,0,1,1,0,5,7,2,2,3,1,4,7,1,9,14,3,11,17,4,14,22,5,19,25,7,21,29,8,15,22,5,
-22,28,7,29,35,9,24,34,12,19,31,16,23,33,21,27,40,24,59,62,29,51,41,20,6,3,3,15,20,7,48,50,17,79,67,27,64,47,23,77,63,25,88,87,25,109,98,32,
-134,113,47,152,139,54,149,134,51,131,120,44,163,160,57,200,187,80,193,177,75,174,169,62,191,190,69,203,188,80,159,143,56,78,64,24,21,14,7,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,10,10,20,48,52,84,70,105,121,82,165,147,70,170,164,44,118,136,56,110,118,69,161,134,75,169,160,94,150,163,
-81,162,141,75,186,160,111,167,176,135,163,188,132,163,183,152,151,191,111,154,179,57,141,154,100,133,145,105,106,138,109,96,161,107,65,146,65,21,94,11,4,24,14,16,66,23,23,94,
-32,18,76,33,13,60,20,14,47,22,34,44,21,27,66,10,9,45,1,1,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,0,0,6,2,5,8,2,4,1,0,0,0,0,0,2,1,1,6,2,4,2,1,2,5,1,2,10,3,5,10,3,6,10,3,4,8,2,2,
-4,1,1,8,2,6,10,3,8,7,2,6,5,1,3,6,2,3,7,5,6,7,4,6,5,2,5,3,1,3,1,0,1,1,0,1,2,1,3,3,1,4,3,1,3,0,0,1,
-0,0,0,0,0,1,1,1,2,2,1,2,2,1,2,2,1,2,2,0,2,1,0,1,1,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,
-0,0,0,0,0,1,0,0,1,1,1,1,1,1,2,1,1,2,1,1,2,1,1,1,1,1,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,0,1,2,0,1,2,
-0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,1,2,0,2,2,0,2,2,0,2,2,0,1,2,1,1,2,1,1,
-2,1,1,2,1,1,1,1,0,1,0,0,1,0,0,2,1,0,2,1,0,1,1,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,0,1,0,1,0,0,1,1,0,
-1,1,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1,0,1,1,0,1,1,1,0,1,0,0,1,0,0,0,0,0,1,3,2,3,7,2,3,6,0,0,1,1,0,0,
-1,1,0,2,2,7,4,3,14,5,9,18,5,12,16,1,4,5,0,0,0,3,4,14,8,16,29,9,20,33,9,15,30,6,7,24,5,7,23,9,16,33,12,24,43,9,17,35,
-5,7,17,1,1,6,6,8,23,7,9,27,2,2,9,0,0,0,2,2,7,4,6,17,1,1,3,0,0,0,2,2,5,3,4,13,1,0,2,0,0,0,0,0,0,0,0,0,
-0,0,0,2,3,1,6,10,2,5,8,2,1,1,0,0,0,0,0,0,0,3,5,2,4,6,2,1,2,1,8,12,3,10,15,4,13,22,5,17,24,6,21,29,8,19,25,6,
-18,23,6,28,33,9,26,33,9,20,29,10,19,27,12,23,35,23,45,54,27,65,56,26,17,9,8,4,9,1,28,38,9,73,67,24,70,53,25,67,50,23,81,79,25,88,95,26,
-96,93,29,134,121,45,141,131,48,125,114,41,145,143,48,194,184,75,197,184,80,181,177,65,186,190,65,205,197,80,182,166,70,102,89,33,39,28,12,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,2,27,46,62,63,91,118,77,135,139,82,177,158,60,161,162,31,106,116,50,121,107,67,165,142,84,166,172,95,144,154,
-67,172,139,73,180,159,123,160,180,123,164,182,130,157,183,145,150,189,85,152,170,64,136,147,112,128,147,100,91,148,107,80,165,99,46,143,50,19,86,7,9,36,24,26,103,29,25,101,
-52,21,89,44,17,73,18,14,53,16,21,52,16,16,60,6,5,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,3,1,3,8,2,5,4,1,1,0,0,0,0,0,0,3,1,3,4,1,3,4,1,2,10,3,6,11,3,7,10,3,6,9,2,3,5,1,1,
-6,1,3,10,3,9,10,3,7,6,1,3,5,1,3,7,4,6,7,4,7,6,3,6,4,1,3,2,1,1,1,0,1,2,1,3,3,1,4,3,1,4,2,1,1,0,0,0,
-0,0,0,0,0,1,2,1,2,2,1,3,2,1,2,2,1,2,1,0,1,1,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,
-0,0,1,0,0,1,1,0,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,2,1,2,2,1,2,2,1,2,2,0,2,1,0,1,1,1,1,1,0,1,1,0,1,1,
-0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,2,0,1,2,0,1,2,0,1,2,0,1,
-2,1,1,2,1,1,2,1,0,1,1,0,1,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,
-1,1,0,1,1,0,0,1,0,0,1,0,1,1,0,0,1,0,0,1,0,1,1,0,1,1,1,0,1,1,0,1,0,0,0,0,0,2,4,2,3,7,1,2,4,0,0,0,
-0,0,0,0,0,2,2,2,10,5,8,17,6,14,21,5,12,15,0,2,2,0,0,3,6,9,21,9,19,31,9,20,32,8,12,28,5,6,21,6,9,24,11,21,39,12,22,41,
-6,12,26,2,2,7,2,3,9,5,9,22,3,4,12,0,0,0,0,0,1,4,5,15,3,4,11,0,0,0,0,0,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4,7,1,6,10,2,4,5,2,2,2,0,0,1,0,1,1,1,4,7,2,2,3,2,4,7,1,10,15,4,17,22,6,21,27,7,22,28,8,22,29,8,
-18,25,6,25,31,8,29,35,9,22,30,7,15,24,6,22,32,19,31,43,25,64,60,26,38,27,15,3,3,2,15,26,6,61,61,19,78,62,27,65,49,22,79,68,24,81,89,25,
-81,86,24,118,105,37,136,128,47,120,109,38,130,124,40,184,177,67,202,193,82,185,183,68,179,188,61,202,200,72,201,189,79,130,117,43,55,40,18,6,3,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,10,15,45,78,99,73,123,143,81,157,150,77,175,161,47,137,146,30,99,104,57,138,116,71,173,158,91,153,173,89,143,142,
-61,180,143,87,173,165,125,159,182,99,159,172,123,146,180,129,146,181,62,140,157,80,125,147,106,106,145,97,77,162,108,65,165,87,37,138,29,15,68,15,17,71,31,32,125,40,27,107,
-54,21,86,35,16,68,11,11,49,13,13,58,12,12,50,2,3,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,1,5,2,4,7,2,3,1,0,0,2,0,1,4,2,4,7,2,5,4,1,3,8,2,5,11,3,8,11,3,7,10,3,4,8,2,3,5,2,4,
-9,3,7,10,3,8,8,2,6,6,2,3,7,2,5,7,4,7,7,3,7,5,2,5,2,0,1,0,0,0,1,1,3,3,1,4,4,1,4,3,1,3,0,0,0,0,0,0,
-0,0,0,2,1,1,2,1,3,2,1,3,2,1,2,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,1,0,1,
-1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,1,2,2,0,2,1,0,1,1,0,1,1,0,1,1,1,1,2,1,1,1,0,1,1,
-0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,0,1,2,0,1,
-2,0,1,2,0,1,2,1,1,2,1,0,2,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,
-1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,1,0,1,1,1,0,1,1,0,0,0,0,0,0,1,3,5,2,3,7,1,2,4,
-1,1,4,0,0,1,1,1,3,4,4,13,6,12,20,6,17,22,3,9,11,0,0,0,2,3,8,8,14,26,9,20,32,9,20,33,6,12,25,5,4,19,8,14,30,12,23,41,
-8,14,30,2,2,8,0,0,2,5,7,17,5,8,20,1,1,3,0,0,0,2,2,7,4,6,17,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,2,1,6,10,2,6,10,3,5,8,3,3,4,1,0,0,0,4,6,1,4,6,2,2,3,1,9,12,3,17,20,5,22,27,7,23,28,7,23,31,8,
-22,30,8,24,31,8,30,35,9,26,33,8,16,25,6,19,27,11,24,34,15,38,42,14,27,23,11,3,1,2,14,21,4,49,53,14,72,59,24,53,39,20,72,56,23,73,74,23,
-73,79,21,100,93,29,136,125,46,123,114,40,121,112,37,169,164,58,204,196,81,196,194,76,182,192,62,197,201,68,208,199,82,153,141,55,67,52,22,15,9,6,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,30,42,62,114,136,79,144,156,82,167,152,72,173,166,43,134,147,40,118,116,63,155,131,71,171,165,73,138,160,65,151,133,
-60,183,151,103,164,172,117,160,179,92,149,165,130,128,178,105,135,167,51,120,144,91,106,144,92,72,146,98,71,170,106,60,163,72,30,124,16,12,53,24,26,102,34,34,130,50,26,105,
-52,20,85,25,16,69,11,12,50,15,15,62,9,9,37,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,4,1,4,5,1,4,5,1,4,2,1,1,1,0,0,6,2,4,9,2,8,8,2,6,7,1,5,10,3,7,11,3,9,11,3,6,10,3,4,8,2,6,9,3,8,
-10,3,9,9,3,8,7,2,6,7,2,5,7,2,6,7,2,7,7,2,6,4,1,3,0,0,0,0,1,1,4,1,4,4,1,4,3,1,3,0,0,0,0,0,0,1,0,1,
-2,1,2,2,1,3,2,1,2,2,1,2,2,0,2,1,0,1,1,0,1,1,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,0,1,
-1,0,1,1,0,1,1,1,2,1,1,2,1,1,1,0,1,1,1,1,2,1,1,2,0,1,1,0,1,1,1,1,1,1,1,2,1,1,2,1,1,1,0,1,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
-2,1,1,2,1,1,2,1,1,2,1,1,2,1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,2,2,1,1,1,1,1,1,0,
-1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,0,1,1,0,1,0,0,0,0,0,0,2,2,3,7,2,3,8,
-2,3,8,1,2,5,0,0,1,1,1,6,5,7,17,6,15,22,6,15,19,1,4,5,0,0,1,5,7,17,9,18,30,9,22,33,8,18,29,4,5,19,5,7,22,10,19,36,
-10,16,35,2,2,9,0,0,0,3,3,8,5,8,22,3,4,12,0,0,0,0,0,2,4,5,16,3,3,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,4,7,1,7,11,3,8,11,3,5,9,2,0,0,0,1,2,0,5,8,2,3,5,1,7,11,3,14,17,4,20,25,6,22,27,7,23,30,8,
-24,33,8,23,31,8,31,36,10,31,37,10,21,29,7,16,24,5,20,26,7,16,25,7,12,18,5,1,2,1,20,19,5,41,43,11,48,43,15,31,23,12,60,46,19,62,54,20,
-46,52,14,81,79,23,135,120,44,130,121,43,118,106,37,150,149,50,202,197,79,203,199,81,184,191,66,190,197,64,210,204,79,180,168,69,88,75,29,30,19,10,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,31,59,77,73,139,160,82,157,161,82,173,155,67,172,173,42,142,151,53,141,132,69,168,146,79,171,178,55,140,150,40,161,132,
-52,168,151,106,150,171,106,160,175,99,133,166,129,115,173,80,122,151,52,99,132,78,78,127,73,52,145,105,73,174,101,51,156,50,22,98,13,13,57,30,31,122,38,31,123,54,23,95,
-46,21,85,22,19,78,14,15,63,14,14,59,5,5,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,1,3,8,2,7,7,2,6,3,1,3,0,0,0,3,1,3,8,2,6,9,2,8,8,2,6,9,2,5,11,3,9,11,3,8,10,3,4,9,2,5,9,2,8,10,3,9,
-10,3,9,9,2,6,7,2,5,7,2,6,7,2,7,7,2,7,6,2,5,2,0,1,0,0,1,3,1,3,4,1,4,4,1,4,2,1,1,0,0,0,1,0,1,2,1,2,
-2,1,2,2,1,3,2,1,2,2,0,2,1,0,1,1,0,1,1,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,1,1,0,1,1,0,1,
-1,0,1,1,1,1,1,1,2,1,1,2,0,1,0,0,0,0,0,1,1,0,1,1,1,1,2,1,2,2,1,1,2,1,1,2,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,
-1,1,1,1,1,1,2,1,1,2,1,1,2,1,1,2,1,0,1,0,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,2,1,2,2,1,1,1,1,
-1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,1,3,2,3,7,
-2,3,8,2,3,8,1,1,4,0,0,2,2,2,11,6,10,19,6,17,21,3,11,13,0,1,0,1,2,5,7,12,24,9,20,31,9,19,30,5,10,21,4,4,18,8,13,28,
-10,19,38,5,8,20,0,0,0,0,0,2,5,7,18,5,7,20,1,1,3,0,0,0,2,3,9,4,6,16,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,0,1,1,0,2,3,1,6,10,2,7,11,3,7,10,3,2,3,0,0,0,0,6,9,2,7,12,3,8,12,3,11,15,4,19,23,6,23,28,7,23,28,7,
-24,32,8,23,31,8,29,34,9,34,38,10,25,33,9,15,24,6,20,25,6,18,26,6,14,22,5,2,5,1,17,13,5,40,37,12,22,26,7,9,12,4,42,33,12,67,52,22,
-43,46,14,63,69,18,121,107,38,136,126,48,118,105,38,125,125,40,189,186,68,205,201,82,191,194,72,189,198,64,207,206,77,198,188,78,117,104,40,43,29,15,3,1,2,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,6,16,46,87,108,78,147,165,82,159,155,80,177,159,60,163,171,42,140,148,61,156,141,70,171,153,76,166,180,43,139,134,37,160,131,
-54,149,151,107,145,173,95,158,168,113,122,168,123,117,169,59,109,138,57,84,121,53,57,111,66,55,151,110,69,173,87,40,145,26,15,68,17,18,76,35,35,135,47,31,121,56,22,89,
-37,21,87,17,17,74,15,15,64,11,11,48,2,2,13,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-6,1,6,9,2,7,6,1,5,0,0,0,0,0,0,5,2,5,9,2,8,8,2,7,7,1,5,11,3,8,12,3,10,11,3,7,10,2,4,8,2,6,9,3,8,10,3,9,
-9,3,8,7,2,5,7,2,6,7,2,7,7,2,7,7,2,7,5,2,3,1,0,0,1,0,2,4,1,4,4,1,4,3,1,3,0,0,0,0,0,0,2,0,2,2,1,2,
-2,1,2,2,1,2,2,1,2,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,
-1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,1,1,2,1,2,2,1,1,2,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,2,1,2,2,1,2,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,1,1,1,2,2,1,
-1,1,0,2,2,1,2,2,1,1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,2,4,5,
-3,5,8,2,3,8,2,2,7,0,0,1,1,1,4,4,5,15,6,13,21,5,15,18,2,5,6,0,0,0,4,5,14,8,17,29,8,19,30,7,14,25,4,5,16,5,6,20,
-9,17,34,9,15,33,2,2,6,0,0,0,3,3,9,5,8,20,2,3,8,0,0,0,0,0,2,4,6,16,2,2,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,3,3,1,6,6,1,3,3,1,4,7,2,7,11,3,7,12,3,5,7,2,0,0,0,4,6,2,11,18,5,9,16,4,9,13,3,17,20,5,24,30,8,23,29,7,
-24,31,8,23,32,8,25,32,9,34,38,10,30,36,9,17,26,6,17,24,6,19,26,6,16,26,6,7,11,3,8,6,2,37,31,12,21,26,7,6,14,3,17,15,5,74,57,23,
-46,43,15,54,59,14,106,98,31,137,126,47,121,110,40,103,103,34,165,167,56,207,201,81,196,197,76,189,199,65,205,208,73,207,199,82,142,129,52,57,42,18,14,8,6,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,12,20,35,59,110,132,81,153,167,82,166,154,76,179,167,52,155,166,45,143,145,66,162,142,70,174,162,50,149,162,36,144,125,40,164,138,
-69,138,154,111,149,174,92,150,165,121,103,167,105,112,158,47,98,132,59,74,118,43,46,112,83,66,164,111,60,168,74,33,131,16,13,54,23,25,102,42,38,141,62,31,121,53,21,86,
-28,21,86,14,16,68,15,15,63,9,9,41,7,7,32,2,2,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,2,
-8,2,7,8,2,7,4,1,4,0,0,0,3,1,2,7,2,6,9,2,8,8,2,6,8,3,5,12,3,10,12,3,11,11,3,5,9,2,5,8,2,7,10,3,9,10,3,9,
-8,2,7,8,2,7,8,2,7,7,2,8,7,2,7,6,2,5,4,1,1,1,0,1,3,1,4,4,1,4,4,1,4,1,1,1,0,0,0,2,0,1,2,1,2,2,1,2,
-2,1,2,2,1,2,1,0,2,1,0,1,1,0,1,1,0,1,0,0,0,1,0,1,1,0,1,1,0,1,0,0,1,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,
-1,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,2,1,1,2,1,1,2,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,2,2,1,2,2,1,2,1,1,2,1,0,2,1,0,1,1,0,0,0,0,0,0,0,0,0,0,2,2,1,
-2,1,1,1,2,0,2,2,1,2,2,1,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,2,2,1,1,0,0,0,0,0,0,1,0,0,0,0,2,3,2,
-4,6,7,2,4,8,2,4,9,1,2,5,0,0,1,3,2,8,5,9,17,6,17,21,4,12,14,1,1,1,1,1,5,7,11,23,8,19,30,8,17,29,4,8,14,2,2,9,
-7,12,26,9,18,35,5,6,18,0,0,0,0,0,2,2,3,8,1,2,4,0,0,0,0,0,0,2,4,11,3,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,2,2,1,9,9,2,7,7,1,3,4,0,7,11,3,10,14,4,7,11,3,2,2,0,1,1,1,10,16,4,10,18,5,9,13,3,13,17,4,23,28,7,25,30,8,
-23,29,7,23,32,8,22,30,8,32,36,10,33,37,10,21,30,8,17,24,6,21,26,6,17,26,6,11,18,4,2,3,1,30,24,11,32,32,10,9,17,4,9,11,2,65,51,19,
-55,47,17,46,53,13,85,80,24,131,117,42,124,115,39,104,98,34,143,148,46,204,197,77,196,197,79,192,201,70,203,211,71,210,206,80,163,150,61,75,60,24,22,13,9,0,0,0,
-0,0,0,0,0,0,0,0,0,2,0,3,25,41,61,69,129,149,83,160,168,84,179,164,71,181,176,46,152,162,50,146,142,71,169,145,65,169,166,42,145,152,38,152,127,41,159,143,
-84,128,156,106,147,168,92,129,158,117,82,156,82,101,145,46,80,138,48,45,114,45,43,125,100,74,172,104,50,161,54,35,117,17,19,72,30,32,124,54,38,140,67,28,112,45,20,85,
-21,20,82,14,14,64,13,13,56,8,8,38,9,9,40,2,2,9,0,0,0,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,1,5,
-8,2,7,7,2,6,1,0,1,3,0,3,8,2,7,9,2,8,8,2,7,7,2,5,11,3,8,13,3,11,12,3,9,9,2,4,7,2,6,8,3,8,10,3,10,9,3,8,
-8,2,6,8,2,7,8,2,7,7,2,7,7,2,6,5,2,3,1,0,0,2,1,3,5,1,5,4,1,4,3,1,3,0,0,0,0,0,1,2,1,2,2,1,2,2,1,2,
-2,1,2,2,0,2,1,0,1,1,0,1,1,0,1,0,0,0,1,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,
-0,0,1,0,0,0,0,0,0,0,1,1,0,1,1,1,1,2,1,1,2,1,1,2,1,1,2,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,2,2,1,2,1,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,
-2,1,0,2,1,0,1,1,1,2,2,1,2,2,1,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,3,2,1,2,2,1,0,0,0,0,0,0,0,0,0,1,0,0,
-3,5,4,3,7,9,3,8,10,3,6,10,0,0,2,0,0,3,4,4,13,6,15,20,5,17,19,2,6,6,0,0,0,3,5,14,8,16,28,8,18,30,5,13,19,1,2,2,
-4,6,16,8,17,32,7,13,28,1,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,4,4,6,16,1,1,5,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,7,7,1,9,9,2,3,3,1,6,10,2,13,15,4,9,13,4,3,5,1,0,0,0,6,9,2,10,17,4,9,14,4,10,15,4,20,24,6,25,30,8,
-22,27,7,22,29,8,21,29,8,27,34,9,34,38,10,26,34,9,15,24,6,18,24,6,17,26,6,13,23,6,2,5,1,18,14,6,40,36,13,13,20,4,4,8,1,47,37,13,
-61,49,20,42,47,13,61,59,17,100,88,31,111,106,35,107,98,34,124,130,40,195,189,70,201,200,82,197,204,74,202,212,70,206,207,75,178,167,68,94,78,31,32,21,12,3,3,1,
-0,0,0,0,0,0,0,0,1,7,1,13,38,65,87,76,141,160,85,170,174,85,192,179,65,179,181,45,148,157,58,151,141,73,170,147,60,165,169,39,143,143,39,156,126,45,147,143,
-98,124,160,95,139,155,86,104,147,92,65,136,54,93,133,45,60,140,34,26,108,57,51,142,109,73,173,93,44,154,39,35,104,19,23,89,37,36,137,62,36,136,62,25,101,39,23,93,
-20,20,84,15,15,66,11,11,48,9,9,43,10,10,43,2,2,9,2,1,5,5,2,4,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,7,2,7,
-9,2,7,4,1,3,3,1,2,9,3,7,10,2,9,8,2,7,7,2,6,9,2,6,13,3,11,13,3,11,10,3,6,7,2,5,7,2,7,10,3,10,10,3,10,8,3,7,
-8,2,7,8,2,7,8,2,7,7,2,7,6,2,5,3,0,1,1,0,1,4,1,5,5,1,5,4,1,4,2,1,1,0,0,0,2,0,1,2,1,2,2,1,2,2,1,2,
-2,1,2,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,1,1,2,1,1,2,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,2,1,0,2,1,0,1,1,0,1,1,0,2,2,0,
-2,2,0,2,2,0,1,1,0,1,1,0,2,2,1,2,2,1,1,1,0,1,1,0,2,2,1,2,2,1,1,1,0,3,2,1,2,2,1,0,0,0,0,0,0,0,0,0,
-1,2,1,4,8,8,6,10,12,5,10,13,2,3,6,0,0,1,2,1,8,6,9,17,6,17,21,3,13,14,0,1,2,1,0,3,5,9,19,8,17,28,7,17,26,2,6,8,
-1,2,7,7,12,25,8,15,31,3,4,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,14,3,4,11,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,3,1,9,9,2,5,5,1,3,6,1,11,14,4,11,14,4,5,8,2,0,0,0,3,4,1,11,16,4,10,16,4,10,14,3,16,20,5,24,30,8,
-22,27,7,19,24,6,20,28,7,25,32,9,34,38,10,30,36,10,16,24,6,13,18,5,18,24,6,13,22,6,3,7,1,9,6,3,43,36,14,15,19,5,0,2,0,25,21,6,
-71,55,23,46,47,15,53,55,14,88,76,26,96,89,29,103,92,32,111,114,36,183,181,62,201,196,81,198,203,77,203,213,72,208,212,75,192,184,72,110,97,37,47,37,15,10,10,4,
-0,2,2,0,2,2,2,1,4,14,12,30,50,88,111,80,150,166,87,178,176,83,196,186,61,173,180,47,145,152,63,157,141,70,172,157,55,159,169,36,140,131,37,154,122,53,134,133,
-105,126,159,86,136,150,82,84,138,74,72,123,40,84,130,45,44,132,29,24,107,76,63,159,111,68,169,81,41,145,29,27,89,24,25,103,43,38,141,70,35,130,58,24,99,36,28,110,
-23,24,96,15,15,66,9,9,41,13,13,57,12,12,51,5,6,23,8,6,25,7,3,8,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,3,8,2,7,
-7,2,6,3,1,2,6,2,5,12,3,10,9,2,8,6,1,5,7,2,5,11,3,9,13,4,12,12,3,10,7,2,4,7,2,6,9,3,8,10,3,10,9,3,9,8,2,7,
-8,2,7,8,2,7,7,2,7,7,2,6,5,2,3,2,0,0,2,1,3,5,1,5,5,1,5,3,1,3,1,1,0,1,0,1,3,1,3,3,1,3,2,1,3,2,1,2,
-1,0,1,0,0,1,1,0,1,1,0,1,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,1,2,1,1,2,0,1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,
-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,2,1,0,2,2,1,1,1,0,2,2,0,
-2,2,1,2,2,1,2,2,1,1,1,0,2,2,0,3,3,1,3,2,1,1,2,1,2,2,1,3,3,1,1,2,1,1,1,0,3,2,1,0,0,0,1,1,1,1,1,1,
-0,0,0,4,5,5,7,11,12,8,11,13,4,8,11,0,0,3,0,0,3,3,4,13,6,14,20,5,17,19,2,6,6,0,0,0,1,2,8,7,13,23,9,19,26,4,11,15,
-0,1,3,3,5,14,6,11,23,4,6,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,9,4,5,16,1,1,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,8,8,2,8,8,2,2,3,1,8,12,3,14,17,5,9,12,3,3,4,1,6,6,2,14,17,4,13,19,5,10,15,3,13,18,5,23,28,8,
-24,29,8,18,23,5,21,27,7,26,32,9,33,38,10,33,38,10,19,27,7,11,16,4,16,22,5,12,19,5,3,6,1,1,1,1,40,31,13,25,26,8,0,3,0,11,9,2,
-60,46,19,46,42,16,51,56,14,84,72,24,79,66,25,73,59,22,98,98,33,163,166,54,197,190,74,197,199,77,203,212,73,210,217,75,204,200,76,125,116,46,50,42,14,16,15,6,
-4,17,17,3,17,16,7,17,23,25,46,66,61,112,134,81,156,170,87,183,178,79,194,187,56,165,176,45,140,145,54,150,137,63,166,159,47,151,161,36,144,126,37,155,120,68,127,135,
-108,131,161,76,127,143,77,65,127,58,63,108,38,65,130,38,29,111,34,29,113,93,73,169,107,56,164,65,39,131,19,23,80,28,30,119,56,40,145,82,34,130,57,27,109,32,30,116,
-22,22,91,14,14,58,9,9,39,15,15,64,10,10,42,8,8,35,12,8,34,4,2,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,7,2,6,9,2,7,
-6,1,5,2,1,2,9,3,8,12,3,10,7,1,6,6,1,5,7,2,6,13,4,11,13,4,12,8,2,7,5,1,4,7,2,7,10,3,9,10,3,9,8,3,7,8,2,6,
-8,2,7,8,2,7,7,2,7,7,2,5,3,1,1,2,1,2,5,1,5,5,1,5,4,1,4,3,1,1,1,0,0,2,1,2,3,1,3,3,1,3,2,1,3,1,0,1,
-0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,1,0,1,1,0,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,0,1,2,0,1,2,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,2,2,1,2,1,0,2,2,1,2,2,1,1,1,0,
-2,2,1,2,2,1,2,2,1,2,2,1,2,1,0,3,3,1,3,3,1,3,2,1,2,3,1,3,2,1,3,2,1,1,1,0,3,2,1,3,2,1,2,3,2,4,4,4,
-0,1,1,1,1,1,5,9,9,8,11,13,7,11,14,2,4,7,0,0,1,2,2,7,7,11,17,7,18,21,4,11,13,0,1,1,0,0,1,5,7,15,10,17,22,6,14,19,
-1,4,5,1,0,3,3,4,11,4,5,14,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,3,7,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,5,6,1,9,9,2,3,4,1,6,9,2,16,19,5,14,17,5,8,10,3,10,10,3,16,17,4,17,22,6,12,17,4,17,20,5,23,27,7,
-26,32,9,21,26,6,23,27,7,28,34,9,33,37,10,34,38,10,22,30,8,10,16,4,15,18,5,13,21,5,5,10,2,0,0,0,31,24,9,34,33,11,3,7,2,3,3,0,
-46,35,13,37,32,13,45,54,13,79,69,23,74,56,25,50,38,16,78,78,25,141,146,44,196,190,71,197,198,77,202,210,74,208,217,73,206,205,74,140,132,50,56,52,17,25,22,9,
-6,26,26,5,25,25,12,34,43,38,80,99,69,130,150,83,162,172,86,189,179,75,192,188,54,166,176,44,144,147,45,143,136,46,152,159,42,145,153,36,146,117,37,148,114,85,118,137,
-104,137,161,69,112,135,66,49,109,45,49,97,37,37,123,32,21,97,44,41,127,103,76,173,99,48,157,50,36,114,17,22,81,33,34,132,72,41,148,88,35,130,52,31,119,28,29,113,
-20,20,82,11,11,48,9,9,43,16,16,65,7,7,32,9,9,38,11,5,22,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,7,2,5,12,3,10,12,3,10,
-6,1,5,4,1,3,11,3,10,10,3,9,8,2,6,7,1,5,9,2,8,13,4,13,12,4,11,5,1,4,5,1,5,8,2,7,10,3,9,10,3,9,8,2,7,8,2,7,
-8,2,7,7,2,7,7,2,7,5,2,4,2,1,1,4,1,4,5,1,5,5,1,5,3,1,2,1,1,0,1,0,1,2,1,3,2,1,3,2,1,3,1,0,2,0,0,0,
-0,0,0,1,0,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,0,1,1,2,1,1,2,1,1,1,1,1,1,0,1,1,0,1,1,0,0,1,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,0,1,1,0,1,1,0,1,1,0,2,1,0,2,1,0,2,2,1,1,2,1,
-1,1,0,2,2,1,2,2,1,2,2,1,2,2,1,3,2,1,3,3,1,3,3,1,2,3,1,2,3,1,3,2,0,3,3,1,4,4,3,4,4,3,2,3,2,4,6,5,
-3,4,4,0,0,0,2,5,6,7,11,13,8,12,14,4,8,11,0,1,2,1,0,3,6,8,13,8,17,20,5,16,18,1,5,5,0,0,0,2,3,8,8,14,19,8,16,19,
-3,9,10,0,0,0,0,0,1,2,4,10,2,2,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,2,1,9,9,2,6,6,1,3,5,1,14,17,4,18,21,5,11,14,4,11,13,3,17,18,5,21,24,6,14,19,5,17,21,5,22,25,6,
-26,32,9,24,31,8,22,26,6,28,33,9,32,36,10,34,36,10,25,30,8,11,17,4,12,16,4,15,22,5,8,14,4,0,1,0,19,15,5,42,36,14,8,12,3,1,1,0,
-29,22,8,31,25,9,37,46,11,72,68,20,87,65,28,45,34,15,62,61,19,117,124,37,189,185,67,196,194,76,200,207,75,208,217,74,209,211,73,161,153,60,69,64,22,32,26,11,
-4,23,22,6,25,25,17,43,56,47,100,120,74,140,158,84,169,174,85,191,180,70,186,186,54,167,175,38,141,146,33,135,137,43,152,167,39,142,143,33,139,98,38,126,100,96,115,147,
-95,139,156,68,98,130,66,49,104,37,48,100,38,30,120,29,21,92,47,43,139,92,60,166,84,42,148,38,31,99,20,23,92,42,38,142,84,41,149,81,34,129,44,32,123,25,27,106,
-18,18,75,9,9,42,12,12,52,14,14,57,7,7,30,11,9,39,8,3,12,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,8,3,6,12,3,9,13,3,11,13,3,11,
-5,2,4,8,2,7,13,3,12,10,2,9,10,3,9,9,2,7,11,3,10,13,4,13,9,3,9,4,1,3,6,2,6,10,3,9,10,3,10,9,3,8,8,2,6,8,2,7,
-8,2,7,7,2,7,7,2,6,4,1,1,2,1,2,5,1,5,5,1,5,4,1,4,3,1,1,1,0,0,1,1,2,2,1,3,2,1,3,1,1,2,0,0,0,0,0,0,
-1,0,1,1,0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,
-0,0,0,0,1,2,1,1,2,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,2,1,1,2,2,1,
-1,1,1,2,1,0,2,2,1,2,2,1,2,2,1,2,1,0,3,3,1,3,3,1,3,3,1,2,3,1,2,2,0,3,3,2,5,5,5,6,5,4,4,4,2,3,5,4,
-5,6,6,1,1,1,0,1,1,5,9,10,8,11,13,7,10,13,1,3,6,0,0,1,3,3,6,9,14,17,8,18,20,3,10,11,0,0,0,1,1,4,6,11,19,9,16,20,
-5,13,15,0,2,3,0,0,0,2,2,7,3,4,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,1,0,8,8,2,8,8,2,3,3,1,10,12,3,19,21,5,14,18,5,12,16,4,17,18,5,21,23,6,16,21,5,15,19,5,21,24,6,
-25,30,8,26,32,9,21,26,6,26,31,8,30,35,10,33,36,10,28,31,8,13,20,5,11,15,4,16,22,5,11,17,5,2,4,1,10,8,3,42,34,12,15,19,5,0,2,1,
-18,14,4,32,26,10,32,39,10,62,63,17,89,68,28,53,39,18,56,50,17,100,106,31,174,169,58,196,193,77,201,207,76,208,218,75,212,217,75,180,175,68,88,83,29,45,42,14,
-5,26,26,7,27,30,23,52,69,53,105,126,78,148,165,86,180,181,83,193,182,65,182,185,52,165,173,35,136,139,33,134,136,41,147,160,36,139,129,31,133,88,40,108,92,90,118,144,
-77,134,143,48,75,106,41,31,75,32,41,106,40,28,116,26,22,94,49,39,147,78,41,155,71,39,136,28,26,88,24,27,107,51,40,147,90,39,143,72,33,126,37,31,120,22,23,93,
-14,14,59,9,9,39,15,16,64,12,13,51,8,8,33,12,8,35,5,2,5,0,0,0,0,0,0,0,0,0,0,0,0,3,1,3,11,3,9,14,4,12,13,3,12,10,2,10,
-4,1,3,12,3,10,13,3,12,11,3,9,11,3,9,10,3,8,13,4,12,13,4,13,7,2,5,5,1,4,8,2,7,11,3,10,10,3,10,8,3,7,8,2,7,8,2,7,
-8,2,7,7,2,7,5,2,4,2,0,1,3,1,4,5,1,5,5,1,5,4,1,3,2,0,0,2,0,1,3,1,2,2,1,3,2,1,2,0,0,1,0,0,0,0,0,0,
-1,0,1,1,1,1,1,2,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,
-0,1,1,1,1,2,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,1,1,0,1,1,0,1,0,0,1,1,0,1,1,0,2,1,1,
-2,1,1,1,1,0,2,2,1,2,2,1,2,2,1,1,1,0,2,2,1,3,3,1,3,3,1,2,3,1,2,3,1,3,3,1,5,5,3,6,6,5,6,6,2,4,5,3,
-5,7,6,3,4,4,3,2,1,6,7,6,8,11,12,8,11,13,4,7,10,0,0,2,0,0,0,7,9,9,12,19,19,6,17,17,1,4,4,0,0,0,3,6,14,9,15,20,
-6,15,17,2,6,7,0,0,0,1,1,3,3,4,12,1,2,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,2,1,2,4,1,5,6,2,9,9,2,4,4,1,6,8,2,17,20,5,18,21,6,13,17,4,15,18,4,20,22,6,19,23,6,13,18,5,19,23,6,
-24,28,7,27,33,9,21,26,7,24,29,7,30,35,9,33,36,10,31,33,9,17,24,6,10,14,4,15,18,5,9,15,4,3,4,1,3,2,1,40,32,13,24,25,8,0,3,1,
-16,13,4,37,27,12,30,36,10,56,62,16,92,73,28,60,44,21,49,41,15,86,88,25,164,161,53,195,191,75,202,207,79,210,218,76,215,221,75,196,192,73,116,114,42,70,75,20,
-5,24,24,8,28,32,28,63,81,59,114,135,81,161,175,89,191,189,80,195,187,62,178,184,51,161,169,34,132,135,35,142,142,37,146,147,34,135,113,29,126,81,46,104,99,79,113,135,
-50,112,115,22,46,74,13,10,47,30,29,108,39,26,108,26,25,103,58,41,154,77,39,150,61,38,126,22,23,85,29,31,123,63,42,150,92,39,142,63,34,129,31,30,115,15,16,67,
-7,7,32,9,10,41,20,25,83,12,14,50,9,8,37,12,6,26,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,6,1,4,12,4,10,16,4,13,14,3,12,8,1,7,
-6,2,4,14,4,12,12,3,10,11,3,9,11,3,8,10,3,9,13,4,12,12,4,11,5,1,4,5,1,5,9,2,8,11,3,10,9,3,8,8,2,7,8,2,7,8,2,7,
-6,2,7,6,2,6,4,1,2,2,0,2,4,1,5,5,1,5,5,1,4,3,1,1,2,0,0,3,1,2,3,1,2,2,1,2,0,0,1,1,0,1,1,0,1,0,0,1,
-0,0,1,2,2,1,2,3,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,
-1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,2,2,1,1,1,0,3,3,1,3,3,1,3,3,1,2,3,1,3,3,1,4,4,2,6,6,5,6,6,4,6,6,2,
-6,7,5,5,6,6,4,4,3,8,8,6,9,11,11,8,11,13,6,10,13,1,2,5,0,0,0,3,4,3,12,16,16,9,19,20,2,9,9,0,0,0,1,2,7,6,11,17,
-7,14,13,2,9,10,0,1,1,0,0,0,3,5,10,5,9,9,3,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,4,1,4,8,2,4,6,2,9,9,2,9,9,2,5,7,2,15,17,5,21,23,6,16,19,5,14,18,4,19,20,5,21,25,6,13,19,5,17,21,5,
-21,25,6,27,32,9,24,28,8,22,27,7,29,34,8,32,36,10,32,35,9,22,27,7,9,15,4,11,13,3,7,9,3,1,1,1,0,0,0,34,26,11,27,23,10,0,1,0,
-5,4,1,38,27,11,27,27,9,36,44,10,80,65,24,75,54,27,44,36,14,79,78,26,152,149,48,191,185,70,201,204,79,211,219,78,217,223,76,207,206,76,137,135,52,71,83,23,
-5,23,22,10,32,38,34,74,94,65,127,146,84,171,182,91,202,197,78,197,192,60,175,183,50,155,162,35,133,136,36,144,145,36,142,140,32,129,100,27,113,74,54,102,106,77,106,130,
-35,83,90,8,23,47,10,8,46,33,27,115,35,24,101,29,28,115,65,42,157,78,39,146,50,36,115,22,25,95,35,37,139,74,43,152,93,41,145,57,36,134,27,28,107,15,11,46,
-2,2,7,12,13,51,22,29,90,10,12,45,10,9,38,11,7,25,3,3,9,4,1,6,3,1,3,0,0,0,0,0,0,8,2,6,15,4,11,16,4,13,11,3,10,4,1,3,
-8,2,7,14,4,12,11,3,10,11,3,9,10,3,8,12,3,10,13,4,12,9,2,8,4,1,3,7,2,6,10,3,9,10,3,9,8,3,7,8,2,7,8,2,7,7,2,7,
-6,2,6,6,2,4,3,1,2,3,1,3,5,1,5,5,1,4,4,1,2,3,1,1,2,0,1,3,1,2,3,1,2,1,0,1,0,0,0,1,0,1,1,0,1,0,0,1,
-0,1,0,2,3,1,2,2,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,
-1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,2,2,1,1,1,0,1,1,0,3,3,1,3,2,1,2,3,1,3,3,1,4,3,1,4,4,4,6,6,5,6,6,2,
-5,7,4,5,7,6,5,5,4,8,8,6,9,11,10,8,11,13,8,11,13,5,7,9,5,3,2,2,2,1,9,11,10,11,19,19,4,11,13,0,0,0,0,0,2,4,5,9,
-7,11,8,4,11,10,0,3,3,0,0,0,1,2,4,9,15,9,8,13,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,2,1,5,8,2,4,6,2,8,8,2,13,13,3,9,10,2,11,14,4,20,22,6,19,22,6,18,21,5,20,22,6,22,25,6,15,20,5,14,18,4,
-19,21,5,26,31,9,25,31,8,21,26,7,27,32,8,30,36,10,31,34,9,22,27,7,10,17,5,9,11,3,6,6,1,0,0,0,0,0,0,23,18,6,32,23,11,1,0,0,
-1,3,0,35,26,10,24,17,8,9,12,3,55,43,14,85,63,27,45,34,15,76,72,23,135,133,43,186,178,66,196,196,77,209,216,79,217,224,77,214,215,77,159,159,61,72,86,23,
-6,25,24,14,38,48,40,83,105,70,134,153,87,179,187,90,204,199,73,193,191,57,172,180,47,151,157,34,133,135,35,139,141,36,139,134,29,122,88,27,111,77,62,102,116,71,109,123,
-26,66,77,7,13,40,14,13,60,39,30,123,30,22,94,35,32,128,71,42,157,76,38,142,40,32,104,21,24,97,40,38,142,83,43,150,86,39,142,49,36,133,28,26,103,24,12,55,
-6,4,19,16,18,67,21,26,84,9,9,40,11,9,37,13,9,35,8,7,31,11,8,24,8,7,20,1,1,2,2,1,1,11,3,8,15,4,12,15,4,13,8,2,7,3,1,2,
-12,3,10,14,4,12,10,3,9,11,3,9,11,3,9,13,3,11,13,3,12,6,2,5,4,1,4,7,2,7,10,3,9,10,3,8,7,2,6,8,2,7,8,2,7,7,2,7,
-6,2,5,5,1,3,3,1,2,3,1,3,4,1,4,4,1,3,4,1,2,2,1,2,3,1,2,3,1,2,2,1,2,0,0,0,1,0,1,1,0,1,0,0,0,0,0,0,
-2,2,0,2,3,1,0,1,1,0,0,1,0,0,0,0,0,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,0,1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,2,2,0,1,1,0,3,2,1,3,2,1,3,3,1,2,3,1,3,3,1,4,4,3,5,5,4,6,6,4,
-6,6,2,5,7,5,5,6,5,6,6,5,9,10,9,9,12,12,8,11,13,9,11,11,10,9,4,7,5,1,6,7,6,11,16,16,5,12,14,0,2,2,0,0,0,1,2,6,
-6,9,7,5,12,8,1,6,6,0,0,0,0,0,0,6,10,3,11,17,4,1,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,4,7,1,5,8,2,6,6,2,13,13,3,11,11,2,8,11,2,19,21,6,21,23,6,22,24,6,22,24,6,22,24,6,18,23,6,14,19,4,
-18,19,4,24,29,7,26,33,9,19,23,6,25,29,7,30,35,9,28,32,9,20,25,6,11,19,5,10,13,4,7,7,1,0,0,0,0,0,0,15,12,4,43,31,13,6,4,3,
-0,1,0,28,22,7,26,18,9,0,0,0,35,29,9,91,69,30,46,34,16,66,63,19,125,122,39,175,166,59,190,188,73,207,213,78,217,224,77,215,218,78,168,168,64,80,92,25,
-5,21,22,17,42,55,47,93,116,75,145,163,87,185,191,87,202,197,69,190,192,57,170,179,44,145,151,32,132,133,33,133,135,32,126,115,27,117,80,32,109,80,71,103,126,65,108,119,
-20,55,71,7,9,36,18,17,74,37,27,112,27,21,88,44,37,139,75,42,155,72,39,138,30,29,94,23,25,102,45,38,142,89,43,150,80,39,140,41,35,129,30,26,103,27,16,68,
-8,8,36,21,24,81,22,23,75,10,9,37,13,9,37,15,9,39,11,7,32,16,13,37,14,12,33,5,1,6,7,2,5,15,4,12,16,4,13,15,4,12,7,2,5,4,1,3,
-14,4,13,14,3,12,10,2,9,12,3,10,12,3,10,13,3,12,11,2,10,4,2,3,6,1,5,8,2,8,10,3,8,8,2,6,7,2,6,8,2,7,7,2,7,6,2,6,
-6,2,4,5,1,2,3,1,2,3,1,3,4,2,4,5,2,3,4,1,2,2,1,2,3,1,2,3,1,2,1,1,1,0,1,0,1,1,1,1,0,1,0,0,0,0,1,0,
-2,3,1,2,2,1,0,0,1,0,0,0,0,0,0,0,0,0,1,2,0,1,2,0,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,1,1,0,1,2,1,3,2,1,3,2,1,2,3,1,2,3,1,4,3,1,5,5,4,6,6,4,
-6,6,2,5,7,4,5,7,6,5,6,5,9,8,7,9,11,11,9,11,13,10,12,12,11,10,4,10,8,2,7,6,3,11,14,11,7,14,13,1,3,4,0,0,0,1,1,4,
-6,8,9,7,13,7,2,9,9,1,1,1,0,0,0,3,5,1,11,18,5,4,7,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,3,5,1,5,8,2,5,5,1,12,11,3,12,12,3,7,10,2,16,19,5,21,23,6,22,24,6,23,24,6,22,23,6,21,26,7,16,22,5,
-16,19,4,22,25,7,28,34,9,19,22,6,21,24,6,30,35,9,27,32,9,20,25,6,12,20,5,9,14,4,10,10,2,2,2,0,0,0,0,9,7,2,37,27,11,9,6,4,
-0,0,0,21,18,5,36,26,12,1,0,1,21,19,5,83,64,24,51,36,16,54,51,17,115,115,35,164,157,53,187,182,70,206,212,80,217,224,79,216,221,78,176,178,65,89,100,28,
-6,23,25,21,47,62,54,115,134,81,164,178,86,186,192,83,198,196,67,186,193,56,168,176,40,140,144,31,128,129,29,119,121,29,116,100,27,117,76,38,106,88,74,105,128,56,100,107,
-15,43,64,6,6,31,17,16,71,34,21,91,22,18,77,49,38,144,76,40,150,66,38,132,25,26,88,26,28,113,55,39,144,98,44,150,77,39,140,35,33,125,33,25,101,26,16,68,
-9,10,45,27,29,97,25,22,72,10,9,37,16,10,40,20,11,45,13,8,32,20,15,43,16,10,31,7,1,5,12,3,9,18,4,15,16,4,14,14,4,11,5,1,4,7,2,6,
-15,4,14,12,3,11,11,3,9,12,3,10,12,3,10,13,3,12,9,2,8,4,1,3,7,1,6,10,3,8,9,3,7,6,1,5,7,2,6,7,2,7,7,2,6,6,2,5,
-5,1,3,3,1,2,3,1,2,6,4,5,8,7,5,5,3,3,3,1,2,3,1,2,3,1,2,3,1,2,1,1,2,1,4,2,1,1,1,1,0,1,0,0,0,1,2,1,
-2,3,1,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,0,1,2,0,1,1,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,2,2,1,3,2,1,2,3,1,2,3,1,3,3,1,5,4,3,6,6,5,
-6,6,5,5,6,4,5,7,6,6,7,5,7,7,6,9,10,10,9,11,12,11,12,13,11,10,7,11,9,2,9,8,2,11,14,6,11,17,13,3,6,7,0,0,0,0,0,2,
-8,8,9,11,14,7,4,11,10,3,7,3,2,4,1,2,2,1,11,16,4,7,10,3,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4,4,1,4,5,1,5,8,2,4,6,2,9,9,2,14,14,3,10,11,3,13,16,4,21,22,6,22,24,6,23,25,6,22,23,6,22,25,7,16,23,6,
-16,19,5,20,23,6,27,33,9,21,26,6,20,22,5,30,34,9,28,34,9,22,26,7,12,18,4,6,12,3,9,10,2,3,3,1,0,0,0,5,4,1,33,25,9,15,10,5,
-0,0,0,13,11,3,37,28,11,3,1,2,8,8,2,55,42,15,37,26,13,33,31,12,99,101,32,154,148,48,179,173,64,204,208,79,218,224,80,217,223,78,190,190,69,109,117,36,
-8,24,29,26,59,78,63,136,154,84,174,187,84,184,191,79,194,195,66,183,192,51,153,162,36,130,135,31,128,129,28,114,114,28,115,94,25,112,73,44,103,97,75,89,124,47,80,94,
-12,34,56,5,5,27,18,15,63,29,15,64,16,16,68,53,36,140,77,38,146,58,38,124,21,24,86,29,31,123,65,42,149,107,45,152,70,38,140,31,31,120,33,24,96,20,14,60,
-12,13,55,32,34,107,23,19,68,10,8,38,21,14,51,23,17,57,15,10,36,20,16,43,15,7,23,6,1,4,14,4,12,18,4,15,15,4,14,13,3,9,4,1,2,11,3,9,
-16,4,14,11,3,10,11,3,9,12,3,10,12,3,11,13,3,11,6,2,5,5,1,4,7,2,7,10,3,8,8,2,6,5,1,5,7,2,6,7,2,7,7,2,5,6,1,4,
-4,1,3,3,1,2,3,1,3,8,8,6,10,11,6,5,4,3,3,1,2,3,1,2,3,1,2,2,0,2,1,3,2,1,4,2,1,1,1,1,0,0,0,1,0,2,3,1,
-2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,2,3,1,1,2,0,0,0,0,0,0,0,1,2,0,1,1,0,1,1,0,1,1,0,1,1,0,0,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,1,1,1,1,1,0,0,2,1,0,3,2,1,2,2,1,2,3,1,3,4,2,4,4,2,5,5,5,
-6,6,6,5,6,5,6,7,5,6,8,6,7,7,5,9,9,8,7,11,11,10,12,13,12,12,9,11,11,5,10,10,4,10,12,3,15,18,12,8,11,10,0,0,1,0,0,0,
-6,5,8,12,14,8,4,10,6,7,12,5,7,12,3,1,2,1,8,13,3,9,14,3,0,1,1,0,0,0,0,0,0,4,7,2,4,6,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4,4,1,5,5,1,4,8,2,4,7,1,7,7,2,16,16,5,14,14,4,12,15,4,21,23,6,22,24,6,22,25,6,22,24,6,22,24,6,17,24,6,
-15,19,5,18,20,5,26,32,9,24,30,8,17,20,4,28,32,8,29,35,9,22,27,7,11,13,3,3,5,2,7,7,2,6,6,2,0,0,0,1,1,0,32,24,9,26,17,9,
-0,0,0,9,8,2,32,24,10,7,3,4,2,2,0,40,30,12,20,14,7,6,7,3,72,78,23,134,131,42,161,155,54,199,202,74,218,224,81,220,225,79,198,201,72,127,137,45,
-9,23,30,32,70,90,70,154,169,86,183,194,82,182,190,75,190,193,63,177,186,49,145,153,35,127,133,33,132,134,29,113,113,23,96,78,22,96,63,37,92,85,59,76,104,30,62,75,
-11,27,52,4,4,23,18,13,58,22,11,50,18,16,70,58,36,139,75,37,142,47,35,114,19,23,86,33,34,130,79,44,151,108,44,150,61,37,137,30,30,117,34,23,92,16,11,53,
-17,20,70,34,35,108,18,14,55,11,9,40,26,20,63,27,22,65,17,11,37,20,16,42,12,4,16,7,2,4,17,5,13,19,7,20,18,8,25,11,3,10,4,1,2,15,4,13,
-16,4,14,11,3,9,11,3,9,11,3,10,12,3,11,11,3,10,5,2,4,5,1,4,8,2,7,9,3,8,6,2,5,4,1,4,7,2,6,6,2,6,5,1,4,5,1,3,
-4,1,2,3,1,2,4,2,4,11,12,6,10,12,5,4,2,2,3,1,2,3,1,2,3,1,2,2,1,2,1,4,2,1,2,2,1,0,0,1,0,0,1,1,0,2,3,1,
-2,2,1,1,2,0,1,0,0,0,0,0,0,0,0,2,2,1,2,3,1,1,1,0,1,0,0,1,2,0,1,2,0,1,2,0,1,2,0,1,2,0,1,1,0,0,1,1,
-1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,1,1,1,0,0,1,1,1,0,2,2,1,1,2,1,2,3,2,3,5,3,4,4,2,5,5,3,
-6,6,6,6,6,5,5,7,5,7,8,6,7,7,5,8,8,6,7,9,10,9,12,13,12,13,11,12,13,8,11,12,6,9,10,2,15,18,9,12,16,12,1,3,3,0,0,0,
-3,3,6,12,13,9,6,8,2,6,10,3,9,14,4,2,3,1,6,8,2,10,16,4,1,3,1,0,0,0,0,0,0,5,9,2,8,12,3,0,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,3,1,6,6,2,6,8,2,5,8,2,7,8,2,17,17,5,17,17,4,11,13,4,21,23,6,24,25,7,22,24,7,22,24,7,22,24,6,19,24,6,
-14,17,4,16,16,4,25,29,8,25,31,9,15,18,4,24,28,7,30,35,9,25,29,7,11,12,3,0,1,0,5,5,2,8,8,2,0,0,0,0,0,0,30,24,8,32,23,11,
-0,0,0,4,4,1,38,30,10,15,9,6,0,0,0,33,25,9,27,18,9,1,4,0,59,65,17,130,125,40,152,147,49,193,195,70,218,224,83,221,226,79,206,209,76,145,154,54,
-11,28,38,38,83,104,76,166,180,88,188,198,80,181,190,74,189,193,61,170,180,46,138,146,35,129,134,34,132,136,29,114,113,22,92,72,20,87,56,25,86,73,26,64,73,14,57,56,
-11,21,48,5,4,25,22,14,64,23,11,49,22,20,83,64,37,143,69,36,136,31,30,98,19,23,90,38,36,136,89,44,151,103,42,148,52,36,134,32,32,118,36,25,94,14,12,56,
-24,29,90,35,36,107,14,11,47,14,11,48,30,24,71,28,19,60,19,12,39,18,14,39,11,3,12,10,3,7,20,5,16,22,10,30,20,13,35,9,3,12,5,2,4,16,4,14,
-14,3,13,10,3,9,12,3,10,10,3,8,12,3,11,10,2,9,3,1,3,4,1,4,8,2,7,9,3,8,4,1,3,5,1,4,7,2,6,6,2,4,3,1,2,3,1,2,
-2,1,1,3,1,2,5,5,5,12,14,6,8,9,3,3,1,2,3,1,2,3,1,2,2,1,2,1,1,2,2,4,3,2,2,2,1,0,0,0,0,0,1,1,1,3,4,1,
-3,4,1,3,3,1,1,0,0,0,0,0,1,2,1,2,3,1,1,2,0,1,1,0,1,1,0,1,2,0,1,2,0,2,2,0,2,2,0,1,2,0,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,1,0,1,1,0,0,0,2,1,1,1,2,2,1,3,3,2,4,3,3,4,3,3,4,3,
-5,5,5,6,6,6,5,7,6,6,8,6,6,7,5,7,7,6,8,9,9,8,11,12,11,12,12,12,13,8,12,13,7,8,9,3,12,15,7,14,17,13,2,5,5,0,0,0,
-1,1,3,11,11,10,7,9,3,4,7,1,10,15,3,3,6,1,3,5,1,10,17,4,4,6,1,0,0,0,0,0,0,4,6,1,8,14,3,1,2,1,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,6,7,2,10,10,3,8,11,2,9,10,2,17,17,5,19,19,5,10,11,3,19,20,5,25,26,7,23,25,6,22,24,6,22,24,6,20,25,6,
-14,18,4,14,14,3,23,25,7,25,31,8,13,16,4,19,23,6,29,34,9,27,32,9,14,16,4,1,1,0,4,4,1,8,8,2,1,1,0,0,0,0,18,15,5,35,26,11,
-2,1,1,1,1,0,35,27,10,21,13,9,0,0,0,28,22,8,31,21,10,2,4,1,44,51,13,118,116,36,148,141,47,187,189,68,217,223,83,220,226,79,210,213,77,155,162,57,
-13,32,44,44,94,114,79,174,186,88,189,198,81,182,189,73,189,193,59,167,176,43,136,144,35,131,135,33,129,135,28,110,107,21,88,66,21,91,58,20,82,68,12,57,53,11,51,47,
-8,13,34,6,6,30,25,15,70,16,9,42,27,23,92,67,36,143,62,35,130,24,28,89,23,25,100,44,39,143,98,45,151,96,41,145,45,36,132,35,37,120,36,29,96,16,15,62,
-33,37,108,35,34,104,12,10,43,19,14,57,34,27,80,27,16,54,20,13,40,19,12,37,12,3,10,15,4,12,21,5,19,22,12,35,20,14,36,8,2,8,8,2,6,17,4,15,
-13,4,12,11,3,9,11,3,10,9,3,8,12,3,11,8,3,7,2,0,1,2,1,2,8,2,6,8,2,6,3,1,2,6,1,5,7,2,6,4,1,3,2,1,1,1,1,2,
-2,1,2,3,1,3,8,8,5,12,14,6,6,5,3,3,1,2,3,1,2,3,1,2,2,0,2,1,3,3,3,5,3,3,3,2,1,0,0,0,0,0,2,3,1,3,4,1,
-3,4,1,2,2,1,0,0,0,0,0,0,2,2,1,2,3,1,1,2,0,1,1,0,1,2,0,1,2,0,1,1,0,2,2,0,1,2,0,1,1,0,1,1,0,1,1,1,
-1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,0,1,1,0,0,0,0,1,1,0,2,2,1,3,3,1,4,3,2,4,3,3,4,3,
-4,5,4,6,6,6,5,7,6,6,8,6,6,8,5,7,7,5,9,8,8,7,9,10,10,10,11,12,13,6,12,13,8,9,10,4,12,15,8,15,18,12,7,9,7,1,1,0,
-0,0,2,9,9,10,10,11,5,3,5,1,10,15,3,6,9,3,6,6,1,11,17,4,6,9,3,0,0,0,0,0,0,2,3,1,9,15,3,3,3,1,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,6,6,1,11,11,3,11,14,4,12,13,3,17,17,4,19,19,5,10,10,2,15,15,4,25,27,7,23,25,6,22,25,6,23,25,7,24,27,8,
-15,20,5,13,14,3,19,21,5,24,29,7,14,16,4,16,19,5,29,35,9,27,32,9,17,19,5,3,3,0,2,2,1,5,5,1,1,1,0,0,0,0,13,11,3,36,26,11,
-5,2,3,0,1,0,24,20,6,24,16,9,0,0,1,20,16,6,35,24,11,1,1,1,39,46,11,117,117,35,144,135,45,180,180,64,216,222,82,221,226,80,212,216,76,168,174,62,
-17,43,58,48,111,129,82,183,193,87,188,198,80,183,189,71,189,194,57,162,172,41,132,140,32,125,129,30,116,122,26,103,98,20,84,62,21,88,55,17,70,61,9,42,35,5,21,15,
-2,4,12,7,7,32,23,14,63,14,8,39,28,21,87,69,35,138,58,36,126,21,27,85,25,27,109,50,40,146,104,45,152,88,40,143,39,34,129,37,38,119,32,25,89,17,17,64,
-38,42,116,32,31,97,11,9,40,22,17,64,35,27,82,25,14,50,22,15,44,20,11,34,14,3,10,18,5,14,22,6,20,23,15,39,18,12,32,5,1,4,10,3,8,16,4,15,
-11,3,9,10,2,8,9,3,8,10,3,8,12,3,11,7,2,6,0,0,0,2,1,1,8,2,6,6,2,5,3,1,2,6,2,5,7,2,6,4,1,2,2,1,2,1,0,2,
-2,1,2,4,1,3,10,10,6,11,13,5,5,4,2,4,3,3,3,1,2,3,1,2,2,1,2,2,4,3,4,5,3,3,3,2,1,0,0,1,1,0,2,4,1,3,4,1,
-3,3,1,2,2,1,0,2,1,1,2,1,2,2,1,1,2,0,1,1,0,2,2,0,2,2,0,1,1,0,2,1,0,1,2,0,1,1,0,1,1,0,1,1,1,1,1,1,
-1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,1,1,0,1,1,1,0,1,1,0,1,1,0,1,1,0,2,2,1,2,2,1,3,3,2,3,3,3,3,2,
-4,4,4,6,6,6,6,7,6,6,8,6,6,8,5,7,7,5,9,8,7,7,8,9,7,7,9,11,11,6,13,13,7,11,12,6,12,16,10,16,19,14,13,14,10,6,5,2,
-0,0,0,7,7,9,13,15,8,3,7,1,8,13,3,8,12,3,10,9,3,13,17,4,7,12,3,0,0,0,0,0,0,1,2,1,9,14,3,4,7,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,5,5,1,9,10,3,13,15,4,14,15,4,16,16,4,20,19,5,12,13,4,12,12,3,26,27,8,26,27,8,23,25,7,24,25,7,26,29,8,
-16,22,6,13,14,3,16,17,4,23,28,7,16,19,4,14,16,4,28,33,9,27,31,8,17,19,5,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,13,11,3,35,25,11,
-9,5,4,0,0,0,26,22,6,30,21,10,0,0,1,16,14,4,39,29,12,3,1,2,18,24,5,98,96,28,149,136,46,170,171,59,214,220,79,223,226,81,214,218,75,178,184,65,
-27,75,90,59,145,159,85,193,202,88,195,204,79,187,192,69,185,192,54,154,167,38,123,131,28,110,114,25,95,103,27,100,93,21,81,58,16,68,45,11,41,40,1,6,7,0,0,0,
-1,1,3,9,8,38,15,11,48,7,6,28,32,22,90,69,34,136,53,35,121,19,25,82,26,28,112,56,39,144,104,44,150,77,38,137,35,33,123,39,37,117,28,22,82,19,19,69,
-41,46,123,31,30,91,13,9,41,27,19,69,35,28,81,26,17,54,23,17,46,22,12,35,15,5,15,19,5,15,22,7,23,24,15,42,16,10,27,4,1,3,13,3,10,15,4,13,
-8,2,6,8,2,6,8,2,6,10,3,9,11,3,10,5,2,4,0,0,0,3,1,2,8,2,6,5,1,5,2,0,2,6,1,4,5,1,4,3,1,2,2,0,2,2,0,2,
-2,1,2,4,3,3,11,13,6,10,11,4,5,5,3,4,4,3,3,1,2,2,1,2,2,1,2,3,5,3,4,5,3,2,2,0,1,0,0,1,2,1,2,4,1,3,4,1,
-3,3,1,2,3,1,1,3,1,1,2,1,1,2,1,1,2,0,1,1,0,2,2,0,2,2,0,2,1,0,2,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,
-1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,2,2,1,2,2,1,3,3,1,3,3,2,3,3,
-4,4,2,4,5,4,6,7,6,5,7,6,5,7,4,6,7,5,9,9,7,8,8,8,5,6,8,10,9,6,12,13,7,11,12,6,12,15,10,17,20,16,14,17,12,9,8,4,
-1,0,0,7,9,7,17,21,11,8,11,3,6,10,2,8,13,3,11,10,3,19,22,6,11,17,5,1,1,0,0,0,0,0,0,0,7,12,3,5,9,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,3,3,1,9,9,2,13,15,3,15,17,4,16,16,4,20,20,5,17,17,4,12,12,3,25,26,8,27,28,8,23,25,7,24,25,7,26,28,8,
-19,24,6,13,15,4,16,16,4,23,27,7,18,22,5,12,14,3,26,29,8,26,29,8,17,17,4,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,8,7,1,33,25,10,
-12,7,6,0,0,0,20,17,5,32,24,10,3,0,3,10,8,2,38,28,11,6,4,3,2,4,0,81,76,22,152,138,47,165,164,58,210,217,78,224,227,82,217,221,77,181,189,65,
-32,86,102,65,159,172,88,200,208,88,196,204,76,188,193,67,179,190,51,145,160,34,118,125,22,89,94,22,80,89,30,95,90,20,71,53,11,47,30,3,10,12,0,1,1,0,0,0,
-2,2,8,10,10,44,8,8,36,4,5,24,34,23,95,59,32,129,43,33,112,18,24,82,28,30,118,62,41,145,97,43,146,59,34,128,31,31,117,41,37,115,25,19,75,22,22,75,
-43,49,127,30,27,83,19,10,46,32,22,76,37,30,84,28,24,65,24,19,50,23,13,40,17,7,21,19,5,15,22,8,26,23,15,42,13,7,21,4,1,3,15,4,12,14,3,12,
-7,2,5,9,2,7,9,2,6,10,3,9,9,3,9,3,0,2,0,0,0,4,1,3,8,2,6,4,1,3,2,0,1,4,1,3,4,1,2,3,1,1,2,0,2,2,0,2,
-2,1,2,4,4,3,11,13,6,7,9,3,5,5,3,4,3,3,3,1,2,1,0,1,2,2,2,3,5,3,4,4,3,2,2,0,1,2,1,1,2,0,2,3,1,3,4,1,
-3,3,1,2,3,1,2,3,1,1,2,1,1,2,0,1,2,0,2,2,0,2,2,1,2,2,0,2,1,0,2,0,0,1,0,0,1,1,0,1,1,0,1,1,1,1,1,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,2,2,0,2,2,1,3,3,1,4,4,3,4,4,
-3,4,2,2,2,2,4,5,5,5,7,6,4,7,4,6,7,5,9,9,7,9,8,7,5,4,5,9,8,4,12,12,6,12,12,7,12,14,9,17,20,17,16,18,13,10,9,5,
-2,1,0,6,8,5,19,22,12,12,16,4,5,8,2,8,14,3,10,11,3,21,25,7,16,23,6,1,3,1,0,0,0,0,0,0,7,11,3,7,11,3,0,0,0,0,0,0,
-0,0,0,1,1,1,1,1,0,2,2,1,8,8,2,13,13,3,16,18,5,17,17,4,21,21,6,20,20,5,15,15,3,23,24,6,26,27,8,23,25,6,23,25,6,27,28,8,
-20,25,7,13,16,4,15,14,4,19,23,6,17,21,6,10,12,3,24,28,7,26,29,8,18,18,5,7,7,2,0,0,0,0,0,0,0,0,0,0,0,0,4,3,1,30,23,8,
-15,10,6,0,0,0,7,8,2,24,17,8,6,3,3,5,5,2,35,26,11,10,7,4,0,0,0,60,56,17,150,135,49,164,161,57,206,213,77,224,227,82,219,223,78,186,194,66,
-35,95,111,71,175,185,90,204,211,87,196,204,74,182,191,67,171,186,51,141,156,32,113,120,20,83,87,23,81,89,31,97,91,20,67,48,9,36,22,1,4,6,0,0,0,0,0,0,
-2,2,9,10,10,45,6,6,29,6,6,31,24,21,90,34,27,111,27,29,99,19,22,80,30,30,118,67,48,148,89,47,144,46,31,123,29,32,116,41,36,113,22,16,70,26,28,87,
-43,48,127,28,22,75,25,15,56,37,28,86,37,31,84,27,23,63,24,19,51,21,13,39,17,6,20,20,5,16,21,9,27,22,15,40,12,5,17,5,1,3,15,4,14,12,3,10,
-7,2,5,9,2,7,8,2,6,10,2,9,6,2,5,1,0,0,0,0,0,5,2,4,7,2,4,2,1,1,2,0,1,4,1,3,3,1,2,3,1,1,2,0,2,2,0,2,
-2,0,2,6,5,4,11,14,6,6,8,3,5,5,3,4,2,3,3,1,2,2,0,1,2,3,3,3,5,3,3,3,2,3,3,1,3,3,1,1,1,0,2,3,1,3,3,1,
-2,3,1,2,4,1,2,3,1,1,3,1,1,2,0,1,2,0,2,2,0,2,2,1,2,2,0,2,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,1,1,1,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,2,1,0,1,1,0,1,1,0,2,2,1,3,3,1,4,4,2,4,4,
-2,2,2,1,2,1,3,3,4,4,6,6,4,6,4,5,7,4,9,8,6,9,8,6,4,3,3,7,5,2,12,12,4,12,13,7,11,13,7,15,19,16,16,18,14,12,12,6,
-3,2,0,4,6,4,18,21,12,13,17,5,5,8,2,8,14,3,9,11,3,21,24,6,18,26,7,4,6,1,0,0,0,0,0,0,8,11,2,10,15,3,0,1,0,0,0,0,
-0,0,0,5,5,2,5,5,1,2,2,1,7,7,2,12,13,4,17,19,5,18,18,5,20,20,5,23,23,6,17,17,4,22,23,6,26,27,7,23,25,6,23,25,6,26,28,7,
-22,27,7,14,18,4,12,12,3,15,18,5,14,20,5,7,10,2,22,25,7,26,30,8,19,20,5,9,9,2,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,31,24,8,
-21,14,7,0,0,0,0,0,0,3,2,2,2,1,2,3,3,0,36,27,10,14,8,6,0,0,0,53,50,15,146,132,48,162,156,57,203,209,75,223,227,83,220,225,78,193,200,69,
-40,107,123,76,188,197,91,207,213,84,191,199,74,177,188,67,167,183,50,139,152,30,110,116,19,81,86,24,84,90,32,98,90,12,36,28,4,9,11,2,2,6,0,0,0,0,0,0,
-4,4,14,11,11,48,6,6,26,8,8,34,19,20,83,22,22,93,19,26,83,18,21,77,36,29,115,76,50,148,83,44,140,42,30,119,33,33,117,41,35,110,20,15,68,31,33,100,
-43,47,126,26,20,70,30,24,72,41,36,94,36,32,84,26,22,62,26,18,50,22,14,39,17,6,18,20,5,16,21,10,30,21,15,39,11,4,14,6,2,5,16,4,14,10,3,8,
-7,2,5,9,2,7,8,2,7,9,2,8,3,1,3,0,0,0,0,0,0,6,2,4,6,2,3,0,0,0,2,0,2,4,1,3,3,4,3,3,4,3,1,0,2,2,2,2,
-3,3,2,7,8,4,11,13,5,6,6,3,5,5,3,3,2,2,3,1,2,2,1,1,2,4,3,3,5,3,3,3,2,3,4,1,3,3,1,1,2,1,3,4,1,3,4,1,
-2,3,1,2,4,1,2,3,1,1,2,1,1,2,0,2,2,1,2,2,1,2,2,1,2,2,0,2,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,1,0,0,1,0,0,2,2,0,1,1,0,1,1,0,2,2,1,3,3,1,4,4,1,4,4,
-1,3,2,1,2,1,1,3,4,2,6,6,3,5,4,4,6,4,8,8,6,9,9,8,4,4,3,5,4,1,11,10,3,12,13,7,11,12,6,14,17,14,16,19,15,13,13,8,
-5,3,1,2,3,3,16,19,12,13,17,6,4,7,2,10,14,3,13,13,3,20,22,5,19,27,7,5,8,2,0,0,0,0,0,0,7,9,2,11,16,4,1,2,1,0,0,0,
-0,0,0,5,5,2,7,7,2,2,2,1,7,8,2,12,13,4,17,19,5,19,19,5,17,17,5,22,22,6,18,18,5,22,22,6,26,27,7,24,25,7,22,25,6,26,27,7,
-23,27,7,13,18,5,12,12,3,10,14,4,11,18,4,6,7,2,19,20,5,25,27,7,19,20,5,10,10,2,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,32,24,8,
-24,16,9,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,33,25,10,19,11,7,0,0,0,42,40,11,141,127,45,162,153,57,198,204,73,223,226,83,221,225,79,201,208,72,
-44,119,135,79,197,204,91,209,215,82,187,196,72,177,187,64,165,176,47,135,146,28,101,108,18,75,81,23,76,85,25,72,72,6,15,15,2,0,7,1,1,4,0,0,0,0,0,0,
-4,4,16,11,11,51,6,6,26,7,7,35,17,17,73,17,17,72,13,20,60,17,18,68,38,29,110,83,51,146,83,42,139,42,30,115,35,33,113,41,34,107,21,16,68,35,37,109,
-43,47,124,26,18,66,34,30,82,44,43,102,36,32,83,25,22,60,27,18,50,21,12,36,17,4,16,20,5,17,22,11,33,21,14,37,9,3,10,8,2,6,16,5,16,10,5,15,
-8,3,8,9,2,7,7,2,6,8,2,7,3,1,3,0,0,0,1,0,1,5,1,4,3,1,2,0,0,0,2,0,2,3,2,3,4,8,5,2,5,3,1,0,0,4,3,2,
-4,6,1,8,11,4,10,12,4,5,5,3,5,4,3,3,1,2,2,1,2,1,1,2,3,4,3,3,5,3,3,3,1,4,5,2,3,3,2,2,2,1,3,4,1,3,4,1,
-2,3,1,2,3,1,1,2,1,0,1,0,0,1,0,2,2,1,2,2,1,2,2,1,2,2,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,1,0,0,1,0,0,2,2,0,1,1,0,0,0,0,2,2,1,3,3,1,3,4,1,4,4,
-1,3,3,1,4,3,1,3,4,1,4,5,1,4,4,3,5,3,7,8,6,8,8,8,4,4,4,4,3,1,11,10,3,12,13,7,11,12,6,13,17,12,15,19,15,13,14,9,
-6,5,2,1,2,1,15,18,11,17,19,8,4,7,2,9,13,3,16,16,4,20,21,5,20,28,7,7,11,3,0,0,0,0,0,0,5,6,1,11,16,4,1,3,1,0,0,0,
-0,0,0,4,4,1,8,8,2,2,2,1,7,8,2,12,13,3,16,18,4,19,20,5,16,16,4,21,21,6,19,19,5,20,21,6,27,27,7,25,26,7,22,24,7,25,25,7,
-23,25,7,12,16,4,12,12,3,10,13,3,11,18,5,6,9,2,15,15,3,22,23,6,18,18,4,11,11,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,29,23,7,
-29,20,10,1,0,1,0,0,0,0,0,0,0,0,0,1,1,0,31,24,8,23,15,8,0,0,0,34,33,8,133,119,42,153,144,54,189,196,69,221,226,81,223,226,80,202,208,71,
-50,135,148,83,206,212,91,210,215,81,187,196,74,181,190,63,164,174,44,128,139,25,81,91,16,56,64,23,73,82,22,64,65,4,12,12,2,0,6,1,1,3,0,0,0,0,0,1,
-4,4,19,12,12,50,4,4,18,4,4,17,12,12,54,11,11,49,12,19,52,17,16,65,39,29,107,85,52,145,77,41,136,36,27,105,34,32,107,44,33,104,23,17,70,39,41,114,
-45,46,119,29,19,65,38,34,86,44,44,102,34,30,81,26,21,59,27,17,49,22,18,39,19,15,25,21,8,20,21,11,34,20,13,36,6,2,8,8,2,6,15,5,15,10,7,21,
-9,3,10,8,2,6,6,2,5,7,2,6,2,1,1,0,0,0,1,1,1,5,1,4,1,0,1,0,0,0,3,1,2,4,2,3,4,9,5,1,4,2,1,0,1,4,5,2,
-4,6,1,9,11,4,9,11,4,5,5,3,4,4,3,3,1,2,2,0,2,1,1,2,3,4,3,3,4,2,3,3,1,4,6,3,3,4,3,2,2,1,3,4,1,3,3,1,
-3,4,1,2,3,1,1,2,1,0,1,0,0,0,0,2,2,1,2,2,1,2,2,1,1,1,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,1,1,1,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,0,0,0,0,0,1,2,1,3,3,1,3,4,1,4,4,
-1,4,3,1,4,3,1,4,4,1,3,5,1,4,5,3,5,3,5,6,5,6,6,6,2,2,3,3,2,0,10,9,2,12,13,7,11,12,6,12,15,11,14,18,15,13,14,10,
-7,6,2,1,1,0,12,15,6,20,21,6,6,9,2,8,13,3,15,16,4,19,19,5,22,28,7,8,13,4,0,0,0,0,0,0,3,4,1,11,16,4,4,8,2,3,5,1,
-0,0,0,4,4,1,10,10,3,2,2,0,6,7,2,12,13,3,16,18,4,20,20,5,15,16,4,20,20,6,20,20,5,18,19,5,26,27,7,25,26,7,23,25,7,24,25,6,
-22,23,6,10,13,3,11,11,2,9,11,3,10,16,4,6,9,2,12,12,3,22,23,6,14,14,3,4,4,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,29,23,6,
-31,21,11,2,1,2,0,0,0,0,0,0,0,0,0,0,1,0,30,24,8,28,19,10,0,0,0,25,22,6,109,94,34,133,128,46,180,191,62,220,225,79,223,227,80,202,208,71,
-55,149,162,86,211,216,90,211,216,80,188,196,73,183,192,62,163,173,43,123,134,20,49,63,10,20,32,22,70,78,23,68,65,4,8,12,2,1,8,1,1,3,0,0,0,0,1,1,
-4,5,23,12,12,51,3,3,15,1,1,3,5,5,21,7,8,30,11,18,52,19,16,67,43,31,111,89,52,147,75,38,133,34,26,102,35,32,107,45,31,102,24,17,67,40,42,114,
-45,42,114,31,18,64,40,36,90,44,43,101,32,28,77,25,20,57,28,19,49,24,34,51,24,34,42,23,15,27,22,12,35,19,12,33,5,1,5,8,2,5,14,5,14,10,7,20,
-9,3,9,7,2,5,5,1,4,6,1,5,1,0,1,0,0,0,2,1,1,5,1,4,1,0,1,0,0,0,3,1,2,3,3,3,4,9,4,1,3,1,1,0,1,4,5,2,
-4,6,2,9,12,4,8,10,4,4,5,3,4,4,3,2,1,2,2,1,2,2,2,2,3,5,3,3,4,2,3,3,2,4,6,3,3,4,2,2,3,1,4,4,1,4,4,1,
-3,4,1,2,4,1,2,2,1,0,1,0,0,0,0,2,2,0,2,2,1,2,2,0,1,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,1,2,1,2,3,1,3,4,1,4,4,
-1,4,4,1,4,3,1,4,4,1,4,5,1,4,5,3,5,3,4,6,4,4,5,5,2,2,3,2,1,1,9,8,2,12,13,6,11,12,6,11,15,10,13,18,15,13,13,7,
-8,6,2,1,1,0,9,11,3,19,21,5,10,13,3,11,17,4,15,17,4,19,17,5,22,28,7,11,17,4,0,0,0,0,0,0,4,5,1,12,17,4,9,15,4,9,13,4,
-0,0,0,4,4,1,10,10,3,3,3,1,5,6,2,11,13,3,17,18,4,20,20,6,16,16,5,19,19,6,21,21,5,18,18,5,24,25,7,25,26,7,23,25,6,24,25,6,
-23,24,6,10,13,3,11,11,2,8,9,3,7,11,3,5,10,2,11,11,3,22,22,6,13,13,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,21,6,
-33,23,11,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,28,23,7,26,17,9,0,0,0,20,17,4,98,80,30,120,117,42,171,185,57,220,225,77,224,227,81,206,211,73,
-59,161,172,87,215,219,89,212,217,80,190,199,71,180,189,60,157,169,42,120,132,19,36,53,10,15,30,23,72,80,21,63,61,4,7,13,3,2,10,1,1,2,0,0,0,1,1,3,
-5,6,23,11,11,51,4,4,15,0,0,0,0,0,0,5,6,21,11,19,52,20,17,70,44,30,109,88,52,142,71,38,131,33,26,101,36,33,108,43,30,99,23,17,65,43,43,114,
-46,42,112,33,19,65,42,37,92,45,44,102,33,29,79,26,20,56,28,21,51,25,44,57,27,45,52,24,18,30,22,13,36,18,11,30,4,1,4,8,2,6,13,5,16,9,6,20,
-9,3,8,7,2,5,3,1,2,4,1,3,0,0,0,0,0,0,3,1,2,4,1,4,1,0,1,0,0,0,2,1,1,3,3,3,4,9,4,1,1,1,1,0,1,4,6,2,
-4,6,2,10,12,4,6,8,3,5,5,3,4,3,3,2,1,2,3,2,2,3,5,3,3,5,3,3,3,2,4,4,2,4,6,3,3,4,2,3,4,1,4,4,1,4,4,1,
-3,4,1,2,4,1,2,2,1,0,1,0,0,0,0,2,2,0,2,2,0,2,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,1,0,0,0,0,1,1,0,2,1,0,2,1,0,1,0,0,1,1,1,2,2,1,3,3,1,4,4,
-1,4,4,1,4,3,1,4,3,1,3,5,1,4,5,3,5,3,4,6,3,4,5,4,2,2,3,1,1,1,7,7,2,11,12,6,10,11,6,11,14,9,13,18,15,12,12,6,
-9,6,2,1,1,0,8,10,3,20,21,5,13,17,4,13,20,5,16,19,4,19,19,4,21,28,7,14,20,5,1,1,0,2,3,0,10,15,4,18,26,6,11,18,4,12,16,4,
-1,1,1,3,2,1,10,10,3,4,4,1,5,5,1,11,13,3,17,18,5,20,22,6,18,17,5,19,19,5,21,21,6,18,18,4,24,24,7,26,27,7,23,25,7,23,24,6,
-24,24,6,12,14,3,11,11,2,8,8,2,5,9,2,5,9,2,10,10,2,22,21,6,14,14,4,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,18,5,
-33,24,10,4,2,2,0,0,0,0,0,0,0,0,0,0,0,0,25,20,6,25,17,8,0,0,0,15,13,3,93,76,29,117,113,40,169,184,57,220,225,77,225,227,81,205,212,74,
-63,170,180,87,217,221,88,212,216,79,190,199,70,176,185,58,154,165,41,116,129,20,34,54,13,20,38,22,66,75,17,47,48,4,5,12,2,3,11,1,1,2,0,0,0,1,1,2,
-6,6,25,11,11,49,2,2,9,0,0,0,0,0,0,5,8,23,14,19,54,22,17,73,41,30,104,81,48,136,66,35,127,32,26,100,38,35,109,42,29,97,22,17,66,45,43,115,
-47,40,106,33,18,60,42,39,92,47,47,106,36,33,84,27,20,57,27,22,50,26,47,59,27,45,52,24,16,30,22,12,37,17,10,29,4,1,3,9,2,7,13,5,16,9,6,19,
-8,2,7,7,1,4,2,1,2,3,1,2,0,0,0,0,0,0,2,1,2,3,1,3,1,0,1,0,0,0,1,0,0,2,4,2,4,8,5,1,1,1,2,1,1,4,6,2,
-5,7,2,10,13,4,6,8,3,5,5,3,3,2,2,2,1,2,4,5,2,5,6,2,3,3,2,3,3,2,4,4,2,4,6,3,4,4,2,3,4,1,4,4,1,4,4,1,
-3,4,1,2,4,1,2,2,1,0,0,0,0,0,0,2,2,0,2,2,0,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,1,0,0,0,0,1,1,1,2,1,1,2,1,0,1,1,0,1,1,1,2,2,1,3,3,1,4,4,
-1,4,4,1,4,2,1,3,3,1,3,4,1,4,5,2,4,3,3,6,3,4,5,4,3,3,3,1,1,1,6,6,1,8,9,5,7,10,6,10,13,8,13,18,15,13,13,7,
-10,7,2,2,1,0,6,9,2,19,21,5,14,17,5,13,20,5,18,23,6,22,23,6,23,28,7,15,22,5,1,2,0,2,4,1,15,24,6,24,33,8,13,20,5,12,17,4,
-2,2,1,1,1,1,10,10,3,4,4,1,3,3,1,11,13,3,17,17,5,22,23,6,19,19,5,18,18,5,21,21,6,17,18,4,22,23,6,26,27,7,24,25,7,23,24,6,
-23,23,6,12,14,4,11,11,3,9,8,2,5,8,2,6,10,2,8,9,2,21,21,5,14,14,4,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,4,2,
-11,7,4,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,22,18,5,32,23,10,1,0,1,13,12,3,91,73,28,118,113,40,169,182,56,219,225,77,225,227,81,204,213,73,
-66,176,186,87,217,221,86,211,216,77,189,197,70,175,185,57,151,162,41,112,126,21,33,54,15,24,44,18,48,59,13,29,36,3,2,12,3,3,11,0,0,1,0,0,0,1,1,2,
-6,6,27,11,11,50,3,3,11,0,0,0,0,0,0,4,5,15,15,15,43,28,19,75,42,30,104,78,47,133,66,35,126,33,25,94,39,33,105,41,28,94,23,17,66,44,43,114,
-43,35,97,31,19,55,41,39,91,47,48,107,36,35,87,27,20,57,28,22,50,25,47,58,27,43,50,23,15,29,21,13,37,16,10,27,3,1,3,10,2,7,12,5,16,7,6,16,
-6,1,5,4,1,3,3,1,2,3,1,2,0,0,0,0,0,0,2,1,2,2,1,2,0,0,0,0,0,0,0,0,0,2,4,2,3,8,4,0,1,1,1,1,1,4,6,2,
-5,7,2,9,12,4,4,7,2,4,5,2,3,2,2,3,2,2,5,5,2,5,5,2,3,3,2,3,3,1,4,5,2,4,6,3,3,4,2,3,3,1,3,4,1,3,4,1,
-3,4,1,2,3,1,1,2,1,0,0,0,0,0,0,2,1,0,2,1,0,1,1,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,1,0,1,2,1,1,2,1,0,2,1,0,1,1,1,2,2,1,3,3,1,4,4,
-1,3,3,1,3,2,1,3,3,1,3,3,1,4,4,1,3,2,2,3,3,4,5,4,3,3,3,1,0,1,3,3,1,5,8,3,4,7,5,7,10,7,13,18,15,13,13,8,
-10,7,2,2,1,0,6,7,2,19,20,5,14,18,5,13,20,5,19,24,6,23,26,6,22,28,7,14,20,5,2,2,0,2,4,1,15,23,6,24,35,9,13,20,5,12,17,4,
-3,4,1,1,1,1,11,11,3,8,8,2,4,5,1,13,15,3,18,18,5,22,23,6,20,21,5,18,18,5,22,22,6,16,17,4,20,21,6,25,26,7,24,25,7,21,23,6,
-20,21,5,12,15,4,11,11,3,9,9,2,5,8,2,6,10,2,8,8,2,20,20,5,16,16,4,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,17,4,37,26,11,2,0,1,10,9,2,89,72,27,110,103,38,156,170,53,217,224,76,225,228,81,205,214,72,
-68,184,193,88,218,221,85,209,215,76,189,196,69,175,185,54,141,153,34,90,104,19,23,46,13,13,33,13,22,34,9,10,18,3,2,13,3,3,11,0,1,1,0,0,0,1,1,4,
-6,6,27,10,10,46,3,3,10,0,0,0,0,0,0,2,1,2,13,6,23,30,18,72,46,33,107,79,47,134,61,33,120,34,23,85,41,33,102,40,26,90,24,18,67,46,44,115,
-42,33,93,33,23,63,43,43,99,47,48,107,35,35,84,27,20,57,27,24,51,25,48,59,28,45,54,23,14,29,20,13,36,16,12,34,4,3,9,9,2,6,10,5,16,4,5,14,
-3,1,2,3,1,3,3,1,2,3,1,2,0,0,0,0,0,0,3,1,2,2,1,2,0,0,0,0,0,0,0,0,0,3,4,3,3,8,4,0,0,0,1,1,0,4,6,2,
-4,5,2,7,8,3,3,4,2,4,5,2,3,5,3,3,6,4,5,6,3,5,5,2,3,3,2,3,3,1,3,5,3,4,6,3,3,3,2,2,2,1,2,3,1,3,4,1,
-3,4,1,2,3,1,1,2,1,0,1,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,1,0,1,2,1,1,2,2,0,2,1,0,0,1,0,1,1,1,2,2,1,3,4,
-1,2,3,1,2,2,1,3,3,1,3,3,1,3,3,0,2,2,0,2,2,3,4,4,3,3,4,0,0,0,1,1,0,5,8,3,4,7,5,5,9,6,11,17,15,12,13,8,
-11,8,2,3,1,0,4,6,2,18,20,5,14,18,4,12,19,4,18,24,6,23,25,6,20,25,7,11,15,4,2,1,0,2,4,1,16,25,6,26,37,9,14,22,5,12,17,4,
-5,6,2,4,3,1,12,12,3,10,10,2,5,7,1,18,21,5,19,20,6,23,23,6,20,21,5,18,18,5,22,22,6,16,17,4,19,20,5,24,25,7,23,24,6,17,19,5,
-17,18,4,11,13,3,7,8,2,6,6,1,4,7,2,6,11,3,7,8,2,20,20,5,15,15,4,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,16,4,30,21,9,1,0,2,8,8,1,84,68,24,104,90,36,143,157,48,215,223,74,226,228,81,205,214,72,
-71,191,199,87,218,221,85,208,213,76,188,196,69,173,183,51,126,140,29,64,82,17,13,36,11,7,26,9,5,17,7,2,11,3,4,13,2,3,9,0,0,0,0,0,0,1,1,4,
-3,3,14,3,3,15,0,0,2,0,0,0,0,0,0,0,0,0,11,3,14,32,19,73,49,33,108,80,46,132,59,30,113,33,22,79,41,33,98,39,26,88,28,20,69,49,46,117,
-42,33,93,35,25,70,45,46,106,48,48,108,34,34,83,27,20,55,29,35,58,27,58,68,31,50,63,23,15,33,19,12,35,14,13,35,3,3,10,8,1,5,8,5,15,3,4,13,
-3,1,2,3,1,2,3,1,2,3,1,2,0,0,0,0,0,0,3,1,2,2,1,2,0,0,0,0,0,0,0,0,0,3,5,3,3,8,4,0,0,0,1,1,0,5,7,2,
-3,3,2,3,2,1,2,2,0,3,6,2,2,8,4,3,8,5,5,7,4,4,5,2,2,2,1,2,2,1,4,5,3,4,6,4,3,3,2,2,2,1,2,3,1,3,4,1,
-3,3,1,2,3,1,1,2,1,0,0,0,0,1,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,1,0,1,2,1,1,2,2,1,1,1,0,0,0,0,1,1,1,3,2,1,3,3,
-1,2,3,1,2,2,1,3,3,1,3,3,1,3,3,0,2,1,0,2,2,3,4,4,3,3,4,0,0,1,1,1,0,5,7,2,4,6,3,4,7,5,9,15,13,11,12,8,
-11,8,2,3,2,1,4,6,2,17,20,5,15,18,5,12,19,4,18,23,6,23,25,6,19,23,6,9,12,3,2,1,0,2,4,1,19,29,8,29,41,10,15,22,6,13,18,4,
-10,11,3,6,6,2,12,12,3,10,10,3,7,10,2,23,30,8,19,20,6,22,22,6,20,21,6,18,18,5,22,22,6,17,17,4,18,19,5,25,25,7,23,23,6,16,16,4,
-14,14,3,9,11,3,3,4,1,0,0,0,3,5,2,5,10,3,5,6,2,14,14,3,11,11,3,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,16,4,28,19,9,1,0,1,10,9,2,80,63,23,84,66,31,126,140,42,215,223,74,226,228,81,206,214,73,
-70,194,201,85,219,222,83,207,213,75,188,196,66,172,182,47,116,131,25,50,69,16,9,33,11,8,28,9,4,17,8,3,12,3,4,13,3,3,10,0,0,1,0,0,0,2,2,5,
-1,1,4,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,13,4,16,35,19,74,48,31,102,70,43,123,53,27,105,32,20,75,40,31,98,39,26,88,32,21,70,51,47,117,
-42,32,91,35,26,72,46,47,108,48,48,108,34,33,81,27,22,57,31,44,66,30,70,78,31,55,66,22,14,32,19,12,35,14,13,35,5,11,17,9,6,9,8,5,15,3,5,14,
-3,1,3,3,1,2,3,1,2,2,1,2,0,0,0,0,0,0,2,1,2,2,1,1,1,1,0,2,3,1,1,1,0,2,5,3,3,7,4,0,0,0,1,2,1,7,10,3,
-2,3,1,1,0,0,1,2,0,3,7,2,3,9,4,4,8,5,5,7,4,4,5,3,2,2,1,2,2,1,4,5,2,4,5,3,3,3,2,2,2,1,3,3,1,3,3,1,
-3,3,1,2,2,1,1,1,1,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,1,2,2,1,2,2,1,2,1,0,1,1,1,2,2,1,3,3,1,3,3,
-1,2,3,1,2,2,1,3,3,1,3,3,1,3,3,0,0,1,0,2,2,3,4,4,3,3,4,0,0,1,1,1,0,3,4,1,2,2,0,4,7,4,7,13,13,7,10,8,
-9,8,2,3,2,1,3,6,1,15,17,4,14,18,5,12,18,4,17,24,6,23,25,6,20,24,6,10,13,3,5,6,1,5,9,2,22,32,8,31,42,11,15,22,5,13,18,4,
-11,13,3,7,7,2,12,12,3,11,10,3,7,9,2,23,30,8,18,19,5,21,21,6,21,21,6,18,18,5,21,21,6,17,17,4,17,19,4,23,24,6,21,22,6,14,15,4,
-12,12,3,9,11,3,2,3,1,0,0,0,1,1,1,2,2,0,2,2,0,10,10,2,6,6,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,16,5,36,26,12,3,1,2,7,6,2,67,52,19,70,54,24,122,137,40,216,224,75,227,228,81,207,215,74,
-71,198,204,85,221,224,84,211,214,73,190,197,64,171,181,45,116,130,25,52,71,16,10,34,11,8,28,12,5,20,10,4,17,4,4,14,3,3,11,2,3,7,1,1,2,2,2,6,
-2,2,5,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,13,4,17,35,20,75,47,31,98,58,38,112,44,24,91,35,21,74,46,34,102,40,25,87,32,21,70,51,47,117,
-42,33,90,35,26,71,46,47,109,48,48,108,34,33,82,28,22,57,32,50,70,31,75,82,30,55,66,20,14,30,18,12,34,14,14,36,8,24,29,12,20,22,8,7,17,5,8,24,
-5,5,14,2,1,2,3,1,2,2,1,2,0,0,0,0,0,0,2,1,2,1,0,1,1,1,0,6,9,2,2,3,0,1,5,3,2,7,4,0,0,0,2,2,1,7,11,3,
-2,3,1,1,0,0,1,2,0,5,8,3,5,11,6,5,10,6,5,7,3,5,5,2,3,4,2,3,3,1,4,5,2,4,6,3,3,4,2,2,2,1,3,3,1,3,3,1,
-2,3,1,1,2,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,1,2,2,1,2,2,1,2,2,0,1,1,1,2,2,1,3,3,1,3,3,
-1,2,3,1,2,2,1,3,3,1,3,3,1,2,2,0,0,0,0,2,2,3,4,4,4,4,4,1,1,1,0,0,0,0,0,0,0,0,0,4,6,4,7,13,13,6,9,8,
-9,7,2,3,2,1,4,6,1,14,17,4,13,17,4,11,17,4,15,20,5,22,25,6,20,23,6,11,16,4,11,16,4,9,14,4,22,32,8,30,42,11,17,25,6,14,20,5,
-11,13,3,7,7,2,12,12,4,12,11,3,8,11,2,22,29,8,18,19,5,21,21,6,21,21,6,17,17,5,20,20,6,17,17,4,17,18,4,21,23,6,21,21,5,14,14,4,
-12,12,3,9,11,3,2,3,1,0,0,0,0,0,0,0,0,0,1,1,0,8,8,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,15,4,40,29,13,3,1,2,9,9,1,63,48,19,66,50,23,123,138,40,217,224,75,226,228,81,208,216,74,
-72,201,207,85,223,226,85,214,218,73,192,198,62,169,179,45,115,130,26,52,71,16,9,34,11,8,27,14,5,23,14,5,21,5,4,14,3,4,14,3,5,14,1,2,5,2,2,7,
-2,2,7,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,14,5,18,36,19,76,47,30,95,57,36,107,46,23,87,37,21,73,46,34,101,39,25,88,32,21,69,50,43,114,
-41,30,87,35,26,71,47,47,108,48,47,107,34,32,81,28,21,55,33,50,69,33,75,81,31,55,66,20,14,30,17,12,34,14,15,36,9,26,31,13,24,26,8,6,18,7,11,30,
-5,7,19,0,1,1,3,0,2,2,1,1,0,0,0,0,1,0,2,1,1,1,0,1,1,1,1,6,9,2,2,3,1,1,5,3,2,7,4,0,0,0,2,2,1,7,11,3,
-2,3,1,1,0,0,1,2,0,6,9,3,7,12,6,6,10,6,5,7,3,3,5,2,3,5,2,3,3,1,4,5,2,4,6,3,4,4,2,2,2,1,2,3,1,2,3,1,
-2,2,1,1,2,1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,1,2,2,1,2,2,1,2,2,0,1,1,1,2,2,1,2,2,1,3,3,
-1,2,2,0,3,2,1,3,3,1,3,3,1,2,2,0,0,0,0,2,2,2,3,4,3,3,4,1,0,1,0,0,0,0,0,0,0,0,0,4,6,4,7,13,13,6,9,8,
-9,7,2,3,2,1,4,6,2,14,18,5,13,17,4,9,14,3,13,16,4,22,24,6,19,23,6,12,16,4,14,20,5,10,17,4,21,31,8,31,42,11,23,32,8,21,29,7,
-12,15,3,8,7,2,12,12,3,14,14,4,9,12,3,22,29,8,18,19,5,21,21,5,21,21,6,16,16,4,18,18,5,16,16,4,17,18,4,21,22,6,19,19,5,14,14,3,
-12,12,3,9,12,3,2,4,1,0,0,0,0,0,0,0,0,0,1,1,1,9,9,2,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,15,4,32,22,11,1,0,2,7,6,1,63,49,17,72,59,25,131,146,42,216,224,75,227,228,81,209,216,74,
-71,200,207,86,224,227,84,216,219,71,189,196,59,157,169,45,112,128,27,55,75,18,10,36,13,9,29,15,6,24,13,4,22,4,3,13,4,5,17,3,5,16,1,1,4,1,1,4,
-1,2,4,0,0,1,1,0,1,5,2,4,2,1,1,1,0,0,17,5,18,40,21,77,48,30,96,56,36,107,47,24,87,37,20,72,46,33,100,40,26,88,32,20,67,48,38,108,
-40,28,85,35,26,70,47,47,107,47,48,104,32,30,76,25,15,45,32,47,65,34,75,82,31,56,67,20,13,30,17,11,34,13,14,36,9,26,31,12,22,24,7,7,16,7,11,30,
-4,7,19,0,0,1,3,0,2,2,1,1,0,0,0,2,6,3,2,5,2,0,0,0,1,1,1,6,9,2,2,3,0,1,4,3,2,7,4,0,0,0,1,2,1,7,11,3,
-2,3,1,0,0,0,1,1,0,5,8,3,7,12,6,7,11,6,5,7,3,3,5,1,3,5,1,3,3,1,3,4,2,4,6,3,4,4,2,2,2,1,2,3,1,2,3,1,
-2,2,1,1,2,1,1,2,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,1,2,1,1,2,2,1,2,2,0,1,1,1,2,2,1,2,2,1,2,3,
-0,2,1,0,3,2,1,3,3,1,3,3,1,2,2,0,1,1,0,1,1,1,2,2,1,1,3,0,0,1,0,0,0,0,0,0,0,0,0,3,6,4,6,11,10,6,8,6,
-9,7,2,3,2,1,5,6,2,15,17,4,13,17,4,9,14,3,13,16,5,22,24,6,19,23,5,12,16,4,14,20,5,10,17,4,21,31,8,31,42,11,26,36,10,25,34,9,
-12,14,3,10,10,3,19,23,6,20,23,6,9,13,3,21,28,7,18,19,5,21,21,6,21,21,6,16,16,4,18,18,5,16,16,4,17,18,4,20,22,6,17,17,5,9,9,2,
-11,11,3,9,13,3,2,3,1,0,0,0,0,0,0,0,0,0,1,1,1,8,8,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,11,3,20,12,7,0,0,1,9,8,1,64,50,18,84,74,28,140,157,47,215,222,75,227,228,81,210,217,75,
-72,201,207,85,225,227,82,217,220,68,182,190,56,150,162,44,112,128,28,56,77,19,10,37,15,13,34,16,11,29,14,6,22,4,4,14,4,6,17,3,5,15,1,1,4,0,0,0,
-1,1,3,2,2,7,2,1,3,8,2,5,2,1,2,1,0,0,19,6,18,43,22,76,48,30,96,54,35,101,46,22,80,38,19,68,44,32,101,36,24,85,32,19,67,47,37,106,
-39,26,81,35,26,70,48,50,110,48,51,106,30,30,73,21,9,30,31,44,59,34,76,83,31,57,68,21,17,36,16,11,35,11,14,35,9,25,31,11,23,25,7,14,22,8,17,34,
-5,8,21,0,0,2,3,0,2,2,1,1,0,0,0,2,8,4,2,9,5,0,0,0,1,1,1,6,9,2,2,4,0,1,4,3,2,7,4,0,0,0,2,4,2,8,14,4,
-2,5,2,0,0,0,0,0,0,4,7,2,7,12,6,7,11,6,5,7,3,3,5,1,3,5,1,3,3,1,2,3,2,4,5,3,4,4,2,2,2,1,2,3,1,2,3,1,
-2,2,1,1,2,1,1,2,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,1,2,1,1,2,2,0,1,2,0,1,1,1,2,2,1,2,2,1,1,2,
-0,1,1,1,2,2,1,3,3,1,3,3,1,2,2,0,1,1,0,0,0,0,1,1,1,1,3,0,0,1,0,0,0,0,0,0,0,0,0,2,4,2,4,6,5,3,4,3,
-4,3,1,2,1,0,5,7,2,15,18,5,13,17,4,9,14,3,14,16,5,23,24,6,19,23,5,12,16,4,14,20,5,10,17,4,22,32,8,29,39,10,25,34,9,26,35,9,
-12,14,3,13,17,4,27,36,9,26,34,9,11,19,5,18,26,6,17,18,5,21,21,6,21,21,6,16,16,4,18,18,5,16,16,4,17,18,4,19,20,6,13,13,4,4,4,1,
-10,10,2,9,12,3,2,3,1,0,0,0,0,0,0,0,0,0,1,1,0,7,8,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,1,0,0,0,8,7,1,66,51,18,92,85,31,145,161,48,214,222,75,226,228,81,212,219,75,
-72,203,209,83,225,227,80,217,220,65,181,189,55,147,160,44,114,129,28,58,79,19,13,39,16,18,37,18,18,34,15,8,23,5,4,15,4,5,18,3,5,15,1,1,4,0,0,0,
-1,1,3,2,4,12,2,2,5,9,2,6,3,1,2,1,0,0,18,5,13,40,18,62,47,28,88,51,30,89,43,16,58,35,16,50,36,29,88,28,21,73,31,18,61,47,36,106,
-40,27,83,35,25,70,49,54,113,50,57,111,29,32,77,20,11,36,30,45,62,34,76,83,31,59,71,23,22,45,16,13,38,11,13,34,9,28,34,11,29,30,9,24,30,10,27,42,
-5,10,23,0,0,2,3,0,2,2,1,1,0,0,0,2,8,4,3,10,5,0,0,0,1,1,1,6,11,5,4,10,4,1,6,4,2,8,4,0,2,1,4,9,3,9,17,7,
-3,7,3,0,0,0,0,0,0,4,6,2,7,12,6,7,11,6,5,7,3,3,5,1,3,5,2,2,3,1,2,2,2,4,5,3,4,4,2,2,1,1,2,2,1,2,3,1,
-2,2,1,1,1,1,1,0,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,0,1,0,0,1,1,0,1,1,1,2,1,1,2,2,0,1,1,0,1,1,1,2,2,1,2,2,0,1,1,
-0,1,1,1,3,2,1,3,3,1,2,2,1,2,2,0,0,0,0,0,0,1,1,1,1,1,3,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,0,0,
-0,0,0,0,0,0,5,7,2,15,18,5,13,16,4,9,14,3,14,16,5,23,25,6,18,22,5,12,16,4,14,20,5,10,17,4,22,32,8,27,37,9,24,33,9,26,35,9,
-11,13,3,15,19,4,32,44,12,28,44,13,15,33,12,21,30,9,18,18,5,22,22,6,21,21,6,16,16,4,17,17,4,16,16,4,17,18,5,19,20,5,12,12,3,4,4,1,
-10,10,2,7,8,2,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,7,8,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,10,2,66,52,19,95,87,31,150,164,49,214,222,74,227,228,81,211,219,76,
-70,204,210,84,225,228,81,218,221,67,183,190,55,147,160,39,105,119,26,51,72,21,14,40,16,20,38,19,20,34,14,8,24,5,3,14,4,6,19,3,5,15,1,2,5,0,0,0,
-1,1,4,2,3,13,2,1,5,9,2,6,5,1,3,5,1,3,18,4,10,35,13,43,44,26,79,50,30,85,45,15,52,36,13,41,33,23,69,23,16,53,27,15,50,46,36,103,
-38,26,80,34,24,68,49,54,112,50,57,110,28,34,77,19,16,47,31,50,69,32,76,83,29,61,73,24,28,54,14,9,31,9,10,27,10,35,41,11,41,40,9,32,35,10,29,43,
-5,11,23,1,1,3,3,1,3,2,1,1,0,0,0,2,7,4,3,10,5,0,0,0,1,2,5,8,15,12,6,16,9,3,12,6,2,8,4,1,3,1,6,12,3,10,18,7,
-4,8,4,0,0,0,0,1,1,4,7,3,7,12,6,7,11,6,5,7,3,3,5,1,3,5,2,2,3,1,2,2,2,3,5,3,3,4,2,2,1,1,2,1,1,2,2,1,
-2,2,1,1,1,1,0,0,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1,0,0,1,1,0,1,1,1,2,2,1,2,2,0,1,1,0,1,1,1,2,2,1,2,2,0,1,1,
-0,1,1,1,2,2,1,2,1,1,2,2,1,2,2,0,0,0,0,0,0,1,1,2,1,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,5,6,2,12,13,3,11,13,3,9,14,3,15,18,6,20,23,6,14,19,5,12,16,4,14,20,5,10,17,4,23,34,8,27,39,12,26,36,11,26,35,10,
-11,12,2,16,21,6,33,44,12,28,48,16,16,40,17,20,30,10,18,18,5,22,22,6,21,21,6,15,14,4,15,15,3,15,14,3,18,19,5,19,21,6,12,12,3,4,4,1,
-10,10,2,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,7,7,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,9,2,68,54,19,95,88,32,152,166,50,215,222,75,227,228,81,210,218,76,
-67,200,205,84,227,229,80,219,221,67,186,193,53,141,154,33,81,98,21,29,53,20,11,38,17,22,39,19,22,36,15,9,24,5,3,14,4,6,18,3,6,16,3,7,10,1,3,3,
-1,1,2,2,3,12,2,2,5,7,2,4,10,3,4,12,3,4,20,5,10,33,11,35,44,24,76,51,31,87,48,17,58,37,13,42,33,22,65,21,14,41,26,13,42,43,33,95,
-37,26,76,33,22,64,47,52,110,49,54,108,31,34,79,21,20,55,33,51,75,33,75,85,29,63,74,24,29,53,12,6,21,7,6,18,10,35,42,11,46,44,9,36,37,11,31,43,
-7,13,27,3,5,14,3,2,7,0,0,1,0,0,0,1,6,3,2,10,5,0,0,0,2,2,7,8,17,17,7,21,13,3,14,7,2,8,4,2,4,1,8,14,4,11,19,7,
-4,8,4,0,0,0,0,4,2,4,10,4,7,12,6,7,11,6,5,7,3,3,5,1,3,5,1,2,3,1,1,2,1,2,4,1,3,4,2,2,1,1,0,0,0,1,1,0,
-1,0,1,1,0,1,0,0,0,1,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1,0,0,1,1,0,1,1,1,2,2,1,2,2,0,1,1,1,1,1,1,2,2,1,2,2,0,1,1,
-0,1,1,0,1,0,0,0,0,1,2,2,1,2,2,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,0,4,3,1,8,8,2,8,10,2,10,16,5,17,23,9,19,24,7,12,17,4,13,17,5,15,20,5,10,17,4,25,35,9,30,43,16,29,42,17,26,35,11,
-10,11,2,17,23,6,33,45,12,28,48,15,17,39,17,19,28,8,16,16,4,22,22,6,19,19,5,10,10,2,12,12,3,13,14,3,14,16,4,17,19,4,12,12,3,4,4,1,
-10,10,2,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,12,3,70,55,20,95,90,31,157,172,51,216,223,76,227,228,81,209,216,74,
-64,195,202,81,227,229,79,220,222,67,186,194,52,139,153,32,70,88,18,13,38,20,11,37,17,26,42,19,26,39,16,11,26,4,4,15,4,5,18,5,8,19,4,11,16,1,7,6,
-1,1,3,3,5,13,2,2,6,8,2,5,12,4,6,17,4,5,22,5,10,33,11,33,44,24,76,49,30,85,43,15,50,35,13,38,34,22,64,23,15,42,26,12,39,42,32,92,
-35,24,74,32,21,61,46,50,108,48,53,107,34,35,79,22,21,56,32,49,73,33,75,85,28,64,74,24,31,54,12,6,22,7,4,15,10,33,41,11,46,46,9,36,36,10,32,43,
-7,14,31,6,9,23,3,5,14,0,0,0,0,0,0,1,6,3,3,13,7,0,2,0,1,1,6,8,15,17,7,22,13,3,15,7,2,6,3,1,2,1,8,14,3,10,18,6,
-5,10,4,0,0,0,0,4,2,4,10,5,7,12,6,6,11,5,5,8,4,3,5,1,3,5,1,2,4,1,1,1,1,2,3,1,3,4,1,2,1,1,1,0,0,1,0,0,
-1,0,1,1,0,1,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1,0,0,1,1,0,1,1,1,2,2,1,2,2,0,1,1,1,1,2,1,2,2,0,2,2,0,1,1,
-0,1,1,0,0,1,0,0,1,1,2,3,1,2,2,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,0,3,2,1,4,3,1,8,6,2,8,9,2,11,19,7,19,27,12,16,21,7,6,9,2,12,15,4,15,20,5,11,18,4,26,37,10,31,45,18,31,46,19,25,33,10,
-10,11,2,20,27,7,37,51,14,29,50,17,17,39,16,19,27,8,16,15,4,22,21,6,18,21,7,9,15,5,13,16,5,13,12,3,10,12,3,14,15,4,10,10,3,4,4,1,
-10,11,2,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,12,3,70,56,20,97,93,33,163,179,55,220,225,77,227,228,81,208,216,74,
-64,195,201,80,227,229,78,221,223,68,188,194,55,147,157,34,75,93,19,14,40,20,13,38,18,29,44,20,31,43,17,14,29,5,2,13,4,4,16,5,10,21,6,14,23,2,8,8,
-2,4,7,4,6,18,2,2,6,8,2,6,13,3,6,18,4,6,22,5,11,32,10,30,44,23,74,41,28,77,30,11,35,34,12,33,34,22,64,24,17,46,24,10,33,39,27,82,
-36,25,77,32,20,58,45,47,103,46,52,106,35,37,81,23,21,56,31,45,71,33,74,86,26,66,74,23,33,56,13,7,24,9,6,20,11,34,45,11,48,47,9,37,36,11,33,43,
-7,16,32,6,9,25,4,6,16,0,0,0,0,0,0,3,9,5,6,23,11,2,9,4,1,1,4,7,13,16,9,22,14,3,15,7,1,3,2,0,0,1,7,13,3,10,19,7,
-5,11,6,0,0,0,0,3,2,4,9,5,7,12,6,7,11,5,5,8,4,2,5,1,3,5,1,3,5,1,1,1,1,2,2,1,2,4,1,1,1,1,1,0,0,1,0,0,
-1,0,1,1,0,1,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,0,0,1,1,0,1,1,0,1,1,0,2,2,0,2,2,0,0,1,1,2,2,1,2,2,0,2,2,0,1,1,
-0,1,1,0,0,1,0,0,1,1,2,3,1,2,2,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,0,3,3,1,5,4,1,8,6,2,8,10,2,11,20,8,20,28,12,14,18,6,3,3,1,12,14,4,14,20,5,12,19,4,27,38,10,30,45,18,31,45,17,26,34,10,
-17,21,5,28,37,10,44,58,17,31,53,18,17,38,16,19,31,11,17,21,7,21,20,5,19,28,11,14,34,14,16,27,10,13,13,3,10,10,3,13,13,3,10,10,2,4,4,1,
-11,11,2,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,7,2,57,46,16,99,97,33,169,184,57,223,227,78,227,228,81,209,217,74,
-63,194,199,81,229,230,78,223,224,67,187,192,56,153,157,37,89,102,19,16,43,20,12,39,19,29,44,21,32,44,18,17,30,5,2,11,2,3,11,6,8,22,11,15,25,6,10,11,
-3,7,11,5,7,19,3,2,7,7,2,5,12,3,5,19,5,7,25,6,14,33,10,30,44,22,73,39,28,75,26,11,30,35,11,32,32,17,52,22,13,36,22,7,22,35,19,63,
-34,22,71,32,19,56,44,45,99,45,52,106,35,38,84,23,21,57,30,41,69,31,73,86,25,68,74,21,36,56,12,8,27,12,12,33,14,38,54,14,54,54,10,41,40,10,33,43,
-8,18,33,6,7,25,4,6,17,0,0,1,0,0,0,4,14,8,8,30,14,5,17,9,1,1,4,7,14,16,10,25,16,5,18,8,1,3,2,0,0,0,7,11,4,11,20,10,
-7,15,9,0,2,2,0,1,1,3,9,4,6,12,6,7,11,5,5,8,4,1,2,1,2,3,1,3,5,1,2,2,1,1,2,1,2,4,1,1,1,1,0,0,0,1,0,0,
-1,0,1,1,0,1,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,2,2,0,1,1,0,1,1,1,2,2,1,2,2,0,2,2,0,1,1,
-0,1,1,0,0,1,0,1,1,1,3,3,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,1,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-2,1,0,3,3,1,4,3,1,5,4,2,7,11,2,12,21,9,20,27,12,13,17,6,3,3,1,13,16,5,14,20,5,14,21,4,27,40,11,30,44,18,31,45,18,26,35,10,
-24,31,8,35,45,12,45,60,17,29,51,18,18,39,16,21,40,16,20,34,13,20,22,7,20,38,16,18,51,22,17,34,14,14,17,6,11,21,7,12,14,4,10,9,2,4,4,1,
-8,8,2,3,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,48,40,12,98,99,32,172,187,58,222,226,78,227,228,81,206,214,73,
-59,187,193,81,229,230,79,225,226,66,187,194,53,148,152,37,94,104,17,19,45,20,11,38,19,28,44,20,32,43,19,18,32,6,5,14,2,3,12,6,9,22,16,17,27,11,10,12,
-3,7,11,5,7,19,6,3,9,11,3,6,12,3,6,18,5,7,28,7,18,35,10,31,44,21,70,42,28,77,28,12,34,34,11,29,32,14,47,18,6,19,20,5,13,32,16,53,
-31,19,60,30,16,49,42,42,96,45,53,106,34,37,83,21,20,55,27,37,64,28,69,81,22,70,74,21,39,59,11,10,29,11,12,33,15,40,57,17,61,62,12,48,46,10,34,42,
-10,22,37,7,12,27,5,11,21,1,1,3,0,0,0,4,16,9,9,34,18,6,23,12,1,2,3,6,15,16,11,28,20,6,22,12,1,5,3,0,0,0,6,10,3,12,20,11,
-9,18,12,1,5,4,0,0,0,3,7,4,6,11,6,7,12,6,4,8,5,0,1,1,1,2,0,3,5,1,2,2,1,1,2,1,2,4,1,1,2,1,0,0,0,0,0,0,
-1,0,1,1,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,1,1,1,2,2,1,2,2,0,2,2,0,1,1,
-0,1,1,0,0,1,0,1,2,1,3,3,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,2,0,3,3,1,2,2,1,1,2,1,8,12,3,13,22,9,17,26,12,11,15,5,4,4,1,15,18,5,15,21,5,18,25,6,30,41,12,30,44,19,31,45,17,26,34,9,
-26,35,9,37,48,13,44,59,17,26,49,18,18,39,17,22,42,17,22,39,16,21,23,8,19,40,17,16,50,23,13,30,14,16,33,14,13,41,16,9,20,8,7,6,2,1,1,1,
-2,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,53,43,14,101,103,32,175,190,59,222,226,78,227,228,81,199,208,70,
-56,178,185,81,229,231,79,226,227,68,192,198,52,143,147,38,101,109,16,23,46,18,11,38,19,27,44,20,33,44,20,21,34,8,10,20,2,6,14,5,7,20,15,15,26,14,12,14,
-3,7,10,6,7,19,11,3,10,17,4,7,14,4,6,18,4,6,28,7,18,35,10,28,43,20,64,42,29,79,30,15,39,33,11,27,32,13,42,18,5,14,19,5,10,29,14,46,
-28,14,45,27,13,40,41,40,92,45,53,107,34,35,81,17,13,42,24,31,59,27,65,77,22,70,75,22,44,62,11,12,31,10,9,30,15,38,56,17,63,65,13,52,49,10,35,40,
-11,30,42,9,25,36,6,22,27,2,4,6,0,0,0,4,16,10,9,35,20,7,26,13,1,3,3,4,12,14,12,30,22,7,26,15,2,8,5,0,0,0,4,8,2,11,20,10,
-10,20,13,3,8,5,0,0,0,1,6,3,6,12,7,7,12,7,4,10,5,0,2,1,1,1,0,3,5,1,2,3,1,1,1,1,2,4,1,1,3,1,0,0,0,0,0,0,
-1,0,1,1,0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,1,1,0,1,1,0,0,1,0,1,1,
-0,1,1,0,0,1,1,2,2,1,3,3,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,2,1,1,2,2,1,1,0,0,0,0,0,0,0,0,0,0,0,
-2,2,1,4,3,1,2,2,0,1,3,0,7,12,3,13,23,10,17,26,11,10,12,4,4,5,1,16,20,6,16,22,6,22,28,8,31,43,14,30,45,19,32,44,17,26,35,10,
-27,36,10,38,50,14,44,59,18,23,46,18,19,38,16,22,43,18,21,36,16,19,21,7,16,40,18,11,46,20,8,23,11,15,39,17,14,51,23,7,23,11,6,5,1,0,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,4,1,57,48,15,106,110,35,181,196,61,222,226,79,226,228,81,191,201,67,
-53,171,177,79,229,231,80,227,229,68,198,203,50,139,143,34,88,95,15,19,42,18,11,38,20,26,44,19,33,44,22,25,38,11,16,27,3,11,17,5,7,19,14,15,26,14,12,16,
-3,7,10,6,8,20,14,4,12,20,5,8,15,4,7,16,4,5,27,7,18,34,10,25,38,13,41,40,25,67,31,17,44,32,10,25,33,13,41,23,7,18,17,4,9,26,12,40,
-28,12,43,24,8,29,40,37,87,46,54,109,36,37,83,16,12,40,21,26,53,27,63,77,23,72,76,23,49,65,12,14,35,8,7,26,14,33,52,17,62,65,14,54,53,9,35,35,
-9,31,41,10,31,41,8,28,32,2,7,9,0,1,2,5,19,16,10,37,25,8,30,16,2,7,4,4,11,12,12,31,23,10,30,18,3,14,8,0,0,0,3,5,1,11,19,9,
-10,20,13,4,11,6,0,0,0,1,5,3,5,12,7,7,13,7,5,9,4,1,2,1,0,0,0,3,5,1,3,4,1,1,1,0,2,3,1,2,3,1,0,0,0,0,0,0,
-1,0,1,1,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,1,1,1,1,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,
-0,0,1,0,0,1,1,2,3,1,2,3,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,2,2,1,2,2,1,1,1,0,0,0,0,0,0,0,0,0,0,
-2,2,1,4,3,1,2,2,0,1,2,0,5,9,3,13,23,10,17,25,10,9,11,3,6,7,2,17,22,6,16,21,6,24,31,8,31,43,15,30,45,19,34,46,19,28,42,16,
-29,40,12,40,53,15,44,61,19,21,45,18,19,37,16,21,41,18,20,32,13,16,19,7,14,42,19,10,43,19,4,18,9,13,40,19,13,52,25,7,21,10,6,5,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,5,1,62,52,18,111,117,37,188,202,64,224,227,79,225,228,81,184,194,65,
-50,165,172,78,229,231,78,228,229,70,204,208,49,139,144,32,78,83,14,16,39,18,11,38,19,25,43,19,32,44,23,27,42,12,19,32,5,14,21,4,7,18,15,16,28,15,14,18,
-3,8,9,5,8,20,13,5,14,21,4,8,16,4,8,16,4,5,27,7,17,33,9,24,35,9,24,38,21,54,31,19,48,31,9,24,35,14,44,23,7,21,18,4,8,24,11,35,
-28,12,46,22,7,25,35,29,75,44,49,103,37,41,85,18,15,44,20,22,49,27,58,75,23,73,76,23,54,68,14,21,41,6,6,24,12,27,48,17,59,64,15,57,56,9,36,35,
-9,30,38,10,31,42,9,30,34,4,14,16,1,4,4,5,21,19,10,38,28,9,33,20,4,16,9,3,12,12,12,30,24,11,32,21,5,19,11,0,1,0,1,2,0,9,17,7,
-11,21,13,5,13,9,0,1,0,1,4,3,5,12,6,7,13,7,6,9,4,2,2,0,0,0,0,2,3,1,3,3,1,1,1,0,1,2,1,2,3,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,1,1,1,1,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,
-0,0,1,0,0,1,0,2,2,0,1,1,1,1,2,1,1,1,0,1,1,0,1,1,0,0,0,1,1,1,2,2,2,2,2,1,1,1,0,0,0,0,0,0,0,1,1,0,
-2,2,1,4,3,1,2,2,0,1,0,0,5,7,3,13,22,10,17,23,9,9,10,3,9,9,3,18,23,6,16,21,6,26,34,9,31,44,16,30,45,20,33,48,20,29,46,20,
-31,43,13,44,58,16,47,65,20,21,44,18,19,37,15,20,40,17,21,32,13,20,29,10,18,50,22,10,41,19,3,16,9,10,42,19,11,48,23,7,17,8,6,4,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,9,2,69,62,20,119,129,39,193,206,66,225,227,80,225,228,81,180,190,62,
-46,152,160,76,229,231,76,228,229,71,209,213,51,145,151,34,84,88,14,18,40,17,11,37,19,22,42,19,33,44,23,29,43,14,23,35,6,18,24,4,9,19,14,16,29,17,15,21,
-4,7,8,4,8,18,13,7,16,22,5,10,16,4,9,15,3,5,28,7,16,35,9,24,35,9,23,37,19,47,32,22,53,30,9,22,34,13,39,25,8,26,19,5,8,22,8,24,
-26,10,33,19,5,17,29,22,60,40,40,97,38,40,87,20,17,47,18,18,45,27,52,71,23,72,77,23,59,69,16,33,48,6,15,25,11,21,43,17,55,63,16,60,59,9,39,37,
-9,30,37,10,32,41,9,32,37,7,27,28,3,11,12,4,18,17,9,36,28,10,36,21,6,24,14,3,15,13,10,26,22,11,32,22,6,23,14,1,3,2,0,0,0,8,14,6,
-11,21,12,7,16,11,0,2,2,0,2,2,4,10,6,7,12,7,6,9,4,2,3,1,0,0,0,1,0,0,1,1,0,0,0,0,0,1,0,1,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,
-0,0,1,0,1,1,0,1,1,0,1,1,1,1,2,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,2,2,2,1,1,1,0,0,0,0,0,0,1,1,0,3,3,1,
-4,4,1,4,3,1,1,1,0,2,1,0,7,10,5,13,21,10,13,17,6,7,7,2,10,12,3,18,23,6,17,21,6,26,35,9,29,43,16,29,44,20,28,44,20,27,43,19,
-32,45,13,47,61,17,45,65,21,20,43,18,19,37,15,19,41,18,23,36,13,33,49,17,29,64,27,9,38,18,3,16,9,11,45,21,11,47,23,7,14,6,5,3,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,15,4,87,84,26,131,144,44,195,207,66,226,227,80,223,227,80,173,183,59,
-40,136,145,73,226,228,75,228,229,72,214,217,51,152,157,35,92,93,15,22,41,16,8,35,20,21,42,19,32,44,23,31,43,17,28,39,7,22,27,5,12,22,15,20,35,18,17,26,
-5,8,9,3,8,17,14,12,22,22,11,15,17,5,11,15,3,5,30,8,16,37,10,25,35,10,23,34,13,33,30,16,40,29,8,20,35,13,39,26,9,30,19,5,9,19,5,11,
-23,7,20,18,4,13,24,15,46,36,34,89,37,38,86,22,21,53,14,14,39,23,46,66,23,67,74,21,51,62,18,35,51,9,28,36,10,18,40,16,50,61,17,62,62,10,43,41,
-9,29,35,10,31,41,10,31,39,8,32,34,4,18,18,4,18,15,9,36,29,10,37,24,7,27,17,4,17,13,9,24,21,13,32,23,7,27,16,1,7,4,0,0,0,6,10,3,
-10,21,11,6,17,11,2,5,3,0,1,0,2,8,5,5,11,7,5,9,4,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,
-0,0,1,0,1,1,0,1,1,1,1,2,1,1,2,1,1,2,1,1,1,0,0,0,0,0,0,1,1,2,2,2,2,1,1,1,0,0,0,0,0,0,2,2,1,4,4,1,
-4,4,1,4,3,1,1,1,0,3,3,1,8,14,7,11,19,9,9,11,4,6,5,1,13,15,4,18,23,6,16,20,5,22,30,8,24,38,16,29,43,20,27,43,19,27,42,17,
-34,46,13,49,64,18,41,63,22,19,43,20,20,38,16,20,43,20,27,45,17,40,62,22,32,68,30,9,35,17,3,19,10,12,52,25,12,52,27,8,14,7,3,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,23,6,103,104,31,144,159,49,198,209,68,226,228,80,220,225,79,164,174,55,
-35,123,131,72,223,226,75,228,230,72,217,219,52,160,165,37,102,102,18,35,49,15,10,34,18,18,38,17,31,42,23,31,43,18,29,40,7,24,30,8,14,23,20,21,35,21,19,28,
-6,8,8,5,9,17,18,17,26,24,18,22,19,9,13,15,3,5,30,8,15,37,10,25,36,10,24,33,8,22,27,8,20,27,7,15,35,13,37,28,10,34,20,5,11,18,4,7,
-22,6,14,18,4,12,22,13,38,33,31,82,38,38,88,25,25,59,11,11,37,20,38,61,22,57,67,17,42,53,17,31,51,11,38,44,9,18,37,15,43,57,17,63,64,12,47,45,
-8,30,33,10,33,42,10,32,40,9,34,36,7,25,25,5,24,18,10,37,29,12,40,27,9,31,20,6,23,18,8,26,23,13,32,24,9,29,18,3,12,7,0,0,0,4,8,3,
-10,19,10,6,19,12,2,8,6,0,0,0,2,6,4,3,10,6,3,8,4,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,
-0,0,1,0,1,1,0,1,1,1,1,2,1,1,2,1,1,2,0,1,1,0,0,1,0,1,1,2,2,2,2,2,2,2,2,1,0,0,0,0,0,0,3,3,1,4,4,1,
-4,4,1,3,2,1,0,0,0,4,4,2,10,17,8,11,18,8,7,8,2,6,6,1,15,19,5,18,23,6,15,18,4,18,27,8,22,36,16,28,43,20,27,43,19,28,42,16,
-37,49,13,50,65,19,37,62,24,21,46,23,22,40,17,22,46,22,31,52,19,42,68,25,30,67,29,6,27,14,5,21,10,14,59,29,16,64,38,11,25,13,3,1,0,0,0,0,
-0,0,0,0,0,0,1,7,4,2,11,6,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,31,8,111,112,34,152,166,52,202,212,69,226,228,81,214,220,78,149,160,49,
-32,116,125,69,217,221,75,229,230,74,220,222,56,169,174,39,111,110,21,48,57,15,15,37,19,16,37,17,30,41,23,32,44,19,29,41,7,25,30,9,14,23,23,20,35,23,20,30,
-8,8,8,4,8,15,20,18,28,28,20,25,23,12,17,19,4,7,28,7,14,37,10,24,36,10,24,31,8,18,26,6,14,25,6,12,33,11,30,30,12,39,20,5,13,17,4,7,
-22,6,13,18,4,12,18,9,29,30,27,77,38,39,91,28,29,66,11,11,36,18,32,57,22,53,66,13,41,49,13,28,49,12,40,47,8,20,36,14,35,54,17,62,64,13,52,50,
-8,32,33,10,37,43,11,39,44,11,39,42,8,34,35,7,30,22,10,38,28,12,42,30,9,33,21,7,28,23,7,28,25,11,32,26,9,30,20,4,17,10,0,0,0,3,8,4,
-10,19,10,8,20,12,3,12,8,0,0,0,0,3,2,2,9,6,2,8,5,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
-1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-0,1,1,0,1,1,0,1,1,1,1,2,1,1,2,1,1,2,0,1,2,0,1,2,1,1,2,2,2,2,2,2,2,2,2,1,0,0,0,1,1,0,4,4,1,5,4,1,
-4,4,1,1,1,0,0,0,0,6,7,3,11,19,8,11,16,7,7,7,2,8,9,2,18,22,6,18,22,6,15,19,5,17,27,9,23,37,17,29,43,19,26,43,19,29,41,15,
-40,52,14,50,66,20,31,60,26,19,44,21,21,40,17,22,47,22,30,52,19,38,68,26,24,61,27,4,21,11,6,28,14,16,66,36,19,72,45,13,35,17,2,1,0,0,0,0,
-0,0,0,0,0,0,3,17,10,4,21,13,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,43,11,122,125,39,164,180,56,209,217,72,226,228,81,208,216,75,134,145,44,
-29,111,118,67,212,216,75,230,231,73,223,225,57,178,182,41,120,117,23,57,64,15,17,37,19,15,37,16,28,41,22,32,44,21,30,42,9,26,32,9,17,25,21,19,34,24,22,33,
-10,9,10,3,7,11,19,17,28,28,21,26,27,15,20,23,6,10,28,7,12,36,10,24,35,9,23,30,8,15,28,8,15,24,6,13,31,10,25,30,12,40,19,5,13,16,4,6,
-21,6,11,16,4,9,13,6,19,26,23,68,37,37,91,29,27,63,11,8,29,17,26,51,23,52,68,13,45,51,11,27,48,12,39,50,9,24,36,11,26,45,17,59,63,14,56,55,
-8,35,34,10,36,40,12,44,47,12,44,46,11,41,42,8,32,25,10,37,26,12,42,32,10,36,22,8,30,23,7,28,25,8,31,28,9,31,24,6,22,14,0,3,2,2,6,3,
-10,19,10,10,20,12,5,15,10,0,3,2,0,2,1,2,8,5,2,10,6,1,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
-1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-0,1,1,0,1,1,1,1,2,1,1,2,1,1,2,1,1,1,0,1,2,0,1,2,2,2,2,2,2,2,2,2,1,2,2,0,1,0,0,2,2,2,4,4,2,5,4,1,
-4,2,1,0,0,0,1,1,0,8,10,4,11,19,9,10,14,6,7,6,2,11,12,3,20,24,7,17,20,6,13,16,5,14,24,10,25,39,18,28,42,19,25,42,18,28,41,12,
-42,55,14,48,66,20,26,56,25,18,41,18,18,39,17,21,47,22,30,54,18,38,70,29,20,54,24,4,22,12,11,47,23,19,78,44,20,74,45,13,35,17,0,0,0,0,0,0,
-0,0,0,0,0,0,5,20,12,5,20,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,47,12,125,131,41,173,188,59,213,221,74,226,228,81,200,209,71,123,135,39,
-27,105,110,65,207,211,75,230,231,72,226,227,55,183,186,41,127,123,30,80,79,15,21,40,18,13,37,17,27,41,19,32,44,20,30,42,10,27,33,8,21,26,20,20,33,25,22,35,
-12,13,15,2,7,10,16,15,26,27,20,26,27,16,20,23,6,10,26,6,11,36,9,23,35,9,23,30,8,14,29,8,13,26,7,14,30,8,21,31,12,42,17,6,15,13,3,4,
-20,5,9,14,4,8,7,3,11,19,19,58,35,36,90,29,26,62,10,5,21,13,19,42,23,49,68,16,49,55,10,27,41,12,35,48,9,30,39,8,18,35,15,53,59,16,60,60,
-10,42,39,11,38,41,13,46,48,12,46,47,12,44,46,8,33,30,9,34,24,12,41,32,11,39,26,9,31,23,7,28,25,8,31,29,9,32,27,8,27,18,1,8,5,1,3,1,
-8,16,8,11,21,12,6,17,10,2,6,3,0,0,0,1,7,4,2,10,6,2,7,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
-1,1,1,1,0,1,1,1,1,2,2,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-0,1,1,1,1,1,1,1,2,1,1,2,1,1,1,0,1,1,0,1,2,1,1,2,2,2,2,2,2,2,2,2,1,2,2,0,0,0,0,3,2,2,5,5,3,5,5,1,
-3,2,1,0,0,0,3,3,0,9,14,6,11,19,9,9,11,4,7,6,2,12,13,4,18,22,6,13,14,4,7,8,2,12,22,10,27,42,19,28,43,19,24,40,16,28,41,12,
-45,59,15,45,66,22,22,52,25,16,36,17,16,39,17,25,51,22,38,62,20,38,72,29,15,46,21,5,27,15,16,66,35,21,85,52,17,67,41,9,24,12,0,0,0,0,0,0,
-0,0,0,1,2,1,6,26,15,3,13,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,1,46,54,14,123,134,39,178,192,60,216,222,76,225,229,81,188,196,66,110,122,34,
-19,73,79,58,191,195,75,231,232,73,227,229,55,186,190,41,129,126,35,104,94,17,28,44,18,11,36,18,25,39,17,33,43,17,28,40,11,27,34,7,22,27,17,18,30,27,25,37,
-17,21,25,3,10,13,13,14,24,27,21,27,27,17,21,23,7,11,25,6,9,35,10,21,36,10,24,30,8,14,31,8,14,28,7,14,29,7,18,32,14,41,20,10,22,13,4,4,
-18,5,7,14,4,6,2,1,3,11,10,35,30,30,80,28,28,65,11,7,23,11,13,34,23,44,66,17,48,56,7,24,30,10,28,41,10,36,43,7,15,32,13,44,52,16,62,61,
-13,51,46,11,44,43,13,47,46,13,47,47,13,48,48,9,37,34,8,32,22,12,41,31,12,42,30,9,35,23,7,29,25,8,30,27,9,33,29,9,31,21,4,15,9,0,1,0,
-5,12,6,11,20,11,7,17,11,2,8,6,0,0,0,1,3,2,2,8,4,2,8,4,0,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
-1,0,1,1,0,1,1,1,1,2,2,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-1,1,1,1,1,1,1,1,2,1,1,2,1,1,1,0,1,2,1,1,2,1,1,2,2,2,2,2,2,2,2,2,1,1,1,0,1,1,0,3,4,3,6,5,3,6,5,2,
-2,2,0,0,0,0,5,5,2,10,17,9,11,18,8,7,8,3,7,6,2,11,11,4,13,15,4,9,8,2,5,6,2,15,27,13,29,43,19,27,42,19,24,41,17,31,45,13,
-48,63,18,40,64,24,14,42,21,10,28,13,18,42,20,35,61,24,51,76,27,41,76,31,10,37,17,7,32,18,19,75,41,21,84,52,14,59,34,3,13,7,0,0,0,0,0,0,
-0,0,0,1,5,2,7,30,18,2,8,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,29,6,64,81,20,129,145,40,184,197,61,218,223,76,222,228,80,174,182,60,97,111,29,
-13,53,60,51,170,175,75,230,232,74,228,229,58,194,197,39,129,129,38,112,101,17,38,50,17,11,35,18,24,39,16,34,44,17,29,41,12,28,36,8,25,29,15,16,28,29,27,40,
-25,27,32,7,15,18,11,13,23,26,22,29,27,19,23,24,9,13,24,6,8,33,9,19,36,10,25,30,8,15,30,8,14,30,8,15,28,7,15,33,15,37,23,17,33,13,9,8,
-16,4,5,15,4,5,1,0,0,4,1,6,21,19,54,29,31,69,15,12,31,9,8,26,20,33,59,17,36,51,4,15,19,8,20,32,11,41,47,8,16,31,11,33,44,16,61,58,
-15,56,50,11,46,41,12,46,43,13,50,46,14,52,49,11,42,41,7,31,23,10,39,28,12,43,32,10,36,24,8,31,25,8,29,26,9,32,29,9,31,24,6,22,13,0,2,1,
-2,7,3,8,17,9,7,16,10,3,11,8,0,2,2,0,0,0,1,3,3,2,7,4,1,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,
-1,0,1,1,0,1,2,1,2,2,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,
-1,1,1,1,1,2,1,1,2,1,1,2,1,1,2,1,1,2,1,1,2,2,1,2,3,3,2,3,3,2,2,2,2,0,1,0,2,1,2,5,5,4,6,5,3,6,4,1,
-1,0,0,1,0,0,7,9,5,11,20,10,10,16,7,7,6,2,8,7,2,10,10,3,11,10,3,8,6,2,6,9,4,18,32,15,28,43,19,25,42,19,27,45,19,36,52,16,
-49,65,19,32,61,25,8,33,18,7,24,11,21,48,22,43,68,25,55,82,30,34,71,30,6,29,14,10,42,22,19,81,44,20,82,52,11,48,27,1,7,3,0,0,0,0,0,0,
-0,0,0,1,9,5,6,26,16,1,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,43,9,95,113,29,144,161,46,190,202,65,219,224,78,220,226,79,164,172,56,84,98,24,
-10,41,48,43,149,156,75,229,232,74,228,229,61,204,206,39,135,137,35,120,106,19,51,58,16,12,35,17,22,39,16,35,44,18,31,42,13,28,38,7,26,30,14,16,27,32,26,40,
-32,32,38,11,19,21,8,14,21,25,25,30,29,23,24,26,14,18,24,8,11,31,9,17,36,10,25,32,8,18,30,8,13,30,8,15,27,7,14,32,14,32,26,22,39,15,14,12,
-16,5,5,17,4,5,3,1,1,1,0,0,13,9,25,26,28,61,19,17,41,7,5,20,17,23,50,16,22,45,2,3,8,5,10,22,12,39,47,8,24,35,9,23,38,15,56,56,
-16,58,53,12,47,41,12,45,41,13,50,45,15,53,50,13,47,46,7,32,27,9,35,24,12,42,33,10,37,25,9,33,24,8,31,26,9,31,28,9,31,25,7,25,16,1,6,3,
-1,3,2,4,12,7,5,14,9,3,12,8,2,6,3,0,0,0,0,0,0,1,5,2,1,7,3,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,1,
-1,0,1,2,1,2,2,1,2,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,
-1,1,1,1,1,2,1,1,2,1,1,2,2,1,2,1,1,2,1,1,2,2,2,2,3,3,3,4,3,3,2,2,3,0,1,2,3,2,3,5,5,4,6,5,3,5,3,1,
-0,0,0,2,2,0,9,13,7,11,20,10,9,12,6,7,6,2,9,8,3,11,10,3,11,9,3,7,5,2,7,14,6,19,33,15,24,38,17,24,42,18,29,48,20,41,57,17,
-48,66,19,23,55,25,5,25,15,10,29,14,26,53,24,47,72,24,53,83,31,26,62,26,4,24,12,13,53,28,21,86,50,20,80,51,8,38,21,0,1,0,0,0,0,0,0,0,
-0,0,0,3,15,9,6,23,14,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,49,61,15,114,131,35,155,170,50,196,208,68,220,226,79,215,223,78,155,163,52,77,92,23,
-9,36,43,37,132,139,73,226,228,75,228,229,66,213,215,39,144,147,32,121,107,21,66,67,16,13,36,19,18,38,16,33,43,18,31,42,15,27,37,7,30,32,12,19,27,31,23,37,
-35,33,40,15,22,24,5,12,19,24,25,31,33,30,28,31,23,25,25,16,18,30,10,17,36,9,24,33,9,20,30,7,13,31,8,15,27,7,14,28,10,19,25,19,26,16,16,14,
-14,7,6,17,4,5,6,2,3,0,0,0,9,5,13,22,23,52,20,21,48,8,5,19,14,18,43,18,20,47,4,2,11,2,3,12,10,33,44,10,31,39,8,16,34,14,49,53,
-16,61,56,13,50,43,11,43,39,13,48,44,14,53,48,14,51,49,9,36,32,8,32,22,12,41,32,12,40,30,10,34,25,9,32,26,9,32,26,9,31,25,8,28,19,4,15,10,
-1,5,3,2,10,5,3,13,7,3,12,9,3,10,7,0,2,2,0,0,0,1,3,2,1,7,3,1,3,2,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,
-0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,
-1,0,1,2,1,2,2,1,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
-1,1,1,1,1,2,1,1,2,2,1,2,2,1,2,0,1,2,1,1,2,3,3,3,4,3,3,4,3,3,2,2,3,1,2,2,4,4,4,5,5,4,5,5,1,2,1,1,
-0,0,0,5,5,3,11,16,9,11,18,9,8,9,3,7,6,2,9,9,3,11,11,3,10,9,2,6,6,2,10,20,10,17,30,14,17,31,14,24,43,19,31,49,19,46,60,17,
-42,64,21,15,47,23,4,21,12,13,35,17,31,58,25,50,75,24,49,82,32,18,51,23,4,24,12,16,67,35,24,95,58,22,84,51,7,32,18,0,1,1,2,7,5,1,2,1,
-0,0,0,5,23,14,5,23,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,11,2,62,75,18,124,138,38,165,180,54,203,213,70,220,226,79,207,216,73,134,140,44,62,73,18,
-7,30,32,29,111,115,69,219,222,75,228,230,68,219,221,42,154,158,32,117,107,24,81,76,14,16,36,20,21,39,18,42,48,18,34,44,16,28,38,9,33,34,10,21,28,28,21,34,
-37,35,43,20,27,29,4,12,18,22,24,30,36,33,30,33,28,28,26,20,24,28,13,17,35,9,21,33,10,20,30,9,14,31,8,15,28,7,15,26,8,16,23,16,19,16,17,14,
-11,8,6,13,3,4,8,2,3,0,0,0,6,2,6,19,18,43,22,26,55,10,7,23,11,13,35,18,24,52,7,7,22,1,4,7,9,28,38,11,38,44,7,15,32,12,38,47,
-16,61,58,13,52,45,9,38,31,11,45,40,14,54,48,15,52,50,11,41,40,7,31,22,11,39,29,12,43,35,11,38,28,9,33,27,9,32,26,9,32,26,9,30,24,7,24,20,
-3,11,8,2,10,5,4,13,7,4,14,9,3,12,11,3,8,7,0,0,1,0,1,1,1,5,3,1,6,3,1,2,1,1,4,1,1,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,
-1,0,1,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,
-1,0,1,2,1,2,2,0,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-1,1,1,1,1,2,1,1,2,2,1,2,2,1,2,0,1,2,2,2,2,4,3,3,4,3,3,3,3,3,1,2,3,2,2,2,5,5,4,5,5,3,5,3,1,0,0,0,
-1,1,0,7,8,4,11,17,9,10,15,6,7,7,2,7,6,1,10,9,3,11,11,3,9,7,2,6,8,3,12,25,12,16,28,14,18,34,15,26,45,20,32,48,17,45,60,16,
-33,60,22,9,37,20,5,21,11,17,42,20,37,63,24,54,80,28,43,78,32,11,38,17,6,31,16,20,78,43,26,100,64,22,84,49,6,23,12,2,12,7,7,30,18,1,5,2,
-0,1,1,6,26,15,3,11,7,1,2,1,1,6,3,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,16,4,73,87,21,137,152,43,178,193,60,210,217,73,220,226,79,195,204,68,108,110,34,37,42,11,
-3,14,15,20,79,82,63,209,212,74,230,230,71,223,225,45,164,168,25,96,85,24,84,71,12,21,37,16,16,34,21,54,54,18,39,47,17,28,39,9,33,34,7,22,26,24,18,32,
-38,35,44,25,30,33,5,14,18,19,20,27,37,33,31,36,31,29,29,24,26,28,16,19,33,9,18,34,14,21,29,15,16,30,9,15,28,7,15,27,7,16,26,14,18,18,18,16,
-9,9,7,7,2,3,7,2,2,0,0,0,4,1,2,16,13,32,22,27,55,14,12,32,7,8,25,15,22,49,9,13,33,4,15,11,8,32,31,11,41,42,8,19,32,11,27,41,
-15,59,56,14,53,46,8,33,24,10,39,33,15,55,49,15,54,50,13,47,45,8,32,26,9,35,25,12,43,36,12,41,32,9,34,27,9,32,27,9,32,26,9,31,26,8,29,24,
-5,16,14,2,9,5,4,15,7,4,14,9,2,10,8,3,10,9,0,3,3,0,0,0,1,3,2,1,6,3,1,2,1,1,3,1,1,4,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,1,
-1,0,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,
-2,1,2,2,1,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,
-1,0,1,1,0,2,1,0,2,2,1,2,1,1,2,2,1,2,3,3,2,4,4,3,4,4,3,2,3,3,1,2,3,4,3,4,5,5,4,6,5,2,3,1,1,0,0,0,
-2,2,1,8,8,4,10,11,5,9,10,3,6,6,2,7,6,1,11,10,3,11,11,3,7,6,2,5,11,5,13,27,12,16,28,14,22,39,16,26,45,19,30,44,14,40,56,16,
-23,53,22,6,28,16,7,24,11,20,48,23,42,68,23,56,84,33,35,75,34,7,33,17,11,49,27,23,91,53,27,102,66,19,75,43,3,11,5,5,22,13,8,38,24,1,3,2,
-2,7,4,7,29,18,2,5,3,4,16,8,6,28,13,2,7,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,24,6,86,99,26,149,165,48,190,203,64,214,221,75,218,226,78,178,186,62,76,73,23,20,22,5,
-2,9,9,11,48,50,56,191,194,75,231,232,73,226,227,50,179,182,23,92,84,26,88,71,12,31,42,10,8,26,17,47,48,19,45,50,17,29,40,11,33,34,8,27,29,20,19,31,
-37,33,43,30,35,38,7,20,22,16,18,25,37,34,32,37,32,29,32,28,28,31,24,21,33,12,18,34,15,22,27,17,18,26,9,14,28,7,13,27,7,15,27,12,17,21,19,17,
-11,13,9,2,2,2,6,2,2,2,1,0,2,0,0,12,7,19,20,20,44,15,12,28,6,4,16,10,20,45,9,16,38,5,16,16,7,33,18,9,39,31,8,26,31,9,21,37,
-14,54,52,13,53,45,7,32,24,8,32,25,15,54,47,16,57,48,14,51,47,8,36,33,8,32,21,12,41,34,12,43,36,10,36,28,9,33,27,9,32,26,9,31,26,8,29,25,
-6,22,19,2,10,8,3,13,7,4,15,8,2,8,5,2,8,9,1,7,6,0,1,1,1,3,3,1,4,3,0,1,1,0,2,1,1,4,1,1,2,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,
-1,0,1,1,0,1,0,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,1,0,1,1,0,1,1,0,1,
-2,1,2,2,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,0,1,
-1,0,1,1,0,1,1,0,2,1,2,2,1,2,2,2,2,2,4,3,3,4,4,4,4,4,4,1,2,3,2,2,3,5,5,5,6,5,4,6,4,2,2,0,0,0,0,0,
-5,5,3,8,8,4,8,8,3,8,7,2,6,6,1,8,8,2,11,11,3,10,9,3,6,5,1,4,8,4,11,21,9,15,29,14,25,43,19,25,42,18,31,43,12,34,50,15,
-13,38,17,4,20,11,10,30,14,22,52,23,46,71,23,55,88,38,26,66,32,7,34,19,18,72,40,26,98,61,27,100,63,14,57,32,3,13,6,9,39,24,6,28,17,0,0,0,
-3,14,7,6,25,16,0,2,1,7,32,15,9,41,19,1,6,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,41,9,101,116,30,159,175,52,195,207,67,215,221,76,215,223,77,160,167,54,60,57,18,14,17,4,
-1,3,3,4,23,23,48,168,171,74,231,232,74,227,229,56,194,196,25,100,97,25,90,71,14,45,49,6,6,21,15,41,41,19,51,53,17,29,42,13,31,37,8,32,32,17,22,32,
-36,34,43,35,40,44,12,27,28,14,21,24,37,35,33,38,33,29,34,30,29,33,27,23,34,15,18,34,13,21,28,18,19,23,10,13,28,7,13,24,6,12,25,9,14,20,17,16,
-13,15,12,2,3,2,6,1,2,4,1,1,0,0,0,6,3,6,11,6,16,12,5,13,6,2,6,6,11,28,6,10,26,3,9,11,7,30,13,8,37,22,8,32,29,8,20,33,
-13,49,49,14,56,49,9,38,31,6,27,20,12,48,41,16,58,49,15,54,46,11,42,40,7,31,23,11,38,29,12,43,36,11,37,29,9,32,25,9,33,26,9,31,24,8,29,24,
-7,26,22,4,14,12,2,10,6,4,16,8,3,11,5,1,6,6,2,8,9,1,4,5,2,6,6,2,5,5,0,0,0,0,0,0,1,4,1,1,4,1,0,0,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-1,0,1,1,0,1,1,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,1,2,
-2,1,2,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,1,1,1,1,1,
-1,0,1,1,0,1,1,1,2,1,2,2,2,2,2,2,2,2,4,3,3,4,4,4,3,3,4,1,2,3,3,3,4,6,5,5,6,5,3,4,2,1,0,0,0,1,1,1,
-7,6,4,8,8,4,8,7,3,6,6,1,6,5,1,9,9,3,11,11,3,9,8,3,4,4,1,4,4,1,11,14,6,18,34,15,26,45,20,24,40,14,35,47,12,27,42,13,
-5,20,10,4,15,7,12,37,18,27,57,23,51,77,26,49,86,40,16,51,25,9,41,23,22,87,50,27,102,67,24,93,57,9,37,21,7,30,16,12,52,32,4,17,10,0,0,0,
-5,22,13,4,19,11,1,5,3,9,42,20,8,34,17,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,2,4,0,48,60,14,120,136,37,165,180,54,197,207,68,214,221,76,208,218,74,139,142,45,44,42,13,11,17,4,
-0,0,1,1,9,9,38,141,143,72,229,231,74,228,229,61,206,208,28,112,112,25,90,72,18,60,57,5,6,19,11,32,31,19,60,54,21,33,43,15,31,37,8,35,33,14,26,33,
-34,32,43,38,41,46,18,32,34,10,20,23,34,33,32,39,35,30,34,30,30,32,28,25,34,18,19,34,11,20,30,18,20,22,12,14,27,7,13,24,6,10,22,7,9,18,15,13,
-14,17,13,4,6,5,5,1,1,5,1,2,0,0,0,1,0,0,4,2,4,9,3,5,7,1,1,2,2,7,1,2,7,1,1,2,5,23,12,8,35,18,9,38,29,7,26,32,
-12,47,47,16,61,54,12,45,38,7,29,21,10,39,32,16,57,49,16,55,47,14,48,44,8,33,28,8,34,24,12,42,35,11,38,32,8,32,24,9,32,26,8,31,24,8,28,23,
-7,26,22,5,19,16,2,10,6,3,14,7,4,16,8,2,9,6,2,8,9,1,7,7,2,6,6,2,7,7,1,2,2,0,0,0,1,1,0,1,4,2,1,4,4,1,3,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,1,0,0,1,1,0,1,1,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,1,2,2,1,2,
-2,0,2,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,1,1,1,1,1,1,1,0,
-1,0,1,1,1,2,1,2,2,1,2,2,3,2,2,3,2,2,4,4,4,4,4,4,2,3,3,2,2,3,4,4,5,6,5,5,6,4,2,3,0,0,0,0,0,4,4,2,
-8,8,5,8,8,3,7,6,1,5,4,1,6,6,2,10,10,3,11,10,3,7,6,2,2,2,0,5,4,1,12,18,8,20,38,16,23,43,19,24,38,12,33,46,11,17,32,11,
-3,19,10,8,28,14,16,44,21,36,63,23,55,83,32,42,83,40,9,39,21,13,55,31,25,94,57,28,104,69,20,81,48,7,27,15,13,56,33,12,52,33,2,7,4,1,3,2,
-6,27,17,3,9,6,2,11,5,12,50,24,8,37,21,1,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,8,12,3,8,12,3,1,1,0,17,24,5,74,90,22,135,151,43,171,185,57,197,208,69,213,221,75,198,208,70,115,116,37,31,29,8,9,15,3,
-0,1,1,0,1,1,26,106,106,68,223,224,74,228,230,65,214,216,35,137,138,28,105,84,23,79,68,6,13,26,6,19,21,18,58,51,25,41,47,21,32,39,9,34,34,11,29,33,
-30,28,40,41,40,46,26,35,38,8,20,22,29,31,31,40,37,32,35,33,31,32,30,27,34,21,20,34,10,19,30,16,21,20,14,15,26,10,14,26,8,12,20,5,7,18,12,10,
-16,18,14,7,9,7,3,1,1,7,1,2,1,0,1,0,0,0,0,0,0,6,1,2,9,2,3,2,1,0,0,0,0,0,0,0,3,14,7,8,34,17,9,38,26,7,28,29,
-10,36,37,15,59,50,13,52,42,10,39,29,9,37,29,14,53,47,17,57,49,15,52,46,10,38,36,8,30,22,10,38,30,11,40,34,9,33,26,9,32,26,9,33,28,7,28,23,
-6,24,21,6,22,19,3,12,10,2,10,5,4,17,9,4,15,8,3,11,9,2,10,10,1,5,5,2,7,7,2,7,6,0,2,1,0,0,0,1,3,1,1,6,5,1,5,5,
-1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,1,2,2,1,2,2,1,2,
-1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,1,1,1,1,0,1,1,0,
-1,0,1,1,1,2,1,2,2,2,2,2,3,2,2,4,3,3,4,4,4,3,3,4,1,2,3,2,2,4,5,5,5,6,5,4,5,3,1,0,0,0,0,0,0,6,6,5,
-8,8,5,8,7,2,5,4,1,5,5,1,8,8,3,11,10,5,7,6,3,2,2,0,2,2,0,7,7,2,13,24,11,19,39,18,17,35,15,21,32,8,25,38,9,9,24,11,
-6,27,15,14,48,24,21,53,25,44,70,23,54,87,37,30,70,34,7,33,18,18,70,40,26,99,63,28,106,71,16,65,38,7,29,17,19,79,50,13,54,35,2,9,5,7,30,16,
-9,41,24,1,3,2,5,22,10,14,58,31,12,54,33,3,13,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,8,9,2,34,44,10,25,31,8,3,3,1,42,56,13,112,132,34,154,170,49,174,189,59,200,211,70,214,221,75,186,197,65,91,89,27,20,20,6,8,13,3,
-0,1,1,0,0,0,17,72,72,61,210,212,74,229,230,70,221,223,45,168,169,29,115,93,26,92,73,9,25,35,6,11,17,17,61,50,26,48,50,25,33,41,11,34,35,9,31,33,
-27,26,37,44,41,47,38,53,50,10,27,27,23,30,30,40,41,36,39,37,33,35,35,32,33,26,22,34,14,20,30,14,21,17,15,15,22,12,14,28,12,14,21,5,7,19,9,8,
-16,18,14,11,13,9,2,1,2,7,2,2,2,1,1,0,0,0,0,0,0,5,1,2,10,2,3,4,1,1,0,0,0,0,0,0,1,5,3,7,29,14,8,35,21,8,34,29,
-6,24,22,12,48,35,13,52,39,11,46,33,10,43,32,13,48,42,17,57,49,15,53,45,12,44,41,8,30,24,8,32,20,10,38,29,10,35,28,8,32,26,10,34,30,9,30,25,
-6,24,21,6,23,21,5,17,15,2,9,6,3,14,7,5,18,10,4,15,11,3,14,13,2,8,8,1,6,6,3,10,8,2,7,4,0,0,0,0,0,0,1,5,3,1,6,5,
-1,4,5,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,
-1,0,1,1,0,1,1,1,1,1,0,1,1,0,1,0,0,1,0,1,0,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,1,2,2,1,2,1,0,1,
-1,0,1,1,0,1,1,0,1,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,1,1,1,1,1,1,1,1,1,0,1,0,1,
-1,0,1,1,1,2,1,1,2,3,2,2,4,3,2,4,3,4,4,3,4,2,3,4,2,2,3,4,3,5,5,5,5,5,4,2,3,1,0,0,0,0,2,3,3,7,6,5,
-8,7,4,6,5,2,2,1,1,5,5,1,10,9,5,11,10,6,3,2,1,0,0,0,3,2,0,8,12,6,10,26,12,10,29,15,9,22,10,19,28,6,16,29,8,5,22,11,
-10,36,20,16,52,27,28,58,24,51,76,26,51,88,40,17,52,25,8,39,22,22,85,49,29,105,71,27,102,68,11,45,25,10,44,26,22,91,59,12,49,29,4,20,9,13,57,29,
-9,39,23,0,1,0,8,36,16,14,62,35,11,46,29,2,6,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,26,26,6,58,66,16,35,38,10,7,8,2,67,83,20,136,153,43,161,175,52,180,193,61,205,215,72,212,221,75,170,179,58,66,62,20,9,9,2,8,13,3,
-0,0,0,0,0,0,13,55,55,55,194,195,73,230,230,73,225,226,55,192,195,32,129,112,27,102,76,13,43,46,5,5,16,14,48,41,22,52,51,25,33,41,12,33,35,9,33,34,
-21,24,32,42,38,45,46,69,61,17,40,37,17,28,28,40,41,37,40,40,34,35,36,33,32,29,25,35,20,22,31,13,20,17,16,17,17,12,13,29,14,16,20,6,9,15,7,7,
-14,16,13,13,16,12,3,4,3,7,2,2,4,1,1,0,0,0,0,0,0,2,1,1,6,1,2,2,1,1,0,0,0,0,0,0,0,0,1,5,21,11,8,35,18,9,39,29,
-6,24,19,9,39,23,14,53,36,11,45,30,12,47,33,11,43,34,15,53,45,15,54,43,13,47,43,9,35,33,7,27,15,9,34,21,10,37,29,8,31,25,9,32,28,9,32,28,
-7,26,22,6,24,21,6,23,19,3,12,10,2,10,6,4,17,9,4,17,11,3,14,13,4,13,12,3,10,8,3,11,8,3,11,8,1,4,2,0,0,0,0,2,0,1,6,4,
-1,6,5,1,4,4,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,2,0,2,2,0,2,2,0,2,1,0,1,
-1,0,1,1,0,1,0,0,0,1,0,1,2,0,1,1,0,0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,1,1,0,1,1,1,1,2,1,0,2,1,1,1,0,1,
-1,0,1,1,1,1,2,1,1,3,2,2,4,3,3,4,3,4,3,3,4,2,3,4,3,2,4,5,4,5,5,4,4,5,3,2,1,0,0,0,0,0,4,5,5,7,6,5,
-7,6,3,4,2,3,1,1,1,6,6,2,11,10,7,8,7,5,0,0,0,0,1,0,5,5,1,9,18,8,7,25,12,5,21,12,10,20,6,20,29,6,11,25,9,4,22,11,
-11,38,19,18,50,25,36,63,21,53,79,26,38,74,33,8,33,16,12,53,31,26,97,60,31,112,78,24,91,59,7,30,16,16,67,42,21,87,56,7,33,19,7,29,15,15,64,35,
-5,22,13,1,8,5,10,46,23,15,63,37,7,33,20,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,40,42,10,68,72,20,28,23,8,15,18,4,88,106,27,149,165,48,167,180,55,183,196,62,209,218,73,210,220,74,149,153,50,42,35,12,4,4,1,6,9,2,
-0,0,0,0,0,0,8,39,38,47,174,175,71,228,229,73,226,227,61,205,207,34,138,128,27,106,79,18,61,58,4,5,18,10,32,31,21,59,53,24,37,42,14,32,34,13,38,35,
-15,25,30,37,30,40,48,65,60,24,48,44,12,27,27,37,40,36,41,40,34,36,37,33,32,33,28,35,24,24,33,13,20,21,17,19,14,16,14,28,16,17,22,12,14,11,10,9,
-11,15,11,15,17,13,5,7,5,4,1,1,6,1,2,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,12,7,8,35,17,11,47,30,
-8,34,27,8,33,21,14,57,38,11,48,31,11,46,32,11,45,33,12,48,39,15,55,44,14,50,42,10,39,38,6,27,19,8,31,16,10,38,29,9,34,26,8,29,23,9,32,29,
-8,29,24,6,23,21,6,24,21,5,18,15,2,9,7,3,12,6,4,16,9,4,14,12,4,14,13,4,14,11,3,13,8,3,13,10,2,9,5,0,2,0,0,1,0,1,5,2,
-2,7,5,1,5,5,1,3,4,0,2,2,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,0,1,0,0,1,0,0,0,0,0,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,0,2,2,1,2,2,0,1,1,0,1,
-1,0,1,1,0,0,1,0,0,2,0,1,2,0,1,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,1,1,1,1,2,1,0,2,1,0,2,1,1,1,0,1,
-1,1,1,1,1,1,3,1,1,4,3,2,4,3,4,3,3,4,1,2,3,2,2,4,4,3,5,5,4,5,6,4,4,3,2,2,0,0,0,1,2,2,5,5,5,7,5,3,
-7,4,4,3,1,4,4,4,1,9,8,4,11,10,7,4,3,3,0,0,0,2,2,0,7,7,2,8,19,8,5,23,12,5,20,9,16,24,6,19,30,8,7,23,10,6,24,13,
-11,33,17,20,46,21,44,69,19,51,77,25,22,46,20,4,22,13,19,73,42,29,106,70,32,113,79,17,69,41,8,34,19,24,94,63,18,74,46,5,22,12,11,45,24,14,58,33,
-2,12,7,8,34,28,15,65,40,14,60,37,4,20,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,5,4,0,52,53,14,64,66,22,26,23,8,34,44,10,109,126,33,158,173,52,170,184,57,188,201,64,211,219,74,204,215,72,121,120,39,23,13,5,0,0,0,1,1,0,
-0,0,0,0,0,0,6,31,25,40,156,149,67,224,225,73,227,227,65,213,216,37,143,139,26,101,79,23,79,67,7,15,27,7,18,23,18,60,53,23,45,46,17,32,34,17,40,35,
-13,30,28,31,26,34,48,55,55,35,64,54,14,29,27,34,38,33,43,41,34,37,39,34,32,35,31,34,26,24,34,15,21,26,15,20,14,21,17,23,18,17,25,16,17,12,15,14,
-10,14,10,12,16,12,6,11,8,2,1,1,6,2,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,18,10,10,41,24,14,55,32,
-12,48,36,7,28,20,13,52,33,14,53,35,11,44,28,12,48,34,12,47,38,15,54,45,15,52,42,11,42,38,7,27,23,7,26,12,10,36,25,10,37,29,7,29,23,8,30,25,
-8,30,25,6,23,19,6,23,20,6,23,19,4,13,11,2,8,5,3,11,5,3,14,9,3,13,13,4,15,13,4,14,10,3,12,9,3,12,9,2,7,3,1,4,1,2,6,2,
-2,7,3,2,7,5,2,5,6,1,6,6,1,4,4,0,2,1,0,2,0,1,2,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,
-1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,1,2,2,1,2,1,1,1,2,1,1,2,1,2,
-1,0,1,1,0,0,2,0,1,2,0,1,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,1,1,1,1,1,1,0,2,1,0,1,1,0,1,0,1,1,1,1,
-1,1,1,3,1,1,3,3,2,4,3,4,4,3,4,1,2,4,1,2,3,3,2,5,4,4,5,5,4,5,5,4,4,1,1,0,1,1,0,5,5,5,6,5,4,6,4,3,
-5,2,4,2,1,3,6,5,1,10,9,6,8,7,6,0,1,0,0,1,0,5,4,1,7,7,2,4,10,5,4,18,10,7,17,7,19,27,6,14,27,9,5,22,11,8,28,14,
-11,32,16,28,53,18,49,73,20,41,67,23,11,31,14,9,43,24,23,88,53,30,110,76,29,105,72,11,44,24,13,56,36,27,107,74,13,58,36,8,35,20,15,64,37,10,42,24,
-2,13,12,15,65,56,17,75,51,11,49,30,2,7,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,14,16,3,73,72,22,64,65,21,39,44,10,62,79,18,127,144,40,164,179,54,175,188,59,192,204,67,210,220,74,189,201,66,92,86,29,11,5,3,0,0,0,0,0,0,
-0,0,0,0,0,0,6,24,15,34,138,120,63,217,217,72,227,228,68,219,220,42,159,159,24,97,81,25,91,71,9,27,32,3,7,13,14,53,45,22,52,50,20,32,35,18,40,35,
-15,36,32,26,28,34,46,46,50,44,67,59,21,41,35,32,36,29,44,42,34,41,40,35,33,38,34,32,29,25,31,17,22,28,13,20,17,23,20,19,22,18,26,23,22,16,19,19,
-9,15,11,11,15,11,7,14,10,1,3,2,6,1,2,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,22,14,12,49,32,13,54,31,
-14,55,37,7,29,23,10,38,24,15,57,38,11,46,29,11,46,32,13,49,37,14,50,42,16,55,44,13,48,38,8,31,28,4,19,12,7,28,20,10,37,32,9,33,25,7,26,19,
-7,27,21,6,23,18,4,17,15,6,23,19,6,19,16,3,10,8,2,8,3,3,12,6,4,15,10,4,14,13,4,15,12,4,13,8,3,12,9,3,11,7,2,7,3,2,7,3,
-2,7,3,2,7,4,2,6,6,2,6,6,2,6,6,1,5,3,1,4,2,1,2,1,1,2,1,0,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,1,1,1,1,1,1,0,0,1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,
-0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,2,1,2,2,1,2,1,0,1,1,0,1,2,1,2,2,1,2,
-1,0,1,2,0,1,1,0,1,1,0,0,1,1,0,1,1,0,1,1,0,1,0,1,1,0,1,1,1,1,1,1,0,2,1,0,2,1,0,0,0,0,0,1,1,2,1,1,
-2,1,1,3,2,1,3,3,3,3,3,4,3,3,4,1,2,3,2,1,4,3,2,5,4,4,5,5,4,4,2,1,2,0,0,0,3,3,4,6,6,6,6,5,3,5,3,4,
-3,1,4,2,2,1,7,6,4,10,8,7,4,3,3,0,0,0,1,1,0,6,5,1,5,3,1,2,6,3,4,16,8,7,10,3,12,18,4,7,22,10,5,23,12,9,30,15,
-15,37,16,40,65,19,51,75,22,29,53,20,8,34,18,16,68,39,25,96,62,32,113,81,23,88,56,7,31,16,20,82,56,25,97,65,11,48,28,16,69,45,21,89,56,7,29,18,
-6,27,25,17,75,59,16,68,42,8,36,22,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,
-4,4,1,38,38,9,87,86,25,67,71,21,68,82,20,100,118,30,139,154,44,161,174,53,174,187,59,198,209,69,207,218,73,167,176,57,62,53,18,3,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,1,7,3,23,98,82,58,205,202,70,228,229,70,223,225,52,187,185,30,121,108,29,109,85,13,47,44,1,0,5,9,40,31,21,60,52,19,30,34,17,37,34,
-16,40,36,21,32,36,43,40,46,49,69,60,32,55,44,29,37,29,43,42,36,42,41,36,35,41,36,30,34,30,30,23,23,29,12,19,21,22,22,16,25,21,27,24,23,21,20,22,
-10,16,14,10,15,11,10,16,12,2,7,4,5,3,2,6,3,3,1,4,2,3,15,10,0,1,1,0,0,0,0,0,0,0,0,0,0,1,1,6,25,16,12,50,33,13,55,34,
-13,53,31,8,34,27,6,26,18,14,55,37,14,54,36,10,43,28,12,49,36,12,49,39,14,53,45,14,52,40,10,38,31,4,16,14,3,11,9,8,32,28,9,35,30,7,29,21,
-6,23,17,7,25,19,3,14,10,4,16,12,6,23,18,4,14,13,2,8,4,3,9,3,4,16,8,4,15,12,4,14,13,4,14,11,3,12,8,3,12,9,2,9,6,1,6,3,
-2,7,3,2,7,3,2,7,5,2,6,6,2,7,6,2,6,6,2,6,4,1,4,2,1,2,1,1,2,1,1,2,1,0,1,1,0,1,1,0,1,1,0,2,1,0,1,0,
-0,0,0,0,0,0,0,1,0,0,1,0,1,1,1,1,1,2,1,1,2,1,1,2,1,1,2,1,1,1,0,1,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,
-0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,2,0,1,2,1,2,2,0,2,1,0,1,2,1,2,2,1,2,2,0,2,
-2,0,1,1,0,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,1,1,0,1,1,1,1,1,1,1,2,1,0,2,1,0,1,0,0,1,0,1,1,1,1,2,1,1,
-2,1,0,3,2,2,3,3,3,3,2,3,2,2,3,2,2,4,2,1,4,3,2,4,4,3,4,3,3,3,0,0,0,2,1,3,6,6,7,6,6,5,6,4,3,5,2,4,
-1,1,3,2,2,1,8,6,6,6,5,5,0,1,0,0,0,0,1,1,0,3,3,1,2,1,0,2,12,6,4,14,6,5,4,0,3,10,4,4,20,10,7,26,13,11,31,16,
-25,48,18,48,72,19,46,71,23,16,39,18,10,47,26,20,77,44,27,102,72,31,111,79,15,61,36,10,41,24,27,104,72,19,77,49,12,51,33,24,97,71,21,87,59,6,24,16,
-13,53,47,18,78,56,14,60,36,5,22,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,12,3,
-37,31,8,78,74,20,91,89,30,66,73,21,87,100,26,122,138,38,143,156,46,162,176,53,178,191,60,199,210,69,199,211,70,137,140,45,36,27,10,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,15,65,52,49,185,178,69,228,228,71,226,227,61,206,203,37,148,136,32,124,103,21,72,62,5,6,10,8,26,18,19,65,51,23,35,38,18,33,33,
-17,42,38,17,35,36,38,36,42,50,60,56,39,67,53,26,38,30,40,42,36,44,42,37,38,41,36,30,39,35,29,31,29,30,16,22,25,19,21,16,30,24,24,28,24,22,23,23,
-12,20,18,11,19,14,11,17,13,5,11,7,3,6,4,8,8,6,2,5,4,6,27,17,3,11,6,0,0,0,0,0,0,0,0,0,0,0,0,4,18,11,11,47,31,15,60,41,
-14,57,34,9,39,25,3,15,11,10,42,26,16,62,44,11,46,29,11,46,32,12,48,37,12,47,40,14,52,40,11,43,32,4,18,14,0,0,1,4,19,17,9,36,31,8,32,25,
-6,24,17,6,25,19,5,21,15,3,12,7,5,19,16,5,18,17,2,10,9,2,7,3,3,12,5,4,17,10,4,15,13,4,14,13,4,13,10,3,12,9,3,12,9,2,8,4,
-1,6,2,2,7,3,2,7,3,2,6,5,2,7,7,2,7,6,2,6,5,2,6,4,1,4,2,1,2,1,1,3,2,1,3,3,0,1,2,0,2,1,1,2,1,1,2,1,
-0,1,0,0,1,0,0,1,0,0,2,0,1,1,1,1,1,2,1,1,2,1,1,2,1,1,2,1,1,2,0,1,1,0,1,1,0,0,1,0,0,1,0,0,1,0,1,1,
-0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
-0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,2,1,2,2,1,2,2,1,2,2,1,2,2,0,1,
-2,0,1,2,1,1,2,1,1,1,1,1,1,1,0,1,0,0,1,0,1,1,0,1,1,1,1,2,1,0,2,1,0,1,1,0,1,0,1,1,1,1,2,1,1,2,1,0,
-2,2,0,3,2,2,3,2,3,2,1,2,2,2,3,2,1,4,2,2,4,3,2,4,4,2,3,0,0,1,0,0,1,5,4,6,6,6,7,4,4,4,5,3,4,2,1,4,
-1,1,3,3,3,4,6,5,6,2,1,2,0,0,0,0,0,0,0,0,0,0,0,0,1,4,2,4,16,8,5,8,3,4,3,1,3,15,8,5,23,12,7,29,15,11,32,16,
-31,56,18,47,70,19,35,60,22,9,34,18,15,62,34,22,87,54,30,110,79,27,101,67,9,37,20,19,73,48,29,112,78,14,61,37,16,66,47,26,106,79,16,66,44,10,43,31,
-22,91,73,20,83,56,16,68,44,7,30,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,22,6,
-61,50,14,95,90,27,82,80,29,68,74,21,99,111,30,131,145,41,148,162,48,169,182,56,185,197,63,199,211,70,186,197,64,105,103,33,20,13,5,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,6,7,15,65,53,42,163,151,66,223,223,71,227,227,66,217,216,45,172,161,34,134,111,25,94,74,11,22,22,7,13,8,19,58,45,29,45,43,22,34,35,
-24,57,46,17,42,39,31,32,38,49,50,50,46,72,59,26,45,34,36,39,30,45,43,38,41,41,36,33,42,38,29,37,35,29,24,26,25,17,17,15,30,24,18,31,24,22,25,23,
-13,20,19,12,22,17,12,18,14,8,13,10,2,7,5,8,11,8,5,6,5,5,22,13,6,26,16,0,2,1,0,0,0,0,0,0,0,0,0,1,5,3,8,35,23,14,56,39,
-16,63,41,12,49,28,4,17,11,5,22,13,16,60,41,15,56,38,10,44,28,13,49,37,11,45,36,13,48,39,13,48,33,7,27,15,1,3,2,1,6,5,8,30,26,9,33,29,
-6,25,19,5,21,16,6,25,20,4,16,11,3,13,9,5,20,18,4,15,15,2,9,7,2,8,3,4,15,7,5,18,13,4,14,13,4,13,12,3,12,8,3,12,9,3,11,8,
-2,7,3,2,6,2,2,7,3,2,6,3,2,7,5,2,7,6,2,6,6,2,6,5,2,6,4,1,4,2,1,3,1,1,4,3,1,4,3,1,2,2,1,3,1,1,3,1,
-1,2,1,0,1,0,1,1,1,1,2,1,1,2,1,1,2,1,1,1,2,1,2,2,1,2,2,1,2,2,1,2,2,0,2,2,0,1,1,0,1,1,0,1,1,0,1,1,
-0,1,1,0,1,1,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,
-0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,2,1,2,2,1,2,2,1,2,2,0,2,2,0,1,2,1,1,
-2,1,1,2,1,2,2,1,1,1,1,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,2,1,0,1,1,0,1,0,0,1,1,1,2,1,1,2,1,1,2,1,0,
-2,2,1,2,2,2,2,1,2,2,0,1,2,1,4,2,1,4,3,2,4,3,2,3,1,1,2,0,0,0,3,2,4,5,4,6,3,3,4,3,1,3,4,1,4,1,1,3,
-2,3,4,6,4,6,4,2,4,0,0,0,0,0,0,0,0,0,1,0,2,1,0,2,2,11,6,4,14,7,5,4,1,2,2,1,2,10,6,6,24,12,6,29,15,14,35,15,
-34,56,15,40,64,20,17,40,18,9,41,22,18,73,41,26,97,66,31,112,82,19,76,47,7,33,18,27,103,72,27,103,70,12,51,31,21,87,63,25,101,73,11,48,30,17,74,57,
-25,104,78,20,83,53,16,70,46,6,26,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,3,5,1,18,20,4,50,43,13,
-80,68,23,102,95,34,76,77,27,75,84,23,111,125,34,137,151,44,156,169,51,176,187,59,191,202,65,198,210,69,164,172,55,74,67,22,10,4,3,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,3,3,11,52,47,36,143,131,61,213,211,70,227,227,69,222,223,53,191,183,35,140,123,29,109,87,16,46,39,8,8,5,16,43,32,33,57,48,29,35,36,
-33,64,51,26,54,46,24,32,36,44,40,43,49,68,58,34,56,42,32,36,24,45,44,37,42,42,37,35,42,38,30,41,38,28,33,30,22,17,15,14,26,19,14,32,24,21,27,24,
-16,20,20,12,22,18,10,20,13,4,15,10,2,8,5,6,11,8,9,13,10,4,14,9,8,34,22,3,10,7,0,0,0,0,0,0,0,0,0,0,0,0,5,20,12,12,48,32,
-16,62,41,15,61,39,10,39,28,3,10,6,12,46,30,17,64,46,11,46,30,11,46,32,12,47,35,10,41,32,14,50,38,10,39,23,4,13,7,0,0,0,4,15,14,9,33,29,
-7,27,23,5,20,15,5,20,17,5,22,17,3,15,11,4,18,15,5,19,17,2,11,10,2,5,3,2,8,3,5,17,11,5,17,14,3,13,12,3,11,8,3,12,7,3,13,9,
-3,11,8,1,7,3,1,6,2,2,7,3,2,7,3,2,7,5,2,7,6,2,6,6,2,6,5,2,6,4,1,4,2,1,4,2,1,4,3,1,4,3,1,3,2,1,3,2,
-1,3,1,1,2,1,1,1,2,1,2,2,1,2,1,1,2,1,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,0,2,2,0,1,1,0,1,1,
-0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,
-0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,1,0,1,1,0,1,2,1,2,2,1,2,2,1,2,2,1,2,2,0,2,2,0,2,2,1,1,2,1,2,
-2,1,1,2,1,0,1,1,0,1,0,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,2,1,1,2,1,1,1,0,0,1,1,0,
-1,0,1,2,1,2,2,0,1,2,0,2,3,1,4,3,2,4,3,2,4,3,2,3,0,0,0,1,1,3,5,5,7,4,4,6,3,1,3,4,1,3,2,1,4,1,1,4,
-4,4,6,6,4,6,1,1,2,0,0,0,0,0,0,0,0,1,2,1,4,2,4,4,4,16,7,5,9,3,4,3,1,0,0,0,2,9,5,6,29,14,6,22,10,20,35,10,
-31,50,13,21,44,17,6,29,16,13,56,30,21,83,50,30,107,77,29,107,73,11,47,26,14,55,36,32,119,84,20,80,51,13,57,39,26,102,76,19,79,55,10,43,28,23,94,75,
-24,99,70,19,78,50,14,59,38,2,10,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,4,1,30,24,6,34,39,9,59,62,14,87,71,23,
-93,81,29,101,98,36,81,89,27,89,101,27,122,136,38,144,156,46,171,181,55,185,193,61,191,203,65,191,203,66,137,142,45,47,38,13,3,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,7,31,30,29,121,109,54,199,195,69,226,227,69,224,224,60,206,202,38,150,137,28,111,95,17,58,51,9,9,9,10,27,16,32,63,45,33,37,35,
-35,55,46,33,67,53,23,38,38,40,36,38,49,59,51,41,68,52,30,38,24,43,41,33,43,43,36,36,41,37,30,43,40,29,39,35,22,22,18,16,20,14,12,32,24,20,32,26,
-20,25,23,12,21,19,11,21,16,4,16,11,2,10,6,3,8,6,9,17,12,5,10,7,6,28,17,5,24,15,0,0,0,0,0,0,0,0,0,0,0,0,1,6,3,10,41,26,
-15,62,43,17,65,44,15,57,41,5,21,14,7,29,18,18,66,49,15,57,40,10,42,27,11,42,30,9,35,25,11,42,33,12,46,31,5,20,10,0,0,0,0,3,3,6,25,22,
-8,32,28,6,24,20,4,18,14,5,20,18,5,20,16,4,15,13,4,17,14,3,11,9,1,2,2,0,1,0,2,8,3,5,16,11,4,14,13,3,10,9,3,11,6,3,12,8,
-3,13,10,2,10,6,1,6,2,2,7,3,2,7,3,2,7,3,2,7,5,2,6,6,2,6,5,2,6,5,2,6,4,1,4,2,1,4,2,1,4,3,1,3,3,1,3,3,
-1,3,2,1,3,1,2,3,3,2,3,3,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,
-0,1,1,0,1,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,
-0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,1,0,1,2,1,2,2,1,2,2,1,2,2,0,2,2,0,2,3,0,2,3,1,2,3,1,2,3,1,2,
-2,1,1,1,1,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,1,0,2,1,1,2,1,0,0,0,0,0,0,0,
-1,0,1,2,0,1,2,0,2,2,1,3,3,2,4,3,2,4,3,2,3,0,1,1,0,0,1,4,4,6,5,5,7,3,2,3,4,1,3,3,1,5,1,2,4,4,4,7,
-7,5,8,4,3,5,0,0,0,0,0,0,0,0,0,1,1,2,2,1,4,3,12,6,5,14,6,5,4,1,1,1,0,0,1,0,5,21,11,6,28,13,9,20,7,26,40,8,
-26,46,14,10,31,15,8,37,20,17,70,39,25,93,61,31,110,78,22,85,53,7,30,16,23,90,62,30,112,78,13,57,34,19,77,55,27,105,76,13,58,38,15,66,49,28,109,84,
-22,92,61,17,73,48,9,41,26,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,15,4,57,46,14,55,60,16,90,83,23,105,85,32,
-98,89,33,99,102,35,103,117,33,117,134,36,136,148,42,159,169,50,179,187,59,185,194,65,192,204,66,175,187,60,107,107,34,26,18,7,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,10,10,20,89,79,47,180,170,66,223,224,69,225,225,64,214,213,44,168,155,29,119,105,19,74,67,13,20,18,7,10,3,24,55,37,34,44,38,
-35,43,38,38,71,55,25,45,41,34,37,37,46,48,46,46,73,58,30,47,31,37,37,26,44,44,37,36,42,37,31,44,40,30,42,38,25,29,26,18,17,12,12,30,22,17,35,28,
-22,31,28,14,21,21,12,23,18,8,21,14,3,15,10,1,7,5,8,15,11,8,13,10,4,16,10,8,35,22,2,9,5,1,4,2,1,7,4,0,2,1,1,3,1,7,31,20,
-16,65,46,17,67,47,16,63,44,11,42,31,3,15,9,14,52,36,18,67,49,10,42,27,8,34,22,9,37,25,8,34,24,12,46,35,7,29,19,0,2,1,0,0,0,3,10,9,
-8,31,27,7,28,25,4,19,14,4,14,13,4,18,17,4,13,13,3,12,9,3,10,5,0,2,1,0,0,0,0,0,0,2,6,3,4,16,12,4,13,12,2,10,8,3,11,6,
-3,11,6,3,11,6,3,9,3,1,6,2,2,7,3,2,7,3,2,6,3,1,6,3,1,5,5,2,6,5,2,6,5,2,6,5,1,5,2,1,4,2,1,3,3,1,3,3,
-1,3,3,1,3,2,1,3,2,2,3,3,2,3,3,2,3,3,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,
-1,2,1,1,2,1,1,2,1,0,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,
-0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,0,1,0,1,1,0,1,2,0,1,2,1,2,2,1,2,2,1,2,2,0,1,2,0,1,3,1,2,3,1,3,3,1,3,3,1,3,2,1,1,
-0,1,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,
-2,0,0,2,0,1,2,0,3,4,2,3,3,2,3,3,2,3,1,1,2,0,0,0,3,3,4,5,5,7,4,4,5,3,1,3,4,2,4,2,3,5,2,3,6,6,5,8,
-6,4,7,1,0,1,0,0,0,0,0,0,1,1,1,2,1,5,2,6,4,3,15,7,5,8,4,4,3,1,0,0,0,2,9,5,6,29,14,6,21,10,19,30,7,30,48,12,
-21,42,16,6,27,15,13,54,29,21,81,49,27,99,68,27,100,63,14,58,32,11,48,30,31,115,81,23,90,59,12,52,34,24,96,71,23,93,65,12,54,34,26,105,85,30,119,96,
-21,88,59,15,66,42,4,18,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,27,8,62,52,19,65,66,21,102,83,28,106,86,37,
-107,99,37,102,111,35,119,133,37,128,142,41,144,155,46,171,179,55,176,183,60,182,192,66,187,200,65,155,164,52,79,73,23,12,5,3,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,15,65,57,40,157,142,61,214,213,68,225,225,67,220,219,50,183,173,33,134,119,26,105,96,11,33,29,8,5,0,14,36,22,33,50,40,
-33,35,33,38,65,51,32,57,47,29,37,37,44,41,41,47,66,55,38,63,45,34,38,24,44,43,36,39,42,36,35,44,40,32,44,41,27,37,33,18,18,13,12,24,17,14,35,27,
-22,35,31,17,24,24,14,25,21,12,27,20,5,21,13,2,9,5,4,10,7,10,17,12,4,10,6,7,29,17,5,20,12,2,6,4,6,26,16,7,27,17,7,28,17,6,24,15,
-15,61,43,17,70,50,16,64,44,15,59,43,6,24,17,6,26,16,18,66,48,13,51,37,6,27,17,9,36,24,8,34,23,10,37,28,11,42,31,4,15,9,0,0,0,0,1,1,
-5,19,16,8,32,27,4,17,12,3,12,7,3,15,14,3,14,14,2,10,11,2,9,7,2,8,2,0,1,0,0,0,0,0,0,0,3,8,4,4,16,13,3,12,11,2,10,8,
-3,11,5,3,11,5,3,11,5,2,9,4,1,6,4,2,7,3,2,7,3,2,6,2,1,5,2,2,6,4,2,6,6,2,6,5,2,6,5,1,5,3,1,4,2,1,3,2,
-1,3,3,1,3,3,1,4,3,1,3,2,2,3,2,2,3,3,2,3,3,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,
-1,2,2,1,2,2,1,2,1,1,2,1,0,2,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,0,1,0,1,1,0,1,1,0,1,1,0,1,2,0,1,2,1,2,2,1,2,1,1,1,2,0,1,3,1,2,3,1,3,3,1,3,3,1,3,2,0,1,0,0,0,
-1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,2,0,0,
-2,0,1,2,1,3,4,1,3,4,2,3,3,2,3,2,2,3,0,0,0,2,1,3,5,5,7,5,5,6,3,1,4,3,1,5,3,2,5,2,3,6,4,3,8,5,3,8,
-2,1,3,0,0,0,0,0,0,0,0,0,2,1,4,2,0,4,1,4,2,3,7,4,5,5,2,1,1,0,0,2,1,5,21,11,6,28,14,7,16,7,23,34,7,26,46,14,
-12,33,15,7,34,18,16,65,36,22,88,55,27,101,68,21,84,52,12,49,29,23,88,62,32,118,84,16,64,40,16,68,47,28,109,81,19,80,54,20,81,59,34,128,110,30,119,96,
-21,87,58,12,50,32,2,7,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,6,1,51,39,13,63,58,22,78,74,22,108,84,32,109,92,38,
-101,98,35,108,120,36,125,137,39,133,144,43,154,163,48,175,183,59,173,180,61,178,190,63,171,184,57,120,123,38,45,36,12,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,10,43,38,34,140,120,56,202,197,67,224,225,68,223,223,57,200,194,37,147,131,30,122,112,15,60,53,10,11,5,8,15,9,31,60,43,
-35,39,34,35,51,41,37,71,53,28,43,39,40,38,39,46,56,49,44,71,55,34,45,28,41,41,31,41,43,37,36,44,39,34,45,42,29,41,37,17,25,20,7,19,13,10,32,24,
-19,36,29,21,29,27,14,25,22,13,29,23,8,24,17,3,14,9,2,7,4,9,16,12,7,12,9,4,17,10,8,33,20,2,9,5,7,28,17,13,52,34,13,53,34,7,31,19,
-10,42,29,19,74,53,18,69,48,16,65,44,12,48,35,3,16,10,12,46,31,18,65,49,9,35,24,7,29,19,9,37,26,8,33,22,10,41,31,9,33,23,2,6,3,0,0,0,
-1,4,4,6,25,22,6,24,19,2,7,3,2,8,6,3,15,15,4,13,14,2,10,11,2,10,5,2,6,2,0,1,0,0,0,0,0,0,0,3,10,6,4,15,13,2,10,10,
-2,9,6,3,10,5,3,11,5,3,11,5,2,8,5,1,6,4,2,7,3,2,7,3,2,6,2,1,5,2,2,5,4,2,6,5,2,6,5,2,6,4,2,5,3,1,4,2,
-1,3,1,0,2,2,1,3,3,1,3,3,1,3,3,1,3,2,2,3,3,2,3,3,1,2,3,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,2,
-1,2,2,1,2,2,0,2,2,0,2,2,0,2,1,0,1,1,0,1,1,0,2,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,1,0,1,1,0,1,1,0,0,1,0,1,1,0,1,1,0,1,1,0,2,2,1,1,3,1,2,3,1,3,3,1,3,3,1,2,3,1,2,1,0,0,1,0,1,
-1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,2,0,1,
-2,1,2,3,1,3,4,2,2,3,2,3,2,2,3,0,0,0,1,0,2,5,4,6,5,5,7,3,2,5,3,1,5,3,2,6,2,3,5,3,3,7,5,3,8,3,1,5,
-0,0,1,0,0,0,0,0,0,1,1,1,2,1,5,1,1,2,0,0,0,1,1,0,3,2,0,0,0,0,3,10,5,7,31,15,5,18,9,3,5,1,11,20,6,16,38,14,
-6,28,15,10,46,24,15,65,37,24,92,61,24,93,59,14,60,36,14,61,39,33,119,88,27,103,72,13,53,32,22,89,64,27,107,76,21,85,58,29,113,90,35,132,116,27,110,83,
-17,74,47,6,27,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,17,4,71,59,20,78,75,25,96,82,25,117,95,38,111,98,38,
-100,104,35,114,127,35,127,140,40,138,149,44,164,172,52,177,183,60,172,181,60,174,187,59,156,167,51,88,86,27,23,17,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,3,15,14,27,112,94,51,189,176,65,220,221,68,224,224,64,214,210,43,165,152,33,134,120,21,89,79,12,26,18,7,8,3,25,59,39,
-35,49,38,35,38,29,39,67,47,29,49,43,35,37,38,45,44,43,47,72,57,37,57,37,38,39,26,43,43,37,37,42,36,35,45,41,31,44,40,17,34,28,5,21,13,7,28,20,
-16,35,28,23,34,31,17,27,25,15,30,25,11,27,20,5,19,13,1,8,5,6,12,9,10,19,13,3,13,8,7,31,20,8,33,21,6,26,16,12,48,31,14,59,38,11,46,29,
-6,28,17,17,67,48,21,78,59,18,69,48,17,64,46,8,32,22,5,21,13,16,62,45,16,57,41,7,28,18,9,34,22,9,36,24,7,28,20,9,36,27,5,18,12,0,0,0,
-0,0,0,3,9,9,6,26,23,3,12,10,0,0,0,3,9,9,4,15,15,3,13,13,2,10,9,2,9,5,1,5,1,0,0,0,0,0,0,0,1,0,3,10,6,3,12,11,
-2,5,5,1,7,3,2,10,5,2,9,4,2,8,4,1,7,5,1,6,4,2,7,3,2,6,3,1,5,2,1,4,1,1,5,4,1,5,4,2,6,4,2,5,4,2,4,3,
-1,3,1,0,2,1,0,2,2,0,2,3,1,3,3,1,3,1,1,3,1,2,3,2,2,3,3,2,2,3,1,2,3,1,2,2,1,2,2,1,1,2,0,1,1,1,1,2,
-1,2,2,1,2,2,1,2,2,0,2,2,0,1,1,0,1,1,0,1,1,0,0,1,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,1,0,1,0,0,0,1,0,1,1,0,1,1,0,1,1,0,1,2,1,2,3,1,3,3,1,3,3,1,3,3,1,2,3,1,1,2,1,1,2,1,2,2,1,1,
-1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,1,
-3,1,3,4,2,3,4,2,3,2,2,3,0,1,1,0,0,1,4,3,5,5,5,7,4,3,6,3,1,5,3,2,6,2,3,6,3,4,7,5,3,8,4,2,7,1,0,2,
-0,0,0,0,0,0,0,1,0,2,1,5,2,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,6,23,11,7,28,14,1,6,3,0,0,0,4,15,7,6,26,13,
-7,35,18,12,54,29,18,73,45,25,96,62,20,82,50,11,49,30,23,89,62,35,126,94,18,74,49,15,63,42,26,103,76,23,93,64,24,99,71,35,131,112,33,128,107,22,93,64,
-13,58,36,4,22,12,2,8,4,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,1,1,0,46,37,11,86,75,27,89,84,26,109,90,31,130,108,44,116,108,40,
-101,110,35,122,135,38,134,145,43,152,163,48,171,179,57,180,185,62,175,185,61,174,187,59,137,143,44,62,56,18,10,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,17,74,63,44,172,153,62,215,214,67,224,224,65,219,217,50,186,174,35,139,125,28,113,102,15,54,42,7,5,1,14,32,20,
-34,58,42,34,32,22,39,57,37,34,64,47,29,38,36,42,39,38,47,60,52,42,69,50,36,42,26,42,41,31,39,39,32,35,44,38,32,44,41,23,40,35,8,25,18,5,23,15,
-11,33,25,22,37,33,20,33,31,15,31,27,14,30,23,7,23,16,3,12,8,3,8,5,10,21,14,6,17,11,4,18,12,13,53,35,11,45,29,9,38,24,13,55,36,14,56,36,
-8,35,22,12,51,34,22,84,64,21,79,60,19,73,52,15,56,40,4,17,11,9,37,24,19,68,49,11,42,30,6,26,16,9,37,26,7,31,21,6,24,19,7,26,21,1,5,3,
-0,0,0,0,0,0,4,15,14,6,25,22,2,7,6,0,1,1,3,11,11,3,13,13,2,9,10,2,10,9,2,8,4,1,2,1,0,0,0,0,0,0,0,2,0,3,9,6,
-3,10,8,1,3,2,1,3,1,1,4,2,1,3,1,1,6,3,1,6,5,1,6,4,1,5,3,1,2,1,1,1,0,1,3,1,1,4,1,1,4,1,2,5,3,2,4,3,
-2,2,3,1,1,2,1,2,1,0,2,1,0,2,1,0,1,1,1,1,1,2,2,2,2,3,2,2,2,3,2,2,3,1,2,3,1,2,2,1,1,1,0,1,0,0,1,1,
-0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,0,1,1,0,2,2,1,2,3,1,2,3,1,2,3,1,3,3,1,2,3,1,1,2,1,1,2,0,1,2,1,2,2,1,2,2,0,1,
-2,1,1,2,1,1,1,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,3,1,1,
-4,1,2,4,2,2,2,2,3,0,1,1,0,0,1,3,2,4,5,4,6,4,4,6,3,1,5,4,2,6,4,3,7,4,4,7,4,4,8,4,2,8,2,1,3,0,0,0,
-0,0,0,0,0,0,2,1,3,2,1,5,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,12,7,7,31,15,4,16,8,0,0,0,1,2,1,4,20,9,5,26,14,
-11,47,24,15,62,36,23,88,56,24,93,59,14,61,37,14,59,37,32,117,88,31,116,85,14,61,39,21,85,60,26,104,76,22,90,60,30,115,90,36,135,118,29,116,90,19,79,52,
-12,50,29,7,36,16,4,17,8,0,0,0,0,0,0,1,3,2,4,19,11,3,12,8,0,0,0,11,8,2,68,55,18,96,87,31,102,89,31,120,97,38,136,117,47,119,119,45,
-111,123,37,126,137,39,142,155,45,166,176,53,179,187,61,184,187,63,176,185,60,162,175,53,112,114,35,41,33,11,4,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,35,32,35,142,122,58,207,200,66,223,224,65,221,221,57,204,195,41,160,144,34,137,123,24,96,79,13,32,18,12,31,16,
-31,66,47,35,39,27,35,39,22,38,67,44,28,44,38,37,35,31,45,48,43,47,73,57,37,52,32,39,38,26,39,38,27,34,40,31,32,45,41,26,42,38,13,32,25,4,20,13,
-8,30,21,16,36,30,18,36,34,12,31,28,14,31,25,11,26,19,4,17,11,1,6,4,6,19,12,9,34,22,3,14,8,11,41,26,16,65,45,12,49,36,12,50,34,14,57,37,
-13,52,33,11,47,31,20,76,56,23,86,67,21,76,57,17,64,47,9,37,27,3,15,9,14,53,36,15,59,42,7,29,18,7,30,20,9,38,26,5,24,17,6,23,20,5,19,15,
-0,1,1,0,0,0,0,2,2,5,20,18,6,22,19,1,3,3,0,2,2,1,7,7,1,4,4,2,8,8,2,9,7,1,2,1,0,0,0,0,0,0,0,0,0,0,1,1,
-3,9,6,3,10,7,1,2,2,0,0,0,0,0,0,1,2,0,1,5,3,1,6,5,1,5,5,1,2,2,0,0,0,0,1,0,1,3,1,1,3,1,0,3,1,1,3,1,
-2,3,3,1,1,3,1,1,2,1,2,1,1,2,2,0,1,2,0,1,2,1,1,2,3,1,3,3,2,4,3,2,3,3,2,3,2,2,2,1,2,2,1,1,2,1,1,1,
-0,1,1,0,1,1,0,1,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,1,2,1,2,2,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,1,2,1,2,2,1,2,1,1,1,1,0,1,2,1,2,
-3,1,2,2,1,1,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,2,0,0,1,0,0,3,1,1,4,1,1,
-4,1,1,2,1,1,0,1,1,0,0,0,2,1,4,5,4,6,5,4,6,2,1,5,4,1,6,4,3,7,4,4,8,4,4,8,4,3,8,3,1,4,0,0,0,0,0,0,
-0,0,0,1,1,1,2,1,5,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,1,4,3,7,26,13,7,26,13,1,4,2,0,0,0,3,13,6,5,24,12,9,37,20,
-12,54,29,18,73,46,25,97,62,20,79,48,11,48,29,22,87,60,36,129,99,24,92,64,16,68,46,26,102,75,23,95,66,24,98,69,34,130,111,37,138,122,28,112,85,16,67,43,
-11,48,25,10,45,20,2,9,5,0,0,0,0,0,0,3,14,8,11,49,30,3,17,10,0,0,0,32,25,6,85,71,25,100,90,33,108,89,34,125,103,43,135,124,49,124,134,46,
-128,143,40,132,143,42,152,165,49,174,183,58,189,192,64,190,189,65,171,181,58,143,153,46,87,87,26,23,17,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,11,11,22,98,84,52,193,179,65,221,221,66,222,222,62,214,208,49,183,166,38,149,136,31,125,108,22,68,46,21,47,26,
-27,68,46,36,52,37,34,30,13,40,61,34,31,57,43,29,35,31,41,40,34,47,64,53,42,65,44,36,42,26,40,40,29,34,37,27,32,44,38,25,44,40,18,37,32,7,23,15,
-6,25,16,10,34,26,12,36,32,9,32,30,12,31,26,15,29,23,6,20,14,2,9,7,3,15,10,13,51,34,9,36,22,4,17,10,15,63,43,19,76,61,16,62,48,13,56,36,
-15,62,41,14,58,39,15,61,43,23,84,64,22,81,62,17,65,49,15,58,44,6,26,18,5,24,15,15,59,41,11,44,30,6,24,15,8,36,24,9,36,24,5,20,16,6,24,21,
-3,13,9,0,0,0,0,0,0,2,5,5,6,23,21,5,18,16,1,2,1,0,0,0,0,0,0,1,2,2,2,9,9,2,6,6,0,0,0,0,0,0,0,0,0,0,0,0,
-0,2,1,3,9,6,3,10,7,0,3,2,0,0,0,0,0,0,1,1,0,1,5,2,1,6,5,1,5,5,1,2,2,0,0,0,0,0,0,0,2,1,0,1,0,0,1,0,
-1,2,0,1,3,3,1,2,3,1,2,3,2,1,3,2,1,4,2,2,4,1,1,3,1,1,3,3,1,4,3,2,4,3,2,4,3,2,3,3,1,3,2,1,3,2,1,3,
-2,1,3,1,1,2,1,1,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,
-1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,2,0,1,2,1,2,3,1,2,3,1,2,3,1,1,3,1,1,4,1,2,3,1,3,3,1,3,3,1,3,2,1,1,1,0,1,3,1,3,3,1,2,
-1,1,1,0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,3,1,1,4,1,1,3,1,1,
-1,0,0,0,0,0,0,0,0,2,1,3,5,4,6,5,4,6,2,1,4,3,1,5,4,3,6,4,4,8,4,4,8,4,3,7,3,1,4,1,0,1,0,0,0,0,0,1,
-0,0,2,2,1,4,1,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,17,9,7,31,15,4,12,6,0,0,0,2,7,3,4,22,11,6,28,15,12,49,26,
-15,60,34,21,83,53,23,89,55,14,59,35,14,59,38,32,117,88,32,118,88,17,70,45,20,85,62,26,105,76,23,95,64,29,115,90,38,137,122,36,136,114,24,99,70,12,54,33,
-11,50,24,7,31,15,0,0,0,0,0,0,0,1,0,7,34,21,11,45,28,2,8,4,6,5,1,63,58,16,97,90,31,98,86,32,118,94,37,135,116,47,128,126,48,130,143,45,
-133,147,42,137,149,44,158,169,50,180,186,60,197,195,67,189,188,69,155,164,54,121,127,38,59,53,17,8,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,61,53,43,168,148,62,215,211,66,222,222,64,219,216,56,200,186,42,161,146,32,132,119,28,93,72,28,49,29,
-31,67,42,36,68,51,35,38,24,39,49,24,38,69,46,26,42,36,37,39,32,45,53,46,48,75,55,37,52,32,39,41,30,37,38,26,32,41,33,27,44,40,23,41,36,11,30,22,
-5,21,13,8,31,23,10,36,30,9,35,33,10,32,29,15,33,26,9,23,18,3,15,13,2,10,7,10,40,26,15,57,39,5,20,12,9,34,22,21,83,63,23,85,70,16,62,44,
-17,67,45,18,72,51,14,57,38,18,71,51,23,85,65,20,75,56,18,68,50,14,53,40,4,15,10,7,30,20,13,53,38,8,32,21,7,27,17,8,33,22,6,25,17,4,15,13,
-5,18,13,2,7,4,0,0,0,0,0,0,3,9,8,6,24,22,3,12,11,0,0,0,0,0,0,0,0,0,1,2,2,2,9,9,2,6,6,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,1,3,9,6,3,9,7,1,3,2,0,0,0,0,0,0,1,1,0,1,4,1,1,6,5,1,6,5,1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,2,0,1,3,2,2,3,3,2,2,4,2,1,4,2,2,4,2,2,4,1,2,4,1,1,4,1,1,3,2,1,4,3,2,4,3,2,4,3,2,4,3,1,4,
-3,1,4,2,1,3,2,1,3,2,1,3,1,1,2,1,0,2,1,0,2,1,0,2,1,0,2,1,0,1,0,0,1,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,
-1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,1,0,0,2,0,1,3,1,2,3,1,1,3,1,2,3,1,2,4,1,3,4,1,3,4,1,4,4,1,3,3,1,3,3,1,3,2,1,2,1,0,1,
-0,0,0,0,0,0,1,1,0,1,1,0,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,1,1,4,1,1,3,1,1,0,0,0,
-0,0,0,0,0,0,1,1,2,4,3,6,5,4,6,3,3,5,2,1,4,2,1,4,4,4,7,4,4,8,4,4,7,2,1,4,0,0,0,0,0,0,1,0,2,3,1,5,
-4,2,7,2,1,5,1,1,3,1,1,2,0,0,0,0,0,0,0,0,0,2,8,5,7,30,15,6,22,11,1,2,1,0,0,0,1,4,2,4,20,11,10,41,22,13,56,30,
-17,68,42,20,81,52,15,62,40,11,47,28,23,91,63,36,129,98,23,91,63,16,68,47,25,101,75,26,103,73,28,111,81,35,131,110,38,140,124,31,122,96,17,73,48,10,45,24,
-10,47,22,6,27,16,15,21,11,7,4,1,1,9,5,9,46,28,18,37,19,22,16,4,33,30,7,101,97,29,116,110,39,104,87,33,133,110,44,143,128,51,129,135,49,136,150,44,
-133,144,42,142,155,45,162,169,52,186,189,62,198,194,71,177,179,69,136,144,48,95,98,29,35,29,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,28,24,35,140,117,56,203,193,65,220,221,65,220,220,61,213,205,49,184,166,35,142,128,30,110,93,31,57,36,
-32,61,34,38,91,73,45,85,71,37,40,19,39,63,36,29,53,41,33,38,32,43,43,38,48,67,54,42,67,44,37,42,28,39,40,29,34,37,27,31,44,39,25,44,39,18,36,30,
-6,23,15,7,26,18,9,34,26,10,37,33,9,35,32,13,34,29,13,28,22,6,21,16,3,15,12,5,19,12,14,56,38,11,44,29,4,16,9,14,58,40,24,92,73,20,76,60,
-15,63,43,19,76,53,18,68,47,14,59,40,21,79,60,23,83,64,19,71,52,17,65,49,10,40,29,2,10,6,10,40,27,12,49,35,6,25,16,4,16,10,4,15,10,4,14,9,
-3,10,6,3,15,9,2,4,3,0,0,0,0,0,0,3,10,10,4,17,17,2,8,8,0,0,0,0,0,0,0,0,0,1,3,3,2,9,9,1,5,5,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,2,5,5,2,6,7,1,3,2,0,0,0,0,0,0,0,0,0,1,3,1,1,6,4,1,6,5,1,4,4,1,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,0,2,0,1,2,1,1,1,2,2,1,4,2,2,4,2,2,4,2,2,4,1,2,4,1,1,3,2,1,4,3,2,4,4,2,4,3,2,4,
-3,2,4,3,2,4,3,2,4,3,1,4,2,1,3,2,1,3,1,1,2,1,1,2,1,1,2,1,1,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,2,1,0,3,1,1,3,1,2,4,1,2,3,1,3,4,1,4,4,1,4,5,2,5,6,2,5,5,1,5,3,1,3,2,0,2,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,1,4,1,1,3,1,1,0,0,0,0,0,0,
-0,0,0,0,0,1,2,2,4,3,3,6,2,3,5,2,1,4,2,1,4,3,4,6,4,4,8,4,4,8,2,1,4,0,0,1,0,0,0,0,0,1,3,1,6,5,2,9,
-5,2,9,2,1,4,2,1,4,1,1,2,0,0,0,0,0,0,1,2,1,5,23,11,7,28,14,2,8,4,0,0,0,0,0,0,1,3,1,6,26,13,10,40,21,12,51,30,
-18,74,46,16,64,42,10,41,25,15,62,40,32,117,85,30,112,81,16,68,44,21,87,64,26,106,78,27,106,75,32,124,98,38,139,122,38,142,120,28,110,80,14,61,38,12,51,25,
-10,47,24,14,50,32,33,48,26,13,11,3,4,25,16,10,47,29,27,30,10,29,22,7,64,63,16,121,116,37,112,104,37,117,96,35,146,124,50,140,133,53,130,142,47,137,149,44,
-137,148,44,150,161,48,167,174,54,194,193,65,193,189,73,160,165,63,119,126,40,68,65,20,18,11,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,10,8,27,113,88,49,186,166,61,213,213,64,220,221,63,218,215,56,200,184,43,159,140,31,121,104,27,67,47,
-33,53,29,35,85,61,44,103,87,40,55,35,40,52,23,33,63,43,28,41,35,41,40,33,46,54,46,46,75,52,36,47,28,39,41,30,37,37,26,32,42,35,27,45,40,22,40,36,
-10,28,21,5,22,13,9,33,25,10,37,31,9,36,34,10,34,31,15,32,26,9,25,18,5,20,16,3,13,9,8,34,22,16,60,41,6,26,17,6,26,16,20,77,57,24,90,73,
-17,67,49,17,68,47,20,77,54,15,62,42,17,65,45,23,84,64,22,79,60,18,68,50,16,62,46,7,27,19,3,14,8,12,48,33,11,43,30,3,11,7,1,3,1,3,12,7,
-3,13,8,3,11,7,3,13,8,0,2,2,0,0,0,0,1,1,3,10,10,3,11,11,0,1,1,0,0,0,0,0,0,0,0,0,1,4,4,2,9,9,1,5,5,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,3,3,1,3,3,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,1,2,1,1,4,4,1,4,4,1,2,2,0,1,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,1,3,2,2,3,2,1,4,2,2,4,2,2,4,2,2,4,2,2,4,2,2,4,3,2,4,
-3,2,4,3,2,4,3,2,4,3,2,4,3,2,3,2,1,3,2,1,3,1,1,3,1,1,3,1,1,3,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,2,1,1,3,1,2,4,1,3,4,1,3,4,1,4,4,1,4,5,1,4,6,2,5,6,2,5,6,2,5,3,1,3,3,1,2,2,1,2,0,0,0,0,0,0,
-0,0,0,1,1,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,1,1,4,1,1,3,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,2,2,2,4,2,2,4,2,1,4,2,1,4,3,3,6,4,4,8,4,4,8,2,1,5,1,0,3,1,0,1,0,0,1,3,2,5,6,2,9,5,2,10,
-3,2,5,2,1,5,1,1,2,0,0,0,0,0,0,0,0,0,2,5,2,5,19,8,3,14,7,0,0,0,0,0,0,0,0,0,3,14,7,8,35,17,7,31,18,14,57,36,
-18,73,46,11,45,29,10,44,27,25,96,67,33,122,88,20,80,53,16,69,48,26,102,76,26,104,74,30,116,87,37,135,115,40,146,129,38,139,111,24,97,67,14,63,36,16,69,38,
-15,69,45,33,78,49,45,63,36,10,15,10,9,45,28,19,44,22,32,26,7,37,30,11,99,92,27,121,116,41,110,95,36,137,118,44,154,137,55,132,134,53,133,146,44,133,145,42,
-141,153,46,157,166,50,171,176,57,193,188,67,180,179,71,145,153,55,103,107,32,43,37,12,6,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,6,3,16,68,53,41,162,134,56,203,196,63,218,218,63,219,218,60,209,196,52,177,155,37,135,120,24,76,65,
-30,46,28,33,68,43,39,98,80,44,82,62,40,44,19,40,64,36,28,50,39,35,38,31,42,43,35,45,66,49,39,58,35,37,42,28,39,39,27,33,37,28,27,44,38,23,42,37,
-17,35,29,6,23,14,8,30,22,10,37,29,10,37,33,9,34,32,12,34,29,11,29,22,6,23,17,4,17,13,5,20,14,15,56,39,14,52,36,5,20,13,13,52,34,25,91,71,
-23,83,67,16,65,44,20,77,53,20,77,55,14,59,39,19,72,52,23,85,67,21,77,59,18,67,50,15,55,40,4,17,11,5,22,14,10,44,30,7,25,16,1,4,1,2,4,2,
-3,13,8,2,7,4,3,10,7,3,12,8,0,1,1,0,0,0,0,1,1,1,2,2,0,0,0,0,0,0,0,0,0,0,2,0,1,3,1,1,4,5,2,9,9,1,5,5,
-0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,2,1,4,4,0,3,3,
-1,0,1,2,1,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,2,1,1,2,1,1,2,1,1,2,1,2,3,2,2,4,2,2,4,2,2,5,
-2,2,4,2,2,4,3,2,4,3,2,4,3,2,4,2,2,4,2,1,3,2,1,3,2,1,3,2,1,3,1,1,2,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,
-1,1,0,1,1,0,1,1,0,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,1,
-2,1,2,2,1,2,3,1,2,4,1,4,4,1,4,5,1,4,5,2,5,6,2,5,6,2,5,6,2,4,5,1,3,3,1,3,3,1,3,1,1,1,0,0,0,1,0,0,
-2,1,1,5,1,1,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,1,1,4,1,1,2,1,1,0,0,0,0,0,0,0,0,0,0,0,1,
-1,1,1,1,1,3,1,1,3,2,1,4,2,1,4,3,3,6,4,4,8,4,4,8,3,2,5,2,1,3,3,1,5,2,0,3,4,1,6,7,3,11,6,3,11,4,2,6,
-2,1,4,2,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,4,2,0,2,1,0,0,0,0,0,0,1,5,3,7,31,16,7,32,16,10,41,25,18,72,45,
-14,60,39,9,37,23,16,66,44,32,118,85,27,102,71,15,64,41,23,90,66,27,106,77,28,111,80,36,132,112,39,143,133,41,148,129,35,132,100,20,84,55,16,70,38,21,92,59,
-25,94,63,48,88,56,31,46,30,7,28,19,22,63,35,48,59,18,38,30,10,62,56,18,118,115,36,114,105,39,123,107,38,157,142,53,147,138,56,129,138,49,138,146,43,136,144,44,
-147,159,47,163,171,53,181,179,58,188,180,68,162,165,65,129,137,44,84,82,24,24,17,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,5,25,13,9,41,30,30,124,99,50,189,171,60,212,211,63,217,218,61,213,206,58,196,174,47,158,140,27,103,92,
-27,52,37,32,53,30,36,88,65,44,98,81,42,54,33,41,54,25,33,63,43,32,41,34,39,40,31,40,51,40,42,71,45,36,48,28,39,40,28,33,33,25,27,39,31,23,42,35,
-21,38,33,10,27,20,6,24,15,10,33,25,10,37,30,10,37,34,10,36,33,10,33,26,6,25,17,5,20,15,6,23,19,12,48,36,18,64,44,13,51,35,13,50,32,21,82,59,
-26,92,75,19,74,56,18,70,47,24,89,65,19,75,54,15,60,40,22,81,64,25,88,75,20,75,58,17,66,48,10,39,29,2,6,3,5,22,14,9,37,25,5,18,11,1,3,1,
-0,2,1,0,1,0,1,2,1,3,13,8,3,11,7,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,4,2,1,2,1,1,4,4,2,8,8,
-2,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,2,
-1,0,1,4,1,3,4,1,4,3,1,2,1,1,2,1,0,2,0,1,1,0,0,0,1,0,2,2,2,4,2,2,3,2,1,2,2,1,2,2,1,3,2,2,4,2,3,4,
-2,2,4,2,2,3,1,1,3,1,1,3,1,2,3,1,2,3,2,1,3,2,1,3,2,1,3,2,1,3,1,1,3,1,0,0,1,1,0,1,1,0,1,1,0,1,1,0,
-1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,1,2,2,1,2,
-2,1,3,3,1,3,5,1,4,5,1,4,6,2,5,6,2,5,7,2,5,6,2,4,5,2,3,5,1,2,3,1,3,2,1,2,1,0,1,0,0,0,1,1,0,3,1,1,
-5,1,1,3,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,3,1,1,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
-1,1,2,1,1,3,2,1,4,2,1,4,3,3,6,3,3,7,4,3,7,3,2,6,2,1,3,3,1,5,2,1,5,4,2,6,7,3,10,7,3,12,4,2,8,2,1,4,
-2,1,5,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,5,21,10,8,35,17,7,32,19,15,62,38,16,66,43,
-10,42,26,10,43,27,24,94,66,31,117,84,18,74,48,18,74,53,26,104,76,27,108,76,35,129,102,39,141,131,41,147,139,39,145,121,30,118,84,17,73,43,21,90,59,25,108,80,
-40,110,79,48,78,50,12,22,15,10,45,28,40,69,28,64,67,16,47,39,15,94,88,26,121,116,39,111,97,35,143,129,45,164,152,59,137,137,54,139,145,47,151,146,44,144,143,44,
-150,158,47,171,177,56,189,181,63,177,171,68,144,151,55,112,118,35,58,53,16,11,5,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,15,9,7,32,19,17,76,58,43,168,142,55,200,196,62,216,217,62,216,214,61,206,191,57,186,167,37,137,126,
-25,72,59,31,46,26,35,77,47,46,108,84,45,81,60,43,57,27,39,69,42,33,51,39,37,41,31,37,42,33,41,64,44,39,61,36,38,41,28,34,33,26,24,31,23,24,41,34,
-22,40,34,16,34,29,5,21,13,7,26,17,11,38,29,13,47,39,10,36,34,10,35,31,8,29,21,7,25,18,6,26,19,9,39,35,15,59,45,19,69,48,17,64,44,19,73,50,
-25,92,70,25,90,73,18,68,49,21,79,55,24,88,66,17,67,46,19,66,47,29,89,74,27,86,73,19,69,52,13,53,40,5,20,16,1,5,2,7,28,18,9,35,24,3,14,8,
-1,3,1,1,4,2,1,3,1,1,3,2,4,13,9,3,10,6,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,1,4,2,1,3,1,1,3,2,
-1,3,3,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,0,2,1,2,4,1,4,4,1,4,4,2,5,3,2,5,1,1,3,0,0,3,1,1,3,2,2,4,3,2,5,5,2,6,5,1,5,4,2,5,3,3,4,
-2,2,4,2,2,3,1,2,2,1,1,2,1,2,2,1,2,2,1,2,2,1,2,2,1,2,3,1,2,3,1,2,2,0,1,1,0,1,0,1,1,0,1,1,0,1,1,0,
-1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,2,3,1,3,
-5,1,4,5,2,4,6,2,4,6,2,4,6,2,4,6,2,4,5,2,3,5,1,3,4,1,4,4,1,4,1,1,2,0,0,0,0,0,0,2,1,0,5,1,2,4,1,2,
-1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
-1,1,3,3,1,4,4,1,5,5,3,7,4,3,7,3,2,7,3,1,4,2,1,4,3,1,5,3,1,5,3,1,5,6,3,10,7,3,12,6,2,9,2,1,4,2,1,5,
-1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,12,6,8,34,16,7,30,17,12,49,29,15,63,37,9,40,25,
-8,35,22,15,65,43,30,114,81,24,94,63,15,63,42,24,95,71,27,106,77,30,117,86,38,140,121,40,144,138,41,148,132,37,137,106,22,90,59,17,75,43,26,111,86,34,123,103,
-55,113,83,33,49,32,17,27,21,30,64,36,63,78,23,58,51,15,66,56,20,116,111,36,115,107,40,124,109,38,160,148,53,153,143,58,129,136,50,153,151,49,158,141,50,140,135,46,
-152,160,49,181,184,60,187,179,68,164,165,65,132,141,47,90,91,26,33,26,9,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,7,5,8,35,18,9,41,29,33,136,109,50,187,173,60,212,212,62,216,217,61,212,204,61,202,185,49,167,152,
-29,111,95,33,67,49,35,66,39,40,89,63,47,96,75,47,74,45,45,75,39,35,63,44,35,45,35,36,40,28,37,46,34,42,71,43,37,47,28,36,38,29,24,28,21,23,37,28,
-21,41,34,17,36,32,7,27,20,4,18,11,10,40,28,17,63,47,12,43,38,10,35,33,9,33,27,8,27,19,7,26,18,7,29,24,11,47,41,18,66,47,19,72,50,16,67,44,
-23,87,62,29,101,81,24,84,68,17,66,46,23,84,61,23,85,63,17,63,42,24,75,55,30,90,77,22,76,61,14,57,41,11,44,36,4,16,13,2,9,4,8,32,21,8,30,19,
-1,8,4,1,5,3,1,6,3,0,2,1,2,4,2,3,10,6,1,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,1,4,2,1,3,1,
-1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,0,1,2,1,2,4,2,4,5,2,5,4,2,5,3,2,5,2,1,3,2,1,3,1,2,3,3,2,4,4,2,6,5,2,6,5,2,6,
-5,2,6,4,2,5,3,2,4,3,2,4,3,2,4,3,2,4,3,2,4,2,2,3,2,2,3,2,2,3,1,2,3,1,2,2,1,2,0,1,1,0,1,1,0,1,1,0,
-1,1,0,1,1,0,1,1,1,1,1,0,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,4,1,2,6,1,4,
-6,2,4,6,2,4,6,2,3,6,2,3,7,2,3,6,2,3,5,1,4,5,1,5,6,2,5,5,2,4,2,1,2,2,1,1,4,1,1,5,1,3,5,1,4,3,1,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,
-2,1,4,5,1,5,6,3,7,5,3,8,2,2,4,1,1,3,2,1,3,3,1,5,2,1,5,3,1,5,6,2,9,7,3,11,6,3,10,3,2,6,3,1,5,1,1,2,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,5,3,7,30,15,8,33,16,6,26,16,12,51,31,9,42,25,7,33,21,
-11,45,28,22,89,59,25,100,69,15,64,40,17,73,54,26,102,77,28,110,78,36,133,108,39,142,133,41,146,138,40,148,123,32,124,90,17,73,42,23,95,64,31,126,106,47,130,109,
-49,88,63,26,28,22,52,53,38,62,76,32,77,80,21,60,52,19,98,92,27,128,126,43,113,103,37,147,132,46,175,163,62,138,135,55,138,144,47,160,147,51,153,133,56,135,132,48,
-158,165,52,188,184,62,180,174,68,149,155,58,112,118,36,62,56,18,15,8,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,27,15,7,34,20,24,99,77,47,181,154,55,202,198,61,212,213,62,215,212,63,208,194,58,185,167,
-39,146,130,35,108,89,39,82,63,37,80,49,42,85,67,48,81,58,49,74,37,39,69,41,34,52,39,37,41,30,37,39,29,39,60,40,39,61,34,37,41,27,30,32,25,21,30,23,
-22,40,33,12,37,32,8,32,27,5,20,13,6,24,16,13,51,37,16,58,46,11,39,37,9,34,31,8,30,22,7,26,19,6,24,17,8,32,29,14,55,46,19,68,48,19,70,48,
-20,77,56,29,101,78,29,100,81,21,77,59,18,69,47,24,89,65,21,79,57,18,62,40,26,79,60,27,86,73,18,68,53,14,53,39,10,40,33,3,12,8,4,15,8,10,32,20,
-5,19,11,1,6,3,1,6,3,1,5,3,1,2,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,1,4,2,
-1,3,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,2,4,2,4,4,2,5,4,2,5,4,2,4,3,2,4,2,2,3,2,2,3,2,2,4,3,2,4,
-4,2,5,5,2,6,5,2,6,5,2,6,6,3,6,6,3,7,6,3,6,5,2,5,5,2,5,5,2,5,4,2,5,3,2,4,3,2,3,3,2,3,3,2,3,2,2,3,
-2,2,3,2,2,3,2,1,2,1,1,1,0,1,0,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,5,1,1,6,1,2,6,2,3,
-6,2,3,7,2,3,7,2,3,7,2,4,7,2,5,6,1,5,6,1,6,6,2,6,7,2,6,7,2,6,6,1,3,5,1,2,5,1,4,5,1,4,3,1,3,1,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,3,1,4,
-5,1,5,5,1,6,5,3,7,2,1,4,0,0,0,1,1,2,3,1,4,2,1,5,3,1,5,5,2,9,7,3,11,5,3,9,4,2,8,4,2,8,2,1,4,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,4,18,9,8,34,15,5,25,14,8,34,21,7,31,20,7,31,19,9,38,24,
-17,70,45,25,101,68,16,67,44,13,56,38,18,79,60,24,98,70,32,122,92,39,141,127,40,145,139,41,147,129,37,139,106,23,95,63,18,78,45,28,117,92,41,137,119,59,126,97,
-32,52,37,40,41,39,66,67,48,85,90,29,90,90,28,83,79,23,128,129,40,129,128,44,128,115,39,168,155,56,159,149,62,131,136,51,152,150,48,160,141,55,141,128,53,141,147,50,
-176,180,58,189,180,66,167,165,66,130,138,47,70,67,21,18,10,5,3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,11,7,8,36,20,13,58,42,38,152,123,53,196,181,57,204,204,60,212,211,65,214,205,68,203,185,
-51,168,152,41,140,120,45,113,98,41,96,71,40,86,61,45,81,64,51,76,45,45,74,38,35,64,44,37,44,35,40,40,28,36,41,27,39,66,35,36,50,28,33,35,27,23,27,21,
-23,37,29,16,39,33,8,35,30,7,28,21,5,19,11,9,32,22,16,59,43,15,53,44,10,35,33,9,34,28,7,28,19,7,25,19,6,23,18,9,39,34,18,63,50,22,77,56,
-21,81,65,24,92,73,30,104,82,29,99,82,20,75,56,20,74,51,24,89,66,20,73,52,19,61,40,26,80,61,25,80,67,15,58,43,12,47,34,9,35,29,3,10,7,7,20,9,
-10,31,18,4,16,9,2,7,4,4,9,4,2,6,3,0,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,
-1,4,2,1,3,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,3,2,3,4,2,4,4,2,5,4,3,5,4,3,4,3,2,4,2,1,4,
-1,2,4,2,2,4,3,2,4,3,2,4,4,3,5,4,3,5,4,3,5,4,2,5,4,2,4,5,2,5,4,2,4,3,2,3,3,2,4,3,2,4,3,2,4,2,2,4,
-2,2,4,2,2,3,2,1,2,0,1,1,1,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,4,1,1,6,1,1,6,1,1,6,2,2,
-7,2,3,7,2,4,7,2,5,6,2,5,7,2,6,7,1,6,7,2,6,7,2,6,7,2,5,7,2,4,6,1,4,5,1,4,3,1,3,1,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,2,5,1,5,
-5,1,6,4,1,6,2,1,3,0,0,0,1,0,2,3,1,5,2,1,5,2,1,5,6,2,9,7,3,11,5,3,9,4,2,8,5,2,10,4,2,6,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,1,3,2,1,5,1,1,2,0,0,0,0,0,0,0,1,1,3,11,6,4,18,10,7,29,18,8,35,22,6,25,15,8,35,22,11,47,30,
-23,94,63,21,84,56,12,52,34,16,71,56,21,87,65,27,109,79,37,138,116,40,144,136,41,148,137,38,142,113,29,115,81,17,74,42,24,102,72,31,128,110,57,144,120,55,104,75,
-33,47,41,67,82,72,84,90,51,95,98,32,85,85,28,113,110,32,141,143,48,131,124,42,153,139,48,171,158,61,139,136,57,139,145,48,159,146,50,152,132,56,137,139,61,152,167,62,
-184,181,61,181,173,67,152,158,59,103,105,34,26,15,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,33,18,12,55,33,28,116,92,52,194,166,55,199,194,58,206,207,65,213,208,74,212,196,
-66,189,171,48,155,137,50,140,121,50,127,103,45,111,78,42,85,68,48,78,58,49,74,38,40,70,41,36,52,37,40,41,27,37,36,19,37,53,27,38,63,31,33,39,28,26,27,24,
-20,28,21,21,38,31,11,36,31,8,33,27,5,22,14,5,22,15,12,45,33,17,62,48,11,42,38,9,35,32,9,33,25,7,26,19,7,26,19,8,31,24,15,55,47,24,83,63,
-26,92,73,25,96,79,28,99,79,32,108,88,29,98,82,19,72,51,22,79,56,24,88,65,19,68,46,21,64,42,27,81,65,23,76,63,13,52,38,11,45,33,5,24,17,3,7,2,
-7,19,10,5,12,6,3,6,3,6,11,5,4,10,5,1,5,3,1,3,2,1,5,3,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,2,1,1,4,2,1,4,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,2,1,2,3,2,4,4,3,5,5,3,5,3,3,4,
-2,2,3,2,2,3,2,2,3,2,2,4,2,2,4,3,3,4,3,2,4,2,2,3,2,2,3,3,2,3,2,2,2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,1,1,0,1,0,0,0,0,0,0,0,1,0,0,1,1,0,1,1,0,2,1,0,3,1,1,4,1,1,5,1,1,6,2,3,6,2,3,7,2,5,
-7,2,6,6,2,6,7,2,6,7,2,6,7,2,6,7,2,6,7,2,5,6,2,4,6,1,4,6,1,4,4,1,3,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,4,1,4,5,1,6,
-5,1,6,1,1,3,0,0,0,1,1,2,3,1,5,2,1,4,2,1,5,5,2,9,7,3,11,7,3,10,5,2,8,5,2,10,3,2,6,0,0,0,1,0,1,1,1,2,
-0,0,0,0,0,0,2,0,2,3,1,6,2,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,5,3,5,22,14,6,24,15,8,34,21,8,37,23,16,66,41,
-21,88,57,12,53,33,13,59,44,19,83,64,34,100,72,43,130,103,39,142,130,41,147,140,40,145,123,34,131,96,20,85,53,22,91,60,30,127,107,43,139,120,61,133,101,40,62,47,
-66,68,63,92,101,66,103,111,42,100,110,45,98,99,36,135,133,42,139,135,48,147,127,45,176,160,59,161,152,62,130,136,51,150,148,48,160,141,54,142,131,57,139,154,67,164,171,63,
-181,167,61,167,163,64,135,143,49,70,63,20,8,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,13,9,11,52,30,19,84,61,44,168,136,53,200,182,53,197,198,61,204,203,76,212,201,
-77,205,185,56,170,153,48,149,131,54,143,122,49,128,99,43,97,72,45,81,64,51,78,48,48,75,36,40,68,41,40,53,35,39,38,21,35,38,17,36,56,25,34,42,22,31,31,26,
-22,22,19,19,30,22,14,37,31,8,34,29,6,26,20,4,19,11,8,29,21,15,55,40,15,56,45,10,38,35,12,45,41,10,39,32,9,38,26,11,45,31,10,44,35,21,75,61,
-29,100,75,29,103,83,25,96,80,28,99,77,32,108,89,27,93,75,18,70,49,22,83,60,23,85,64,22,67,44,25,67,45,28,83,67,21,72,59,12,50,34,9,37,23,4,16,9,
-3,6,2,6,8,3,5,7,2,5,10,4,6,11,5,4,9,5,1,6,3,1,6,3,2,6,3,0,2,2,0,0,0,0,0,0,0,0,0,1,2,1,1,2,1,0,0,0,
-0,0,0,1,2,1,1,4,2,1,4,2,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,3,
-4,3,6,4,4,7,2,2,2,0,0,0,0,0,0,1,2,1,2,2,1,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,2,3,2,5,5,3,7,5,3,6,
-4,3,5,3,3,4,3,3,3,3,3,5,4,3,5,4,3,5,4,3,5,3,3,5,3,3,5,3,3,4,3,3,4,3,3,4,3,2,4,3,2,4,3,2,4,3,2,4,
-3,2,4,3,2,3,2,1,2,1,1,0,1,1,0,1,1,0,2,1,1,5,1,1,5,1,1,5,1,2,6,1,2,6,2,4,7,2,5,7,2,6,8,2,7,8,2,7,
-8,2,7,7,2,6,7,2,6,6,1,5,7,2,6,8,2,6,8,2,6,7,2,7,5,1,4,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,2,4,1,4,4,1,4,3,1,4,
-1,0,2,0,0,0,1,1,2,3,1,5,2,1,5,3,1,5,5,2,9,7,3,11,8,3,10,8,3,10,6,2,10,3,2,6,0,0,0,1,0,2,4,2,7,3,1,5,
-0,0,1,0,0,1,3,1,5,3,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,3,7,30,18,8,38,23,13,54,33,22,87,56,
-14,58,37,7,34,24,14,64,52,26,91,67,51,120,92,48,138,119,39,142,134,41,148,133,36,138,107,26,105,71,18,77,45,30,121,96,36,138,121,59,146,119,56,95,70,72,51,49,
-105,95,76,117,120,53,121,133,49,113,127,60,129,132,48,141,141,46,143,125,46,172,147,57,183,167,68,144,142,59,138,145,48,160,146,52,154,134,56,138,139,60,147,160,61,171,163,57,
-170,156,62,152,157,59,108,111,35,34,24,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,8,35,20,14,64,40,33,134,103,54,201,171,52,193,187,54,196,196,72,209,201,
-83,213,196,68,191,172,47,150,134,52,148,128,54,139,113,50,119,84,44,89,67,47,79,59,50,76,40,46,80,43,46,87,55,43,62,37,34,37,18,30,36,15,32,39,15,35,47,28,
-30,33,27,14,17,13,15,33,25,11,36,31,8,30,25,5,22,13,4,19,12,12,45,31,20,72,53,16,58,48,15,56,54,17,60,57,11,43,31,14,57,39,12,50,34,14,54,44,
-28,99,78,32,107,83,27,101,84,25,94,77,29,101,78,33,109,91,26,89,72,18,70,48,23,85,63,25,86,64,25,72,47,27,72,50,26,80,65,17,64,52,11,45,31,8,34,21,
-3,14,8,4,7,2,7,10,2,6,10,3,5,9,5,6,11,5,4,9,4,1,5,3,1,6,3,1,5,3,0,2,1,0,0,0,1,0,0,2,4,1,2,5,1,2,2,1,
-0,0,0,0,0,0,1,2,1,2,5,2,2,5,2,1,3,2,2,3,1,1,2,0,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,2,
-4,4,8,9,6,14,8,6,13,5,4,8,2,2,3,2,2,3,4,3,6,3,3,5,2,3,2,2,2,1,2,2,0,1,1,0,0,0,0,1,1,2,3,2,5,5,3,6,
-5,3,7,5,3,6,5,3,6,4,3,6,4,3,5,4,3,6,4,3,6,4,3,5,4,3,6,4,3,5,3,3,5,3,3,5,3,3,5,3,3,5,3,3,5,3,2,5,
-3,2,5,3,2,4,2,1,3,1,0,1,1,0,1,2,1,1,3,1,2,5,1,3,5,1,3,5,1,3,6,1,4,7,2,6,8,2,7,7,2,7,7,2,7,7,2,6,
-6,1,5,6,1,6,6,2,6,7,2,7,10,3,9,11,3,9,10,2,9,8,2,7,3,1,3,0,0,0,0,0,0,0,0,0,2,1,1,3,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,1,3,4,1,4,3,1,3,2,1,1,0,0,0,
-0,0,0,2,1,3,3,1,5,2,1,4,3,1,6,6,2,10,7,3,11,8,2,11,9,3,10,8,3,11,4,2,6,0,0,1,1,0,2,4,2,8,5,2,10,4,1,7,
-2,1,2,2,2,5,3,2,5,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,21,13,8,38,24,9,38,24,34,79,52,30,75,51,
-5,27,17,9,40,32,18,74,57,47,109,81,60,137,114,40,136,125,40,146,133,39,144,117,31,123,88,18,77,47,24,101,72,33,134,117,50,150,128,83,141,110,76,77,65,112,89,85,
-127,117,77,132,138,52,129,141,61,131,140,69,148,155,71,143,141,62,158,131,53,188,164,70,170,155,70,136,140,53,151,149,48,158,137,55,139,127,56,137,150,65,161,164,61,173,157,58,
-161,156,63,133,141,49,68,62,19,8,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,11,7,10,45,27,21,91,67,48,181,147,53,196,175,48,183,183,60,197,194,
-81,214,200,80,210,190,56,170,153,46,141,126,56,146,124,56,134,100,48,105,73,44,93,78,52,92,68,51,81,44,51,104,64,49,96,59,37,53,30,28,33,13,31,37,12,37,63,30,
-39,66,42,18,20,16,12,22,16,16,36,29,10,33,29,7,28,21,4,18,10,10,39,25,21,77,54,25,90,68,16,59,50,18,63,62,14,54,48,12,48,33,16,63,43,11,45,32,
-18,68,55,30,105,82,31,106,83,26,99,82,26,95,75,32,105,84,34,110,93,23,83,65,19,71,48,25,91,68,28,92,69,27,72,48,26,69,48,22,70,57,16,60,48,12,47,31,
-8,33,21,3,14,7,6,9,3,8,12,3,6,9,3,5,9,4,6,11,5,4,8,4,1,6,3,3,7,4,2,6,4,0,2,1,0,0,0,1,2,0,3,4,1,3,5,1,
-2,2,1,0,0,0,1,1,0,2,4,1,3,6,3,2,6,3,3,5,2,2,4,1,2,2,0,2,2,1,2,1,1,0,1,0,0,0,0,0,0,0,0,0,0,1,1,0,
-2,2,1,5,4,7,8,6,12,9,6,15,8,6,13,6,5,9,4,3,7,4,3,6,5,4,6,4,3,5,4,4,4,4,3,2,3,2,1,1,1,0,1,0,0,4,2,3,
-6,3,6,7,3,8,7,3,8,7,3,7,6,3,7,5,3,7,5,3,6,4,3,6,4,3,6,4,3,6,4,2,5,3,2,6,3,2,5,2,2,2,1,1,2,1,1,2,
-1,2,2,3,2,3,4,2,4,4,1,3,3,1,3,3,1,3,3,1,2,2,0,2,2,0,2,1,0,1,2,1,2,5,1,4,7,2,6,7,2,6,6,1,5,6,1,5,
-8,2,6,10,2,9,12,3,10,12,3,10,11,3,10,10,3,9,10,2,9,8,2,6,2,0,2,0,0,0,2,1,1,5,1,1,6,1,1,4,1,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,2,4,1,4,4,1,4,3,1,2,1,0,1,0,0,0,0,0,1,
-2,1,4,3,1,5,2,1,4,3,2,6,6,3,10,7,3,11,8,2,10,9,2,11,8,3,11,4,2,6,0,0,1,1,0,2,4,2,8,7,2,11,8,2,10,8,2,9,
-5,2,7,3,2,5,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,14,9,9,38,24,5,29,19,23,50,35,42,78,55,18,39,29,
-7,32,20,15,68,46,38,98,71,60,130,104,46,136,123,39,141,132,40,147,127,37,140,106,23,96,64,19,84,54,40,128,108,43,144,126,80,159,130,86,119,93,102,95,87,128,123,98,
-135,140,72,134,145,62,127,138,67,150,158,89,154,167,108,151,140,75,178,149,63,182,160,74,148,138,61,149,148,50,159,146,50,138,109,51,118,117,53,142,157,63,171,162,58,169,155,61,
-151,155,59,107,109,36,33,23,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,33,18,15,68,43,34,135,107,56,204,172,50,188,179,49,183,183,
-71,205,196,84,216,195,71,197,174,50,151,135,53,146,126,58,144,117,54,126,88,47,110,88,51,109,96,55,88,56,53,96,55,52,112,70,45,82,49,32,40,19,27,32,12,33,44,15,
-38,74,39,26,48,33,7,12,10,15,29,20,12,34,29,8,32,27,6,23,16,7,29,17,19,73,50,27,97,70,22,80,60,15,56,50,17,63,62,11,45,37,13,52,35,15,59,40,
-10,45,33,22,83,68,32,108,84,29,104,83,25,95,79,26,95,74,33,108,88,33,107,91,21,76,57,17,67,45,25,90,68,28,87,64,25,65,42,22,62,43,21,67,55,16,59,46,
-12,46,31,8,32,20,4,14,8,6,10,3,8,11,3,6,10,3,5,11,5,5,11,5,4,9,4,4,9,4,5,9,4,2,6,3,1,3,1,1,3,0,2,3,1,3,4,1,
-3,5,1,2,3,1,0,1,0,1,1,0,2,4,2,3,6,3,3,6,3,3,5,2,2,5,2,2,3,1,2,2,1,3,2,1,2,3,1,1,2,1,0,1,0,1,0,0,
-2,1,0,2,2,1,3,3,2,4,4,6,8,6,11,9,7,14,9,6,14,7,5,11,6,4,9,5,4,7,5,4,7,5,4,6,5,4,6,4,3,4,3,3,2,4,2,4,
-8,3,7,9,3,9,10,4,10,11,5,11,11,5,11,9,4,10,9,4,10,8,4,10,8,4,8,7,4,8,7,4,8,7,3,8,6,3,7,5,2,5,4,1,4,3,1,4,
-2,1,3,3,1,3,2,1,3,1,0,1,0,0,0,0,0,0,1,0,0,1,0,0,1,0,1,3,1,3,5,1,4,7,2,7,10,3,9,10,3,9,10,2,8,11,3,8,
-12,3,9,13,3,10,12,3,9,12,3,9,10,2,9,10,2,9,8,2,7,4,1,4,4,1,2,7,2,4,10,3,6,7,2,4,2,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,1,2,4,1,4,4,1,4,2,1,1,0,0,0,0,0,0,1,1,1,3,1,4,
-3,1,5,2,1,4,3,2,6,6,3,11,7,3,11,8,2,10,9,2,11,8,3,11,4,2,8,2,1,4,3,1,5,5,2,9,7,3,12,8,3,11,9,2,10,8,2,9,
-4,2,7,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,7,4,8,35,21,7,32,20,15,37,25,41,69,50,25,46,37,9,28,22,
-13,62,41,31,95,67,59,121,92,48,131,113,37,135,127,41,147,132,40,145,115,32,127,92,19,86,52,45,120,94,67,145,127,72,158,133,94,147,116,92,104,89,124,130,114,138,149,100,
-138,150,68,128,139,64,141,148,76,158,172,112,151,160,108,165,144,70,184,159,70,161,142,69,147,142,57,162,155,55,148,120,52,110,83,44,113,125,56,157,161,58,172,156,56,155,150,61,
-124,131,46,67,61,19,8,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,12,7,13,59,34,19,83,62,47,177,144,54,199,177,45,178,176,
-56,189,187,79,209,193,80,209,182,61,171,147,49,142,126,58,148,127,57,138,105,52,122,89,50,118,103,54,103,84,54,83,46,52,105,65,50,104,65,41,66,38,29,34,15,29,33,10,
-31,51,23,31,70,41,13,30,22,6,13,9,14,30,24,10,32,27,7,27,21,5,20,11,10,42,26,22,85,58,26,98,71,18,68,52,15,55,52,16,59,57,11,45,36,15,59,41,
-14,55,37,14,58,49,28,100,87,32,111,89,27,101,81,25,95,79,28,98,77,34,110,91,31,104,87,16,63,45,14,56,37,23,83,60,26,79,55,24,61,38,22,60,42,17,58,49,
-13,51,40,8,35,22,5,23,14,5,17,8,7,12,4,9,14,3,8,13,4,6,11,5,5,11,5,4,10,5,5,9,4,5,10,4,3,7,4,3,6,3,4,5,1,2,3,1,
-2,3,1,3,5,1,2,4,1,0,0,0,1,1,0,2,4,1,4,6,3,5,7,3,4,6,3,3,4,2,2,3,1,3,3,1,4,4,1,4,5,1,3,4,1,1,1,1,
-0,0,0,1,1,0,2,2,1,3,2,0,3,3,2,5,5,5,7,7,10,9,7,13,10,7,14,9,6,13,7,5,11,6,5,8,6,4,7,5,4,7,5,4,6,5,4,6,
-7,4,7,8,4,8,10,5,10,11,5,12,11,6,12,11,6,12,11,5,12,11,5,12,11,5,12,11,5,12,11,5,12,10,5,11,10,5,11,11,5,11,10,4,11,9,4,11,
-8,3,9,5,3,8,4,3,6,4,1,4,4,2,3,5,2,4,7,2,6,9,3,8,10,3,9,11,3,10,12,4,11,13,4,11,13,4,11,13,4,11,13,4,10,12,3,9,
-12,3,9,12,3,9,11,3,9,11,2,8,10,2,7,8,2,5,6,2,4,8,2,5,10,3,6,9,3,6,5,2,4,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,2,1,2,4,1,4,4,1,4,3,1,3,1,1,1,0,0,0,0,0,1,1,1,3,3,1,5,3,1,5,
-2,1,3,2,2,5,5,2,9,7,3,11,8,3,10,9,3,11,8,3,10,4,2,7,3,2,6,5,2,9,7,3,12,9,3,13,9,3,13,9,3,10,8,2,9,5,2,7,
-1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,2,7,31,19,8,36,22,10,32,20,36,64,46,32,55,42,9,26,21,11,50,33,
-23,91,62,53,116,87,54,125,103,35,123,116,38,142,131,38,143,115,35,132,97,21,94,60,31,103,73,79,148,126,89,161,138,96,159,128,89,115,91,116,119,105,138,151,118,137,151,80,
-136,146,67,135,141,71,153,164,99,157,172,117,160,152,85,181,157,67,174,152,71,146,134,59,158,156,58,165,147,58,132,100,51,98,96,46,132,148,58,171,162,55,164,146,60,127,126,50,
-85,86,27,29,19,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,27,16,11,53,33,30,122,94,56,203,168,48,184,167,
-46,171,168,69,196,183,82,210,183,74,196,167,53,154,136,54,149,129,60,150,126,59,142,103,56,129,97,57,121,104,55,90,63,50,85,49,50,107,68,49,94,55,41,60,26,32,40,14,
-25,31,9,30,68,37,26,67,42,6,14,9,11,18,13,12,30,24,7,28,21,5,22,14,4,18,10,13,53,34,24,91,63,26,96,70,16,60,48,17,62,60,20,73,72,15,60,50,
-16,61,41,16,66,53,21,81,77,32,112,99,32,110,87,26,99,80,25,96,78,31,102,84,36,114,98,30,101,84,14,52,37,11,45,29,22,78,55,28,78,54,24,60,37,18,47,33,
-13,44,39,8,35,29,4,18,12,5,25,15,6,21,11,9,15,5,11,16,4,9,14,4,6,12,5,5,10,5,4,9,4,5,10,4,5,10,4,3,8,4,4,7,3,4,6,1,
-3,5,1,2,4,1,3,5,1,2,4,1,1,1,0,0,0,0,2,3,0,5,6,3,5,7,3,4,7,3,2,4,2,2,4,1,3,4,1,4,5,1,4,5,1,3,5,1,
-2,3,1,1,0,0,0,0,0,1,1,0,2,2,1,3,2,1,3,3,1,4,5,4,6,6,8,8,7,11,9,7,13,9,6,14,9,6,13,8,5,11,7,5,10,6,5,8,
-5,4,6,4,4,5,5,4,6,7,5,9,8,5,10,8,5,10,8,5,10,9,5,11,10,5,12,10,5,12,10,5,12,10,5,12,10,5,12,11,5,12,12,5,13,12,5,13,
-11,5,12,11,5,12,11,5,12,11,4,10,11,4,9,12,4,10,13,4,11,13,4,12,13,4,12,13,4,11,13,4,11,13,4,10,12,4,10,13,4,10,13,4,10,12,3,10,
-11,3,8,10,2,7,11,2,6,11,3,5,13,3,6,13,3,6,11,3,7,8,3,6,4,1,3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,2,4,1,4,4,1,3,2,1,1,0,0,0,0,0,0,0,0,0,1,1,2,3,1,5,3,1,5,2,1,4,
-2,1,5,3,1,6,6,2,8,8,2,9,8,2,10,8,3,10,7,3,9,5,2,7,4,3,9,7,3,13,9,4,14,10,4,15,10,3,12,8,2,9,4,2,6,0,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,9,5,6,26,17,7,28,18,28,56,40,38,64,48,12,27,23,9,40,27,18,81,54,
-43,111,81,60,125,101,49,121,113,41,135,129,39,143,122,34,132,98,22,97,64,21,88,56,64,137,113,91,160,138,100,167,139,93,132,103,109,115,97,143,154,123,141,154,93,142,149,69,
-146,139,68,157,153,86,159,174,117,157,163,103,180,163,71,185,163,72,154,136,64,146,142,54,160,151,58,156,127,57,112,95,50,109,125,53,159,162,55,171,151,58,136,123,53,86,86,32,
-39,34,10,7,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,7,4,10,46,26,19,83,57,47,176,139,56,206,172,
-48,173,158,69,181,167,80,201,179,83,207,176,68,183,156,55,160,138,61,163,139,67,161,125,75,159,105,71,145,110,58,112,94,53,85,51,50,96,58,50,107,60,57,101,44,47,76,26,
-30,42,10,30,62,23,33,90,52,18,45,28,5,9,6,13,23,15,9,26,18,5,22,15,4,15,8,5,20,11,15,61,39,24,92,65,24,87,65,15,56,47,21,75,75,21,80,79,
-15,60,47,16,65,45,19,73,63,25,91,88,34,114,99,30,107,83,25,98,80,28,100,85,33,108,93,36,113,98,27,93,76,11,46,31,11,45,30,24,80,57,28,78,54,20,46,27,
-14,32,22,11,38,36,7,28,26,4,17,11,5,20,12,5,15,7,10,16,5,12,16,4,9,14,4,6,10,3,5,9,4,4,10,4,5,9,4,5,9,4,4,9,4,5,9,3,
-7,9,2,4,7,2,3,4,1,3,5,1,3,5,1,1,2,0,0,0,0,1,2,0,4,5,2,5,7,3,4,5,2,3,3,1,2,3,1,3,4,1,3,5,1,4,5,1,
-4,5,1,4,4,1,2,2,0,0,0,0,0,0,0,2,1,0,2,2,1,3,2,1,5,4,4,6,5,8,6,6,8,7,6,9,8,6,11,8,6,12,9,6,13,9,6,12,
-6,5,8,4,3,4,3,3,2,3,4,3,4,4,4,4,3,3,4,3,3,5,4,5,9,5,9,9,5,10,9,5,10,9,5,10,9,5,11,10,5,11,10,5,11,10,5,11,
-10,5,11,10,5,11,10,4,10,11,4,10,11,3,8,10,3,8,10,3,9,11,3,9,12,4,10,12,4,10,13,3,9,13,4,9,13,4,9,13,4,8,14,4,7,14,4,6,
-13,4,6,13,3,7,15,4,9,16,4,10,13,4,9,7,2,5,2,1,2,0,0,0,1,0,1,4,1,4,2,1,2,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,1,3,2,1,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,1,2,0,1,1,1,1,3,
-4,1,6,6,1,6,8,2,8,7,2,9,7,2,8,9,2,9,8,2,10,6,2,10,8,3,13,10,4,15,10,4,14,10,3,11,8,2,9,6,2,7,2,1,3,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,2,1,8,5,21,35,25,37,66,49,16,36,29,8,33,23,15,70,47,37,103,74,
-58,120,93,62,119,109,73,131,128,63,146,130,39,137,105,26,108,75,17,83,50,49,124,98,91,160,142,99,169,146,107,151,121,108,112,89,143,150,120,150,163,112,142,156,83,149,150,81,
-159,146,81,167,168,109,156,169,116,166,157,78,188,167,69,163,141,68,139,128,54,149,140,52,155,129,55,130,96,52,99,99,50,122,138,54,168,155,55,152,131,57,86,76,35,37,33,11,
-12,10,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,27,17,12,56,36,26,111,86,51,192,156,
-50,185,158,61,170,154,77,184,167,84,206,179,78,200,167,57,164,140,56,160,134,68,168,141,79,171,119,82,161,106,66,136,111,57,102,79,49,75,41,45,93,51,54,111,53,60,117,51,
-42,71,23,33,48,10,33,81,36,26,81,48,8,28,17,6,11,6,11,23,14,6,20,13,3,13,7,3,13,6,9,37,22,20,78,52,26,98,71,21,78,58,15,56,49,21,80,79,
-20,77,73,17,64,47,17,68,48,18,74,67,26,96,92,34,115,98,29,105,81,26,99,81,29,102,88,33,106,91,33,108,93,26,94,78,12,50,38,11,48,32,24,81,57,26,70,46,
-17,35,17,12,29,20,11,39,36,7,29,28,3,11,8,2,8,3,5,14,6,10,16,5,11,16,4,9,13,3,6,9,3,5,9,4,4,10,5,5,9,4,5,9,4,5,10,5,
-7,11,4,7,11,3,5,8,2,3,4,1,3,4,1,3,5,1,1,3,1,0,1,0,2,3,1,4,6,1,5,6,2,5,5,1,3,4,1,2,3,1,2,3,1,3,4,1,
-4,4,1,5,5,1,5,5,1,4,4,1,2,2,0,0,1,0,0,0,0,1,1,0,3,2,2,5,4,5,6,6,8,7,6,9,6,6,9,6,6,8,6,6,8,6,6,8,
-6,5,7,3,3,3,2,3,1,2,2,1,3,3,1,3,3,0,3,2,0,3,3,1,4,3,2,4,2,3,3,2,4,3,2,4,4,2,5,4,3,5,4,3,5,5,3,5,
-5,3,5,5,3,5,5,3,5,6,3,5,7,2,4,7,2,4,8,2,5,11,3,7,14,4,9,14,4,8,14,4,8,15,4,8,14,4,7,15,4,7,16,5,8,17,4,11,
-17,4,12,15,4,11,13,3,11,10,3,9,4,1,4,0,0,1,3,1,2,6,1,5,7,2,6,6,1,6,2,1,2,0,0,0,3,1,1,7,2,2,5,2,2,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,3,
-7,2,7,8,2,9,8,2,9,7,2,8,8,2,9,8,2,10,6,3,11,9,4,14,11,4,16,10,4,14,10,3,11,8,2,8,7,2,8,8,2,7,4,1,4,0,0,0,
-0,0,0,0,0,0,4,1,1,8,2,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,10,9,7,36,44,33,23,40,32,7,28,20,13,59,38,28,92,64,52,113,85,
-55,108,95,76,115,112,91,145,135,64,142,118,30,120,86,17,80,49,34,107,77,83,155,135,102,173,158,122,172,149,124,134,105,145,138,111,156,165,122,148,165,104,151,162,107,159,154,104,
-170,164,109,162,174,126,152,153,94,174,156,63,173,151,67,139,124,56,138,131,50,145,118,52,136,94,52,98,82,48,108,123,54,148,141,49,163,139,55,118,102,48,38,28,16,2,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,2,9,40,24,16,71,50,37,147,119,
-52,195,160,49,167,143,70,168,144,81,188,162,82,203,172,67,177,149,51,148,122,62,164,138,74,171,135,88,173,110,88,163,113,69,129,107,54,87,60,44,69,36,43,87,44,62,128,64,
-57,112,48,35,51,12,29,51,14,27,88,45,16,68,41,3,15,9,11,16,9,9,18,11,3,10,6,5,19,10,10,43,25,17,72,47,24,96,73,30,111,91,22,80,65,16,61,54,
-25,96,92,25,95,82,18,70,50,16,67,48,19,75,69,28,100,95,33,114,95,27,100,77,26,96,79,29,102,89,32,104,90,32,107,92,25,89,74,11,44,34,11,46,30,22,72,49,
-23,61,38,17,34,16,12,28,18,11,38,35,8,30,29,3,12,9,2,8,4,5,14,6,10,16,5,12,16,4,10,14,3,6,10,3,5,9,4,5,10,5,5,9,4,5,10,5,
-6,11,5,6,11,5,7,11,3,6,9,2,3,5,1,2,4,1,3,5,1,3,4,1,2,3,1,3,4,1,5,6,1,6,7,2,6,6,2,4,4,1,3,4,1,3,5,1,
-4,4,1,4,4,1,4,5,1,5,6,1,5,6,1,4,4,1,2,2,0,0,1,0,0,0,0,1,1,0,2,2,1,4,3,3,5,4,6,6,5,7,6,6,9,7,6,9,
-7,7,10,8,7,10,6,6,8,5,4,5,4,3,4,4,3,3,4,2,3,3,2,1,2,1,1,1,0,0,0,0,0,1,0,1,1,0,1,1,0,1,2,0,1,7,2,2,
-8,2,3,9,2,4,9,3,4,9,3,4,11,3,5,13,4,7,15,4,8,16,4,9,16,4,10,17,5,10,17,5,12,18,5,13,17,5,14,17,4,14,17,5,15,17,4,15,
-15,3,13,11,3,10,10,2,10,10,2,9,8,2,7,7,1,6,7,2,6,5,2,5,3,1,3,1,1,3,3,1,2,7,2,2,8,2,2,7,2,2,2,1,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,4,1,3,7,2,7,
-8,2,9,7,2,9,8,2,9,8,2,9,7,2,10,7,3,11,9,4,15,12,4,17,12,4,16,10,3,11,8,2,8,7,2,8,8,2,8,8,2,7,2,0,2,2,1,1,
-4,1,4,7,2,5,26,7,9,31,8,9,11,2,5,0,0,0,0,0,0,0,0,0,7,3,3,31,28,23,25,37,31,8,27,21,10,50,32,18,66,43,44,92,67,54,100,86,
-65,96,95,92,129,121,83,144,125,45,128,100,20,89,58,24,93,61,71,144,122,99,169,155,121,178,161,137,157,126,147,142,107,162,165,129,149,163,108,152,169,113,155,164,125,167,164,121,
-168,177,139,149,162,119,161,148,66,180,158,65,151,130,61,134,126,49,142,125,49,137,94,50,108,73,48,97,108,55,125,138,53,162,140,51,143,121,55,72,61,30,13,7,4,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,24,14,13,56,33,22,96,71,
-50,187,150,49,186,155,54,161,132,74,167,140,78,186,158,76,193,161,56,155,128,53,150,123,67,168,141,86,177,128,104,185,116,92,165,119,66,120,98,49,78,46,39,69,34,48,100,51,
-62,130,64,44,86,32,27,37,7,28,62,22,24,90,51,11,52,30,4,8,4,9,10,5,5,8,5,2,6,3,8,37,21,15,65,41,23,92,72,30,114,100,32,116,100,20,76,60,
-21,82,69,29,111,102,25,95,79,24,72,49,24,72,52,20,78,72,28,102,95,30,106,87,22,87,66,25,94,78,30,103,89,31,103,88,29,100,85,22,79,66,9,36,29,8,35,21,
-20,64,42,24,63,40,18,36,18,12,29,18,10,36,34,8,33,31,4,14,12,2,7,4,5,13,6,10,16,5,12,16,4,10,14,3,6,10,3,5,9,3,4,9,4,6,11,5,
-7,11,5,5,10,5,6,11,5,8,11,4,7,10,2,4,6,2,3,4,1,3,5,1,3,4,1,2,3,1,3,4,1,5,6,2,6,7,2,6,7,2,5,6,2,5,6,2,
-4,6,2,3,5,1,3,4,1,4,4,1,4,5,1,5,6,1,5,6,1,6,5,4,7,4,5,3,2,3,1,0,0,0,0,0,1,1,0,2,2,0,3,4,2,4,4,4,
-4,5,6,7,6,10,8,7,12,8,7,12,9,7,13,12,7,15,13,7,16,13,6,14,11,5,13,9,4,11,10,4,10,12,4,11,12,4,12,12,4,12,13,4,12,15,4,12,
-16,4,13,16,4,13,16,4,13,17,4,14,17,5,15,19,5,17,19,6,17,19,5,17,19,5,17,18,5,17,19,5,17,19,5,18,18,5,16,15,4,14,14,3,14,13,3,13,
-12,3,12,11,3,11,10,3,10,9,3,9,7,3,8,5,2,6,2,1,3,1,1,2,4,1,2,8,2,2,9,2,3,7,2,1,2,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,2,5,2,5,7,2,8,7,2,9,
-7,2,9,8,2,9,8,2,10,7,2,10,7,3,12,10,4,16,12,4,17,12,4,16,11,3,12,7,2,8,7,2,8,8,2,8,8,2,7,7,2,5,5,1,3,7,2,7,
-14,3,12,31,7,13,40,9,15,23,6,13,4,2,5,0,0,0,0,0,0,4,1,1,24,7,10,23,15,18,8,23,18,25,51,36,25,65,44,39,80,56,48,89,74,60,86,88,
-85,119,113,87,141,124,53,134,108,26,101,72,19,84,53,55,133,107,93,164,149,113,177,162,136,167,140,148,147,108,164,165,129,153,164,116,150,167,108,157,170,130,155,158,121,164,172,135,
-145,171,147,138,143,90,175,155,60,172,150,69,142,134,63,142,134,53,142,106,51,122,75,48,96,88,49,118,132,55,159,146,52,159,134,56,104,91,43,31,22,12,2,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,10,46,26,16,71,42,
-33,132,102,51,194,152,49,172,140,65,156,126,73,161,137,79,193,163,72,183,152,54,152,124,56,158,133,77,174,142,105,189,129,108,185,119,85,153,118,59,105,80,44,73,37,38,76,38,
-52,112,57,57,122,56,33,60,19,27,39,7,28,74,31,20,84,49,12,43,23,13,19,4,4,4,1,0,0,0,2,9,5,9,41,24,17,71,48,27,102,84,32,119,105,31,112,94,
-19,74,56,22,87,73,32,112,102,53,107,85,57,92,56,39,83,57,19,79,74,28,102,95,28,100,82,22,86,64,26,96,79,30,104,90,30,102,87,29,99,83,21,79,66,8,36,30,
-8,32,20,19,63,41,24,62,39,17,38,19,11,27,16,9,33,29,6,24,21,3,9,5,4,10,5,5,14,6,9,16,5,12,16,5,10,15,4,7,11,3,5,9,4,5,10,4,
-6,10,5,6,10,4,5,10,5,6,10,5,7,11,5,7,11,3,6,8,1,3,5,1,2,4,1,3,5,1,2,4,1,2,3,1,3,4,1,5,7,2,6,7,2,6,7,2,
-5,6,2,5,6,2,4,6,1,4,5,1,3,5,1,4,5,1,4,4,1,8,6,3,12,7,8,12,7,10,10,5,9,7,3,6,4,1,4,2,1,1,2,1,0,0,0,0,
-0,0,0,0,1,0,1,2,2,2,3,3,3,4,5,9,5,11,13,8,17,15,9,19,16,9,20,16,8,20,17,9,19,19,9,20,19,8,20,19,8,20,19,7,20,20,7,20,
-20,7,21,20,7,21,20,7,21,21,7,21,21,7,22,21,7,22,21,7,22,20,7,21,18,6,19,16,5,17,15,4,15,14,4,15,13,4,13,12,4,12,12,3,11,11,3,11,
-9,3,9,7,3,9,6,2,8,7,3,8,9,2,9,9,3,7,7,2,3,8,2,2,11,2,4,12,2,7,9,3,7,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,3,1,2,5,1,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,4,1,3,6,1,6,6,2,6,6,2,7,7,2,8,
-8,2,9,8,2,10,6,3,10,8,3,13,11,4,16,12,4,17,13,4,15,11,3,12,7,2,8,7,2,7,9,2,8,7,2,6,16,4,12,27,6,20,18,4,15,15,3,14,
-33,8,17,41,10,15,26,7,17,7,3,10,1,0,2,0,0,0,4,1,1,23,5,8,22,3,10,6,10,12,22,47,33,45,68,50,46,79,58,48,89,70,55,83,83,83,108,106,
-92,139,127,62,138,114,29,109,80,16,82,51,49,122,95,93,161,144,110,176,162,131,173,149,141,147,109,163,162,127,159,169,128,148,164,105,159,175,131,158,168,139,159,165,128,150,173,147,
-127,146,113,151,138,57,180,157,64,159,142,71,141,145,74,137,116,57,130,80,47,101,77,48,100,117,55,133,134,48,158,131,54,128,106,52,57,48,23,9,4,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,15,9,15,67,38,
-17,78,52,39,157,113,55,187,141,63,167,128,76,152,115,76,172,145,83,201,169,68,179,147,55,158,127,64,168,139,91,182,143,112,192,123,102,178,119,80,144,113,65,112,70,51,87,39,
-39,83,41,54,119,60,52,109,49,29,49,13,26,45,10,22,79,38,31,95,52,29,65,24,18,32,6,2,1,0,0,0,0,2,10,6,9,41,24,18,76,54,28,109,93,34,124,110,
-29,106,86,17,67,50,26,99,87,58,127,117,83,122,95,70,101,58,37,83,59,19,80,76,28,102,95,27,98,80,21,84,63,26,95,78,30,103,88,30,102,88,28,98,82,21,79,66,
-9,38,32,7,29,19,17,52,32,22,53,32,18,40,20,11,25,12,5,17,11,2,9,5,4,9,4,5,11,5,4,13,6,8,16,6,11,16,4,11,15,4,8,12,4,6,9,3,
-5,7,2,4,7,2,6,9,3,6,11,4,6,11,5,6,11,5,7,11,4,7,9,2,4,6,1,2,4,1,3,4,1,3,4,1,2,4,1,2,4,1,4,6,1,6,7,2,
-6,7,2,6,7,2,6,6,2,5,6,2,4,6,1,4,5,1,2,3,1,2,2,0,3,3,1,5,5,3,9,7,6,10,7,9,10,6,9,9,3,9,8,2,8,6,1,5,
-4,1,4,3,0,2,1,0,1,0,0,0,0,0,0,1,1,2,3,3,6,7,5,11,8,6,13,9,7,14,10,7,16,12,8,16,12,8,17,12,8,17,12,8,17,14,8,18,
-14,8,18,14,8,18,16,7,19,17,8,19,16,8,18,14,8,18,13,7,16,11,6,14,11,5,12,12,5,12,13,4,12,13,4,11,15,4,10,15,5,10,16,5,10,13,4,9,
-9,3,9,8,2,8,10,2,8,10,3,7,11,3,6,11,3,4,11,2,6,13,3,9,14,3,12,15,4,13,11,3,9,2,1,2,0,0,0,0,0,0,0,0,0,2,1,1,
-8,2,5,12,3,8,8,2,6,1,0,1,0,0,0,0,0,0,0,0,0,1,1,1,4,1,4,2,1,2,5,1,4,6,1,6,5,1,5,5,1,5,7,2,7,9,2,10,
-8,2,10,7,3,11,9,4,14,12,4,17,13,4,17,13,4,15,12,3,12,8,3,9,7,2,7,8,2,7,7,2,6,19,4,14,36,9,29,34,8,30,21,5,19,32,7,17,
-44,11,18,38,9,21,15,4,15,2,1,5,0,0,0,2,0,1,23,5,7,25,4,11,6,8,12,16,40,29,40,66,47,46,75,57,50,89,71,52,81,79,76,90,91,91,129,115,
-67,138,114,46,120,93,30,71,47,41,102,75,94,156,138,124,175,162,135,177,159,140,154,119,158,157,121,163,171,134,151,166,112,161,177,131,165,176,149,163,168,135,158,174,144,133,158,132,
-139,134,69,176,153,58,170,150,70,142,139,77,126,114,67,124,71,46,105,66,44,90,95,49,110,123,47,142,125,43,129,98,46,67,50,30,10,6,4,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,36,21,
-13,61,37,21,92,62,47,172,124,69,184,133,77,158,105,75,150,117,79,187,159,82,203,170,64,175,139,59,160,120,72,169,138,100,187,138,109,189,118,100,173,121,83,152,111,73,126,66,
-50,90,42,42,94,47,65,142,71,49,107,46,25,38,8,19,44,12,30,94,48,51,115,54,40,76,23,16,25,4,0,0,0,0,0,0,2,9,5,10,48,30,24,94,77,34,126,116,
-35,128,113,27,100,80,19,79,64,34,114,108,70,135,128,85,123,93,74,109,72,36,85,65,18,79,75,27,102,96,26,97,78,21,84,63,25,96,79,30,102,88,29,97,84,28,97,80,
-22,82,69,10,41,34,4,18,11,12,33,18,20,49,29,18,43,23,10,23,11,3,10,5,2,9,4,4,9,4,5,10,5,4,12,6,6,14,5,11,16,5,11,16,4,9,12,3,
-6,9,2,4,7,1,4,6,1,6,9,3,6,11,4,6,11,5,6,11,4,7,10,3,7,10,3,5,8,2,3,5,1,2,5,1,3,5,1,2,4,1,1,2,0,2,4,1,
-5,6,2,6,7,2,6,7,2,6,5,2,4,5,1,4,5,1,3,4,1,2,3,1,1,2,0,5,5,1,9,9,2,8,9,2,7,7,3,6,5,5,7,4,6,7,3,7,
-8,2,7,8,2,8,8,2,7,7,2,6,7,1,6,5,1,5,5,1,3,4,1,3,3,1,4,2,2,3,0,1,2,0,2,3,1,2,3,2,3,4,3,4,5,4,4,5,
-4,4,5,4,4,5,6,4,6,8,5,8,9,5,7,9,5,7,11,5,7,12,5,7,14,5,9,18,5,12,20,6,14,20,6,13,20,5,13,21,5,15,21,5,15,17,4,11,
-13,3,7,12,3,5,14,4,7,15,4,9,16,4,10,15,4,12,15,4,14,14,4,13,11,3,11,6,3,8,2,2,4,0,1,1,0,0,0,3,1,2,7,2,6,11,3,8,
-10,3,8,5,2,6,1,1,3,0,0,1,0,0,0,0,0,0,6,2,5,13,3,10,11,3,8,2,0,2,4,1,3,5,1,4,6,2,6,8,2,9,9,2,10,9,3,12,
-10,4,14,10,4,15,12,4,17,12,4,16,12,3,13,10,3,11,7,2,9,7,2,8,9,2,8,11,2,9,23,6,20,41,11,34,36,10,34,23,7,23,33,8,18,43,11,18,
-49,13,27,46,12,26,17,4,12,0,0,1,2,1,0,22,5,7,27,5,10,9,6,10,19,37,28,41,64,46,39,59,46,46,70,58,53,82,79,71,83,86,89,110,101,70,130,107,
-52,125,99,57,74,53,66,79,63,95,146,130,126,174,161,143,180,166,141,160,129,151,149,111,166,170,135,153,167,119,159,178,136,175,185,162,172,169,141,160,165,137,136,165,143,134,149,100,
-167,151,60,178,155,68,152,142,75,125,119,71,111,61,47,109,54,43,80,72,45,85,110,48,120,119,38,137,105,43,83,54,35,12,3,8,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,4,
-10,45,27,13,62,38,32,132,90,64,194,139,76,176,119,82,153,101,77,160,130,80,195,163,77,194,158,61,161,118,61,155,116,80,173,138,107,191,134,109,189,120,99,179,131,86,156,104,
-75,121,57,51,93,42,56,127,62,65,151,77,37,85,33,20,26,3,22,53,20,45,112,58,54,115,51,37,67,19,12,19,3,0,0,0,0,0,0,4,17,10,17,73,58,31,118,106,
-36,132,122,33,123,109,27,101,81,21,88,75,36,119,114,72,135,126,89,125,96,72,106,71,35,84,64,19,80,76,27,101,94,25,95,77,21,83,62,24,89,74,25,89,78,26,90,77,
-27,96,81,23,84,70,11,45,39,3,16,11,10,27,14,20,48,28,17,44,25,9,24,12,3,11,5,2,9,4,4,9,4,5,9,4,4,9,5,5,12,5,8,14,4,10,14,4,
-8,13,3,7,10,3,4,6,2,2,4,1,4,5,2,6,9,3,5,9,4,5,8,2,6,9,2,7,11,3,7,10,2,4,7,2,3,5,1,1,2,0,0,0,0,0,0,0,
-2,4,1,5,7,2,6,7,2,6,7,2,6,5,2,5,4,1,4,4,1,4,4,1,3,4,1,9,9,3,15,14,4,16,14,4,15,13,3,12,11,3,9,9,2,8,8,2,
-7,6,3,6,5,4,5,4,4,5,2,4,4,1,5,8,2,8,11,2,10,11,2,9,11,2,10,10,2,9,7,1,6,6,2,5,8,2,6,12,4,6,15,4,8,16,4,8,
-16,4,8,17,5,9,18,5,10,19,5,12,21,6,14,23,6,16,24,6,19,26,7,21,26,7,21,25,6,21,25,7,22,25,7,23,25,7,23,25,7,22,24,6,20,21,6,17,
-20,5,14,23,6,18,27,7,22,27,8,23,23,7,18,14,4,13,8,3,9,3,2,6,0,2,4,0,1,3,2,1,3,9,2,7,15,4,12,14,4,11,10,3,8,5,2,6,
-1,1,4,0,1,3,0,0,2,0,0,1,4,1,3,12,2,9,14,3,11,8,2,8,2,1,3,1,0,2,5,2,5,7,2,8,9,2,10,8,2,10,9,3,11,10,4,14,
-11,4,17,12,4,17,13,4,16,12,3,12,9,2,8,15,4,10,17,4,10,10,2,8,12,3,11,30,8,27,44,13,40,36,10,36,24,7,24,35,8,19,45,11,20,50,13,27,
-53,14,30,37,10,23,10,2,9,2,1,1,22,5,6,26,4,10,7,5,10,30,38,29,55,66,49,42,62,48,40,57,48,53,71,72,82,85,90,96,108,102,74,125,106,51,128,101,
-63,81,62,82,70,59,108,136,124,125,170,158,142,181,168,148,173,152,154,153,120,166,162,128,155,165,119,156,176,129,176,190,169,180,183,166,166,164,139,130,159,142,123,152,117,153,153,76,
-172,152,66,157,141,70,135,134,77,111,79,54,109,49,40,91,64,45,73,96,47,99,112,37,136,112,39,112,79,44,32,17,17,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-4,17,11,13,56,34,17,77,51,40,156,107,70,189,135,85,170,112,84,148,102,73,158,129,79,194,158,72,184,145,61,157,112,65,160,124,88,179,143,109,192,126,108,188,125,101,180,132,
-94,159,94,80,125,53,53,103,46,59,140,70,60,143,72,34,70,24,17,26,3,22,63,27,50,119,61,50,104,42,33,58,13,9,15,3,0,2,2,0,0,0,5,25,18,21,85,71,
-32,121,110,36,133,123,35,129,113,27,106,85,20,88,76,36,118,115,72,134,124,87,123,93,72,107,71,37,85,65,17,73,69,22,88,80,24,92,73,19,79,58,20,77,63,22,79,70,
-22,81,71,24,86,72,22,83,70,13,54,47,5,22,16,8,23,11,16,43,24,16,46,27,10,29,16,3,13,6,2,9,4,3,9,4,5,9,4,4,9,4,3,11,4,6,12,4,
-9,14,4,9,14,3,6,10,3,2,4,1,0,0,0,2,3,1,6,8,2,6,9,2,5,8,2,6,10,3,8,11,3,8,11,3,6,9,2,4,5,1,1,1,1,0,0,0,
-0,0,0,1,2,1,3,5,1,5,7,2,6,7,2,6,7,2,6,6,2,5,5,1,4,3,1,3,4,1,6,7,2,10,10,3,13,12,3,14,14,3,15,13,4,16,14,5,
-17,15,11,16,16,11,15,14,9,12,11,6,9,9,6,14,10,12,18,10,18,21,10,19,20,9,18,20,8,19,21,8,20,22,7,21,23,7,22,26,8,23,27,8,24,27,8,24,
-27,8,24,28,8,25,28,8,25,28,8,26,29,9,28,29,9,29,30,10,29,30,10,30,29,10,29,28,9,27,28,9,28,29,9,29,30,10,29,30,10,28,30,10,28,30,10,28,
-31,10,29,31,10,28,28,9,25,21,7,19,11,4,11,7,3,7,7,2,8,6,2,5,10,3,5,14,4,10,19,5,15,20,5,16,14,4,13,6,2,7,1,1,4,0,1,2,
-0,0,1,0,0,0,3,1,2,10,2,8,14,3,11,9,2,9,3,2,5,2,1,5,4,1,5,7,2,7,8,2,10,9,2,10,8,2,9,8,3,10,8,3,13,10,4,15,
-12,4,16,18,5,19,13,3,12,8,2,6,21,5,10,35,9,16,30,7,15,19,4,15,33,9,29,45,12,41,34,10,35,25,8,23,38,10,21,53,13,28,55,14,32,52,14,29,
-37,9,23,12,4,13,4,1,4,23,5,7,27,5,12,8,5,10,28,36,28,58,67,52,54,65,54,41,55,48,48,68,68,86,82,90,112,98,100,88,118,104,59,128,105,64,93,73,
-78,63,52,107,125,115,126,168,157,138,180,168,149,179,163,158,165,146,173,163,138,160,158,116,151,168,116,173,191,165,182,189,174,174,170,149,138,160,145,116,152,128,146,154,86,165,149,65,
-156,135,63,136,134,73,114,94,59,110,51,42,102,60,45,73,83,46,87,110,40,129,117,37,131,97,46,58,36,28,4,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,1,7,31,19,11,53,33,20,91,60,49,168,113,78,183,125,91,165,103,80,143,100,73,166,134,78,197,159,67,174,134,60,154,107,69,162,128,95,180,133,109,189,117,111,185,126,
-110,183,129,99,159,86,73,116,50,51,109,50,63,148,77,57,136,67,29,58,19,13,26,3,24,71,31,48,114,55,46,96,36,32,59,17,15,35,17,5,11,3,1,1,0,7,32,23,
-22,90,76,38,125,114,44,135,124,35,131,114,26,104,83,21,91,79,38,120,116,72,134,125,86,122,92,71,106,72,38,83,63,16,67,62,20,83,76,23,89,72,18,76,56,19,75,60,
-20,76,66,20,73,65,21,80,67,23,86,71,14,58,50,6,23,20,7,20,10,14,37,21,17,47,27,12,35,19,4,15,8,2,8,4,3,9,4,5,9,4,4,9,4,3,10,4,
-5,12,4,8,14,3,9,14,3,6,10,3,3,4,1,0,1,0,1,1,0,3,6,1,6,9,2,5,9,2,5,8,2,7,10,3,8,11,3,7,10,3,5,7,2,2,3,0,
-0,1,0,0,0,0,0,0,0,1,2,1,3,5,1,4,7,2,6,8,2,6,7,2,6,6,2,4,4,1,3,2,1,2,2,0,2,4,1,5,6,1,6,8,2,9,9,3,
-12,12,8,15,13,11,17,15,13,18,16,14,20,17,14,24,19,19,27,20,24,29,20,26,29,20,25,28,19,25,31,20,28,32,19,30,32,15,31,32,12,32,31,12,32,31,13,32,
-31,12,33,32,12,33,32,12,33,32,12,32,32,12,32,33,12,32,32,12,31,33,12,32,33,13,32,33,13,32,34,13,33,34,13,33,33,13,32,33,13,31,32,12,30,31,11,29,
-27,9,26,19,7,19,13,6,14,12,4,12,15,4,14,22,6,18,28,7,20,29,8,19,29,8,18,22,6,16,12,4,13,5,2,8,1,1,5,0,1,2,0,0,0,0,0,0,
-4,1,2,10,2,7,14,3,10,11,3,10,6,2,7,2,2,5,3,1,5,6,1,6,7,1,6,7,2,8,8,2,10,8,2,10,7,3,11,7,3,11,8,3,12,13,4,15,
-24,6,20,24,6,20,14,3,10,26,6,12,39,10,17,34,9,19,28,8,23,39,11,36,45,12,41,31,9,33,24,7,21,40,10,21,59,15,34,65,17,41,55,14,32,35,8,22,
-10,3,12,4,2,5,20,5,7,26,5,11,9,5,10,26,35,27,60,67,52,62,65,58,57,46,46,48,45,48,78,61,68,111,90,93,96,100,96,70,114,100,86,98,91,94,61,65,
-106,112,107,123,158,149,127,174,163,142,177,162,156,168,149,175,171,153,170,166,136,149,163,114,165,186,154,180,190,176,176,173,154,149,161,144,114,153,136,136,152,96,167,155,70,162,139,63,
-140,133,71,122,116,70,108,61,45,105,48,41,76,67,45,75,102,45,115,115,35,138,106,45,86,57,37,14,5,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,2,8,36,22,13,59,38,28,117,77,58,175,118,85,180,117,94,167,99,75,145,105,74,175,141,76,190,149,63,164,119,59,147,105,71,157,126,99,180,124,107,179,107,
-112,186,130,106,178,123,94,151,75,73,115,50,54,115,55,63,151,79,59,131,61,36,66,16,23,45,9,30,80,36,63,123,58,55,99,36,40,78,31,35,71,29,24,43,12,11,28,20,
-13,58,53,39,105,87,68,136,117,53,137,124,35,132,116,29,110,93,21,93,83,38,119,115,72,135,126,85,126,102,75,113,83,40,85,64,16,68,63,19,80,76,23,90,74,20,79,59,
-16,64,49,15,57,44,15,59,50,19,71,62,19,72,61,13,53,48,7,30,27,6,21,11,12,32,16,16,46,27,12,38,23,4,15,8,1,7,3,3,9,4,4,9,4,5,10,4,
-4,10,4,4,11,4,5,12,3,7,11,3,6,10,2,4,7,2,1,2,0,0,1,0,2,3,1,5,7,1,4,6,1,2,4,1,4,7,2,6,10,3,6,9,2,5,8,2,
-3,5,1,1,2,1,0,0,0,0,0,0,0,0,0,1,2,1,2,4,1,4,6,2,6,8,2,6,7,2,5,5,1,3,3,1,1,1,1,0,1,0,0,2,0,1,3,1,
-1,3,0,1,1,0,2,2,1,5,4,3,14,7,6,20,11,9,22,12,11,23,14,13,23,15,15,26,16,18,30,18,23,30,19,26,30,15,27,30,12,28,30,12,28,30,12,28,
-31,13,31,33,13,32,34,14,32,35,14,32,35,14,31,35,14,31,35,13,32,34,13,31,34,13,32,34,13,32,34,13,32,33,12,31,32,12,29,30,11,27,28,10,25,25,9,24,
-23,7,22,20,7,20,25,7,22,31,9,25,34,9,27,34,10,26,29,9,23,21,7,18,10,4,11,3,1,6,0,1,4,0,0,2,0,0,0,0,0,0,5,1,3,10,2,8,
-14,3,11,11,2,10,8,3,9,11,4,11,13,4,11,6,2,6,6,1,6,5,1,4,6,1,5,12,3,11,12,3,12,6,3,11,6,3,12,5,2,10,13,3,12,26,6,20,
-23,6,19,21,5,15,33,9,17,39,10,18,32,8,21,31,9,30,43,13,41,44,13,42,28,9,30,26,7,19,48,12,26,67,17,43,65,17,43,54,14,32,35,8,24,9,2,12,
-6,2,5,25,5,10,27,5,12,7,5,10,26,36,27,57,65,51,69,67,61,80,42,47,69,20,33,82,37,47,111,66,74,96,83,84,67,97,89,89,90,93,113,53,81,118,89,105,
-123,147,142,127,167,157,135,174,160,149,167,149,173,171,152,174,169,142,148,157,111,152,178,142,178,191,175,180,172,157,150,152,140,115,156,146,130,158,119,156,152,73,162,140,63,139,127,76,
-116,118,82,107,68,50,113,49,43,64,33,39,46,71,38,92,106,33,124,100,36,107,75,42,32,18,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,5,19,12,14,62,37,13,64,42,36,140,93,68,176,116,88,168,93,88,152,86,70,141,106,74,172,133,71,177,134,63,155,105,63,149,109,77,163,130,102,180,117,
-107,181,110,111,185,129,102,169,102,94,144,61,68,109,45,50,118,57,65,155,81,69,139,58,48,82,19,28,52,12,50,96,44,75,128,58,55,99,33,58,104,36,47,94,39,35,75,51,
-16,58,60,25,78,68,68,122,94,80,143,121,53,140,127,36,134,122,26,108,93,20,90,80,36,117,113,70,135,127,87,128,108,76,113,82,44,89,65,19,70,63,18,76,72,21,86,73,
-16,66,49,11,46,29,9,35,23,11,44,38,15,58,52,17,66,58,15,61,54,8,35,33,6,21,15,9,26,12,13,36,20,6,21,12,0,2,1,1,5,3,2,9,5,4,9,4,
-10,13,5,18,20,8,12,17,6,4,10,4,4,10,2,6,10,2,5,8,2,2,3,1,1,1,0,11,10,3,13,12,3,6,7,2,2,4,1,2,4,1,4,7,2,6,9,2,
-6,8,2,3,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,3,1,3,4,1,3,5,1,3,5,1,3,4,1,2,2,1,1,2,0,1,1,1,
-0,1,0,0,0,0,0,0,0,0,0,0,6,1,1,10,2,2,11,3,2,12,3,2,14,4,4,19,6,9,22,7,13,22,7,13,23,8,14,26,9,18,29,10,22,29,10,23,
-31,11,26,33,12,29,34,13,30,35,13,30,35,12,30,34,12,30,34,12,30,34,12,30,34,11,30,34,11,31,34,12,31,35,11,32,36,11,31,34,10,28,34,11,29,35,11,30,
-37,12,32,39,12,34,40,13,35,36,12,31,25,9,22,13,5,14,4,2,8,0,1,4,0,0,1,0,0,0,0,0,0,4,1,3,13,3,10,19,5,16,15,4,13,10,2,9,
-8,2,9,11,3,11,15,4,12,13,3,11,7,2,6,3,1,3,6,1,4,14,3,11,20,5,16,28,7,23,17,5,18,5,2,10,7,3,9,18,4,15,31,7,24,30,7,24,
-28,8,19,37,9,19,38,10,20,30,8,23,35,10,34,54,16,49,51,15,48,27,8,27,29,8,18,58,15,35,83,22,59,77,20,54,55,14,34,35,9,25,11,3,14,10,3,6,
-44,10,15,48,10,18,19,9,13,32,40,29,62,70,54,71,67,61,79,42,47,86,22,39,97,28,50,119,55,73,104,68,80,66,85,82,83,83,87,113,51,83,122,68,100,123,129,133,
-125,159,151,141,170,158,157,163,147,174,171,153,176,173,147,150,158,116,148,175,136,172,191,174,183,179,171,169,149,143,119,148,144,120,163,137,150,155,88,160,140,63,143,122,67,112,118,89,
-96,74,64,109,46,42,78,30,39,28,38,32,51,79,30,91,84,26,81,55,27,40,24,18,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,7,31,18,13,57,35,19,85,56,45,160,105,74,170,100,91,162,80,85,145,86,69,140,104,78,176,132,83,180,125,77,166,108,64,151,113,80,167,128,
-106,185,123,110,187,118,107,176,113,98,160,82,92,141,60,61,104,44,54,128,63,79,164,85,78,145,57,48,79,16,27,53,13,57,105,48,78,130,58,61,104,36,59,107,41,53,104,53,
-38,87,67,19,67,69,32,91,76,74,135,106,82,149,127,56,141,129,52,137,123,36,112,97,19,90,80,34,115,110,66,133,127,87,129,110,82,117,87,52,95,71,19,69,60,14,66,66,
-17,74,68,9,47,37,3,15,8,5,17,10,11,40,32,13,52,48,15,60,53,12,51,48,9,37,37,6,25,21,5,18,9,3,13,6,0,4,3,0,1,1,0,4,2,1,5,3,
-8,9,3,27,25,7,34,33,10,23,25,9,9,15,5,4,8,2,3,6,2,3,4,1,0,0,0,6,5,2,13,11,3,17,15,4,13,13,4,7,8,2,3,5,2,3,5,1,
-4,6,1,3,5,1,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,0,2,4,1,3,4,1,9,6,3,15,7,4,
-14,6,4,11,5,4,13,4,8,13,4,9,9,3,7,7,2,5,7,2,5,7,2,5,13,4,10,19,5,16,20,5,18,23,6,17,26,7,18,29,8,21,32,9,26,33,10,28,
-34,10,28,34,10,29,34,11,30,36,11,31,37,11,34,38,12,34,38,12,35,39,12,36,40,13,37,41,13,39,42,14,40,43,14,41,43,14,39,42,14,37,41,13,36,39,12,35,
-37,12,35,35,12,35,31,10,32,23,8,25,7,3,10,0,0,1,1,0,1,7,1,5,10,2,8,12,3,10,19,5,16,29,8,25,33,8,29,24,6,23,11,3,12,17,5,15,
-28,6,22,23,6,19,11,3,10,1,1,4,3,1,6,13,4,11,29,7,23,37,10,30,29,8,26,17,5,20,9,3,12,13,3,12,24,6,19,35,9,28,44,12,36,47,13,33,
-44,12,25,34,8,21,29,8,26,41,12,40,59,17,54,59,17,55,42,12,36,37,10,21,64,17,40,86,24,64,83,23,61,61,16,42,36,9,27,16,4,17,17,4,11,54,13,18,
-72,17,26,50,18,24,43,43,34,65,69,58,88,72,76,95,46,63,91,25,45,99,28,53,123,54,78,106,54,77,63,64,73,80,77,84,115,52,84,124,61,95,123,105,113,121,144,137,
-140,166,154,161,165,151,179,169,153,182,172,153,148,146,112,138,164,126,168,189,168,184,185,180,176,161,164,135,149,151,119,161,142,147,159,97,154,139,68,151,132,87,123,124,101,98,89,76,
-103,44,42,91,35,40,34,28,32,37,70,32,60,72,21,47,36,13,23,13,9,3,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,4,3,9,39,25,13,59,37,23,105,69,55,169,108,80,166,90,93,160,79,80,140,90,74,148,107,93,185,129,97,188,126,80,167,110,61,153,119,
-85,173,132,107,188,119,110,184,113,103,171,106,96,157,78,90,133,51,59,110,50,58,134,69,86,169,86,81,143,53,49,78,16,28,54,16,60,109,51,74,126,56,59,102,34,61,108,39,
-52,102,53,37,85,69,21,78,75,37,112,92,75,144,114,82,149,127,72,147,132,66,145,128,39,114,100,38,100,84,56,124,112,70,134,127,81,127,110,83,118,89,54,88,63,20,54,49,
-18,61,61,23,67,66,7,35,35,10,18,8,27,36,12,22,43,28,11,46,42,12,50,47,11,47,45,10,40,41,8,32,30,10,24,14,6,14,6,1,6,3,0,1,1,0,1,0,
-0,1,0,7,6,2,22,20,5,34,32,9,32,31,10,19,20,6,6,8,2,0,1,0,0,0,0,0,0,0,0,0,0,6,5,1,13,11,3,17,15,4,15,15,4,9,10,3,
-5,7,2,7,8,2,10,11,3,7,8,2,2,4,1,0,1,0,0,0,0,0,0,0,3,2,1,2,2,0,0,0,0,0,0,0,0,0,0,0,1,0,7,3,2,16,6,4,
-20,8,5,20,9,6,23,10,9,25,8,13,25,7,14,24,6,14,23,6,15,25,6,17,29,8,24,34,11,32,37,13,35,38,13,36,40,14,37,41,14,37,41,14,38,41,14,38,
-41,14,38,42,14,38,41,14,39,42,14,40,43,15,42,44,16,42,44,16,42,44,16,41,43,16,41,43,16,41,43,16,41,41,15,40,38,15,38,35,12,35,31,10,32,28,9,30,
-25,9,27,22,8,24,18,7,20,14,6,16,12,4,12,16,4,13,26,6,22,35,9,32,39,10,37,39,11,35,37,10,34,35,10,32,28,9,27,26,8,24,31,8,26,38,9,31,
-35,9,30,23,6,21,13,3,13,14,4,12,27,6,21,37,9,29,35,10,30,22,7,23,11,4,16,12,4,14,21,6,18,32,8,25,42,11,34,55,15,43,60,17,44,54,15,38,
-41,11,32,36,10,34,52,15,48,64,18,57,55,16,50,40,11,34,45,12,28,73,19,50,90,25,69,81,23,59,67,18,47,54,15,43,38,9,33,36,8,22,63,15,25,74,17,29,
-64,24,35,62,51,50,70,70,64,91,69,80,112,50,80,106,30,65,101,26,57,119,36,69,110,45,75,66,53,68,76,66,78,115,52,84,136,61,98,138,98,108,127,130,121,136,160,145,
-159,162,149,177,168,151,184,176,158,154,152,121,126,151,116,156,181,160,182,187,181,180,168,172,144,155,162,120,162,152,137,159,117,150,139,71,150,129,84,134,136,123,104,100,91,99,47,43,
-102,41,40,47,25,34,29,59,32,51,70,22,35,32,9,8,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,3,14,9,12,54,32,14,64,41,30,121,80,61,167,104,84,164,84,94,160,84,71,119,70,78,143,94,99,188,129,95,185,122,75,163,109,
-63,156,125,92,177,127,115,193,118,112,186,116,100,169,102,103,161,75,92,134,51,52,105,46,62,140,72,99,178,90,83,141,49,45,74,14,29,59,18,62,112,52,79,129,57,58,101,34,
-58,104,37,53,104,54,40,89,71,25,89,82,38,116,94,72,141,112,84,151,128,79,149,132,71,146,129,60,129,108,64,120,91,69,128,108,65,127,117,79,125,110,81,113,85,58,82,57,
-45,70,52,53,83,74,43,82,80,29,59,52,36,46,20,40,45,13,26,41,21,12,41,34,11,48,46,11,48,46,12,44,43,30,52,42,37,50,30,18,28,11,3,10,4,0,1,1,
-0,0,0,0,0,0,1,1,0,10,10,2,25,24,6,34,31,9,29,26,7,16,14,4,5,5,1,0,0,0,0,0,0,0,0,0,0,0,0,4,3,1,10,9,2,16,14,4,
-17,17,4,21,20,5,26,23,6,24,22,6,18,18,5,12,12,3,6,7,2,7,8,2,16,15,4,17,15,4,13,11,3,8,7,2,3,4,1,1,1,0,0,0,0,3,0,1,
-11,3,3,12,3,3,13,4,3,13,4,3,14,3,4,15,4,5,16,4,6,18,5,7,22,6,13,28,9,21,31,11,25,34,12,28,35,13,31,36,13,31,36,13,32,38,14,34,
-41,15,38,42,16,40,40,16,40,38,15,39,36,14,38,36,14,37,36,15,37,35,14,36,33,13,34,31,13,33,29,12,32,27,11,30,24,10,27,21,8,24,19,8,21,16,7,18,
-16,6,18,18,7,19,22,8,23,30,9,29,38,11,36,45,12,43,48,14,46,47,15,46,44,14,42,36,12,35,33,10,31,34,11,31,36,11,33,38,11,34,36,10,32,32,9,30,
-28,8,27,32,9,29,40,11,34,46,11,37,36,9,31,22,7,23,10,4,16,12,4,15,28,8,20,41,10,28,40,10,32,49,13,39,63,18,47,69,19,52,63,18,50,56,16,49,
-58,17,53,71,21,64,75,22,66,54,15,47,39,11,30,55,15,36,83,23,61,95,27,74,87,25,65,75,21,51,71,19,49,62,15,48,56,14,42,76,19,40,75,19,33,62,24,35,
-65,53,54,76,73,71,94,71,83,109,47,79,112,32,76,112,31,72,120,32,70,111,35,71,88,56,73,95,68,81,118,56,87,136,60,98,146,98,111,139,127,121,139,152,141,156,164,149,
-175,166,151,182,175,161,156,158,130,125,149,113,149,177,155,181,187,181,184,171,175,153,157,164,120,164,158,133,165,136,146,145,102,145,123,86,140,135,119,112,115,105,97,54,49,103,40,37,
-62,27,35,27,51,35,49,78,30,44,43,11,12,6,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,23,14,13,57,34,13,61,40,32,123,79,69,170,99,88,166,84,88,144,70,67,107,54,82,155,99,100,191,131,93,179,114,
-69,157,107,65,157,125,107,187,132,120,195,122,113,187,117,108,171,101,119,160,62,92,126,38,45,102,45,66,145,77,99,177,87,91,149,50,59,91,19,32,63,19,64,113,53,80,129,59,
-70,111,47,82,123,61,75,119,66,49,97,70,35,99,83,39,120,98,73,144,118,106,158,135,101,155,135,83,152,133,77,142,114,73,124,89,71,121,95,71,127,112,80,127,112,84,117,92,
-70,92,61,61,81,54,71,93,75,74,102,89,51,74,58,33,40,16,37,37,7,32,38,13,16,38,26,15,44,38,22,48,35,32,52,37,44,63,49,46,62,42,29,37,18,10,11,3,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,0,13,13,3,26,25,7,32,29,8,28,25,7,17,16,4,6,6,1,0,1,0,0,0,0,0,0,0,0,0,0,2,1,1,
-7,7,2,15,14,4,23,22,6,29,26,7,32,27,8,33,26,8,27,23,7,23,22,6,24,24,6,25,24,6,25,23,6,23,20,5,22,18,5,20,16,4,14,13,3,14,10,3,
-21,10,5,23,9,6,22,7,5,25,7,6,26,7,7,23,6,6,20,5,5,18,4,4,17,3,3,17,4,4,17,3,5,17,4,6,17,4,7,17,5,8,19,5,10,26,8,18,
-33,11,28,36,13,32,35,13,32,35,12,31,33,12,30,30,11,28,30,11,27,28,10,25,23,9,23,19,8,20,17,7,19,18,7,19,20,7,20,24,7,24,28,9,27,31,10,30,
-36,11,35,44,13,41,50,15,46,53,17,50,52,17,50,48,16,47,41,15,41,38,14,37,35,13,34,36,12,34,37,11,35,37,11,34,33,10,32,28,9,28,30,8,28,34,10,32,
-43,12,39,52,15,46,49,14,43,32,10,32,12,5,17,11,4,13,25,7,18,41,10,26,47,12,34,51,14,40,63,18,50,74,21,57,72,20,57,62,18,54,63,18,57,73,22,66,
-81,24,73,77,23,69,59,17,51,48,13,34,65,18,45,88,25,68,97,28,76,91,27,69,80,22,56,76,21,53,77,20,59,83,22,65,85,23,57,74,19,39,61,17,33,63,36,44,
-76,63,68,105,69,85,114,45,80,110,30,76,116,33,77,121,33,73,109,36,71,93,57,74,115,74,88,132,57,92,138,52,93,143,93,106,140,124,118,139,145,136,155,160,147,173,163,145,
-180,173,158,154,161,145,118,147,123,141,170,151,183,186,177,187,174,176,157,156,164,120,163,159,130,171,150,147,156,121,146,133,101,142,133,115,111,127,114,74,57,47,99,44,34,79,47,52,
-26,42,38,41,72,27,48,53,13,17,13,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,8,35,21,12,55,33,12,61,41,45,142,89,78,169,96,91,163,79,85,134,60,66,107,56,86,163,104,96,183,110,
-86,171,98,64,154,109,71,160,127,110,188,123,118,194,119,114,186,117,121,176,97,123,160,56,80,114,34,47,106,48,76,154,81,114,187,90,100,157,52,63,95,21,39,69,21,78,122,56,
-104,145,83,106,137,91,113,144,91,84,126,71,59,108,73,45,113,96,45,132,118,86,153,134,117,161,138,111,157,135,96,152,130,81,143,117,78,133,104,97,134,104,92,135,115,80,128,115,
-81,117,96,72,95,65,64,85,57,73,90,63,78,94,67,52,65,42,29,32,10,36,35,7,36,38,9,29,40,16,37,47,17,38,47,15,33,46,27,38,55,42,43,55,37,36,34,13,
-20,18,4,5,5,1,0,0,0,2,1,0,0,0,0,0,0,0,2,3,0,13,13,4,26,26,6,33,30,8,29,26,7,20,18,4,10,9,3,9,8,2,5,5,1,2,1,1,
-11,1,3,15,3,4,11,5,3,12,9,3,26,18,6,39,26,10,43,30,11,41,30,10,37,29,9,32,28,8,29,26,7,29,26,7,34,25,9,37,25,9,35,24,8,32,23,8,
-33,22,8,32,21,8,34,21,9,40,21,10,44,21,11,44,20,12,43,19,11,42,17,11,40,16,10,39,15,10,38,14,9,37,13,9,36,11,8,34,9,8,34,9,8,36,9,11,
-39,11,16,41,12,20,40,12,19,41,12,20,40,12,22,38,10,23,38,11,24,37,10,26,33,10,27,33,9,31,37,11,35,42,13,41,48,14,46,52,16,50,54,17,52,55,18,52,
-54,18,52,54,19,51,52,19,49,50,18,48,47,17,45,43,16,41,45,15,41,45,14,41,40,12,36,35,10,33,30,9,29,28,8,27,32,9,30,43,12,39,54,16,49,58,16,52,
-49,14,45,31,10,33,16,7,22,16,6,20,30,8,25,41,10,27,50,13,35,56,15,45,62,18,50,74,22,59,82,25,68,79,24,68,71,22,63,69,21,64,79,24,71,82,24,74,
-68,20,61,54,16,46,61,18,46,83,24,62,94,27,74,98,29,78,99,29,77,93,27,70,83,23,61,80,22,63,92,25,73,94,27,66,77,21,49,66,18,40,60,16,36,80,36,56,
-108,48,77,124,45,83,117,33,79,117,34,76,129,38,79,122,45,77,104,62,78,120,76,92,139,58,98,142,46,92,143,81,96,138,120,114,139,141,133,154,151,142,171,160,142,180,169,151,
-155,159,143,117,149,128,129,164,151,177,183,181,189,173,181,160,151,165,108,153,159,124,176,161,139,164,148,142,140,128,144,133,118,119,132,119,54,67,53,59,37,18,69,63,56,32,70,75,
-20,64,48,30,40,14,20,17,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,4,7,32,18,8,39,22,22,81,52,57,155,95,78,164,88,92,161,74,80,124,57,66,110,56,88,161,89,
-93,176,98,83,166,95,56,137,97,68,147,109,106,184,106,115,192,115,114,185,118,122,174,97,123,158,55,88,126,39,60,123,55,85,163,85,116,188,95,105,163,71,63,96,26,55,82,22,
-104,140,71,123,159,103,120,146,104,116,147,94,89,129,70,64,115,79,49,124,110,43,136,127,81,152,135,126,164,140,125,159,132,112,154,133,91,149,133,84,140,116,101,137,105,98,138,113,
-81,129,114,77,115,95,77,104,75,61,81,52,60,70,34,70,73,37,61,68,37,39,46,22,33,33,8,38,38,8,39,43,11,36,40,10,40,42,10,43,47,16,37,44,21,31,29,9,
-36,31,8,30,27,7,20,19,4,22,19,5,15,13,4,4,4,1,0,0,0,0,0,0,3,3,1,14,13,4,22,21,5,29,26,7,31,27,7,35,30,8,30,27,7,21,19,5,
-22,12,5,29,8,7,27,6,6,21,3,5,22,4,5,28,9,7,32,13,8,35,19,8,39,23,10,41,27,10,41,29,10,41,31,10,43,30,11,43,29,11,42,27,10,41,27,10,
-40,26,10,39,26,9,38,26,10,40,27,10,44,27,11,44,27,11,44,26,12,43,24,11,44,25,11,45,25,14,50,28,24,51,29,27,49,25,26,45,17,23,42,11,21,43,11,21,
-44,12,22,44,12,26,44,12,27,45,12,29,48,14,37,51,16,45,52,17,47,53,18,49,53,17,50,55,19,53,57,20,56,58,21,56,57,21,55,54,20,52,51,19,50,48,18,46,
-47,17,44,48,17,45,48,16,46,49,16,46,49,16,46,49,15,46,48,14,44,45,13,41,39,11,36,35,10,32,39,11,36,52,15,47,64,19,58,66,20,62,57,17,54,35,12,38,
-16,6,22,17,6,21,37,10,31,55,14,44,62,16,50,61,17,50,68,20,56,78,23,64,83,25,68,81,24,69,75,23,67,74,23,68,82,26,75,87,27,80,76,23,69,47,14,46,
-49,14,41,81,24,62,101,30,82,102,30,83,99,30,78,101,30,80,103,31,81,95,27,76,87,24,72,95,27,74,91,26,63,75,22,50,77,22,54,82,22,54,85,23,57,108,31,70,
-122,35,80,119,34,81,121,36,79,131,39,80,128,38,76,122,56,80,129,75,94,139,58,99,142,46,95,143,81,96,137,112,110,145,139,138,157,154,147,167,159,144,175,168,153,148,154,142,
-105,140,124,126,164,148,174,184,183,192,177,190,159,142,169,103,143,159,109,171,161,137,174,160,139,146,142,144,138,136,125,133,124,65,81,66,34,27,8,40,47,33,28,79,81,18,84,81,
-8,31,25,3,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,5,21,12,11,48,27,29,101,63,63,162,98,84,164,86,95,160,76,78,120,55,69,114,57,
-88,163,89,95,177,96,78,156,88,51,122,80,67,134,81,108,180,97,111,186,105,110,182,115,122,173,92,126,161,53,94,138,42,61,127,57,84,164,92,121,193,119,106,167,84,81,113,31,
-87,108,28,111,140,64,117,144,90,116,140,98,126,151,95,103,138,75,69,120,79,54,127,109,45,135,125,84,154,137,142,169,143,148,166,139,129,159,141,99,153,138,82,143,122,95,136,105,
-101,136,106,90,128,104,86,119,92,80,108,80,66,87,59,54,63,30,66,69,27,79,83,44,63,68,35,37,39,12,35,35,7,36,37,8,39,38,9,58,54,13,63,60,14,45,44,11,
-31,29,7,31,28,7,39,34,9,37,34,8,33,29,8,26,23,6,13,12,3,9,4,2,15,3,4,19,3,5,14,4,4,10,8,3,18,16,4,26,23,6,33,29,8,35,31,8,
-35,31,9,34,26,8,32,20,8,30,13,7,31,9,7,39,9,9,43,9,11,37,9,9,33,8,8,33,10,8,37,15,9,38,20,9,39,23,10,39,23,10,35,19,9,37,21,9,
-39,23,9,40,23,10,40,25,10,40,25,10,42,26,10,45,27,11,39,19,10,35,14,8,35,14,9,38,16,12,44,20,23,45,22,28,45,19,28,42,14,27,41,12,26,45,13,28,
-48,14,32,48,15,39,46,15,40,46,15,40,49,17,44,52,18,47,50,18,46,50,18,45,52,19,46,52,19,46,47,17,45,42,16,41,40,15,39,42,15,40,43,15,41,44,14,41,
-46,14,43,49,15,46,49,15,45,46,14,44,45,14,43,45,13,43,47,14,45,52,15,50,59,18,56,64,19,59,68,20,62,64,19,60,50,16,50,31,12,36,20,9,26,24,9,25,
-42,11,36,58,15,47,67,18,55,71,21,61,77,25,67,83,26,72,88,27,75,86,27,74,72,22,65,63,20,60,73,23,68,90,28,82,92,29,84,75,22,70,43,13,43,48,14,44,
-91,26,74,110,34,89,105,33,86,100,30,79,102,30,80,101,30,81,94,27,78,92,27,78,96,28,73,87,25,59,78,22,52,82,23,59,91,25,66,100,28,73,115,32,76,123,35,80,
-118,34,81,122,36,78,132,39,80,128,37,75,125,36,76,137,47,93,142,49,100,140,49,93,141,81,96,139,112,111,137,122,126,152,139,138,167,157,142,169,168,158,131,146,146,73,117,115,
-95,143,138,166,175,178,191,180,194,166,152,178,99,136,157,96,163,158,133,174,159,138,151,146,144,137,136,135,143,133,72,94,79,32,28,12,43,46,27,31,75,74,21,95,90,12,52,45,
-1,4,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,1,5,24,13,11,45,28,33,109,68,68,161,94,87,163,82,96,158,74,73,110,50,
-64,96,43,90,156,79,96,179,97,75,149,82,46,103,62,65,116,60,102,168,73,111,186,99,109,180,115,124,174,93,125,162,53,86,129,39,55,117,48,82,154,84,121,192,120,111,171,87,
-92,124,35,91,110,24,108,130,51,115,141,86,130,151,106,143,162,104,120,150,90,90,139,101,72,139,116,60,141,128,91,155,137,142,170,144,154,170,143,138,162,142,115,159,144,91,148,128,
-94,139,111,115,142,105,116,141,112,100,127,102,84,107,80,65,88,60,56,71,40,71,74,29,92,91,40,84,88,43,53,58,26,35,36,10,35,36,7,45,44,10,61,59,14,71,67,17,
-60,58,15,45,44,11,47,43,11,48,44,11,42,37,9,38,33,9,33,30,8,33,25,8,42,20,10,47,15,11,42,10,10,29,5,7,21,8,4,18,13,4,15,14,4,20,19,5,
-28,25,6,34,30,8,36,32,9,34,30,8,33,26,8,38,22,9,44,18,11,47,15,12,48,14,12,51,14,13,54,14,14,51,13,14,46,12,12,40,11,10,35,9,9,32,10,8,
-31,10,7,31,12,7,30,13,7,31,15,8,35,17,8,39,19,9,36,14,8,33,8,7,33,8,8,31,8,8,25,6,6,24,5,7,25,5,8,24,6,9,25,6,9,29,7,13,
-36,10,20,34,10,25,36,11,27,36,11,28,35,11,28,35,11,29,34,10,28,33,10,27,33,10,28,31,10,28,28,8,27,26,8,25,35,10,32,43,13,40,47,14,43,47,14,44,
-45,14,43,44,13,43,45,14,44,49,14,47,54,16,51,61,19,57,68,21,64,70,23,66,65,21,63,54,19,54,36,13,40,22,9,28,18,8,22,29,9,28,49,14,41,62,17,50,
-67,19,57,71,21,62,78,25,69,87,28,76,92,31,81,90,29,81,79,25,73,67,21,62,63,19,60,76,23,70,89,27,80,87,26,79,73,22,67,59,17,54,77,23,66,106,32,89,
-112,35,93,105,32,85,102,31,81,103,31,82,99,28,80,92,27,79,96,28,79,98,29,71,83,24,55,80,22,54,88,24,62,93,26,68,105,31,77,125,36,84,122,36,83,112,33,79,
-120,36,77,132,39,79,126,37,74,126,36,77,143,42,102,149,44,110,139,42,94,129,74,94,132,112,111,139,117,125,148,126,128,162,141,129,166,164,155,123,142,145,54,107,110,70,121,127,
-151,166,177,185,173,193,167,150,180,99,135,157,71,158,153,107,169,155,124,146,143,141,136,136,137,138,131,80,103,89,33,34,17,43,42,20,30,64,64,21,88,87,14,62,56,1,7,5,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,7,4,5,26,16,10,38,24,35,101,61,69,152,82,88,160,77,95,153,71,
-66,89,36,64,94,40,89,158,81,92,175,96,69,140,75,40,86,47,67,111,49,114,173,78,116,186,101,109,180,115,116,167,83,120,157,44,84,122,32,46,92,26,79,145,77,117,190,118,
-114,174,92,96,128,38,93,109,23,112,137,62,127,156,109,138,161,121,150,170,121,136,167,117,114,156,111,107,154,121,81,149,130,84,153,136,132,167,142,158,172,142,154,168,142,133,164,147,
-99,153,135,101,144,114,128,149,117,127,145,116,105,123,98,83,100,75,72,92,67,56,79,55,54,65,32,80,81,31,97,96,45,82,86,41,50,54,21,33,34,8,40,40,9,62,61,14,
-74,72,18,75,72,19,73,69,18,66,62,17,54,50,13,47,43,11,42,38,9,39,34,9,44,34,11,51,31,12,52,25,13,51,17,12,51,19,12,50,24,12,40,22,10,25,17,6,
-16,13,4,16,15,4,21,20,5,31,28,7,35,31,8,28,26,6,21,18,5,26,19,6,42,29,11,55,32,13,63,30,16,65,26,17,64,22,17,62,19,17,60,17,16,56,15,14,
-51,13,13,47,12,12,43,11,10,41,11,11,41,11,17,38,10,16,35,9,14,33,8,11,32,8,11,28,6,9,16,4,6,8,2,4,7,1,3,8,2,3,7,1,2,8,2,3,
-9,2,6,11,3,8,20,5,16,29,8,25,31,9,27,31,8,28,32,9,29,33,9,30,33,9,31,30,9,28,26,7,24,25,7,24,32,9,31,40,12,38,46,13,43,47,14,45,
-51,15,48,54,16,51,59,18,56,64,20,61,62,20,59,56,19,55,48,17,50,36,14,41,23,10,29,18,8,23,23,8,23,38,10,32,54,15,44,65,18,54,68,21,59,71,22,63,
-76,24,69,83,26,75,89,28,80,89,28,80,80,26,74,68,22,64,65,20,62,74,23,69,86,26,78,86,25,77,76,23,69,72,21,65,82,24,71,100,30,85,115,37,98,115,37,97,
-108,34,89,102,31,81,101,30,81,94,28,78,92,27,78,103,30,79,103,30,69,88,25,56,81,22,56,88,24,63,95,26,71,112,33,79,131,39,86,126,38,85,106,31,75,109,31,73,
-126,36,73,124,35,71,129,38,82,146,44,106,151,46,114,140,45,99,120,63,93,115,88,107,135,111,125,148,124,126,161,140,128,163,148,146,116,119,131,49,89,101,69,123,128,148,161,175,
-183,168,192,160,134,172,99,125,150,67,154,150,78,166,149,87,140,136,122,134,141,137,145,140,89,110,95,32,36,20,42,39,17,36,65,60,18,67,76,12,55,55,3,14,10,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,3,3,13,7,7,25,15,38,105,60,71,150,79,92,162,76,
-92,146,68,62,85,33,65,102,45,91,163,83,89,170,91,65,137,72,44,87,47,89,127,55,133,185,79,116,185,99,102,168,91,109,156,53,118,156,38,84,119,27,50,94,25,80,147,74,
-117,190,118,112,175,94,94,130,41,96,114,30,119,143,72,126,155,112,130,157,120,151,171,121,152,175,122,137,167,117,127,161,120,94,150,126,75,149,133,116,163,141,154,170,137,157,168,136,
-140,164,139,114,156,132,111,150,121,128,149,113,129,143,108,112,124,95,90,103,80,59,83,65,31,63,52,35,56,38,63,67,25,101,100,39,107,109,53,75,79,36,44,46,13,36,36,8,
-50,50,11,66,65,16,76,74,19,81,77,21,79,74,20,66,63,16,55,51,13,47,43,11,43,40,10,40,36,9,41,32,9,47,31,11,55,28,13,64,27,16,71,28,18,66,28,17,
-53,25,13,37,21,9,28,20,7,35,30,9,37,33,9,27,24,6,12,11,3,9,9,2,21,20,5,36,32,9,46,38,12,53,40,13,56,39,15,60,38,15,63,34,16,63,31,16,
-64,27,17,65,24,17,63,21,16,63,20,17,64,20,25,62,19,28,58,16,27,54,15,26,53,15,26,51,14,26,47,13,24,39,11,21,37,10,20,36,10,20,36,9,19,31,8,18,
-21,5,15,16,4,14,21,5,18,32,8,30,36,10,35,36,10,35,36,10,36,36,10,36,36,10,36,38,11,37,37,10,36,41,12,39,42,13,41,47,14,45,54,17,51,60,19,57,
-58,19,56,52,17,51,44,15,45,35,13,38,24,10,29,17,7,22,16,6,19,22,7,21,35,10,29,49,13,39,61,17,50,72,21,63,78,24,70,79,26,73,79,25,73,84,26,77,
-86,27,80,83,26,78,75,24,71,66,21,63,66,21,62,75,23,69,85,26,78,86,26,79,78,23,71,71,21,64,81,24,70,98,29,83,111,35,96,113,36,99,109,35,92,106,33,86,
-103,30,82,100,30,83,96,28,82,97,28,79,107,31,76,102,29,64,89,25,58,81,22,60,86,23,64,101,29,74,120,35,82,133,40,87,123,37,83,105,31,75,110,32,78,121,34,78,
-122,34,71,133,38,88,149,45,111,153,47,116,136,42,92,116,52,83,111,78,103,128,102,120,151,124,128,162,140,130,160,148,147,109,106,126,43,76,93,71,120,127,151,165,177,182,163,188,
-158,122,164,94,103,133,65,144,139,78,166,146,75,137,134,99,129,140,125,150,155,95,132,123,36,46,31,45,40,19,37,62,61,17,67,75,13,54,58,2,13,10,1,0,4,1,1,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,11,31,18,43,109,60,73,144,69,
-95,163,76,89,144,66,57,81,33,66,100,43,89,152,73,87,162,81,67,138,71,46,91,48,92,128,56,131,183,78,115,181,86,95,158,67,99,146,43,114,152,38,95,133,31,65,115,28,
-88,152,80,126,191,125,118,176,99,92,131,45,92,108,27,111,125,60,126,152,106,131,158,121,151,170,121,162,178,123,154,174,120,139,166,119,104,154,128,70,141,126,101,152,132,145,165,132,
-155,164,123,146,161,119,132,161,129,126,158,128,128,152,115,131,146,104,119,132,98,87,101,66,60,83,45,57,85,57,45,62,37,45,47,13,82,80,25,113,112,46,108,111,52,73,77,34,
-42,43,13,36,36,7,53,53,12,81,78,20,93,88,23,93,89,24,82,77,20,68,63,17,58,53,13,51,47,12,44,40,9,38,34,9,42,34,9,58,35,14,74,36,19,78,33,20,
-76,30,20,72,29,18,66,30,17,63,38,16,57,41,14,50,39,12,40,33,10,31,28,8,24,22,6,22,20,5,22,21,5,25,24,6,29,28,7,35,32,8,41,35,10,47,38,11,
-49,39,12,53,39,13,55,37,14,52,29,13,54,26,13,54,26,14,51,23,14,52,22,15,53,22,17,54,21,17,53,21,19,45,18,16,42,17,15,43,17,17,39,13,15,28,9,12,
-14,5,9,3,2,7,7,3,9,16,5,18,25,8,28,26,9,29,23,8,27,22,8,25,26,9,27,36,12,35,41,13,40,44,15,44,40,14,42,35,12,37,34,12,35,30,11,32,
-24,8,26,19,7,22,16,5,18,14,5,16,23,7,20,39,10,31,50,14,41,58,16,48,63,18,55,67,20,61,74,22,68,82,26,76,86,28,80,87,29,82,85,28,81,80,25,76,
-71,22,67,64,20,61,66,20,62,77,23,70,86,26,78,86,26,79,78,23,72,72,21,64,77,22,66,94,28,79,108,33,94,110,34,97,106,33,92,102,31,85,102,31,82,102,31,83,
-101,30,86,107,32,93,112,33,88,105,31,70,96,28,60,87,24,60,80,21,62,78,21,64,103,29,76,128,38,85,133,40,88,115,34,79,104,30,76,119,35,86,131,38,92,133,39,91,
-142,42,101,152,46,115,150,46,112,132,41,89,108,31,62,106,48,76,128,94,115,144,122,123,156,134,131,145,127,144,91,92,120,38,80,95,64,120,127,144,164,177,181,163,191,159,122,168,
-92,97,135,58,133,130,76,163,141,79,142,135,81,121,134,94,138,155,66,133,133,39,72,58,38,36,25,47,70,85,25,72,92,13,56,60,4,17,17,6,6,25,8,10,38,1,1,5,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,11,26,13,44,97,48,
-77,141,65,97,165,76,86,138,64,56,78,29,61,86,29,84,141,60,87,161,80,59,131,68,38,82,45,95,130,58,129,179,73,112,175,75,86,150,63,98,146,43,120,158,40,108,151,37,
-84,137,52,106,164,107,136,189,129,124,177,101,90,131,49,85,99,23,105,117,50,126,149,98,136,162,122,159,175,127,174,184,137,165,180,125,145,170,118,122,160,126,99,153,133,101,154,134,
-131,160,131,154,164,120,155,164,113,146,164,121,132,161,127,129,156,123,136,151,109,126,134,77,105,110,46,89,98,35,79,96,42,57,74,40,42,50,21,68,67,18,111,107,38,126,127,55,
-110,114,52,72,74,29,44,45,12,54,52,11,80,75,19,94,88,24,96,90,25,94,89,24,87,84,22,84,79,22,73,68,18,58,54,14,47,43,11,45,38,10,52,37,12,61,37,15,
-70,37,18,73,33,19,77,32,20,77,34,20,75,34,19,71,36,18,67,39,17,62,41,15,55,41,14,47,38,11,39,33,9,32,28,7,27,24,6,23,21,5,27,22,6,33,24,8,
-33,25,8,34,27,8,35,28,8,33,27,7,32,26,7,32,26,8,34,27,8,34,27,8,35,27,8,36,27,8,37,27,9,36,27,8,36,26,8,36,26,8,27,17,6,12,6,3,
-1,0,0,0,0,1,0,0,0,0,1,2,4,1,5,3,1,4,1,1,3,0,0,2,1,1,2,7,2,7,13,4,13,15,5,16,12,5,14,11,3,12,15,4,15,23,6,22,
-33,8,31,40,11,38,44,12,41,44,12,41,54,15,49,65,19,57,66,20,61,68,21,63,70,22,66,77,24,71,85,28,79,86,29,81,83,28,78,76,24,71,66,21,64,61,18,58,
-64,19,59,77,23,70,87,26,78,86,26,78,76,23,70,70,20,62,74,21,64,89,26,75,103,31,87,108,33,94,105,33,91,102,31,85,102,30,82,100,30,81,100,30,85,105,31,92,
-114,34,94,114,34,84,100,29,65,86,24,57,81,22,60,77,21,61,89,25,69,116,34,81,134,40,88,127,38,85,109,32,77,107,31,78,126,36,90,137,40,97,144,43,105,151,47,115,
-153,48,118,147,45,107,125,38,81,105,29,58,101,29,60,113,60,88,127,105,110,143,131,129,127,117,140,64,64,108,23,64,84,64,119,124,133,160,174,165,160,189,149,123,173,91,103,146,
-45,127,138,58,154,142,68,137,133,89,132,146,89,149,165,51,132,137,23,69,56,37,38,24,47,69,86,33,87,124,17,65,79,4,21,18,4,4,20,12,16,56,6,9,29,0,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,13,28,12,
-44,85,40,79,137,60,96,165,76,82,135,60,53,69,23,63,87,29,81,141,60,83,158,78,57,123,63,37,71,35,83,112,37,124,167,55,99,159,69,75,141,62,94,145,45,125,165,42,
-119,163,47,91,148,67,99,157,100,131,179,117,126,178,101,95,139,56,85,103,23,101,110,39,125,144,90,139,162,128,161,175,143,176,184,147,170,182,131,156,175,126,147,170,136,124,163,141,
-99,153,134,116,157,133,148,163,122,153,160,92,148,158,93,142,163,125,141,162,130,140,154,108,134,141,79,124,127,57,109,114,45,91,103,41,75,92,43,63,75,38,59,62,20,83,81,21,
-118,116,42,129,129,56,111,112,51,75,76,31,53,54,16,59,56,13,78,73,19,93,88,24,100,96,26,102,98,27,100,95,26,92,87,24,79,74,20,65,60,16,52,48,12,46,40,11,
-41,32,9,34,20,8,50,26,12,73,43,18,82,49,22,82,43,22,79,37,21,76,34,20,73,34,19,70,36,18,66,38,17,63,40,15,58,42,15,51,40,13,49,37,12,47,34,11,
-44,31,10,42,29,10,40,28,9,39,27,9,38,25,9,37,25,8,37,24,8,35,24,8,33,24,8,32,22,8,28,18,6,28,18,7,29,18,7,27,18,6,23,13,5,16,6,4,
-11,3,2,13,3,3,15,3,4,16,3,4,16,3,4,11,2,4,5,1,3,6,1,4,9,2,7,11,2,9,15,4,11,18,4,14,21,5,18,26,6,22,37,9,32,52,14,48,
-57,17,55,57,17,55,61,19,59,64,20,61,64,20,61,65,20,61,71,22,66,75,24,70,75,24,69,71,23,67,64,21,61,59,19,58,59,18,57,59,18,56,64,18,60,70,20,64,
-76,22,68,81,23,72,75,22,67,68,19,60,68,19,58,81,22,66,100,30,83,109,34,95,106,33,93,102,31,86,100,30,81,101,30,81,100,29,84,103,30,89,112,34,95,116,35,88,
-107,32,70,90,26,58,72,20,55,65,17,56,79,21,62,103,29,75,129,39,88,135,41,89,118,35,81,105,30,75,114,33,82,131,38,94,140,41,100,147,44,109,154,48,120,154,49,119,
-143,43,102,120,36,74,102,27,57,100,29,60,110,57,88,116,82,106,123,107,125,105,102,135,48,58,99,18,55,72,66,102,108,136,152,168,162,158,189,138,122,172,80,104,147,40,125,137,
-36,140,141,50,124,133,86,130,150,90,155,172,56,150,157,17,74,70,18,23,16,41,62,80,36,87,130,26,78,113,7,28,35,4,4,20,10,12,47,7,8,30,0,0,2,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,
-12,21,8,45,82,33,81,140,61,100,168,79,81,132,62,50,65,23,60,84,28,80,140,60,80,154,73,53,104,48,30,48,17,74,90,21,109,147,48,91,152,66,73,140,62,90,142,45,
-122,160,40,122,165,45,93,149,64,95,151,93,126,176,117,130,181,110,105,155,77,83,108,28,93,103,30,122,135,86,145,163,143,155,169,158,172,179,154,174,183,144,166,180,142,156,176,147,
-138,169,145,106,156,135,103,153,131,129,153,107,147,153,74,150,156,76,150,162,106,147,163,126,141,158,119,136,148,95,130,135,70,120,123,55,109,115,46,102,112,47,79,88,31,56,58,12,
-60,58,13,88,86,25,122,121,45,132,132,58,111,112,50,78,80,32,55,56,18,56,54,13,77,73,19,91,85,23,100,94,26,106,102,29,104,100,28,97,93,26,87,81,22,75,70,19,
-56,52,13,32,30,8,28,25,6,47,37,11,61,46,15,69,50,17,76,52,20,80,51,21,81,47,21,78,38,21,74,28,19,74,27,19,72,29,18,71,32,18,63,33,16,51,33,12,
-46,35,10,46,37,11,47,38,11,39,31,10,35,27,8,37,29,9,38,28,9,39,28,9,40,28,9,34,22,8,20,9,4,18,3,7,30,7,18,30,8,19,31,8,20,30,8,19,
-30,7,19,31,8,20,31,8,20,30,7,20,29,7,20,23,6,20,22,6,20,27,8,25,33,9,31,34,10,32,34,10,33,36,10,35,36,10,35,35,11,36,38,12,39,49,16,48,
-54,18,52,57,18,55,60,19,56,58,18,55,52,16,51,50,16,48,53,16,51,51,15,49,40,13,41,31,10,32,31,9,31,42,11,38,53,15,48,68,19,60,75,21,67,71,20,64,
-68,19,60,66,19,57,72,19,59,82,23,67,94,27,77,103,31,87,108,33,94,107,33,93,103,31,85,100,30,81,100,30,84,102,30,89,110,33,94,116,35,91,112,34,76,98,29,62,
-78,22,56,64,17,55,65,17,57,91,25,69,120,35,84,137,41,90,126,39,85,98,29,73,102,29,77,127,36,93,137,40,97,142,43,103,145,44,111,147,46,118,146,46,113,133,40,91,
-101,29,61,92,23,51,107,36,72,113,63,93,116,80,105,116,91,124,89,84,128,37,53,90,20,56,70,75,105,111,138,142,163,157,136,178,130,107,162,77,103,143,36,127,135,32,137,137,
-69,129,150,101,135,163,98,157,177,61,155,166,26,87,98,6,15,28,17,46,75,32,86,128,27,77,114,10,31,46,3,2,16,11,13,50,9,10,40,1,1,4,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,3,0,16,26,9,47,81,32,82,129,52,95,152,71,67,114,55,45,60,20,57,83,29,79,139,58,80,153,69,51,103,47,18,33,12,61,72,16,106,140,44,88,142,62,59,125,60,
-78,132,45,121,161,40,124,166,43,98,151,58,93,152,93,124,176,129,141,194,145,114,169,102,85,118,38,88,98,25,118,132,85,134,156,147,145,160,159,164,172,156,177,184,154,171,184,151,
-160,178,148,148,173,147,119,161,140,97,149,129,114,150,114,144,154,87,153,157,70,152,158,84,149,162,115,146,163,126,140,154,106,133,141,73,131,133,62,126,127,53,116,120,42,97,101,27,
-73,76,17,56,57,12,67,66,15,100,98,27,125,123,43,132,131,55,117,118,56,85,86,31,61,60,14,56,53,13,71,65,18,93,87,24,105,100,28,107,104,29,106,101,29,102,97,27,
-93,87,25,81,76,21,70,65,17,60,56,15,54,49,13,51,45,12,53,45,12,56,45,14,61,45,14,66,45,17,70,43,18,74,41,19,75,37,19,75,33,19,69,29,18,59,24,14,
-50,21,12,49,21,11,46,21,11,37,15,9,20,10,5,9,8,2,9,9,2,11,11,3,13,12,3,10,9,2,4,4,1,1,0,1,9,2,9,12,4,12,12,4,12,10,3,13,
-10,4,12,10,4,12,9,3,11,7,4,10,6,3,9,5,3,8,11,4,12,27,8,28,35,11,36,32,11,35,30,11,32,26,9,29,22,8,25,16,7,21,14,6,17,23,7,22,
-30,9,29,42,13,39,40,12,38,31,10,31,22,7,24,14,4,17,13,4,14,22,6,20,35,10,31,44,12,39,51,13,44,55,14,47,57,15,50,63,17,56,64,18,56,69,19,57,
-76,21,61,84,24,67,93,27,75,101,31,86,103,30,89,101,31,86,100,30,82,101,30,83,102,31,85,102,30,88,104,30,91,107,32,89,109,33,77,100,29,64,83,23,56,68,18,55,
-62,17,56,74,20,63,104,29,77,130,39,88,134,40,88,109,33,77,87,24,69,101,27,81,131,37,99,142,42,104,144,44,106,145,44,115,137,42,114,125,38,100,108,32,72,82,22,47,
-67,17,42,89,36,66,113,71,99,117,84,111,112,84,124,77,68,119,29,48,82,28,66,74,85,103,113,143,140,165,154,129,177,118,85,149,65,82,125,33,124,128,35,138,137,68,126,147,
-116,141,174,106,159,186,62,151,165,31,83,102,18,23,59,22,49,88,30,85,126,27,78,115,11,34,48,2,0,6,12,20,54,10,21,46,2,3,7,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,4,5,1,18,23,6,46,57,14,75,107,38,83,140,66,63,110,51,43,61,21,55,78,25,78,139,59,80,152,69,49,101,47,12,28,13,53,62,14,87,112,36,70,117,52,
-37,100,49,67,121,41,114,156,41,122,161,40,99,152,56,91,157,102,117,180,147,141,193,153,124,178,116,91,132,51,85,100,24,110,120,77,139,155,146,146,161,165,156,165,157,172,178,154,
-174,184,151,165,179,147,155,175,147,133,166,143,107,155,135,114,153,125,138,157,105,146,153,76,147,152,70,151,160,94,150,164,113,141,157,99,136,147,81,133,138,67,132,134,64,127,128,55,
-114,117,39,96,100,25,74,77,17,62,63,14,71,70,16,94,92,25,117,115,39,124,121,37,116,114,31,88,85,23,63,60,15,59,54,14,69,65,17,86,81,22,97,92,25,106,103,29,
-110,106,31,110,105,31,105,99,29,93,87,25,80,73,20,69,63,17,63,57,15,56,51,14,50,45,12,43,38,10,44,37,10,50,40,12,55,41,13,61,43,15,64,42,16,64,41,16,
-64,39,15,64,37,16,62,32,15,58,30,14,42,23,10,21,16,4,14,13,3,11,11,3,9,9,2,9,9,2,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,9,3,9,9,3,10,7,3,9,4,2,6,2,1,3,0,1,2,0,0,1,0,0,0,0,0,0,
-4,1,4,9,3,8,7,2,8,2,1,4,0,0,0,0,0,0,4,1,3,28,7,22,53,13,45,59,15,51,55,14,48,53,14,45,59,16,48,69,19,56,80,23,65,89,25,70,
-92,26,74,92,26,77,91,27,80,86,25,77,79,23,71,82,24,66,88,25,71,96,28,82,105,31,92,102,30,88,88,26,71,72,20,54,73,20,51,69,18,53,61,16,54,69,18,58,
-92,25,71,112,32,81,122,36,85,107,31,75,84,24,63,84,22,67,114,31,88,136,39,99,140,42,100,142,44,106,141,43,114,132,40,110,113,33,87,88,25,55,65,17,37,65,17,43,
-82,35,62,106,71,94,116,85,114,106,83,128,63,56,109,18,36,64,23,60,65,90,106,119,145,134,167,149,115,171,111,77,142,51,70,109,29,115,120,36,135,138,59,118,149,99,133,170,
-102,159,184,61,150,165,29,77,96,17,21,55,27,59,110,35,92,143,28,81,119,11,33,48,3,2,13,10,17,44,15,45,69,7,29,35,1,5,3,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,6,9,2,21,27,6,48,58,14,74,104,37,81,130,58,59,102,45,41,60,21,56,81,27,78,133,55,80,151,68,49,107,48,13,31,14,35,36,7,74,91,27,
-60,104,46,32,98,50,56,115,46,99,137,37,114,148,36,98,148,50,88,153,96,106,165,135,135,183,150,131,183,128,99,147,71,90,110,35,122,126,81,149,158,142,144,159,162,149,160,161,
-169,178,162,176,183,154,168,178,144,156,173,145,141,167,140,121,156,123,110,147,116,118,150,112,133,149,91,142,147,65,147,151,66,150,160,88,145,159,99,136,153,91,135,146,80,131,137,69,
-124,127,62,119,121,48,114,117,39,97,101,27,76,80,19,62,64,14,62,61,13,79,77,19,102,98,27,115,111,31,113,110,30,96,93,25,75,72,19,61,58,15,59,56,14,71,66,18,
-92,86,24,107,102,30,113,108,32,111,106,31,104,99,29,97,91,25,89,82,23,83,77,21,74,67,19,54,50,13,38,35,9,35,33,8,35,32,8,35,32,9,38,34,10,43,36,10,
-45,36,11,51,40,12,55,41,13,58,43,14,52,41,12,47,40,11,46,39,11,45,38,11,43,36,10,38,32,9,20,17,5,6,5,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,14,3,11,34,9,29,47,12,40,41,11,37,38,11,33,54,14,40,76,21,58,88,25,70,88,25,72,75,21,64,
-65,19,58,63,18,58,65,19,60,62,18,57,61,17,55,70,19,60,84,23,72,89,26,74,86,25,68,68,19,53,55,14,44,53,14,45,55,14,48,55,14,46,71,18,53,103,28,71,
-117,33,82,103,30,75,73,20,59,66,17,52,91,24,67,128,35,91,141,41,100,139,42,98,128,38,94,121,35,95,116,35,93,102,30,72,78,22,45,60,16,35,68,17,45,89,24,53,
-93,47,70,94,71,105,87,74,123,48,49,98,10,23,44,17,32,33,70,86,103,122,119,159,132,106,166,99,72,134,49,81,117,28,119,123,38,131,134,57,113,148,71,120,168,70,144,176,
-49,135,153,25,70,89,18,22,57,29,61,113,36,92,145,29,78,118,10,33,46,2,2,11,12,20,54,18,50,81,13,51,58,5,24,21,1,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,0,7,10,2,24,29,7,49,59,15,73,101,33,79,121,49,61,103,44,43,62,23,56,77,24,75,122,45,72,126,46,45,84,30,8,14,4,25,24,4,
-67,80,22,63,104,44,34,93,49,39,79,32,80,100,24,105,130,29,97,140,40,83,143,77,94,153,122,127,176,147,139,188,142,110,164,94,102,131,48,121,126,66,144,150,121,144,159,157,
-136,157,165,156,169,164,173,179,156,169,176,145,156,168,136,144,161,124,127,152,108,112,146,109,108,142,110,116,136,93,129,134,62,142,144,53,147,153,67,145,158,89,140,158,98,133,151,90,
-124,136,74,117,122,61,119,121,59,119,120,51,112,114,39,99,103,28,82,85,19,65,68,15,59,59,14,69,68,16,88,85,22,107,103,28,116,112,31,108,105,28,87,84,22,63,61,15,
-54,51,13,58,55,14,73,69,18,89,85,24,103,98,28,107,102,29,105,98,28,103,97,28,99,92,26,91,85,24,82,75,21,70,63,17,58,53,14,52,46,12,46,41,11,38,35,9,
-25,23,6,20,19,4,22,21,5,25,23,6,30,27,7,32,28,8,34,29,8,37,31,8,40,34,9,37,31,8,20,17,5,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,1,19,5,15,19,5,17,21,5,18,34,9,28,52,14,44,68,18,56,72,20,60,58,16,52,44,12,41,24,6,25,
-24,7,24,43,11,38,59,15,51,63,17,54,66,18,54,71,20,55,71,20,53,62,17,47,55,14,43,52,13,44,55,14,48,55,14,47,61,16,45,77,20,44,91,24,48,91,25,57,
-73,19,54,61,16,49,77,20,58,117,32,84,137,40,97,142,42,99,136,41,96,120,35,89,100,28,76,93,26,63,84,23,48,69,18,37,61,15,38,74,18,46,88,23,50,84,22,50,
-66,40,85,46,48,102,25,41,77,9,23,34,27,25,28,73,68,95,107,94,147,108,91,153,75,66,122,40,78,109,30,117,127,42,128,144,61,113,152,71,124,171,64,140,175,46,121,148,
-25,59,83,16,21,56,28,63,115,36,92,145,26,75,112,10,31,44,3,2,15,15,23,63,23,57,98,16,53,68,6,25,24,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,1,0,8,11,3,26,33,8,51,60,15,71,92,27,70,106,40,55,97,42,43,68,26,50,63,16,65,94,25,63,104,29,38,66,16,10,15,3,
-16,14,2,66,75,20,72,104,38,38,79,38,28,58,25,56,66,17,89,103,22,96,133,33,84,141,64,86,148,109,115,167,141,137,186,150,122,178,125,96,136,65,106,114,47,135,136,93,
-136,153,145,131,158,168,141,164,168,163,173,161,170,174,149,162,168,137,148,160,123,136,155,113,122,147,106,103,128,93,105,125,89,119,130,77,139,142,59,146,148,53,144,152,70,144,158,93,
-138,156,98,127,143,88,118,127,67,109,112,45,103,105,47,109,111,55,112,113,45,104,108,32,88,92,22,71,74,17,61,62,15,62,62,14,74,72,18,93,90,23,100,97,26,103,101,27,
-96,94,25,78,77,19,55,54,13,44,42,10,51,47,12,64,60,16,78,73,20,91,85,24,101,94,27,105,98,28,102,96,27,95,89,25,86,79,21,80,73,20,77,71,19,70,63,17,
-52,47,12,36,32,8,32,29,8,27,24,6,24,22,5,22,20,5,20,19,4,19,18,4,15,14,3,9,8,2,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,1,2,11,2,8,23,5,17,41,10,34,50,13,44,40,11,37,26,7,27,16,5,17,18,4,17,31,8,25,
-47,11,39,60,16,50,66,17,53,64,17,48,57,15,41,46,12,33,40,10,31,51,13,42,57,14,49,53,13,46,45,12,39,54,13,36,82,21,41,82,21,41,59,15,34,52,13,38,
-74,19,56,107,29,76,131,38,92,141,43,100,140,43,100,127,38,92,102,30,79,79,23,60,77,21,45,74,20,36,61,16,33,51,13,37,60,15,40,74,19,39,74,20,56,52,25,81,
-26,30,85,9,29,56,10,25,29,41,36,43,83,69,104,108,93,152,99,84,148,60,66,115,31,83,108,31,113,131,46,109,142,65,110,155,70,126,172,66,142,178,52,123,159,34,57,102,
-22,23,66,30,70,122,38,95,152,28,78,116,9,27,40,4,5,17,18,39,75,24,61,103,17,56,74,5,22,21,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,0,9,12,3,28,34,9,51,58,15,56,66,20,55,80,32,52,90,40,43,65,24,47,61,17,60,85,20,56,94,22,38,68,16,
-12,21,4,14,13,2,52,58,13,79,105,35,47,89,39,15,49,24,30,37,12,74,81,17,95,124,27,83,137,49,79,141,90,106,164,142,131,188,169,123,182,147,91,139,85,89,108,43,
-123,131,85,142,161,147,131,162,169,133,162,171,149,167,165,169,175,158,170,174,147,158,166,132,144,158,121,131,149,105,114,135,96,100,123,91,111,125,81,125,128,51,130,131,33,141,144,49,
-148,153,72,145,155,88,132,148,78,117,129,43,106,111,30,100,102,36,101,102,48,105,108,50,106,108,45,98,101,33,88,92,23,78,82,20,66,69,16,60,61,15,60,59,14,70,68,17,
-85,83,22,98,95,25,93,90,23,81,78,20,65,63,16,51,48,12,42,38,10,37,34,9,45,41,10,59,55,14,71,67,18,76,71,19,76,72,19,80,75,20,84,80,21,86,82,22,
-83,78,21,76,71,19,67,60,16,57,49,13,52,43,12,51,42,12,49,42,12,44,37,11,31,25,7,5,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,1,2,9,2,6,15,4,12,21,5,16,31,7,24,31,7,25,27,6,23,22,6,20,17,4,16,20,5,17,30,7,25,44,11,35,53,13,44,60,15,50,
-62,16,49,63,17,44,52,13,37,39,10,28,26,7,21,20,5,17,32,8,25,45,11,37,44,11,38,48,12,33,55,14,30,65,16,32,64,16,35,51,13,36,64,17,50,104,29,75,
-128,36,93,130,38,95,124,36,93,122,36,91,111,32,83,75,21,63,36,11,36,39,10,21,57,14,25,57,14,37,42,10,35,26,7,25,29,8,25,41,16,54,40,28,87,19,33,77,
-7,27,44,20,28,31,54,52,71,94,85,131,109,94,157,88,74,137,52,68,111,29,89,109,31,107,126,51,108,145,67,112,161,68,127,171,63,142,175,62,117,163,48,57,121,36,36,98,
-33,72,127,39,94,154,32,82,131,12,30,53,6,9,23,23,57,93,30,83,123,18,62,81,5,22,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,9,12,3,30,36,10,48,52,15,51,55,16,54,75,29,53,90,40,45,72,30,45,59,17,52,78,20,54,91,21,
-38,72,16,15,28,7,7,5,0,38,41,9,72,94,29,54,97,40,18,57,29,18,30,12,59,61,12,85,105,22,83,125,34,80,145,86,93,166,145,114,179,168,123,185,162,96,155,115,
-87,118,74,118,129,96,143,157,141,144,169,165,131,163,171,140,165,169,156,170,162,168,173,151,161,166,133,147,158,123,136,153,116,122,141,104,105,121,80,88,94,40,95,94,22,117,116,27,
-129,129,33,133,135,45,134,140,49,130,141,41,126,138,37,116,128,33,107,115,29,102,106,33,97,100,42,84,86,35,82,82,22,89,88,21,91,93,23,87,91,22,77,82,20,63,65,15,
-50,49,11,45,44,11,57,54,14,73,70,18,79,77,19,74,73,18,57,54,13,35,34,8,16,15,4,9,9,2,12,12,3,18,17,4,25,23,6,34,33,8,45,42,10,53,50,13,
-60,57,14,57,54,14,48,47,11,40,36,9,34,29,7,37,31,8,40,34,9,40,34,9,28,24,7,8,7,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-13,3,10,21,5,18,27,7,23,32,8,27,29,7,25,23,6,21,20,5,18,14,3,13,11,3,10,12,3,10,24,6,19,47,12,39,56,15,47,52,13,44,41,11,36,35,9,30,
-34,9,25,33,8,22,24,5,18,21,5,18,23,6,18,25,6,20,31,8,23,47,12,28,57,14,32,60,15,32,57,14,33,50,13,35,60,16,49,85,23,70,109,31,84,120,35,89,
-121,34,91,104,29,86,87,24,75,73,20,63,43,12,42,9,4,15,1,0,2,21,4,10,37,9,27,33,8,29,16,5,20,7,6,28,14,18,61,21,29,80,11,31,62,9,28,35,
-32,35,38,66,57,80,82,84,137,73,84,147,62,61,117,37,58,93,25,88,108,36,107,132,58,107,149,68,114,163,67,135,175,63,139,173,69,110,163,70,54,138,56,48,125,39,81,140,
-40,100,159,34,79,135,17,32,69,8,14,37,23,64,95,34,97,140,24,72,101,7,26,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,9,13,3,31,38,10,48,53,14,51,56,16,54,72,28,53,89,38,43,66,25,39,50,12,51,73,18,
-61,96,24,44,79,19,22,41,9,5,7,1,28,29,6,71,86,25,74,106,41,29,57,42,9,10,20,41,39,8,71,81,15,83,116,27,80,137,62,85,160,125,104,173,160,116,180,167,
-111,168,150,100,136,122,104,112,106,131,136,124,145,164,154,138,169,173,127,162,173,131,155,159,143,156,140,149,157,125,150,159,125,144,156,123,134,150,115,117,128,82,92,91,36,83,80,19,
-90,89,19,97,97,22,102,103,24,112,114,28,125,130,34,123,133,36,117,132,35,116,127,32,109,117,29,93,99,25,76,77,19,66,65,15,73,71,17,81,81,20,90,91,23,88,87,22,
-70,66,17,40,37,9,21,21,4,22,22,5,30,29,7,29,29,7,34,34,8,40,40,9,39,39,9,37,37,8,21,21,5,0,0,0,0,0,0,0,0,0,3,3,1,6,6,1,
-10,9,2,7,6,1,3,3,0,0,0,0,1,1,0,2,2,0,4,4,1,6,5,1,4,4,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,
-12,3,10,16,4,15,16,4,15,13,3,11,9,2,8,7,2,6,7,2,6,10,2,8,16,4,14,22,5,18,31,8,25,36,9,31,29,7,25,21,5,18,16,4,14,17,4,13,
-19,5,15,22,5,17,24,6,20,26,6,21,26,6,21,25,6,20,43,11,25,63,16,33,57,15,36,53,14,39,63,17,52,84,24,70,98,27,82,99,27,84,96,26,81,98,27,81,
-84,24,75,63,17,59,40,12,40,14,5,18,0,1,4,2,1,2,22,5,16,34,8,28,22,5,20,6,4,18,7,11,38,16,22,70,15,30,72,9,26,43,19,27,30,48,42,52,
-74,62,94,70,71,123,39,52,107,24,48,94,21,59,86,24,91,113,45,108,139,75,116,166,76,119,170,65,130,170,62,132,170,68,99,159,76,51,143,66,58,145,44,90,153,39,96,154,
-32,74,127,14,26,63,8,18,39,24,68,103,33,96,139,25,74,109,14,33,63,3,3,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,10,13,3,30,36,10,47,53,14,51,55,15,53,65,23,49,62,21,41,47,13,42,49,13,
-75,89,23,76,107,26,47,83,20,20,37,9,0,1,0,17,16,2,55,62,16,74,91,50,43,54,61,12,13,32,27,25,10,60,62,15,88,105,36,80,126,48,81,149,93,97,167,146,
-118,178,175,128,179,176,107,141,150,89,97,116,108,110,116,141,160,151,140,173,170,110,155,166,96,140,156,111,138,142,137,149,135,150,155,131,145,154,126,141,154,124,128,140,102,104,108,60,
-82,80,29,70,66,16,70,69,14,79,79,18,93,93,22,102,103,25,104,108,27,111,116,30,117,126,32,111,124,32,96,107,27,74,80,19,62,66,16,58,59,13,62,61,14,64,62,14,
-65,61,16,58,52,14,47,41,11,38,33,9,32,27,7,13,12,3,1,1,0,5,5,1,13,13,3,20,20,4,18,18,4,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4,1,4,10,3,8,12,3,9,14,4,11,16,4,13,17,4,13,18,5,15,18,4,14,14,3,11,12,3,9,14,4,10,17,4,12,19,4,13,20,5,13,
-22,6,16,24,6,19,25,6,20,25,7,20,26,7,22,28,8,24,39,10,29,52,14,39,67,18,55,86,24,71,102,28,84,99,27,84,84,22,72,69,18,61,71,19,64,64,17,59,
-41,11,41,17,5,20,2,1,6,0,0,0,4,1,3,24,6,19,29,7,26,13,5,20,6,7,27,9,12,44,11,15,49,7,10,33,5,18,24,20,32,34,57,50,66,73,65,106,
-56,58,114,28,35,89,14,32,69,18,66,87,31,102,126,57,110,149,86,117,170,92,125,177,71,127,170,64,118,164,74,83,154,74,50,146,64,71,156,47,97,163,39,96,155,30,70,122,
-10,19,45,10,23,46,27,74,113,32,98,135,25,71,105,15,32,65,4,4,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,10,13,3,28,35,9,46,52,14,51,55,16,52,56,17,50,54,16,43,49,14,
-50,56,14,74,86,22,66,88,21,30,47,11,4,8,2,0,0,0,6,5,1,42,45,13,73,82,43,51,61,61,15,17,40,16,10,29,64,47,52,71,69,53,66,97,37,77,134,65,
-95,160,128,112,172,173,122,174,183,117,154,171,100,108,142,94,89,117,114,124,129,117,151,152,104,154,163,94,145,163,96,138,156,110,136,147,120,135,134,131,139,124,132,136,109,123,125,89,
-104,106,74,73,74,52,59,57,30,59,54,14,66,64,13,75,74,16,84,83,20,93,92,22,100,99,25,100,101,25,96,100,25,90,97,24,84,93,23,75,85,20,53,61,15,28,34,7,
-24,25,6,38,38,9,45,43,10,52,49,12,48,44,11,24,22,5,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
-5,1,3,9,1,6,13,3,10,15,4,12,15,4,12,13,3,10,11,3,9,8,2,6,5,1,4,3,1,2,4,1,2,9,2,4,16,4,10,21,5,14,21,5,15,22,5,16,
-23,6,19,26,7,21,29,8,25,32,9,28,37,10,30,42,11,32,55,15,41,70,19,56,96,26,80,98,27,83,83,22,72,61,15,54,35,10,32,26,6,23,34,8,29,23,6,24,
-7,2,9,0,0,0,0,0,0,0,0,0,2,1,2,9,3,8,5,3,12,6,10,35,11,15,50,7,8,29,1,1,6,1,8,5,8,33,35,32,52,77,60,67,114,41,47,103,
-18,27,75,11,27,60,18,62,87,35,88,122,69,108,156,90,116,169,88,124,172,71,125,166,66,110,162,75,68,149,74,48,144,61,81,161,50,99,165,39,96,151,30,66,124,17,25,75,
-15,33,60,28,82,116,32,95,132,26,68,109,18,34,77,5,4,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,3,1,2,4,1,10,13,3,26,33,8,45,51,14,52,55,16,53,56,17,51,55,16,
-43,48,14,39,45,12,56,63,15,59,67,16,24,28,7,1,1,1,0,0,0,1,0,0,26,27,4,61,63,25,53,59,56,32,34,57,22,12,52,29,8,54,46,31,53,60,74,40,
-66,109,43,67,127,87,88,150,145,117,168,181,133,164,184,121,131,162,99,88,132,92,82,125,99,113,140,107,146,154,101,153,163,92,140,161,85,121,147,95,115,135,107,115,123,117,116,106,
-112,105,88,91,88,79,64,67,70,52,57,54,56,57,37,57,53,19,54,51,11,62,61,13,76,76,18,87,86,21,86,84,20,85,82,20,86,84,21,87,88,22,72,80,20,45,59,14,
-29,45,11,22,35,8,19,26,6,19,19,4,25,25,5,28,29,7,21,21,5,23,23,5,16,16,4,8,8,2,6,6,1,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,
-5,2,4,8,2,6,7,1,5,5,1,4,4,1,3,3,1,3,3,1,2,6,2,5,9,2,7,12,3,10,15,4,11,16,4,11,20,5,16,24,6,20,27,7,23,30,8,26,
-33,9,29,36,10,30,41,11,32,48,13,36,57,15,42,61,16,45,58,16,45,56,15,47,73,19,61,60,15,52,35,9,32,14,3,14,9,2,8,11,2,9,12,3,11,10,3,10,
-5,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,6,5,6,22,3,4,14,0,0,1,1,6,3,7,32,35,17,51,75,27,50,97,24,35,89,14,17,62,
-10,22,55,19,54,81,42,70,116,76,90,151,93,118,171,82,127,173,64,123,164,67,101,158,76,57,145,70,56,149,59,89,162,61,106,172,61,97,165,41,61,126,19,25,80,21,48,91,
-30,89,124,31,93,127,29,69,118,22,34,92,5,4,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,3,1,2,4,1,4,5,1,9,12,3,25,31,8,44,50,14,53,56,17,53,56,17,
-51,55,17,43,49,14,38,45,12,49,55,13,51,55,13,25,27,6,3,3,1,0,0,0,0,0,0,11,10,1,45,45,11,62,63,36,41,46,58,24,21,53,24,7,52,38,17,56,
-50,52,55,50,73,40,49,94,48,72,130,109,105,157,166,128,165,183,136,154,179,127,123,165,108,85,146,95,82,136,101,118,141,104,145,153,91,137,153,77,117,145,81,109,141,89,110,135,
-99,107,123,90,86,103,64,53,77,39,33,66,43,45,69,52,56,64,31,39,36,9,15,11,19,20,5,44,44,9,66,66,15,79,79,19,84,83,20,86,83,20,77,74,18,67,65,16,
-63,69,17,55,66,16,36,41,10,16,15,3,11,10,2,8,8,2,10,11,3,18,18,4,21,21,5,23,23,5,30,30,7,28,28,6,23,23,6,20,20,5,14,14,3,9,9,2,
-6,6,1,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,1,2,1,2,
-4,1,3,5,1,3,5,2,4,8,2,6,12,3,9,16,4,13,20,5,16,23,6,19,26,7,21,27,7,23,28,8,23,29,8,25,32,9,27,34,10,29,36,10,30,36,10,29,
-40,11,30,53,14,39,60,16,45,59,16,45,50,14,41,44,12,37,37,10,32,34,9,28,33,8,27,21,5,18,11,3,10,11,2,9,13,3,11,12,3,11,8,2,7,4,1,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,3,13,2,2,10,0,0,0,0,0,0,3,6,12,11,29,50,17,35,73,17,25,76,10,13,52,7,7,35,
-17,23,56,48,52,100,84,90,149,90,118,171,79,127,175,70,125,175,72,89,160,71,51,144,66,65,153,57,95,165,63,105,171,71,96,168,55,57,133,26,29,89,23,58,99,31,93,130,
-30,88,125,26,59,112,23,31,94,9,9,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,1,3,5,1,4,6,1,9,12,3,22,28,7,42,48,13,53,56,17,
-53,56,17,52,56,17,45,51,14,36,43,11,37,44,11,54,56,13,44,44,10,11,10,3,0,0,0,0,0,0,0,0,0,26,27,5,58,58,24,54,57,54,33,36,65,24,19,64,
-39,37,81,53,66,97,55,73,72,60,80,58,72,108,95,87,141,141,113,161,172,132,167,185,139,153,182,126,116,165,109,85,147,96,85,137,98,114,142,97,135,149,88,132,150,77,118,147,
-77,110,142,71,97,133,52,71,110,27,33,71,23,20,54,30,24,58,14,21,42,3,13,20,0,0,1,0,0,0,9,9,2,26,26,6,48,48,11,65,65,15,63,63,15,57,56,13,
-63,61,14,68,66,16,66,60,15,58,51,13,48,42,11,38,33,9,26,22,6,17,15,3,9,9,2,6,6,1,7,7,1,13,13,3,17,17,4,23,23,5,26,26,6,29,29,6,
-28,28,6,26,26,6,8,8,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,1,2,4,2,3,5,2,4,4,1,3,5,1,4,5,2,4,5,2,4,5,2,4,6,2,5,7,2,5,8,2,6,8,2,7,10,2,8,11,3,8,11,3,9,13,3,10,
-15,4,12,16,4,13,17,5,13,18,5,14,24,6,19,28,8,24,30,8,25,32,9,27,32,9,27,33,9,27,33,9,26,34,9,27,36,10,27,36,10,26,36,10,25,37,11,25,
-44,12,32,48,13,37,48,13,39,39,11,32,36,9,31,34,8,29,27,7,23,22,6,18,18,4,15,18,4,16,19,5,16,17,4,15,14,4,11,9,2,7,3,1,2,0,0,0,
-0,0,0,0,0,0,0,0,0,2,1,2,3,2,8,6,7,28,7,9,32,1,1,6,0,0,2,5,6,21,11,14,49,16,24,68,17,22,73,16,19,72,10,9,43,24,11,50,
-59,45,100,84,94,146,83,126,169,73,130,175,72,115,176,78,73,163,73,42,148,57,55,147,56,90,162,66,103,172,70,85,160,48,47,120,26,34,89,26,68,107,32,97,131,32,85,131,
-32,62,128,24,31,98,9,8,38,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,3,3,1,4,5,1,8,11,3,22,28,7,42,48,13,
-53,56,17,54,56,17,53,56,17,47,53,15,38,45,12,39,44,11,49,51,13,49,48,11,21,20,5,1,1,0,0,0,0,0,0,2,11,11,0,39,39,18,64,69,70,51,60,95,
-34,54,103,40,66,110,54,76,118,67,78,111,75,79,96,75,90,88,78,115,105,86,139,143,107,155,174,129,161,184,125,139,181,110,101,168,101,76,150,96,82,139,99,111,140,98,136,149,
-92,136,151,79,123,149,52,101,129,29,77,101,16,48,72,14,33,56,11,18,40,3,7,13,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,10,10,2,11,11,3,11,11,3,
-23,23,5,40,41,9,53,53,12,61,60,14,66,64,15,63,58,14,53,46,12,48,42,11,42,37,10,20,18,5,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,4,4,1,
-7,7,1,9,9,2,3,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,
-5,1,4,12,3,10,16,4,12,15,4,12,15,4,12,15,4,12,16,4,12,16,4,13,16,4,13,16,4,12,17,4,13,17,4,13,16,4,13,17,4,13,17,4,13,19,5,15,
-22,6,18,24,6,19,24,6,19,24,6,19,25,6,20,27,6,21,27,7,20,29,8,20,31,9,20,32,9,20,33,9,19,35,10,22,37,11,25,37,11,28,38,11,29,38,11,30,
-37,10,31,36,10,31,34,9,29,31,8,26,27,7,22,22,5,18,19,5,16,20,5,17,25,6,20,26,7,21,25,6,20,23,6,18,20,5,15,14,3,11,5,2,4,0,0,0,
-0,0,0,3,1,1,10,4,13,15,9,32,11,8,30,5,5,20,2,1,8,4,4,18,9,11,40,14,18,59,17,20,70,16,19,71,14,15,60,17,11,55,40,20,74,74,66,124,
-86,110,158,77,128,171,72,129,179,80,100,173,79,60,160,69,43,155,53,45,145,51,61,146,68,86,167,72,77,163,56,44,126,29,44,94,26,79,115,32,95,133,32,82,132,36,63,144,
-27,34,109,10,9,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,4,6,1,12,16,4,24,31,8,
-40,46,13,51,55,16,55,57,17,54,56,17,51,55,16,42,48,14,33,39,10,42,45,11,53,53,12,31,31,7,3,3,1,0,0,5,3,3,24,5,6,14,29,31,35,51,57,81,
-41,51,105,32,48,116,34,59,116,47,71,117,62,77,121,73,79,112,75,77,93,60,66,83,55,79,103,67,108,134,84,130,160,101,135,175,110,127,178,110,103,170,102,79,153,97,79,138,
-98,106,138,99,132,145,89,137,149,69,120,135,45,85,103,26,63,80,15,48,65,14,42,60,11,26,47,5,12,25,2,2,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,2,2,0,7,7,1,16,16,4,32,32,7,29,29,6,15,15,3,16,16,4,26,23,6,18,16,4,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,
-6,2,4,11,3,9,14,3,11,14,4,10,13,4,10,13,3,10,13,3,10,12,3,10,11,3,9,11,3,8,10,3,8,11,3,9,16,4,12,18,4,13,17,4,12,20,5,13,
-22,5,15,23,5,14,21,5,13,21,5,12,22,6,12,24,6,12,27,7,15,31,8,18,35,9,21,36,10,25,37,10,27,36,10,28,36,10,29,37,10,31,37,10,31,34,9,29,
-30,8,26,26,7,22,22,5,19,20,5,17,21,5,18,23,6,18,28,7,21,31,8,23,34,9,23,33,9,22,29,7,22,23,6,18,18,5,14,10,3,8,3,1,0,4,1,3,
-10,4,15,18,9,32,18,10,39,12,7,28,3,2,7,0,0,0,4,5,20,12,16,54,16,22,69,16,19,68,15,17,64,15,13,55,28,12,60,56,31,91,80,77,136,83,123,168,
-73,133,177,71,116,176,80,78,164,76,47,157,61,47,155,50,52,148,57,48,146,70,54,158,71,54,157,61,44,133,52,62,128,36,91,130,31,93,130,34,78,137,35,55,141,28,35,110,
-13,13,55,5,4,20,1,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,6,2,14,18,5,
-23,30,7,35,41,11,49,54,15,55,57,17,55,56,17,52,56,17,44,50,14,33,40,11,32,38,9,44,45,10,44,42,9,22,21,7,7,8,25,6,7,38,4,5,24,9,9,22,
-13,15,50,23,29,87,30,37,112,33,50,121,41,65,125,52,79,132,64,81,125,64,59,107,53,34,85,46,29,78,62,60,110,80,100,144,90,125,164,100,136,175,109,126,176,109,89,163,
-99,61,147,95,66,136,97,95,137,98,123,143,91,131,144,65,114,120,26,80,82,15,63,67,14,53,66,14,42,61,8,14,36,5,3,22,3,3,16,1,1,6,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,2,1,1,2,1,1,2,1,1,2,1,1,2,1,1,2,1,1,1,0,1,1,0,0,0,0,0,1,0,1,4,1,3,13,3,6,18,5,8,20,5,8,20,6,9,
-21,5,10,22,6,11,25,7,14,29,7,18,32,8,21,33,9,23,35,9,26,35,10,28,36,10,29,34,9,29,34,9,28,33,9,28,32,8,27,32,8,28,29,7,25,22,6,20,
-20,5,17,22,5,18,25,6,19,29,8,21,32,8,22,33,8,23,36,9,24,36,9,25,34,9,23,29,7,20,20,5,14,11,3,8,8,2,5,7,2,5,11,4,16,18,9,34,
-19,12,43,12,7,27,4,2,8,0,0,0,0,0,0,0,0,0,5,6,23,11,13,46,14,16,63,11,12,50,23,14,58,47,22,80,70,46,111,77,75,135,72,102,156,68,116,171,
-75,101,172,81,59,159,74,45,157,54,52,153,51,50,146,67,52,155,77,60,175,75,51,163,65,48,133,58,78,140,45,99,142,34,89,131,35,73,142,35,52,139,23,24,89,10,9,43,
-9,11,42,3,4,15,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,
-9,11,3,21,26,7,32,40,10,47,52,15,55,57,17,56,56,17,54,56,17,48,53,16,37,44,12,27,33,8,35,36,9,45,44,10,36,34,7,15,15,7,4,5,24,5,5,28,
-6,6,27,6,6,26,14,16,57,24,29,94,34,44,120,35,57,133,50,73,138,72,84,143,74,78,135,66,57,114,61,33,98,67,33,102,74,59,121,81,94,142,87,111,153,94,104,154,
-103,95,159,106,80,160,101,63,150,96,61,140,96,81,136,88,105,131,53,101,122,27,91,105,20,85,90,16,72,75,12,48,56,8,22,36,6,7,28,7,7,32,4,4,20,4,4,16,
-2,2,10,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,2,5,1,4,5,1,5,7,2,5,14,3,8,19,5,10,22,6,12,25,7,16,
-28,7,20,29,7,22,31,8,24,33,9,27,34,9,28,34,9,29,33,9,28,33,8,27,31,8,26,30,8,25,29,7,24,27,7,23,25,6,22,25,7,22,26,7,21,27,7,21,
-30,8,22,34,9,23,36,9,24,37,9,25,37,9,26,37,9,26,35,9,26,30,8,23,20,5,14,9,2,6,6,2,4,9,3,9,15,5,21,18,9,32,18,11,42,11,7,28,
-3,2,10,0,0,0,0,0,0,0,0,0,0,1,3,4,5,18,10,12,46,11,13,51,19,14,57,36,16,70,59,23,93,72,49,117,72,81,140,64,89,152,68,88,161,79,66,158,
-80,46,154,77,50,164,63,52,157,65,55,154,74,59,168,83,57,178,79,54,166,71,63,152,57,90,146,39,97,137,33,84,132,36,66,144,32,42,125,18,17,70,10,8,40,6,7,30,
-2,2,12,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,4,5,1,15,18,5,29,36,10,44,50,14,54,56,17,56,57,17,55,57,17,52,55,17,43,50,14,28,34,9,29,32,8,37,36,8,41,39,8,25,24,7,8,8,17,
-4,5,29,5,6,29,5,5,22,7,8,34,16,21,67,29,34,99,39,45,126,63,67,151,81,86,161,82,88,152,76,81,137,68,57,116,65,36,103,68,33,105,74,54,122,78,71,132,
-82,85,137,92,96,147,100,97,155,105,88,160,102,68,153,98,60,145,80,53,134,64,66,127,49,84,121,34,95,114,25,90,101,15,64,68,5,23,24,3,11,17,4,7,20,6,7,28,
-5,6,26,7,8,31,6,6,25,3,3,14,2,2,8,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,1,0,1,1,0,1,1,0,1,4,1,3,7,1,5,9,2,6,14,3,11,17,4,13,19,5,15,24,6,19,28,7,23,
-30,8,25,32,8,26,31,8,25,29,8,25,27,7,23,26,7,22,26,6,23,26,6,22,25,7,21,26,6,21,26,6,22,28,7,22,30,8,22,32,8,23,35,9,24,36,9,25,
-38,10,26,38,10,28,39,10,30,38,10,29,33,9,26,26,6,20,19,4,14,13,3,8,13,3,8,12,4,13,15,7,25,19,10,38,17,11,41,9,6,24,2,2,7,0,0,0,
-0,0,0,0,0,0,1,0,3,5,6,21,9,10,41,11,12,48,10,11,45,21,11,51,50,17,78,62,20,93,58,26,99,57,54,127,62,74,151,74,64,157,79,43,153,77,39,148,
-71,46,150,75,52,158,81,58,167,86,60,179,89,58,185,81,53,159,74,76,150,56,98,149,35,93,134,33,77,135,40,60,151,32,40,127,16,16,64,9,8,37,5,5,21,1,1,5,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,6,8,2,22,27,7,41,48,13,53,57,17,56,58,17,55,57,17,54,57,17,48,53,16,35,41,11,23,28,7,28,28,7,43,41,9,40,38,7,
-22,22,6,6,5,17,5,7,34,5,6,26,4,4,20,15,18,41,23,28,73,35,36,105,51,51,136,71,71,158,84,86,165,84,90,157,77,81,138,71,63,123,71,48,121,74,42,128,
-75,45,128,78,62,131,82,82,140,90,95,151,97,97,154,102,89,157,100,60,150,95,37,142,88,39,138,76,52,131,61,64,122,43,63,101,24,53,68,11,45,45,7,36,34,4,20,19,
-0,1,5,3,3,14,5,5,22,7,8,29,5,6,27,2,2,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,1,4,1,3,8,3,7,10,3,8,10,3,8,11,3,8,11,3,9,11,3,8,13,4,10,18,5,14,18,4,15,18,4,15,19,5,15,20,5,17,
-20,5,16,18,5,15,18,5,14,17,4,13,17,4,12,20,5,15,26,7,19,28,8,22,31,8,22,34,8,23,35,9,24,37,11,26,39,11,27,39,11,28,39,10,29,39,10,30,
-39,10,31,37,10,30,34,9,28,28,7,22,18,4,12,13,3,8,17,4,12,22,7,24,21,9,30,20,11,40,12,9,33,5,4,16,1,1,5,0,0,0,0,0,0,0,0,0,
-1,1,6,4,5,20,8,9,40,12,14,55,12,13,54,16,10,43,24,9,42,39,13,58,47,17,76,45,23,91,47,33,112,61,46,140,74,43,150,78,42,151,69,43,147,65,39,134,
-72,42,144,88,57,172,98,62,188,90,56,179,81,61,160,72,88,153,63,105,157,55,95,150,46,76,152,41,60,157,30,35,116,18,16,69,13,14,54,9,10,40,2,2,9,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,15,4,34,39,10,51,55,16,55,57,17,56,57,17,55,56,17,52,56,17,43,49,14,29,35,9,24,27,7,36,35,8,
-47,44,10,34,33,8,13,13,6,5,5,21,9,19,47,12,29,51,19,40,55,21,36,59,22,29,73,34,37,105,52,53,143,72,74,168,83,86,169,83,90,160,80,85,145,75,70,135,
-74,56,131,74,45,130,80,51,141,85,66,152,85,78,150,86,82,145,82,61,130,83,41,121,87,32,127,93,34,137,91,34,139,78,34,126,55,35,99,33,38,72,23,45,65,13,33,41,
-1,5,5,0,0,0,0,0,0,0,0,2,1,1,6,1,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,4,1,3,10,3,8,11,3,8,10,3,8,10,3,8,9,2,7,9,2,7,9,2,6,9,2,5,8,2,5,7,2,4,8,2,5,11,3,6,
-17,4,10,22,6,13,25,6,17,29,7,19,32,9,21,34,10,23,37,10,25,38,11,26,39,11,28,41,11,28,41,12,30,42,12,32,43,12,32,39,11,31,36,9,29,32,8,26,
-29,7,23,26,7,19,25,6,18,25,6,18,23,7,22,23,10,31,21,10,39,16,11,42,7,5,24,2,2,9,0,0,0,0,0,0,0,0,0,0,0,0,1,1,5,5,5,21,
-6,7,29,10,13,49,11,12,47,13,8,37,23,9,44,33,11,51,35,13,59,34,17,71,39,28,100,48,39,123,62,37,133,73,39,145,72,44,150,72,42,146,72,35,134,77,43,145,
-88,57,176,95,62,188,98,57,174,90,77,158,74,99,150,67,104,155,68,92,164,58,73,167,41,53,151,25,27,98,16,13,64,13,14,59,8,10,40,2,2,10,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,1,19,23,6,43,48,13,54,58,17,56,57,17,56,57,17,55,57,17,50,55,16,37,43,12,23,27,7,
-26,26,7,41,39,9,43,41,9,33,31,4,14,20,19,13,39,60,20,67,92,23,69,87,19,52,63,18,35,55,21,26,71,36,34,109,55,54,144,70,70,165,83,87,173,87,91,166,
-83,87,151,77,78,139,82,65,141,90,57,151,90,50,152,85,50,148,79,44,138,73,38,126,72,33,112,75,33,110,81,33,116,77,30,116,63,25,106,58,23,100,53,26,97,43,25,80,
-29,14,54,19,7,33,10,3,15,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,1,1,0,1,0,0,1,1,1,1,1,6,2,2,8,2,3,8,2,2,8,2,2,11,3,4,17,4,6,24,6,9,
-28,7,12,34,9,19,37,10,24,40,11,27,41,12,29,42,12,31,42,12,31,43,12,32,42,12,32,41,12,32,39,10,30,36,10,28,33,8,26,29,7,22,26,6,18,27,7,18,
-28,6,22,31,8,27,33,12,37,33,13,45,27,12,43,14,9,32,5,5,19,3,2,8,6,1,5,7,2,4,4,1,1,0,0,0,2,2,9,5,5,21,8,10,38,6,8,32,
-3,3,14,12,7,32,22,9,42,32,11,51,33,12,56,35,17,73,36,25,93,46,35,117,59,37,131,65,36,135,67,35,131,71,41,139,80,39,145,89,45,159,94,58,178,100,61,188,
-95,57,180,91,69,165,84,93,158,72,103,155,70,98,160,72,87,177,55,60,165,35,37,126,20,23,83,14,13,55,11,13,53,6,6,25,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,2,29,34,9,51,55,16,57,59,18,56,57,17,55,56,17,52,56,17,43,50,14,
-29,36,9,21,24,6,25,25,6,40,37,9,41,39,8,33,45,23,20,54,54,18,64,81,21,73,99,21,68,84,24,54,69,39,43,82,49,37,103,50,37,120,59,54,148,73,76,176,
-83,88,181,86,93,172,89,95,165,96,93,165,98,81,160,98,66,156,93,53,153,88,47,152,82,43,146,78,41,135,74,37,122,60,30,97,46,23,74,46,21,72,46,20,75,41,19,77,
-34,18,72,39,19,80,37,17,73,14,7,31,2,2,9,1,1,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,1,1,6,1,2,8,2,3,8,2,3,8,2,3,8,2,3,8,2,3,10,2,4,12,3,5,15,4,7,17,4,8,19,5,10,22,6,12,25,7,15,32,8,17,35,9,20,
-36,9,23,39,10,26,40,11,29,41,12,31,40,12,31,39,11,30,37,10,28,33,9,25,31,8,24,30,8,22,29,7,21,28,7,19,28,6,20,30,7,23,32,10,32,32,10,34,
-32,12,44,27,12,46,22,12,42,17,7,27,11,4,15,8,2,7,10,2,6,12,3,8,14,3,9,10,3,10,6,6,20,7,8,32,7,7,32,3,5,21,5,4,18,12,5,22,
-22,8,38,36,14,63,38,20,79,32,19,75,32,23,85,45,33,115,57,37,130,65,35,133,66,33,129,64,31,123,73,31,128,87,40,150,97,59,178,100,71,198,97,73,199,98,69,181,
-97,81,164,87,104,163,74,106,159,72,93,170,67,79,183,51,59,165,28,31,108,16,15,66,13,15,59,10,12,47,3,4,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,16,5,39,43,13,55,58,17,57,58,17,55,57,17,54,57,17,
-49,54,16,39,45,12,25,30,7,16,17,4,23,19,7,33,27,8,43,41,14,36,48,26,20,51,51,18,66,86,21,72,96,34,74,102,52,69,106,56,52,101,54,41,107,53,40,124,
-56,52,147,67,66,167,79,84,180,88,96,183,97,103,181,101,103,177,102,91,169,88,75,154,82,60,146,85,51,148,85,47,148,79,42,140,71,37,125,62,34,105,48,28,82,33,20,56,
-19,12,34,18,11,37,17,10,40,7,7,30,5,7,31,7,8,35,4,6,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
-6,2,2,14,3,4,17,4,5,18,5,5,17,5,5,17,4,5,19,5,6,23,5,10,27,7,15,28,7,17,29,8,17,30,8,18,34,9,22,35,9,24,36,9,25,36,9,25,
-34,9,24,34,8,24,34,9,23,34,9,23,33,9,21,31,8,19,26,7,18,25,7,17,28,7,21,31,8,24,33,9,28,36,11,39,32,12,41,30,14,49,27,12,45,23,9,33,
-19,8,27,14,5,17,9,3,9,11,2,7,12,2,7,13,3,9,14,3,12,16,5,15,17,9,28,13,9,35,8,9,35,4,5,20,5,3,13,14,5,22,28,9,44,39,16,69,
-40,20,82,32,22,83,25,22,78,30,20,77,47,27,103,60,32,127,66,34,130,64,31,125,70,32,127,87,36,143,98,53,174,101,69,194,103,73,202,110,75,198,106,81,185,93,86,167,
-92,87,161,93,89,174,80,85,184,62,73,185,43,53,155,22,23,86,13,12,54,12,13,54,7,8,34,1,1,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,21,23,7,46,49,15,57,59,18,56,58,17,
-55,57,17,53,56,17,47,52,15,32,38,9,16,19,7,25,16,25,56,35,52,58,42,39,50,46,24,40,54,31,26,57,50,18,63,78,27,78,103,40,79,109,49,71,104,56,59,105,
-55,42,105,50,36,114,52,42,131,53,47,139,67,65,160,84,89,181,96,103,189,91,107,182,78,98,164,75,84,150,78,72,145,81,59,144,85,50,146,87,46,148,81,45,146,72,40,131,
-53,34,102,41,24,74,30,21,57,20,14,37,13,8,25,6,4,15,3,3,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,3,1,11,8,2,10,9,3,8,7,2,
-6,5,2,5,4,1,3,2,1,1,2,0,1,1,0,0,0,0,0,0,0,0,0,0,2,0,0,9,2,2,13,3,4,12,3,4,11,3,3,10,2,3,9,2,4,9,2,3,
-12,3,4,16,4,6,18,4,6,18,4,7,18,4,6,17,4,6,18,4,7,24,6,12,28,7,16,29,7,18,30,8,18,30,7,18,30,8,18,32,8,19,32,9,20,33,9,20,
-33,9,19,34,9,20,35,9,21,35,9,21,35,9,22,35,9,22,31,8,22,27,7,21,26,6,20,24,6,19,22,6,21,24,11,37,23,11,36,21,8,25,22,6,18,24,6,12,
-23,5,11,19,4,11,15,3,8,15,3,10,17,5,14,19,7,22,23,11,34,25,12,37,23,13,37,12,6,16,1,0,0,0,0,0,12,5,22,36,16,68,39,21,85,30,21,83,
-20,20,70,12,16,54,19,13,55,40,20,86,54,28,112,62,31,121,69,31,124,86,37,144,107,55,178,119,69,200,114,78,207,112,77,203,117,81,194,120,90,187,109,85,175,95,69,164,
-88,64,172,78,74,190,54,61,172,32,35,119,18,18,74,14,14,57,9,10,42,4,4,17,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,6,2,28,32,9,51,54,16,
-57,59,18,56,57,17,55,57,17,53,56,16,42,48,13,32,33,20,37,25,42,51,32,57,66,45,61,59,44,40,45,40,19,27,36,19,18,41,53,21,60,80,24,72,95,35,81,108,
-50,77,112,70,71,122,74,56,124,64,42,120,52,35,118,54,43,133,63,58,157,75,77,177,82,92,187,87,102,184,84,103,177,78,96,164,72,74,147,66,41,124,68,32,123,68,32,124,
-63,35,122,57,34,118,58,40,122,56,38,115,52,34,100,43,28,81,29,22,60,15,13,35,6,6,15,3,3,6,0,0,3,0,0,0,1,1,0,7,6,0,9,7,0,10,9,1,
-12,11,2,17,14,5,19,15,5,17,14,4,15,12,4,12,10,3,10,8,2,8,7,2,10,6,3,16,7,4,20,7,6,20,7,6,20,6,6,19,6,6,20,6,6,22,6,8,
-24,7,10,23,7,10,22,6,10,23,6,10,23,6,10,23,6,10,24,7,11,27,8,14,32,9,19,32,9,20,34,10,22,32,9,21,33,8,22,35,10,23,36,10,23,34,9,23,
-34,9,23,32,9,23,30,7,21,27,6,20,25,6,18,23,6,17,21,6,15,21,5,13,22,5,12,25,6,13,29,7,14,30,8,15,29,7,16,30,8,14,29,7,15,27,7,14,
-24,6,12,21,6,13,21,9,26,23,10,30,24,11,33,25,13,35,21,8,21,15,5,11,9,2,3,3,0,0,2,2,9,6,6,29,13,13,53,24,22,78,18,19,66,9,11,43,
-6,9,34,10,9,39,30,20,82,54,28,113,69,32,126,84,35,141,100,44,166,117,64,195,128,78,211,134,74,211,131,65,202,133,79,195,129,87,186,118,73,178,105,66,183,95,70,195,
-81,70,193,52,48,152,24,23,90,14,15,61,11,12,49,5,6,25,2,2,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,3,
-36,39,11,54,57,17,57,59,18,56,57,17,55,57,17,50,55,15,40,46,13,38,39,25,42,33,40,56,35,61,59,37,61,52,31,49,40,20,47,40,24,63,31,37,67,22,54,76,
-26,70,91,54,85,125,85,96,152,96,87,153,89,71,141,74,51,126,63,42,130,58,44,136,57,50,148,65,61,162,76,77,176,83,90,184,85,86,178,76,61,159,65,46,141,58,36,122,
-51,28,107,48,24,98,49,25,102,54,29,108,57,34,115,60,37,121,55,40,121,41,34,100,25,28,76,22,23,62,18,21,56,10,15,44,5,8,31,4,5,23,3,4,19,3,4,12,
-4,3,5,8,6,2,15,9,4,17,11,4,19,14,5,19,15,5,20,16,5,21,16,5,21,16,5,23,17,6,24,17,7,24,17,7,24,16,7,24,16,7,24,15,7,26,17,10,
-28,17,12,27,16,12,28,16,12,27,16,11,28,16,12,28,17,12,28,17,13,30,18,15,35,20,21,37,20,23,34,16,23,31,12,21,30,12,20,30,13,19,28,10,18,23,6,15,
-21,5,14,21,5,13,24,6,13,25,6,14,28,7,14,31,8,15,33,9,16,36,10,18,38,10,19,40,11,20,39,10,19,35,9,16,31,8,15,29,8,12,26,6,10,25,6,9,
-26,6,8,27,7,12,26,11,31,20,8,25,15,5,12,9,2,3,5,1,1,4,3,11,4,5,20,7,9,35,11,14,51,15,19,65,13,18,60,9,13,45,7,9,36,10,10,42,
-21,13,51,38,20,81,62,28,115,85,35,140,102,48,170,113,61,191,125,72,205,132,76,209,138,64,205,142,56,198,138,52,186,130,58,181,118,66,187,102,73,198,88,73,198,75,62,179,
-51,35,124,27,18,80,13,15,59,8,9,38,3,3,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,16,18,5,42,45,13,56,59,17,57,58,18,56,57,17,54,57,17,49,54,14,43,49,14,39,41,24,50,42,60,64,49,95,75,48,99,73,41,91,59,28,75,44,23,65,
-31,28,59,32,47,76,49,70,109,67,85,135,82,96,152,91,97,156,95,87,153,95,71,149,80,55,139,65,44,133,60,42,138,59,41,143,67,49,151,72,57,159,72,59,162,75,62,165,
-73,59,161,68,49,143,62,40,130,51,31,112,43,24,97,40,20,88,42,22,92,40,21,87,40,25,93,43,29,94,43,36,97,33,30,84,21,17,59,16,14,54,16,15,57,15,13,45,
-11,5,17,8,2,1,8,2,3,7,1,2,7,2,2,8,2,3,9,3,3,10,4,2,11,6,3,13,7,3,13,8,3,14,9,3,15,10,4,18,11,5,23,13,7,23,14,7,
-24,14,7,23,14,7,23,14,7,25,15,8,28,16,10,29,17,10,29,16,10,30,16,10,31,15,11,32,15,13,30,11,13,30,9,12,31,10,12,33,10,15,36,10,17,34,9,16,
-35,9,17,37,10,18,39,11,19,41,12,20,41,13,20,41,11,20,38,11,18,37,10,18,35,9,16,33,9,14,31,8,12,28,7,10,27,7,9,27,6,8,28,7,8,27,6,8,
-24,6,7,19,5,7,9,2,3,3,1,2,3,2,8,3,4,16,6,7,30,7,7,33,5,6,26,6,7,27,10,14,47,8,9,38,8,9,37,16,12,49,30,18,72,44,24,94,
-61,24,105,86,34,141,107,47,170,117,61,193,130,66,206,137,71,211,142,68,209,145,59,201,144,51,190,139,47,183,133,49,186,119,65,199,100,83,211,82,74,195,62,44,146,38,25,99,
-18,17,68,10,11,46,6,6,27,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,3,1,22,25,7,47,50,15,56,59,18,56,57,17,55,56,17,54,57,16,48,53,12,45,53,36,51,60,81,67,70,118,79,69,126,82,59,116,76,45,96,
-64,31,85,54,28,83,46,32,76,42,42,78,44,59,95,60,84,127,86,101,157,114,107,178,123,108,178,114,92,163,100,74,151,91,54,140,89,49,138,81,46,136,70,43,133,65,44,140,
-66,50,149,69,56,151,73,59,153,73,60,153,61,53,144,41,43,120,33,34,107,30,29,98,33,25,93,39,27,87,48,30,88,51,32,84,45,24,65,41,21,59,39,18,59,38,16,52,
-33,15,30,21,11,3,22,12,4,19,10,4,18,9,5,16,7,5,14,6,5,15,7,5,14,7,4,12,6,4,10,4,3,10,3,3,10,4,4,15,4,5,22,6,7,23,6,7,
-24,7,8,27,7,9,28,7,9,32,9,11,35,10,12,37,10,13,38,10,13,37,10,13,37,11,13,37,11,13,39,12,13,39,13,14,40,14,16,42,15,20,42,16,20,42,16,20,
-41,16,19,40,16,19,40,17,18,40,17,17,38,17,16,34,12,13,29,8,11,28,7,10,28,7,9,27,7,8,27,7,8,27,6,10,26,7,10,25,6,10,18,4,7,9,2,3,
-5,1,5,3,3,11,3,4,17,5,6,27,7,8,34,6,7,29,3,4,17,0,0,3,0,0,0,1,1,8,10,11,45,22,17,64,37,25,89,51,27,106,64,29,121,76,35,139,
-94,49,167,118,61,192,134,65,203,141,69,208,156,64,212,160,60,209,160,56,202,152,51,194,141,51,191,130,63,200,117,78,211,94,76,203,69,52,162,43,28,109,21,16,68,12,13,55,
-6,7,28,1,1,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,6,7,2,29,33,9,51,54,16,56,58,17,55,56,17,54,56,17,54,56,18,54,60,42,57,68,79,60,75,113,67,74,126,76,72,130,
-79,61,118,81,55,117,79,49,115,67,38,99,54,31,85,49,34,80,59,47,99,79,71,129,101,97,156,114,106,166,122,112,173,127,109,175,124,102,171,120,88,164,111,73,154,100,60,146,
-89,48,139,79,45,137,71,44,135,68,47,136,61,51,138,57,53,138,53,54,135,45,50,124,38,43,113,34,41,112,38,41,108,40,40,103,38,39,97,40,36,92,43,35,89,44,33,84,
-40,29,67,30,22,31,25,20,15,25,19,11,24,17,6,26,17,7,27,17,7,31,21,9,34,22,9,32,22,9,31,21,9,31,20,8,29,19,9,31,19,9,34,19,10,34,19,10,
-35,19,11,36,19,12,37,19,12,38,19,14,40,20,15,41,21,15,41,21,15,41,21,16,41,22,15,41,22,15,41,22,15,43,23,16,45,25,17,43,25,16,41,22,15,38,19,13,
-37,16,13,35,15,11,36,15,11,35,14,11,34,12,11,33,10,11,29,8,10,27,7,11,28,7,13,25,6,12,21,5,11,19,4,11,16,4,12,15,4,14,10,5,17,4,6,22,
-5,6,27,8,8,35,9,9,33,8,6,20,5,3,9,0,0,0,0,0,0,1,1,3,9,5,22,24,14,57,45,25,98,60,30,119,70,33,128,79,37,143,92,50,168,105,61,188,
-124,67,200,142,65,206,161,64,211,169,62,212,173,60,211,169,57,206,158,56,202,141,63,204,121,74,209,102,78,206,74,59,171,47,31,116,24,16,75,12,14,56,7,9,36,2,2,10,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,12,3,36,40,11,53,56,16,56,58,18,55,56,17,54,56,15,54,56,21,56,61,43,57,65,72,59,72,105,
-63,75,122,71,75,134,80,74,144,86,71,148,85,60,134,76,47,118,66,37,101,64,37,98,65,42,97,72,57,111,86,74,131,101,91,152,115,106,167,122,110,173,126,110,176,126,108,174,
-123,100,171,119,86,163,110,72,155,100,54,146,90,45,137,82,44,137,77,47,137,68,44,127,63,46,123,55,47,120,51,47,117,47,46,116,40,41,101,34,34,84,33,34,86,31,35,88,
-28,32,80,25,26,56,23,24,48,22,22,36,18,14,5,19,14,2,21,15,3,24,18,5,28,20,5,29,20,7,30,22,8,32,23,9,32,23,9,33,23,10,33,23,9,33,23,9,
-33,24,9,32,24,9,33,24,9,35,24,10,37,25,11,39,25,12,38,26,12,36,23,11,33,19,11,31,18,11,33,17,11,35,17,12,37,17,13,37,16,14,36,14,12,34,12,13,
-34,10,13,34,9,15,33,9,15,30,7,15,30,7,15,28,7,15,24,6,12,21,4,12,19,4,13,14,3,12,12,5,18,11,6,23,10,8,30,10,8,33,12,10,37,12,10,35,
-11,5,19,12,4,13,13,3,9,11,2,4,7,2,6,8,4,19,19,10,43,36,17,72,48,22,96,62,29,119,73,33,136,83,40,148,97,50,169,117,64,194,140,68,207,154,67,212,
-164,63,212,174,62,214,181,62,215,177,60,212,164,59,207,144,62,204,122,72,206,101,75,201,76,58,169,46,31,115,24,16,74,12,12,54,7,9,38,3,3,14,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,20,6,42,45,13,54,57,17,54,57,17,54,56,16,54,56,14,54,56,16,54,58,30,
-55,62,56,58,68,88,68,77,128,79,86,155,80,82,155,83,76,152,89,70,142,90,61,140,83,46,120,71,40,107,71,37,104,83,45,120,97,59,142,102,74,149,107,87,155,112,97,162,
-117,111,168,122,115,173,124,106,175,120,86,164,112,59,148,109,48,144,106,48,145,102,45,142,100,49,141,91,51,134,76,49,120,68,48,116,60,43,104,51,36,88,51,39,93,47,38,94,
-38,32,85,31,24,72,30,25,79,31,24,65,29,18,38,28,15,24,27,15,19,28,15,18,27,15,18,26,14,10,27,14,9,29,16,10,30,16,10,28,16,10,28,16,9,29,16,10,
-31,18,13,32,18,13,32,18,14,33,19,14,36,19,16,37,20,16,37,20,17,35,16,16,31,11,15,29,7,15,30,7,15,32,8,17,34,8,18,34,8,19,34,8,18,35,9,19,
-35,9,19,35,10,19,32,8,17,27,7,14,23,6,13,20,5,16,13,5,18,10,7,23,13,11,33,13,12,33,12,10,36,13,9,33,12,6,22,12,5,16,14,4,11,12,3,7,
-10,2,5,9,2,8,9,4,17,8,8,34,22,19,70,44,26,98,59,28,113,65,31,125,68,32,127,82,39,146,104,57,178,123,64,195,139,63,204,161,65,214,179,65,218,185,63,218,
-186,62,218,182,61,215,171,60,211,151,63,208,119,66,200,93,64,187,72,53,161,45,32,117,25,18,77,13,13,59,7,9,38,4,4,19,0,0,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,4,1,24,26,7,46,50,14,53,56,17,54,56,17,54,56,16,54,56,15,
-53,55,13,53,55,19,66,61,56,82,70,107,82,74,129,83,84,146,89,91,161,100,92,172,109,84,172,102,73,160,99,63,150,101,54,149,105,51,149,101,47,145,98,47,140,99,53,139,
-103,67,142,108,83,149,113,92,154,111,79,145,106,59,133,105,52,132,108,52,138,106,50,138,110,52,143,109,52,142,98,49,127,96,49,122,95,49,121,90,48,118,86,47,114,81,46,111,
-73,44,103,64,39,97,58,35,92,60,39,101,60,37,90,58,34,77,56,33,74,58,32,74,59,30,71,54,25,52,44,20,31,36,17,16,33,15,11,33,15,11,33,15,11,34,14,12,
-37,15,17,37,14,19,37,13,18,38,14,19,38,14,19,36,14,18,38,14,19,37,13,18,36,11,18,35,11,17,35,11,16,35,11,16,34,11,15,34,12,15,34,12,14,35,14,13,
-34,14,13,32,15,12,30,16,11,27,15,8,22,13,13,24,16,28,25,17,34,25,16,26,28,18,27,28,14,25,19,5,13,20,5,10,14,2,5,9,2,5,9,3,13,7,5,22,
-10,10,39,17,16,61,30,26,93,42,32,112,56,39,132,71,38,139,84,41,146,92,47,156,109,51,173,135,59,194,158,65,210,173,65,217,182,64,218,191,64,220,193,63,220,187,62,218,
-171,61,212,145,61,205,117,63,195,90,61,181,66,47,150,43,30,109,23,17,70,13,13,56,8,10,40,4,6,22,1,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,8,2,28,32,9,46,50,14,51,55,16,53,56,17,
-53,56,17,53,56,15,57,57,22,67,60,44,73,62,61,80,65,85,83,71,110,89,81,137,99,89,158,106,96,171,108,96,175,108,89,174,109,79,171,108,72,170,111,64,165,110,56,157,
-108,53,149,106,53,143,107,58,142,114,62,147,117,61,147,114,60,141,112,59,137,107,57,131,105,54,130,105,54,131,103,54,129,105,54,128,109,54,132,109,53,132,110,53,133,107,52,127,
-93,47,105,81,43,87,75,42,82,75,41,84,76,42,84,72,42,77,69,42,73,64,39,63,65,39,64,63,38,60,55,35,43,42,30,21,38,28,12,37,26,11,38,27,12,37,26,12,
-37,24,12,35,21,12,35,21,12,35,21,12,35,21,12,36,22,13,36,22,13,34,19,13,34,19,12,35,19,13,35,19,13,35,21,13,35,21,14,36,22,15,36,22,14,35,22,15,
-34,22,14,34,21,16,35,22,17,32,20,15,28,15,16,28,14,17,27,12,15,21,9,9,17,8,7,12,3,4,9,3,10,8,5,21,8,9,36,9,13,48,13,19,69,23,25,86,
-41,32,112,54,35,127,65,39,140,80,41,150,98,47,164,119,53,178,139,60,195,160,64,209,177,66,218,188,67,221,193,65,222,197,65,222,196,65,222,190,64,220,173,64,217,148,65,210,
-108,60,189,80,52,164,56,37,126,30,19,75,18,13,56,13,15,56,8,10,39,5,5,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,12,3,32,36,10,45,49,13,
-50,53,15,52,55,16,53,56,15,53,56,15,55,57,21,58,57,27,63,58,40,74,61,65,92,68,104,102,76,130,105,83,147,104,91,158,103,95,165,105,98,173,114,100,183,125,93,187,
-125,81,184,123,73,178,118,64,167,128,64,173,131,66,174,128,63,167,125,64,163,121,64,157,120,64,154,119,63,149,117,64,144,112,62,135,104,59,124,104,57,123,106,57,126,106,56,123,
-98,51,111,89,48,97,87,47,94,84,45,89,83,44,88,73,41,71,57,35,45,43,30,19,40,30,14,41,30,18,41,31,16,39,28,10,39,28,11,41,29,12,42,30,13,42,30,13,
-42,30,13,41,30,13,41,30,12,41,30,12,42,31,15,45,32,19,47,33,22,46,30,22,45,27,22,45,23,22,44,23,21,42,21,21,40,20,20,39,19,19,36,17,17,29,15,14,
-22,11,10,19,8,8,15,5,6,11,4,5,7,3,4,6,2,7,6,4,15,6,6,25,8,10,39,10,15,54,13,17,65,16,21,77,25,30,96,33,29,101,42,30,107,55,27,107,
-80,38,142,104,46,166,123,54,182,144,59,196,166,63,209,181,65,217,191,68,222,198,67,224,202,67,224,202,66,224,196,65,222,182,63,218,161,63,212,131,63,202,101,60,186,71,47,151,
-45,28,102,23,13,55,11,7,33,6,7,31,5,7,27,3,4,15,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,14,16,5,
-31,36,9,42,47,13,48,51,14,51,53,15,52,55,15,52,55,14,51,55,15,55,56,23,80,64,68,97,69,100,111,73,125,119,75,142,116,77,146,113,81,150,112,87,159,125,96,177,
-132,102,189,134,106,196,132,98,193,136,94,195,134,86,191,128,79,184,129,72,178,127,70,177,127,69,174,131,69,174,135,70,173,128,68,162,114,66,146,110,63,139,109,64,138,108,62,133,
-107,61,128,104,60,122,101,58,117,100,57,115,99,55,114,90,51,100,72,44,72,66,39,60,60,35,53,60,34,51,56,33,44,48,28,32,39,23,16,38,23,13,41,24,16,41,24,16,
-42,24,16,42,24,17,41,23,16,40,19,15,38,18,12,39,19,13,40,20,15,39,19,14,37,16,13,36,14,12,31,10,10,24,7,7,20,5,5,16,3,4,12,2,2,4,1,3,
-1,1,8,3,4,18,7,7,30,13,12,46,19,16,58,29,23,80,30,23,83,21,21,71,21,21,72,26,26,89,39,27,98,59,30,115,83,35,133,104,39,151,117,42,161,130,46,173,
-151,56,194,172,65,212,187,68,220,198,68,223,204,68,224,206,68,225,204,67,226,196,65,223,186,65,221,168,63,214,141,62,204,108,53,179,78,43,149,54,35,120,31,20,76,13,8,37,
-7,6,27,5,6,25,2,3,13,3,3,13,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,3,0,15,19,5,28,33,8,36,41,11,42,46,12,49,51,14,52,55,15,53,56,16,61,58,32,73,62,55,85,66,82,104,72,113,115,74,130,122,75,141,125,76,148,127,79,154,
-129,82,162,129,88,168,132,92,175,132,97,181,133,103,189,138,102,194,142,102,198,143,101,201,140,98,200,144,92,199,146,82,194,142,76,186,136,72,178,133,70,173,131,72,171,131,72,168,
-127,72,160,123,68,149,120,67,143,116,66,139,116,66,139,115,66,138,110,63,131,105,60,126,103,57,124,104,57,124,97,54,116,84,49,96,68,42,70,62,40,62,62,40,63,64,40,64,
-64,38,64,63,37,65,60,31,66,50,24,56,29,15,23,22,12,11,24,13,15,26,14,19,28,15,25,28,14,27,22,10,22,12,6,18,11,9,26,15,10,29,22,13,40,27,19,56,
-36,28,88,40,28,95,49,30,102,56,33,112,65,33,113,75,34,120,67,27,98,66,26,95,77,29,114,88,32,128,113,40,155,142,49,182,166,56,202,178,60,211,188,63,217,196,66,222,
-204,67,224,208,69,225,209,69,226,208,68,227,203,67,226,189,64,221,167,60,210,140,59,200,111,54,183,82,44,153,61,34,122,32,17,69,17,8,36,6,2,13,0,0,0,0,1,5,
-3,4,17,2,2,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4,4,1,12,17,4,22,27,7,30,34,10,40,43,11,45,47,12,49,51,13,50,54,13,53,55,20,62,59,38,72,62,57,84,66,79,97,69,102,107,72,119,
-115,73,133,121,74,141,126,76,148,127,77,152,133,82,163,145,88,179,150,92,188,155,98,198,154,102,201,152,105,202,154,100,201,151,90,195,144,80,187,144,76,186,145,78,186,144,79,186,
-145,81,185,143,78,183,139,72,173,136,68,166,136,70,165,137,71,164,137,69,166,135,70,163,130,68,155,129,68,153,125,67,150,118,64,140,110,62,129,108,61,126,107,61,125,104,59,123,
-100,54,117,99,51,119,96,48,118,83,41,103,69,35,83,69,39,92,77,43,106,74,45,108,78,46,110,77,44,113,62,38,97,57,34,89,62,40,98,70,42,106,77,42,112,84,43,122,
-89,41,132,90,36,129,95,35,131,103,38,140,119,42,154,133,46,168,148,51,182,161,56,195,171,59,205,180,61,212,189,63,219,198,66,222,205,67,225,208,68,226,210,68,227,211,68,227,
-210,68,228,201,67,226,186,63,219,163,59,206,135,53,188,105,46,164,80,41,146,61,33,122,37,20,79,18,8,39,6,2,13,1,0,2,0,0,0,0,0,0,0,0,0,0,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,6,1,12,17,4,20,25,7,25,29,7,30,32,8,36,39,10,43,45,10,47,50,11,49,53,12,50,53,15,55,56,26,60,57,39,
-70,59,57,84,64,84,98,67,110,107,70,123,113,71,130,122,73,142,129,74,152,135,76,160,141,78,168,144,81,174,151,85,182,153,85,185,151,81,181,150,80,180,146,78,177,148,79,181,
-150,80,185,152,79,188,148,74,182,144,70,175,141,69,173,146,70,178,148,70,181,148,70,180,144,68,174,142,69,172,144,69,173,143,69,172,144,69,173,144,69,173,144,69,173,135,65,162,
-128,61,155,123,59,149,121,58,147,116,55,138,121,58,147,125,61,160,122,63,162,114,59,152,114,56,148,112,55,147,112,52,148,118,53,153,128,56,161,136,58,170,144,59,178,151,56,186,
-160,56,194,168,58,201,174,59,206,181,62,212,190,64,217,195,66,220,203,67,224,207,67,226,210,68,226,212,69,228,212,69,228,211,69,229,209,69,229,202,67,226,189,64,222,169,61,211,
-141,54,191,112,48,169,89,39,147,69,33,124,49,24,93,31,14,63,19,9,41,10,5,22,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,7,9,2,15,18,5,14,15,4,14,16,4,19,21,6,28,29,7,38,39,10,44,44,11,46,48,11,48,51,11,
-49,52,10,57,55,29,71,58,59,81,62,78,82,62,82,89,64,97,96,63,107,101,63,115,105,63,121,114,66,132,132,72,157,144,76,173,153,79,182,156,81,187,158,81,187,163,84,192,
-168,86,197,171,86,200,173,86,201,165,84,194,159,81,189,159,79,188,162,78,193,159,75,191,160,75,192,158,73,191,157,73,190,154,71,187,154,71,188,158,68,191,162,68,196,163,69,195,
-157,66,190,151,64,185,154,65,187,157,67,190,160,66,194,161,62,196,163,62,197,163,61,197,167,62,199,172,63,203,182,66,210,188,67,215,193,68,219,197,69,221,199,68,222,204,68,224,
-208,69,226,211,70,227,213,72,227,213,71,227,214,68,228,214,69,229,215,69,230,212,69,231,206,68,229,196,65,224,180,61,214,158,54,196,135,47,176,107,38,149,77,33,126,50,27,100,
-27,19,69,20,13,51,18,10,41,15,7,30,7,3,14,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,5,5,2,7,8,2,9,10,3,11,11,3,16,16,4,22,22,6,30,29,8,38,37,9,
-44,44,12,48,48,13,62,54,39,66,56,45,69,57,52,71,57,56,72,57,61,74,57,67,77,56,74,80,55,83,93,57,106,105,59,125,115,61,140,125,63,151,134,66,162,146,72,175,
-157,77,188,167,79,199,175,83,204,180,86,208,183,88,211,186,87,213,187,86,214,188,86,214,190,86,215,187,81,214,185,79,213,183,78,211,182,78,211,185,77,213,189,76,216,191,75,217,
-193,74,218,192,72,218,193,73,219,194,73,219,196,72,220,199,70,222,202,71,223,205,71,225,208,72,226,211,72,227,214,73,227,215,74,227,214,74,228,214,75,228,215,76,228,217,76,229,
-216,77,230,213,76,230,207,75,227,200,71,224,191,64,219,175,59,209,154,53,191,128,45,167,103,36,139,74,26,105,46,17,72,30,11,49,17,6,31,6,4,17,3,3,15,0,0,4,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,3,0,4,4,1,7,6,2,7,7,2,12,11,3,15,14,4,
-21,21,6,33,29,21,44,36,32,51,43,35,56,47,37,55,47,32,59,49,37,60,50,40,60,49,40,60,50,41,63,50,49,66,50,56,68,50,63,71,47,71,74,45,79,90,50,102,
-108,56,129,118,57,143,130,60,159,143,63,174,155,68,187,166,71,198,175,75,206,181,78,210,187,79,214,189,77,216,190,77,217,192,78,219,194,78,219,198,79,222,201,80,223,201,80,224,
-203,79,225,205,78,226,206,80,226,206,79,226,206,79,226,206,78,226,209,79,227,207,79,227,208,79,228,208,78,227,205,76,225,199,73,222,192,70,217,181,67,210,174,63,205,166,61,200,
-155,56,191,135,49,172,109,40,147,90,33,127,75,27,111,59,21,90,35,13,59,20,8,37,5,3,14,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,1,0,0,0,0,2,2,1,4,3,1,
-6,5,1,17,11,18,29,17,33,33,22,33,33,25,26,38,30,28,47,36,40,48,37,37,45,37,31,52,41,34,54,43,38,55,43,38,57,44,36,56,44,38,56,44,41,67,49,60,
-77,52,78,79,51,84,81,50,90,84,47,98,94,47,112,102,48,124,112,51,138,117,51,144,123,54,152,130,55,160,138,57,169,143,58,174,147,59,178,152,61,182,153,62,184,155,62,185,
-157,62,187,157,63,187,160,64,190,157,63,188,151,61,181,146,59,176,143,58,172,134,53,164,125,50,157,121,47,154,111,43,143,99,35,131,92,32,125,81,29,113,71,25,105,68,24,105,
-61,22,97,50,18,80,34,12,57,25,10,45,25,9,42,22,8,38,14,6,26,11,4,22,8,4,14,1,1,4,0,0,3,0,0,3,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+static const uint8_t spheremap_packed[] = {
+66,90,104,57,49,65,89,38,83,89,173,224,121,217,0,2,192,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+224,147,40,97,53,127,15,137,81,95,64,177,161,65,160,13,0,0,10,160,0,0,40,80,
+0,0,0,0,0,208,0,6,216,0,0,3,33,67,54,5,177,88,64,2,129,64,136,82,
+73,34,10,73,0,0,81,81,64,40,5,1,163,4,40,18,43,62,176,56,107,8,40,1,
+64,161,165,82,128,12,13,12,148,145,66,102,52,91,184,119,54,26,5,20,13,180,0,32,
+25,84,146,163,97,137,45,217,221,219,174,53,169,81,84,42,148,4,202,137,86,204,219,54,
+54,237,183,119,118,178,148,208,20,213,12,7,66,154,214,139,109,247,111,79,106,202,66,13,
+24,35,0,7,90,171,111,119,186,106,132,26,48,21,96,5,85,235,119,118,40,85,21,4,
+160,186,133,39,90,47,111,80,0,0,2,224,42,189,171,128,0,0,4,226,72,98,168,0,
+0,5,138,204,139,96,3,208,2,112,228,174,75,160,36,4,97,211,133,43,160,168,130,91,
+166,0,14,144,132,93,195,14,180,96,9,12,117,192,0,225,49,130,233,192,58,8,1,140,
+0,201,0,48,193,160,65,65,140,45,149,72,3,48,12,200,0,140,13,108,208,6,48,219,
+98,95,65,92,113,172,198,185,40,231,52,155,97,202,135,56,101,108,192,45,21,169,39,72,
+152,168,20,210,115,142,10,29,41,220,49,75,110,146,206,96,181,135,5,221,148,40,114,141,
+168,0,193,119,54,217,67,129,59,176,54,206,5,165,0,194,209,74,48,64,2,17,160,48,
+64,105,130,0,66,20,130,237,128,132,10,65,2,9,77,48,130,160,136,9,42,133,20,8,
+65,74,160,232,228,20,237,133,246,57,6,141,5,40,10,0,0,0,0,0,0,0,0,0,
+0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,1,64,0,0,0,0,0,1,
+64,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,32,47,100,43,195,232,85,79,
+0,128,0,0,0,35,67,32,0,0,0,0,0,0,104,104,208,0,0,0,0,0,0,1,
+52,13,19,4,208,0,0,153,26,6,137,128,64,144,140,34,167,144,0,0,8,208,0,0,
+0,76,77,26,0,0,35,77,0,0,4,196,192,38,0,77,13,13,0,210,70,41,233,169,
+177,20,252,148,242,143,77,70,79,73,233,24,53,12,128,3,64,0,0,49,20,242,16,0,
+52,0,0,64,2,0,64,0,154,6,129,52,211,77,25,77,79,83,244,68,218,53,61,77,
+79,76,17,169,232,208,154,27,83,70,154,104,122,131,64,104,13,52,100,0,0,0,0,0,
+0,0,1,169,132,2,100,0,64,128,77,4,100,52,104,2,105,161,147,77,50,19,105,61,
+33,138,155,244,35,9,166,148,105,237,83,101,54,106,155,213,15,68,245,15,212,128,26,13,
+169,144,0,0,0,3,77,0,0,200,0,0,0,13,79,16,130,8,16,64,32,154,76,83,
+105,180,81,54,209,79,41,145,234,0,0,0,13,0,104,3,212,25,168,211,64,0,0,0,
+0,0,0,0,0,0,0,13,0,0,0,4,154,72,132,34,9,130,4,39,164,167,189,8,
+83,39,180,147,196,212,244,158,83,35,212,6,71,169,181,13,168,0,0,61,70,128,6,135,
+168,6,128,26,7,168,0,3,64,0,208,0,0,0,0,3,64,208,26,48,11,90,109,10,
+154,97,45,174,251,107,68,243,106,2,34,200,247,237,227,57,29,245,104,29,193,64,20,84,
+129,228,202,168,136,177,20,16,17,4,81,83,77,99,197,150,103,159,167,39,202,236,79,101,
+175,159,30,122,61,222,187,223,146,249,218,58,73,138,201,164,61,8,30,158,46,196,95,215,
+180,165,41,221,32,13,118,24,234,231,183,75,178,78,141,221,171,148,59,196,49,226,21,196,
+155,178,108,33,89,157,40,61,21,130,52,122,39,158,20,178,150,4,184,186,217,217,84,231,
+201,247,141,232,235,2,142,78,236,116,224,198,65,23,65,44,121,167,30,119,118,102,217,148,
+238,158,203,50,188,53,50,136,87,183,139,3,17,213,49,196,31,43,81,53,65,27,108,89,
+20,33,80,123,211,186,113,179,102,73,158,171,38,120,241,119,168,94,104,181,158,143,44,48,
+216,228,228,145,28,32,195,48,134,11,37,229,89,237,134,233,9,218,49,2,193,40,118,110,
+33,88,122,144,169,20,232,74,233,35,105,13,243,100,196,229,62,38,144,54,55,4,72,93,
+28,24,40,161,116,23,67,215,152,193,2,1,3,107,236,237,103,24,96,154,36,141,200,3,
+70,194,77,132,26,207,146,114,109,237,165,3,97,167,106,236,101,133,210,88,176,185,0,18,
+55,54,71,173,43,19,60,245,204,243,176,187,35,101,187,211,93,238,172,55,48,156,150,189,
+155,182,121,102,155,133,243,165,121,203,113,160,167,62,186,123,60,83,108,72,220,249,190,124,
+180,46,98,183,80,88,36,14,13,135,61,144,142,157,103,19,215,26,118,4,216,92,131,32,
+242,129,61,198,53,182,154,92,208,20,128,181,231,51,199,9,223,50,107,158,45,39,173,200,
+27,112,62,221,149,142,222,155,220,116,245,171,217,157,16,188,178,117,19,99,139,175,9,90,
+209,40,116,35,147,97,122,8,10,225,41,134,204,144,193,110,252,64,179,135,215,136,156,144,
+22,143,71,108,3,69,24,56,44,219,64,129,4,106,41,193,102,154,1,215,116,250,74,50,
+184,114,26,54,156,77,98,106,236,177,99,48,216,59,194,19,8,249,211,4,115,3,59,196,
+227,78,182,144,165,121,153,210,146,48,186,177,151,203,82,134,218,83,57,189,221,232,83,174,
+202,100,134,240,100,94,21,171,19,135,37,155,111,72,10,34,61,133,88,91,234,158,144,58,
+87,190,241,133,248,141,187,44,33,164,202,80,146,213,59,113,59,135,117,232,69,132,31,12,
+35,189,244,221,164,237,212,237,117,108,170,61,44,32,241,117,168,129,78,50,147,227,84,90,
+202,49,68,81,154,99,197,198,34,188,178,193,117,195,113,51,94,251,157,144,38,208,22,28,
+37,99,45,47,81,216,154,116,2,197,145,25,233,110,112,91,146,160,241,198,180,58,222,93,
+209,189,222,41,205,18,102,80,10,187,62,152,67,87,187,143,130,12,214,4,176,97,19,97,
+70,217,142,56,209,193,198,244,230,180,205,57,198,179,4,205,235,13,50,72,44,5,38,91,
+54,146,105,92,66,53,164,14,75,66,43,150,110,156,249,117,207,110,142,128,232,104,144,189,
+184,242,239,184,78,146,65,100,231,139,27,65,17,4,129,57,180,77,43,183,22,67,77,74,
+56,157,239,28,104,231,142,181,213,78,207,3,203,188,79,64,89,191,181,11,88,34,1,102,
+152,1,58,57,57,138,222,24,134,246,70,112,45,96,26,24,41,202,122,24,120,215,108,146,
+7,57,67,41,65,242,241,188,208,67,125,146,146,19,25,88,73,167,207,84,128,231,150,73,
+39,73,166,72,101,178,73,214,168,21,132,49,129,56,234,195,72,73,174,212,144,198,6,217,
+33,217,146,26,100,225,156,115,100,156,48,147,201,132,13,178,67,164,128,64,226,78,134,218,
+67,186,234,204,123,234,245,191,155,141,238,10,74,202,34,201,203,28,167,204,156,73,140,19,
+144,114,2,41,144,204,161,182,183,170,204,248,19,0,25,16,21,33,210,65,155,147,159,162,
+92,7,143,159,175,94,124,185,237,249,117,123,250,60,183,243,114,19,148,135,102,21,132,170,
+146,84,36,247,184,144,22,1,62,86,72,84,138,10,106,150,41,34,150,217,34,214,171,34,
+32,107,155,3,24,137,166,197,101,69,146,197,79,131,84,100,22,34,0,176,21,67,60,92,
+20,22,48,207,94,96,152,141,47,31,45,154,213,81,88,162,162,169,4,86,114,146,204,181,
+70,165,43,80,20,145,96,162,145,16,17,0,77,120,184,48,98,108,66,160,10,109,217,148,
+85,84,86,49,86,34,48,175,79,102,19,110,224,129,245,82,73,235,103,58,170,35,225,149,
+89,217,43,59,117,96,30,237,94,105,188,10,111,190,115,151,74,155,189,178,85,226,205,108,
+173,184,172,251,214,221,126,159,183,46,58,183,211,92,100,223,178,12,16,73,54,38,21,145,
+60,4,16,86,88,196,144,107,86,45,46,178,18,97,141,68,49,198,40,41,20,131,24,229,
+33,81,24,65,65,16,139,225,60,144,134,223,31,82,240,128,11,13,91,9,234,66,120,126,
+171,33,247,137,38,216,30,207,159,143,87,111,47,71,198,246,237,8,20,119,137,108,17,67,
+18,86,64,89,140,38,50,98,124,25,140,135,177,36,54,56,147,108,88,35,50,203,32,65,
+100,5,0,140,72,30,228,33,164,193,36,33,70,73,37,100,20,169,10,12,172,9,89,22,
+4,80,5,130,146,0,162,203,105,20,3,72,18,176,128,177,97,39,165,8,26,100,147,25,
+36,128,42,168,101,174,154,49,81,69,65,81,23,73,85,16,65,65,180,89,81,69,81,5,
+65,136,204,184,90,98,168,38,82,138,12,88,34,39,174,220,165,5,84,98,42,141,162,232,
+221,38,148,20,125,246,187,101,98,40,107,209,76,124,153,85,13,253,206,102,91,58,103,147,
+238,214,242,109,198,47,169,33,125,54,79,52,198,67,187,121,96,84,17,180,177,68,139,17,
+153,74,164,81,92,180,81,145,97,43,8,84,229,133,7,201,10,128,177,73,22,2,144,5,
+132,98,44,80,84,100,84,86,34,140,177,42,160,171,24,144,83,11,73,137,137,138,193,131,
+23,171,118,149,20,130,170,138,163,187,42,163,18,10,44,114,173,64,85,68,42,40,86,84,
+170,139,34,145,73,213,170,17,100,131,171,44,85,65,73,109,32,232,75,166,21,17,85,15,
+153,8,142,79,66,3,54,4,216,131,107,86,123,102,56,49,116,43,207,152,230,134,168,128,
+71,154,74,190,203,47,106,81,56,77,229,56,66,137,20,221,161,233,203,39,132,210,2,69,
+135,82,161,26,232,192,129,204,83,102,53,42,222,81,216,177,98,108,57,59,17,190,232,119,
+96,167,9,222,125,95,139,141,121,112,89,199,87,19,229,215,127,62,118,78,144,89,17,138,
+40,140,69,136,8,192,81,103,44,181,172,91,107,147,207,49,81,8,178,10,112,146,84,0,
+52,147,151,23,203,156,142,83,104,5,100,42,19,35,49,145,18,98,69,38,101,163,27,66,
+197,100,88,18,177,96,10,2,139,0,109,10,68,34,168,161,88,164,70,20,98,144,88,69,
+22,45,203,136,99,205,239,151,116,149,13,182,148,5,22,54,158,161,12,25,7,42,149,0,
+245,53,89,20,14,233,43,3,86,144,173,24,84,177,34,132,168,86,41,21,96,188,219,238,
+249,51,2,34,44,216,149,34,48,89,85,36,43,17,33,82,124,201,142,50,121,36,158,24,
+26,77,61,48,190,53,129,60,91,22,47,157,222,37,81,177,47,45,192,12,64,89,12,172,
+176,202,88,179,73,166,105,71,66,7,102,5,17,210,88,197,13,37,109,51,6,216,109,13,
+99,90,84,45,111,14,64,72,99,82,68,106,183,217,110,121,225,46,20,224,182,15,138,75,
+53,103,14,51,18,142,183,97,136,29,125,23,25,54,212,225,129,80,203,81,85,6,33,50,
+91,68,42,49,23,154,21,82,101,171,32,140,139,15,102,253,26,212,138,27,19,132,3,19,
+4,46,251,241,223,209,207,140,161,202,40,176,81,19,171,96,145,130,10,35,13,53,24,161,
+92,80,92,125,124,93,26,69,88,168,42,86,133,101,100,85,130,136,129,68,43,110,238,76,
+72,163,65,75,26,82,147,50,192,193,95,107,14,117,117,107,70,176,104,178,180,197,76,96,
+231,171,61,207,205,158,141,240,136,205,161,233,115,41,223,182,99,19,154,20,218,22,239,60,
+244,84,17,53,91,27,18,219,167,50,210,149,180,173,173,162,180,175,191,44,142,90,221,52,
+194,174,166,192,4,72,61,200,130,205,133,134,101,176,68,54,133,125,19,187,10,74,184,141,
+73,203,30,16,225,168,185,106,18,173,165,149,165,85,80,173,81,18,209,176,181,175,13,130,
+153,26,146,219,86,33,29,90,11,109,144,18,116,209,85,6,69,96,161,164,42,49,130,178,
+234,226,168,109,133,138,69,62,12,37,4,89,170,95,135,21,203,80,41,161,109,99,138,197,
+177,25,242,175,46,85,241,223,100,9,28,27,8,32,150,120,59,40,240,132,90,82,21,82,
+165,29,51,19,45,143,26,246,232,222,219,170,24,98,218,96,111,52,138,106,54,133,42,193,
+133,173,5,182,133,138,128,219,41,111,116,43,50,182,138,249,39,14,84,172,70,106,209,100,
+180,168,214,74,169,5,239,154,194,154,173,181,65,25,153,152,182,150,220,204,96,229,76,194,
+200,30,183,79,132,214,35,98,54,20,170,198,109,149,1,72,136,138,192,196,139,17,40,197,
+140,87,239,25,40,193,98,138,164,198,249,211,195,14,53,98,172,132,85,68,54,133,98,32,
+86,77,111,94,56,240,242,247,183,163,129,136,99,90,217,74,95,70,83,179,62,78,189,59,
+214,249,197,100,85,88,184,54,87,41,136,71,198,171,137,104,178,218,178,178,170,118,111,125,
+92,148,77,53,225,214,168,121,236,209,189,122,82,67,17,72,170,162,233,150,210,140,156,210,
+152,156,230,91,50,11,219,69,156,166,133,49,139,100,218,4,43,36,43,14,25,131,166,178,
+148,43,105,89,117,119,160,179,69,91,26,218,216,200,74,146,31,115,178,154,77,166,241,180,
+173,98,54,130,144,20,40,113,133,114,174,54,38,183,142,20,146,10,11,4,121,165,120,44,
+42,18,87,134,166,21,29,184,64,244,83,83,78,146,217,9,182,75,149,53,96,22,208,7,
+51,9,12,96,119,114,216,107,44,157,38,120,237,217,212,33,194,246,178,28,164,198,16,89,
+32,246,160,164,129,80,130,193,24,17,24,21,139,0,233,5,132,236,195,195,173,208,139,36,
+221,160,103,25,173,67,24,26,100,133,64,152,192,149,8,73,53,154,204,88,219,253,118,80,
+86,11,17,24,170,139,237,214,24,42,165,221,169,38,122,45,159,156,180,83,26,195,86,20,
+68,155,180,112,189,220,72,246,214,58,235,122,138,240,83,104,76,80,198,143,14,176,74,141,
+106,219,49,204,181,165,166,76,154,241,206,206,53,189,185,134,62,119,112,216,155,226,147,34,
+137,150,8,210,218,37,181,141,90,81,69,141,165,89,195,97,137,254,142,117,173,155,53,117,
+152,58,172,94,183,189,233,205,215,69,44,68,213,170,162,214,154,178,163,140,82,137,238,106,
+170,170,67,90,185,211,131,48,174,99,120,201,166,24,40,177,4,123,94,51,89,55,133,88,
+241,77,117,169,155,171,85,53,171,189,85,69,22,34,155,106,32,44,83,134,177,61,237,138,
+196,227,89,143,29,97,136,49,156,222,175,58,52,140,229,221,48,50,155,115,24,168,91,172,
+46,12,211,156,239,12,138,21,109,21,214,221,59,187,51,122,182,221,229,92,212,225,247,243,
+198,12,173,21,226,240,233,52,193,140,172,177,68,45,160,143,46,34,228,85,121,74,170,9,
+170,20,183,88,219,25,31,198,101,115,156,231,131,91,27,75,168,52,109,42,218,105,163,117,
+112,77,238,134,140,166,133,52,45,199,182,94,27,173,156,107,78,181,177,153,195,180,254,175,
+84,140,23,111,189,200,254,13,162,193,78,62,197,12,98,200,178,124,236,215,122,77,71,28,
+67,58,248,238,67,246,125,152,229,229,246,185,24,130,136,138,105,62,210,73,251,79,226,89,
+180,54,148,72,162,172,5,62,178,74,143,123,83,238,239,212,207,106,79,74,31,51,242,61,
+222,88,79,178,201,88,184,149,145,16,23,228,74,175,198,52,22,49,16,47,89,214,165,25,
+255,51,39,232,152,27,116,140,69,19,189,158,16,200,195,76,42,190,246,5,127,59,248,88,
+100,252,247,190,195,13,126,119,14,222,170,77,189,233,79,220,109,147,105,83,212,133,62,148,
+44,127,15,163,167,69,126,249,54,138,2,206,159,74,126,142,217,175,146,135,233,158,24,126,
+149,134,241,171,217,43,235,111,224,179,242,176,175,169,162,8,39,206,149,98,204,108,81,245,
+241,173,29,118,224,184,87,224,135,221,231,224,125,199,57,177,85,97,148,220,108,71,182,255,
+72,154,26,64,137,114,245,83,79,242,124,28,251,8,14,241,96,63,151,31,229,127,5,27,
+249,1,56,129,17,68,60,155,125,56,86,99,50,209,136,63,97,177,84,53,104,161,241,253,
+135,53,169,140,225,88,107,202,211,159,60,169,246,208,186,62,38,115,163,243,236,46,82,41,
+223,221,170,122,247,178,41,180,172,196,22,177,98,145,98,193,84,20,88,125,25,95,194,166,
+158,93,82,204,73,121,166,33,166,138,203,171,3,24,10,72,164,81,101,182,6,63,171,204,
+194,73,80,154,97,140,88,44,152,82,207,83,32,99,1,65,76,141,182,84,136,168,191,220,
+183,110,179,252,4,196,198,126,67,48,69,20,6,36,152,201,82,165,68,73,47,252,25,144,
+134,48,138,65,84,15,80,212,85,138,167,150,143,212,225,236,221,159,154,159,135,199,246,249,
+42,137,181,66,241,73,85,32,140,89,20,146,103,228,83,241,83,237,239,245,88,20,254,123,
+169,146,98,64,233,88,160,85,73,69,100,147,18,76,76,72,12,96,63,171,252,127,193,214,
+146,109,89,47,212,104,251,169,117,84,172,45,253,151,3,243,232,98,164,253,63,220,88,127,
+47,245,175,223,51,233,78,95,127,245,87,251,31,205,166,208,244,53,37,100,59,90,96,162,
+177,71,244,116,133,96,99,249,140,147,31,216,245,73,230,233,253,82,31,116,195,91,161,180,
+251,12,219,13,50,105,132,63,25,133,69,33,150,130,254,200,133,24,42,134,32,149,237,132,
+193,152,159,226,191,136,106,138,70,50,15,203,97,43,17,144,119,123,92,114,181,179,158,174,
+79,176,151,101,252,54,99,57,66,172,17,85,116,216,252,109,251,91,184,67,109,96,235,247,
+204,211,165,67,249,12,54,8,255,249,1,233,10,223,161,50,13,143,229,233,177,39,248,82,
+207,232,207,74,138,133,221,34,179,219,209,251,45,190,70,221,191,250,210,20,129,104,52,198,
+28,175,0,88,243,6,65,134,76,97,149,76,239,35,32,8,152,138,138,197,86,42,48,211,
+79,12,46,155,53,66,193,96,42,199,44,159,120,192,174,155,229,73,191,201,104,42,193,98,
+128,234,202,200,162,237,149,2,225,159,161,186,51,246,171,128,201,234,166,191,65,116,11,131,
+81,60,186,204,246,29,169,153,233,231,228,253,7,127,189,228,245,188,120,84,190,196,42,47,
+174,216,34,44,155,72,218,239,225,251,119,150,206,189,28,118,215,79,228,178,105,155,117,231,
+147,34,134,51,240,51,242,28,59,187,17,237,77,101,5,235,41,20,1,23,18,252,232,120,
+87,6,51,91,176,198,35,31,210,37,102,153,44,84,85,210,220,28,75,109,180,219,28,185,
+233,214,105,211,8,190,206,52,103,3,54,184,173,110,156,198,75,171,140,22,102,155,153,68,
+181,31,247,211,88,235,38,54,211,26,156,234,228,69,45,164,79,133,214,237,214,55,3,121,
+167,10,54,230,24,185,106,44,218,28,241,72,105,8,40,36,218,53,69,89,91,105,195,173,
+7,139,155,71,89,250,205,105,80,254,13,133,100,22,10,138,200,162,193,68,103,40,86,14,
+236,37,84,70,42,130,197,201,108,85,11,198,11,136,40,192,20,14,201,12,76,96,26,100,
+149,134,210,18,161,20,21,252,246,242,98,44,70,239,12,255,196,106,121,165,31,246,218,207,
+248,210,127,208,144,245,36,219,33,180,147,169,216,174,75,241,13,50,207,251,4,169,38,42,
+119,74,194,78,45,128,125,118,72,126,75,33,137,14,7,203,254,254,114,125,44,36,225,12,
+85,254,39,48,33,250,102,171,14,200,66,164,172,149,34,246,96,40,164,177,39,12,168,79,
+215,91,38,144,134,31,149,72,6,48,147,73,15,211,176,156,12,49,60,210,178,62,250,125,
+143,22,4,233,229,144,190,163,254,44,158,196,59,48,62,148,0,219,136,69,156,160,84,130,
+146,125,52,241,245,117,245,157,35,227,246,108,147,24,116,202,172,159,101,37,96,44,144,20,
+89,5,233,10,200,11,21,14,26,27,202,107,84,60,147,50,142,210,170,161,80,168,176,24,
+130,34,49,123,52,140,127,130,104,197,32,143,116,40,163,54,156,235,65,149,169,255,237,42,
+145,251,105,245,240,160,253,250,87,202,219,238,191,125,175,67,49,63,42,253,175,189,186,127,
+97,230,250,212,250,107,119,158,189,158,12,16,142,3,8,104,199,234,170,103,239,205,126,224,
+189,127,244,255,231,104,206,191,252,252,151,104,239,243,80,231,175,55,38,247,72,132,9,148,
+0,162,32,165,105,44,137,132,210,12,24,52,202,218,238,141,204,169,247,252,242,27,62,165,
+188,123,169,159,93,59,246,160,179,132,165,187,65,102,86,234,83,24,152,225,139,21,99,148,
+42,22,146,204,78,250,166,145,215,108,42,28,93,237,133,97,38,140,173,148,182,134,181,69,
+48,42,221,38,59,194,205,42,186,227,47,23,139,50,43,148,56,111,22,45,178,148,53,110,
+76,129,138,1,155,0,46,64,201,22,99,52,195,206,95,228,36,32,213,223,87,89,186,102,
+237,99,17,159,69,173,79,167,31,215,97,49,60,173,65,60,0,193,95,69,40,255,253,255,
+214,243,247,183,244,153,198,79,74,88,201,225,251,89,73,215,145,84,57,63,57,234,253,17,
+201,173,131,105,47,235,253,249,33,236,103,221,117,64,228,89,13,50,114,35,141,162,167,245,
+23,19,19,92,235,66,234,140,93,82,143,191,65,144,139,23,241,89,63,45,166,69,240,152,
+104,65,35,28,255,178,168,3,56,23,123,195,4,99,26,207,214,162,4,33,200,193,130,249,
+6,25,231,223,46,167,123,92,192,222,94,19,12,3,234,161,176,177,242,144,88,76,103,196,
+216,184,27,20,51,180,30,245,171,67,20,218,194,54,100,88,126,111,214,173,105,51,75,193,
+36,54,79,68,188,209,240,60,162,209,113,191,203,54,19,61,245,134,184,237,76,90,40,165,
+44,184,204,84,17,19,42,163,10,212,109,180,70,153,198,104,199,74,105,171,6,49,6,50,
+35,52,209,12,186,87,4,84,1,117,74,177,140,20,82,8,49,66,176,45,161,230,48,196,
+193,10,202,43,136,102,13,148,69,5,149,156,181,227,85,28,25,27,46,233,88,163,153,142,
+24,143,14,107,77,204,166,74,176,81,22,31,176,53,88,57,78,28,70,42,40,242,65,65,
+43,23,112,5,162,144,8,146,213,180,246,78,140,196,133,98,26,181,126,117,67,91,84,0,
+209,119,209,176,242,109,5,158,72,16,128,224,149,164,5,37,250,177,109,157,7,191,32,255,
+13,178,116,77,30,220,89,80,248,155,234,202,233,11,47,20,183,43,42,160,184,149,17,150,
+148,89,109,21,68,109,222,18,239,156,205,37,136,131,82,218,234,230,19,218,225,171,116,177,
+167,23,21,41,149,174,102,156,214,77,100,125,212,184,12,61,26,224,141,34,106,114,130,47,
+144,152,220,222,130,36,29,127,187,90,247,107,119,122,29,95,136,238,31,63,241,114,56,240,
+206,3,207,226,248,142,61,56,251,77,105,138,47,220,48,204,42,187,228,246,187,139,54,32,
+200,56,159,54,36,124,234,238,116,152,36,226,27,66,114,221,161,32,74,51,135,95,193,108,
+62,127,210,85,125,131,111,82,45,110,218,223,110,73,109,16,144,106,96,128,217,109,5,239,
+136,118,62,151,232,34,9,67,252,196,58,31,155,222,187,27,95,141,188,22,121,134,219,94,
+34,93,76,10,28,79,21,20,97,129,243,202,182,23,204,197,170,212,130,54,201,145,253,90,
+250,13,180,69,239,112,147,250,136,199,234,80,145,73,213,158,57,178,105,114,252,172,51,209,
+102,220,223,53,195,89,205,192,117,67,70,6,178,76,196,82,136,189,219,136,164,188,80,214,
+172,46,138,109,53,102,96,182,180,83,46,98,194,99,140,81,98,43,5,146,220,76,5,43,
+70,210,174,172,37,81,33,137,90,209,247,183,41,82,35,5,20,85,5,116,209,71,225,231,
+129,255,187,227,235,113,211,62,15,155,151,203,207,71,212,115,206,156,25,248,186,244,245,125,
+187,56,228,183,172,158,121,167,1,96,170,177,32,196,82,148,149,21,98,162,219,76,48,112,
+48,228,121,119,170,165,178,142,132,185,100,139,54,195,18,76,178,153,171,37,96,238,195,76,
+55,172,28,139,1,65,72,52,164,42,68,106,219,60,216,107,84,116,91,104,86,173,107,105,
+80,109,49,200,226,91,159,91,191,220,154,248,114,87,159,29,242,98,139,170,122,16,201,21,
+72,162,130,162,136,162,121,91,4,85,60,154,155,102,190,199,27,52,197,121,249,127,150,195,
+71,94,156,197,25,199,108,48,221,181,148,154,80,199,90,135,105,253,191,229,51,104,156,4,
+32,32,80,229,102,98,32,163,2,67,38,106,253,119,13,94,28,130,149,146,218,41,94,105,
+113,144,177,144,81,109,209,150,54,241,76,51,207,89,131,161,179,91,193,87,24,21,133,18,
+211,121,55,173,100,49,145,204,196,90,91,161,49,203,101,69,137,3,72,98,9,133,75,193,
+129,98,198,17,140,20,138,8,226,219,105,98,227,1,25,9,93,33,10,129,164,21,25,90,
+50,161,93,92,53,165,133,6,217,76,24,217,85,74,88,198,136,44,134,212,162,140,59,18,
+13,36,9,54,77,170,48,19,66,85,148,31,167,241,150,166,255,149,23,29,173,250,139,198,
+188,185,242,116,243,218,224,249,27,166,49,203,81,94,106,34,162,85,25,80,196,168,179,141,
+221,161,182,104,66,184,138,11,32,179,122,200,96,184,202,130,34,196,24,170,11,8,140,91,
+116,56,106,235,42,56,230,85,211,69,153,74,26,189,156,29,91,99,85,21,93,40,115,77,
+101,154,11,131,134,59,165,112,180,69,117,142,107,42,46,159,139,94,206,115,158,58,167,107,
+138,185,54,246,53,101,22,208,163,59,83,111,8,166,196,43,16,8,148,99,46,166,108,144,
+112,96,134,96,147,94,140,58,1,125,175,181,237,227,152,211,216,86,118,144,74,22,198,116,
+29,215,230,58,118,19,243,243,145,138,5,133,100,111,194,231,25,35,29,47,73,225,137,146,
+72,84,185,249,107,56,217,99,35,7,44,205,50,98,199,77,36,250,83,92,234,224,183,156,
+206,58,188,105,70,180,56,47,139,172,168,234,198,208,168,164,229,59,91,180,134,211,22,56,
+105,189,108,224,194,219,95,44,48,194,55,121,81,56,105,163,73,85,5,22,44,84,56,182,
+44,121,221,199,45,72,176,12,106,43,104,99,58,213,28,106,59,203,197,168,128,131,104,4,
+89,83,108,18,9,202,64,126,244,169,203,189,92,229,103,171,140,205,176,174,222,21,51,90,
+213,56,166,242,218,186,12,49,81,1,221,210,184,195,77,20,97,70,74,245,107,130,148,89,
+43,89,82,163,91,104,80,168,134,101,187,18,4,66,97,217,38,59,23,38,9,180,193,80,
+96,22,85,254,84,166,45,36,56,80,97,137,242,184,136,214,177,154,40,248,242,113,137,59,
+17,3,207,40,81,2,140,189,185,53,52,199,86,84,163,21,73,109,158,30,29,93,101,119,
+150,86,26,102,91,235,101,145,5,136,162,102,236,172,201,82,140,149,153,187,150,154,196,154,
+69,20,65,73,18,150,33,0,225,27,179,17,0,136,49,74,32,47,178,133,53,225,203,23,
+30,217,29,60,245,224,140,101,27,18,22,147,38,196,89,144,73,109,48,88,165,238,211,53,
+112,81,84,172,182,133,73,148,170,34,5,208,121,108,118,109,194,218,57,211,147,5,21,173,
+85,227,117,26,141,84,208,48,9,44,209,32,230,100,77,83,162,24,67,237,160,38,34,150,
+92,9,6,196,17,9,222,196,136,136,163,6,10,146,16,102,204,242,120,188,212,53,78,26,
+129,117,181,90,104,66,118,52,115,40,90,13,164,217,97,52,172,4,67,222,242,38,152,78,
+204,210,80,77,50,102,165,80,88,167,5,165,111,209,118,234,40,119,105,19,191,92,121,248,
+239,220,233,151,135,187,46,20,196,213,205,235,182,182,236,166,153,112,81,227,84,205,13,10,
+51,11,65,203,136,109,152,227,173,253,206,205,64,205,236,214,184,238,235,232,191,169,228,239,
+247,126,94,143,27,118,208,242,19,202,92,28,6,181,74,71,46,56,139,225,208,152,209,10,
+49,106,137,150,163,104,189,242,162,229,42,179,10,133,182,143,246,139,249,168,63,135,79,205,
+117,29,254,126,155,114,178,122,97,116,148,208,69,147,100,122,66,110,24,21,134,173,5,135,
+139,40,234,211,77,198,170,26,109,204,174,45,56,243,222,133,52,241,244,97,124,184,197,47,
+204,115,223,183,124,12,85,101,5,21,123,132,44,148,65,100,18,156,101,153,180,191,69,171,
+192,6,104,69,137,31,127,53,147,68,98,22,36,44,17,129,74,244,11,80,3,74,162,73,
+9,2,130,34,99,4,35,2,36,227,12,151,7,23,43,151,41,75,174,115,31,159,158,56,
+9,116,214,208,20,156,235,209,168,109,220,82,21,39,71,127,177,229,219,142,39,61,156,240,
+237,134,208,215,101,65,96,216,174,103,176,191,150,126,83,26,195,69,145,193,163,16,208,100,
+76,43,2,69,155,70,196,61,20,94,196,56,33,22,209,35,161,117,8,9,179,247,233,12,
+130,77,179,107,214,1,148,220,204,51,97,213,9,202,253,247,168,248,119,87,205,104,116,221,
+81,176,110,93,137,4,27,19,181,51,187,232,91,4,131,8,30,16,143,182,150,9,192,32,
+58,9,161,120,69,18,219,170,10,132,145,33,5,100,179,56,24,139,69,32,105,95,108,94,
+242,77,220,8,1,211,139,175,14,28,150,64,38,193,131,115,108,155,88,77,228,58,41,194,
+118,131,62,126,202,138,163,124,160,218,30,52,168,27,145,170,139,151,236,92,30,51,156,182,
+206,64,197,84,8,147,108,137,212,127,149,253,85,239,108,72,56,198,162,166,11,4,53,48,
+118,246,213,252,95,13,103,34,166,102,207,38,13,58,72,230,35,240,94,248,68,155,209,196,
+241,20,12,224,144,194,55,139,145,14,28,157,17,229,80,205,193,179,32,16,71,68,18,54,
+253,4,9,227,123,17,222,42,47,183,229,107,109,243,152,215,9,157,146,55,89,112,240,153,
+173,238,224,19,177,180,157,245,26,175,238,78,110,172,9,0,144,36,146,125,35,115,38,125,
+153,127,70,141,59,158,80,98,85,137,24,38,92,70,233,142,42,28,10,148,205,64,158,85,
+228,142,18,66,66,136,172,76,84,81,137,24,138,184,150,194,20,246,117,84,155,188,76,85,
+129,102,247,120,10,4,1,4,96,163,136,55,68,1,55,65,77,17,122,45,178,25,69,166,
+201,130,19,180,138,24,212,12,19,72,220,92,59,229,18,42,3,34,38,34,168,146,204,60,
+182,23,24,172,85,240,112,104,219,4,65,118,119,154,119,37,194,114,29,212,18,68,155,81,
+17,153,117,70,234,156,187,76,226,99,101,182,191,139,154,219,87,126,31,29,252,47,84,59,
+179,90,193,49,113,148,135,57,207,61,156,217,194,35,57,32,36,128,25,132,68,36,138,181,
+43,204,185,243,53,40,92,205,75,80,138,73,105,57,39,77,234,2,20,43,72,85,30,213,
+241,190,158,72,174,103,51,54,8,32,65,0,130,128,71,125,212,16,113,54,13,144,77,134,
+215,112,68,95,120,172,86,134,164,98,208,65,131,114,37,45,91,105,82,218,229,161,88,116,
+185,152,23,233,249,110,158,55,241,101,99,124,127,51,31,240,250,237,140,14,112,211,8,30,
+187,244,6,33,159,66,193,225,4,9,6,85,145,34,56,101,197,242,108,88,34,136,177,137,
+24,162,42,44,136,177,136,34,90,81,20,233,206,116,98,177,112,165,83,212,194,163,50,129,
+106,141,81,25,80,67,214,225,131,87,194,100,236,149,236,130,37,79,220,247,126,119,234,47,
+249,188,223,174,113,215,219,205,112,57,93,142,34,192,148,17,68,88,65,1,17,150,212,95,
+33,146,46,147,73,82,170,170,136,137,61,73,81,20,84,22,109,149,71,54,95,36,210,243,
+126,255,226,185,174,187,104,40,136,197,51,77,81,227,71,60,113,193,195,182,85,135,219,249,
+114,103,243,95,111,39,225,242,93,173,178,158,101,246,50,224,250,156,118,106,99,131,75,106,
+23,45,115,45,200,95,168,134,34,229,19,213,113,56,186,114,143,163,151,38,181,162,229,166,
+76,27,102,45,151,11,84,21,24,173,165,6,218,140,202,84,84,92,74,196,98,136,131,21,
+4,84,17,136,36,88,49,80,85,21,65,186,202,101,89,52,220,74,10,138,34,130,197,8,
+138,72,130,9,33,160,33,54,44,109,208,137,4,244,42,10,130,21,83,142,208,226,114,227,
+165,165,52,185,153,219,51,73,171,218,215,180,81,65,16,56,81,118,96,170,118,180,229,44,
+225,44,193,184,216,112,196,181,141,74,37,18,229,104,84,90,230,26,201,99,82,193,246,183,
+123,51,20,51,48,112,40,213,171,101,99,14,90,51,45,22,205,56,40,229,27,88,206,25,
+151,172,3,76,88,179,74,139,182,98,183,44,214,168,229,175,170,210,57,77,181,88,42,224,
+165,165,181,19,179,43,230,154,96,187,180,52,140,182,109,48,197,53,133,156,218,193,116,134,
+61,221,38,162,10,8,218,91,171,48,92,44,148,45,141,42,49,242,106,162,174,119,254,77,
+124,164,90,73,63,96,160,72,28,31,178,69,2,48,190,126,110,58,241,126,151,146,250,175,
+212,17,163,81,103,175,181,59,94,56,245,236,189,233,223,157,25,109,77,37,138,164,45,176,
+119,74,24,208,225,22,92,161,113,226,184,168,188,188,225,180,214,232,67,133,102,153,85,156,
+50,24,14,181,99,150,18,162,197,81,173,52,154,113,19,86,85,85,96,140,85,128,165,180,
+138,10,68,69,146,176,172,93,37,69,136,197,24,138,10,4,88,185,92,184,53,184,209,68,
+82,10,222,117,173,42,140,93,38,242,253,155,85,84,88,49,53,26,205,227,151,10,168,141,
+222,76,203,229,129,69,7,157,223,120,148,120,76,193,53,144,8,207,210,47,19,69,196,131,
+196,119,15,185,17,26,5,187,142,2,240,226,39,19,208,240,151,45,68,106,27,76,114,47,
+90,184,107,190,23,232,186,49,37,101,82,165,156,216,208,196,231,44,76,176,88,179,86,222,
+46,253,186,186,214,41,155,213,215,27,172,102,219,133,162,197,38,57,134,97,150,230,22,75,
+171,122,176,85,46,196,112,81,12,20,162,232,36,188,113,29,51,142,38,20,97,65,8,103,
+43,27,83,178,37,228,60,23,15,49,107,9,148,100,102,80,136,57,86,38,149,152,36,35,
+107,222,42,164,130,10,12,59,50,172,82,69,17,149,107,134,117,27,125,31,196,213,124,126,
+124,235,114,183,161,209,110,97,103,145,81,107,208,164,202,5,205,35,38,221,12,152,48,126,
+74,248,252,159,183,127,20,170,178,243,45,5,3,18,230,64,70,210,13,171,230,231,87,154,
+32,129,252,54,122,69,163,93,190,168,131,185,21,55,113,59,58,45,151,53,133,77,82,245,
+227,132,209,161,17,225,157,156,38,203,80,180,211,12,92,250,110,30,155,68,17,138,136,32,
+170,233,162,205,210,163,12,76,112,113,40,170,197,136,138,42,49,107,37,88,162,172,85,71,
+41,84,147,25,78,174,101,175,173,205,186,12,162,138,38,124,226,126,100,55,33,254,171,136,
+253,47,239,27,109,107,155,74,218,34,1,3,131,111,83,27,94,220,31,80,235,52,199,157,
+76,50,218,106,200,98,10,24,33,166,76,100,138,67,50,224,172,109,44,71,173,211,22,72,
+44,22,34,114,201,89,194,70,173,0,82,44,39,169,49,50,42,170,63,98,146,229,43,1,
+17,72,176,5,65,80,88,176,82,49,8,164,130,144,225,183,14,51,80,233,243,222,176,99,
+44,74,137,75,43,89,66,218,146,219,5,4,74,156,161,83,25,90,170,168,196,84,221,191,
+51,0,227,102,228,161,243,182,236,180,157,181,240,79,226,185,123,243,137,140,132,12,161,248,
+124,162,101,47,224,55,215,110,136,84,108,176,118,6,214,234,253,101,224,109,113,123,230,234,
+101,70,92,218,0,191,57,133,209,189,245,190,239,99,167,150,84,50,217,45,184,143,67,107,
+109,65,215,123,161,81,219,189,157,46,175,5,236,157,245,46,247,152,234,52,65,85,52,111,
+191,92,111,133,58,98,201,81,69,123,55,148,151,58,235,90,73,192,182,244,5,147,133,120,
+132,7,236,94,90,218,114,246,213,155,10,101,192,159,130,222,46,237,189,138,72,11,144,44,
+11,150,173,124,107,83,20,83,12,148,182,223,33,79,47,147,183,6,147,175,5,22,27,77,
+72,52,155,22,5,139,102,10,156,222,207,69,108,24,217,49,58,86,202,184,209,214,103,130,
+211,163,127,159,236,235,226,219,232,123,152,140,22,133,129,231,188,152,201,100,30,91,100,97,
+32,36,131,60,190,215,131,214,191,93,238,158,23,32,192,145,214,231,89,103,150,50,30,3,
+143,247,95,196,165,248,135,167,149,253,87,127,16,97,76,15,70,48,140,0,81,145,210,165,
+31,3,240,126,227,6,214,239,252,174,203,186,74,174,46,158,132,243,48,231,228,113,225,44,
+134,155,182,34,154,72,234,244,71,59,114,61,13,128,131,200,152,41,167,95,173,253,195,156,
+225,141,167,30,231,93,61,158,221,233,190,66,195,92,85,58,91,116,90,164,34,193,65,65,
+174,140,146,84,44,65,101,25,70,66,229,11,23,41,20,168,178,161,43,5,139,33,109,32,
+170,73,82,42,192,81,18,176,88,88,168,196,144,106,159,117,152,136,46,249,166,231,242,58,
+223,227,118,199,199,173,241,208,170,175,39,124,46,140,120,223,119,105,215,50,24,197,49,52,
+205,234,196,81,85,92,101,149,147,69,204,61,72,124,12,107,18,244,32,27,35,29,170,182,
+173,128,172,43,65,202,80,163,50,54,138,162,236,110,84,32,176,100,67,49,25,76,192,70,
+26,64,217,37,124,34,43,89,198,78,109,85,48,53,148,5,27,171,45,104,48,74,181,136,
+110,115,130,48,48,82,200,45,182,21,236,114,19,140,198,84,180,78,59,23,19,136,189,163,
+9,33,170,247,125,62,186,251,184,198,195,157,249,224,37,132,16,66,215,69,107,229,116,206,
+69,97,9,176,128,141,210,249,210,102,16,20,131,34,208,68,61,100,74,190,55,63,209,207,
+12,245,235,218,51,228,68,140,148,123,246,44,20,89,133,75,125,66,170,77,18,72,96,217,
+2,101,222,20,116,202,227,88,233,40,8,204,107,88,182,150,22,216,34,196,22,21,42,125,
+187,88,233,235,139,198,195,226,214,253,117,79,95,92,204,180,53,213,198,10,42,49,24,41,
+82,44,122,204,197,229,211,194,15,209,198,180,195,211,215,99,174,2,246,170,6,34,144,42,
+21,40,43,205,185,106,75,57,78,205,77,247,35,133,144,206,39,37,2,148,104,239,3,97,
+59,32,88,68,146,17,0,236,155,23,135,10,204,95,3,108,90,54,214,218,184,36,26,177,
+25,111,109,147,202,14,213,53,54,63,86,248,25,35,21,147,16,193,209,182,141,157,36,171,
+107,56,106,12,146,46,108,198,182,161,246,59,86,134,231,27,198,210,214,54,146,55,53,202,
+163,89,20,201,17,130,48,39,20,94,226,99,92,12,201,162,80,149,59,105,125,218,85,190,
+219,103,81,78,97,92,233,95,107,92,16,59,104,185,101,157,147,150,160,60,113,174,51,58,
+242,222,250,98,181,47,81,103,71,79,108,179,144,86,10,88,193,5,44,43,54,130,4,16,
+183,107,50,190,239,101,184,206,219,17,149,177,129,10,9,0,130,40,137,1,12,234,227,29,
+189,53,231,200,233,92,74,56,183,84,137,38,76,105,81,6,219,242,185,82,32,54,87,63,
+158,113,10,23,109,178,115,146,217,4,232,178,193,69,98,19,155,112,156,97,187,22,144,36,
+216,92,54,56,112,24,39,88,35,2,160,220,26,41,38,208,74,211,80,252,102,246,190,115,
+124,25,63,9,172,206,202,202,136,130,210,73,4,84,237,198,216,115,91,101,208,185,171,139,
+177,22,44,230,50,29,72,59,22,149,162,170,238,232,139,131,87,72,164,205,149,252,109,123,
+237,161,181,208,147,32,96,139,103,88,40,250,45,218,120,198,172,70,138,184,9,43,70,73,
+193,76,233,100,247,172,237,165,163,86,40,50,73,0,134,77,136,202,4,131,161,162,117,129,
+245,254,184,55,231,125,232,45,216,5,166,73,100,22,247,139,40,68,111,9,54,92,204,206,
+246,217,239,195,56,67,126,60,179,171,110,9,0,157,205,130,67,165,84,27,86,23,195,219,
+232,227,60,115,121,170,101,11,23,6,205,82,216,147,132,129,17,203,12,217,4,132,168,99,
+141,78,212,20,94,173,49,45,124,186,98,34,81,32,229,109,93,114,237,115,97,24,40,145,
+187,124,198,90,203,83,41,144,21,136,60,3,108,85,141,239,124,49,48,176,85,144,216,187,
+16,73,183,82,134,14,180,49,235,246,254,210,192,28,79,224,210,28,218,20,242,28,50,200,
+69,18,9,59,78,219,135,56,248,246,21,67,219,251,154,183,173,255,50,182,242,61,15,47,
+28,43,116,163,103,44,162,194,137,245,253,15,229,199,179,132,68,161,175,11,98,3,146,16,
+5,141,246,118,142,32,53,175,151,236,17,154,221,33,162,115,100,79,67,101,96,202,16,66,
+37,149,106,149,243,101,29,35,206,50,241,227,210,188,154,230,114,192,43,78,153,110,60,241,
+242,64,163,72,158,158,108,94,16,36,144,64,191,211,172,118,43,53,120,219,28,177,122,230,
+119,196,85,39,136,229,65,130,54,224,140,216,130,28,222,41,171,94,129,4,18,77,33,185,
+184,112,5,205,240,221,221,215,166,218,26,220,217,104,230,249,94,221,161,223,244,85,227,182,
+221,14,80,91,83,68,65,37,14,154,125,148,111,218,113,93,99,49,202,235,184,73,18,140,
+108,9,21,2,130,171,48,72,37,18,124,208,196,236,215,30,91,229,149,176,149,131,162,151,
+225,123,46,112,154,3,34,32,97,28,96,200,94,101,218,183,169,137,91,28,98,200,198,76,
+92,188,138,149,29,200,92,84,136,198,19,7,9,11,132,20,53,126,157,43,140,239,182,248,
+48,86,232,1,122,110,220,19,104,217,187,98,183,6,250,66,173,181,213,158,214,72,20,37,
+57,203,91,25,81,78,163,75,167,89,129,66,10,70,212,58,43,44,105,186,214,191,67,111,
+107,172,225,46,183,195,32,147,3,4,27,65,29,49,139,10,185,7,114,155,86,20,183,121,
+250,174,16,109,97,61,246,206,69,65,134,207,206,231,221,82,35,17,35,76,105,39,169,226,
+137,98,3,70,27,225,27,162,61,33,171,246,218,17,214,13,129,207,91,80,72,108,232,222,
+247,131,177,205,234,184,247,230,68,236,50,64,16,114,24,121,212,41,61,47,126,51,198,255,
+76,235,43,86,206,242,37,66,152,61,58,158,90,144,68,68,72,102,116,233,130,109,149,210,
+139,44,33,35,133,157,155,226,235,44,145,77,107,34,4,48,134,143,42,135,87,42,211,229,
+58,236,118,239,140,70,123,122,88,205,62,77,204,7,82,105,77,18,52,88,253,26,173,3,
+174,46,39,211,173,239,197,34,118,230,99,65,101,87,167,146,140,41,23,187,149,16,34,71,
+65,214,247,60,11,166,151,59,253,46,71,53,180,64,65,110,83,10,92,176,81,141,140,49,
+181,239,168,198,231,33,78,239,57,253,181,7,63,94,114,118,141,209,190,182,203,182,38,233,
+3,97,183,131,85,19,134,134,102,98,209,10,33,171,84,234,148,244,243,199,75,203,87,142,
+54,15,131,53,173,160,44,98,172,178,68,230,250,197,150,110,49,137,55,81,34,83,57,87,
+137,202,155,221,94,1,213,94,49,109,122,63,74,198,227,107,230,242,78,218,93,11,233,1,
+16,73,233,118,36,138,214,220,250,185,29,20,176,57,221,35,15,24,141,250,204,193,203,117,
+53,188,50,34,247,203,16,48,47,10,56,115,242,172,58,184,36,38,70,158,155,65,138,12,
+33,8,217,22,93,29,48,21,33,242,73,221,88,150,73,34,15,233,39,174,219,113,141,183,
+86,78,243,223,112,56,222,70,115,54,104,104,141,101,24,66,82,54,190,212,48,111,122,235,
+34,39,50,5,70,67,12,16,149,164,147,236,125,100,109,42,146,148,20,16,177,47,175,189,
+154,210,112,211,34,121,188,154,164,218,101,222,37,94,230,106,107,116,163,119,170,104,71,66,
+81,182,56,107,12,98,237,171,236,226,143,30,141,207,175,246,60,179,199,55,197,236,134,20,
+145,103,197,197,166,77,62,76,189,204,57,207,3,182,221,92,109,169,139,82,206,103,90,195,
+74,68,29,220,202,11,82,20,70,10,108,106,99,10,40,48,92,181,43,198,170,104,42,8,
+233,148,113,42,65,96,184,213,104,197,82,219,50,149,61,246,171,53,106,64,17,41,24,36,
+35,6,13,131,2,75,200,215,185,255,183,182,140,29,118,199,75,173,180,172,207,87,201,26,
+98,226,156,220,174,58,62,29,120,206,77,143,13,22,213,163,82,149,151,41,83,16,170,130,
+145,84,86,42,95,85,129,140,10,213,24,42,172,21,169,91,100,172,50,222,24,85,6,44,
+210,20,85,97,237,182,99,17,90,181,45,180,241,147,12,17,14,45,152,169,101,156,119,120,
+82,36,138,109,147,247,18,2,228,175,63,237,150,13,242,213,221,198,231,31,165,142,35,164,
+215,167,54,247,110,168,148,134,219,162,8,218,165,67,48,234,98,166,64,73,45,54,1,44,
+163,4,113,231,153,164,206,110,33,137,194,86,77,234,154,109,167,169,133,65,96,187,72,85,
+117,99,101,84,96,160,241,97,89,154,204,182,204,111,197,102,101,16,46,172,193,4,196,39,
+95,147,248,159,137,191,94,152,17,211,91,113,218,57,125,101,164,128,32,146,22,51,211,29,
+90,162,197,90,130,202,143,94,156,205,170,81,139,11,171,49,34,82,147,5,95,181,241,119,
+237,215,7,106,243,157,138,83,71,103,98,230,179,122,130,66,40,164,43,104,14,166,155,37,
+152,13,90,147,19,9,37,126,127,12,223,131,86,206,197,29,37,164,16,122,139,67,88,176,
+61,102,8,204,43,229,226,176,75,21,40,65,129,150,199,181,168,84,214,37,115,133,14,179,
+92,114,59,13,43,39,9,108,148,94,41,193,214,204,214,205,245,172,124,236,52,156,50,10,
+40,70,218,202,151,69,133,222,92,38,146,18,160,98,74,128,178,165,64,163,35,108,132,16,
+136,70,198,196,89,20,109,5,145,46,251,172,103,215,27,214,236,131,140,115,182,209,28,112,
+34,204,111,40,94,55,134,12,80,198,10,10,42,195,77,68,173,196,117,67,122,163,24,238,
+218,50,181,124,108,187,231,191,100,225,56,59,121,61,101,239,105,83,190,80,68,138,35,23,
+198,105,113,42,8,107,191,107,199,62,49,25,140,233,152,36,181,178,178,176,80,42,86,218,
+44,68,36,19,128,138,156,38,32,218,32,10,161,193,214,120,136,18,70,137,182,146,71,65,
+12,219,3,10,46,5,198,41,162,209,69,27,32,113,111,43,253,213,246,58,231,22,182,77,
+134,50,14,238,8,2,39,216,179,239,210,33,32,79,131,107,3,71,169,41,86,145,114,144,
+115,39,127,15,235,254,163,87,205,167,113,62,47,87,111,75,60,125,251,189,61,64,176,152,
+68,56,110,32,243,64,164,68,0,204,148,19,72,52,243,251,111,102,181,49,7,145,147,199,
+90,237,13,115,112,65,202,93,82,103,22,161,142,38,75,153,9,154,161,174,253,243,76,155,
+65,24,28,34,133,67,24,99,137,9,89,4,64,172,172,175,41,57,116,38,210,187,64,172,
+204,149,100,204,166,139,105,124,49,135,121,162,197,119,137,156,133,95,148,189,41,17,178,148,
+139,216,176,217,64,51,1,64,232,184,93,186,19,86,87,20,175,211,126,94,56,45,149,57,
+109,126,171,207,109,30,31,75,60,29,119,94,112,40,171,50,121,245,123,161,234,249,251,247,
+124,74,108,172,182,242,209,60,147,79,119,50,249,51,201,13,111,53,145,71,5,234,30,126,
+171,219,176,197,91,70,178,10,176,181,44,144,149,178,27,4,65,4,106,112,55,222,111,107,
+171,203,116,33,18,198,143,19,233,6,59,199,159,134,236,51,24,148,46,237,202,94,166,119,
+207,11,137,247,72,236,196,67,11,163,156,29,95,111,242,212,16,186,204,178,199,97,11,178,
+156,189,17,249,187,227,23,123,232,125,182,211,83,53,174,229,114,179,60,66,2,0,180,226,
+96,17,1,48,246,123,217,124,38,149,132,216,91,52,149,46,174,36,89,5,133,104,132,70,
+7,193,12,221,186,177,185,251,167,150,220,231,198,178,99,47,50,181,167,174,241,149,52,244,
+156,97,83,81,211,136,126,19,229,156,91,227,171,161,58,202,100,180,204,182,216,87,6,139,
+23,142,190,70,239,61,7,214,236,228,125,251,243,83,189,90,248,19,196,168,129,0,180,9,
+214,213,158,113,128,68,11,151,100,47,58,34,141,34,64,161,155,178,35,42,82,50,73,10,
+2,70,242,49,60,34,132,216,91,96,55,180,224,15,107,37,140,97,8,199,65,222,122,194,
+202,120,99,43,223,175,205,249,57,217,109,208,246,99,156,48,205,218,243,249,235,187,74,81,
+49,186,131,208,56,94,63,113,254,73,110,159,12,161,125,15,142,223,168,100,68,202,123,81,
+113,145,25,89,68,227,73,68,79,75,2,8,4,216,18,4,195,136,129,217,73,165,68,49,
+74,12,30,10,13,41,251,144,31,205,42,78,91,197,190,44,90,92,222,0,130,2,36,130,
+145,16,13,169,4,99,141,185,119,50,144,3,7,135,131,146,188,183,233,156,227,116,241,222,
+72,227,113,32,29,136,36,111,110,215,29,58,92,109,89,153,52,244,193,222,0,71,30,238,
+125,8,188,29,184,230,183,190,230,225,4,145,187,74,254,156,173,16,150,111,23,18,23,168,
+153,190,26,109,69,230,181,212,141,188,220,239,122,56,17,90,157,203,111,210,230,102,50,174,
+169,67,74,103,160,86,101,27,24,151,16,68,155,62,230,140,35,5,36,70,111,194,205,91,
+18,172,9,38,174,136,37,153,243,161,153,71,0,220,164,42,140,243,220,248,156,96,227,101,
+175,102,6,65,198,55,67,126,105,138,81,118,250,94,238,227,167,33,180,9,245,89,142,163,
+113,23,93,53,113,83,58,189,252,213,248,49,158,151,218,45,177,176,129,182,197,245,194,142,
+207,120,22,209,4,219,0,121,30,247,169,221,140,81,135,101,160,131,106,51,242,231,91,243,
+141,89,133,26,216,115,114,151,5,222,141,248,197,96,212,104,70,86,64,151,220,237,139,222,
+49,142,236,118,185,187,185,16,210,168,227,88,165,88,192,83,51,182,13,141,158,222,141,121,
+66,149,200,173,34,165,197,184,236,32,36,231,18,51,34,12,32,5,197,59,119,171,248,192,
+186,13,246,145,83,158,154,27,137,185,161,182,98,133,65,220,214,207,144,110,46,13,202,49,
+62,135,0,241,172,138,197,177,105,191,59,147,129,181,228,209,235,182,195,70,8,37,89,21,
+116,221,137,32,16,107,104,136,92,182,25,129,28,25,240,102,170,162,43,27,95,21,157,39,
+136,221,149,109,160,42,177,68,32,178,109,182,58,81,178,2,178,11,18,139,38,143,155,181,
+123,119,152,55,184,63,107,34,222,54,156,109,215,161,141,22,51,126,157,162,226,81,4,54,
+139,28,111,214,43,189,100,197,165,91,7,110,113,90,246,227,172,96,23,225,134,8,181,206,
+135,182,84,208,165,216,129,115,9,18,72,49,191,190,64,137,1,18,70,11,244,119,133,104,
+144,242,81,240,218,215,187,183,151,157,187,154,25,79,204,96,94,24,155,117,116,124,170,136,
+223,140,13,29,120,208,205,215,52,247,190,179,190,105,11,237,94,63,28,214,70,175,181,182,
+12,153,34,67,56,223,226,247,184,93,181,192,142,116,198,202,55,120,237,14,48,71,84,49,
+98,8,239,41,77,245,219,223,229,85,146,13,177,229,10,123,246,159,109,198,48,74,64,221,
+97,15,148,193,102,213,27,97,126,203,102,10,252,217,70,240,102,151,213,236,189,181,189,62,
+83,205,23,146,24,144,168,114,130,36,26,131,124,155,136,145,230,16,56,159,233,233,5,186,
+12,128,33,2,165,42,183,97,126,118,192,237,121,41,118,99,105,48,218,251,245,222,100,101,
+250,72,30,120,181,84,32,236,111,12,102,114,154,28,172,40,196,19,239,41,36,36,35,1,
+17,107,209,32,128,140,227,37,89,37,251,173,233,242,65,103,22,16,154,200,40,64,101,21,
+158,73,55,192,159,5,232,80,164,45,193,242,192,157,174,173,175,178,98,73,130,32,44,193,
+105,57,33,89,156,203,150,75,148,156,72,230,182,141,202,97,226,136,179,83,195,170,86,116,
+91,144,125,109,157,119,84,238,249,237,140,100,251,200,60,176,156,9,228,197,5,5,48,178,
+63,149,139,196,139,124,28,176,49,55,25,132,65,126,47,125,75,176,86,13,140,66,22,93,
+119,69,228,36,227,9,24,175,205,219,123,96,26,203,158,17,84,29,55,118,53,207,217,232,
+73,66,35,205,153,18,150,4,194,27,152,115,101,54,125,43,217,235,193,180,204,233,38,239,
+190,86,218,247,174,7,21,8,183,89,62,125,70,82,121,152,34,129,68,18,41,154,174,62,
+67,14,206,1,226,4,64,131,89,37,185,203,115,166,21,194,139,22,152,124,187,86,77,140,
+97,112,181,38,150,27,227,1,5,56,248,22,54,25,228,118,173,134,204,46,114,140,90,210,
+109,142,23,55,87,64,186,55,57,220,114,229,213,149,48,195,74,144,59,194,126,215,175,179,
+72,161,55,228,216,236,75,146,238,169,214,104,100,92,47,60,98,253,30,195,108,14,199,77,
+150,22,196,149,70,79,116,103,123,178,116,186,34,216,41,167,147,205,237,198,200,49,244,189,
+155,171,163,180,211,73,8,233,123,231,216,245,165,153,190,14,145,46,186,205,79,85,2,91,
+91,233,84,121,211,157,10,104,104,109,20,54,44,208,231,85,221,116,60,183,35,196,98,135,
+165,224,65,1,119,75,232,215,34,113,206,57,139,213,104,232,137,190,134,162,75,83,45,64,
+163,59,93,179,85,183,164,185,58,251,195,81,125,177,235,219,113,53,165,190,152,103,156,239,
+142,156,215,11,107,204,111,123,223,69,8,90,115,144,129,33,190,164,108,190,135,54,233,194,
+205,199,74,247,23,119,238,52,228,119,246,169,4,117,194,1,155,10,217,123,76,71,52,130,
+233,218,189,187,34,76,43,137,86,55,1,25,88,33,122,115,49,198,211,16,53,140,135,201,
+3,181,47,46,252,14,78,51,67,120,146,224,130,73,153,140,82,188,182,6,255,139,151,238,
+173,8,164,135,52,141,137,1,75,136,101,20,100,236,109,32,197,170,141,172,51,44,136,86,
+49,100,31,226,254,9,121,231,62,204,21,19,182,132,18,124,122,121,197,108,181,221,65,202,
+214,41,73,186,102,90,246,182,118,189,0,192,35,19,46,44,108,8,36,20,98,199,11,14,
+29,34,189,83,78,211,41,219,117,235,213,215,99,125,175,27,78,225,189,110,169,218,152,203,
+129,189,234,25,24,119,180,88,181,104,88,168,216,217,18,8,48,96,48,140,126,118,124,174,
+63,118,213,248,92,15,92,94,185,230,252,216,132,135,0,233,81,158,132,211,154,66,138,243,
+223,12,226,133,136,104,182,131,114,152,99,108,13,141,142,80,97,230,116,211,21,147,196,125,
+239,229,98,245,52,126,152,143,146,163,60,141,158,227,142,153,193,227,57,69,211,30,180,110,
+100,226,208,185,76,69,90,242,154,137,26,210,242,203,138,109,193,198,60,165,155,177,99,189,
+235,84,53,170,58,191,113,111,232,126,199,211,236,214,192,209,207,142,87,6,10,28,82,102,
+219,178,66,73,190,107,24,72,200,44,246,104,86,30,85,152,35,31,62,189,207,59,103,27,
+236,155,41,144,200,24,212,180,213,172,102,44,193,29,70,234,161,214,183,179,102,239,137,229,
+239,176,210,167,73,211,230,157,110,130,138,238,226,76,109,162,144,85,138,109,13,101,49,169,
+88,74,168,18,138,32,89,146,109,124,239,155,251,253,244,224,235,58,211,130,1,100,136,132,
+55,32,21,6,2,142,219,140,172,98,141,69,139,34,215,48,174,83,199,158,247,219,123,239,
+190,157,128,209,75,12,32,108,108,145,167,177,201,4,19,183,222,233,156,155,100,160,149,219,
+34,228,40,132,201,36,32,97,12,88,161,223,190,56,233,163,186,4,108,144,41,34,66,68,
+91,232,231,175,128,73,23,189,193,23,65,244,113,196,214,209,204,104,140,216,16,65,39,19,
+13,54,168,144,173,98,148,19,58,34,29,140,41,147,66,94,168,247,49,188,199,104,182,89,
+78,77,38,8,148,217,223,214,89,43,70,28,34,32,41,166,86,76,98,149,42,5,98,144,
+210,64,211,229,231,187,184,113,144,172,68,47,54,162,156,48,80,20,88,164,169,68,83,155,
+115,46,2,158,148,243,60,123,254,126,254,149,235,47,127,12,41,187,188,166,71,179,71,109,
+19,105,227,87,35,151,91,214,106,230,42,111,16,102,222,189,71,92,108,144,190,53,209,70,
+165,9,104,196,38,128,208,175,62,171,57,200,4,28,5,96,74,178,68,96,99,192,54,239,
+142,242,81,198,13,137,16,142,240,220,177,170,228,135,68,230,170,86,198,215,23,30,183,188,
+76,221,169,67,17,24,156,243,249,237,83,56,51,206,127,106,200,16,65,232,241,68,80,204,
+19,170,119,110,239,92,83,79,179,114,166,152,86,11,34,242,194,170,72,178,5,100,225,219,
+234,117,186,154,119,112,102,28,243,196,116,83,19,255,197,67,151,73,82,179,65,67,104,134,
+66,34,200,132,45,61,99,138,67,131,114,5,27,64,33,155,27,146,141,221,149,33,32,119,
+233,246,93,52,54,25,25,75,4,29,146,184,170,249,235,106,248,235,210,221,8,214,189,107,
+160,247,115,192,28,91,116,243,202,118,210,90,77,243,51,17,121,20,95,227,112,129,56,129,
+60,2,204,164,70,0,93,69,66,11,205,165,60,173,9,120,240,72,224,119,215,110,182,158,
+134,54,216,63,42,92,31,15,72,10,248,173,171,193,45,43,189,177,168,58,127,105,32,184,
+79,81,4,66,252,214,164,80,20,22,11,9,82,157,123,255,91,149,222,236,28,181,17,69,
+6,39,41,95,159,225,179,135,62,165,115,140,69,179,140,101,200,253,93,83,131,133,49,38,
+85,16,96,163,227,29,120,202,214,190,1,71,206,96,145,177,219,135,186,216,113,115,145,128,
+195,132,148,52,152,167,78,93,8,216,40,102,132,251,40,104,177,54,3,32,44,249,118,42,
+70,75,125,39,194,238,229,16,130,170,170,204,70,97,167,140,110,91,33,106,229,226,240,120,
+24,136,101,247,77,201,122,6,28,48,161,20,33,118,149,234,215,11,77,120,11,222,39,53,
+236,214,251,227,129,52,59,21,97,65,11,67,178,103,228,236,61,125,4,95,217,34,215,127,
+75,18,136,162,34,153,74,134,168,215,143,6,244,179,54,230,70,56,233,186,212,41,104,51,
+102,8,68,217,6,88,117,229,241,226,78,66,22,162,9,62,236,38,130,239,115,102,200,52,
+60,17,7,153,139,35,199,147,236,39,2,5,99,102,58,91,100,230,31,147,165,136,158,76,
+186,135,75,193,165,107,75,93,39,28,18,165,110,74,235,112,230,71,98,18,162,55,66,152,
+206,15,39,208,156,228,243,22,254,30,109,29,209,8,149,176,209,108,25,98,173,80,29,181,
+83,61,32,155,19,224,70,216,19,145,155,137,164,24,160,138,8,177,156,176,183,147,158,254,
+211,180,235,164,53,151,142,185,248,238,111,128,182,121,251,222,250,19,100,146,173,171,223,88,
+149,241,133,98,153,76,247,216,105,144,95,145,49,89,65,198,114,33,6,45,149,217,221,109,
+180,236,111,111,189,188,120,252,187,246,35,167,143,36,73,101,187,81,244,42,194,10,0,185,
+75,34,160,229,0,45,122,63,154,46,82,187,105,100,70,221,112,114,171,41,101,178,117,143,
+213,44,242,245,177,23,178,6,213,16,117,118,148,125,84,203,247,119,241,229,73,30,225,30,
+172,50,64,100,171,120,239,98,64,36,162,77,252,162,159,81,204,121,67,17,107,173,187,126,
+23,215,3,180,164,32,96,44,79,139,218,44,219,118,57,223,2,54,142,27,66,235,31,27,
+88,76,188,45,225,92,77,155,137,196,138,131,4,123,106,150,183,139,206,14,202,55,97,91,
+219,92,94,186,247,230,227,17,227,136,75,71,112,93,219,9,110,116,197,226,204,157,5,9,
+185,73,25,65,35,156,202,202,98,26,76,20,83,24,21,231,122,90,42,228,42,142,124,48,
+14,156,239,170,180,37,201,129,82,219,120,96,240,252,10,23,11,73,146,32,217,182,185,79,
+39,153,200,201,208,16,52,230,60,31,99,163,72,140,216,68,203,197,115,64,154,26,226,130,
+220,213,168,224,98,66,182,227,106,25,90,109,109,187,238,197,108,113,225,8,94,67,25,139,
+139,137,180,147,199,156,142,114,180,69,202,55,199,26,129,36,77,216,169,247,106,92,24,242,
+160,13,77,237,186,222,183,212,50,165,165,113,209,77,55,44,213,164,134,91,65,86,161,208,
+140,31,150,83,132,62,135,164,14,187,81,217,11,145,168,81,217,117,197,184,205,245,167,124,
+236,237,147,148,52,67,4,130,99,32,71,13,156,229,37,49,104,210,163,107,112,108,154,184,
+32,72,217,7,12,249,162,183,94,100,110,39,157,80,96,10,89,24,44,26,26,26,208,208,
+82,167,110,186,72,60,95,158,218,182,202,136,85,151,133,181,38,215,240,229,41,99,67,117,
+136,136,165,223,212,222,214,176,152,37,132,18,36,215,209,176,199,33,59,94,163,61,225,219,
+212,43,91,166,80,32,210,124,55,39,13,105,190,45,164,169,76,183,75,247,103,140,179,208,
+228,65,228,38,74,72,194,236,181,240,17,54,181,20,35,244,83,237,61,40,87,98,248,223,
+62,204,103,219,209,60,212,215,30,215,141,235,31,47,111,178,117,132,172,137,194,135,46,104,
+32,39,173,87,199,23,53,215,44,158,183,27,78,187,184,50,241,138,35,78,90,94,215,144,
+151,15,57,175,63,159,215,115,223,159,58,196,87,125,97,159,11,5,216,35,218,5,72,233,
+34,157,148,161,218,19,129,98,247,231,34,122,203,46,77,70,202,244,177,8,172,78,255,70,
+206,97,17,112,119,81,237,53,59,3,131,205,27,50,125,216,140,204,96,140,220,113,112,222,
+250,107,221,86,142,81,213,5,48,237,232,129,127,115,174,33,249,144,50,33,181,200,132,47,
+31,15,79,59,213,210,105,15,101,210,241,82,35,83,11,216,111,234,178,49,63,204,110,188,
+230,218,54,58,177,8,19,106,212,78,197,118,251,170,67,82,9,105,175,112,233,232,106,233,
+211,5,143,28,57,90,27,213,123,86,0,175,230,158,98,112,25,41,188,243,150,190,196,45,
+136,202,48,97,198,5,139,108,109,164,112,181,165,153,20,117,8,152,222,215,115,221,204,143,
+240,62,225,125,226,212,223,125,73,29,126,100,55,41,133,202,38,176,166,67,166,148,207,115,
+132,51,63,145,134,40,219,136,182,180,94,134,68,20,208,175,217,70,7,207,219,203,248,143,
+121,20,36,124,102,161,73,188,56,60,29,251,180,237,242,172,116,24,81,159,18,19,176,220,
+140,166,123,193,36,45,106,11,95,0,140,207,183,40,88,30,248,62,17,108,156,164,22,176,
+27,218,251,106,176,91,142,40,244,239,20,149,102,230,133,43,137,108,115,222,123,54,102,35,
+73,21,142,219,44,165,86,214,229,230,193,246,234,70,19,35,170,177,70,42,47,44,215,30,
+123,155,18,176,152,28,35,102,245,93,222,97,68,116,50,226,96,16,68,159,225,230,52,64,
+30,210,236,108,48,150,122,104,24,214,189,220,100,251,163,190,216,2,26,31,61,186,211,17,
+105,146,6,174,137,5,47,111,153,244,252,72,179,32,102,247,209,239,176,243,97,118,160,141,
+133,216,228,169,89,195,43,175,204,251,141,107,93,248,235,211,116,161,229,123,162,117,81,213,
+12,241,44,49,14,200,154,244,39,252,156,118,231,191,105,103,52,182,104,195,76,148,80,73,
+0,72,193,177,6,115,12,3,42,18,137,232,255,190,62,81,35,193,238,239,111,99,90,239,
+213,53,146,216,227,225,210,179,164,212,47,204,83,21,225,119,183,22,33,25,156,181,38,190,
+214,116,198,185,205,224,141,211,213,57,1,160,32,176,244,78,226,10,131,97,16,219,251,223,
+75,102,171,108,44,45,157,64,92,234,131,139,229,92,70,212,224,65,68,5,32,132,21,141,
+155,73,56,112,92,106,11,136,179,146,143,4,218,230,177,134,33,77,215,140,195,10,209,120,
+203,70,24,130,201,241,123,247,174,42,119,199,154,157,53,138,199,165,172,124,190,191,151,65,
+199,87,209,113,236,42,88,157,88,157,122,190,62,58,227,203,91,153,142,6,219,184,103,11,
+70,194,136,144,69,176,17,59,31,155,244,30,205,241,190,214,103,125,137,37,71,50,122,69,
+238,240,121,167,16,225,231,207,232,195,24,35,219,101,204,246,156,238,75,179,136,181,72,133,
+163,70,239,214,190,19,176,241,244,120,27,218,228,112,122,226,203,238,116,189,19,210,112,111,
+96,202,220,48,139,131,54,32,236,203,199,55,40,159,203,240,82,4,67,27,95,19,70,3,
+160,48,52,44,47,221,38,135,114,237,230,122,183,134,34,160,234,133,66,44,138,10,18,135,
+167,43,22,6,38,172,166,53,98,195,235,245,223,206,114,114,48,229,146,44,57,180,104,38,
+166,168,136,129,2,9,128,145,4,27,17,66,171,127,109,198,12,12,89,2,108,206,24,184,
+206,5,118,39,11,12,146,17,68,172,95,71,121,182,241,121,103,225,236,123,9,157,38,58,
+20,158,188,154,173,252,219,85,237,120,159,149,222,23,202,176,194,88,248,121,176,126,28,249,
+230,26,166,148,51,83,34,34,5,4,95,122,90,149,134,135,216,232,112,63,75,232,249,57,
+227,44,247,37,103,46,154,45,187,189,140,138,72,22,104,138,74,200,36,135,167,182,251,119,
+89,206,114,224,134,11,57,109,76,112,85,89,25,166,185,114,60,74,16,64,55,111,67,22,
+196,69,16,113,34,103,38,161,43,121,85,194,3,8,231,87,82,195,21,120,56,89,114,49,
+69,240,178,93,114,39,176,251,253,248,211,147,102,167,55,247,189,191,143,248,255,129,248,159,
+31,194,34,190,239,109,196,78,135,236,180,205,122,243,90,7,129,170,197,83,86,160,138,138,
+77,51,229,203,111,182,226,204,41,197,217,107,171,10,197,168,169,164,89,82,137,147,227,102,
+193,119,96,233,86,109,62,78,220,6,205,18,165,56,140,102,92,172,52,11,34,249,199,98,
+48,3,4,98,140,7,55,56,136,186,16,16,67,113,151,9,51,22,147,9,216,230,218,204,
+197,155,105,78,27,219,209,94,175,121,52,194,25,187,231,122,125,85,245,188,30,190,209,214,
+154,214,150,73,204,91,79,59,222,31,100,186,185,151,45,89,89,129,0,128,139,226,66,160,
+58,95,97,236,204,34,10,136,90,137,74,214,67,224,144,182,163,14,63,105,143,55,135,135,
+86,145,154,4,132,95,204,224,129,27,168,40,82,16,236,106,0,65,122,251,85,211,72,245,
+58,123,168,131,239,31,111,6,180,193,64,203,212,47,22,245,242,95,172,2,159,143,93,93,
+90,252,37,61,77,78,6,127,203,18,181,7,207,39,141,174,167,23,12,171,65,24,14,227,
+65,83,200,48,92,6,56,150,22,71,40,162,34,10,138,149,164,182,250,53,197,29,164,205,
+103,173,16,89,137,100,9,130,195,152,113,31,65,12,218,97,15,99,162,224,36,13,144,54,
+250,254,129,206,58,131,142,137,223,218,107,66,116,34,144,151,64,16,34,89,221,99,90,219,
+82,77,119,69,29,37,49,103,134,35,154,86,175,211,49,165,143,42,54,102,99,187,130,168,
+94,74,6,9,159,170,81,166,162,150,17,32,17,33,41,148,16,1,1,130,17,177,32,146,
+62,13,178,35,122,136,95,81,155,143,126,81,42,240,172,49,238,232,246,15,33,6,59,6,
+5,168,41,30,109,185,41,97,218,219,117,48,74,138,163,22,154,106,53,216,149,253,226,241,
+152,43,198,116,71,68,156,155,163,187,119,235,240,203,12,187,242,123,200,72,137,155,193,49,
+132,68,55,25,190,13,94,92,12,148,36,1,0,214,23,16,96,140,224,166,129,123,55,188,
+57,168,72,16,169,182,14,187,80,230,89,195,5,73,65,156,132,75,129,114,8,108,35,67,
+118,147,160,204,128,37,68,119,201,60,61,182,114,164,225,82,198,149,147,168,37,21,32,161,
+213,32,1,20,62,102,227,170,94,38,194,239,107,136,151,11,83,120,150,201,194,113,68,223,
+197,67,55,240,217,215,74,32,253,67,158,60,253,46,106,214,145,108,49,169,110,3,121,51,
+34,150,163,123,137,84,110,97,47,59,166,186,110,236,211,122,16,23,17,9,193,84,208,193,
+66,201,49,216,6,170,143,82,2,101,197,138,253,52,107,98,121,134,218,39,49,84,32,130,
+35,30,73,149,169,194,164,163,222,240,11,137,6,25,103,86,24,225,135,13,245,44,78,229,
+216,69,204,217,229,5,89,134,167,2,68,235,130,188,239,247,221,106,140,153,165,109,8,154,
+155,11,145,183,22,55,142,146,142,47,153,181,51,199,66,110,24,234,166,34,90,227,175,208,
+84,225,208,119,210,67,174,95,83,236,155,203,242,240,15,131,228,208,30,158,60,220,17,19,
+237,188,73,100,115,213,107,68,93,75,2,102,55,141,94,26,170,213,67,66,242,149,164,238,
+237,238,202,1,200,78,214,219,152,76,200,19,15,35,200,174,215,3,221,136,163,38,250,165,
+15,3,59,84,160,216,52,204,26,145,129,2,115,87,88,178,210,45,106,151,22,59,92,136,
+46,217,237,137,237,131,237,163,205,41,118,15,189,218,40,7,223,87,69,89,146,3,24,102,
+97,76,216,189,90,117,187,117,167,171,12,103,157,19,117,116,181,146,17,14,120,137,56,101,
+154,87,97,44,253,142,92,227,93,117,113,8,21,202,13,72,24,38,16,37,204,34,2,25,
+238,125,133,118,51,65,211,54,221,199,44,158,55,55,60,92,231,208,200,131,74,209,114,216,
+167,182,187,172,139,205,151,189,52,43,251,221,20,212,8,179,100,138,219,204,168,78,5,56,
+65,102,227,142,227,165,27,202,13,15,115,183,179,112,196,249,208,101,11,185,183,33,105,249,
+205,203,29,42,107,168,128,96,144,212,110,159,187,124,197,198,16,142,253,239,87,248,246,108,
+17,36,47,55,111,197,40,207,141,101,229,95,76,163,125,200,218,56,18,105,42,25,220,236,
+109,80,233,79,203,113,201,77,186,37,254,137,198,3,33,209,225,48,148,4,67,150,229,165,
+61,204,192,204,131,68,58,36,177,104,221,212,154,217,100,215,51,127,151,194,111,224,136,244,
+117,6,51,148,128,53,113,3,146,144,65,177,81,180,32,88,138,157,176,90,252,68,138,117,
+72,153,218,136,2,49,48,52,132,17,177,76,112,231,78,232,111,60,120,89,96,73,18,131,
+34,99,222,136,69,54,204,58,187,179,170,110,103,46,23,4,10,36,10,213,101,238,228,212,
+243,33,3,215,20,239,200,40,174,91,19,185,106,180,82,169,193,38,176,255,183,247,142,141,
+141,168,184,168,126,100,73,239,110,37,7,89,106,199,62,76,94,108,120,184,185,43,157,164,
+143,135,250,17,24,97,125,168,244,62,131,11,134,31,157,0,182,192,72,109,211,126,242,44,
+255,118,206,200,239,240,164,203,171,46,239,146,9,158,1,32,136,35,108,184,95,122,94,81,
+174,235,236,26,217,65,84,19,228,86,87,154,183,67,191,21,242,247,216,188,115,193,47,38,
+204,39,165,121,182,105,220,117,96,225,153,65,186,92,238,134,186,9,16,86,147,137,215,59,
+84,56,21,143,170,61,35,178,114,136,88,194,19,141,218,9,238,234,29,179,39,61,214,201,
+125,143,127,165,254,6,16,90,63,71,199,213,159,129,207,130,48,65,144,113,150,23,185,68,
+239,190,253,248,206,47,238,64,130,150,213,120,178,7,42,142,125,155,12,68,200,248,25,90,
+13,90,217,153,46,192,33,69,81,181,17,66,161,138,46,33,32,233,126,127,149,2,20,209,
+71,1,4,79,62,217,231,164,239,124,235,65,70,20,163,251,117,246,144,43,174,9,18,64,
+56,19,244,70,99,99,198,100,240,49,241,87,136,216,146,65,168,27,9,129,57,53,231,24,
+92,60,227,235,106,233,96,28,160,34,19,247,192,237,49,209,92,218,69,200,76,147,48,161,
+16,153,132,208,97,19,86,224,159,213,188,40,227,140,11,235,106,217,96,34,216,72,130,167,
+115,121,170,220,187,195,76,216,18,211,199,75,203,189,9,186,240,228,229,194,155,226,139,78,
+20,180,171,197,178,82,245,174,56,219,178,10,41,239,193,128,225,121,166,208,216,162,2,182,
+146,123,54,29,160,168,189,33,219,63,153,3,99,139,146,195,14,195,101,96,135,174,225,88,
+108,58,96,241,89,235,36,171,43,133,148,68,97,136,16,247,116,105,75,73,31,186,111,125,
+148,220,71,199,58,189,104,3,116,72,40,217,140,156,50,207,213,86,20,64,32,196,157,59,
+171,92,213,159,44,80,114,238,68,65,223,210,61,78,247,121,206,83,231,195,105,154,207,111,
+143,127,171,10,177,188,92,24,41,205,110,38,69,30,33,6,109,7,225,93,115,66,72,194,
+8,143,155,236,60,113,181,128,119,183,5,225,64,64,253,26,155,25,8,145,41,77,189,251,
+109,215,161,177,162,65,174,154,2,114,61,155,87,211,223,166,53,149,182,7,160,240,41,24,
+198,110,99,155,213,212,161,20,153,99,204,209,242,201,252,9,141,5,99,224,20,86,174,228,
+219,81,197,100,92,159,130,93,241,135,204,9,196,40,115,225,178,108,17,37,36,44,85,145,
+181,168,158,155,245,59,156,13,16,223,1,68,215,143,62,54,246,78,149,224,22,11,174,109,
+174,189,59,176,172,141,26,33,165,99,101,42,34,40,87,223,190,171,134,5,243,124,103,91,
+253,29,181,40,99,89,216,72,221,125,208,16,125,141,177,238,124,56,63,12,89,66,225,54,
+194,221,157,53,115,112,35,203,153,31,198,88,107,242,239,156,61,47,233,228,236,64,37,33,
+236,44,155,2,108,251,32,154,242,221,87,221,121,240,177,128,141,145,70,200,27,0,46,110,
+125,51,189,237,114,69,205,80,222,173,20,10,64,165,97,70,174,183,20,221,168,244,133,3,
+115,68,8,182,49,227,207,215,123,12,140,128,51,110,115,233,52,36,239,119,123,235,140,101,
+244,129,235,55,60,94,232,32,46,178,193,90,238,239,60,11,231,245,221,155,8,132,70,153,
+38,5,145,56,129,48,152,92,89,85,226,213,213,142,57,198,93,164,225,134,146,211,140,1,
+22,187,114,196,4,18,180,54,193,110,26,48,96,192,9,186,230,243,224,44,98,233,134,156,
+199,208,76,61,8,57,164,28,77,107,215,132,165,123,152,230,22,19,57,83,188,218,60,178,
+5,137,249,189,221,247,31,101,186,250,205,135,40,70,237,153,107,110,97,147,102,207,6,38,
+150,188,156,249,108,92,164,162,241,17,191,165,18,255,220,209,185,43,166,76,228,2,81,227,
+129,0,100,64,243,48,11,149,96,161,17,33,91,246,85,203,175,214,125,155,174,56,227,233,
+251,190,121,156,92,17,143,94,223,7,129,174,148,11,159,161,194,189,243,48,89,116,216,198,
+117,203,190,126,34,88,2,133,150,120,220,167,225,162,111,157,10,110,202,54,91,181,110,130,
+228,214,28,160,240,239,113,189,238,221,125,165,112,128,8,128,80,53,8,40,4,34,167,98,
+21,84,8,154,1,17,177,19,179,159,177,161,133,211,123,166,209,183,83,244,82,29,132,231,
+181,34,169,33,134,238,187,113,199,162,234,95,43,159,211,187,163,183,47,78,51,135,102,242,
+190,225,184,22,12,27,193,147,8,130,16,184,240,211,103,47,236,183,121,68,68,218,149,16,
+49,130,18,21,173,78,80,94,230,189,131,143,179,223,219,89,251,94,153,157,80,197,244,82,
+29,190,213,76,216,68,184,19,202,205,210,213,60,230,202,70,121,108,149,83,98,130,89,30,
+210,60,163,16,80,253,130,53,136,8,16,168,38,76,124,160,15,148,36,81,34,56,66,210,
+76,124,123,94,210,82,244,128,250,110,55,215,156,20,184,16,248,82,181,39,161,85,72,214,
+17,10,182,88,171,185,180,165,118,150,16,20,36,244,146,204,82,204,36,2,11,16,9,206,
+68,105,178,5,34,34,34,44,214,59,52,187,206,233,187,45,182,59,164,186,238,77,243,201,
+219,108,83,159,118,141,46,13,186,204,144,90,79,232,210,59,106,82,51,216,144,74,187,36,
+9,250,108,27,198,208,221,93,124,179,105,191,76,67,129,146,109,141,138,87,48,8,34,173,
+66,64,110,66,22,43,59,241,65,52,131,56,194,98,52,234,152,102,144,68,9,233,24,7,
+18,187,24,119,167,123,119,110,112,88,221,39,167,57,65,217,84,227,215,236,28,150,51,207,
+2,24,244,25,243,22,110,162,33,140,190,83,204,39,86,188,227,60,246,199,101,179,108,149,
+185,196,222,26,171,179,247,28,220,70,188,159,169,25,102,49,211,83,4,160,20,200,103,96,
+119,246,240,122,87,10,37,129,47,196,202,26,30,196,255,68,105,52,65,48,168,244,97,36,
+182,33,90,19,29,240,67,91,228,1,44,11,132,200,0,33,57,21,39,66,68,85,168,164,
+23,192,18,42,4,113,146,97,77,111,207,121,58,146,72,144,65,21,75,28,100,5,148,109,
+134,214,96,5,28,43,8,145,36,137,81,193,140,64,4,45,186,181,144,252,243,61,28,210,
+152,101,18,32,35,154,82,218,116,68,82,18,138,234,57,197,40,98,82,68,135,84,81,83,
+77,78,202,18,154,163,182,102,178,204,143,158,18,82,193,210,188,239,97,91,221,132,21,206,
+199,66,18,36,38,49,163,157,81,132,89,228,102,67,189,111,28,248,17,18,13,250,104,26,
+71,42,75,162,229,195,20,212,152,39,142,220,250,88,165,179,146,201,53,144,163,96,163,71,
+18,26,162,53,74,68,160,186,12,27,138,43,99,157,204,249,37,175,195,62,7,164,76,12,
+169,125,20,37,104,92,253,235,46,81,150,54,3,52,200,194,12,203,170,103,223,60,228,28,
+5,120,236,138,39,182,246,160,142,78,53,75,51,108,117,211,19,25,107,69,133,203,96,35,
+182,204,168,89,146,7,22,40,242,97,53,81,246,156,30,211,140,62,179,143,116,47,27,59,
+50,93,174,27,126,75,240,20,38,245,80,20,239,211,200,123,188,42,247,161,95,148,103,126,
+142,189,233,213,158,187,22,192,90,90,151,106,165,248,53,131,24,155,86,106,252,218,226,33,
+122,154,122,198,105,148,206,38,173,157,205,112,144,242,161,180,78,177,55,19,13,141,217,9,
+70,38,18,217,233,200,115,64,216,39,215,108,249,198,235,180,238,27,125,236,122,221,195,97,
+136,174,55,205,90,194,91,121,106,253,26,214,244,154,43,78,53,189,173,89,197,240,245,95,
+19,210,98,124,236,168,177,32,214,162,105,107,2,120,84,9,68,237,105,217,38,147,219,34,
+210,42,228,102,153,10,250,147,25,226,183,20,31,137,76,32,173,5,65,202,161,110,104,162,
+117,102,86,2,221,28,245,53,82,148,157,66,16,132,212,24,65,103,149,142,247,153,164,60,
+28,196,183,130,90,172,114,1,142,107,240,208,101,206,240,43,66,181,84,165,72,110,87,144,
+186,173,146,198,56,154,48,32,157,52,18,132,14,144,62,81,197,25,162,244,251,239,238,169,
+134,177,243,82,234,59,135,4,197,68,203,87,165,0,189,11,133,0,75,29,103,245,72,129,
+10,92,40,221,61,10,169,91,205,247,223,81,86,16,187,239,211,89,194,122,6,35,134,37,
+155,194,211,109,140,46,94,235,113,239,191,11,91,34,10,36,231,88,30,238,174,250,21,138,
+39,41,174,70,141,129,37,102,105,230,185,106,165,142,119,248,243,75,225,194,253,243,224,209,
+182,171,166,153,163,179,75,55,69,114,45,91,169,195,69,147,204,68,84,184,17,248,140,30,
+7,119,128,203,170,227,137,104,226,114,142,115,230,179,84,16,216,220,76,115,95,23,178,21,
+50,239,70,126,129,145,115,34,7,133,185,176,36,19,68,123,136,204,226,153,130,41,239,173,
+246,23,59,104,100,232,254,247,157,179,219,57,245,43,115,216,243,188,206,103,48,55,87,49,
+245,111,168,140,229,49,156,210,16,193,10,196,100,141,51,33,130,167,152,29,42,47,33,178,
+144,208,152,128,106,234,138,43,56,161,98,68,69,213,243,171,41,47,38,68,19,4,93,43,
+44,136,169,164,90,36,80,202,213,212,156,99,231,252,125,158,202,254,78,50,12,249,42,212,
+217,112,132,64,108,94,84,109,42,55,173,76,224,131,116,49,142,147,29,225,136,48,74,203,
+20,17,178,48,220,192,68,40,96,176,32,218,33,90,9,6,208,172,32,196,56,133,185,19,
+211,46,215,58,46,235,23,205,242,237,7,112,81,4,216,51,104,36,216,144,72,45,228,96,
+70,165,230,194,18,26,161,122,62,185,212,46,36,229,197,140,45,33,16,79,187,140,7,46,
+246,67,162,181,248,129,34,47,120,75,48,85,238,71,216,252,77,244,48,77,249,211,98,8,
+71,68,236,195,155,194,122,182,202,251,97,8,55,122,234,199,84,108,106,29,142,98,203,93,
+102,133,74,109,160,1,54,181,168,216,152,242,243,173,136,180,26,160,178,96,128,195,67,217,
+183,94,156,200,232,195,141,181,235,136,208,161,68,108,196,130,240,175,156,89,140,21,123,54,
+218,178,40,43,32,239,61,160,82,73,120,76,105,226,81,149,173,254,153,147,211,124,216,99,
+186,13,120,183,193,66,87,93,82,161,137,22,223,62,60,106,27,168,23,182,7,167,27,24,
+178,52,220,36,128,81,97,232,126,122,184,170,55,42,131,191,21,70,39,225,240,200,124,11,
+165,128,173,23,81,99,46,28,145,39,196,176,191,40,134,4,189,75,198,246,177,65,48,48,
+136,16,11,113,176,253,94,218,81,97,77,143,34,45,121,46,205,253,59,240,113,193,223,167,
+109,206,215,4,29,62,253,215,142,185,198,83,172,67,142,41,63,12,61,9,79,61,53,178,
+87,227,139,57,106,136,100,194,4,51,60,144,47,3,198,14,121,43,137,54,8,218,193,18,
+124,21,222,22,147,138,48,125,150,114,154,105,204,69,9,250,177,113,107,147,30,28,138,162,
+4,43,65,54,186,45,198,215,60,158,136,249,149,156,54,18,159,112,24,227,191,202,92,189,
+47,23,200,236,251,223,65,242,121,83,224,207,145,20,113,47,201,163,230,227,95,27,199,195,
+224,92,10,132,172,15,130,88,6,109,57,77,68,197,160,40,33,222,19,250,162,180,12,250,
+172,192,250,99,222,6,224,140,123,88,36,248,205,69,244,156,24,192,80,66,96,19,194,136,
+120,130,246,163,135,82,190,57,213,107,43,40,55,186,165,1,149,10,182,162,214,107,151,35,
+110,190,41,204,171,206,70,198,0,68,194,97,49,138,20,194,55,249,159,161,197,90,10,7,
+187,158,33,35,216,189,40,141,181,12,26,230,149,0,189,131,174,116,55,45,58,16,171,162,
+84,54,234,221,0,223,15,23,55,13,86,112,229,229,237,250,27,98,40,245,224,99,125,126,
+207,47,49,241,118,3,228,135,192,253,248,178,6,172,193,170,111,25,247,252,107,228,22,201,
+63,148,102,40,250,172,213,76,241,93,65,183,162,235,139,56,242,117,80,183,204,214,191,122,
+239,51,54,8,169,98,131,96,136,210,114,120,72,84,1,65,0,128,0,207,168,246,30,69,
+233,88,14,12,208,39,33,180,154,158,130,157,219,42,86,160,165,95,22,186,235,21,123,208,
+16,71,183,131,214,183,185,131,59,53,219,140,88,70,69,96,32,224,28,212,36,28,12,189,
+39,48,214,47,10,199,142,18,86,10,180,19,134,20,139,6,209,98,128,211,115,153,129,73,
+153,110,215,149,239,50,223,101,157,212,55,221,134,3,12,84,183,17,56,250,138,134,238,10,
+231,180,220,129,234,128,178,13,14,223,187,122,25,250,119,212,44,121,187,47,151,46,135,211,
+155,155,105,118,44,210,121,249,98,4,195,229,236,143,7,129,185,160,158,90,4,27,120,137,
+213,71,10,206,15,139,10,51,22,6,68,220,87,82,195,192,21,49,77,126,106,149,213,216,
+187,126,85,245,74,19,66,17,1,141,62,144,50,65,35,28,185,8,82,83,194,120,93,166,
+10,155,194,80,164,192,44,171,41,142,201,43,105,177,168,234,142,77,58,19,140,131,28,131,
+61,208,53,78,139,35,128,203,62,145,64,164,123,204,156,68,228,81,238,145,100,86,153,198,
+216,233,201,170,228,134,113,156,100,58,208,190,132,48,2,145,128,192,131,194,88,80,16,128,
+192,86,202,222,149,233,176,83,175,30,15,175,77,240,226,177,228,151,210,124,42,152,149,29,
+83,159,85,155,16,197,166,119,108,8,35,197,247,204,88,45,35,5,154,91,183,87,150,236,
+5,163,10,245,241,35,91,155,19,71,97,129,39,9,223,203,172,249,53,166,109,186,214,237,
+29,150,219,197,78,24,120,21,6,231,95,136,62,217,225,165,151,99,45,45,234,140,170,219,
+48,45,148,94,56,26,119,44,142,17,17,83,196,132,144,249,218,224,254,149,220,253,50,38,
+242,52,26,225,166,167,173,45,180,180,201,136,131,108,91,27,110,34,113,6,153,183,62,244,
+228,132,237,77,93,8,104,178,203,118,134,51,119,30,99,159,70,174,46,109,199,227,87,229,
+47,151,183,196,30,224,79,155,177,97,21,228,217,24,32,146,215,202,254,255,148,249,12,124,
+144,23,58,180,187,84,81,204,61,110,106,147,120,142,50,90,171,179,48,173,112,245,223,205,
+174,128,144,71,35,210,13,215,179,195,232,28,22,145,72,14,92,219,205,132,58,55,244,219,
+28,175,27,143,130,10,108,123,35,209,84,214,246,249,152,238,215,45,156,77,122,193,174,95,
+69,15,91,235,158,157,221,151,14,122,119,123,56,88,253,95,178,161,92,18,69,176,82,25,
+117,199,18,205,117,145,151,13,4,195,4,226,202,174,184,50,169,105,84,33,83,247,15,77,
+131,19,106,16,142,139,132,110,72,120,229,133,58,85,151,71,159,97,232,150,165,166,110,122,
+100,89,228,42,108,249,180,107,169,103,16,44,3,54,243,53,13,17,215,153,148,221,110,147,
+132,230,212,115,57,13,108,198,229,51,42,170,244,198,136,90,60,167,209,34,167,82,103,77,
+151,39,90,90,141,76,175,252,227,181,174,144,217,42,101,62,88,217,190,239,52,28,60,22,
+52,220,118,204,203,149,196,101,99,100,102,26,167,210,171,172,186,249,238,91,246,235,51,179,
+238,188,171,53,122,4,180,29,194,203,183,197,134,107,233,97,232,159,188,116,224,46,111,182,
+169,232,195,139,117,142,14,32,86,173,80,93,19,197,85,25,57,18,19,7,73,150,89,18,
+233,235,158,132,115,156,168,116,218,22,30,60,7,164,210,74,144,190,131,54,228,64,14,136,
+4,98,240,175,159,189,194,16,89,150,180,218,207,123,196,243,233,14,162,226,60,3,43,109,
+205,125,14,72,51,154,221,52,118,155,201,147,80,47,173,131,67,59,200,85,221,16,113,140,
+103,164,105,71,105,73,141,54,184,155,18,251,247,195,123,229,220,104,240,142,137,65,254,85,
+232,219,60,178,123,205,134,217,203,198,182,119,201,46,43,5,204,170,58,208,200,200,233,152,
+145,2,25,81,163,112,108,204,164,26,143,113,70,11,186,43,142,107,177,51,109,220,132,233,
+171,17,148,158,186,238,194,29,44,23,16,96,17,33,36,68,8,76,64,89,248,111,239,29,
+158,6,253,20,120,182,196,174,187,57,239,17,189,86,160,253,15,36,74,142,155,181,140,139,
+199,94,163,137,189,202,35,55,65,121,124,222,225,66,78,107,108,21,157,138,228,172,2,65,
+63,198,190,53,73,171,224,18,249,90,100,8,67,109,173,27,5,99,98,86,5,213,28,93,
+193,23,178,163,88,105,205,157,226,209,22,171,204,205,117,138,136,202,25,7,29,115,171,206,
+108,78,15,169,204,11,150,86,176,16,146,52,104,66,75,23,209,216,235,107,239,70,118,154,
+189,156,87,69,70,219,112,21,65,1,29,27,2,118,32,34,108,108,210,17,99,70,183,29,
+234,108,196,71,27,21,146,243,8,32,130,196,162,62,36,104,209,213,135,21,108,31,116,170,
+185,148,132,2,12,101,151,15,20,128,160,140,177,49,104,81,88,170,34,14,254,179,49,112,
+114,21,193,24,72,132,172,99,49,21,199,32,247,33,15,60,7,197,231,80,23,209,173,234,
+188,170,219,78,136,98,36,10,128,160,6,227,61,248,215,55,208,67,139,231,175,92,231,92,
+111,229,34,133,108,203,91,176,146,91,211,99,186,14,204,18,171,87,199,225,30,47,86,4,
+132,8,136,30,24,87,195,99,158,68,1,24,121,90,221,28,231,100,158,103,68,254,109,220,
+168,90,197,52,15,25,236,2,30,134,229,145,220,209,17,13,130,68,121,9,180,73,19,38,
+209,91,77,27,10,166,145,41,100,155,101,10,19,136,165,40,189,206,18,197,240,16,68,235,
+180,71,61,206,84,53,149,250,182,251,106,84,238,17,247,74,198,45,225,128,32,139,2,253,
+133,147,172,87,120,133,56,135,211,167,49,180,232,18,250,200,130,88,185,28,73,134,32,197,
+206,181,178,115,203,189,115,85,213,30,59,107,208,184,9,211,29,91,156,52,200,17,68,129,
+238,247,122,176,162,30,34,181,87,226,126,119,225,189,235,219,192,120,218,176,175,103,177,219,
+169,86,48,25,60,218,200,194,2,197,13,118,50,38,218,96,139,78,191,94,248,242,110,21,
+169,21,95,69,82,182,243,192,133,160,145,5,150,108,1,6,204,36,87,223,150,72,128,189,
+104,32,239,196,71,143,100,161,185,8,10,181,131,36,101,208,103,170,108,78,117,159,4,33,
+200,228,17,110,189,117,27,88,218,104,10,171,233,109,64,8,231,10,252,182,251,44,87,224,
+252,142,49,2,161,91,173,228,172,138,238,173,186,204,205,85,198,74,212,105,161,61,189,79,
+71,3,10,10,9,163,118,33,133,220,203,54,189,101,118,218,32,232,221,62,239,101,50,7,
+63,79,62,87,110,238,71,147,71,62,206,222,147,229,222,10,194,129,9,132,68,4,64,57,
+236,53,167,11,70,129,56,9,179,54,107,102,97,92,52,3,8,12,244,22,14,229,121,215,
+171,48,45,70,207,89,199,166,237,156,104,179,175,141,83,138,130,21,17,8,208,42,40,66,
+160,26,169,144,52,16,83,60,50,170,112,94,182,168,104,88,81,253,123,246,209,62,202,173,
+246,158,106,205,245,104,42,207,112,225,155,4,77,72,116,144,98,130,97,13,55,56,213,119,
+241,174,231,136,31,18,87,31,18,9,62,181,37,138,154,104,160,3,149,148,242,230,84,129,
+213,152,226,205,193,68,179,24,114,132,129,74,16,64,2,64,74,140,147,207,69,12,5,16,
+2,164,71,90,28,110,166,88,166,230,162,109,87,179,50,58,205,65,232,186,0,161,34,122,
+41,17,34,26,9,84,18,135,157,2,40,117,169,227,166,4,215,36,116,221,73,25,86,213,
+88,214,115,94,122,53,235,154,250,38,162,132,9,197,67,141,199,80,198,59,134,164,197,43,
+196,106,194,71,171,208,202,227,73,213,153,228,7,118,226,10,133,143,155,193,27,248,67,36,
+136,124,129,242,137,88,68,118,197,28,27,78,185,243,223,220,134,122,100,68,194,238,28,186,
+182,106,207,28,237,70,4,207,4,107,83,167,43,178,65,229,218,96,58,201,171,92,154,143,
+38,109,77,56,43,141,178,215,92,218,231,49,168,29,115,132,226,225,245,69,94,189,18,153,
+151,214,156,34,36,131,206,114,167,8,60,109,203,40,101,3,100,59,146,100,248,222,140,41,
+185,182,108,126,215,46,72,80,111,233,70,92,57,239,222,151,215,125,148,201,28,1,77,82,
+189,153,68,101,21,192,103,217,50,200,229,201,151,149,136,2,49,138,251,176,60,219,147,30,
+18,144,96,15,167,25,215,82,117,132,52,111,89,213,14,38,113,246,220,96,37,106,49,190,
+147,3,101,81,1,23,113,58,165,35,32,217,115,156,25,6,229,117,14,16,198,137,76,105,
+16,241,143,1,142,101,184,179,8,33,218,225,216,237,91,35,166,24,159,193,119,144,49,15,
+125,193,235,211,158,120,131,209,234,60,52,135,246,176,229,199,13,8,186,249,187,218,36,235,
+127,73,26,37,100,220,216,156,133,167,163,0,96,138,76,101,66,199,135,69,101,83,16,26,
+145,169,16,75,215,140,137,119,114,197,4,0,49,70,112,48,8,68,50,42,104,188,220,227,
+169,45,195,182,46,35,28,252,58,124,167,46,151,108,149,178,182,117,91,43,220,132,241,218,
+208,133,183,160,249,1,137,79,203,143,78,138,133,91,57,55,9,212,21,165,176,109,242,198,
+19,87,137,203,37,120,147,103,182,23,17,3,207,187,232,218,155,231,200,243,157,215,212,146,
+24,246,182,252,177,243,150,200,156,14,123,132,50,233,121,223,176,107,228,145,75,133,209,131,
+142,228,185,46,34,148,99,104,182,186,29,221,86,244,215,174,189,219,173,219,70,199,151,106,
+106,184,129,211,166,222,195,197,234,42,78,150,67,28,248,95,149,55,47,197,154,56,207,30,
+206,94,36,142,124,159,174,134,141,86,236,94,243,229,161,133,46,188,206,47,37,215,182,194,
+223,145,107,93,36,9,53,206,107,31,216,172,139,202,38,183,153,23,188,198,78,153,234,115,
+150,134,119,43,53,83,231,94,22,14,26,223,191,202,170,50,139,84,115,189,28,87,96,49,
+44,44,81,225,213,50,226,211,28,182,70,203,40,54,202,42,147,46,5,121,171,171,172,211,
+157,220,8,151,174,235,58,35,148,183,148,48,198,178,223,198,11,108,221,180,56,185,242,9,
+215,217,62,244,238,117,6,183,4,155,8,137,19,81,179,178,205,123,90,59,141,242,228,235,
+19,117,76,172,225,134,45,89,94,243,215,95,181,110,175,137,204,23,93,178,109,104,109,219,
+102,97,207,135,190,174,142,29,149,201,64,105,235,216,28,17,108,161,28,197,43,15,111,139,
+88,189,158,210,111,37,67,118,136,129,22,230,252,57,197,161,248,64,18,131,121,82,182,168,
+1,183,228,6,30,44,69,197,213,44,76,107,54,39,85,221,16,72,23,13,160,233,81,59,
+48,105,68,239,172,101,194,166,214,174,230,73,89,87,53,19,53,11,234,130,232,181,112,95,
+116,106,22,242,11,195,129,4,98,34,21,130,181,155,130,251,80,221,108,108,52,239,157,192,
+218,160,94,33,80,130,149,32,148,8,31,118,40,144,115,37,176,93,64,49,131,163,207,205,
+42,130,46,227,126,78,147,150,116,52,97,213,102,3,85,160,236,64,142,176,100,67,191,0,
+141,128,199,159,24,4,155,220,151,66,255,207,49,35,170,72,28,160,191,165,95,73,155,15,
+181,178,173,130,217,214,221,251,109,140,120,205,34,43,96,208,129,88,27,3,70,185,196,180,
+16,125,241,152,5,98,202,34,82,83,169,6,53,186,14,144,214,117,225,187,155,133,229,123,
+200,59,78,175,53,171,136,181,239,241,123,125,181,107,220,174,78,140,66,203,121,48,150,166,
+100,77,48,42,58,145,90,233,233,181,10,133,180,78,199,164,212,222,251,232,67,6,247,246,
+239,82,172,15,142,71,48,4,78,185,163,184,223,131,120,198,36,249,223,6,234,209,123,216,
+94,57,139,237,153,216,136,10,171,62,237,135,150,135,146,207,195,229,59,94,251,156,19,36,
+52,38,200,64,23,44,51,128,120,128,34,6,112,15,242,44,68,47,182,236,243,120,152,22,
+28,200,209,16,176,111,208,86,123,167,231,215,81,35,93,61,159,146,157,121,251,120,247,50,
+9,127,123,50,92,76,48,236,18,45,22,29,147,101,216,150,24,72,130,9,54,41,248,17,
+17,7,148,120,206,206,184,158,231,170,178,62,106,188,230,228,161,241,20,119,61,146,194,50,
+214,88,105,230,119,225,229,228,204,136,21,216,163,51,145,142,141,84,63,150,166,224,164,195,
+32,109,137,188,148,122,45,142,96,224,209,179,94,226,138,189,29,21,176,20,213,24,247,242,
+161,91,221,203,135,63,183,211,240,248,207,151,210,123,88,27,98,168,123,6,167,202,209,69,
+25,135,179,223,173,62,116,120,43,51,196,38,151,104,212,161,33,22,141,49,33,146,155,90,
+246,225,120,236,234,231,92,247,195,205,225,134,25,130,180,121,250,56,4,130,44,72,246,3,
+107,227,30,85,105,176,4,250,49,159,185,179,117,190,36,152,241,30,166,31,152,159,113,119,
+189,167,187,112,182,156,79,167,88,248,52,190,154,166,64,202,242,4,1,0,64,136,51,2,
+99,12,136,181,105,121,138,2,179,28,237,124,4,116,24,24,56,162,145,60,139,161,162,228,
+34,23,221,153,102,19,183,126,112,219,229,249,212,156,147,206,252,223,91,209,201,55,51,2,
+12,200,138,58,128,132,78,51,50,6,96,17,176,193,25,117,53,105,34,7,176,160,99,225,
+236,18,29,83,118,132,170,44,80,30,218,18,213,47,107,12,252,104,67,69,185,243,229,164,
+83,224,113,11,26,67,144,13,74,76,81,205,132,38,236,212,9,234,25,128,143,213,82,61,
+179,167,144,180,77,222,14,137,159,147,63,216,254,53,159,48,121,59,122,8,48,129,21,15,
+181,58,187,189,173,235,38,56,152,28,227,0,222,238,234,147,161,216,68,213,226,108,137,249,
+214,38,154,208,167,61,216,101,154,14,86,104,50,1,215,173,121,29,188,239,57,226,111,151,
+153,220,253,215,125,218,105,26,68,10,97,54,112,204,216,0,81,231,25,54,241,199,147,85,
+31,232,172,149,93,183,50,151,38,248,140,70,19,111,46,126,124,121,148,37,180,215,199,153,
+97,167,219,235,103,156,218,220,125,50,85,69,117,9,0,24,68,70,160,56,214,19,156,16,
+130,169,96,92,76,84,9,154,166,113,112,213,173,69,125,214,75,69,54,119,11,70,111,199,
+226,111,135,136,208,205,48,132,162,164,132,105,104,32,4,40,133,8,199,59,180,42,51,57,
+5,80,210,135,83,63,70,41,95,225,200,221,193,205,95,207,167,85,19,67,153,140,146,168,
+199,16,48,0,128,132,226,2,36,160,209,74,245,26,168,155,77,52,3,27,99,239,97,227,
+197,162,100,214,249,9,123,181,105,12,97,94,121,66,122,4,167,52,218,205,74,37,81,146,
+23,162,173,169,249,234,47,86,153,152,9,130,179,5,8,82,102,163,128,164,133,68,130,5,
+0,50,78,142,235,100,129,184,170,14,3,186,4,249,155,112,95,76,24,194,21,2,202,200,
+176,209,131,102,175,97,210,113,77,145,46,248,52,1,69,37,5,202,142,15,225,133,244,190,
+238,58,111,137,195,238,162,8,161,136,199,134,187,155,53,205,193,128,154,122,242,217,10,169,
+149,153,0,65,157,44,67,67,197,1,3,48,65,49,129,118,130,228,192,40,127,169,83,40,
+252,24,40,253,186,98,149,134,0,67,142,163,51,184,137,71,154,6,196,101,177,214,10,108,
+85,94,14,186,201,177,23,31,32,143,212,36,134,31,189,216,222,154,218,104,99,112,52,251,
+129,184,202,60,33,79,196,130,73,226,56,30,58,27,225,17,119,83,145,181,147,213,33,178,
+134,65,64,187,60,11,4,32,184,160,193,220,68,14,0,112,221,176,231,190,188,156,64,66,
+46,56,78,184,7,254,92,230,92,116,188,232,13,5,183,66,49,69,140,189,141,68,48,78,
+232,42,100,28,228,16,190,40,42,252,107,242,202,40,133,70,229,51,151,3,239,69,60,16,
+145,231,47,178,136,129,200,150,33,57,13,63,122,24,164,137,35,187,143,68,184,72,251,182,
+101,28,244,70,172,8,216,39,149,4,54,10,158,111,65,232,141,102,22,43,101,8,131,60,
+111,179,172,5,187,218,214,241,165,94,197,95,14,114,152,65,145,33,166,230,144,200,176,99,
+68,75,127,107,118,253,183,36,47,96,153,182,81,116,196,171,151,47,0,249,87,148,203,151,
+43,93,26,166,234,197,234,115,170,51,56,66,42,42,39,4,196,15,152,212,137,66,120,105,
+221,13,41,46,71,90,32,134,59,174,140,82,17,41,164,146,131,200,99,33,98,86,148,132,
+64,35,40,122,216,109,205,134,199,122,76,203,87,53,140,161,134,132,132,106,202,204,104,2,
+144,147,92,128,202,13,229,217,11,129,59,195,101,48,43,4,210,247,75,19,61,165,138,178,
+180,99,67,28,166,54,169,232,219,30,131,164,52,226,222,76,80,186,12,252,16,157,121,180,
+149,233,58,111,14,223,124,231,194,133,115,56,50,166,185,115,14,241,83,178,58,198,72,252,
+47,189,154,184,63,84,8,91,8,249,79,83,75,239,171,203,11,204,186,209,168,141,125,116,
+154,156,75,30,50,205,159,66,188,41,52,210,249,90,145,21,194,183,194,196,178,228,28,52,
+34,192,170,222,27,209,46,149,3,71,53,197,104,221,94,239,155,159,29,184,200,219,108,108,
+14,75,240,189,137,180,145,76,218,168,32,227,190,214,214,215,24,140,210,138,33,163,65,224,
+134,155,21,215,167,110,197,248,47,179,134,234,182,238,99,121,137,226,60,209,211,20,163,38,
+2,64,134,161,229,36,217,65,31,43,2,103,134,209,129,143,89,216,59,166,220,196,21,52,
+87,65,30,239,28,230,51,23,249,48,131,95,42,137,218,229,34,153,8,98,157,92,85,26,
+48,219,16,181,59,150,59,139,213,109,221,31,201,62,48,104,20,57,120,136,142,216,55,172,
+211,54,176,81,134,76,132,168,51,153,215,172,27,31,85,244,182,222,110,44,224,88,235,11,
+156,206,66,130,156,128,225,179,160,211,109,27,129,224,207,78,70,56,15,158,200,192,194,58,
+186,5,129,91,96,237,230,221,179,28,219,129,224,242,1,128,237,120,0,34,16,93,194,179,
+34,4,129,196,130,43,190,57,217,188,206,85,174,148,152,241,60,193,7,11,219,133,171,118,
+111,206,242,32,180,86,40,95,215,213,96,214,139,175,181,126,1,90,223,191,124,90,110,113,
+141,46,147,57,210,244,206,238,134,44,115,12,109,18,173,245,202,153,222,134,28,111,149,81,
+68,150,161,48,172,93,7,231,129,248,215,188,139,243,110,68,52,173,1,147,174,179,188,78,
+8,86,24,53,50,183,169,156,27,251,43,124,161,71,108,188,77,94,47,201,122,172,10,12,
+132,114,222,234,6,244,169,63,142,118,137,34,212,46,131,198,64,137,72,211,103,98,177,136,
+156,8,138,70,46,162,247,174,171,116,94,9,200,68,222,249,252,111,103,150,51,178,223,67,
+25,171,139,132,69,205,13,137,218,133,64,251,119,66,166,232,110,70,101,109,149,183,110,140,
+142,253,207,136,66,45,182,221,70,6,43,174,241,4,140,2,174,254,116,24,186,157,199,40,
+238,118,74,62,117,183,117,218,228,118,247,226,19,51,10,242,87,173,8,47,51,77,13,228,
+96,77,77,15,126,40,183,111,177,226,92,77,248,117,116,202,203,7,155,92,18,67,73,19,
+200,243,126,33,121,122,6,46,200,101,31,39,105,30,126,142,38,110,58,120,115,94,32,193,
+145,92,70,193,77,44,165,217,121,133,141,175,63,102,253,219,112,220,179,208,24,34,204,204,
+136,48,17,90,196,142,233,121,144,129,4,130,126,143,3,202,32,109,219,62,68,122,80,193,
+185,208,103,100,188,231,236,222,55,175,119,131,94,191,135,203,243,234,79,62,212,236,252,201,
+97,246,126,182,99,17,69,22,49,61,65,92,148,188,31,51,175,33,139,224,153,236,67,36,
+181,111,230,174,61,195,222,95,77,91,105,183,199,182,34,235,141,151,144,65,21,248,36,160,
+170,168,162,102,39,184,214,140,245,251,126,59,231,237,249,124,31,95,231,244,125,31,117,236,
+89,107,119,120,122,123,37,41,249,159,199,238,233,222,225,178,17,91,188,204,136,137,141,36,
+76,255,57,3,148,52,152,12,152,104,68,34,35,41,192,216,84,0,168,9,234,26,106,50,
+226,184,158,10,141,130,184,128,222,179,178,81,211,160,213,225,192,216,123,254,174,255,243,119,
+121,186,58,149,240,227,204,154,128,64,68,45,182,163,220,3,145,42,129,80,142,117,76,59,
+144,115,128,138,170,156,84,1,1,17,21,72,144,66,194,1,7,192,64,213,41,128,175,133,
+253,121,97,204,220,59,120,34,6,175,183,196,191,54,44,23,191,241,61,225,157,101,170,147,
+187,191,217,183,206,189,157,183,148,128,35,103,44,110,146,92,22,21,213,16,33,80,0,214,
+145,206,0,182,162,4,28,14,12,244,71,226,63,22,252,88,190,254,98,128,205,2,28,227,
+170,174,238,197,157,240,121,32,239,235,138,136,210,83,136,138,128,3,77,84,125,10,161,2,
+162,168,10,140,93,234,93,204,227,96,107,11,27,26,108,41,181,82,4,203,123,233,236,251,
+76,227,231,203,115,61,19,20,211,137,1,140,1,65,170,231,3,33,81,16,5,64,85,80,
+212,129,13,147,133,53,22,98,102,42,166,133,70,139,59,253,222,79,39,56,123,252,90,254,
+206,217,37,9,132,99,73,132,38,48,164,115,105,162,232,134,67,218,96,182,242,206,105,213,
+14,56,117,63,211,99,187,229,204,39,127,34,106,112,160,64,21,204,212,136,133,87,65,73,
+226,131,148,163,206,105,179,232,105,96,162,185,234,169,143,94,28,198,240,242,182,105,236,53,
+65,98,43,49,10,14,213,130,11,110,70,233,233,91,109,56,97,78,0,132,244,141,151,199,
+4,66,17,132,96,163,196,71,62,3,18,166,21,99,239,183,171,134,5,174,202,8,41,134,
+75,35,51,93,11,148,22,69,104,165,73,20,145,85,58,5,70,232,175,85,8,150,132,242,
+239,232,202,99,143,27,146,145,25,6,144,108,142,56,188,134,105,36,234,215,24,102,245,135,
+198,159,42,38,85,44,25,143,232,89,30,190,23,152,35,134,44,89,146,216,141,191,195,100,
+83,234,51,14,110,120,46,186,226,26,176,54,184,25,14,155,190,72,172,222,174,166,84,119,
+0,147,51,238,177,141,243,31,67,176,241,218,159,87,115,143,169,10,101,44,118,98,244,13,
+168,243,255,101,219,45,123,150,45,104,108,27,16,132,22,131,94,204,237,14,17,224,60,122,
+27,13,150,148,218,196,151,124,195,65,212,34,236,134,21,202,113,182,34,209,162,237,237,54,
+235,14,137,3,201,122,80,65,7,18,25,247,158,7,205,70,50,107,221,168,225,4,54,248,
+242,101,61,15,210,34,61,18,5,62,55,39,27,193,176,39,200,159,168,226,24,237,74,181,
+173,98,89,86,12,223,214,106,199,131,87,115,45,108,176,56,190,212,188,157,182,172,19,57,
+26,178,128,223,64,19,52,136,153,252,164,8,138,83,128,197,117,140,154,37,235,78,178,132,
+29,126,34,164,66,195,171,110,181,231,193,168,227,147,78,147,105,24,225,112,48,124,31,19,
+17,66,78,66,97,150,31,240,72,21,253,50,86,198,80,121,34,169,232,145,144,174,119,202,
+129,54,200,16,211,119,152,205,228,213,75,63,18,236,43,130,16,173,92,246,131,237,211,161,
+58,28,85,209,34,121,201,23,93,234,255,159,133,217,202,191,28,244,37,232,108,102,52,166,
+172,169,96,77,224,154,212,21,186,171,159,117,178,68,44,63,83,49,218,218,18,149,215,243,
+66,206,132,2,158,29,218,36,111,70,243,201,116,22,211,155,132,169,77,26,27,141,170,225,
+103,139,32,188,196,150,87,72,70,207,93,67,5,85,55,123,186,185,72,58,115,211,41,193,
+199,218,209,141,44,44,51,196,245,219,129,126,55,200,152,201,37,9,44,205,122,186,116,91,
+34,30,120,102,114,124,230,134,243,81,46,72,219,94,12,218,87,2,113,84,209,234,150,48,
+140,54,195,31,8,50,147,132,187,170,219,186,155,239,134,89,182,224,176,33,100,37,153,47,
+196,140,124,107,155,162,73,164,38,99,90,15,167,2,130,14,219,222,155,24,98,24,68,198,
+46,154,11,109,179,5,114,190,238,199,130,176,63,204,92,195,199,91,171,242,184,205,181,200,
+156,106,89,217,227,127,112,191,119,23,90,186,101,176,229,90,165,166,134,231,146,203,53,60,
+253,239,242,26,57,247,101,206,253,125,143,194,39,25,158,233,95,190,221,187,100,227,75,96,
+201,95,36,106,231,204,205,140,216,41,108,33,173,83,142,19,109,197,39,157,85,204,75,195,
+241,236,68,91,53,179,155,36,96,86,243,236,35,227,225,34,46,105,34,4,34,199,217,38,
+59,173,124,111,30,71,142,168,5,70,111,111,61,142,246,98,67,208,38,51,105,27,8,130,
+19,58,138,118,15,69,60,17,38,243,172,112,51,192,189,28,67,237,201,202,86,70,242,242,
+157,247,84,59,186,252,134,115,214,53,232,101,45,151,222,212,122,237,120,217,27,135,88,73,
+130,15,67,51,104,161,236,174,254,238,87,108,95,40,145,227,180,212,175,19,190,209,113,29,
+16,200,231,100,43,156,33,182,140,193,185,44,165,67,236,235,56,192,55,39,1,166,110,151,
+91,223,235,157,99,45,139,226,50,108,68,115,126,155,109,109,27,72,136,188,184,41,9,201,
+4,223,99,140,160,211,54,155,223,91,155,118,236,122,173,148,242,167,6,133,100,156,147,117,
+73,246,220,231,135,2,162,73,196,22,253,29,14,135,61,42,227,5,22,178,203,100,226,221,
+209,92,214,69,102,5,54,86,225,141,253,219,174,202,233,159,131,201,7,22,247,235,206,195,
+218,138,24,207,187,220,34,24,94,241,196,99,106,95,145,153,6,221,107,219,21,17,238,93,
+107,215,221,247,125,61,111,247,147,22,54,35,169,40,155,2,71,192,191,83,83,223,172,31,
+149,245,141,237,9,127,64,250,199,185,155,148,131,60,111,217,170,24,69,91,106,8,152,74,
+166,181,99,73,13,73,155,53,168,1,52,129,188,94,194,193,131,18,7,137,244,156,57,87,
+196,121,98,92,60,195,135,120,195,99,142,86,96,136,76,8,92,228,12,128,46,198,184,34,
+241,193,172,13,3,55,112,148,50,217,177,122,141,116,36,207,143,110,184,187,45,221,216,49,
+246,66,208,5,72,136,136,139,11,204,33,0,9,230,184,145,224,211,198,170,88,95,181,218,
+62,154,119,234,164,26,207,175,131,224,21,192,4,0,18,10,68,46,16,196,64,231,32,1,
+1,5,4,101,18,21,69,100,202,96,161,101,85,158,123,160,156,168,91,156,253,123,70,223,
+45,219,213,173,221,240,166,8,165,50,145,202,64,51,18,147,152,136,72,72,21,84,12,1,
+121,183,175,66,27,106,112,118,44,116,14,158,141,127,44,253,29,75,244,255,125,167,25,168,
+8,129,78,170,200,226,161,19,20,136,17,113,103,35,9,197,65,239,217,94,68,160,192,11,
+231,171,247,241,243,95,222,90,31,127,206,62,153,186,0,35,146,110,166,218,11,126,223,107,
+23,45,153,150,123,21,112,115,84,20,154,162,80,10,186,76,161,80,70,168,136,84,64,129,
+140,201,196,195,226,72,245,67,52,221,0,68,215,4,240,146,18,107,29,213,216,171,105,96,
+85,215,223,213,189,157,222,247,170,29,100,165,57,253,21,251,249,185,252,30,30,95,102,73,
+207,141,210,237,187,65,212,3,255,209,250,239,161,26,89,215,155,10,230,210,128,59,80,99,
+23,103,18,214,75,62,185,135,88,131,26,170,211,185,217,120,28,60,66,5,230,35,45,238,
+122,118,253,175,191,235,240,199,88,194,61,66,161,128,4,102,177,34,114,160,8,20,10,132,
+149,48,146,192,32,186,228,68,107,122,80,122,20,56,136,122,59,37,144,122,123,254,125,118,
+7,88,113,231,54,191,111,192,152,230,150,90,10,131,141,7,156,133,19,134,128,159,63,23,
+133,250,9,199,70,23,200,27,56,236,218,248,109,129,138,224,55,161,211,244,248,174,243,84,
+143,162,200,252,145,166,186,194,65,148,36,21,76,96,32,9,141,225,70,169,229,105,150,78,
+51,26,203,166,204,209,164,61,50,220,156,26,130,34,140,196,161,11,241,16,92,101,206,131,
+107,22,39,42,53,91,14,24,113,179,167,61,147,229,203,157,189,79,197,25,1,21,19,232,
+167,64,168,33,81,16,1,103,175,94,143,62,139,58,46,235,90,8,1,241,133,227,64,129,
+44,144,116,36,208,97,146,209,49,178,84,232,215,172,239,44,243,207,157,184,12,228,3,183,
+84,156,180,225,14,172,66,63,30,50,249,32,127,116,80,169,88,128,102,137,21,134,188,188,
+174,196,22,63,166,62,57,113,208,173,124,99,140,70,211,66,63,106,135,184,175,76,227,56,
+20,237,105,151,77,210,239,220,198,183,25,180,70,32,221,54,158,25,232,213,74,36,148,94,
+7,142,182,217,140,236,143,75,63,72,96,243,172,247,154,143,47,77,205,211,91,137,55,186,
+227,151,61,19,142,193,206,237,53,115,132,134,123,18,143,199,246,164,30,54,140,124,241,6,
+90,94,226,246,168,43,243,37,8,37,245,115,238,125,208,229,60,252,202,52,56,211,23,84,
+170,109,110,22,87,191,92,189,151,234,120,134,101,224,186,21,15,83,192,29,22,234,211,181,
+203,175,78,18,194,232,146,63,47,147,193,196,121,111,163,121,6,158,140,94,11,99,69,80,
+235,36,212,106,171,133,186,94,11,50,53,161,9,158,87,251,246,65,46,176,253,50,14,130,
+252,231,189,218,116,211,219,211,7,84,152,165,252,106,116,73,150,98,15,232,44,186,213,112,
+117,142,35,79,76,244,181,131,236,10,40,79,58,48,187,179,57,230,209,123,211,77,7,89,
+224,226,99,215,205,63,128,236,238,178,123,227,132,24,8,235,189,184,56,178,249,196,34,74,
+96,14,139,158,117,240,33,110,153,104,73,50,226,195,183,124,240,118,73,91,23,140,84,214,
+136,206,219,45,208,66,221,18,80,135,213,121,158,146,133,119,227,138,44,243,98,88,54,148,
+122,39,105,186,218,123,111,125,215,166,27,254,21,165,241,132,48,134,154,174,142,29,169,217,
+68,102,216,215,110,214,173,155,57,141,82,154,112,200,34,16,142,230,215,116,103,201,103,233,
+85,140,91,158,75,157,31,170,243,54,202,224,245,226,6,60,76,208,1,187,232,223,84,2,
+195,9,215,226,41,166,221,72,47,2,166,130,67,65,180,103,136,58,253,203,229,14,183,92,
+194,27,117,242,178,125,139,69,235,68,255,76,173,106,210,228,72,161,130,131,108,193,70,217,
+165,141,202,201,139,190,220,58,246,4,133,86,206,51,73,24,58,161,104,136,59,35,143,19,
+57,247,220,250,58,122,248,198,223,37,179,95,175,146,121,10,131,91,1,128,135,70,93,58,
+100,251,29,82,77,191,64,104,100,5,210,152,185,152,121,74,186,40,10,230,236,206,199,157,
+26,21,70,77,220,213,227,182,43,85,3,238,60,166,213,131,7,155,207,224,126,130,162,252,
+6,189,11,203,182,157,214,33,85,86,213,99,198,114,185,250,147,6,205,77,100,134,221,120,
+22,179,121,134,80,235,217,231,242,43,141,169,92,60,224,29,162,18,176,64,187,5,180,215,
+106,128,93,246,150,220,179,130,38,228,210,208,190,195,124,37,242,41,202,52,246,95,235,191,
+185,141,17,184,35,140,92,221,59,103,223,163,76,107,184,240,14,11,169,229,72,178,33,237,
+5,238,152,179,226,132,37,174,124,117,137,207,238,191,127,30,53,90,220,237,27,108,240,129,
+59,35,81,41,98,29,103,0,204,64,194,160,204,69,137,168,129,197,62,187,125,136,233,237,
+225,231,230,93,14,253,18,223,155,201,125,21,15,60,123,61,255,13,189,1,183,198,93,152,
+173,179,226,100,70,211,195,13,242,216,196,184,17,77,146,48,230,147,154,211,112,241,104,50,
+97,238,218,80,33,102,121,81,167,85,186,141,128,43,18,213,24,24,70,201,5,215,252,13,
+207,199,166,226,43,85,0,179,248,255,134,3,4,122,36,109,114,71,225,248,56,132,74,32,
+224,254,125,188,29,24,196,234,233,100,41,80,233,142,227,202,56,206,12,80,51,0,165,128,
+160,82,14,24,172,6,21,133,125,27,121,208,150,72,128,105,21,162,212,219,161,99,93,12,
+104,165,133,124,60,206,94,186,108,190,234,237,16,43,101,178,180,43,83,4,96,90,117,136,
+206,14,106,160,98,52,219,8,188,33,142,99,230,106,188,204,13,197,78,62,11,173,223,237,
+245,243,80,28,124,30,181,206,200,217,32,9,132,67,44,241,107,91,163,131,131,154,215,17,
+150,186,66,186,61,198,122,100,222,251,122,124,94,143,131,171,209,240,10,41,8,164,64,30,
+20,136,2,130,32,1,160,81,116,82,30,59,132,101,73,140,4,35,24,96,16,250,247,219,
+29,175,184,9,21,20,17,5,1,228,132,64,74,54,249,158,126,56,51,220,246,231,226,187,
+8,52,8,40,251,144,152,18,2,34,34,36,36,17,40,5,209,29,3,41,83,35,56,113,
+107,41,213,102,197,177,25,216,98,87,78,63,163,98,23,16,82,241,72,218,36,4,154,21,
+87,64,214,16,99,139,35,54,230,178,195,44,197,223,155,195,193,161,113,46,219,120,120,148,
+59,12,72,19,139,28,193,132,194,62,109,8,72,216,144,66,33,18,132,124,62,87,163,235,
+94,130,254,94,115,233,175,74,154,3,139,207,36,135,133,171,48,169,250,184,81,129,187,3,
+172,81,87,215,239,173,171,163,175,209,2,213,41,96,204,64,74,84,34,32,99,5,162,113,
+143,43,76,168,44,6,185,89,205,96,9,171,184,144,129,57,206,64,215,10,235,147,30,188,
+163,248,137,107,195,162,155,123,253,159,46,189,60,199,245,250,125,146,89,190,155,12,71,191,
+7,16,174,43,44,8,3,146,160,107,183,222,76,99,130,140,162,235,66,167,227,146,247,1,
+95,77,191,169,217,240,54,17,196,41,81,77,66,164,228,87,18,60,37,66,40,64,24,38,
+208,211,196,144,234,139,82,52,175,4,238,216,106,4,30,56,40,241,128,8,109,88,145,8,
+70,181,155,35,66,82,2,111,14,159,79,195,209,238,14,62,21,224,81,49,38,20,156,32,
+74,9,116,136,14,128,233,136,94,151,166,83,159,197,100,245,249,63,4,80,65,24,71,33,
+226,36,71,34,210,91,59,184,99,233,189,121,107,171,200,178,1,241,16,133,247,132,44,210,
+78,60,183,167,205,211,171,13,222,221,222,159,85,173,91,21,194,6,184,195,18,115,54,236,
+253,86,205,57,233,103,114,157,14,24,88,105,227,4,4,34,79,242,89,3,96,8,194,198,
+74,192,248,203,120,248,117,215,230,147,215,2,103,132,38,138,35,35,206,182,136,198,173,112,
+211,159,30,217,51,241,134,157,222,218,220,55,199,118,89,154,110,47,122,177,215,200,176,229,
+52,208,58,235,151,131,189,52,248,12,223,52,238,80,253,238,128,138,152,184,66,246,216,244,
+214,175,21,86,13,70,245,126,247,59,223,231,107,159,123,65,0,58,46,109,230,44,150,96,
+40,22,116,23,94,168,173,16,118,251,215,120,1,225,185,197,46,119,131,213,11,5,30,247,
+90,117,201,244,225,53,52,46,164,200,53,81,184,83,68,130,45,192,46,130,64,111,101,196,
+101,137,42,5,219,130,226,181,97,211,81,106,15,76,156,227,110,25,89,219,93,33,95,100,
+241,74,83,72,155,209,19,220,208,146,175,17,139,158,39,200,123,45,245,117,185,215,175,56,
+78,144,213,102,174,158,137,35,1,198,233,39,240,174,183,30,127,77,252,118,237,139,12,134,
+158,77,199,32,69,185,251,166,221,143,47,185,23,143,210,248,81,46,194,48,245,118,41,117,
+220,192,144,131,116,197,25,213,219,99,57,54,89,253,247,229,55,60,47,240,170,7,121,184,
+53,163,67,57,165,23,189,141,81,114,12,235,127,197,30,48,2,35,119,54,237,126,121,170,
+65,174,71,38,53,235,215,110,46,58,84,75,141,138,237,86,133,214,28,89,143,140,78,234,
+151,132,11,202,179,12,209,64,31,166,14,76,246,165,246,211,38,216,72,217,4,24,64,200,
+112,155,101,76,181,164,211,191,10,31,25,106,114,96,40,38,224,201,231,239,73,102,25,150,
+14,197,8,167,136,232,190,206,112,155,62,118,17,203,102,172,245,52,171,69,81,84,13,30,
+184,8,8,238,97,116,211,118,105,139,118,171,170,78,64,116,189,58,202,228,251,189,59,147,
+12,27,248,186,196,102,126,42,34,135,75,9,142,117,54,200,171,104,116,35,0,224,242,187,
+24,77,214,58,102,169,125,62,212,8,133,151,30,126,155,29,192,253,139,86,215,6,182,140,
+251,83,86,142,95,11,62,138,227,14,49,238,147,222,235,233,159,179,134,221,116,92,212,90,
+205,166,77,88,208,140,20,196,37,15,45,241,119,227,151,76,63,222,13,241,61,22,128,215,
+204,228,33,219,94,187,107,193,196,250,95,90,199,87,130,197,245,189,197,254,182,149,87,203,
+71,48,120,103,84,59,22,174,152,49,124,49,235,228,231,106,104,245,158,5,30,213,217,178,
+163,37,76,54,229,175,45,185,105,71,150,153,14,2,218,176,230,88,202,173,74,250,136,80,
+24,235,65,162,76,188,70,166,118,182,91,242,176,165,165,111,63,52,213,133,68,150,244,198,
+72,132,104,205,152,34,172,196,206,211,128,6,156,137,247,4,147,134,76,40,140,88,18,44,
+13,8,144,255,195,231,70,198,248,60,93,149,26,250,90,160,206,242,35,223,227,38,120,219,
+77,170,105,228,75,31,193,219,243,5,198,34,30,227,155,110,121,209,207,5,43,44,0,129,
+18,113,49,135,156,85,19,87,93,7,57,146,132,226,32,115,17,223,32,250,141,16,82,86,
+21,13,39,2,176,156,9,252,81,246,62,107,51,52,43,95,102,171,51,130,241,173,21,205,
+144,161,153,180,5,54,21,136,146,98,172,14,25,90,151,135,67,42,46,77,132,231,44,151,
+115,103,86,182,225,5,74,223,88,167,3,24,196,18,57,169,241,32,118,60,93,166,246,212,
+146,35,8,153,213,17,11,97,228,186,72,238,253,206,56,44,177,118,181,22,21,113,233,233,
+112,12,205,239,106,170,53,56,173,188,199,63,95,15,121,81,54,149,185,140,114,212,236,82,
+113,55,71,232,27,126,216,225,90,194,154,92,194,126,100,205,74,9,205,230,160,171,79,138,
+105,242,124,244,219,77,143,94,195,223,139,131,137,111,222,161,193,55,171,65,4,39,111,52,
+55,233,156,144,28,120,227,221,225,243,238,63,119,174,137,247,32,62,182,159,9,124,149,250,
+248,187,162,60,72,70,203,175,183,45,120,248,33,195,135,47,95,155,91,56,159,169,152,241,
+187,54,100,8,180,54,3,32,194,201,19,50,206,250,59,46,66,42,17,230,99,68,17,47,
+91,60,43,135,155,211,217,22,251,149,51,230,53,175,1,194,151,210,6,5,20,65,16,2,
+100,128,76,126,130,242,200,11,72,13,202,101,116,160,204,245,81,182,253,27,123,179,216,65,
+61,203,136,127,53,141,27,93,165,51,136,40,34,160,28,72,82,70,19,5,46,13,225,142,
+230,238,221,46,193,223,231,62,223,163,108,82,168,192,128,173,143,158,124,3,92,92,214,178,
+134,195,58,219,206,137,200,235,135,15,51,213,81,216,157,133,150,215,239,192,18,154,16,50,
+34,96,79,95,68,80,211,243,140,208,223,142,96,8,164,6,34,28,167,168,30,140,32,211,
+191,180,63,39,175,153,42,75,140,96,232,129,237,49,128,102,33,61,203,29,0,112,188,161,
+58,4,4,99,196,65,163,7,144,16,158,120,79,64,34,204,17,74,161,36,33,80,197,134,
+157,139,91,20,127,147,35,201,173,155,169,210,157,123,155,163,233,251,25,106,80,7,30,113,
+45,130,6,207,1,204,51,5,142,166,156,85,209,133,235,206,199,100,55,251,214,107,250,172,
+75,176,111,146,68,74,113,51,200,54,225,88,100,143,46,146,221,23,194,93,167,250,189,63,
+87,218,72,56,10,74,248,36,8,240,164,232,222,173,145,26,56,175,183,194,30,220,62,223,
+41,60,79,164,34,17,81,65,20,152,44,49,196,131,178,62,136,222,99,192,138,252,155,7,
+102,167,87,17,168,158,48,63,155,52,192,227,15,186,194,206,187,228,219,233,3,122,62,230,
+152,162,146,48,7,33,58,110,135,204,162,255,45,91,32,242,219,83,108,188,65,72,58,249,
+196,64,224,169,115,219,44,215,195,217,232,62,191,89,168,239,235,177,215,252,227,8,136,15,
+151,126,14,229,224,221,34,224,211,77,27,88,30,112,158,132,69,200,133,125,12,111,22,69,
+144,103,204,170,218,186,145,224,117,128,113,126,42,131,121,63,106,118,251,126,198,224,13,36,
+207,51,76,112,38,94,244,174,200,139,12,154,102,147,39,94,173,62,241,121,24,82,122,98,
+69,200,218,170,70,27,97,146,254,208,95,129,120,224,117,59,199,162,232,87,120,243,69,185,
+120,217,66,46,226,184,175,199,181,108,43,109,67,97,16,189,104,23,167,28,226,79,172,249,
+115,100,91,223,16,79,192,227,121,17,170,107,190,192,38,192,129,162,216,36,9,1,176,21,
+32,212,150,64,68,160,252,253,69,19,78,214,70,121,6,11,42,234,200,38,46,125,147,142,
+16,236,16,224,119,231,251,20,83,217,224,104,26,123,134,125,0,251,175,151,132,180,207,127,
+123,201,214,16,102,235,220,251,32,61,4,249,41,54,125,27,104,202,148,249,124,79,222,165,
+60,31,162,152,184,215,120,61,199,29,23,68,136,31,119,26,156,110,145,187,142,199,235,134,
+159,25,221,158,233,167,101,205,17,247,75,211,130,176,178,168,100,22,244,207,122,182,208,199,
+107,122,58,121,244,111,179,193,166,14,101,131,83,212,83,183,55,169,15,52,76,223,205,187,
+20,32,57,107,233,158,136,179,111,140,89,183,240,180,125,145,74,208,115,234,174,73,215,118,
+245,81,2,26,215,20,122,56,208,251,195,115,159,35,172,207,28,134,76,44,92,9,198,174,
+216,60,30,5,166,161,168,255,59,51,156,80,47,190,80,66,2,98,189,218,58,211,128,233,
+201,218,25,69,85,206,241,92,175,58,217,118,218,211,107,174,5,218,203,148,185,45,247,77,
+156,145,49,80,184,34,52,110,99,153,163,204,200,54,158,222,166,130,187,161,13,145,125,230,
+250,110,131,138,120,159,163,95,174,39,96,238,195,193,237,206,168,57,72,169,78,159,104,99,
+52,92,193,13,248,48,169,197,129,90,138,179,145,188,36,11,183,109,219,199,68,215,72,117,
+119,200,121,35,83,66,121,53,115,108,142,134,157,100,3,28,99,49,58,52,147,147,73,117,
+37,153,112,166,252,23,149,39,80,203,228,165,195,97,11,199,142,76,251,167,18,129,181,56,
+56,234,96,44,105,77,179,133,27,194,12,219,199,11,59,21,52,101,101,208,112,80,149,181,
+78,123,64,108,120,108,163,51,78,42,54,27,77,226,168,219,73,40,101,63,58,62,28,132,
+99,164,50,53,151,205,178,105,62,190,169,85,53,247,253,223,9,176,187,237,244,86,94,140,
+61,240,1,144,116,15,230,164,19,185,189,80,54,71,239,40,244,126,74,191,155,202,41,11,
+99,234,249,26,73,49,18,32,148,180,86,74,129,192,151,213,112,71,189,226,160,142,249,36,
+191,111,214,14,13,34,22,191,114,175,132,176,241,67,220,176,155,136,132,144,195,105,121,239,
+191,3,133,194,200,155,195,101,115,119,215,23,137,119,221,50,155,71,12,23,215,86,198,246,
+193,85,36,42,97,231,182,56,163,83,108,248,73,114,140,129,243,233,12,239,206,56,25,172,
+243,42,115,203,170,91,210,7,21,210,135,55,23,214,14,113,169,166,253,119,206,141,101,180,
+27,235,171,212,86,126,155,228,26,226,60,214,8,109,212,197,30,45,43,139,8,194,37,147,
+180,21,189,70,141,143,131,23,105,115,202,122,148,41,205,238,121,173,214,12,118,22,217,114,
+183,121,25,185,8,137,33,57,116,109,183,180,214,224,204,28,228,233,229,124,64,70,32,146,
+138,138,106,219,85,8,32,21,101,65,217,58,58,108,152,211,218,10,189,20,49,208,68,30,
+244,254,216,129,239,14,213,170,18,22,230,17,141,216,205,60,133,98,74,129,14,154,153,48,
+54,131,26,213,216,158,137,148,125,142,111,202,213,51,96,243,69,94,130,130,248,213,180,8,
+200,15,16,171,76,234,198,71,140,66,125,16,72,215,14,255,131,47,109,183,196,94,8,72,
+12,38,80,68,136,20,52,68,120,79,16,141,135,211,81,140,7,197,124,22,26,16,51,84,
+26,250,250,89,237,210,172,155,29,192,179,188,3,0,153,153,48,200,136,179,131,140,157,120,
+59,250,82,185,244,246,228,61,191,155,198,180,185,132,87,17,98,225,148,1,1,158,120,12,
+198,81,1,246,169,134,183,246,237,119,245,143,218,224,80,32,148,149,69,7,166,52,28,81,
+137,178,150,66,141,219,4,119,79,165,229,92,215,235,223,211,113,247,223,228,251,186,153,140,
+8,148,2,25,70,128,16,48,130,130,33,218,36,240,76,93,205,143,184,97,1,247,5,189,
+76,242,122,191,188,240,59,212,168,175,93,248,146,140,72,136,200,27,76,53,80,33,132,52,
+142,228,2,113,209,18,137,197,232,236,91,114,65,107,250,122,13,119,163,213,244,118,127,43,
+203,249,114,81,77,28,77,50,58,7,133,213,211,66,105,90,128,18,69,71,47,18,231,47,
+151,173,101,166,82,30,107,108,18,72,8,11,62,169,166,64,112,208,150,190,107,178,87,108,
+26,201,203,53,33,235,85,227,110,158,238,205,167,250,184,115,105,231,180,158,61,166,17,56,
+117,211,94,190,112,232,61,215,116,57,227,132,35,160,46,239,254,54,26,133,144,16,8,99,
+33,130,236,225,7,85,21,232,117,240,77,229,195,249,184,253,205,94,63,70,107,184,18,62,
+65,113,122,2,240,129,61,4,196,50,244,7,148,122,157,6,235,80,30,18,37,51,116,45,
+24,106,58,218,89,115,199,162,119,20,195,7,140,163,42,105,82,241,70,142,47,204,216,189,
+82,239,252,255,123,237,247,253,27,146,196,201,2,24,134,167,41,218,21,153,113,143,171,202,
+19,197,156,180,65,201,226,8,27,113,152,73,113,245,236,96,23,176,79,86,16,234,87,135,
+196,26,217,166,8,86,40,89,166,62,88,159,85,59,79,39,188,213,15,142,151,95,69,201,
+127,213,234,119,251,136,158,122,36,89,58,152,28,142,228,115,78,56,245,93,26,10,191,169,
+172,252,35,209,1,3,35,86,60,236,43,108,33,171,7,117,199,115,118,211,7,232,32,32,
+34,116,47,52,56,107,228,186,23,18,139,209,87,22,59,65,117,215,91,191,204,238,126,166,
+249,224,211,5,143,116,117,31,112,101,228,48,176,164,177,74,219,47,35,41,18,37,239,246,
+162,100,34,62,29,88,77,101,97,159,96,241,84,65,10,184,22,69,40,23,173,79,165,110,
+213,248,148,103,231,105,225,159,37,90,6,94,185,194,62,202,201,45,133,130,227,191,26,192,
+16,237,136,41,207,162,140,19,10,3,5,66,13,251,147,78,168,179,45,161,33,35,145,186,
+154,164,132,38,211,98,75,176,65,48,107,38,29,205,174,34,57,12,161,21,80,107,65,187,
+105,138,185,65,138,90,231,201,54,202,43,122,60,81,54,248,121,36,247,35,107,116,230,243,
+158,245,214,98,20,30,82,130,73,152,224,252,45,178,31,54,223,132,215,11,131,152,99,202,
+40,89,109,229,226,231,52,173,233,135,142,101,183,61,148,218,138,161,38,128,164,238,110,29,
+172,53,102,139,26,81,208,24,121,97,131,106,233,194,54,91,108,94,163,189,126,190,208,26,
+162,115,219,178,224,170,228,38,115,198,128,20,88,173,53,243,111,175,189,222,228,219,130,26,
+29,52,15,142,68,241,205,223,139,95,147,244,101,190,245,240,100,28,110,164,25,75,123,103,
+206,7,150,103,72,64,196,122,55,222,176,67,245,62,190,213,166,213,232,153,211,245,230,15,
+187,46,201,181,227,220,141,143,218,188,247,21,123,57,135,173,103,64,153,238,6,230,214,21,
+63,246,223,76,210,114,249,241,51,254,238,43,108,30,90,12,78,117,60,138,133,65,78,96,
+174,39,80,195,164,57,128,154,244,233,228,51,145,74,196,227,50,215,208,76,221,222,81,156,
+152,104,161,41,37,100,183,107,21,94,113,121,166,73,97,27,202,95,106,197,55,158,206,116,
+248,109,159,64,232,177,176,96,59,34,128,96,157,140,242,153,10,194,156,36,109,29,195,43,
+177,119,88,175,58,126,54,220,149,246,88,189,160,119,113,151,137,253,253,62,188,105,187,222,
+80,224,61,255,62,206,147,160,61,176,38,84,135,161,208,228,33,235,67,228,252,199,123,37,
+127,174,61,171,44,65,99,108,54,138,17,125,51,117,47,133,234,149,63,122,239,75,4,75,
+198,101,13,52,136,164,29,103,131,89,232,56,125,19,3,234,139,194,140,231,245,249,211,204,
+109,198,70,55,134,143,28,127,98,88,60,161,52,223,40,186,54,206,42,36,103,82,57,147,
+137,43,137,153,219,147,90,231,180,61,105,67,199,185,231,240,163,26,48,223,57,182,71,60,
+102,140,117,179,14,56,60,220,38,65,237,66,121,104,183,67,53,76,177,104,33,87,184,98,
+220,251,161,205,27,251,42,141,177,89,73,66,64,88,17,112,170,10,136,140,70,2,16,23,
+144,185,174,187,208,132,118,139,45,76,218,146,12,175,17,173,170,177,181,248,94,113,20,213,
+228,247,32,146,233,109,150,253,213,25,210,9,193,120,229,48,136,70,65,16,64,96,184,199,
+137,199,245,165,105,31,179,205,217,168,237,131,194,11,188,87,12,3,97,16,12,209,47,16,
+232,84,99,97,111,81,174,189,73,160,198,251,230,204,197,218,103,130,20,198,98,12,219,144,
+193,32,62,86,136,45,14,94,60,246,221,101,118,78,229,108,121,199,103,127,228,215,12,201,
+33,0,80,102,37,20,41,5,228,29,201,91,86,76,74,243,5,54,134,187,154,199,183,193,
+126,180,40,13,136,0,8,128,128,185,9,140,249,36,161,178,5,239,85,230,177,195,171,88,
+98,57,106,229,135,221,246,181,72,160,6,28,102,48,207,195,92,128,247,143,95,130,215,230,
+109,177,228,32,31,31,78,208,65,212,1,29,98,37,109,248,196,144,220,34,32,104,157,147,
+108,91,187,123,219,121,188,226,144,136,82,2,50,144,145,40,54,16,108,24,199,122,95,137,
+49,235,145,189,134,127,178,216,29,156,64,10,20,168,200,17,200,106,27,14,169,142,74,186,
+178,239,110,125,147,237,229,215,79,82,225,95,77,63,36,223,139,223,248,125,51,72,49,144,
+140,215,234,194,156,2,91,48,42,52,216,124,34,5,144,18,31,243,90,134,11,112,40,143,
+154,53,246,170,123,162,200,162,237,143,110,207,135,209,230,204,57,58,16,132,99,106,72,241,
+1,9,71,32,10,182,90,170,215,172,194,226,22,213,222,143,143,121,3,63,175,173,46,54,
+254,135,226,81,80,128,150,233,20,97,120,47,114,37,247,120,203,30,145,195,249,221,222,136,
+31,174,35,8,154,217,81,213,49,59,95,139,123,223,31,129,125,207,3,193,69,20,248,120,
+119,174,67,30,230,136,225,1,250,252,222,44,170,114,0,163,56,140,6,26,166,130,89,50,
+135,234,244,222,203,192,253,233,17,57,21,151,121,108,185,1,173,93,164,219,81,85,6,74,
+145,203,143,86,40,83,195,105,203,45,167,21,4,72,36,146,47,89,157,49,69,48,233,11,
+14,89,40,201,43,182,145,231,52,192,67,158,65,239,211,217,77,110,82,2,13,142,16,57,
+215,54,61,74,199,3,13,68,36,54,196,122,228,154,201,186,187,189,247,195,7,1,169,99,
+142,38,169,89,100,136,144,64,113,99,86,199,221,155,221,249,114,105,201,221,242,172,203,36,
+102,153,96,13,24,98,52,164,240,116,252,42,2,50,21,104,35,168,248,235,53,89,46,125,
+22,143,133,132,200,58,187,104,74,30,230,107,108,33,14,102,157,128,197,6,155,19,5,113,
+165,237,42,206,78,196,115,108,129,212,215,167,86,240,81,160,13,196,97,20,12,151,74,5,
+59,23,108,103,60,165,172,200,120,85,62,141,103,20,73,5,50,180,143,103,34,161,76,108,
+63,35,72,9,141,155,145,168,147,13,130,129,56,226,48,227,160,155,15,26,40,204,154,35,
+53,18,176,157,12,109,31,164,166,206,75,82,15,185,24,42,205,92,249,233,23,155,171,58,
+129,198,93,218,167,44,204,147,42,50,155,53,113,201,202,106,98,138,231,23,15,47,94,91,
+94,142,161,97,157,230,79,173,183,93,147,130,22,23,154,249,106,76,213,249,38,98,36,122,
+104,195,143,190,254,167,31,30,129,107,155,170,30,201,149,157,172,218,20,182,8,5,151,56,
+218,88,220,219,202,174,42,172,128,221,116,77,119,106,131,194,219,138,136,39,16,116,253,176,
+176,34,255,144,66,167,218,221,252,247,108,111,22,137,85,169,22,145,166,79,50,118,107,211,
+167,169,182,155,186,211,58,36,116,31,9,91,75,143,45,145,179,112,50,181,220,167,141,149,
+185,180,73,207,85,35,191,201,49,152,40,188,49,250,149,138,14,84,6,125,237,128,249,187,
+137,122,149,194,188,103,24,110,84,138,122,252,78,244,122,16,143,45,91,110,34,185,50,134,
+76,140,50,115,162,203,159,21,183,10,181,33,22,42,164,94,60,49,102,87,147,102,220,58,
+117,185,170,130,2,204,139,119,71,136,153,19,5,216,141,165,120,156,147,225,29,171,155,181,
+33,96,155,96,201,75,70,145,151,72,90,249,240,141,133,109,169,164,33,34,141,233,243,101,
+9,154,53,116,58,109,84,142,75,218,176,238,99,25,26,27,144,54,97,53,192,44,64,72,
+128,67,22,160,203,132,89,153,107,213,99,74,183,223,222,219,159,15,194,219,97,224,29,45,
+195,188,88,17,99,183,99,112,153,168,178,217,27,28,208,47,16,194,224,178,218,2,107,186,
+113,215,67,239,214,175,126,215,253,117,235,54,66,230,52,131,196,197,66,16,164,172,59,67,
+74,237,193,90,214,144,32,132,109,5,148,149,109,186,115,225,116,152,14,175,47,45,33,42,
+135,239,131,116,147,242,191,215,112,225,115,4,220,228,1,180,88,43,16,129,147,8,205,196,
+35,39,22,97,109,41,45,254,84,114,215,50,230,250,86,232,248,214,197,190,166,201,222,176,
+105,135,166,235,134,81,215,29,91,59,23,70,182,155,209,72,158,102,69,83,212,64,160,84,
+26,101,158,77,221,60,180,58,221,74,168,97,213,16,135,137,206,83,93,60,207,125,168,255,
+152,223,47,139,175,193,231,146,6,138,141,12,113,63,20,39,165,43,227,216,25,227,195,41,
+168,137,64,178,178,1,146,215,194,53,108,166,54,141,190,0,108,22,21,47,108,34,114,140,
+39,18,88,106,176,134,35,193,41,158,134,6,213,134,125,61,236,251,213,239,250,213,251,16,
+74,42,76,2,22,17,89,36,172,234,66,54,107,133,193,241,218,29,227,146,116,209,28,203,
+181,238,248,22,145,240,8,192,64,4,84,8,197,65,31,64,159,74,16,122,248,247,177,170,
+12,183,183,215,54,15,111,55,58,36,252,197,175,217,170,32,8,199,120,10,128,1,9,74,
+177,195,116,0,170,176,251,98,122,85,121,74,144,216,53,107,159,109,247,99,143,11,255,185,
+54,224,3,47,13,171,208,72,19,165,211,170,43,193,118,106,225,177,71,48,160,235,196,252,
+231,94,132,65,243,1,3,103,130,0,56,90,170,218,54,225,223,136,119,115,75,68,214,244,
+185,110,78,193,10,44,19,12,132,4,43,153,138,38,79,63,7,136,105,223,245,118,220,118,
+253,13,124,255,177,253,77,227,155,38,94,9,136,13,132,196,76,176,69,4,147,237,145,116,
+42,184,196,174,190,110,195,95,20,63,26,215,73,205,191,206,59,190,15,195,153,247,251,60,
+158,105,31,154,121,192,136,52,17,25,27,39,222,9,209,189,224,147,240,178,203,96,66,95,
+191,22,112,203,99,76,189,91,222,30,201,142,150,99,128,52,73,2,72,198,12,252,2,40,
+72,113,74,121,20,48,225,21,190,159,46,23,155,15,195,2,100,17,146,36,239,157,96,30,
+125,194,25,110,183,14,169,37,146,33,244,4,254,176,99,96,105,53,2,77,135,108,10,85,
+208,130,34,35,179,34,202,66,29,156,252,188,123,220,60,237,26,211,128,82,220,88,98,172,
+54,25,1,76,181,141,201,81,163,95,22,34,20,4,224,10,42,108,63,4,205,62,151,13,
+67,227,184,21,19,95,71,122,234,214,4,120,159,202,191,194,107,18,129,30,232,234,83,60,
+72,160,107,212,74,50,89,166,140,154,99,201,155,191,75,55,67,18,32,232,145,134,241,243,
+1,17,130,184,34,145,90,236,236,187,252,244,225,168,10,61,6,84,27,10,142,254,56,162,
+49,122,168,208,77,69,26,151,34,209,15,75,161,107,18,248,150,79,10,203,38,168,178,108,
+68,168,91,76,133,242,213,190,137,128,249,144,23,161,75,110,199,0,233,102,131,56,218,150,
+252,121,210,110,131,14,163,38,84,151,173,41,149,128,72,231,54,150,105,231,67,98,155,101,
+112,82,61,151,86,178,11,209,34,196,182,184,68,86,188,221,53,217,176,36,41,219,168,161,
+57,104,197,152,115,232,155,84,86,167,31,183,180,100,227,205,176,7,228,92,164,20,225,48,
+27,183,229,85,82,141,12,132,208,136,143,21,39,160,95,44,109,39,57,247,210,8,208,24,
+21,180,3,54,129,231,209,61,200,118,207,54,68,69,93,222,203,60,168,173,109,218,223,49,
+43,51,71,6,79,68,208,194,162,11,228,163,95,33,122,240,180,80,86,97,199,182,114,101,
+105,170,98,188,68,218,170,99,21,197,41,29,84,22,130,186,54,80,215,144,7,31,80,225,
+89,204,43,8,235,172,10,81,205,93,1,11,46,34,128,77,13,92,185,108,190,90,89,53,
+237,41,242,226,29,255,130,109,12,182,219,70,68,160,218,162,99,169,60,196,238,143,77,43,
+172,202,178,128,46,6,80,84,55,160,65,200,112,244,178,133,215,252,84,235,183,209,117,139,
+58,203,59,251,221,233,235,161,140,105,115,213,94,175,99,220,31,175,94,222,174,153,216,170,
+238,220,165,235,158,148,153,209,163,105,195,29,71,226,200,203,85,116,35,59,24,169,79,99,
+199,62,210,215,221,140,38,227,85,201,202,161,208,176,195,103,72,146,133,250,248,243,165,228,
+98,142,230,23,28,42,192,211,138,240,176,213,217,28,236,183,206,62,69,196,47,151,86,15,
+78,253,200,192,197,60,80,114,233,58,128,242,163,167,42,207,30,46,90,170,228,159,69,45,
+195,52,147,46,206,174,12,172,177,210,176,105,178,164,191,82,30,132,201,25,156,119,138,158,
+43,121,130,70,181,19,9,229,244,136,163,101,131,145,202,143,47,42,14,209,40,47,42,163,
+208,248,50,97,163,180,27,2,217,38,55,4,10,1,22,40,2,219,28,2,132,8,193,61,
+53,59,232,105,214,225,41,17,223,216,248,244,36,219,223,117,30,63,49,158,143,200,57,12,
+108,214,178,181,197,139,154,159,12,81,9,125,233,5,248,92,178,107,98,230,177,101,161,189,
+253,236,146,144,63,251,120,152,160,139,67,188,51,72,226,40,132,70,10,24,31,187,195,72,
+189,177,133,254,123,213,90,86,163,233,175,202,226,110,23,74,46,175,176,238,98,159,37,162,
+198,91,97,24,204,212,31,64,90,18,193,236,238,84,78,151,65,211,224,127,88,119,133,175,
+141,71,31,17,238,58,226,56,159,138,243,46,41,91,33,130,42,3,118,2,122,62,221,50,
+115,28,11,228,243,114,227,171,183,198,44,53,195,231,152,87,10,110,235,93,87,195,11,226,
+149,210,141,178,140,237,73,107,148,247,171,146,176,238,68,50,24,66,41,2,166,149,20,28,
+132,66,71,144,154,78,2,33,235,129,233,224,103,217,237,229,143,203,34,214,80,106,170,9,
+149,79,142,252,35,9,108,154,73,73,22,24,249,151,180,88,158,79,17,151,124,98,65,205,
+145,244,236,208,24,228,149,223,239,190,144,116,42,120,47,170,185,78,180,40,133,66,26,169,
+76,149,145,160,209,38,243,56,23,78,68,49,8,208,4,64,200,146,245,66,21,219,205,240,
+104,58,238,37,163,9,136,133,64,152,100,157,211,23,41,117,236,221,230,29,94,24,245,237,
+205,94,220,94,8,6,33,81,64,48,130,137,10,179,192,249,112,150,173,178,3,239,249,38,
+48,249,52,61,172,93,0,11,68,28,214,131,5,168,32,210,178,194,151,197,252,190,246,126,
+131,178,13,0,182,60,194,106,4,66,97,129,221,186,36,211,242,114,233,107,7,24,19,16,
+141,65,229,66,0,226,234,180,188,55,81,127,12,248,153,239,107,103,189,236,233,219,206,144,
+24,18,106,116,68,90,70,142,255,86,162,204,121,28,186,57,164,248,190,22,32,188,97,16,
+27,196,198,36,145,24,8,76,99,24,198,56,27,89,196,144,100,2,48,215,101,186,111,145,
+53,232,86,97,211,40,245,185,244,43,237,124,12,124,100,30,168,164,17,25,5,73,82,115,
+28,228,82,222,121,115,234,14,218,217,146,248,76,12,184,26,89,113,197,68,65,1,33,60,
+72,62,251,49,203,31,208,179,225,254,175,144,52,246,146,124,159,120,97,64,83,164,98,74,
+91,155,109,17,82,158,247,55,154,53,35,0,120,148,165,38,53,86,247,121,96,227,164,47,
+252,175,27,205,61,99,182,149,134,3,216,29,234,250,21,166,174,200,33,133,33,6,159,214,
+52,16,166,20,141,52,69,142,204,37,152,11,41,207,229,186,64,183,218,218,181,31,55,83,
+209,132,87,12,193,27,183,74,248,170,168,77,220,191,152,38,137,222,244,151,253,254,152,59,
+236,196,12,11,164,224,136,17,232,13,58,30,219,239,114,114,129,150,60,129,217,118,85,202,
+244,59,205,35,142,34,33,201,110,143,16,254,69,240,6,25,19,19,80,53,175,102,91,116,
+235,98,197,20,134,47,227,212,116,245,229,203,139,82,14,166,94,98,109,86,135,4,20,145,
+42,190,171,155,22,217,105,22,198,146,97,16,86,103,220,137,173,253,86,167,149,10,145,231,
+213,185,141,80,98,72,48,187,204,191,56,39,220,157,111,184,138,201,207,64,33,163,101,242,
+27,90,100,86,36,231,212,97,213,240,130,145,102,133,228,34,25,94,56,163,129,171,108,117,
+158,4,155,65,70,159,64,155,220,165,77,6,85,214,228,114,8,139,164,214,245,13,76,200,
+156,87,230,211,162,227,215,184,177,163,70,11,212,117,56,116,180,56,121,132,219,139,11,140,
+160,9,66,141,48,137,23,156,30,91,81,167,33,196,206,226,174,73,202,80,184,125,180,14,
+83,120,109,121,97,7,211,103,232,122,225,215,206,138,121,224,15,101,114,249,238,70,253,134,
+119,209,141,215,69,240,44,16,110,178,7,61,167,150,2,239,166,224,133,115,246,153,117,28,
+135,193,232,122,30,79,44,184,3,72,127,170,171,151,88,64,64,17,237,39,141,138,153,153,
+51,244,100,226,4,76,4,5,93,51,249,197,1,116,76,136,161,6,80,186,72,3,97,8,
+107,240,239,167,186,169,220,246,155,6,9,138,86,132,195,70,26,24,32,65,13,157,212,105,
+16,33,82,0,251,97,254,70,125,126,31,87,231,249,158,47,121,246,21,140,96,6,8,152,
+8,16,38,83,121,231,61,105,244,59,243,252,56,15,118,92,228,61,117,238,23,55,201,176,
+201,18,125,242,98,97,95,76,37,231,39,14,28,250,217,118,148,65,253,101,18,137,65,43,
+249,244,93,172,45,71,38,55,48,81,149,163,155,50,206,27,80,194,44,32,97,26,18,32,
+107,96,171,110,164,86,208,167,185,185,116,229,172,74,63,94,52,188,18,202,94,222,91,178,
+45,208,134,255,112,167,161,83,35,98,51,201,185,148,183,49,3,97,89,150,61,11,196,119,
+32,175,149,102,138,151,23,49,39,130,18,122,45,161,75,118,212,195,164,103,153,63,153,200,
+145,196,159,172,154,27,49,185,93,41,188,89,255,228,185,153,148,253,61,100,100,99,209,210,
+153,142,25,65,104,45,111,89,200,218,81,247,240,58,75,238,36,93,237,147,158,39,59,135,
+194,141,8,129,90,38,221,96,40,64,33,1,120,210,58,225,80,6,94,225,168,29,34,121,
+136,136,221,114,14,49,76,81,133,186,143,10,140,211,209,219,203,37,67,14,170,67,47,37,
+83,247,160,176,79,173,67,187,248,13,203,211,131,144,62,118,63,13,93,6,210,231,136,126,
+131,229,21,95,206,181,101,100,185,98,179,185,193,157,164,220,54,38,81,32,163,193,92,103,
+242,253,41,165,67,143,79,79,65,70,53,126,255,182,71,42,173,225,230,70,84,51,228,243,
+18,250,38,113,24,35,88,49,73,228,228,67,242,109,161,106,66,46,137,131,103,210,54,49,
+239,16,181,168,213,159,77,38,147,42,55,213,158,215,107,115,171,124,189,42,82,190,228,85,
+204,120,48,68,112,88,253,154,21,193,180,10,146,8,31,59,62,68,13,90,215,164,35,86,
+91,207,2,37,61,86,171,108,103,133,184,110,32,79,192,153,26,85,11,246,184,172,146,233,
+200,34,185,98,140,234,21,6,182,82,50,97,67,243,29,115,107,247,183,72,148,132,15,62,
+63,109,214,206,0,115,10,33,129,196,95,161,46,143,160,40,139,73,156,114,12,90,35,136,
+169,233,130,25,208,134,180,38,224,207,236,172,191,117,120,87,208,30,234,213,136,189,121,17,
+153,128,193,8,214,11,123,156,195,205,189,191,119,158,253,240,222,185,160,133,224,33,7,130,
+226,47,136,89,244,62,219,218,122,243,13,14,40,216,8,138,151,137,0,128,189,172,12,115,
+107,30,84,159,42,41,126,127,102,39,210,243,180,16,16,253,242,9,68,194,161,160,177,228,
+168,96,236,135,227,221,114,106,232,252,238,81,62,164,1,211,215,206,233,222,0,236,180,74,
+107,249,178,252,55,245,102,248,113,16,236,132,207,54,130,175,75,239,134,151,228,211,213,242,
+63,8,127,3,201,115,240,64,67,20,41,49,192,136,43,135,61,115,83,10,188,221,207,100,
+159,31,248,159,202,224,228,48,8,194,145,37,34,184,198,4,32,192,64,101,4,133,65,237,
+200,150,57,141,78,24,62,102,55,136,191,147,188,230,102,81,215,124,159,219,218,105,134,91,
+150,32,36,144,148,233,21,237,57,147,82,75,176,96,202,165,151,55,176,15,177,134,84,144,
+111,220,37,159,151,197,217,23,163,26,244,237,144,243,183,117,169,125,40,33,187,185,95,11,
+93,157,31,12,127,44,111,54,200,189,68,129,186,90,220,252,75,47,20,77,107,56,156,0,
+198,144,136,29,243,125,37,91,117,251,63,73,120,133,177,6,185,247,26,45,234,195,228,23,
+55,120,139,205,250,73,105,129,152,140,35,238,186,60,243,107,239,177,16,178,200,23,141,157,
+199,79,57,42,2,117,200,11,99,145,125,124,33,96,23,182,102,124,207,8,199,177,28,93,
+137,158,78,15,38,68,106,14,94,227,108,64,34,44,40,192,26,166,60,123,196,220,58,172,
+150,190,218,157,138,141,11,210,102,189,222,233,100,112,194,141,82,57,92,211,62,88,63,36,
+153,122,131,46,245,15,233,121,161,159,109,247,156,32,130,152,237,98,59,221,135,43,63,67,
+96,248,74,2,97,46,65,19,85,138,27,21,175,243,121,219,233,32,38,49,65,72,26,171,
+160,41,20,106,93,130,139,143,80,174,106,137,86,14,25,167,71,102,19,249,86,86,64,124,
+215,207,50,5,192,142,46,9,134,89,80,13,80,131,179,162,95,215,142,21,82,87,159,197,
+9,116,28,173,42,121,252,23,249,23,162,202,217,140,17,161,27,102,49,142,41,189,158,69,
+72,182,55,243,184,151,120,196,114,227,100,151,84,238,116,137,167,61,158,146,116,249,40,208,
+128,100,40,188,58,186,4,190,174,72,167,88,202,63,34,205,185,50,174,113,231,131,136,195,
+182,152,114,75,115,34,21,34,95,175,94,74,68,220,142,144,140,161,11,121,126,41,163,66,
+229,58,44,146,106,47,0,2,201,97,125,114,77,213,100,209,40,189,187,168,193,182,193,116,
+230,18,84,41,247,28,196,7,51,2,120,179,33,234,190,209,68,188,35,82,200,91,33,213,
+223,61,247,228,68,51,250,122,81,170,213,207,188,19,87,214,165,22,142,246,113,111,217,149,
+54,234,27,170,137,108,184,106,227,28,146,143,59,84,78,102,61,175,165,142,84,146,148,33,
+121,83,22,209,72,241,93,41,173,4,169,226,248,109,226,50,35,85,173,80,185,153,164,43,
+26,108,102,161,24,90,121,48,149,218,219,89,38,58,31,4,233,2,64,250,175,209,230,153,
+62,137,89,10,108,66,200,24,82,83,149,10,166,201,208,167,46,76,186,147,91,217,84,129,
+138,36,19,138,214,224,204,110,77,179,18,131,86,78,13,216,145,28,66,177,178,176,240,215,
+11,128,34,8,35,101,26,124,128,181,43,51,71,21,114,233,134,189,67,110,240,151,85,113,
+130,217,102,106,207,146,174,227,42,166,70,208,136,238,156,168,58,9,39,151,160,209,239,29,
+160,117,69,33,36,4,209,77,135,111,50,181,12,72,166,97,23,83,194,91,110,33,241,91,
+202,198,89,172,89,23,220,127,23,193,194,56,142,79,233,126,86,2,216,209,250,24,136,200,
+7,135,81,233,249,141,153,61,69,225,86,77,124,42,58,45,14,113,49,210,174,249,184,57,
+191,93,208,88,35,236,122,170,150,220,219,247,166,212,150,123,143,170,249,150,27,224,129,24,
+67,38,158,36,166,96,34,3,74,14,0,113,138,92,45,89,156,80,219,241,166,169,152,88,
+211,113,61,79,194,32,187,207,170,113,126,181,133,6,72,143,203,236,36,175,242,124,177,89,
+85,147,80,137,163,183,34,189,135,104,124,64,242,219,44,190,225,31,89,228,95,225,215,92,
+23,164,38,16,148,99,144,67,25,145,162,213,167,44,158,248,159,49,163,79,147,84,81,68,
+243,98,240,196,4,152,147,157,53,85,24,252,218,17,31,217,123,233,122,17,118,19,9,24,
+33,57,83,134,200,92,157,235,49,242,228,237,220,98,143,230,68,16,196,98,7,232,64,14,
+93,144,19,157,111,123,117,159,163,217,240,122,209,47,75,193,104,168,17,114,3,9,89,211,
+103,132,28,105,224,179,186,61,41,235,126,161,80,50,132,148,3,8,98,42,102,112,183,166,
+34,143,157,149,249,228,177,255,214,139,85,75,194,166,247,12,160,113,237,32,67,250,82,58,
+29,200,40,205,141,66,65,89,178,56,28,72,102,22,91,115,116,173,227,244,114,248,188,127,
+59,106,50,249,16,128,76,88,185,211,132,102,27,251,85,190,14,254,220,252,21,61,3,228,
+80,41,225,16,49,236,202,190,237,61,230,159,6,236,135,222,133,232,168,125,125,66,161,32,
+183,17,0,152,16,70,21,49,202,21,104,13,250,95,228,239,216,247,89,111,101,68,247,210,
+233,133,68,153,148,157,117,87,95,153,85,137,84,121,48,170,212,229,82,176,211,189,41,24,
+5,41,57,82,100,195,193,122,203,67,39,152,66,70,2,157,35,29,253,38,207,221,250,25,
+11,69,72,157,22,221,45,117,251,111,206,237,72,213,167,224,237,21,223,136,180,8,75,45,
+17,93,24,249,100,215,13,9,168,160,136,34,141,88,81,47,90,65,16,165,253,223,200,122,
+41,192,20,4,237,209,80,154,232,163,167,140,230,24,112,226,72,117,211,157,104,51,200,6,
+211,190,113,243,81,192,67,132,93,89,220,183,132,72,144,74,167,26,34,208,35,189,247,125,
+58,219,125,225,227,115,234,82,215,204,239,92,139,178,20,19,85,157,169,103,90,207,30,89,
+114,243,84,219,206,52,89,56,40,240,247,153,142,52,39,4,180,163,130,225,56,124,118,182,
+255,177,204,7,175,245,28,137,174,80,56,231,130,38,254,47,211,76,78,52,228,165,239,110,
+177,217,33,57,113,1,85,112,33,151,154,105,146,165,29,14,59,233,255,121,179,142,6,96,
+75,97,41,123,97,79,20,100,220,48,17,69,23,156,21,61,138,25,228,136,153,60,212,68,
+140,118,197,89,171,219,51,183,244,171,169,88,222,41,115,225,21,112,185,116,88,228,60,236,
+240,165,43,89,230,4,57,148,56,211,133,198,94,41,178,44,169,194,191,200,58,195,123,124,
+60,206,99,192,65,252,126,69,137,58,17,220,127,4,76,28,88,186,251,139,14,94,42,216,
+48,115,65,114,180,179,250,133,242,167,178,181,184,44,214,206,55,62,14,80,102,83,91,147,
+44,243,155,55,107,78,52,38,56,240,251,216,50,38,85,83,29,53,137,173,200,120,184,240,
+221,152,118,29,156,130,164,109,29,152,141,221,5,245,238,170,96,30,197,152,164,137,132,146,
+128,131,106,21,97,36,101,23,120,136,177,70,44,141,78,53,163,140,163,17,92,169,112,244,
+114,43,230,235,55,216,207,166,74,28,151,115,109,23,14,171,77,175,46,214,181,10,115,19,
+135,90,82,156,11,57,48,135,98,178,75,176,44,122,47,79,140,91,14,81,8,168,30,217,
+117,168,14,17,107,47,31,86,67,186,82,101,78,126,156,189,116,47,69,93,217,206,219,42,
+37,250,116,249,254,89,209,182,55,24,213,211,150,162,204,41,62,36,108,192,158,237,74,137,
+83,68,168,84,134,73,246,14,94,182,44,196,111,143,13,121,125,221,187,154,217,83,179,211,
+206,217,180,163,68,185,143,6,107,185,215,95,62,209,49,42,124,41,35,163,60,55,37,31,
+5,230,24,118,101,107,229,62,180,127,39,177,13,52,142,17,119,141,206,130,161,61,146,74,
+162,238,219,211,56,152,196,231,72,3,130,88,184,228,0,20,2,32,157,252,252,227,116,245,
+183,203,59,25,41,28,36,186,63,18,217,200,151,146,158,124,207,130,148,242,190,47,119,216,
+193,45,250,163,135,14,7,37,107,111,62,24,234,134,174,96,252,214,154,121,170,212,10,159,
+153,235,172,9,219,89,233,130,23,197,178,193,90,195,140,94,175,104,84,117,233,249,226,230,
+202,34,41,86,98,12,77,35,195,107,182,188,69,196,168,61,183,56,77,173,7,100,230,235,
+19,188,230,161,137,225,191,223,73,147,125,205,231,192,30,180,179,93,101,172,109,56,108,41,
+140,231,51,110,71,214,255,146,152,59,71,186,191,85,24,195,217,189,42,11,94,25,110,219,
+159,113,150,144,141,244,136,55,129,167,48,89,66,14,182,52,143,195,8,164,10,188,227,150,
+173,146,181,36,210,204,22,90,7,11,41,209,18,67,33,251,159,63,163,91,128,235,210,194,
+5,231,62,99,146,31,208,180,140,158,13,4,29,84,215,243,49,112,131,51,184,42,56,36,
+232,60,220,112,65,173,138,51,130,158,52,233,125,230,159,8,76,58,143,118,207,195,247,117,
+89,229,91,170,180,79,211,101,172,188,24,141,98,14,137,132,19,86,205,92,126,22,197,47,
+243,176,195,145,8,26,231,93,80,12,52,253,180,236,122,46,255,139,37,118,144,60,14,54,
+26,240,8,97,191,5,120,213,130,126,16,232,247,181,124,223,166,126,132,182,34,160,0,205,
+43,14,196,47,86,254,240,237,26,128,93,253,146,116,20,116,68,5,65,232,16,80,148,230,
+16,242,111,207,132,181,26,21,112,200,158,18,130,241,171,44,117,148,214,38,3,196,150,84,
+3,2,202,167,12,218,41,105,242,112,17,152,99,142,137,135,76,79,168,114,65,124,251,252,
+83,227,218,107,112,105,198,212,104,72,194,64,65,116,212,8,157,247,231,135,136,101,205,127,
+30,244,51,182,29,169,1,72,121,162,18,33,33,71,97,200,76,168,58,254,56,130,251,59,
+41,250,122,123,214,45,226,71,226,253,203,241,8,66,42,10,107,139,101,237,70,141,188,45,
+31,12,87,205,199,73,109,207,220,133,104,227,140,226,4,79,167,119,131,162,99,186,30,94,
+244,77,103,196,128,23,210,14,137,184,88,86,107,225,191,91,159,131,243,100,97,73,167,124,
+166,118,109,186,246,193,217,3,113,0,168,208,212,46,25,172,219,209,167,175,239,123,158,124,
+41,141,208,180,94,45,179,76,238,207,54,173,12,203,89,100,46,80,222,86,218,68,24,140,
+43,181,235,168,116,252,79,198,207,132,93,101,240,13,176,117,98,223,212,119,215,130,83,109,
+56,177,175,158,214,180,202,42,240,121,55,182,224,131,229,193,173,111,99,230,240,181,223,25,
+104,64,81,21,17,84,49,183,29,148,238,145,166,157,132,194,2,83,34,190,233,14,129,249,
+52,167,162,140,77,25,106,50,226,95,212,142,109,51,36,26,211,227,102,80,220,150,164,169,
+124,226,209,18,232,227,175,190,195,208,193,231,237,65,187,36,75,3,97,80,229,21,113,12,
+168,250,231,64,228,30,51,194,164,168,65,90,45,85,84,144,90,211,66,141,91,81,221,227,
+89,224,240,118,80,90,204,168,145,31,186,205,19,165,229,221,78,124,100,221,188,99,123,110,
+191,193,53,221,61,217,27,171,228,238,7,46,229,237,131,169,226,154,190,143,44,220,94,226,
+62,42,167,233,154,74,137,47,58,67,20,162,109,67,229,58,180,184,193,39,50,79,4,99,
+212,181,107,181,86,174,168,140,88,223,2,135,169,46,212,26,0,78,46,103,17,46,116,98,
+94,92,43,139,164,188,72,145,111,91,190,155,203,74,31,214,120,55,124,110,226,171,158,31,
+6,217,82,1,107,190,218,167,63,6,214,218,186,46,75,86,244,104,76,117,102,222,245,246,
+43,66,167,6,133,212,178,47,7,86,41,240,144,71,4,126,34,27,148,114,146,120,78,101,
+206,164,174,174,174,173,46,49,65,157,4,28,215,155,177,206,154,254,132,188,228,1,152,208,
+116,136,58,90,204,100,71,224,145,31,251,178,220,78,60,55,40,234,106,217,146,143,30,147,
+35,43,110,142,188,204,141,220,155,23,143,193,101,252,244,123,118,235,222,73,219,153,21,22,
+135,17,215,216,200,178,148,168,163,134,128,79,254,165,77,157,149,63,178,111,28,233,113,119,
+162,41,119,171,207,41,201,7,245,139,135,69,34,166,230,149,167,9,173,238,79,86,233,85,
+30,142,167,7,27,171,166,51,16,50,79,51,140,28,106,132,145,79,144,28,126,49,133,19,
+200,47,38,248,195,126,1,219,2,19,218,59,167,67,201,225,6,231,40,71,113,130,208,180,
+155,84,220,2,26,165,180,10,20,103,20,171,220,166,148,36,203,231,7,248,255,165,2,75,
+45,145,116,149,20,11,165,135,102,5,7,70,239,177,246,50,69,90,138,89,173,39,82,79,
+161,171,165,243,43,37,157,121,242,108,228,9,161,5,215,184,23,194,142,86,132,56,239,221,
+213,164,32,178,173,242,200,220,250,155,25,97,2,118,72,42,64,75,147,254,60,140,7,58,
+31,103,159,123,87,131,233,212,150,185,101,186,216,26,201,176,61,15,59,53,209,28,93,204,
+250,186,173,185,247,214,192,48,33,93,18,174,144,84,4,128,85,180,145,30,118,231,55,216,
+151,84,89,152,32,117,226,90,200,44,132,161,251,102,87,227,127,13,15,215,164,246,218,123,
+98,67,218,48,164,221,89,216,39,125,243,51,245,192,217,133,208,6,220,121,15,230,62,197,
+92,6,240,119,189,81,205,35,27,27,12,15,168,200,157,200,66,1,72,138,4,4,202,228,
+100,208,109,190,252,116,252,222,140,69,156,30,8,221,60,36,254,248,36,144,55,106,205,79,
+140,119,253,247,246,34,245,89,117,252,210,101,1,35,97,136,43,95,31,62,123,94,90,86,
+155,38,78,77,181,92,94,111,180,105,244,160,61,14,105,32,25,16,33,221,179,183,52,239,
+113,14,248,219,135,137,115,158,250,43,17,132,194,6,157,62,26,219,225,178,189,8,235,175,
+181,225,246,42,19,23,24,0,132,33,70,172,20,86,188,61,46,89,208,118,117,233,32,136,
+9,36,178,136,32,0,158,108,56,96,183,101,10,130,224,215,119,132,26,4,94,46,221,156,
+187,250,122,119,243,95,243,56,220,144,152,66,16,222,38,65,195,91,254,44,54,120,252,59,
+114,232,243,124,211,123,79,190,167,77,145,28,14,9,136,80,39,0,56,8,128,156,8,0,
+136,12,21,68,236,30,78,247,40,59,26,101,33,200,74,6,234,153,115,81,173,34,70,249,
+128,145,232,136,129,77,38,115,112,226,91,176,244,136,215,49,167,78,64,214,142,168,235,38,
+77,252,94,142,244,140,178,200,147,102,224,201,95,105,188,183,44,172,12,144,137,2,228,104,
+15,138,188,78,105,154,163,170,111,127,177,189,238,144,140,87,65,183,21,248,184,211,169,213,
+152,234,73,56,237,180,241,231,235,190,64,154,60,66,24,66,51,55,137,196,44,212,199,28,
+12,141,69,174,52,41,38,131,128,249,134,199,40,149,176,107,107,149,107,102,150,201,39,233,
+187,234,106,135,69,134,4,248,25,140,209,232,123,200,89,68,141,240,166,62,164,5,11,44,
+53,203,223,212,237,44,104,191,203,188,60,119,4,50,15,143,229,158,189,145,139,174,101,37,
+120,201,85,209,196,172,115,69,248,31,6,215,188,207,165,104,139,162,168,142,137,40,170,114,
+57,124,29,224,46,18,71,187,97,146,133,161,152,0,148,160,40,163,133,72,248,102,105,97,
+61,126,124,245,81,142,106,155,80,222,89,87,198,149,14,191,15,151,65,126,85,227,113,167,
+210,229,80,143,46,199,10,158,77,24,179,35,2,28,237,171,176,114,103,202,111,167,142,211,
+53,20,127,55,160,197,82,247,162,20,235,175,216,86,91,200,213,199,181,87,133,220,88,138,
+60,41,175,98,226,239,41,81,235,155,29,70,146,55,66,138,24,179,179,76,57,188,58,140,
+63,164,181,67,65,51,149,3,247,135,51,155,85,34,233,168,87,26,12,30,105,218,71,212,
+226,69,53,123,239,44,191,94,145,18,120,198,177,167,152,80,50,82,107,167,40,113,38,121,
+55,103,95,203,205,114,30,86,204,36,242,22,38,113,230,41,85,237,57,19,46,111,234,154,
+180,107,73,216,153,205,168,23,249,150,238,166,133,23,202,126,97,182,17,224,241,105,244,44,
+52,172,74,145,210,204,22,182,112,105,179,163,131,146,44,237,87,39,212,180,237,200,53,42,
+154,85,39,108,65,167,64,137,50,10,82,204,61,77,25,246,250,117,52,48,206,82,62,30,
+126,210,58,78,72,75,58,233,54,30,197,194,86,127,83,180,78,224,163,232,213,197,168,214,
+28,236,25,210,176,177,219,199,165,138,128,222,77,86,112,191,240,103,116,58,92,114,56,184,
+246,192,173,77,140,90,165,151,3,157,202,221,69,13,210,24,96,92,210,206,7,17,220,92,
+102,240,248,101,38,13,30,54,139,228,25,193,72,70,104,1,36,113,140,119,243,58,73,69,
+116,50,6,73,78,156,193,3,95,43,118,91,114,230,108,227,11,141,11,28,126,183,218,169,
+221,246,140,93,12,180,187,161,197,82,143,243,13,112,128,91,115,201,112,16,68,186,29,114,
+190,142,40,136,155,149,173,44,144,68,81,218,198,201,74,253,124,216,57,255,77,40,151,130,
+102,239,178,104,46,250,95,68,213,164,24,7,179,220,22,171,11,2,170,129,124,107,9,23,
+26,51,110,210,240,90,117,175,171,229,94,129,64,84,3,25,247,33,137,118,63,166,23,164,
+123,45,177,211,134,231,12,193,80,137,210,123,211,39,100,204,251,237,32,209,83,14,169,62,
+63,130,25,19,95,219,251,7,33,71,134,124,252,154,32,59,200,93,248,21,57,136,76,100,
+21,208,177,160,116,219,16,196,189,229,169,235,20,251,55,72,211,121,194,210,74,3,187,100,
+128,149,205,182,169,93,211,187,239,64,103,54,25,253,143,61,49,214,216,171,149,229,35,251,
+108,94,186,217,84,21,213,242,73,240,69,5,140,16,68,32,184,227,37,150,2,86,86,93,
+120,167,221,40,25,223,208,126,44,165,178,0,43,34,128,232,16,130,202,201,255,14,218,221,
+62,184,217,7,166,146,51,234,114,115,204,222,201,176,21,29,105,94,151,113,156,171,32,130,
+7,95,152,167,202,173,153,209,250,12,186,166,32,32,4,34,205,85,69,244,154,62,175,101,
+94,255,167,221,157,199,84,208,32,161,14,135,241,144,44,234,209,208,57,125,44,169,136,131,
+98,34,62,12,152,107,104,91,86,191,185,129,250,63,117,223,212,237,0,35,213,7,142,164,
+32,52,229,183,161,239,12,139,132,238,180,225,142,45,56,70,58,174,3,212,178,116,180,156,
+52,227,206,1,8,25,32,0,130,70,0,65,16,211,38,82,109,190,230,25,113,113,236,95,
+191,201,142,232,119,182,182,220,112,29,27,64,40,14,130,163,36,36,178,173,120,24,185,30,
+62,214,207,43,169,231,223,189,69,80,97,133,192,128,0,146,56,20,10,172,60,28,99,10,
+33,186,80,93,205,98,120,172,250,116,119,182,56,219,233,124,126,191,238,88,45,151,137,2,
+124,174,255,137,122,241,55,176,159,153,12,218,121,102,110,45,199,127,183,234,123,246,76,79,
+98,58,8,132,67,183,231,247,107,24,90,143,47,67,133,190,127,206,246,188,127,79,231,82,
+51,157,228,114,201,13,160,48,162,153,20,77,5,28,111,83,0,102,231,248,118,146,145,2,
+19,74,206,214,75,81,8,240,234,34,224,143,166,227,101,101,190,197,57,73,215,70,248,142,
+54,181,58,242,62,172,232,70,131,39,208,151,142,76,168,152,51,244,227,194,26,18,162,79,
+34,140,107,39,178,192,180,41,156,215,86,61,110,170,134,59,92,70,72,163,92,65,202,171,
+207,131,123,89,23,79,162,67,184,167,47,53,209,96,135,5,10,93,3,65,163,161,154,85,
+250,132,153,67,128,236,61,114,160,52,166,150,74,37,20,133,58,157,46,166,7,27,94,5,
+230,179,137,74,193,220,211,72,33,249,13,210,45,103,122,78,116,246,55,201,167,31,65,212,
+51,224,224,203,168,26,252,254,52,23,84,175,59,144,39,219,191,191,87,154,185,91,185,119,
+99,59,145,171,66,59,27,208,249,184,115,43,22,69,37,67,135,22,217,183,118,182,108,148,
+229,89,216,108,43,39,108,21,136,24,194,240,225,76,234,83,206,146,100,210,99,92,134,158,
+175,82,167,192,195,28,150,167,110,155,105,4,139,165,231,81,20,51,168,196,144,169,52,132,
+67,169,59,26,185,168,221,161,37,26,153,145,27,9,118,122,134,81,179,202,47,62,161,241,
+226,151,148,205,38,116,155,57,76,158,115,18,58,124,55,175,208,232,40,158,84,164,118,234,
+100,229,243,156,164,151,2,219,59,121,16,245,230,13,61,195,90,144,175,90,108,146,28,192,
+96,119,208,126,165,62,124,215,215,151,158,215,77,41,252,4,86,153,107,133,126,84,142,177,
+48,225,36,90,222,174,119,145,3,21,107,69,179,50,80,66,115,214,181,139,218,208,141,214,
+156,162,69,246,27,50,157,78,142,54,123,74,103,53,39,225,217,237,193,191,39,151,79,145,
+74,55,51,147,157,14,12,157,136,87,178,179,232,245,57,217,219,253,160,128,209,35,10,162,
+0,218,16,68,230,114,139,39,164,96,230,10,185,35,60,93,84,120,93,58,122,229,110,245,
+75,53,66,25,19,26,230,236,192,103,241,231,180,144,249,89,156,242,40,184,25,125,139,172,
+4,68,150,125,238,239,59,13,138,176,250,188,201,122,195,90,196,131,127,155,151,215,181,166,
+77,89,35,39,33,20,113,39,232,60,219,17,240,85,179,39,58,125,62,195,222,239,165,98,
+49,47,109,38,230,202,205,46,34,146,214,107,246,214,81,14,100,166,215,216,235,27,194,142,
+171,219,8,183,183,134,237,176,225,213,236,125,252,190,253,157,238,31,29,235,60,123,188,86,
+191,10,100,144,224,123,1,253,134,39,231,95,206,177,234,252,197,172,62,181,97,226,205,155,
+45,86,27,85,52,243,80,211,206,193,36,132,17,253,38,86,17,45,222,171,163,118,29,176,
+12,71,60,46,157,182,222,230,193,243,140,126,46,123,121,197,93,48,6,187,3,94,211,239,
+37,227,7,254,173,91,117,73,166,62,81,35,100,230,55,212,82,2,209,63,33,68,3,119,
+41,141,26,0,182,1,123,223,102,216,171,135,135,208,200,57,247,158,5,50,209,112,239,54,
+246,219,91,133,13,154,56,163,38,240,22,248,113,246,177,120,177,15,200,232,58,166,247,148,
+49,5,135,115,124,2,78,118,60,45,234,233,142,200,52,57,0,192,244,166,23,131,46,59,
+153,240,217,70,49,235,121,234,48,224,240,115,113,240,87,183,42,234,252,4,177,254,222,96,
+243,225,198,51,5,99,186,229,178,199,218,243,126,151,239,87,161,149,29,21,4,63,30,102,
+13,162,8,240,86,109,116,204,101,34,22,133,66,16,80,65,6,34,4,202,135,116,254,14,
+89,103,10,0,133,0,0,241,64,28,148,197,110,101,75,114,174,168,120,46,46,168,160,36,
+192,193,43,44,99,218,222,226,180,226,160,8,182,13,83,203,83,122,99,241,121,155,138,57,
+56,109,127,200,252,3,58,80,38,237,50,136,180,230,18,241,92,237,43,87,239,124,95,71,
+197,59,42,112,68,22,221,229,37,155,188,158,215,199,240,255,35,245,241,182,160,76,13,72,
+193,123,4,2,4,186,221,93,223,106,112,177,225,42,38,30,103,55,37,246,17,7,216,129,
+163,149,43,160,73,88,30,53,225,155,102,132,205,3,14,17,224,56,35,58,193,239,202,117,
+133,32,42,43,116,119,88,208,49,33,6,80,41,0,229,242,149,2,209,44,176,149,158,142,
+142,127,198,225,166,136,241,86,189,152,228,114,139,9,169,196,52,15,215,119,239,63,118,198,
+19,172,15,200,67,55,165,250,60,32,175,4,99,33,242,29,77,129,14,98,231,133,131,143,
+126,214,106,245,229,36,109,184,146,44,68,190,231,47,103,97,35,146,148,136,73,124,28,186,
+118,78,99,0,129,198,232,114,229,18,89,85,193,169,30,124,147,225,161,164,251,72,39,73,
+232,201,197,52,74,144,225,155,171,65,110,8,205,148,188,222,38,66,149,141,150,135,59,79,
+71,28,151,163,130,18,148,227,107,95,237,110,224,74,212,89,245,92,208,236,55,191,23,122,
+229,220,232,162,207,219,153,168,215,94,34,221,126,34,121,215,110,189,189,199,207,234,73,205,
+161,243,87,154,152,250,123,150,33,101,117,105,226,139,208,14,205,109,220,151,26,23,28,84,
+34,205,171,25,191,135,33,222,214,231,63,131,58,244,213,41,48,253,58,61,110,82,214,227,
+163,71,97,6,119,161,234,193,82,239,246,215,141,44,161,44,122,210,58,134,65,54,55,85,
+0,154,73,47,143,180,201,135,198,52,44,152,113,148,144,138,123,79,110,243,91,110,159,10,
+252,218,244,76,119,142,159,114,194,140,10,222,238,24,82,32,138,196,220,146,142,19,60,73,
+48,98,73,228,203,199,110,201,136,238,202,224,151,207,126,204,235,183,42,76,232,106,227,147,
+22,104,102,104,243,156,184,190,166,234,12,171,174,140,151,206,206,134,213,131,249,77,79,155,
+134,148,180,247,229,96,141,205,180,145,146,19,217,172,115,197,87,212,204,236,110,109,48,180,
+218,205,30,159,221,126,78,218,245,187,50,6,213,72,108,79,232,175,219,67,127,50,137,60,
+138,125,180,246,52,52,195,87,134,77,254,118,206,133,108,254,222,100,124,211,54,169,92,141,
+131,177,171,167,170,208,161,25,212,231,246,195,153,175,95,112,10,17,83,13,202,230,115,121,
+68,83,71,127,152,29,52,100,141,62,158,64,166,127,249,168,78,175,205,244,246,251,56,217,
+109,181,253,79,150,168,123,65,191,43,95,209,251,182,55,125,62,11,218,215,175,224,132,236,
+202,4,247,85,26,65,176,145,64,225,29,201,79,211,253,107,39,2,40,190,86,32,248,199,
+50,61,129,255,95,134,253,13,207,124,112,57,223,6,63,75,34,12,187,12,103,121,61,170,
+243,249,196,210,247,41,190,186,96,237,227,134,199,213,7,229,101,255,71,244,40,62,253,217,
+125,199,245,222,249,112,126,190,147,217,214,209,114,88,190,9,100,158,76,135,220,196,49,6,
+9,241,250,133,249,208,48,18,196,107,23,85,243,39,36,206,203,169,78,141,90,178,148,243,
+176,232,148,37,88,200,132,33,62,205,139,34,114,84,114,105,202,169,96,89,165,142,236,62,
+15,151,229,85,200,247,106,25,168,64,201,3,234,83,162,93,2,184,103,103,53,7,234,116,
+116,153,109,31,118,221,25,240,156,168,31,51,76,188,47,144,83,166,32,221,151,208,189,124,
+70,102,138,105,183,60,203,155,62,188,252,61,16,105,149,232,64,95,2,82,0,49,104,29,
+146,110,143,30,17,63,189,192,210,213,98,19,237,38,178,51,28,12,133,36,247,252,111,58,
+132,97,168,10,141,98,3,176,57,36,62,197,174,116,53,228,116,123,176,220,111,3,54,148,
+5,132,192,18,51,187,211,239,241,242,90,181,249,246,200,88,64,17,9,145,176,172,161,230,
+14,145,187,207,167,231,151,146,203,39,97,1,242,144,122,89,165,174,142,167,133,166,65,241,
+81,150,200,8,64,78,98,0,17,189,186,93,237,115,115,187,126,159,131,235,71,107,238,11,
+130,243,196,10,139,135,30,241,244,178,207,52,217,116,9,32,104,37,155,34,35,113,66,191,
+250,199,156,32,129,133,49,218,110,223,38,36,185,88,232,136,124,111,79,87,161,207,89,65,
+0,132,168,128,66,5,68,56,241,122,125,77,253,115,65,188,57,153,161,49,164,229,136,192,
+50,86,116,169,54,116,216,135,201,70,116,250,16,166,44,90,195,190,214,104,57,146,175,27,
+131,253,249,10,38,142,130,106,144,55,150,91,84,155,52,121,60,206,81,225,28,245,78,16,
+180,136,40,228,55,8,93,4,176,60,120,37,163,224,232,135,181,47,255,146,227,122,9,73,
+124,190,100,63,4,137,2,11,193,62,144,191,185,85,64,85,87,105,46,189,63,45,38,129,
+213,221,105,177,17,83,111,125,153,233,245,122,127,27,190,102,84,108,93,128,158,28,233,143,
+217,69,13,244,247,155,163,68,237,90,239,68,184,132,151,114,219,21,221,58,70,187,22,97,
+26,204,193,31,29,249,41,227,189,176,136,78,168,124,22,89,93,7,6,25,104,232,185,211,
+143,215,126,134,185,81,137,55,39,59,83,124,181,218,106,82,52,205,188,228,202,97,84,74,
+57,104,45,180,232,202,217,128,150,180,180,149,149,51,87,117,147,194,70,25,110,221,52,205,
+121,145,144,206,106,230,127,29,40,155,6,244,56,150,123,184,83,155,53,46,35,18,211,219,
+116,173,86,144,157,143,96,183,54,167,103,226,227,165,195,183,197,205,103,164,91,123,100,246,
+161,15,177,26,17,70,22,144,206,54,92,226,207,71,57,167,250,112,182,168,32,105,11,232,
+254,51,72,87,28,211,212,83,174,100,233,143,233,79,120,181,79,208,15,52,58,173,193,31,
+115,159,144,133,35,120,143,67,42,82,160,78,134,86,151,98,181,14,206,38,81,66,214,198,
+141,89,177,117,40,229,178,156,152,42,76,205,218,18,243,32,209,43,166,29,178,250,217,20,
+185,109,238,173,14,117,92,190,133,187,78,240,16,13,46,97,59,8,114,178,102,116,11,200,
+180,222,9,48,117,155,205,171,90,17,52,122,119,56,16,246,157,25,107,212,228,240,176,82,
+181,35,99,135,4,37,125,49,45,86,177,35,46,143,247,209,255,118,118,230,5,70,254,191,
+184,84,185,213,204,98,92,16,22,92,142,25,234,122,117,84,112,193,0,136,89,218,71,217,
+92,49,110,197,163,126,151,0,28,85,219,2,224,64,171,228,44,43,70,178,8,90,98,8,
+21,168,213,121,156,190,153,230,162,45,110,33,68,242,148,47,172,182,156,220,173,234,153,108,
+100,11,40,93,72,78,9,161,1,29,98,22,227,146,4,160,13,117,69,156,251,173,253,71,
+109,252,175,168,147,139,253,218,17,222,188,237,133,20,62,194,106,143,44,119,28,242,100,187,
+55,106,230,135,116,181,170,181,67,153,154,149,66,37,142,105,65,238,234,145,131,93,221,133,
+220,235,52,186,149,61,147,65,193,61,204,48,213,109,233,198,51,252,57,71,119,197,106,138,
+53,250,40,105,146,182,155,212,7,105,242,189,180,147,80,94,162,88,118,158,60,61,19,8,
+238,205,224,85,23,215,218,170,5,249,135,93,209,62,29,63,148,132,163,236,26,127,130,181,
+110,170,137,49,144,149,209,173,84,39,224,113,104,165,220,172,26,150,47,20,138,171,18,105,
+123,207,247,158,139,18,10,228,224,24,29,131,167,233,56,55,88,55,167,216,246,142,26,91,
+210,157,188,15,53,172,106,131,59,90,194,58,168,123,38,93,175,33,174,47,141,57,97,100,
+48,233,251,240,234,232,1,174,105,254,237,90,89,113,126,105,219,177,255,185,159,67,236,91,
+20,226,9,59,120,190,148,202,27,29,38,145,48,4,242,3,236,138,60,152,198,70,141,9,
+173,35,129,17,1,130,130,125,154,51,137,159,50,26,174,221,122,168,164,125,242,126,254,125,
+59,47,229,182,223,223,165,201,29,2,21,6,89,185,55,220,83,203,250,76,49,28,101,14,
+165,44,99,45,191,157,95,226,178,67,199,242,19,157,65,233,173,218,214,190,85,61,191,82,
+249,231,64,98,212,64,18,202,121,101,217,95,64,122,89,253,255,174,90,11,44,225,102,244,
+46,113,209,221,183,161,207,198,95,172,172,178,196,106,183,145,231,62,126,54,123,176,121,10,
+94,136,76,31,171,84,69,36,124,116,55,188,132,24,88,128,114,233,158,196,198,242,226,197,
+194,203,62,238,218,42,52,179,106,18,11,167,57,74,127,229,230,222,56,225,2,16,99,41,
+42,254,8,13,203,220,132,130,44,141,162,33,145,161,153,159,6,48,128,227,68,33,225,142,
+99,59,213,87,48,213,65,212,21,84,43,149,167,145,67,6,169,104,155,0,17,200,133,41,
+152,105,152,104,146,24,201,237,229,224,42,16,141,1,8,202,129,141,43,11,201,213,144,190,
+78,56,137,67,151,182,178,209,59,253,197,90,121,208,210,226,185,5,91,252,85,170,133,40,
+150,140,101,130,91,123,207,52,251,96,195,49,97,16,110,26,61,212,109,125,147,125,25,140,
+201,69,213,193,110,124,218,51,248,165,185,22,4,34,139,42,117,18,210,135,98,84,116,39,
+169,176,142,237,191,131,2,243,166,24,57,119,153,136,145,250,205,170,53,232,43,36,93,86,
+192,223,19,113,80,242,113,203,180,60,172,86,74,40,42,211,195,208,150,44,145,218,222,222,
+68,203,213,128,237,251,175,42,221,197,122,136,148,154,42,208,119,18,180,103,228,230,96,43,
+43,230,203,209,8,10,218,101,151,193,43,84,172,214,18,144,15,243,141,8,85,216,109,200,
+5,113,135,180,169,8,10,101,138,224,150,21,150,211,183,166,55,254,76,174,21,177,242,232,
+81,51,166,39,48,226,70,180,54,37,25,177,131,82,79,95,215,183,114,242,5,180,158,161,
+36,211,132,116,162,27,209,150,199,140,171,27,93,112,178,150,10,192,123,180,116,181,204,102,
+137,121,50,124,77,89,202,180,142,69,139,62,10,251,220,62,9,167,27,231,137,228,214,157,
+185,30,47,200,189,171,235,135,90,195,7,11,200,198,155,194,192,129,91,14,173,140,144,4,
+26,130,242,97,231,9,246,72,71,195,245,147,205,17,61,70,167,100,171,65,130,58,232,156,
+67,69,100,191,109,29,77,120,216,82,55,161,88,219,245,48,239,73,201,126,148,15,252,182,
+98,79,205,244,117,24,214,194,255,79,52,113,45,178,28,74,148,101,109,230,248,206,8,111,
+148,246,160,38,84,106,52,244,233,72,157,66,178,250,166,143,14,161,169,114,184,59,60,46,
+112,117,58,187,159,20,8,29,177,4,1,119,7,199,32,97,215,236,112,202,32,162,186,3,
+28,1,113,126,25,130,181,208,235,115,190,35,208,69,158,193,153,157,180,150,88,160,113,177,
+178,201,131,37,38,165,168,153,96,50,136,4,44,185,185,93,119,226,248,29,26,182,133,188,
+177,43,1,58,113,79,179,151,179,48,58,26,113,121,129,194,45,209,129,177,200,236,187,228,
+62,209,37,198,241,85,251,208,87,194,18,32,173,181,183,74,6,3,151,94,104,3,15,251,
+73,23,113,228,171,23,104,178,138,234,144,24,149,111,176,136,165,175,241,191,44,129,52,145,
+52,63,106,7,62,159,156,33,90,26,1,9,140,229,123,77,254,55,2,108,171,186,91,196,
+21,109,35,7,200,64,39,37,34,16,40,138,34,40,110,91,193,244,233,115,203,80,5,223,
+119,5,111,121,211,141,138,228,25,221,197,69,28,244,78,140,68,224,150,162,105,202,204,136,
+250,75,34,8,76,9,35,50,148,229,29,62,121,50,122,142,38,185,132,23,24,142,71,41,
+240,10,3,247,23,196,120,168,213,35,93,27,126,84,51,205,48,58,211,86,158,134,208,236,
+173,226,102,66,166,202,121,154,171,124,27,194,236,115,127,70,170,43,255,105,240,8,42,32,
+118,112,42,133,202,21,193,175,39,206,181,212,1,41,61,63,57,16,117,115,112,31,19,44,
+125,223,145,134,174,73,78,122,112,10,70,82,23,3,7,216,225,38,195,76,130,2,208,144,
+166,76,232,202,85,225,184,106,39,142,188,154,84,174,68,5,44,201,20,254,29,46,189,117,
+20,84,7,0,6,244,196,16,56,65,47,152,113,208,13,56,96,44,66,36,79,89,68,82,
+1,152,88,109,37,80,159,149,7,124,3,173,196,158,194,3,86,151,113,113,81,239,249,27,
+220,112,113,60,122,173,196,121,128,186,190,163,236,5,1,231,121,126,114,250,255,140,220,29,
+21,8,98,79,166,166,206,133,84,16,242,248,161,239,254,126,75,172,12,11,2,161,187,29,
+65,197,60,121,185,166,117,247,188,61,28,93,113,246,237,131,215,55,82,122,134,111,83,107,
+81,224,72,66,122,193,4,61,254,17,190,72,231,202,155,131,131,112,195,94,28,146,3,80,
+210,8,64,162,11,32,27,141,138,112,205,96,40,152,65,167,178,65,68,7,86,44,148,177,
+152,109,97,158,52,15,95,88,83,103,71,224,96,249,59,199,165,1,33,51,113,66,5,49,
+110,15,129,176,52,153,22,6,129,245,9,101,183,12,229,33,26,138,172,157,36,65,95,65,
+112,66,125,105,143,194,41,26,185,95,59,207,55,106,35,210,158,208,238,160,105,204,93,153,
+29,138,67,179,81,98,26,131,6,240,17,190,162,26,33,48,215,235,103,54,191,3,229,24,
+247,248,241,125,156,49,232,118,80,0,70,251,113,23,3,82,144,99,14,106,141,41,8,82,
+98,213,77,64,103,45,100,249,10,253,80,43,205,21,220,37,62,180,44,5,84,3,17,204,
+97,163,150,178,194,189,51,126,101,198,68,36,50,252,34,182,153,118,42,43,229,64,244,105,
+91,168,160,109,77,128,56,179,13,215,141,50,166,120,233,91,101,71,106,138,15,104,148,229,
+185,36,21,43,116,93,110,202,49,193,140,35,193,165,195,176,89,65,67,145,228,74,134,73,
+185,113,57,62,0,201,121,45,94,91,180,203,207,31,35,22,113,206,210,239,144,99,209,144,
+196,94,56,24,121,69,31,186,101,28,101,44,146,85,65,95,38,88,205,69,75,193,47,227,
+206,223,80,51,117,44,117,18,74,88,92,8,35,174,77,185,84,84,104,248,248,155,242,148,
+238,11,138,27,168,104,4,102,16,224,45,181,69,106,241,250,145,68,60,196,221,137,25,234,
+202,114,184,93,203,29,33,121,219,237,118,106,200,234,215,221,212,133,58,221,4,39,117,127,
+125,71,103,206,212,154,71,159,71,209,27,165,219,131,87,163,205,31,39,59,201,57,176,218,
+98,100,109,148,137,208,131,141,156,115,74,164,117,84,115,238,150,183,156,238,206,52,251,94,
+14,198,173,98,6,79,86,224,18,95,192,121,61,174,65,69,116,115,178,112,237,118,147,48,
+195,70,154,33,8,253,12,180,33,42,136,30,47,208,203,61,149,136,23,192,183,23,189,218,
+54,11,124,110,254,62,177,46,50,211,212,198,236,60,212,86,101,167,97,182,72,227,8,178,
+77,41,78,139,223,189,134,238,12,198,201,231,163,116,253,139,17,119,43,103,186,103,154,85,
+16,246,130,42,135,251,142,6,74,210,147,212,68,161,96,126,27,103,51,15,115,230,226,142,
+234,155,225,90,189,122,183,101,244,240,253,244,118,225,225,158,143,59,6,80,21,243,189,214,
+250,51,201,132,245,184,4,19,224,179,37,56,132,255,140,68,154,53,23,227,165,34,107,41,
+122,239,145,215,220,7,96,49,183,25,144,241,75,247,147,10,113,220,7,136,53,203,240,68,
+181,191,99,42,134,2,155,6,227,166,24,91,171,56,245,82,223,236,58,28,131,231,153,176,
+160,176,223,1,221,224,125,6,139,44,118,121,227,186,40,172,136,201,117,241,87,231,239,148,
+106,141,60,65,119,205,14,203,34,131,20,118,95,27,174,24,132,97,231,222,199,31,125,85,
+157,22,43,56,237,43,151,202,39,190,65,183,127,227,252,222,77,3,213,145,8,128,198,57,
+6,255,42,126,166,61,171,34,162,136,144,121,42,59,158,105,230,152,104,157,17,144,165,93,
+180,118,96,244,16,144,218,36,35,108,99,236,150,149,137,79,241,115,195,140,210,0,144,205,
+141,126,138,56,190,11,81,33,69,65,180,235,19,15,16,132,119,107,87,36,216,40,14,4,
+50,8,71,167,49,11,193,12,77,222,135,227,197,150,210,160,152,8,100,167,167,33,147,153,
+10,212,183,234,247,51,93,232,139,193,104,122,106,243,123,9,215,133,177,102,154,127,51,138,
+192,8,91,105,140,3,233,17,228,59,68,184,200,172,172,171,158,14,207,117,149,4,154,194,
+24,214,88,15,114,94,182,167,239,95,60,17,137,18,142,137,88,43,179,105,82,166,89,153,
+222,175,149,217,243,125,46,18,33,4,199,110,118,251,239,154,51,152,144,67,149,61,233,9,
+246,195,25,76,144,40,158,255,115,15,59,178,216,176,184,129,112,211,180,39,245,255,183,237,
+198,125,243,140,223,113,33,241,72,248,132,48,154,149,222,95,241,245,90,190,186,105,33,210,
+111,200,135,236,231,195,29,144,196,190,52,209,111,174,14,234,23,126,11,224,181,159,19,214,
+48,90,123,93,95,231,91,207,20,96,108,33,173,74,191,116,245,107,221,240,245,64,145,229,
+167,154,230,195,240,111,183,23,46,95,153,58,209,6,72,102,182,115,252,173,149,215,67,200,
+143,107,39,169,69,146,185,242,73,218,209,157,35,131,245,150,222,142,95,110,134,185,196,235,
+217,89,219,248,58,217,59,146,40,96,235,113,198,191,55,49,120,213,171,85,148,79,71,169,
+219,139,135,68,184,14,138,135,116,152,134,149,183,214,237,2,90,83,38,83,155,216,131,234,
+69,36,34,236,165,75,191,241,16,216,124,30,174,91,196,236,115,30,85,251,182,242,253,83,
+119,242,91,118,221,186,31,12,79,158,97,170,142,38,124,66,185,12,157,211,235,22,44,118,
+20,223,233,239,108,179,27,127,225,66,127,63,46,214,187,48,102,23,87,180,84,26,190,141,
+9,66,239,219,150,233,82,53,207,230,239,66,209,90,238,134,14,189,52,34,213,52,223,85,
+181,47,200,241,236,163,15,178,234,186,203,119,15,67,175,181,214,156,246,166,85,237,63,170,
+77,62,231,86,91,28,40,52,230,119,102,206,87,181,46,39,146,30,188,219,43,211,91,188,
+186,72,110,112,213,41,77,187,153,90,199,30,166,84,25,82,32,135,95,47,74,167,86,15,
+78,223,60,175,166,101,78,5,19,6,217,44,252,10,11,138,47,0,64,231,243,181,133,202,
+16,85,47,91,224,1,208,13,15,7,84,222,233,244,77,173,47,225,53,112,88,125,222,217,
+63,15,88,8,25,134,97,115,136,87,91,185,152,236,190,231,84,134,103,140,26,92,238,228,
+20,233,81,35,170,243,168,24,193,70,54,92,174,81,131,3,229,186,0,45,213,73,215,252,
+139,36,201,157,177,94,25,79,122,174,196,55,14,110,20,212,188,233,21,244,170,225,222,171,
+22,196,80,11,199,70,221,195,244,113,207,90,82,39,100,86,167,51,53,110,126,177,124,140,
+176,194,227,154,18,250,6,173,6,71,47,184,132,145,172,168,254,73,49,182,41,157,89,152,
+92,140,225,249,102,89,192,62,141,195,232,51,72,144,232,209,193,115,201,92,25,85,6,151,
+224,48,63,20,20,186,247,203,247,107,70,81,235,126,173,136,101,101,254,179,48,180,58,162,
+105,169,69,41,153,200,27,9,221,169,213,126,72,61,91,237,28,102,155,1,76,9,250,227,
+117,214,28,222,14,5,16,137,77,185,224,19,21,183,28,95,138,244,106,124,174,253,203,144,
+56,34,216,110,208,87,115,145,51,196,78,222,35,30,247,46,201,112,159,139,38,121,126,149,
+5,156,103,90,132,165,239,148,83,224,237,108,202,113,18,125,38,242,35,100,40,247,219,109,
+94,179,50,101,95,150,146,236,231,107,215,175,162,169,27,80,132,31,231,217,134,156,159,232,
+183,209,248,154,3,8,75,209,85,23,17,72,137,236,240,60,91,234,116,53,110,71,171,113,
+140,66,20,54,65,150,30,60,153,161,81,137,51,252,149,191,71,213,61,104,19,90,1,204,
+105,67,241,185,58,123,174,75,65,56,182,217,26,115,245,126,127,213,251,239,202,93,48,168,
+74,39,186,216,45,64,42,166,208,125,224,57,9,250,216,217,40,227,255,201,243,93,178,122,
+73,74,168,74,128,81,76,8,6,66,217,2,28,35,35,226,141,98,219,196,105,109,110,110,
+158,30,117,198,178,240,34,44,42,113,102,94,119,149,226,57,224,61,248,65,10,85,26,238,
+155,0,180,166,10,93,16,213,181,82,218,77,127,203,9,118,103,8,143,32,25,15,52,145,
+66,205,245,120,165,100,48,38,27,57,26,76,15,39,167,168,167,147,187,142,11,176,37,240,
+54,17,156,163,169,190,110,223,153,149,153,102,160,19,97,177,190,98,117,207,103,240,127,215,
+93,149,89,1,106,19,108,190,133,108,247,240,61,3,224,223,203,153,247,154,235,138,243,179,
+214,16,152,68,21,246,245,139,36,115,139,51,46,196,248,100,52,90,33,129,145,10,52,203,
+6,67,145,0,201,227,17,167,216,208,204,184,252,54,172,161,19,30,59,201,108,110,216,170,
+209,80,230,168,19,35,144,191,30,178,125,168,107,42,200,89,58,31,9,24,157,132,251,145,
+137,241,249,98,26,148,143,43,158,153,243,58,144,95,213,62,237,72,159,162,141,133,109,244,
+59,215,10,218,152,10,69,113,192,77,75,19,9,14,213,163,204,228,197,22,36,152,85,182,
+152,6,163,236,175,175,217,69,196,171,164,46,165,42,6,209,111,209,5,100,7,230,62,75,
+8,99,171,11,164,47,7,116,63,29,121,174,40,84,254,207,95,166,34,58,27,141,159,206,
+253,117,9,163,46,114,161,99,165,83,58,177,108,210,35,213,99,125,109,222,141,79,17,91,
+24,118,188,23,169,223,206,226,247,92,60,148,188,75,238,28,175,0,90,138,232,151,73,62,
+170,254,87,60,48,97,221,166,255,121,207,137,85,26,3,85,202,89,129,61,214,37,171,233,
+84,53,208,195,180,25,60,109,76,153,53,19,15,164,33,230,123,190,91,124,208,120,0,133,
+140,77,248,89,102,71,188,200,226,189,22,40,251,142,217,85,76,92,36,130,136,166,216,111,
+122,91,91,170,69,169,227,55,21,28,94,75,48,250,223,251,162,34,24,48,137,48,147,110,
+100,103,182,5,229,33,27,221,82,173,141,99,62,255,42,253,20,170,108,164,117,101,42,249,
+1,1,79,148,233,137,96,27,163,164,118,25,241,29,1,89,155,78,144,181,229,237,189,252,
+76,201,48,120,71,76,157,194,44,54,131,37,162,108,14,159,124,207,3,1,220,48,12,80,
+249,104,136,87,224,156,231,116,95,222,119,176,72,226,116,62,22,89,241,24,33,120,136,6,
+123,110,38,167,140,50,137,17,94,37,134,167,196,116,146,95,174,94,196,40,26,239,246,39,
+36,6,36,188,81,7,156,213,77,48,164,28,114,98,12,194,133,8,177,58,20,141,33,51,
+165,66,166,165,97,203,116,75,177,114,31,77,140,249,207,72,72,135,136,211,47,12,7,85,
+165,72,191,92,65,219,44,51,131,81,54,129,39,204,106,144,215,235,236,130,0,142,64,97,
+199,93,18,148,248,104,121,108,59,88,250,54,32,116,199,204,173,192,123,161,134,85,223,49,
+46,159,212,252,231,255,49,185,195,85,95,54,137,193,153,185,159,209,162,225,166,194,137,44,
+73,104,115,101,146,122,29,44,157,99,247,83,15,7,69,36,76,53,70,189,69,66,88,84,
+138,234,178,225,16,72,186,18,228,42,145,107,36,72,234,84,161,12,60,116,81,165,205,143,
+167,204,83,34,184,76,54,67,186,142,51,235,29,126,239,197,64,54,14,16,74,245,236,112,
+220,28,22,72,168,200,242,24,122,30,225,141,31,134,160,248,193,131,151,27,34,145,144,87,
+105,146,10,5,104,211,48,155,22,166,101,123,74,80,64,117,50,34,228,115,93,175,156,231,
+34,139,81,163,185,112,137,149,92,145,180,205,46,251,142,36,23,132,241,2,183,106,197,234,
+157,250,70,128,26,204,196,89,203,201,31,77,134,63,6,17,57,21,167,4,179,175,65,219,
+60,241,46,56,17,143,64,66,32,117,139,201,139,216,44,224,23,168,71,8,65,46,44,89,
+90,112,242,111,196,202,171,222,252,18,101,181,134,4,64,93,98,36,226,183,217,108,209,30,
+113,163,36,241,4,69,143,95,74,186,6,30,162,35,1,87,74,168,105,39,178,100,184,83,
+136,62,148,86,98,68,167,107,143,170,120,98,105,26,135,95,213,247,148,104,94,246,8,111,
+179,144,142,156,116,118,100,156,116,97,165,33,52,8,144,188,140,172,33,51,39,113,52,66,
+40,238,168,9,187,148,160,174,5,94,35,184,150,28,111,63,162,50,207,42,182,28,236,156,
+218,157,243,142,158,50,236,222,145,96,192,77,241,17,218,138,85,24,78,74,163,107,118,175,
+161,201,134,191,51,162,11,179,65,215,132,209,203,27,75,96,185,156,201,222,137,255,94,30,
+213,216,189,159,123,111,97,166,138,175,79,45,47,174,82,120,26,238,197,34,130,210,12,110,
+18,219,31,38,34,162,208,84,37,28,248,185,166,5,151,244,244,97,102,62,66,92,152,197,
+65,108,142,143,198,118,14,136,53,197,224,216,227,107,119,133,45,17,241,110,99,141,171,24,
+34,123,144,239,135,41,98,46,236,221,73,127,88,107,125,4,105,113,88,206,207,161,196,37,
+237,36,203,25,67,48,245,178,52,109,82,147,58,96,20,114,178,142,172,159,105,232,172,171,
+2,42,169,112,6,51,153,45,125,107,11,148,82,190,26,165,116,73,165,7,178,85,139,121,
+101,182,98,173,207,67,106,132,202,105,4,178,92,16,200,231,73,201,51,184,162,102,118,187,
+126,252,197,205,72,212,60,83,38,114,243,141,246,84,55,22,13,142,139,222,129,248,72,193,
+180,85,136,62,198,218,20,46,71,147,132,43,20,187,222,163,110,35,145,52,87,89,89,222,
+63,170,141,27,165,218,159,169,245,244,106,175,218,217,226,150,208,244,24,224,90,57,183,197,
+77,62,66,164,86,243,123,44,71,85,173,1,17,0,46,143,240,87,67,90,107,172,89,73,
+40,179,100,66,47,133,233,161,139,36,219,68,106,208,107,0,42,218,187,220,96,89,74,137,
+16,40,44,168,38,197,180,195,36,55,219,19,2,22,194,30,250,234,75,12,97,128,45,89,
+188,167,116,114,45,11,152,4,29,234,145,74,253,155,89,248,237,139,157,15,209,47,142,186,
+194,207,191,250,134,68,249,125,125,166,223,117,191,40,209,202,252,47,225,79,170,235,240,161,
+100,159,143,139,74,95,191,13,229,23,76,105,247,146,229,147,225,34,185,32,170,255,199,237,
+62,69,100,17,239,214,43,174,69,175,204,248,246,222,214,244,188,135,245,136,33,233,157,253,
+72,41,60,147,206,31,174,46,72,217,72,251,208,156,137,13,228,99,163,218,56,68,181,210,
+45,40,125,159,225,236,230,246,88,81,79,5,82,88,4,217,148,139,244,127,87,19,44,78,
+108,183,78,136,86,106,86,101,1,245,181,208,31,169,185,115,251,31,122,107,231,8,244,29,
+48,4,169,9,204,232,234,156,19,250,235,185,249,115,210,0,195,53,150,204,30,200,157,204,
+194,13,53,38,233,183,238,118,103,165,68,32,237,26,166,251,65,129,229,28,163,68,173,6,
+141,5,130,12,242,8,44,109,40,129,12,2,179,190,159,86,24,50,141,142,247,34,135,83,
+132,92,6,4,6,157,24,251,11,63,25,137,209,114,238,121,98,195,138,252,197,76,160,146,
+48,112,250,51,17,116,4,240,244,155,3,246,119,167,179,233,146,116,244,10,159,24,219,117,
+226,118,252,211,113,26,132,100,84,80,98,20,89,139,84,168,111,156,116,131,151,14,146,0,
+238,152,166,165,155,240,100,228,102,100,196,103,139,95,69,53,155,120,53,216,215,138,217,102,
+196,74,196,73,152,178,62,57,195,76,22,16,142,20,169,80,161,89,204,22,113,134,1,203,
+43,33,12,25,188,7,205,3,134,49,75,181,131,207,17,67,4,35,4,2,25,137,196,20,
+245,150,159,74,166,176,244,146,215,96,225,0,149,211,133,74,39,179,193,75,80,230,219,106,
+101,54,221,149,8,156,198,127,46,69,14,221,48,127,39,159,248,221,30,211,209,67,1,160,
+170,236,157,246,74,164,177,200,109,241,239,185,148,64,42,122,50,172,119,76,100,81,227,156,
+233,66,128,186,249,176,246,209,32,90,97,130,212,84,89,162,48,26,116,198,42,173,31,11,
+79,246,100,184,0,112,123,1,196,73,167,102,43,140,55,103,54,217,225,20,70,28,113,208,
+24,127,77,101,15,130,118,165,162,173,33,172,105,58,133,200,161,115,22,86,45,147,130,196,
+162,107,236,10,220,221,83,98,59,70,130,6,154,189,179,114,159,183,17,41,241,15,73,248,
+24,215,159,197,208,182,170,8,132,127,120,232,225,201,154,242,88,96,182,188,79,47,86,124,
+50,71,189,102,68,204,48,239,212,131,223,199,107,162,76,82,75,26,89,85,253,157,218,123,
+107,122,37,118,253,94,174,82,239,217,240,208,243,204,66,98,114,198,222,172,191,14,6,177,
+250,208,59,60,49,96,78,60,175,145,171,46,154,61,114,153,52,153,37,195,36,186,10,177,
+177,47,100,12,8,12,240,138,186,98,140,98,4,148,34,6,55,53,97,111,147,173,194,217,
+238,146,29,218,136,119,214,212,224,121,237,47,225,23,174,103,213,131,22,180,19,4,111,207,
+138,110,159,118,126,169,137,103,228,66,233,210,233,252,24,16,0,160,17,111,194,15,135,117,
+151,4,46,239,84,110,92,71,215,178,238,206,190,164,111,182,135,198,122,92,106,26,22,126,
+91,19,86,48,6,163,155,61,101,144,40,29,204,185,55,178,82,250,9,217,57,244,208,145,
+88,115,116,175,59,120,171,209,100,184,93,23,108,154,89,153,220,70,207,9,136,106,83,94,
+87,30,213,127,38,217,63,51,236,248,138,249,163,42,79,173,91,235,107,191,215,30,27,26,
+223,183,118,78,183,223,111,179,29,188,14,176,45,124,107,63,175,199,224,105,124,28,81,19,
+23,178,216,14,17,188,147,58,118,79,239,30,29,196,122,61,176,233,164,149,159,230,79,186,
+200,120,208,63,197,227,156,226,14,174,202,228,84,31,116,72,10,71,122,250,91,251,223,189,
+179,71,236,81,255,175,251,69,130,70,14,106,126,13,127,102,85,242,229,88,195,119,178,251,
+18,171,106,254,175,233,137,199,131,175,11,154,172,254,2,46,191,100,15,46,135,142,4,105,
+31,66,21,195,11,149,214,189,35,20,108,83,247,207,59,10,205,41,159,48,135,230,230,10,
+220,218,186,162,220,117,87,211,26,144,107,113,253,58,178,28,94,112,33,181,128,131,47,90,
+184,36,62,54,58,217,87,244,112,155,117,241,97,37,150,235,138,230,37,150,231,245,159,29,
+100,48,219,163,7,29,206,47,223,189,88,253,174,120,236,246,245,254,172,190,206,120,167,174,
+200,92,213,173,152,33,101,125,184,115,6,28,158,102,115,31,229,78,23,254,71,84,12,1,
+186,157,121,182,221,130,225,16,210,159,173,231,67,169,222,122,233,214,183,106,253,41,110,116,
+186,10,142,153,206,29,78,51,113,220,56,254,49,48,189,145,22,19,0,145,96,123,39,163,
+96,236,253,43,8,88,20,7,45,155,59,219,129,83,77,4,70,48,117,107,55,58,204,238,
+154,104,133,45,216,180,112,49,86,170,243,174,26,137,232,129,164,218,69,230,237,252,4,153,
+134,26,52,89,72,43,98,187,121,211,206,15,103,200,121,2,24,140,102,180,141,250,244,250,
+59,103,60,136,13,145,5,219,185,47,132,32,130,181,254,138,0,120,144,184,115,84,114,242,
+114,185,198,148,32,22,110,122,227,254,202,165,160,64,8,95,37,222,24,168,15,55,63,236,
+47,73,153,104,64,39,218,134,154,165,25,250,8,78,233,38,195,152,64,133,65,38,156,89,
+203,222,15,163,144,106,27,154,232,34,37,52,39,84,135,25,181,221,231,253,168,162,171,128,
+40,146,122,250,144,146,13,4,248,235,30,7,172,116,123,73,139,14,162,30,119,75,70,4,
+225,142,121,9,4,171,154,103,178,255,81,6,82,3,178,157,56,40,141,138,63,143,245,193,
+148,87,26,32,225,159,195,96,200,255,192,182,45,40,204,167,26,123,126,17,8,139,219,103,
+69,250,195,174,182,59,240,62,23,59,143,237,211,225,119,7,227,40,119,206,111,192,156,233,
+36,34,198,159,136,113,234,248,55,181,188,240,5,245,6,252,236,22,17,215,217,183,183,167,
+215,109,132,20,4,50,16,243,16,78,129,21,123,82,173,121,216,184,145,31,114,33,233,185,
+25,114,65,207,149,23,74,216,111,127,199,243,210,203,101,47,130,254,150,60,12,9,122,149,
+83,7,140,209,9,2,240,239,22,244,118,58,154,102,98,135,125,12,189,179,88,218,240,160,
+153,174,185,53,141,157,129,149,120,214,35,60,140,178,193,180,121,19,23,236,43,75,234,232,
+247,123,221,230,131,124,129,237,139,238,67,11,91,54,183,78,54,7,97,242,136,249,3,174,
+185,129,192,227,61,8,94,198,175,159,59,59,28,72,161,229,225,21,130,127,204,103,182,154,
+158,214,104,165,240,244,92,156,190,101,90,49,117,216,249,187,73,85,236,45,168,12,155,67,
+71,91,214,25,44,250,39,37,59,26,42,212,14,90,144,183,239,125,132,194,36,197,32,82,
+148,193,224,225,155,75,3,160,106,148,254,52,154,165,20,141,246,223,237,221,77,95,89,25,
+143,139,146,201,174,20,114,209,16,77,51,140,132,247,125,21,22,130,108,2,12,137,250,116,
+18,195,231,205,156,150,136,158,163,38,14,175,6,88,85,111,203,114,91,111,112,199,98,68,
+199,166,141,106,60,22,67,160,1,35,158,56,29,62,118,102,215,116,158,93,110,233,7,11,
+157,226,183,154,154,96,102,215,107,184,7,158,62,185,40,42,10,152,8,106,24,177,191,202,
+110,31,1,124,37,242,23,222,62,242,51,249,220,206,159,205,23,15,201,110,64,243,251,36,
+34,114,251,31,206,18,127,1,93,135,177,23,89,29,76,241,72,32,207,45,15,167,247,250,
+68,189,170,171,56,142,141,171,176,251,231,162,105,249,47,201,220,3,131,198,71,187,87,52,
+125,153,248,247,180,134,118,68,230,18,153,240,138,118,254,176,67,33,1,168,250,195,245,152,
+89,213,70,103,157,179,248,127,159,78,201,158,92,93,61,151,123,49,109,220,44,79,52,78,
+203,237,252,79,221,251,214,179,136,24,24,72,66,251,235,212,245,167,122,255,217,45,64,41,
+131,108,141,184,243,185,216,202,255,194,114,154,228,219,25,180,189,197,202,107,213,44,23,34,
+69,132,107,161,25,225,238,26,5,62,8,3,97,22,176,40,58,163,42,117,21,142,74,19,
+170,198,39,123,154,184,67,4,224,79,117,162,190,62,167,67,13,248,60,137,70,200,128,39,
+173,91,188,219,139,162,158,52,110,97,182,32,74,34,132,8,129,160,97,117,62,158,71,52,
+114,205,129,120,77,211,153,77,43,63,42,33,159,23,89,4,164,142,99,126,182,202,40,10,
+45,57,184,57,25,239,223,159,66,105,177,82,88,73,252,131,243,18,160,178,119,226,131,4,
+229,16,137,200,20,135,164,164,155,113,85,34,209,188,106,88,212,80,128,201,207,173,19,226,
+89,155,7,14,123,160,68,8,8,72,17,113,155,81,151,229,116,125,71,64,65,65,40,33,
+66,73,207,78,97,166,1,34,50,65,208,8,42,205,246,2,171,248,176,71,110,79,141,230,
+221,23,222,48,8,80,112,54,87,122,250,49,244,67,123,83,136,52,66,68,223,116,130,231,
+92,82,124,126,223,239,27,110,62,18,24,226,161,117,220,87,117,247,250,59,241,230,252,51,
+19,160,212,207,177,232,117,72,146,212,67,77,81,93,159,177,252,47,235,191,161,14,125,12,
+81,4,69,177,11,126,47,123,30,46,62,206,196,164,90,0,164,85,167,250,53,173,84,22,
+125,112,152,224,61,11,116,235,215,28,95,243,21,105,4,135,236,17,29,215,130,173,7,110,
+30,237,64,197,131,83,233,86,18,182,232,184,223,0,138,133,237,68,140,132,196,90,220,115,
+209,73,154,7,26,49,9,53,37,67,63,10,121,242,133,179,133,22,102,238,185,168,238,78,
+20,190,79,185,0,113,196,108,175,164,81,101,182,100,190,191,52,186,166,12,44,41,231,157,
+72,188,156,217,82,7,84,65,226,149,96,236,169,81,76,46,175,205,95,136,103,158,194,248,
+28,225,60,24,186,124,229,167,160,207,198,132,191,54,79,214,33,117,40,222,100,213,135,149,
+231,242,28,180,99,178,164,7,15,178,223,27,178,210,222,217,133,183,63,64,157,192,81,195,
+227,209,215,150,156,110,23,213,51,248,108,229,123,115,53,248,253,96,167,251,139,9,152,234,
+27,44,33,116,159,218,36,167,138,191,156,167,156,179,195,79,28,84,206,138,9,151,137,140,
+224,223,178,24,80,67,151,122,55,161,159,58,188,21,183,205,48,132,117,130,97,58,56,176,
+129,231,167,50,192,68,128,90,207,71,56,55,164,233,41,76,58,53,149,103,141,152,53,161,
+202,225,75,222,157,17,56,226,160,162,208,89,133,135,94,137,123,210,225,88,32,39,50,149,
+247,12,180,46,125,34,13,43,250,104,99,75,208,160,208,223,172,183,122,170,60,109,113,199,
+188,31,222,219,88,236,146,43,115,149,239,48,14,173,226,252,243,70,223,27,93,50,144,98,
+187,223,204,150,33,49,87,124,35,179,226,22,45,150,237,169,109,152,239,173,66,249,41,171,
+108,100,244,1,170,72,105,101,48,114,38,191,219,248,24,239,225,207,157,132,166,172,49,29,
+93,24,244,212,25,174,128,113,74,141,215,74,238,196,24,214,97,60,225,90,5,13,120,53,
+250,240,244,48,11,225,2,234,235,40,196,105,147,144,87,204,144,208,82,47,127,139,231,99,
+208,82,223,23,155,210,98,2,2,187,240,23,44,177,147,168,48,250,37,15,142,208,205,56,
+149,73,44,6,160,17,111,178,254,193,242,138,185,61,163,99,193,45,25,12,187,238,92,60,
+127,80,210,60,145,19,36,106,105,15,183,123,123,50,149,155,11,74,178,97,113,193,19,48,
+104,189,197,173,213,12,149,191,157,186,102,177,249,162,144,150,113,88,223,34,8,98,196,255,
+99,233,194,135,168,234,162,51,109,77,135,16,36,159,53,236,212,231,130,12,177,230,172,183,
+150,179,186,83,99,181,44,60,11,140,150,232,181,82,77,71,0,82,101,200,240,23,103,162,
+223,156,175,145,35,106,220,169,101,146,35,175,86,189,18,1,162,130,188,170,51,109,112,45,
+250,102,39,22,212,73,72,43,68,237,114,141,116,43,174,41,92,99,66,251,57,181,242,144,
+186,202,171,255,172,231,128,30,237,202,19,222,192,109,89,197,192,69,202,49,54,81,17,195,
+241,167,152,232,39,92,62,106,54,175,93,214,224,244,155,76,212,146,30,56,97,219,102,109,
+92,141,238,117,19,193,16,73,34,48,36,131,49,177,23,2,145,100,218,175,63,234,237,77,
+203,194,187,130,150,32,246,169,62,21,107,221,153,99,52,12,52,97,244,17,9,199,150,238,
+229,27,0,192,247,234,215,24,134,193,85,81,136,40,128,61,4,238,124,59,157,95,42,53,
+86,12,105,168,17,19,183,60,156,236,39,147,168,87,157,18,68,69,81,4,108,14,79,213,
+192,142,132,221,100,16,71,27,72,168,101,157,67,96,27,6,64,13,118,0,161,230,99,38,
+72,120,254,179,61,165,12,212,16,64,130,73,64,52,225,186,245,177,189,7,139,137,36,95,
+7,28,232,65,25,252,153,219,217,51,45,11,49,41,2,185,102,207,66,204,3,196,66,3,
+132,6,108,91,87,31,96,20,235,209,7,241,209,105,11,4,2,84,68,131,158,34,149,167,
+212,187,213,235,20,88,44,156,24,91,32,121,113,68,34,231,231,180,124,89,85,205,56,187,
+59,108,133,153,39,118,78,56,224,134,122,98,50,92,14,42,198,184,9,28,132,42,52,154,
+183,11,65,70,119,171,38,170,252,84,178,162,161,174,41,144,217,20,140,184,197,149,74,37,
+114,99,21,163,12,186,185,200,214,132,106,175,76,130,149,59,0,57,74,153,66,29,12,9,
+33,94,104,46,180,185,251,106,182,235,56,140,211,116,191,71,82,124,125,12,124,3,36,144,
+91,188,133,165,19,157,235,133,221,37,180,109,182,156,59,151,96,203,55,224,45,47,178,122,
+116,148,173,81,189,46,21,173,204,175,114,102,241,27,41,159,175,24,205,219,102,1,69,230,
+92,171,205,83,234,153,26,124,64,102,106,202,150,126,124,10,38,36,166,190,133,112,207,85,
+89,89,5,243,111,231,171,6,197,56,217,223,84,110,40,169,98,154,54,168,88,174,148,20,
+90,99,74,10,98,81,51,55,98,51,220,132,60,145,209,170,76,27,32,1,104,230,87,136,
+181,211,8,229,203,252,8,121,134,68,223,239,145,62,122,38,109,176,182,103,52,169,8,205,
+28,239,155,180,220,106,90,94,11,254,68,148,132,217,45,72,162,213,111,23,143,231,252,18,
+213,241,104,232,109,35,125,117,159,166,148,192,111,86,179,77,116,252,250,57,81,28,213,18,
+177,142,91,229,74,114,131,207,180,5,124,81,47,72,38,20,223,236,73,66,62,145,36,112,
+243,214,118,146,200,172,26,17,155,106,104,61,188,44,175,140,172,130,53,0,118,90,80,196,
+140,172,0,226,47,3,4,123,124,8,250,244,107,104,122,114,170,103,222,147,173,189,194,189,
+189,19,26,176,56,241,92,23,160,180,140,41,110,49,5,11,145,112,25,37,99,109,166,170,
+234,166,159,15,222,66,95,30,183,199,67,87,118,1,71,190,152,74,120,241,219,224,138,141,
+159,234,145,20,204,29,129,26,130,32,115,244,255,125,2,25,52,86,222,85,9,71,49,225,
+153,168,128,37,120,213,139,140,72,99,114,68,114,135,5,100,94,76,20,5,13,105,30,114,
+69,244,85,120,212,248,254,206,225,209,9,252,34,147,230,134,92,68,20,196,76,119,153,239,
+190,192,229,137,248,219,110,145,49,19,172,85,180,91,60,241,196,107,4,161,253,93,17,100,
+206,15,52,2,212,35,6,82,207,93,210,200,131,104,12,97,153,228,60,72,9,21,147,129,
+4,136,48,84,103,227,88,207,84,222,74,75,174,92,120,239,71,128,180,244,136,10,14,29,
+171,231,246,237,82,86,26,163,151,68,152,194,180,252,229,91,144,199,90,52,26,160,137,137,
+209,130,121,48,37,195,34,151,83,158,7,158,208,134,127,46,194,180,104,123,103,70,56,30,
+175,97,57,176,194,164,50,47,115,48,117,98,74,68,121,10,36,234,177,83,188,28,51,128,
+167,198,33,158,120,106,87,207,197,202,170,201,200,84,162,203,233,218,155,237,217,101,136,0,
+129,149,240,189,25,186,65,45,111,71,94,202,73,0,9,150,204,190,78,49,23,97,26,2,
+82,150,103,157,19,166,155,50,100,63,7,81,63,93,133,144,8,144,220,137,145,113,203,24,
+229,243,72,149,113,224,74,133,133,20,144,254,121,234,3,232,181,3,77,62,231,114,93,19,
+212,121,4,247,254,63,170,28,0,210,85,184,233,157,159,149,106,58,119,125,154,72,34,156,
+67,118,60,49,138,128,94,49,138,164,249,116,125,178,244,233,199,185,222,162,154,103,206,37,
+66,76,210,246,163,12,45,228,246,165,166,9,162,140,9,238,42,57,81,18,147,171,120,195,
+151,72,130,201,122,91,88,106,214,52,230,43,198,124,26,40,129,74,106,187,254,32,232,150,
+12,26,48,16,199,8,65,81,131,57,209,126,179,102,198,93,6,171,101,83,126,16,111,175,
+56,211,194,156,40,52,120,26,250,105,238,75,220,6,95,189,102,85,112,75,130,52,101,133,
+78,127,107,113,216,32,2,121,87,15,101,59,20,66,126,89,4,59,153,97,122,211,166,159,
+144,225,139,2,41,77,38,229,6,139,2,88,224,213,243,85,130,236,148,182,143,193,92,185,
+76,126,66,102,199,169,10,126,159,185,208,171,17,113,243,201,135,152,229,73,174,86,244,155,
+44,72,241,8,239,162,114,232,188,17,55,174,147,63,142,49,249,40,42,113,145,126,143,213,
+201,15,221,249,14,74,145,223,31,23,57,43,226,104,184,169,105,104,173,24,216,234,56,76,
+122,194,197,172,22,227,59,229,115,45,175,71,135,89,8,74,246,56,218,120,18,211,109,105,
+157,172,114,88,76,233,188,180,88,43,9,176,109,66,176,177,169,37,115,45,82,47,225,229,
+171,231,117,234,105,255,119,68,15,18,251,121,203,153,150,57,99,30,50,75,108,195,229,100,
+142,63,68,83,139,114,90,255,60,154,137,192,151,155,206,61,71,113,14,85,3,244,169,131,
+147,45,31,241,109,103,43,218,73,156,174,219,63,179,51,179,11,163,167,139,34,183,70,1,
+68,241,77,134,178,131,169,254,35,228,222,200,109,156,40,134,197,235,57,110,115,187,193,117,
+242,168,9,88,70,173,18,176,174,243,92,236,45,46,82,107,98,65,234,170,213,237,230,114,
+12,121,174,173,107,186,223,121,199,17,141,5,60,181,91,238,127,29,234,150,206,246,114,137,
+84,221,51,159,208,116,116,158,11,20,45,80,129,39,179,45,111,123,128,232,111,12,137,152,
+112,129,42,33,25,185,121,83,196,20,165,112,141,239,55,153,0,101,33,200,233,119,184,161,
+232,90,84,108,181,32,172,178,9,173,6,48,41,20,159,76,50,9,25,14,130,159,41,44,
+200,4,137,126,36,65,68,154,161,110,203,31,197,194,243,124,140,93,252,86,254,206,131,117,
+147,251,246,255,65,236,88,254,55,145,89,57,79,138,243,254,54,192,97,101,87,86,82,118,
+167,158,48,161,2,141,111,62,216,195,251,19,230,159,224,51,163,240,224,153,166,53,248,69,
+133,15,12,176,221,101,191,188,137,97,240,110,192,202,98,178,231,63,226,168,125,11,220,58,
+179,134,46,41,208,221,172,50,147,157,223,226,226,194,212,110,51,19,183,38,252,90,254,76,
+245,99,165,244,159,103,92,130,160,216,155,95,208,19,88,64,24,35,129,234,46,220,117,139,
+167,6,41,205,38,252,137,211,80,66,10,184,85,10,145,158,1,13,183,10,127,77,230,89,
+178,79,45,255,173,99,38,239,70,44,36,135,156,32,11,239,78,61,0,234,79,30,87,135,
+244,175,254,170,90,66,99,140,165,218,103,188,28,219,106,169,120,69,160,1,32,148,166,227,
+156,158,110,207,176,178,128,214,146,154,156,246,179,133,0,179,207,204,180,2,73,112,11,19,
+130,73,19,30,201,25,231,228,242,250,221,127,55,115,142,172,208,252,235,3,179,214,148,229,
+90,212,118,127,50,32,85,127,187,234,72,215,175,165,161,42,239,189,204,80,168,193,93,100,
+37,104,60,162,152,232,47,139,85,20,167,96,187,129,64,36,43,66,122,247,6,98,5,184,
+225,242,241,201,140,40,39,31,8,118,195,132,108,119,214,88,235,157,114,65,1,1,71,3,
+28,182,88,9,244,66,203,160,187,70,239,20,113,214,255,151,165,119,124,57,247,115,60,60,
+83,19,129,4,17,124,130,87,200,116,198,228,166,61,123,190,206,28,20,142,72,19,197,248,
+17,155,87,217,156,104,28,38,134,49,125,178,14,2,73,0,40,128,205,102,218,13,183,215,
+251,121,136,205,72,104,138,99,99,7,21,135,62,237,43,203,193,210,215,251,177,95,80,18,
+62,109,202,165,108,189,189,200,178,158,79,222,79,27,248,125,103,195,93,252,140,1,189,56,
+33,11,41,166,225,228,221,97,249,178,33,167,117,254,40,166,149,49,213,234,104,89,52,95,
+132,35,236,173,39,202,124,185,97,141,19,167,42,178,230,217,168,255,19,202,76,150,144,104,
+68,126,17,151,178,163,196,104,106,180,93,196,252,114,157,214,39,4,239,124,123,162,197,161,
+231,154,173,108,44,162,120,118,145,18,154,132,44,87,14,144,80,51,145,74,154,10,129,81,
+140,12,56,54,87,181,5,10,150,155,159,203,212,32,197,125,101,13,249,117,207,143,163,34,
+112,137,116,2,233,215,181,151,155,249,113,38,235,101,176,33,176,31,27,100,93,10,96,86,
+51,109,149,102,59,186,215,23,209,92,244,24,238,171,30,118,14,20,222,218,144,93,118,241,
+109,158,249,94,243,72,242,120,25,51,175,9,202,235,17,63,145,170,60,236,179,66,152,159,
+194,131,59,9,229,190,29,158,181,60,61,114,13,36,171,163,100,145,21,150,82,27,21,174,
+192,143,187,138,224,181,108,94,120,91,35,209,37,162,165,87,188,209,158,140,161,25,198,189,
+131,7,237,228,205,40,172,25,10,165,37,153,181,181,143,160,189,203,103,88,215,40,112,204,
+100,237,200,33,109,148,161,93,236,7,9,156,87,217,121,29,90,10,30,64,242,103,101,116,
+148,192,193,139,50,29,63,80,92,66,58,209,80,113,176,65,203,92,31,203,81,4,118,133,
+178,223,217,196,13,41,95,237,95,9,222,59,218,232,141,243,238,78,92,35,77,171,130,10,
+203,10,252,42,193,101,8,192,192,148,182,180,41,127,234,241,34,74,92,65,121,56,124,166,
+73,18,157,191,191,190,68,78,57,134,116,189,36,32,64,61,228,96,162,196,250,226,86,20,
+72,110,121,136,142,152,81,40,64,203,159,39,165,78,177,75,26,77,39,125,68,7,98,9,
+4,28,67,82,56,237,250,86,244,34,91,114,91,249,92,99,192,82,15,121,204,138,56,64,
+220,73,88,170,94,19,156,52,246,13,167,13,228,100,59,126,175,22,70,39,79,196,113,7,
+95,226,164,29,241,218,254,138,77,156,122,60,193,157,85,63,91,204,179,46,26,205,139,244,
+230,138,165,139,240,54,65,249,182,104,119,52,216,132,186,119,248,59,251,159,216,14,128,171,
+156,48,130,137,134,18,210,14,111,98,179,18,36,212,172,221,57,80,225,200,144,30,167,205,
+126,132,30,143,206,221,212,35,217,173,105,121,212,153,145,78,45,40,191,53,168,177,45,41,
+97,215,171,189,8,186,164,252,206,92,42,148,16,151,98,77,201,76,181,92,250,21,83,3,
+121,60,73,203,149,42,154,41,91,135,10,89,221,69,255,177,205,58,20,139,160,253,124,132,
+137,97,227,2,92,184,152,61,133,22,9,166,120,58,81,36,141,226,88,78,57,24,126,62,
+49,205,20,108,198,130,188,141,88,44,48,33,9,115,221,150,76,100,56,95,156,227,18,126,
+237,79,155,221,218,84,61,254,240,77,177,116,60,183,153,140,35,179,48,107,20,116,149,190,
+19,245,100,188,138,86,28,247,99,59,229,252,120,38,132,241,50,49,226,207,103,47,79,232,
+249,170,176,205,6,233,2,105,19,157,12,88,175,140,75,128,144,47,54,93,29,108,102,168,
+6,207,60,165,212,26,48,50,14,97,77,78,22,111,179,223,178,170,135,0,212,120,5,244,
+92,221,76,86,47,244,246,80,128,192,143,70,38,113,243,63,39,193,9,97,57,31,50,5,
+29,61,24,16,254,174,46,21,33,35,210,114,82,107,130,24,153,123,95,74,127,182,173,40,
+28,12,55,233,89,236,170,253,182,87,122,126,145,247,27,163,222,216,180,126,89,154,223,222,
+242,86,228,151,72,52,134,212,189,77,100,251,199,125,17,73,223,14,31,211,145,137,199,81,
+162,112,156,67,101,193,194,118,70,7,111,138,249,231,31,73,163,132,164,248,147,133,133,78,
+169,51,31,155,49,35,146,61,137,0,122,220,94,9,33,227,148,70,199,88,155,88,91,135,
+197,94,226,37,199,196,250,156,82,237,237,29,23,233,37,8,168,75,251,43,125,191,192,145,
+159,123,222,161,228,50,186,116,57,82,102,12,232,26,132,43,67,175,189,47,20,136,252,89,
+22,133,226,79,150,219,213,154,158,83,37,23,147,43,177,135,67,173,195,146,32,219,74,103,
+37,158,131,176,120,63,169,168,73,202,41,71,182,176,230,143,2,71,46,44,87,125,144,53,
+173,156,185,22,42,117,60,113,92,129,112,54,150,138,154,48,72,170,105,255,114,116,162,70,
+27,75,80,215,59,73,220,98,58,36,22,165,173,86,40,214,54,122,139,56,20,207,218,226,
+236,234,177,21,178,74,96,62,249,54,153,109,26,129,34,200,24,39,110,132,31,116,192,13,
+92,83,73,20,129,167,135,210,41,52,130,9,164,229,196,20,196,20,30,115,93,82,16,142,
+33,250,5,90,246,177,146,78,235,54,16,64,67,187,191,110,172,120,209,230,73,61,3,108,
+169,38,140,66,56,133,119,211,19,123,136,227,19,196,138,141,173,50,86,124,251,87,21,156,
+239,178,163,36,125,223,167,149,77,16,211,157,251,134,78,191,8,13,205,168,46,252,40,45,
+133,167,16,135,76,202,74,58,122,188,192,138,67,172,162,176,40,54,120,65,228,134,16,117,
+216,151,247,7,51,240,142,90,156,166,197,31,8,171,124,45,80,37,8,244,217,245,200,130,
+166,16,248,201,242,75,244,74,241,164,130,144,252,145,58,241,31,143,188,179,240,140,17,7,
+251,4,76,88,137,182,74,114,149,120,167,153,243,165,193,178,42,84,182,40,197,15,61,23,
+240,135,242,59,76,43,252,63,46,92,195,134,191,209,79,32,214,17,55,202,187,35,247,163,
+10,97,135,249,4,182,158,10,78,6,82,174,223,1,25,92,44,168,75,150,245,54,45,133,
+15,176,126,156,113,227,54,148,102,220,11,19,143,200,88,227,196,56,66,84,233,54,66,97,
+213,80,81,69,133,74,205,194,83,158,77,106,84,18,226,219,177,7,33,197,108,156,254,15,
+131,227,250,204,152,15,183,21,55,136,178,231,76,249,0,241,98,146,104,150,151,169,109,223,
+101,117,237,18,127,199,125,52,135,33,103,248,191,211,254,13,45,54,250,72,208,81,81,142,
+103,214,123,201,15,245,94,59,182,52,219,117,38,96,157,200,40,209,0,132,36,86,137,36,
+6,118,237,86,206,15,208,161,98,64,217,86,20,69,204,224,229,113,82,111,248,20,166,146,
+168,33,152,40,152,25,161,238,105,170,102,68,66,16,219,140,104,32,38,97,140,37,48,229,
+116,197,164,211,74,54,122,62,229,164,213,167,240,169,105,131,142,130,134,2,163,52,48,81,
+185,98,217,70,198,28,250,159,55,174,105,234,204,165,17,136,154,218,182,13,132,40,11,33,
+46,212,201,53,132,70,86,186,84,179,146,4,18,68,68,74,36,138,43,67,99,79,71,75,
+77,4,79,151,50,166,92,72,54,102,41,48,17,105,33,231,141,39,207,95,74,19,41,121,
+113,180,149,225,4,113,5,104,138,219,142,202,106,4,29,135,114,121,156,74,104,212,205,194,
+166,25,112,106,125,176,191,58,47,148,136,82,66,201,53,153,200,156,222,92,116,131,68,182,
+102,210,173,78,136,101,192,176,9,219,170,144,128,228,22,182,13,88,3,185,134,151,104,231,
+103,210,131,152,68,90,245,42,198,52,192,160,5,215,20,51,202,162,148,19,224,149,112,248,
+36,33,95,21,109,223,190,49,223,89,189,240,175,156,244,93,91,88,98,252,209,170,229,252,
+202,115,178,166,230,34,31,29,215,51,57,231,96,75,18,153,226,191,86,246,174,42,245,174,
+241,204,201,115,135,114,190,68,188,7,100,179,223,212,147,77,122,236,157,145,149,54,181,28,
+86,189,63,195,127,239,206,222,153,125,161,155,71,205,57,24,246,82,53,124,77,74,91,27,
+206,179,90,112,121,117,149,119,130,98,204,189,23,123,222,11,163,15,109,28,142,178,218,135,
+81,81,97,225,187,55,167,19,5,243,35,123,70,158,226,206,33,102,217,156,242,250,113,211,
+207,3,102,38,22,38,38,61,35,169,184,148,111,112,3,88,238,65,105,49,38,209,25,247,
+247,202,100,17,244,84,221,69,44,104,34,147,109,237,94,234,121,37,17,111,74,66,95,252,
+197,138,226,109,162,81,86,53,243,177,220,87,147,239,226,74,24,131,139,233,137,178,216,159,
+123,249,101,217,124,81,59,115,112,123,83,108,96,10,63,105,88,4,0,5,116,24,0,250,
+231,1,208,108,12,0,238,172,137,1,73,0,184,238,222,27,216,75,96,227,233,208,157,53,
+120,87,42,202,142,56,233,107,181,221,248,150,51,131,232,103,80,162,132,128,205,16,12,161,
+156,167,80,158,223,49,41,76,250,122,29,145,124,96,38,188,140,184,72,16,50,140,67,151,
+32,201,213,246,207,251,72,252,252,50,11,194,104,115,178,119,252,168,166,4,195,68,70,181,
+23,45,249,160,115,132,80,138,111,155,247,124,126,224,62,215,55,201,25,127,140,97,65,54,
+23,138,5,240,164,16,89,40,195,180,228,247,220,70,95,169,95,63,195,78,221,89,245,42,
+130,198,51,225,58,172,176,119,131,202,57,234,68,203,241,74,23,190,35,30,129,87,174,38,
+252,195,146,11,186,151,142,147,52,147,180,132,52,253,132,76,76,18,161,62,125,95,23,31,
+211,250,191,8,54,151,59,242,185,113,146,219,196,212,49,5,209,31,35,234,77,56,245,76,
+195,30,85,53,11,48,129,100,92,141,246,7,214,89,141,233,100,228,145,86,91,214,149,245,
+235,38,155,215,252,187,60,109,254,210,181,141,100,199,2,129,202,26,163,188,170,214,96,242,
+181,159,74,193,193,16,253,163,168,248,201,164,222,150,90,127,159,191,207,123,251,51,227,33,
+8,244,105,150,232,150,251,14,184,84,132,1,140,226,157,8,112,194,27,188,220,0,162,64,
+168,78,202,103,29,249,9,23,172,159,211,250,33,186,154,143,52,36,67,202,81,66,148,233,
+17,161,80,210,215,218,19,84,148,29,88,159,55,37,32,138,178,96,156,32,70,162,106,117,
+36,123,77,3,106,71,31,126,139,69,199,186,81,51,10,48,178,160,175,97,190,29,44,210,
+30,255,175,87,217,212,144,109,225,170,42,136,207,164,47,169,31,44,164,78,148,150,36,243,
+184,124,11,156,25,159,197,248,30,112,130,50,230,179,167,234,49,211,71,197,21,134,64,217,
+16,254,42,117,255,111,249,157,209,127,22,205,230,50,119,166,113,52,33,214,163,53,130,103,
+204,142,63,179,92,211,104,64,209,159,155,121,136,160,218,89,124,212,80,21,235,178,203,166,
+126,207,38,217,36,126,28,214,160,71,148,137,134,38,167,153,149,58,71,33,79,98,17,46,
+1,64,123,44,66,170,105,188,156,159,195,154,135,55,227,72,39,166,219,163,253,6,212,240,
+120,57,94,245,113,228,190,204,25,177,81,148,97,157,61,124,186,83,60,123,82,174,241,135,
+1,19,111,56,255,11,56,101,36,242,211,112,33,146,43,230,233,92,77,150,58,53,2,129,
+32,250,200,188,163,65,59,23,48,199,12,174,206,167,99,188,35,40,196,80,38,95,176,179,
+130,223,60,123,34,14,236,65,220,60,170,170,176,127,209,176,73,159,98,22,166,5,35,142,
+179,29,86,47,91,242,133,142,93,69,213,75,151,211,51,97,154,98,217,241,220,192,19,31,
+147,150,43,33,126,104,26,140,224,119,95,175,117,142,167,216,196,154,47,21,161,11,91,14,
+243,5,89,133,70,159,71,105,201,128,219,109,225,51,46,200,241,25,121,111,58,218,111,206,
+103,11,226,255,53,133,171,8,182,199,50,234,249,191,115,35,15,59,130,173,79,42,191,7,
+241,166,59,45,70,113,81,52,238,230,205,167,193,116,6,80,117,177,201,196,188,212,194,34,
+243,0,14,49,131,187,24,165,6,57,24,182,229,180,4,11,6,196,32,205,228,171,234,91,
+120,184,255,104,153,17,31,7,202,135,159,208,192,122,109,249,125,91,202,131,171,12,161,58,
+35,141,235,253,6,110,247,154,8,133,143,198,172,238,139,133,30,252,217,62,191,27,108,121,
+39,10,98,200,35,6,51,228,199,33,186,2,246,185,34,151,155,208,37,180,209,76,223,50,
+117,62,209,170,40,135,87,199,97,90,50,82,46,113,192,119,50,111,54,121,138,233,171,213,
+240,201,121,82,9,102,148,136,158,170,1,19,77,179,185,254,126,236,245,144,137,17,42,98,
+96,138,100,34,24,43,155,94,130,7,32,19,111,191,224,85,21,200,168,96,35,144,149,123,
+104,195,65,186,181,43,71,219,34,142,35,171,221,85,103,110,175,20,171,71,233,16,97,104,
+207,7,29,183,242,231,89,41,69,193,147,21,108,143,98,50,132,33,25,235,29,85,159,157,
+107,242,22,66,52,132,91,140,23,68,73,196,25,68,47,32,36,205,78,76,20,16,59,50,
+148,37,225,36,68,61,254,56,100,124,136,181,34,123,97,142,219,255,199,123,146,217,231,140,
+177,75,209,148,72,75,209,197,145,240,115,15,158,148,210,63,178,229,180,104,232,124,87,78,
+61,139,204,75,1,68,30,177,105,235,55,57,92,188,147,151,177,220,61,193,58,54,213,48,
+61,17,158,52,4,99,97,145,197,250,175,24,27,110,180,128,220,147,21,229,168,193,81,221,
+63,11,51,146,24,9,170,105,173,135,55,224,119,220,233,184,51,129,40,99,142,160,204,25,
+67,147,185,177,175,217,47,46,179,135,1,229,67,27,122,233,81,197,30,58,7,192,57,160,
+18,99,151,143,122,172,200,95,135,233,52,160,85,141,233,85,232,118,163,228,8,227,94,184,
+7,153,99,203,167,26,98,11,10,105,17,228,34,195,38,169,26,36,111,196,210,96,125,6,
+96,85,59,110,75,74,75,61,95,87,218,227,8,29,35,93,140,101,11,28,209,200,222,41,
+240,43,108,130,69,4,171,4,5,13,91,9,146,28,62,216,211,173,138,55,13,248,242,49,
+83,236,123,120,101,90,205,53,67,202,47,14,116,227,40,194,159,119,248,16,95,95,222,123,
+109,207,71,129,237,232,180,204,170,16,224,254,125,215,242,72,237,109,97,80,82,27,157,72,
+42,242,91,148,118,201,120,90,89,234,28,116,84,73,221,245,158,114,57,250,127,155,233,183,
+182,100,115,106,24,151,68,226,227,3,6,180,164,170,167,252,110,130,190,3,99,207,214,151,
+192,183,197,208,241,240,160,240,142,54,238,178,9,195,187,247,15,183,216,22,101,78,63,78,
+194,225,27,217,125,84,175,145,174,138,223,152,77,153,244,11,3,248,220,172,71,131,17,33,
+146,73,205,246,60,149,58,226,240,233,42,218,222,62,239,182,173,243,86,112,53,207,126,55,
+197,73,127,249,40,155,139,147,168,222,191,34,10,10,103,133,253,33,35,225,138,130,81,76,
+251,74,59,53,25,57,116,178,65,223,133,89,94,28,122,229,193,226,224,183,30,202,208,67,
+21,166,1,75,145,91,121,139,120,16,55,48,10,210,90,93,219,80,223,32,222,244,178,120,
+120,75,241,241,73,231,56,30,90,4,37,210,232,184,175,208,35,132,67,79,247,162,247,152,
+85,101,162,122,221,142,224,190,145,62,247,210,227,80,90,244,205,132,241,115,61,16,126,224,
+73,203,3,137,49,131,193,4,78,156,215,50,164,194,240,168,121,172,118,166,238,216,155,80,
+110,204,159,49,73,10,55,21,237,250,62,89,134,66,112,155,54,191,135,247,125,190,198,171,
+217,117,181,37,180,156,158,39,114,60,66,81,16,189,83,188,42,84,70,47,47,69,23,155,
+105,134,92,157,159,229,191,160,65,122,187,116,101,176,103,111,189,99,35,84,27,226,253,129,
+131,165,137,22,75,124,252,29,58,23,134,11,141,227,152,126,143,174,105,88,98,100,142,186,
+219,31,129,141,129,97,106,199,63,231,72,176,50,158,70,43,60,147,186,77,62,124,80,18,
+17,48,78,133,143,43,228,231,237,28,120,145,29,112,206,186,132,32,59,231,188,137,199,31,
+62,99,36,176,154,108,102,148,111,180,253,136,165,32,132,243,192,108,208,154,121,199,224,116,
+202,58,0,132,1,192,99,236,212,215,250,104,51,141,23,17,196,207,182,149,40,167,57,7,
+91,67,81,171,27,84,180,24,107,108,16,218,69,249,168,4,44,169,133,222,43,56,72,182,
+141,145,253,138,198,8,214,230,76,111,48,229,207,24,125,100,24,191,192,186,101,130,209,149,
+8,124,205,85,33,130,129,208,99,58,90,32,92,2,193,50,1,23,226,207,60,35,33,145,
+252,254,20,90,159,40,228,237,225,154,34,71,42,15,141,10,82,11,24,29,88,198,44,230,
+243,207,145,178,33,114,208,59,223,191,116,58,63,191,25,171,212,93,225,20,111,239,127,17,
+226,229,36,189,1,71,189,159,246,77,37,114,162,155,147,191,10,90,229,205,78,83,167,87,
+157,130,218,183,76,58,19,1,133,159,71,34,214,142,237,61,103,168,22,150,210,64,70,127,
+23,214,67,54,253,116,242,82,225,16,145,171,232,25,138,11,57,201,204,71,237,94,114,63,
+16,216,230,142,207,100,150,112,101,244,136,91,197,57,157,184,187,16,108,208,79,160,66,90,
+212,32,143,70,32,223,228,100,64,111,34,111,135,155,108,68,168,114,55,110,142,236,169,117,
+88,202,249,21,67,51,158,241,154,206,213,198,181,215,89,40,29,145,223,78,83,50,152,117,
+39,31,163,82,78,6,235,143,8,17,65,239,179,195,218,22,27,71,95,104,214,38,158,107,
+3,40,31,216,63,31,92,116,227,219,135,188,214,184,33,131,113,38,42,208,108,54,132,245,
+169,104,211,116,43,96,119,209,222,23,45,194,99,54,144,166,158,84,28,167,21,229,57,6,
+53,174,34,204,20,206,67,4,128,215,86,228,113,187,74,105,98,29,228,159,196,104,84,29,
+210,98,239,39,151,61,139,156,233,100,16,43,240,39,196,8,232,90,142,109,108,170,75,2,
+200,148,87,100,92,94,158,162,22,239,229,198,162,55,133,40,17,128,170,11,98,227,216,155,
+42,127,29,2,26,132,46,47,93,241,207,23,8,135,125,189,255,131,235,138,104,225,172,2,
+66,39,145,243,220,243,206,51,238,74,28,79,191,236,220,73,241,205,146,241,162,210,93,67,
+187,53,60,65,244,51,40,110,16,66,15,158,249,130,92,115,14,84,77,125,40,253,211,159,
+247,81,6,190,136,204,45,217,134,39,205,2,224,17,10,25,118,57,63,207,52,201,181,147,
+139,7,172,113,228,67,33,24,84,40,122,224,215,177,95,209,241,195,184,215,201,89,144,253,
+87,112,85,232,59,58,43,48,97,249,61,30,109,126,235,231,84,177,118,1,55,112,31,233,
+203,84,242,192,208,90,232,120,99,152,163,169,229,155,151,11,34,222,93,125,233,206,28,211,
+74,180,72,50,77,24,63,129,0,155,148,125,231,58,93,7,42,96,115,213,244,92,100,224,
+162,142,37,177,195,172,52,177,29,5,88,36,222,232,253,245,60,167,58,124,160,95,50,247,
+160,183,37,8,80,226,27,65,185,97,5,172,159,134,52,255,115,73,168,49,210,173,137,52,
+179,239,72,248,157,204,121,20,156,24,13,170,91,115,230,179,171,146,248,99,46,70,86,87,
+206,154,144,17,131,131,53,39,196,242,42,237,235,115,123,28,89,91,70,52,9,219,185,226,
+236,207,142,213,247,143,145,106,132,250,11,39,39,99,115,91,171,110,73,89,146,78,83,223,
+153,61,158,206,77,107,163,165,207,70,7,125,166,121,52,106,13,238,220,144,170,47,137,133,
+28,97,152,64,228,102,173,103,236,248,213,107,219,235,47,145,8,31,112,139,64,104,187,62,
+98,122,94,47,81,161,17,218,47,54,117,170,63,108,21,160,31,66,21,34,77,231,24,99,
+109,162,26,3,148,116,176,91,131,194,45,8,46,72,71,177,124,155,106,213,138,116,29,42,
+37,210,148,49,136,22,205,132,244,237,158,38,47,182,111,199,248,200,192,207,13,28,253,102,
+51,50,228,72,9,77,52,124,27,157,213,210,124,229,23,60,164,171,217,200,73,11,183,44,
+254,142,168,39,153,185,53,176,40,31,225,104,24,149,113,123,181,61,42,86,85,68,243,28,
+152,162,177,120,230,244,99,15,97,45,60,62,136,45,250,238,75,53,26,101,94,197,51,244,
+88,186,80,218,233,234,97,140,129,128,79,103,128,142,156,207,185,24,24,175,71,178,50,161,
+49,57,35,126,72,36,89,184,228,49,243,5,129,200,97,153,177,33,127,203,28,143,15,252,
+108,238,123,154,33,56,232,210,247,150,243,168,199,137,222,164,184,143,161,226,109,86,27,227,
+209,254,74,207,21,102,42,250,101,156,181,50,229,217,47,11,125,230,65,6,33,114,133,35,
+6,217,142,48,175,144,218,61,237,70,13,30,184,16,123,217,168,175,1,71,186,233,121,121,
+125,78,36,62,13,86,150,27,193,45,73,124,182,52,9,140,151,6,54,210,56,178,169,11,
+107,190,251,32,217,240,207,3,62,144,160,193,93,156,179,196,172,57,137,89,169,171,98,252,
+95,145,50,80,89,117,87,249,72,15,58,165,44,136,187,194,19,223,62,197,3,200,33,134,
+210,57,127,154,52,185,13,80,53,20,152,98,67,201,53,233,23,141,132,39,37,50,89,146,
+226,42,176,78,112,186,63,26,242,206,161,217,243,193,64,136,195,12,184,137,78,243,46,252,
+51,114,126,205,174,27,211,159,243,131,33,247,34,203,210,32,214,189,8,31,122,180,121,49,
+19,107,34,85,36,109,87,176,41,243,98,167,222,136,172,47,121,196,69,101,10,249,63,25,
+85,125,214,201,189,135,22,5,215,61,53,38,242,13,84,204,154,255,157,217,137,21,98,63,
+152,233,161,54,92,255,199,142,43,43,27,33,204,81,166,229,181,96,208,86,208,195,220,9,
+215,32,66,92,74,83,96,155,120,67,31,218,111,217,8,113,237,228,33,218,138,172,144,18,
+128,58,154,57,161,86,79,203,249,249,62,164,2,12,180,98,131,104,196,100,194,196,139,252,
+146,255,30,15,223,161,208,61,95,222,85,231,46,101,75,63,239,253,73,121,69,125,181,55,
+96,185,46,214,122,80,54,66,31,165,4,5,173,146,237,236,235,23,81,186,240,204,138,119,
+190,84,210,204,53,152,213,5,23,29,132,160,46,140,147,94,191,107,243,27,4,64,32,184,
+3,83,67,22,6,241,21,167,15,75,106,90,32,9,2,82,102,168,203,104,194,128,126,201,
+199,214,68,123,228,128,71,213,248,72,12,245,134,210,138,30,129,101,192,158,104,180,230,111,
+255,99,236,31,200,129,103,9,141,122,42,77,225,126,186,181,129,125,227,77,180,222,181,159,
+216,178,148,0,224,32,58,52,152,126,114,187,133,254,86,112,180,119,229,1,199,124,150,135,
+66,78,105,52,213,81,18,24,175,222,64,151,180,19,169,178,206,87,36,111,126,207,133,10,
+61,123,254,178,127,32,186,125,126,142,115,216,99,33,46,211,88,192,48,146,220,44,142,126,
+233,196,43,233,228,138,25,81,51,146,138,33,93,11,26,92,21,153,240,83,62,132,11,208,
+20,194,14,111,8,82,238,189,149,98,47,225,14,82,195,77,236,133,175,169,105,93,177,164,
+114,52,38,233,147,119,112,110,238,82,60,9,95,206,246,30,95,91,100,108,110,215,214,6,
+183,28,196,20,109,228,99,129,195,45,40,163,109,54,117,26,127,248,207,122,247,130,14,55,
+211,190,26,22,186,18,28,248,144,144,41,99,110,61,126,130,253,23,142,177,97,125,178,248,
+38,119,255,156,28,59,231,30,179,192,143,142,182,24,38,92,189,66,31,204,184,131,180,184,
+4,232,40,193,103,173,173,67,20,64,214,100,157,27,15,83,75,24,214,29,228,242,195,6,
+175,116,239,132,50,89,10,17,241,219,99,188,59,98,226,122,188,228,35,226,77,117,211,73,
+184,128,103,36,143,2,136,119,138,219,90,81,166,243,80,233,44,115,205,175,58,73,174,39,
+21,112,65,117,190,178,93,232,87,164,139,211,210,15,217,73,187,223,100,88,189,167,157,173,
+22,17,240,160,53,249,152,146,131,4,9,238,252,239,150,163,49,233,83,247,32,132,237,75,
+175,10,143,126,210,34,122,221,177,136,110,20,71,186,48,43,55,202,87,64,244,26,180,55,
+82,53,230,70,139,177,99,143,226,19,167,70,147,50,41,79,138,99,128,47,95,31,228,201,
+39,194,108,201,57,51,126,84,101,178,96,61,26,150,238,97,105,93,140,79,237,140,83,232,
+203,34,164,245,252,149,63,85,155,171,22,104,145,242,238,155,170,39,52,177,208,4,161,171,
+72,200,32,201,41,211,11,176,84,238,121,133,29,210,99,219,190,14,76,179,186,196,77,70,
+145,50,23,148,187,20,172,168,251,85,83,225,171,70,106,94,141,159,179,87,231,65,103,134,
+31,108,66,22,66,77,140,137,128,185,124,139,231,162,26,168,233,211,65,179,218,219,119,165,
+150,216,91,110,38,18,84,207,100,120,254,162,191,33,250,87,46,190,5,152,31,100,42,144,
+179,189,204,254,211,159,52,96,33,46,53,20,209,137,106,255,104,199,47,67,48,136,45,105,
+172,179,112,132,146,205,92,88,20,151,140,44,68,116,9,202,89,141,63,156,209,32,56,253,
+75,205,193,48,62,226,32,204,198,121,88,52,1,146,2,34,161,84,232,224,26,153,16,40,
+233,197,61,48,106,247,139,227,44,161,75,213,144,177,146,181,2,22,23,54,93,26,200,215,
+137,126,194,102,75,40,106,197,65,236,82,89,177,234,140,180,148,208,51,34,252,212,93,49,
+68,10,15,96,77,236,50,217,231,98,187,146,99,70,78,222,141,150,188,22,230,11,104,229,
+188,94,231,109,215,31,124,148,247,86,99,107,151,119,102,110,4,250,52,70,106,176,237,188,
+155,115,142,0,64,76,162,239,9,212,84,100,35,1,109,133,25,198,113,21,207,175,136,255,
+161,18,147,130,180,115,224,244,36,119,241,127,126,116,185,247,249,47,60,65,209,52,181,203,
+76,207,118,142,54,163,136,61,207,19,219,206,139,220,33,163,191,228,183,143,83,255,98,118,
+56,223,100,246,128,192,32,90,235,80,147,9,215,64,205,236,235,126,178,208,141,205,30,161,
+38,24,206,248,135,226,4,71,237,237,147,236,91,163,229,113,173,33,248,70,158,231,32,245,
+23,83,153,229,130,241,172,217,95,211,253,203,127,47,228,143,224,140,73,159,184,76,48,65,
+240,72,105,248,35,246,221,194,247,99,110,31,127,244,59,190,62,164,166,12,254,25,225,247,
+22,39,102,77,36,203,192,204,48,197,138,142,154,171,99,204,24,43,56,200,187,67,134,2,
+64,142,128,203,30,75,220,84,140,175,87,44,102,177,46,84,3,84,140,148,186,77,153,36,
+192,46,136,189,238,85,212,46,135,200,105,211,164,124,189,72,101,147,98,19,96,195,115,90,
+29,181,105,212,70,184,201,38,102,220,78,246,27,145,80,144,133,9,189,153,121,76,159,145,
+57,255,69,148,204,23,168,171,143,186,186,198,202,252,58,117,77,134,225,104,65,42,187,144,
+177,96,63,9,128,84,145,61,197,36,135,143,97,55,184,141,154,169,55,229,238,207,45,35,
+35,125,76,21,32,170,239,238,229,76,206,238,92,10,49,146,189,204,164,169,150,24,55,193,
+251,181,156,203,169,122,255,6,74,117,5,97,248,39,221,197,236,244,252,203,45,93,23,39,
+58,205,45,108,174,119,178,41,231,183,85,220,171,183,160,54,204,217,67,217,185,82,107,17,
+60,208,141,92,211,151,26,209,144,179,32,240,61,160,154,12,76,236,72,48,207,115,238,69,
+42,214,36,85,236,70,204,224,253,196,1,135,106,160,111,237,173,123,220,96,125,108,177,29,
+38,203,1,140,80,6,38,135,244,66,216,16,201,156,193,240,52,98,28,15,34,79,219,124,
+173,191,228,167,164,195,41,116,54,75,251,147,41,247,210,253,218,241,245,246,80,76,83,132,
+133,209,232,103,150,5,91,177,80,149,207,25,118,183,72,119,138,185,124,28,175,103,203,246,
+92,234,121,208,221,193,199,88,138,106,156,179,116,65,77,211,225,168,197,211,175,63,85,179,
+38,83,73,148,17,149,230,93,203,206,22,83,55,125,119,202,249,234,159,149,64,242,200,181,
+4,10,185,102,139,93,82,97,159,119,226,144,166,125,163,34,120,42,230,90,115,196,157,46,
+95,104,43,220,108,44,191,86,79,184,143,146,229,89,37,234,239,136,6,97,252,79,91,38,
+15,12,158,54,105,188,43,22,15,195,173,239,107,169,94,18,38,92,203,6,171,198,204,124,
+93,136,180,172,67,233,109,127,222,221,146,245,148,157,194,241,149,101,78,110,104,247,127,86,
+39,123,246,123,148,177,52,47,12,5,195,97,255,204,164,74,152,233,58,93,214,215,79,130,
+236,18,244,82,154,101,108,0,68,204,61,112,197,231,240,48,12,69,14,88,19,42,77,0,
+121,202,241,74,231,230,200,225,233,124,9,3,94,190,249,94,149,182,185,159,16,249,236,91,
+28,84,189,34,47,57,115,171,182,106,198,4,63,92,79,195,26,7,46,252,99,213,243,51,
+20,199,31,129,33,111,90,64,144,206,6,106,172,175,115,169,102,141,67,217,230,136,207,8,
+210,75,194,153,212,252,42,106,182,130,201,196,130,19,72,35,167,87,184,91,29,49,143,207,
+241,170,113,96,133,36,104,248,31,79,192,112,29,59,233,246,203,4,181,253,36,96,136,136,
+227,224,161,147,120,198,123,63,206,210,62,76,101,127,9,69,1,37,57,88,200,157,175,157,
+211,215,238,140,21,23,217,154,160,244,70,20,138,205,250,204,79,201,187,233,56,33,10,165,
+8,111,243,202,211,2,199,165,27,248,187,196,186,41,56,148,250,164,148,39,164,15,226,36,
+13,132,26,120,141,165,142,229,106,5,170,122,86,91,67,140,156,179,7,174,176,124,63,99,
+95,4,41,126,3,128,219,244,101,170,202,10,24,27,154,164,135,152,144,145,124,113,179,34,
+30,233,128,61,148,97,112,81,249,140,42,171,35,139,217,241,37,42,116,146,12,19,36,80,
+156,210,236,0,25,80,100,221,177,140,245,122,240,8,72,8,173,0,196,0,66,5,20,102,
+22,151,237,193,179,32,241,73,102,39,100,81,142,165,58,142,102,70,159,199,219,108,206,87,
+183,115,109,113,17,253,166,145,164,124,2,207,135,88,44,113,62,167,236,223,156,154,33,153,
+27,25,16,213,242,54,50,21,187,172,160,34,89,214,28,220,47,115,185,79,139,235,70,234,
+227,158,141,237,226,15,231,186,10,184,86,89,185,121,221,98,164,229,229,26,157,81,248,12,
+31,207,196,57,65,84,48,88,180,171,82,12,25,98,209,48,148,246,22,35,63,68,61,113,
+59,89,84,175,171,132,45,162,10,40,86,103,14,177,145,242,79,73,224,190,166,87,141,7,
+64,108,14,57,102,28,119,76,175,193,158,165,210,117,35,209,43,171,238,98,61,102,110,193,
+58,227,162,248,179,41,59,61,44,244,116,19,127,191,131,93,204,254,60,231,186,75,78,217,
+157,187,144,172,17,99,104,203,113,163,21,153,141,243,3,73,120,4,120,222,28,226,103,120,
+253,235,76,134,54,220,133,119,143,155,47,26,201,255,195,161,169,229,104,111,131,65,253,221,
+253,98,122,209,167,67,17,95,95,239,94,34,175,255,56,62,162,127,218,246,128,225,0,47,
+237,44,44,177,107,237,81,17,95,187,143,106,190,134,192,29,132,201,9,26,20,117,217,235,
+193,97,114,75,100,239,240,38,155,68,122,252,225,125,60,217,60,116,57,36,66,166,40,32,
+2,174,74,42,125,65,132,29,48,200,176,48,171,194,32,144,39,24,166,200,50,212,130,114,
+103,63,230,78,20,135,83,48,125,49,129,8,77,142,127,136,153,196,70,252,159,209,8,25,
+61,74,111,115,131,209,242,126,190,34,210,206,151,59,206,128,160,203,243,217,59,168,31,157,
+145,51,251,147,243,137,84,104,221,253,37,125,254,28,20,112,187,45,207,236,124,251,66,117,
+115,215,159,87,33,95,41,231,224,57,113,98,114,172,248,127,152,94,208,142,193,182,177,212,
+145,139,231,120,62,179,103,64,3,67,243,42,68,163,7,112,128,24,188,114,35,111,117,11,
+129,238,20,42,146,123,156,50,189,203,254,92,139,65,156,91,137,25,169,54,227,97,177,142,
+222,127,221,249,173,86,165,106,187,232,34,49,4,217,211,13,168,83,128,100,95,206,97,80,
+10,40,135,96,146,62,207,185,19,13,169,159,173,244,31,81,205,17,38,79,237,194,135,68,
+162,132,66,100,0,192,8,2,5,99,65,253,221,187,52,255,199,221,58,11,169,47,249,245,
+21,50,15,220,113,181,255,67,70,33,192,175,177,136,148,132,19,85,16,107,232,43,68,163,
+8,23,242,35,188,203,6,232,152,212,218,152,189,164,200,158,152,232,228,157,147,138,25,199,
+132,165,66,247,165,200,149,2,74,117,9,243,235,135,124,248,147,77,83,159,165,40,153,106,
+9,194,234,207,70,91,110,215,201,210,76,151,241,228,150,54,93,87,189,16,25,49,167,131,
+174,135,180,78,135,196,86,3,123,60,72,28,53,238,171,252,229,159,136,209,225,218,140,236,
+174,210,116,170,218,130,76,244,207,19,214,34,179,39,182,242,141,187,157,204,239,97,196,40,
+153,143,117,69,111,252,181,11,29,95,31,116,157,124,251,7,78,19,19,164,128,81,64,123,
+53,19,179,123,170,134,189,187,186,15,219,26,223,19,195,124,173,199,123,225,122,88,225,250,
+132,138,172,206,123,240,156,138,206,50,239,79,162,255,33,226,246,106,148,223,73,232,55,120,
+212,16,52,194,87,38,241,152,247,154,146,202,89,214,114,77,242,81,219,32,23,203,22,91,
+139,63,94,241,154,64,250,181,41,32,30,105,141,11,95,25,148,172,51,149,70,4,5,101,
+154,1,93,3,31,43,58,196,169,153,218,227,100,239,24,125,104,41,218,212,231,230,120,154,
+234,199,251,71,222,213,134,202,76,115,135,0,105,148,212,20,125,217,18,126,70,16,146,40,
+138,73,80,132,148,124,82,179,126,22,11,32,20,250,186,100,167,3,199,171,221,174,9,253,
+113,132,184,28,32,55,227,168,10,88,72,223,154,21,24,94,180,66,155,63,23,242,39,210,
+152,42,250,219,9,124,233,84,230,116,133,224,74,177,138,33,104,188,235,78,97,64,135,4,
+131,192,113,136,19,165,125,44,46,75,21,91,106,154,104,158,127,108,162,245,65,128,77,201,
+176,140,9,126,90,232,38,153,200,91,161,119,125,88,203,102,251,161,203,57,132,96,24,102,
+123,164,252,194,6,178,70,93,109,31,127,187,143,157,41,20,8,126,155,31,233,150,152,141,
+23,214,207,165,120,148,49,233,57,243,253,15,201,157,73,133,228,70,208,102,247,221,116,203,
+114,32,234,18,121,193,185,234,33,34,66,18,127,47,165,127,221,254,223,119,84,25,56,159,
+224,254,180,255,137,92,158,107,161,152,128,62,212,117,237,78,231,161,254,90,124,68,38,249,
+65,84,80,8,4,152,99,255,64,190,105,99,48,88,152,165,70,23,225,87,223,169,226,117,
+3,63,93,240,25,0,107,84,178,255,159,182,93,188,46,40,119,35,50,206,175,246,220,35,
+149,163,189,16,241,75,218,194,177,48,178,236,207,250,254,235,181,245,43,218,62,41,214,119,
+201,148,187,3,254,152,153,54,63,124,179,184,231,138,14,160,213,202,69,231,212,141,215,227,
+244,156,139,204,37,214,97,37,243,71,204,84,250,82,158,191,43,233,26,122,21,56,30,162,
+41,170,243,168,53,238,95,40,175,75,26,83,107,5,211,98,38,232,86,154,226,7,88,123,
+47,211,119,209,55,175,179,93,189,35,223,190,191,81,140,143,17,53,203,88,252,218,222,74,
+119,67,163,94,89,146,173,235,67,177,238,26,66,159,65,21,232,187,51,73,201,202,215,132,
+148,27,149,93,146,208,112,151,197,189,131,50,120,235,253,140,70,135,39,53,102,175,13,219,
+127,101,99,65,146,65,103,249,162,113,90,241,163,36,244,228,134,182,43,242,27,154,73,17,
+25,46,247,40,130,45,29,47,131,127,148,53,224,130,5,168,204,81,196,20,21,22,17,81,
+190,28,171,235,114,222,35,46,228,96,19,177,98,70,228,116,88,112,248,198,47,172,135,161,
+143,81,254,246,230,251,125,9,120,163,242,132,22,124,255,36,26,141,37,225,14,104,17,58,
+48,195,172,188,56,111,194,243,123,141,140,99,130,3,212,104,250,234,18,122,207,59,36,208,
+225,18,103,194,121,203,109,246,27,60,62,231,108,121,22,157,217,151,40,208,102,127,162,12,
+69,23,31,221,99,241,224,234,198,226,144,85,169,126,234,100,237,23,235,90,243,240,220,251,
+240,202,249,102,190,170,63,41,246,58,21,208,145,5,210,39,170,177,22,177,52,65,165,60,
+67,51,207,248,187,197,126,47,99,32,51,190,113,229,250,45,214,220,213,206,50,19,119,233,
+253,36,149,234,125,242,67,230,180,56,26,100,124,196,20,112,194,105,164,159,252,81,165,149,
+0,207,229,252,106,232,235,21,83,62,84,243,202,52,113,62,172,169,76,49,157,165,141,68,
+74,188,52,64,221,142,209,40,19,149,171,194,40,244,15,28,184,67,250,61,98,15,174,14,
+172,18,155,229,131,0,238,146,247,100,108,95,99,122,15,203,26,43,108,254,129,240,105,73,
+64,206,71,72,209,120,179,85,141,114,109,240,224,215,64,148,222,208,130,217,92,94,185,225,
+88,248,166,126,76,194,75,251,100,255,71,78,108,46,122,153,220,141,156,166,189,108,115,115,
+208,117,186,147,111,254,82,92,200,57,225,14,67,69,158,38,180,51,50,161,41,74,235,231,
+58,80,164,31,135,98,4,9,252,241,85,73,100,93,224,176,166,184,166,50,170,146,183,117,
+218,31,71,193,42,68,51,170,194,240,4,152,26,114,135,167,0,123,208,114,123,13,162,174,
+136,26,234,43,154,173,215,62,227,42,174,98,176,80,54,116,186,84,162,203,33,110,149,251,
+83,83,252,51,12,54,55,140,112,112,82,5,176,243,125,27,222,160,163,230,170,132,229,8,
+207,31,202,230,213,25,222,241,192,100,80,99,66,62,164,211,146,70,219,183,198,2,186,13,
+73,100,252,130,227,63,195,227,15,18,238,106,86,194,73,222,179,194,14,238,245,102,85,162,
+108,25,225,120,157,162,120,121,236,234,178,154,61,109,49,224,8,226,62,85,133,208,59,26,
+220,193,183,168,236,180,111,126,10,55,189,152,122,108,91,199,81,208,222,75,80,92,202,214,
+204,148,99,24,125,29,246,187,64,175,196,206,76,148,169,96,226,130,83,116,94,248,193,201,
+172,234,146,132,187,231,25,73,236,168,124,190,103,35,169,155,248,66,56,98,3,96,172,8,
+123,75,27,230,49,63,213,16,224,40,9,72,4,90,158,104,223,89,179,181,102,26,91,69,
+135,148,152,8,235,155,31,153,35,223,184,133,65,248,203,132,87,121,62,147,12,248,116,150,
+29,42,215,69,249,239,205,132,231,89,46,183,200,53,191,11,241,208,241,21,217,47,245,126,
+209,36,6,92,67,243,83,110,28,201,62,178,86,67,59,242,115,138,200,171,8,135,4,152,
+174,114,226,162,4,138,223,225,252,241,52,203,166,183,96,76,24,211,102,55,198,2,87,240,
+193,206,97,209,36,163,237,97,164,17,17,1,66,73,10,92,162,140,245,238,208,80,202,240,
+15,101,193,151,145,80,97,55,22,194,89,94,98,136,33,247,205,58,109,102,142,248,20,128,
+248,222,98,163,142,116,168,130,4,170,32,49,93,14,70,6,36,232,78,159,23,193,192,56,
+26,237,54,52,100,6,134,17,247,64,51,6,53,130,14,100,184,193,58,231,75,74,152,51,
+37,173,10,82,128,112,38,170,126,69,10,198,170,103,201,165,32,162,227,114,90,144,99,123,
+243,108,192,72,178,241,16,147,26,163,199,63,24,240,21,51,101,51,141,27,231,120,176,58,
+10,125,226,195,106,66,29,248,152,37,239,200,130,245,22,52,90,1,97,237,81,71,172,175,
+194,239,122,130,207,24,23,63,20,228,229,198,126,213,86,20,211,11,10,255,134,198,204,189,
+222,233,241,48,73,235,245,158,138,107,147,187,121,21,181,170,8,16,182,140,87,184,63,157,
+26,101,215,87,58,177,100,124,19,28,238,46,29,131,255,107,223,38,120,60,219,175,221,187,
+236,191,12,25,222,46,104,86,222,139,196,252,181,130,80,98,80,114,34,138,165,69,97,109,
+159,33,142,52,187,182,9,36,73,39,240,255,244,52,91,56,109,149,93,33,197,4,228,0,
+187,190,8,24,173,236,161,204,224,57,183,95,147,98,65,25,57,251,2,153,1,108,188,202,
+145,170,19,31,99,177,144,183,228,251,188,188,157,207,156,96,218,1,223,16,123,133,27,237,
+224,144,89,37,37,184,28,238,90,222,99,90,145,25,17,46,169,100,103,32,72,159,202,106,
+41,95,145,100,67,50,66,94,152,177,68,177,216,14,92,107,252,124,209,105,187,66,16,168,
+117,146,154,69,94,219,173,201,147,47,249,191,141,90,198,151,243,226,234,93,165,170,207,84,
+252,151,129,165,136,192,24,170,159,89,124,214,141,26,187,220,170,24,12,4,90,101,126,19,
+174,231,156,71,184,103,116,198,176,20,148,166,243,38,40,120,154,229,240,188,41,210,152,38,
+57,214,0,193,65,132,80,234,35,161,65,119,96,139,167,228,241,57,86,119,197,136,114,68,
+214,168,135,86,227,154,69,33,36,203,44,176,121,200,94,23,119,229,139,248,108,253,239,160,
+193,255,165,8,7,0,108,72,22,174,174,31,122,20,61,231,192,239,30,84,220,57,89,95,
+188,91,167,83,46,113,4,224,57,16,168,12,0,208,97,136,233,39,255,113,140,77,29,31,
+112,47,89,129,102,104,243,12,153,59,134,33,6,25,81,247,138,7,160,131,52,253,226,146,
+152,147,165,147,240,241,92,158,147,241,253,123,141,1,44,213,253,132,100,95,254,231,24,149,
+225,89,49,88,127,218,77,244,93,203,227,54,80,163,38,239,227,201,142,91,125,96,253,237,
+57,200,24,0,160,252,198,249,23,204,132,70,235,210,184,72,77,138,28,89,25,125,181,37,
+94,251,66,25,204,166,242,72,149,99,123,185,178,215,247,150,69,105,23,178,111,221,138,18,
+106,149,242,50,211,249,42,200,125,200,133,164,194,179,211,170,81,39,7,57,224,201,39,51,
+91,207,214,200,20,87,123,180,14,63,242,55,83,240,166,75,213,194,114,50,71,167,198,117,
+219,206,90,36,78,120,129,146,123,94,159,208,75,22,219,85,29,238,223,192,122,179,22,196,
+93,254,101,129,255,219,47,244,202,175,214,213,171,131,27,18,214,121,65,249,221,133,241,216,
+122,4,145,243,34,19,222,132,175,163,108,3,18,14,182,231,44,45,140,224,204,33,164,47,
+154,122,164,107,119,32,28,168,242,97,31,185,26,208,178,83,52,26,129,40,67,180,121,19,
+141,175,158,47,224,220,45,182,34,137,5,13,43,226,100,60,39,166,98,198,158,35,0,111,
+54,168,48,81,82,62,201,160,104,30,54,219,52,221,14,249,69,142,60,47,169,222,79,204,
+238,157,83,82,215,202,4,78,232,196,194,136,27,229,250,83,235,102,141,96,164,51,146,145,
+120,121,22,170,240,179,16,55,241,215,146,88,177,130,176,15,124,98,130,32,42,61,182,170,
+178,136,68,73,43,194,223,12,69,22,87,162,128,243,32,167,196,12,45,220,228,194,92,124,
+80,177,145,6,15,16,108,118,145,252,20,144,82,21,233,43,115,229,130,192,228,52,8,78,
+131,144,130,238,30,97,41,176,15,160,219,35,37,73,20,65,3,8,72,158,81,0,57,141,
+88,239,219,123,134,86,61,105,148,25,4,70,94,173,250,223,148,146,180,253,124,83,51,207,
+44,188,250,49,178,237,111,6,202,234,30,12,0,128,100,73,44,164,211,49,157,110,173,35,
+206,58,171,224,43,177,109,80,106,142,161,219,209,16,81,226,71,206,101,85,75,235,255,149,
+76,169,94,2,85,68,174,136,146,90,118,10,20,127,1,85,32,123,47,7,169,63,58,229,
+138,233,13,212,134,157,9,31,112,56,115,103,119,33,61,176,250,5,233,93,88,231,75,188,
+38,171,242,114,69,229,77,254,2,102,62,203,61,35,24,209,173,215,134,175,118,54,146,58,
+11,248,45,165,65,197,62,69,115,108,30,165,58,165,45,100,132,111,239,2,128,238,141,55,
+79,205,193,209,111,92,36,61,221,207,158,145,181,215,169,246,115,43,236,126,191,140,142,26,
+195,92,25,250,138,127,235,193,137,74,135,19,237,202,244,228,182,215,148,218,206,176,231,167,
+224,137,153,244,252,187,88,85,55,117,85,216,58,55,186,240,0,110,45,18,118,231,46,114,
+180,235,113,180,205,218,137,121,72,123,16,90,106,209,106,14,22,16,181,96,102,162,199,165,
+44,216,131,196,179,189,214,17,9,81,10,28,215,194,63,175,80,86,228,143,48,158,21,74,
+10,152,124,2,134,74,140,164,13,9,119,77,123,217,84,242,5,71,114,92,191,0,40,206,
+195,120,118,15,144,213,33,45,246,202,26,17,205,38,165,12,210,43,210,210,222,67,253,162,
+166,238,71,113,41,141,133,44,172,164,110,1,164,205,165,245,226,254,115,62,60,3,103,239,
+202,190,22,199,106,55,108,213,253,160,97,12,130,66,24,11,240,244,12,26,228,247,214,36,
+194,196,67,91,252,2,11,250,181,216,12,240,231,149,252,177,199,157,246,68,64,52,25,29,
+235,198,179,111,32,95,95,44,165,126,72,125,234,143,151,127,125,37,101,78,105,13,195,166,
+127,242,51,99,34,97,27,63,225,15,113,137,148,33,10,205,176,203,33,53,134,88,140,250,
+141,46,225,69,8,180,134,49,16,34,5,158,176,127,191,206,237,113,142,44,207,202,116,196,
+225,231,104,75,56,53,179,144,4,68,38,193,189,209,128,39,196,59,193,228,51,67,246,51,
+45,121,67,140,188,129,160,248,153,160,216,12,25,253,222,87,208,64,215,18,142,28,103,132,
+249,49,66,56,109,5,3,24,222,111,199,94,138,218,45,38,147,212,247,146,165,243,118,126,
+35,36,226,63,143,5,251,155,221,35,193,49,78,220,243,66,150,244,220,33,59,234,176,210,
+61,196,168,172,226,209,167,79,124,52,5,125,223,118,59,235,159,143,199,186,231,118,74,247,
+16,207,70,209,242,21,214,28,245,228,80,34,97,98,10,217,109,79,68,89,149,247,185,177,
+65,115,181,17,209,205,207,236,13,219,16,119,223,117,219,217,71,251,127,72,61,120,79,252,
+171,205,204,105,23,67,36,181,227,211,71,199,208,207,24,96,206,122,28,115,93,118,174,143,
+253,54,245,126,230,92,31,151,102,63,207,230,229,36,167,168,39,76,80,58,101,2,168,38,
+2,91,97,44,156,138,186,172,138,176,41,194,19,247,13,72,78,131,206,240,110,23,24,19,
+85,131,154,221,155,36,189,136,103,139,209,37,4,17,41,75,87,219,239,18,200,142,137,9,
+101,244,119,70,169,158,241,48,95,216,98,76,110,238,194,91,24,196,233,41,201,222,90,1,
+230,135,200,173,239,217,248,248,207,211,53,87,227,30,113,208,103,68,97,106,240,237,51,74,
+152,153,252,200,182,173,114,130,105,90,97,230,191,197,137,240,187,64,105,192,210,193,207,78,
+60,165,101,105,3,5,162,209,245,251,9,17,23,7,76,152,49,89,222,182,37,124,81,151,
+251,207,195,53,10,123,118,143,220,206,165,240,159,235,138,156,84,64,143,226,2,16,29,226,
+194,72,6,151,207,14,35,15,24,128,188,171,115,232,146,108,215,151,251,15,99,15,225,244,
+105,254,146,208,48,54,154,132,80,44,191,127,201,161,192,250,21,178,152,147,64,98,254,248,
+130,65,16,180,9,51,117,42,177,8,26,101,136,131,224,206,137,196,17,39,121,196,243,4,
+149,160,65,131,132,96,221,4,0,78,129,88,114,7,20,20,226,122,242,54,130,156,52,7,
+154,227,138,60,20,24,192,129,64,116,194,4,48,17,219,49,231,27,27,67,215,203,136,123,
+53,24,211,188,81,5,255,51,172,162,169,138,40,198,151,213,195,253,228,101,32,113,232,48,
+102,111,78,60,54,11,203,58,143,34,8,91,224,180,52,33,94,22,167,39,64,79,10,143,
+64,35,81,165,75,206,45,11,190,168,238,244,63,11,221,60,163,196,244,154,226,147,180,221,
+5,227,76,252,167,99,232,164,160,236,224,103,51,156,31,32,164,12,199,91,39,193,36,62,
+89,39,168,198,215,253,246,69,237,126,239,139,201,187,88,237,217,207,195,202,103,217,193,25,
+187,184,38,254,63,203,235,193,146,151,197,78,198,158,109,103,148,99,69,26,71,249,28,170,
+160,251,112,124,62,187,111,52,138,109,90,51,208,87,252,180,190,121,243,188,214,103,231,70,
+176,150,111,107,169,16,179,58,207,27,230,218,123,72,22,231,153,116,179,15,202,150,129,66,
+15,177,91,196,247,207,134,7,52,56,239,86,83,121,226,157,127,58,188,92,252,250,113,132,
+44,22,185,156,79,89,252,88,237,219,13,228,135,247,100,237,110,92,86,209,169,185,190,133,
+179,44,80,225,75,67,56,32,22,220,177,69,89,231,183,84,152,139,144,105,200,230,47,204,
+21,19,252,207,235,191,141,62,255,217,153,107,52,229,135,228,145,247,160,25,69,224,43,246,
+30,231,9,113,1,21,243,119,251,3,242,226,104,145,80,32,88,63,96,218,209,212,90,196,
+236,119,220,152,226,176,112,204,44,84,149,198,243,142,123,50,97,21,99,149,118,143,82,125,
+6,75,214,243,85,240,197,65,143,144,75,227,183,180,237,51,254,94,48,210,32,46,145,70,
+72,168,151,239,145,163,140,247,122,106,52,171,161,1,196,149,20,85,219,235,159,131,239,160,
+212,214,131,69,41,7,134,190,50,6,11,220,210,220,138,188,246,195,34,72,227,164,72,233,
+88,167,155,101,103,95,18,206,149,48,24,97,242,252,98,215,222,149,34,84,160,30,55,133,
+123,20,37,61,11,218,58,158,178,167,80,254,30,51,134,31,107,207,253,70,195,25,152,47,
+182,169,97,9,34,33,18,169,179,210,195,234,3,255,7,249,127,193,99,126,236,161,31,186,
+96,234,66,132,192,68,223,84,216,21,203,244,80,66,182,201,197,15,242,190,179,223,251,95,
+115,47,221,95,83,235,211,235,249,148,247,253,75,193,202,103,160,61,76,31,80,212,47,163,
+168,68,102,184,113,161,210,86,105,145,101,91,67,80,96,226,136,66,213,70,3,201,65,182,
+252,149,201,36,66,24,45,117,57,88,174,38,46,66,38,63,213,228,133,14,49,7,181,130,
+43,7,34,14,21,179,188,242,25,31,4,106,44,109,212,30,180,85,129,235,250,234,35,208,
+49,199,245,167,221,159,16,20,48,49,191,132,43,223,51,231,169,55,49,169,7,149,80,53,
+38,97,42,95,142,27,45,38,212,242,219,110,178,221,26,243,119,228,234,240,111,223,177,224,
+249,250,246,227,171,211,2,16,182,9,238,236,97,50,140,49,131,233,241,241,254,67,189,34,
+126,20,179,166,197,179,91,0,194,79,1,79,34,56,21,14,224,33,0,29,0,127,142,148,
+185,121,195,5,161,233,236,173,168,165,206,160,178,157,56,86,220,107,169,48,142,217,9,142,
+49,46,66,169,207,46,217,177,153,10,156,26,109,85,3,206,152,50,3,199,132,1,193,23,
+102,22,16,16,51,245,34,12,64,16,34,246,254,239,20,110,110,2,194,103,229,253,95,202,
+142,255,99,246,190,9,133,182,239,193,159,11,61,136,174,31,55,197,238,163,197,108,108,87,
+217,224,185,159,133,240,168,85,118,246,165,218,219,219,7,132,184,162,151,229,169,200,102,79,
+228,34,48,26,42,39,49,248,116,235,25,253,82,68,153,0,65,2,242,16,232,185,152,22,
+120,158,88,176,18,136,156,84,64,25,180,43,6,144,102,126,109,235,73,48,238,85,191,152,
+40,247,231,76,250,24,230,200,226,224,149,145,164,46,101,63,214,119,228,198,143,135,223,193,
+249,12,151,248,25,253,9,12,184,128,189,172,124,89,102,2,34,15,232,24,12,64,32,3,
+66,0,248,51,236,146,80,2,101,132,205,158,63,61,189,77,96,50,10,68,101,255,4,126,
+167,171,95,228,247,41,244,62,79,242,120,215,196,239,137,63,143,207,243,247,244,232,224,191,
+88,144,143,21,174,11,210,65,43,2,21,230,4,56,76,189,47,136,146,151,46,164,186,214,
+64,242,71,49,57,234,148,75,42,101,52,173,10,189,8,67,175,62,241,48,22,156,72,239,
+146,159,202,55,101,19,86,15,78,239,255,84,135,190,124,87,125,210,63,243,175,245,89,39,
+241,111,45,196,247,112,56,52,68,255,131,23,1,80,219,105,121,241,181,61,255,90,103,143,
+177,142,242,71,40,242,126,205,215,242,60,252,126,167,18,208,147,253,254,255,131,240,75,170,
+251,83,127,152,51,8,229,184,234,62,111,147,225,226,244,112,75,139,193,158,43,190,111,227,
+97,249,255,205,89,255,249,187,225,228,248,77,113,128,12,66,5,223,13,53,222,11,246,213,
+125,251,112,138,142,217,197,189,157,48,191,93,78,107,81,139,19,169,7,191,205,194,95,147,
+71,148,233,35,125,199,68,176,211,244,147,249,255,236,175,229,248,121,232,255,171,252,106,143,
+225,45,191,79,198,106,128,255,9,218,163,203,107,46,68,1,176,67,253,143,202,207,75,135,
+85,167,49,43,45,227,12,199,20,133,64,247,164,254,155,239,189,30,239,189,63,47,63,51,
+183,247,133,138,139,189,170,80,14,186,70,143,221,252,45,59,138,246,203,76,62,30,41,205,
+53,97,232,61,158,30,73,8,206,1,222,31,102,27,161,89,72,83,15,123,140,12,92,43,
+136,206,59,238,35,117,4,48,231,91,52,96,47,184,67,162,177,254,146,191,16,197,217,167,
+208,143,160,130,130,146,40,2,2,135,208,195,24,165,31,164,49,8,94,249,23,174,128,98,
+2,102,73,212,252,219,54,64,38,65,52,206,202,88,230,111,189,15,81,170,47,140,40,84,
+105,140,43,124,210,0,101,79,77,186,107,205,230,234,138,59,132,5,135,124,228,73,173,173,
+109,237,177,49,159,149,243,255,82,169,164,205,187,235,197,48,184,63,245,144,87,36,243,56,
+227,3,68,16,2,64,128,0,56,231,12,0,209,10,0,128,66,8,11,228,157,173,186,74,
+71,154,107,100,12,173,214,159,80,48,127,23,222,75,139,87,253,44,86,228,9,69,224,45,
+196,226,195,61,100,90,234,145,174,72,95,116,57,72,132,194,13,71,138,105,169,240,11,15,
+241,34,136,57,176,95,228,194,43,228,65,249,200,166,90,248,196,199,33,203,219,224,207,123,
+248,120,175,123,232,101,79,77,76,23,53,137,242,83,42,216,244,165,212,90,97,188,229,228,
+143,175,94,73,241,34,254,134,96,255,237,238,82,37,182,7,6,228,216,233,235,249,102,178,
+58,124,223,175,155,85,96,191,145,43,236,188,117,255,97,22,37,61,208,83,251,212,40,95,
+110,49,98,183,169,108,175,125,158,23,127,139,122,63,196,159,130,33,148,95,189,242,255,248,
+216,247,197,30,136,90,56,123,158,138,143,23,165,214,52,252,85,16,252,105,248,127,167,242,
+244,17,9,97,240,249,32,149,96,84,122,122,209,228,221,218,95,223,5,169,176,44,238,169,
+36,79,111,178,85,114,116,167,109,144,133,45,117,171,11,83,70,2,140,236,94,89,220,12,
+68,124,225,215,21,4,138,83,185,39,210,192,22,39,36,87,67,67,193,136,88,111,120,32,
+18,233,200,16,50,242,157,54,149,135,170,245,28,182,241,132,42,3,25,182,124,191,208,95,
+205,62,62,61,31,206,126,95,217,253,65,108,60,181,213,6,203,28,249,111,234,88,158,22,
+147,161,142,117,253,57,243,20,36,176,246,114,98,1,87,83,44,135,161,128,235,173,155,26,
+95,66,1,244,69,143,98,195,132,72,99,0,45,219,236,125,65,178,34,241,137,6,160,47,
+173,132,230,234,248,27,91,175,214,68,75,160,65,39,54,8,57,57,81,197,217,224,228,21,
+169,80,170,195,136,38,77,21,217,50,156,82,92,37,119,249,127,143,191,102,236,249,21,4,
+8,244,63,42,20,18,236,191,80,243,192,10,220,242,25,30,221,158,215,225,232,39,164,27,
+83,201,234,196,147,250,23,224,187,253,37,134,78,44,199,168,160,33,30,24,151,254,95,120,
+19,0,51,196,0,136,160,64,128,17,14,253,101,255,155,217,253,146,204,0,88,238,143,239,
+134,241,2,65,1,24,24,17,145,88,46,163,17,69,59,205,196,109,247,59,159,24,236,7,
+205,24,75,147,55,168,25,127,1,208,173,13,111,187,74,76,106,83,5,165,138,124,110,204,
+249,168,143,28,174,143,98,31,41,36,14,125,234,222,3,117,159,155,186,198,49,95,77,145,
+78,207,177,13,18,190,117,157,63,10,49,55,159,151,213,111,204,252,135,86,212,58,150,206,
+83,45,200,22,4,79,234,182,28,190,131,187,63,73,175,115,238,63,74,60,38,85,222,39,
+170,56,30,62,89,7,159,147,131,99,51,179,106,173,49,120,8,47,79,46,93,239,179,250,
+145,66,60,76,109,88,157,21,144,175,135,43,218,240,242,124,124,62,172,6,50,105,60,34,
+229,121,255,31,103,198,200,108,101,213,95,188,198,168,93,43,253,166,184,77,192,91,44,155,
+235,253,126,127,235,242,150,136,254,62,69,69,140,0,48,112,100,28,173,109,96,21,151,37,
+12,144,62,77,253,94,224,136,175,226,48,130,205,254,174,66,219,119,99,153,79,128,42,2,
+148,31,199,241,34,94,176,131,125,104,103,15,145,15,155,16,190,235,240,221,84,214,200,87,
+228,255,142,98,226,2,78,87,245,58,129,197,64,50,102,252,95,123,41,36,104,9,93,198,
+85,193,130,227,146,173,40,69,73,27,187,181,49,145,205,30,135,22,118,165,58,129,121,233,
+114,197,91,127,65,225,121,217,67,171,76,68,15,80,203,93,132,0,108,244,85,220,210,12,
+45,178,95,192,214,116,26,251,104,69,192,86,251,232,155,104,110,29,79,200,33,77,90,218,
+111,222,52,120,80,192,106,227,199,171,120,197,44,129,168,199,74,34,13,2,43,155,10,47,
+248,141,95,5,178,163,102,113,164,251,227,150,118,110,126,137,18,191,196,99,62,157,95,122,
+93,244,139,17,129,129,170,56,107,32,95,205,232,32,167,191,180,92,145,78,223,208,115,12,
+81,104,186,183,252,128,36,217,1,0,128,139,44,15,242,154,32,159,244,65,46,210,77,11,
+172,28,65,240,78,203,194,135,49,249,20,34,210,100,77,121,221,229,197,65,73,20,210,131,
+208,179,231,175,47,18,86,91,28,228,167,247,132,142,69,69,232,117,174,245,29,170,241,75,
+156,102,219,195,136,101,215,196,116,204,80,107,30,236,230,97,48,52,184,149,78,168,123,252,
+165,71,209,248,158,167,88,206,213,107,93,114,232,168,52,127,241,185,156,90,87,37,215,79,
+228,4,138,140,95,103,29,181,247,184,0,196,42,127,238,254,182,177,86,167,145,192,94,117,
+20,97,155,95,85,65,241,111,105,51,244,31,207,11,134,61,43,169,253,244,216,180,86,63,
+186,208,91,159,157,190,160,159,111,146,147,225,51,86,32,255,86,187,165,144,77,195,135,9,
+232,43,129,65,130,30,84,156,193,15,85,115,198,113,203,231,106,95,130,164,49,141,40,190,
+208,38,176,112,69,24,147,225,199,70,220,130,161,83,24,210,103,69,109,97,170,160,150,197,
+118,62,99,20,163,170,52,85,26,28,177,200,8,0,69,116,177,188,32,50,209,152,175,226,
+99,179,125,104,112,6,237,209,59,80,248,200,219,87,109,61,154,104,87,169,251,196,159,36,
+138,225,193,18,246,249,182,132,34,136,224,124,59,15,184,118,158,175,30,85,217,24,231,126,
+12,131,70,184,48,169,12,46,123,249,164,248,96,253,185,182,78,44,155,63,204,64,19,48,
+64,61,219,214,245,81,40,122,250,36,87,223,32,147,197,244,67,159,215,39,222,34,185,68,
+147,46,127,214,242,100,218,2,209,165,231,15,13,160,28,29,169,177,166,74,230,149,13,246,
+134,113,98,227,141,17,42,136,201,45,181,70,255,233,228,188,248,15,18,16,72,81,4,242,
+242,48,172,101,100,46,100,91,187,19,162,99,251,25,149,224,24,206,191,243,81,188,40,30,
+88,33,20,192,29,134,8,232,223,2,217,95,64,210,18,18,80,146,89,83,155,166,139,60,
+209,27,153,217,34,58,40,160,138,74,18,8,81,224,244,17,120,226,83,77,71,75,40,216,
+128,254,62,39,196,63,252,243,190,124,35,117,189,119,111,203,105,66,39,195,118,179,85,230,
+211,236,148,104,146,145,253,205,114,199,21,214,109,188,192,169,175,250,178,133,218,163,75,199,
+163,59,20,243,53,240,100,249,40,252,92,185,241,123,234,178,111,20,21,71,204,107,245,169,
+233,122,83,176,200,74,249,189,196,106,204,96,159,152,39,206,17,71,219,3,102,189,215,126,
+32,175,117,41,240,86,65,175,112,106,38,37,33,238,144,255,78,178,190,81,79,252,95,187,
+233,215,254,126,255,236,225,254,38,70,241,113,91,79,95,94,170,250,114,253,99,114,230,217,
+232,31,10,35,90,220,108,247,27,164,76,42,45,225,126,61,200,14,77,74,128,153,22,141,
+179,162,66,221,29,70,53,233,153,206,54,9,235,205,201,36,169,229,32,202,65,243,145,160,
+52,26,52,59,124,190,213,35,153,173,214,49,185,127,24,89,15,172,127,152,249,211,223,131,
+156,179,235,141,102,42,88,97,1,192,144,41,235,173,208,222,60,138,247,244,155,129,208,57,
+123,245,170,107,182,7,228,17,0,130,181,14,136,59,191,116,82,129,54,232,140,21,236,231,
+32,162,133,167,34,48,80,222,198,150,26,189,7,98,223,221,127,14,8,120,67,168,15,159,
+1,216,247,103,146,53,165,6,98,189,48,29,203,246,94,149,6,121,153,42,175,41,191,218,
+23,13,100,197,17,84,219,126,51,3,180,117,69,236,36,99,132,16,240,177,82,13,160,249,
+218,137,253,197,41,242,14,34,42,186,150,2,42,193,244,249,11,82,119,251,73,125,199,30,
+242,87,103,45,159,253,88,81,43,150,124,141,68,3,117,115,161,137,29,226,251,206,2,74,
+14,90,242,163,157,232,239,77,133,179,78,163,167,100,60,207,232,50,88,24,42,81,226,99,
+189,150,13,62,68,17,212,208,9,127,30,189,47,217,239,152,8,214,187,252,158,223,158,35,
+158,251,10,56,70,162,226,62,191,32,134,165,254,101,66,194,209,172,137,130,211,242,225,110,
+27,189,125,41,159,217,90,10,238,199,149,171,191,18,123,131,63,203,129,91,143,147,152,197,
+175,245,21,45,166,212,133,46,238,102,205,164,233,30,62,190,191,37,140,117,236,213,115,30,
+31,5,127,135,240,40,87,229,173,39,34,187,215,84,207,224,2,232,221,18,150,89,255,62,
+232,255,235,183,254,190,158,219,255,231,39,251,4,251,5,78,103,55,27,152,43,4,109,242,
+239,254,110,18,51,98,81,224,4,14,120,192,204,133,168,162,162,100,201,66,15,212,233,18,
+74,2,181,39,227,70,213,57,149,120,10,166,133,116,196,249,205,95,140,50,40,142,65,57,
+182,200,233,165,70,109,12,50,67,23,213,151,78,44,141,164,62,189,93,145,120,190,46,154,
+91,4,242,252,218,54,99,244,28,43,100,22,141,21,113,169,246,60,175,153,183,187,57,73,
+246,97,149,190,19,111,95,121,153,7,0,163,56,238,4,124,112,255,176,222,232,91,184,30,
+113,53,22,101,138,88,96,4,16,14,18,109,2,114,236,6,214,8,160,53,177,175,188,174,
+166,89,87,126,168,111,65,120,103,114,165,62,205,68,68,72,94,126,9,57,190,157,100,244,
+90,134,89,167,25,168,97,235,132,198,87,32,154,180,131,129,3,0,255,63,126,12,194,69,
+81,243,157,165,75,46,250,142,158,80,114,75,151,248,129,88,56,207,38,35,248,135,0,20,
+36,168,100,75,134,187,217,228,209,6,34,147,4,72,37,204,223,21,85,111,138,39,218,177,
+76,191,232,199,145,191,218,56,117,156,114,244,233,135,248,185,150,23,81,232,184,248,124,41,
+135,130,237,156,20,35,28,182,171,255,156,99,31,47,140,229,49,98,132,123,28,219,254,179,
+0,239,228,155,38,76,250,170,139,22,18,252,138,94,90,241,99,119,177,126,234,166,117,8,
+108,168,206,255,181,226,233,53,47,182,151,221,240,225,188,98,5,61,243,125,223,132,125,45,
+127,87,58,229,124,218,95,103,218,227,124,230,220,100,122,116,56,18,170,76,29,146,204,226,
+251,199,227,183,229,220,250,58,124,123,95,116,251,191,119,142,203,237,168,223,202,221,229,174,
+62,197,175,215,21,246,117,253,127,223,242,175,105,253,139,255,244,24,220,63,15,141,71,251,
+45,255,62,105,67,131,172,103,162,116,31,151,120,13,5,143,112,30,30,138,188,186,141,122,
+82,252,52,159,168,95,17,29,253,237,238,121,191,0,201,47,116,61,16,124,230,249,140,58,
+18,100,47,40,180,95,41,183,29,247,36,37,82,90,100,192,102,50,14,128,200,153,232,207,
+147,0,167,67,169,18,82,190,85,40,27,140,12,135,25,227,235,3,206,186,95,174,75,192,
+131,109,111,151,115,187,191,93,8,121,111,140,188,254,34,135,207,56,118,68,248,148,205,30,
+23,135,177,120,255,116,41,33,24,121,178,181,137,253,186,65,144,61,175,139,84,101,163,19,
+158,246,83,193,83,180,35,13,144,203,133,156,169,161,115,163,64,166,49,89,42,52,150,96,
+110,218,170,10,2,71,230,12,15,218,31,146,8,13,94,215,243,229,38,202,107,121,255,183,
+176,137,84,8,122,83,74,104,126,191,92,102,203,88,8,160,252,52,13,169,255,104,117,131,
+31,141,61,250,126,42,125,195,8,123,164,146,160,249,204,8,152,128,137,20,171,31,55,159,
+200,29,173,192,8,42,137,11,228,49,247,226,13,128,143,192,64,86,80,176,252,8,175,30,
+60,255,101,63,27,168,252,80,70,192,94,155,243,65,39,89,164,33,25,88,160,86,41,192,
+169,254,21,88,8,206,13,51,239,66,65,79,198,17,191,249,36,239,74,211,105,55,96,90,
+218,213,214,69,41,12,126,144,5,14,221,125,170,127,60,25,172,79,199,9,47,232,250,34,
+143,223,235,83,249,126,59,91,71,243,161,229,32,251,140,173,155,231,221,239,243,187,224,223,
+228,254,212,60,50,220,169,255,199,217,246,20,113,183,249,201,105,65,9,231,246,127,123,168,
+88,111,180,111,153,126,220,119,52,215,239,241,99,101,248,74,233,82,120,182,252,191,7,155,
+221,246,254,31,171,200,132,31,163,186,88,162,174,234,126,68,61,33,120,66,46,63,131,252,
+10,34,58,100,20,214,165,84,60,20,253,161,117,168,195,190,155,219,97,76,47,38,41,2,
+173,234,245,131,28,206,255,206,90,50,154,159,195,228,248,186,171,254,47,39,11,174,209,96,
+9,174,88,225,126,244,225,91,247,143,78,80,201,104,194,49,34,76,121,102,137,18,179,180,
+200,106,68,247,254,158,21,41,20,27,139,102,49,138,57,128,236,16,166,44,85,219,200,131,
+75,69,153,211,185,55,252,74,211,15,173,240,174,249,196,97,191,232,120,98,96,252,207,160,
+112,156,81,13,160,100,119,168,77,98,233,62,120,65,177,247,207,60,187,174,217,204,141,41,
+185,204,103,236,203,207,1,104,39,185,68,69,128,245,238,108,122,91,21,24,51,167,204,29,
+20,168,29,75,14,160,87,67,32,117,20,66,242,16,34,139,2,149,181,241,147,126,229,191,
+134,70,7,209,84,176,108,201,70,30,168,96,187,178,30,51,62,75,51,210,15,146,241,63,
+67,116,170,143,191,210,192,234,77,138,234,104,52,223,49,100,161,50,7,220,208,67,66,147,
+247,248,44,1,255,32,12,131,82,127,199,229,21,244,225,225,33,194,62,110,5,238,5,165,
+114,4,37,202,105,63,120,3,212,169,165,177,174,250,138,176,161,46,185,246,5,161,86,95,
+159,23,188,205,11,56,184,242,147,5,214,193,132,121,129,74,90,4,73,101,195,130,209,47,
+20,73,191,85,30,14,133,15,198,188,251,159,190,213,248,237,255,252,249,112,232,237,152,171,
+180,104,143,13,213,212,66,237,155,38,243,144,211,142,119,98,29,199,252,79,65,248,174,138,
+119,117,212,112,253,119,227,114,32,57,100,90,43,195,34,151,201,134,170,165,171,218,190,163,
+241,11,68,151,217,200,225,242,245,252,113,125,168,162,90,113,239,144,241,243,238,205,201,108,
+89,125,205,14,73,23,194,9,12,81,195,150,159,103,95,208,209,55,228,145,247,132,199,63,
+9,103,177,121,175,207,255,33,123,212,123,130,13,246,246,255,110,142,14,142,188,21,229,121,
+170,46,105,175,64,24,214,152,150,62,138,75,158,119,86,117,226,16,31,208,86,211,164,169,
+162,218,197,62,183,34,152,157,39,87,85,104,129,92,119,141,212,23,83,194,226,218,227,90,
+28,228,228,183,209,79,214,100,168,71,56,139,166,233,61,72,220,53,198,170,19,163,46,111,
+104,53,36,3,101,126,6,176,235,79,35,26,215,57,25,212,235,86,154,104,23,70,239,159,
+167,11,82,100,160,207,4,154,124,126,225,233,204,37,118,230,178,103,156,169,225,210,173,135,
+9,57,120,38,121,235,176,197,0,183,36,32,17,146,97,54,186,190,34,130,132,101,12,96,
+162,138,24,113,175,97,41,234,36,115,36,243,225,165,27,48,29,68,3,81,240,129,13,0,
+45,153,70,111,217,231,140,31,198,243,124,30,195,29,28,29,142,176,0,58,149,246,74,205,
+106,159,196,250,156,4,217,125,42,210,25,92,205,79,245,60,50,174,142,170,112,137,24,151,
+161,11,61,234,245,0,146,11,142,24,10,104,32,42,126,1,113,148,126,45,163,178,200,164,
+121,126,51,189,159,152,104,126,126,199,184,68,44,136,58,10,146,214,66,205,158,114,36,157,
+204,159,239,68,55,223,12,9,62,208,80,88,98,126,67,147,60,243,195,40,236,122,63,98,
+76,214,119,11,229,27,178,1,200,68,113,126,102,121,233,232,215,6,224,43,17,145,241,42,
+235,166,115,149,207,250,125,209,86,24,108,66,135,254,183,158,115,111,124,159,167,236,218,214,
+236,72,122,110,151,19,175,220,65,118,79,199,245,225,171,185,247,245,166,154,88,240,126,95,
+5,114,28,254,94,85,30,247,234,129,243,89,177,81,199,59,247,124,217,170,193,241,35,4,
+67,248,87,31,65,67,124,223,232,127,15,244,255,95,102,85,25,143,44,175,79,211,245,10,
+31,195,212,15,123,172,0,233,249,78,220,63,140,9,202,0,238,57,56,88,10,48,253,7,
+244,168,163,105,193,156,55,21,164,14,110,94,70,71,55,177,33,29,174,107,246,248,175,36,
+49,70,2,226,243,134,75,157,11,161,119,81,158,132,125,116,68,151,1,243,191,53,192,166,
+61,247,103,80,95,24,216,17,58,73,91,254,131,209,226,61,238,187,23,104,142,228,193,7,
+152,60,164,25,49,142,127,130,170,156,218,227,233,107,158,110,48,159,90,180,124,224,39,219,
+13,96,52,24,92,67,87,167,49,215,5,140,204,135,168,223,157,216,201,183,94,206,177,62,
+31,95,23,200,41,33,164,17,217,183,166,190,192,161,68,97,246,135,212,92,100,245,156,196,
+129,151,9,176,194,242,149,132,194,250,6,0,238,225,255,50,188,185,82,4,0,246,220,166,
+54,209,239,239,251,17,141,45,46,105,211,195,231,247,62,54,177,71,69,200,196,40,120,35,
+145,149,189,113,111,143,51,190,39,223,132,133,192,136,178,51,187,249,143,202,15,40,7,116,
+255,55,183,174,19,59,48,1,160,136,117,150,21,86,75,27,163,35,43,117,204,253,176,2,
+132,108,215,77,191,55,250,74,164,244,9,157,14,145,102,174,127,199,174,199,45,195,172,74,
+94,104,51,253,160,192,181,144,196,235,57,184,60,237,145,189,239,42,159,199,114,175,167,163,
+241,244,199,162,194,211,34,188,43,175,131,167,239,105,196,24,150,95,201,199,193,91,168,103,
+228,165,36,165,183,67,127,237,106,143,243,226,201,129,147,255,28,77,95,75,66,248,44,22,
+251,142,203,190,79,207,11,253,82,206,255,143,229,209,113,233,201,115,75,189,144,162,73,80,
+5,7,63,233,14,254,187,247,76,50,39,242,254,127,227,195,248,255,240,127,15,237,84,37,
+178,59,116,213,127,80,196,16,8,80,82,144,24,30,5,7,132,1,215,112,125,215,206,3,
+3,155,17,96,6,15,134,228,47,241,140,91,21,212,205,187,33,235,252,49,228,116,247,20,
+10,211,115,187,152,161,41,182,3,12,47,139,193,217,171,61,89,191,226,62,184,240,60,58,
+148,229,112,124,159,172,139,169,252,180,64,42,140,1,32,139,55,118,147,186,85,73,240,26,
+80,57,132,222,28,12,84,7,122,117,187,252,48,30,12,27,94,159,94,198,159,140,54,176,
+205,12,96,252,250,62,91,162,158,80,135,127,240,165,121,172,39,56,87,146,143,150,184,43,
+252,248,139,138,96,73,128,211,1,75,199,5,162,32,4,235,228,14,0,34,146,228,19,51,
+22,84,108,238,93,26,114,197,11,110,150,191,44,52,215,113,9,32,174,57,176,142,157,152,
+214,250,50,63,31,4,177,212,108,127,143,25,230,115,255,8,140,89,21,18,155,109,10,192,
+86,120,120,172,244,52,255,169,114,255,47,198,174,101,157,39,39,16,133,22,62,128,51,223,
+121,95,15,236,114,36,170,91,224,127,103,243,67,24,240,247,5,128,15,25,127,240,19,6,
+69,123,9,24,65,35,127,226,42,108,39,115,47,47,129,73,156,138,50,81,64,131,181,26,
+194,250,120,105,235,81,116,77,32,238,13,156,192,66,20,73,232,187,114,44,113,80,113,151,
+23,217,191,12,253,251,54,79,2,195,250,30,108,242,94,124,39,107,250,72,106,126,56,103,
+237,229,68,45,187,165,247,204,135,79,155,252,135,203,38,79,26,149,172,252,52,63,199,199,
+13,130,111,197,252,127,191,21,41,220,65,185,189,223,140,5,248,200,110,225,143,230,101,51,
+236,93,206,55,87,235,200,118,155,202,214,173,252,59,187,10,96,233,125,99,46,108,252,86,
+15,229,237,183,247,113,189,95,85,79,252,254,163,31,63,219,11,230,133,228,201,243,164,255,
+66,247,176,12,231,64,102,127,11,174,241,94,61,159,15,127,183,210,63,144,24,207,52,22,
+86,118,32,149,235,226,218,129,47,193,48,252,168,87,202,139,235,97,73,2,161,167,99,10,
+126,100,142,100,230,24,134,186,123,144,137,187,24,226,25,15,201,38,148,201,163,151,60,66,
+120,84,33,46,167,197,244,135,242,23,56,195,196,16,186,213,169,39,47,255,43,169,243,190,
+5,148,22,217,162,171,123,237,153,59,185,92,50,34,197,64,38,67,224,130,8,16,3,8,
+23,89,221,2,128,253,192,101,66,131,126,208,216,242,195,14,96,45,81,30,161,168,116,12,
+16,119,25,239,136,99,195,239,147,174,235,9,245,240,70,119,125,166,146,227,125,26,253,76,
+239,92,26,19,57,35,92,91,181,226,163,151,247,24,127,136,81,203,43,98,84,215,33,175,
+171,132,149,92,141,24,6,23,88,239,165,153,162,23,148,1,92,7,98,7,0,64,89,126,
+30,1,47,232,168,98,77,155,28,202,16,71,24,85,141,130,124,250,162,106,88,192,183,45,
+254,251,16,194,65,31,253,166,169,82,200,5,46,208,168,14,178,136,209,230,8,95,213,243,
+64,2,95,26,104,79,21,116,170,31,183,208,90,114,203,189,182,155,236,172,93,151,167,246,
+123,154,143,62,213,127,157,84,230,150,244,172,66,166,148,88,106,63,133,67,138,66,190,185,
+19,142,125,152,191,67,77,24,43,179,83,251,31,87,43,79,187,175,244,254,223,182,11,108,
+152,124,72,13,206,95,171,253,22,247,246,42,194,218,246,76,110,22,254,255,59,75,221,246,
+42,80,210,197,157,219,215,96,6,225,10,16,4,9,166,255,128,183,185,246,252,100,19,254,
+241,9,42,80,193,14,156,32,183,214,246,125,150,224,217,111,102,38,216,225,254,115,217,186,
+194,146,29,87,219,173,235,163,251,121,243,178,138,82,112,253,71,53,237,204,174,114,88,21,
+217,241,99,107,141,103,173,206,50,231,176,152,140,70,193,146,87,244,75,184,92,140,58,85,
+4,125,187,200,141,217,60,120,211,249,8,180,204,107,232,104,43,82,134,120,90,89,88,88,
+160,249,181,218,179,126,228,150,167,178,29,200,214,68,105,100,99,111,6,201,80,218,190,210,
+64,252,17,136,128,247,35,113,111,135,162,28,17,253,159,236,66,5,94,36,137,50,71,5,
+46,16,51,67,36,78,101,194,14,44,149,182,13,200,192,245,193,13,116,111,46,19,148,157,
+132,33,232,154,6,196,77,176,104,199,221,90,149,69,3,55,108,26,65,98,243,125,187,7,
+90,116,22,13,117,51,132,156,72,56,133,225,20,132,244,47,57,68,58,0,144,128,16,64,
+36,0,255,252,23,32,64,11,255,208,8,242,13,113,127,78,3,70,124,7,66,95,9,254,
+255,168,244,144,138,74,11,64,89,33,197,3,136,155,152,120,82,27,175,59,43,205,240,189,
+150,50,112,190,146,55,159,250,131,178,68,224,146,56,122,162,60,133,188,232,226,62,137,105,
+188,73,193,47,248,3,158,47,21,88,39,188,231,26,193,7,127,161,45,149,223,188,234,238,
+156,221,21,15,155,146,14,10,127,220,251,96,48,222,127,189,59,175,155,242,250,44,255,234,
+163,249,210,253,80,120,30,247,103,101,250,47,148,166,234,223,7,245,250,3,136,251,127,140,
+7,216,243,17,248,17,225,255,191,215,252,181,95,147,126,127,23,145,191,235,173,232,117,91,
+208,247,121,17,253,61,203,47,248,92,0,127,127,216,27,167,187,253,67,229,241,93,62,10,
+233,62,15,88,96,116,122,252,93,196,0,11,255,111,244,31,230,32,60,195,16,20,95,7,
+139,40,23,126,26,27,95,215,221,254,199,243,120,170,203,205,232,106,225,108,90,39,219,200,
+209,255,72,12,67,95,154,243,249,68,46,112,223,121,115,38,62,204,193,205,103,100,22,226,
+236,238,52,49,75,252,255,47,172,255,237,242,121,188,159,120,184,95,102,107,6,28,118,167,
+30,172,17,186,235,94,182,119,184,119,19,205,250,214,33,88,107,191,1,227,241,131,28,233,
+143,48,184,191,185,41,147,1,123,107,21,121,52,180,203,121,116,218,198,0,184,90,163,136,
+41,221,245,133,22,248,55,178,190,226,178,159,4,132,68,25,136,239,73,202,205,179,44,75,
+211,122,187,255,145,77,115,189,236,153,249,237,30,207,173,152,115,254,124,220,222,131,115,98,
+138,33,183,180,133,238,193,255,232,1,223,108,19,160,59,41,199,88,216,193,128,190,255,71,
+32,165,59,129,223,36,149,1,145,147,73,236,146,80,204,225,119,120,0,233,244,195,76,79,
+111,221,238,156,165,213,76,223,145,17,223,96,4,241,253,118,62,247,56,243,81,31,36,15,
+125,183,138,21,247,245,45,253,158,63,157,86,210,143,64,149,242,90,126,127,164,191,156,189,
+212,151,59,229,149,49,31,55,87,170,179,226,97,120,179,245,178,98,138,94,122,107,28,226,
+250,74,4,255,23,170,166,15,229,253,61,159,22,170,181,95,205,123,36,55,105,162,128,3,
+125,127,187,233,143,209,22,83,9,254,70,243,234,254,113,79,255,188,186,68,17,59,231,165,
+183,204,187,254,243,7,252,64,212,6,241,63,153,112,255,63,96,224,0,2,7,239,12,3,
+114,242,255,65,71,182,219,115,167,30,44,62,4,206,79,247,38,63,75,18,39,249,109,126,
+243,178,83,111,97,26,225,19,236,56,226,206,166,143,66,159,96,201,84,193,50,11,33,5,
+150,63,27,153,12,215,210,153,89,252,92,58,203,147,126,110,168,54,25,157,223,227,47,221,
+41,17,25,130,81,56,250,169,99,117,49,31,159,209,249,189,93,194,96,124,119,191,93,235,
+13,217,49,159,241,255,176,170,197,34,32,75,250,214,247,73,25,108,164,81,196,140,70,156,
+50,127,90,161,37,22,25,253,63,53,120,93,210,211,143,148,10,127,87,254,186,252,1,228,
+206,37,42,129,62,160,76,194,232,235,169,251,240,105,150,93,187,115,127,84,166,130,152,40,
+218,47,238,68,152,157,4,112,83,54,155,41,31,13,222,132,0,196,8,252,73,15,62,15,
+226,59,189,252,163,193,207,169,64,130,15,181,29,180,84,104,244,68,100,220,241,141,119,241,
+112,240,169,254,102,56,165,131,61,27,28,1,0,110,36,96,71,141,62,133,49,136,104,231,
+114,192,171,23,238,89,133,17,253,174,138,218,37,117,136,253,148,73,33,50,82,37,168,150,
+171,228,181,137,148,123,121,154,91,77,146,213,32,85,217,255,154,232,63,213,53,147,253,21,
+182,183,225,225,230,175,46,38,36,5,182,241,170,125,239,77,86,129,247,97,48,24,223,22,
+63,45,7,217,248,201,161,80,199,245,211,90,235,136,213,74,95,204,50,120,60,8,232,107,
+254,109,186,210,189,192,30,81,11,38,221,11,37,127,235,235,254,159,119,185,165,173,204,94,
+238,111,224,249,189,9,10,144,15,248,249,0,233,109,175,215,57,71,132,51,251,254,111,160,
+22,250,37,148,234,195,230,198,232,201,248,106,75,140,34,198,55,33,196,151,51,239,208,222,
+120,229,241,135,123,4,177,162,79,92,101,215,237,183,64,121,45,216,181,130,39,74,202,187,
+227,131,161,96,164,77,186,55,121,163,236,88,99,220,252,31,26,63,45,252,154,146,60,172,
+221,142,236,26,50,255,195,188,250,28,12,17,146,178,96,211,182,99,57,228,34,174,166,29,
+159,187,201,229,54,130,157,180,23,120,104,61,30,106,59,177,112,52,15,152,9,162,35,88,
+39,216,98,252,69,22,192,107,195,177,59,167,133,242,244,7,210,108,226,133,203,34,160,183,
+108,251,53,178,248,10,97,75,146,150,113,135,30,211,14,86,154,191,223,138,44,28,129,130,
+148,216,104,238,131,105,134,113,154,124,68,200,21,71,245,163,221,247,248,74,146,152,48,127,
+16,191,192,72,208,42,235,230,83,167,54,70,203,211,13,13,234,31,84,160,218,20,48,126,
+5,111,110,215,8,162,70,208,205,182,144,113,91,254,82,43,102,26,255,8,105,126,131,43,
+122,97,229,79,199,107,60,18,241,13,253,111,56,79,62,46,242,249,109,29,99,104,103,47,
+54,229,130,244,55,247,164,247,59,157,238,80,100,65,88,69,122,154,223,69,17,151,18,242,
+137,250,131,18,235,225,152,181,70,219,49,21,196,30,87,3,169,124,190,63,134,14,231,225,
+65,91,120,193,164,61,236,88,58,27,127,189,120,180,111,237,57,184,130,11,255,19,239,81,
+125,177,209,32,253,55,119,84,26,221,222,251,35,55,63,119,237,226,254,21,231,239,235,173,
+172,27,80,13,241,124,45,241,253,201,24,187,241,245,61,191,127,76,212,180,163,0,130,36,
+204,5,71,145,36,88,193,136,31,234,11,135,136,101,228,116,148,52,88,197,140,243,68,5,
+186,14,26,88,104,225,105,117,138,165,201,174,173,69,175,147,163,163,126,206,87,49,107,140,
+0,170,142,102,35,85,231,173,225,123,188,31,143,164,153,116,29,0,193,38,152,250,97,24,
+9,117,81,152,245,87,143,203,11,212,228,50,137,140,89,112,186,251,115,247,35,232,75,5,
+59,185,239,45,24,230,91,209,193,114,24,192,5,237,152,66,212,184,170,10,9,24,56,112,
+55,102,63,112,120,195,65,13,195,176,76,146,27,79,143,13,30,234,41,228,158,241,114,60,
+227,167,147,60,163,90,92,204,87,203,132,59,169,30,255,240,31,232,31,116,44,161,16,27,
+136,58,16,86,196,7,149,125,17,26,80,161,64,66,133,242,133,95,243,174,68,152,217,178,
+59,29,99,212,124,81,48,177,213,121,125,63,38,87,41,71,38,82,117,6,115,142,226,157,
+76,219,213,151,30,111,150,48,21,210,201,251,184,109,99,254,66,121,79,115,248,88,203,138,
+102,105,214,101,227,223,165,216,155,66,178,106,245,105,146,179,145,202,17,253,23,74,248,191,
+141,148,148,90,255,135,245,86,208,68,37,188,195,47,109,247,111,59,135,238,199,119,127,199,
+248,191,142,142,188,121,249,250,62,39,179,70,111,233,166,9,6,110,13,91,196,132,191,212,
+164,78,170,155,235,31,195,238,245,157,142,233,221,126,154,7,221,235,220,45,7,144,14,62,
+31,160,100,7,113,191,103,253,150,230,14,29,164,107,229,185,185,183,238,13,161,189,255,241,
+231,173,146,161,127,109,121,195,250,139,98,6,192,81,204,241,214,215,230,20,36,112,210,4,
+98,51,206,147,117,220,19,26,69,2,134,250,138,96,157,57,232,245,5,13,199,104,202,82,
+237,145,180,105,36,68,227,60,208,73,82,182,255,34,99,63,93,170,175,130,223,17,139,182,
+134,205,88,135,177,32,15,88,190,117,27,39,55,134,176,76,185,159,249,19,183,213,210,84,
+229,24,96,84,64,10,138,16,0,146,159,208,54,229,214,253,99,5,49,3,228,147,135,153,
+129,167,240,205,236,218,40,68,143,84,223,183,251,86,254,41,254,181,17,194,104,210,160,211,
+197,108,250,71,26,112,146,163,249,100,77,100,163,1,77,204,222,116,235,183,203,84,73,102,
+68,213,20,25,37,55,202,90,170,76,125,195,179,243,20,227,87,71,110,25,215,132,53,244,
+175,251,176,205,147,226,235,169,207,54,55,128,252,97,115,185,43,136,249,23,66,171,90,217,
+148,49,49,10,243,247,222,65,82,239,217,249,71,244,147,226,59,251,82,91,166,175,198,208,
+207,251,164,51,224,105,185,53,169,159,66,227,29,219,232,18,107,205,57,186,161,191,254,222,
+151,17,150,36,252,136,176,58,187,25,24,63,77,81,8,82,209,26,199,244,3,231,107,29,
+91,35,145,103,185,232,207,151,255,218,7,111,212,193,141,209,22,165,182,180,185,208,112,215,
+240,155,250,240,211,122,165,118,247,126,207,216,83,248,67,143,244,23,225,255,142,95,211,157,
+39,192,131,250,13,247,254,224,76,4,233,193,243,95,102,239,97,90,16,231,30,136,74,233,
+17,89,253,95,4,95,171,228,150,186,252,248,49,134,242,248,130,240,103,31,47,1,207,224,
+85,216,11,127,170,178,76,51,134,155,23,47,184,161,81,42,135,237,45,169,130,180,185,116,
+76,15,116,104,187,61,114,233,137,97,148,76,167,209,170,189,160,106,189,235,225,25,253,86,
+147,123,103,31,123,119,222,94,68,129,44,41,135,198,22,39,136,130,98,99,195,97,51,241,
+122,87,16,246,89,127,185,241,153,116,50,188,208,137,53,131,15,220,235,49,84,242,48,232,
+222,254,165,183,35,128,212,61,218,255,95,254,158,176,50,183,84,186,190,218,180,95,210,0,
+89,63,251,148,250,159,77,249,156,214,213,63,121,251,114,128,198,105,99,182,250,115,38,185,
+166,252,147,215,227,223,123,198,162,192,99,147,208,41,179,161,64,221,61,139,234,8,247,23,
+76,37,48,191,111,191,129,172,114,7,135,215,110,185,17,194,188,195,212,169,232,54,157,116,
+9,176,233,95,231,169,24,67,145,255,91,118,221,174,229,229,125,253,170,4,40,247,117,31,
+77,37,228,105,72,243,108,186,77,232,157,163,214,54,231,23,175,95,156,245,189,208,92,2,
+106,179,85,243,164,139,163,161,190,127,83,246,224,53,61,221,73,250,90,73,196,194,70,209,
+120,233,111,172,193,72,14,63,186,43,155,193,142,202,74,187,95,242,139,49,200,99,7,7,
+145,7,251,242,228,211,200,216,95,228,126,108,37,206,26,187,61,116,21,97,136,229,67,109,
+241,123,155,156,203,127,106,77,17,25,32,24,143,221,253,144,92,121,249,160,233,57,127,127,
+39,248,253,224,187,255,206,78,96,129,209,253,241,65,250,219,203,182,154,178,119,138,160,219,
+218,251,209,242,120,242,113,220,212,26,208,18,39,239,142,55,105,10,32,93,5,197,122,116,
+158,57,44,33,46,0,49,237,244,134,194,126,28,249,68,19,134,108,227,202,113,214,255,20,
+208,255,106,123,78,141,19,9,98,188,125,181,6,69,212,214,176,118,235,109,139,81,177,136,
+162,179,169,31,51,77,166,116,56,103,145,240,50,245,248,45,189,202,113,187,79,125,248,232,
+121,194,61,7,20,25,69,189,143,152,29,172,202,184,8,159,4,32,125,215,229,132,217,147,
+42,239,135,238,23,2,206,197,49,50,197,147,123,184,75,185,142,67,93,206,134,176,216,8,
+9,231,180,196,241,93,100,71,53,241,218,104,127,163,102,176,25,24,101,134,73,172,5,185,
+44,24,37,1,88,27,91,132,39,121,62,136,41,250,181,41,224,137,130,185,232,247,97,246,
+57,222,23,162,99,166,118,53,40,123,146,227,3,100,98,191,245,136,43,178,96,228,136,132,
+79,199,1,210,144,238,133,60,83,189,66,1,180,76,219,190,157,168,135,136,231,224,84,1,
+231,78,54,130,102,255,16,207,210,214,99,190,39,86,31,106,47,245,148,89,250,175,3,151,
+145,58,247,238,120,220,113,243,252,155,140,44,110,40,127,43,172,74,47,206,69,226,30,111,
+179,124,107,160,87,219,169,53,97,241,236,234,30,183,253,238,127,235,158,167,216,79,229,57,
+232,144,211,250,199,253,62,208,215,255,209,119,147,70,145,140,71,246,217,221,106,72,128,16,
+4,110,255,80,9,255,133,61,255,177,248,212,47,207,159,115,110,103,2,101,231,221,254,92,
+17,210,146,95,134,134,56,123,37,169,231,175,61,92,126,178,134,240,51,175,89,111,22,59,
+51,76,80,190,242,34,252,100,69,86,112,249,194,27,61,85,89,13,194,31,97,18,163,26,
+41,229,85,108,239,14,155,206,118,113,48,63,65,15,149,232,139,155,106,243,25,135,253,132,
+230,75,77,190,67,108,253,61,11,189,48,132,19,132,238,162,172,136,19,156,31,217,227,50,
+233,239,157,235,247,221,218,30,134,105,131,105,105,184,11,29,132,56,144,2,221,137,92,99,
+12,162,147,202,192,181,64,64,52,255,240,229,150,211,254,164,128,241,139,182,63,221,70,148,
+236,201,68,94,192,251,120,96,93,108,158,184,82,166,165,54,124,79,223,135,249,192,202,238,
+72,92,127,181,41,139,128,227,13,245,198,206,238,200,235,95,237,241,173,249,210,146,3,102,
+133,122,36,239,207,224,129,132,253,2,159,56,29,150,38,149,108,121,222,184,103,212,8,193,
+189,122,131,240,77,238,162,141,114,85,151,137,58,184,217,109,219,29,32,222,185,69,254,87,
+91,212,10,203,255,95,215,212,182,89,117,120,141,104,166,184,127,95,151,137,227,82,227,199,
+33,105,89,195,98,214,139,17,207,149,31,15,233,243,244,245,199,58,248,239,73,36,254,1,
+58,174,5,113,108,251,219,5,247,107,29,29,143,205,203,252,126,31,235,211,116,87,219,241,
+240,243,167,255,187,65,127,150,225,31,127,87,67,65,78,124,179,61,173,209,115,58,69,132,
+3,30,219,251,215,57,240,88,192,189,228,45,191,27,189,57,5,58,111,156,73,195,37,42,
+185,231,234,21,89,252,28,188,166,66,68,36,143,61,80,133,157,40,55,160,142,124,155,82,
+55,53,209,171,81,243,167,25,2,53,215,123,76,218,164,117,20,223,38,14,227,170,2,11,
+11,93,207,238,93,61,251,99,118,88,123,197,141,21,203,207,46,235,122,157,169,139,98,54,
+88,125,227,122,149,252,41,113,122,56,125,12,140,69,139,81,74,89,114,109,238,178,153,106,
+12,242,34,214,60,232,30,142,162,179,87,62,163,4,186,158,216,140,58,96,5,66,39,56,
+57,120,153,66,5,218,185,190,42,1,63,103,180,119,136,135,136,21,112,94,222,209,210,67,
+127,158,255,198,204,203,0,184,100,131,125,61,195,10,174,45,18,193,96,6,14,132,4,116,
+14,158,48,194,173,15,32,132,180,95,209,192,89,30,177,226,88,253,47,48,35,107,208,199,
+178,175,21,18,139,236,247,132,35,199,241,177,173,153,154,118,137,140,99,207,219,240,182,145,
+39,154,174,196,227,246,188,180,10,57,127,230,181,53,90,63,130,215,85,157,14,106,222,236,
+149,226,65,73,219,230,27,250,97,189,70,53,187,14,72,125,38,27,156,205,232,42,62,29,
+253,95,161,220,110,172,45,188,154,220,169,254,12,31,87,16,133,158,42,94,52,172,112,105,
+55,114,187,118,121,254,239,171,221,252,183,61,57,190,155,185,77,176,110,196,197,131,42,172,
+143,228,240,16,6,9,14,81,203,96,174,175,172,174,3,4,134,166,189,145,188,231,141,71,
+193,14,137,209,170,246,70,0,241,69,243,10,107,233,235,175,218,24,30,233,123,211,228,70,
+21,79,48,108,113,118,188,205,204,21,220,161,115,21,183,41,93,79,162,142,78,129,218,189,
+219,162,181,176,41,86,45,212,182,156,11,85,17,151,227,96,60,207,49,210,77,150,190,149,
+205,229,92,246,119,113,148,241,15,74,105,152,194,239,61,88,215,150,49,150,52,66,0,26,
+102,164,225,74,244,197,194,198,40,32,197,194,180,237,222,139,107,37,239,155,191,218,20,255,
+241,12,247,210,141,102,87,179,252,255,179,31,213,129,41,190,241,19,123,13,59,20,54,33,
+139,212,36,226,79,21,81,151,20,175,93,68,190,123,201,240,3,5,4,12,9,39,37,57,
+132,251,124,167,117,27,34,67,135,82,80,16,170,120,225,228,252,240,2,29,122,193,74,90,
+194,159,246,164,137,248,169,116,120,211,98,177,254,12,191,83,71,215,218,149,181,113,217,221,
+104,228,90,98,252,38,24,184,221,222,115,83,252,54,39,237,115,233,255,128,226,251,14,233,
+157,175,181,184,5,149,116,247,71,162,232,163,63,166,187,82,199,238,186,233,225,239,62,245,
+48,240,34,188,126,109,107,127,54,15,252,43,181,141,159,250,179,127,183,189,167,253,191,135,
+187,239,239,254,138,129,255,127,5,206,187,179,219,208,42,100,52,157,110,255,164,157,0,211,
+240,186,147,146,30,31,13,40,206,146,167,34,229,118,165,196,199,32,31,137,172,171,143,120,
+65,146,89,151,132,152,11,112,213,166,244,196,137,97,141,5,121,187,91,121,68,82,244,39,
+84,26,247,226,77,20,100,32,21,172,68,236,13,160,255,77,146,194,97,226,20,7,102,103,
+108,143,220,33,226,44,229,195,23,182,228,189,7,16,158,50,15,87,62,123,209,41,51,86,
+146,104,220,237,128,184,95,174,202,245,244,109,35,122,114,92,62,240,229,138,68,155,248,132,
+26,31,235,143,130,71,125,241,91,22,42,3,134,98,114,22,253,102,242,217,134,252,84,176,
+90,31,16,252,68,6,62,247,171,223,19,222,245,194,158,222,48,100,184,16,73,103,134,101,
+48,8,54,84,31,196,5,62,64,201,55,189,131,21,241,236,107,21,50,243,169,39,207,236,
+62,82,62,149,219,141,15,94,146,249,160,179,141,20,151,215,217,119,52,128,94,244,169,193,
+219,14,209,17,70,1,114,115,36,129,21,225,45,150,151,159,185,72,86,161,80,159,135,43,
+181,43,57,23,193,11,7,231,249,111,12,254,99,76,170,108,162,197,237,175,144,242,137,62,
+248,209,38,231,215,192,217,61,190,13,103,201,121,37,127,239,89,117,228,238,22,179,67,21,
+178,47,217,99,242,118,161,248,219,15,249,126,191,111,23,213,229,177,254,30,84,53,168,154,
+4,80,80,125,1,125,230,163,5,23,128,214,223,7,205,227,47,242,241,240,75,112,131,132,
+199,234,58,99,207,247,186,66,217,98,188,60,124,56,30,159,63,203,161,187,59,3,206,245,
+87,69,191,22,62,239,31,215,187,23,97,198,108,193,26,3,77,208,103,138,52,130,19,135,
+5,207,246,204,102,82,57,196,62,133,190,229,23,44,193,155,233,119,155,156,174,94,3,12,
+11,186,126,63,33,84,205,138,230,12,83,149,122,192,79,122,144,206,64,214,212,46,122,114,
+146,236,86,249,135,135,222,19,43,127,219,251,112,209,192,21,220,122,21,65,56,237,118,145,
+103,245,231,58,29,27,12,79,96,189,146,63,132,137,120,108,63,166,103,125,26,189,212,168,
+62,255,238,148,129,127,223,106,165,252,170,146,2,15,141,251,234,217,144,51,7,148,73,48,
+30,255,75,211,8,224,157,51,16,109,19,245,64,150,1,9,66,12,120,68,231,135,131,252,
+76,208,132,85,219,155,226,255,206,145,192,103,196,67,33,20,25,3,231,144,84,170,56,236,
+56,159,202,23,17,19,223,198,160,232,225,133,230,242,250,204,236,237,119,253,182,229,185,73,
+57,224,138,93,110,112,100,77,220,120,1,10,172,111,44,133,156,199,157,118,211,169,208,121,
+237,13,57,224,252,60,9,229,29,222,47,110,230,143,253,243,149,173,47,39,39,108,26,101,
+208,224,77,253,95,95,183,58,142,136,111,125,242,218,19,67,238,253,9,22,97,207,241,216,
+223,8,78,115,187,159,38,251,151,60,91,39,127,95,240,16,78,47,231,198,133,248,96,130,
+83,190,38,38,189,52,230,52,92,172,92,139,244,31,149,227,111,62,229,246,58,98,244,44,
+221,90,10,137,91,56,96,130,216,129,209,47,170,110,126,67,30,44,147,186,218,145,74,68,
+253,197,207,144,139,219,157,229,73,227,52,207,94,116,105,234,233,194,133,119,61,11,16,108,
+220,110,177,47,153,52,40,95,35,230,122,148,74,42,62,68,174,232,47,119,112,48,238,42,
+82,229,20,255,45,119,214,152,202,35,225,15,207,86,237,94,62,209,191,156,73,33,81,95,
+192,248,95,244,69,43,138,110,44,188,118,241,140,61,172,124,117,114,107,51,16,20,148,43,
+126,41,64,39,16,215,52,213,214,144,197,109,191,97,99,8,153,163,139,230,20,214,183,249,
+17,175,80,184,91,217,113,122,156,96,28,141,125,84,80,95,41,147,167,51,131,68,93,225,
+221,66,61,35,159,156,169,210,207,14,176,128,218,27,120,30,196,195,59,16,108,129,93,2,
+9,236,61,199,7,2,88,250,152,148,209,144,145,221,145,94,239,189,63,81,178,138,75,50,
+11,208,18,203,106,202,15,230,244,223,207,42,251,113,60,241,54,102,127,194,227,199,200,239,
+113,55,20,218,154,41,173,174,98,39,216,23,241,21,39,215,188,126,131,75,61,167,45,68,
+121,215,3,224,183,45,193,225,184,214,39,42,97,241,235,248,11,187,29,244,74,127,18,217,
+255,9,55,223,199,56,33,1,162,0,128,16,78,128,116,217,253,90,194,3,88,63,238,119,
+102,230,190,192,24,18,63,133,107,235,211,182,36,247,217,167,19,157,147,120,247,155,65,131,
+23,124,33,151,248,1,40,60,190,93,73,233,23,204,241,115,186,11,94,225,78,14,10,254,
+205,172,96,181,170,73,163,164,186,68,5,114,244,87,141,24,101,131,57,34,61,22,201,195,
+25,203,239,170,205,157,28,174,162,83,199,131,191,88,182,155,186,197,100,4,35,207,113,131,
+183,198,234,254,111,219,135,127,149,140,8,60,132,229,84,229,127,48,237,66,123,11,124,166,
+61,168,88,169,23,253,205,174,188,17,100,159,59,150,184,171,185,200,35,37,56,247,166,124,
+63,209,233,216,42,252,189,15,89,231,237,147,128,37,1,182,9,117,70,211,40,214,123,33,
+33,138,124,33,223,93,168,38,226,27,48,47,237,130,93,69,62,84,199,15,171,224,55,210,
+139,7,28,151,196,227,2,70,44,26,225,96,47,12,82,252,229,88,148,128,207,93,91,196,
+28,128,237,163,202,199,208,234,149,211,169,245,109,253,250,239,219,96,69,232,14,61,26,39,
+250,234,121,109,42,173,154,250,125,108,14,101,11,97,169,223,235,23,87,115,250,11,88,56,
+144,185,205,160,135,254,133,62,47,171,123,190,158,25,28,152,146,249,222,194,185,124,26,250,
+187,222,109,142,123,157,135,79,233,155,166,232,235,75,109,29,117,35,79,41,73,89,142,9,
+73,235,55,151,220,160,91,25,55,227,186,201,201,180,147,65,13,20,16,36,178,181,0,205,
+25,192,17,30,62,97,95,45,181,244,221,249,130,168,15,61,145,162,151,203,26,78,108,148,
+249,38,248,253,234,10,113,81,207,43,172,28,26,220,95,178,197,165,94,124,171,234,206,219,
+87,242,186,225,146,213,244,184,145,191,133,197,131,126,177,180,82,192,175,137,58,126,205,226,
+118,155,83,166,247,72,172,20,108,23,114,33,157,70,140,190,205,127,191,28,250,133,223,174,
+70,234,40,185,38,13,18,21,148,200,162,15,249,142,64,145,193,5,192,26,130,229,231,101,
+208,84,139,57,127,51,131,14,168,99,102,96,123,195,66,88,228,214,17,34,104,149,208,44,
+50,56,25,89,251,230,234,231,215,148,124,35,199,107,159,242,101,45,204,244,10,149,138,96,
+128,161,4,86,99,80,177,223,64,172,70,207,70,182,121,8,68,66,101,154,188,103,145,119,
+171,94,71,230,22,196,46,9,116,222,92,115,115,10,186,38,43,106,12,216,202,42,169,216,
+182,159,90,94,155,54,187,227,199,23,96,118,82,252,144,250,58,205,149,236,91,203,92,254,
+144,127,189,250,91,243,170,246,98,183,62,99,47,31,249,120,188,127,134,92,235,188,203,48,
+130,126,136,214,202,129,201,186,100,176,108,139,26,161,129,133,17,92,196,176,181,30,40,65,
+234,36,8,2,192,141,65,94,9,226,134,10,188,164,204,106,2,85,89,215,218,199,159,171,
+91,118,146,93,125,10,244,158,169,4,254,180,255,185,7,192,62,95,151,59,124,156,28,236,
+19,100,167,174,190,66,235,185,142,203,138,224,174,10,104,28,123,246,102,210,78,83,213,196,
+103,6,25,32,55,63,96,12,88,81,203,194,146,56,38,193,47,4,158,230,200,130,10,136,
+32,27,27,28,11,49,216,105,138,29,185,207,253,46,52,64,160,225,183,205,198,187,171,235,
+42,127,88,244,232,164,203,221,32,73,229,42,112,173,192,151,194,15,144,119,217,13,116,250,
+141,106,51,46,88,100,41,58,48,130,254,2,159,73,20,188,54,23,103,75,102,68,171,203,
+230,60,143,235,81,225,136,22,109,153,154,132,209,79,245,23,243,158,135,234,159,59,203,194,
+55,226,240,212,114,52,90,253,175,68,248,27,62,137,195,41,21,157,26,14,197,140,138,170,
+141,67,85,102,220,218,73,198,117,244,130,232,240,7,161,155,67,56,207,220,164,47,161,62,
+210,13,136,190,207,211,98,77,124,211,91,255,110,31,249,254,81,199,42,83,69,60,126,85,
+43,160,117,245,102,42,231,112,104,48,26,235,234,98,241,137,137,38,81,160,82,0,223,10,
+68,217,174,136,236,38,4,237,71,168,113,22,254,227,42,186,101,106,98,136,6,21,84,140,
+156,108,108,169,232,207,54,61,81,146,16,211,99,176,43,243,180,245,74,32,111,212,133,218,
+222,144,123,184,90,120,84,179,15,35,17,89,77,75,174,59,114,217,226,74,41,247,121,80,
+70,103,78,9,218,92,171,253,73,146,115,111,160,46,10,149,44,56,79,1,31,60,101,24,
+48,108,146,8,241,2,26,94,95,116,76,16,14,172,129,100,191,236,218,54,120,10,215,88,
+123,80,2,58,215,182,103,22,24,3,188,134,147,10,255,48,116,56,47,145,78,29,224,7,
+236,101,11,127,213,10,165,240,152,112,192,132,35,235,3,165,93,243,166,102,101,159,249,12,
+82,146,218,82,98,207,39,43,224,211,181,200,194,156,147,153,11,179,215,130,206,206,8,206,
+190,190,179,117,186,201,240,117,57,11,189,210,220,182,145,85,73,104,3,119,84,117,253,249,
+221,249,95,110,219,243,245,126,93,195,212,253,173,13,126,193,66,199,142,207,125,8,191,159,
+235,7,174,127,251,3,171,179,249,127,0,118,78,75,74,101,116,192,198,190,92,96,165,56,
+187,10,1,214,112,120,252,196,240,92,9,114,238,80,253,129,242,109,246,70,186,127,141,91,
+170,119,11,216,48,172,155,99,15,153,67,76,130,251,73,72,246,44,191,74,54,222,119,145,
+30,116,27,250,84,93,248,50,113,227,207,27,191,224,195,206,175,125,234,45,230,112,69,108,
+236,178,72,0,140,202,246,61,73,21,63,166,18,11,121,180,145,94,190,209,180,73,179,41,
+105,184,97,17,191,40,103,200,57,165,90,196,21,36,207,221,139,162,80,227,16,24,158,73,
+251,180,5,29,11,12,79,80,177,66,167,16,35,4,154,147,211,231,29,175,168,244,198,201,
+105,231,26,201,253,45,66,207,102,184,254,135,110,43,240,41,60,102,238,134,27,199,61,221,
+244,143,24,152,21,114,113,143,226,105,149,14,166,1,127,172,188,71,128,243,254,22,128,235,
+245,94,60,59,98,220,194,51,200,165,79,33,95,127,191,143,89,87,49,83,140,106,178,163,
+83,11,39,42,238,167,193,39,238,155,140,173,163,74,170,191,103,182,106,28,175,252,125,16,
+27,159,71,239,255,218,140,191,147,191,247,255,92,201,140,13,40,138,137,53,14,63,230,146,
+69,253,232,181,217,65,216,83,211,225,50,199,125,125,195,12,64,95,60,155,160,199,67,124,
+48,10,225,224,160,44,44,254,65,4,29,244,191,202,61,25,29,33,77,253,171,184,138,37,
+121,37,49,123,154,28,73,99,49,135,107,220,29,107,107,17,130,173,192,199,14,154,57,252,
+123,196,124,146,94,1,244,213,135,234,143,225,131,233,81,219,134,102,223,198,194,238,34,226,
+21,79,112,136,180,40,208,11,140,27,168,77,44,6,155,59,114,173,97,41,66,13,228,50,
+229,54,137,178,27,194,53,204,168,202,246,139,95,192,132,104,215,253,6,237,228,255,195,37,
+2,54,152,35,160,121,67,248,52,47,101,83,172,116,232,89,79,198,54,133,169,204,32,181,
+248,207,111,46,137,208,1,63,186,181,102,154,253,216,181,20,85,81,157,98,172,132,9,63,
+154,247,131,233,69,156,49,44,32,176,39,235,166,242,241,146,206,149,192,31,130,158,194,189,
+57,92,226,221,185,249,120,188,158,254,87,151,201,109,246,216,254,165,159,225,247,255,114,130,
+200,252,116,52,239,34,92,185,163,172,139,194,150,191,141,31,221,191,108,77,52,27,169,92,
+28,48,142,180,43,28,106,254,64,158,147,133,32,240,206,24,52,88,165,147,241,191,117,228,
+156,82,233,203,204,98,98,95,133,137,119,185,216,30,66,27,252,91,195,22,1,29,145,23,
+210,25,147,50,19,110,208,180,214,119,155,44,86,200,83,135,127,85,135,91,187,214,61,236,
+69,151,204,17,91,254,217,158,28,138,106,179,86,237,234,51,233,249,99,180,239,150,112,68,
+81,181,69,128,64,56,86,138,72,84,154,125,2,82,147,53,1,13,107,125,68,148,34,133,
+122,163,115,120,102,208,138,216,74,79,220,219,152,237,1,38,120,240,223,65,109,48,106,37,
+107,99,241,31,51,56,9,95,125,33,197,200,2,50,246,168,92,54,90,23,184,108,71,32,
+182,28,223,78,64,230,80,31,132,58,230,184,132,99,160,233,8,239,111,186,30,155,44,194,
+74,250,179,82,200,7,187,19,226,47,33,38,239,81,143,28,113,241,12,108,169,163,45,77,
+87,237,48,207,141,217,185,9,105,38,243,243,19,139,22,111,122,135,173,99,173,29,213,191,
+19,99,194,50,195,220,86,156,23,197,33,84,42,193,69,77,218,182,22,194,199,3,245,239,
+226,200,81,90,177,67,19,149,85,249,255,108,223,203,193,165,233,116,153,124,4,104,51,41,
+2,243,57,120,141,220,96,150,78,55,61,239,63,107,209,106,98,61,136,120,227,81,65,19,
+90,81,0,10,99,103,83,211,161,190,220,153,44,50,104,66,217,217,64,8,35,28,35,116,
+8,163,42,107,70,210,185,45,76,183,125,129,109,138,120,74,205,64,207,230,170,124,164,176,
+135,101,43,27,147,112,221,219,171,60,228,49,201,33,206,76,4,125,18,159,132,87,172,107,
+231,231,37,72,251,216,149,235,101,94,45,42,185,23,64,164,17,0,140,198,133,42,231,173,
+158,13,124,165,76,74,150,129,21,225,58,87,14,195,58,73,192,155,72,191,42,249,56,54,
+239,208,9,12,130,81,138,151,155,97,190,50,74,30,22,139,137,224,230,246,108,196,52,92,
+64,19,62,222,104,138,129,229,124,48,158,3,99,202,235,122,17,188,95,154,137,203,231,86,
+40,193,102,210,150,56,140,213,185,20,103,170,118,38,139,34,186,218,47,46,44,245,237,31,
+197,167,213,3,201,90,221,250,210,139,8,173,4,181,252,250,79,110,229,239,142,210,180,53,
+121,127,135,250,33,234,114,221,246,61,254,99,22,36,123,43,6,38,130,151,40,124,20,115,
+31,53,73,234,123,203,138,243,23,23,71,67,122,188,37,149,8,167,97,79,175,42,92,87,
+59,242,192,57,202,167,84,88,230,12,16,192,229,120,73,50,81,152,134,98,234,89,209,230,
+157,88,157,52,36,47,155,18,125,23,87,203,87,61,44,180,210,165,242,68,37,246,231,123,
+2,188,163,166,168,80,76,58,233,240,237,191,65,177,118,215,99,196,59,143,102,4,5,156,
+88,67,140,252,19,185,1,235,163,1,82,245,229,75,213,11,77,193,243,65,66,124,119,216,
+64,186,41,185,5,180,77,58,210,160,17,25,107,27,42,237,236,169,223,54,66,104,186,133,
+141,187,28,247,46,247,7,241,165,188,138,157,244,49,150,175,193,134,56,217,228,48,86,17,
+161,85,194,217,27,214,194,215,233,81,221,176,57,59,124,94,197,176,52,20,85,197,154,58,
+226,69,222,71,246,79,191,42,41,5,124,242,61,154,190,144,235,148,10,249,251,206,255,85,
+242,86,119,206,124,172,179,94,47,40,149,112,245,199,221,172,175,24,68,204,112,150,63,222,
+113,202,109,34,79,160,124,194,75,67,56,70,75,89,55,21,224,235,63,59,236,25,152,107,
+4,30,125,186,184,138,192,228,102,109,23,30,143,182,43,42,64,178,215,230,227,66,159,64,
+206,53,65,146,229,161,201,121,175,135,130,125,7,98,49,37,94,67,168,172,45,148,164,55,
+160,138,5,39,234,135,224,53,97,199,80,231,219,163,45,224,24,4,77,32,255,214,6,105,
+157,145,127,128,208,29,135,173,50,94,98,134,204,226,162,164,79,189,10,80,125,192,192,65,
+114,166,54,141,98,229,21,197,110,190,242,184,240,89,204,132,239,39,147,109,204,25,127,33,
+245,31,89,150,63,42,32,68,190,126,225,35,209,63,53,211,163,67,70,157,224,73,58,184,
+217,147,155,144,145,164,81,16,44,149,0,110,168,101,16,206,120,112,237,122,45,30,69,106,
+200,86,252,111,21,20,151,87,175,120,252,151,52,138,182,97,91,157,218,132,201,60,241,183,
+145,236,255,159,243,246,127,130,183,187,169,219,74,248,245,232,177,253,233,254,171,241,57,111,
+133,175,205,191,39,90,236,232,184,119,56,160,236,148,85,144,195,27,138,245,148,133,55,84,
+82,125,16,26,21,182,238,164,248,79,152,178,225,141,189,48,160,207,192,91,135,61,146,71,
+18,10,50,228,112,171,109,65,25,64,26,108,192,224,41,30,107,224,39,40,173,104,249,185,
+176,205,230,213,20,52,91,35,12,185,138,233,114,42,223,135,13,5,120,111,245,182,203,135,
+111,42,247,126,86,237,90,243,120,37,107,175,78,0,46,16,195,113,58,149,122,67,76,116,
+114,100,167,13,120,151,5,60,107,113,29,140,107,93,188,119,94,59,210,184,33,3,13,85,
+235,216,115,222,101,34,12,113,3,233,145,214,214,8,145,83,201,37,132,123,193,191,56,53,
+243,71,210,115,235,238,239,95,247,212,80,162,120,10,235,6,33,68,244,167,133,252,151,124,
+168,5,143,85,17,178,96,137,48,241,222,244,130,250,141,198,197,176,142,30,239,226,89,238,
+197,224,37,160,146,80,222,212,16,86,136,30,196,185,143,57,99,101,3,115,89,110,3,181,
+196,21,135,250,241,107,150,20,30,189,75,56,119,97,154,220,100,162,194,227,104,7,80,153,
+148,129,189,177,68,124,242,170,248,105,132,229,118,166,163,55,111,220,36,180,171,193,38,9,
+155,252,35,37,114,10,119,231,51,105,106,7,156,117,14,76,135,83,177,114,165,105,8,227,
+133,90,1,33,31,169,181,105,7,1,23,143,71,69,76,208,120,159,63,242,14,74,49,167,
+60,5,242,10,8,154,128,21,212,68,104,73,83,163,107,32,76,30,223,8,117,85,193,152,
+156,46,152,205,247,45,173,161,66,139,173,11,55,47,230,60,84,130,67,118,163,174,29,185,
+195,75,183,159,98,46,76,6,1,53,163,140,153,125,96,17,108,19,7,61,183,52,91,65,
+242,123,151,141,46,109,35,131,179,70,73,182,193,0,140,44,24,27,137,53,4,145,19,182,
+159,22,110,233,31,204,56,218,219,178,18,141,220,79,77,15,46,228,171,28,204,22,231,42,
+67,55,148,23,62,172,182,145,21,43,243,216,200,218,68,227,68,87,54,194,222,56,112,250,
+23,175,76,37,189,172,122,107,194,151,101,129,123,122,255,65,123,121,211,29,86,137,97,91,
+225,50,118,235,222,207,201,247,209,95,31,72,158,244,56,203,247,153,31,36,115,195,252,189,
+237,20,161,146,34,88,192,32,183,148,155,148,174,67,17,51,161,7,50,16,228,58,162,109,
+203,92,178,238,114,48,171,204,102,184,128,117,46,163,120,86,219,215,163,173,127,182,180,56,
+128,112,24,249,131,36,189,104,148,15,199,68,72,151,114,149,169,204,0,57,85,240,149,39,
+113,231,110,231,208,123,48,39,146,129,191,90,89,147,54,143,100,27,69,119,175,10,128,64,
+157,155,221,23,69,113,57,116,74,134,0,204,36,211,104,177,42,228,194,245,82,70,50,155,
+134,202,127,171,49,178,155,192,87,56,220,198,186,67,244,180,116,70,176,109,166,236,179,47,
+227,161,163,247,1,246,230,11,127,157,122,130,175,58,151,112,237,79,15,20,27,181,44,251,
+221,209,52,21,246,56,110,79,124,69,112,79,92,62,61,149,183,51,187,36,238,35,189,109,
+40,96,204,134,64,85,16,214,147,101,214,20,196,43,32,235,114,191,46,180,18,86,147,165,
+113,138,18,244,230,14,81,1,244,106,237,59,228,125,22,39,251,60,151,94,1,122,76,6,
+11,133,129,216,29,172,148,3,124,148,222,200,195,170,162,47,44,54,194,164,211,111,214,132,
+108,10,16,253,66,128,13,47,82,88,174,102,94,238,204,107,83,196,124,150,184,153,106,27,
+95,54,131,154,50,2,206,149,40,89,168,92,245,110,76,104,80,190,97,94,86,6,45,145,
+123,0,10,112,236,167,150,192,248,39,2,0,218,214,144,5,157,137,15,158,212,53,89,28,
+227,231,216,163,188,52,33,93,167,218,159,109,33,102,85,119,20,250,212,115,164,59,71,185,
+162,153,121,172,213,230,61,100,46,178,31,10,234,241,194,145,170,172,120,148,153,130,62,236,
+38,222,56,34,31,186,103,254,161,58,172,157,104,174,68,3,244,221,144,87,247,11,183,242,
+136,219,185,61,216,93,74,56,211,49,110,109,33,10,86,70,32,147,154,10,93,9,104,61,
+24,58,172,162,216,40,216,50,49,214,86,201,30,94,32,98,226,216,246,98,120,56,100,8,
+75,117,55,248,139,23,16,15,22,151,26,50,91,137,19,43,241,238,151,103,26,214,252,243,
+8,5,191,172,209,162,33,11,171,217,27,220,193,140,160,20,193,144,7,60,216,85,5,71,
+47,97,240,23,20,184,95,87,57,6,39,76,177,41,42,247,3,239,152,16,80,140,102,223,
+88,141,139,84,31,4,58,87,85,102,33,90,40,54,57,135,70,94,46,141,87,146,30,51,
+140,5,170,253,44,33,124,186,9,125,89,99,219,18,185,103,248,153,79,221,210,209,186,140,
+14,72,31,183,123,235,39,55,74,91,118,164,165,132,74,170,69,38,32,203,187,49,142,176,
+168,120,152,141,212,214,130,129,157,224,215,194,198,171,163,138,126,0,86,133,174,139,68,52,
+106,69,144,169,108,36,222,92,101,188,96,111,25,186,167,127,78,83,170,249,149,212,56,145,
+113,147,149,211,102,138,148,118,58,241,159,189,25,70,148,44,115,52,151,62,252,51,238,180,
+131,188,218,62,25,237,10,48,48,56,247,170,141,29,36,234,58,65,164,83,215,38,141,227,
+171,232,54,25,240,131,28,35,208,207,79,165,86,177,208,38,169,94,7,212,94,105,79,157,
+66,102,103,136,111,90,168,213,123,49,106,157,115,24,75,188,16,172,157,174,74,241,229,236,
+158,202,88,82,149,141,94,41,85,105,176,206,149,223,71,136,138,121,36,154,255,123,63,64,
+238,2,3,56,129,7,205,198,124,203,85,213,233,65,173,11,89,75,10,86,227,33,49,199,
+176,78,5,79,133,68,13,90,201,238,170,170,97,240,62,215,24,250,118,181,207,142,98,96,
+246,39,125,29,193,2,34,94,49,233,242,6,82,108,201,155,48,59,232,158,145,184,52,200,
+235,194,174,55,189,83,120,184,218,172,238,0,206,226,166,56,205,96,19,34,220,190,167,188,
+36,241,195,117,48,61,93,41,75,187,30,83,133,106,54,50,187,227,155,17,219,33,76,194,
+237,5,126,183,103,6,214,226,21,229,69,207,151,169,252,103,55,85,48,45,103,41,39,239,
+231,203,173,124,120,153,53,107,26,243,119,106,47,20,158,181,197,73,78,53,82,210,99,166,
+251,2,165,48,11,46,181,62,86,106,150,216,138,113,34,62,211,10,216,157,196,139,219,131,
+52,234,59,243,55,9,245,218,93,158,160,18,4,33,11,104,63,95,36,217,119,171,232,53,
+252,173,195,249,174,158,44,3,76,93,178,102,149,96,64,201,80,155,92,161,14,242,167,48,
+177,130,74,5,136,92,120,124,219,138,46,236,96,221,201,108,242,173,55,153,155,192,143,70,
+19,20,22,222,55,103,151,26,218,254,226,143,107,177,62,13,246,148,197,166,87,87,24,180,
+243,212,155,60,15,104,227,97,149,52,148,80,244,235,160,153,19,211,211,5,182,215,196,165,
+121,205,144,151,124,173,180,196,190,164,34,140,49,176,227,237,222,69,180,94,58,235,59,60,
+27,188,18,87,101,204,92,44,178,152,147,239,68,44,9,23,41,243,57,251,37,115,212,215,
+38,137,237,149,225,171,235,125,132,163,128,95,141,107,167,198,125,189,44,232,143,210,164,196,
+92,198,136,190,173,176,96,58,16,220,179,47,212,30,232,199,8,8,11,209,50,50,152,41,
+32,130,108,179,136,162,65,237,61,218,1,190,251,121,128,24,233,213,184,170,218,159,180,44,
+47,168,241,84,167,123,12,135,67,246,164,225,195,76,201,86,219,85,231,91,66,16,116,163,
+229,134,77,15,130,115,110,149,101,98,63,21,166,135,21,218,7,86,127,60,157,211,43,139,
+180,229,111,168,231,174,167,19,42,176,146,15,102,78,73,77,93,119,131,221,162,10,194,76,
+207,160,238,11,146,223,31,163,23,10,187,95,199,132,125,235,81,5,161,178,176,47,221,24,
+74,254,237,170,140,38,36,197,115,244,5,21,201,27,203,200,176,230,206,43,200,120,53,133,
+216,231,171,106,95,39,50,251,37,129,119,164,217,1,128,35,133,0,151,5,137,220,125,92,
+77,29,12,124,32,176,197,187,172,40,162,91,101,115,204,221,9,119,238,100,237,71,56,157,
+53,132,111,37,149,60,196,74,56,61,116,214,137,49,204,123,41,94,233,32,129,128,105,114,
+77,76,4,5,202,12,234,173,174,51,139,93,17,10,27,116,8,2,155,46,150,24,106,62,
+12,123,42,162,165,60,175,97,250,96,138,150,125,166,196,162,61,118,204,50,200,30,161,95,
+139,144,91,217,186,196,107,144,46,191,114,158,33,49,178,45,113,19,56,66,83,145,201,174,
+61,115,76,188,81,148,248,82,151,246,201,149,217,191,158,213,52,76,46,252,59,40,62,91,
+107,3,24,49,55,6,65,125,102,209,88,150,91,176,37,11,70,216,100,227,217,223,95,174,
+164,63,161,105,58,114,245,213,218,60,164,26,222,103,75,0,128,114,209,212,67,209,25,33,
+180,14,194,164,44,43,136,40,54,147,128,183,108,220,3,220,118,217,16,230,26,228,18,116,
+88,155,119,182,73,200,140,236,104,141,218,228,23,245,213,178,103,222,94,98,161,15,112,53,
+65,14,134,168,16,4,180,75,230,153,177,91,186,210,61,70,231,142,149,206,84,99,57,51,
+212,237,28,153,165,241,6,76,224,231,60,57,112,249,157,186,15,255,113,228,56,185,92,50,
+23,217,175,149,104,66,8,17,134,31,146,102,246,36,102,0,166,54,10,128,88,128,249,127,
+192,181,127,5,41,100,128,165,228,32,173,59,200,104,72,9,75,238,51,192,184,190,200,17,
+197,70,231,199,238,238,79,106,94,27,212,58,84,188,88,120,198,125,239,64,133,15,146,32,
+11,113,13,91,145,110,92,111,122,57,86,31,116,123,120,88,220,43,122,107,10,249,40,144,
+214,82,248,102,164,235,5,155,186,171,191,143,191,204,186,34,68,154,205,162,147,54,149,114,
+154,182,20,184,24,62,43,61,233,233,23,252,234,50,138,50,236,233,55,85,220,23,50,145,
+61,182,240,30,159,26,224,95,92,187,43,3,189,226,228,65,215,94,118,181,78,113,24,129,
+191,144,12,36,130,128,119,116,164,149,96,87,39,25,223,36,72,170,98,129,164,193,197,45,
+175,65,117,152,16,232,104,96,252,79,226,26,170,146,130,185,199,146,194,15,11,117,242,92,
+2,151,164,101,36,244,162,73,118,229,198,73,91,180,176,181,110,133,102,227,132,116,163,175,
+232,250,152,251,120,89,150,203,159,44,32,14,59,135,252,94,230,86,111,216,77,186,239,23,
+69,41,149,240,50,116,112,48,76,166,76,211,15,116,132,177,149,101,205,186,56,121,140,58,
+40,70,210,122,20,152,69,71,92,3,15,165,56,171,177,34,73,170,51,65,69,183,29,89,
+184,78,9,101,244,240,243,89,40,156,84,226,21,125,122,99,0,101,188,110,122,123,232,247,
+247,183,51,243,164,95,218,81,208,56,154,217,135,142,135,189,162,81,144,98,182,181,181,169,
+106,32,197,157,24,55,201,235,148,154,180,100,103,64,220,89,148,174,174,54,40,78,95,172,
+236,234,170,64,41,139,125,107,107,153,177,109,195,113,178,234,32,196,155,136,85,133,101,202,
+102,217,235,50,158,100,100,240,173,149,101,221,64,20,157,85,121,175,72,113,171,251,179,120,
+7,189,149,179,167,46,159,15,168,81,12,228,236,93,103,69,109,114,233,183,209,172,186,224,
+104,153,79,150,116,136,165,79,253,38,19,158,28,198,42,202,87,221,91,198,225,56,107,192,
+148,237,176,33,252,168,74,249,231,148,45,74,89,13,184,84,162,63,0,191,192,230,255,153,
+73,98,137,97,174,188,125,238,143,211,215,165,64,98,14,231,87,123,55,42,199,89,101,56,
+121,123,157,163,19,218,210,223,181,231,57,254,127,74,230,5,91,73,122,22,50,147,136,141,
+208,235,83,229,85,99,196,19,189,195,22,185,3,187,229,205,221,19,189,177,187,55,14,193,
+38,203,205,246,38,186,30,244,54,138,105,194,55,65,140,72,27,209,142,30,14,34,123,28,
+2,106,225,140,148,236,227,136,178,13,77,165,60,4,101,200,189,77,180,19,169,82,103,197,
+43,234,184,110,21,155,221,46,140,157,18,97,99,130,106,249,47,111,134,12,35,119,114,151,
+85,53,134,219,91,211,66,152,83,148,51,136,98,168,240,140,78,150,78,228,80,21,211,223,
+12,222,108,136,99,132,19,122,234,76,30,56,212,151,18,243,208,18,198,38,109,39,160,240,
+39,105,233,33,209,25,53,163,92,140,164,165,22,36,114,30,232,163,20,109,12,151,150,95,
+107,92,224,96,53,230,184,107,8,100,43,219,3,47,3,70,123,144,105,41,104,140,104,31,
+102,193,59,228,124,53,37,192,48,106,43,160,109,99,43,187,244,30,125,220,41,120,140,252,
+139,64,31,53,81,76,94,116,216,139,143,213,181,34,140,27,6,236,52,6,180,14,206,198,
+210,117,226,132,229,161,155,180,80,148,164,14,203,61,218,49,35,225,210,167,238,15,84,130,
+252,29,110,176,135,214,66,209,122,204,203,65,204,194,226,118,20,132,128,213,158,214,211,182,
+146,157,123,158,150,228,34,155,166,7,215,65,49,6,162,147,170,137,62,100,17,55,176,138,
+16,86,230,214,137,55,182,51,191,8,154,111,229,73,165,137,183,44,85,112,195,129,200,70,
+53,24,215,50,178,62,105,33,186,70,18,235,236,103,49,89,62,150,157,112,107,32,86,69,
+148,163,200,135,58,159,98,253,1,18,156,180,251,108,208,69,174,16,146,224,129,103,102,123,
+47,159,118,249,188,125,36,254,81,71,107,103,92,157,234,4,227,210,48,38,81,218,169,73,
+133,43,74,209,27,182,57,29,84,126,43,13,224,156,12,108,120,142,132,20,185,212,254,10,
+96,102,90,47,30,85,137,249,161,111,21,121,161,161,114,188,215,107,61,139,158,46,118,4,
+150,63,97,115,101,154,230,245,90,93,123,28,108,231,163,107,111,179,47,7,132,177,1,186,
+122,148,130,93,129,226,54,170,231,2,41,124,133,82,104,217,73,123,145,27,113,218,98,32,
+206,132,36,16,84,150,232,106,181,224,243,247,15,27,159,4,238,5,59,106,142,7,84,135,
+252,218,143,165,43,29,239,207,41,181,96,118,106,2,131,60,224,1,139,0,168,2,92,124,
+7,14,217,184,140,32,84,3,190,224,138,64,21,89,57,189,184,127,175,73,19,219,71,220,
+98,148,116,97,39,135,204,197,50,56,200,4,64,184,49,60,235,173,95,64,159,246,39,70,
+96,230,210,74,169,115,50,81,203,171,104,142,97,86,105,151,200,157,163,199,246,67,222,114,
+82,238,99,137,19,183,23,20,56,216,178,20,148,29,242,240,16,43,249,57,226,112,50,164,
+33,52,56,42,218,81,83,224,109,128,17,112,78,29,184,107,74,8,135,146,146,141,28,136,
+46,170,201,63,127,109,181,12,146,146,226,233,232,67,16,5,74,26,219,184,73,186,170,4,
+8,203,232,130,46,225,228,37,126,229,143,83,190,196,55,38,173,0,45,221,245,194,62,224,
+71,153,217,154,231,237,74,211,119,196,17,197,190,226,252,180,255,75,156,216,111,29,135,77,
+249,235,237,54,3,214,84,21,161,191,164,226,190,184,76,141,48,107,195,218,22,61,96,168,
+94,48,29,136,8,180,1,32,101,82,239,39,163,35,34,65,82,170,204,196,83,10,11,23,
+4,217,27,13,22,47,62,192,201,112,186,75,138,255,178,39,9,255,132,203,218,226,204,116,
+223,179,163,105,78,223,59,27,60,6,170,133,75,53,65,114,175,101,13,164,174,130,27,118,
+141,109,109,119,3,33,140,252,155,152,24,73,209,99,193,101,89,8,86,99,70,112,201,187,
+131,77,243,169,219,221,89,56,160,184,179,187,190,182,123,117,231,40,207,209,11,115,173,61,
+59,128,204,95,62,208,120,143,251,24,119,21,77,47,69,150,43,161,100,134,216,198,77,227,
+115,198,187,112,142,131,3,104,238,3,160,117,8,167,138,57,169,155,173,159,173,97,71,25,
+151,31,30,247,48,125,110,44,108,186,216,17,35,65,107,174,224,27,69,136,136,75,244,171,
+182,78,146,25,75,63,219,111,127,47,27,16,239,64,55,192,93,68,217,139,171,174,137,172,
+251,85,125,37,173,100,112,204,193,185,63,16,241,193,137,72,156,189,221,53,2,27,65,138,
+133,38,28,255,189,182,11,4,67,1,158,13,45,15,137,93,163,206,76,172,220,238,134,12,
+138,23,84,212,110,53,158,90,71,236,169,132,158,91,108,126,230,69,26,219,164,56,56,120,
+41,178,33,18,199,41,194,192,129,158,171,212,194,226,211,172,141,231,161,215,168,84,155,171,
+197,14,243,82,44,248,133,66,135,237,223,192,211,230,177,171,161,22,194,49,102,78,2,246,
+239,176,151,215,29,155,174,78,98,228,17,127,97,125,146,195,11,75,112,114,242,89,155,178,
+117,20,88,79,164,203,206,239,13,139,141,143,54,206,190,31,57,37,57,136,185,249,231,56,
+187,111,27,153,168,97,164,167,16,229,227,174,164,150,230,163,194,160,170,180,91,142,228,177,
+203,198,241,145,181,146,158,150,6,103,122,215,152,128,222,183,196,173,150,126,130,104,136,27,
+197,181,223,195,180,151,78,56,112,20,225,215,64,20,167,244,135,55,178,106,197,18,35,101,
+252,190,54,175,24,145,68,62,81,212,131,76,193,192,37,180,74,80,80,157,240,181,26,228,
+67,143,98,103,166,22,209,119,219,173,143,227,20,250,200,145,44,106,220,202,192,50,243,53,
+244,220,155,222,130,110,95,188,149,249,110,120,148,71,117,98,84,52,226,162,185,171,112,166,
+206,162,11,134,103,136,19,0,197,139,76,158,123,173,238,209,191,4,42,59,151,33,68,78,
+89,25,29,183,21,64,19,165,184,22,214,177,92,199,99,213,207,82,38,47,112,232,132,185,
+142,184,205,176,127,117,55,164,81,176,251,90,138,218,217,40,150,206,190,228,153,120,187,130,
+75,8,22,245,242,136,75,134,192,175,131,186,109,212,67,76,254,17,42,144,71,248,85,76,
+62,84,94,91,75,123,181,164,209,197,161,237,27,80,74,132,149,249,86,250,6,153,89,10,
+250,220,105,175,146,196,198,182,84,232,247,6,203,136,126,155,78,94,73,80,245,94,122,97,
+252,227,31,128,29,88,163,25,72,164,138,213,195,158,89,239,16,97,145,132,57,248,175,154,
+219,148,208,106,226,82,225,77,96,186,138,101,35,53,87,23,85,54,188,80,190,28,189,123,
+25,189,86,181,187,19,233,166,167,224,23,120,231,244,206,135,160,124,236,70,246,157,47,185,
+222,7,172,122,140,144,246,171,24,112,43,98,230,206,221,165,21,222,229,204,35,28,13,9,
+33,111,143,112,219,143,165,163,201,114,27,247,26,242,204,166,86,222,27,161,223,250,176,176,
+136,205,206,148,129,140,65,16,206,170,19,50,122,31,59,78,235,33,204,9,134,135,101,142,
+97,10,132,158,117,173,41,23,49,63,101,152,28,173,53,16,20,18,25,215,5,161,167,237,
+107,199,47,1,175,44,243,97,124,48,43,196,102,80,200,128,249,169,138,51,11,254,219,55,
+239,42,98,113,121,97,50,23,14,143,152,137,28,249,56,26,158,151,245,76,29,107,18,211,
+7,28,190,100,78,103,135,131,21,205,178,252,169,162,104,190,130,239,0,184,24,192,2,188,
+4,27,239,39,88,221,113,195,206,227,48,42,63,158,206,171,101,204,45,82,0,222,33,49,
+251,117,108,47,89,109,225,7,91,86,210,143,82,151,129,172,216,214,9,171,21,57,208,222,
+14,53,181,137,99,193,230,27,126,140,143,149,154,89,13,93,186,230,58,22,197,6,56,91,
+116,157,154,145,9,121,66,53,42,240,242,158,59,16,108,251,23,242,131,92,159,22,82,80,
+5,39,43,182,209,29,204,40,252,189,119,236,14,148,74,181,120,195,32,26,86,8,101,215,
+73,186,9,212,222,15,180,215,141,202,92,17,215,88,62,197,148,63,40,225,238,184,201,181,
+111,232,32,7,187,163,28,67,53,216,216,249,193,210,160,137,119,226,75,53,171,203,121,199,
+123,68,160,133,21,121,43,229,82,48,178,143,114,191,61,242,249,163,203,204,2,59,141,115,
+87,108,248,93,131,125,13,14,68,192,157,140,173,111,5,180,82,171,44,74,218,231,34,119,
+2,179,54,11,152,17,72,124,149,48,229,237,101,235,180,166,33,50,113,116,35,106,163,54,
+118,103,39,150,91,26,193,196,185,85,52,121,254,56,139,139,157,4,73,202,225,212,31,189,
+186,204,193,47,57,177,55,5,101,65,125,152,148,156,55,54,22,109,239,16,93,56,161,162,
+183,95,25,202,106,16,43,144,178,11,227,142,44,194,239,12,85,142,221,147,114,195,76,133,
+213,67,206,22,121,170,44,183,23,71,203,162,65,129,29,229,180,61,26,57,233,12,251,213,
+130,158,92,102,236,59,226,162,28,26,63,210,100,100,4,97,23,113,114,235,59,229,87,89,
+91,112,195,73,234,122,204,154,101,39,174,41,184,146,228,228,232,205,74,174,22,145,145,135,
+170,40,126,249,114,152,208,201,63,80,165,122,246,45,108,165,27,36,212,175,65,83,140,193,
+226,177,205,47,20,121,77,65,231,170,3,170,124,174,214,22,194,82,134,60,115,32,24,208,
+65,164,11,61,72,211,146,79,102,165,135,161,58,53,184,49,164,7,68,205,66,3,197,19,
+231,44,110,197,94,126,250,13,160,164,246,184,37,178,141,232,84,102,70,230,210,221,143,25,
+11,119,114,61,212,207,169,125,83,114,106,175,198,5,238,26,46,40,10,188,23,186,13,154,
+32,137,29,179,133,230,65,155,213,188,30,101,147,86,37,138,80,245,141,101,3,59,121,126,
+84,241,194,4,58,248,86,252,225,155,200,142,138,3,202,30,19,93,244,69,142,162,210,38,
+202,239,147,158,9,158,215,224,154,98,25,45,181,130,203,183,196,22,34,231,228,40,154,126,
+93,150,227,139,31,84,127,12,117,228,104,148,113,233,72,157,78,13,72,103,218,152,196,146,
+140,219,217,65,61,105,47,214,77,152,235,133,47,181,84,159,75,2,246,91,163,110,13,61,
+118,203,0,45,66,201,68,20,205,44,143,27,221,20,4,76,150,183,53,108,61,130,237,109,
+136,219,247,238,17,222,100,136,43,14,189,124,253,179,134,184,54,52,148,144,82,49,249,146,
+247,174,210,32,167,206,187,172,229,22,226,229,147,176,178,96,119,130,65,73,163,64,64,193,
+98,132,57,43,240,223,28,205,148,123,96,178,25,172,218,34,115,136,140,132,99,93,239,61,
+127,75,15,85,159,117,115,221,90,152,127,162,20,58,18,96,164,119,149,31,54,101,42,236,
+242,245,12,72,145,7,20,117,148,30,165,241,24,117,145,146,91,193,87,162,152,118,233,242,
+226,172,158,126,210,181,147,169,221,129,53,93,95,174,46,5,107,178,232,202,190,104,217,96,
+215,178,105,133,198,8,132,43,243,172,231,176,202,59,133,175,97,98,122,145,195,141,80,147,
+53,136,211,213,195,163,35,84,34,215,17,5,15,211,217,180,161,214,211,53,1,114,229,101,
+86,5,156,11,212,194,10,145,138,242,194,101,218,170,188,50,146,146,6,225,2,157,57,226,
+92,112,98,38,167,162,138,151,128,128,83,119,71,198,80,91,240,211,106,34,103,240,212,228,
+150,122,204,127,45,232,60,77,2,158,1,242,163,166,39,171,102,135,248,208,56,45,12,25,
+249,116,120,151,42,213,50,73,62,92,213,33,138,235,160,83,97,6,0,229,138,170,105,74,
+62,225,144,58,146,130,186,246,34,2,235,26,75,138,116,102,108,186,233,186,58,106,82,151,
+193,167,46,173,235,245,83,166,210,232,206,175,76,199,9,117,6,132,75,144,49,155,104,215,
+31,86,90,223,18,204,73,148,77,181,249,112,230,173,19,113,179,232,149,137,81,37,40,125,
+181,153,72,235,183,40,192,190,241,121,107,144,170,99,95,192,248,199,150,8,53,23,3,243,
+210,188,194,176,8,72,118,245,210,117,34,209,18,208,181,152,120,59,12,235,224,102,56,154,
+241,78,254,248,11,137,30,202,123,172,233,157,200,194,43,49,221,202,45,187,149,231,100,65,
+130,210,127,226,136,103,177,99,112,195,91,26,211,32,80,86,160,69,165,216,82,106,106,238,
+97,140,89,117,37,125,186,92,198,206,238,114,156,183,247,243,254,218,114,87,94,162,187,190,
+138,53,244,101,172,244,119,6,252,126,197,66,236,115,167,84,163,147,65,4,213,224,209,48,
+220,156,120,18,229,66,167,130,231,185,107,83,35,236,223,248,124,64,67,149,220,211,201,131,
+82,218,223,85,27,200,76,108,190,223,138,203,39,187,195,177,77,153,139,151,222,134,8,172,
+93,236,20,136,182,239,184,189,221,41,103,183,203,97,45,193,63,220,225,194,123,234,15,35,
+230,166,171,228,156,93,94,231,10,24,147,190,241,19,185,21,86,91,20,75,101,40,138,50,
+75,69,181,131,203,95,46,231,17,59,250,119,163,33,124,62,248,217,130,201,232,30,103,230,
+73,119,76,228,165,137,135,30,229,67,104,111,89,231,125,252,107,101,223,127,230,254,241,136,
+47,191,101,237,249,44,60,252,158,56,55,222,179,33,34,160,149,69,148,172,219,179,8,45,
+141,207,47,151,134,46,189,125,108,215,32,158,24,80,242,59,137,7,99,248,119,225,75,144,
+3,62,17,124,52,70,237,122,93,1,17,68,183,122,235,33,124,121,134,149,119,53,220,77,
+180,193,93,62,237,48,157,149,155,49,49,120,248,219,183,230,133,176,200,11,131,192,155,217,
+50,117,152,86,163,229,13,9,236,5,173,29,135,119,159,247,103,2,50,224,210,130,157,144,
+20,33,102,239,86,20,214,217,17,4,217,241,119,73,216,9,240,16,39,65,65,20,62,179,
+213,57,243,114,181,52,90,126,237,150,115,26,47,176,199,111,143,26,132,217,123,235,25,255,
+68,111,153,62,114,45,31,6,20,250,10,238,126,110,44,27,35,19,113,17,146,227,90,132,
+158,49,9,136,152,207,115,66,118,78,50,197,197,117,29,4,145,250,154,151,179,243,219,9,
+236,75,249,236,115,163,89,84,192,92,50,55,131,223,81,31,58,37,107,145,27,21,221,176,
+151,67,191,175,82,94,208,232,102,125,26,91,41,226,28,47,239,177,98,225,227,104,142,28,
+179,228,156,54,135,114,119,117,163,207,101,101,199,147,122,126,152,179,180,126,46,22,12,127,
+14,216,80,65,24,182,42,159,122,0,71,160,253,53,241,27,54,163,55,169,114,122,143,138,
+152,128,204,249,173,182,228,79,161,124,150,182,246,213,150,120,103,38,228,128,210,230,224,241,
+85,166,194,134,1,133,212,191,84,184,189,41,8,153,93,232,235,124,115,93,203,56,177,21,
+143,35,250,116,74,43,100,136,1,49,61,102,201,232,192,207,136,214,77,53,67,67,177,171,
+247,125,119,50,253,89,107,160,176,107,104,40,125,207,13,236,10,43,99,45,247,170,33,52,
+125,184,151,211,198,47,30,214,87,22,153,69,135,127,94,24,186,245,114,181,165,131,136,220,
+25,254,86,127,219,19,18,97,254,0,15,207,8,99,50,76,81,195,238,84,125,126,164,147,
+16,179,220,58,102,67,168,195,240,47,226,59,46,247,38,88,132,253,242,134,130,119,119,43,
+242,22,175,57,111,108,94,34,207,178,20,214,114,129,172,105,235,205,35,213,23,234,213,73,
+77,117,154,216,139,170,245,186,58,176,149,197,185,245,190,86,202,171,134,157,151,236,77,63,
+28,209,77,217,191,15,188,85,13,227,200,113,40,33,226,196,135,191,122,63,54,74,58,156,
+172,105,200,74,171,215,182,22,121,212,123,52,44,155,149,210,138,49,108,246,122,146,155,48,
+228,165,139,98,161,13,213,5,168,253,13,114,181,9,141,82,230,52,23,244,86,122,54,114,
+82,177,177,110,185,52,64,84,211,176,244,11,100,131,77,97,111,76,29,52,181,211,251,254,
+163,142,226,135,96,231,145,87,142,149,188,141,94,56,125,19,226,60,2,46,152,15,116,244,
+63,21,152,219,223,4,187,26,213,150,61,66,87,37,9,65,209,66,201,156,47,169,196,63,
+86,101,87,66,172,129,60,69,215,123,168,95,100,187,93,94,245,48,208,78,146,126,215,205,
+187,113,119,80,221,76,187,155,6,241,71,29,240,245,44,67,86,137,218,117,76,217,154,225,
+115,74,61,42,182,127,132,65,59,204,252,206,11,200,255,104,202,234,219,94,210,86,94,2,
+114,170,145,46,190,67,122,33,114,106,111,209,104,243,113,24,217,227,205,242,105,80,74,71,
+101,57,148,182,248,111,219,82,18,218,199,45,162,76,25,202,6,146,40,112,243,53,172,243,
+45,111,244,46,77,248,194,138,133,184,9,105,129,130,207,83,206,56,215,206,31,138,11,170,
+76,116,27,108,243,141,9,156,144,213,234,23,35,51,133,191,41,219,4,45,71,140,117,86,
+177,137,131,229,181,47,223,202,27,141,181,241,84,24,81,56,102,125,95,49,104,120,83,41,
+67,229,11,88,252,89,165,2,82,189,109,230,115,65,110,202,26,204,233,241,60,101,83,209,
+123,146,142,167,248,124,16,121,105,68,178,180,134,202,51,11,97,39,167,19,22,248,96,59,
+253,231,26,239,207,78,239,80,237,107,236,174,39,53,109,43,41,8,5,73,34,195,189,111,
+120,44,71,53,209,91,207,81,6,113,57,173,104,47,0,245,232,166,21,29,223,231,167,80,
+38,67,140,123,88,254,2,106,120,174,196,160,160,146,232,139,229,168,172,143,49,38,88,84,
+97,97,62,206,60,187,16,186,91,209,86,46,76,42,255,39,38,152,246,36,228,167,149,102,
+104,198,74,232,71,168,138,129,28,100,10,93,83,122,173,228,101,30,58,110,78,192,87,168,
+158,127,135,196,73,61,99,226,235,42,166,97,53,129,156,35,86,45,135,8,156,218,46,90,
+56,235,125,14,154,236,189,204,183,186,160,48,210,48,179,169,242,222,205,160,180,25,110,42,
+216,226,209,86,106,117,83,92,25,125,173,162,61,63,32,235,24,195,63,66,173,181,230,56,
+197,116,202,242,200,187,146,131,11,178,216,134,249,18,241,244,74,180,103,152,212,153,133,180,
+61,97,203,183,29,9,89,239,26,223,17,183,207,211,187,89,69,9,112,45,83,88,24,82,
+228,10,151,193,71,116,49,181,246,69,230,49,172,35,159,188,90,5,131,48,237,155,52,127,
+54,74,144,181,237,197,177,102,87,18,120,83,187,102,109,2,180,218,67,43,147,6,88,206,
+252,243,96,175,125,254,114,144,111,30,111,122,30,86,0,233,154,252,32,106,196,34,63,18,
+16,238,47,221,153,190,84,191,175,131,202,164,67,32,206,191,2,239,210,21,144,245,92,244,
+151,151,45,99,3,165,41,3,203,186,151,90,206,43,96,236,61,11,182,83,238,155,41,125,
+146,22,202,235,85,218,69,87,42,22,247,90,46,74,118,22,69,195,43,53,60,248,119,195,
+100,94,169,109,63,113,195,74,234,186,90,29,156,161,20,232,182,214,72,39,174,217,190,187,
+183,140,55,225,134,209,119,102,206,202,245,117,215,69,212,23,145,101,233,212,72,181,160,26,
+216,221,56,209,194,154,102,162,224,196,160,120,34,108,71,69,217,186,218,178,124,78,140,155,
+107,90,35,189,188,175,140,182,57,91,209,224,166,154,65,242,21,71,67,198,133,68,124,205,
+196,245,236,42,82,134,172,246,130,163,103,17,108,87,161,142,237,115,105,216,155,7,87,200,
+39,158,122,130,181,149,117,19,113,26,148,205,204,67,7,175,99,108,162,199,74,214,105,165,
+128,200,16,83,56,144,132,20,132,124,239,249,185,148,76,10,167,61,97,16,181,186,45,7,
+90,65,153,74,173,227,76,80,194,237,146,11,205,206,117,218,194,7,154,62,206,252,225,122,
+121,17,102,229,117,43,155,62,20,45,31,194,235,55,5,237,210,53,213,211,127,52,119,148,
+202,8,89,224,247,158,174,99,78,209,185,172,18,185,174,53,119,193,72,108,128,75,197,160,
+27,42,6,114,128,228,38,139,173,115,26,148,53,178,230,50,206,58,162,122,242,208,50,98,
+125,225,69,22,78,224,217,72,43,29,234,147,79,80,214,74,133,92,82,208,40,64,141,105,
+207,115,66,117,28,154,81,33,22,93,105,19,154,99,28,238,193,44,241,1,135,233,232,106,
+171,54,69,204,233,69,110,42,215,238,166,231,65,161,165,78,25,248,136,55,104,158,120,188,
+155,16,28,148,90,104,236,172,88,26,246,54,106,208,164,71,31,19,9,121,150,124,221,1,
+63,183,120,205,161,144,212,158,181,190,224,79,141,34,170,18,254,127,163,8,109,34,145,15,
+150,148,71,49,223,9,124,239,168,189,236,99,3,50,182,69,98,10,202,187,171,174,38,122,
+208,14,178,43,166,238,166,58,18,164,205,104,94,156,156,58,245,212,206,235,139,99,163,240,
+12,197,106,121,183,85,230,35,233,100,12,103,152,232,203,190,48,14,234,106,83,5,228,36,
+234,79,217,160,225,240,6,143,44,129,50,221,169,166,124,21,249,104,201,230,199,226,124,90,
+18,12,213,39,106,60,81,183,217,238,70,56,98,180,38,148,106,232,104,44,80,84,20,170,
+138,47,131,154,82,56,189,196,129,138,170,115,60,34,209,156,45,48,212,206,141,66,71,233,
+211,181,152,210,249,9,173,147,206,201,78,183,73,19,34,154,45,110,83,2,189,6,139,105,
+117,82,216,158,50,89,245,221,51,245,69,105,220,215,122,169,247,117,192,173,10,31,154,76,
+191,21,62,102,164,174,240,244,87,65,183,122,96,126,40,154,122,139,76,223,77,73,82,116,
+90,242,204,29,215,10,182,113,22,131,153,49,141,39,209,188,22,193,101,88,136,106,80,109,
+41,142,221,163,203,63,19,173,197,87,52,220,223,170,184,78,205,116,163,186,215,133,113,113,
+84,157,72,248,206,74,46,142,148,38,142,122,126,198,36,236,18,105,21,132,193,63,166,103,
+95,87,7,86,239,5,159,18,246,174,172,124,219,18,253,65,86,135,79,212,27,3,79,165,
+76,209,170,242,63,22,138,26,146,218,194,43,104,220,227,83,234,147,54,176,29,144,195,47,
+222,54,102,37,107,131,25,37,143,85,162,201,55,55,125,27,63,235,203,187,121,133,191,188,
+208,122,49,1,211,61,30,187,37,165,38,101,51,214,40,99,243,196,210,248,81,211,249,41,
+135,195,64,209,250,171,45,117,18,98,228,194,60,54,191,128,221,203,141,220,153,184,75,61,
+242,221,191,148,57,73,92,194,34,33,226,9,27,120,61,58,49,40,21,248,139,135,38,72,
+133,184,171,50,230,194,206,165,31,150,231,177,53,116,174,39,87,75,188,107,196,155,221,44,
+91,191,38,214,66,169,16,185,52,66,94,230,186,247,83,95,163,58,11,95,71,197,66,229,
+211,89,186,198,146,199,236,149,129,177,172,246,62,45,169,85,117,178,87,247,59,56,36,99,
+149,31,197,188,223,128,205,221,213,248,243,96,176,112,185,155,101,24,249,103,111,39,11,126,
+201,95,203,159,147,16,181,221,102,240,84,157,100,65,233,4,253,225,166,88,247,78,88,143,
+0,96,195,33,238,145,12,108,145,22,211,8,227,71,26,24,42,112,147,122,43,5,164,152,
+97,12,28,145,68,117,56,167,244,97,239,236,61,20,90,140,7,118,39,213,90,244,32,34,
+18,193,188,85,158,200,229,49,153,52,86,134,211,166,159,191,29,181,181,15,167,197,11,207,
+32,193,143,133,214,42,242,102,101,15,38,98,81,46,34,41,156,71,219,120,54,182,117,245,
+35,155,217,85,38,102,25,185,138,195,133,178,72,179,237,191,114,118,37,22,212,234,154,173,
+168,202,218,211,184,23,247,15,135,210,222,88,154,215,47,93,186,80,247,19,139,15,154,92,
+172,110,243,108,253,157,254,13,5,108,231,119,35,87,119,241,152,169,156,81,127,250,10,162,
+202,114,179,35,75,54,153,190,13,197,35,209,214,36,154,2,75,52,167,253,100,218,206,104,
+78,162,179,42,184,182,24,213,32,239,84,9,19,9,166,110,21,61,33,209,199,233,125,142,
+97,175,28,243,50,22,133,106,200,59,90,86,29,136,59,236,27,175,130,212,71,171,138,240,
+240,208,34,100,145,238,74,88,215,79,49,84,110,158,137,122,89,58,218,213,250,82,244,237,
+141,227,233,107,212,215,99,214,201,5,86,87,161,227,182,245,150,162,46,89,23,46,174,44,
+242,252,153,48,23,101,42,58,223,0,194,114,212,56,244,17,144,113,92,182,199,226,87,81,
+63,200,78,73,165,242,75,195,253,163,90,206,115,248,157,204,116,149,33,214,126,174,12,218,
+184,63,148,54,147,121,117,147,116,211,70,92,39,1,206,9,200,145,56,62,205,114,164,17,
+134,222,177,200,162,26,48,48,72,29,223,96,241,116,67,129,132,194,10,178,185,57,243,144,
+157,222,179,143,176,146,184,170,121,10,190,149,48,181,213,173,30,63,152,52,226,247,18,198,
+243,185,125,139,165,90,104,138,48,213,208,70,196,60,182,59,152,215,59,52,187,91,51,117,
+130,47,17,80,75,43,81,165,69,91,3,85,166,41,89,120,203,249,61,74,8,105,22,249,
+138,85,151,196,118,53,125,173,77,179,32,182,98,50,243,155,70,190,121,12,247,91,153,45,
+150,248,178,123,145,239,207,148,94,108,115,87,21,240,248,152,83,150,240,125,236,185,100,233,
+242,224,60,133,84,136,24,61,146,193,197,1,109,130,255,67,11,88,99,179,197,119,17,199,
+209,170,133,97,72,28,17,15,7,234,236,231,81,203,118,36,216,142,134,165,147,194,119,226,
+139,182,189,222,111,43,221,65,159,237,156,139,227,26,102,222,227,67,74,157,144,51,204,42,
+214,102,241,37,120,54,201,195,151,24,207,88,59,70,41,19,214,200,232,203,54,167,252,83,
+43,166,240,77,93,85,71,231,182,238,245,14,85,233,193,189,235,215,212,190,179,19,207,160,
+173,179,144,6,221,76,109,220,125,70,114,70,175,246,183,218,50,122,151,148,213,209,29,102,
+142,77,150,202,218,138,173,155,50,239,8,235,225,176,181,145,234,88,41,67,114,97,84,53,
+141,17,187,106,81,233,128,196,116,160,117,161,44,84,89,70,21,16,23,149,132,205,154,162,
+69,161,115,159,13,31,132,103,12,173,68,159,20,156,148,245,132,15,162,155,190,15,117,207,
+52,165,150,21,29,13,44,66,130,54,24,220,199,163,103,96,205,23,12,133,205,140,221,28,
+75,252,83,167,185,95,209,195,3,201,52,230,174,11,109,200,140,138,5,88,223,34,211,68,
+193,106,214,17,72,236,210,95,43,134,77,186,240,90,234,118,93,251,115,13,100,228,21,206,
+6,119,74,249,44,81,46,31,21,152,213,154,207,197,41,97,121,49,117,17,181,6,251,115,
+101,55,32,230,150,150,217,10,39,156,71,135,233,62,95,78,201,56,81,48,102,165,105,8,
+10,188,156,188,43,215,119,43,114,227,170,161,42,44,51,100,204,97,219,28,98,169,46,62,
+200,182,104,193,107,25,28,88,30,224,135,60,54,231,39,173,224,150,98,207,65,185,239,133,
+189,165,66,183,212,100,93,245,61,83,130,229,143,105,17,107,178,122,13,128,150,191,62,111,
+79,118,44,6,225,153,218,241,185,34,53,95,113,38,93,179,119,251,145,77,86,203,58,79,
+67,171,153,191,172,114,62,235,58,87,118,247,40,5,101,40,229,179,68,54,107,79,118,108,
+104,94,46,210,52,154,32,227,174,169,244,123,185,250,145,178,47,119,230,237,235,162,231,232,
+142,88,104,204,109,94,215,1,41,171,219,194,87,88,83,235,83,4,217,138,90,99,91,149,
+244,53,111,84,210,35,26,146,85,19,155,30,154,71,63,1,149,253,117,92,161,16,9,50,
+207,152,130,77,111,154,83,172,173,177,156,232,156,166,175,200,184,8,174,136,90,208,165,212,
+84,105,82,204,218,134,248,166,204,72,137,251,227,94,20,202,93,190,108,5,240,119,114,62,
+211,142,166,46,235,79,102,198,207,194,16,98,190,176,164,90,137,20,112,119,7,78,186,230,
+74,195,214,0,65,236,169,230,167,179,193,22,147,27,214,87,170,230,78,66,166,10,130,12,
+192,43,101,11,37,105,71,45,83,120,199,240,148,114,93,27,128,91,248,47,211,101,87,42,
+188,149,177,142,64,226,144,201,68,159,142,177,79,36,54,3,213,111,36,195,129,200,216,131,
+199,142,67,176,98,199,18,70,79,192,226,114,82,226,7,223,115,100,171,91,135,92,247,161,
+202,178,118,45,247,203,249,195,219,113,149,158,128,253,26,154,19,208,37,82,202,120,15,16,
+143,167,96,137,10,154,99,77,37,213,0,96,95,2,44,213,166,203,74,247,90,124,94,78,
+12,164,123,52,38,241,212,76,232,164,138,132,184,153,134,222,95,47,90,41,95,117,78,2,
+30,213,37,187,102,141,59,66,161,229,53,104,87,3,70,73,185,218,167,21,144,201,98,229,
+221,167,245,230,175,103,14,28,186,188,194,158,111,111,100,173,141,175,64,175,208,105,31,246,
+119,10,223,110,64,82,75,84,120,93,227,214,97,150,122,66,205,86,76,140,235,229,166,246,
+55,91,212,252,144,65,73,52,247,221,181,168,39,84,100,20,94,222,224,156,163,132,102,241,
+234,119,210,182,231,84,171,133,102,46,145,251,131,175,154,11,241,175,45,59,130,111,40,136,
+171,135,121,132,111,176,199,10,236,187,228,115,28,223,20,211,99,158,51,51,145,193,184,221,
+49,121,147,106,158,233,108,124,22,34,162,148,186,213,181,108,177,125,134,1,11,58,120,40,
+120,27,87,204,10,120,221,135,247,120,243,97,82,92,73,185,111,137,206,10,144,183,54,150,
+91,189,77,42,49,130,159,177,27,12,14,92,25,195,185,122,8,75,201,231,219,74,219,163,
+172,231,14,232,76,71,6,34,42,8,204,114,73,91,60,107,251,60,89,147,127,171,85,44,
+13,105,104,245,131,44,159,192,178,85,166,219,26,26,54,154,214,158,132,180,182,99,88,108,
+95,114,203,94,161,205,51,241,234,139,28,139,44,49,41,235,25,57,48,180,172,235,234,255,
+224,216,189,118,2,33,19,117,218,205,164,215,209,42,246,209,218,238,252,70,81,43,137,22,
+7,70,153,54,228,43,81,103,149,30,132,91,104,114,160,43,77,225,177,82,220,25,67,123,
+4,125,23,142,87,126,164,169,121,221,184,116,24,74,76,218,96,76,62,66,247,208,92,57,
+53,238,70,189,139,154,126,242,56,59,51,184,11,226,109,144,68,82,107,172,131,99,64,109,
+63,93,214,87,128,160,166,33,35,89,87,218,31,180,40,22,173,207,13,197,133,75,145,124,
+87,149,137,43,253,203,240,223,116,171,18,56,147,152,139,157,131,255,200,254,47,89,56,239,
+51,134,58,53,202,108,253,198,184,38,2,105,224,89,23,231,161,42,247,110,168,241,188,219,
+28,94,98,69,143,198,202,223,178,144,230,47,70,223,171,93,91,140,21,103,96,111,180,55,
+34,226,76,224,212,219,88,191,64,214,29,35,231,161,51,64,234,51,112,128,253,64,36,45,
+115,72,2,177,71,95,84,111,64,62,137,73,232,8,222,109,89,94,252,91,74,2,59,170,
+173,30,157,239,176,5,14,116,175,151,23,129,175,38,204,84,22,81,201,37,169,10,65,86,
+60,71,107,207,165,142,81,165,133,169,174,170,219,30,105,101,155,187,59,50,12,108,90,6,
+16,118,39,150,6,60,4,38,5,49,235,111,23,128,161,153,235,171,136,218,95,37,106,184,
+153,215,135,175,121,154,174,4,116,242,101,122,205,139,247,176,163,180,182,127,207,173,38,190,
+119,33,251,186,161,44,118,92,151,21,233,212,192,243,89,179,18,150,161,54,103,69,135,26,
+11,98,100,205,4,90,69,90,138,7,81,186,236,100,77,251,251,25,132,106,231,191,177,127,
+180,119,34,166,230,129,219,110,240,8,6,168,44,184,169,93,147,130,222,195,135,179,183,128,
+151,150,221,221,206,113,210,168,170,224,92,87,88,82,197,81,9,46,227,63,147,44,67,45,
+253,247,184,203,216,139,41,98,134,19,187,212,205,69,135,62,194,223,123,98,57,79,12,78,
+203,165,117,165,34,13,38,190,52,240,214,15,245,245,25,206,220,168,227,179,219,236,60,244,
+43,192,53,95,178,72,198,237,180,48,142,231,179,77,108,231,99,52,187,206,160,161,51,133,
+155,41,30,25,18,52,116,142,245,189,240,207,81,64,146,120,92,159,95,143,148,134,22,93,
+84,47,128,104,118,90,157,27,41,34,209,179,164,102,26,74,20,133,93,88,139,106,60,11,
+9,25,27,47,58,163,17,152,206,105,186,139,252,42,171,89,191,41,31,76,227,193,234,228,
+145,173,225,52,59,29,171,4,87,126,90,37,93,229,212,87,141,232,99,26,154,246,27,165,
+202,195,47,222,140,30,230,247,70,134,173,155,11,4,182,20,186,92,119,202,15,75,36,194,
+3,210,172,154,23,108,27,143,23,131,44,106,123,72,119,61,15,138,55,215,107,191,215,238,
+158,153,144,55,227,207,36,151,96,183,42,142,77,185,137,26,211,42,230,87,4,204,205,17,
+116,85,116,248,253,197,175,172,153,133,131,2,242,215,66,205,15,226,137,44,92,236,182,165,
+114,139,76,128,130,155,161,55,19,80,237,100,250,143,35,155,219,230,207,6,150,167,68,198,
+115,219,252,190,243,89,88,110,201,217,189,194,52,233,246,2,199,121,173,218,143,177,157,167,
+65,100,26,109,129,139,217,76,181,15,98,198,181,253,99,64,175,54,225,169,207,157,178,223,
+14,66,161,116,251,147,8,67,168,184,86,61,28,98,249,33,226,161,53,30,181,211,205,105,
+250,209,162,246,208,63,214,182,161,113,149,156,168,204,122,218,68,97,93,53,212,249,40,242,
+30,15,85,92,133,71,97,98,183,152,175,54,176,56,97,203,73,235,161,173,140,240,217,29,
+185,150,106,120,75,51,216,158,137,39,155,201,163,154,30,203,38,94,79,149,70,6,71,6,
+149,102,180,107,90,55,18,208,238,240,188,147,208,1,75,141,99,15,137,225,124,110,52,57,
+162,184,114,229,204,213,13,219,156,126,94,213,148,29,249,154,248,152,122,100,205,227,99,84,
+179,180,174,203,118,80,118,70,114,13,45,130,91,194,99,245,78,173,31,145,158,38,252,138,
+40,249,99,26,156,56,136,137,121,118,182,119,166,177,171,39,18,249,230,168,54,24,198,45,
+212,31,75,224,222,221,152,91,25,32,113,216,253,77,139,229,63,7,28,69,54,213,157,105,
+229,224,233,231,29,213,250,94,169,95,202,35,57,153,254,229,245,145,176,162,10,246,54,191,
+113,153,82,157,102,101,47,230,114,233,28,99,218,200,92,221,1,228,40,59,232,173,182,17,
+74,37,231,113,112,196,172,113,195,77,149,44,126,166,194,82,231,158,170,156,132,58,218,154,
+80,74,63,100,212,148,125,93,60,28,50,112,250,100,42,215,187,115,56,160,132,54,143,82,
+43,181,213,160,251,245,245,93,168,230,132,210,201,228,164,99,169,103,171,8,112,220,42,23,
+211,218,157,159,145,20,132,172,3,91,59,14,218,230,150,181,83,81,140,60,91,42,43,195,
+183,150,174,47,43,205,23,50,142,210,118,191,63,135,15,36,173,15,71,117,155,166,193,171,
+24,198,236,203,86,150,173,85,155,41,98,226,98,114,95,124,169,102,98,55,62,115,95,16,
+207,91,36,248,46,24,102,250,8,104,150,206,18,251,99,150,214,19,187,73,222,57,230,6,
+79,95,139,5,134,28,211,254,131,222,140,197,116,43,253,61,73,214,146,118,229,108,58,94,
+140,20,129,98,251,39,111,171,120,116,26,221,15,242,67,62,73,184,38,86,15,88,78,89,
+189,106,121,138,247,50,118,0,197,149,137,113,4,161,221,21,137,90,140,151,154,92,34,142,
+181,128,97,26,89,54,24,164,142,82,16,48,209,82,216,74,233,14,16,88,21,231,167,48,
+223,156,62,142,111,25,193,145,165,157,86,82,202,101,200,61,159,28,12,88,108,93,105,154,
+190,221,25,46,225,74,73,151,115,101,96,44,161,234,46,90,63,253,54,54,16,175,239,242,
+150,154,83,146,238,115,177,179,108,101,130,145,86,240,184,209,175,14,98,56,43,165,244,66,
+155,170,166,47,143,193,34,250,97,115,75,215,207,247,36,241,121,121,76,94,94,141,137,251,
+78,137,38,245,240,254,26,42,83,42,119,81,55,193,76,108,248,208,118,23,98,199,73,75,
+210,100,51,134,32,23,230,53,111,10,174,182,137,118,146,217,51,91,87,38,255,56,140,236,
+137,93,240,222,104,128,73,195,172,90,6,92,35,33,87,238,161,207,120,130,81,37,166,154,
+22,37,246,10,139,120,138,170,193,168,118,106,89,91,34,68,40,144,179,51,180,191,5,172,
+156,194,107,139,185,199,187,92,81,174,14,101,211,33,6,230,251,90,118,89,97,70,114,217,
+59,154,6,134,104,133,106,203,76,37,95,155,144,246,155,119,115,224,124,146,198,167,202,174,
+145,192,77,64,177,250,250,137,253,134,187,197,20,234,105,212,246,248,251,212,199,110,22,61,
+210,110,89,238,86,220,220,161,188,158,168,156,134,51,43,113,62,227,46,16,41,138,153,38,
+91,139,73,28,170,198,79,21,59,83,159,14,191,2,0,188,81,105,59,151,218,88,200,31,
+179,60,75,120,40,15,108,241,27,4,103,225,138,184,87,237,25,38,106,233,19,88,163,48,
+170,134,90,226,230,65,32,140,51,226,225,143,125,60,187,118,54,186,175,187,208,21,248,167,
+195,216,253,99,24,220,140,80,187,24,252,238,134,67,137,167,232,170,247,58,98,88,247,112,
+20,138,83,28,167,103,21,194,76,197,212,245,188,113,153,112,218,19,148,83,86,83,82,14,
+15,87,98,29,93,56,48,42,101,163,226,34,235,196,208,6,171,103,155,209,158,164,108,183,
+179,106,38,111,202,68,194,84,213,37,71,181,76,247,82,236,101,108,120,242,250,147,246,58,
+58,82,80,44,42,244,113,114,231,56,170,44,224,18,92,100,212,182,233,157,250,236,144,197,
+186,232,59,193,178,66,239,35,115,117,10,245,33,30,249,99,142,93,111,32,247,194,200,142,
+254,254,172,195,223,80,150,216,214,22,2,137,155,81,185,179,84,158,86,147,117,235,45,232,
+64,84,216,191,173,8,85,179,226,189,29,154,183,59,157,205,119,66,202,70,63,95,38,211,
+15,93,214,131,57,28,22,134,16,215,97,47,114,191,114,203,211,167,45,173,11,108,97,234,
+165,13,73,221,170,216,121,168,210,32,184,236,42,94,27,72,120,242,60,12,252,230,53,172,
+241,117,167,218,11,113,227,180,81,55,80,45,36,213,192,200,150,103,117,155,195,192,158,40,
+110,130,201,108,229,197,88,139,235,224,230,115,103,33,155,232,80,223,206,160,18,86,62,217,
+30,148,185,39,36,124,25,61,35,69,191,97,113,32,206,92,77,240,143,20,213,204,97,221,
+166,230,74,238,100,62,232,30,95,210,13,152,90,1,43,11,241,122,49,154,185,167,53,236,
+170,79,49,25,172,103,199,239,101,72,241,106,67,171,145,207,235,193,67,54,29,51,104,220,
+140,2,149,154,244,4,217,215,146,206,82,157,27,177,142,88,157,27,140,186,140,34,130,41,
+115,92,36,126,177,18,121,18,3,164,201,172,125,113,46,86,15,91,92,129,107,170,5,173,
+207,67,201,103,43,12,93,7,13,225,231,182,239,111,56,175,22,84,213,167,133,10,129,228,
+68,184,68,175,142,59,211,110,213,189,121,155,46,15,161,173,10,184,78,153,106,82,144,214,
+76,55,56,245,166,75,216,136,195,134,180,17,151,186,206,153,193,24,130,245,213,9,111,11,
+143,121,57,211,234,159,181,81,191,115,234,88,226,207,88,78,58,144,80,48,35,94,198,145,
+15,18,171,162,199,28,137,200,104,240,221,208,121,116,199,227,242,32,250,100,236,155,148,221,
+218,242,218,86,139,123,103,107,229,164,142,63,90,39,9,20,184,13,167,224,111,227,79,12,
+227,34,113,94,166,77,67,81,99,25,227,144,163,86,109,52,111,104,216,240,157,93,80,22,
+135,36,11,150,178,63,83,195,117,242,145,26,152,40,170,168,234,29,195,129,133,138,20,62,
+185,68,66,172,239,81,74,104,87,212,173,160,160,92,73,107,163,183,117,132,160,227,72,231,
+121,218,49,204,243,196,9,249,171,225,30,50,38,229,74,79,141,112,213,249,97,180,50,165,
+161,240,224,95,187,117,174,125,49,157,18,113,90,14,217,108,141,231,251,52,95,194,229,184,
+161,194,195,68,85,198,109,195,73,140,157,19,80,244,135,153,70,248,3,214,26,207,221,221,
+225,123,110,22,146,12,182,238,214,129,141,224,34,10,71,143,193,72,65,246,217,199,106,234,
+244,12,195,241,93,203,80,13,161,25,77,5,184,176,191,13,207,25,235,76,182,177,214,249,
+220,245,206,109,183,53,52,20,113,144,214,85,119,15,133,18,62,46,141,141,125,119,120,139,
+56,222,110,89,157,254,153,197,88,210,71,244,67,59,113,172,232,251,119,95,229,220,121,97,
+14,118,163,158,134,48,208,36,84,63,130,62,85,219,57,38,153,253,84,32,218,215,186,178,
+111,159,114,234,34,137,249,203,216,168,22,156,12,79,103,111,86,241,87,243,108,203,199,24,
+159,135,160,108,223,70,178,10,195,37,237,107,253,38,195,205,0,154,125,165,106,58,202,83,
+83,32,182,206,227,144,97,179,65,98,248,244,45,96,155,114,171,95,14,35,180,97,121,25,
+79,155,82,189,248,51,22,200,241,230,34,170,147,233,55,151,117,107,168,231,35,59,119,153,
+114,184,178,147,52,30,157,238,53,124,15,154,53,61,83,206,41,183,128,20,169,148,219,85,
+59,116,63,20,141,182,237,85,222,37,23,132,37,20,191,143,20,13,150,254,158,10,214,202,
+113,99,54,214,178,4,132,234,187,104,249,178,236,55,55,171,206,79,176,138,73,81,151,7,
+36,29,221,215,97,71,198,215,198,35,183,208,194,116,166,226,159,169,139,102,216,35,88,248,
+35,62,25,155,135,145,181,227,156,145,84,247,111,153,11,165,59,182,194,77,108,85,97,185,
+120,233,233,33,242,57,99,107,89,82,33,135,149,83,36,166,62,177,172,38,133,182,118,159,
+15,183,111,38,175,166,157,171,64,162,15,217,86,228,90,182,41,61,132,250,161,158,46,66,
+91,173,89,94,174,70,60,122,189,22,189,124,227,84,179,103,193,29,205,114,131,75,228,143,
+153,121,210,160,176,212,19,37,71,19,194,218,89,185,23,236,33,37,183,245,50,119,107,49,
+168,114,83,170,53,85,111,222,130,213,190,77,62,9,52,149,151,177,88,187,179,213,91,59,
+30,73,172,253,211,214,211,85,106,74,211,107,44,109,45,89,47,201,168,206,138,235,192,210,
+62,229,124,125,238,228,5,189,14,203,10,246,152,207,112,86,177,153,82,15,212,188,32,140,
+121,121,122,92,182,10,186,204,173,199,201,129,244,63,141,173,11,221,203,89,53,84,39,55,
+2,27,26,123,29,2,54,22,76,76,115,85,224,239,242,62,74,89,81,216,205,161,166,83,
+83,25,80,203,85,49,202,98,7,155,168,71,170,113,75,30,133,16,189,137,14,221,61,214,
+193,159,199,239,163,119,73,142,78,212,18,99,119,180,184,118,48,74,58,167,234,48,171,93,
+116,138,224,225,103,220,89,234,75,72,157,126,111,86,166,131,52,164,129,179,203,32,216,130,
+234,212,243,210,44,238,250,44,57,7,92,197,250,55,74,50,205,183,208,189,101,74,128,137,
+244,143,112,37,184,185,42,64,247,74,117,165,10,223,67,124,78,188,124,220,158,168,39,167,
+255,33,92,207,85,101,45,8,206,219,168,231,105,150,89,146,244,239,227,2,110,140,188,204,
+121,221,187,249,253,40,220,94,218,106,155,105,25,77,139,45,103,94,153,95,3,253,99,13,
+106,221,163,89,26,9,129,195,95,173,177,69,98,210,186,241,39,62,164,166,187,244,48,143,
+152,22,220,240,134,138,106,88,208,141,125,17,207,243,235,107,86,95,54,71,213,45,28,132,
+32,20,244,248,40,243,171,209,16,220,219,58,189,148,188,85,241,210,232,252,209,87,95,9,
+164,211,197,165,163,162,97,117,225,114,168,231,235,108,198,30,7,193,87,57,68,152,70,252,
+133,224,105,160,23,130,119,81,234,130,238,127,159,42,75,46,106,108,245,97,46,252,90,88,
+45,49,82,233,217,207,226,50,204,42,158,10,49,86,77,179,21,179,222,60,138,61,142,89,
+240,78,193,87,172,167,2,33,182,235,36,98,42,72,207,173,215,104,97,38,178,59,254,78,
+82,218,102,105,13,161,124,42,167,109,232,90,24,71,211,83,135,57,121,49,248,221,16,18,
+239,189,85,74,231,119,67,75,126,222,42,254,85,85,108,141,238,221,230,142,117,8,189,124,
+153,255,249,201,248,45,150,171,205,160,15,205,203,34,126,55,59,8,226,177,69,162,110,98,
+67,35,59,55,71,86,35,74,144,190,246,103,134,57,202,7,152,62,208,98,226,74,208,209,
+200,118,208,222,72,225,225,64,117,135,62,225,59,241,207,44,73,15,102,198,55,91,21,127,
+96,112,186,201,93,19,90,74,109,77,230,112,60,64,121,45,97,165,54,32,182,60,118,24,
+43,16,86,148,162,158,142,153,104,200,227,243,182,161,86,188,39,3,108,145,219,31,33,29,
+114,117,148,64,137,150,201,151,147,236,148,143,185,17,119,108,161,55,219,233,178,153,218,69,
+18,240,91,111,156,53,151,207,218,177,18,92,217,244,8,110,227,112,183,58,164,181,81,76,
+90,76,70,61,132,82,133,128,97,63,131,111,67,135,16,207,101,225,101,205,168,120,215,162,
+46,243,136,103,21,77,101,126,197,35,229,228,99,170,5,8,20,54,123,151,73,81,45,15,
+173,43,78,146,1,253,226,210,87,244,232,123,247,234,117,130,128,179,22,83,18,133,229,123,
+60,24,46,225,211,243,74,114,240,76,210,204,77,9,195,181,147,127,93,53,0,200,110,218,
+151,126,243,216,119,242,145,221,98,13,198,128,224,242,245,155,9,46,28,93,240,208,1,252,
+212,245,208,251,21,117,242,102,226,180,109,85,212,149,45,92,105,74,36,84,114,220,88,41,
+50,114,17,224,80,247,44,134,221,160,167,134,171,211,38,79,42,146,157,252,118,185,200,245,
+221,43,137,143,218,199,199,197,43,73,124,22,55,134,43,151,111,159,47,104,61,8,103,243,
+148,198,40,177,178,29,222,41,187,131,200,147,231,185,153,156,11,6,64,106,121,97,139,172,
+160,206,154,224,118,187,157,80,205,49,72,57,166,20,78,100,165,160,240,202,226,4,253,207,
+66,213,191,17,109,120,221,172,204,108,133,4,114,78,223,147,83,154,78,42,78,235,216,236,
+179,245,103,123,40,254,123,9,140,146,154,22,85,16,112,187,20,214,179,13,134,218,221,139,
+101,229,202,152,94,253,177,7,177,93,184,99,72,136,40,221,31,146,66,90,242,218,194,204,
+14,103,244,130,147,23,163,40,245,231,52,165,229,148,125,2,205,138,116,240,180,114,211,207,
+126,245,30,224,245,14,168,100,47,243,51,10,52,30,137,233,174,42,104,120,131,54,148,156,
+34,2,99,22,41,139,23,88,170,89,120,198,52,81,12,30,79,229,238,74,61,160,200,244,
+187,198,130,166,250,250,152,113,106,84,92,215,204,119,203,20,136,189,191,189,105,143,182,213,
+211,193,218,127,145,198,219,213,135,123,199,60,227,232,237,205,193,152,153,162,87,54,5,156,
+189,136,243,34,104,138,240,124,253,7,184,141,20,66,151,118,3,119,158,40,217,153,103,124,
+73,25,152,197,149,81,187,77,234,238,139,54,181,162,190,40,177,148,164,122,136,155,202,123,
+156,122,76,245,165,118,234,51,0,179,93,234,97,254,67,38,253,215,30,138,29,109,129,72,
+187,71,37,50,84,151,98,132,19,70,53,64,8,107,200,222,37,232,36,225,162,49,30,252,
+210,59,58,113,213,146,240,217,254,189,159,229,182,131,156,62,166,27,109,235,241,56,246,30,
+7,41,142,210,53,85,158,127,65,143,44,227,93,141,70,147,211,197,163,164,226,17,78,221,
+67,60,162,67,16,249,98,25,150,211,30,123,140,51,20,162,15,156,102,43,203,154,219,11,
+111,172,201,41,38,52,43,101,41,231,216,227,199,62,154,215,172,213,154,131,92,82,112,122,
+75,117,18,116,103,178,72,69,241,82,110,23,250,178,83,209,84,107,2,91,158,78,16,23,
+3,17,219,127,107,33,112,248,240,177,246,34,134,19,206,95,105,180,159,46,86,92,5,196,
+62,154,210,181,81,69,177,111,99,235,95,164,140,93,64,7,161,57,113,165,123,124,53,65,
+119,116,16,25,218,80,23,80,232,99,55,120,164,179,44,163,16,213,70,157,82,103,71,129,
+60,172,223,146,70,41,216,246,179,152,234,198,214,239,26,215,193,154,175,130,241,87,56,139,
+86,93,237,225,71,198,124,197,47,248,16,85,156,83,73,100,96,229,128,186,90,225,213,166,
+20,148,191,130,161,186,105,132,178,213,87,141,95,186,46,111,109,243,88,166,194,99,3,45,
+52,130,219,21,155,234,83,149,233,184,105,170,221,235,156,196,193,145,5,12,138,247,113,134,
+95,33,229,135,164,115,75,19,27,3,233,124,231,7,116,198,14,213,213,150,137,170,121,120,
+151,244,199,78,222,198,200,202,61,195,221,246,59,106,223,233,215,72,200,27,241,205,88,196,
+206,225,195,66,46,60,186,39,109,214,77,107,212,95,38,109,202,35,212,186,247,174,200,141,
+7,75,18,100,204,136,153,141,129,101,29,113,115,42,129,169,57,236,72,241,206,221,203,71,
+161,65,3,110,106,80,238,122,118,119,78,219,119,145,119,211,249,190,218,25,203,120,7,4,
+249,119,111,127,201,30,169,43,253,204,75,251,247,110,32,95,115,96,221,199,97,114,131,122,
+151,147,6,43,90,102,23,117,255,74,164,76,42,11,25,139,194,231,152,192,74,135,3,53,
+121,41,87,40,253,95,15,67,37,104,60,205,20,229,33,114,134,183,233,109,130,152,186,124,
+223,195,168,235,94,65,186,48,203,93,26,89,161,230,194,152,198,59,50,133,108,247,79,171,
+212,222,65,209,242,47,234,223,187,187,133,148,108,163,15,98,223,78,37,5,100,45,229,170,
+78,54,16,210,27,93,214,59,122,138,149,67,200,27,125,198,60,102,16,151,131,70,111,1,
+61,177,85,0,171,122,72,240,251,145,38,141,13,140,46,171,170,227,222,116,206,16,46,57,
+95,43,240,107,69,118,5,113,15,232,237,186,116,177,126,217,162,144,235,122,191,65,141,233,
+115,109,43,255,159,118,129,125,74,75,197,252,14,44,187,160,124,234,51,58,162,160,180,160,
+224,243,99,212,73,135,238,94,29,91,2,197,7,174,7,114,30,112,40,83,111,58,9,238,
+185,67,116,212,10,10,253,91,37,146,54,18,132,42,35,65,189,147,198,4,166,164,44,100,
+43,84,82,60,150,94,25,147,90,80,73,212,251,178,57,114,83,242,123,174,230,58,253,147,
+93,189,249,213,26,61,197,36,231,167,118,41,103,218,207,205,187,57,64,141,132,210,248,217,
+137,137,140,51,72,75,143,71,161,115,159,1,31,80,238,37,240,79,50,84,65,144,23,5,
+53,143,111,153,149,36,133,138,176,113,152,151,148,240,111,60,106,37,64,221,157,181,167,196,
+171,139,82,86,62,233,202,248,203,166,200,157,178,206,134,167,62,90,229,243,1,121,117,47,
+147,19,34,7,33,30,254,247,207,121,237,214,103,181,183,26,144,53,220,217,125,79,35,165,
+133,115,147,242,64,224,104,163,30,217,230,237,251,54,122,181,36,77,246,148,14,221,203,13,
+180,97,153,123,189,138,147,142,69,41,46,37,136,94,252,133,149,157,33,19,50,148,87,86,
+16,180,176,112,84,212,98,141,221,141,38,166,229,37,187,242,140,250,119,138,139,43,231,25,
+182,192,113,46,119,55,51,172,52,211,122,114,92,73,213,149,52,250,97,230,22,35,230,141,
+145,202,191,198,106,91,200,253,202,128,254,117,124,36,201,223,37,184,134,104,115,160,163,238,
+83,0,187,142,74,165,81,68,167,154,102,253,73,201,174,110,160,239,108,60,69,204,6,124,
+90,76,142,94,119,204,216,201,168,173,58,234,183,5,69,58,210,14,218,171,175,42,58,235,
+226,89,71,29,110,21,239,171,139,92,212,100,95,190,236,59,202,101,53,220,84,79,116,16,
+115,149,48,200,93,242,95,41,182,74,46,142,246,223,39,33,169,188,212,101,227,226,167,200,
+97,142,225,207,166,76,175,185,90,15,167,68,254,147,185,92,239,158,58,62,0,228,102,220,
+246,131,197,38,125,62,250,195,16,56,24,116,119,134,53,182,147,82,93,196,13,57,190,115,
+22,177,36,131,69,55,97,189,46,211,161,71,21,29,145,170,152,230,32,116,131,240,80,227,
+218,84,89,88,151,246,90,216,212,190,28,132,34,254,98,169,44,52,86,55,117,134,16,51,
+207,22,243,237,154,83,125,143,11,31,145,98,25,120,249,111,154,190,71,190,238,167,70,191,
+31,159,105,95,136,100,188,109,159,156,69,77,213,240,165,154,199,130,92,117,188,92,159,72,
+175,164,121,99,43,107,248,98,53,115,108,105,162,53,119,187,233,84,119,227,129,148,121,100,
+185,111,87,118,208,9,18,170,4,32,52,33,94,91,207,147,240,127,118,176,80,17,172,15,
+249,142,177,62,235,91,207,122,241,192,14,22,246,172,225,32,57,112,214,85,121,114,142,209,
+85,226,250,186,81,55,214,182,101,154,212,58,18,47,172,40,94,235,50,171,100,165,27,224,
+25,176,93,89,194,111,54,53,243,46,122,123,142,99,42,10,14,186,133,47,194,37,72,89,
+50,122,111,69,234,235,242,35,181,31,15,253,142,73,146,140,224,130,201,222,125,180,223,168,
+167,58,155,9,180,49,250,168,166,80,116,80,50,177,84,13,224,109,180,233,82,68,184,56,
+253,36,255,88,167,147,156,61,229,154,54,27,79,122,229,230,111,252,56,64,136,182,133,123,
+242,195,201,131,141,52,47,171,224,134,83,107,233,226,80,183,159,193,7,240,73,106,116,236,
+63,219,250,169,38,152,117,154,131,150,134,128,234,154,131,126,121,135,95,48,201,5,177,140,
+42,215,248,27,92,136,247,56,118,169,178,50,234,38,100,113,78,217,42,151,120,114,152,65,
+149,98,199,186,133,235,239,204,255,15,13,254,170,70,121,0,54,13,152,66,176,20,107,70,
+128,124,92,82,31,169,118,252,210,86,121,79,246,23,11,29,109,214,103,27,173,251,88,215,
+23,241,205,193,196,86,225,48,195,185,83,126,82,139,230,71,1,77,13,50,202,144,15,152,
+147,114,247,177,37,119,54,225,163,61,89,222,110,136,58,41,76,236,121,66,175,143,38,144,
+62,98,65,64,168,33,59,103,251,205,23,183,203,83,47,159,33,37,164,105,210,67,67,134,
+69,165,107,249,29,173,251,188,73,246,130,74,3,233,159,174,131,25,101,170,202,74,232,30,
+180,116,214,92,121,184,240,38,84,213,111,123,188,11,247,118,96,185,56,130,148,139,102,99,
+197,29,55,216,245,69,120,252,135,1,35,8,72,41,206,217,218,72,201,233,134,153,244,212,
+27,98,24,128,252,162,29,124,90,184,114,104,109,91,81,66,127,116,127,233,70,28,59,197,
+132,28,76,179,220,30,192,117,62,184,86,78,210,79,43,55,136,170,192,182,10,147,79,126,
+34,91,14,232,209,79,38,155,110,35,150,196,78,195,68,151,129,238,206,176,152,124,77,17,
+150,236,105,209,0,231,109,68,59,163,108,137,216,26,206,225,189,72,175,27,228,248,164,227,
+77,124,18,254,107,235,152,60,217,95,89,220,239,84,17,210,183,215,37,241,233,235,136,205,
+101,31,75,164,246,81,242,153,226,166,35,48,59,17,202,148,89,61,44,253,33,33,193,3,
+145,157,61,6,118,161,100,233,240,239,29,16,203,63,105,172,51,60,138,21,173,13,115,221,
+62,39,94,213,245,253,195,174,5,68,122,241,107,68,94,248,7,226,110,57,123,95,54,50,
+25,174,135,125,28,86,102,102,48,181,85,70,64,75,180,125,119,151,132,209,51,56,44,48,
+79,92,13,233,189,74,211,67,158,97,27,109,52,228,3,189,223,208,81,84,194,61,77,190,
+249,100,241,252,86,203,245,29,60,88,90,149,182,228,108,71,208,58,196,207,76,189,175,82,
+142,22,126,189,249,202,214,153,226,80,116,196,145,133,157,24,254,20,5,132,86,164,24,164,
+81,191,26,42,176,102,200,231,247,251,93,224,212,226,65,242,154,106,249,6,250,143,24,174,
+212,161,223,115,252,33,132,109,74,8,195,15,10,222,152,212,91,132,239,117,136,165,242,199,
+42,196,162,44,233,159,25,147,84,83,125,187,143,117,58,147,30,47,91,84,62,103,56,108,
+251,40,29,69,233,231,226,139,166,50,222,85,219,1,204,115,172,98,201,53,245,181,193,63,
+39,156,81,180,33,197,254,59,106,43,243,179,124,115,149,212,143,234,112,154,129,41,187,118,
+22,84,178,178,72,142,20,121,64,17,24,115,79,82,207,115,83,185,90,214,18,9,53,222,
+157,221,86,159,102,47,206,17,231,118,177,107,151,216,40,147,248,205,246,193,37,248,62,127,
+184,71,102,12,66,118,126,118,211,234,219,123,201,250,185,53,186,90,188,181,242,189,231,58,
+201,190,62,54,249,222,145,197,249,104,170,30,35,232,50,86,247,7,146,246,249,186,90,11,
+223,142,116,222,120,242,40,94,241,223,241,232,252,107,19,149,217,179,91,243,124,122,194,187,
+0,89,119,87,23,83,139,248,92,222,5,27,69,161,16,157,228,110,155,249,102,211,118,205,
+99,169,129,129,84,64,103,107,196,158,30,115,54,123,135,224,159,55,242,98,105,76,202,49,
+124,205,187,184,29,225,196,97,195,184,112,146,111,173,19,124,129,243,225,62,48,93,42,176,
+45,43,66,128,44,143,232,40,138,126,245,7,158,141,11,72,89,58,107,172,27,125,223,249,
+133,6,123,73,45,225,76,130,106,74,72,81,26,10,255,189,233,201,134,140,121,38,226,50,
+14,33,213,96,79,52,236,238,71,151,206,53,32,36,142,11,93,186,86,197,116,224,104,190,
+106,58,57,192,4,241,101,145,62,27,170,151,98,236,217,142,24,76,157,129,59,88,202,203,
+43,29,114,209,204,1,144,206,165,41,34,201,177,88,10,18,179,167,132,66,141,53,211,130,
+5,68,15,148,129,142,160,149,83,106,44,227,194,39,180,79,205,145,146,94,205,132,244,167,
+166,192,253,211,194,96,154,127,229,26,153,75,159,226,248,10,138,175,233,133,6,127,60,65,
+10,126,60,202,65,251,191,81,3,43,77,110,101,207,252,236,72,133,239,214,209,37,84,244,
+170,194,70,254,12,22,130,168,66,41,122,218,69,65,181,0,236,91,38,82,174,19,17,233,
+7,253,60,196,206,65,79,74,70,122,246,29,164,170,160,35,210,107,200,47,142,127,155,111,
+203,9,38,9,49,1,12,195,106,33,189,219,233,187,19,213,254,22,113,108,164,171,114,194,
+173,86,190,221,124,124,68,154,24,96,83,133,20,35,248,144,31,29,76,73,15,140,128,193,
+101,26,240,47,126,191,238,249,255,126,44,96,222,218,209,217,62,79,113,104,80,121,33,23,
+145,178,72,88,215,181,108,251,194,226,163,218,23,104,94,182,52,49,98,228,233,127,132,86,
+185,54,180,200,135,207,214,23,233,47,136,81,90,49,68,40,106,190,183,230,221,179,104,161,
+69,124,69,111,89,236,244,11,138,106,174,114,30,183,81,254,225,179,144,119,82,119,25,74,
+112,78,33,168,3,200,9,219,220,152,201,61,15,192,47,227,255,6,149,223,253,185,188,96,
+239,192,168,40,80,85,69,181,188,229,79,115,112,91,16,168,145,130,25,21,18,32,34,109,
+40,19,108,131,212,171,147,59,255,123,93,26,99,2,98,187,61,119,28,133,153,77,130,203,
+216,114,14,54,41,216,249,107,245,127,143,213,147,114,140,72,193,189,138,48,69,50,85,190,
+122,242,100,221,115,150,57,53,243,225,192,202,175,44,41,192,220,249,250,252,155,149,228,66,
+7,184,205,118,103,72,26,202,181,94,245,103,183,233,147,8,226,179,95,171,12,41,217,27,
+181,186,231,105,125,191,197,253,231,66,116,74,181,104,222,112,92,174,14,28,200,113,33,102,
+69,125,8,56,113,12,162,18,172,22,18,86,54,224,125,238,220,116,41,66,187,72,116,254,
+13,28,200,177,41,9,248,111,132,66,67,180,69,183,167,8,184,177,97,192,240,147,77,87,
+211,179,118,239,115,246,180,88,162,68,69,81,82,170,239,86,129,237,90,5,13,17,12,236,
+56,139,160,196,33,208,34,27,46,139,232,91,7,2,119,233,126,92,185,195,88,249,31,254,
+67,85,244,136,243,115,217,133,215,28,55,189,213,13,65,120,135,89,120,226,228,31,198,254,
+103,243,236,14,120,247,237,4,135,244,14,7,173,247,168,202,182,224,134,73,52,192,183,9,
+83,52,192,111,130,110,127,35,237,155,249,74,78,204,61,57,144,100,189,82,12,249,132,60,
+140,26,35,129,10,109,162,127,131,180,231,249,74,143,61,72,62,239,103,31,97,41,188,205,
+40,54,93,1,5,192,165,24,100,144,14,177,163,6,0,154,197,47,223,226,131,5,200,54,
+246,40,255,89,29,189,63,52,62,94,60,211,99,86,211,17,84,59,132,165,231,112,43,108,
+248,190,33,215,231,248,186,71,136,123,14,155,118,226,132,93,116,206,109,252,206,200,98,70,
+220,171,172,134,160,240,43,176,42,42,90,186,163,135,122,159,87,101,11,95,127,228,157,215,
+167,150,7,180,241,204,66,51,199,242,94,57,28,199,112,199,12,52,120,180,171,246,116,6,
+137,41,100,2,89,198,224,192,31,124,85,190,106,30,64,133,118,117,135,233,250,38,202,250,
+106,137,87,230,155,250,73,254,215,166,53,143,25,43,181,116,120,50,167,19,21,130,98,205,
+112,32,170,167,50,32,138,76,164,12,149,127,172,4,28,116,172,150,200,114,17,204,131,32,
+227,64,38,13,3,4,7,71,101,2,5,1,108,251,202,219,125,174,183,199,174,131,130,71,
+204,105,145,133,118,74,96,148,225,30,134,188,194,216,92,36,105,103,219,170,147,97,177,163,
+243,107,15,190,31,180,50,53,208,163,212,0,129,212,139,80,76,208,182,102,237,180,214,67,
+9,152,46,162,54,117,215,121,123,185,1,123,63,121,252,143,209,144,149,173,59,85,148,34,
+6,122,14,254,100,193,137,119,27,194,48,136,94,102,249,122,228,57,246,108,254,105,104,48,
+19,131,141,154,111,238,140,6,36,195,84,34,33,136,15,20,223,137,44,147,152,242,50,206,
+13,201,67,151,208,103,76,9,248,253,80,62,1,228,238,108,247,177,142,113,97,200,134,228,
+38,33,16,66,117,113,180,24,175,119,19,191,0,138,175,16,223,113,161,8,64,180,29,222,
+56,215,143,214,252,135,188,249,131,5,20,72,32,139,16,187,248,192,91,231,164,59,62,157,
+229,248,148,61,130,219,138,129,213,251,238,52,147,168,30,192,108,181,170,198,206,120,141,86,
+228,189,182,216,58,254,127,194,132,108,141,155,233,190,76,241,202,231,200,73,128,220,33,151,
+55,191,160,233,245,219,248,89,57,226,24,192,193,255,248,187,146,41,194,132,133,111,3,206,
+200
 };
 
-
-
-#endif
+static rsAsset spheremap(spheremap_packed, 91345, 196608);
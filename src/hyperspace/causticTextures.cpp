@@ -18,18 +18,58 @@
 #include "main.h"
 #include "mipmap.h"
 
+#include <kodi/Filesystem.h>
 #include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <rsFile/rsFile.h>
 #include <rsMath/rsMath.h>
+#include <rsThreads/rsWorkerPool.h>
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 
+// Change when the textures come out differently for the same parameters,
+// so that old cache files are not used anymore
+#define CAUSTIC_CACHE_VERSION 1
+
+namespace
+{
+
+struct sCausticCacheHeader
+{
+  char magic[4];
+  uint32_t version;
+  int32_t frames;
+  int32_t geoRes;
+  int32_t texSize;
+  float depth;
+  float waveAmp;
+  float refractionMult;
+};
+
+sCausticCacheHeader CacheHeader(int frames, int geoRes, int texSize, float depth, float waveAmp, float refractionMult)
+{
+  sCausticCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "RSCT", 4);
+  header.version = CAUSTIC_CACHE_VERSION;
+  header.frames = frames;
+  header.geoRes = geoRes;
+  header.texSize = texSize;
+  header.depth = depth;
+  header.waveAmp = waveAmp;
+  header.refractionMult = refractionMult;
+  return header;
+}
+
+} // namespace
+
 CCausticTextures::CCausticTextures(CScreensaverHyperspace* base, int keys, int frames, int res, int size, float depth, float wa, float rm)
   : m_base(base)
 {
-  int i, j, k;
-  int xminus, xplus, zminus, zplus;
+  int i, k;
   int viewport[4];
-  unsigned char* bitmap = new unsigned char[size * size * 3];
 
   // initialize dimensions
   m_numKeys = keys;
@@ -50,37 +90,35 @@ CCausticTextures::CCausticTextures(CScreensaverHyperspace* base, int keys, int f
   m_caustictex = new GLuint[m_numFrames];
   glGenTextures(m_numFrames, m_caustictex);
 
-  // allocate memory
-  m_x = new float[m_geoRes + 1];
-  m_z = new float[m_geoRes + 1];
-  m_y = new float**[m_numFrames];
-  for (k = 0; k < m_numFrames; k++)
-  {
-    m_y[k] = new float*[m_geoRes];
-    for (i = 0; i < m_geoRes; i++)
-      m_y[k][i] = new float[m_geoRes];
-  }
-  m_xz = new float**[m_geoRes + 1];
-  for (i = 0; i <= m_geoRes; i++)
+  const size_t bitmapSize = size_t(m_texSize) * m_texSize * 3;
+  std::vector<GLubyte> bitmaps(bitmapSize * m_numFrames);
+  const std::string file = cacheFile(depth);
+  const bool cached = loadCache(file, depth, bitmaps);
+
+  if (!cached)
   {
-    m_xz[i] = new float*[m_geoRes + 1];
-    for (j = 0; j <= m_geoRes; j++)
-      m_xz[i][j] = new float[2];
-  }
-  m_intensity = new float*[m_geoRes + 1];
-  for (i = 0; i <= m_geoRes; i++)
-    m_intensity[i] = new float[m_geoRes + 1];
-
-  // set x and z geometry positions
-  for (i = 0; i <= m_geoRes; i++){
-    m_x[i] = float(i) / float(m_geoRes);
-    m_z[i] = float(i) / float(m_geoRes);
-  }
+    // allocate memory
+    m_x.resize(m_geoRes + 1);
+    m_z.resize(m_geoRes + 1);
+    m_y.resize(size_t(m_numFrames) * m_geoRes * m_geoRes);
+    m_xz.resize(size_t(m_numFrames) * (m_geoRes + 1) * (m_geoRes + 1) * 2);
+    m_intensity.resize(size_t(m_numFrames) * (m_geoRes + 1) * (m_geoRes + 1));
+
+    // set x and z geometry positions
+    for (i = 0; i <= m_geoRes; i++){
+      m_x[i] = float(i) / float(m_geoRes);
+      m_z[i] = float(i) / float(m_geoRes);
+    }
 
-  // set m_y geometry positions (altitudes)
-  // fractal altitudes is sort of ugly, so I don't use it
-  //makeFractalAltitudes();
-  makeTrigAltitudes();
+    // set m_y geometry positions (altitudes) and project them; every
+    // frame is independent of the others, so they are spread over threads
+    // fractal altitudes is sort of ugly, so I don't use it
+    //makeFractalAltitudes();
+    rsWorkerPool::shared().parallelFor(m_numFrames, [&](unsigned int frame) {
+      makeTrigAltitudes(frame);
+      makeIntensities(frame, depth);
+    });
+  }
 
   // prepare to draw textures
   glGetIntegerv(GL_VIEWPORT, viewport);
@@ -100,105 +138,58 @@ CCausticTextures::CCausticTextures(CScreensaverHyperspace* base, int keys, int f
   glBlendFunc(GL_SRC_ALPHA, GL_ONE);
   glEnable(GL_BLEND);
 
-  // project vertices and create textures
-  float recvert = float(m_geoRes) * 0.5f;  // reciprocal of vertical component of light ray
+  // create textures
   for (k = 0; k < m_numFrames; k++)
   {
-    // compute projected offsets
-    // (this uses surface normals, not actual refractions, but it's faster this way)
-    for (i = 0; i < m_geoRes; i++)
-    {
-      for (j = 0; j < m_geoRes; j++)
-      {
-        makeIndices(i, &xminus, &xplus);
-        m_xz[i][j][0] = (m_y[k][xplus][j] - m_y[k][xminus][j]) * recvert * (depth + m_y[k][i][j]);
-        makeIndices(j, &zminus, &zplus);
-        m_xz[i][j][1] = (m_y[k][i][zplus] - m_y[k][i][zminus]) * recvert * (depth + m_y[k][i][j]);
-      }
-    }
+    GLubyte* bitmap = &bitmaps[bitmapSize * k];
 
-    // copy offsets to edges of m_xz array
-    for (i = 0; i < m_geoRes; i++)
+    if (!cached)
     {
-      m_xz[i][m_geoRes][0] = m_xz[i][0][0];
-      m_xz[i][m_geoRes][1] = m_xz[i][0][1];
-    }
-    for (j = 0; j <= m_geoRes; j++)
-    {
-      m_xz[m_geoRes][j][0] = m_xz[0][j][0];
-      m_xz[m_geoRes][j][1] = m_xz[0][j][1];
+      // draw texture
+      glClear(GL_COLOR_BUFFER_BIT);
+      // draw most of texture
+      draw(k, 0, m_geoRes, 0, m_geoRes);
+      // draw edges of texture that wrap around from opposite sides
+      int numRows = m_geoRes / 10;
+      glm::mat4 modelMatCallBase = modelMat;
+
+      modelMat = glm::translate(modelMat, glm::vec3(-1.0f, 0.0f, 0.0f));
+      draw(k, m_geoRes - numRows, m_geoRes, 0, m_geoRes);
+      modelMat = modelMatCallBase;
+
+      modelMat = glm::translate(modelMat, glm::vec3(1.0f, 0.0f, 0.0f));
+      draw(k, 0, numRows, 0, m_geoRes);
+      modelMat = modelMatCallBase;
+
+      modelMat = glm::translate(modelMat, glm::vec3(0.0f, 0.0f, -1.0f));
+      draw(k, 0, m_geoRes, m_geoRes - numRows, m_geoRes);
+      modelMat = modelMatCallBase;
+
+      modelMat = glm::translate(modelMat, glm::vec3(0.0f, 0.0f, 1.0f));
+      draw(k, 0, m_geoRes, 0, numRows);
+      modelMat = modelMatCallBase;
+
+      // draw corners too
+      modelMat = glm::translate(modelMat, glm::vec3(-1.0f, 0.0f, -1.0f));
+      draw(k, m_geoRes - numRows, m_geoRes, m_geoRes - numRows, m_geoRes);
+      modelMat = modelMatCallBase;
+
+      modelMat = glm::translate(modelMat, glm::vec3(1.0f, 0.0f, -1.0f));
+      draw(k, 0, numRows, m_geoRes - numRows, m_geoRes);
+      modelMat = modelMatCallBase;
+
+      modelMat = glm::translate(modelMat, glm::vec3(-1.0f, 0.0f, 1.0f));
+      draw(k, m_geoRes - numRows, m_geoRes, 0, numRows);
+      modelMat = modelMatCallBase;
+
+      modelMat = glm::translate(modelMat, glm::vec3(1.0f, 0.0f, 1.0f));
+      draw(k, 0, numRows, 0, numRows);
+      modelMat = modelMatCallBase;
+
+      // read back texture
+      glReadPixels(0, 0, m_texSize, m_texSize, GL_RGB, GL_UNSIGNED_BYTE, bitmap);
     }
 
-    // compute light intensities
-    float space = 1.0f / float(m_geoRes);
-    for (i = 0; i < m_geoRes; i++)
-    {
-      for (j = 0; j < m_geoRes; j++)
-      {
-        makeIndices(i, &xminus, &xplus);
-        makeIndices(j, &zminus, &zplus);
-        // this assumes nominal light m_intensity is 0.25
-        m_intensity[i][j] = (1.0f / (float(m_geoRes) * float(m_geoRes)))
-          / ((myFabs(m_xz[xplus][j][0] - m_xz[i][j][0] + space)
-          + myFabs(m_xz[i][j][0] - m_xz[xminus][j][0] + space))
-          * (myFabs(m_xz[i][zplus][1] - m_xz[i][j][1] + space)
-          + myFabs(m_xz[i][j][1] - m_xz[i][zminus][1] + space)))
-          - 0.125f;
-        if (m_intensity[i][j] > 1.0f)
-          m_intensity[i][j] = 1.0f;
-      }
-    }
-
-    // copy intensities to edges of m_intensity array
-    for (i = 0; i < m_geoRes; i++)
-      m_intensity[i][m_geoRes] = m_intensity[i][0];
-    for (j = 0; j <= m_geoRes; j++)
-      m_intensity[m_geoRes][j] = m_intensity[0][j];
-
-    // draw texture
-    glClear(GL_COLOR_BUFFER_BIT);
-    // draw most of texture
-    draw(0, m_geoRes, 0, m_geoRes);
-    // draw edges of texture that wrap around from opposite sides
-    int numRows = m_geoRes / 10;
-    glm::mat4 modelMatCallBase = modelMat;
-
-    modelMat = glm::translate(modelMat, glm::vec3(-1.0f, 0.0f, 0.0f));
-    draw(m_geoRes - numRows, m_geoRes, 0, m_geoRes);
-    modelMat = modelMatCallBase;
-
-    modelMat = glm::translate(modelMat, glm::vec3(1.0f, 0.0f, 0.0f));
-    draw(0, numRows, 0, m_geoRes);
-    modelMat = modelMatCallBase;
-
-    modelMat = glm::translate(modelMat, glm::vec3(0.0f, 0.0f, -1.0f));
-    draw(0, m_geoRes, m_geoRes - numRows, m_geoRes);
-    modelMat = modelMatCallBase;
-
-    modelMat = glm::translate(modelMat, glm::vec3(0.0f, 0.0f, 1.0f));
-    draw(0, m_geoRes, 0, numRows);
-    modelMat = modelMatCallBase;
-
-    // draw corners too
-    modelMat = glm::translate(modelMat, glm::vec3(-1.0f, 0.0f, -1.0f));
-    draw(m_geoRes - numRows, m_geoRes, m_geoRes - numRows, m_geoRes);
-    modelMat = modelMatCallBase;
-
-    modelMat = glm::translate(modelMat, glm::vec3(1.0f, 0.0f, -1.0f));
-    draw(0, numRows, m_geoRes - numRows, m_geoRes);
-    modelMat = modelMatCallBase;
-
-    modelMat = glm::translate(modelMat, glm::vec3(-1.0f, 0.0f, 1.0f));
-    draw(m_geoRes - numRows, m_geoRes, 0, numRows);
-    modelMat = modelMatCallBase;
-
-    modelMat = glm::translate(modelMat, glm::vec3(1.0f, 0.0f, 1.0f));
-    draw(0, numRows, 0, numRows);
-    modelMat = modelMatCallBase;
-
-    // read back texture
-    glReadPixels(0, 0, m_texSize, m_texSize, GL_RGB, GL_UNSIGNED_BYTE, bitmap);
-
     // create texture object
     glBindTexture(GL_TEXTURE_2D, m_caustictex[k]);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -212,27 +203,16 @@ CCausticTextures::CCausticTextures(CScreensaverHyperspace* base, int keys, int f
 
   glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
 
-  for (k = 0; k < m_numFrames; k++)
-  {
-    for (i = 0; i < m_geoRes; i++)
-      delete[] m_y[k][i];
-    delete[] m_y[k];
-  }
-  for (i = 0; i <= m_geoRes; i++)
-  {
-    for (j = 0; j <= m_geoRes; j++)
-      delete[] m_xz[i][j];
-    delete[] m_xz[i];
-  }
-  for (i = 0; i <= m_geoRes; i++)
-    delete[] m_intensity[i];
-
-  delete[] m_x;
-  delete[] m_y;
-  delete[] m_z;
-  delete[] m_xz;
-  delete[] m_intensity;
-  delete[] bitmap;
+  // a window smaller than the textures can't hold them for reading back
+  if (!cached && viewport[2] >= m_texSize && viewport[3] >= m_texSize)
+    saveCache(file, depth, bitmaps);
+
+  // the geometry is only needed to draw the textures
+  m_x = std::vector<float>();
+  m_z = std::vector<float>();
+  m_y = std::vector<float>();
+  m_xz = std::vector<float>();
+  m_intensity = std::vector<float>();
 }
 
 CCausticTextures::~CCausticTextures()
@@ -256,19 +236,20 @@ void CCausticTextures::makeFractalAltitudes()
     for (i = 0; i < m_geoRes; i++)
     {
       for (j = 0; j < m_geoRes; j++)
-        m_y[keyFrame[k]][i][j] = 0.0f;
+        y(keyFrame[k], i, j) = 0.0f;
     }
     // generate altitudes in first positions
     phase = float(k) * RS_PIx2 / float(m_numKeys);
-    m_y[keyFrame[k]][0][0] = m_waveAmp * rsCosf(1.5707f + phase);
-    m_y[keyFrame[k]][m_geoRes/2][0] = m_waveAmp * rsCosf(1.5707f + phase);
-    m_y[keyFrame[k]][m_geoRes/2][m_geoRes/2] = m_waveAmp * rsCosf(3.1416f + phase);
-    m_y[keyFrame[k]][0][m_geoRes/2] = m_waveAmp * rsCosf(4.7124f + phase);
+    y(keyFrame[k], 0, 0) = m_waveAmp * rsCosf(1.5707f + phase);
+    y(keyFrame[k], m_geoRes/2, 0) = m_waveAmp * rsCosf(1.5707f + phase);
+    y(keyFrame[k], m_geoRes/2, m_geoRes/2) = m_waveAmp * rsCosf(3.1416f + phase);
+    y(keyFrame[k], 0, m_geoRes/2) = m_waveAmp * rsCosf(4.7124f + phase);
     // recurse to find remaining altitudes
-    altitudeSquare(0, m_geoRes/2, 0, m_geoRes/2, m_y[keyFrame[k]]);
-    altitudeSquare(m_geoRes/2, m_geoRes, 0, m_geoRes/2, m_y[keyFrame[k]]);
-    altitudeSquare(0, m_geoRes/2, m_geoRes/2, m_geoRes, m_y[keyFrame[k]]);
-    altitudeSquare(m_geoRes/2, m_geoRes, m_geoRes/2, m_geoRes, m_y[keyFrame[k]]);
+    float* alt = &y(keyFrame[k], 0, 0);
+    altitudeSquare(0, m_geoRes/2, 0, m_geoRes/2, alt);
+    altitudeSquare(m_geoRes/2, m_geoRes, 0, m_geoRes/2, alt);
+    altitudeSquare(0, m_geoRes/2, m_geoRes/2, m_geoRes, alt);
+    altitudeSquare(m_geoRes/2, m_geoRes, m_geoRes/2, m_geoRes, alt);
   }
 
   // interpolate to find remaining frames
@@ -298,8 +279,8 @@ void CCausticTextures::makeFractalAltitudes()
         where = float(a-kf1) / float(diff);
         for (i = 0; i < m_geoRes; i++)
           for (j = 0; j < m_geoRes; j++)
-            m_y[a][i][j] = interpolate(m_y[kf0][i][j], m_y[kf1][i][j],
-              m_y[kf2][i][j], m_y[kf3][i][j], where);
+            y(a, i, j) = interpolate(y(kf0, i, j), y(kf1, i, j),
+              y(kf2, i, j), y(kf3, i, j), where);
       }
     }
   }
@@ -307,7 +288,7 @@ void CCausticTextures::makeFractalAltitudes()
   delete[] keyFrame;
 }
 
-void CCausticTextures::altitudeSquare(int left, int right, int bottom, int top, float** alt)
+void CCausticTextures::altitudeSquare(int left, int right, int bottom, int top, float* alt)
 {
   // find wrapped indices
   int rr = right;
@@ -327,21 +308,21 @@ void CCausticTextures::altitudeSquare(int left, int right, int bottom, int top,
   if (hor > 1)  // find bottom and top altitudes
   {
     offset = myFabs(m_waveAmp * float(m_x[right] - m_x[left]));
-    if (alt[centerHor][bottom] == 0.0f)
-      alt[centerHor][bottom] = (alt[left][bottom] + alt[rr][bottom]) * 0.5f
+    if (alt[centerHor*m_geoRes + bottom] == 0.0f)
+      alt[centerHor*m_geoRes + bottom] = (alt[left*m_geoRes + bottom] + alt[rr*m_geoRes + bottom]) * 0.5f
         + rsRandf(offset+offset) - offset;
-    if (alt[centerHor][tt] == 0.0f)
-      alt[centerHor][tt] = (alt[left][tt] + alt[rr][tt]) * 0.5f
+    if (alt[centerHor*m_geoRes + tt] == 0.0f)
+      alt[centerHor*m_geoRes + tt] = (alt[left*m_geoRes + tt] + alt[rr*m_geoRes + tt]) * 0.5f
         + rsRandf(offset+offset) - offset;
   }
   if (vert > 1)  // find left and right altitudes
   {
     offset = myFabs(m_waveAmp * float(m_z[top] - m_z[bottom]));
-    if (alt[left][centerVert] == 0.0f)
-      alt[left][centerVert] = (alt[left][bottom] + alt[left][tt]) * 0.5f
+    if (alt[left*m_geoRes + centerVert] == 0.0f)
+      alt[left*m_geoRes + centerVert] = (alt[left*m_geoRes + bottom] + alt[left*m_geoRes + tt]) * 0.5f
         + rsRandf(offset+offset) - offset;
-    if (alt[rr][centerVert] == 0.0f)
-      alt[rr][centerVert] = (alt[rr][bottom] + alt[rr][tt]) * 0.5f
+    if (alt[rr*m_geoRes + centerVert] == 0.0f)
+      alt[rr*m_geoRes + centerVert] = (alt[rr*m_geoRes + bottom] + alt[rr*m_geoRes + tt]) * 0.5f
         + rsRandf(offset+offset) - offset;
   }
   if (hor > 1 && vert > 1)  // find center altitude
@@ -349,8 +330,8 @@ void CCausticTextures::altitudeSquare(int left, int right, int bottom, int top,
     offset = m_waveAmp * 0.5f *
       (myFabs(float(m_x[right] - m_x[left]))
       + myFabs(float(m_z[top] - m_z[bottom])));
-    alt[centerHor][centerVert] = (alt[left][bottom] + alt[rr][bottom] + alt[left][tt]
-      + alt[rr][tt]) * 0.25f + rsRandf(offset+offset) - offset;
+    alt[centerHor*m_geoRes + centerVert] = (alt[left*m_geoRes + bottom] + alt[rr*m_geoRes + bottom] + alt[left*m_geoRes + tt]
+      + alt[rr*m_geoRes + tt]) * 0.25f + rsRandf(offset+offset) - offset;
   }
 
   // keep recursing if necessary
@@ -387,46 +368,102 @@ void CCausticTextures::altitudeSquare(int left, int right, int bottom, int top,
   return;
 }
 
-void CCausticTextures::makeTrigAltitudes()
+void CCausticTextures::makeTrigAltitudes(int frame)
 {
-  int i, j, k;
+  int i, j;
   float xx, zz, offset;
 
-  for (k = 0; k < m_numFrames; k++)
+  offset = RS_PIx2 * float(frame) / float(m_numFrames);
+  for (i = 0; i < m_geoRes; i++)
   {
-    offset = RS_PIx2 * float(k) / float(m_numFrames);
-    for (i = 0; i < m_geoRes; i++)
+    xx = RS_PIx2 * float(i) / float(m_geoRes);
+    for (j = 0; j < m_geoRes; j++)
     {
-      xx = RS_PIx2 * float(i) / float(m_geoRes);
-      for (j = 0; j < m_geoRes; j++)
-      {
-        zz = RS_PIx2 * float(j) / float(m_geoRes);
-        /*m_y[k][i][j] = m_waveAmp
-          * (0.12f * rsCosf(xx + 2.0f * offset)
-          + 0.08f * rsCosf(-1.0f * xx + 2.0f * zz + offset)
-          + 0.04f * rsCosf(-2.0f * xx - 4.0f * zz + offset)
-          + 0.014f * rsCosf(xx - 7.0f * zz - 2.0f * offset)
-          + 0.014f * rsCosf(3.0f * xx + 5.0f * zz + offset)
-          + 0.014f * rsCosf(9.0f * xx + zz - offset)
-          + 0.007f * rsCosf(11.0f * xx + 7.0f * zz - offset)
-          + 0.007f * rsCosf(4.0f * xx - 13.0f * zz + offset)
-          + 0.007f * rsCosf(19.0f * xx - 9.0f * zz - offset));*/
-        m_y[k][i][j] = m_waveAmp
-          * (0.08f * rsCosf(xx * 2.0f + offset)
-          + 0.06f * rsCosf(-1.0f * xx + 2.0f * zz + offset)
-          + 0.04f * rsCosf(-2.0f * xx - 3.0f * zz + offset)
-          + 0.01f * rsCosf(xx - 7.0f * zz - 2.0f * offset)
-          + 0.01f * rsCosf(3.0f * xx + 5.0f * zz + offset)
-          + 0.01f * rsCosf(9.0f * xx + zz - offset)
-          + 0.005f * rsCosf(11.0f * xx + 7.0f * zz - offset)
-          + 0.005f * rsCosf(4.0f * xx - 13.0f * zz + offset)
-          + 0.003f * rsCosf(19.0f * xx - 9.0f * zz - offset));
-      }
+      zz = RS_PIx2 * float(j) / float(m_geoRes);
+      /*y(frame, i, j) = m_waveAmp
+        * (0.12f * rsCosf(xx + 2.0f * offset)
+        + 0.08f * rsCosf(-1.0f * xx + 2.0f * zz + offset)
+        + 0.04f * rsCosf(-2.0f * xx - 4.0f * zz + offset)
+        + 0.014f * rsCosf(xx - 7.0f * zz - 2.0f * offset)
+        + 0.014f * rsCosf(3.0f * xx + 5.0f * zz + offset)
+        + 0.014f * rsCosf(9.0f * xx + zz - offset)
+        + 0.007f * rsCosf(11.0f * xx + 7.0f * zz - offset)
+        + 0.007f * rsCosf(4.0f * xx - 13.0f * zz + offset)
+        + 0.007f * rsCosf(19.0f * xx - 9.0f * zz - offset));*/
+      y(frame, i, j) = m_waveAmp
+        * (0.08f * rsCosf(xx * 2.0f + offset)
+        + 0.06f * rsCosf(-1.0f * xx + 2.0f * zz + offset)
+        + 0.04f * rsCosf(-2.0f * xx - 3.0f * zz + offset)
+        + 0.01f * rsCosf(xx - 7.0f * zz - 2.0f * offset)
+        + 0.01f * rsCosf(3.0f * xx + 5.0f * zz + offset)
+        + 0.01f * rsCosf(9.0f * xx + zz - offset)
+        + 0.005f * rsCosf(11.0f * xx + 7.0f * zz - offset)
+        + 0.005f * rsCosf(4.0f * xx - 13.0f * zz + offset)
+        + 0.003f * rsCosf(19.0f * xx - 9.0f * zz - offset));
+    }
+  }
+}
+
+void CCausticTextures::makeIntensities(int frame, float depth)
+{
+  int i, j;
+  int xminus, xplus, zminus, zplus;
+  const int k = frame;
+
+  // compute projected offsets
+  // (this uses surface normals, not actual refractions, but it's faster this way)
+  float recvert = float(m_geoRes) * 0.5f;  // reciprocal of vertical component of light ray
+  for (i = 0; i < m_geoRes; i++)
+  {
+    for (j = 0; j < m_geoRes; j++)
+    {
+      makeIndices(i, &xminus, &xplus);
+      xz(k, i, j)[0] = (y(k, xplus, j) - y(k, xminus, j)) * recvert * (depth + y(k, i, j));
+      makeIndices(j, &zminus, &zplus);
+      xz(k, i, j)[1] = (y(k, i, zplus) - y(k, i, zminus)) * recvert * (depth + y(k, i, j));
+    }
+  }
+
+  // copy offsets to edges of m_xz array
+  for (i = 0; i < m_geoRes; i++)
+  {
+    xz(k, i, m_geoRes)[0] = xz(k, i, 0)[0];
+    xz(k, i, m_geoRes)[1] = xz(k, i, 0)[1];
+  }
+  for (j = 0; j <= m_geoRes; j++)
+  {
+    xz(k, m_geoRes, j)[0] = xz(k, 0, j)[0];
+    xz(k, m_geoRes, j)[1] = xz(k, 0, j)[1];
+  }
+
+  // compute light intensities
+  float space = 1.0f / float(m_geoRes);
+  for (i = 0; i < m_geoRes; i++)
+  {
+    for (j = 0; j < m_geoRes; j++)
+    {
+      makeIndices(i, &xminus, &xplus);
+      makeIndices(j, &zminus, &zplus);
+      // this assumes nominal light intensity is 0.25
+      intensity(k, i, j) = (1.0f / (float(m_geoRes) * float(m_geoRes)))
+        / ((myFabs(xz(k, xplus, j)[0] - xz(k, i, j)[0] + space)
+        + myFabs(xz(k, i, j)[0] - xz(k, xminus, j)[0] + space))
+        * (myFabs(xz(k, i, zplus)[1] - xz(k, i, j)[1] + space)
+        + myFabs(xz(k, i, j)[1] - xz(k, i, zminus)[1] + space)))
+        - 0.125f;
+      if (intensity(k, i, j) > 1.0f)
+        intensity(k, i, j) = 1.0f;
     }
   }
+
+  // copy intensities to edges of m_intensity array
+  for (i = 0; i < m_geoRes; i++)
+    intensity(k, i, m_geoRes) = intensity(k, i, 0);
+  for (j = 0; j <= m_geoRes; j++)
+    intensity(k, m_geoRes, j) = intensity(k, 0, j);
 }
 
-void CCausticTextures::draw(int xlo, int xhi, int zlo, int zhi)
+void CCausticTextures::draw(int frame, int xlo, int xhi, int zlo, int zhi)
 {
   int i, j;
   float mult;
@@ -439,10 +476,10 @@ void CCausticTextures::draw(int xlo, int xhi, int zlo, int zhi)
     mult = 1.0f - m_refractionMult / float(m_geoRes);
     for (i = xlo; i <= xhi; i++)
     {
-      m_lights[ptr  ].color = sColor(m_intensity[i][j+1], 0.0f, 0.0f);
-      m_lights[ptr++].vertex = sPosition(m_x[i] + m_xz[i][j+1][0] * mult, 0.0f, m_z[j+1] + m_xz[i][j+1][1] * mult);
-      m_lights[ptr  ].color = sColor(m_intensity[i][j], 0.0f, 0.0f);
-      m_lights[ptr++].vertex = sPosition(m_x[i] + m_xz[i][j][0] * mult, 0.0f, m_z[j] + m_xz[i][j][1] * mult);
+      m_lights[ptr  ].color = sColor(intensity(frame, i, j + 1), 0.0f, 0.0f);
+      m_lights[ptr++].vertex = sPosition(m_x[i] + xz(frame, i, j + 1)[0] * mult, 0.0f, m_z[j+1] + xz(frame, i, j + 1)[1] * mult);
+      m_lights[ptr  ].color = sColor(intensity(frame, i, j), 0.0f, 0.0f);
+      m_lights[ptr++].vertex = sPosition(m_x[i] + xz(frame, i, j)[0] * mult, 0.0f, m_z[j] + xz(frame, i, j)[1] * mult);
     }
     m_base->Draw(GL_TRIANGLE_STRIP, m_lights.data(), ptr);
     ptr = 0;
@@ -450,10 +487,10 @@ void CCausticTextures::draw(int xlo, int xhi, int zlo, int zhi)
     // green
     for (i = xlo; i <= xhi; i++)
     {
-      m_lights[ptr  ].color = sColor(0.0f, m_intensity[i][j+1], 0.0f);
-      m_lights[ptr++].vertex = sPosition(m_x[i] + m_xz[i][j+1][0], 0.0f, m_z[j+1] + m_xz[i][j+1][1]);
-      m_lights[ptr  ].color = sColor(0.0f, m_intensity[i][j], 0.0f);
-      m_lights[ptr++].vertex = sPosition(m_x[i] + m_xz[i][j][0], 0.0f, m_z[j] + m_xz[i][j][1]);
+      m_lights[ptr  ].color = sColor(0.0f, intensity(frame, i, j + 1), 0.0f);
+      m_lights[ptr++].vertex = sPosition(m_x[i] + xz(frame, i, j + 1)[0], 0.0f, m_z[j+1] + xz(frame, i, j + 1)[1]);
+      m_lights[ptr  ].color = sColor(0.0f, intensity(frame, i, j), 0.0f);
+      m_lights[ptr++].vertex = sPosition(m_x[i] + xz(frame, i, j)[0], 0.0f, m_z[j] + xz(frame, i, j)[1]);
     }
     m_base->Draw(GL_TRIANGLE_STRIP, m_lights.data(), ptr);
     ptr = 0;
@@ -462,10 +499,10 @@ void CCausticTextures::draw(int xlo, int xhi, int zlo, int zhi)
     mult = 1.0f + m_refractionMult / float(m_geoRes);
     for (i = xlo; i <= xhi; i++)
     {
-      m_lights[ptr  ].color = sColor(0.0f, 0.0f, m_intensity[i][j+1]);
-      m_lights[ptr++].vertex = sPosition(m_x[i] + m_xz[i][j+1][0] * mult, 0.0f, m_z[j+1] + m_xz[i][j+1][1] * mult);
-      m_lights[ptr  ].color = sColor(0.0f, 0.0f, m_intensity[i][j]);
-      m_lights[ptr++].vertex = sPosition(m_x[i] + m_xz[i][j][0] * mult, 0.0f, m_z[j] + m_xz[i][j][1] * mult);
+      m_lights[ptr  ].color = sColor(0.0f, 0.0f, intensity(frame, i, j + 1));
+      m_lights[ptr++].vertex = sPosition(m_x[i] + xz(frame, i, j + 1)[0] * mult, 0.0f, m_z[j+1] + xz(frame, i, j + 1)[1] * mult);
+      m_lights[ptr  ].color = sColor(0.0f, 0.0f, intensity(frame, i, j));
+      m_lights[ptr++].vertex = sPosition(m_x[i] + xz(frame, i, j)[0] * mult, 0.0f, m_z[j] + xz(frame, i, j)[1] * mult);
     }
     m_base->Draw(GL_TRIANGLE_STRIP, m_lights.data(), ptr);
     ptr = 0;
@@ -497,3 +534,35 @@ float CCausticTextures::interpolate(float a, float b, float c, float d, float wh
   t = b;
   return(q + r + s + t);
 }
+
+std::string CCausticTextures::cacheFile(float depth) const
+{
+  char name[128];
+  snprintf(name, sizeof(name), "caustics-%d-%d-%d-%g-%g-%g.bin",
+           m_numFrames, m_geoRes, m_texSize, depth, m_waveAmp, m_refractionMult);
+  return kodi::GetBaseUserPath(name);
+}
+
+bool CCausticTextures::loadCache(const std::string& file, float depth, std::vector<GLubyte>& bitmaps)
+{
+  kodi::vfs::CFile cache;
+  if (!kodi::vfs::FileExists(file) || !cache.OpenFile(file))
+    return false;
+
+  const sCausticCacheHeader expected = CacheHeader(m_numFrames, m_geoRes, m_texSize, depth, m_waveAmp, m_refractionMult);
+  sCausticCacheHeader header;
+  if (cache.Read(&header, sizeof(header)) != sizeof(header) ||
+      memcmp(&header, &expected, sizeof(header)) != 0)
+    return false;
+
+  return cache.Read(bitmaps.data(), bitmaps.size()) == ssize_t(bitmaps.size());
+}
+
+void CCausticTextures::saveCache(const std::string& file, float depth, const std::vector<GLubyte>& bitmaps)
+{
+  kodi::vfs::CreateDirectory(kodi::GetBaseUserPath());
+
+  const sCausticCacheHeader header = CacheHeader(m_numFrames, m_geoRes, m_texSize, depth, m_waveAmp, m_refractionMult);
+  if (!rsWriteFile(file, {{&header, sizeof(header)}, {bitmaps.data(), bitmaps.size()}}))
+    kodi::Log(ADDON_LOG_WARNING, "Failed to write caustic texture cache '%s'", file.c_str());
+}
@@ -21,6 +21,7 @@
 #include <kodi/gui/gl/GL.h>
 #include <kodi/AddonBase.h>
 #include <glm/gtc/type_ptr.hpp>
+#include <string>
 #include <vector>
 
 class CScreensaverHyperspace;
@@ -39,13 +40,34 @@ public:
 
 private:
   void makeFractalAltitudes();
-  void makeTrigAltitudes();
-  void altitudeSquare(int left, int right, int bottom, int top, float** alt);
-  void draw(int xlo, int xhi, int zlo, int zhi);
+  void makeTrigAltitudes(int frame);
+  void altitudeSquare(int left, int right, int bottom, int top, float* alt);
+  void makeIntensities(int frame, float depth);
+  void draw(int frame, int xlo, int xhi, int zlo, int zhi);
   void makeIndices(int index, int* minus, int* plus);
   float myFabs(float x){if(x<0) return -x; return x;};
   float interpolate(float a, float b, float c, float d, float where);
 
+  // The finished textures of all frames are kept on disk, as they only
+  // depend on the parameters and take a while to draw
+  std::string cacheFile(float depth) const;
+  bool loadCache(const std::string& file, float depth, std::vector<GLubyte>& bitmaps);
+  void saveCache(const std::string& file, float depth, const std::vector<GLubyte>& bitmaps);
+
+  // altitude, projected offset and light intensity of a vertex in a frame
+  ATTR_FORCEINLINE float& y(int frame, int i, int j)
+  {
+    return m_y[(frame * m_geoRes + i) * m_geoRes + j];
+  }
+  ATTR_FORCEINLINE float* xz(int frame, int i, int j)
+  {
+    return &m_xz[((frame * (m_geoRes + 1) + i) * (m_geoRes + 1) + j) * 2];
+  }
+  ATTR_FORCEINLINE float& intensity(int frame, int i, int j)
+  {
+    return m_intensity[(frame * (m_geoRes + 1) + i) * (m_geoRes + 1) + j];
+  }
+
   int m_numKeys;
   int m_numFrames;
   int m_geoRes;
@@ -57,14 +79,12 @@ private:
   GLuint* m_caustictex;
 
   // space for storing geometry of water surface
-  float* m_x;  // x and z are the same for each frame
-  float* m_z;
-  float*** m_y;  // y (altitude) is different
-
-  float*** m_xz;  // projected vertex positions
-  float** m_intensity;  // projected light intensity
+  std::vector<float> m_x;  // x and z are the same for each frame
+  std::vector<float> m_z;
+  std::vector<float> m_y;  // y (altitude) is different
 
-  GLubyte** m_bitmap;
+  std::vector<float> m_xz;  // projected vertex positions
+  std::vector<float> m_intensity;  // projected light intensity
 
   std::vector<sLight> m_lights;
   
@@ -53,3 +53,36 @@ bool CCamera::inViewVolume(float* pos, float radius)
     return false;
   return true;
 }
+
+bool CCamera::inViewVolume(const float* rotMat, const float* min, const float* max, float radius)
+{
+  // A plane is rotated back into the box's space by the transposed matrix,
+  // where the corner of the box farthest along its vector is easy to find
+  float vec[3];
+
+  // check back plane
+  vec[0] = rotMat[2];
+  vec[1] = rotMat[6];
+  vec[2] = rotMat[10];
+  if (farthest(vec, min, max) < -(farplane + radius))
+    return false;
+
+  // check bottom, top, left and right planes
+  for (int i = 0; i < 4; i++)
+  {
+    vec[0] = cullVec[i][0]*rotMat[0] + cullVec[i][1]*rotMat[1] + cullVec[i][2]*rotMat[2];
+    vec[1] = cullVec[i][0]*rotMat[4] + cullVec[i][1]*rotMat[5] + cullVec[i][2]*rotMat[6];
+    vec[2] = cullVec[i][0]*rotMat[8] + cullVec[i][1]*rotMat[9] + cullVec[i][2]*rotMat[10];
+    if (farthest(vec, min, max) < -radius)
+      return false;
+  }
+  return true;
+}
+
+float CCamera::farthest(const float* vec, const float* min, const float* max)
+{
+  float dist = 0.0f;
+  for (int i = 0; i < 3; i++)
+    dist += vec[i] * (vec[i] >= 0.0f ? max[i] : min[i]);
+  return dist;
+}
@@ -17,8 +17,16 @@ public:
   ~CCamera(){};
   void init(const float* mat, float f);
   bool inViewVolume(float* pos, float radius);
+  // Like inViewVolume() for the axis aligned box from min to max, given
+  // relative to the camera before rotating by rotMat.  Only returns false
+  // when all of the box is outside.
+  bool inViewVolume(const float* rotMat, const float* min, const float* max, float radius);
 
 // private:
   float farplane;
   float cullVec[4][3];  // vectors perpendicular to viewing volume planes
+
+private:
+  // distance along vec to the corner of the box farthest along it
+  static float farthest(const float* vec, const float* min, const float* max);
 };
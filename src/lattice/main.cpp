@@ -16,6 +16,7 @@
 
 #include "main.h"
 
+#include <algorithm>
 #include <chrono>
 #include <rsMath/rsMath.h>
 #include <kodi/gui/gl/Texture.h>
@@ -28,6 +29,11 @@
 #define TEXTURE_RGBA 2
 #define TEXTURE_ALPHA 3
 
+// Cells are culled as spheres of this radius, and candidates for the next
+// frames are kept while the camera moves less than the margin
+#define LATTICE_CULL_RADIUS 0.9f
+#define LATTICE_CULL_MARGIN 1.0f
+
 #define PI M_PI
 #define PIx2 (M_PI * 2)
 #define DEG2RAD (M_PI / 180)
@@ -82,6 +88,11 @@ bool CScreensaverLattice::Start()
   if (m_settings.dTexture != 2 && m_settings.dTexture != 6)  // No z-buffering for crystal or ghostly
     glEnable(GL_DEPTH_TEST);
 
+  // Drawing front to back lets the depth test reject hidden fragments early,
+  // but blended textures have to keep their order
+  m_sortCells = m_settings.dTexture != 2 && m_settings.dTexture != 6 && m_settings.dTexture != 7;
+  m_cellCandidatesValid = false;
+
   glFrontFace(GL_CCW);
   glEnable(GL_CULL_FACE);
   glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -215,6 +226,8 @@ bool CScreensaverLattice::Start()
   m_segments = 1;
 
   glGenBuffers(1, &m_vertexVBO);
+  uploadLatticeObjects(m_segmentList);
+
   m_lastTime = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
   m_startOK = true;
   return true;
@@ -280,7 +293,6 @@ void CScreensaverLattice::Render()
     glEnable(GL_BLEND);
   }
 
-  int i, j, k;
   int indexx, indexy, indexz;
   rsVec xyz, dir, angvel, tempVec;
   static rsVec oldxyz(0.0f, 0.0f, 0.0f);
@@ -394,54 +406,39 @@ void CScreensaverLattice::Render()
                                       glm::vec3(-xyz[0], -xyz[1], -xyz[2]));
 
   // Render everything
+  // The geometry stays in the vertex buffer and the shader stays bound, so
+  // each segment only needs its matrices and a single draw call.
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
   glBindTexture(GL_TEXTURE_2D, m_texture_id[0]);
-  for (i = m_globalxyz[0]-drawDepth; i <= m_globalxyz[0]+drawDepth; i++)
+  const bool segmentTextures = m_settings.dTexture == 1 || m_settings.dTexture == 9;
+  EnableShader();
+  findVisibleCells(xyz.v, rotMat, drawDepth);
+  for (const auto& cell : m_visibleCells)
   {
-    for (j = m_globalxyz[1]-drawDepth; j <= m_globalxyz[1]+drawDepth; j++)
+    indexx = myMod(cell.x);
+    indexy = myMod(cell.y);
+    indexz = myMod(cell.z);
+    glm::mat4 modelLattice = glm::translate(modelMat, glm::vec3(float(cell.x), float(cell.y), float(cell.z)));
+
+    // draw it
+    for (const auto& segment : m_segmentList[m_lattice[indexx][indexy][indexz]])
     {
-      for (k = m_globalxyz[2]-drawDepth; k <= m_globalxyz[2]+drawDepth; k++)
-      {
-        tempVec[0] = float(i) - xyz[0];
-        tempVec[1] = float(j) - xyz[1];
-        tempVec[2] = float(k) - xyz[2];
-
-        float tpos[3];  // transformed position
-        tpos[0] = tempVec[0] * rotMat[0] + tempVec[1] * rotMat[4] + tempVec[2] * rotMat[8];
-        tpos[1] = tempVec[0] * rotMat[1] + tempVec[1] * rotMat[5] + tempVec[2] * rotMat[9];
-        tpos[2] = tempVec[0] * rotMat[2] + tempVec[1] * rotMat[6] + tempVec[2] * rotMat[10];
-        if (m_camera.inViewVolume(tpos, 0.9f))
-        {
-          indexx = myMod(i);
-          indexy = myMod(j);
-          indexz = myMod(k);
-          glm::mat4 modelLattice = glm::translate(modelMat, glm::vec3(float(i), float(j), float(k)));
-
-          // draw it
-          for (const auto& entries : m_segmentList[m_lattice[indexx][indexy][indexz]])
-          {
-            EnableShader();
-            m_modelMat = modelLattice * entries.matrix;
-
-            if (m_settings.dTexture == 1 || m_settings.dTexture == 9)
-              glBindTexture(GL_TEXTURE_2D, entries.texture);
-
-            m_normalMat = glm::transpose(glm::inverse(glm::mat3(m_modelMat)));
-            for (const auto& entry : entries.entries)
-            {
-              glBufferData(GL_ARRAY_BUFFER, sizeof(sLatticeSegmentEntry)*entry.size(), &entry[0], GL_DYNAMIC_DRAW);
-              glDrawArrays(GL_TRIANGLE_STRIP, 0, entry.size());
-            }
-
-            if (m_settings.dTexture == 1 || m_settings.dTexture == 9)
-              glBindTexture(GL_TEXTURE_2D, 0);
-            DisableShader();
-          }
-        }
-      }
+      m_modelMat = modelLattice * segment.matrix;
+      m_normalMat = glm::transpose(glm::inverse(glm::mat3(m_modelMat)));
+      glUniformMatrix4fv(m_uModelViewMatLoc, 1, GL_FALSE, glm::value_ptr(m_modelMat));
+      glUniformMatrix3fv(m_uNormalMatLoc, 1, GL_FALSE, glm::value_ptr(m_normalMat));
+
+      if (segmentTextures)
+        glBindTexture(GL_TEXTURE_2D, segment.texture);
+
+      glDrawArrays(GL_TRIANGLE_STRIP, segment.first, segment.count);
     }
   }
 
+  DisableShader();
+  if (segmentTextures)
+    glBindTexture(GL_TEXTURE_2D, 0);
+
   glDisableVertexAttribArray(m_aNormalLoc);
   glDisableVertexAttribArray(m_aVertexLoc);
   glDisableVertexAttribArray(m_aColorLoc);
@@ -453,6 +450,89 @@ void CScreensaverLattice::Render()
   glDisable(GL_CULL_FACE);
 }
 
+// Fill m_visibleCells with the cells inside the view volume.  Whole slabs
+// and rows of cells outside of it are skipped at once, and the cells found
+// near the view volume are kept as candidates while the camera moves less
+// than LATTICE_CULL_MARGIN, so most frames only test those again.
+void CScreensaverLattice::findVisibleCells(const float* xyz, const float* rotMat, int drawDepth)
+{
+  const int* g = m_globalxyz;
+
+  // How far any cell can have moved relative to the camera since the
+  // candidates were found: the camera's own movement plus the rotation,
+  // which moves a point at most by sqrt(3 - trace(R * R0^T)) times its
+  // distance
+  bool rebuild = !m_cellCandidatesValid ||
+                 g[0] != m_cellCandidatesGlobalxyz[0] ||
+                 g[1] != m_cellCandidatesGlobalxyz[1] ||
+                 g[2] != m_cellCandidatesGlobalxyz[2];
+  if (!rebuild)
+  {
+    float maxDistance = 0.0f;
+    float moved = 0.0f;
+    float trace = 0.0f;
+    for (int a = 0; a < 3; a++)
+    {
+      const float nearEdge = fabsf(float(g[a] - drawDepth) - xyz[a]);
+      const float farEdge = fabsf(float(g[a] + drawDepth) - xyz[a]);
+      maxDistance += std::max(nearEdge, farEdge) * std::max(nearEdge, farEdge);
+      moved += (xyz[a] - m_cellCandidatesXyz[a]) * (xyz[a] - m_cellCandidatesXyz[a]);
+      for (int b = 0; b < 3; b++)
+        trace += rotMat[a * 4 + b] * m_cellCandidatesRotMat[a * 4 + b];
+    }
+    moved = sqrtf(moved) + sqrtf(std::max(0.0f, 3.0f - trace) * maxDistance);
+    rebuild = moved > LATTICE_CULL_MARGIN;
+  }
+
+  if (rebuild)
+  {
+    m_cellCandidates.clear();
+    const float radius = LATTICE_CULL_RADIUS + LATTICE_CULL_MARGIN;
+    for (int i = g[0] - drawDepth; i <= g[0] + drawDepth; i++)
+    {
+      float min[3] = {float(i) - xyz[0], float(g[1] - drawDepth) - xyz[1], float(g[2] - drawDepth) - xyz[2]};
+      float max[3] = {float(i) - xyz[0], float(g[1] + drawDepth) - xyz[1], float(g[2] + drawDepth) - xyz[2]};
+      if (!m_camera.inViewVolume(rotMat, min, max, radius))
+        continue;
+
+      for (int j = g[1] - drawDepth; j <= g[1] + drawDepth; j++)
+      {
+        min[1] = max[1] = float(j) - xyz[1];
+        if (!m_camera.inViewVolume(rotMat, min, max, radius))
+          continue;
+
+        for (int k = g[2] - drawDepth; k <= g[2] + drawDepth; k++)
+        {
+          const float pos[3] = {min[0], min[1], float(k) - xyz[2]};
+          if (m_camera.inViewVolume(rotMat, pos, pos, radius))
+            m_cellCandidates.push_back({i, j, k, 0.0f});
+        }
+      }
+    }
+
+    m_cellCandidatesValid = true;
+    std::copy(g, g + 3, m_cellCandidatesGlobalxyz);
+    std::copy(xyz, xyz + 3, m_cellCandidatesXyz);
+    std::copy(rotMat, rotMat + 16, m_cellCandidatesRotMat);
+  }
+
+  m_visibleCells.clear();
+  for (const auto& cell : m_cellCandidates)
+  {
+    const float pos[3] = {float(cell.x) - xyz[0], float(cell.y) - xyz[1], float(cell.z) - xyz[2]};
+    float tpos[3];  // transformed position
+    tpos[0] = pos[0] * rotMat[0] + pos[1] * rotMat[4] + pos[2] * rotMat[8];
+    tpos[1] = pos[0] * rotMat[1] + pos[1] * rotMat[5] + pos[2] * rotMat[9];
+    tpos[2] = pos[0] * rotMat[2] + pos[1] * rotMat[6] + pos[2] * rotMat[10];
+    if (m_camera.inViewVolume(tpos, LATTICE_CULL_RADIUS))
+      m_visibleCells.push_back({cell.x, cell.y, cell.z, -tpos[2]});
+  }
+
+  if (m_sortCells)
+    std::sort(m_visibleCells.begin(), m_visibleCells.end(),
+              [](const sLatticeCell& a, const sLatticeCell& b) { return a.depth < b.depth; });
+}
+
 void CScreensaverLattice::OnCompiledAndLinked()
 {
   // Variables passed directly to the Vertex shader
@@ -885,6 +965,49 @@ void CScreensaverLattice::makeLatticeObjects(std::vector<SEGMENT>& segments)
   }
 }
 
+// Join the triangle strips of every segment into one strip and put all of
+// them into the vertex buffer once, so that drawing a segment is a single
+// draw call without any upload.
+void CScreensaverLattice::uploadLatticeObjects(std::vector<SEGMENT>& segments)
+{
+  std::vector<sLatticeSegmentEntry> vertices;
+
+  for (auto& object : segments)
+  {
+    for (auto& segment : object)
+    {
+      segment.first = static_cast<GLint>(vertices.size());
+      for (const auto& strip : segment.entries)
+      {
+        if (strip.empty())
+          continue;
+
+        if (static_cast<GLint>(vertices.size()) > segment.first)
+        {
+          // Repeat the last vertex of the previous strip and the first of
+          // this one, which gives degenerate triangles that are never
+          // drawn.  One more repeat keeps this strip starting on an even
+          // triangle so that its front faces keep their winding.
+          const sLatticeSegmentEntry last = vertices.back();
+          vertices.push_back(last);
+          if ((vertices.size() - segment.first) % 2 == 0)
+            vertices.push_back(last);
+          vertices.push_back(strip.front());
+        }
+        vertices.insert(vertices.end(), strip.begin(), strip.end());
+      }
+      segment.count = static_cast<GLsizei>(vertices.size()) - segment.first;
+
+      // only needed on the GPU from now on
+      segment.entries.clear();
+    }
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(sLatticeSegmentEntry)*vertices.size(), vertices.data(), GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void CScreensaverLattice::makeTorus(sLatticeSegment& segment, int longitude, int latitude, float centerradius, float thickradius)
 {
   float r, rr;  // Radius
@@ -56,10 +56,22 @@ struct sLatticeSegment
   sColor color;
   glm::mat4 matrix;
   unsigned int texture = 0;
+
+  // The strips in entries joined into one strip inside the static vertex
+  // buffer, filled in by uploadLatticeObjects()
+  GLint first = 0;
+  GLsizei count = 0;
 };
 
 typedef std::vector<sLatticeSegment> SEGMENT;
 
+// A lattice cell that passed culling, with its distance in front of the camera
+struct sLatticeCell
+{
+  int x, y, z;
+  float depth;
+};
+
 // Parameters edited in the dialog box
 struct settings
 {
@@ -97,7 +109,9 @@ private:
   void reconfigure();
   void setMaterialAttribs(sLatticeSegment& segment);
   void makeLatticeObjects(std::vector<SEGMENT>& segments);
+  void uploadLatticeObjects(std::vector<SEGMENT>& segments);
   void makeTorus(sLatticeSegment& segment, int longitude, int latitude, float centerradius, float thickradius);
+  void findVisibleCells(const float* xyz, const float* rotMat, int drawDepth);
 
   settings m_settings;
   unsigned int m_lattice[LATSIZE][LATSIZE][LATSIZE];
@@ -161,5 +175,15 @@ private:
   float m_frameTime = 0.0f;
   std::vector<SEGMENT> m_segmentList;
 
+  // Cells near the view volume, found by findVisibleCells() and kept while
+  // the camera moves less than a cell away from where they were found
+  std::vector<sLatticeCell> m_cellCandidates;
+  std::vector<sLatticeCell> m_visibleCells;
+  bool m_cellCandidatesValid = false;
+  int m_cellCandidatesGlobalxyz[3];
+  float m_cellCandidatesXyz[3];
+  float m_cellCandidatesRotMat[16];
+  bool m_sortCells = false;
+
   CCamera m_camera;
 };
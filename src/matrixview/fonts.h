@@ -22,6566 +22,1297 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  US
  */
 
-#ifndef MATRIX_FONTS_H
-#define MATRIX_FONTS_H
-
 /* Font data for matrix characters, by Alex */
-unsigned char font[131072]={
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,40,58,82,103,
-121,139,131,109,67,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-22,40,58,77,82,103,109,109,109,112,109,109,109,109,94,82,58,40,22,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,22,50,82,94,109,109,109,109,109,109,109,109,109,109,109,
-109,109,109,109,109,109,109,109,109,109,109,94,77,50,22,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,40,86,103,109,109,109,
-109,109,109,112,94,82,50,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,22,50,82,109,109,109,109,109,109,109,109,109,109,109,109,109,
-109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,103,77,
-50,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,35,58,77,86,103,109,109,109,109,109,109,109,109,109,
-82,67,50,26,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,26,58,82,109,109,109,109,109,109,109,109,112,109,109,109,
-109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,112,109,
-109,109,58,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,26,40,67,73,94,94,109,103,86,77,
-67,50,26,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,50,77,94,109,
-109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,103,82,58,
-26,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,22,35,67,112,161,197,239,255,255,215,127,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,14,14,50,77,118,149,170,197,212,212,
-212,212,212,212,212,203,193,161,118,77,40,22,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,50,103,149,
-185,212,211,212,212,212,212,212,212,211,212,212,212,212,212,212,212,212,212,212,
-212,212,212,193,145,94,50,17,17,5,5,5,5,14,17,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,14,22,82,161,203,212,212,212,212,212,212,212,193,161,94,17,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,50,86,170,212,
-212,211,211,212,212,212,212,212,211,212,212,212,212,212,212,212,212,212,212,211,
-211,211,212,212,212,212,211,212,212,212,197,149,94,40,14,5,5,5,5,5,
-17,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,17,26,67,109,
-149,179,197,212,212,212,212,212,212,212,212,203,161,131,82,50,22,8,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,8,58,112,161,
-212,212,212,212,212,212,211,212,211,212,211,212,212,212,212,212,212,212,212,211,
-211,212,212,212,212,212,212,212,211,212,212,212,211,212,118,17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,26,50,82,118,149,170,193,211,197,161,149,131,82,50,26,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,26,40,94,145,193,203,212,212,212,212,212,211,212,212,
-212,212,212,212,212,212,212,212,212,197,161,109,50,22,17,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,8,
-17,17,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,22,64,109,121,139,161,
-179,203,212,239,255,255,251,212,131,26,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,17,
-40,64,104,131,157,179,203,212,230,230,242,251,242,242,242,242,242,242,230,220,
-203,179,161,127,82,49,17,5,5,8,5,5,5,8,5,5,5,8,5,5,
-5,5,5,5,5,8,22,26,86,149,185,220,230,242,251,242,251,242,251,242,
-251,242,251,242,242,242,242,251,242,251,242,242,242,242,242,239,212,193,140,94,
-35,17,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,8,8,5,40,82,157,212,
-242,242,242,242,251,242,251,242,224,193,104,8,8,17,5,5,5,5,5,5,
-5,5,5,17,5,5,5,17,49,103,197,251,242,251,242,242,242,251,242,242,
-242,242,242,242,251,251,242,251,242,251,242,251,242,251,242,242,251,242,242,251,
-242,251,230,167,104,49,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,40,73,104,149,170,197,211,230,239,251,247,251,247,247,
-247,251,247,247,224,203,193,161,139,103,58,26,17,5,5,8,5,5,5,5,
-5,5,8,5,5,5,8,5,5,64,130,193,247,247,247,247,247,247,247,247,
-247,248,247,248,247,247,248,248,248,247,248,247,248,247,248,247,247,248,248,247,
-247,247,247,247,248,247,140,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,17,26,49,94,127,161,185,203,212,224,239,
-247,230,224,212,211,193,161,130,94,58,8,17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,26,82,140,
-179,220,230,247,247,248,248,247,247,247,247,230,247,248,247,248,247,248,247,248,
-247,247,212,193,157,109,49,17,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,17,5,5,8,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,49,121,179,224,255,255,255,255,255,255,255,255,255,212,
-130,22,5,5,5,5,17,17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,32,67,127,194,239,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,220,163,82,26,17,
-5,5,5,5,5,8,8,5,5,8,8,5,5,5,5,17,8,5,26,58,
-148,242,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,239,163,58,22,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,8,67,163,220,255,255,255,255,255,255,255,255,255,
-255,212,118,8,5,5,5,5,5,8,5,17,8,8,8,5,5,5,5,22,
-58,118,220,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,194,118,49,8,5,
-5,8,8,5,5,8,5,5,5,8,5,5,5,8,8,8,5,17,67,140,
-203,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-242,194,103,44,22,5,5,17,5,5,5,8,5,5,5,5,5,5,5,5,
-5,73,139,202,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,157,22,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,22,44,103,179,239,255,255,255,255,255,255,255,255,255,255,255,255,255,230,
-179,109,26,17,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,26,53,130,238,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,194,82,22,
-17,5,5,5,17,5,5,5,5,5,5,5,5,5,17,5,5,17,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,8,5,5,17,5,5,17,5,17,8,17,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,53,167,
-238,255,255,255,255,255,255,255,255,255,255,220,127,22,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,5,
-5,22,53,95,157,202,238,255,255,255,255,255,242,220,194,179,157,145,139,130,
-130,157,179,203,230,255,255,242,220,170,118,58,8,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,53,109,167,230,238,242,203,157,149,130,
-139,139,130,139,130,130,130,145,157,194,220,248,255,255,255,255,255,255,255,255,
-255,255,255,203,118,58,22,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,5,5,5,22,40,
-109,197,255,255,255,247,255,255,255,255,255,255,247,220,113,17,8,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,17,40,73,139,170,170,167,170,167,
-170,170,179,167,170,167,170,167,170,170,167,170,170,170,170,170,179,203,255,255,
-255,255,255,255,255,255,255,194,118,50,5,8,5,5,5,17,5,5,5,5,
-5,5,8,5,5,5,5,17,67,113,163,211,247,255,255,255,255,255,255,247,
-203,179,179,179,203,230,255,255,255,255,255,255,255,238,197,149,85,49,22,5,
-8,5,5,5,8,5,5,5,8,5,5,5,5,40,73,103,139,130,130,139,
-130,139,130,139,130,130,130,130,139,130,139,130,130,130,139,130,139,130,145,167,
-203,255,255,255,255,255,255,255,255,255,148,17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,26,73,139,193,230,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,230,193,139,85,32,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-49,118,193,255,255,255,255,255,255,255,255,255,212,163,145,127,131,139,163,197,
-242,255,255,255,255,255,255,255,255,220,131,67,22,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,17,5,5,5,5,5,
-5,5,5,8,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,17,8,8,73,211,255,255,255,255,255,255,255,255,
-255,255,255,212,131,22,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,17,40,103,163,255,255,255,255,
-255,255,255,242,211,163,113,85,58,32,5,5,5,40,77,131,175,230,255,255,
-255,248,203,95,26,17,5,5,5,5,5,5,5,8,5,8,5,5,5,5,
-8,5,77,163,185,203,203,203,136,58,32,8,5,5,5,5,5,5,5,22,
-58,109,163,212,255,255,255,255,255,255,255,255,255,255,255,239,167,95,26,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,8,8,5,5,5,5,5,32,73,157,242,255,255,255,220,233,255,
-255,255,255,255,255,212,118,8,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,17,26,67,73,73,77,67,73,73,73,77,73,77,67,73,73,
-73,77,73,73,73,73,73,73,73,157,224,255,255,255,255,255,255,255,255,193,
-118,50,8,8,8,5,5,5,5,5,5,5,8,17,5,5,5,5,17,26,
-109,212,255,255,255,255,255,255,255,255,239,193,136,95,77,85,127,193,233,255,
-255,255,255,255,255,255,255,239,157,85,35,5,5,5,8,5,5,5,5,5,
-5,8,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,26,58,140,248,255,255,255,255,255,255,
-255,255,149,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,26,58,127,212,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,242,140,67,35,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,17,5,85,179,239,255,255,255,255,255,
-255,255,255,255,157,58,26,5,5,17,58,121,211,255,255,255,255,255,255,255,
-255,248,157,95,40,5,5,5,8,8,5,5,5,5,5,8,5,5,8,5,
-5,5,5,8,5,5,5,14,8,14,14,14,5,14,14,14,8,8,5,8,
-5,5,14,8,14,8,14,8,14,8,14,14,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,67,179,242,242,248,255,255,255,255,255,255,255,255,221,127,26,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,35,85,167,224,255,255,255,255,255,255,255,193,109,82,59,40,
-26,14,14,5,8,22,40,59,95,140,193,242,255,255,239,175,109,50,5,5,
-5,14,5,5,14,5,5,8,5,5,5,5,5,5,40,77,95,95,103,103,
-67,35,14,5,5,5,5,5,5,8,5,8,26,50,82,121,188,242,255,255,
-255,255,255,255,255,255,255,242,197,121,35,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,5,5,5,
-8,22,67,149,203,255,255,247,203,157,188,255,255,255,255,255,247,215,112,14,
-5,8,5,5,14,8,5,5,14,5,5,5,5,5,5,5,14,14,26,40,
-40,35,40,40,49,35,40,35,40,40,40,40,40,35,35,35,40,26,40,40,
-35,130,221,255,255,255,255,255,255,255,255,197,121,49,5,5,5,5,5,5,
-5,5,5,8,5,5,8,5,5,5,40,86,161,247,255,255,255,255,255,255,
-247,221,157,95,73,40,40,40,67,95,157,203,247,255,255,255,255,255,255,255,
-215,140,49,8,14,8,5,8,5,5,5,5,5,5,5,5,5,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,26,59,139,248,255,255,255,255,255,255,255,255,161,22,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,59,139,197,248,255,
-255,255,255,255,255,255,255,238,211,215,221,248,255,255,255,255,255,255,255,215,
-161,82,17,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,82,179,233,255,255,255,255,255,255,255,247,211,121,26,22,5,
-5,5,40,95,197,255,255,255,255,255,255,255,255,255,179,104,40,5,5,5,
-8,5,8,5,8,5,5,5,5,5,8,5,8,5,5,5,5,5,5,40,
-67,73,82,77,77,82,82,82,77,40,26,8,17,22,40,67,77,82,82,82,
-82,82,73,67,49,17,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,5,49,157,202,202,215,255,
-255,255,255,255,255,255,255,221,130,22,17,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,59,130,238,255,
-255,255,255,255,255,255,247,140,26,5,5,5,5,5,5,5,5,5,5,5,
-17,59,127,202,255,255,255,238,179,73,8,5,8,8,17,5,5,5,5,5,
-5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,8,5,5,8,8,
-5,17,5,8,5,5,8,40,130,202,255,255,255,255,255,255,255,255,255,255,
-221,139,40,17,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,17,5,5,8,17,5,8,5,22,40,104,221,255,255,251,215,
-157,86,140,255,255,255,255,255,251,215,113,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,5,5,5,5,104,211,247,255,255,255,255,
-255,255,255,197,121,50,5,5,5,5,5,5,5,5,8,5,5,5,5,8,
-8,14,67,149,212,255,255,255,255,255,255,255,224,157,86,5,5,5,5,8,
-5,14,67,130,221,255,255,255,255,255,255,255,255,197,77,22,5,5,14,14,
-5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,8,5,8,5,8,5,5,5,5,5,5,5,26,59,140,251,255,255,
-255,255,255,255,255,255,157,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,35,103,203,255,255,255,255,255,255,255,255,255,229,188,
-149,149,157,212,255,255,255,255,255,255,255,255,255,139,26,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,82,179,238,255,
-255,255,255,255,255,255,221,157,82,5,5,8,5,5,35,67,184,255,255,255,
-255,255,255,255,255,255,179,109,46,5,8,5,8,8,14,5,5,5,8,8,
-14,5,8,5,5,5,8,5,5,8,8,67,118,130,149,149,161,140,149,149,
-130,82,40,14,8,35,67,122,140,140,149,149,149,140,139,118,67,22,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,14,8,22,73,109,95,139,202,247,255,255,255,255,255,255,221,
-122,22,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,40,109,179,255,255,255,255,255,255,255,247,197,118,
-22,5,14,8,8,5,5,5,5,5,8,5,5,40,67,130,188,221,238,221,
-175,82,22,14,5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,14,8,26,
-82,161,229,255,255,255,255,255,255,255,255,255,221,139,35,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,8,5,35,109,175,238,255,255,224,145,103,77,149,255,255,255,255,255,
-247,221,112,14,5,5,8,5,8,8,5,5,8,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,5,8,8,5,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,109,212,247,255,255,255,255,255,255,255,194,118,58,5,5,
-5,5,5,5,5,14,5,5,8,5,5,5,8,22,109,203,247,255,255,255,
-255,255,255,255,175,103,40,5,5,5,8,5,5,8,40,82,179,255,255,255,
-255,255,255,255,255,212,95,32,22,5,5,5,8,5,8,5,5,5,5,5,
-5,5,5,14,5,5,14,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,8,5,5,5,5,40,95,161,255,255,255,255,255,255,255,255,255,145,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,26,82,149,
-229,255,255,255,255,255,255,255,255,212,139,95,73,73,82,125,175,221,255,255,
-255,255,255,255,255,179,95,44,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,77,179,233,255,255,255,255,255,255,255,221,149,
-82,8,5,5,5,14,67,130,212,255,255,255,255,255,255,255,255,255,179,112,
-40,5,5,8,8,5,5,5,14,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,103,167,194,221,221,221,221,221,221,188,109,50,22,26,73,122,188,
-221,221,221,221,212,221,188,145,85,22,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,5,5,
-5,5,67,167,224,255,255,255,255,255,255,221,130,22,8,8,8,8,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,58,
-149,221,255,255,255,255,255,255,255,224,161,85,14,8,5,5,8,8,5,5,
-5,5,5,8,5,5,14,67,112,161,194,194,176,95,26,14,5,5,5,8,
-5,5,5,5,5,14,8,8,14,8,8,5,5,5,5,8,5,5,5,5,
-8,5,8,5,5,14,5,5,5,5,8,22,50,109,212,255,255,255,255,255,
-255,255,255,255,221,145,32,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,14,5,5,5,5,14,67,161,229,255,
-255,255,188,73,50,67,157,255,255,255,255,255,255,212,118,8,5,5,5,5,
-5,8,5,5,5,14,8,8,5,5,5,5,5,5,5,5,8,5,8,5,
-8,5,5,8,5,5,14,5,5,8,5,8,5,5,5,5,5,109,212,255,
-255,255,255,255,255,255,255,188,118,50,14,5,5,5,5,5,5,5,5,5,
-5,5,5,8,22,40,139,255,255,255,255,255,255,255,255,255,139,22,14,5,
-5,5,5,5,8,8,5,40,149,233,255,255,255,255,255,255,255,229,122,58,
-22,5,5,5,5,5,8,14,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,8,58,122,
-194,255,255,255,255,255,255,255,255,238,131,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,40,127,194,255,255,255,255,255,255,255,255,
-247,161,50,22,5,5,5,40,82,172,255,255,255,255,255,255,255,220,157,73,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-77,176,238,255,255,255,255,255,255,255,215,149,73,8,5,5,8,22,109,194,
-238,255,255,255,255,255,255,255,255,247,184,112,40,8,8,5,5,5,5,5,
-5,8,5,8,5,5,5,5,14,5,5,8,8,5,8,118,220,255,255,255,
-255,255,255,255,247,140,58,26,40,100,170,248,255,255,255,255,255,255,233,167,
-94,22,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,8,5,5,5,5,5,58,167,233,255,255,255,
-255,255,255,220,127,22,5,8,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,58,157,229,255,255,255,255,255,255,
-255,229,161,94,22,5,5,5,8,5,5,5,5,5,8,5,5,5,5,32,
-58,82,100,100,86,40,14,14,5,5,5,8,5,8,5,14,5,5,5,5,
-5,8,5,5,5,5,8,5,5,8,5,8,5,5,5,8,5,5,5,5,
-8,5,5,14,22,86,203,255,255,255,255,255,255,255,255,255,221,139,40,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,26,58,118,211,255,255,255,194,131,44,40,67,149,255,
-255,255,255,255,248,221,112,14,5,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,14,8,5,5,8,5,5,5,8,5,5,8,8,8,5,
-5,5,14,5,5,5,8,5,5,109,212,247,255,255,255,255,255,255,255,193,
-118,50,5,5,5,5,5,5,5,5,5,5,5,5,8,5,44,94,170,255,
-255,255,255,255,255,255,255,229,118,14,5,5,5,5,5,5,8,5,5,32,
-118,193,247,255,255,255,255,255,255,229,140,76,26,5,5,5,5,5,5,5,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,14,5,5,67,161,229,255,255,255,255,255,255,255,
-229,179,94,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,40,140,211,255,255,255,255,255,255,255,255,203,127,40,8,5,8,5,22,
-32,157,255,255,255,255,255,255,255,221,167,76,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,76,179,238,255,255,255,255,255,
-255,255,212,145,76,5,14,8,22,46,149,238,255,255,255,255,255,255,255,255,
-255,255,184,112,40,8,5,5,14,5,8,5,5,5,5,5,5,8,5,5,
-5,8,5,5,8,5,14,139,255,255,255,255,255,255,255,255,242,118,26,14,
-26,103,170,242,255,255,255,255,255,255,238,161,95,26,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,67,170,230,255,255,255,255,255,255,221,127,22,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,58,161,230,255,255,255,255,255,255,255,230,161,86,14,5,5,5,
-5,5,8,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,8,
-5,8,8,5,5,5,5,8,8,5,14,5,5,5,5,5,5,5,8,14,
-5,8,8,5,14,5,5,5,5,5,14,5,5,5,5,5,5,58,203,255,
-255,255,255,255,255,255,255,255,221,140,32,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,40,112,
-179,242,255,255,230,136,73,22,32,67,149,255,255,255,255,255,248,215,112,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-14,14,22,22,22,22,22,22,31,22,22,22,22,31,14,31,22,31,31,31,
-22,121,220,255,255,255,255,255,255,255,255,193,121,50,5,5,8,5,5,5,
-5,5,5,5,8,5,5,8,58,140,211,255,255,255,255,255,255,255,242,203,
-109,5,5,14,5,8,5,5,5,5,8,31,95,167,239,255,255,255,255,255,
-255,239,157,86,31,8,14,8,5,5,5,5,8,5,14,5,5,5,5,5,
-5,5,5,8,8,5,5,5,5,8,5,5,5,5,5,5,8,5,14,8,
-8,14,82,203,255,255,255,255,255,255,255,255,203,109,58,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,50,148,230,255,255,255,255,
-255,255,255,230,170,95,31,5,5,5,8,14,5,131,255,255,255,255,255,255,
-255,230,179,86,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,82,179,239,255,255,255,255,255,255,255,212,145,77,5,5,5,
-40,82,188,255,255,255,255,255,255,255,255,255,255,247,184,109,40,8,14,5,
-5,5,8,8,5,5,5,5,5,5,8,14,8,5,5,5,8,5,22,157,
-255,255,255,255,255,255,255,255,239,95,5,5,40,109,179,247,255,255,255,255,
-255,255,230,157,95,22,5,5,5,5,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,67,167,
-230,255,255,255,255,255,255,220,131,31,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,58,158,230,255,255,
-255,255,255,255,255,230,158,86,22,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,
-8,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,8,5,
-5,5,5,8,5,5,5,5,5,58,194,255,255,255,255,255,255,255,255,255,
-230,139,40,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,32,82,170,239,255,255,247,179,82,40,8,
-31,67,148,255,255,255,255,255,247,212,112,14,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,8,8,5,14,22,40,82,109,118,131,127,127,
-127,131,118,127,131,118,131,118,118,131,127,127,131,188,247,255,255,255,255,255,
-255,255,255,194,118,50,5,8,5,8,5,5,5,5,8,5,5,8,5,5,
-73,167,221,255,255,255,255,255,255,255,224,176,95,5,5,5,5,5,8,8,
-5,5,5,26,95,167,239,255,255,255,255,255,255,247,161,95,35,5,8,5,
-5,14,5,5,5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,26,58,131,230,255,255,255,255,
-255,255,255,255,167,67,35,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,40,136,212,255,255,255,255,255,255,255,248,194,118,35,5,
-5,8,5,22,40,145,255,255,255,255,255,255,255,221,149,73,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,77,176,233,255,
-255,255,255,255,255,255,212,149,77,5,5,14,82,157,221,255,255,255,255,255,
-255,255,255,255,255,247,184,109,50,8,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,14,35,163,255,255,255,255,255,255,255,255,
-239,95,5,5,40,121,194,255,255,255,255,255,255,255,233,149,95,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,67,175,230,255,255,255,255,255,255,212,
-127,22,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,58,163,230,255,255,255,255,255,255,255,230,163,91,
-14,5,5,14,8,5,5,8,14,5,5,5,8,5,5,8,5,5,14,5,
-5,5,5,5,5,8,5,5,8,5,5,5,8,5,5,14,5,5,14,5,
-5,8,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,67,194,255,255,255,255,255,255,255,255,255,221,139,40,5,8,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,
-22,67,127,230,255,255,255,194,130,50,8,5,35,64,149,255,255,255,255,255,
-248,212,112,5,8,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,
-8,14,5,22,49,95,140,179,211,221,212,221,221,212,221,212,221,212,221,221,
-212,221,212,221,212,247,255,255,255,255,255,255,255,255,255,194,121,49,5,5,
-5,5,5,5,5,5,8,5,8,5,5,5,82,179,239,255,255,255,255,255,
-255,255,212,149,77,8,5,5,8,5,5,8,5,5,5,26,95,167,239,255,
-255,255,255,255,255,247,170,103,35,5,8,5,5,5,5,5,5,5,14,8,
-8,8,8,5,5,5,14,5,5,5,5,5,14,5,5,5,5,5,5,14,
-5,8,5,5,49,109,184,255,255,255,255,255,255,255,255,238,130,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,118,194,
-248,255,255,255,255,255,255,255,229,149,49,14,14,14,22,40,64,167,255,255,
-255,255,255,255,255,203,130,58,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,77,181,238,255,255,255,255,255,255,255,212,149,
-77,5,5,22,121,221,255,255,255,255,255,255,255,255,255,255,255,247,181,112,
-40,5,5,8,5,5,8,8,5,5,5,8,8,5,5,5,5,5,5,5,
-8,26,49,170,255,255,255,255,255,255,255,255,229,95,5,5,49,140,212,255,
-255,255,255,255,255,255,229,140,77,22,5,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,64,167,229,255,255,255,255,255,255,221,130,22,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,49,
-148,221,255,255,255,255,255,255,255,238,188,109,22,5,5,5,5,8,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,14,5,5,
-5,5,5,5,5,5,5,8,5,5,5,8,5,8,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,58,194,255,255,255,255,255,
-255,255,255,255,221,140,35,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,14,46,127,188,255,255,255,212,127,
-76,22,5,8,26,64,148,255,255,255,255,255,247,212,118,8,5,5,5,5,
-5,14,5,8,5,5,5,5,5,8,5,5,5,14,40,76,140,181,221,229,
-247,255,255,255,255,255,248,255,255,255,248,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,188,118,49,5,5,8,5,5,5,5,5,5,5,
-5,8,5,5,76,188,238,255,255,255,255,255,255,255,229,167,95,8,5,5,
-5,5,8,8,5,5,5,26,95,167,238,255,255,255,255,255,255,247,170,103,
-35,5,5,8,5,8,5,14,5,5,5,5,8,5,5,5,5,5,5,5,
-5,14,5,8,5,5,5,8,5,8,5,5,8,5,14,14,64,163,224,255,
-255,255,255,255,255,255,221,163,85,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,26,85,157,238,255,255,255,255,255,255,255,
-255,203,139,95,64,64,73,118,170,224,255,255,255,255,255,255,255,167,85,40,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-77,179,238,255,255,255,255,255,255,255,212,148,77,5,40,59,163,255,255,255,
-255,255,255,255,255,255,255,255,255,255,179,109,46,5,5,5,14,5,5,8,
-5,5,8,5,5,5,5,5,5,5,8,5,5,35,64,179,255,255,255,255,
-255,255,255,255,203,82,5,5,49,145,220,255,255,255,255,255,255,255,220,118,
-64,14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,8,5,5,5,5,8,5,5,5,59,167,233,255,255,255,
-255,255,255,220,127,22,5,8,5,8,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,49,130,197,255,255,255,255,255,255,
-255,247,211,121,22,5,8,5,5,5,5,8,5,5,5,5,8,5,5,5,
-5,5,5,5,8,5,8,5,5,5,5,8,8,5,14,5,8,5,8,5,
-5,8,5,8,5,8,5,5,5,5,5,8,5,8,5,5,14,5,5,5,
-5,8,8,5,5,64,197,255,255,255,255,255,255,255,255,255,220,145,40,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,22,77,184,255,255,255,247,170,73,14,14,5,5,26,59,148,255,
-255,255,255,255,255,212,121,8,5,5,5,5,5,5,5,8,5,14,5,5,
-5,5,8,14,5,26,64,130,220,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,251,255,251,255,255,255,255,255,255,255,255,255,255,255,255,239,179,
-109,49,5,5,5,5,5,5,5,5,5,5,5,8,5,5,82,188,239,255,
-255,255,255,255,255,255,247,197,109,5,5,5,5,14,5,5,8,5,5,35,
-103,179,239,255,255,255,255,255,255,247,167,94,26,5,5,5,5,5,8,5,
-8,8,5,5,8,5,5,5,5,5,8,5,8,5,8,5,8,5,5,5,
-5,8,8,5,5,5,8,35,103,212,255,255,255,255,255,255,255,255,188,86,
-35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,49,109,220,255,255,255,255,255,255,255,255,255,211,170,118,118,139,188,
-255,255,255,255,255,255,255,255,255,139,40,26,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,77,179,230,255,255,255,255,255,
-255,255,212,148,77,5,59,112,202,255,255,255,255,255,255,255,255,255,255,255,
-255,255,179,103,40,5,5,5,5,8,5,8,14,5,8,5,14,8,5,5,
-5,5,8,5,5,40,82,188,255,255,255,255,255,255,255,230,179,82,5,8,
-50,161,230,255,255,255,255,255,255,255,211,103,50,17,5,5,5,5,8,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,8,5,64,170,230,255,255,255,255,255,255,220,130,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,35,82,157,247,255,255,255,255,255,255,255,247,140,26,5,5,5,
-5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,17,5,5,5,5,8,
-5,5,5,5,8,5,17,5,8,5,5,5,5,5,5,8,5,59,202,255,
-255,255,255,255,255,255,255,255,224,140,32,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,73,136,212,255,255,
-247,170,109,40,8,5,5,5,26,64,149,255,255,255,255,255,255,212,118,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,130,197,
-247,255,255,255,255,255,255,255,255,255,255,247,203,170,136,130,112,112,118,118,
-112,118,112,112,112,118,112,112,112,112,109,82,50,26,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,94,202,255,255,255,255,255,255,255,255,255,239,
-118,5,5,5,5,5,8,5,5,5,5,32,136,211,255,255,255,255,255,255,
-255,230,149,82,26,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,14,5,5,5,5,8,5,5,40,103,
-179,242,255,255,255,255,255,255,255,224,140,50,22,8,5,8,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,26,77,167,230,255,255,
-255,255,255,255,255,255,242,230,211,211,221,242,255,255,255,255,255,255,255,224,
-175,94,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,82,179,239,255,255,255,255,255,255,255,212,148,77,5,100,188,
-239,255,255,255,255,255,255,255,255,255,255,255,255,247,179,109,40,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,40,77,188,
-255,255,255,255,255,255,255,239,179,73,5,5,50,179,251,255,255,255,255,255,
-255,255,211,94,40,14,5,5,5,14,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,64,175,
-230,255,255,255,255,255,255,221,127,22,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,50,109,221,255,
-255,255,255,255,255,255,255,163,50,14,5,5,5,5,5,5,5,5,5,5,
-5,8,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,14,5,8,5,5,8,5,8,5,8,5,
-5,5,5,5,5,5,5,8,14,64,203,255,255,255,255,255,255,255,255,255,
-224,139,40,8,5,5,5,5,8,5,14,5,14,5,5,5,8,5,5,5,
-5,5,5,14,5,8,50,118,194,247,255,255,221,112,49,22,5,5,5,5,
-35,64,148,255,255,255,255,255,255,212,112,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,59,179,255,255,255,255,255,255,255,255,255,
-255,255,242,203,140,100,49,26,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-94,203,255,255,255,255,255,255,255,255,255,255,139,22,14,5,8,8,5,5,
-8,5,14,49,175,255,255,255,255,255,255,255,255,224,130,64,22,5,8,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,64,167,238,255,255,255,255,255,255,255,
-230,175,100,14,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,40,118,188,238,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,175,94,49,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,82,179,238,255,
-255,255,255,255,255,255,212,148,82,22,140,251,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,184,109,40,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,8,5,49,82,188,255,255,255,255,255,255,255,230,
-179,73,5,5,64,188,255,255,255,255,255,255,255,255,202,94,35,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,59,167,230,255,255,255,255,255,255,221,
-130,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,64,148,202,255,255,255,255,255,255,255,211,
-121,64,17,8,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-8,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,8,5,17,
-49,100,212,255,255,255,255,255,255,255,255,255,224,140,40,5,17,5,5,5,
-8,5,5,5,5,5,17,5,8,5,5,5,5,5,5,5,17,40,85,175,
-238,255,255,221,161,73,22,17,5,8,5,5,26,64,148,255,255,255,255,255,
-248,212,118,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,58,194,255,255,255,255,255,255,255,255,255,255,238,175,118,64,49,26,17,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,85,194,247,255,255,255,255,255,
-255,255,255,255,179,77,49,5,5,5,5,5,5,22,49,109,202,255,255,255,
-255,255,255,255,255,224,118,58,26,8,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,40,109,211,255,255,255,255,255,255,255,255,194,100,58,8,5,5,5,5,
-5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,
-49,100,167,212,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,212,161,100,49,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,82,179,238,255,255,255,255,255,255,255,212,148,
-112,91,184,255,255,255,255,242,255,255,255,255,255,255,255,255,255,255,184,112,
-40,5,5,5,5,5,5,5,5,5,5,5,8,5,8,8,5,5,8,5,
-5,64,118,202,255,255,255,255,255,255,255,221,158,64,5,5,64,197,255,255,
-255,255,255,255,255,255,197,58,22,17,5,5,5,5,5,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,64,167,230,255,255,255,255,255,255,212,127,22,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,32,77,148,224,255,255,255,255,255,255,242,197,118,40,22,8,8,5,5,
-8,5,5,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,8,5,5,
-5,5,5,5,5,5,8,5,5,8,5,22,82,139,224,255,255,255,255,255,
-255,255,255,255,221,140,40,8,8,5,5,5,8,5,5,5,5,5,5,5,
-8,5,17,5,5,5,5,5,22,73,139,224,255,255,242,167,95,40,5,8,
-5,8,5,5,26,64,148,255,255,255,255,255,248,212,118,17,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,64,202,255,255,255,255,255,
-255,255,255,255,255,202,109,50,17,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,17,82,179,242,255,255,255,255,255,255,255,255,255,202,139,82,22,
-17,17,17,17,22,40,103,161,230,255,255,255,255,255,255,255,255,221,109,49,
-17,5,5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,5,17,5,8,32,82,157,238,255,255,255,255,
-255,255,255,230,148,49,17,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,40,109,167,224,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,242,161,82,49,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-77,179,238,255,255,255,255,255,255,255,212,148,148,157,212,255,255,255,230,203,
-242,255,255,255,255,255,255,255,255,242,184,109,40,5,5,5,5,5,5,5,
-5,5,5,5,8,5,8,5,5,8,8,8,5,77,145,221,255,255,255,255,
-255,255,255,211,145,59,5,8,64,203,255,255,255,255,255,255,255,255,188,49,
-5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,59,175,230,255,255,255,
-255,255,255,221,130,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,17,40,77,127,194,242,255,
-255,255,255,255,242,194,139,86,22,17,5,5,8,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,5,5,
-8,5,5,5,5,5,5,5,5,17,5,5,5,5,8,8,17,5,5,5,
-5,17,8,49,127,194,248,255,255,255,255,255,255,255,255,255,221,145,40,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,
-40,139,212,255,255,255,211,109,40,22,5,5,5,5,5,5,32,67,148,255,
-255,255,255,255,248,212,118,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,59,203,255,255,255,255,255,255,255,255,255,255,170,67,26,
-13,5,5,17,5,13,5,17,5,13,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,82,184,238,255,
-255,255,255,255,255,255,255,255,242,221,157,82,67,49,49,49,67,95,170,230,
-255,255,255,255,255,255,255,255,255,188,77,22,17,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,5,
-5,5,5,17,49,149,221,255,255,255,255,255,255,255,230,161,91,26,17,17,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,40,109,167,230,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,230,157,77,40,13,5,13,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,77,179,230,255,255,255,255,255,
-255,255,221,157,188,221,247,255,255,255,188,139,221,255,255,255,255,255,255,255,
-255,255,184,109,40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,77,149,212,255,255,255,255,255,255,255,203,130,49,17,13,
-73,211,255,255,255,255,255,255,255,255,188,49,13,5,13,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,67,167,230,255,255,255,255,255,255,212,127,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,22,59,121,212,248,255,255,255,255,255,255,230,145,
-58,40,22,17,13,5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,13,13,5,5,5,5,5,5,5,5,
-13,13,22,17,17,17,17,22,17,17,22,22,22,26,46,85,179,247,255,255,
-255,255,255,255,255,255,255,255,212,139,32,5,5,5,5,5,5,5,5,5,
-5,5,5,13,17,13,13,5,13,5,17,26,77,188,255,255,255,230,175,73,
-17,17,17,17,22,22,17,17,40,67,157,255,255,255,255,255,247,212,118,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,67,202,255,
-255,255,255,255,255,255,255,255,230,148,32,5,13,5,5,5,5,5,17,5,
-13,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,85,179,230,255,255,255,255,255,255,255,255,255,
-255,255,212,157,130,100,100,109,127,161,230,255,255,255,255,255,255,255,255,248,
-221,148,46,5,5,8,8,5,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,17,5,8,5,5,5,17,40,94,202,255,255,
-255,255,255,255,255,255,197,91,40,17,5,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,22,58,118,179,
-238,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230,161,82,58,
-17,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,77,179,238,255,255,255,255,255,255,255,230,179,212,255,255,255,
-255,255,161,82,193,255,255,255,255,255,255,255,255,247,184,109,40,5,5,5,
-5,5,5,5,5,5,5,8,8,5,5,8,5,8,8,5,5,82,157,220,
-255,255,255,255,255,255,255,193,118,49,5,26,82,211,255,255,255,255,255,255,
-255,255,184,46,5,8,5,5,5,5,5,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,58,175,
-230,255,255,255,255,255,255,220,131,26,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,8,
-26,58,118,175,230,255,255,255,255,255,255,220,179,118,58,32,5,5,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,8,5,26,49,46,49,49,49,46,46,
-49,46,49,58,82,112,148,179,224,255,255,255,255,255,255,255,255,255,255,242,
-193,109,35,5,5,5,8,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,17,86,157,220,255,255,255,202,140,82,50,50,50,50,50,50,50,50,
-73,94,175,255,255,255,255,255,255,212,118,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,58,202,255,255,255,255,255,255,255,255,255,
-224,140,40,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-67,140,211,255,255,255,255,255,255,255,255,255,255,255,255,224,220,202,202,202,
-220,230,255,255,255,255,255,255,255,255,230,184,131,73,26,5,5,5,5,5,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,8,5,5,26,94,167,238,255,255,255,255,255,255,255,230,161,58,
-22,5,5,5,5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,26,94,140,197,238,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,224,197,131,67,40,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,77,179,238,255,
-255,255,255,255,255,255,255,238,251,255,255,255,242,202,104,50,179,255,255,255,
-255,255,255,255,255,255,184,104,41,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,100,193,238,255,255,255,255,255,255,255,175,
-100,50,14,50,100,212,255,255,255,255,255,255,255,251,167,41,5,14,8,8,
-8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,67,167,230,255,255,255,255,255,255,220,
-127,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,22,50,104,179,220,255,255,
-255,255,255,255,255,193,118,73,32,22,8,8,5,8,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-8,5,8,5,59,100,100,100,104,100,100,100,104,104,104,104,149,193,230,255,
-255,255,255,255,255,255,255,255,255,255,255,212,149,82,22,5,8,5,8,8,
-8,5,5,5,8,5,5,5,8,5,5,5,5,22,50,130,212,255,255,255,
-255,193,140,104,100,100,104,100,104,104,100,100,113,140,193,255,255,255,255,255,
-247,212,118,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,64,203,255,255,255,255,255,255,255,255,255,212,139,32,8,5,5,14,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,50,118,194,255,255,255,255,255,
-255,255,255,251,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,224,179,118,50,14,8,8,5,8,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,14,59,157,
-220,255,255,255,255,255,255,255,247,194,113,31,5,5,5,5,14,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,59,
-148,212,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,203,130,59,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,8,82,179,238,255,255,255,255,255,255,255,255,255,
-255,255,255,255,211,148,73,31,175,255,255,255,255,255,255,255,255,251,179,109,
-41,5,5,5,5,5,5,5,5,5,5,5,14,5,8,5,8,5,14,5,
-8,113,211,247,255,255,255,255,255,255,255,167,91,41,17,50,118,220,255,255,
-255,255,255,255,255,233,148,41,8,5,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,64,175,233,255,255,255,255,255,255,220,130,22,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,
-5,5,17,5,5,17,22,50,91,130,193,233,255,255,255,255,255,247,212,161,
-118,59,22,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,17,5,5,103,203,211,211,
-203,203,203,211,211,211,203,211,220,247,255,255,255,255,255,255,255,255,255,255,
-255,255,212,157,82,41,17,5,17,5,5,5,5,5,5,8,5,5,8,8,
-5,5,5,5,8,50,103,193,255,255,255,255,255,247,220,212,203,211,203,203,
-203,203,211,203,211,220,247,255,255,255,255,255,255,212,113,17,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,64,203,255,255,255,255,255,
-255,255,255,255,224,139,35,5,5,5,5,5,5,5,8,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,8,50,118,193,255,255,255,255,255,255,255,229,163,179,179,211,238,
-255,255,255,255,255,255,255,255,255,238,220,203,163,130,94,59,22,14,5,5,
-5,8,8,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,41,94,188,255,255,255,255,255,255,255,255,
-212,127,67,22,5,8,5,5,5,8,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,22,50,109,194,255,255,255,255,255,255,255,
-255,255,247,212,188,188,203,229,255,255,255,255,255,255,255,247,203,109,22,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-77,184,229,255,255,255,255,255,255,255,255,255,255,255,255,255,170,82,40,35,
-167,255,255,255,255,255,255,255,255,255,179,109,40,5,5,5,5,5,5,5,
-5,5,5,8,5,8,5,14,5,8,5,5,14,112,212,248,255,255,255,255,
-255,255,255,163,73,35,22,58,118,224,255,255,255,255,255,255,255,229,163,40,
-5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,67,163,229,255,255,255,
-255,255,255,220,127,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,14,
-22,58,127,179,238,255,255,255,255,255,255,238,188,118,50,32,14,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,131,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,247,212,161,94,31,5,8,5,
-5,5,5,5,5,8,5,8,5,8,5,5,5,5,5,14,31,100,161,224,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,248,212,118,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,67,197,255,255,255,255,255,255,255,255,255,224,140,32,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,50,109,179,255,
-255,255,255,255,255,255,203,118,118,109,148,188,211,238,230,238,238,230,238,230,
-211,188,163,127,94,58,14,5,5,5,5,5,5,8,5,8,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,
-22,67,131,230,255,255,255,255,255,255,255,255,170,73,22,14,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,31,94,163,238,255,255,255,255,255,255,255,255,242,188,154,113,118,131,179,
-230,255,255,255,255,255,255,255,255,140,40,22,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,77,184,230,255,255,255,255,255,
-255,255,255,255,255,255,255,238,127,40,22,32,167,255,255,255,255,255,255,255,
-255,255,184,109,40,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,8,5,5,118,224,255,255,255,255,255,255,255,255,148,67,31,22,67,
-118,224,255,255,255,255,255,255,255,212,131,40,5,5,5,14,8,5,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,67,167,230,255,255,255,255,255,255,221,131,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,14,26,58,94,139,188,242,255,
-255,255,255,255,242,197,154,94,40,22,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-103,212,242,255,255,255,255,255,255,255,255,255,242,203,194,188,188,188,188,188,
-188,188,179,163,131,103,64,40,14,5,8,8,5,5,14,8,5,5,5,5,
-5,5,8,5,5,5,5,22,53,140,224,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,212,118,14,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,64,203,255,
-255,255,255,255,255,255,255,255,224,139,35,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,26,58,149,255,255,255,255,255,255,255,224,167,
-103,49,64,77,85,94,103,94,103,104,94,94,85,77,73,58,40,22,14,5,
-5,5,5,5,8,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,35,131,197,248,255,255,255,255,
-255,255,255,211,139,49,22,5,5,8,8,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,35,131,197,255,255,255,255,
-255,255,255,255,255,188,103,64,53,53,58,94,140,211,255,255,255,255,255,255,
-255,172,85,49,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,77,184,238,255,255,255,255,255,255,255,255,255,255,255,230,172,
-103,8,14,26,172,255,255,255,255,255,255,255,255,247,184,104,40,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,139,255,255,
-255,255,255,255,255,255,255,149,64,26,26,85,157,238,255,255,255,255,255,255,
-247,188,118,26,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,64,167,
-233,255,255,255,255,255,255,212,131,22,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,
-8,5,8,5,5,5,5,35,49,131,197,233,255,255,255,255,255,255,230,161,
-86,49,22,14,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,14,5,8,5,14,5,5,5,5,5,77,148,197,238,247,255,255,255,
-255,255,255,255,221,188,167,148,139,127,118,118,118,118,112,86,53,22,14,5,
-5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,14,35,
-64,161,233,247,247,247,248,248,247,247,247,247,248,247,247,247,247,248,247,247,
-247,255,255,255,255,255,255,255,248,211,118,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,64,203,255,255,255,255,255,255,255,255,255,
-221,139,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-17,26,118,247,255,255,255,255,255,255,248,203,109,17,17,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,8,8,5,5,5,5,17,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,17,53,167,248,255,255,255,255,255,255,255,238,167,95,35,5,5,
-5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,49,157,220,255,255,255,255,255,255,255,255,233,148,40,5,
-5,5,5,40,77,167,255,255,255,255,255,255,255,197,118,59,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,77,184,233,255,
-255,255,255,255,255,255,255,255,255,255,197,118,64,5,8,26,172,255,255,255,
-255,255,255,255,255,247,179,109,40,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,157,255,255,255,255,255,255,255,255,248,139,
-59,26,35,103,172,247,255,255,255,255,255,255,238,167,95,26,5,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,59,172,230,255,255,255,255,255,255,220,
-127,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,5,5,5,5,5,5,8,5,5,5,17,
-26,50,103,157,221,248,255,255,255,255,255,221,188,131,64,35,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,26,64,95,127,161,203,238,255,255,255,255,255,255,238,211,172,
-131,95,64,50,50,50,50,40,22,17,5,5,5,5,5,8,5,5,5,5,
-8,5,8,5,8,5,5,5,5,5,5,17,50,95,139,140,140,140,140,140,
-140,140,140,140,140,140,140,140,140,140,140,140,157,172,212,255,255,255,255,255,
-247,212,118,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,59,203,255,255,255,255,255,255,255,255,248,221,139,40,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,17,17,91,194,230,255,255,255,
-255,255,255,255,157,50,26,5,17,5,5,5,8,8,5,5,5,5,5,5,
-5,5,5,17,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,22,73,188,255,255,
-255,255,255,255,255,255,224,127,64,22,5,5,5,8,5,17,5,8,17,5,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,149,224,
-255,255,255,255,255,255,255,247,194,118,26,5,5,5,5,22,35,149,255,255,
-255,255,255,255,255,194,130,64,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,17,5,5,77,185,238,255,255,255,255,255,255,255,255,255,
-255,255,163,59,35,5,5,35,167,255,255,255,255,255,255,255,255,255,179,112,
-40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,5,5,5,
-5,140,255,255,255,255,255,255,255,255,247,118,26,17,26,109,179,247,255,255,
-255,255,255,255,238,163,95,26,5,5,5,5,8,8,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,64,167,230,255,255,255,255,255,255,221,127,31,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,8,5,5,5,5,5,5,17,22,82,163,203,247,255,
-255,255,255,255,255,194,130,82,40,22,17,5,17,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,22,40,
-82,139,179,220,247,255,255,255,255,255,247,211,163,112,73,49,35,31,14,5,
-5,5,5,5,5,5,8,8,5,5,5,5,8,5,8,5,8,5,5,14,
-8,5,5,14,22,49,64,59,64,59,59,64,59,64,64,64,59,59,59,59,
-59,59,59,59,77,109,179,255,255,255,255,255,255,212,118,14,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,64,202,255,255,255,255,255,
-255,255,255,255,230,140,35,13,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,64,130,202,255,255,255,255,255,255,255,188,104,49,5,
-5,5,5,8,5,5,8,5,5,8,5,5,5,5,8,5,5,5,5,5,
-8,5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,13,35,85,202,255,255,255,255,255,255,255,255,212,95,
-35,13,5,8,5,5,5,5,8,8,5,8,5,8,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,49,149,224,255,255,255,255,255,255,255,238,
-179,100,31,5,5,5,5,13,13,130,255,255,255,255,255,255,255,197,118,64,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-77,179,238,255,255,255,255,255,255,255,255,255,255,224,127,13,13,5,8,32,
-179,255,255,255,255,255,255,255,255,248,179,109,40,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,8,5,5,13,130,242,242,242,242,242,242,
-242,242,212,95,5,5,32,95,167,212,242,242,242,242,242,242,202,149,86,22,
-5,5,5,8,5,13,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,64,175,229,255,255,255,
-255,255,255,221,130,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-13,8,5,5,5,8,8,32,64,113,161,212,255,255,255,255,255,242,212,175,
-121,59,8,13,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,5,5,5,5,5,13,5,5,5,13,13,40,59,82,100,149,179,221,255,
-255,255,255,255,229,212,179,149,113,73,32,13,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,13,22,26,26,
-26,26,26,26,32,26,26,26,26,26,26,26,26,26,26,26,49,82,161,255,
-255,255,255,255,242,212,118,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,64,203,255,255,255,255,255,255,255,255,255,255,161,49,13,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,26,59,
-157,255,255,255,255,255,255,255,238,179,104,22,13,5,5,5,8,5,5,8,
-5,5,5,5,5,5,8,5,8,5,8,8,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,22,40,
-100,212,255,255,255,255,255,255,255,255,203,64,22,8,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,40,140,212,255,255,255,255,255,255,255,255,203,130,32,5,5,5,5,22,
-50,157,255,255,255,255,255,255,255,179,104,50,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,77,184,229,255,255,255,255,255,
-255,255,255,255,221,157,82,13,5,5,5,26,167,255,255,255,255,255,255,255,
-255,255,179,104,46,5,5,5,5,5,5,5,5,5,5,5,5,13,5,13,
-5,5,5,5,5,73,140,139,140,139,140,140,140,139,121,50,5,5,22,64,
-95,130,140,140,139,140,139,140,121,82,46,22,5,5,5,5,5,5,5,13,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,64,167,233,255,255,255,255,255,255,221,127,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,5,5,
-5,41,95,161,221,242,255,255,255,255,255,239,194,121,64,32,22,13,5,5,
-5,5,5,5,5,5,5,5,5,5,5,13,5,13,5,5,5,5,13,13,
-5,13,5,5,5,5,13,26,64,113,161,203,233,255,255,255,255,255,255,233,
-184,139,82,64,46,32,13,13,5,5,5,5,5,5,5,5,5,13,5,13,
-13,5,5,5,5,5,5,5,13,5,5,5,5,13,5,13,5,5,5,5,
-5,5,5,5,5,5,5,5,26,64,148,248,255,255,255,255,255,221,113,13,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,59,203,255,
-255,255,255,255,255,255,255,255,255,188,77,26,13,13,13,5,5,5,5,5,
-5,5,5,5,5,5,5,13,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,13,5,5,13,22,104,203,247,255,255,255,255,255,
-255,247,148,59,32,13,5,8,5,5,5,5,5,13,8,5,8,5,13,5,
-5,13,8,5,13,8,5,8,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,13,59,104,212,255,255,255,255,255,255,
-255,255,194,59,5,5,5,8,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,41,121,188,255,255,255,255,
-255,255,255,255,233,161,64,40,32,32,32,64,104,188,255,255,255,255,255,255,
-255,161,73,32,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,77,179,239,255,255,255,255,255,255,255,255,255,179,95,40,8,
-5,8,5,26,170,255,255,255,255,255,255,255,255,247,179,104,40,5,5,5,
-5,5,5,5,5,5,5,8,5,5,13,5,5,5,8,5,5,40,59,59,
-59,59,59,64,59,59,59,26,5,5,13,32,40,59,64,64,59,64,64,59,
-50,40,26,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,59,170,
-233,255,255,255,255,255,255,212,130,22,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,22,32,73,104,170,233,255,
-255,255,255,255,247,211,170,104,59,22,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,8,
-32,46,59,95,127,170,211,239,255,255,255,255,247,224,202,170,130,104,50,17,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,17,5,5,5,5,17,5,5,5,5,5,5,5,5,
-26,64,145,255,255,255,255,255,247,212,113,17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,64,202,255,255,255,255,255,255,255,255,255,
-255,221,148,86,22,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,59,109,188,255,255,255,255,255,255,255,212,161,95,40,22,5,
-17,5,8,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,5,
-5,5,8,59,113,212,255,255,255,255,255,255,255,255,202,59,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,8,8,5,5,
-5,5,5,5,5,22,73,139,229,255,255,255,255,255,255,255,255,212,161,121,
-103,104,104,157,197,230,255,255,255,255,255,255,239,130,26,22,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,77,185,230,255,
-255,255,255,255,255,255,255,247,145,40,22,5,5,5,5,26,167,255,255,255,
-255,255,255,255,255,255,179,104,46,5,5,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,17,26,26,26,26,26,26,26,26,22,8,
-5,5,5,17,22,22,26,26,26,26,26,26,22,22,22,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,8,8,
-5,5,17,5,8,5,8,5,5,5,59,167,230,255,255,255,255,255,255,221,
-127,22,5,5,5,5,17,5,8,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
-22,22,22,22,22,22,22,32,46,121,188,230,255,255,255,255,255,255,248,175,
-113,64,26,8,5,5,17,5,8,5,5,5,5,8,5,5,5,5,22,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,40,86,130,167,211,
-247,255,255,255,255,255,255,247,212,163,104,73,46,26,8,5,5,5,5,5,
-5,5,5,5,5,5,5,8,13,5,5,5,5,5,13,5,8,5,5,5,
-8,5,8,5,8,5,5,5,5,5,5,5,32,64,157,255,255,255,255,255,
-255,211,121,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,59,197,255,255,255,255,255,255,255,255,255,255,248,211,139,59,40,32,22,
-22,13,5,8,8,5,13,13,26,32,46,59,64,64,59,40,22,22,5,5,
-8,5,5,8,5,13,5,5,5,5,8,5,8,8,8,5,22,46,118,203,
-230,255,255,255,255,255,255,230,163,94,64,40,26,22,8,5,5,5,5,5,
-8,5,8,5,5,8,5,8,5,8,5,5,5,5,5,13,5,5,13,5,
-5,5,5,5,5,5,8,5,8,5,5,5,5,5,22,50,109,212,255,255,
-255,255,255,255,255,255,197,59,5,5,5,13,5,5,5,5,5,5,5,5,
-5,8,5,8,5,5,5,5,5,8,5,5,5,8,5,5,5,13,32,94,
-193,255,255,255,255,255,255,255,255,255,221,197,175,179,179,221,255,255,255,255,
-255,255,255,230,193,85,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,77,179,230,255,255,255,255,255,255,255,255,247,
-139,26,26,22,22,22,32,64,179,255,255,255,255,255,255,255,255,247,179,109,
-40,5,5,5,8,8,13,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,8,13,5,5,5,5,5,5,5,8,5,5,5,
-5,8,64,175,230,255,255,255,255,255,255,221,127,26,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,40,50,
-50,50,50,59,50,59,50,59,50,50,59,50,59,50,59,50,59,50,46,59,
-64,94,118,193,247,255,255,255,255,255,255,247,203,127,77,32,5,5,5,5,
-5,5,5,5,5,8,5,5,8,5,40,94,100,104,100,104,100,100,100,104,
-100,104,100,104,104,100,104,104,118,131,157,179,203,247,255,255,255,255,255,255,
-255,247,212,179,127,82,22,5,5,5,8,5,5,8,5,5,8,5,5,5,
-5,5,8,13,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,26,59,145,255,255,255,255,255,255,212,118,13,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,59,179,255,255,255,255,255,
-255,255,255,255,255,255,255,212,163,118,86,67,40,26,5,5,5,8,8,32,
-59,104,145,179,197,197,193,118,67,26,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,22,46,94,148,203,247,255,255,255,255,255,
-238,211,163,118,82,46,26,5,8,5,5,5,8,8,5,8,13,5,5,5,
-5,5,8,5,5,5,8,5,8,5,5,5,5,5,5,8,5,5,5,5,
-13,5,5,5,5,5,22,50,112,212,255,255,255,255,255,255,255,255,197,67,
-8,13,5,5,5,13,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,8,5,5,8,13,46,118,193,247,255,255,255,255,255,
-255,255,255,248,247,247,247,255,255,255,255,255,255,255,255,179,109,50,5,5,
-5,13,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-67,163,221,255,255,255,255,255,255,255,255,255,179,94,77,50,50,59,109,157,
-224,255,255,255,255,255,255,255,255,248,163,94,32,5,5,13,5,8,5,8,
-13,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,5,5,8,5,
-5,5,8,5,5,5,5,5,5,8,5,5,5,5,67,167,230,255,255,255,
-255,255,255,212,131,22,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,26,86,118,118,118,118,118,118,118,118,118,
-118,118,118,118,118,118,118,118,118,118,118,118,112,118,118,193,247,255,255,255,
-255,255,255,255,255,193,118,46,5,5,5,5,8,5,5,5,8,8,5,5,
-13,5,73,161,170,170,167,170,170,170,170,170,170,170,167,170,170,170,170,179,
-170,170,170,179,211,238,255,255,255,255,255,255,255,255,255,247,193,112,32,5,
-8,5,13,5,8,5,5,5,8,5,5,5,5,5,8,26,41,59,67,67,
-67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,82,112,179,255,
-255,255,255,255,248,212,118,5,8,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,41,140,211,247,255,255,255,255,255,255,255,255,255,255,255,
-230,197,149,131,109,94,59,67,67,67,67,94,127,167,220,255,255,255,230,149,
-73,41,5,5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,8,5,
-14,5,14,14,77,139,184,230,247,255,255,255,255,255,230,193,140,109,82,59,
-67,59,50,50,50,50,50,32,8,5,5,5,8,5,8,5,8,5,5,8,
-8,8,5,5,14,5,5,8,8,5,5,5,5,5,5,14,5,5,14,50,
-112,220,255,255,255,255,255,255,255,255,197,59,5,5,5,5,5,5,5,8,
-5,5,5,8,5,5,5,14,5,5,5,5,5,14,8,5,8,5,8,5,
-8,5,5,26,67,131,203,247,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,238,212,131,41,22,14,5,5,5,5,5,8,5,5,5,
-5,5,14,5,8,5,5,5,5,8,5,8,50,131,193,255,255,255,255,255,
-255,255,255,255,220,158,139,121,121,121,170,215,255,255,255,255,255,255,255,255,
-255,220,131,73,31,5,5,5,5,5,14,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,5,5,5,5,5,14,5,5,5,5,5,14,
-5,5,5,8,5,8,67,170,230,255,255,255,255,255,255,221,127,31,5,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,50,161,224,221,224,221,224,221,221,224,221,224,221,221,221,224,221,224,221,
-221,221,221,221,221,221,221,247,255,255,255,255,255,255,255,255,255,215,149,59,
-14,5,8,8,8,8,5,8,5,8,5,5,5,5,103,221,238,242,242,242,
-238,238,242,242,242,242,242,242,242,238,242,242,242,238,242,242,255,255,255,255,
-255,255,255,255,255,255,255,255,215,131,35,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,5,8,73,121,167,203,203,197,203,203,203,203,203,203,203,
-203,203,203,197,203,203,203,203,211,221,242,255,255,255,255,255,255,211,121,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,31,76,140,
-215,255,255,255,255,255,255,255,255,255,255,255,255,242,230,224,221,211,203,203,
-203,203,203,211,221,242,255,255,255,224,172,94,35,14,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,14,31,53,82,109,
-163,203,238,255,255,255,255,242,238,221,211,197,172,163,157,163,149,149,140,109,
-41,5,5,8,5,14,8,5,5,5,8,8,5,5,5,5,8,5,5,5,
-5,5,5,5,8,5,8,5,5,5,22,49,109,215,255,255,255,255,255,255,
-255,255,203,59,8,5,8,8,5,14,8,5,5,5,5,5,5,8,5,5,
-5,8,5,5,8,5,8,5,5,5,5,5,5,5,5,14,31,67,118,172,
-230,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230,163,103,59,
-14,14,8,5,5,8,5,8,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,31,59,131,221,255,255,255,255,255,255,255,255,255,230,230,224,
-221,221,242,255,255,255,255,255,255,255,255,255,221,163,82,31,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,59,149,
-211,238,248,242,255,242,224,194,118,22,5,8,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,67,179,255,248,248,248,242,
-242,248,242,248,248,248,248,248,242,255,248,242,255,242,242,242,242,242,242,248,
-248,248,255,242,242,242,255,242,238,212,157,59,5,5,5,8,14,5,8,5,
-8,5,5,5,5,5,103,224,242,242,255,242,242,242,248,242,248,248,242,248,
-248,248,242,248,242,248,248,248,242,242,255,242,255,248,242,255,242,248,242,230,
-197,131,31,5,8,5,5,5,5,5,14,5,8,5,5,5,5,5,14,85,
-163,203,255,248,248,248,248,242,242,255,242,248,242,255,242,248,248,242,255,242,
-242,255,242,248,242,248,255,242,221,194,103,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,31,85,163,203,224,242,242,242,248,242,
-248,242,255,248,242,242,242,255,248,248,255,242,255,242,242,242,242,242,242,230,
-212,163,109,49,5,5,14,5,5,5,5,8,14,5,5,5,5,5,5,5,
-5,5,14,5,5,5,5,5,5,5,22,35,85,139,172,211,221,233,238,248,
-242,248,242,242,224,211,203,194,194,194,179,140,49,14,5,5,5,5,5,5,
-8,8,5,8,5,5,5,5,8,5,5,5,5,5,14,5,5,5,8,5,
-8,5,14,49,103,194,242,242,248,242,255,248,248,242,172,59,5,5,5,5,
-8,5,5,5,14,5,5,5,5,5,5,8,8,5,8,14,5,8,5,5,
-8,14,5,5,14,5,5,5,5,22,59,109,161,202,224,242,242,255,255,255,
-255,255,255,242,242,238,224,197,172,103,31,14,5,5,5,8,5,5,8,5,
-14,5,5,5,5,5,5,5,5,8,8,8,8,5,5,5,14,14,85,161,
-202,224,239,242,242,255,242,242,242,248,242,255,242,248,248,248,248,255,242,248,
-242,239,233,211,157,104,35,5,5,5,5,5,8,5,8,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,8,8,5,5,5,5,14,
-8,5,5,5,5,5,5,5,8,5,49,104,149,172,184,184,172,184,161,140,
-85,22,5,8,14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,40,139,179,179,179,179,179,179,179,179,179,179,179,179,179,
-184,179,184,179,184,179,179,179,194,179,179,179,179,184,184,179,179,184,179,184,
-172,140,104,49,8,8,5,14,5,5,5,5,5,8,5,5,14,5,77,167,
-179,179,179,184,184,179,179,184,179,179,179,179,179,179,184,184,184,184,179,179,
-179,179,184,184,179,179,179,184,179,179,179,167,140,94,35,5,5,5,5,5,
-8,5,8,5,5,5,5,5,5,5,14,68,122,161,179,179,179,184,179,179,
-179,179,179,184,179,179,179,184,179,184,179,184,184,179,179,179,184,179,184,179,
-161,139,77,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,35,49,85,122,157,172,179,179,184,179,179,179,179,184,179,184,179,
-179,179,184,184,184,179,179,184,184,172,161,131,104,67,49,22,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,14,5,5,8,8,8,5,5,5,
-8,5,14,14,35,49,67,77,104,131,157,167,179,179,184,179,172,161,161,161,
-161,161,161,122,49,14,8,5,5,5,5,5,5,5,5,5,8,5,14,5,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,14,35,68,140,179,184,
-179,184,179,184,184,179,122,40,5,5,5,5,8,5,5,5,5,5,5,8,
-5,14,8,5,5,8,5,5,5,8,8,5,5,5,5,8,5,5,5,8,
-5,8,31,40,58,100,122,161,172,197,221,229,229,221,211,197,172,139,104,85,
-58,40,14,14,5,5,8,5,8,8,5,8,5,8,8,8,5,5,5,8,
-5,5,5,5,5,5,5,5,5,14,26,58,94,131,149,179,179,179,179,179,
-184,179,179,179,179,179,179,179,184,179,179,179,161,149,121,100,67,40,14,5,
-5,8,5,5,5,14,5,5,14,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,14,5,5,5,8,5,8,8,5,5,5,5,5,
-5,5,35,67,100,104,104,104,104,100,100,86,49,14,5,5,5,5,5,5,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,86,104,
-104,104,104,104,104,104,112,104,104,104,112,104,104,104,104,104,104,100,104,104,
-104,104,112,104,104,104,100,112,104,104,104,104,100,94,68,35,5,8,5,5,
-5,5,5,5,5,5,5,8,5,5,50,104,104,104,104,104,104,112,104,104,
-104,112,112,112,104,104,104,104,104,104,104,104,112,112,104,104,104,104,104,104,
-104,112,112,104,94,58,14,5,5,5,8,5,5,5,5,8,5,5,8,5,
-8,5,14,50,86,100,104,104,112,104,104,104,112,112,112,104,104,104,104,104,
-100,104,104,104,104,104,104,104,104,104,100,104,100,86,50,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,58,86,
-100,104,104,104,104,112,104,104,104,104,112,104,104,112,104,104,104,104,104,104,
-104,100,100,58,26,22,5,5,5,5,5,14,5,8,5,5,5,5,8,5,
-5,14,5,5,5,5,5,8,14,8,5,8,5,8,5,5,5,5,5,5,
-26,58,86,104,100,100,104,100,104,104,104,104,112,104,104,94,40,14,5,5,
-5,5,5,5,5,5,14,5,5,5,5,5,8,8,8,5,5,5,5,8,
-5,5,5,5,5,5,14,22,50,86,104,104,104,104,112,104,104,104,86,26,
-5,5,5,5,5,5,5,5,8,5,8,8,5,5,5,5,5,8,5,5,
-5,8,5,5,5,5,8,5,5,8,5,8,5,5,5,5,5,26,58,86,
-104,131,161,161,161,157,139,121,100,67,40,22,5,5,5,5,5,5,8,5,
-8,5,8,5,8,5,5,14,5,5,5,5,8,5,5,5,14,5,8,5,
-8,5,5,5,26,50,86,100,104,112,104,104,112,104,112,112,104,104,112,112,
-104,104,104,104,94,77,50,26,14,5,5,8,5,8,8,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,8,14,5,5,5,5,5,5,5,14,26,35,40,40,40,
-35,40,35,35,22,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,35,40,40,40,40,50,40,50,40,40,
-50,40,40,40,40,40,40,40,35,50,40,50,40,50,40,40,40,40,40,40,
-40,40,40,40,40,40,26,14,8,5,5,5,5,5,14,5,5,5,5,8,
-5,5,22,40,40,40,40,35,40,40,40,40,40,40,40,40,40,40,40,40,
-40,40,50,40,40,50,40,40,40,40,40,40,40,40,50,40,26,26,8,5,
-8,5,5,5,5,8,5,8,5,8,5,5,5,5,8,22,35,40,40,40,
-40,40,50,40,40,40,40,40,40,40,40,40,40,40,35,40,40,40,50,40,
-35,40,40,40,40,35,22,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,22,35,40,40,40,40,40,40,50,40,
-40,40,40,40,40,40,40,50,40,35,40,40,40,35,35,22,14,5,5,5,
-14,5,5,5,8,8,5,8,8,8,8,5,8,5,8,5,5,14,5,8,
-5,8,5,5,8,5,5,5,5,5,5,5,14,26,35,35,40,40,40,50,
-40,40,50,40,40,50,40,35,22,5,14,5,8,5,8,5,5,5,8,5,
-5,5,14,5,5,8,8,5,5,5,8,5,5,5,5,8,5,5,5,8,
-22,35,40,40,40,40,40,40,40,40,35,8,5,5,14,5,5,5,5,8,
-5,5,5,8,5,8,5,5,5,5,5,5,5,14,5,8,5,5,5,8,
-5,5,5,5,8,5,5,5,5,14,26,26,40,50,50,67,58,58,50,50,
-40,26,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,14,22,35,40,
-40,40,50,40,40,40,40,40,50,40,40,40,40,40,35,35,40,35,22,14,
-8,5,5,5,5,5,8,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,5,5,5,8,5,5,5,5,8,5,
-8,5,5,5,5,5,5,5,14,5,5,5,5,5,14,5,5,5,5,5,
-8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,14,5,5,
-8,5,5,5,5,5,8,5,14,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,14,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,14,8,5,5,5,5,5,5,5,8,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,8,8,14,8,22,22,26,26,22,26,22,22,22,14,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,22,
-26,22,22,26,22,26,22,26,22,26,22,26,26,22,22,22,26,22,26,22,
-22,26,22,26,22,22,26,26,22,22,22,14,5,8,5,5,8,5,8,5,
-8,8,5,5,5,8,8,5,5,5,5,5,5,5,14,8,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,
-5,5,5,5,5,8,8,5,5,5,5,5,8,5,5,5,5,8,14,5,
-8,5,5,5,5,8,5,5,5,5,5,8,14,5,5,5,5,8,5,5,
-5,5,5,8,5,5,5,8,5,5,14,5,8,5,5,8,8,5,8,5,
-8,5,5,5,5,5,5,5,5,5,5,14,8,22,22,22,26,26,26,22,
-26,22,22,26,22,22,22,22,26,22,26,22,22,22,22,22,22,22,26,22,
-26,22,26,26,22,26,22,22,14,5,5,5,8,5,5,5,5,8,5,5,
-8,5,8,5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,14,5,5,5,5,8,8,5,8,8,5,5,5,8,14,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,8,14,8,8,5,5,5,5,5,5,5,8,5,8,
-5,5,5,14,5,5,5,5,5,5,5,14,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,5,5,5,5,5,
-5,5,8,14,8,5,8,5,5,5,5,5,5,5,5,8,5,5,5,8,
-5,5,5,5,5,5,5,5,5,8,5,5,14,8,5,8,5,5,8,5,
-5,5,14,5,5,8,8,5,5,5,5,5,5,5,5,8,5,5,14,8,
-5,8,5,5,5,8,5,8,8,5,14,5,8,5,14,5,5,5,5,8,
-22,40,58,58,58,58,58,58,50,40,26,8,5,8,5,5,5,8,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,35,50,50,58,58,67,58,58,58,58,
-67,58,58,58,58,58,67,58,58,58,67,58,67,58,58,58,58,58,58,58,
-50,50,40,22,5,5,8,5,5,8,5,8,5,5,8,8,5,5,5,5,
-8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,8,5,8,8,5,
-5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,
-8,5,5,5,5,8,5,5,14,5,8,5,5,5,5,5,5,5,5,5,
-5,8,5,8,8,14,8,5,14,5,5,5,5,5,5,5,5,5,14,5,
-5,5,5,8,22,35,50,58,67,58,67,58,58,58,58,58,58,58,58,58,
-58,67,58,58,58,58,58,58,67,67,58,58,58,58,58,50,67,58,58,40,
-26,22,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,8,14,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,50,86,86,86,86,77,77,
-77,77,77,77,77,77,77,86,86,77,77,77,77,86,77,86,77,77,77,77,
-77,86,77,77,86,77,58,40,26,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,8,8,8,8,5,5,8,14,5,5,5,5,5,8,5,8,5,5,
-8,5,14,5,5,5,5,5,5,8,5,8,5,5,8,5,8,5,5,5,
-8,5,5,5,5,8,5,8,5,5,5,5,8,5,5,5,5,8,5,5,
-8,5,5,14,5,5,8,5,5,5,5,5,8,5,8,5,5,8,5,5,
-14,5,5,5,5,5,8,5,5,5,14,26,50,94,131,131,131,131,121,131,
-121,86,50,22,5,5,5,8,5,5,8,5,5,5,5,8,5,5,5,5,
-5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,68,104,121,139,127,131,121,127,127,127,131,127,127,131,131,131,131,121,
-127,131,131,121,131,127,127,127,127,131,131,131,127,104,94,40,5,8,5,8,
-5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,8,5,8,5,8,5,8,5,5,5,5,5,5,5,
-5,8,5,8,5,8,5,5,14,5,5,5,5,5,8,8,8,5,5,8,
-5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,8,5,5,
-5,8,5,5,5,14,5,5,5,5,14,5,5,14,5,8,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,8,14,5,22,50,86,104,131,
-121,131,127,127,127,127,131,127,131,121,131,127,127,127,131,127,131,121,131,131,
-127,131,127,121,131,127,131,131,131,121,121,94,58,26,5,5,8,5,5,5,
-5,5,5,5,14,5,5,5,5,5,5,14,5,5,8,8,5,14,5,5,
-5,5,5,8,14,5,5,5,5,5,5,8,5,5,8,8,5,8,5,5,
-5,8,5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,22,127,212,212,212,212,212,220,212,212,212,212,212,220,220,212,
-212,212,212,220,212,212,220,212,212,212,212,212,212,220,212,212,212,220,167,104,
-58,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-8,5,5,5,5,14,8,8,5,5,5,5,5,5,5,5,5,8,5,5,
-5,14,8,5,5,5,5,5,5,14,5,5,5,8,5,5,5,5,5,5,
-8,5,8,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,
-14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,5,5,40,77,161,229,229,229,229,229,229,203,157,94,40,5,5,8,5,
-5,5,5,5,5,8,5,5,8,5,8,5,5,5,5,14,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,40,127,193,220,229,229,229,
-229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,229,
-229,229,229,229,229,193,157,67,5,5,5,5,5,5,8,5,5,8,5,5,
-5,14,5,5,8,5,5,5,5,5,5,5,5,5,8,5,8,5,5,8,
-8,5,5,5,5,5,5,5,8,8,8,5,5,5,8,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,
-5,8,5,8,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,8,8,5,5,5,5,22,86,139,193,233,229,233,233,233,233,233,233,229,
-233,233,233,233,233,233,233,233,229,233,229,233,229,229,233,233,233,233,233,233,
-229,233,220,161,104,50,5,8,5,5,5,14,8,5,5,5,5,5,8,5,
-5,14,5,5,5,5,5,5,8,8,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,212,149,68,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,14,14,22,26,26,26,26,26,26,35,40,50,40,40,50,50,
-58,67,58,67,58,67,50,35,14,14,5,5,8,5,8,5,5,5,5,5,
-5,5,5,8,8,5,8,5,8,5,8,5,5,5,8,5,8,5,5,5,
-5,5,8,14,5,5,5,5,8,5,5,5,5,8,5,5,8,5,5,14,
-5,5,14,5,5,5,5,5,5,5,5,5,8,8,14,50,91,193,255,255,
-255,255,255,255,255,179,118,40,5,5,5,5,8,5,5,8,5,5,14,5,
-5,8,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,40,139,193,229,247,247,247,247,247,247,247,247,247,247,247,
-247,247,247,247,247,247,247,247,247,255,255,255,255,255,255,255,255,239,185,82,
-5,5,14,8,5,8,5,5,5,8,5,8,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,14,5,5,5,5,
-5,5,8,5,8,5,8,8,8,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,14,50,82,82,82,82,82,82,82,91,
-82,82,91,82,91,82,82,82,82,82,82,82,82,91,82,82,82,91,58,35,
-22,5,8,5,5,5,5,5,5,5,14,5,8,5,5,5,8,5,5,26,
-77,139,193,220,220,220,220,229,229,229,220,220,220,229,229,229,220,220,220,220,
-229,229,229,247,255,255,255,255,255,255,255,255,255,255,229,161,104,40,5,8,
-8,5,5,8,5,5,5,8,5,5,5,5,8,5,5,5,8,5,5,8,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,22,161,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,211,140,68,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,40,58,58,
-58,67,67,58,58,82,118,104,104,112,112,131,157,161,167,161,167,161,140,82,
-40,22,5,8,5,8,5,5,5,5,5,5,5,5,5,14,5,8,5,8,
-5,8,8,5,8,5,5,5,5,8,8,5,8,5,5,5,5,5,5,5,
-5,14,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,40,94,193,255,255,255,255,255,255,247,193,118,49,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,94,140,
-161,179,172,172,179,172,172,172,172,179,172,172,179,172,172,179,172,172,172,172,
-179,224,255,255,255,255,255,255,255,239,179,82,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,8,5,5,5,5,5,8,5,5,5,8,5,5,
-5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,8,14,118,220,212,220,220,220,220,220,212,220,220,212,220,220,212,220,220,
-220,220,220,212,220,220,220,212,220,212,161,73,35,14,8,14,8,5,5,5,
-5,5,5,8,5,5,5,8,5,5,5,14,49,77,104,118,118,118,118,118,
-118,118,118,118,118,127,118,118,118,118,118,118,127,118,118,172,239,255,255,255,
-255,255,255,255,255,211,145,100,58,26,5,14,5,8,5,8,5,14,5,5,
-5,5,8,8,5,5,14,5,5,8,8,5,8,5,5,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,8,
-5,8,5,14,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,161,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,197,131,73,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,26,40,49,67,67,67,
-67,67,67,77,82,86,82,94,94,104,127,131,131,131,127,131,139,157,179,179,
-179,179,193,202,221,224,224,230,230,230,197,109,49,14,5,8,5,5,5,5,
-5,5,5,5,8,8,5,8,5,5,5,8,8,5,14,5,5,5,8,5,
-5,5,8,5,22,22,40,58,67,67,67,67,67,67,67,58,40,32,14,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,44,
-94,197,255,255,255,255,255,255,255,179,118,44,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,22,58,86,94,109,100,100,109,100,109,109,
-109,109,109,100,100,100,109,109,100,109,100,131,149,212,255,255,255,255,255,255,
-255,238,193,77,5,5,5,5,8,5,14,5,5,5,8,5,5,8,5,5,
-5,5,5,8,5,5,5,5,14,5,5,5,5,14,5,5,5,5,5,8,
-5,5,8,5,5,5,5,14,5,5,5,14,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,14,5,5,5,8,5,8,14,158,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,193,94,44,5,8,14,5,5,5,5,5,8,5,5,8,14,5,8,
-5,5,5,14,22,32,44,58,58,49,58,58,49,58,58,58,58,58,58,58,
-49,58,49,58,58,58,49,139,221,255,255,255,255,255,255,255,255,175,109,58,
-26,14,5,5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,8,14,8,5,5,5,5,8,8,5,5,5,5,
-8,5,5,5,8,5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,22,158,255,255,255,255,255,255,
-238,230,230,224,224,224,224,221,224,224,224,224,224,224,224,224,224,224,224,224,
-224,224,224,224,224,224,175,118,58,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,22,64,100,139,161,161,161,175,175,179,194,212,221,221,224,
-224,224,238,224,238,238,238,238,230,247,255,247,255,255,247,255,255,255,255,255,
-255,255,224,131,58,22,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,14,8,5,5,8,5,5,5,5,8,8,5,5,8,22,44,100,149,
-161,167,167,167,167,167,161,149,109,67,22,5,8,14,5,5,8,8,5,8,
-5,5,5,8,5,8,5,5,5,5,14,44,100,197,255,255,255,255,255,255,
-255,193,109,40,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,22,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,94,175,224,255,255,255,255,255,255,255,238,185,82,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,22,161,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,197,94,40,14,5,8,
-5,8,5,5,14,5,5,8,5,5,5,8,8,5,5,5,14,14,14,22,
-22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,109,
-211,247,255,255,255,255,255,255,255,161,77,40,14,8,5,5,5,8,8,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,8,8,8,5,
-5,5,8,5,14,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,22,161,255,255,255,255,255,212,179,161,157,149,149,157,149,149,
-157,149,157,149,149,157,149,149,157,149,149,149,149,149,157,149,149,149,113,82,
-40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,100,161,
-202,221,230,224,224,238,247,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,238,130,64,26,5,8,
-8,5,5,5,5,5,5,5,14,8,5,5,5,5,5,5,8,8,5,5,
-5,5,8,5,5,14,26,44,82,121,172,211,221,230,230,230,224,212,193,149,
-104,58,22,5,8,5,8,5,5,5,8,5,5,5,5,5,5,5,5,22,
-26,40,44,77,118,211,255,255,255,255,255,255,255,193,139,82,44,50,44,50,
-44,50,50,40,50,50,50,44,50,50,44,50,44,44,44,44,44,44,26,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,26,44,130,202,247,255,255,
-255,255,255,255,255,230,172,73,5,8,5,5,5,5,5,5,5,8,5,5,
-8,5,8,5,5,5,5,8,5,5,8,8,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,8,5,8,14,5,8,5,8,5,5,8,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,14,8,5,22,149,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,179,85,44,5,5,5,8,5,8,5,5,5,5,5,
-5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,104,211,242,255,255,255,255,255,255,
-255,161,64,26,5,8,5,8,5,8,5,5,5,5,5,5,5,14,5,5,
-8,14,32,58,73,85,94,94,94,85,94,85,85,85,58,32,14,5,5,8,
-5,5,5,5,14,5,5,8,5,5,5,5,5,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,
-255,255,255,172,104,64,44,44,44,40,50,44,50,44,50,40,44,40,50,44,
-50,40,50,40,50,44,40,44,40,58,40,26,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,44,140,211,242,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,242,130,58,26,8,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,58,100,
-167,230,242,255,255,255,255,255,242,203,140,85,44,22,14,5,8,5,5,14,
-8,5,8,5,5,5,5,5,5,5,5,32,58,94,118,139,161,230,255,255,
-255,255,255,255,255,221,184,139,118,118,118,118,118,118,112,118,118,112,109,118,
-112,112,112,112,112,112,112,118,112,118,58,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,8,5,5,58,112,179,255,255,255,255,255,255,255,255,255,211,149,64,
-5,5,8,8,5,5,5,8,5,5,8,5,5,5,8,5,8,5,8,5,
-5,5,5,8,8,5,5,5,8,8,5,5,5,5,8,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,14,8,5,5,5,5,5,
-8,5,5,5,8,5,5,5,5,8,22,127,230,230,230,230,230,230,221,230,
-233,255,255,255,255,255,255,255,255,238,230,230,230,221,230,230,230,230,161,73,
-40,14,5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,14,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,109,211,247,255,255,255,255,255,255,255,161,64,32,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,14,22,64,139,193,221,230,221,
-230,230,221,230,221,211,139,77,40,5,8,5,5,5,5,5,8,5,5,5,
-8,5,5,5,5,5,14,8,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,149,58,32,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,50,161,230,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,221,127,
-50,26,5,5,8,5,5,5,5,5,8,5,8,5,5,5,5,5,14,5,
-5,8,5,5,5,8,14,22,50,77,130,175,230,255,255,255,255,255,255,230,
-193,157,91,44,22,8,5,5,8,5,8,5,5,5,8,8,5,5,5,5,
-5,5,5,58,94,145,193,193,215,255,255,255,255,255,255,255,255,247,220,193,
-179,193,179,193,184,179,184,193,179,193,193,193,193,193,193,179,193,179,184,193,
-179,193,94,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,8,22,40,109,179,238,
-255,255,255,255,255,255,255,255,247,175,103,50,5,5,5,5,8,5,5,8,
-5,8,5,5,5,8,5,8,5,5,5,14,5,5,5,14,5,5,5,5,
-8,8,5,14,5,5,5,8,5,8,5,5,8,5,8,8,5,5,5,8,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,8,82,149,149,149,149,149,149,149,149,161,215,255,255,255,255,255,255,
-242,179,149,149,149,149,149,149,149,149,109,50,26,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,109,203,242,255,255,
-255,255,255,255,255,161,64,32,5,5,8,5,5,5,8,5,5,5,5,5,
-14,5,5,5,5,22,58,121,161,211,242,255,255,255,255,255,255,255,203,148,
-104,64,40,22,5,5,8,5,5,5,8,5,8,5,8,5,8,8,5,5,
-5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,161,255,255,255,255,255,148,64,26,5,8,5,5,8,8,8,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,50,161,229,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,247,194,104,50,22,5,8,5,8,5,5,
-5,5,5,5,8,5,8,5,5,5,5,5,8,5,8,5,5,5,22,40,
-121,179,212,247,255,255,255,255,255,255,212,148,104,58,32,14,14,5,5,5,
-5,5,5,5,5,8,5,5,8,5,14,5,8,5,5,73,131,194,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,251,255,255,251,255,255,255,255,
-255,251,255,247,255,247,255,255,255,255,255,255,255,247,131,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,5,5,49,85,161,255,255,255,255,255,255,255,255,255,255,
-212,121,49,22,5,8,5,5,5,5,5,5,5,8,5,8,5,5,5,5,
-8,8,5,5,5,8,5,5,5,5,8,8,5,5,5,5,5,5,5,5,
-5,5,8,5,14,8,5,5,14,5,5,5,5,8,5,5,5,5,14,14,
-8,8,5,5,5,8,8,14,5,5,5,5,5,5,5,26,49,40,49,40,
-49,40,49,49,73,167,229,255,255,255,255,255,212,94,49,40,49,49,40,49,
-40,49,32,22,14,5,5,14,5,14,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,104,211,247,255,255,255,255,255,255,255,149,67,32,
-5,5,5,5,5,14,5,5,8,8,8,8,5,5,5,5,5,8,22,40,
-73,103,179,255,255,255,255,255,255,255,255,242,203,167,94,32,22,8,5,5,
-8,5,5,8,8,8,14,5,8,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,149,
-67,26,14,5,14,8,8,5,14,5,5,5,5,8,5,5,8,5,5,5,
-5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,49,157,229,255,255,255,255,255,255,255,255,255,255,255,255,
-251,239,239,239,229,239,229,229,220,212,212,212,212,212,203,197,197,197,197,193,
-179,161,130,67,40,14,8,5,8,5,8,8,5,5,5,8,5,14,5,5,
-5,5,5,5,5,8,5,5,32,50,86,127,179,242,255,255,255,255,255,255,
-229,203,140,103,40,14,5,5,5,5,5,5,5,8,5,5,5,5,5,8,
-5,5,8,5,8,5,14,77,148,212,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,139,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,26,85,
-161,212,255,255,255,255,255,255,255,255,255,211,157,77,14,14,5,5,5,5,
-5,5,5,5,5,14,5,5,5,14,5,5,5,5,8,5,14,5,5,8,
-8,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,14,5,5,5,8,5,8,8,8,8,5,5,5,5,5,8,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,40,148,220,255,
-255,255,255,255,203,67,5,5,5,5,5,8,5,5,5,5,8,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,8,5,8,5,14,22,32,50,50,
-50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,130,
-220,255,255,255,255,255,255,255,255,179,103,58,26,14,5,5,5,5,5,5,
-5,8,5,5,5,8,5,5,8,5,8,5,22,50,109,184,203,239,255,255,
-255,255,255,255,255,229,161,109,73,40,22,5,8,5,8,5,5,8,5,5,
-8,5,5,14,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,22,157,255,255,255,255,247,148,67,26,5,5,14,5,5,5,
-5,5,5,5,5,5,5,8,5,8,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,50,161,229,
-255,255,255,255,255,255,229,224,220,220,224,212,203,179,167,161,170,161,170,145,
-130,118,109,109,109,100,94,73,50,58,50,58,50,44,40,22,14,5,8,8,
-5,5,8,5,8,8,5,5,5,8,8,8,5,5,5,5,5,5,5,5,
-58,112,170,239,251,255,255,255,255,255,255,230,167,109,58,26,8,14,5,5,
-5,5,5,14,5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,77,
-148,220,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,139,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,14,5,8,26,58,148,242,255,255,255,255,255,255,255,
-255,255,239,148,67,35,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,14,8,8,5,5,5,8,8,5,5,5,
-8,8,8,5,5,5,8,5,5,5,14,5,8,5,5,5,8,8,5,5,
-5,8,8,5,8,5,5,5,8,8,14,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,14,5,40,140,230,255,255,255,255,255,203,67,5,8,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,14,5,5,5,8,
-5,14,5,5,8,8,5,22,40,73,100,118,118,118,118,118,118,118,118,118,
-118,118,118,118,118,118,118,118,118,118,118,175,239,255,255,255,255,255,255,255,
-255,203,140,94,50,26,5,8,8,5,5,5,5,8,5,8,5,8,5,8,
-5,8,5,8,8,14,35,67,118,175,229,255,255,255,255,255,255,255,242,211,
-157,100,50,8,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,
-255,255,255,148,58,26,5,8,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,40,109,157,179,193,193,193,193,175,148,140,
-140,148,140,139,118,112,109,94,94,94,94,82,58,58,50,50,50,50,35,17,
-17,17,17,17,5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,17,
-5,8,5,5,8,5,5,5,22,22,50,77,127,179,238,255,255,255,255,255,
-251,229,193,157,94,50,22,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,17,5,5,5,5,8,8,8,5,5,67,112,161,212,229,229,255,255,255,
-255,255,255,255,255,255,238,229,212,212,212,212,212,211,211,212,212,212,212,212,
-212,212,212,212,212,212,212,212,212,212,109,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,5,5,5,8,5,5,14,5,5,5,5,14,
-22,73,130,202,255,255,255,255,255,255,255,255,255,229,172,94,26,14,5,5,
-5,5,5,5,8,5,5,14,5,5,5,5,5,5,5,8,14,5,5,5,
-5,8,5,8,5,8,5,5,5,5,8,5,5,8,8,5,5,8,5,5,
-5,5,8,5,5,8,5,8,8,8,5,14,5,5,5,8,5,5,5,5,
-5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-40,149,229,255,255,255,255,255,211,67,5,5,5,5,5,5,5,8,5,5,
-5,8,5,14,5,8,5,5,5,5,5,8,5,8,5,14,5,8,5,22,
-73,118,157,193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,
-193,193,193,221,255,255,255,255,255,255,255,255,255,238,193,139,86,40,5,8,
-5,5,8,5,5,8,5,5,5,5,8,5,8,5,8,8,8,5,14,14,
-67,100,161,202,229,255,255,255,255,255,255,255,212,167,112,67,40,22,5,5,
-5,5,5,5,5,14,5,5,14,8,5,8,5,8,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,149,67,35,8,8,
-8,5,14,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,35,40,49,49,49,49,49,49,40,40,40,40,40,40,35,35,26,35,
-35,26,35,26,22,22,14,14,14,14,14,14,8,26,40,22,5,5,5,5,
-5,5,5,5,5,14,5,8,8,5,8,5,8,5,14,5,5,5,8,8,
-26,49,112,179,221,255,255,255,255,255,255,255,202,157,95,49,35,22,14,5,
-5,5,5,5,5,8,8,5,8,8,8,5,8,5,8,5,5,5,5,8,
-5,14,5,26,58,85,109,130,158,229,255,255,255,255,255,255,255,221,179,130,
-109,109,109,109,103,109,109,103,109,109,109,109,109,109,109,109,109,109,109,109,
-109,109,49,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,14,5,8,8,5,5,5,8,8,22,49,121,221,255,255,255,255,255,
-255,255,255,255,255,158,82,40,14,5,8,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,14,5,8,5,8,5,8,5,5,
-5,5,5,5,8,5,5,5,5,14,8,5,8,5,8,5,8,14,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,
-5,5,5,5,8,5,5,5,5,8,5,8,40,149,229,255,255,255,255,255,
-202,67,5,5,5,5,5,5,5,5,5,14,5,8,5,5,5,8,5,5,
-5,5,5,8,5,8,5,5,5,8,5,35,95,157,221,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,251,255,251,255,255,255,255,255,255,255,
-255,255,255,255,255,255,247,184,109,59,8,5,8,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,14,8,5,5,14,26,59,103,167,238,255,255,
-255,255,255,255,255,247,202,161,95,26,22,5,5,5,5,5,5,5,5,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,161,255,255,255,255,255,149,67,26,5,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,22,
-26,26,26,35,40,49,49,49,59,49,59,59,73,73,77,77,77,77,77,91,
-103,95,103,95,104,121,121,49,5,5,8,5,5,5,5,5,5,8,5,5,
-8,5,5,5,5,5,5,5,5,14,26,59,95,139,179,238,255,255,255,255,
-255,255,229,193,139,82,40,14,14,5,5,5,8,5,5,14,5,5,5,14,
-5,5,5,8,8,5,8,8,5,5,5,5,8,5,8,22,35,40,49,73,
-103,202,255,255,255,255,255,255,255,197,140,82,49,49,49,49,49,49,49,49,
-49,49,49,49,49,49,49,49,49,49,49,49,49,49,26,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,8,5,5,
-5,8,14,49,109,179,255,255,255,255,255,255,255,255,255,238,193,109,49,14,
-5,8,5,8,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,
-14,26,26,26,35,35,35,35,35,26,35,26,35,35,35,35,22,14,5,14,
-8,22,26,35,35,35,26,35,26,35,35,35,35,26,35,26,22,14,5,5,
-5,5,5,8,5,5,5,8,5,8,5,5,5,14,5,5,8,5,5,5,
-5,5,5,5,40,149,229,255,255,255,255,255,211,67,5,5,5,5,5,8,
-5,5,5,5,8,5,8,5,5,8,5,8,5,8,5,8,5,5,5,8,
-5,5,5,35,95,167,238,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,193,
-121,59,5,5,5,8,5,8,5,5,5,8,5,5,5,8,5,8,5,5,
-5,8,5,5,5,5,22,49,100,157,193,230,255,255,255,255,255,255,255,215,
-161,109,73,49,22,5,5,5,5,5,5,8,5,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,149,
-67,26,14,5,5,5,5,5,5,14,8,5,5,14,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,40,49,59,59,67,73,95,109,118,118,
-118,127,118,140,161,170,184,184,184,184,179,212,238,242,230,238,242,242,212,95,
-5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,14,5,5,5,5,
-5,5,59,118,179,242,255,255,255,255,255,255,255,221,149,82,49,26,14,5,
-8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,8,5,14,14,14,22,49,179,255,255,255,255,255,255,
-255,193,121,49,14,14,14,14,14,14,14,22,14,14,14,14,14,14,14,14,
-14,14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,5,8,5,5,5,5,8,14,91,181,238,255,255,
-255,255,255,255,255,255,255,181,100,49,8,14,5,8,8,5,5,5,5,5,
-8,5,8,5,5,5,5,5,5,5,5,5,26,59,67,67,67,67,67,59,
-67,67,67,59,67,59,67,59,40,22,8,14,35,49,59,67,67,67,67,67,
-67,59,67,67,67,67,59,59,40,26,8,14,5,5,5,8,8,8,5,8,
-5,8,5,8,5,5,8,5,8,5,8,5,5,5,8,5,49,149,230,255,
-255,255,255,255,202,67,5,5,5,5,5,5,5,14,5,5,5,5,5,14,
-5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,26,100,167,242,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,197,121,50,8,5,5,8,5,8,
-5,14,5,8,5,8,5,5,8,5,14,8,5,5,5,5,5,14,8,8,
-22,40,104,167,230,255,255,255,255,255,255,255,242,211,161,104,40,5,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,22,161,255,255,255,255,255,149,67,26,5,5,5,5,14,5,
-5,5,8,5,5,5,5,5,8,5,8,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,40,94,121,139,149,149,161,161,181,188,188,188,197,188,203,230,230,230,230,
-238,230,238,255,255,255,255,255,255,255,242,104,5,5,8,5,5,5,8,8,
-8,5,8,5,5,5,5,5,5,5,5,5,5,8,73,145,212,255,255,255,
-255,255,255,255,242,203,121,44,26,5,5,14,5,5,8,5,5,5,5,5,
-8,5,8,5,8,5,5,5,8,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,26,161,255,255,255,255,255,255,255,197,127,50,14,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,8,
-5,5,5,14,5,40,85,161,230,255,255,255,255,255,255,255,255,248,212,127,
-44,26,5,5,8,5,5,5,8,5,14,5,5,5,8,5,5,5,5,5,
-5,5,14,8,59,127,148,148,148,148,145,148,145,148,148,148,148,148,145,145,
-85,26,14,14,73,121,139,157,148,148,148,148,148,148,148,145,148,148,145,121,
-77,40,8,5,5,5,5,5,8,5,14,5,5,8,5,5,5,8,5,14,
-5,8,5,5,14,5,5,8,44,145,230,255,255,255,255,255,211,59,5,5,
-5,8,5,8,5,5,5,5,5,5,5,5,8,14,8,5,5,5,8,5,
-14,5,8,5,5,5,14,22,67,109,161,179,188,179,179,188,179,179,179,188,
-179,179,179,179,188,179,179,188,179,179,179,220,255,255,255,255,255,255,255,255,
-255,230,197,139,82,40,5,5,8,5,5,5,5,5,5,8,5,5,5,8,
-5,5,8,5,8,5,5,5,5,5,5,8,5,8,50,109,157,203,230,255,
-255,255,255,255,255,255,212,170,118,73,40,22,14,5,5,5,5,14,5,5,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,
-255,255,247,148,67,35,5,5,5,5,5,5,8,8,5,8,5,5,5,8,
-5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,59,157,211,238,248,248,247,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,238,104,5,5,5,5,5,8,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,14,22,91,157,220,255,255,255,255,255,255,255,247,197,113,40,
-22,5,5,5,5,5,5,5,5,14,8,5,14,5,5,5,5,5,5,5,
-8,5,8,8,5,8,5,5,8,5,5,5,8,5,5,5,31,145,238,255,
-255,255,255,255,255,230,158,58,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,8,8,5,5,5,5,14,14,91,179,230,
-255,255,255,255,255,255,255,255,255,203,131,64,14,14,8,5,5,5,5,8,
-8,5,5,5,8,5,14,5,5,5,5,8,8,5,5,5,94,230,255,247,
-255,247,248,255,255,247,248,255,247,255,248,247,131,40,22,31,131,211,230,255,
-247,247,247,247,255,247,247,255,255,248,255,197,118,58,22,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,8,5,5,5,5,5,
-40,148,220,255,255,255,255,255,203,64,5,5,5,5,8,8,8,5,5,5,
-5,5,5,8,5,8,5,8,5,5,5,5,5,8,5,8,5,5,5,5,
-22,31,40,49,40,49,49,40,49,49,49,40,49,49,49,49,40,49,49,49,
-49,49,49,127,220,247,255,255,255,255,255,255,255,179,94,49,22,14,8,5,
-5,5,5,8,8,8,5,8,5,5,5,5,5,8,5,8,5,5,5,5,
-14,5,5,14,5,5,14,26,58,94,158,230,255,255,255,255,255,255,255,255,
-212,167,94,40,22,5,5,5,5,8,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,158,255,255,255,255,255,148,64,26,5,5,
-5,8,5,5,5,5,8,5,8,5,5,8,8,5,5,5,5,8,5,5,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,64,161,230,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,94,5,5,5,5,
-5,5,5,8,5,14,5,5,5,8,5,5,5,5,5,5,8,14,58,104,
-145,203,230,255,255,255,255,255,255,230,167,113,82,50,26,5,8,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,14,5,8,8,5,5,5,14,
-5,8,5,5,5,5,5,5,22,131,212,255,255,255,255,255,255,242,179,73,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,8,35,64,139,224,255,255,255,255,255,255,255,255,255,
-238,149,64,40,5,5,14,5,5,5,8,5,8,5,5,5,5,5,5,5,
-8,14,8,5,5,5,14,26,121,248,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,127,26,22,32,161,247,255,255,255,255,255,255,255,255,255,255,
-255,255,255,215,104,49,14,5,5,8,5,5,14,5,5,8,5,5,8,5,
-8,8,8,5,5,14,5,5,5,5,8,5,49,149,224,255,255,255,255,255,
-203,64,5,8,14,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,104,211,248,255,255,
-255,255,255,255,255,161,64,32,5,5,8,5,5,14,8,8,5,5,8,5,
-8,5,5,5,8,5,8,5,5,5,5,5,5,5,5,8,5,5,5,14,
-22,49,131,197,247,255,255,255,255,255,255,255,255,203,118,58,22,5,8,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,161,255,255,255,255,255,149,64,26,5,5,5,5,5,5,8,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,58,170,233,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,238,103,5,14,5,5,5,14,8,5,5,8,8,5,
-5,5,5,5,5,8,5,5,5,5,14,26,58,103,179,248,255,255,255,255,
-255,255,247,221,161,109,49,5,8,5,8,5,5,8,5,5,5,5,5,5,
-5,5,5,8,5,8,5,5,5,8,5,5,5,5,8,5,14,5,5,5,
-22,103,179,238,255,255,255,255,255,255,203,77,5,8,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,58,
-139,197,255,255,255,255,255,255,255,255,255,224,175,103,22,8,5,5,8,5,
-5,8,14,8,5,5,5,5,8,5,5,5,5,5,5,5,8,5,26,58,
-140,255,255,255,255,255,255,255,255,255,255,255,255,255,255,233,118,5,22,40,
-179,255,255,255,255,255,255,255,255,255,255,255,255,255,255,202,82,22,8,5,
-5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,5,8,8,8,5,
-5,5,5,5,40,149,224,255,255,255,255,255,202,64,8,5,8,5,5,8,
-5,8,5,5,5,8,5,5,5,5,5,5,8,8,5,5,5,5,5,5,
-5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,104,215,247,255,255,255,255,255,255,255,161,64,35,
-5,5,5,5,5,5,5,5,8,5,5,8,8,5,5,14,5,8,5,5,
-5,5,8,5,8,8,5,8,5,5,5,5,8,22,94,179,233,255,255,255,
-255,255,255,255,255,233,148,82,35,5,5,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,22,157,255,255,255,255,255,148,
-64,26,5,8,5,14,8,5,5,5,8,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,64,167,233,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,248,255,255,255,255,248,247,233,197,82,
-5,5,5,5,5,5,14,5,5,14,5,8,5,5,5,5,5,5,8,5,
-5,5,8,5,26,49,103,161,194,238,255,255,255,255,255,255,221,184,130,82,
-46,22,14,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,14,
-8,5,5,5,8,5,5,5,5,5,14,5,22,82,140,221,255,255,255,255,
-255,255,221,103,35,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,5,5,8,8,26,49,104,194,238,255,255,255,255,255,255,
-255,255,248,175,103,49,5,5,5,5,5,5,8,5,8,5,8,5,8,5,
-5,5,8,8,5,5,5,5,5,5,22,40,94,161,179,179,175,179,179,175,
-179,179,175,179,179,179,161,148,73,5,14,35,104,179,179,175,179,179,175,179,
-175,179,175,179,179,179,179,130,40,14,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,40,148,224,255,
-255,255,255,255,203,67,5,5,5,5,5,5,8,5,8,5,14,5,8,5,
-5,14,5,5,5,8,5,14,5,5,5,14,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,104,
-203,242,255,255,255,255,255,255,255,157,67,26,5,5,5,8,5,5,5,5,
-8,5,5,8,8,5,5,5,5,5,5,5,5,8,14,8,5,14,5,5,
-5,5,22,35,67,104,161,211,242,255,255,255,255,255,255,233,194,161,104,58,
-22,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,22,161,255,255,255,255,248,148,67,26,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,67,167,233,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,248,221,215,221,221,215,215,194,179,139,58,5,5,5,5,5,5,5,8,
-8,5,5,5,5,5,5,5,5,5,5,5,5,14,5,8,14,14,26,26,
-104,179,224,255,255,255,255,255,255,255,221,179,104,40,22,5,5,5,5,5,
-8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,8,5,5,
-5,5,14,8,14,50,112,203,255,255,255,255,255,255,238,139,58,35,5,5,
-14,5,8,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,46,109,175,242,255,255,255,255,255,255,255,255,242,203,118,26,14,5,8,
-5,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,22,26,35,35,40,35,35,35,35,35,35,35,35,35,35,35,
-14,5,5,14,26,35,35,35,40,40,40,40,35,40,40,40,40,40,40,26,
-8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,5,8,5,40,148,224,255,255,255,255,255,203,67,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,8,8,14,5,8,5,5,
-5,5,5,5,5,8,8,5,5,14,5,5,5,5,5,5,5,5,5,5,
-14,5,8,5,8,5,8,5,5,5,5,103,211,242,255,255,255,255,255,255,
-255,161,58,35,8,5,14,8,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,5,5,5,5,5,5,5,35,68,157,221,242,255,
-255,255,255,255,255,255,230,179,109,58,35,14,14,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,
-255,255,255,148,58,35,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,50,139,188,212,224,212,203,
-203,203,197,197,203,197,188,179,175,175,179,175,175,157,131,131,131,131,131,131,
-112,103,77,26,8,5,5,5,8,5,8,5,8,5,5,8,5,5,14,5,
-5,5,5,8,5,8,5,8,5,5,5,5,58,103,149,197,224,255,255,255,
-255,255,255,230,179,131,82,50,26,8,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,8,5,5,14,5,5,5,14,8,14,5,8,32,68,188,
-255,255,255,255,255,255,248,179,103,40,5,5,5,5,5,5,8,5,5,8,
-5,5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,22,32,94,161,230,255,255,255,255,
-255,255,255,255,255,197,131,67,5,8,5,5,5,5,5,8,5,5,5,5,
-5,8,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,8,5,8,5,5,5,5,8,8,5,5,8,14,5,
-40,149,230,255,255,255,255,255,203,67,5,5,8,5,5,5,5,5,5,8,
-5,5,5,14,5,8,5,5,5,8,5,5,8,5,5,5,8,5,5,14,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
-8,5,8,103,211,247,255,255,255,255,255,255,255,161,67,32,8,5,5,5,
-5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,14,8,40,68,113,157,211,255,255,255,255,255,255,255,230,194,149,104,
-58,26,17,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,149,67,26,5,5,
-17,5,5,5,5,5,5,17,5,17,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,40,94,127,149,149,131,118,103,94,103,103,94,82,67,50,
-40,40,32,32,32,26,26,26,32,26,26,26,26,22,17,17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,5,8,5,5,
-5,8,5,5,8,26,58,94,167,238,255,255,255,255,255,255,255,230,167,103,
-50,22,17,5,5,5,5,8,8,17,8,8,5,5,5,8,5,5,5,5,
-5,5,8,5,5,5,5,8,5,17,40,161,255,255,255,255,255,255,255,220,
-157,50,5,5,5,5,5,5,5,5,5,17,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,31,73,139,233,255,255,255,255,255,255,255,255,255,233,145,46,22,
-17,5,8,8,5,5,5,5,5,5,5,5,5,5,5,8,5,8,8,17,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-8,5,8,8,5,5,17,8,5,5,8,5,40,149,220,255,255,255,255,255,
-203,67,17,5,8,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,8,5,5,5,8,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,103,211,242,255,255,
-255,255,255,255,255,161,67,32,5,5,5,5,8,5,5,5,5,8,8,5,
-5,8,5,5,5,5,5,8,8,5,5,5,5,5,8,17,103,157,211,255,
-255,255,255,255,255,255,255,242,161,103,53,31,22,8,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,161,255,255,255,255,255,149,58,32,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,17,5,5,5,5,5,5,5,5,5,5,8,5,17,22,58,73,
-82,77,73,67,40,46,46,46,46,40,31,17,5,22,32,32,32,32,40,46,
-53,58,67,67,67,67,67,73,82,94,73,53,22,17,5,8,17,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,22,46,
-94,145,194,233,255,255,255,255,255,255,220,179,131,82,53,31,8,5,8,17,
-5,5,5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,5,8,5,
-8,5,22,109,188,247,255,255,255,255,255,248,188,94,32,17,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,17,22,58,131,194,255,255,
-255,255,255,255,255,255,255,220,167,103,22,8,5,5,17,5,5,5,5,5,
-5,5,8,17,5,5,8,8,8,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,8,5,
-5,5,5,5,40,149,224,255,255,255,255,255,203,67,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,17,5,5,
-5,5,5,5,5,8,5,5,5,5,8,5,5,5,8,5,5,5,5,5,
-5,8,5,17,5,5,5,109,224,255,255,255,255,255,255,255,255,154,67,31,
-8,5,5,5,5,5,5,8,5,5,17,5,5,5,5,5,8,5,5,5,
-5,5,17,5,22,40,73,112,158,220,247,255,255,255,255,255,255,233,194,154,
-103,46,22,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,17,158,255,255,255,255,255,149,
-67,31,5,5,5,5,5,5,5,5,8,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,17,8,17,31,17,17,17,17,17,17,8,
-17,17,5,17,5,32,73,67,73,67,77,94,118,118,131,131,127,131,139,158,
-179,188,158,94,46,22,5,5,5,5,17,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,17,22,40,103,167,239,255,255,255,
-255,255,255,255,224,175,109,58,22,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,8,5,8,5,17,5,5,5,17,31,58,112,212,255,255,
-255,255,255,255,224,127,64,31,5,8,5,5,5,5,5,8,5,17,5,5,
-5,8,17,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,22,46,112,203,255,255,255,255,255,255,255,255,255,255,184,
-77,40,17,5,5,5,5,8,5,17,5,5,5,8,5,5,5,5,5,5,
-5,8,5,5,5,17,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,5,5,5,8,8,5,8,40,149,224,255,
-255,255,255,255,203,64,8,5,5,5,5,5,5,5,5,5,5,5,8,8,
-8,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,8,5,5,
-5,5,5,8,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,118,
-239,255,255,255,255,255,255,255,255,149,64,31,5,5,5,8,8,5,5,5,
-5,5,8,5,5,5,5,17,5,5,5,5,5,5,5,5,40,82,149,220,
-248,255,255,255,255,255,255,255,224,179,95,40,26,17,8,5,5,5,17,5,
-17,8,8,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,22,158,255,255,255,255,255,149,58,32,5,5,5,5,8,5,
-8,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,8,5,22,40,50,
-58,64,64,82,95,86,95,95,82,95,95,109,118,118,118,118,118,139,161,154,
-161,161,161,175,188,194,194,194,203,194,203,220,233,233,211,112,46,22,5,8,
-5,8,8,8,5,5,5,5,5,5,8,5,5,5,5,5,5,5,14,5,
-5,5,5,5,5,14,50,95,140,188,220,247,248,255,255,247,233,203,149,109,
-64,32,14,5,5,5,5,14,5,5,8,5,5,5,5,5,14,5,5,5,
-5,8,5,5,5,14,8,32,73,175,247,255,255,255,255,255,255,188,118,50,
-14,5,5,5,5,5,5,14,5,5,5,5,14,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,22,58,112,184,
-247,255,255,255,255,255,255,255,255,233,179,113,40,22,5,5,5,8,14,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,14,8,5,8,5,
-5,5,5,5,14,5,8,5,40,140,224,255,255,255,255,255,203,64,5,5,
-5,8,5,5,5,14,5,5,8,8,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,
-5,5,14,5,8,8,5,5,5,26,49,149,255,255,255,255,255,255,255,255,
-255,161,64,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,14,5,14,14,40,82,118,167,211,255,255,255,255,255,255,255,224,194,
-140,104,49,14,14,5,5,5,14,5,5,14,5,5,14,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,22,161,255,255,
-255,255,255,140,64,26,14,5,14,5,5,5,5,14,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,14,5,5,26,77,104,127,139,140,161,184,194,194,188,
-194,202,202,224,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,233,127,58,26,5,5,13,13,5,5,13,5,5,5,
-5,13,5,5,13,5,5,5,5,5,5,13,5,5,5,5,5,5,13,22,
-49,77,154,202,211,212,212,212,212,211,194,170,109,64,22,5,5,5,5,5,
-5,5,5,8,5,5,8,8,5,8,5,8,13,5,5,13,5,5,5,8,
-40,121,202,255,255,255,255,255,255,255,188,64,13,13,8,5,5,5,5,8,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,13,26,91,194,255,255,255,255,255,255,255,255,255,
-255,188,91,49,13,5,5,5,8,5,8,8,5,5,5,5,5,5,5,13,
-5,8,8,8,5,8,5,5,8,5,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,13,8,5,5,5,5,8,5,8,5,5,5,5,5,5,8,
-49,148,224,255,255,255,255,255,202,64,5,5,5,8,5,5,5,5,5,5,
-13,5,5,13,5,5,5,5,8,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,8,13,8,5,5,13,5,5,
-5,49,103,179,255,255,255,255,255,255,255,255,255,154,64,32,5,5,5,8,
-8,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,13,13,95,167,
-220,255,255,255,255,255,255,255,255,242,163,104,59,13,13,13,5,5,5,5,
-5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,163,255,255,255,255,255,163,95,49,40,32,
-32,32,40,32,40,32,40,32,32,40,32,32,32,32,32,32,32,32,32,32,
-32,32,40,32,32,32,40,32,32,22,22,5,5,5,5,5,5,5,5,8,
-5,40,104,163,188,202,211,220,233,242,242,242,238,242,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,131,
-59,26,5,5,13,5,5,8,5,5,13,5,8,5,5,8,5,5,5,8,
-5,5,8,8,5,5,5,8,5,13,5,5,22,40,82,113,121,131,125,131,
-131,125,131,103,73,40,13,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,8,5,5,5,5,5,5,5,26,77,139,211,255,255,255,255,
-255,255,224,140,82,32,14,5,5,5,8,5,5,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,40,
-103,154,238,255,255,255,255,255,255,255,255,242,203,131,49,26,5,5,5,5,
-5,8,8,5,5,5,5,5,5,5,5,5,5,8,5,8,5,14,5,5,
-5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,14,
-26,49,64,64,64,64,59,64,64,64,64,64,103,175,230,255,255,255,255,255,
-220,109,64,59,64,64,64,64,64,64,64,64,49,40,22,5,8,5,5,5,
-5,5,5,5,5,5,5,8,5,8,5,14,5,5,5,5,8,5,5,5,
-5,5,5,8,14,5,8,5,8,5,5,14,14,82,161,220,255,255,255,255,
-255,255,255,255,255,148,59,26,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,8,5,14,22,49,77,113,161,220,255,255,255,255,255,255,255,230,
-179,140,95,50,26,5,8,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,154,255,255,255,255,255,179,109,95,64,64,73,64,64,64,64,77,64,64,
-64,64,73,64,64,64,64,73,64,64,64,73,64,64,64,64,64,64,64,64,
-59,50,26,8,5,5,5,5,5,5,5,5,5,50,161,220,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,238,139,59,22,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,8,14,8,
-5,5,5,5,5,5,14,26,22,22,22,14,14,22,22,22,8,5,5,5,
-8,8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,8,8,
-5,5,5,5,14,22,64,167,242,255,255,255,255,255,255,230,161,59,14,8,
-5,8,8,5,5,8,5,5,5,5,5,8,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,64,161,233,255,255,255,255,255,255,
-255,255,255,220,139,73,14,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,14,5,5,5,8,5,5,8,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,8,5,8,5,5,22,40,95,125,125,131,131,139,131,
-131,131,131,131,148,203,242,255,255,255,255,255,238,167,131,131,131,131,131,131,
-131,131,131,131,109,73,40,14,8,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,8,5,8,
-8,8,5,8,14,113,230,255,255,255,255,255,255,255,255,255,255,139,49,26,
-5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,14,8,5,40,91,
-161,230,255,255,255,255,255,255,255,255,220,161,95,32,22,14,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,220,
-188,175,161,175,161,161,167,167,167,161,175,161,167,161,167,161,167,167,161,167,
-161,167,161,167,161,167,161,167,161,167,161,161,140,113,49,8,5,8,5,5,
-8,5,14,5,5,49,161,224,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,238,131,64,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-35,64,64,64,64,64,64,64,64,73,64,64,64,64,64,64,64,64,64,64,
-64,64,64,64,64,64,64,64,64,59,40,26,8,5,8,5,5,5,5,14,
-5,5,8,5,5,5,5,14,5,5,5,5,14,5,5,5,5,22,40,95,
-161,224,255,255,255,255,255,255,212,148,91,40,22,14,5,5,5,8,5,8,
-14,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,59,118,211,255,255,255,255,255,255,255,255,255,224,161,82,40,14,5,
-5,5,5,5,5,5,5,14,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,35,59,136,203,203,203,203,203,203,203,203,203,203,211,242,255,255,
-255,255,255,255,255,212,203,203,203,203,203,203,197,203,203,203,161,109,59,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-5,5,8,14,5,8,5,5,5,8,5,5,5,14,22,59,109,184,255,255,
-255,255,255,255,255,255,255,255,242,118,26,14,5,5,14,5,5,5,5,8,
-14,5,5,5,5,5,5,5,14,14,40,82,131,175,179,188,188,188,188,188,
-188,175,136,95,59,14,14,5,8,8,5,8,5,14,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,8,22,161,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,224,188,95,8,8,5,5,5,5,5,5,8,8,49,161,224,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,131,59,26,5,5,
-5,14,5,5,5,5,5,5,5,8,5,5,59,131,131,131,131,136,136,131,
-136,131,131,136,131,131,131,136,136,131,140,131,131,136,131,131,131,131,136,131,
-136,118,86,49,22,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,8,14,8,8,5,14,26,73,175,242,255,255,255,255,255,
-255,242,179,86,40,14,5,5,5,5,8,8,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,35,95,175,238,255,255,255,
-255,255,255,255,255,230,161,95,26,8,5,8,8,5,5,14,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,8,14,5,8,8,5,5,5,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,35,76,179,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,212,140,82,14,5,5,8,5,8,5,5,5,
-5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-8,5,5,5,5,22,35,118,203,242,255,255,255,255,255,255,255,255,255,255,
-230,109,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-14,14,40,73,82,82,95,82,86,86,82,82,82,73,40,14,8,8,8,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,22,161,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,197,95,5,
-8,8,5,14,5,8,5,8,5,59,161,230,255,255,255,255,255,255,255,255,
-255,255,255,242,242,242,242,238,220,220,220,212,220,212,203,203,188,188,188,188,
-179,175,161,161,161,161,136,76,40,14,5,5,5,5,5,5,5,8,5,5,
-5,5,14,5,86,197,203,211,203,203,203,203,203,203,211,203,203,203,203,203,
-203,203,203,211,203,203,203,203,203,203,203,203,203,175,118,73,22,5,5,5,
-5,8,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,14,
-5,5,5,8,40,95,154,197,238,255,255,255,255,255,230,175,131,100,64,35,
-22,14,8,5,5,5,5,5,8,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,35,109,175,242,255,255,255,255,255,255,255,242,179,100,50,
-14,5,5,5,14,5,14,14,5,5,5,5,5,14,5,14,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,40,76,184,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-220,140,82,5,5,5,5,13,5,13,5,5,5,13,5,5,5,5,5,13,
-26,44,59,64,64,64,64,64,73,64,73,64,64,64,64,77,95,109,140,188,
-248,255,255,255,255,255,255,255,255,255,255,229,170,82,5,13,5,5,5,13,
-5,5,5,13,13,5,5,5,5,5,5,5,5,13,26,35,40,44,40,40,
-40,44,44,40,40,26,22,5,13,5,5,5,13,5,5,5,5,5,5,13,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,161,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,238,194,95,5,5,5,13,5,13,5,5,5,
-5,50,161,229,255,255,255,255,255,255,255,255,242,229,220,212,212,212,212,179,
-161,149,149,149,149,136,131,109,85,85,85,85,85,44,35,26,13,13,13,13,
-5,5,13,5,5,5,5,5,5,5,5,5,5,5,5,5,118,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,238,161,100,35,5,5,5,13,5,13,5,5,5,5,5,
-13,5,13,13,5,5,5,5,5,5,5,5,5,5,5,5,5,13,40,131,
-194,255,255,255,255,255,255,255,233,184,127,67,35,13,5,5,5,5,13,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,100,170,
-248,255,255,255,255,255,255,247,194,113,41,13,13,5,13,5,5,5,13,5,
-13,13,5,5,5,13,5,5,13,5,5,5,5,13,5,5,5,5,5,13,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,41,
-76,184,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,220,161,85,13,5,13,5,13,
-13,5,5,5,13,5,5,5,5,5,5,22,50,85,118,136,136,136,136,136,
-136,136,136,145,131,145,136,154,179,212,255,255,255,255,255,255,255,255,255,255,
-255,255,255,194,118,58,5,5,13,13,5,5,5,13,5,5,5,5,5,13,
-5,13,5,5,5,5,5,5,13,5,13,5,13,5,13,5,13,5,13,13,
-5,5,5,5,5,13,5,13,13,13,13,5,5,5,5,5,5,5,5,5,
-5,5,5,5,13,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-22,145,248,248,247,247,247,247,247,255,248,247,248,247,248,248,248,247,248,247,
-255,247,247,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,247,248,
-212,172,82,5,13,5,5,5,5,13,5,5,5,41,109,149,167,172,161,157,
-149,149,161,145,127,121,121,121,121,121,121,109,76,82,76,82,82,76,67,50,
-41,50,41,41,41,31,13,5,5,5,5,5,5,5,13,5,5,5,13,5,
-5,5,5,5,5,5,5,5,109,229,248,247,248,248,247,247,247,247,247,248,
-248,248,247,255,248,248,247,248,247,248,248,248,247,248,247,247,247,212,149,82,
-31,5,5,13,13,5,5,13,5,5,5,5,5,5,13,5,13,5,5,5,
-5,5,5,5,5,5,5,5,13,5,31,67,109,149,193,220,247,255,255,255,
-255,229,203,167,145,121,109,100,82,73,67,67,59,41,22,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,35,109,179,247,255,255,255,255,255,255,247,
-203,158,109,95,109,109,100,100,100,100,100,100,109,95,109,95,100,95,100,100,
-100,100,95,41,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,8,5,41,67,158,255,247,247,248,248,248,
-247,255,255,247,248,247,247,248,248,248,248,247,247,247,248,247,248,247,255,247,
-248,248,248,248,197,131,67,13,5,5,5,8,5,5,5,8,5,5,8,5,
-5,13,5,22,82,131,179,203,203,203,203,211,203,203,211,203,203,203,203,212,
-229,255,255,255,255,255,255,255,255,255,255,255,255,247,212,139,67,31,5,5,
-8,5,5,5,5,8,13,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,22,121,212,212,212,212,220,212,
-212,212,212,212,212,212,212,212,212,212,212,212,212,212,211,212,212,212,212,212,
-212,212,212,212,212,212,212,212,212,212,212,212,184,149,76,5,13,13,5,5,
-5,5,5,13,8,31,41,67,67,50,31,13,13,13,13,13,22,8,13,8,
-8,13,8,13,5,13,5,13,5,13,5,13,5,5,13,5,13,5,5,5,
-5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,
-95,203,212,212,220,212,212,212,212,212,212,211,212,212,212,211,212,212,212,212,
-212,212,212,212,212,212,211,220,212,179,131,82,31,5,8,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,13,5,5,5,5,5,5,13,5,
-5,8,5,8,22,41,82,149,211,255,255,255,255,255,255,255,255,238,212,193,
-161,140,139,139,109,76,41,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,31,109,170,247,255,255,255,255,255,255,255,220,211,203,211,203,203,203,203,
-203,203,203,203,197,203,203,203,211,203,203,203,203,203,179,82,5,5,5,5,
-5,14,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,5,8,35,67,140,211,212,212,212,211,220,212,211,212,212,212,212,212,212,
-212,212,212,212,212,212,212,212,212,212,212,212,212,211,212,212,167,118,67,5,
-5,5,5,5,8,5,8,14,5,5,5,5,5,8,5,35,95,167,229,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,212,154,77,5,14,5,5,5,5,14,5,5,5,5,5,
-5,5,5,5,8,8,8,8,8,5,5,5,5,5,5,5,5,8,5,5,
-5,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,67,113,113,113,118,109,118,118,118,118,113,113,118,109,113,
-113,113,118,118,118,113,118,113,113,113,113,113,113,113,113,113,113,113,113,113,
-113,113,113,113,109,82,35,5,5,8,8,5,5,5,5,5,5,14,22,35,
-35,31,14,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,50,109,113,113,118,113,118,118,
-118,118,113,118,113,113,113,113,113,113,118,113,113,118,118,113,118,113,118,113,
-113,103,67,41,14,5,5,5,5,5,5,14,5,5,5,5,5,5,8,5,
-5,5,5,5,8,8,5,8,5,5,8,5,8,5,14,5,14,22,41,82,
-118,154,179,193,215,224,230,255,247,224,215,203,193,179,161,148,109,73,41,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,41,103,179,242,255,255,255,
-255,255,255,255,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,242,
-242,242,242,242,242,242,215,95,5,5,5,5,5,5,8,5,8,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,8,8,14,8,5,5,14,22,35,77,113,113,
-118,113,113,113,113,118,113,118,113,118,109,118,118,118,118,113,118,113,118,113,
-118,118,118,118,118,118,113,118,103,67,35,14,5,5,8,5,5,5,5,5,
-5,5,5,5,8,8,5,31,103,167,242,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,238,215,193,139,77,35,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,
-8,5,5,5,8,5,5,8,8,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,14,8,5,5,5,8,5,5,8,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,14,8,14,5,14,5,14,5,14,8,14,8,14,5,14,5,14,8,14,
-8,8,8,8,8,14,8,8,14,8,8,8,8,8,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,8,5,5,14,5,14,14,5,14,14,8,14,8,5,14,5,14,5,14,
-14,5,14,14,8,14,8,14,5,14,8,14,8,14,5,5,5,5,5,5,
-5,5,8,5,5,5,14,5,5,8,8,8,5,5,5,5,5,5,8,5,
-5,5,8,5,5,5,5,5,5,8,8,14,22,41,67,103,131,170,193,211,
-211,215,215,215,215,211,193,154,118,82,41,5,5,5,5,8,8,8,8,8,
-5,5,5,5,5,35,109,170,242,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,109,
-5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,8,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,8,5,5,8,8,8,5,5,14,14,5,14,5,14,5,14,14,5,
-14,5,14,8,14,8,8,8,14,8,8,8,8,8,8,8,14,14,8,14,
-5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,14,14,5,31,
-103,170,238,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,238,193,140,103,50,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,8,5,5,8,5,
-5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,8,8,5,5,
-5,5,14,5,5,8,8,8,14,5,5,5,5,5,5,5,5,5,8,8,
-5,5,8,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,8,8,5,
-5,5,5,5,5,5,8,5,14,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,14,22,41,58,73,95,103,109,109,113,113,113,109,113,95,82,
-64,41,22,8,8,5,14,5,5,8,5,5,5,5,5,5,14,14,64,91,
-127,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,
-148,148,148,148,148,148,148,148,148,140,131,58,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,5,5,8,5,8,5,8,5,5,5,5,5,14,5,8,8,8,
-8,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,5,5,
-8,5,5,5,5,5,5,5,5,14,5,22,50,95,127,148,148,148,148,148,
-148,148,148,148,148,148,148,140,148,148,140,148,148,140,148,148,148,131,109,77,
-46,31,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,8,5,5,8,5,5,5,8,8,5,8,
-5,8,5,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,
-14,5,5,5,5,8,8,5,5,5,5,5,5,5,8,5,5,5,5,14,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,
-5,5,5,5,5,14,8,5,5,5,8,5,8,5,8,5,5,5,8,14,
-14,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,8,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,14,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,14,8,5,5,8,5,5,14,5,8,8,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,14,5,14,8,5,14,5,14,
-8,8,14,8,14,8,8,5,14,8,5,14,5,14,5,14,5,14,5,5,
-5,14,8,5,8,5,5,8,8,8,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,8,5,8,14,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,8,8,14,5,
-5,5,14,5,14,5,5,5,8,5,5,5,8,5,8,5,5,5,5,5,
-5,5,5,14,8,5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,
-5,8,5,5,5,8,8,14,8,5,5,5,5,5,8,8,5,5,8,5,
-5,5,5,5,8,14,8,8,5,14,8,5,8,8,5,8,5,8,5,14,
-5,5,5,8,14,8,5,14,8,5,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,
-5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,8,8,5,5,5,
-5,5,5,5,5,14,5,5,5,5,8,5,5,8,5,8,8,5,5,5,
-8,8,14,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,8,5,5,5,8,8,8,8,14,8,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,8,5,8,5,5,14,5,14,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,5,
-5,8,5,14,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,8,14,5,5,5,14,5,5,5,5,8,5,5,5,
-5,5,5,5,5,8,5,8,5,8,5,8,5,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,
-5,5,14,5,5,8,5,8,8,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,14,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,5,5,5,5,5,8,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,8,5,5,14,5,5,5,5,5,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,
-5,5,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,14,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,5,5,5,5,8,
-8,5,5,5,14,5,5,5,5,5,5,5,5,8,5,5,5,5,8,8,
-5,5,8,5,5,5,14,5,5,5,14,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,8,5,5,5,8,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,14,5,5,5,8,8,5,5,5,5,5,5,8,5,
-8,14,5,5,5,5,5,14,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,8,5,8,8,8,5,5,8,
-5,5,5,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,8,5,5,8,5,8,5,5,8,8,5,5,
-14,14,5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,8,8,14,
-8,8,5,5,8,8,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-8,14,5,5,5,8,8,5,5,8,5,5,5,8,8,5,8,5,5,5,
-8,8,14,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,5,5,14,5,14,8,14,5,5,8,8,5,
-5,5,5,14,5,5,5,5,5,5,5,5,5,8,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,8,
-5,5,5,5,5,5,5,5,8,5,14,5,5,5,5,5,5,5,8,5,
-5,5,5,5,8,8,8,5,5,5,5,14,5,8,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,14,8,5,5,5,5,5,14,8,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,14,5,8,5,
-8,5,5,14,5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,8,5,5,5,5,5,8,8,5,5,5,5,5,5,14,5,5,5,
-14,5,14,8,5,5,5,8,5,8,5,14,5,5,5,5,5,5,5,5,
-14,8,5,5,5,5,5,5,5,8,8,5,5,5,5,8,8,5,5,5,
-5,5,5,5,5,5,8,8,8,5,5,5,5,5,5,5,8,5,8,8,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,14,5,8,31,46,64,
-77,73,82,77,77,77,77,82,58,22,22,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,22,41,50,73,82,77,73,77,77,77,41,5,5,5,5,8,5,5,
-8,5,5,5,5,5,5,22,41,58,64,77,77,77,77,64,58,35,14,8,
-5,8,5,5,5,5,5,8,8,5,5,5,14,14,22,58,77,77,77,77,
-77,77,77,77,77,77,77,77,77,77,77,73,77,77,77,77,77,77,77,77,
-77,77,77,77,77,77,77,77,73,82,58,41,22,5,5,5,8,5,5,8,
-5,14,5,14,5,8,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,8,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,41,58,64,82,77,77,82,77,77,77,73,50,22,5,5,8,
-5,5,5,5,5,5,8,5,5,5,5,8,14,35,64,64,82,77,77,77,
-64,41,22,8,5,5,5,5,5,5,31,58,77,77,77,77,77,77,50,14,
-5,5,5,5,8,5,5,5,8,8,5,5,14,5,5,5,5,5,5,5,
-5,5,5,22,58,77,77,77,73,82,73,58,22,5,5,5,5,5,5,5,
-5,41,77,77,77,77,73,46,22,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,14,5,8,
-5,5,5,8,5,8,5,5,5,5,5,14,5,14,41,58,73,77,77,77,
-77,64,31,5,8,8,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-8,5,8,5,14,8,5,8,5,5,5,5,5,5,8,22,35,41,41,46,
-41,41,41,41,22,14,5,5,5,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-8,5,8,5,5,5,5,5,14,46,77,131,140,140,140,140,148,148,140,140,
-109,41,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,8,8,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,5,35,64,103,140,140,140,
-148,140,148,140,73,5,5,5,5,5,5,8,5,5,8,5,5,5,8,35,
-64,109,127,140,140,140,140,131,109,58,31,8,5,5,5,5,5,5,8,5,
-8,8,5,5,5,31,46,103,140,140,140,148,140,140,140,140,140,140,140,140,
-140,140,148,140,140,140,140,140,140,140,140,140,140,140,140,140,140,148,140,148,
-140,140,109,73,41,5,5,5,14,5,5,5,5,5,5,8,14,5,8,5,
-8,14,5,8,5,14,8,8,14,8,14,5,14,5,5,14,8,5,5,14,
-8,5,5,8,5,8,5,8,5,5,8,14,8,8,5,5,5,5,8,8,
-5,5,5,14,5,5,5,14,14,5,5,5,8,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,64,109,131,140,
-140,140,140,140,140,148,140,95,22,5,8,5,8,8,5,5,5,5,14,8,
-14,5,5,5,14,64,113,127,140,140,140,148,118,73,35,22,8,5,5,5,
-5,5,46,118,140,140,140,140,140,140,82,14,5,5,5,8,8,5,5,5,
-5,8,8,5,8,5,5,5,5,5,5,5,5,5,5,41,103,148,140,140,
-148,140,140,103,31,8,5,5,5,14,5,5,8,77,140,140,140,140,140,82,
-41,22,5,8,14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,8,5,5,5,5,8,5,5,5,5,8,5,8,5,8,
-8,5,5,14,14,14,73,113,127,140,140,148,140,113,46,5,5,14,5,5,
-5,8,5,5,5,5,5,14,8,8,5,5,8,8,5,5,5,5,8,8,
-5,8,14,5,5,5,14,41,58,64,82,82,82,82,73,64,46,22,5,5,
-5,5,5,5,5,5,14,5,5,5,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,
-14,14,91,184,212,212,212,212,212,212,212,212,148,82,41,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,8,5,8,8,5,5,5,5,5,
-5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,5,50,109,154,203,212,211,212,212,211,211,109,5,5,8,
-5,8,5,5,5,5,5,5,5,5,8,41,127,179,203,212,212,211,211,172,
-109,64,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,41,64,148,
-211,212,212,212,212,211,211,212,212,212,212,212,212,212,211,211,211,212,211,211,
-212,211,212,212,212,212,220,212,212,211,212,211,212,212,161,103,50,5,5,5,
-5,5,5,5,5,5,8,26,82,112,112,112,112,112,112,112,112,112,112,112,
-112,112,112,109,112,109,112,112,109,118,112,109,112,118,109,112,112,112,112,112,
-112,112,112,112,109,77,46,26,5,5,8,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,35,94,139,188,212,211,212,212,211,212,211,212,140,
-35,5,5,5,5,5,8,5,5,5,14,5,5,5,5,8,22,103,172,194,
-212,212,211,212,188,109,46,22,5,5,5,5,5,5,73,172,212,220,211,220,
-212,212,131,22,5,8,8,8,5,5,5,5,8,8,5,5,5,5,8,8,
-5,5,5,5,5,14,5,50,154,212,212,212,211,212,212,140,41,5,5,5,
-5,8,5,5,5,94,203,212,211,211,211,131,58,26,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,14,5,8,5,5,5,5,5,5,8,5,5,26,109,179,
-194,212,212,203,188,140,46,5,5,5,5,5,8,5,5,8,5,14,8,5,
-5,5,5,8,5,5,5,5,5,5,8,5,5,5,5,5,5,5,22,103,
-140,167,179,179,179,179,167,148,103,41,5,5,5,5,14,5,8,5,8,5,
-8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,5,5,8,5,5,5,5,5,5,8,5,103,239,255,255,255,255,
-255,255,255,255,203,118,64,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,8,5,5,5,14,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,58,131,
-203,255,255,255,255,255,255,255,131,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,64,184,255,255,255,255,255,255,212,127,58,22,5,5,8,8,5,
-8,5,5,5,5,5,5,5,14,46,86,188,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,203,140,64,8,5,5,5,5,5,5,8,5,5,41,
-154,212,212,212,212,212,212,212,220,212,220,212,212,212,212,212,212,211,220,212,
-211,212,212,212,211,212,212,212,212,211,212,211,211,212,212,212,194,140,94,41,
-5,5,5,8,8,5,5,5,5,5,14,5,14,8,14,8,14,8,14,8,
-8,14,14,8,8,8,14,5,14,14,5,14,14,5,14,5,14,5,14,35,
-103,172,247,255,255,255,255,255,255,255,255,184,41,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,121,212,255,255,255,255,255,247,139,64,26,
-8,5,5,5,5,5,94,229,255,255,255,255,255,255,172,35,5,8,5,8,
-5,5,8,5,8,5,5,5,5,8,8,5,5,5,5,5,14,8,8,64,
-211,255,255,255,255,255,255,194,50,5,5,5,8,5,5,5,5,127,255,255,
-255,255,255,172,64,41,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,5,14,14,14,8,14,14,14,8,14,8,14,
-8,14,8,14,8,14,8,14,8,41,140,233,255,255,255,255,233,172,73,14,
-8,14,5,5,5,8,14,5,5,5,8,5,5,5,5,5,5,5,5,5,
-14,5,5,14,5,14,8,8,14,8,40,139,229,255,255,255,255,255,255,229,
-161,58,8,14,14,5,8,14,8,8,5,8,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,8,5,5,5,82,194,255,255,255,255,255,255,255,255,220,154,77,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,14,5,5,5,5,14,5,5,5,5,5,8,5,5,
-5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,64,130,194,255,255,255,255,255,255,255,
-139,5,5,8,5,8,5,14,5,5,5,5,5,22,35,82,202,255,255,255,
-255,255,255,202,82,35,14,5,8,5,14,5,5,5,5,5,8,5,14,5,
-5,40,82,194,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,211,136,
-64,5,5,5,5,5,5,5,5,5,14,50,172,255,247,247,255,248,248,247,
-248,247,248,248,247,248,247,248,247,247,248,247,255,248,248,255,248,247,248,248,
-248,247,248,248,255,247,247,255,229,167,104,40,5,5,8,5,14,8,5,5,
-5,5,50,94,118,112,118,112,112,112,112,112,118,112,112,118,112,118,112,118,
-112,112,112,112,112,118,112,118,112,118,112,130,172,212,255,255,255,255,255,255,
-255,255,255,185,49,5,8,5,5,5,5,8,8,8,8,5,5,5,5,5,
-22,130,220,255,255,255,255,255,247,136,58,26,5,5,5,5,5,5,82,229,
-255,255,255,255,255,255,172,35,5,5,5,5,5,5,5,5,8,14,5,8,
-5,5,5,8,8,8,5,5,8,5,8,64,203,255,255,255,255,255,255,193,
-49,5,8,5,5,8,5,8,5,131,255,255,255,255,255,167,73,40,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,64,
-104,140,149,149,157,149,149,149,149,149,149,161,149,149,149,157,149,157,149,149,
-157,161,212,255,255,255,255,255,255,224,179,140,121,85,32,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,8,5,8,26,49,64,77,77,85,77,
-77,77,94,179,239,255,255,255,255,255,255,242,193,112,85,85,77,77,85,77,
-73,64,40,14,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,8,5,5,5,8,5,8,8,5,5,5,64,157,
-220,255,255,255,255,255,255,255,229,179,95,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,
-5,14,8,14,8,14,22,8,14,8,14,8,22,8,14,8,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,58,127,193,255,255,255,255,255,255,255,139,5,5,8,5,5,5,5,
-5,5,8,5,5,22,58,121,224,255,255,255,255,255,255,185,49,5,5,5,
-5,5,8,8,14,5,8,5,5,5,5,5,8,40,85,193,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,202,139,64,5,8,5,5,5,5,5,
-5,5,5,59,193,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,193,121,49,5,5,5,5,5,5,8,5,8,5,77,179,212,212,212,212,
-212,212,212,212,212,212,212,212,220,212,212,212,220,212,220,212,220,212,220,212,
-220,212,212,220,239,255,255,255,255,255,255,255,255,255,255,179,40,5,8,8,
-5,5,8,5,5,5,8,5,5,5,5,8,22,121,212,248,255,255,255,255,
-242,139,64,26,5,5,5,5,5,5,95,224,255,255,255,255,255,255,167,32,
-5,5,5,5,5,5,5,5,5,5,5,14,5,8,5,5,8,5,8,8,
-5,5,5,64,202,255,255,255,255,255,255,193,59,8,14,5,14,5,8,5,
-5,131,255,255,255,255,255,179,77,49,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,5,49,121,193,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,224,161,49,5,5,5,8,5,8,8,5,5,8,5,5,5,
-8,5,8,8,5,40,82,112,148,148,145,148,145,148,161,211,247,255,255,255,
-255,255,255,255,220,170,148,145,148,148,145,148,139,121,67,22,5,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,14,5,5,5,5,14,5,59,131,202,255,255,255,255,255,255,255,
-255,224,121,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,32,49,82,112,121,112,121,
-121,121,121,121,112,104,82,40,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,67,131,202,255,255,255,
-255,255,255,255,131,5,5,5,5,5,5,5,5,5,5,5,8,32,91,158,
-247,255,255,255,255,255,220,145,40,5,14,5,5,8,5,5,5,5,5,5,
-5,5,5,5,14,49,82,194,255,255,255,255,255,255,255,255,255,220,194,170,
-167,158,167,167,167,167,167,167,167,167,167,167,167,167,170,167,167,167,167,167,
-167,158,121,82,40,5,5,8,8,8,5,5,14,5,5,59,194,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,194,121,49,5,5,5,5,
-5,5,5,8,5,8,82,212,255,247,247,247,247,248,247,247,247,247,247,247,
-247,247,255,247,248,248,247,248,247,248,247,248,247,247,255,255,255,255,255,255,
-255,255,255,255,255,255,255,179,49,5,5,5,5,5,5,5,8,8,8,5,
-8,5,5,5,22,131,212,255,255,255,255,255,247,139,59,26,5,5,5,5,
-5,5,95,224,255,255,255,255,255,255,179,26,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,8,5,5,5,5,8,22,40,95,212,255,255,255,
-255,255,255,202,82,49,40,49,49,40,49,49,40,157,255,255,255,255,255,194,
-95,67,32,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,49,127,193,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,224,161,49,14,
-8,5,8,5,8,5,5,5,5,5,14,5,8,5,8,5,8,67,109,170,
-212,220,220,212,212,220,224,247,255,255,255,255,255,255,255,255,255,224,212,220,
-212,212,212,220,193,170,109,22,5,5,8,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,49,109,179,255,255,255,255,255,255,255,255,255,139,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,8,5,49,95,157,211,212,220,220,220,212,212,212,212,193,161,73,
-14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,59,130,202,255,255,255,255,255,255,255,139,5,5,5,
-5,5,5,5,5,5,5,5,5,40,127,202,255,255,255,255,255,247,179,104,
-35,5,5,5,5,14,5,5,5,5,5,5,5,14,5,5,5,40,82,193,
-255,255,255,255,255,255,255,255,247,170,112,82,77,67,73,67,73,67,73,67,
-67,67,67,77,73,67,73,67,77,77,73,67,67,73,59,40,22,5,5,5,
-5,5,8,5,5,5,5,59,194,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,247,179,112,49,5,5,5,5,5,5,8,5,8,5,95,233,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,194,
-40,5,14,5,5,5,5,5,8,5,8,5,5,5,5,5,22,127,220,255,
-255,255,255,255,247,145,59,26,5,5,14,5,5,5,95,229,255,255,255,255,
-255,255,167,35,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,14,22,40,67,127,229,255,255,255,255,255,255,220,118,85,85,85,
-91,85,85,85,85,167,255,255,255,255,255,194,131,95,59,35,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,49,118,194,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,212,157,49,5,8,5,8,8,8,5,5,5,
-14,5,5,8,5,8,5,5,5,77,148,220,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,224,131,26,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,5,5,5,5,14,5,5,5,5,35,77,157,255,255,255,
-255,255,255,255,255,255,161,26,22,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,14,5,5,8,5,8,49,118,179,
-238,248,248,248,248,255,247,255,248,212,179,85,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,67,139,
-203,255,255,255,255,255,255,255,131,5,5,5,8,5,5,5,5,5,5,5,
-22,59,161,229,255,255,255,255,255,229,139,73,22,5,5,5,5,5,5,8,
-5,5,5,5,5,5,8,5,5,22,49,179,255,255,255,255,255,255,255,255,
-247,157,82,49,40,35,40,35,40,40,35,35,40,35,40,40,35,40,40,35,
-40,35,40,40,26,40,26,22,8,5,5,5,5,8,5,5,5,5,5,59,
-194,255,255,255,255,255,255,255,255,229,161,130,127,130,127,130,127,127,127,130,
-130,130,127,130,127,130,127,130,127,127,130,127,130,127,127,127,118,91,49,26,
-5,5,5,5,5,5,8,5,8,5,95,203,247,247,238,247,238,247,238,247,
-247,247,247,247,247,247,247,247,247,247,247,247,247,238,247,247,247,247,247,247,
-255,255,255,255,255,255,255,255,255,255,255,179,49,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,8,22,130,229,255,255,255,255,255,247,130,59,26,
-5,5,5,5,5,5,95,220,255,255,255,255,255,255,175,26,5,5,5,5,
-8,5,5,5,8,5,5,5,5,5,5,8,5,5,5,8,40,82,149,211,
-255,255,255,255,255,255,255,247,211,194,194,194,194,194,194,194,194,229,255,255,
-255,255,255,247,211,175,136,67,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,49,118,193,255,255,255,255,238,203,179,161,167,161,167,
-161,161,167,161,167,167,167,167,179,203,247,255,255,255,255,255,238,212,179,161,
-136,91,35,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,77,149,212,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,220,130,35,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,22,49,130,247,255,255,255,255,255,255,255,255,170,59,
-35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,8,5,5,59,130,193,255,255,255,255,255,255,255,255,
-255,247,203,95,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,67,148,212,255,255,255,255,255,255,255,
-136,5,5,5,5,8,5,5,5,5,5,8,22,67,194,255,255,255,255,255,
-255,212,95,49,17,5,5,8,5,5,5,8,5,8,5,5,5,5,8,5,
-5,5,22,161,255,255,255,255,255,255,255,255,247,136,67,26,5,5,5,5,
-5,8,5,17,17,17,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-17,5,5,5,5,5,5,5,5,17,5,59,194,255,255,255,255,255,255,255,
-255,194,49,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,8,5,5,
-5,5,67,167,194,194,203,194,194,194,194,194,203,194,194,194,194,194,194,194,
-194,194,194,194,194,194,194,194,194,194,203,203,224,247,255,255,255,255,255,255,
-255,255,255,179,40,5,5,5,5,5,5,5,5,5,5,5,17,5,5,8,
-22,140,238,255,255,255,255,255,247,140,59,26,8,5,5,5,5,5,85,224,
-255,255,255,255,255,255,167,32,5,5,5,8,5,5,5,8,5,5,17,5,
-5,8,8,8,5,5,5,22,49,113,220,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,247,194,95,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,44,118,
-188,255,255,255,247,206,140,85,73,73,67,67,76,67,73,73,73,73,67,76,
-104,140,220,255,255,255,255,255,203,149,95,67,59,40,14,5,5,5,5,5,
-5,5,5,5,5,5,14,5,5,14,8,5,5,76,149,212,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,220,127,26,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,14,26,
-113,224,255,255,255,255,255,255,255,255,188,95,44,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,
-5,59,127,194,255,255,255,255,255,255,255,255,255,242,202,95,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,14,85,175,224,255,255,255,255,255,255,255,131,5,5,5,5,8,5,5,
-5,5,8,22,44,104,202,255,255,255,255,255,255,188,76,14,5,5,8,5,
-5,5,8,5,8,5,5,8,5,5,5,5,5,5,26,163,255,255,255,255,
-255,255,255,255,242,131,59,26,5,5,5,5,14,32,59,91,76,40,26,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-8,5,5,59,179,255,255,255,255,255,255,255,255,194,50,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,5,5,5,5,5,5,5,5,5,8,5,5,5,40,82,100,95,95,95,
-95,100,95,95,100,91,95,100,95,104,100,100,100,100,100,100,95,95,104,100,
-100,100,100,112,163,211,255,255,255,255,255,255,255,255,255,179,44,5,5,5,
-5,5,5,5,8,8,5,8,5,5,8,5,26,157,255,255,255,255,255,255,
-242,127,44,26,5,5,5,5,5,5,95,229,255,255,255,255,255,255,170,26,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,14,8,5,22,
-59,113,212,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,242,202,95,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,44,91,170,255,255,255,255,221,140,44,
-40,32,40,32,40,32,32,32,40,32,40,40,91,131,221,255,255,255,255,242,
-163,100,59,32,32,22,14,5,5,8,5,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,64,131,188,239,242,239,242,242,242,242,255,255,255,255,255,
-255,255,255,255,255,248,242,242,239,242,242,242,212,194,113,26,5,5,5,5,
-5,5,5,5,8,5,5,5,8,5,5,5,5,5,8,14,5,5,8,8,
-8,5,5,14,5,8,5,5,5,5,5,5,91,211,255,255,255,255,255,255,
-255,255,211,130,73,8,5,5,5,8,5,14,5,5,5,14,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,14,8,59,130,194,255,255,255,255,
-255,255,255,255,255,242,202,94,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,5,82,194,242,255,255,255,
-255,255,255,255,136,5,5,5,5,8,5,14,8,5,5,22,64,130,229,255,
-255,255,255,255,242,167,50,5,5,5,5,5,5,5,5,5,8,5,8,5,
-8,5,5,5,5,5,26,167,255,255,255,255,255,255,255,255,242,136,64,26,
-5,14,14,22,32,59,109,158,140,82,40,14,5,5,5,5,5,14,5,5,
-5,14,5,5,5,5,5,14,5,5,14,14,5,5,14,50,179,242,255,255,
-255,255,255,255,255,194,59,5,5,5,5,5,14,5,14,5,5,14,14,5,
-5,5,14,5,5,5,5,5,5,5,5,5,14,5,5,14,5,14,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,100,179,242,255,
-255,255,255,255,255,255,255,179,49,5,5,5,5,5,5,5,5,5,14,5,
-5,5,14,5,26,158,255,255,255,255,255,255,239,130,40,22,14,5,5,5,
-5,5,94,229,255,255,255,255,255,255,167,32,5,5,5,5,5,5,5,5,
-5,5,14,14,5,5,5,14,5,14,14,14,49,109,203,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,229,185,85,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,32,73,149,255,255,255,255,229,136,22,5,5,14,14,5,5,5,5,
-5,5,5,14,67,130,212,255,255,255,255,242,130,67,26,5,5,5,5,5,
-14,5,5,14,5,5,5,5,14,14,5,5,5,5,5,5,14,59,100,158,
-193,197,197,197,197,197,203,230,255,255,255,255,255,255,255,255,242,211,193,197,
-197,197,197,197,179,158,100,22,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,14,5,5,5,5,5,5,14,5,5,5,5,14,
-5,5,5,5,77,179,230,255,255,255,255,255,255,255,230,179,91,5,5,5,
-14,5,5,5,14,5,14,5,5,5,5,5,14,5,5,5,14,5,5,5,
-5,5,5,14,5,67,131,197,255,255,255,255,255,255,255,255,255,242,203,94,
-5,5,14,14,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,5,5,5,85,185,230,255,255,255,255,255,255,255,131,14,5,5,
-14,14,5,5,5,5,5,32,104,179,239,255,255,255,255,255,197,127,40,8,
-5,8,5,5,5,5,5,14,5,8,5,5,5,5,5,5,5,8,22,158,
-255,255,255,255,255,255,255,255,242,136,59,26,26,67,91,118,158,179,197,230,
-179,91,49,14,5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,5,5,5,5,49,158,239,255,255,255,255,255,255,255,202,73,22,
-8,5,5,5,5,5,8,8,8,5,5,5,5,5,5,5,5,14,5,5,
-5,8,8,5,5,5,5,14,5,5,5,5,8,5,8,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,32,100,172,242,255,255,255,255,255,255,255,255,179,
-40,5,5,8,5,5,5,5,5,5,8,5,5,5,5,8,26,158,255,255,
-255,255,255,255,238,109,22,14,5,5,14,5,5,5,94,230,255,255,255,255,
-255,255,172,32,5,5,5,5,5,5,8,8,5,5,5,5,5,14,5,5,
-5,14,5,14,26,59,94,158,238,255,255,255,255,255,255,230,149,127,127,118,
-127,127,127,118,118,194,255,255,255,255,255,212,158,118,94,40,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,49,127,242,255,255,
-255,255,158,40,22,8,5,5,5,5,5,5,5,5,5,22,82,145,230,255,
-255,255,255,242,130,49,22,5,5,8,5,5,8,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,5,8,26,49,73,94,94,94,94,94,94,113,188,
-238,255,255,255,255,255,255,242,194,130,100,94,94,94,94,94,94,73,40,8,
-5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,8,5,5,
-14,26,26,32,32,32,32,26,32,32,26,26,26,8,8,8,64,148,212,255,
-255,255,255,255,255,255,247,212,109,5,5,8,5,5,5,8,5,8,5,8,
-14,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,59,121,194,
-255,255,255,255,255,255,255,255,255,238,194,94,8,8,14,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,82,172,
-230,255,255,255,255,255,255,255,136,8,8,5,5,14,5,5,5,5,5,40,
-136,212,255,255,255,255,255,230,158,91,26,8,8,5,5,5,14,5,8,8,
-5,5,5,14,5,14,5,5,5,5,22,140,248,255,255,255,255,255,255,255,
-247,140,82,59,64,113,163,211,247,255,255,255,203,100,44,14,8,8,8,8,
-5,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,44,
-148,230,255,255,255,255,255,255,255,211,94,32,14,8,8,5,5,8,5,5,
-8,8,8,5,5,5,14,5,5,5,5,8,8,5,8,5,5,5,5,5,
-5,5,14,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,
-104,172,247,255,255,255,255,255,255,255,255,188,40,5,5,5,8,8,5,5,
-5,5,8,5,14,5,5,5,26,167,255,255,255,255,255,255,230,94,5,5,
-5,5,8,5,5,5,94,230,255,255,255,255,255,255,167,32,5,5,5,5,
-5,8,5,5,14,5,5,5,5,5,5,14,8,5,8,5,5,5,5,64,
-211,255,255,255,255,255,255,194,50,5,5,5,8,5,5,5,5,131,255,255,
-255,255,255,172,73,40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,14,104,230,255,255,255,255,179,64,32,5,5,5,
-5,5,5,5,5,8,5,14,91,163,230,255,255,255,255,238,127,44,22,5,
-5,5,5,5,8,5,5,5,5,5,5,5,14,8,5,8,8,8,5,8,
-5,8,5,5,5,5,5,5,5,8,32,139,221,255,255,255,255,255,255,230,
-158,50,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,26,59,121,167,167,167,163,172,167,
-167,163,158,121,77,22,5,5,50,112,184,255,255,255,255,255,255,255,255,255,
-131,22,14,8,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,50,104,170,230,247,238,238,238,238,247,238,
-238,211,170,82,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,77,148,212,255,255,255,255,255,255,255,
-139,5,5,5,8,5,5,5,5,14,8,58,170,255,255,255,255,255,255,230,
-121,58,14,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,22,131,230,255,255,255,255,255,255,255,255,194,158,167,188,203,230,255,
-255,255,255,255,211,109,44,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,44,148,230,255,255,255,255,255,255,
-255,212,109,44,14,5,8,8,5,5,5,14,5,5,5,5,5,5,8,5,
-5,5,5,5,5,8,5,8,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,32,103,176,247,255,255,255,255,255,
-255,255,255,176,40,5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,
-26,163,255,255,255,255,255,255,230,94,5,5,5,8,8,5,5,5,94,221,
-255,255,255,255,255,255,170,26,5,5,5,5,5,8,5,5,5,5,5,5,
-8,5,5,5,5,5,5,8,8,5,5,64,203,255,255,255,255,255,255,194,
-53,5,5,5,5,5,5,5,5,130,255,255,255,255,255,170,73,40,8,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-77,176,230,255,255,255,203,113,58,14,5,5,14,8,5,5,5,5,8,22,
-94,176,230,255,255,255,255,230,104,22,14,5,5,14,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,40,139,221,255,255,255,255,255,255,224,163,53,8,5,5,5,8,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,14,5,5,
-5,5,14,44,103,211,255,255,255,255,255,255,255,255,247,194,118,40,5,5,
-35,82,161,255,255,255,255,255,255,255,255,255,157,26,17,8,5,8,8,5,
-5,5,5,8,5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,
-5,35,94,139,176,194,188,194,188,194,188,194,194,161,140,67,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,58,130,203,255,255,255,255,255,255,255,139,8,5,8,5,5,5,8,
-5,5,17,67,176,255,255,255,255,255,255,194,85,26,17,5,5,5,8,8,
-5,5,5,5,5,5,8,5,8,5,5,5,5,5,22,118,212,247,255,255,
-255,255,255,255,255,238,230,255,255,255,255,255,255,255,255,255,203,103,44,8,
-5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-17,8,5,44,140,221,255,255,255,255,255,255,255,221,131,67,22,5,8,8,
-5,5,5,5,5,8,5,5,8,8,8,17,5,5,5,17,5,5,5,17,
-5,8,5,17,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,35,104,170,247,255,255,255,255,255,255,255,255,176,44,5,8,5,
-5,5,8,5,8,5,5,5,5,5,5,5,26,161,255,255,255,255,255,255,
-230,94,5,17,5,5,5,5,5,5,82,212,255,255,255,255,255,255,161,26,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,
-17,17,8,67,211,255,255,255,255,255,255,194,53,5,5,5,5,5,5,5,
-8,118,255,255,255,255,255,161,67,40,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,53,131,194,255,255,255,230,161,
-94,8,17,5,5,8,5,5,5,5,5,22,104,188,247,255,255,255,255,230,
-91,5,8,8,5,5,5,5,8,5,17,8,5,5,5,5,5,5,5,5,
-5,5,5,8,5,17,8,22,17,22,22,17,22,17,35,139,230,255,255,255,
-255,255,255,230,161,67,22,22,22,22,8,17,5,5,5,5,5,5,5,8,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,26,77,139,230,255,255,
-255,255,255,255,255,255,238,161,82,26,5,5,26,53,148,255,255,255,255,255,
-255,255,255,255,167,67,26,5,5,8,5,17,5,5,5,8,5,5,5,5,
-5,5,8,5,8,5,5,5,5,17,5,5,5,22,40,67,82,94,94,82,
-91,82,82,94,94,73,67,35,8,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,67,131,203,255,255,255,
-255,255,255,255,139,5,5,5,5,5,5,17,8,5,17,26,82,113,113,118,
-118,118,118,94,40,22,5,5,17,5,5,5,5,5,5,5,5,5,8,5,
-8,5,8,5,5,5,17,94,176,238,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,176,82,40,17,5,5,5,8,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,44,127,203,255,255,
-255,255,255,255,255,230,161,94,26,8,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,17,5,5,5,5,5,5,5,8,5,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,103,170,242,255,
-255,255,255,255,255,255,255,179,44,5,5,17,5,5,5,5,5,5,5,17,
-5,5,8,5,26,148,255,255,255,255,255,255,230,103,5,8,5,5,5,5,
-8,5,44,127,157,161,161,157,157,157,94,22,5,5,5,8,5,5,5,5,
-5,5,5,8,5,5,5,8,5,5,17,8,5,8,5,67,203,255,255,255,
-255,255,255,194,50,5,5,5,5,5,5,5,5,77,157,161,157,161,157,94,
-40,22,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,35,67,139,230,255,255,255,220,131,44,22,5,5,8,5,5,
-5,5,8,22,127,211,248,255,255,255,255,220,85,5,5,8,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,26,50,73,
-85,94,91,85,85,50,50,145,230,255,255,255,255,255,255,230,179,113,94,91,
-94,94,58,17,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,26,109,188,242,255,255,255,255,255,255,255,255,220,118,
-64,17,17,5,22,35,127,242,255,255,255,255,255,255,255,255,188,109,50,5,
-5,8,5,5,5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,8,58,127,194,255,255,255,255,255,255,255,139,5,5,8,
-8,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,17,5,17,5,5,8,8,17,8,5,5,5,8,8,5,17,22,103,
-158,230,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,238,215,
-145,58,26,5,5,5,8,8,8,5,5,5,5,5,5,5,8,5,5,8,
-5,8,8,8,5,5,5,26,109,179,242,255,255,255,255,255,255,255,202,130,
-40,5,8,5,8,5,5,17,8,17,5,5,5,5,5,5,17,5,5,5,
-5,5,5,5,8,5,8,8,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,35,103,170,242,255,255,255,255,255,255,255,255,188,
-40,5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,26,145,242,255,
-255,255,255,255,230,103,5,5,5,5,5,5,5,5,22,58,64,64,64,73,
-64,64,40,17,5,5,8,5,5,5,5,5,5,8,8,5,8,5,5,17,
-5,5,5,5,5,5,5,64,202,255,255,255,255,255,255,194,50,5,5,5,
-5,8,8,5,5,35,58,64,64,64,64,40,22,17,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,17,22,94,188,
-230,255,255,255,179,94,58,26,22,17,8,5,5,5,17,26,130,224,255,255,
-255,255,255,211,82,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,5,5,40,94,121,161,161,149,161,145,94,58,149,
-224,255,255,255,255,255,255,230,194,179,149,158,158,158,109,26,5,5,8,8,
-5,5,17,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,35,139,
-220,255,255,255,255,255,255,255,255,255,194,82,26,17,5,5,17,22,109,224,
-255,255,255,255,255,255,255,255,212,145,64,5,5,5,5,5,17,5,5,5,
-5,8,5,5,5,5,8,5,5,8,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,50,103,
-179,255,255,255,255,255,255,255,130,5,8,5,17,5,5,5,8,5,5,5,
-5,5,5,17,8,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,8,5,5,8,5,5,5,35,58,130,194,242,255,255,255,255,255,255,
-255,255,255,255,255,255,242,220,188,149,121,109,64,35,17,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,17,5,5,5,5,5,26,
-77,145,233,255,255,255,255,255,255,255,238,158,49,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,8,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,
-103,172,242,255,255,255,255,255,255,255,255,179,40,5,5,5,5,5,5,17,
-8,5,5,5,8,8,8,5,22,131,233,255,255,255,255,255,233,94,17,8,
-5,5,5,5,17,5,17,26,35,35,35,26,35,35,22,5,5,5,5,5,
-5,5,5,5,8,8,5,5,5,5,5,5,8,5,5,5,5,5,5,58,
-179,248,255,255,255,255,255,194,49,5,5,5,5,5,8,5,5,22,35,35,
-35,35,35,22,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,8,8,40,94,145,194,233,255,239,194,157,113,
-85,58,35,5,17,5,5,26,140,239,255,255,255,255,242,188,73,8,5,5,
-5,5,8,5,8,5,5,5,5,8,5,5,5,5,5,5,17,5,5,5,
-5,64,118,179,224,224,224,224,203,103,50,149,220,255,255,255,255,255,255,233,
-212,220,233,224,220,224,157,35,5,5,8,5,5,8,5,5,8,5,5,5,
-5,5,5,17,5,8,8,5,5,17,50,167,255,255,255,255,255,255,255,255,
-255,242,172,58,5,5,5,5,5,5,94,197,242,255,255,255,255,255,255,255,
-233,184,94,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,17,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,17,26,85,167,255,255,255,255,255,255,255,
-139,17,17,8,8,5,8,8,5,5,5,5,5,5,5,8,5,8,5,8,
-5,5,5,8,5,5,5,5,5,5,5,17,5,5,5,8,5,5,5,8,
-17,64,118,172,220,255,255,255,255,255,255,255,255,255,255,255,248,224,197,157,
-113,58,26,17,5,5,5,17,5,8,8,5,5,5,5,8,5,8,5,5,
-8,17,5,5,5,5,5,8,8,5,5,17,49,109,212,255,255,255,255,255,
-255,255,255,188,73,26,17,5,5,17,5,5,5,5,5,5,5,5,5,22,
-26,22,22,22,22,22,22,22,17,5,5,17,8,5,8,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,35,109,176,242,255,255,255,255,255,
-255,255,255,188,40,5,17,5,8,5,5,5,8,5,5,5,5,5,8,5,
-22,121,212,255,255,255,255,255,230,109,26,17,5,5,5,5,5,5,5,5,
-5,5,8,5,8,5,8,8,5,5,5,5,5,5,5,5,8,5,5,5,
-5,17,5,5,5,8,5,8,5,8,5,53,161,224,255,255,255,255,255,197,
-53,5,5,5,5,5,5,8,8,8,8,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,
-5,5,17,22,64,127,176,242,255,255,220,172,131,95,53,5,5,8,5,26,
-149,255,255,255,255,255,230,176,64,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,17,8,5,82,157,220,255,255,255,255,
-251,118,53,140,220,255,255,255,255,255,255,230,224,255,255,255,255,255,188,49,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,40,82,197,255,255,255,255,255,255,255,255,255,212,140,49,5,5,5,8,
-5,5,73,167,224,255,255,255,255,255,255,255,251,212,109,5,5,5,5,5,
-5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,8,8,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,26,58,149,255,255,255,255,255,255,255,157,49,26,5,5,8,5,5,
-17,5,8,5,5,5,5,8,8,5,5,17,5,5,5,5,5,8,5,5,
-8,17,5,5,5,5,17,5,5,5,5,26,53,139,212,239,255,255,255,255,
-255,255,255,255,255,255,247,197,149,113,82,73,49,26,17,17,5,5,5,5,
-5,8,8,5,5,8,5,8,5,5,5,5,5,5,5,5,5,17,5,8,
-8,5,5,8,26,64,161,220,255,255,255,255,255,255,255,212,131,73,17,5,
-5,5,5,8,5,8,8,5,5,8,5,49,100,100,91,100,91,100,82,64,
-40,22,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,35,109,172,247,255,255,255,255,255,255,255,255,179,40,5,5,5,
-5,5,5,5,8,5,5,5,8,5,5,5,22,109,188,239,255,255,255,255,
-247,131,40,22,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,
-5,5,5,5,8,5,5,5,17,5,8,5,5,5,5,5,5,5,5,5,
-8,8,5,49,149,220,255,255,255,255,255,194,58,17,5,5,5,5,8,5,
-5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,8,5,8,17,26,58,91,113,
-139,161,161,161,139,121,58,5,8,8,5,26,161,255,255,255,255,255,229,161,
-64,5,5,5,8,5,8,5,8,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,8,8,109,188,233,255,255,255,255,255,109,40,139,220,255,255,255,
-255,255,255,229,220,239,255,255,255,255,188,49,5,5,8,8,17,8,5,5,
-17,5,5,5,5,5,5,5,5,8,5,8,17,64,130,212,255,255,255,255,
-255,255,255,255,247,179,109,40,5,8,5,5,5,8,58,139,203,255,255,255,
-255,255,255,255,255,247,121,8,17,8,5,5,5,5,5,5,5,5,5,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,17,8,5,8,5,8,
-17,5,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,35,139,255,255,255,
-255,255,255,255,179,82,40,5,17,8,5,5,8,5,5,8,5,5,5,5,
-5,5,8,8,8,5,5,17,5,8,8,8,5,8,5,8,5,5,8,5,
-5,5,8,35,82,188,255,255,255,255,255,255,255,255,255,255,255,255,224,130,
-67,26,8,5,5,5,5,5,5,5,5,5,5,8,17,8,8,5,8,5,
-8,5,5,5,8,8,5,8,5,5,8,5,8,17,8,5,5,40,100,172,
-239,255,255,255,255,255,255,247,188,121,40,17,5,5,8,5,8,5,8,5,
-8,17,22,100,157,157,157,157,157,157,148,109,67,35,8,5,5,5,8,17,
-5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,109,179,247,255,
-255,255,255,255,255,255,255,188,40,5,5,5,5,5,5,5,8,5,5,5,
-5,5,8,5,17,94,158,229,255,255,255,255,247,140,67,26,5,5,5,5,
-8,8,5,5,5,5,5,8,8,5,17,8,8,5,5,8,5,17,5,5,
-5,5,5,5,5,5,5,5,17,5,5,5,5,8,5,44,140,203,255,255,
-255,255,255,203,73,26,8,5,5,5,5,5,8,5,17,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,8,5,5,17,17,44,77,104,125,125,125,67,5,
-5,8,5,35,170,255,255,255,255,255,212,158,58,5,5,5,8,5,5,5,
-5,17,5,5,5,5,5,5,5,5,8,5,5,8,5,8,17,113,211,247,
-255,255,255,255,248,104,26,139,220,255,255,255,255,255,255,229,212,220,238,255,
-255,255,188,50,8,8,5,8,8,14,5,5,5,5,5,5,5,5,14,5,
-5,5,5,5,22,94,158,229,255,255,255,255,255,255,255,255,229,145,77,26,
-5,8,5,5,8,5,50,100,175,255,255,255,255,255,255,255,255,255,145,26,
-14,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,5,5,8,5,5,5,5,5,5,5,5,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,14,5,8,22,118,247,255,255,255,255,255,255,188,100,50,5,
-5,5,8,5,5,8,5,5,8,8,8,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,40,82,188,255,255,
-255,255,255,255,255,255,255,255,255,255,229,118,50,22,5,8,5,5,8,5,
-8,5,5,5,14,5,5,5,5,8,5,5,5,5,5,8,5,8,8,5,
-5,5,5,8,8,5,5,5,5,22,50,118,202,255,255,255,255,255,255,255,
-247,179,91,50,14,5,5,5,5,8,5,5,5,35,50,148,229,229,229,229,
-229,229,215,145,82,35,5,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,35,118,188,247,255,255,255,255,255,255,255,255,188,
-40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,73,130,220,
-255,255,255,255,248,158,94,40,5,5,14,5,5,5,8,14,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,8,5,5,40,112,185,248,255,255,255,255,215,100,50,14,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,14,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,22,37,50,50,58,58,26,5,8,5,22,50,179,255,255,255,
-255,255,202,127,50,5,5,5,5,8,8,8,5,8,5,5,8,5,5,5,
-8,5,5,5,5,5,8,5,8,112,215,247,255,255,255,255,220,94,37,139,
-220,255,255,255,255,255,255,229,202,202,220,255,255,255,188,50,5,5,5,8,
-5,5,5,5,5,8,5,5,5,5,8,5,5,5,14,5,22,112,188,248,
-255,255,255,255,255,255,255,255,220,112,50,22,5,5,5,14,5,5,31,58,
-149,255,255,255,255,255,255,255,255,255,158,50,31,5,14,5,5,5,5,5,
-5,5,5,8,14,5,5,5,14,5,5,8,5,14,5,14,5,14,22,31,
-37,40,37,37,37,40,40,37,40,37,31,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,
-103,215,255,255,255,255,255,255,202,139,67,5,5,5,14,5,5,8,5,5,
-8,5,8,5,5,5,8,8,5,5,5,8,5,5,5,8,5,8,14,5,
-5,5,5,5,8,5,14,40,82,188,255,255,255,255,255,255,255,255,255,255,
-255,255,238,118,50,22,5,8,8,8,5,8,5,5,5,8,5,8,8,5,
-5,5,5,5,5,5,5,8,5,8,5,5,5,14,8,8,8,8,5,5,
-5,14,14,58,149,229,255,255,255,255,255,255,255,229,149,82,37,14,5,5,
-8,5,5,5,5,50,94,193,255,255,255,255,255,255,255,158,86,40,5,5,
-5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,
-139,211,255,255,255,255,255,255,255,255,255,193,40,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,14,50,94,197,255,255,255,255,255,179,109,40,
-5,8,14,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,
-5,5,5,8,5,5,5,14,5,8,8,5,8,5,14,5,5,5,5,37,
-86,149,242,255,255,255,255,220,130,73,22,5,5,5,14,5,14,5,5,5,
-5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,14,5,5,
-5,5,5,8,5,5,35,58,193,255,255,255,255,255,193,113,50,5,5,8,
-5,5,5,14,5,5,8,5,14,5,5,5,5,5,8,5,5,5,8,5,
-5,118,220,255,255,255,255,242,203,94,35,140,220,255,255,255,255,255,255,229,
-197,175,197,255,255,255,197,58,14,5,5,8,5,5,5,5,5,8,5,5,
-5,5,8,5,5,5,5,5,35,140,238,255,255,255,255,255,255,255,255,255,
-197,86,22,14,5,5,5,5,5,5,14,35,127,242,255,255,255,255,255,255,
-255,255,179,94,49,5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,
-5,8,5,8,5,5,5,5,5,35,67,94,130,139,139,139,139,139,139,139,
-139,118,100,49,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,5,5,8,82,167,224,255,255,255,255,255,
-230,188,86,5,5,5,5,8,5,8,5,5,5,5,5,8,8,5,5,5,
-5,5,5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,49,
-82,179,255,238,203,188,179,238,255,255,255,255,255,255,248,175,94,40,5,5,
-5,5,5,5,8,5,5,5,8,5,5,8,5,8,14,5,5,5,5,8,
-8,5,5,5,5,8,5,8,5,5,5,5,5,5,5,40,82,149,230,255,
-255,255,255,255,255,255,224,158,82,49,14,5,5,5,14,5,5,73,130,212,
-255,255,255,255,255,255,255,140,49,31,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,49,158,230,255,255,255,255,255,255,
-255,255,255,179,40,5,5,5,5,5,5,8,5,8,5,5,5,5,5,8,
-8,31,73,179,255,255,255,255,255,203,139,58,5,8,8,5,5,5,5,5,
-5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,8,5,5,
-5,8,5,5,5,5,5,5,5,5,5,22,49,121,230,255,255,255,255,238,
-175,94,31,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,8,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,14,5,8,5,5,5,5,5,5,5,14,5,5,8,5,14,40,82,
-188,255,255,255,255,255,175,104,35,5,5,5,14,5,5,8,5,5,5,8,
-5,5,8,8,5,5,8,5,5,8,8,8,8,139,255,255,255,255,255,242,
-194,86,31,140,224,255,255,255,255,255,255,224,188,140,167,242,255,255,203,94,
-40,22,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,14,
-46,175,255,255,255,255,255,255,255,255,255,242,179,58,5,5,5,5,5,8,
-5,8,5,5,109,233,255,255,255,255,255,255,255,255,203,130,64,5,5,5,
-5,5,5,8,5,5,8,8,8,5,5,5,5,5,8,5,5,5,5,5,
-5,50,109,161,212,224,221,221,224,221,224,221,221,188,161,77,14,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,14,5,58,113,194,255,255,255,255,255,255,224,121,14,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,40,77,149,221,179,149,113,109,194,
-255,255,255,255,255,255,255,212,157,50,14,5,5,5,14,5,5,5,5,5,
-5,8,8,5,8,5,5,8,5,5,5,14,5,8,8,5,5,14,5,5,
-5,5,5,5,5,5,5,14,31,94,179,238,255,255,255,255,255,255,255,224,
-149,86,40,14,14,5,5,5,5,86,170,224,255,255,255,255,255,255,238,121,
-32,22,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,64,179,255,255,255,255,255,255,255,255,255,255,179,46,14,5,5,
-5,5,5,5,5,5,5,5,14,8,5,8,8,14,40,158,255,255,255,255,
-255,233,167,64,14,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,8,5,14,32,86,203,255,255,255,255,255,203,125,32,5,5,5,5,5,
-14,5,8,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,8,5,5,5,5,8,8,8,5,
-5,5,5,5,5,5,5,8,5,5,50,94,194,255,255,255,255,247,161,82,
-40,5,5,5,5,5,5,5,5,8,8,5,5,8,5,8,5,8,5,8,
-5,5,5,8,5,149,255,255,255,255,255,233,179,82,32,139,221,255,255,255,
-255,255,255,233,179,109,130,233,255,255,221,130,67,22,5,5,5,8,5,5,
-5,5,5,5,5,8,5,5,5,5,14,40,82,194,255,255,255,255,255,255,
-255,255,255,211,140,50,5,5,5,5,5,5,8,5,8,5,86,194,247,255,
-255,255,255,255,255,255,221,161,77,5,5,5,5,5,5,14,5,5,8,5,
-5,5,5,5,8,5,5,5,8,5,5,5,5,50,118,188,247,255,251,255,
-255,255,255,255,255,221,188,82,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,32,58,154,255,
-255,255,255,255,255,247,149,50,22,5,5,8,5,8,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,
-5,5,5,32,50,77,103,82,58,50,58,130,202,251,255,255,255,255,255,255,
-188,82,22,14,5,5,5,5,5,5,5,5,5,8,5,5,8,8,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,40,94,161,212,255,255,255,255,255,255,255,230,175,109,67,8,5,5,5,
-5,109,197,242,255,255,255,255,255,255,221,109,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,8,40,94,202,255,255,255,
-255,255,255,255,255,255,255,179,49,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,26,130,212,255,255,255,255,255,202,94,22,14,5,5,
-5,8,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,67,161,233,
-255,255,255,255,238,161,49,14,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,8,58,109,211,255,255,255,255,242,157,73,26,5,5,5,5,5,5,8,
-5,5,5,5,5,5,8,5,5,5,5,8,5,5,14,5,5,148,255,255,
-255,255,255,212,148,67,32,139,224,255,255,255,255,255,255,224,161,77,94,212,
-255,255,238,161,94,26,5,5,8,8,5,5,5,5,5,5,8,5,8,5,
-5,5,8,67,130,212,255,255,255,255,255,255,255,255,255,197,139,67,32,26,
-22,22,14,5,14,5,5,5,77,167,224,255,255,255,255,255,255,255,238,193,
-94,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,58,127,197,255,255,255,255,255,255,255,255,255,242,202,94,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,5,5,5,5,5,14,14,121,230,255,255,255,255,255,255,179,94,
-49,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,14,14,14,22,14,
-5,5,22,77,140,220,255,255,255,255,255,255,230,121,49,22,5,5,5,5,
-5,5,5,8,5,5,5,8,5,14,8,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,31,82,161,212,251,255,
-255,255,255,255,255,242,193,121,49,32,31,8,14,121,224,255,255,255,255,255,
-255,242,193,82,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,8,
-8,5,8,5,14,22,73,139,224,255,255,255,255,255,255,255,255,255,255,184,
-49,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,100,
-161,230,255,255,255,255,238,130,49,22,5,5,8,8,5,5,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,40,113,193,242,255,255,255,255,193,77,32,
-14,5,5,5,5,5,8,8,5,14,5,5,5,5,5,5,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,8,5,5,5,14,67,130,212,255,255,255,
-255,242,139,58,31,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,5,5,5,5,14,22,161,255,255,255,255,255,197,127,67,31,139,
-220,255,255,255,255,255,255,230,161,50,67,170,238,255,255,211,130,32,14,8,
-5,8,5,5,5,5,5,5,5,5,8,8,5,5,22,94,161,224,255,255,
-255,255,255,255,255,255,255,224,184,140,109,94,77,58,32,14,5,5,5,5,
-67,139,202,255,255,255,255,255,255,255,255,224,109,5,5,14,5,8,5,8,
-5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,67,127,197,
-255,255,255,255,255,255,255,255,255,242,202,94,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,82,175,230,255,255,255,255,255,221,167,82,5,5,14,5,5,5,5,
-5,8,5,5,5,5,5,5,5,8,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,14,8,5,5,5,14,40,86,184,255,255,
-255,255,255,255,255,197,127,50,5,5,8,5,5,5,8,5,5,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,32,77,130,175,224,255,255,255,255,255,255,242,211,
-167,127,82,50,22,139,255,255,255,255,255,255,255,221,157,73,5,5,5,5,
-5,5,5,5,8,5,5,5,5,8,5,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,50,127,202,
-255,255,255,255,255,255,255,255,255,255,255,184,50,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,50,94,197,255,255,255,255,242,175,
-109,40,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,26,67,139,238,255,255,255,255,221,139,73,22,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,77,145,221,255,255,255,255,242,130,50,26,5,5,5,
-5,5,8,14,8,5,5,5,5,5,8,5,8,5,14,5,5,8,8,26,
-50,170,255,255,255,255,255,197,130,58,32,145,224,255,255,255,255,255,255,224,
-161,50,40,109,170,255,255,242,170,67,26,14,5,5,5,5,5,5,5,5,
-14,8,8,5,5,5,22,113,193,242,255,255,255,255,255,255,255,255,255,248,
-224,203,179,158,145,118,94,67,50,50,50,40,77,118,197,255,255,255,255,255,
-255,255,255,242,127,22,8,8,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,5,8,5,5,5,58,127,197,255,255,255,255,255,255,255,255,
-255,242,203,94,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,8,58,118,193,255,255,255,
-255,255,255,221,118,35,22,8,8,5,8,5,5,8,5,5,8,8,5,5,
-5,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,5,5,14,50,139,212,242,255,255,255,255,255,242,184,82,
-26,8,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,14,
-14,59,113,167,224,242,255,255,255,255,255,255,255,197,145,104,67,179,255,255,
-255,255,255,255,255,197,127,59,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,14,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,22,49,91,179,242,255,255,255,255,255,255,255,255,
-255,255,255,179,40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,49,161,238,255,255,255,255,221,161,67,22,14,5,8,14,5,
-5,8,5,5,5,5,14,5,8,5,8,8,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,14,31,94,203,255,255,255,
-255,242,197,121,40,14,5,5,5,5,5,8,5,8,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,14,5,5,5,5,5,5,5,5,8,5,5,5,5,14,94,161,
-224,255,255,255,255,242,127,40,22,5,5,14,5,5,5,5,5,8,14,5,
-5,5,5,5,5,5,5,8,14,8,8,49,82,179,255,255,255,255,255,193,
-121,50,35,139,221,255,255,255,255,255,255,230,157,59,22,50,121,212,255,255,
-212,113,59,14,5,5,14,5,5,5,5,5,5,5,5,5,5,14,40,145,
-242,255,255,255,255,255,255,255,255,255,255,255,255,255,242,230,224,212,203,197,
-179,157,145,139,145,145,211,255,255,255,255,255,255,255,255,255,149,40,22,5,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,59,130,197,255,255,255,255,255,255,255,255,255,247,203,104,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,5,8,5,26,49,136,224,255,255,255,255,255,255,179,104,49,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,8,5,
-8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-26,77,136,212,255,255,255,255,255,255,224,157,94,26,5,5,8,5,5,5,
-5,14,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,22,49,77,104,149,197,230,
-255,255,255,255,255,248,224,212,202,242,255,255,255,255,255,255,255,167,94,40,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,
-8,5,8,5,5,5,5,8,5,5,8,14,5,5,5,5,5,8,14,40,
-104,167,230,255,255,255,255,255,255,255,255,255,255,255,242,161,40,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,26,94,167,230,
-255,255,255,255,211,121,58,22,5,5,5,5,5,5,5,8,5,5,5,8,
-5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,49,130,197,255,255,255,255,242,179,82,40,14,5,
-8,5,5,5,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,8,8,5,8,5,5,5,14,104,188,238,255,255,255,255,230,104,22,
-14,8,5,5,5,5,8,8,5,5,5,5,5,5,5,5,8,5,5,5,
-8,8,5,40,82,179,255,255,255,255,255,179,94,50,35,139,221,255,255,255,
-255,255,255,230,161,50,22,22,73,140,202,255,242,188,121,35,14,5,5,8,
-5,5,8,5,8,5,5,14,5,22,58,172,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,230,221,211,197,179,221,255,
-255,255,255,255,255,255,255,255,161,76,40,5,5,5,5,5,14,5,5,8,
-5,5,5,14,5,5,5,5,5,5,5,5,5,50,130,197,255,255,255,255,
-255,255,255,255,255,242,197,100,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,
-85,172,221,255,255,255,255,255,230,179,104,40,22,14,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,8,8,8,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,14,26,73,172,230,255,255,255,
-255,255,255,221,148,76,40,22,8,8,8,8,5,5,8,14,5,8,5,14,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,
-5,5,5,5,8,5,5,14,26,73,130,170,211,230,239,248,255,255,255,255,
-255,255,255,255,255,255,255,255,255,148,58,26,5,5,8,5,8,5,8,5,
-5,5,5,8,5,5,5,14,5,8,14,5,5,8,8,5,5,5,5,8,
-5,8,5,5,5,14,14,22,26,40,50,94,170,230,255,255,255,255,255,255,
-255,255,255,255,255,255,212,130,35,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,50,100,188,255,255,255,255,248,179,104,58,
-22,8,5,5,5,8,5,5,8,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,26,
-73,139,230,255,255,255,255,221,140,91,26,22,8,8,5,5,5,8,8,8,
-8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,14,5,5,
-5,14,113,203,247,255,255,255,255,233,94,5,5,5,5,5,5,5,8,8,
-5,5,5,5,5,5,5,8,5,5,5,5,8,8,5,50,85,188,255,255,
-255,255,255,161,85,40,35,136,221,255,255,255,255,255,255,230,161,58,5,8,
-35,85,140,212,230,230,161,73,40,5,5,8,5,8,5,5,5,5,5,5,
-8,50,94,197,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,248,247,255,255,255,255,255,255,255,255,255,255,
-188,118,58,5,5,14,5,5,5,5,5,8,14,5,5,5,5,5,5,5,
-5,5,5,8,14,58,130,197,255,255,255,255,255,255,255,255,255,247,203,94,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,14,5,5,8,8,5,5,50,85,161,247,255,255,255,255,
-255,239,170,109,58,14,14,5,5,8,8,8,5,5,5,14,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,22,40,91,145,230,255,255,255,255,255,255,230,179,118,58,
-22,14,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,14,
-8,35,50,73,82,109,130,161,184,202,221,247,255,255,255,255,255,255,255,255,
-255,125,26,14,5,5,8,8,5,8,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,8,5,5,5,5,8,5,5,8,5,5,8,14,22,40,58,
-77,100,149,197,230,255,255,255,255,255,255,255,255,255,255,255,255,230,167,94,
-26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,22,50,118,184,242,255,255,255,242,188,113,67,22,8,5,5,5,5,8,
-5,8,5,5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,22,35,82,167,221,255,255,255,255,
-221,157,77,40,14,5,5,5,5,5,14,5,8,14,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,8,5,5,5,5,5,5,5,5,8,5,14,118,212,242,255,255,255,
-255,212,95,5,5,5,5,5,5,5,5,14,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,8,58,118,202,255,255,255,255,255,157,73,35,35,145,
-221,255,255,255,255,255,255,229,157,50,5,5,22,35,67,113,161,202,188,149,
-86,14,5,5,5,5,5,5,14,5,5,5,14,73,130,212,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,221,161,77,8,5,5,5,8,
-5,5,5,5,5,5,5,8,5,5,5,5,14,5,8,5,5,50,104,161,
-212,229,229,229,221,229,229,229,221,197,161,82,5,14,5,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,8,14,5,14,22,103,188,221,255,255,255,255,255,229,184,118,58,40,22,
-22,14,8,5,8,5,5,5,5,5,5,5,14,5,5,5,5,14,5,5,
-5,5,14,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,14,35,
-82,167,229,255,255,255,255,255,255,247,194,113,73,50,35,22,14,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,26,58,82,
-104,131,157,211,255,255,255,255,255,255,255,255,229,104,5,5,5,14,5,5,
-8,5,8,8,5,5,14,5,5,5,35,50,67,58,67,58,58,67,67,58,
-67,67,58,67,58,58,67,67,67,82,95,118,139,175,229,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,211,118,58,14,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,58,113,188,247,255,
-255,255,247,179,113,58,35,22,5,14,5,14,5,8,5,8,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,40,104,161,221,255,255,255,255,203,145,95,40,26,5,8,
-5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,8,8,8,5,
-5,14,5,8,5,14,131,229,255,255,255,255,255,194,82,5,5,5,5,5,
-5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,77,
-145,212,255,255,255,255,255,179,100,67,73,161,229,255,255,255,255,255,255,238,
-179,95,50,50,50,50,58,82,131,197,203,197,113,14,5,5,5,5,5,5,
-5,5,5,5,8,95,161,229,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,247,188,95,5,5,8,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,22,40,67,82,95,82,95,95,82,82,95,
-82,77,58,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,14,8,50,82,
-140,197,247,255,255,255,255,247,206,161,118,67,40,22,8,5,5,5,8,5,
-5,5,5,5,8,5,8,14,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,14,40,77,131,197,247,255,255,255,
-255,255,247,221,179,139,95,50,26,14,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,8,5,
-5,5,14,5,5,5,5,5,5,14,26,35,50,50,67,157,248,255,255,255,
-255,255,255,247,197,85,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,67,175,197,203,197,203,197,197,197,197,197,197,197,197,197,203,197,197,
-203,203,212,221,224,229,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-224,157,67,26,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,26,50,109,161,221,255,255,255,238,197,140,85,32,
-14,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,40,85,
-131,188,247,255,255,255,224,175,109,59,14,5,5,5,5,14,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,5,8,5,14,5,5,5,5,5,5,5,22,148,247,
-255,255,255,255,247,181,77,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,8,5,8,5,5,5,5,5,73,140,212,255,255,255,255,255,221,
-181,161,161,212,255,255,255,255,255,255,255,255,212,175,148,148,148,148,161,161,
-181,203,203,188,109,22,8,5,14,5,5,5,5,5,8,5,22,109,203,247,
-255,255,255,255,255,255,255,255,255,255,248,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,221,100,5,
-8,8,5,5,14,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,
-8,8,5,5,5,5,5,5,5,5,14,22,77,131,188,239,255,255,255,255,
-255,239,181,131,104,67,59,46,32,32,32,40,40,40,22,14,8,5,5,5,
-8,5,8,14,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,14,26,59,127,188,221,247,255,255,255,255,255,247,206,161,113,
-95,67,59,50,46,40,40,40,31,22,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,14,131,247,255,255,255,255,255,255,221,161,77,8,8,
-5,8,5,5,14,8,5,8,5,5,5,5,5,5,95,239,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,229,172,104,32,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,32,85,161,211,229,248,255,247,203,157,95,67,40,32,31,22,22,14,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,31,67,118,194,229,247,255,255,229,
-179,118,67,50,46,40,32,32,31,22,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,22,31,32,50,50,50,50,50,50,46,
-50,50,50,50,50,50,50,59,50,59,172,255,255,255,255,255,247,194,109,50,
-50,50,50,50,40,32,22,5,8,5,5,14,8,8,5,8,5,8,5,8,
-5,5,5,73,140,212,255,255,255,255,255,255,238,229,229,255,255,255,255,255,
-255,255,255,255,255,229,229,229,229,229,229,229,229,229,211,188,109,22,5,5,
-5,5,5,5,5,5,8,5,22,140,255,255,255,255,255,255,255,255,255,255,
-238,202,188,211,221,238,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,247,112,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-8,8,5,14,31,50,95,136,188,238,255,255,255,255,247,229,202,188,161,127,
-109,95,95,100,121,100,59,32,14,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,31,50,
-82,127,167,212,247,255,255,255,255,255,238,221,202,194,179,157,136,121,112,104,
-82,50,32,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,8,5,5,5,5,8,8,5,8,5,5,5,5,26,40,157,
-255,255,255,255,255,255,255,203,130,59,5,5,8,5,5,5,5,8,5,5,
-5,5,5,5,5,5,95,230,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,221,161,95,40,14,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,14,40,67,100,161,197,238,
-255,247,230,203,167,130,95,82,59,46,26,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,22,26,50,82,130,161,212,247,247,247,206,179,157,130,118,100,95,
-73,40,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,26,67,109,140,157,157,157,161,149,157,157,157,149,157,149,157,157,149,
-157,161,221,255,255,255,255,255,255,230,188,157,157,157,161,140,127,95,26,5,
-5,14,5,5,5,5,5,5,14,5,5,5,5,5,5,67,130,203,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,230,206,118,26,5,5,5,5,5,5,5,5,5,14,
-32,157,255,255,255,255,255,255,255,255,255,230,197,140,118,139,161,172,188,215,
-230,230,238,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,247,113,5,5,5,5,5,5,5,5,5,14,5,14,5,5,5,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,14,5,5,14,14,5,14,5,14,14,14,32,67,
-118,172,203,230,247,255,255,255,255,255,230,203,179,161,149,161,172,140,77,32,
-14,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,5,14,14,5,14,22,59,95,140,185,215,230,238,
-247,255,255,255,255,255,230,215,197,170,157,140,109,58,40,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,8,8,5,14,8,8,8,14,5,
-5,8,5,5,5,5,5,5,5,32,53,157,248,247,248,247,247,248,238,167,
-95,44,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,95,230,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,247,230,203,161,95,26,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,40,85,130,170,203,230,239,239,221,179,157,130,
-104,85,53,14,5,5,14,8,5,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,8,5,8,5,5,5,14,22,53,
-104,149,179,203,230,230,221,203,179,161,140,121,104,53,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,95,140,197,203,211,
-203,203,215,215,203,211,211,215,211,211,211,211,215,215,247,255,255,255,255,255,
-255,247,221,211,211,203,211,197,179,121,40,5,5,8,5,5,5,8,8,5,
-5,5,14,5,8,5,8,50,95,170,239,230,230,230,230,230,239,230,239,230,
-230,230,230,230,230,230,230,230,230,230,230,230,230,239,230,230,230,230,215,179,
-104,14,5,5,5,5,5,5,5,5,5,31,50,157,230,230,230,230,230,230,
-230,230,215,170,130,67,59,50,67,67,73,95,104,130,140,170,188,215,221,230,
-230,230,230,230,230,230,230,230,230,230,230,230,230,215,103,5,5,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,
-14,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,14,
-5,5,5,5,5,5,5,5,5,8,14,31,50,67,103,125,158,194,230,248,
-255,255,255,255,247,230,215,194,188,140,73,32,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,8,5,14,31,40,59,77,95,125,149,158,179,194,230,230,230,220,215,
-194,188,158,140,95,50,31,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,
-8,31,59,121,179,179,185,179,179,179,170,113,59,32,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,82,194,230,230,230,230,230,230,230,230,
-230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
-230,220,202,170,139,103,67,40,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,32,50,67,95,130,157,179,188,197,188,179,161,139,77,14,5,8,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,8,5,5,5,5,8,14,31,40,50,64,95,109,140,161,179,
-188,170,161,121,95,50,5,5,8,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,40,95,140,197,215,215,211,215,211,215,215,211,215,211,
-211,211,215,215,211,211,220,230,230,230,230,230,230,220,215,215,211,211,215,197,
-170,121,50,5,8,8,5,5,5,5,5,8,5,8,5,5,5,14,5,31,
-40,82,130,130,125,125,130,125,125,125,130,125,130,125,130,125,130,130,130,130,
-130,125,130,139,125,130,130,130,125,130,121,109,64,14,5,5,14,5,5,5,
-5,5,5,31,50,112,161,161,161,161,161,161,161,161,149,109,73,31,5,5,
-5,5,5,22,31,49,73,109,121,149,157,161,161,161,161,161,161,161,161,161,
-161,161,161,161,161,149,73,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,8,5,14,5,5,5,5,5,5,
-5,5,5,5,5,5,32,49,95,130,161,179,202,212,212,221,212,202,185,170,
-149,121,59,31,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,8,5,
-14,31,49,77,95,109,130,161,161,161,167,161,161,149,130,112,73,32,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,14,5,
-5,8,5,5,14,5,8,5,5,5,8,5,5,31,40,77,109,109,103,109,
-121,109,109,64,31,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,59,139,161,161,167,161,161,161,161,161,161,167,161,161,161,161,161,167,
-161,161,167,161,161,167,161,161,161,161,161,161,161,157,139,103,59,32,14,5,
-5,5,5,8,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,8,5,5,5,14,5,5,5,5,31,59,82,112,
-130,161,161,161,149,130,77,22,5,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,
-5,5,8,5,8,5,5,22,40,73,109,130,149,130,125,109,64,40,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,31,73,
-112,157,161,161,161,161,161,161,161,161,161,161,161,167,161,161,161,161,161,161,
-161,167,161,167,161,161,161,161,161,161,161,157,130,95,32,5,5,5,5,14,
-5,8,5,8,5,5,5,8,5,5,5,5,5,32,59,59,59,59,59,59,
-59,59,59,64,59,59,59,59,59,49,59,59,49,59,59,59,59,64,59,59,
-59,59,49,49,31,5,5,5,5,5,5,5,5,5,5,8,22,49,59,64,
-59,64,64,59,59,59,59,40,31,14,5,5,14,5,5,14,14,22,31,40,
-40,59,59,59,59,64,59,64,59,64,59,59,59,64,59,59,64,59,31,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,14,22,
-40,49,59,64,73,77,77,77,77,77,64,59,59,40,22,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,5,5,5,8,5,5,8,14,22,31,32,40,49,49,
-59,64,59,59,59,59,49,40,31,14,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,8,5,5,14,5,5,5,8,5,5,8,
-5,5,5,5,5,8,22,32,32,40,40,40,40,40,40,31,22,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,31,49,59,59,64,59,
-64,64,59,59,59,64,59,64,59,64,59,59,59,64,59,59,59,59,59,64,
-64,64,59,64,64,49,49,49,22,14,14,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,14,22,40,40,49,59,64,59,49,49,32,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,5,5,5,5,8,5,5,5,5,5,14,
-22,31,32,49,59,49,49,40,31,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,31,40,49,59,59,64,59,59,59,
-59,59,59,59,59,59,64,59,64,59,64,59,64,59,59,59,64,59,64,59,
-64,59,64,59,49,32,14,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,5,14,31,31,31,31,22,22,31,31,31,31,22,31,22,31,
-22,31,22,31,31,31,31,22,31,31,22,31,22,31,22,22,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,
-5,5,5,8,5,5,5,5,8,5,5,8,5,5,5,5,8,5,5,5,
-5,5,14,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,8,5,8,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,14,31,31,22,31,31,22,22,22,31,31,31,22,31,31,
-31,22,31,31,22,22,22,31,31,22,31,31,31,22,22,22,31,22,22,31,
-31,22,22,22,14,14,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,8,8,5,5,5,5,5,5,8,5,5,8,5,5,5,8,5,5,5,
-5,5,5,5,14,5,8,5,5,5,5,5,5,5,5,8,5,5,5,14,
-5,5,5,5,5,5,5,5,14,14,14,22,31,22,22,31,31,31,22,22,
-22,22,31,22,22,22,22,31,22,31,31,22,22,22,31,22,22,22,22,22,
-14,14,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,5,5,5,5,14,5,5,14,5,8,5,8,5,5,5,5,5,
-5,5,8,5,8,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,5,5,5,5,
-5,8,5,5,8,5,5,5,5,5,8,5,14,5,8,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-8,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,14,14,40,59,59,
-59,59,59,59,64,59,59,59,64,59,59,59,64,59,59,59,64,49,64,59,
-49,64,59,59,49,64,64,59,64,59,59,59,59,59,64,59,32,14,14,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,31,40,59,59,59,59,59,59,59,64,59,64,59,59,59,59,59,59,64,
-59,59,59,64,49,59,59,64,49,59,64,49,40,22,14,5,14,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,14,5,5,14,5,5,5,5,5,5,5,5,5,
-8,8,5,5,5,5,8,5,5,5,8,5,5,5,5,8,5,5,5,5,
-5,5,5,8,5,14,5,5,5,5,14,5,8,5,14,5,5,14,22,49,
-59,59,64,64,59,59,59,59,59,59,64,59,64,59,64,59,64,59,59,59,
-59,59,59,59,59,59,40,5,5,5,5,5,5,5,5,14,8,5,5,5,
-5,5,22,40,59,77,77,82,77,82,77,77,77,77,77,77,77,77,77,77,
-77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,82,82,
-82,77,77,82,73,49,32,22,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,8,8,8,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,5,5,5,5,22,31,82,130,125,130,125,130,121,130,130,125,130,
-125,125,125,130,125,125,130,130,125,130,130,125,125,130,125,130,125,130,130,125,
-130,130,125,130,125,125,130,121,77,40,22,5,5,8,8,5,5,8,5,5,
-5,14,49,59,59,59,59,64,59,59,59,59,64,59,64,59,64,59,59,64,
-59,59,64,59,59,59,64,64,59,64,59,64,59,49,31,22,5,8,5,8,
-5,14,5,5,8,14,5,8,5,5,5,5,31,59,95,121,125,130,125,121,
-130,125,125,130,130,125,125,130,125,130,125,130,125,130,125,130,125,130,125,130,
-125,130,130,109,82,49,22,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,8,14,8,40,64,73,77,77,82,77,77,
-77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
-77,77,77,77,77,77,77,82,73,82,82,64,49,31,5,8,8,5,5,14,
-8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,32,59,64,
-77,82,73,82,82,77,77,82,64,40,8,8,5,5,8,5,5,8,5,14,
-5,5,5,5,14,5,8,5,5,5,5,5,5,5,14,8,8,5,5,5,
-5,5,5,5,8,5,5,5,8,32,59,121,161,167,161,161,161,161,167,161,
-161,161,161,161,161,167,161,161,161,161,161,161,167,161,167,161,167,161,95,5,
-8,5,8,5,5,5,8,5,8,5,5,5,8,22,40,95,167,220,212,220,
-212,220,212,212,212,212,220,212,212,212,212,220,220,220,212,212,220,212,212,212,
-220,212,212,220,212,220,212,220,212,220,212,212,212,212,212,212,194,139,82,32,
-5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,8,8,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,40,
-64,161,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
-230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,239,230,230,
-139,59,31,5,5,14,5,5,8,14,5,5,5,49,121,161,161,161,161,161,
-161,161,161,161,167,161,161,161,161,161,161,161,161,161,161,161,161,167,161,161,
-161,167,161,161,157,121,73,40,5,5,5,5,5,5,8,8,5,5,5,5,
-5,5,5,14,49,109,161,220,230,230,230,230,230,230,230,230,230,230,230,230,
-230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,202,149,86,31,5,
-8,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,
-5,8,5,31,109,170,194,220,211,212,220,212,212,220,212,220,212,220,212,220,
-212,220,212,220,212,212,220,212,212,212,212,212,212,212,220,212,212,220,212,212,
-220,212,202,188,139,64,5,5,8,5,8,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,8,5,5,8,5,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,8,82,161,188,211,212,212,212,212,220,212,220,
-194,86,5,5,14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,
-14,49,86,167,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
-230,230,230,230,230,230,230,230,230,230,121,8,5,5,5,5,5,5,5,8,
-8,8,8,5,5,22,49,109,220,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,179,109,40,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,8,59,77,
-77,64,40,22,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,8,8,40,82,188,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,167,73,40,5,8,5,5,5,
-8,14,5,5,5,49,140,194,188,194,202,211,230,230,230,230,230,230,230,211,
-194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,194,179,136,86,40,
-5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,49,121,194,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,242,179,100,40,5,8,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,32,136,220,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230,179,82,5,8,
-8,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,40,64,73,82,59,40,22,5,5,5,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,104,202,242,255,255,255,255,255,255,255,255,255,118,14,14,14,5,5,5,
-5,5,5,5,5,5,14,5,5,5,5,14,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,44,100,194,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,139,5,5,5,5,5,14,14,5,5,5,5,5,14,5,22,50,118,
-220,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-248,185,100,40,5,14,14,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,14,5,22,139,211,194,161,94,40,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,14,14,
-5,5,14,40,82,181,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,161,73,32,5,5,5,5,14,5,5,14,5,14,40,112,161,
-161,161,181,211,242,255,255,255,255,255,242,203,167,161,161,157,161,161,157,161,
-161,157,161,161,161,157,161,161,149,112,73,32,5,14,14,5,5,5,5,5,
-14,5,5,5,5,14,5,14,59,130,194,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,
-170,100,32,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,14,5,5,14,5,32,130,221,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,239,185,77,5,14,5,14,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,14,
-100,161,197,203,161,100,44,5,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,14,109,203,242,255,255,255,255,
-255,255,255,255,242,122,26,14,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,14,5,5,5,8,5,5,5,14,5,5,5,5,5,5,
-5,8,8,5,14,50,100,203,255,255,255,255,255,255,255,242,242,242,242,242,
-239,242,242,242,242,239,255,255,255,255,255,255,255,255,149,14,5,14,5,5,
-5,5,14,5,5,14,5,5,5,14,59,118,221,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,247,181,109,40,5,8,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,32,170,255,255,221,118,50,26,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,32,77,188,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,161,73,40,5,
-5,5,8,5,14,5,5,5,5,26,82,100,109,118,139,188,255,255,255,255,
-255,255,247,179,118,109,100,109,100,100,109,100,109,100,100,109,100,109,100,100,
-100,67,59,26,5,5,8,5,14,5,5,5,8,8,8,5,5,5,5,8,
-40,94,161,211,221,221,221,224,221,221,221,221,221,224,221,221,221,221,224,247,
-255,255,255,255,255,255,255,247,230,221,221,188,140,86,26,5,8,8,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,5,26,
-127,202,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,221,
-170,73,8,14,5,5,8,8,5,5,8,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,14,118,221,247,255,194,127,59,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,94,194,247,255,255,255,255,255,255,255,255,255,139,50,22,
-8,5,8,5,5,5,8,5,5,5,5,8,5,8,5,8,5,5,5,5,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,8,8,8,50,100,202,
-255,255,255,255,255,247,211,179,170,170,170,170,170,161,170,167,170,170,202,247,
-255,255,255,255,255,255,148,5,5,5,5,5,8,5,5,5,5,8,5,5,
-5,14,50,112,224,255,255,255,255,255,255,255,255,255,230,224,224,224,224,224,
-224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,230,248,255,
-255,255,255,255,248,184,100,40,5,14,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,32,170,255,255,239,139,59,
-26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,14,5,5,40,82,179,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,167,68,32,5,8,5,8,5,5,8,5,5,
-5,14,22,32,32,50,82,148,239,255,255,255,255,255,224,148,50,40,32,26,
-26,40,26,32,26,26,32,26,32,26,40,32,32,26,22,5,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,32,59,82,112,118,118,118,118,
-118,118,118,118,118,112,112,112,118,118,140,170,230,255,255,255,255,255,224,179,
-140,118,118,104,68,44,22,5,5,8,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,5,5,5,26,104,179,203,224,224,230,224,224,
-224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,
-224,224,224,224,224,224,224,224,230,224,221,188,148,67,5,5,5,8,5,8,
-14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,118,212,255,255,197,130,59,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,91,179,230,
-255,255,255,255,255,255,255,255,255,148,59,26,5,5,5,5,8,5,14,5,
-8,5,5,8,8,8,14,8,5,8,5,5,8,8,5,5,5,5,5,5,
-5,5,5,14,5,5,8,5,8,50,103,203,255,255,255,255,255,221,167,130,
-103,103,103,103,103,103,103,103,103,103,157,212,255,255,255,255,255,255,148,5,
-5,5,5,8,5,5,5,14,5,8,5,8,5,22,50,118,220,255,255,255,
-255,255,255,255,255,220,163,157,148,148,148,148,148,157,148,148,148,148,148,148,
-148,148,148,148,148,148,148,148,157,167,197,242,255,255,255,255,242,179,109,44,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,32,170,255,255,242,148,67,26,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,
-73,188,255,255,255,255,255,255,255,255,255,255,255,224,203,203,197,197,203,203,
-197,197,197,197,197,197,197,197,197,197,197,197,197,203,197,197,197,197,197,197,
-118,53,26,5,8,5,14,5,5,8,5,8,5,5,5,5,5,22,59,130,
-238,255,255,255,255,255,220,130,26,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,8,8,5,8,5,14,5,8,8,5,
-5,8,5,5,14,32,40,59,59,53,44,59,53,59,44,59,53,59,53,59,
-53,59,82,130,212,255,255,255,255,255,203,148,91,44,59,53,40,22,14,5,
-8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,8,
-8,5,5,22,73,121,139,157,148,148,148,148,148,148,148,148,148,148,148,148,
-148,148,148,148,148,148,148,148,163,148,157,148,148,148,148,157,148,148,157,148,
-148,148,148,127,95,44,5,5,14,5,8,5,5,8,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,121,212,248,255,
-197,127,58,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,82,163,224,255,255,255,255,255,255,255,255,
-255,157,67,26,5,5,5,8,5,5,8,5,5,14,22,26,26,26,8,8,
-8,8,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-14,53,104,211,255,255,255,255,255,188,127,67,32,32,32,32,32,32,26,40,
-32,32,103,194,242,255,255,255,255,255,148,5,5,14,14,5,8,5,5,8,
-5,14,5,5,5,14,58,118,221,255,255,255,255,255,255,255,230,157,77,44,
-50,44,50,40,44,40,50,44,44,44,44,44,44,44,44,44,44,44,44,44,
-50,91,131,221,255,255,255,255,248,179,103,40,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,175,255,
-255,242,148,58,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,8,5,5,5,5,5,32,64,184,255,255,255,255,255,255,
-255,255,255,255,203,118,73,64,58,64,58,58,58,64,58,58,64,58,64,58,
-64,58,58,64,58,64,64,64,58,58,58,64,40,22,14,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,26,64,136,238,255,255,255,255,255,221,131,
-26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,14,8,5,8,5,5,5,5,14,5,5,5,5,14,14,22,
-22,22,22,22,22,22,22,14,22,14,22,22,22,26,58,109,203,255,255,255,
-255,255,194,118,58,22,22,14,14,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,40,40,50,
-44,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,50,44,
-40,44,44,50,44,50,44,44,50,44,50,44,50,44,50,40,32,22,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,8,14,118,212,247,255,194,131,58,5,8,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-8,73,148,212,255,255,255,255,255,255,255,255,255,157,58,32,8,5,5,5,
-5,5,5,5,8,14,26,67,58,40,26,14,5,5,8,5,5,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,14,40,109,211,255,255,255,255,
-255,184,112,40,5,5,5,5,5,5,5,5,5,5,82,188,238,255,255,255,
-255,255,148,14,5,8,5,8,8,5,5,5,5,8,5,5,5,14,53,118,
-221,255,255,255,255,255,255,255,221,148,40,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,44,109,211,255,255,255,255,
-248,176,109,44,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,8,32,175,255,255,248,148,67,26,5,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,26,53,175,255,255,255,255,255,255,255,255,255,242,188,82,22,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,8,5,5,5,5,5,8,5,8,5,8,22,26,
-32,40,77,140,242,255,255,255,255,255,224,148,50,26,26,26,26,26,26,26,
-26,26,26,26,26,26,26,26,26,22,8,14,5,5,8,8,5,8,5,5,
-8,5,5,5,5,5,5,5,22,32,50,67,67,77,73,67,73,67,73,67,
-73,73,67,77,73,73,95,131,221,255,255,255,255,255,188,118,44,8,5,5,
-5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,44,67,73,67,67,67,67,67,67,67,67,67,
-67,67,67,67,67,67,67,67,67,67,67,67,67,73,67,67,67,67,67,67,
-67,67,67,67,73,67,67,67,67,59,50,22,5,5,5,5,5,5,14,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-118,211,255,255,194,127,59,8,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,67,131,202,255,255,255,255,
-255,255,255,255,255,163,86,40,5,5,14,22,26,40,50,67,82,95,118,140,
-118,67,32,14,5,5,5,5,5,8,5,5,14,5,5,5,5,5,8,5,
-5,5,5,5,8,50,103,202,255,255,255,255,255,184,109,40,8,8,5,5,
-5,5,5,5,5,5,82,194,238,255,255,255,255,255,148,5,5,5,5,8,
-5,8,5,5,8,5,5,8,5,22,50,118,221,255,255,255,255,255,255,255,
-230,140,40,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,50,109,211,255,255,255,255,242,179,103,40,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,
-5,32,167,255,255,248,148,67,26,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,8,8,5,8,14,22,163,255,255,
-255,255,255,255,255,255,255,230,179,67,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,5,5,8,5,5,5,22,44,67,59,77,100,167,248,255,255,255,
-255,255,230,163,77,59,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
-67,44,32,14,5,5,5,5,8,5,5,8,5,8,5,5,5,5,5,5,
-40,77,118,163,175,175,175,175,179,175,175,175,175,175,175,175,175,175,184,194,
-242,255,255,255,255,255,188,109,44,5,5,8,5,5,5,8,8,5,5,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,26,
-112,179,175,179,179,175,179,175,179,175,179,175,179,175,179,175,179,175,179,175,
-179,175,179,179,175,175,179,175,179,179,175,179,179,175,179,175,179,179,179,175,
-167,148,109,44,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,118,212,242,255,194,130,59,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,59,109,194,255,255,255,255,255,255,255,255,255,188,109,50,
-5,5,14,32,59,91,130,163,202,221,230,242,188,95,44,14,5,5,8,5,
-8,8,5,5,5,5,5,5,5,5,8,5,5,5,5,5,14,44,100,202,
-255,255,255,255,242,179,109,40,5,5,5,8,5,5,5,5,5,5,91,188,
-239,255,255,255,255,255,148,14,5,5,5,5,5,5,5,5,8,14,5,5,
-8,22,59,118,221,255,255,255,255,255,255,255,224,140,44,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,50,109,211,
-255,255,255,255,247,179,109,40,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,26,175,255,255,247,148,64,
-26,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,8,8,5,5,14,157,255,255,255,255,255,255,255,255,255,230,
-175,73,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,5,8,5,5,5,5,5,5,
-8,35,109,140,139,148,167,202,255,255,255,255,255,255,255,202,148,140,139,139,
-139,139,139,139,139,139,139,139,139,139,139,139,127,100,64,35,5,5,5,5,
-8,5,5,5,8,5,5,5,5,5,8,5,46,109,161,224,233,233,233,233,
-224,238,233,238,233,238,233,233,233,233,233,238,255,255,255,255,255,255,197,130,
-50,5,8,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,14,5,5,5,35,148,233,233,238,229,233,233,233,
-238,229,233,233,238,229,233,233,233,233,238,229,233,233,233,233,233,233,238,229,
-233,238,229,233,233,229,233,233,233,238,229,233,229,197,145,64,5,14,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,118,212,247,255,197,127,59,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,14,5,8,5,50,91,188,
-255,255,255,255,255,255,255,255,255,211,148,95,64,73,95,109,139,161,188,229,
-255,255,255,255,212,109,59,14,5,8,5,5,8,5,5,5,5,5,5,5,
-5,5,8,5,8,5,5,5,14,50,100,211,255,255,255,255,255,184,109,40,
-5,5,5,5,5,5,8,5,5,5,91,188,247,255,255,255,255,255,148,5,
-8,5,5,5,5,5,8,8,5,8,5,14,8,22,50,112,221,255,255,255,
-255,255,255,255,229,145,40,5,5,8,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,49,109,211,255,255,255,255,255,179,109,40,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,35,175,255,255,255,145,64,26,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,
-22,139,248,255,255,255,255,255,255,255,255,233,175,64,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,8,14,5,5,5,58,179,242,242,248,255,255,
-255,255,255,255,255,255,255,255,248,242,242,242,242,242,242,242,242,242,242,242,
-242,242,242,242,233,167,109,50,5,8,5,8,14,5,14,5,5,8,5,5,
-5,5,5,5,50,121,188,242,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,221,161,58,5,14,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,
-5,5,5,40,175,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,229,175,64,5,5,8,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,14,121,221,255,255,
-197,130,58,8,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,8,40,64,175,255,255,255,255,255,255,255,255,
-255,233,188,161,161,179,211,233,242,255,255,255,255,255,255,255,221,109,50,22,
-5,5,8,5,8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,
-14,50,100,203,255,255,255,255,248,184,109,50,5,5,5,8,5,5,5,5,
-5,5,82,188,239,255,255,255,255,255,149,8,5,5,5,14,5,5,5,8,
-8,5,5,5,5,22,50,121,212,255,255,255,255,255,255,255,221,145,40,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,
-14,50,100,211,255,255,255,255,242,179,109,40,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,175,255,
-255,255,149,64,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,5,5,8,121,221,255,255,255,255,255,
-255,255,255,239,175,73,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,64,203,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,197,127,58,
-5,8,5,5,5,5,5,5,5,5,5,14,5,8,5,5,58,127,188,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,248,188,77,8,5,8,5,5,5,5,8,5,5,5,14,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,40,179,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,233,179,77,
-5,8,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,121,212,255,255,197,127,64,5,5,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,22,40,161,255,255,255,255,255,255,255,255,255,255,233,221,212,242,255,255,
-255,255,255,255,255,255,255,255,197,104,40,22,5,5,8,5,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,14,49,100,211,255,255,255,255,
-248,184,104,40,5,5,8,5,5,5,5,5,5,8,82,188,239,255,255,255,
-255,255,149,5,5,5,5,5,5,5,5,8,5,5,8,5,8,22,58,113,
-221,255,255,255,255,255,255,255,229,140,35,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,44,104,206,255,255,255,255,
-255,179,104,40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,35,170,255,255,255,140,64,26,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,17,104,194,242,255,255,255,255,255,255,255,233,170,64,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,5,5,8,8,5,8,5,5,5,5,64,202,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,194,121,58,5,5,8,5,5,5,5,5,
-8,8,5,5,5,5,5,5,58,127,194,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,221,94,17,8,5,
-5,8,5,8,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,17,5,5,5,5,40,179,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,233,179,64,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,
-121,215,255,255,202,127,58,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,17,17,140,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,
-179,77,35,17,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,17,44,100,202,255,255,255,255,242,179,109,40,5,5,5,5,
-5,17,5,5,5,5,86,188,238,255,255,255,255,255,149,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,22,50,109,221,255,255,255,255,255,255,255,
-229,145,40,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,17,26,73,139,188,179,188,179,161,121,73,35,8,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,35,170,255,255,248,149,64,26,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,94,161,229,
-255,255,255,255,255,255,255,247,188,77,5,8,5,5,5,17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,50,170,233,233,238,247,255,255,255,255,255,
-255,255,255,255,255,255,255,255,248,247,229,229,233,229,233,233,233,229,233,233,
-229,161,109,50,5,8,17,5,5,5,5,8,5,8,5,5,5,5,8,17,
-40,94,149,197,212,229,248,255,255,255,255,255,255,255,242,206,212,203,212,203,
-206,212,242,255,255,255,255,238,127,50,22,5,8,5,5,17,5,8,5,8,
-5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,40,
-179,255,255,255,255,255,255,255,255,255,255,255,238,233,233,233,229,233,233,233,
-233,233,233,233,233,238,229,233,233,238,229,233,229,229,233,233,233,233,233,233,
-233,197,145,64,5,5,5,5,17,5,5,17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,17,118,221,248,255,197,130,67,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,5,5,22,35,46,67,167,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,242,224,212,188,161,109,46,22,5,5,5,5,5,
-5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,46,100,206,
-255,255,255,255,242,188,109,40,5,5,5,5,5,5,5,5,5,5,82,188,
-238,255,255,255,255,255,157,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,50,113,224,255,255,255,255,255,255,255,220,140,40,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,22,40,
-50,50,50,50,40,35,22,17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,13,17,5,35,167,255,255,242,148,67,
-26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,67,130,211,255,255,255,255,255,255,255,255,
-211,82,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,40,118,163,163,170,179,212,255,255,255,255,255,255,255,255,255,255,255,238,
-188,179,163,167,170,163,163,163,163,163,170,163,163,113,77,35,5,14,14,5,
-5,5,5,14,5,5,5,5,5,14,5,5,22,50,77,100,121,148,211,255,
-255,255,255,255,255,255,179,109,100,109,100,109,109,121,188,242,255,255,255,242,
-167,109,40,14,5,14,5,14,5,14,5,14,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,14,49,179,255,255,255,255,255,255,255,
-255,255,255,229,179,167,163,167,163,175,163,163,167,163,167,163,163,163,167,163,
-167,163,167,167,167,167,163,163,163,163,163,163,157,139,109,49,5,5,5,5,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,121,212,255,255,197,127,58,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,40,73,112,148,211,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,229,188,
-140,109,77,49,35,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,49,103,211,255,255,255,255,255,197,140,85,
-58,58,58,58,58,49,58,58,58,49,121,203,242,255,255,255,255,255,148,5,
-13,5,17,5,5,5,5,13,5,5,5,5,13,22,49,121,220,255,255,255,
-255,255,255,255,229,148,49,5,13,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,17,5,26,139,229,242,220,130,58,26,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,13,5,13,5,5,
-5,40,94,197,255,255,255,255,255,255,255,255,220,85,17,13,5,5,5,5,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,22,67,94,94,109,130,179,
-242,255,255,255,255,255,255,255,255,255,255,220,157,121,94,103,94,103,94,94,
-94,94,94,94,85,67,49,26,5,5,17,8,5,5,5,8,8,5,5,8,
-5,5,8,5,17,26,35,49,77,103,179,255,255,255,255,255,255,255,148,58,
-49,49,49,49,49,67,121,179,238,255,255,255,215,157,73,26,8,8,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,17,26,26,
-35,35,35,35,26,35,26,35,35,26,35,35,26,35,26,35,35,26,35,26,
-35,26,26,35,26,26,26,22,22,5,5,5,5,5,5,5,8,8,5,8,
-17,5,5,40,157,255,255,255,255,255,255,255,255,255,248,197,130,86,103,86,
-103,94,94,103,94,94,94,94,86,103,94,94,103,86,103,94,103,86,103,103,
-94,94,94,94,103,77,67,26,17,5,5,8,5,8,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,118,212,255,255,
-197,130,58,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,22,26,86,157,184,211,242,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,238,221,197,170,148,109,77,49,26,17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-17,49,103,203,255,255,255,255,255,224,179,148,127,127,127,127,127,121,121,121,
-130,121,157,224,255,255,255,255,255,255,148,5,5,8,5,5,5,5,5,5,
-5,8,5,5,5,22,49,121,221,255,255,255,255,255,255,255,224,140,40,8,
-5,8,17,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,22,94,148,
-188,179,109,49,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,17,17,22,49,179,255,255,255,255,
-255,255,255,255,224,94,17,8,8,5,8,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,17,22,22,26,40,77,148,242,255,255,255,255,255,255,255,
-255,255,255,203,109,67,26,26,26,26,22,26,26,26,26,26,26,17,17,17,
-8,5,8,5,17,8,5,8,5,5,5,8,5,17,5,8,5,5,17,17,
-40,82,167,255,255,255,255,255,255,255,127,8,22,17,17,17,8,22,49,103,
-194,255,255,255,255,215,121,49,22,5,5,5,8,5,5,5,17,5,8,5,
-5,5,17,5,5,5,17,5,8,32,49,58,67,67,67,67,67,67,67,58,
-67,67,58,67,67,58,67,67,58,67,67,58,67,67,67,67,67,67,49,40,
-22,8,5,5,5,5,5,8,5,5,5,8,5,5,5,32,139,229,255,255,
-255,255,255,255,255,255,242,170,67,26,26,26,22,26,26,26,22,26,26,26,
-26,26,22,26,26,22,26,22,26,26,22,26,22,26,22,26,22,22,22,17,
-8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,17,118,221,248,255,194,130,49,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,58,140,
-242,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,215,170,130,
-100,58,40,26,22,17,17,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,17,49,100,211,255,255,255,255,
-255,242,229,203,188,194,194,194,188,194,194,194,194,194,215,248,255,255,255,255,
-255,255,148,5,5,5,8,5,5,5,5,5,5,8,5,5,5,22,49,109,
-221,255,255,255,255,255,255,255,224,148,49,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,17,49,94,109,113,73,26,17,17,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,5,5,5,8,17,32,148,255,255,255,255,255,255,255,255,229,118,40,22,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,58,130,238,255,255,255,255,255,255,255,255,255,255,203,118,58,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,17,8,5,5,8,5,8,5,5,5,32,64,163,255,255,255,255,255,
-255,255,130,8,5,5,5,5,8,8,17,50,127,194,229,255,255,247,188,127,
-82,58,50,22,17,8,8,5,5,8,8,5,5,5,8,5,5,5,8,5,
-17,64,118,130,148,145,148,145,148,145,148,148,148,148,148,148,148,148,148,148,
-148,148,148,148,148,148,148,148,148,148,118,82,50,17,8,8,5,8,5,5,
-5,5,5,8,5,5,5,26,118,203,248,255,255,255,255,255,255,255,255,184,
-67,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,17,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-118,212,255,255,194,130,67,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,32,73,158,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,212,179,139,100,77,40,17,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,17,50,100,203,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,149,5,5,5,5,8,
-8,5,8,17,8,5,5,5,5,22,50,118,220,255,255,255,255,255,255,255,
-220,145,40,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
-5,8,22,22,26,32,22,17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,17,5,5,5,5,22,125,
-211,255,255,255,255,255,255,255,242,139,58,26,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,26,58,130,242,255,255,255,
-255,255,255,255,255,255,255,212,145,82,5,14,5,5,8,5,5,5,5,5,
-5,8,14,8,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,32,73,158,255,255,255,255,255,255,255,130,5,5,5,5,5,
-5,5,14,22,50,95,170,229,255,255,255,224,179,130,82,50,22,5,5,8,
-8,8,5,8,5,5,5,5,5,5,5,5,5,109,193,224,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,248,255,248,255,255,255,255,
-255,255,203,145,73,14,5,14,14,5,14,5,5,5,5,14,5,5,5,26,
-109,179,242,255,255,255,255,255,255,255,255,203,82,14,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,14,118,220,255,255,197,125,58,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,40,73,158,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,158,
-77,49,26,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,49,95,211,
-255,255,255,255,255,255,248,238,224,229,224,229,224,224,224,224,224,224,242,255,
-255,255,255,255,255,255,149,5,5,5,5,5,5,5,5,5,5,5,14,5,
-5,14,40,100,212,255,255,255,255,255,255,255,247,158,49,14,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,14,5,14,49,73,67,49,26,14,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,14,5,14,5,5,5,5,14,5,14,95,163,224,255,255,255,255,255,255,
-247,172,95,40,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,22,58,130,238,255,255,255,255,255,255,255,255,255,255,224,
-163,95,14,5,5,5,5,5,5,5,5,5,5,14,14,14,14,5,5,5,
-5,14,5,14,5,5,5,5,5,5,5,5,14,5,5,5,26,49,140,255,
-255,255,255,255,255,255,140,22,14,5,5,5,5,5,5,5,22,44,100,149,
-188,212,229,224,211,179,163,125,58,32,14,5,14,5,5,5,14,5,5,5,
-5,5,5,5,5,109,188,229,255,247,255,248,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,248,255,247,255,203,140,76,14,8,8,
-8,5,5,14,5,5,8,8,5,14,5,22,82,149,229,255,255,255,255,255,
-255,255,255,229,113,50,22,5,5,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,8,5,
-14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,118,212,247,255,197,130,58,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,32,73,161,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,161,86,40,5,5,8,5,5,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,50,100,203,255,255,255,255,255,238,203,179,
-161,161,161,161,161,161,161,161,161,161,188,247,255,255,255,255,255,255,149,5,
-5,14,5,5,14,5,5,5,5,8,5,8,8,8,22,82,203,255,255,255,
-255,255,255,255,255,188,64,14,14,5,8,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,5,5,22,109,167,145,113,58,22,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,8,
-8,8,14,50,109,203,255,255,255,255,255,255,255,197,130,50,8,8,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,22,64,130,
-242,255,255,255,255,255,255,255,255,255,255,230,179,95,14,5,5,8,8,5,
-5,5,8,5,5,5,5,14,5,5,5,8,14,5,5,5,8,8,5,5,
-5,5,5,5,5,5,5,8,5,14,121,255,255,255,255,255,255,255,149,32,
-22,5,8,14,5,5,5,8,8,14,22,49,86,125,172,197,212,230,242,211,
-130,64,22,5,5,5,5,5,5,5,8,5,5,5,5,5,14,86,167,197,
-220,220,220,212,220,212,220,212,220,212,220,212,220,212,220,212,220,220,220,220,
-220,220,220,220,220,220,179,121,64,14,5,5,5,5,5,5,5,8,8,5,
-8,5,5,14,58,109,212,255,255,255,255,255,255,255,255,239,161,94,26,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,8,14,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,121,220,255,255,
-197,125,58,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,40,64,167,255,255,255,255,255,255,239,255,255,255,255,255,
-255,255,255,203,130,58,5,5,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,49,100,211,255,255,255,255,255,212,167,109,86,86,86,86,86,86,86,86,
-86,94,145,212,255,255,255,255,255,255,149,5,5,5,5,8,5,5,8,5,
-5,14,5,5,5,14,14,64,188,255,255,255,255,255,255,255,255,203,94,40,
-8,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,26,139,224,
-203,179,94,32,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,8,8,5,8,5,5,8,5,8,14,26,58,172,255,255,
-255,255,255,255,255,233,172,76,22,5,8,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,5,26,58,130,239,255,255,255,255,255,255,255,
-255,255,255,242,203,109,8,5,5,5,8,5,5,5,8,14,5,5,5,5,
-5,8,5,5,5,5,14,5,5,5,8,5,5,5,14,5,5,5,5,8,
-5,8,94,203,248,255,255,255,255,255,163,64,32,8,5,8,8,5,5,8,
-5,5,5,14,49,64,94,118,130,157,167,145,85,49,22,5,5,5,8,5,
-5,5,5,8,14,5,5,5,5,58,100,118,127,130,130,139,130,130,130,130,
-130,130,130,130,130,130,130,130,130,130,127,130,130,130,130,127,130,127,100,76,
-40,8,5,14,5,5,5,5,5,5,5,8,5,5,5,14,32,76,188,255,
-255,255,255,255,255,255,255,255,212,130,49,14,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,8,14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,118,212,255,255,194,131,64,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,73,145,
-238,233,212,203,179,157,157,212,255,255,255,255,255,255,255,238,179,85,14,8,
-5,14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,49,100,203,255,255,255,255,
-255,188,118,58,22,22,22,22,22,22,22,22,22,22,94,194,242,255,255,255,
-255,255,149,5,5,5,5,8,8,5,8,5,8,5,5,5,8,8,5,49,
-175,242,255,255,255,255,255,255,255,229,149,76,22,8,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,32,157,255,255,238,139,58,26,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,8,8,5,5,5,8,8,32,139,229,255,255,255,255,255,255,255,220,94,
-31,22,5,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,64,131,242,255,255,255,255,255,255,255,255,255,255,255,238,127,8,5,
-5,5,5,5,5,8,8,5,5,5,5,5,5,5,8,5,5,5,5,5,
-8,5,8,5,5,5,5,5,5,5,5,5,5,8,73,149,211,255,255,255,
-255,255,184,104,41,5,5,5,5,5,5,8,5,8,5,14,14,14,22,31,
-31,31,32,32,22,14,5,5,5,5,8,5,8,8,5,5,5,5,5,5,
-8,22,22,31,31,32,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
-31,31,32,31,31,31,31,31,31,31,22,22,8,5,5,5,5,8,5,8,
-5,5,8,5,5,5,5,5,14,41,167,255,255,255,255,255,255,255,255,255,
-255,179,67,14,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,8,5,8,5,5,8,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-118,212,255,255,194,131,53,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,32,67,131,194,163,131,94,49,49,53,163,
-255,255,255,255,255,255,255,255,220,104,26,22,8,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,49,94,211,255,255,255,255,255,179,112,41,5,5,5,5,
-5,5,5,5,8,5,85,188,242,255,255,255,255,255,148,5,5,5,5,14,
-5,5,5,5,5,5,5,5,5,5,8,41,121,194,247,255,255,255,255,255,
-255,247,194,121,32,14,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,32,170,255,255,247,145,58,26,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,5,5,8,
-14,104,170,233,255,255,255,255,255,255,247,148,76,32,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,26,58,131,233,255,255,255,
-255,255,255,255,255,255,255,255,255,163,40,22,5,5,8,8,5,5,8,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,8,5,5,14,8,5,5,
-5,5,5,8,8,5,46,94,179,255,255,255,255,255,203,145,67,14,5,5,
-5,5,8,8,8,8,5,5,5,5,5,8,5,5,8,5,5,5,5,8,
-5,5,14,8,5,5,5,8,5,5,8,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,8,5,8,5,5,8,5,5,5,5,5,8,5,5,5,
-5,32,121,194,255,255,255,255,255,255,255,255,255,212,121,58,22,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,5,5,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,118,212,255,255,194,127,58,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,22,40,76,112,94,67,40,22,14,22,131,212,255,255,255,255,255,255,255,
-247,163,94,40,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,46,100,203,
-255,255,255,255,255,179,112,46,5,5,5,5,5,5,8,5,5,8,86,188,
-233,255,255,255,255,255,148,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,22,67,127,233,255,255,255,255,255,255,255,255,167,58,14,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,5,8,5,32,167,255,255,247,148,67,
-26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,22,58,131,211,255,255,255,255,
-255,255,255,211,139,46,5,5,17,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,22,67,127,239,255,255,255,255,255,255,255,255,255,255,255,
-255,175,73,40,5,5,8,5,8,17,5,5,8,8,17,5,5,5,17,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,26,46,
-148,255,255,255,255,255,239,188,94,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,8,17,5,5,5,8,5,5,5,5,8,5,17,8,5,5,
-5,8,8,17,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,17,
-5,5,5,5,5,5,5,5,8,8,8,5,8,22,73,131,224,255,255,255,
-255,255,255,255,255,247,188,109,35,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,17,127,212,255,255,197,131,58,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,17,8,22,22,22,22,8,
-5,5,17,82,163,224,255,255,255,255,255,255,255,224,163,58,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,46,100,203,255,255,255,255,255,179,112,40,
-5,5,5,5,8,5,5,5,5,5,82,188,247,255,255,255,255,255,148,5,
-5,5,5,5,5,5,17,5,5,5,5,5,5,5,5,17,32,94,197,255,
-255,255,255,255,255,255,255,203,118,58,17,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,26,175,255,255,247,145,67,26,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,8,82,139,220,255,255,255,255,255,255,255,247,188,100,40,22,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,26,58,131,
-239,255,255,255,255,255,255,255,255,255,255,255,255,211,131,67,8,5,8,8,
-5,5,5,8,5,8,8,5,5,5,5,8,5,5,8,5,5,8,5,5,
-5,5,8,5,5,5,5,8,5,5,17,26,112,206,247,255,255,255,255,230,
-118,26,22,5,8,14,5,5,14,5,8,5,5,5,5,5,5,5,8,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,5,5,14,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-8,5,5,8,5,14,40,86,175,247,255,255,255,255,255,255,255,255,230,163,
-82,32,14,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,118,212,255,255,
-197,127,58,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,8,5,8,5,8,50,94,179,255,255,
-255,255,255,255,255,255,206,112,50,22,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,50,100,203,255,255,255,255,255,184,112,46,5,8,5,5,5,5,5,5,
-5,5,94,188,239,255,255,255,255,255,148,5,5,5,5,5,5,8,5,5,
-5,5,8,14,8,5,5,5,14,58,163,230,255,255,255,255,255,255,255,242,
-194,112,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,32,175,255,
-255,255,148,67,26,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,5,8,14,5,5,8,22,109,179,238,
-255,255,255,255,255,255,255,255,230,140,82,26,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,26,67,131,238,255,255,255,255,255,255,255,
-255,255,255,255,255,230,188,94,8,5,8,5,5,8,5,8,5,8,5,5,
-5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,14,73,148,212,255,255,255,255,255,158,64,32,5,5,8,5,5,
-8,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,8,5,5,5,5,5,5,5,8,5,14,8,5,5,8,5,40,
-131,203,251,255,255,255,255,255,255,255,255,212,127,73,22,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-14,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,118,212,255,255,194,131,58,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,5,5,5,5,8,8,14,32,140,238,255,255,255,255,255,255,255,242,158,
-94,40,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,49,100,211,255,255,255,255,
-251,179,109,49,5,8,8,5,5,5,5,5,5,5,82,194,242,255,255,255,
-255,255,148,5,5,5,5,8,5,8,5,5,5,5,5,8,5,5,5,5,
-5,32,100,158,224,255,255,255,255,255,255,255,230,167,82,40,17,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,35,175,255,255,242,148,58,26,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,8,5,5,35,58,148,224,255,255,255,255,255,255,255,255,255,
-255,203,148,82,40,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,22,58,127,238,255,255,255,255,255,242,230,230,251,255,255,255,255,224,131,
-49,22,5,17,5,5,8,8,5,5,5,5,5,5,5,5,8,5,5,17,
-5,5,5,8,5,5,5,8,5,5,5,8,5,5,5,5,40,82,167,255,
-255,255,255,255,203,140,67,17,17,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,17,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,5,5,5,5,5,5,17,5,5,5,8,
-5,5,8,5,5,5,5,5,5,5,8,26,77,140,212,255,255,255,255,255,
-255,255,255,255,197,139,77,46,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-118,212,242,255,197,118,67,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,5,
-17,94,163,224,255,255,255,255,255,255,255,212,163,94,40,22,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,17,46,100,203,255,255,255,255,255,184,109,40,5,5,5,5,
-5,8,17,5,5,5,86,188,230,255,255,255,255,255,148,8,5,5,5,5,
-8,5,8,5,5,5,8,8,5,5,5,5,5,17,26,86,188,242,255,255,
-255,255,255,255,255,221,148,82,22,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,35,175,255,255,255,140,67,26,5,8,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,17,5,5,8,8,5,5,5,17,49,
-109,194,255,255,255,255,255,255,255,255,255,255,255,255,224,139,73,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,26,58,131,238,255,255,255,
-255,255,221,194,175,212,255,255,255,255,255,175,73,40,5,5,8,5,8,5,
-5,5,5,5,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-17,5,5,5,8,8,8,17,17,17,118,224,255,255,255,255,255,230,118,22,
-17,5,5,5,5,17,5,5,5,5,5,8,5,5,5,5,5,5,8,8,
-5,8,8,17,5,5,8,8,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,5,5,
-5,5,5,5,5,5,8,8,8,5,5,5,5,17,5,8,5,5,5,5,
-5,5,5,17,26,73,179,238,255,255,255,255,255,255,255,255,255,221,139,77,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,17,125,212,255,255,194,125,58,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,17,8,5,5,5,17,40,86,179,255,255,255,255,
-255,255,255,255,233,148,82,35,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,46,100,203,
-255,255,255,255,251,184,113,40,5,5,5,5,5,8,8,5,5,5,82,188,
-238,255,255,255,255,255,148,8,5,5,5,8,5,5,5,5,5,8,5,5,
-5,5,5,8,5,5,17,46,109,167,212,251,255,255,255,255,255,247,211,158,
-94,50,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,26,176,255,255,255,145,59,
-26,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,14,5,5,5,8,5,14,22,109,176,233,255,255,255,255,255,255,
-255,255,255,255,255,255,255,203,157,94,59,22,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,22,59,131,238,255,255,255,255,255,220,167,104,157,224,255,
-255,255,255,220,149,82,14,14,14,5,14,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,14,5,5,5,5,5,5,14,5,
-5,5,73,145,202,255,255,255,255,255,176,104,50,14,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,8,5,5,5,8,5,8,5,5,5,5,5,
-5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,8,5,5,5,5,14,5,5,8,40,100,157,
-211,247,255,255,255,255,255,255,255,247,202,161,104,59,22,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,118,220,251,255,197,125,59,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,8,5,22,50,113,176,233,255,255,255,255,255,255,255,202,157,100,
-59,22,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,49,100,211,255,255,255,255,247,184,109,40,
-8,5,5,5,5,8,8,5,5,5,94,188,233,255,255,255,255,255,149,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,
-26,77,149,215,255,255,255,255,255,255,255,224,172,94,17,5,8,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,17,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,32,172,255,255,248,149,59,32,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,
-5,17,32,149,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-233,172,109,49,17,17,5,5,5,8,5,17,5,5,5,5,5,5,5,5,
-5,5,8,8,5,5,5,8,5,8,5,5,5,5,5,8,5,26,59,131,
-239,255,255,255,255,255,220,131,32,82,172,224,255,255,255,255,233,131,22,17,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,22,32,139,230,255,255,
-255,255,247,188,94,22,17,5,8,5,8,5,5,5,5,5,8,8,5,5,
-8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,17,8,17,5,5,17,5,8,8,17,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,8,5,5,5,5,5,5,5,8,26,67,149,203,255,255,255,255,255,255,
-255,255,255,239,194,118,40,17,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,5,17,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,118,212,255,255,
-194,127,59,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,40,
-94,188,255,255,255,255,255,255,255,255,247,179,109,40,5,5,5,8,8,5,
-5,5,5,5,5,5,5,17,5,8,5,5,8,5,5,8,17,5,5,5,
-8,49,94,203,255,255,255,255,255,203,149,94,67,67,67,73,67,73,67,73,
-67,67,130,212,247,255,255,255,255,255,149,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,17,32,82,130,188,230,255,255,
-255,255,255,255,230,172,109,82,40,22,8,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,172,255,
-255,247,149,59,32,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,17,5,5,59,118,203,255,255,255,255,
-255,255,255,220,194,203,220,255,255,255,255,255,255,230,188,139,103,59,40,22,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,8,8,5,17,8,5,5,5,26,59,130,239,255,255,255,255,255,220,130,
-26,40,103,157,230,255,255,255,255,184,113,67,26,22,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,17,17,77,139,203,255,255,255,255,239,172,109,67,26,
-22,5,5,5,5,5,8,5,17,5,5,5,5,5,8,5,8,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
-5,5,5,8,8,8,5,17,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,8,5,8,5,8,5,5,8,
-5,5,17,40,77,118,172,212,255,255,255,255,255,255,255,255,239,188,140,103,
-73,40,17,8,5,5,5,5,5,8,5,5,5,17,5,5,5,5,17,8,
-5,5,17,5,8,5,5,5,8,17,8,5,5,5,8,5,5,17,5,5,
-5,5,5,8,5,5,5,17,109,194,221,239,179,118,50,8,5,5,5,5,
-5,5,5,5,5,8,5,5,17,5,5,5,5,8,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,22,44,121,179,230,255,255,255,255,
-255,255,255,230,188,139,94,67,40,22,17,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,8,5,5,5,17,44,103,203,255,255,255,255,
-255,230,194,157,131,139,139,139,139,139,139,140,139,139,172,233,255,255,255,255,
-255,255,149,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,17,50,109,179,242,255,255,255,255,255,255,255,230,161,
-73,40,5,5,17,8,8,5,5,5,8,5,17,5,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,17,26,172,255,255,255,149,59,26,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-17,5,5,8,22,113,203,242,255,255,255,255,255,255,248,161,103,113,149,221,
-255,255,255,255,255,255,255,238,188,121,73,32,17,5,5,5,8,8,8,5,
-5,5,5,17,5,5,8,8,5,5,5,5,5,5,5,8,5,8,5,5,
-5,26,59,136,242,255,255,255,255,255,221,131,26,5,17,85,172,230,255,255,
-255,248,221,131,50,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,17,8,5,5,8,8,8,5,5,5,5,8,5,
-26,40,140,233,255,255,255,255,242,212,131,64,26,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,8,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,17,8,8,8,8,8,5,5,8,5,5,17,32,85,140,
-224,255,255,255,255,255,255,255,255,255,255,203,140,85,26,17,5,5,8,8,
-8,8,8,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,8,
-5,5,8,8,8,5,5,5,5,8,5,8,5,5,8,8,8,5,5,8,
-103,157,188,203,149,103,50,17,5,5,5,5,8,8,5,8,8,8,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,22,50,94,179,255,255,255,255,255,255,255,255,255,242,188,127,
-77,40,17,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,8,49,94,211,255,255,255,255,255,242,233,212,203,203,203,203,
-211,203,203,211,203,203,224,255,255,255,255,255,255,255,149,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,8,22,
-59,94,140,188,221,248,255,255,255,255,255,211,179,140,118,103,77,64,59,49,
-40,40,40,40,32,40,40,49,32,22,5,14,5,8,5,8,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,26,157,255,255,255,140,64,26,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,40,64,157,242,255,
-255,255,255,255,255,255,203,113,59,59,82,127,170,212,242,255,255,255,255,255,
-233,197,167,140,109,94,82,73,73,64,64,73,73,82,94,109,59,5,5,5,
-5,5,14,8,5,8,5,8,5,5,5,5,5,26,59,131,238,255,255,255,
-255,255,220,131,26,5,5,50,95,148,202,233,255,255,255,202,158,109,64,32,
-22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,
-5,5,5,5,5,8,5,5,5,8,5,5,5,14,77,127,175,220,248,255,
-255,247,202,158,109,77,50,40,40,40,40,32,14,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,8,5,14,5,5,8,5,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-14,5,5,5,5,5,5,5,5,14,40,77,131,167,197,229,255,255,255,255,
-255,255,255,247,206,175,140,118,95,82,59,50,40,46,40,40,40,40,40,46,
-50,46,32,22,5,5,5,14,5,5,5,5,14,5,5,8,8,5,5,8,
-8,5,5,14,5,5,5,8,5,5,5,8,46,95,109,113,82,46,26,5,
-5,5,5,14,8,8,5,5,5,5,5,5,5,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,50,103,
-161,194,233,255,255,255,255,255,255,255,247,202,175,148,131,109,95,82,73,73,
-73,73,67,73,50,40,22,5,5,5,5,5,8,5,5,5,14,50,109,203,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,148,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,14,22,46,95,158,220,255,255,
-255,255,255,255,255,255,238,188,148,127,104,95,73,73,73,76,76,67,76,73,
-59,26,5,8,8,5,5,8,8,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,5,32,140,238,255,248,140,67,
-26,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,67,131,215,255,255,255,255,255,255,255,224,167,73,
-5,14,14,26,73,140,203,255,255,255,255,255,255,255,255,255,220,179,157,140,
-139,139,140,139,140,161,188,215,104,5,5,14,5,5,5,8,5,5,5,5,
-5,5,8,5,5,26,59,131,242,255,255,255,255,255,220,131,26,5,5,5,
-14,59,118,188,255,255,255,255,255,194,131,67,14,14,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,14,5,5,5,5,
-5,14,5,8,14,5,5,22,95,161,220,255,255,255,255,255,203,161,103,73,
-73,73,67,50,22,8,8,5,5,5,5,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,5,8,5,5,5,
-5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,14,26,67,112,167,224,255,255,255,255,255,255,255,255,255,255,230,
-188,157,118,95,73,73,67,73,73,73,76,95,104,82,67,26,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,8,8,5,8,5,
-5,5,5,5,14,5,14,14,8,8,5,5,5,8,5,5,5,5,5,5,
-5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,5,14,22,50,118,179,242,255,255,255,255,
-255,255,255,255,255,255,248,220,188,161,148,140,139,139,139,139,104,76,40,5,
-5,5,5,5,8,5,8,5,5,40,76,161,215,215,220,215,220,215,215,215,
-220,215,215,215,220,215,215,211,215,220,215,215,215,215,215,215,215,220,118,5,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,14,22,46,94,118,148,179,202,224,238,255,255,255,255,242,
-212,202,188,179,170,170,170,170,167,167,157,112,82,35,5,5,8,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,22,76,127,148,140,86,49,22,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,26,109,
-188,238,255,255,255,255,255,255,255,167,94,40,5,5,8,14,35,76,112,148,
-170,197,220,238,255,255,255,255,255,224,220,202,211,202,202,211,202,197,202,202,
-94,5,5,5,5,5,5,8,8,5,8,5,8,5,5,5,5,26,59,131,
-238,255,255,255,255,255,212,136,26,5,5,5,5,35,59,103,145,188,220,238,
-255,230,197,157,104,49,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,8,5,8,5,14,8,5,5,5,5,8,5,5,5,14,
-49,86,118,161,179,203,230,230,230,203,179,170,170,167,167,118,49,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,8,5,5,5,5,8,5,5,8,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,8,8,26,59,94,
-118,148,167,188,211,229,242,255,255,255,255,255,238,212,203,179,170,170,167,170,
-170,179,170,170,161,118,76,35,5,8,5,5,5,14,5,5,5,8,8,5,
-5,5,5,8,5,5,5,5,8,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,14,8,5,8,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,26,59,103,145,175,197,220,229,255,255,255,255,255,255,255,248,
-229,220,212,203,203,211,185,148,109,67,35,5,5,5,14,5,8,5,5,5,
-14,26,50,103,148,148,148,145,145,148,148,145,148,148,145,148,145,145,148,148,
-148,145,148,145,148,148,148,148,148,148,76,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,14,
-5,14,26,68,118,161,188,229,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,229,161,94,40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,22,
-22,26,26,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,22,50,157,255,255,255,255,255,255,255,255,
-229,112,26,8,5,5,8,5,8,5,14,22,58,109,157,197,229,255,255,255,
-255,255,255,255,255,255,255,255,255,242,211,170,85,5,5,5,5,5,5,8,
-5,5,5,8,5,14,5,5,5,26,58,136,239,255,255,255,255,255,220,131,
-26,5,5,5,5,8,8,22,26,91,148,197,248,255,255,239,188,85,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,
-5,5,5,8,5,8,5,5,5,8,5,5,5,14,14,35,85,127,161,211,
-239,255,255,255,255,255,255,197,67,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,14,5,8,14,
-5,8,5,8,5,8,5,5,8,8,14,5,14,26,50,94,136,170,211,239,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,248,224,157,103,40,
-5,5,8,5,5,5,5,14,8,5,5,5,5,5,5,8,5,5,8,5,
-5,5,5,5,5,5,5,8,8,8,5,5,5,8,5,8,5,5,8,5,
-8,5,8,8,8,5,5,8,5,5,5,5,8,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,40,
-67,109,148,188,229,255,255,255,255,255,255,255,255,255,255,255,255,255,224,161,
-113,58,35,5,5,5,5,5,5,5,8,8,5,22,26,58,76,76,68,85,
-85,68,76,76,76,76,76,76,76,76,76,68,76,76,76,76,76,76,76,76,
-76,76,50,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,40,67,85,103,118,
-136,148,163,167,179,179,179,184,179,184,179,163,148,140,127,82,59,22,5,5,
-5,5,5,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,14,5,5,5,5,5,14,14,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,26,40,109,170,179,179,184,179,179,179,163,136,67,8,14,5,5,8,5,
-5,5,5,14,26,59,82,109,118,140,163,167,179,179,179,179,184,179,167,163,
-140,131,113,91,44,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,22,40,82,148,179,179,184,179,163,140,82,22,8,8,5,5,5,5,14,
-14,44,76,109,131,163,167,148,118,50,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,8,5,5,
-5,5,5,5,5,5,14,22,40,67,82,109,131,140,157,163,157,140,140,109,
-40,5,5,5,5,5,5,8,5,5,8,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,5,5,8,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,14,
-5,5,5,5,5,14,26,50,68,91,109,127,140,157,163,179,179,179,179,179,
-179,179,179,179,179,163,157,140,118,82,50,22,5,8,5,5,5,5,5,5,
-8,5,8,5,8,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,5,8,5,5,5,8,5,8,5,5,8,5,5,
-5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,22,35,50,76,103,118,136,157,167,
-170,179,179,184,179,179,170,157,148,148,118,94,59,35,22,5,5,5,5,5,
-5,8,5,8,5,5,14,5,5,5,5,5,5,5,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,14,26,50,76,76,76,76,
-76,76,68,35,8,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,
-5,8,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,5,5,5,8,22,44,59,76,76,76,76,
-68,76,68,59,40,26,5,8,5,8,14,5,14,5,5,5,5,5,5,5,
-8,5,26,50,68,76,76,76,76,76,50,22,14,5,5,8,5,5,8,14,
-5,8,5,8,5,5,5,5,5,5,5,5,5,14,22,40,67,76,76,76,
-68,76,67,35,14,5,14,8,5,5,5,5,5,14,5,5,14,26,59,50,
-40,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,8,5,14,8,5,14,8,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,8,35,40,14,8,14,14,5,5,5,5,8,5,5,8,
-8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,8,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,
-5,5,14,8,8,26,40,59,76,82,82,76,76,82,68,82,68,44,22,14,
-5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,8,5,5,14,5,
-8,5,5,14,8,5,5,5,5,5,5,5,5,14,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,8,5,8,5,5,5,14,22,50,67,68,76,76,76,76,50,35,
-22,5,14,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,
-5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,8,8,5,5,5,5,8,5,
-5,5,5,5,5,14,14,26,40,35,40,40,35,35,40,22,8,5,5,5,
-8,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,22,26,35,40,40,40,35,35,40,40,35,22,14,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,8,5,22,26,40,35,40,40,
-40,35,26,14,14,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,14,8,22,40,35,40,40,35,35,26,22,8,5,5,8,
-5,5,5,5,5,5,5,5,5,22,26,26,22,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,14,5,5,14,5,5,5,5,5,5,5,5,5,22,22,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,8,5,5,5,5,8,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,14,22,35,
-40,40,40,40,40,40,40,40,35,22,14,8,5,5,5,5,5,5,8,5,
-5,5,14,5,5,14,5,5,8,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,8,5,
-5,14,5,5,8,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,5,8,8,
-8,5,14,26,26,40,35,40,35,35,35,14,14,8,5,5,5,5,5,5,
-5,5,5,5,5,5,14,8,5,8,5,5,5,5,5,8,5,5,5,5,
-5,5,5,8,5,8,5,5,5,14,5,5,5,8,5,5,8,8,8,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,14,8,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,8,8,5,5,5,
-5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,14,5,8,5,5,5,8,5,5,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,
-5,5,5,5,5,8,5,5,5,8,5,8,5,8,5,8,5,5,5,5,
-8,5,5,5,8,5,5,5,5,8,5,5,5,5,5,8,5,8,5,5,
-5,8,8,8,8,5,5,5,5,8,8,5,8,8,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,14,5,5,5,8,5,5,5,5,5,5,5,5,14,14,
-5,5,5,5,5,8,5,5,5,8,5,5,5,8,5,5,5,5,5,8,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,8,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,8,8,5,8,8,5,5,8,5,8,8,5,5,8,5,5,5,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,5,
-5,8,5,5,8,5,14,5,8,14,8,5,5,8,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,14,5,5,
-5,5,5,8,8,8,5,5,8,8,14,5,5,5,5,5,8,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,8,14,22,40,40,44,40,40,40,40,40,22,14,8,5,22,40,
-40,44,40,40,26,22,8,5,5,8,5,14,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,5,8,14,8,
-5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,8,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,8,5,8,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,8,5,5,5,14,5,5,5,14,5,5,14,22,35,40,40,44,
-40,40,40,44,40,44,44,44,44,40,40,44,26,14,14,5,5,5,5,5,
-5,14,35,40,40,40,40,40,40,40,40,44,40,40,40,44,40,44,35,44,
-40,40,40,44,40,40,44,40,44,40,44,40,40,40,44,40,40,22,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,26,40,40,40,44,
-40,40,44,40,40,40,40,44,40,40,44,40,44,40,40,40,40,40,40,40,
-40,44,40,40,44,40,40,35,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,35,40,44,40,44,40,44,40,26,22,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,14,35,40,
-40,40,40,40,40,40,44,40,40,40,44,44,40,40,44,40,44,40,40,40,
-40,40,44,40,40,40,44,40,40,40,44,40,40,40,40,26,14,5,5,8,
-8,5,8,5,5,5,5,5,5,8,5,5,14,22,35,40,40,44,40,40,
-35,26,14,14,5,5,14,14,26,40,40,44,40,40,22,5,22,35,40,44,
-40,40,35,26,14,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,22,50,
-76,76,68,82,76,76,59,22,5,5,5,5,5,5,8,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,40,59,67,
-82,76,76,68,68,59,44,22,5,5,35,67,76,76,76,76,59,35,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,8,8,5,5,8,8,8,
-8,8,5,5,5,5,8,5,8,8,5,8,5,5,5,5,5,5,5,8,
-8,5,14,5,8,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,14,5,14,5,8,5,14,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,8,5,5,8,5,5,5,5,5,5,8,5,
-5,5,8,8,8,5,22,40,50,68,76,76,76,76,76,76,76,76,76,76,
-76,76,76,76,44,22,14,8,5,5,5,5,5,14,50,76,82,76,76,76,
-76,76,76,76,76,76,76,76,76,76,76,76,76,76,68,76,76,76,76,68,
-82,76,76,68,76,68,76,76,67,35,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,22,50,59,68,82,76,76,76,76,76,76,76,76,76,
-76,76,68,82,68,82,82,76,76,76,82,76,82,82,76,76,76,76,76,67,
-22,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,14,5,5,5,22,50,76,76,76,82,76,76,
-67,59,26,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,5,5,5,14,50,76,76,76,76,76,76,76,76,76,
-76,76,76,68,76,82,76,82,76,76,82,76,76,76,76,76,76,76,76,68,
-76,76,82,76,76,82,68,44,14,14,5,5,8,8,5,5,5,5,5,5,
-5,5,5,8,22,40,59,67,82,76,76,76,59,40,26,5,5,5,14,26,
-50,76,68,82,68,67,35,14,35,44,67,82,68,68,67,40,22,5,14,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,5,5,5,35,103,140,140,148,140,148,140,103,35,
-5,8,5,5,8,8,8,14,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,5,5,26,94,148,167,179,179,184,184,167,136,103,35,
-5,5,59,157,179,179,184,179,127,59,26,14,5,5,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,
-5,5,5,5,5,8,8,5,5,5,5,5,14,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,5,8,5,8,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,8,5,
-5,8,5,5,8,5,5,5,5,14,5,5,5,5,5,5,5,5,35,82,
-118,163,179,179,179,184,184,184,184,179,179,170,184,184,179,179,109,44,22,5,
-5,5,5,5,5,40,118,184,184,179,184,184,184,179,184,179,184,184,179,184,
-179,184,184,179,184,179,179,179,179,179,179,179,179,179,179,179,179,179,179,184,
-163,68,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,50,113,
-157,179,179,184,184,184,184,184,184,184,184,179,184,179,179,179,179,179,179,179,
-184,184,184,184,179,184,184,184,179,179,179,131,44,5,5,5,5,8,14,5,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,35,127,184,179,179,179,179,179,163,140,94,26,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,35,118,184,184,184,179,184,179,184,179,184,179,179,184,184,184,184,179,179,
-179,179,184,179,184,184,184,179,184,179,179,179,184,184,179,179,179,179,163,94,
-44,22,5,8,14,5,5,5,5,5,5,5,5,5,5,8,35,82,127,170,
-179,179,184,179,140,109,50,5,5,5,40,67,131,179,179,179,167,148,59,22,
-68,118,163,179,184,167,131,103,40,8,5,5,5,8,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,8,
-5,5,40,148,212,211,212,212,212,211,157,50,5,5,5,5,5,8,5,5,
-5,5,8,5,5,5,5,5,5,5,14,8,5,8,5,8,5,5,14,5,
-40,140,221,255,255,255,255,255,255,212,140,40,5,5,94,239,255,255,255,255,
-197,82,40,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,8,14,5,8,8,5,5,8,
-5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,5,5,8,5,5,
-5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,14,5,8,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,14,8,8,5,14,8,8,5,5,5,8,5,5,5,
-5,5,8,5,5,5,5,5,5,5,50,118,188,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,167,73,40,5,5,5,14,5,5,50,188,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,109,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,73,179,233,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,212,73,5,14,5,5,5,8,5,5,8,5,5,5,5,5,5,
-5,14,5,8,14,5,8,14,5,14,5,14,8,14,5,14,50,197,255,255,
-255,255,255,255,255,224,157,44,14,5,8,14,5,8,14,5,8,14,5,8,
-14,5,8,5,5,8,5,5,5,5,5,5,5,44,179,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,148,59,35,5,5,5,5,14,8,
-5,5,5,5,8,5,8,8,59,118,197,255,255,255,255,255,221,148,77,5,
-5,5,50,109,197,255,255,255,255,221,94,31,118,197,247,255,255,255,203,131,
-44,5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,14,5,14,8,14,5,8,14,8,14,14,5,8,59,203,255,255,255,255,
-255,255,197,67,8,14,8,5,5,5,5,8,8,8,5,14,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,35,145,221,255,255,255,255,255,
-247,197,118,40,5,5,94,239,255,255,255,255,197,94,44,5,5,5,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,14,8,5,5,
-8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,44,118,197,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-167,67,40,5,5,5,5,5,5,50,188,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,247,112,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,82,197,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,212,82,22,8,5,
-5,5,5,5,8,5,8,5,5,5,5,22,22,50,82,77,77,77,77,77,
-77,82,82,77,77,77,77,77,112,212,255,255,255,255,255,255,255,247,184,109,
-77,77,77,77,77,77,77,77,77,77,77,77,77,77,50,22,22,5,5,5,
-5,5,5,5,5,31,91,139,139,139,139,131,139,139,139,139,139,131,139,131,
-139,139,131,139,131,139,131,139,131,139,139,157,170,221,255,255,255,255,255,255,
-255,247,197,109,40,14,5,5,5,5,8,8,5,8,8,5,5,8,5,5,
-67,148,203,255,255,255,255,255,212,145,77,14,5,5,82,148,221,255,255,255,
-239,181,91,35,140,221,255,255,255,247,181,109,40,5,5,5,5,5,5,5,
-5,5,8,5,8,5,5,5,5,40,59,67,82,77,77,77,77,77,82,77,
-77,77,77,77,82,77,118,221,255,255,255,255,255,255,224,118,77,77,67,44,
-35,8,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,40,140,224,255,255,255,255,255,247,179,103,35,5,5,94,238,
-255,255,255,255,194,94,44,14,8,8,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,8,5,
-5,8,14,5,14,8,8,5,5,14,5,5,8,5,14,5,5,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,8,5,5,5,8,5,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,50,118,188,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,167,67,40,5,5,5,5,5,
-8,50,188,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,247,112,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,94,203,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,212,103,35,14,5,5,14,5,8,5,8,8,5,
-5,5,5,22,35,94,148,145,148,145,145,145,148,148,148,148,148,148,148,148,
-170,242,255,255,255,255,255,255,255,255,212,161,145,148,148,148,148,148,148,148,
-145,148,148,145,157,145,94,40,22,5,5,5,8,5,8,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,
-5,5,5,40,68,179,255,255,255,255,255,255,255,203,145,59,5,5,8,5,
-5,5,5,8,5,8,5,8,14,8,5,5,68,161,224,255,255,255,255,255,
-221,148,77,5,5,5,104,197,242,255,255,255,212,161,68,40,161,255,255,255,
-255,242,161,82,35,8,8,8,14,5,5,5,5,5,5,8,8,14,5,5,
-5,59,104,131,148,148,148,148,148,148,145,145,148,145,148,145,145,145,170,242,
-255,255,255,255,255,255,242,179,145,145,127,94,50,14,8,5,8,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,167,255,255,
-255,255,255,255,242,170,104,35,5,5,94,221,255,255,255,255,197,94,50,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,14,5,5,5,5,5,5,5,5,8,5,14,26,35,
-40,40,35,22,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,50,118,194,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,167,67,35,5,5,5,5,8,5,50,197,255,255,255,255,255,
-255,255,221,211,203,211,203,203,211,203,211,203,211,203,203,203,211,203,203,211,
-203,203,203,203,211,203,203,211,184,91,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,77,197,242,255,255,255,255,255,255,255,255,255,233,211,
-203,211,211,203,203,211,203,211,203,203,211,203,211,224,255,255,255,255,255,224,
-118,50,22,8,5,5,5,5,5,5,5,5,5,5,5,35,50,131,212,212,
-212,221,221,212,212,221,212,212,212,212,212,212,224,255,255,255,255,255,255,255,
-255,255,248,224,212,221,212,212,212,212,221,221,212,221,221,212,221,212,145,59,
-35,5,5,8,5,8,5,5,8,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,5,5,5,14,5,5,5,5,35,68,179,255,255,
-255,255,255,255,255,203,131,59,5,5,8,5,5,14,8,5,5,5,5,5,
-5,5,8,5,68,179,233,255,255,255,255,255,221,149,77,5,5,5,131,229,
-255,255,255,255,197,118,68,67,179,255,255,255,255,238,118,50,22,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,82,163,193,212,221,212,221,
-212,221,212,221,221,221,221,212,221,221,229,255,255,255,255,255,255,255,255,233,
-212,221,179,127,67,22,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,50,193,255,255,255,255,255,255,242,175,104,35,
-5,5,86,203,255,255,255,255,197,94,50,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,
-5,5,5,8,5,8,5,5,8,22,50,59,77,77,67,26,5,8,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,14,5,22,8,8,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,50,118,
-193,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,167,67,35,5,
-5,5,5,14,8,50,193,255,255,255,255,255,255,242,167,131,139,139,131,139,
-139,139,139,139,131,139,139,139,131,139,139,139,139,139,139,139,131,139,139,139,
-118,50,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,73,175,
-238,255,255,255,255,255,255,255,255,242,193,139,139,139,139,139,139,131,139,139,
-139,139,139,139,145,179,238,255,255,255,255,238,139,73,22,5,5,5,5,5,
-5,5,5,5,5,5,8,35,50,167,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,179,68,35,5,5,14,5,14,5,8,
-5,8,22,22,8,14,14,14,14,14,14,22,14,22,8,22,14,14,14,14,
-14,14,14,14,14,22,14,50,82,179,255,255,255,255,255,255,255,202,131,67,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,8,5,77,179,233,255,
-255,255,255,255,221,149,82,8,5,14,139,255,255,255,255,255,167,82,73,94,
-202,255,255,255,255,221,94,22,8,5,5,8,8,5,5,5,5,5,14,5,
-5,5,8,5,5,104,202,247,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,233,163,94,22,5,5,
-5,5,5,8,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-50,193,255,255,255,255,255,255,233,145,77,26,14,5,77,193,247,255,255,255,
-197,82,50,14,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,5,8,8,5,5,
-8,50,94,145,179,163,145,82,8,5,8,5,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,35,50,82,104,50,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,40,104,163,224,247,247,247,238,247,238,
-247,247,247,247,247,247,247,233,149,59,32,5,5,5,5,8,5,50,193,255,
-255,255,255,255,255,224,118,67,67,67,67,73,67,67,67,67,67,67,67,67,
-67,67,67,67,67,67,67,67,67,67,67,67,59,32,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,77,179,238,255,255,255,255,255,255,255,
-255,224,149,67,67,67,67,67,67,73,67,67,67,67,67,67,77,104,179,247,
-255,255,255,247,170,94,40,5,5,5,5,5,5,8,5,5,5,5,5,14,
-32,149,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,179,73,40,5,5,5,5,8,5,14,26,50,94,127,118,118,118,118,
-118,118,118,118,127,118,118,118,118,127,127,118,118,118,118,118,118,118,118,130,
-161,221,255,255,255,255,255,255,255,233,179,94,26,22,5,8,5,8,5,8,
-5,5,5,8,5,5,5,5,82,179,238,255,255,255,255,255,221,149,82,14,
-22,32,161,255,255,255,255,255,149,59,82,113,212,255,255,255,255,203,77,14,
-5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,100,203,242,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,238,161,94,22,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,50,193,255,255,255,255,255,255,
-224,121,50,22,5,5,77,179,238,255,255,255,193,86,40,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,8,22,26,14,8,5,5,5,64,139,197,255,248,212,104,
-5,8,5,8,14,14,22,14,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,5,14,5,8,50,100,145,
-193,94,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,40,94,139,193,193,197,197,197,197,197,197,203,197,197,197,197,203,197,
-118,50,26,5,5,5,5,5,5,50,193,255,255,255,255,255,255,203,73,5,
-5,5,8,5,5,8,5,5,8,5,5,5,5,5,14,5,5,5,8,5,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,77,179,238,255,255,255,255,255,255,255,242,212,109,5,5,5,5,5,
-8,8,5,5,5,5,5,8,8,40,131,202,255,255,255,255,202,131,49,5,
-5,5,5,5,8,5,5,5,5,8,5,5,5,131,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,175,77,40,5,5,5,
-5,8,5,14,40,82,161,212,212,212,221,212,221,212,221,212,221,221,212,221,
-212,212,221,221,212,221,221,212,212,212,212,224,229,248,255,255,255,255,255,255,
-255,255,221,127,49,22,5,5,8,5,5,5,8,5,5,5,8,5,5,8,
-77,179,239,255,255,255,255,255,212,157,73,8,35,67,175,255,255,255,255,255,
-118,26,86,148,229,255,255,255,242,175,67,5,5,5,5,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,100,202,242,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,224,157,
-100,22,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,35,82,202,255,255,255,255,255,255,224,118,58,22,5,5,77,179,
-239,255,255,255,197,94,49,8,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,49,127,113,
-77,40,22,5,5,58,139,202,255,242,212,109,5,5,14,35,58,100,113,77,
-40,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,5,67,118,170,203,100,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,40,67,86,94,94,
-94,100,94,100,94,94,94,94,94,94,94,100,58,26,14,5,5,5,5,8,
-5,50,188,255,255,255,255,255,255,211,73,5,14,5,5,8,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,77,179,229,255,255,255,
-255,255,255,255,242,212,112,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,22,67,131,220,255,255,255,242,179,73,22,8,5,5,5,5,5,5,5,
-5,5,8,5,5,112,229,255,255,255,255,255,255,255,255,255,255,229,203,203,
-203,203,197,203,203,203,203,203,203,203,197,203,203,203,203,203,203,203,203,203,
-203,203,203,203,203,203,127,58,35,8,5,5,5,5,5,14,49,100,188,242,
-255,255,255,255,255,255,242,255,242,248,255,242,255,255,242,242,255,242,255,242,
-255,248,242,242,255,255,255,255,255,255,255,255,255,255,242,140,58,35,5,8,
-5,5,8,5,5,8,5,5,5,5,5,5,67,167,220,255,255,255,255,255,
-220,140,82,14,49,109,197,255,255,255,255,230,109,35,121,197,248,255,255,255,
-212,157,59,5,5,5,14,5,5,14,5,5,5,5,5,8,8,5,5,5,
-5,103,203,242,255,255,255,248,220,188,157,157,157,157,157,167,157,179,203,255,
-255,255,255,255,255,255,242,188,157,157,139,94,59,22,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,49,103,211,255,255,
-255,255,255,255,229,121,49,22,5,5,73,179,229,255,255,255,194,94,40,14,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,8,5,5,94,203,211,136,85,35,22,22,76,136,203,
-255,242,211,113,14,22,22,73,113,170,203,130,64,35,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,73,136,188,229,109,5,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,14,5,5,5,5,5,5,5,50,188,255,255,255,255,255,
-255,211,64,5,5,5,14,5,5,5,17,14,26,22,26,26,22,22,26,17,
-17,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,73,179,238,255,255,255,255,255,255,255,255,212,113,5,
-5,5,5,5,14,14,14,14,5,17,14,5,14,14,17,73,188,248,255,255,
-255,212,94,35,17,5,5,5,14,14,5,14,14,5,14,5,5,109,188,233,
-255,255,255,255,255,255,255,255,255,188,136,130,130,130,127,130,130,130,130,127,
-130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,85,40,
-22,5,5,5,5,5,5,14,50,103,211,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,157,59,35,5,14,14,5,5,5,5,5,5,14,
-5,5,14,14,64,149,212,255,255,255,255,255,212,149,76,14,85,149,212,255,
-255,255,248,203,103,35,149,238,255,255,255,255,194,127,50,5,5,5,5,5,
-5,14,14,5,5,5,14,5,14,5,14,5,5,103,211,242,255,255,255,224,
-167,118,68,68,64,68,64,68,76,94,136,224,255,255,255,255,255,255,220,112,
-68,68,59,49,26,5,14,5,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,49,103,211,255,255,255,255,255,255,220,109,40,14,
-5,5,64,149,211,255,255,255,197,94,49,8,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,94,220,242,212,188,158,131,109,131,158,212,255,242,220,145,59,109,149,175,
-203,224,230,145,64,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,8,64,112,188,242,118,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,44,188,255,255,255,255,255,255,212,64,5,5,5,5,5,
-5,22,26,68,118,127,127,127,131,127,127,68,8,14,5,8,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,64,158,
-220,255,255,255,255,255,255,255,248,212,112,5,5,5,5,8,5,5,8,5,
-5,5,5,5,5,14,26,59,112,175,238,255,255,238,149,86,35,5,5,14,
-5,5,5,5,8,5,5,8,5,68,140,212,255,255,255,255,255,255,255,255,
-255,167,94,76,64,64,59,64,64,64,64,59,64,64,64,64,59,64,59,64,
-59,64,59,64,59,64,59,64,59,64,40,22,14,5,8,8,5,5,5,14,
-50,104,211,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,149,
-59,35,5,5,8,5,5,5,5,5,5,8,5,5,5,5,59,131,203,255,
-255,255,255,255,211,131,64,5,104,188,242,255,255,255,230,170,85,40,170,255,
-255,255,255,248,161,85,40,5,5,5,5,5,5,5,5,5,5,5,14,5,
-5,5,5,5,5,103,211,242,255,255,255,212,149,85,35,35,35,35,35,40,
-35,68,121,230,255,255,255,255,255,255,211,85,35,40,26,14,14,14,5,5,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,53,
-104,211,255,255,255,255,255,255,220,94,26,14,5,5,53,121,188,255,255,255,
-194,85,50,14,5,14,5,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,14,5,5,5,5,94,230,255,255,255,255,230,
-188,179,188,230,255,255,230,179,130,188,248,255,255,255,242,149,59,35,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,14,53,94,188,255,139,14,14,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,22,22,26,35,26,35,26,26,26,
-35,26,26,35,35,35,26,26,22,14,14,5,5,5,5,5,5,53,188,255,
-255,255,255,255,255,211,67,5,14,14,5,5,5,26,53,121,202,212,212,220,
-212,220,212,130,14,14,14,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,59,157,212,255,255,255,255,255,255,255,
-248,212,109,5,5,5,5,8,14,8,14,14,22,22,22,26,26,26,49,49,
-53,94,194,255,255,255,202,127,49,14,5,8,8,8,5,8,5,5,5,5,
-5,49,103,188,255,255,255,255,255,255,255,255,255,157,68,35,5,5,5,14,
-8,5,8,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,8,5,8,5,5,5,8,53,103,202,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,242,140,59,26,5,14,5,5,14,5,
-5,5,5,5,5,5,5,5,49,121,188,255,255,255,255,255,202,113,59,14,
-113,233,255,255,255,255,211,140,77,59,179,255,255,255,255,242,130,59,22,5,
-5,5,5,5,8,5,5,5,5,5,8,5,5,5,14,5,5,103,211,248,
-255,255,255,202,139,67,5,5,5,5,5,5,22,49,109,212,255,255,255,255,
-255,255,202,59,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,59,121,212,255,255,255,255,255,255,
-211,82,14,14,5,5,40,103,179,255,255,255,194,86,49,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,77,188,233,255,255,255,255,238,242,233,255,255,255,255,230,
-211,238,255,255,255,242,202,121,49,22,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,35,77,179,
-255,161,59,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,35,68,118,149,167,167,167,167,175,167,167,167,161,175,161,161,167,161,
-104,40,26,8,5,5,5,5,5,49,167,255,255,255,255,255,255,215,67,5,
-5,5,8,5,5,26,59,139,230,255,255,255,255,248,255,131,14,8,5,5,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,59,131,203,255,255,255,255,255,255,255,242,194,109,5,5,5,8,8,
-22,40,50,67,86,103,121,140,161,161,140,109,59,50,109,179,238,255,242,179,
-94,40,14,5,5,5,5,14,5,5,8,5,5,26,49,161,255,255,255,255,
-255,255,255,255,255,203,140,59,5,5,8,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,
-5,5,5,8,22,67,197,255,255,255,255,255,212,175,136,121,121,121,121,121,
-127,121,121,121,121,113,127,121,113,121,121,136,161,212,255,255,255,255,255,255,
-255,233,179,94,35,22,5,5,5,5,5,5,5,5,8,5,8,14,5,5,
-59,121,188,255,255,255,255,255,188,104,50,14,136,255,255,255,255,255,184,104,
-82,86,197,255,255,255,255,233,104,35,14,5,5,5,8,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,103,211,242,255,255,255,211,131,67,8,5,
-5,5,5,5,22,50,104,212,255,255,255,255,255,255,197,67,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,22,73,136,224,255,255,255,255,255,255,211,73,5,5,5,5,40,94,
-167,255,255,255,197,94,50,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,14,5,59,136,197,
-224,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,197,148,82,
-32,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,32,50,175,255,197,118,59,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,50,118,188,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,167,73,32,8,8,5,5,14,
-5,40,161,238,255,255,255,255,255,211,73,14,5,8,8,5,5,32,67,148,
-255,255,255,255,255,255,255,148,5,5,5,8,8,5,5,8,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,50,118,188,255,255,255,
-255,255,255,255,242,202,109,22,26,26,26,40,59,86,109,131,157,176,215,238,
-255,255,224,161,67,14,40,109,197,248,255,220,131,76,14,5,5,5,5,5,
-5,8,5,5,5,5,5,118,230,255,255,255,255,255,255,255,255,255,202,94,
-22,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,8,5,50,176,255,
-255,255,255,242,167,104,35,5,14,5,5,5,8,5,5,5,5,8,5,8,
-8,5,5,35,73,176,255,255,255,255,255,255,255,197,131,58,5,5,8,5,
-5,5,5,5,5,5,5,8,5,5,5,5,50,127,197,255,255,255,255,255,
-188,82,50,26,140,255,255,255,255,242,149,67,82,103,194,255,255,255,255,215,
-82,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,
-5,103,211,242,255,255,255,203,136,67,5,5,8,5,8,8,26,50,113,220,
-255,255,255,255,255,255,203,58,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,5,5,5,5,5,5,5,5,5,5,5,5,22,82,157,230,255,255,
-255,255,255,255,215,67,5,5,5,5,35,67,149,255,255,255,211,127,67,17,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,26,67,86,113,167,230,255,255,255,255,255,
-255,255,255,255,255,255,242,188,127,103,67,49,22,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,22,26,157,255,230,179,86,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,49,118,188,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,167,67,40,5,5,5,5,5,5,49,140,229,255,255,255,255,
-255,220,104,35,22,5,8,8,5,31,67,157,255,255,255,255,255,255,255,149,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,40,94,170,255,255,255,255,255,255,255,255,229,161,104,
-112,127,157,170,179,188,203,215,221,229,248,255,255,255,242,179,67,17,22,49,
-104,140,197,203,170,112,35,5,8,17,5,5,5,5,5,8,5,8,5,77,
-149,215,255,255,255,255,255,255,255,255,238,161,94,40,5,5,5,5,17,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,8,8,5,8,5,40,161,255,255,255,255,255,179,104,40,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,17,5,35,77,179,255,255,
-255,255,255,255,255,197,127,58,5,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,49,104,179,255,255,255,255,255,188,94,58,22,94,154,161,154,
-154,149,85,35,58,73,121,161,149,154,149,121,49,5,5,5,5,5,8,5,
-5,5,8,5,5,5,5,5,8,5,5,5,5,103,203,242,255,255,255,203,
-139,67,5,8,5,5,5,5,8,49,103,212,255,255,255,255,255,255,203,58,
-5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,22,94,161,233,255,255,255,255,255,255,203,67,8,5,
-17,5,22,49,127,242,255,255,229,161,94,17,5,5,5,17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,17,17,31,40,127,212,255,255,255,255,255,255,255,255,255,255,255,229,136,
-58,40,22,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,8,8,5,5,136,255,255,229,127,
-17,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,49,118,
-188,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,167,73,40,5,
-5,5,5,5,5,49,140,221,255,255,255,255,255,229,118,58,22,5,5,8,
-5,35,67,154,255,255,255,255,255,255,255,148,5,5,5,5,5,17,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,73,
-154,255,255,255,255,255,255,255,255,247,212,172,194,221,255,255,255,255,255,255,
-255,255,255,255,255,255,248,194,73,5,5,8,22,59,125,167,185,130,35,8,
-8,8,5,5,5,5,5,8,8,5,5,40,64,172,255,255,255,255,255,255,
-255,255,255,221,158,73,22,17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,8,8,5,
-5,40,140,224,255,255,255,255,194,125,49,5,8,5,5,5,17,5,5,5,
-5,5,5,5,5,5,5,35,73,179,255,255,255,255,255,255,255,194,125,59,
-5,5,5,5,5,5,5,5,8,5,8,5,8,5,5,5,40,94,172,255,
-255,255,255,255,194,109,64,22,40,64,64,64,64,59,35,5,31,40,50,64,
-64,59,59,46,22,8,17,5,8,5,5,5,5,5,17,5,5,5,5,5,
-8,5,5,5,5,103,211,247,255,255,255,203,130,64,8,5,5,5,5,5,
-14,35,94,211,255,255,255,255,255,255,203,59,5,5,5,14,8,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,104,
-172,238,255,255,255,255,255,247,179,64,5,5,5,5,14,22,112,238,255,255,
-229,172,94,14,5,14,5,5,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,31,82,112,149,194,255,255,
-255,255,255,255,255,255,255,255,255,255,255,212,172,130,103,46,14,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,14,5,118,221,247,255,157,77,40,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,46,118,188,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,167,64,35,5,5,5,5,5,5,40,140,221,
-255,255,255,255,255,230,136,73,31,5,13,5,5,35,59,157,255,255,255,255,
-255,255,255,149,5,5,13,13,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,22,40,130,248,255,255,255,255,255,255,
-255,255,255,233,247,255,255,255,255,255,255,255,255,255,255,255,255,255,221,158,
-64,5,5,5,13,31,64,77,82,59,22,5,5,5,5,13,5,5,5,5,
-13,5,5,22,35,112,179,233,255,255,255,255,255,255,255,255,212,158,85,35,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,13,5,5,5,13,5,31,104,185,247,255,255,255,
-233,158,59,5,13,5,13,5,5,5,5,5,13,5,5,13,5,5,5,40,
-73,179,255,255,255,255,255,255,255,194,130,59,5,5,13,5,5,13,5,5,
-5,5,5,5,5,5,5,5,35,77,158,255,255,255,255,255,211,127,73,17,
-22,35,35,35,35,35,22,5,17,22,31,35,35,31,35,22,17,5,5,13,
-5,5,5,5,5,13,5,5,13,5,5,5,5,5,5,17,5,100,211,247,
-255,255,255,203,139,67,5,5,5,5,5,5,17,17,73,203,255,255,255,255,
-255,255,203,67,5,5,13,5,5,5,5,5,13,13,17,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,31,109,179,247,255,255,255,255,255,230,
-158,59,5,5,5,5,8,5,94,221,255,255,238,188,109,17,5,17,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,59,139,188,238,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,212,158,82,31,17,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,100,
-188,238,255,203,127,67,17,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,50,118,188,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-163,67,40,5,5,5,5,5,5,40,140,221,255,255,255,255,255,238,163,91,
-26,5,5,5,5,35,59,157,255,255,255,255,255,255,255,148,5,5,8,5,
-5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,17,22,112,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,247,212,179,130,50,8,8,5,5,5,5,5,
-5,5,5,5,5,17,5,8,5,5,5,5,5,5,5,5,5,59,118,194,
-255,255,255,255,255,255,255,255,255,212,163,73,22,22,8,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,22,77,140,221,255,255,255,255,188,77,17,8,8,5,5,
-5,5,5,5,8,5,8,5,5,5,8,40,73,172,255,255,255,255,255,255,
-255,194,130,59,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-26,59,140,255,255,255,255,255,221,157,77,5,5,5,5,5,5,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-8,5,8,5,8,5,5,5,5,109,211,247,255,255,255,203,139,64,5,5,
-8,8,8,5,5,5,59,194,255,255,255,255,255,255,203,64,5,8,5,5,
-5,5,14,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,26,130,203,248,255,255,255,255,255,230,163,50,5,5,5,5,5,5,
-82,188,247,255,255,221,130,14,5,5,5,8,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,5,82,194,247,
-255,255,255,255,221,212,212,247,255,255,247,230,212,247,255,255,255,255,212,130,
-50,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,5,5,5,77,140,221,255,247,211,109,35,22,
-5,5,8,5,5,8,5,5,5,8,8,5,5,5,40,100,163,221,238,238,
-230,238,238,238,230,238,230,238,230,238,230,230,140,64,26,5,5,8,5,5,
-5,40,130,212,255,255,255,255,255,255,197,127,40,5,5,5,5,26,58,157,
-255,255,255,255,255,255,255,149,14,14,5,5,5,5,5,14,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,109,212,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230,203,179,140,
-118,94,82,58,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,58,109,197,255,255,255,255,255,255,255,255,
-255,247,212,163,100,46,14,8,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,14,40,94,
-194,255,255,255,255,212,109,46,22,8,5,5,5,14,5,5,5,5,8,5,
-14,5,5,40,73,179,255,255,255,255,255,255,255,194,127,58,8,5,8,5,
-5,5,5,14,5,5,5,8,5,5,8,5,14,26,121,248,255,255,255,255,
-230,167,85,14,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,100,203,247,255,255,255,203,136,64,5,5,5,5,5,5,5,5,50,179,
-255,255,255,255,255,255,203,85,22,14,8,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,5,35,136,221,255,255,255,
-255,255,255,229,157,46,5,5,5,5,5,5,64,163,221,255,255,255,148,22,
-8,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,14,5,5,100,229,255,255,255,248,211,163,163,170,221,
-255,247,229,188,148,197,229,247,255,255,255,157,59,35,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,
-14,8,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,8,14,8,5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,50,100,197,255,255,255,163,77,40,14,8,5,8,5,8,5,5,
-5,8,5,5,5,5,40,85,130,175,179,188,185,185,188,188,179,188,179,188,
-179,179,188,179,109,46,26,5,5,8,5,5,8,35,121,197,247,255,255,255,
-255,255,229,163,59,14,5,5,5,35,67,157,255,255,255,255,255,255,255,163,
-26,14,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,85,188,247,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,247,229,203,175,148,94,50,26,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,14,22,
-35,77,121,197,255,255,255,255,255,255,255,255,255,255,255,229,170,94,46,26,
-22,5,5,8,8,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,
-14,5,5,5,5,5,5,5,5,14,14,50,163,229,255,255,255,239,157,85,
-35,14,5,8,5,5,5,5,5,5,8,5,5,5,5,40,73,170,255,255,
-255,255,255,255,255,197,130,59,8,5,5,5,8,5,5,5,5,5,5,8,
-5,5,5,8,5,5,109,242,255,255,255,255,239,188,94,5,5,8,5,14,
-5,5,5,5,8,8,5,5,8,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,100,203,242,255,255,255,203,
-136,67,5,5,5,5,5,14,5,8,50,167,242,255,255,255,255,255,212,94,
-35,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,35,136,221,255,255,255,255,255,255,203,130,50,5,5,
-5,8,5,5,50,125,194,255,255,255,167,40,22,8,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,
-5,85,212,233,203,167,136,100,73,109,149,211,255,255,221,145,67,94,112,149,
-188,229,239,149,67,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,50,167,255,255,
-255,229,167,94,35,22,5,5,5,5,5,5,5,5,8,8,5,5,22,40,
-50,77,85,85,85,85,85,85,85,85,85,85,85,77,85,85,50,26,14,5,
-5,8,5,5,5,22,85,149,233,255,255,255,255,255,255,197,85,40,14,5,
-5,35,59,157,255,255,255,255,255,255,255,170,59,26,8,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-59,131,203,255,255,255,255,255,255,255,255,255,255,247,212,197,157,136,109,94,
-77,67,40,26,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,22,67,131,170,212,247,255,255,255,255,
-255,255,255,255,255,255,255,255,229,197,149,94,46,22,5,5,5,5,14,5,
-5,14,5,5,5,5,5,5,5,14,5,14,5,14,5,5,5,5,5,5,
-5,5,5,35,85,157,229,255,255,255,220,158,67,35,14,5,14,14,5,5,
-5,5,5,5,5,5,5,35,77,175,255,255,255,255,255,255,255,197,127,59,
-5,5,5,5,5,5,5,5,14,5,5,14,5,14,14,5,5,5,85,203,
-255,255,255,255,247,212,112,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,109,203,247,255,255,255,203,136,67,5,8,8,5,5,8,
-5,5,40,145,220,255,255,255,255,255,212,109,46,14,5,5,5,5,5,8,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,8,14,40,145,
-229,255,255,255,255,255,247,188,127,46,5,5,8,5,5,8,40,94,163,255,
-255,255,179,73,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,14,5,5,5,8,73,175,179,131,100,46,26,
-8,67,131,211,255,247,211,109,5,14,22,73,118,175,194,118,59,26,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,8,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,8,5,8,5,5,5,5,5,5,5,5,5,5,
-8,5,14,5,5,8,5,8,8,139,247,255,255,255,247,149,77,40,22,14,
-5,5,5,5,8,8,5,5,5,5,5,5,5,5,8,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,5,22,40,109,
-211,255,255,255,255,255,255,229,139,73,26,14,5,35,67,158,255,255,255,255,
-255,255,255,179,85,40,8,8,8,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,40,85,167,255,255,255,255,255,
-255,255,255,255,230,194,163,118,85,46,22,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,
-14,35,59,131,211,247,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,230,158,94,59,35,22,22,5,5,5,5,5,5,5,5,5,8,8,
-5,5,5,8,5,8,5,5,5,5,5,14,5,5,5,14,35,85,179,239,
-255,255,255,220,131,67,35,22,8,5,5,5,14,5,5,14,5,5,5,40,
-82,179,255,255,255,255,255,255,255,194,130,59,5,5,5,5,5,5,5,5,
-8,5,5,5,8,5,8,5,5,5,82,179,230,255,255,255,255,239,130,14,
-8,5,5,8,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,103,211,247,
-255,255,255,211,130,67,8,8,14,8,5,5,5,8,40,118,188,248,255,255,
-255,255,230,130,59,22,5,5,5,8,5,8,5,5,5,8,5,8,5,5,
-5,5,5,5,5,5,8,5,5,8,40,163,255,255,255,255,255,255,255,179,
-109,40,5,5,5,8,5,5,22,50,140,255,255,255,203,118,59,5,5,5,
-14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,40,77,77,59,46,22,14,5,67,136,203,255,248,212,109,
-5,8,8,35,50,73,85,50,26,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,8,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,
-14,109,194,239,255,255,255,220,179,118,73,35,5,5,8,5,5,5,5,5,
-5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,22,67,170,247,255,255,255,255,255,255,
-211,148,67,26,5,35,59,157,255,255,255,255,255,255,255,194,109,59,8,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,26,46,131,248,255,255,255,255,255,255,255,220,157,82,73,50,
-40,26,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,14,40,109,179,212,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230,194,157,131,82,
-59,26,14,8,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,
-14,8,5,5,5,5,5,5,22,40,94,157,230,255,255,255,203,157,103,50,
-35,22,5,5,5,5,8,5,5,8,5,46,94,188,255,255,255,255,255,255,
-255,194,122,64,5,5,5,8,5,5,5,8,8,5,5,5,5,8,5,8,
-5,5,64,136,203,255,255,255,255,255,148,35,22,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,8,103,203,242,255,255,255,211,131,64,8,5,
-14,5,5,5,5,5,26,82,157,239,255,255,255,255,239,157,94,35,5,5,
-5,8,5,14,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,5,
-5,5,40,170,255,255,255,255,255,255,242,179,103,35,5,14,5,5,5,5,
-8,22,113,239,255,255,224,167,85,14,8,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,8,64,131,194,255,239,203,104,5,5,8,5,5,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,8,22,22,26,26,35,26,26,26,26,26,26,26,26,26,26,
-26,26,26,26,26,26,26,26,26,26,26,35,35,22,22,14,5,5,5,5,
-5,5,14,8,8,8,5,5,5,5,5,5,14,73,131,212,255,255,255,255,
-242,194,131,77,35,26,22,14,5,5,14,5,5,5,5,5,5,8,8,5,
-5,5,5,5,5,5,5,8,8,5,5,8,8,8,5,5,14,5,5,5,
-8,5,5,40,131,203,255,255,255,255,255,255,255,212,122,73,40,50,85,161,
-255,255,255,255,255,255,255,211,140,73,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,109,212,
-255,255,255,255,255,255,242,203,109,14,14,5,14,5,14,5,14,5,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,35,50,161,255,255,255,255,255,255,255,255,255,255,255,255,255,242,
-248,255,255,255,255,255,255,255,255,242,211,157,109,77,50,40,35,26,26,22,
-14,14,14,5,5,5,5,5,5,14,5,5,5,14,5,5,5,5,5,5,
-5,22,40,85,167,221,242,255,255,221,157,109,67,40,22,14,5,5,14,5,
-5,5,14,67,109,194,255,255,255,255,255,255,255,194,131,50,5,14,5,14,
-5,14,5,14,14,5,5,5,5,5,5,5,5,5,50,94,179,255,255,255,
-255,255,179,67,35,5,5,5,14,14,14,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,
-14,109,211,242,255,255,255,203,136,67,14,5,14,5,5,14,5,5,22,59,
-118,221,255,255,255,255,248,194,118,35,14,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,5,5,5,5,5,5,5,40,179,255,255,255,255,
-255,255,242,158,94,35,5,5,5,5,5,5,5,14,82,179,233,255,255,224,
-118,14,14,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,14,5,5,5,5,5,5,5,5,5,14,5,59,118,172,
-233,203,179,94,5,5,14,5,5,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,26,49,73,94,
-94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
-94,104,94,94,94,85,59,35,22,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,8,40,82,172,255,255,255,255,255,242,211,167,127,94,49,22,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,14,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,26,77,148,224,255,
-255,255,255,255,255,255,212,172,131,127,118,179,255,255,255,255,255,255,255,238,
-194,103,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,68,158,212,255,255,255,255,255,255,255,
-158,49,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,40,67,167,255,255,
-255,255,255,255,255,255,255,255,255,212,167,131,131,224,255,255,255,255,255,255,
-255,255,248,224,212,197,172,139,118,103,77,59,49,26,22,5,5,5,5,5,
-5,5,5,5,8,5,5,8,8,5,8,8,5,8,22,40,77,121,161,197,
-212,221,212,197,172,131,58,26,14,8,5,5,5,5,5,67,127,203,255,255,
-255,255,255,255,255,197,131,58,8,5,8,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,26,49,140,247,255,255,255,255,212,127,68,5,5,5,
-8,5,5,8,8,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,103,211,247,255,255,255,203,
-139,67,5,5,8,8,5,5,5,5,14,26,82,194,255,255,255,255,255,224,
-157,46,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,46,179,255,255,255,255,255,255,247,140,82,32,5,5,
-8,5,5,5,5,5,58,131,194,255,255,255,161,32,14,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-8,5,5,5,14,5,8,5,5,46,82,139,179,157,131,68,5,14,8,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,8,5,40,82,121,161,167,161,167,167,161,167,167,167,
-167,167,167,167,167,167,167,167,167,167,167,161,167,161,167,167,167,140,103,58,
-14,5,8,5,5,5,5,5,8,5,5,5,5,8,5,5,8,14,32,131,
-221,247,255,255,255,255,255,238,203,148,109,67,46,40,32,26,26,22,22,22,
-22,22,22,22,22,22,22,14,22,22,22,22,22,22,22,22,14,14,5,5,
-5,5,5,14,5,14,5,14,32,86,179,239,255,255,255,255,255,255,255,255,
-203,188,167,212,255,255,255,255,255,255,255,255,239,121,22,14,5,5,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,5,
-5,5,46,94,175,255,255,255,255,255,255,255,188,94,49,14,14,5,5,14,
-5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,5,5,40,67,175,255,255,255,255,255,255,255,255,255,239,
-211,149,94,32,49,194,255,255,255,255,255,255,255,255,255,255,255,255,248,220,
-188,161,140,109,94,82,67,49,32,22,8,5,5,5,5,5,5,5,5,8,
-5,8,8,8,5,5,5,8,14,32,82,127,161,188,212,212,203,149,68,32,
-14,5,5,5,5,5,8,77,161,220,255,255,255,255,255,255,255,194,131,58,
-5,14,5,5,5,5,5,5,8,5,5,5,5,14,5,5,5,5,8,22,
-109,212,255,255,255,255,239,194,109,14,14,5,5,5,8,14,8,5,5,8,
-8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,8,5,8,103,211,247,255,255,255,203,139,64,5,5,5,5,8,8,
-5,5,8,8,49,161,239,255,255,255,255,255,179,58,22,5,5,5,8,8,
-5,8,5,5,14,5,5,5,5,5,5,5,5,5,8,5,5,14,49,188,
-255,255,255,255,255,255,239,139,64,22,5,5,5,5,5,5,5,8,26,64,
-140,247,255,255,188,94,49,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,
-5,22,46,49,68,64,58,32,5,5,8,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-58,113,170,233,229,239,233,239,233,233,239,233,233,233,233,233,233,233,233,233,
-233,233,239,233,239,233,239,229,233,203,145,82,26,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,22,68,131,212,255,255,255,255,255,255,
-255,233,212,188,170,131,113,94,77,58,49,49,49,49,49,49,49,49,49,49,
-49,49,49,49,49,49,49,49,32,22,8,5,5,8,5,5,5,8,5,14,
-14,40,94,149,203,247,255,255,255,255,255,255,247,247,233,255,255,255,255,255,
-255,255,255,255,255,161,49,32,8,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,5,5,5,22,40,127,229,255,255,
-255,255,255,255,233,188,94,14,14,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,40,
-68,170,255,255,255,255,255,255,255,247,211,149,103,64,40,22,49,194,255,255,
-255,255,255,255,255,255,247,220,229,247,255,255,247,239,229,212,211,203,194,188,
-118,40,26,8,5,5,5,5,5,5,5,5,8,5,5,8,5,14,5,5,
-14,22,40,49,64,82,82,94,82,58,32,22,5,8,5,8,5,5,5,103,
-203,247,255,255,255,255,255,255,255,194,130,58,8,5,5,5,5,8,5,5,
-5,5,8,5,5,5,5,5,5,14,5,14,77,161,220,255,255,255,255,248,
-145,49,26,5,5,8,5,8,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,103,211,247,
-255,255,255,211,130,67,5,5,8,5,8,5,5,5,5,5,40,103,175,247,
-255,255,255,255,203,109,49,22,5,5,5,8,5,5,5,8,5,5,5,5,
-5,5,14,5,5,5,5,5,14,22,67,188,255,255,255,255,255,255,229,130,
-58,22,5,8,5,8,14,5,5,5,8,14,94,188,238,255,220,157,82,14,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,8,5,14,5,5,14,5,8,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,58,125,188,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,212,161,94,26,5,5,5,8,5,5,5,5,8,8,5,14,5,5,5,
-8,8,8,26,67,175,255,255,255,255,255,255,255,255,255,255,247,212,179,161,
-145,118,109,109,109,109,109,113,109,109,113,113,113,109,113,109,109,113,109,103,
-67,32,14,5,5,14,5,5,5,8,5,8,5,14,40,77,145,188,221,238,
-247,247,247,247,247,247,247,247,248,255,255,255,255,255,255,255,255,188,103,50,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,82,184,233,255,255,255,255,255,255,247,148,59,
-32,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,40,68,172,255,255,255,255,255,255,
-242,194,148,68,14,5,5,5,50,194,255,255,255,255,255,255,255,242,203,161,
-161,194,211,224,233,242,242,242,242,242,242,242,145,50,26,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,
-5,5,5,5,5,5,5,5,8,22,35,136,242,255,255,255,255,255,255,255,
-255,194,127,59,5,8,14,5,5,5,5,5,5,8,5,14,8,5,8,5,
-5,5,8,5,50,109,188,255,255,255,255,255,194,109,50,8,5,5,5,5,
-5,14,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,103,203,242,255,255,255,212,157,94,22,22,
-22,22,22,14,14,14,8,5,22,59,118,212,255,255,255,255,238,161,94,35,
-5,5,8,8,8,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-8,40,82,197,255,255,255,255,255,255,229,127,59,26,5,5,5,5,5,5,
-5,5,5,14,59,109,179,255,242,221,130,40,22,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,
-8,8,8,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,40,94,130,179,188,188,188,179,188,188,179,188,188,179,188,188,
-188,188,188,179,188,188,188,179,188,188,179,188,188,161,112,64,22,5,5,5,
-5,5,5,5,5,5,5,8,5,5,8,5,5,8,5,14,35,109,179,238,
-255,255,255,255,255,255,255,255,255,255,242,238,229,212,221,212,221,212,212,212,
-221,212,212,212,212,212,212,221,212,212,212,212,127,59,35,5,5,5,5,5,
-5,5,5,5,5,8,14,35,59,82,94,118,130,136,136,136,145,136,145,148,
-161,211,255,255,255,255,255,255,255,229,188,94,22,8,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-44,94,172,255,255,255,255,255,255,255,212,161,82,22,17,8,5,8,5,5,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,40,68,172,255,255,255,255,255,202,145,103,59,26,17,8,5,5,
-50,194,255,255,255,255,255,255,255,238,172,94,64,77,82,94,112,130,140,140,
-139,139,139,140,82,26,17,5,5,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,17,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,50,94,179,255,255,255,255,255,255,255,255,255,194,127,59,17,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,26,59,140,242,
-255,255,255,255,242,194,109,22,13,17,13,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,
-5,103,211,242,255,255,255,255,212,140,85,68,50,59,50,40,35,22,5,13,
-13,22,77,161,224,255,255,255,255,221,157,59,22,13,5,13,5,5,5,5,
-5,5,5,5,5,5,5,5,5,13,5,5,13,50,94,203,255,255,255,255,
-255,255,224,127,50,22,5,13,5,5,5,5,5,5,5,13,22,50,127,221,
-238,248,179,94,50,13,13,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,13,5,5,5,5,13,13,13,5,5,5,13,5,
-13,5,5,5,13,5,5,5,5,13,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,13,5,13,13,35,59,94,109,
-118,113,113,118,118,118,118,118,113,118,118,118,113,118,118,118,118,118,113,118,
-118,113,113,113,118,94,68,50,13,8,8,5,5,5,5,5,5,8,5,5,
-8,5,8,5,5,5,13,5,13,50,109,179,242,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,167,77,35,8,8,5,8,5,5,5,5,5,8,5,5,5,
-5,13,13,26,50,59,59,59,64,59,59,68,85,158,242,255,255,255,255,255,
-255,255,242,149,59,35,8,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,22,35,118,221,247,255,255,255,
-255,255,255,224,139,59,35,13,8,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,40,77,170,255,255,
-255,233,212,139,68,40,5,5,5,5,5,5,59,197,255,255,255,255,255,255,
-255,224,158,40,5,5,5,8,26,59,64,59,59,50,59,59,35,5,8,5,
-5,5,5,5,8,5,5,13,5,8,5,8,8,5,5,5,5,8,5,13,
-5,8,8,8,8,5,8,8,5,5,5,22,35,94,163,221,255,255,255,255,
-255,255,255,255,255,188,118,50,5,5,5,5,5,5,5,5,5,13,5,5,
-5,5,5,5,5,5,13,5,8,13,94,197,233,255,255,255,255,255,163,64,
-40,13,13,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,103,211,247,255,255,255,255,
-255,202,148,130,113,109,109,94,77,35,5,8,5,5,40,109,179,229,255,255,
-255,255,202,104,50,17,5,8,5,5,5,8,5,5,5,5,5,5,5,8,
-5,5,17,5,8,50,103,202,255,255,255,255,255,255,221,104,35,17,5,5,
-5,5,5,5,5,5,5,5,13,22,59,118,167,221,212,202,112,35,22,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,13,5,5,5,13,5,5,13,5,5,5,5,5,13,5,5,5,5,
-13,5,13,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,22,22,35,50,50,50,50,50,50,50,50,50,
-50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,40,35,22,
-13,5,5,5,5,5,5,5,5,5,5,13,5,5,5,5,5,5,5,5,
-17,26,50,109,167,229,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,167,64,40,8,
-5,5,5,5,5,5,5,8,5,5,8,5,5,5,17,17,26,26,26,26,
-26,26,26,35,35,103,179,233,255,255,255,255,255,255,255,206,163,82,22,22,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,22,59,109,188,255,255,255,255,255,255,255,206,163,82,26,
-22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,40,73,175,255,238,188,140,94,59,26,22,5,5,
-5,5,5,5,49,194,255,255,255,255,255,255,255,229,148,49,5,5,5,5,
-14,26,26,26,26,26,26,26,22,5,5,5,5,5,14,8,5,5,5,5,
-5,5,5,14,5,5,5,5,8,8,5,8,5,5,5,8,5,5,8,5,
-5,8,5,49,103,163,233,255,255,255,255,255,255,255,255,255,255,175,82,40,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,14,49,109,188,255,255,255,255,255,229,185,109,40,22,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,8,5,8,5,103,206,247,255,255,255,255,255,248,233,229,212,221,212,179,
-139,58,5,5,5,5,22,40,94,175,229,255,255,255,238,188,118,40,14,8,
-5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,22,58,112,206,
-255,255,255,255,255,255,221,86,17,17,5,5,5,5,5,5,5,5,5,8,
-5,5,26,49,109,175,194,212,130,35,17,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,17,5,5,8,5,5,5,5,5,
-5,5,5,5,5,8,17,5,5,5,5,5,5,5,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,5,5,5,5,5,5,5,5,8,49,103,167,224,247,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,167,67,40,5,5,8,5,5,5,8,5,5,
-5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,58,118,188,
-247,255,255,255,255,255,255,255,224,140,67,40,26,17,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,22,44,
-127,206,239,255,255,255,255,255,255,224,148,82,49,32,22,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,40,
-67,148,230,175,130,67,17,17,5,5,5,5,8,5,5,5,58,194,255,255,
-255,255,255,255,255,224,148,44,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,17,5,5,5,5,8,5,5,5,8,8,17,22,32,32,32,40,32,
-40,32,32,32,32,32,32,40,32,32,32,32,40,40,58,109,158,221,255,255,
-255,255,255,255,255,255,255,255,247,140,49,26,5,5,5,5,5,5,5,5,
-5,5,17,5,5,5,5,17,5,5,5,5,17,5,22,49,130,212,247,255,
-255,255,255,255,179,95,67,26,22,17,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,17,8,95,193,238,
-255,255,255,255,255,255,255,255,255,255,255,238,185,77,5,5,5,5,5,5,
-40,112,179,230,255,255,255,247,179,100,53,22,22,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,17,68,130,212,255,255,255,255,255,255,212,77,
-17,5,8,5,5,5,5,8,5,5,5,5,5,8,17,22,40,67,85,109,
-67,8,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,
-8,5,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,
-5,5,5,5,5,8,5,22,49,85,121,175,221,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-167,67,40,5,5,5,5,5,5,5,5,5,5,5,17,5,8,8,5,5,
-5,8,5,5,5,5,5,5,5,26,49,121,197,238,255,255,255,255,255,255,
-255,224,179,130,67,32,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,17,5,5,5,5,17,22,58,91,158,230,255,255,255,255,
-255,255,230,193,139,95,53,22,17,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,26,53,82,109,82,53,26,17,5,
-5,5,5,5,5,5,5,5,49,197,255,255,255,255,255,255,255,230,158,49,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,8,5,22,67,103,103,103,109,109,109,109,109,109,109,109,109,109,
-103,109,109,109,112,139,167,202,238,255,255,255,255,255,255,255,255,255,255,255,
-212,109,22,22,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,17,22,67,109,193,255,255,255,255,255,247,202,158,95,
-53,8,17,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,5,5,77,161,221,255,255,255,255,255,255,255,255,
-255,255,255,230,179,77,5,5,5,5,5,5,22,40,103,167,221,255,255,255,
-238,202,139,67,32,17,5,5,5,8,5,5,5,5,5,5,8,5,5,5,
-17,82,149,229,255,255,255,255,255,255,212,73,5,8,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,22,32,17,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,17,5,5,5,5,8,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,17,5,8,5,17,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,
-5,5,5,5,5,5,5,8,17,5,17,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,17,5,5,8,5,5,5,5,5,5,
-17,5,5,5,5,8,5,8,8,8,8,5,5,5,5,5,5,5,8,5,
-8,26,49,109,161,203,229,247,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,167,67,40,5,5,5,8,8,
-8,8,8,5,5,5,5,5,8,5,8,5,5,17,5,5,5,5,5,5,
-8,5,8,67,131,193,247,255,255,255,255,255,255,255,255,193,131,95,58,49,
-40,22,22,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,8,22,95,167,203,247,255,255,255,255,255,255,203,161,109,67,
-58,49,40,26,26,22,22,22,22,17,5,5,5,5,5,5,5,5,5,5,
-17,5,17,22,32,58,67,49,40,32,32,32,32,32,32,32,32,32,40,32,
-82,203,255,255,255,255,255,255,255,229,161,67,40,32,40,40,32,40,32,32,
-32,32,32,32,40,32,26,13,17,5,5,5,5,5,17,13,5,32,118,170,
-167,170,167,170,170,170,170,167,170,170,167,170,179,167,170,179,185,211,247,255,
-255,255,255,255,255,255,255,255,255,255,255,211,161,68,5,5,5,5,13,5,
-5,13,13,5,5,13,5,5,5,13,5,5,5,5,5,5,5,5,5,5,
-26,40,127,211,229,255,255,255,255,255,221,161,118,68,53,49,32,22,22,13,
-22,22,22,22,13,13,5,5,5,5,5,5,5,5,5,13,5,5,5,13,
-5,59,109,179,247,255,255,255,255,255,255,255,255,255,255,224,167,68,5,13,
-5,5,13,5,5,5,49,95,161,221,247,255,255,255,211,131,85,49,26,13,
-13,13,5,5,5,5,5,5,5,5,5,5,22,91,157,224,255,255,255,255,
-255,255,194,68,5,5,5,5,13,5,5,5,5,5,5,5,5,13,5,13,
-5,13,13,13,13,5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,
-5,5,13,5,5,5,5,5,5,5,5,5,5,5,13,5,5,5,5,5,
-5,5,5,5,13,5,5,5,5,5,5,13,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,13,13,5,13,13,5,5,13,13,13,5,13,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,13,22,40,67,91,131,170,
-211,238,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,167,67,35,5,5,13,13,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,26,49,109,170,212,
-255,255,255,255,255,255,255,248,229,203,184,140,109,77,46,22,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,35,67,
-109,161,211,255,255,255,255,255,248,238,211,193,161,131,109,85,67,59,59,53,
-46,35,14,5,5,5,5,5,5,5,5,5,5,5,5,22,40,73,109,109,
-103,103,109,109,103,109,109,109,109,109,109,109,131,224,255,255,255,255,255,255,
-255,247,197,127,103,109,103,109,103,103,103,103,109,103,103,103,109,109,67,26,
-22,5,8,8,8,5,5,5,5,40,161,247,247,238,247,238,247,238,247,247,
-238,247,247,247,238,247,238,247,247,255,255,255,255,255,255,255,255,255,255,255,
-255,255,229,149,73,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,22,53,85,149,203,247,255,
-255,255,255,238,212,193,149,118,91,59,35,26,40,59,49,46,26,14,14,5,
-5,5,5,5,8,5,5,5,8,5,5,14,5,26,35,104,161,193,212,224,
-229,229,224,229,224,229,221,197,145,67,5,5,5,5,8,5,5,8,14,46,
-85,118,167,224,255,255,255,230,179,139,82,22,22,5,5,5,5,5,8,5,
-5,5,5,5,22,94,167,238,255,255,255,255,255,247,184,67,8,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,
-5,14,5,5,5,5,5,5,5,14,5,14,5,5,5,5,5,8,5,5,
-8,5,14,5,5,5,8,5,14,5,5,5,14,5,5,8,5,5,5,5,
-5,14,5,5,5,5,5,5,5,8,14,8,5,5,8,5,5,5,5,5,
-5,8,5,5,5,5,8,5,14,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-14,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,26,49,94,140,175,202,221,230,239,247,248,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,158,67,35,8,
-5,5,5,14,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,49,94,158,202,224,247,248,255,255,255,255,
-255,255,248,212,175,130,82,35,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,44,94,140,193,212,239,248,255,
-255,255,255,248,230,202,179,158,130,118,113,103,85,67,26,5,5,5,8,5,
-5,5,5,5,5,5,5,26,44,109,175,179,175,175,175,175,175,179,175,179,
-175,179,175,175,194,247,255,255,255,255,255,255,255,255,230,194,179,175,175,179,
-175,175,175,179,175,175,179,179,175,179,109,44,26,8,5,8,5,5,5,5,
-5,50,184,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,248,212,175,94,14,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,14,22,82,139,184,221,230,247,255,255,255,255,212,194,
-158,121,109,82,109,121,109,94,40,22,5,5,5,5,5,14,5,5,8,8,
-5,8,5,5,8,5,5,44,94,127,158,158,158,158,158,167,158,167,158,140,
-109,50,14,5,5,5,5,5,14,8,5,5,22,50,109,158,194,230,247,255,
-230,194,121,40,22,5,5,5,5,5,5,5,5,14,8,5,22,109,194,247,
-255,255,255,255,255,238,175,67,5,5,5,5,5,8,5,8,5,5,5,5,
-5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,8,8,5,5,5,
-5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,8,5,8,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,8,22,40,50,67,82,109,130,149,161,175,194,202,211,230,230,230,230,230,
-230,230,230,230,230,230,230,230,139,59,35,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,40,67,82,121,161,179,202,230,255,255,255,255,255,255,230,193,139,59,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,22,35,50,73,109,149,175,211,242,255,255,255,255,255,242,230,
-230,221,202,179,149,100,35,5,14,8,5,8,5,5,5,5,5,5,5,35,
-59,149,242,242,242,242,242,242,242,242,242,242,242,242,242,242,248,255,255,255,
-255,255,255,255,255,255,255,248,242,242,242,242,242,242,242,242,242,242,242,242,
-242,238,157,67,40,5,5,5,5,8,5,5,5,40,193,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,221,193,127,77,40,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-35,50,73,94,130,170,197,212,230,238,242,242,230,230,221,212,221,212,193,140,
-73,31,14,8,5,5,5,5,8,5,5,5,5,5,5,5,8,8,5,31,
-31,50,59,59,67,67,67,59,67,59,59,50,50,31,5,8,5,14,5,8,
-5,5,5,5,8,22,40,59,94,130,167,197,202,202,130,59,35,5,5,5,
-5,14,5,8,8,8,5,5,31,100,170,202,226,230,230,230,212,193,139,50,
-5,5,5,5,8,8,8,5,8,5,5,5,5,5,5,14,5,5,14,8,
-8,5,5,5,5,5,5,14,5,5,8,5,8,5,5,5,8,8,5,5,
-8,5,14,5,5,5,8,8,5,8,8,5,5,5,8,5,14,5,5,5,
-14,5,5,14,5,5,8,5,8,5,5,8,5,5,5,5,5,5,5,5,
-8,5,14,5,8,5,8,5,5,5,14,5,5,5,5,5,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,32,
-59,73,103,109,118,127,148,158,158,158,158,158,158,158,167,158,158,158,158,158,
-103,50,22,5,5,5,5,5,5,5,14,5,5,14,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,8,5,5,5,8,14,22,50,94,109,
-140,167,193,203,212,212,220,212,211,170,118,50,5,5,5,8,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-50,77,112,140,179,211,211,212,212,220,212,212,212,211,197,170,140,94,26,5,
-5,5,5,5,5,5,5,5,5,5,5,32,67,148,226,230,230,230,230,230,
-230,226,230,226,230,226,230,230,230,226,230,230,230,230,230,230,230,230,230,230,
-230,230,230,230,230,230,230,230,230,230,230,230,230,230,140,59,32,5,5,5,
-5,8,14,5,5,40,140,212,220,220,212,220,212,212,220,212,212,212,220,212,
-220,212,220,212,212,212,212,212,212,212,220,212,220,197,193,157,118,67,14,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,14,5,5,14,22,67,100,122,148,
-167,179,203,212,220,212,212,212,220,203,179,122,67,26,14,5,5,5,8,5,
-5,5,8,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,14,5,
-5,5,8,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,
-32,58,94,127,148,157,112,58,22,5,5,5,5,8,5,5,8,5,5,5,
-14,58,94,112,130,127,130,130,122,109,77,26,5,5,5,5,5,5,8,14,
-5,14,5,5,5,5,8,5,5,5,5,8,5,5,5,8,5,8,5,5,
-5,5,5,5,5,8,5,14,5,5,5,5,5,5,5,5,5,8,5,5,
-8,5,5,5,8,8,8,8,5,8,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-8,5,5,5,8,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,14,22,22,26,26,40,49,49,49,58,
-67,67,67,58,67,67,58,67,67,58,58,58,40,14,22,5,5,5,5,8,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,8,22,32,40,49,58,73,77,77,77,77,77,
-73,67,49,22,5,5,5,14,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,22,26,40,49,67,73,77,77,
-77,77,77,77,77,77,67,58,49,32,14,8,5,5,8,5,5,5,8,5,
-5,5,5,22,26,82,127,130,127,127,130,130,122,130,127,127,130,127,130,130,
-130,127,127,127,127,130,130,122,130,122,130,122,130,127,130,127,130,127,130,127,
-127,127,130,127,130,127,82,40,22,5,14,5,8,5,5,5,5,22,49,77,
-77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,82,77,
-77,82,77,77,82,73,67,58,49,26,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,8,26,32,49,58,67,67,73,77,77,77,77,77,
-82,73,67,49,26,14,8,5,5,5,5,5,8,5,5,5,5,8,5,5,
-8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,14,
-8,8,5,5,8,5,5,5,5,8,5,5,14,26,40,49,49,67,40,14,
-14,8,5,5,5,5,5,8,14,5,5,5,8,26,49,49,49,58,58,58,
-49,49,32,14,5,5,8,14,5,5,5,5,5,5,5,5,8,5,5,14,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,14,5,5,5,5,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,14,5,5,5,14,5,5,14,5,5,5,5,8,5,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,8,5,8,5,5,14,5,5,8,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,14,22,49,58,58,
-58,58,58,58,58,58,58,58,58,58,58,49,58,58,58,58,67,58,58,58,
-58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,40,14,
-14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,
-8,5,14,5,5,5,5,5,5,5,8,8,8,5,14,5,5,5,8,14,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,8,5,5,5,8,8,5,5,5,5,14,5,5,5,5,8,5,5,5,
-8,5,5,8,5,14,14,22,26,22,26,22,22,22,22,8,5,5,8,5,
-5,8,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,8,5,
-8,5,5,5,5,5,5,5,5,5,8,8,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,5,5,5,5,5,8,8,5,5,5,5,5,5,
-14,8,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,8,8,5,5,8,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,8,8,5,5,14,5,5,14,8,8,5,5,8,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,14,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,5,5,5,5,14,5,5,8,14,22,22,14,26,22,26,22,26,22,22,
-22,22,26,22,26,22,26,26,22,22,26,22,22,26,22,26,22,26,22,22,
-22,26,22,22,26,22,22,26,22,22,14,5,5,8,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,14,5,5,8,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,14,5,8,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,14,8,5,5,5,8,8,8,5,5,5,5,
-5,5,8,8,8,5,8,5,5,14,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,22,32,49,73,82,73,82,82,67,58,26,14,
-5,8,5,5,5,5,5,5,5,8,5,8,5,5,5,5,8,5,8,5,
-5,8,5,14,22,26,49,58,67,67,58,67,58,58,67,58,58,58,67,58,
-67,58,58,58,58,67,58,67,58,58,58,58,58,67,58,67,58,67,58,67,
-58,58,58,49,40,22,5,5,5,5,5,5,5,5,32,67,82,77,82,77,
-82,77,82,77,82,82,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
-77,77,77,77,77,77,77,77,77,77,77,82,82,82,77,67,49,26,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
-5,8,5,5,5,5,5,14,5,5,5,5,5,5,5,14,5,5,5,5,
-5,14,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,5,14,5,8,5,5,8,8,5,5,8,8,5,5,5,5,5,
-8,5,8,8,5,8,5,8,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,14,8,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,5,8,8,8,5,5,5,5,
-8,5,8,5,14,5,5,5,5,5,8,5,5,5,5,8,8,5,5,5,
-5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,8,
-5,8,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,8,5,5,
-5,5,14,5,5,8,5,5,5,5,5,8,5,5,5,8,14,5,5,8,
-8,8,5,8,5,5,8,5,5,5,5,5,5,8,5,5,5,5,5,5,
-8,5,8,5,5,5,5,8,14,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,14,5,5,8,
-32,82,139,194,212,220,212,220,179,130,82,22,5,5,5,8,8,5,5,8,
-5,8,5,5,8,5,5,5,5,5,5,5,14,14,5,14,26,73,127,157,
-157,157,157,157,167,157,157,157,167,157,157,157,157,157,167,157,157,157,157,157,
-157,167,157,167,157,157,157,157,157,157,157,157,157,167,157,130,109,40,5,5,
-5,5,5,5,5,5,82,194,212,212,212,220,212,212,212,212,212,212,212,212,
-220,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,212,220,
-212,220,220,212,212,212,212,179,122,67,22,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,8,5,8,5,8,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,8,5,5,5,
-8,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,8,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,14,5,
-8,5,5,5,14,5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,
-5,5,8,5,8,8,8,5,8,5,5,8,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,8,5,5,8,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,
-8,8,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,8,5,8,
-8,5,5,8,5,8,8,5,5,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,14,8,5,5,5,5,5,5,5,14,5,5,
-5,5,5,5,5,8,8,8,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,8,5,8,5,5,5,5,5,14,49,122,194,251,255,255,255,255,
-238,179,94,22,5,14,5,14,5,8,5,5,5,8,5,5,5,8,5,5,
-5,5,5,5,8,8,8,14,32,73,130,157,157,157,157,157,157,157,157,157,
-157,157,157,157,179,194,229,229,229,229,229,212,194,170,157,157,157,157,157,157,
-157,157,157,157,157,157,148,130,94,32,8,5,5,5,5,8,5,5,103,242,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,229,
-157,94,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,5,8,8,5,5,5,5,5,14,5,5,8,8,5,
-8,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,8,5,8,8,5,14,5,5,5,14,5,5,5,8,5,
-5,5,8,8,5,8,5,5,8,5,14,8,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,14,5,5,5,5,5,5,5,5,
-5,14,5,5,5,5,5,8,5,8,8,5,8,5,8,5,5,5,8,8,
-5,8,5,8,5,8,5,5,5,5,5,5,5,5,8,5,8,5,5,5,
-5,5,5,8,5,8,5,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,5,14,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,5,8,5,14,8,8,8,5,5,5,5,8,5,8,
-5,5,5,5,5,8,5,5,5,5,5,8,5,5,5,5,8,5,5,5,
-5,5,8,5,5,8,5,5,5,5,8,5,5,5,5,8,5,8,5,8,
-5,5,5,5,8,5,5,5,5,5,8,5,14,5,8,5,8,5,5,5,
-14,5,5,5,49,140,211,255,255,255,255,255,229,157,103,26,5,5,5,5,
-5,5,5,5,14,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-14,22,46,49,49,49,49,49,58,58,49,49,49,49,46,77,94,170,255,255,
-255,255,255,203,157,109,49,49,49,58,49,49,49,46,49,49,49,49,49,40,
-32,14,8,5,5,5,14,5,5,5,103,242,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,226,157,86,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,5,5,14,5,8,5,5,8,8,8,8,8,5,5,5,5,5,5,5,
-5,5,14,5,5,8,5,5,5,5,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-8,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,8,
-5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,8,5,5,5,5,5,8,5,5,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,8,8,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,
-8,5,8,5,8,5,8,5,5,14,8,5,8,8,5,8,8,5,14,5,
-5,5,8,5,8,5,5,5,5,5,14,5,5,8,5,8,8,5,5,5,
-5,8,5,5,14,8,5,14,8,5,5,14,5,5,5,5,5,5,8,5,
-8,5,5,5,5,8,5,5,5,5,5,8,8,5,5,5,58,157,226,255,
-255,255,255,255,226,148,77,14,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,14,5,5,8,5,8,5,5,8,5,22,22,40,46,46,49,46,49,
-40,46,46,40,46,46,40,67,103,176,255,255,255,255,255,220,161,103,46,46,
-40,50,40,50,46,46,46,46,46,40,40,40,26,14,8,5,8,8,14,5,
-5,5,94,224,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,212,140,82,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,5,5,5,5,8,8,5,5,5,5,8,5,5,
-5,8,5,8,5,5,5,5,8,5,8,8,5,5,5,5,14,8,5,5,
-5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,8,8,5,5,5,8,5,14,5,5,14,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,5,5,8,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,14,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,8,14,
-5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,8,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,5,5,5,
-5,5,5,5,5,14,8,8,5,5,8,8,5,8,5,8,5,5,5,5,
-5,5,8,8,8,8,8,5,5,5,5,5,8,5,8,8,5,5,5,5,
-5,8,5,5,5,8,8,8,5,5,8,14,5,8,8,5,5,5,8,14,
-5,5,5,5,5,5,5,5,5,14,8,5,8,5,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,58,170,238,255,255,255,255,255,211,118,46,14,
-5,8,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,14,5,8,
-5,5,5,14,26,50,103,113,118,113,113,109,113,113,109,113,109,113,113,130,
-157,203,255,255,255,255,255,238,194,157,113,118,118,113,109,118,109,113,113,109,
-113,113,109,94,73,26,5,8,5,8,5,8,5,5,82,194,224,224,224,224,
-224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,224,
-224,220,224,224,224,224,224,220,229,220,224,224,220,224,224,185,130,73,14,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,
-5,8,5,5,5,8,5,5,5,8,5,5,5,5,14,5,5,8,5,5,
-5,5,5,5,5,5,8,5,8,8,8,5,5,5,5,5,8,8,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,14,5,5,8,5,14,5,5,5,8,8,8,5,14,5,8,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,8,14,8,5,5,8,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,14,5,5,8,5,5,5,
-5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,8,5,14,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,8,5,8,5,5,8,8,8,5,8,5,5,5,5,
-5,5,5,5,5,5,8,5,8,5,8,8,5,5,5,8,8,8,8,5,
-5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,14,5,8,32,50,73,94,82,94,82,94,94,86,82,94,82,
-127,211,255,255,255,255,255,255,229,157,118,91,94,91,94,94,82,94,82,94,
-82,91,40,5,8,5,5,5,5,8,5,8,5,5,5,17,46,77,148,179,
-179,185,179,179,179,179,179,179,179,194,185,194,202,238,255,255,255,255,255,255,
-229,202,185,185,179,194,179,179,185,179,185,185,185,179,179,148,113,40,5,5,
-8,5,5,5,5,5,59,130,157,148,148,148,148,157,148,148,148,148,148,148,
-148,157,145,157,145,157,145,157,148,148,148,148,148,157,145,157,148,157,148,148,
-148,161,148,157,145,157,148,130,86,50,17,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,22,26,26,26,26,26,26,26,26,26,26,26,26,
-26,26,26,26,26,26,26,26,32,26,26,26,17,5,5,17,5,5,5,5,
-5,5,5,8,17,5,5,5,8,8,8,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,22,22,26,26,22,22,8,8,5,5,5,
-5,5,5,5,8,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,8,5,5,8,5,5,5,17,5,5,17,5,5,5,17,5,5,5,5,
-5,17,8,5,8,5,5,5,8,5,5,5,5,5,17,5,5,5,8,5,
-8,5,5,5,8,5,17,5,5,5,17,5,8,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,
-5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,17,5,5,5,5,8,8,5,5,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-8,17,5,5,5,17,5,5,5,5,5,5,5,8,8,8,5,5,8,5,
-5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,8,5,5,5,17,8,8,5,5,5,5,5,5,5,5,5,
-17,8,5,5,5,5,8,5,5,5,5,5,8,5,5,5,8,5,17,73,
-127,179,221,224,224,221,221,224,224,224,221,221,238,255,255,255,255,255,255,255,
-255,247,229,224,224,229,224,221,224,221,224,224,224,221,112,5,5,5,17,8,
-5,8,5,17,5,5,5,17,59,109,202,255,255,255,255,255,255,255,255,255,
-247,255,255,251,255,255,255,255,255,255,255,255,255,255,247,255,247,255,247,255,
-251,255,255,247,255,247,247,202,148,59,5,5,5,5,5,5,5,5,22,32,
-50,50,50,50,50,50,40,50,50,50,50,50,50,50,50,50,50,50,50,50,
-50,50,50,50,50,50,50,40,50,50,50,50,50,50,40,50,50,50,50,40,
-26,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,17,40,
-59,67,59,59,67,67,67,67,67,67,59,59,67,67,59,67,59,59,67,59,
-67,67,50,50,26,17,5,8,8,5,5,5,5,5,5,5,5,8,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,26,59,59,59,50,32,22,5,5,8,5,5,5,5,5,5,8,17,5,
-5,8,5,5,5,5,8,5,8,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,
-5,5,8,5,5,5,5,5,5,5,8,17,5,5,5,5,8,5,5,5,
-5,17,5,5,5,5,8,5,5,5,8,5,8,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,8,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,17,5,5,5,5,5,8,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,17,8,5,5,5,5,5,17,5,5,5,5,5,5,5,8,5,
-5,5,5,5,5,5,5,5,8,5,17,8,5,8,5,5,5,8,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,17,5,5,8,5,5,
-5,5,5,5,5,5,5,5,8,5,22,82,157,229,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,130,5,5,5,5,5,8,5,5,5,5,5,5,22,
-50,118,229,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,229,
-163,59,5,5,5,5,5,5,5,5,22,40,50,50,50,50,50,50,50,40,
-50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
-50,50,50,50,50,50,50,50,50,50,50,40,32,22,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,22,94,139,139,139,139,139,139,139,139,
-139,139,139,139,130,139,145,139,139,139,139,139,130,139,130,109,67,5,8,8,
-5,5,5,5,5,5,5,5,5,8,5,5,5,17,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,67,127,139,145,109,73,40,
-5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,8,8,8,5,5,8,5,8,5,5,5,5,5,5,8,5,5,5,
-17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,17,5,5,8,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-8,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,8,5,5,5,5,5,17,5,5,17,5,5,5,5,5,17,5,5,5,
-5,5,5,5,5,8,5,5,5,8,8,5,5,5,5,5,5,5,5,5,
-8,5,17,82,163,229,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,130,5,
-5,5,5,5,5,5,5,5,5,5,5,22,50,118,229,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,233,163,67,5,5,5,5,5,8,
-5,5,50,109,112,118,112,112,118,118,118,118,118,112,118,112,112,112,112,112,
-118,118,112,118,112,112,112,118,118,118,118,118,118,118,118,118,118,112,118,118,
-118,112,112,94,67,40,17,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,32,148,242,242,238,242,242,242,242,242,242,242,242,242,242,242,242,242,
-242,238,242,242,242,242,212,193,109,17,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,5,
-5,5,5,5,5,103,221,242,242,193,127,67,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,22,77,148,203,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,251,255,255,255,255,255,242,131,5,5,5,5,5,5,5,5,5,
-5,5,5,22,59,127,229,255,255,255,255,255,255,242,203,193,193,193,193,193,
-193,193,193,193,193,193,193,193,193,193,193,193,193,193,193,203,221,255,255,255,
-255,255,255,229,167,59,5,5,5,5,5,5,5,5,73,163,193,181,193,181,
-193,181,193,193,193,193,193,181,181,181,193,181,193,193,193,193,181,193,193,181,
-193,193,193,193,193,193,181,193,193,181,181,193,193,185,193,148,109,59,13,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,32,157,233,233,238,238,
-233,233,238,233,238,229,238,238,238,233,238,233,238,238,233,233,238,233,212,181,
-109,17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,13,5,5,5,13,5,5,5,5,5,5,5,121,255,255,
-255,212,148,77,5,5,5,5,5,5,5,5,13,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,17,64,131,181,229,229,221,221,221,229,229,221,229,229,
-242,255,255,255,255,255,255,255,255,229,229,221,221,221,229,229,229,221,221,221,
-221,221,109,5,5,5,5,5,5,5,5,5,5,5,5,22,50,118,229,255,
-255,255,255,255,255,203,94,59,59,50,59,50,50,59,50,59,50,50,59,59,
-59,50,50,50,59,50,59,85,127,215,255,255,255,255,255,229,167,64,5,5,
-5,5,5,5,5,5,94,221,255,255,255,255,255,255,242,251,255,255,255,255,
-255,255,255,255,255,255,255,255,255,251,255,251,255,251,255,242,251,255,255,242,
-255,251,255,255,255,255,255,211,140,85,22,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,22,104,167,167,167,167,167,167,167,167,167,167,167,163,
-167,167,167,167,167,163,175,167,167,167,149,131,73,13,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,118,255,255,255,212,149,77,5,5,5,5,
-14,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,50,
-85,118,140,140,140,140,140,140,149,140,163,175,212,255,255,255,255,255,255,251,
-211,163,149,140,149,140,140,140,140,149,140,140,140,140,64,5,5,5,5,5,
-5,8,5,5,5,5,5,22,59,127,229,255,255,255,255,255,255,188,50,5,
-5,8,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,14,50,
-104,203,255,255,255,255,255,229,167,64,5,5,5,5,5,5,5,5,104,242,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,229,
-163,86,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,64,
-94,94,94,94,94,94,94,94,94,94,94,103,94,94,94,94,94,94,103,94,
-94,94,94,73,50,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,8,5,5,
-5,127,255,255,255,212,149,77,5,5,5,5,8,8,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,14,8,8,14,22,32,40,40,40,40,40,40,
-40,40,59,104,175,242,255,255,255,255,255,229,163,64,40,40,40,40,40,40,
-40,40,40,40,40,40,22,5,5,5,5,5,5,8,5,5,5,5,5,14,
-59,118,229,255,255,255,255,255,255,188,50,5,5,5,8,5,5,5,5,5,
-5,5,14,5,5,5,5,5,5,5,8,50,103,203,255,255,255,255,255,233,
-167,64,5,5,5,5,5,5,5,5,103,242,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,229,154,86,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,22,31,31,31,32,31,31,31,31,
-31,32,31,31,31,31,32,31,32,31,31,31,31,31,31,22,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,8,5,5,5,5,8,5,8,118,255,255,255,212,140,77,
-5,5,14,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,5,5,5,8,5,32,94,163,242,255,255,
-255,255,255,211,131,31,5,8,8,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,8,5,5,5,5,5,5,22,59,118,233,255,255,255,255,255,
-255,188,50,5,5,5,5,5,5,5,5,5,8,5,5,5,8,5,8,5,
-5,5,8,50,94,211,255,255,255,255,255,233,163,59,5,5,5,8,5,8,
-5,5,64,163,188,188,188,188,188,188,212,255,255,255,255,255,255,255,255,255,
-238,211,197,188,188,188,179,188,188,188,179,188,188,188,188,188,179,188,188,188,
-188,179,188,154,104,64,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,31,32,
-32,32,32,31,32,131,255,255,255,221,163,86,31,32,31,32,32,22,22,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,
-5,14,14,5,5,5,32,104,170,242,255,255,255,255,242,197,118,32,5,14,
-5,14,5,5,14,5,14,14,14,5,14,5,5,5,5,5,5,5,5,5,
-5,5,5,22,50,118,224,255,255,255,255,255,255,188,50,5,5,5,14,5,
-5,5,5,5,14,5,5,5,14,5,14,5,5,5,14,50,94,203,255,255,
-255,255,255,233,163,64,5,5,5,5,5,5,5,5,31,40,50,50,50,50,
-50,50,131,233,255,255,255,255,255,255,255,255,179,103,73,50,50,50,50,50,
-50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,35,35,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,14,
-5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,22,59,59,64,59,59,64,59,154,255,255,
-255,224,170,118,64,59,64,64,59,50,35,22,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,14,5,5,40,118,
-188,242,255,255,255,255,242,179,112,31,5,14,5,5,5,5,5,5,5,5,
-5,14,5,5,5,5,5,5,5,14,5,5,5,5,5,22,59,118,224,255,
-255,255,255,255,255,188,50,5,5,5,5,14,5,5,5,5,5,5,5,14,
-5,14,5,5,5,5,14,40,86,170,233,233,233,233,221,188,139,50,5,14,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,94,197,242,255,255,255,
-255,255,255,255,170,94,40,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,
-5,50,118,149,145,149,149,149,149,203,255,255,255,247,212,179,149,149,145,149,
-145,109,73,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,40,127,197,255,255,255,255,255,238,167,
-103,31,8,5,5,5,8,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,22,50,118,224,255,255,255,255,255,255,188,50,5,
-5,5,8,5,14,5,5,5,5,5,5,5,5,5,8,8,5,5,14,35,
-59,118,158,158,158,158,148,139,103,40,5,5,5,5,5,14,5,5,5,8,
-5,5,5,8,5,8,82,158,224,255,255,255,255,255,255,255,194,118,59,5,
-5,5,5,14,5,5,5,5,14,5,5,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,82,203,255,251,255,247,255,
-247,255,255,255,255,255,255,255,251,247,255,251,247,179,118,59,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,50,145,211,255,255,255,255,255,224,148,82,22,5,14,5,8,5,5,
-5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,22,
-59,118,224,255,255,255,255,255,255,188,50,5,5,5,8,5,8,5,5,5,
-5,8,5,5,5,5,14,5,5,5,5,22,35,73,94,94,94,86,86,77,
-50,31,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,59,118,
-194,255,255,255,255,255,255,255,212,157,64,5,5,5,5,5,5,5,5,5,
-5,5,5,14,8,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,94,230,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,203,131,59,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,8,5,5,5,14,5,14,5,5,5,50,161,224,255,255,255,
-255,255,220,131,67,22,5,5,5,8,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,22,50,121,224,255,255,255,255,255,
-255,188,50,5,5,5,5,5,8,5,5,5,5,5,14,5,5,5,5,5,
-5,5,5,8,14,22,22,22,26,22,22,22,8,14,5,5,5,5,5,5,
-5,5,5,5,5,8,8,5,8,5,40,67,175,255,255,255,255,255,255,255,
-230,188,82,5,8,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,8,5,14,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,94,230,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,203,131,67,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,5,5,8,5,5,5,
-8,5,5,5,5,5,59,175,242,255,255,255,255,255,212,112,59,22,5,5,
-5,8,5,5,5,14,5,5,8,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,22,59,125,224,255,255,255,255,255,255,188,59,22,8,5,8,5,
-8,5,5,5,14,5,8,5,5,14,5,5,14,5,5,14,5,14,5,8,
-5,5,5,5,5,5,8,8,5,5,8,5,5,5,14,5,5,5,8,5,
-5,5,22,35,145,255,255,255,255,255,255,255,255,212,109,14,14,5,5,5,
-5,5,5,14,5,5,8,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,77,188,230,230,230,230,230,230,248,255,255,
-255,255,255,242,230,230,230,230,220,167,109,49,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,67,188,
-255,255,255,255,255,255,212,109,59,14,14,5,5,5,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,22,49,118,230,255,
-255,255,255,255,255,203,82,22,14,5,5,5,5,8,5,8,5,5,14,5,
-5,5,8,14,8,5,5,5,5,5,8,5,8,5,5,8,5,5,5,5,
-8,14,5,5,5,5,5,5,5,5,5,8,5,5,8,14,118,230,255,255,
-255,255,255,255,255,242,131,35,22,5,5,5,5,5,5,5,8,8,8,8,
-5,5,5,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,
-5,49,131,161,161,161,161,157,161,211,255,255,255,255,220,188,157,161,161,161,
-157,112,82,40,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,14,8,
-5,5,5,5,5,5,5,5,5,14,73,202,255,255,255,255,255,255,202,82,
-35,14,8,5,5,5,14,5,14,5,5,8,14,5,5,5,5,5,5,5,
-5,5,5,5,8,5,14,22,50,118,224,255,255,255,255,255,255,211,104,40,
-14,5,5,5,8,8,8,5,5,5,8,5,5,8,8,8,5,8,5,5,
-5,5,8,5,14,5,5,8,8,8,8,5,5,5,5,5,5,5,5,8,
-5,5,14,5,5,5,5,5,94,184,230,255,255,255,255,255,255,255,161,73,
-35,5,5,5,14,8,5,5,8,5,14,5,5,5,8,5,8,8,5,8,
-14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,8,5,5,
-5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,40,77,91,91,91,82,94,
-94,167,255,255,255,230,188,139,91,91,91,91,91,67,50,22,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,5,5,5,5,8,5,5,5,14,5,5,
-14,14,82,211,255,255,255,255,255,255,194,59,8,5,5,5,5,14,8,8,
-5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,5,14,
-50,104,224,255,255,255,255,255,255,221,130,64,22,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,8,5,
-8,5,5,5,5,5,8,8,8,5,5,8,8,8,8,5,8,8,5,5,
-64,118,202,255,255,255,255,255,255,255,188,118,50,8,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,14,14,22,22,22,22,22,14,130,255,255,255,221,157,91,
-22,22,22,22,22,14,22,8,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,14,40,64,94,118,118,118,118,118,118,118,118,163,242,255,255,255,255,
-255,255,224,145,118,118,118,118,118,118,118,112,118,118,118,118,118,112,59,5,
-5,5,5,5,5,5,5,5,5,8,5,14,26,91,202,255,255,255,255,255,
-255,238,170,104,26,5,5,5,5,5,5,5,5,5,5,8,8,5,8,5,
-5,5,5,5,5,5,5,5,5,5,8,5,8,14,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,8,5,5,40,59,163,255,255,255,255,255,
-255,255,224,170,82,14,8,5,8,5,5,5,5,5,5,5,5,5,8,14,
-5,8,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,8,5,14,5,5,5,8,14,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,118,255,255,255,212,145,77,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,77,145,202,255,255,
-255,255,255,255,242,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,118,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,64,188,255,255,255,255,255,255,255,212,130,35,5,5,5,
-5,8,5,8,14,8,5,5,8,5,5,5,5,5,8,5,5,5,5,5,
-5,5,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-14,5,5,8,14,14,118,221,242,255,255,255,255,255,255,224,118,35,22,5,
-5,5,5,5,5,8,5,14,5,5,5,5,8,5,8,5,5,5,8,5,
-5,5,5,5,14,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,118,255,255,
-255,221,145,77,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,14,5,5,14,82,161,224,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,130,5,5,5,5,5,5,5,5,5,5,5,5,5,5,49,145,212,
-255,255,255,255,255,255,242,167,59,26,5,5,5,5,8,5,5,5,5,8,
-5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,8,8,5,5,5,5,5,5,5,5,5,5,5,73,145,
-212,255,255,255,255,255,255,255,167,94,49,5,5,8,5,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,22,73,125,118,118,118,118,118,118,118,118,118,118,118,118,118,
-125,118,118,118,118,125,118,118,118,118,118,125,109,94,49,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,118,255,255,255,221,145,77,5,5,8,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,8,22,82,
-161,224,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,130,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,31,100,170,242,255,255,255,255,255,255,203,
-94,40,14,5,8,5,14,8,5,8,8,8,5,8,5,5,14,5,5,5,
-14,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,8,5,5,
-5,14,8,5,5,8,8,5,5,8,32,64,163,255,255,255,255,255,255,255,
-230,170,77,5,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,14,5,5,5,5,5,5,5,5,8,5,8,8,5,31,157,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,230,197,109,14,14,14,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,118,255,255,255,212,149,77,5,5,14,5,5,5,5,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,14,64,130,179,220,220,220,220,220,220,
-230,242,255,255,255,255,255,255,255,255,242,230,220,230,220,220,220,220,220,220,
-220,220,220,220,220,215,109,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,22,59,121,215,255,255,255,255,255,255,230,175,100,31,14,5,14,5,5,
-5,5,5,5,5,5,5,14,5,14,5,5,5,5,5,5,14,5,5,14,
-5,5,14,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,14,
-5,5,14,31,121,203,242,255,255,255,255,255,255,220,139,64,32,14,5,14,
-5,5,5,14,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,31,175,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,242,215,121,5,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,91,179,194,194,145,94,49,
-5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,14,49,91,125,149,157,149,157,145,157,163,194,230,255,255,255,255,255,
-255,242,203,163,157,149,157,157,145,157,157,145,157,157,149,157,157,149,77,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,73,179,242,255,255,
-255,255,255,255,238,149,40,14,5,5,5,5,14,5,14,5,5,14,5,5,
-5,5,14,5,5,5,5,14,5,5,5,5,14,14,14,14,14,5,5,5,
-14,5,5,5,14,5,5,5,5,14,5,5,5,5,5,5,64,130,202,255,
-255,255,255,255,255,255,202,139,59,14,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,14,5,5,5,5,5,5,5,14,5,14,5,5,14,5,
-31,175,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,220,112,14,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,40,82,94,82,59,32,22,5,5,5,5,14,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,5,14,32,50,67,91,77,
-82,82,82,82,104,163,211,255,255,255,255,255,255,202,163,104,82,82,82,82,
-82,82,82,82,82,82,82,82,77,82,40,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,40,104,170,233,255,255,255,255,255,255,202,125,73,
-22,14,5,5,8,5,5,5,5,8,5,8,5,5,5,5,5,5,5,5,
-8,5,5,14,5,8,8,5,5,8,14,5,5,5,5,5,5,5,8,5,
-14,5,5,5,5,5,5,14,41,67,140,203,248,255,255,255,255,255,238,194,
-130,67,32,5,5,5,5,5,5,8,5,8,8,14,5,5,8,5,5,8,
-5,5,5,5,5,14,8,5,5,5,5,5,22,104,163,163,163,157,163,163,
-163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,163,157,
-140,121,67,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,41,41,
-41,32,14,14,5,5,5,8,5,8,5,5,8,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,8,14,14,14,14,14,22,46,125,188,242,
-255,255,255,255,238,170,100,32,14,14,14,14,14,14,14,14,14,14,14,14,
-14,14,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-32,82,194,242,255,255,255,255,255,255,224,140,31,14,5,5,5,5,14,5,
-5,5,8,14,5,5,5,5,5,5,5,5,8,5,8,5,5,14,5,8,
-5,5,5,5,5,5,5,8,8,5,5,5,5,5,5,5,5,5,5,5,
-5,14,73,130,212,255,255,255,255,255,255,255,203,130,59,8,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,8,5,5,5,8,8,5,5,5,5,
-5,5,5,5,5,14,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
-22,22,22,22,22,31,22,31,22,31,22,31,22,22,14,8,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,14,14,8,8,5,5,5,5,5,8,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,8,8,5,
-5,5,8,5,5,5,5,8,41,130,211,251,255,255,255,255,233,157,94,22,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,50,109,163,220,255,255,255,
-255,255,255,194,130,82,50,22,8,5,8,5,5,5,8,5,5,5,14,5,
-5,5,5,5,14,5,5,5,5,5,5,8,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,8,5,5,5,5,5,5,14,35,76,130,194,233,255,
-255,255,255,255,238,202,140,94,44,31,8,5,8,5,5,8,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,8,5,5,8,5,5,5,5,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,5,8,8,5,5,8,5,5,5,8,5,
-50,148,224,255,255,255,255,255,233,140,76,22,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,14,31,82,167,224,255,255,255,255,255,255,238,161,82,44,
-8,5,5,5,5,5,8,5,14,5,8,5,5,5,5,5,8,5,8,8,
-8,5,8,14,5,8,5,5,5,5,5,8,8,5,5,8,5,14,5,5,
-5,5,5,8,5,8,8,14,59,94,179,247,255,255,255,255,255,255,238,179,
-100,41,22,5,8,8,8,5,5,5,5,5,5,5,5,5,8,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,8,5,14,5,5,5,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-8,5,5,5,8,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,8,
-5,8,8,5,5,8,5,5,8,5,5,5,50,161,247,255,255,255,255,255,
-224,130,59,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,41,
-100,139,188,224,255,255,255,255,255,220,175,127,94,67,50,31,5,8,5,5,
-5,5,8,5,5,5,5,8,5,8,14,5,5,5,14,5,5,5,5,5,
-5,5,5,8,8,5,5,5,5,8,8,5,5,5,5,5,5,5,14,8,
-31,50,109,148,188,224,255,255,255,255,255,230,179,145,103,76,59,46,41,41,
-41,35,22,22,5,8,5,5,8,5,5,8,5,5,5,5,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,8,5,5,8,5,5,8,8,8,5,14,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5,
-5,8,14,5,50,179,255,255,255,255,255,255,212,109,46,22,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,8,5,8,5,46,94,167,247,255,255,255,
-255,255,255,229,167,130,94,50,5,5,5,5,5,5,8,8,5,5,5,5,
-8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,8,14,5,8,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,14,22,46,109,163,220,255,
-255,255,255,255,255,247,188,148,109,91,76,68,68,59,41,26,14,5,5,5,
-8,5,8,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,8,5,5,5,5,8,8,5,5,5,14,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,5,5,5,5,5,8,5,8,5,5,5,5,67,188,255,255,
-255,255,255,255,212,109,41,14,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,22,46,94,139,170,202,229,247,255,255,255,229,202,179,163,
-130,121,104,104,104,104,104,104,104,67,40,22,8,5,5,5,5,5,5,5,
-8,5,5,5,8,5,14,5,5,8,5,5,8,5,5,5,5,5,8,14,
-5,5,5,5,5,5,14,22,59,85,130,157,188,212,247,255,255,255,229,212,
-188,179,170,170,167,157,121,76,14,5,5,5,5,5,5,5,8,14,5,8,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,14,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,8,5,5,5,5,8,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,8,5,5,5,5,5,59,197,255,255,255,255,255,255,202,82,35,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,14,14,
-26,67,121,170,229,247,255,255,255,255,255,255,255,239,211,202,211,211,202,220,
-202,127,59,35,5,14,14,8,5,5,8,5,5,14,5,5,5,8,5,14,
-5,5,5,14,5,5,5,5,5,14,5,14,8,5,5,5,5,8,5,5,
-5,14,22,40,94,148,197,247,255,255,255,255,255,255,255,255,255,247,202,121,
-35,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,5,5,5,5,5,5,5,5,5,14,8,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,5,14,14,
-59,157,212,212,212,211,212,211,157,59,14,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,14,40,59,94,121,140,163,170,
-188,197,212,212,212,197,179,179,179,170,170,163,140,94,40,22,5,8,8,5,
-5,5,5,5,8,5,5,5,5,8,5,5,5,5,5,5,5,8,5,5,
-5,5,8,8,5,5,5,5,5,5,5,5,5,5,8,22,50,82,109,130,
-140,163,179,179,202,202,211,202,185,157,130,82,22,5,5,8,5,5,5,5,
-5,5,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,14,5,8,5,5,14,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,8,8,8,14,50,112,140,148,140,148,136,130,
-91,26,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,
-5,5,5,5,5,5,5,5,8,22,40,67,94,118,140,140,140,140,136,140,
-140,127,130,94,67,50,22,14,8,5,8,5,5,8,5,5,5,5,5,8,
-5,14,5,5,5,5,5,5,5,8,8,8,8,8,5,5,8,5,8,8,
-8,5,5,5,5,5,5,5,8,5,5,5,26,37,67,82,127,130,140,118,
-91,67,50,26,14,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,8,14,5,5,5,5,5,5,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,5,5,5,5,5,
-5,5,5,14,26,59,73,77,77,77,73,67,50,14,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,14,26,37,50,67,73,77,77,77,73,77,73,73,59,50,50,22,14,8,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,5,5,5,14,5,5,5,5,8,5,5,5,5,5,5,5,5,8,
-5,5,5,14,14,14,26,50,67,67,77,59,50,37,26,14,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,5,5,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5
-};
 
-#endif /* MATRIX_FONTS_H */
+#pragma once
+
+#include <rsAsset/rsAsset.h>
+
+/* data from font.raw, 131072 bytes */
+
+static const uint8_t font_packed[] = {
+66,90,104,57,49,65,89,38,83,89,221,48,16,173,0,32,107,127,255,255,255,255,255,255,
+255,255,255,253,38,83,9,132,194,97,50,152,76,38,19,40,148,202,100,50,25,12,134,83,
+33,144,200,224,132,159,35,190,227,162,64,15,151,53,182,91,2,219,109,108,109,100,148,211,
+90,245,211,76,171,109,179,108,48,46,218,74,219,109,102,212,5,84,88,193,108,52,86,144,
+162,162,1,74,170,86,153,65,106,140,66,82,91,98,13,52,20,166,180,18,72,160,160,0,
+14,58,10,93,245,221,182,149,182,82,162,77,178,201,90,203,74,150,217,85,92,214,51,51,
+4,85,33,74,138,185,106,167,93,43,139,90,211,173,216,123,173,239,110,129,196,40,83,161,
+166,128,85,94,190,243,221,13,73,247,183,10,189,41,239,120,0,239,62,221,10,30,109,15,
+190,238,134,243,237,221,230,235,125,236,121,230,116,3,231,188,117,30,95,119,14,96,204,96,
+246,220,199,156,238,27,190,231,61,158,251,222,175,23,189,222,188,43,110,229,57,93,161,179,
+32,17,163,3,65,160,69,154,101,58,58,246,212,163,94,189,30,180,20,26,9,219,64,246,
+195,160,179,5,137,128,235,77,5,27,167,107,238,30,119,217,205,180,18,83,232,11,111,166,
+151,123,185,71,125,235,239,125,71,207,119,28,236,50,117,85,102,107,79,166,169,209,142,190,
+239,46,60,238,157,187,217,239,158,251,238,222,0,0,0,0,0,53,49,2,2,2,4,201,
+161,136,192,6,152,0,38,0,64,134,152,144,104,138,123,73,233,26,158,20,52,208,208,24,
+70,132,83,244,32,8,208,16,2,1,2,100,167,134,134,152,105,163,76,154,1,52,211,36,
+152,202,26,9,234,104,200,0,3,64,0,212,242,8,128,128,153,2,50,0,154,104,196,211,
+76,154,97,26,104,200,21,61,149,63,76,76,147,209,76,79,210,143,81,132,209,137,166,128,
+0,13,61,18,65,1,50,1,52,42,158,244,201,137,61,9,233,170,122,106,123,77,83,106,
+159,234,104,161,234,6,128,1,145,161,160,6,128,208,26,0,0,148,244,137,16,16,2,26,
+147,205,84,242,167,166,245,79,74,126,168,98,104,49,52,26,52,192,70,141,3,65,144,52,
+209,166,17,161,160,104,104,12,130,77,36,144,83,209,19,13,19,2,104,50,76,209,169,180,
+6,41,148,240,166,122,37,61,79,80,26,63,84,244,17,136,0,0,1,166,134,134,135,14,
+154,7,76,100,22,5,225,36,9,59,44,32,41,0,145,96,65,97,33,49,132,37,72,79,
+123,220,239,116,30,206,216,209,33,136,7,189,188,246,247,154,128,69,33,133,180,141,66,145,
+168,194,129,223,43,125,39,208,241,77,202,80,121,184,38,85,152,83,136,77,133,152,152,72,
+166,43,242,206,32,1,21,125,89,193,133,64,25,223,217,0,132,139,184,220,214,154,140,204,
+121,248,253,30,177,226,191,18,115,88,21,249,70,126,126,103,238,40,224,80,136,213,245,250,
+253,130,127,215,246,159,230,32,254,95,179,104,132,229,254,191,164,65,175,246,182,47,214,6,
+166,23,127,251,254,237,159,244,24,254,145,250,127,116,91,104,143,235,254,239,236,254,208,21,
+83,218,216,80,16,72,187,253,236,192,15,254,255,210,87,239,166,190,16,255,191,13,129,166,
+202,255,243,255,146,229,121,254,252,8,236,82,7,255,25,206,75,223,15,230,24,31,253,254,
+123,0,229,187,142,19,18,73,212,100,155,91,9,186,33,163,49,190,196,62,198,123,204,246,
+64,129,34,129,34,135,214,138,44,128,176,135,216,126,223,211,247,104,55,160,27,32,125,95,
+117,38,225,15,175,91,125,218,33,226,220,95,175,236,179,235,209,172,226,194,217,0,219,132,
+29,254,14,14,104,189,109,240,45,93,40,163,81,2,85,202,93,79,94,230,217,215,178,80,
+64,97,151,20,219,58,243,240,244,204,223,232,100,15,74,16,167,197,67,231,244,89,242,229,
+63,237,58,255,155,63,149,129,243,50,31,71,211,244,156,189,59,73,204,36,132,254,111,63,
+12,9,103,26,73,252,254,131,118,73,54,61,52,9,224,72,19,210,135,207,233,108,3,206,
+200,67,208,32,249,253,146,0,7,161,62,116,9,15,161,80,172,136,128,43,45,60,168,160,
+118,140,48,144,214,41,89,12,0,21,35,3,158,155,208,0,176,74,172,162,11,33,91,19,
+19,140,193,213,128,192,97,43,9,40,86,67,164,186,189,45,164,29,191,134,14,118,81,167,
+168,83,139,216,7,199,214,177,243,124,153,242,176,219,148,164,248,217,230,60,214,19,200,146,
+124,41,60,204,158,70,73,230,123,41,13,108,20,132,226,155,32,25,240,208,37,182,64,182,
+200,30,81,0,56,15,153,36,49,36,159,18,16,53,181,191,151,184,66,64,63,42,72,121,
+16,242,124,62,92,33,166,67,95,5,60,9,43,228,19,223,29,124,23,198,250,31,119,42,
+120,252,249,214,129,226,247,236,39,99,221,41,39,180,95,191,2,31,70,190,124,36,240,251,
+133,144,240,164,149,132,246,31,105,0,210,67,216,165,36,159,115,2,196,146,67,194,146,29,
+54,73,39,86,73,36,59,236,89,39,125,33,223,18,39,230,180,66,219,241,167,201,175,6,
+120,25,224,100,242,61,207,7,123,192,107,169,252,175,93,157,214,113,119,33,224,66,126,134,
+64,59,108,3,123,11,123,57,9,219,64,198,16,238,122,108,129,82,66,124,9,14,234,61,
+73,9,36,129,39,115,187,249,39,209,235,251,217,232,106,5,116,231,207,74,154,73,185,196,
+22,29,166,79,14,215,238,113,217,0,210,13,1,64,136,92,173,132,1,24,31,204,84,183,
+127,29,114,186,89,34,182,138,181,206,158,67,13,30,66,175,159,60,162,86,87,225,183,57,
+130,180,18,50,26,252,28,156,69,60,29,50,71,155,108,253,61,58,109,229,214,7,73,244,
+167,133,226,205,239,141,43,186,208,89,241,51,16,49,80,230,244,252,185,71,118,67,121,23,
+100,227,8,86,233,81,165,82,143,22,58,79,205,241,188,197,223,202,85,162,137,246,66,47,
+56,123,221,142,188,44,7,99,159,28,243,113,0,22,162,101,6,225,153,228,212,18,160,65,
+236,19,47,148,128,142,111,132,88,252,220,211,136,110,206,91,95,1,199,205,172,29,53,138,
+245,127,165,115,236,106,34,52,163,24,176,59,59,251,25,255,75,5,158,84,207,158,148,55,
+171,216,165,21,34,43,215,227,33,220,38,131,126,233,94,39,125,22,147,16,138,2,12,226,
+247,117,220,172,54,114,24,79,9,105,213,243,176,139,105,92,146,162,94,240,130,167,138,79,
+46,182,27,184,168,168,154,165,107,111,2,87,189,224,227,161,100,142,211,107,42,196,223,229,
+119,85,188,77,25,55,76,212,134,141,213,102,19,194,213,133,96,175,176,89,219,64,182,54,
+140,101,65,68,182,178,21,14,141,246,116,61,55,114,235,118,98,10,176,248,121,67,19,41,
+75,149,56,51,50,29,18,223,200,113,52,132,67,240,30,46,109,229,45,250,100,84,161,124,
+39,15,44,180,165,90,181,123,218,241,79,54,141,46,201,228,92,121,177,163,193,175,125,238,
+219,77,39,155,3,130,71,155,92,26,219,33,179,62,168,77,72,243,72,53,201,143,114,83,
+34,156,154,54,27,185,69,220,23,217,235,219,10,52,227,229,180,30,16,174,198,208,100,172,
+109,164,68,123,90,137,86,212,79,206,121,39,21,16,196,85,5,85,232,213,69,26,224,205,
+216,237,2,39,115,85,137,158,177,85,130,198,84,72,136,197,94,27,174,59,90,119,114,204,
+83,202,53,171,118,67,150,111,0,173,171,42,162,224,121,69,40,43,3,161,4,109,87,224,
+195,241,236,136,165,87,203,148,58,228,39,202,7,106,88,157,186,148,100,149,146,81,220,134,
+101,145,78,194,20,67,100,1,107,17,39,58,28,25,137,185,37,215,27,39,66,152,133,80,
+37,204,73,219,79,139,125,156,226,203,142,22,69,128,105,176,122,27,83,150,208,80,243,104,
+221,11,251,146,136,236,214,115,203,161,248,121,235,13,181,219,159,11,208,0,141,238,149,138,
+20,167,115,168,17,173,141,168,107,224,241,229,226,230,69,46,146,152,183,241,166,48,222,155,
+33,203,85,68,85,234,218,247,173,89,254,166,86,15,43,89,7,220,17,168,65,58,72,39,
+57,1,83,233,98,124,100,69,167,36,174,176,141,42,138,133,178,187,61,114,91,199,179,227,
+158,8,121,181,209,235,155,216,28,222,72,109,59,249,86,175,69,246,229,136,220,243,111,73,
+219,217,189,159,40,19,102,171,18,39,52,34,168,53,122,79,2,182,219,65,131,50,178,31,
+123,76,172,20,202,10,200,85,3,181,170,119,94,14,30,183,18,195,16,93,207,4,38,42,
+181,154,229,76,77,50,86,3,23,147,155,80,238,21,49,32,69,55,208,111,23,201,141,145,
+219,79,86,26,76,70,43,74,134,82,22,133,191,14,120,218,134,39,88,64,114,69,185,57,
+64,193,162,193,160,85,62,153,20,23,146,123,39,38,140,166,132,74,164,1,3,19,213,249,
+73,216,216,171,208,37,148,116,196,246,73,80,173,221,173,120,239,178,44,133,4,252,143,65,
+77,94,5,195,15,174,221,87,35,197,224,215,94,55,68,184,120,92,91,55,186,158,87,28,
+87,215,85,40,250,28,107,72,57,83,181,168,42,29,61,3,157,214,13,82,130,155,200,116,
+125,154,229,146,180,49,164,65,78,72,175,6,110,126,124,191,109,237,119,183,10,178,150,93,
+218,197,102,67,89,248,197,22,135,68,117,4,185,148,243,123,158,38,221,175,70,187,144,214,
+72,209,187,56,237,56,228,69,226,215,77,242,214,190,251,142,198,96,11,186,18,36,5,69,
+76,107,104,146,197,165,83,223,42,119,200,188,223,133,197,94,229,56,225,237,229,69,145,223,
+122,214,139,203,152,161,181,176,44,90,150,7,51,19,139,19,205,246,75,87,213,56,181,193,
+49,165,90,232,157,232,22,226,23,245,202,196,243,212,46,67,78,238,62,114,87,171,4,123,
+55,177,184,52,138,45,122,54,144,76,221,49,76,39,27,154,38,155,195,145,189,186,201,92,
+155,241,139,2,160,226,211,231,13,28,22,84,77,33,30,41,41,174,204,156,204,216,233,149,
+107,241,191,181,153,162,241,203,39,190,72,65,225,121,104,179,72,243,37,30,79,12,191,254,
+107,185,189,108,238,104,162,239,23,94,246,82,249,200,46,154,130,71,195,172,246,239,213,156,
+183,150,196,242,125,174,0,67,163,215,234,38,222,112,50,31,131,107,63,92,209,16,28,211,
+108,170,9,60,4,113,240,68,186,148,40,68,241,231,82,212,21,126,250,5,75,149,163,223,
+43,131,142,147,159,25,89,146,171,104,180,25,80,164,120,255,14,119,207,195,45,187,176,24,
+44,64,181,54,110,186,136,0,19,119,108,75,153,97,220,242,200,161,187,83,104,91,98,41,
+180,191,147,120,114,65,231,44,236,155,136,90,70,189,252,114,204,240,128,98,87,120,233,236,
+118,86,168,254,231,56,198,131,149,186,239,105,82,4,17,102,231,97,209,236,41,60,230,154,
+197,74,246,75,17,76,184,53,253,61,129,208,3,109,213,124,161,95,9,0,183,203,206,22,
+208,181,137,94,141,90,244,73,95,47,187,2,232,219,194,202,230,250,60,182,34,169,67,240,
+50,235,85,84,25,240,75,27,33,195,121,88,42,3,71,11,47,169,222,50,198,147,19,173,
+179,2,104,73,105,210,244,42,202,58,4,255,30,111,105,96,109,18,215,9,160,64,8,246,
+30,35,46,56,171,60,235,215,58,47,53,252,127,66,107,191,54,78,169,204,79,156,149,225,
+14,214,249,247,125,237,157,250,135,20,34,34,68,87,239,60,37,161,1,171,161,189,131,243,
+189,229,45,4,1,184,198,225,193,83,69,104,85,71,14,77,113,74,245,218,82,240,247,202,
+242,106,218,58,145,227,211,57,240,130,136,157,36,18,176,197,145,44,71,17,192,252,21,212,
+88,108,138,219,184,122,213,27,128,22,214,71,205,109,44,53,155,137,6,249,112,187,93,188,
+30,203,220,230,225,45,69,14,115,41,93,98,7,26,98,1,11,110,155,103,1,62,196,13,
+145,124,217,198,17,1,227,199,232,133,242,212,238,72,116,103,57,70,217,41,185,225,129,35,
+9,179,7,182,246,20,99,142,38,204,35,185,219,219,48,77,72,196,221,160,170,70,198,96,
+197,206,17,122,241,145,84,175,65,228,46,35,189,37,40,132,10,128,40,2,151,148,79,38,
+249,181,178,83,12,197,216,66,54,25,4,115,99,246,244,222,182,200,52,221,109,224,112,250,
+176,219,25,229,169,105,247,171,250,18,139,236,136,149,226,156,218,221,161,78,41,198,247,125,
+77,100,26,250,129,37,100,168,3,26,109,187,157,197,205,20,12,58,181,210,248,145,203,109,
+10,142,200,94,162,249,9,57,169,142,38,106,6,198,183,78,83,17,114,33,153,145,169,73,
+149,145,56,52,173,2,40,40,207,99,159,79,177,175,33,180,88,25,74,199,59,79,86,236,
+111,232,167,134,217,191,73,40,64,38,211,88,109,112,109,43,185,20,42,112,122,20,176,44,
+7,76,78,47,41,16,138,205,168,68,139,109,108,215,41,130,177,26,109,177,77,38,173,206,
+120,130,211,188,245,226,64,207,124,9,188,34,44,99,70,53,20,77,164,164,69,170,224,135,
+43,148,232,101,58,115,43,109,25,166,50,16,72,129,62,220,42,53,92,157,143,174,248,112,
+217,189,177,193,51,132,181,29,196,98,16,234,150,157,95,53,247,231,44,56,54,251,161,7,
+225,115,157,223,233,103,74,162,138,173,150,39,63,72,98,97,223,41,99,218,223,41,90,71,
+211,206,202,56,86,77,53,193,14,196,203,145,165,41,72,39,27,150,139,137,19,61,181,133,
+195,45,169,15,181,115,50,248,116,149,197,7,90,177,107,6,81,248,10,154,20,22,253,175,
+49,99,14,154,141,70,245,183,90,249,242,136,57,246,226,221,74,155,146,180,84,52,207,125,
+135,30,27,100,114,236,156,158,215,10,177,220,89,99,181,252,91,180,207,173,50,210,148,88,
+209,16,88,243,66,39,99,179,213,230,99,54,198,15,148,80,75,38,208,80,180,185,88,1,
+34,90,137,69,36,7,125,166,169,192,25,23,95,24,120,58,236,148,67,82,59,63,36,136,
+141,164,124,26,180,44,16,185,235,103,59,211,199,59,220,28,113,8,220,149,16,240,98,89,
+94,27,93,17,171,55,75,218,237,100,95,6,149,149,152,12,48,214,87,113,113,152,150,37,
+144,172,205,171,155,163,234,55,144,64,112,108,12,140,205,167,14,110,178,0,40,0,217,146,
+84,97,206,86,247,41,21,49,20,25,4,71,121,106,124,101,223,169,168,44,242,100,101,44,
+70,172,234,194,247,14,125,70,69,161,139,171,194,226,41,0,197,59,109,29,173,57,219,157,
+220,152,101,44,17,77,91,28,82,149,69,20,82,115,150,123,161,17,200,74,203,32,29,114,
+33,153,51,11,106,214,211,71,210,57,147,235,180,202,86,222,145,162,39,5,32,46,217,76,
+231,114,54,81,178,168,165,111,73,11,28,164,162,222,150,67,22,44,114,246,178,93,154,34,
+174,36,74,0,163,1,105,222,17,243,79,159,164,199,100,128,17,146,5,45,132,157,182,176,
+130,112,98,141,173,230,195,4,231,188,118,210,132,99,125,178,65,241,137,168,208,14,155,64,
+211,206,34,73,29,48,64,133,61,77,146,138,17,76,77,55,220,67,233,183,180,167,99,167,
+191,187,197,117,133,235,30,65,79,132,237,184,184,72,206,190,87,129,114,99,92,146,42,10,
+46,101,171,116,193,20,164,88,178,161,190,208,155,37,213,145,75,150,166,228,154,74,210,16,
+107,22,64,70,178,229,30,77,109,160,130,33,225,38,155,185,64,139,4,98,161,213,178,171,
+24,179,76,170,202,148,25,104,81,43,115,40,152,90,210,217,8,18,238,85,182,162,81,181,
+21,108,173,164,138,73,226,73,89,5,144,52,129,88,168,199,77,69,27,108,172,162,176,0,
+130,32,169,90,91,137,49,173,145,17,101,178,45,2,65,168,219,109,138,42,133,75,123,22,
+64,134,34,128,226,54,66,52,105,74,217,39,53,214,187,217,207,158,39,13,181,66,239,132,
+154,97,10,90,153,72,93,169,113,164,129,101,104,91,81,80,6,146,145,161,130,50,81,56,
+64,136,151,53,122,195,78,173,178,72,0,198,49,157,59,123,94,238,76,99,197,149,138,138,
+240,111,10,93,244,32,252,24,236,155,95,70,251,25,146,78,251,35,64,160,141,90,180,141,
+124,175,119,37,158,182,216,225,191,48,203,11,101,31,2,86,34,46,81,74,43,20,83,170,
+109,198,86,39,59,242,188,77,181,190,215,154,125,19,217,215,219,149,170,65,93,247,151,86,
+240,118,75,92,211,98,54,72,10,15,186,91,94,207,123,172,72,10,246,200,170,34,150,78,
+219,232,227,130,40,136,60,119,178,218,200,68,133,22,84,141,75,211,187,99,74,234,151,45,
+24,140,80,69,69,80,221,19,69,216,228,105,158,126,233,91,69,98,66,70,69,101,6,195,
+217,198,37,169,101,6,59,35,37,49,13,160,89,183,236,108,207,55,4,178,250,56,221,227,
+18,66,34,180,46,129,2,218,240,84,49,172,88,232,120,41,25,59,143,139,80,140,98,14,
+166,34,95,181,215,220,184,98,242,132,69,36,8,68,135,54,10,42,168,47,186,74,90,85,
+211,43,219,156,54,200,39,201,190,253,104,195,210,114,109,29,154,180,184,235,214,97,203,87,
+116,138,137,194,231,208,227,206,65,49,36,73,66,212,145,167,148,133,164,69,17,69,69,105,
+35,4,81,221,136,138,170,220,145,136,72,69,227,42,44,131,2,92,128,220,58,54,160,46,
+140,108,148,172,168,25,18,50,68,208,80,8,10,65,101,119,199,69,14,212,171,193,240,189,
+189,21,30,54,177,221,74,219,95,93,175,43,40,112,125,172,179,102,167,221,187,171,17,81,
+22,169,68,107,77,84,233,147,210,97,98,204,157,153,65,143,133,195,28,143,140,151,34,70,
+103,241,243,21,194,66,152,144,71,220,145,84,184,65,21,146,164,219,51,181,172,212,70,72,
+115,106,8,180,220,34,10,131,179,41,52,251,37,208,141,46,162,136,241,238,187,202,20,141,
+12,117,198,83,225,114,38,38,112,117,200,150,155,160,76,245,70,65,49,8,85,251,76,107,
+179,37,208,162,208,141,10,145,221,62,121,4,81,17,83,18,10,234,21,4,20,236,149,3,
+183,248,215,219,157,108,34,42,34,42,218,68,224,209,4,147,27,161,4,20,94,13,103,8,
+112,209,3,46,72,80,155,80,98,40,160,160,238,31,55,129,76,58,147,176,130,182,147,64,
+229,66,114,149,13,164,84,190,178,182,107,50,17,35,83,198,110,219,238,109,45,17,94,100,
+185,101,166,236,48,114,210,168,197,170,162,44,89,86,72,145,136,18,132,82,49,7,164,61,
+108,227,161,194,22,95,57,130,141,115,212,56,56,55,35,66,193,34,155,66,52,92,8,10,
+42,138,76,94,173,134,151,86,42,145,67,218,182,35,136,239,166,8,177,112,75,90,186,165,
+21,69,138,68,92,18,202,215,77,65,138,238,72,81,13,29,250,99,50,221,25,113,22,11,
+109,130,140,74,133,91,101,18,40,84,177,24,192,2,29,10,166,175,89,196,69,104,120,106,
+22,36,157,137,238,179,194,205,33,104,165,1,26,170,61,187,253,184,123,123,141,196,145,102,
+50,21,144,222,48,77,201,207,138,81,47,173,113,196,237,165,198,222,251,142,21,189,126,87,
+39,133,133,138,196,118,165,156,146,184,133,75,108,21,68,74,50,210,150,227,69,194,217,109,
+162,238,102,99,66,44,33,252,70,173,178,36,131,89,237,2,243,165,218,169,169,143,79,135,
+211,102,202,170,250,247,114,100,50,208,92,182,43,75,90,188,174,90,87,6,84,85,68,88,
+212,85,84,140,19,190,19,193,38,16,141,44,18,49,17,36,145,16,233,37,194,68,233,32,
+173,178,17,35,94,178,41,172,237,188,75,125,44,139,74,40,88,132,102,242,35,114,70,68,
+146,169,70,170,219,21,74,139,21,103,149,149,85,89,22,44,152,149,182,149,40,157,122,80,
+196,45,180,101,96,219,27,74,144,82,23,171,74,172,246,181,172,232,205,178,74,53,89,5,
+45,178,20,245,169,113,104,54,129,82,163,82,172,41,106,145,175,131,39,62,89,23,74,144,
+172,80,172,82,176,80,82,115,230,101,180,82,16,34,40,119,109,94,181,204,245,156,78,87,
+73,137,109,137,148,185,98,209,26,202,40,140,109,190,189,196,147,161,55,161,178,77,33,88,
+28,204,149,82,11,32,40,42,152,42,21,85,22,40,140,87,86,21,20,162,130,142,34,67,
+164,224,216,138,73,40,95,4,34,106,27,165,218,109,150,57,101,45,133,74,195,153,152,139,
+2,65,17,19,131,10,169,171,81,22,218,177,67,115,42,64,130,204,45,32,169,227,181,150,
+209,85,20,227,115,166,65,190,112,180,241,64,33,137,25,36,145,17,171,105,88,82,187,219,
+115,49,156,50,84,34,192,20,144,196,168,166,120,76,104,49,121,33,14,50,7,199,87,117,
+84,68,2,43,141,4,120,101,156,117,43,136,5,6,182,110,240,92,82,40,233,177,109,44,
+77,233,69,18,46,247,152,74,69,107,116,139,37,15,50,94,77,49,178,49,81,173,70,8,
+139,108,146,0,110,203,59,86,236,202,109,153,138,130,130,195,4,55,100,177,20,96,204,178,
+87,26,172,92,26,62,221,40,208,234,118,92,245,101,59,34,202,143,179,104,45,40,244,98,
+52,42,43,164,178,178,145,130,198,44,173,65,213,170,169,43,85,20,141,139,18,77,78,113,
+219,167,188,104,35,96,83,4,82,98,220,49,1,141,81,47,175,151,10,164,109,167,42,21,
+49,44,217,37,22,42,101,230,202,8,176,88,177,81,6,68,203,41,212,178,136,229,81,106,
+32,170,68,138,233,237,184,137,178,17,243,218,22,148,168,210,168,180,44,132,81,86,164,148,
+71,190,247,151,186,105,52,209,194,74,188,150,42,97,106,53,148,86,90,87,46,114,179,81,
+56,140,162,198,58,55,194,219,66,49,149,76,98,8,162,40,130,131,221,202,204,218,26,16,
+222,74,181,149,15,54,63,25,17,68,85,201,19,105,41,172,178,5,242,187,182,145,20,69,
+69,39,148,171,171,249,216,88,134,237,65,58,106,173,75,90,84,85,164,80,85,35,35,4,
+69,201,29,152,162,46,101,220,145,11,98,50,69,124,88,170,33,242,72,170,135,222,72,168,
+200,168,49,68,103,73,172,30,132,181,13,101,130,139,189,170,171,146,5,12,252,81,77,110,
+37,27,16,128,32,196,70,205,165,154,22,35,238,53,136,155,157,216,92,104,141,220,153,133,
+187,217,89,28,178,218,168,64,128,237,60,115,82,36,8,52,26,157,185,203,161,191,68,117,
+185,166,20,115,101,84,78,229,187,132,40,49,131,108,55,185,48,121,240,162,11,20,22,99,
+40,214,168,163,22,34,219,142,157,69,84,49,149,103,69,148,85,81,122,77,140,69,17,78,
+181,151,46,252,177,80,182,173,182,220,65,218,5,217,8,177,234,151,77,42,91,193,44,65,
+68,105,165,105,164,83,174,215,172,8,42,56,151,100,69,71,164,134,152,32,169,105,20,21,
+114,69,21,94,76,70,169,84,23,177,145,23,86,91,25,81,206,93,254,27,2,236,34,162,
+32,197,130,140,21,34,138,35,4,65,96,205,205,27,72,60,46,67,185,75,164,43,105,89,
+207,203,12,224,211,154,146,172,120,179,139,14,109,28,28,140,87,102,138,140,98,47,22,93,
+37,152,150,210,242,166,97,68,82,173,162,40,130,169,202,16,105,17,162,227,8,92,8,42,
+45,239,37,193,144,136,170,27,181,20,69,69,166,249,234,239,8,8,211,32,217,98,162,181,
+173,163,107,194,148,28,165,4,198,238,178,138,201,8,171,67,169,90,21,82,198,36,69,22,
+163,49,169,209,136,173,34,167,185,231,182,5,211,54,150,136,168,35,105,16,225,32,173,51,
+18,138,177,4,69,130,174,101,197,30,149,166,51,161,51,117,246,89,138,155,91,225,78,27,
+181,142,25,134,14,206,147,35,28,168,133,45,41,144,101,165,198,9,236,146,155,72,8,164,
+86,35,36,211,13,53,135,27,78,142,203,196,174,56,184,211,41,48,10,108,224,229,77,56,
+75,109,148,34,217,23,166,204,28,213,197,202,222,9,136,142,90,53,179,102,193,84,82,216,
+43,21,8,56,218,2,220,96,200,119,229,225,130,135,9,80,199,18,197,106,148,69,144,82,
+219,156,238,196,71,62,139,177,222,16,54,145,215,14,251,51,234,149,21,53,32,136,200,69,
+84,83,178,18,155,133,140,181,178,171,22,40,239,181,198,21,88,160,177,223,104,134,61,116,
+49,86,42,162,185,69,71,78,101,141,41,21,24,162,138,168,215,166,51,226,116,49,86,69,
+142,90,174,219,92,98,130,49,75,106,48,172,177,69,1,138,69,98,49,210,107,11,239,91,
+20,17,21,120,53,17,174,238,86,105,5,56,178,160,177,85,104,51,111,131,87,24,133,171,
+75,187,189,165,80,86,6,162,247,56,167,123,82,86,54,94,69,85,169,204,227,21,97,225,
+119,56,48,85,21,221,106,40,92,161,137,21,17,182,169,69,105,85,23,177,115,17,138,149,
+175,153,8,210,138,95,75,44,184,66,73,71,22,221,220,91,132,250,229,189,142,42,155,93,
+101,156,108,164,80,122,118,137,60,45,69,1,118,165,104,216,54,202,136,157,148,196,195,182,
+213,38,238,165,193,144,168,181,22,40,178,176,233,185,207,153,130,162,197,138,172,84,139,13,
+246,212,43,179,195,3,150,81,84,98,197,93,145,186,200,6,38,36,71,125,148,88,160,138,
+109,74,172,5,135,138,209,85,98,51,114,87,214,181,240,72,40,159,75,85,203,156,231,165,
+139,85,33,227,46,212,105,211,17,44,184,55,49,27,74,35,109,89,65,165,164,172,194,209,
+203,85,133,18,219,22,88,132,87,179,123,207,62,168,172,109,40,196,96,174,205,69,170,80,
+21,16,141,74,89,13,144,231,153,172,141,44,122,53,218,214,132,22,2,36,81,93,182,178,
+189,91,169,140,91,103,59,136,169,17,138,163,49,11,32,4,20,211,190,34,169,220,180,22,
+116,146,160,80,86,136,238,137,171,121,71,65,85,243,189,23,96,174,131,105,87,84,0,124,
+187,36,168,6,201,9,125,246,172,70,42,116,181,114,73,5,9,206,152,137,24,170,35,74,
+13,34,210,42,119,53,225,158,151,21,209,8,48,146,70,90,20,109,189,134,198,44,20,196,
+148,87,172,201,88,136,98,35,42,138,171,109,21,34,170,189,59,153,96,160,162,220,180,69,
+146,116,146,233,181,40,194,246,41,83,17,165,234,51,28,136,219,43,30,54,99,49,1,166,
+235,46,20,98,214,41,80,172,227,150,47,38,174,149,177,173,21,124,108,170,136,168,177,88,
+34,49,113,146,12,146,84,167,231,119,77,193,90,66,13,84,124,88,218,105,55,204,150,117,
+200,138,130,32,180,45,80,162,170,100,141,17,143,38,55,76,141,150,22,42,20,65,85,99,
+106,133,122,77,25,140,196,185,97,105,69,114,202,169,136,85,70,34,141,167,12,185,172,48,
+71,76,111,37,201,6,148,20,100,33,32,42,49,34,29,158,119,121,162,22,42,151,217,42,
+13,196,148,42,170,164,140,32,197,69,5,145,169,65,123,9,51,42,128,177,84,236,180,198,
+139,43,98,69,70,69,34,169,21,17,122,140,43,1,69,28,108,222,194,197,67,16,89,80,
+241,92,83,42,21,86,70,178,167,99,11,13,185,106,237,131,95,22,13,82,157,210,34,32,
+228,168,42,59,12,21,182,157,54,117,93,51,86,200,173,176,11,105,88,137,222,76,113,22,
+86,171,80,238,184,227,81,86,11,88,40,141,17,88,146,177,181,69,133,219,50,42,177,152,
+197,5,40,130,162,162,146,136,10,5,69,27,101,165,11,82,163,33,2,34,157,170,21,20,
+83,215,79,109,3,16,68,197,96,179,150,74,29,43,84,84,107,186,77,33,209,171,200,77,
+161,41,1,87,131,83,104,21,18,52,69,116,201,81,100,88,10,57,64,90,128,115,50,21,
+88,27,181,76,69,107,102,234,89,5,145,100,17,88,240,75,22,66,16,58,73,1,97,68,
+138,166,212,187,144,196,200,197,168,87,73,95,18,83,40,84,208,134,14,74,213,11,74,2,
+193,65,222,230,54,144,101,165,99,109,138,200,72,86,168,172,88,91,68,69,2,160,94,245,
+2,166,205,154,108,88,4,20,228,226,27,181,71,50,224,229,144,217,196,211,166,101,45,45,
+144,14,56,81,28,67,100,193,19,41,142,36,157,196,234,167,105,134,145,96,160,197,73,185,
+163,34,145,74,219,74,86,219,69,146,34,140,1,88,194,8,170,42,45,182,12,69,32,140,
+109,133,65,150,202,219,84,89,32,176,10,200,87,131,173,82,58,90,176,222,212,3,120,144,
+162,17,116,172,43,215,181,100,222,146,136,174,170,213,17,81,175,89,198,44,155,236,188,27,
+181,63,35,140,88,10,251,151,109,212,52,145,78,210,31,145,56,48,234,191,51,141,87,115,
+140,194,10,99,9,242,126,215,213,144,15,214,132,63,6,31,130,4,56,33,9,233,161,8,
+29,198,16,232,125,207,13,52,246,95,153,234,156,79,232,251,182,126,116,159,165,147,172,245,
+146,125,165,176,33,196,146,7,178,144,247,19,218,78,179,231,124,110,255,213,202,135,38,28,
+204,135,218,147,189,36,135,107,135,211,232,186,127,106,217,251,223,7,236,205,63,141,171,170,
+123,188,53,56,176,214,17,209,235,59,84,133,30,202,103,40,64,104,127,191,239,111,217,84,
+127,97,164,193,166,146,193,92,133,199,241,51,114,21,163,122,139,82,74,185,82,252,149,97,
+12,211,53,80,90,136,169,196,39,63,147,179,73,254,45,37,236,68,137,52,26,78,37,139,
+157,48,170,65,123,120,31,195,253,147,183,21,20,252,238,88,255,55,195,47,180,188,53,107,
+44,55,21,202,145,61,237,137,201,119,39,28,92,61,39,134,87,50,202,127,162,215,238,94,
+184,254,178,35,129,65,109,42,235,211,136,255,74,163,124,185,206,253,83,70,50,72,35,251,
+240,190,141,137,183,208,236,6,140,209,189,82,84,48,14,111,4,30,91,222,193,194,134,53,
+120,231,46,192,143,225,11,154,168,82,72,18,105,185,186,108,241,242,255,194,98,6,172,186,
+214,244,192,206,162,177,156,113,150,45,116,181,233,39,216,94,87,207,49,8,104,61,125,151,
+197,30,197,94,66,169,80,130,24,236,76,113,50,130,96,68,222,168,220,8,98,122,243,86,
+29,59,157,168,236,108,202,19,252,10,152,66,146,5,228,34,199,106,179,184,177,31,197,154,
+239,228,201,171,113,84,18,156,154,132,232,223,39,248,51,83,242,239,6,150,165,235,250,167,
+207,147,72,142,186,170,85,38,171,81,1,240,27,165,237,228,89,107,66,178,134,26,217,177,
+55,54,181,173,183,104,157,6,14,131,56,67,94,235,20,152,185,188,210,8,115,190,31,146,
+177,74,117,57,20,29,199,110,43,148,226,121,14,98,98,173,130,150,212,86,252,114,243,223,
+139,23,248,71,197,242,54,26,0,177,4,228,214,127,173,60,60,229,27,38,233,159,40,90,
+125,60,101,205,165,210,77,187,240,207,124,168,210,233,33,2,51,164,95,98,182,239,60,145,
+131,192,34,211,192,22,193,245,9,130,135,207,52,134,92,41,92,206,232,57,8,145,229,198,
+123,210,109,62,207,15,126,176,212,207,44,61,95,169,211,164,94,131,47,69,157,81,106,174,
+21,52,178,187,111,79,84,70,71,173,87,24,98,20,227,87,54,34,196,11,26,235,43,34,
+77,50,52,69,40,221,48,204,127,179,177,214,222,247,48,208,45,199,68,175,78,29,210,52,
+189,55,99,28,147,92,182,19,177,59,30,95,232,133,116,241,157,255,41,211,235,149,15,119,
+75,183,253,201,18,148,232,191,62,206,90,52,142,170,197,34,165,54,37,57,12,116,157,211,
+45,105,90,200,115,160,129,5,161,14,82,5,206,192,240,152,219,120,16,166,215,2,30,83,
+61,112,167,67,227,155,237,195,160,94,11,106,115,118,172,48,25,219,83,234,172,134,169,247,
+75,30,186,89,33,118,21,96,19,179,8,235,22,133,176,136,172,51,126,201,76,125,136,78,
+54,103,76,235,29,114,38,31,117,252,115,77,85,150,200,162,7,69,92,217,234,84,151,68,
+239,22,66,76,107,78,49,65,117,206,168,172,200,208,204,238,142,183,153,76,226,121,122,227,
+53,4,145,37,152,27,162,175,12,97,130,191,67,117,186,91,90,250,238,228,118,160,39,3,
+156,231,138,122,101,90,78,196,131,193,61,91,71,191,109,179,5,107,105,61,218,37,163,183,
+11,180,221,146,30,47,198,75,226,251,54,220,90,104,233,144,173,77,145,209,115,191,150,252,
+101,148,147,86,155,183,215,197,250,175,67,152,143,233,170,25,238,189,142,20,216,116,189,230,
+82,196,129,107,10,220,108,219,26,120,210,4,210,229,28,15,200,119,244,80,153,171,49,162,
+35,194,153,175,73,178,201,220,27,148,158,45,29,230,3,51,174,229,75,133,188,75,93,219,
+166,68,43,35,241,143,54,30,41,143,14,254,171,241,103,166,110,192,162,61,145,61,177,219,
+56,64,52,179,6,133,69,211,179,73,147,188,210,49,191,158,107,117,88,131,156,166,192,128,
+142,156,21,67,59,118,54,161,167,100,182,53,102,158,119,98,70,59,235,139,142,73,66,135,
+53,134,106,169,83,111,37,97,193,251,8,111,108,160,79,57,80,6,52,251,229,50,178,189,
+162,133,183,111,102,57,52,26,152,53,34,198,211,237,195,141,252,23,179,217,182,99,118,127,
+215,86,22,27,13,2,52,204,140,203,18,46,161,76,154,215,27,179,184,199,64,241,251,215,
+117,158,77,68,65,83,210,220,90,26,22,159,146,126,240,150,91,27,239,105,248,221,89,11,
+22,193,46,161,95,1,228,211,71,160,82,86,83,19,110,174,204,154,97,86,27,154,187,198,
+77,94,14,4,19,206,102,75,243,30,139,185,252,243,55,236,52,130,5,163,139,141,234,8,
+166,10,88,114,145,153,136,102,1,141,41,6,220,114,25,201,57,26,116,141,40,228,11,16,
+77,220,235,251,98,251,158,227,78,43,33,50,169,36,98,145,63,182,253,149,152,211,205,115,
+46,236,167,35,45,185,197,227,251,156,53,48,84,111,120,172,92,118,92,95,164,204,207,241,
+30,210,88,100,134,153,76,89,248,73,131,4,90,191,172,74,97,53,137,213,31,242,47,75,
+177,86,143,156,224,54,35,197,102,146,33,36,5,244,18,39,4,93,109,159,44,175,158,161,
+238,73,208,156,211,180,92,139,204,96,169,121,165,77,9,33,227,151,24,29,50,41,197,91,
+172,224,155,170,160,0,159,11,118,91,22,8,138,249,176,224,151,15,131,245,233,151,246,46,
+106,218,23,153,190,129,108,143,49,48,8,233,128,163,112,165,4,178,110,225,205,146,46,231,
+143,91,176,67,101,181,159,82,130,78,178,24,210,235,208,195,37,80,78,92,247,204,112,144,
+199,23,88,126,168,106,98,104,140,243,159,70,65,231,42,7,70,61,19,146,91,163,135,211,
+182,219,27,46,237,246,193,74,37,206,215,130,118,234,108,215,111,116,221,137,174,16,206,49,
+29,164,146,6,134,166,165,17,72,33,153,160,171,167,94,116,196,180,42,145,83,98,72,186,
+112,96,45,43,196,130,26,15,37,103,245,167,23,23,36,208,241,36,113,182,12,63,60,144,
+147,8,90,228,238,238,192,7,211,110,7,3,55,29,9,92,27,119,67,16,156,37,243,134,
+255,133,49,54,107,202,95,164,194,212,234,195,245,167,243,67,104,51,141,204,51,128,172,109,
+146,3,43,43,188,142,238,46,6,228,228,187,129,38,132,13,87,115,204,172,246,152,139,65,
+102,4,37,11,198,39,143,150,65,86,56,53,153,176,244,247,44,181,244,236,227,108,92,196,
+26,44,19,83,46,102,244,187,198,182,169,66,88,166,92,201,19,153,210,102,208,173,92,35,
+209,32,223,158,113,202,173,8,181,221,198,119,175,66,104,104,230,199,56,75,228,147,76,121,
+237,45,21,84,155,223,147,142,236,222,115,108,71,224,199,116,51,162,131,155,236,156,143,7,
+65,4,119,85,12,138,58,150,76,40,142,38,139,131,79,157,242,6,60,8,105,123,35,228,
+211,62,145,98,122,102,66,236,182,9,108,233,240,232,235,199,71,47,36,214,241,206,234,43,
+77,54,177,9,152,8,106,178,116,86,12,143,186,64,126,46,57,122,10,145,158,56,112,235,
+150,154,94,113,118,12,237,248,176,71,140,232,32,73,226,186,101,245,242,90,182,49,76,29,
+91,220,93,120,93,83,153,21,124,143,150,33,64,241,125,17,111,207,19,45,237,247,124,152,
+171,56,182,32,208,93,147,209,41,133,143,183,140,191,12,54,192,140,182,192,114,28,26,169,
+32,180,165,135,10,99,3,138,204,202,86,244,131,135,33,54,153,87,108,228,251,163,218,154,
+77,7,47,123,173,52,107,134,247,225,201,192,40,47,155,231,155,85,47,108,123,152,46,140,
+158,40,251,137,26,92,207,233,244,235,3,35,34,133,212,250,133,80,177,62,17,222,110,164,
+2,70,237,24,53,236,130,222,186,246,67,2,62,14,142,173,5,240,53,36,58,67,75,48,
+54,93,29,38,58,184,248,184,150,41,235,215,107,211,162,225,61,242,28,103,27,135,135,72,
+104,105,109,232,106,163,117,146,250,11,156,231,203,57,71,65,230,122,217,158,41,113,116,206,
+50,47,205,155,242,52,68,235,212,246,136,208,157,138,32,18,47,44,111,46,206,210,98,101,
+180,249,208,164,58,37,17,110,146,227,226,126,23,2,172,81,25,38,52,207,1,12,61,132,
+169,161,33,141,205,230,126,123,34,68,26,230,233,5,230,207,6,189,37,139,28,247,231,107,
+207,29,78,175,123,204,189,178,41,144,219,245,57,1,230,84,217,216,78,105,28,232,89,243,
+110,147,56,201,60,60,51,157,59,58,13,174,228,36,129,98,142,211,68,192,73,189,211,121,
+8,159,195,59,153,188,201,235,19,15,223,199,41,170,51,22,70,255,107,139,36,17,26,186,
+141,115,179,100,125,205,87,206,6,6,93,150,69,141,29,33,156,182,33,231,26,140,25,222,
+247,157,182,181,113,204,91,238,120,52,22,79,221,150,12,42,212,98,75,177,248,21,232,180,
+156,53,231,67,132,197,198,8,23,17,211,211,242,245,30,195,114,162,211,41,168,46,242,224,
+192,65,15,8,18,64,15,18,105,51,0,74,144,201,31,91,16,180,54,212,104,50,137,161,
+12,131,120,85,8,89,4,207,141,168,247,24,180,31,210,23,105,210,254,234,22,75,207,2,
+86,170,24,66,75,232,135,181,17,152,142,201,102,82,237,188,245,10,147,205,231,204,118,222,
+219,112,162,117,119,221,244,241,9,161,96,221,101,59,118,90,212,211,181,239,189,202,246,17,
+108,206,149,36,47,62,144,71,54,90,91,142,189,110,39,105,101,193,112,21,85,112,216,170,
+133,138,34,18,30,207,182,133,27,131,162,213,44,73,31,5,157,249,170,243,25,252,87,52,
+229,33,33,212,119,228,178,12,189,217,112,30,240,163,74,216,115,35,150,182,44,49,59,13,
+238,141,234,101,91,145,73,131,213,53,46,73,28,102,166,213,84,150,83,58,151,45,96,6,
+57,217,81,136,171,170,62,40,71,18,17,85,199,85,158,229,75,1,122,200,143,62,146,177,
+134,152,147,19,18,193,4,16,71,22,197,196,179,35,6,95,87,115,80,198,81,146,54,60,
+229,221,104,120,29,248,236,230,157,163,33,215,65,178,126,120,254,69,66,65,58,26,10,245,
+31,94,85,161,19,70,144,99,124,248,82,66,98,173,123,172,114,204,84,3,131,148,227,185,
+118,173,95,136,184,119,46,108,0,158,99,109,95,105,224,142,129,145,105,5,0,218,1,20,
+37,105,222,10,128,134,184,42,128,145,210,184,34,69,72,199,100,225,17,39,125,234,156,89,
+71,238,47,188,141,82,131,177,88,94,156,232,52,28,196,73,132,55,176,89,160,77,57,173,
+147,251,234,41,202,110,225,233,101,142,51,238,20,234,183,113,193,112,85,169,136,247,231,156,
+160,75,6,242,237,91,217,119,247,15,54,250,187,154,153,143,65,49,100,245,95,158,241,250,
+30,102,72,21,249,100,44,109,173,20,227,60,215,136,189,37,62,135,172,123,181,74,4,92,
+136,104,45,8,1,153,178,40,37,194,230,150,182,201,40,182,155,26,216,86,163,110,174,212,
+113,32,174,34,104,236,21,119,193,240,201,189,124,142,238,150,84,103,163,226,108,48,65,81,
+149,207,200,37,179,33,111,138,27,223,1,205,53,214,84,48,142,25,39,153,126,9,103,236,
+218,92,154,179,49,18,164,190,165,150,158,38,29,29,34,204,47,55,28,136,198,248,97,38,
+247,80,240,206,149,54,40,119,100,168,139,99,145,249,186,209,78,234,168,29,87,204,227,108,
+48,210,105,1,202,148,5,140,237,118,208,67,62,144,209,93,54,113,73,212,168,229,251,87,
+38,39,89,252,136,12,123,101,137,6,194,182,100,246,158,195,199,155,47,63,93,175,76,118,
+33,120,222,92,118,109,45,191,73,48,133,167,74,36,51,214,206,32,210,243,39,184,166,168,
+223,51,76,9,130,80,135,109,238,243,223,141,48,172,217,83,204,242,189,110,222,87,22,5,
+38,227,22,197,101,117,137,138,30,166,253,63,176,225,229,106,151,16,141,82,4,155,244,224,
+226,254,12,235,104,2,122,76,181,71,122,67,154,53,242,195,7,110,110,172,80,54,184,96,
+100,184,224,79,116,170,115,95,198,193,62,76,41,82,55,32,187,36,46,181,103,131,116,177,
+209,152,248,139,51,2,179,25,188,177,113,16,117,66,201,176,236,182,190,22,187,74,128,36,
+20,185,97,159,142,229,109,43,103,77,204,144,189,229,88,166,79,202,38,179,205,77,226,121,
+58,92,50,184,34,128,44,201,5,190,220,99,229,186,83,39,65,244,137,157,60,118,239,198,
+186,241,211,61,140,59,6,128,153,62,34,171,43,179,183,111,142,235,28,244,120,186,103,4,
+43,57,150,46,99,44,21,4,123,71,121,236,74,181,197,1,100,169,160,180,5,213,35,174,
+225,216,110,85,208,235,67,176,224,226,182,235,192,179,41,63,43,238,231,106,33,249,101,43,
+90,63,49,184,189,86,154,75,251,116,202,45,161,190,77,10,2,153,164,253,248,191,133,198,
+214,73,181,225,217,150,241,23,168,148,55,49,109,144,215,155,222,3,116,205,97,3,66,9,
+84,67,151,122,36,57,21,91,90,78,220,97,178,191,56,93,72,155,42,96,41,85,84,141,
+10,134,255,123,215,60,229,45,198,226,10,192,109,173,36,140,173,227,224,192,64,189,161,180,
+226,169,231,170,167,9,181,157,48,183,50,71,97,128,118,25,44,247,110,230,124,164,156,56,
+28,48,3,50,72,201,184,177,86,38,117,84,19,189,148,144,118,44,10,183,29,94,8,122,
+109,64,236,234,48,208,98,201,124,138,155,52,102,200,29,50,175,117,31,226,250,117,19,90,
+227,201,119,36,43,208,174,213,220,124,118,22,100,49,119,11,117,238,149,88,44,76,206,121,
+238,242,23,213,197,222,141,53,215,181,236,184,83,39,193,128,169,211,212,65,221,20,17,60,
+243,229,206,33,205,6,7,34,9,96,240,218,112,66,0,150,5,247,144,246,25,152,55,9,
+99,222,157,241,118,183,89,178,121,52,202,20,54,140,228,161,252,6,120,167,238,241,206,78,
+43,71,23,209,44,234,119,239,121,6,136,130,61,88,245,76,75,116,150,135,23,247,110,92,
+134,166,239,79,134,190,157,136,119,53,6,132,95,171,225,242,204,6,246,138,51,211,186,236,
+86,110,213,255,186,218,178,219,95,17,59,218,105,166,200,178,230,43,130,68,118,207,102,244,
+54,154,70,123,50,125,87,214,175,241,112,166,211,9,130,223,86,55,127,197,130,148,47,48,
+200,204,196,92,99,16,80,190,97,49,24,124,179,250,226,93,103,121,176,165,183,93,101,155,
+60,29,118,76,181,55,154,178,25,178,25,66,151,66,205,4,183,3,38,226,40,115,158,40,
+68,31,224,122,7,107,160,218,244,42,35,113,229,137,51,232,22,57,54,89,200,221,208,203,
+120,49,220,210,155,176,167,252,123,89,203,131,11,221,205,216,111,58,88,160,143,193,84,89,
+16,180,85,222,245,68,114,183,162,31,195,48,206,201,150,87,187,29,36,117,68,56,106,18,
+185,172,195,8,84,220,144,123,216,124,106,45,48,146,59,79,106,211,177,135,100,17,9,121,
+14,128,170,176,23,111,103,109,10,66,167,128,81,68,36,188,81,44,122,106,93,240,221,16,
+70,182,249,97,250,235,203,212,84,217,167,225,97,182,253,77,23,128,131,132,184,172,208,98,
+6,92,136,64,192,237,78,217,179,143,33,150,196,72,214,134,56,169,166,191,159,183,175,148,
+170,170,54,215,183,21,64,199,147,133,9,231,64,98,113,54,57,30,18,56,140,101,139,0,
+72,177,29,50,50,32,60,174,187,225,4,196,83,79,26,3,164,69,119,149,134,55,181,41,
+168,135,56,17,216,205,73,2,96,33,209,54,38,185,67,189,234,246,246,67,107,139,93,83,
+201,35,109,108,209,143,111,228,67,207,125,239,155,65,192,177,38,155,182,113,215,143,33,141,
+117,205,245,122,73,27,14,130,4,98,135,51,214,189,147,4,129,164,132,0,52,120,23,187,
+193,174,206,141,190,43,66,23,3,184,104,219,155,130,225,185,195,151,71,225,45,21,251,2,
+102,162,24,153,89,191,211,227,198,151,180,81,19,49,255,112,171,41,70,238,3,76,68,175,
+238,184,151,148,191,183,134,182,184,247,53,211,246,110,157,154,110,229,123,144,136,247,237,188,
+165,212,39,165,169,118,198,166,233,228,151,36,48,35,140,189,86,18,129,35,18,5,142,130,
+7,21,234,82,22,44,108,147,28,119,153,137,143,22,210,209,225,39,40,112,106,221,246,134,
+217,40,82,190,164,51,41,48,200,116,46,81,122,24,200,89,46,129,185,235,241,171,157,94,
+149,50,36,138,135,43,52,219,174,187,132,172,222,32,173,190,173,52,180,202,86,120,60,166,
+194,116,140,13,88,204,98,211,224,227,97,238,114,109,97,170,236,112,112,6,120,115,78,140,
+230,137,189,28,143,87,66,53,182,55,195,96,18,32,131,151,247,61,53,106,108,196,80,45,
+217,232,153,201,135,214,154,184,77,152,139,187,136,32,208,247,86,44,189,87,160,196,27,97,
+116,60,6,198,89,193,6,142,177,171,224,92,217,19,48,182,156,8,152,102,27,131,205,92,
+55,102,22,142,5,22,33,19,158,93,110,71,19,45,114,211,11,176,104,209,239,4,190,192,
+98,222,42,235,93,3,133,123,72,250,10,14,182,77,105,41,58,227,228,206,159,140,88,20,
+154,150,26,49,125,151,64,194,69,87,102,179,96,94,73,228,178,147,71,236,207,76,232,138,
+93,36,112,90,97,184,102,94,154,107,205,8,156,220,109,23,70,50,149,90,237,139,158,27,
+119,94,250,55,184,239,37,11,240,19,142,135,190,67,67,33,117,153,94,54,76,140,87,99,
+96,11,33,63,70,110,85,175,134,31,24,183,177,170,41,137,208,117,248,181,228,247,195,22,
+106,17,129,180,33,169,219,23,1,26,3,40,10,247,49,223,89,225,53,223,202,175,34,181,
+201,176,211,34,231,164,58,163,240,123,22,209,3,117,151,114,200,116,97,82,122,184,182,210,
+3,214,252,28,73,136,76,52,170,54,138,176,98,72,205,105,111,12,255,35,112,18,103,212,
+135,1,200,232,228,84,19,185,1,107,208,208,70,169,65,111,231,227,40,109,153,27,136,195,
+232,127,175,249,255,15,219,252,136,1,251,233,3,136,73,60,191,85,15,191,252,155,67,143,
+240,240,195,251,172,159,229,97,192,132,158,199,236,167,171,203,67,251,219,121,126,159,248,124,
+188,252,246,59,147,193,14,223,243,221,150,158,167,90,40,163,241,16,59,188,191,205,177,68,
+104,222,255,185,55,64,3,224,97,62,167,229,100,156,82,109,254,100,15,148,48,254,202,123,
+63,125,159,39,139,242,231,101,215,108,92,172,147,144,196,48,52,111,26,3,221,35,180,68,
+153,212,169,86,29,200,113,221,112,188,168,201,163,172,134,74,103,147,186,123,127,227,130,186,
+183,146,161,24,183,4,43,199,135,40,32,251,115,75,37,223,189,221,1,71,1,31,173,194,
+41,7,252,81,109,247,181,204,91,5,189,25,150,242,83,100,146,174,123,248,249,175,11,151,
+114,184,220,105,134,133,175,28,11,82,181,89,97,116,241,54,185,79,185,169,117,149,63,134,
+50,195,2,17,94,53,65,222,120,166,223,185,100,57,144,156,146,28,24,31,173,58,238,149,
+147,76,55,145,157,215,169,216,112,214,35,81,163,16,61,50,223,187,63,139,247,56,29,14,
+159,32,181,244,93,93,59,220,65,30,162,136,20,18,69,199,135,147,129,211,185,224,228,86,
+61,14,178,177,56,228,165,249,136,12,113,72,115,16,136,250,93,80,14,233,20,242,112,167,
+158,195,47,23,123,219,246,197,47,0,77,189,105,17,77,233,107,40,163,168,130,71,76,236,
+75,169,10,232,91,72,186,228,141,196,88,129,199,51,186,214,255,12,109,65,194,122,164,246,
+208,3,35,113,130,195,161,203,139,13,48,141,9,230,201,106,175,62,78,40,116,172,77,195,
+182,134,222,215,202,218,140,139,32,16,49,248,106,206,45,168,85,140,127,144,163,61,22,214,
+67,210,78,156,82,219,29,189,98,59,239,151,249,242,77,137,196,214,22,87,33,51,106,84,
+7,234,109,78,184,123,178,181,92,42,218,13,238,174,122,155,81,141,206,40,38,186,25,118,
+134,171,213,36,64,70,7,185,123,34,47,122,62,227,125,199,85,225,253,131,162,157,96,244,
+163,224,127,189,181,29,255,98,95,212,119,15,169,199,81,109,21,132,21,226,121,125,39,93,
+14,221,166,121,140,240,54,137,198,104,213,55,65,81,134,244,166,92,59,180,147,50,57,86,
+225,201,216,153,249,141,32,228,103,61,58,59,209,168,210,57,84,58,71,143,135,69,34,32,
+97,220,57,48,196,183,123,169,243,89,224,79,82,218,33,26,69,24,143,67,87,199,194,208,
+136,220,68,105,79,209,78,118,28,172,168,199,22,86,36,134,110,219,81,108,172,112,235,158,
+62,194,22,35,237,170,4,147,254,60,232,114,157,123,245,220,53,120,37,142,147,236,254,244,
+60,85,94,94,210,221,117,196,126,173,60,123,14,172,59,87,136,52,17,60,222,203,138,112,
+155,121,126,122,190,227,153,38,138,168,10,96,183,207,66,48,84,59,120,61,73,226,8,108,
+129,170,176,32,246,9,36,4,148,255,237,240,254,223,142,152,173,82,33,113,164,110,34,136,
+254,164,128,61,141,43,228,60,151,78,238,222,214,38,158,233,229,181,77,225,110,138,102,73,
+22,236,179,110,183,121,154,171,111,187,220,231,186,121,77,73,7,20,48,196,38,105,246,95,
+152,184,170,58,116,215,9,110,111,14,47,112,141,151,48,202,58,111,143,215,44,90,220,82,
+133,97,26,121,185,144,238,194,155,170,200,61,220,107,124,89,150,173,10,226,56,153,64,136,
+109,128,129,198,200,15,107,37,177,255,110,135,9,14,211,46,20,235,77,194,157,131,238,138,
+173,160,56,69,17,245,148,145,128,145,138,229,81,83,129,142,222,195,171,53,144,190,144,110,
+70,243,137,14,235,217,40,193,19,158,215,112,62,67,223,75,175,173,70,99,236,117,119,86,
+64,230,116,8,52,208,138,25,150,247,206,130,26,152,17,202,171,17,2,167,230,40,108,67,
+121,181,187,76,51,52,184,27,100,253,237,232,175,118,247,47,226,46,241,149,53,116,25,139,
+215,31,237,117,107,56,141,30,115,236,60,47,69,58,71,241,97,142,111,46,169,179,14,7,
+31,167,85,238,53,161,32,4,96,177,29,51,196,122,127,10,220,101,26,150,148,133,60,228,
+70,179,199,47,83,209,44,112,58,121,86,0,142,150,206,102,14,47,67,81,167,162,229,159,
+75,39,246,99,3,206,69,53,224,16,228,133,253,7,51,228,150,108,3,12,152,190,134,165,
+228,93,34,90,126,53,202,123,4,27,13,246,31,242,139,16,49,55,198,134,215,237,213,135,
+84,147,213,35,29,42,167,187,196,187,61,93,149,194,210,72,25,25,151,10,159,236,101,202,
+164,87,239,189,8,174,12,17,253,121,52,255,123,55,101,247,209,126,175,17,218,10,108,50,
+47,221,3,96,134,133,238,116,22,185,171,54,212,195,5,236,107,110,236,82,12,254,136,116,
+153,91,122,232,154,7,35,18,110,84,109,235,40,180,184,238,213,204,14,63,206,64,24,152,
+133,200,71,17,246,140,226,169,187,181,169,133,230,229,223,235,235,132,190,34,221,150,237,215,
+95,186,118,149,56,181,145,110,69,188,148,49,250,196,215,44,252,159,155,91,199,35,58,160,
+53,164,54,66,3,68,162,11,20,81,26,8,12,70,233,109,167,14,46,173,207,108,142,130,
+62,115,99,208,173,90,156,117,233,68,8,213,161,152,96,130,139,217,137,61,221,237,105,134,
+96,69,184,144,177,137,219,126,254,156,235,122,224,236,214,35,44,148,96,135,153,53,24,29,
+214,118,114,191,143,10,179,130,109,217,85,194,239,98,208,15,38,245,239,17,88,179,120,26,
+154,143,109,210,52,104,66,125,181,241,119,86,169,208,215,145,196,92,210,243,38,148,228,152,
+100,54,48,76,1,54,39,77,155,165,60,28,110,6,163,71,54,170,177,29,62,134,1,170,
+71,61,156,49,246,16,126,210,1,60,134,10,202,149,224,143,103,127,68,225,238,43,238,168,
+236,94,196,135,33,200,70,152,125,251,110,122,73,74,164,53,203,13,111,125,167,23,169,60,
+213,97,212,34,97,23,182,164,207,75,153,113,154,61,9,45,42,8,114,250,114,139,226,76,
+223,114,103,33,205,141,189,190,72,121,229,66,181,95,78,246,183,219,59,244,245,93,120,117,
+94,71,19,11,129,80,217,109,65,49,47,39,238,231,48,97,25,182,85,155,77,248,180,224,
+80,25,20,52,17,229,235,162,249,93,86,2,210,168,136,30,146,24,16,6,47,221,215,106,
+28,5,176,135,144,89,206,49,96,92,139,222,223,167,148,179,5,125,205,172,133,203,187,91,
+219,28,79,161,222,157,178,7,76,206,238,45,151,141,38,65,36,141,201,104,199,124,191,50,
+82,11,154,70,14,208,167,210,177,25,176,157,13,154,103,186,102,101,165,196,183,78,26,223,
+202,124,252,114,80,43,184,103,79,194,119,187,234,161,198,78,163,81,8,146,92,236,249,247,
+108,24,163,235,244,111,152,41,36,141,49,32,91,132,227,95,206,153,252,142,250,143,182,118,
+121,29,47,148,230,107,187,79,15,141,197,142,152,179,36,192,68,0,97,189,34,129,96,223,
+208,155,109,196,142,135,212,244,53,150,182,171,233,176,47,133,185,122,40,167,194,47,10,71,
+25,185,26,178,239,118,62,123,214,25,237,24,172,9,252,123,151,48,96,204,254,43,58,163,
+252,111,121,23,32,205,13,40,94,1,179,121,225,62,97,104,47,184,200,242,4,68,99,132,
+251,26,150,85,229,46,179,44,135,173,139,5,73,41,33,21,67,117,154,105,119,122,105,182,
+251,170,236,88,114,63,111,41,196,241,33,209,236,94,75,145,75,230,110,123,68,53,16,32,
+131,236,183,226,231,120,25,246,144,173,226,177,105,109,61,205,139,63,19,75,28,221,44,30,
+222,27,162,208,88,0,175,30,137,171,140,25,83,89,169,99,30,203,241,253,80,199,222,72,
+145,91,217,189,228,228,55,14,142,115,182,0,238,213,127,29,43,182,252,56,62,203,149,32,
+212,143,6,228,44,96,216,240,179,235,205,175,145,160,141,198,238,20,61,187,33,198,114,35,
+29,201,136,213,238,95,147,201,164,226,217,224,221,136,154,27,43,19,63,193,198,163,10,202,
+141,122,188,208,94,81,189,45,172,178,229,88,220,170,18,161,75,10,237,96,77,25,245,205,
+127,94,216,232,88,32,83,25,180,65,10,224,188,6,91,95,106,57,12,184,14,221,10,72,
+81,61,66,232,211,176,233,89,162,69,6,0,71,133,34,47,92,182,225,97,153,2,15,20,
+122,236,133,241,184,209,129,3,111,31,218,152,56,193,105,184,46,249,159,0,35,172,102,66,
+163,252,209,92,211,96,60,85,97,191,163,7,180,138,176,124,20,108,60,123,206,245,161,234,
+165,118,47,37,198,81,26,208,232,28,197,36,217,190,113,139,147,54,144,113,30,4,242,161,
+56,55,66,18,19,132,193,18,112,32,140,148,233,89,49,25,202,96,104,113,72,114,29,189,
+78,211,94,100,122,181,42,62,105,185,36,67,225,154,68,63,89,5,206,145,227,186,207,237,
+121,86,202,146,160,228,152,119,18,120,72,134,247,55,51,105,230,124,187,139,157,252,221,171,
+120,39,117,154,255,135,227,63,98,26,129,33,225,100,249,210,125,110,219,66,130,148,7,25,
+64,74,34,3,88,128,85,66,131,41,130,117,111,240,31,179,224,161,57,211,168,221,139,133,
+148,231,13,174,72,161,91,118,121,58,223,7,120,196,31,6,106,249,189,223,18,212,43,241,
+191,95,177,85,51,223,84,127,105,93,134,148,155,97,238,26,53,76,152,134,71,179,134,121,
+224,200,142,213,167,10,166,8,228,200,45,6,153,226,248,177,238,47,159,176,178,15,121,149,
+96,119,79,101,135,16,79,7,65,12,10,200,187,201,7,235,226,178,123,27,226,8,85,217,
+198,237,53,180,173,109,208,98,245,140,179,231,53,136,46,216,142,160,185,43,121,2,179,16,
+44,193,20,46,199,248,24,203,197,77,23,195,50,85,110,156,89,101,173,140,183,208,228,103,
+96,212,9,9,192,138,29,197,64,77,101,19,95,23,112,102,121,69,246,166,114,138,140,26,
+201,58,226,96,165,35,210,240,104,194,69,213,29,91,44,15,183,61,54,131,224,149,206,92,
+221,126,230,27,50,222,221,66,221,110,24,175,14,40,132,56,200,201,220,2,196,34,180,52,
+96,196,44,203,192,9,69,69,120,252,145,108,203,134,14,44,107,234,70,16,250,212,243,235,
+231,202,7,14,43,176,105,205,212,227,96,32,208,126,123,81,100,9,161,185,13,239,169,187,
+179,114,183,124,175,168,88,234,105,234,253,70,193,86,190,39,161,144,183,106,233,126,40,215,
+35,105,90,157,164,215,54,1,141,41,213,35,168,105,4,12,10,54,245,113,62,149,215,154,
+0,30,131,165,150,161,148,63,223,60,248,248,237,157,238,216,97,195,141,254,146,129,160,60,
+22,29,195,217,234,92,210,2,40,210,124,158,107,180,72,83,6,166,245,71,211,134,179,119,
+38,174,8,191,52,166,122,11,49,151,167,215,243,97,121,197,225,217,156,228,45,155,159,38,
+247,186,172,5,212,202,43,156,124,13,161,163,218,79,210,65,26,54,24,53,24,141,61,36,
+52,227,91,253,147,0,144,58,230,136,99,92,220,112,23,204,32,63,81,224,101,75,2,58,
+93,198,219,220,226,174,209,211,95,225,127,136,17,74,0,61,198,19,192,243,251,215,111,225,
+127,50,25,36,1,130,4,15,227,164,176,132,242,165,154,33,236,82,128,222,130,183,111,71,
+171,223,196,140,153,35,52,215,46,171,239,212,40,38,30,152,169,49,105,193,26,214,156,137,
+238,163,234,159,36,211,128,248,238,69,20,154,125,118,20,33,112,86,54,16,146,49,186,30,
+111,113,32,136,13,115,88,197,167,118,107,69,74,201,221,183,159,219,162,19,63,235,75,144,
+151,221,165,145,149,244,186,1,91,125,150,157,37,168,11,48,61,162,198,25,9,103,74,245,
+53,222,107,137,182,199,101,168,47,145,203,33,121,253,203,164,93,28,209,221,55,12,117,58,
+107,55,254,102,146,157,231,159,105,28,97,169,152,28,241,31,225,41,139,55,61,95,50,146,
+66,80,36,36,97,169,167,249,49,101,8,205,205,111,226,104,82,103,235,178,105,244,55,40,
+210,46,4,230,108,44,238,54,178,237,123,195,123,75,247,157,33,125,209,221,76,214,61,140,
+223,139,150,5,108,171,9,29,243,203,38,125,35,49,69,167,68,131,35,217,81,190,30,46,
+107,168,212,122,30,96,201,199,134,37,114,29,33,215,129,71,61,218,46,239,198,84,49,253,
+187,53,43,52,116,53,73,45,35,44,1,240,158,100,166,88,19,10,70,97,117,221,110,158,
+70,233,123,199,119,181,169,90,205,1,101,47,232,87,97,129,183,7,68,169,113,243,2,218,
+231,246,181,127,83,101,103,130,249,211,126,87,120,155,18,224,27,91,180,24,252,3,24,251,
+248,159,157,214,118,159,77,45,191,83,49,147,34,220,193,165,167,145,24,23,62,93,122,245,
+224,82,29,140,78,232,204,151,126,188,150,33,161,6,247,210,109,217,19,114,157,64,162,93,
+149,214,195,102,205,154,45,211,219,227,126,206,22,166,103,111,235,155,11,49,89,27,215,99,
+51,243,181,92,74,59,216,145,213,81,19,29,132,109,100,231,165,187,57,145,198,111,214,179,
+196,79,83,54,172,146,110,139,221,58,227,34,14,173,72,10,14,66,34,105,82,32,55,121,
+186,165,97,46,207,218,209,90,17,189,175,188,139,87,184,209,43,173,162,0,174,143,91,206,
+243,205,198,18,37,152,28,112,254,26,213,153,157,253,89,231,176,69,6,4,192,35,89,37,
+138,37,56,144,23,234,203,179,132,239,206,183,239,67,138,231,19,249,23,102,14,19,131,43,
+231,226,62,138,234,22,23,42,84,134,52,72,32,73,56,187,17,230,216,132,234,60,87,4,
+241,130,32,44,161,236,103,145,39,183,254,146,244,12,237,176,65,107,64,8,140,200,64,240,
+20,255,6,27,75,158,251,85,132,28,137,83,189,220,53,47,35,139,231,219,18,8,51,52,
+87,145,226,97,162,66,251,26,241,47,8,16,8,73,87,78,102,55,141,21,53,161,107,153,
+201,27,200,228,101,79,216,166,212,65,205,228,115,179,250,207,205,140,176,198,115,119,4,193,
+26,33,125,73,222,43,136,142,2,4,24,33,31,215,112,171,113,243,214,28,19,189,18,26,
+244,245,78,203,140,253,58,28,92,164,245,138,127,174,163,72,106,39,39,3,223,141,90,149,
+79,26,120,9,182,222,5,120,65,166,85,35,186,226,13,29,179,98,22,40,224,208,107,94,
+179,36,191,77,251,216,176,152,6,202,223,187,83,5,24,104,123,125,86,226,116,71,69,35,
+61,154,222,158,40,228,36,31,139,91,93,50,122,9,203,228,179,103,148,234,149,72,154,7,
+71,6,71,107,142,38,198,59,88,62,228,226,231,162,83,138,103,186,117,165,139,180,32,73,
+38,83,36,194,15,208,200,215,82,205,212,162,86,251,176,111,156,142,188,219,186,255,203,53,
+45,249,184,68,236,181,204,27,243,248,23,131,249,63,63,234,104,253,10,212,127,235,126,188,
+21,249,119,143,61,218,232,0,154,40,40,182,8,26,148,161,123,74,127,82,10,90,148,2,
+216,130,168,80,120,212,211,253,244,23,123,187,1,224,94,63,12,63,227,141,208,201,133,11,
+95,249,45,148,79,114,70,150,127,187,63,203,229,61,191,28,93,210,208,149,148,37,243,33,
+158,14,142,158,250,58,241,67,48,225,218,98,55,104,180,156,100,129,175,124,33,48,76,116,
+53,251,255,173,176,137,204,62,114,81,38,214,199,112,2,134,254,118,30,197,90,67,227,91,
+254,198,115,156,43,149,99,110,121,177,140,95,13,25,71,70,81,231,142,227,95,122,145,158,
+60,217,195,212,221,99,248,216,217,204,223,77,43,215,145,153,198,227,122,18,210,227,158,115,
+41,217,44,51,158,77,211,121,147,136,69,164,70,86,173,152,217,231,243,193,249,127,107,242,
+97,229,92,153,177,17,8,102,254,151,225,100,126,82,103,233,25,15,251,125,156,23,58,141,
+93,115,209,153,191,91,255,119,77,180,209,175,118,81,216,13,165,251,28,87,6,182,122,139,
+79,31,36,91,23,18,226,144,198,57,161,119,237,150,14,224,186,55,21,116,140,174,145,246,
+105,251,123,57,248,246,206,144,46,224,181,116,165,230,97,73,110,84,44,74,45,50,78,245,
+42,10,198,40,35,60,45,102,53,153,246,230,105,148,252,140,135,6,99,12,211,106,104,253,
+66,86,34,149,17,160,196,218,91,116,180,254,34,191,29,229,12,74,206,227,187,169,66,34,
+11,14,46,171,59,224,103,52,255,47,85,240,128,65,132,27,210,133,29,241,96,194,247,4,
+3,209,137,61,198,35,54,207,184,109,136,96,35,67,35,48,82,114,42,254,25,107,248,122,
+171,190,55,71,225,233,155,87,140,215,56,134,31,95,1,150,9,42,172,13,27,10,177,36,
+100,247,59,208,92,75,209,149,86,201,95,105,109,243,106,88,213,126,31,149,152,253,191,171,
+240,107,204,28,156,222,48,136,96,141,40,158,80,166,159,179,115,83,89,123,110,33,168,77,
+215,221,193,161,156,71,47,150,195,100,18,37,165,168,203,51,140,12,26,36,232,133,99,157,
+94,107,150,77,81,215,184,35,55,64,224,171,128,155,11,158,150,178,88,153,100,130,251,147,
+118,62,152,30,142,45,107,205,193,108,228,248,126,167,14,38,236,247,237,191,102,149,95,183,
+41,82,177,47,202,90,162,169,32,40,16,80,4,1,40,2,34,80,27,42,87,225,150,160,
+226,232,229,167,23,17,75,209,129,237,232,171,5,70,64,199,68,200,48,181,173,134,69,225,
+138,90,20,242,139,151,23,39,30,182,8,241,182,192,197,169,29,25,118,104,61,11,113,201,
+185,189,173,234,159,69,187,225,60,183,121,100,4,23,236,75,176,251,119,235,217,138,5,170,
+211,146,20,52,68,225,72,80,44,135,112,241,138,198,125,114,21,126,216,253,34,107,145,17,
+253,44,177,176,192,112,202,58,181,226,45,220,122,254,48,205,239,52,62,17,76,124,136,73,
+142,241,0,252,27,217,237,183,107,142,56,94,207,212,70,250,43,133,251,154,55,214,33,227,
+187,238,254,144,102,248,31,254,207,44,89,221,41,98,229,153,9,76,227,61,48,190,62,68,
+4,106,61,150,219,254,61,95,46,106,245,62,145,45,184,120,113,66,166,152,196,133,191,127,
+220,109,150,152,87,167,14,229,115,44,204,130,184,227,15,172,153,187,211,102,223,78,122,228,
+207,191,123,51,123,22,222,235,173,107,50,159,22,139,112,121,91,252,233,120,46,196,233,101,
+196,201,243,164,148,243,161,220,103,213,62,243,39,34,106,239,205,225,31,33,232,152,165,1,
+225,148,110,116,105,64,83,46,44,144,8,18,70,243,32,74,33,238,109,2,4,32,83,89,
+156,233,250,246,67,221,246,143,43,227,125,146,197,162,127,143,28,191,189,166,115,240,191,200,
+216,223,95,13,131,49,192,219,4,245,190,175,121,223,90,178,81,6,174,194,28,125,243,59,
+150,175,34,98,167,82,198,24,176,229,224,195,251,175,98,176,202,177,39,34,119,138,124,154,
+141,108,15,227,119,130,134,53,115,239,223,164,222,47,178,157,151,245,114,175,25,40,2,48,
+25,62,201,60,94,94,167,235,243,248,140,249,152,91,204,94,161,62,150,173,66,114,237,115,
+71,102,3,34,18,53,47,116,27,150,216,89,213,27,3,23,210,204,211,102,84,159,35,235,
+156,81,222,208,157,62,20,139,175,75,162,247,200,129,132,238,121,26,183,104,209,227,88,222,
+201,19,198,195,221,177,105,124,111,169,114,250,181,55,70,83,179,100,103,202,118,101,98,119,
+143,234,195,38,111,99,186,123,88,88,37,217,135,134,77,108,175,223,76,123,143,125,213,141,
+231,18,248,55,120,223,13,118,211,51,2,11,239,162,20,166,119,109,130,125,23,242,187,60,
+246,186,165,240,231,6,135,81,24,69,32,43,71,188,164,190,131,24,61,196,148,47,123,246,
+240,180,150,45,85,163,124,250,227,196,145,71,247,113,246,222,98,201,2,55,188,227,170,104,
+127,172,246,120,16,67,253,201,129,96,203,36,60,251,75,108,34,32,221,155,179,169,200,126,
+246,11,23,159,11,182,135,10,135,224,193,3,129,122,121,93,69,68,51,145,178,184,57,6,
+96,202,162,45,164,242,68,239,159,170,69,240,37,226,149,187,196,211,103,72,20,136,83,162,
+243,43,72,54,169,156,185,124,92,185,153,165,242,37,254,166,37,251,91,77,45,207,59,112,
+161,148,187,30,119,174,137,163,77,20,248,203,128,187,126,43,233,147,223,244,156,210,66,54,
+159,48,212,158,50,34,65,85,66,175,172,90,242,245,13,38,179,217,30,186,43,82,156,2,
+149,75,229,255,143,87,79,78,109,110,110,136,251,170,193,111,175,189,35,241,137,139,131,17,
+26,203,202,66,121,144,193,59,248,179,110,119,151,40,44,227,32,71,103,218,249,209,164,92,
+167,91,230,89,195,223,236,186,50,176,239,206,121,238,86,47,69,182,29,146,99,92,119,162,
+221,208,203,71,253,89,206,200,107,198,116,155,227,46,139,51,50,166,155,239,135,152,57,219,
+217,15,63,213,158,16,108,31,70,69,122,113,255,197,184,105,129,127,169,99,105,87,171,14,
+180,33,125,247,220,24,228,210,227,223,207,200,247,30,54,113,182,26,214,189,245,180,162,37,
+107,89,166,159,130,158,216,57,44,188,215,92,186,150,221,57,34,93,108,9,74,196,134,54,
+110,16,95,178,24,1,201,221,105,184,140,50,169,67,30,9,107,90,110,199,31,161,107,199,
+19,226,175,171,147,231,126,232,235,143,22,108,157,59,81,246,246,221,196,243,161,232,206,124,
+9,142,235,220,157,135,113,38,250,123,54,71,143,26,83,127,78,108,154,214,111,217,241,119,
+163,12,81,159,76,96,148,84,80,237,237,47,187,137,177,126,145,118,204,144,234,24,57,194,
+213,208,176,101,173,223,176,240,100,175,107,34,143,1,27,224,241,188,235,244,250,214,157,21,
+172,90,165,49,204,103,104,115,78,171,68,7,109,100,67,188,47,188,234,84,50,4,8,226,
+243,189,178,99,52,75,238,126,239,218,252,50,232,3,176,68,218,111,215,48,113,101,34,113,
+54,176,3,92,124,54,13,248,116,179,166,69,201,169,102,254,18,208,212,49,239,115,43,163,
+73,215,155,163,126,54,229,149,184,225,82,138,214,94,150,138,27,207,238,188,140,208,150,98,
+78,128,141,17,5,33,33,144,34,205,150,91,48,194,208,72,192,210,151,189,203,4,234,54,
+214,194,69,90,131,2,74,67,3,139,144,134,138,143,45,233,190,122,222,240,18,3,74,185,
+177,32,68,198,75,119,195,15,222,181,181,220,167,214,214,113,112,53,13,103,96,233,103,46,
+40,196,12,43,169,222,180,202,239,145,132,26,162,247,86,51,130,64,255,115,30,175,32,77,
+50,232,16,180,67,39,27,154,47,23,4,144,29,70,224,20,239,76,49,249,247,76,91,9,
+122,18,224,132,138,69,4,245,114,240,99,231,132,28,240,75,143,211,102,23,233,182,111,148,
+140,144,197,110,147,26,247,42,57,159,43,17,32,26,17,82,33,236,8,111,5,54,16,17,
+70,184,229,14,168,226,232,56,25,24,4,50,9,199,181,109,88,155,145,61,123,76,165,157,
+170,173,68,68,43,167,8,62,254,255,182,18,148,182,88,71,84,197,128,201,167,103,200,25,
+8,11,15,88,82,225,129,192,105,244,29,211,125,59,12,137,76,121,167,133,142,110,60,28,
+61,61,7,135,102,159,254,91,109,172,130,222,126,190,170,109,109,202,201,95,3,26,46,55,
+84,1,203,179,96,114,173,107,27,170,45,238,254,84,95,179,118,154,199,191,136,190,43,111,
+2,213,9,36,4,165,90,19,245,52,108,109,111,13,157,251,167,199,186,196,137,193,61,76,
+236,239,210,32,168,28,32,127,7,219,243,249,88,118,79,133,216,50,236,208,46,168,242,191,
+235,236,110,94,33,164,22,76,134,188,94,198,30,107,118,248,232,28,21,49,232,178,136,123,
+215,66,144,248,211,72,180,7,160,169,240,239,244,241,118,187,35,173,168,246,50,134,233,251,
+7,178,44,28,84,164,145,146,37,164,23,94,99,90,106,214,64,7,48,224,217,171,192,41,
+141,205,238,90,88,170,189,190,201,2,143,160,228,230,230,226,4,209,185,189,7,42,226,47,
+107,106,158,116,55,49,25,21,136,229,116,123,240,251,249,80,123,246,148,202,166,18,129,24,
+38,20,97,1,13,210,46,107,44,227,113,86,227,231,227,228,162,124,101,24,8,7,17,176,
+44,185,32,107,23,226,115,57,92,146,20,17,3,62,72,64,2,122,149,197,237,225,232,234,
+237,255,78,46,237,237,182,240,167,189,26,92,100,113,200,170,201,165,227,76,166,238,74,125,
+241,71,202,233,207,57,233,54,143,159,197,213,137,112,194,238,239,119,222,187,26,95,118,155,
+177,239,223,145,36,115,58,221,3,239,135,227,11,221,110,159,127,6,18,47,183,61,60,150,
+177,220,29,249,66,120,69,116,192,219,140,188,33,94,29,200,229,141,118,213,6,230,207,166,
+204,219,124,53,247,232,110,243,98,133,197,226,25,223,125,140,68,218,149,211,239,221,122,242,
+240,227,203,88,183,195,228,205,134,62,60,174,203,63,46,21,239,174,132,167,161,50,102,82,
+34,130,231,188,205,28,154,80,96,166,17,64,160,109,197,115,140,86,23,0,224,147,79,61,
+151,137,119,207,130,209,239,11,100,154,218,61,237,53,248,47,80,234,174,188,175,14,112,30,
+41,186,200,89,98,248,212,78,19,122,181,90,149,245,246,60,198,34,89,152,131,230,192,25,
+115,104,144,229,4,41,2,94,78,152,153,162,16,209,18,32,142,68,230,166,77,83,16,36,
+183,147,203,62,179,22,3,150,219,156,8,131,115,5,114,15,154,173,93,91,97,5,212,138,
+19,144,150,76,40,115,252,96,91,228,39,78,37,174,69,16,105,207,94,5,41,91,23,250,
+105,217,232,46,93,229,252,185,31,73,218,34,187,17,114,21,229,220,9,32,232,208,145,136,
+186,10,165,163,8,68,10,105,207,191,77,39,49,210,75,24,107,6,111,6,148,2,198,149,
+21,194,53,81,158,137,237,240,231,155,105,170,196,241,104,239,75,22,231,240,222,200,50,91,
+197,18,149,106,251,32,142,251,94,177,199,191,203,49,226,222,230,165,155,218,206,88,220,102,
+135,155,114,113,165,59,57,36,241,250,127,146,245,108,116,38,100,176,103,62,27,151,137,155,
+83,95,142,226,220,6,47,167,51,237,70,49,201,217,54,210,73,145,253,155,182,92,168,34,
+56,205,60,62,189,83,228,213,11,38,232,53,47,74,156,164,92,44,179,241,59,12,135,67,
+215,143,52,72,36,154,19,36,34,40,23,154,47,130,226,128,18,197,124,85,171,147,65,65,
+18,255,10,28,102,221,53,223,4,97,201,189,159,74,175,137,153,134,71,115,63,54,119,84,
+68,39,238,88,81,137,4,248,124,254,16,238,108,56,218,231,174,117,206,212,97,117,177,225,
+180,158,28,2,178,10,243,226,69,165,132,56,84,37,200,129,121,247,230,97,186,214,46,38,
+4,178,248,161,155,161,52,181,165,124,211,46,245,39,202,163,15,52,75,192,76,82,32,185,
+165,226,9,140,82,182,156,136,39,223,155,198,60,249,195,175,93,151,150,97,177,38,145,172,
+112,15,139,212,152,33,90,192,113,68,193,6,148,133,68,85,138,164,144,106,168,59,210,106,
+121,130,203,178,148,105,27,135,182,252,48,215,24,85,212,30,198,184,221,84,112,133,238,242,
+237,109,152,164,87,100,238,106,94,105,74,127,135,152,119,251,62,67,2,79,121,218,94,237,
+181,129,75,136,109,238,43,131,151,147,26,192,245,238,250,245,113,158,193,32,219,41,142,30,
+5,53,167,237,100,16,110,51,216,192,21,204,165,10,182,236,233,243,73,87,238,255,162,93,
+37,246,6,44,26,33,46,190,244,78,184,231,56,20,31,8,152,218,198,84,135,20,107,147,
+153,115,252,80,17,29,175,39,36,250,171,237,185,123,17,243,79,213,109,159,52,141,240,215,
+152,203,29,38,67,33,130,98,243,43,178,171,249,252,176,211,206,151,155,149,107,243,30,125,
+112,158,41,174,137,207,102,24,53,212,232,182,29,53,125,159,85,151,229,208,206,58,95,134,
+87,186,202,67,54,245,46,243,192,219,163,122,203,181,99,78,125,111,211,224,130,146,247,140,
+254,113,154,6,130,166,249,76,129,153,37,119,39,213,247,238,195,91,169,37,50,43,213,103,
+59,136,189,2,102,198,28,117,145,142,40,143,215,242,237,234,159,54,243,122,11,4,209,75,
+198,151,171,102,126,107,203,54,120,60,120,181,254,235,248,205,156,201,129,91,122,26,160,208,
+248,234,24,99,146,23,214,255,125,61,174,131,251,222,96,249,61,185,26,61,50,239,83,90,
+36,228,121,14,18,141,245,242,113,189,211,157,251,172,226,5,87,210,90,129,173,3,99,139,
+136,100,233,137,4,230,190,106,252,78,123,163,157,221,43,230,46,25,243,79,68,25,103,183,
+16,0,115,225,195,197,215,206,25,110,173,116,229,241,121,127,247,206,29,47,1,190,11,205,
+255,158,121,83,154,129,221,18,239,206,92,203,82,46,46,205,84,155,144,216,70,249,37,61,
+236,242,140,95,109,252,204,231,231,63,31,153,148,250,57,101,228,63,141,148,222,107,191,11,
+152,154,19,135,55,9,150,232,74,129,249,51,198,54,110,232,223,254,1,27,28,180,95,211,
+103,62,249,223,108,253,39,176,44,118,66,103,147,44,222,221,134,169,22,59,249,213,254,44,
+28,15,55,64,234,211,171,3,150,89,112,250,253,204,117,111,97,116,51,210,214,61,171,10,
+186,7,83,193,157,221,38,141,240,159,76,230,119,57,2,17,3,75,138,62,167,246,190,120,
+4,106,8,10,9,190,199,50,246,59,155,75,189,40,3,103,101,74,137,84,40,170,122,153,
+52,205,219,53,169,87,236,179,48,111,15,78,235,173,159,29,187,130,151,164,203,68,84,105,
+17,170,20,83,165,221,95,231,181,23,164,211,219,38,221,119,241,230,1,60,64,2,229,178,
+218,214,57,122,146,21,92,100,218,237,103,59,76,171,242,155,157,232,225,142,120,103,123,138,
+16,66,83,233,142,72,172,251,26,174,8,253,190,94,204,214,45,129,145,235,234,138,51,6,
+204,46,150,25,48,41,18,2,2,21,211,19,18,104,162,183,56,227,172,215,170,160,90,6,
+54,88,225,2,72,119,95,39,221,12,40,76,71,50,182,52,112,34,99,104,63,145,31,142,
+200,213,209,141,195,122,15,173,46,12,219,111,218,214,122,82,154,197,41,236,124,95,95,32,
+142,175,252,58,173,222,81,125,106,222,175,163,231,45,188,218,49,126,234,55,186,13,175,54,
+27,117,36,163,137,140,77,105,141,203,147,87,45,184,24,221,167,44,104,227,234,60,18,196,
+221,139,164,89,176,195,165,166,70,162,35,99,249,90,226,175,126,184,231,255,209,234,27,236,
+144,203,171,83,103,134,24,61,204,55,115,75,203,209,173,118,252,121,127,145,188,247,71,220,
+200,66,71,192,35,49,87,166,126,125,108,165,80,21,59,234,83,57,159,86,26,110,102,93,
+231,183,102,9,242,49,107,32,253,246,27,220,102,229,77,183,90,190,35,163,177,186,170,220,
+217,95,174,38,106,51,245,58,170,225,55,191,132,89,113,214,165,31,152,200,182,194,147,190,
+177,2,8,155,133,91,211,91,253,21,228,105,128,151,136,92,211,167,207,229,26,36,250,89,
+31,45,210,199,245,143,86,192,123,143,199,243,218,116,46,7,227,26,61,134,114,32,77,44,
+64,22,200,141,18,100,204,203,71,53,206,141,88,55,235,245,254,121,60,171,195,20,47,193,
+176,190,181,73,19,78,167,221,248,250,183,97,37,160,69,125,127,182,109,106,14,245,41,84,
+241,127,158,12,150,41,179,163,6,119,92,15,203,231,132,216,235,208,22,39,73,46,72,224,
+198,248,125,24,194,121,226,182,217,186,137,250,57,199,157,18,84,128,115,219,157,44,106,223,
+229,113,100,82,150,48,99,60,94,166,196,175,100,146,191,69,101,62,154,69,249,200,181,124,
+134,15,95,56,135,71,57,163,4,67,253,140,24,27,173,43,124,173,70,109,245,71,44,89,
+89,30,30,119,200,57,247,144,47,57,223,42,245,175,74,122,153,9,148,23,171,94,120,246,
+5,72,10,247,250,177,243,121,211,215,47,179,69,237,47,223,183,62,171,51,209,143,78,194,
+94,227,16,123,180,17,252,10,79,53,181,56,28,189,169,203,98,238,65,242,153,164,58,21,
+21,67,172,64,202,97,41,108,196,187,52,213,147,185,211,232,253,90,232,204,239,189,12,218,
+63,141,8,126,25,203,239,97,164,58,215,69,42,81,168,118,54,162,23,171,205,118,139,66,
+238,143,55,206,10,55,211,38,226,187,227,162,188,33,104,115,37,206,71,60,142,11,207,53,
+41,18,135,206,21,115,176,155,43,66,23,232,42,59,0,62,142,233,217,11,22,134,244,40,
+222,241,100,127,84,191,161,88,55,146,89,190,153,141,54,131,107,115,191,166,106,248,86,135,
+161,134,204,170,172,53,169,8,123,116,88,140,253,239,37,86,37,22,234,211,210,232,202,119,
+153,70,54,65,90,120,24,114,76,54,52,25,252,166,208,163,57,22,233,165,47,201,144,204,
+111,18,74,225,62,143,243,237,167,198,232,225,136,74,91,58,137,47,227,74,198,229,59,118,
+44,192,151,86,219,119,122,125,183,164,177,172,76,169,82,150,202,185,75,197,198,198,11,198,
+180,245,144,231,246,251,226,214,63,111,174,72,96,249,148,93,75,67,126,230,254,255,188,144,
+247,183,209,38,18,205,170,36,62,116,168,173,61,251,251,155,229,188,139,61,30,254,34,30,
+158,69,15,15,23,157,232,95,158,89,156,141,228,138,212,175,116,238,126,24,65,144,135,229,
+39,198,13,18,245,119,73,58,150,193,201,169,218,220,207,218,216,140,82,217,121,179,191,62,
+59,37,5,97,157,246,185,146,212,247,161,106,48,15,238,234,209,234,99,190,116,59,27,238,
+75,71,209,223,55,150,43,232,205,247,178,61,189,162,70,245,55,133,32,155,80,201,85,141,
+157,112,184,196,54,209,136,52,197,175,246,133,28,227,80,50,46,147,64,64,209,172,188,156,
+80,212,217,13,48,169,0,145,227,212,240,224,146,65,120,250,100,168,63,35,252,70,186,171,
+229,71,74,174,246,50,104,4,225,247,192,158,153,224,213,41,62,54,2,128,191,192,104,37,
+235,62,161,226,105,68,24,159,147,227,15,142,231,62,57,208,54,45,109,73,79,103,84,142,
+215,231,217,174,173,62,177,108,50,233,125,113,115,198,220,103,6,186,61,112,189,158,109,142,
+107,92,39,78,54,38,24,247,128,28,211,56,239,172,42,199,87,21,102,149,59,232,150,57,
+169,83,221,178,206,234,147,7,55,81,227,229,63,129,35,141,71,198,97,100,20,166,18,207,
+148,144,153,198,129,74,70,180,185,76,38,67,67,109,149,130,58,80,147,108,139,23,166,89,
+254,207,155,207,231,7,232,245,191,219,195,254,85,251,62,164,144,251,109,141,155,191,149,253,
+175,245,110,31,167,18,152,22,101,239,33,193,14,12,111,142,1,48,165,130,3,90,156,196,
+138,57,90,122,94,146,232,242,230,99,6,244,60,11,62,93,88,99,225,197,75,95,167,45,
+8,95,53,5,28,222,109,233,141,197,234,234,230,214,138,61,101,77,26,12,107,237,31,123,
+4,46,101,116,118,245,239,112,254,164,165,90,199,184,27,212,25,11,237,1,22,115,242,26,
+1,79,103,190,142,196,42,69,5,43,80,71,128,219,218,124,94,136,36,160,172,53,59,122,
+34,153,144,24,228,90,248,34,182,134,162,38,18,136,2,175,45,182,70,193,138,186,242,174,
+38,209,108,31,22,239,50,125,25,239,128,205,98,206,24,146,109,223,45,125,248,79,75,109,
+81,233,134,247,214,166,30,83,148,159,73,28,70,60,134,68,192,120,175,170,175,36,95,54,
+229,130,49,120,173,186,133,23,186,79,58,160,100,214,173,95,136,166,115,42,192,171,207,212,
+149,77,96,70,104,192,39,212,159,77,121,147,40,50,50,214,80,225,228,181,242,235,181,232,
+203,184,190,117,111,63,19,88,225,216,252,28,118,140,167,71,59,88,163,122,226,112,100,39,
+209,205,230,38,167,71,193,243,127,70,121,121,11,154,56,44,250,36,77,120,94,147,231,139,
+73,35,162,227,47,127,146,203,232,10,179,232,240,94,251,58,107,246,241,29,209,189,46,125,
+220,31,163,245,226,237,222,119,239,125,246,78,231,228,246,91,57,230,156,243,211,171,25,86,
+53,156,142,86,30,236,241,98,219,46,239,124,203,207,36,93,168,230,181,252,229,19,119,161,
+116,118,44,134,93,195,95,111,180,185,204,211,41,190,155,146,200,217,241,107,56,99,41,214,
+97,17,1,128,8,131,199,27,203,170,6,250,219,230,12,32,65,190,7,53,77,43,34,142,
+13,227,2,135,118,97,169,79,91,126,30,140,88,101,244,112,155,24,58,175,170,157,181,148,
+164,218,69,70,147,145,26,216,161,206,240,248,227,6,34,209,117,207,70,64,127,153,27,155,
+236,70,198,78,129,185,201,240,124,115,181,108,100,61,249,216,34,237,100,144,47,26,221,14,
+172,144,177,172,76,210,118,162,51,73,198,243,12,224,70,36,210,236,115,144,56,175,66,131,
+41,2,87,88,228,13,193,208,100,125,33,99,3,137,72,148,202,80,30,191,161,63,36,104,
+36,141,111,2,209,87,239,163,126,69,14,68,29,135,64,21,160,139,236,252,28,243,253,216,
+41,102,14,128,252,1,68,168,234,100,80,157,11,230,62,56,175,120,93,203,254,78,213,173,
+164,216,140,187,164,187,143,181,52,150,13,56,7,159,103,196,165,146,90,27,11,212,92,122,
+126,83,161,207,62,174,176,191,156,200,225,173,167,217,109,110,38,92,8,1,117,158,76,198,
+166,45,205,158,192,201,2,238,139,149,5,206,145,206,219,163,165,72,58,47,251,122,87,210,
+53,22,212,116,98,43,141,91,218,119,45,49,42,54,180,231,24,137,166,194,178,49,84,231,
+225,247,172,248,248,42,121,59,253,60,41,183,166,167,47,26,223,12,179,23,102,172,83,29,
+20,215,118,194,81,241,189,59,236,116,51,87,134,145,158,198,218,115,103,48,126,180,65,237,
+233,231,231,204,75,19,97,145,91,210,189,206,222,35,232,95,23,32,99,249,247,88,63,18,
+229,103,43,223,49,99,156,134,173,245,193,204,177,174,78,150,167,143,191,251,56,40,23,171,
+135,223,240,226,251,166,115,244,94,181,26,116,204,226,39,152,247,111,238,47,38,67,26,220,
+118,205,92,61,81,48,116,171,158,207,36,156,61,179,184,151,196,118,143,135,224,32,223,95,
+39,107,90,145,144,167,123,146,49,208,240,186,42,2,199,143,54,225,255,127,249,176,102,93,
+39,59,224,192,144,53,150,250,29,197,147,208,53,129,36,235,254,216,186,27,90,19,40,157,
+12,128,150,234,132,28,130,169,250,161,98,164,101,222,245,77,243,231,175,191,100,233,251,109,
+105,194,25,173,127,174,246,26,73,38,93,63,70,17,150,139,155,28,60,14,151,222,126,190,
+105,227,111,81,195,126,141,90,95,133,229,142,155,110,182,178,95,229,118,143,102,198,212,179,
+107,240,241,218,215,183,78,245,126,150,199,191,40,71,109,122,240,207,189,219,40,194,232,105,
+239,156,15,151,13,43,248,239,226,158,81,100,96,208,190,128,113,3,218,97,15,65,161,187,
+208,212,160,46,10,229,44,64,162,137,181,136,208,67,47,58,250,109,2,231,243,170,199,144,
+52,13,233,25,35,96,124,233,224,242,47,127,153,149,165,30,166,198,59,169,108,64,246,159,
+52,179,65,215,181,239,31,159,146,126,178,99,78,80,159,141,177,14,39,249,32,216,177,128,
+140,71,200,143,147,42,242,175,231,230,57,63,161,93,54,136,205,115,211,61,202,67,242,60,
+93,26,197,111,186,45,21,117,55,28,61,62,247,124,172,40,99,241,139,152,207,223,252,61,
+136,89,65,169,137,208,1,242,163,180,208,191,52,66,218,214,246,181,90,133,172,9,8,80,
+244,53,121,126,31,142,33,219,152,170,30,21,255,176,254,93,217,173,225,118,24,114,95,200,
+183,64,11,1,206,132,244,226,154,142,35,139,34,228,96,204,126,169,166,201,18,8,37,187,
+55,41,65,163,58,207,234,67,18,105,110,204,90,249,178,38,124,208,71,176,183,71,143,116,
+129,17,22,67,136,47,138,163,88,188,237,76,197,83,33,173,107,104,186,196,132,179,28,35,
+174,194,85,98,203,53,103,176,50,37,154,19,193,149,231,50,188,149,122,214,235,101,129,151,
+83,174,12,165,124,196,178,18,225,118,27,146,38,210,144,189,58,209,54,128,181,103,229,221,
+209,199,204,150,197,174,117,249,126,22,17,145,87,171,209,247,50,187,229,197,12,194,175,123,
+99,86,171,237,77,185,57,3,97,176,203,53,250,90,45,86,90,94,100,189,131,98,195,30,
+28,4,242,90,247,208,8,39,0,189,228,61,80,16,47,67,139,118,11,100,66,36,123,103,
+179,229,123,147,155,168,244,32,145,154,127,168,236,156,182,226,71,219,179,79,68,100,251,58,
+157,90,182,109,74,178,178,228,116,203,48,180,50,201,67,41,122,132,9,219,48,203,243,32,
+122,127,82,59,224,19,137,70,243,69,17,8,76,141,48,125,221,20,143,255,171,94,138,122,
+41,149,101,221,165,212,107,59,250,46,37,66,84,81,87,126,135,75,213,231,118,9,196,111,
+187,233,134,171,165,141,239,153,54,245,243,19,226,147,171,98,227,123,47,190,56,228,143,203,
+247,194,47,174,167,76,115,46,223,19,175,153,151,66,212,113,22,11,173,4,140,64,255,105,
+89,67,38,97,77,101,137,207,89,33,220,209,23,90,250,181,252,251,223,12,192,250,184,110,
+117,224,24,100,24,109,246,249,45,28,119,80,138,233,28,7,136,99,140,60,149,212,204,119,
+171,7,153,150,218,118,117,241,164,2,137,102,50,66,103,225,126,246,68,13,141,176,232,190,
+142,191,97,9,254,225,16,159,152,66,137,81,69,186,145,177,240,107,32,50,210,160,6,59,
+31,50,252,115,226,111,221,92,104,25,190,255,242,236,102,44,161,185,62,221,144,59,196,148,
+76,168,52,47,200,145,128,198,114,108,121,104,151,11,31,232,255,187,7,121,224,141,221,176,
+23,135,126,171,60,23,177,222,59,116,191,135,188,102,77,138,30,27,218,73,218,127,21,249,
+66,8,122,244,61,20,9,65,65,230,13,74,0,192,48,132,12,136,84,245,26,200,44,148,
+194,50,6,38,164,72,163,32,178,86,173,243,139,242,78,242,72,115,166,157,229,157,142,214,
+229,196,188,80,73,239,185,159,91,54,98,247,17,144,72,143,229,157,237,57,137,165,228,185,
+38,118,65,130,26,44,237,90,178,230,108,105,57,173,250,106,134,137,223,10,9,46,95,138,
+149,138,222,51,25,238,126,159,210,230,86,224,209,163,246,44,46,64,178,202,183,174,86,125,
+253,153,24,176,99,9,57,125,144,243,254,150,245,70,81,163,24,190,67,28,190,75,85,94,
+11,216,134,0,168,137,65,220,10,255,95,215,95,233,177,245,224,61,105,103,165,237,82,33,
+227,97,146,116,137,121,218,150,99,236,219,234,218,213,196,243,223,66,174,123,156,205,179,99,
+185,29,182,189,83,152,245,89,95,60,227,77,15,206,78,244,79,23,211,217,194,223,227,191,
+195,63,217,131,229,28,173,45,67,6,251,75,241,69,192,247,255,47,226,181,165,114,69,169,
+177,249,206,163,103,78,244,30,168,199,182,68,217,95,225,176,239,177,15,13,214,248,248,107,
+234,105,146,47,145,16,223,33,227,18,209,90,35,245,238,132,69,0,178,134,198,183,192,250,
+32,82,154,113,60,53,105,28,38,153,73,102,21,24,35,86,254,122,216,252,47,118,86,98,
+4,160,97,132,137,113,34,235,239,33,125,25,224,191,116,204,31,98,202,253,150,111,187,135,
+226,239,199,224,112,22,224,191,167,166,136,65,125,31,35,97,3,98,126,38,166,63,91,90,
+137,248,135,167,184,203,242,132,45,69,63,181,208,181,203,239,145,123,167,119,38,206,206,50,
+29,41,139,130,47,230,251,187,247,96,77,107,81,25,253,211,246,150,234,205,173,217,200,51,
+109,49,133,255,118,2,106,43,112,143,229,136,28,19,133,47,248,47,124,15,209,107,181,47,
+244,64,8,64,242,87,18,134,49,254,42,204,105,228,70,50,44,214,121,124,121,46,103,210,
+152,1,124,72,193,2,239,56,63,253,38,77,121,153,241,179,77,223,7,137,179,183,178,235,
+86,194,38,96,91,84,87,76,254,240,67,246,155,150,107,43,61,24,58,137,24,68,165,19,
+218,140,42,21,40,132,80,55,190,135,86,22,210,132,169,100,51,33,139,17,138,237,224,175,
+35,21,162,255,40,72,27,15,5,86,80,43,79,51,12,232,170,58,11,84,142,167,79,67,
+107,148,45,16,37,250,80,46,212,46,168,91,44,178,74,219,128,89,28,117,106,243,175,229,
+73,163,154,176,167,198,218,107,204,57,171,248,120,117,86,124,150,106,59,227,242,155,201,98,
+109,139,29,139,101,163,100,220,131,163,150,126,47,172,127,3,209,41,59,217,41,198,132,221,
+52,210,252,142,123,79,174,98,126,71,39,192,81,104,55,34,136,206,100,72,8,144,17,125,
+172,194,234,85,93,167,94,62,111,180,247,137,228,117,52,197,212,250,39,90,145,149,75,181,
+104,196,32,178,243,174,241,6,192,10,31,167,237,230,31,98,170,67,246,53,70,165,87,32,
+101,76,135,227,113,104,11,158,199,224,121,169,201,84,175,55,141,239,17,221,164,139,132,230,
+34,44,173,206,35,38,213,68,251,175,91,104,123,90,64,255,24,138,72,228,111,195,255,177,
+229,243,230,70,217,122,196,87,51,177,239,84,241,171,145,167,225,84,66,220,85,207,37,251,
+243,101,229,148,236,55,62,46,110,180,82,60,65,102,247,124,135,55,208,240,95,101,15,73,
+113,222,99,11,187,18,245,215,143,134,174,179,161,247,99,133,78,133,12,44,3,35,221,127,
+95,234,187,14,147,142,112,131,238,240,195,61,77,21,33,58,157,254,24,241,216,197,144,152,
+117,102,121,143,229,69,37,36,91,17,148,5,99,139,218,255,63,150,50,201,252,48,136,12,
+29,48,115,223,209,208,106,175,41,38,122,102,26,143,244,123,205,59,157,49,173,96,193,55,
+111,65,104,203,167,93,186,92,228,38,201,251,117,97,39,107,27,101,98,103,102,131,109,47,
+179,240,67,32,196,52,248,181,50,15,0,89,141,140,100,90,98,177,22,193,0,103,230,150,
+206,20,39,74,94,215,246,186,4,238,11,81,119,23,121,32,32,22,126,101,219,24,97,64,
+75,89,68,240,248,125,13,207,54,16,69,81,92,11,90,167,195,198,190,105,147,102,127,45,
+79,223,255,127,247,51,245,243,3,179,15,215,233,39,205,140,47,66,237,249,253,123,254,56,
+12,217,123,47,114,6,90,159,24,93,240,189,142,28,254,68,189,100,200,220,246,123,236,185,
+143,240,194,255,127,164,189,126,127,65,184,186,51,181,221,54,73,29,2,88,48,68,93,217,
+174,200,6,105,134,2,45,135,203,43,51,22,87,232,77,19,81,172,84,4,216,244,97,198,
+38,162,106,164,76,93,90,153,69,219,72,216,237,183,43,50,65,141,184,165,125,236,16,63,
+236,69,14,101,172,99,19,156,213,222,159,103,9,64,119,36,88,89,161,173,204,51,89,35,
+90,197,150,124,35,177,60,188,250,178,219,166,130,191,185,67,107,115,216,82,251,166,207,205,
+126,59,132,95,19,63,135,237,233,249,191,71,197,207,173,223,13,10,172,243,90,124,13,85,
+65,86,10,47,198,241,248,141,127,77,221,62,254,254,110,141,111,134,255,99,169,129,147,135,
+23,195,132,124,134,94,0,104,68,70,92,100,131,242,33,238,27,204,136,19,176,238,184,245,
+108,43,148,67,193,0,215,242,253,25,193,38,154,61,190,189,162,241,235,209,234,174,51,163,
+241,109,210,133,109,54,235,122,190,171,204,121,57,244,46,127,170,7,206,226,243,143,170,135,
+55,159,219,42,237,16,244,135,61,61,68,96,4,83,203,180,128,158,242,96,154,105,207,177,
+226,232,164,215,92,208,75,234,194,116,128,14,199,122,99,15,158,149,43,87,250,241,173,237,
+46,231,156,11,237,209,94,198,180,165,107,79,106,9,238,193,18,44,150,89,254,189,176,165,
+203,221,147,111,175,76,167,240,235,214,133,22,215,155,81,168,51,177,108,101,16,152,39,22,
+4,130,62,6,65,12,46,53,160,113,70,38,12,155,187,192,122,98,37,16,59,254,54,16,
+176,98,12,8,74,50,97,218,182,196,47,208,175,198,247,224,100,24,226,59,44,188,109,107,
+16,19,15,12,140,69,128,195,0,31,58,254,95,42,52,157,117,31,99,34,214,151,145,210,
+123,41,205,242,126,54,242,183,229,52,135,157,135,205,79,137,249,236,203,114,53,205,129,63,
+106,214,131,7,178,73,146,72,219,254,125,243,8,98,132,126,226,40,86,2,41,102,100,67,
+168,194,129,129,115,166,86,69,87,72,231,240,227,170,195,244,153,197,122,58,116,145,107,136,
+185,65,136,44,21,245,230,69,146,136,20,151,254,143,147,175,6,72,32,141,100,85,122,209,
+205,181,145,208,147,10,134,156,147,113,20,17,192,120,66,242,67,110,45,200,153,59,45,212,
+65,126,240,235,98,241,25,180,78,118,54,73,148,132,48,152,100,174,249,192,33,104,49,143,
+42,215,147,210,21,182,140,209,52,122,25,254,226,108,233,158,158,182,246,133,103,85,252,102,
+152,143,250,231,24,200,118,125,49,44,150,67,42,30,28,167,229,43,165,5,191,157,185,52,
+70,180,140,190,82,25,16,38,73,153,194,69,53,97,35,161,227,26,225,104,39,72,36,36,
+200,86,226,208,192,233,216,154,97,240,227,157,244,121,183,179,177,184,162,253,217,176,118,47,
+52,212,211,235,237,94,76,195,79,1,231,51,68,58,162,139,3,124,30,44,84,159,67,134,
+10,171,192,191,14,30,238,94,46,187,232,53,221,114,32,131,70,146,11,228,72,215,7,204,
+196,138,131,29,97,221,70,119,221,157,24,84,72,202,177,191,235,159,175,26,204,223,108,47,
+68,214,229,38,94,191,124,242,69,50,34,198,32,113,123,136,25,189,17,7,222,72,184,225,
+196,51,19,6,90,3,182,13,199,239,97,203,36,49,13,196,129,68,179,50,213,111,156,176,
+123,200,13,217,85,244,181,138,242,97,59,102,118,8,88,38,253,4,110,181,101,247,58,133,
+45,146,93,171,56,98,106,138,138,136,207,151,228,107,42,139,34,179,87,123,223,238,30,27,
+219,190,230,241,243,18,114,171,153,145,59,130,38,252,56,43,133,14,62,17,24,37,4,12,
+208,135,245,200,123,252,131,56,88,5,194,108,225,14,223,220,95,8,226,207,202,9,185,206,
+207,207,248,217,251,237,164,172,17,124,227,233,99,8,21,231,235,53,238,210,120,167,214,71,
+125,33,28,61,72,194,245,132,23,247,67,82,108,212,234,145,206,234,206,155,99,58,20,132,
+231,183,77,68,233,53,12,84,206,172,102,166,86,66,81,2,32,21,17,45,1,168,40,130,
+92,114,10,36,166,243,180,56,150,70,74,34,171,132,201,175,72,84,215,12,254,90,41,90,
+118,99,118,138,243,115,198,212,205,108,168,21,199,179,44,201,137,0,38,220,133,254,80,189,
+151,99,43,238,128,210,226,67,162,97,255,119,137,246,75,133,11,1,22,46,87,76,91,167,
+34,222,196,41,166,115,225,152,182,122,50,118,61,247,162,67,251,119,66,133,194,24,204,91,
+85,171,117,143,2,239,45,16,47,201,104,155,9,227,106,24,175,189,48,93,35,254,105,158,
+82,234,184,182,229,99,224,134,217,89,157,7,150,173,1,228,118,117,33,238,191,187,117,156,
+216,116,116,178,75,70,1,63,236,187,13,157,54,254,25,143,170,147,132,55,92,188,10,112,
+139,179,197,93,242,17,143,86,11,232,139,205,101,89,248,159,211,47,120,44,235,173,28,241,
+95,247,229,230,189,172,105,145,195,242,138,119,76,186,80,10,76,145,246,182,144,64,164,223,
+244,107,201,188,76,198,225,51,245,11,39,8,55,230,154,134,132,252,228,120,208,69,61,126,
+115,164,139,178,93,12,152,17,112,206,154,221,180,107,252,231,104,197,228,97,144,17,247,229,
+158,129,110,217,197,248,153,131,253,30,223,111,149,163,222,242,106,91,189,109,157,41,238,6,
+28,234,169,67,171,217,55,181,109,30,175,64,151,175,215,94,30,200,189,24,125,238,79,6,
+247,181,223,143,160,187,140,139,33,145,226,203,163,181,59,180,98,206,190,205,16,223,50,71,
+27,155,33,180,200,17,73,33,221,100,125,30,56,111,101,201,113,244,51,227,236,161,106,228,
+121,225,110,5,204,92,253,62,25,113,81,140,187,230,198,51,144,140,52,192,50,223,37,110,
+16,67,35,18,153,136,167,131,136,1,132,51,21,235,82,37,47,22,1,121,27,212,244,103,
+67,69,99,93,80,85,151,114,228,63,70,193,118,203,235,218,180,146,107,5,43,83,216,162,
+218,53,61,16,137,20,22,8,16,175,84,234,175,170,161,113,29,67,38,24,248,143,71,8,
+186,57,164,21,199,173,170,58,182,97,66,51,42,115,250,44,122,54,199,59,147,81,164,9,
+95,236,116,82,190,184,177,27,26,213,252,97,212,90,206,215,229,182,185,150,117,95,98,14,
+255,115,23,87,195,216,201,174,179,78,20,240,154,98,233,77,134,244,147,247,185,122,114,127,
+22,211,152,87,209,111,210,215,161,160,132,58,207,87,129,172,71,250,148,178,17,36,81,183,
+2,154,25,15,33,152,10,102,12,22,119,165,199,123,13,67,75,154,223,135,227,207,111,143,
+194,168,223,197,91,108,75,191,27,116,151,241,106,254,112,220,235,107,90,151,145,128,132,204,
+65,6,21,142,200,19,180,242,4,197,5,215,60,177,75,127,241,137,8,149,51,34,65,225,
+164,43,167,94,34,24,201,12,17,24,182,100,95,140,185,240,53,93,217,48,101,102,105,164,
+236,4,200,100,130,54,5,73,152,241,195,79,6,59,179,232,104,243,114,16,172,227,3,80,
+199,129,35,137,168,127,217,162,150,49,70,118,195,4,237,146,204,75,209,216,151,246,137,187,
+144,27,165,200,217,148,13,229,151,91,58,68,197,102,205,143,127,11,47,146,148,204,109,73,
+228,41,140,97,102,17,238,187,65,164,157,58,23,162,84,80,147,251,208,64,55,157,152,223,
+10,8,251,21,180,122,79,196,136,198,114,54,233,190,120,153,172,120,218,230,253,23,100,91,
+130,230,77,128,228,235,116,207,36,83,114,229,200,188,107,244,97,144,67,48,26,132,17,14,
+35,203,150,110,180,179,114,225,150,123,1,75,9,9,113,228,39,244,219,179,111,158,175,24,
+169,83,131,131,220,91,253,154,53,183,183,60,248,61,154,219,27,91,124,202,24,201,94,175,
+221,181,116,108,150,214,107,190,198,45,109,6,25,130,230,125,214,123,94,248,176,28,17,187,
+54,89,236,150,73,80,136,61,249,17,51,137,60,78,38,77,159,151,86,40,31,151,222,243,
+151,78,116,141,243,215,34,49,124,176,35,151,225,158,55,115,135,195,206,198,234,120,250,232,
+97,97,8,126,69,26,106,187,76,93,154,125,28,125,134,28,116,11,221,8,170,144,51,214,
+90,239,163,230,185,67,69,220,147,120,25,144,77,30,226,136,160,222,170,89,36,0,133,183,
+234,159,91,10,81,125,139,10,175,5,30,240,136,39,15,84,253,55,153,91,48,45,178,118,
+120,97,238,179,55,195,248,49,59,254,185,120,216,98,93,92,171,218,219,229,219,132,125,189,
+62,100,16,20,117,41,90,251,56,190,58,87,102,13,47,74,252,109,253,178,109,47,248,59,
+179,143,159,222,37,15,87,174,52,200,227,34,207,56,254,154,124,28,93,163,228,183,18,245,
+76,166,25,202,77,121,163,255,42,95,155,93,247,254,0,98,234,203,225,219,178,158,5,132,
+187,58,5,239,229,149,62,46,228,148,224,136,153,218,93,125,139,237,197,68,197,136,112,101,
+206,232,103,114,157,197,196,160,42,92,95,93,131,16,222,107,110,69,245,167,114,214,74,86,
+221,82,7,223,43,85,14,213,163,59,76,175,84,103,171,78,202,202,219,80,197,124,202,0,
+120,251,234,124,249,186,105,87,51,175,210,132,42,119,157,82,129,33,90,133,135,57,203,22,
+29,90,167,131,191,171,130,205,226,220,109,85,87,71,223,243,134,133,26,13,68,142,117,134,
+92,69,254,242,84,250,48,20,71,226,196,64,186,213,210,235,111,75,55,82,23,56,216,87,
+37,179,211,55,87,54,102,153,229,18,60,153,151,240,160,127,195,46,99,97,184,44,35,252,
+17,106,28,84,187,245,72,6,251,93,231,12,113,66,126,46,141,156,141,171,175,244,225,15,
+251,126,55,122,62,164,196,82,131,239,212,204,172,145,98,144,84,0,87,198,222,131,248,41,
+23,17,79,69,216,85,205,149,216,214,252,3,197,25,134,173,157,166,225,253,42,196,17,153,
+68,17,145,204,129,121,143,194,90,132,222,121,78,238,255,4,105,252,39,3,112,137,243,74,
+248,247,103,127,174,224,37,158,142,128,141,111,195,75,252,197,211,32,191,19,232,176,235,53,
+174,214,156,161,197,169,231,40,163,82,229,147,165,251,41,95,243,120,231,209,233,30,169,79,
+242,97,54,219,41,6,176,233,242,95,108,23,52,139,216,79,244,124,161,194,143,71,8,93,
+20,219,238,247,110,209,186,86,67,1,72,179,155,220,68,199,249,249,47,188,0,100,0,50,
+87,133,2,13,90,232,50,6,50,10,46,82,188,85,166,231,236,209,185,128,105,103,121,127,
+51,234,8,117,48,117,199,241,143,38,114,202,133,9,120,39,116,125,189,241,225,109,7,78,
+103,123,8,251,139,191,96,135,114,99,205,152,214,74,135,46,68,113,125,96,181,243,47,84,
+93,146,194,74,136,128,186,122,143,102,134,229,143,181,139,4,173,233,185,243,48,201,130,140,
+11,136,207,220,119,170,206,229,164,251,184,122,176,176,241,7,230,98,174,97,140,238,182,209,
+174,17,97,167,131,8,194,225,100,173,222,134,238,3,118,63,205,174,111,177,64,119,168,92,
+254,234,146,251,140,173,17,120,197,112,195,127,153,171,250,126,191,173,239,169,49,92,137,135,
+248,151,90,201,185,4,204,75,183,61,130,249,79,76,248,198,169,95,40,225,91,77,129,10,
+52,132,22,201,186,216,124,147,115,70,232,216,187,80,250,85,233,107,47,223,185,146,1,131,
+90,31,81,23,192,190,219,38,223,152,84,164,210,144,204,97,135,181,30,64,113,119,33,204,
+193,245,145,122,146,181,96,115,39,45,138,122,146,23,170,63,216,223,248,225,120,91,158,181,
+196,192,34,41,8,42,130,224,200,225,141,153,71,218,51,109,218,248,254,122,32,204,250,56,
+191,99,244,167,211,54,246,242,215,48,219,234,183,171,215,235,70,43,131,115,187,215,51,243,
+182,75,152,83,208,217,17,116,24,62,41,139,94,223,75,141,193,242,4,119,103,88,7,181,
+216,196,149,196,237,31,64,183,22,253,15,166,120,187,87,177,170,182,42,33,19,34,253,243,
+193,241,5,116,14,77,61,126,22,133,220,108,173,135,6,12,63,193,22,232,218,144,226,96,
+35,111,217,121,124,113,37,198,230,151,50,101,252,135,149,104,77,120,74,15,208,226,147,189,
+199,125,237,122,174,207,225,158,156,162,46,230,78,1,246,107,89,116,75,69,20,170,191,77,
+172,93,107,198,215,29,92,152,160,49,215,138,196,177,76,186,209,4,223,199,174,52,89,227,
+153,61,176,174,246,9,245,250,130,238,205,130,155,199,89,96,121,96,131,21,230,236,51,25,
+10,186,144,147,90,46,41,10,232,191,231,130,117,22,78,94,79,195,27,70,61,35,18,173,
+142,123,184,140,172,245,245,220,34,235,188,251,12,130,11,215,219,19,174,49,16,86,238,22,
+108,174,149,16,17,64,149,73,182,95,193,14,148,167,78,207,182,21,216,44,221,5,212,212,
+88,119,55,50,74,101,204,75,227,230,31,13,254,24,164,57,22,190,54,138,167,216,174,63,
+135,191,143,135,225,190,92,23,127,215,54,126,109,232,62,255,190,17,210,210,95,76,114,137,
+91,92,158,239,219,23,198,74,109,50,167,170,159,142,157,62,11,217,169,210,173,53,177,221,
+180,198,101,133,77,147,197,159,2,100,130,197,129,231,248,253,90,223,230,119,231,217,246,240,
+245,122,77,50,230,183,110,101,174,161,211,58,213,11,53,39,211,107,133,104,142,45,92,121,
+54,122,95,109,48,56,76,76,183,78,238,59,160,204,17,80,214,25,78,47,211,5,21,255,
+15,153,176,103,176,58,171,88,248,91,179,189,146,116,253,39,178,73,194,155,91,27,39,67,
+103,164,5,10,246,181,1,125,15,2,25,167,205,19,175,83,6,91,59,77,107,114,30,38,
+98,79,179,23,2,229,120,123,3,50,70,238,184,151,249,56,48,131,124,222,151,65,3,110,
+198,60,54,93,108,171,62,55,86,225,32,44,64,121,72,197,101,249,57,164,226,143,166,102,
+84,156,86,112,151,181,24,74,28,6,127,124,113,252,154,111,245,113,85,107,206,252,183,98,
+215,2,50,115,50,47,218,223,68,110,75,229,217,237,221,176,244,238,41,64,36,179,176,217,
+159,251,23,184,199,34,36,35,236,145,46,105,167,174,17,12,138,123,62,132,160,190,189,17,
+61,99,243,157,202,169,70,12,85,65,94,253,45,135,176,69,9,201,167,226,74,64,49,132,
+33,37,119,226,95,128,83,93,194,187,250,218,193,122,182,145,84,253,20,172,68,33,197,252,
+82,87,131,168,126,217,192,134,2,130,17,167,211,93,206,31,245,131,112,199,47,27,253,132,
+11,190,206,86,25,155,200,37,236,182,171,186,63,29,244,234,244,60,6,106,208,119,127,87,
+127,83,142,228,121,43,213,188,48,85,147,223,176,177,159,163,32,34,170,120,200,53,237,37,
+120,247,107,244,188,117,209,166,61,16,245,253,9,18,252,56,223,79,168,18,143,235,141,127,
+179,199,31,174,156,91,77,247,104,27,220,219,45,94,8,26,63,57,150,109,36,198,103,242,
+187,119,206,185,242,215,30,26,74,235,120,211,143,224,218,83,55,45,151,199,226,117,55,65,
+237,47,201,159,177,121,194,63,166,84,155,103,188,252,99,145,242,127,75,218,64,76,202,98,
+64,25,154,205,41,137,186,109,171,224,214,47,79,231,125,43,234,178,199,152,247,157,123,153,
+157,110,21,92,10,209,100,101,108,153,107,7,198,12,136,125,22,228,40,123,125,242,47,131,
+202,2,186,209,250,202,243,167,194,141,142,121,155,62,47,92,215,206,89,181,211,162,5,177,
+253,178,32,199,147,53,244,82,97,231,253,245,186,72,202,191,26,34,150,57,248,246,247,166,
+216,10,178,51,124,103,34,101,193,163,181,165,67,88,148,134,223,208,209,100,194,81,188,25,
+246,234,101,135,94,225,158,94,207,215,60,203,186,132,74,37,28,154,191,208,165,125,9,212,
+76,45,150,32,155,83,212,226,34,25,125,132,152,106,126,136,240,33,177,7,184,84,233,149,
+231,219,148,175,147,188,250,63,79,155,239,243,163,242,63,64,27,253,175,47,109,56,89,85,
+105,213,210,40,77,240,231,34,222,224,44,155,156,125,131,71,169,68,12,240,39,187,179,179,
+109,185,234,22,29,161,131,102,53,42,162,135,23,1,141,133,124,137,64,139,129,42,146,215,
+83,212,239,93,94,170,144,190,63,98,227,114,4,169,237,146,73,102,66,191,100,82,36,137,
+71,59,128,183,254,199,193,157,248,66,44,108,55,159,248,58,111,131,177,116,98,161,16,198,
+80,28,89,85,125,180,100,115,101,138,148,216,177,247,30,253,149,133,48,153,78,39,170,13,
+45,58,27,107,160,209,234,30,186,50,40,181,22,207,168,235,34,42,74,74,163,212,52,0,
+146,22,101,137,122,121,125,249,110,149,145,252,193,103,143,179,79,178,239,103,207,236,228,250,
+121,44,184,160,72,171,246,114,255,103,98,58,227,50,197,31,229,37,89,86,84,168,220,179,
+51,189,143,91,15,188,234,199,120,52,188,221,106,109,252,171,143,145,228,162,126,26,233,250,
+199,150,110,165,110,38,198,84,146,86,239,189,196,225,63,118,41,110,171,236,215,153,183,198,
+141,177,134,123,93,127,121,118,99,87,118,199,134,188,232,114,148,162,116,197,134,106,205,56,
+119,125,91,112,184,149,0,86,174,221,5,109,202,220,170,87,94,33,94,189,203,24,23,193,
+201,233,130,203,242,56,176,166,60,136,176,118,15,226,77,91,127,138,98,94,104,167,125,115,
+194,146,148,13,9,69,125,185,88,51,254,140,133,115,223,22,103,130,102,134,38,199,114,204,
+246,243,105,81,172,128,6,162,82,140,193,19,107,114,251,35,244,124,107,205,152,71,138,236,
+175,139,151,33,214,41,136,99,173,151,255,56,113,134,116,83,86,34,30,146,58,205,86,18,
+133,169,10,210,235,2,133,113,167,149,199,227,243,239,80,252,170,211,182,1,16,62,52,65,
+226,186,119,87,119,153,103,84,184,173,163,225,178,142,97,89,13,74,205,62,181,171,196,40,
+65,222,27,103,31,4,143,241,127,127,149,255,164,157,126,6,102,96,166,26,9,8,128,23,
+228,88,34,138,128,177,2,158,24,103,74,126,86,73,9,213,247,154,246,112,171,116,233,111,
+48,119,193,135,221,44,60,14,33,254,143,160,128,114,146,131,146,186,11,196,160,229,145,76,
+6,118,214,99,219,133,3,38,64,200,126,156,246,18,237,185,42,185,205,233,231,52,190,47,
+85,191,84,166,180,162,210,80,217,97,88,245,45,97,176,74,143,175,151,86,27,14,135,233,
+190,51,180,202,96,38,199,107,221,228,182,86,147,185,189,215,215,228,41,76,91,23,66,45,
+130,65,43,145,50,112,126,134,28,122,35,39,116,66,43,59,11,168,128,177,102,162,172,130,
+34,171,109,119,153,113,186,90,208,64,174,15,155,236,17,116,152,89,17,178,193,125,198,111,
+96,133,120,152,169,38,45,72,172,6,12,36,76,90,212,178,50,199,33,160,155,30,24,144,
+53,152,32,68,236,192,126,109,196,201,142,214,113,139,182,124,60,63,26,117,50,228,189,235,
+123,175,137,146,228,243,144,7,140,128,32,125,32,147,65,242,121,188,120,184,156,218,231,237,
+221,246,51,107,117,182,33,235,158,83,165,230,75,237,157,53,107,103,151,155,112,194,195,43,
+90,141,143,240,233,149,47,197,90,1,135,186,163,224,140,71,86,3,90,242,86,235,59,26,
+239,87,170,100,69,102,236,195,181,27,33,190,23,114,15,22,136,60,39,66,200,230,190,64,
+210,49,50,57,241,71,193,189,96,15,135,213,96,86,228,33,105,174,65,200,67,151,165,150,
+23,5,197,149,41,35,132,199,241,99,173,202,135,4,68,230,255,3,11,105,41,118,35,75,
+23,44,217,158,101,206,103,43,89,92,65,77,41,234,65,216,97,172,167,97,131,217,3,154,
+66,212,206,122,122,28,177,216,235,97,23,82,116,149,245,108,84,131,159,149,124,199,93,105,
+209,202,241,205,217,97,171,134,152,169,228,211,206,248,165,219,40,220,115,245,22,38,118,206,
+173,8,173,162,25,214,32,113,34,203,83,239,56,102,97,10,3,161,86,106,3,32,100,1,
+144,34,34,42,232,12,82,176,164,74,132,188,254,229,157,135,179,227,2,152,139,130,219,236,
+185,23,152,152,73,17,147,197,148,100,81,255,89,81,153,183,243,70,133,166,40,48,52,22,
+143,59,190,87,73,247,239,156,190,125,86,120,242,247,16,190,247,63,227,141,141,173,11,199,
+202,184,62,231,114,130,116,175,72,69,23,153,206,162,39,50,220,76,48,247,214,147,106,46,
+124,58,101,190,69,90,121,78,214,144,215,67,81,36,86,193,154,130,135,163,145,36,232,48,
+160,60,86,201,210,218,67,89,84,99,79,231,36,171,77,196,27,159,166,231,217,162,219,77,
+89,18,72,215,206,79,56,166,55,28,56,239,150,100,130,97,131,221,216,31,185,121,114,180,
+66,230,2,226,239,68,181,119,26,253,175,132,179,99,215,3,175,172,190,153,46,142,105,143,
+215,37,183,194,9,146,239,68,199,73,57,201,135,110,254,105,171,248,9,50,199,205,223,126,
+44,186,130,2,80,150,71,54,58,55,150,1,70,16,242,244,15,63,161,221,50,184,103,183,
+206,154,51,166,149,178,182,20,43,212,230,100,50,234,58,177,213,122,66,241,100,26,211,230,
+149,7,193,111,217,113,86,193,11,124,122,243,103,201,235,78,174,11,100,9,69,33,24,141,
+68,184,199,91,58,229,202,157,175,14,27,240,192,210,121,8,146,34,65,250,22,74,15,18,
+98,193,243,92,144,156,115,49,56,105,157,120,36,250,36,185,230,101,147,250,46,66,64,175,
+126,76,90,116,158,36,221,184,65,241,249,149,248,249,29,156,164,33,237,171,27,91,71,17,
+56,22,108,230,220,145,9,0,126,101,36,111,136,99,113,56,48,151,14,223,38,143,157,68,
+2,109,134,238,228,221,93,109,186,228,175,87,208,66,191,210,39,111,121,143,103,71,178,243,
+62,45,136,226,25,207,241,219,235,251,90,226,128,59,245,30,231,54,58,2,141,252,2,100,
+202,15,200,246,59,150,17,139,61,57,29,87,83,101,97,194,18,233,168,64,118,101,98,117,
+17,236,116,239,115,176,161,246,157,94,96,188,177,106,134,36,109,135,163,23,231,119,133,124,
+153,128,140,202,128,0,67,194,168,143,138,117,86,228,15,229,47,55,62,44,140,126,193,59,
+188,245,247,46,191,61,189,57,255,107,243,95,231,177,116,123,222,225,119,167,86,124,175,156,
+176,205,14,101,40,5,115,143,66,46,108,101,207,118,194,155,252,58,194,240,117,154,55,230,
+235,112,156,32,154,226,122,19,30,105,19,16,170,78,218,29,64,156,127,180,119,154,109,243,
+77,42,81,25,137,120,28,199,116,120,21,246,180,177,189,254,43,143,11,99,135,61,216,78,
+109,191,245,207,119,154,22,52,89,96,68,34,145,2,234,85,169,42,202,212,209,165,152,169,
+185,201,153,63,117,102,186,93,25,27,177,71,150,44,66,241,77,89,38,186,103,175,208,113,
+77,65,207,53,43,50,232,252,151,0,253,155,37,232,71,55,94,50,249,235,132,155,182,91,
+21,22,171,33,157,93,241,87,50,130,250,155,229,63,194,116,181,91,73,19,1,2,64,86,
+254,143,30,253,182,250,219,136,66,54,89,183,138,153,191,243,230,157,110,178,66,83,212,227,
+230,253,199,93,55,78,145,238,25,17,194,109,251,237,124,11,22,75,27,45,90,215,244,221,
+217,95,198,19,0,157,54,112,227,245,245,38,185,111,105,140,127,6,172,183,122,35,138,63,
+166,149,68,84,95,77,165,88,239,57,92,41,69,164,106,188,127,11,229,123,73,90,250,60,
+164,246,235,143,134,186,162,18,159,173,42,34,48,68,5,110,179,78,14,68,66,139,40,196,
+47,134,79,95,191,95,63,126,173,252,236,239,93,70,213,125,219,247,132,83,47,135,65,27,
+55,21,224,113,250,97,197,2,148,224,67,224,121,114,81,213,199,63,76,19,208,112,114,106,
+118,101,96,131,221,50,92,98,157,170,67,30,137,83,209,189,5,213,93,118,74,200,219,121,
+67,75,111,73,156,34,81,185,93,235,91,37,99,182,54,150,139,201,250,204,150,93,166,234,
+148,248,229,114,48,141,205,126,29,173,140,228,194,72,117,4,167,23,112,128,112,255,18,249,
+123,239,95,189,115,77,215,228,197,122,252,184,145,143,49,139,28,15,159,74,229,227,184,180,
+4,1,18,170,87,106,197,163,96,67,81,141,216,77,100,178,115,181,217,100,240,254,92,111,
+228,235,234,248,115,156,218,92,28,88,14,101,46,125,69,43,87,107,221,182,137,53,101,247,
+162,123,218,17,2,180,255,98,21,11,177,115,57,4,245,170,151,92,186,187,234,132,202,214,
+180,11,27,213,109,22,249,127,91,71,199,23,225,133,239,138,149,89,237,216,138,206,131,51,
+115,110,255,111,100,118,159,181,62,166,167,100,143,94,41,169,161,113,65,69,155,67,201,157,
+126,182,7,229,116,239,121,37,76,203,130,84,175,210,144,172,63,126,254,119,58,156,125,232,
+75,85,74,38,12,16,0,133,85,8,139,190,142,27,84,187,226,73,148,0,7,190,201,49,
+249,70,25,117,254,122,245,69,208,223,103,66,225,154,121,23,44,47,193,206,120,121,61,219,
+92,229,59,175,219,208,189,91,108,130,224,46,134,97,129,211,49,117,245,191,34,136,189,103,
+19,36,213,144,73,50,123,22,130,20,26,179,27,101,172,100,231,190,188,81,226,142,140,248,
+224,76,105,5,213,43,151,249,114,142,244,87,85,46,126,74,220,124,238,50,80,113,40,189,
+17,0,66,172,72,76,13,130,186,140,173,200,96,16,37,147,148,108,117,67,84,162,65,169,
+73,86,214,192,191,200,99,213,88,127,231,195,59,176,186,106,88,87,196,222,225,175,95,235,
+174,16,86,59,173,181,79,233,174,190,1,150,159,18,33,146,186,218,48,3,172,115,57,26,
+19,154,179,34,73,32,17,249,19,236,115,182,201,183,45,73,191,233,218,79,163,91,117,31,
+153,228,225,186,169,181,27,43,24,142,18,56,10,163,44,35,136,190,232,210,75,15,56,201,
+147,150,62,44,155,205,144,236,68,202,12,213,78,82,227,46,167,32,129,150,77,36,32,109,
+153,95,37,123,153,103,199,50,155,195,86,187,83,4,164,217,125,135,92,155,5,84,15,176,
+140,182,138,72,205,215,97,116,16,78,43,29,19,108,220,91,3,32,146,130,106,182,101,177,
+27,245,86,90,191,102,93,217,145,61,169,169,20,222,48,5,177,95,225,76,144,129,16,182,
+70,72,120,176,244,212,172,167,48,140,4,0,224,35,15,81,189,48,146,251,77,157,117,144,
+125,3,220,111,127,67,45,0,193,36,146,96,162,63,121,88,73,141,95,212,254,113,91,99,
+231,243,244,153,125,126,91,15,130,7,2,243,157,15,110,29,87,124,58,197,135,191,6,151,
+151,14,128,234,85,56,3,16,81,160,4,118,101,225,211,116,141,41,155,150,179,33,66,31,
+99,92,209,94,59,40,215,157,145,3,237,37,62,99,123,38,179,212,85,56,229,176,84,10,
+157,54,144,48,92,171,178,84,121,146,39,62,44,191,66,183,213,1,18,188,90,180,140,225,
+187,114,132,120,103,219,116,147,107,236,150,195,91,247,218,215,114,159,88,43,37,23,181,60,
+40,223,20,50,54,24,139,238,203,148,251,163,27,107,112,199,203,197,23,2,46,110,231,242,
+207,117,197,25,78,229,3,168,175,13,226,2,148,80,215,178,99,146,187,17,132,74,113,42,
+217,9,171,4,195,4,143,43,222,39,247,148,199,157,197,4,130,20,16,35,228,150,255,119,
+247,56,149,175,242,133,246,242,194,95,27,113,73,6,130,196,249,188,150,72,237,55,160,136,
+222,255,82,173,182,242,41,87,145,4,132,22,21,9,43,172,180,109,26,48,212,32,156,177,
+14,31,134,245,23,58,187,202,17,141,244,180,218,40,212,64,12,204,213,9,42,46,22,167,
+111,198,238,213,244,249,187,52,251,157,222,250,226,203,244,91,30,191,71,36,117,186,182,188,
+170,58,27,9,97,85,106,207,151,172,91,247,87,190,60,206,230,146,140,232,81,151,114,70,
+17,39,177,115,223,174,231,228,123,183,248,29,1,13,228,113,122,248,121,68,56,108,102,218,
+112,157,228,204,101,145,14,90,170,34,249,187,85,125,32,203,184,134,3,3,222,111,118,79,
+188,186,85,209,17,82,227,242,72,145,100,127,99,81,136,185,65,99,38,234,130,158,21,254,
+242,240,192,86,35,200,216,187,177,246,176,16,211,253,232,84,241,234,175,196,247,137,37,57,
+208,86,78,209,83,42,28,194,113,53,126,75,149,144,220,159,105,130,116,54,237,11,145,61,
+159,27,144,206,149,176,7,162,113,52,199,7,238,55,18,16,90,122,26,9,187,109,131,250,
+6,0,161,126,94,20,2,14,114,122,8,90,96,40,66,216,46,49,200,80,192,211,153,245,
+183,181,247,246,132,28,207,153,243,236,251,175,178,20,42,158,138,203,153,43,95,89,7,54,
+113,195,149,52,208,63,249,36,191,40,230,174,190,171,139,91,239,215,169,94,159,135,107,53,
+90,232,170,250,251,98,188,225,45,177,214,185,211,70,205,73,4,86,74,104,105,78,160,111,
+89,145,40,164,144,108,239,25,226,60,222,107,103,201,63,141,237,208,248,55,29,217,124,169,
+247,228,184,107,2,187,159,99,250,105,107,13,221,72,28,233,173,6,237,84,139,125,157,196,
+240,198,205,212,158,202,43,139,100,63,17,22,101,40,111,210,46,238,3,78,142,59,54,200,
+16,101,100,104,238,182,97,215,94,242,196,254,192,229,135,44,193,136,136,89,102,67,171,173,
+62,179,231,123,34,43,17,201,187,240,244,237,159,18,153,228,107,204,85,44,91,65,84,141,
+151,246,200,42,226,44,11,216,237,123,179,202,195,73,76,34,34,81,11,43,50,16,65,99,
+221,71,163,63,13,62,61,106,207,166,100,174,87,10,80,209,214,219,231,166,184,168,31,58,
+170,64,113,245,82,109,121,132,81,86,129,44,206,210,130,221,10,51,236,114,89,155,12,202,
+2,116,117,183,133,58,188,180,241,158,35,65,208,95,122,252,125,218,168,94,195,250,252,17,
+89,198,93,223,229,241,33,95,121,132,187,179,120,108,237,8,157,5,201,100,174,116,17,137,
+165,228,144,135,25,28,36,33,67,159,20,112,71,229,204,232,22,118,255,226,230,87,190,215,
+136,107,57,35,176,4,5,137,99,217,9,180,48,62,35,59,43,237,111,80,8,197,34,58,
+247,45,78,21,27,199,51,155,249,113,66,236,118,66,229,60,0,132,194,13,165,25,196,196,
+152,55,103,114,10,105,5,109,250,131,39,113,185,194,28,53,169,117,72,217,213,210,185,0,
+201,122,174,16,241,128,229,161,118,214,165,202,207,225,41,132,236,123,233,62,123,250,214,151,
+13,67,229,108,196,214,53,202,94,228,211,201,88,149,109,28,167,250,165,252,98,200,174,255,
+140,111,215,91,12,117,103,118,59,24,88,99,145,207,117,211,175,144,190,145,220,250,75,237,
+37,244,177,107,98,89,234,220,90,219,72,94,145,27,224,212,71,32,40,209,96,222,152,233,
+75,73,60,105,209,223,125,71,41,243,217,7,203,97,207,42,65,181,200,69,235,202,107,246,
+14,10,85,71,55,20,187,164,5,71,141,234,155,249,154,239,183,3,200,138,173,84,82,84,
+119,191,63,215,150,171,225,33,169,59,90,196,248,219,59,95,63,177,65,67,39,23,217,248,
+249,213,169,64,135,252,136,124,30,205,31,145,132,96,183,115,240,239,208,68,14,246,45,220,
+127,174,244,114,155,57,69,252,77,224,245,67,75,179,31,91,179,78,12,226,132,93,115,91,
+188,172,27,24,181,180,145,189,245,225,170,184,26,167,95,70,14,201,58,167,9,202,165,8,
+108,107,131,27,101,243,60,68,43,61,218,20,145,19,228,125,49,83,24,158,164,54,126,42,
+139,170,177,62,19,109,113,142,226,62,173,111,33,114,13,55,223,72,150,167,188,165,75,243,
+102,237,244,207,168,86,82,165,150,23,192,237,159,55,54,111,108,216,154,215,181,122,248,213,
+188,150,22,47,136,39,179,218,10,1,156,171,176,218,33,96,225,56,37,6,44,69,25,232,
+240,15,140,130,37,76,241,239,55,219,36,17,19,37,183,61,8,208,233,94,214,230,157,125,
+180,249,193,2,5,118,210,63,156,117,182,24,39,59,100,221,223,17,220,189,235,66,136,134,
+90,22,43,221,130,117,87,14,230,41,41,237,188,168,215,218,110,183,69,207,55,216,53,78,
+80,218,111,32,58,43,143,8,214,194,235,197,74,219,12,231,15,27,25,226,43,79,105,239,
+158,165,89,67,69,229,28,248,62,142,249,161,167,123,174,107,218,124,207,82,22,241,230,221,
+167,122,77,190,15,101,9,37,214,149,208,221,87,207,26,148,171,162,207,117,49,203,211,234,
+230,69,130,6,177,212,72,202,8,222,118,18,193,8,8,32,240,93,216,184,32,186,48,206,
+80,111,116,201,167,154,61,203,67,126,94,245,214,17,128,240,98,229,254,212,215,138,222,189,
+243,227,217,21,112,106,130,1,142,21,218,247,69,30,134,88,25,42,48,138,184,84,122,2,
+29,10,106,141,173,117,175,183,217,126,19,114,181,172,137,64,156,34,161,124,83,193,249,192,
+140,124,145,122,99,233,107,206,0,21,110,170,129,99,187,119,234,243,225,102,85,87,207,159,
+190,218,212,10,116,125,47,221,191,237,223,149,108,56,54,181,6,80,158,159,162,69,86,36,
+177,29,33,33,65,136,97,25,243,9,220,200,119,74,149,53,96,112,33,160,32,34,85,35,
+112,238,124,255,65,223,16,230,191,98,207,30,209,119,115,131,10,92,77,139,179,191,157,149,
+167,54,135,198,134,187,180,204,20,231,78,96,132,29,223,107,38,72,54,228,163,24,133,233,
+44,17,203,71,237,79,86,50,47,186,19,119,126,122,123,216,56,120,196,111,106,102,45,216,
+233,117,204,36,21,36,104,70,128,91,44,209,194,247,226,188,208,143,30,251,60,92,214,100,
+193,141,135,145,30,189,88,121,153,169,44,24,124,232,254,73,150,73,134,37,162,23,107,237,
+30,172,10,43,103,199,236,199,145,244,40,165,59,122,185,17,38,137,15,105,18,85,82,13,
+222,67,199,238,183,131,220,143,110,241,115,244,32,50,39,43,49,8,181,116,189,204,40,160,
+68,112,187,82,228,139,105,200,37,73,10,57,248,21,34,164,64,84,13,116,9,200,68,140,
+190,253,117,89,38,80,183,74,169,236,107,120,161,66,90,15,184,169,24,175,146,5,181,204,
+192,252,123,139,132,14,173,84,209,129,213,45,189,51,183,109,89,73,239,61,179,221,123,129,
+72,127,88,15,89,187,203,30,237,197,147,230,215,98,252,165,169,106,95,135,12,250,228,149,
+11,89,244,245,162,164,54,226,212,156,205,73,42,235,115,205,215,176,44,208,221,216,219,107,
+35,72,43,54,226,227,217,218,161,172,55,226,248,41,64,13,222,9,198,54,209,220,32,87,
+243,10,136,154,4,12,170,240,182,101,100,35,70,72,23,106,238,220,149,59,60,123,250,25,
+250,240,31,210,45,78,45,253,246,78,124,237,225,32,64,147,201,224,164,59,79,4,2,186,
+119,161,137,51,207,172,59,105,173,168,165,72,117,144,152,144,153,150,66,99,3,198,203,150,
+6,244,224,195,242,243,117,75,7,33,113,125,19,61,187,213,4,60,133,46,22,234,217,85,
+64,186,189,79,177,238,149,209,132,121,90,222,60,107,193,8,194,171,100,38,59,14,36,17,
+130,165,58,90,221,134,144,23,70,204,195,92,179,78,152,143,61,51,89,27,16,42,168,42,
+163,71,117,120,72,180,209,236,64,241,76,242,51,130,64,233,164,211,33,222,67,73,199,200,
+246,249,106,109,194,234,155,242,30,173,174,183,209,136,28,6,131,150,48,108,141,49,53,58,
+185,67,251,47,225,44,69,48,174,199,168,175,37,105,134,149,78,44,119,48,185,1,9,34,
+66,49,147,42,38,8,209,234,165,85,68,85,17,85,83,46,127,132,56,64,59,123,88,234,
+195,86,108,28,124,27,21,186,226,236,19,25,229,61,110,135,9,213,168,128,4,65,53,122,
+84,148,131,237,241,151,207,232,50,107,1,99,27,176,10,210,250,62,164,252,133,110,196,203,
+12,89,111,11,112,118,247,102,59,136,12,34,135,52,225,198,30,65,144,133,56,246,178,149,
+201,43,51,44,240,70,206,240,194,100,96,86,186,182,71,100,177,123,73,2,86,1,165,123,
+101,74,99,54,214,176,195,97,147,85,233,50,90,34,193,235,185,182,8,45,202,173,242,69,
+171,142,46,124,153,73,169,89,189,135,145,188,119,146,228,4,202,207,41,200,83,93,217,22,
+183,234,235,91,174,204,227,49,205,241,201,107,128,215,12,182,28,81,229,39,49,150,242,70,
+250,197,150,53,12,69,140,15,113,119,5,206,99,95,3,115,170,34,1,153,178,226,23,221,
+14,183,23,221,201,214,73,194,18,179,125,162,214,237,126,125,221,108,232,7,104,206,96,248,
+155,43,52,109,107,184,219,159,119,6,216,246,96,125,139,51,225,195,98,151,4,179,194,147,
+209,71,212,1,60,129,216,77,176,65,22,97,210,45,248,33,240,100,254,190,40,248,27,155,
+222,158,53,242,99,167,52,237,147,202,102,119,89,143,93,139,11,145,242,103,25,47,98,186,
+240,190,45,125,114,165,183,70,47,253,155,107,117,210,151,114,14,216,22,218,35,146,210,175,
+230,99,73,176,5,130,86,165,169,210,126,71,9,58,40,96,148,22,58,83,86,7,215,4,
+91,178,195,11,217,98,35,245,180,148,198,60,6,200,225,193,117,6,13,125,222,46,19,125,
+142,210,154,35,120,55,23,0,50,218,184,141,236,46,173,99,138,88,167,11,216,67,0,128,
+178,84,4,78,83,168,12,99,2,212,132,44,168,6,111,178,58,235,116,142,131,100,136,215,
+116,224,167,191,6,231,141,217,246,97,142,87,233,44,133,32,154,160,214,193,212,73,13,77,
+125,53,124,219,30,235,42,237,184,142,235,100,156,121,137,110,80,29,80,170,240,125,120,106,
+102,121,56,156,42,39,148,12,2,92,251,159,8,71,49,233,209,7,80,109,90,202,6,108,
+219,168,222,210,59,77,41,176,9,2,102,63,55,14,134,117,183,161,41,3,12,18,207,160,
+104,5,190,11,7,57,42,68,207,38,62,233,201,220,144,208,166,24,90,156,116,45,15,176,
+103,211,159,131,115,176,80,117,230,25,91,12,214,113,171,233,114,67,48,194,153,177,29,139,
+10,177,12,81,51,225,162,200,152,42,128,42,221,72,43,54,93,155,69,219,45,213,136,155,
+236,52,85,183,113,44,185,25,150,221,182,76,202,177,220,195,146,214,198,134,76,24,153,140,
+154,112,100,81,185,160,212,204,172,235,231,61,142,208,235,56,116,245,129,29,155,34,50,125,
+36,198,224,210,65,188,50,217,29,125,183,117,185,30,87,111,114,118,15,27,248,131,144,180,
+113,170,237,166,99,66,86,101,189,200,35,167,126,250,217,71,234,207,191,120,105,157,85,131,
+210,90,222,254,71,157,218,161,70,54,110,20,139,95,96,141,49,7,216,184,248,105,76,97,
+76,226,230,46,240,153,68,241,72,178,192,229,135,95,127,132,229,161,184,203,78,11,88,43,
+52,58,23,102,18,167,13,106,250,228,166,119,222,178,53,145,197,151,38,9,110,162,249,153,
+26,219,192,179,177,152,59,91,36,138,121,100,137,110,128,226,67,221,59,174,83,181,105,90,
+12,9,92,200,78,188,155,140,82,17,145,45,239,137,106,15,82,179,69,201,114,194,56,60,
+179,159,6,19,105,0,34,28,32,183,157,116,7,188,148,155,92,16,202,224,8,164,196,41,
+185,137,80,189,68,202,77,98,53,94,120,222,200,43,167,115,218,85,224,15,45,103,40,45,
+33,43,235,121,221,145,148,88,70,117,238,100,177,203,24,157,48,174,153,243,48,179,55,48,
+82,202,235,170,166,171,180,101,166,228,235,25,217,71,22,138,11,113,165,151,50,92,82,133,
+241,117,178,157,184,100,163,95,243,25,112,97,161,221,110,57,217,131,172,32,51,91,123,3,
+59,59,252,138,78,205,199,29,124,91,27,146,53,187,247,118,118,73,155,24,212,141,116,11,
+187,126,24,38,243,246,93,123,49,132,244,87,72,69,220,114,164,250,215,141,254,46,39,87,
+117,129,178,224,222,171,16,252,247,35,150,46,206,188,83,203,53,146,156,100,67,64,44,211,
+201,205,138,230,100,168,186,235,213,107,21,141,3,120,29,166,113,158,251,119,95,7,213,166,
+65,248,164,104,198,204,203,95,14,140,81,250,48,221,110,12,206,217,221,150,84,133,178,160,
+40,222,200,153,0,71,2,189,49,4,200,220,234,79,77,167,120,26,236,133,175,108,40,115,
+162,184,51,91,139,45,110,107,67,136,201,11,52,242,38,148,31,46,9,177,148,149,219,2,
+87,158,238,60,241,250,111,39,73,126,236,115,181,155,116,233,187,101,109,190,186,209,154,68,
+8,195,117,87,137,65,132,27,9,104,176,216,217,161,225,169,251,210,75,36,119,137,97,186,
+251,168,246,147,132,103,178,197,19,51,189,213,108,119,35,114,148,113,61,227,44,226,167,102,
+180,22,219,179,94,72,202,236,28,47,193,138,88,185,24,90,115,69,179,66,219,173,233,192,
+118,74,104,19,58,118,48,102,102,177,217,36,75,69,110,5,142,109,16,211,94,50,127,13,
+50,92,244,224,183,81,184,181,199,232,134,4,56,173,223,109,150,239,52,156,199,196,173,137,
+96,90,46,126,85,12,137,162,144,56,196,163,1,181,204,92,169,184,162,197,198,117,59,55,
+202,200,139,106,202,151,17,57,251,55,182,38,169,23,255,197,220,145,78,20,36,55,76,4,
+43,64
+};
 
+static rsAsset font(font_packed, 30746, 131072);
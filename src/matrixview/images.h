@@ -22,4187 +22,1579 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  US
  */
 
-#ifndef MATRIX_IMAGES_H
-#define MATRIX_IMAGES_H
-
 /* Image data for 3D images and credits. Each set of 6300 characters represents
- * Z values for each of the 90*70 on-screen characters.
- *
- * Tips for creating a new image:
- *    - Z-values must be in the range 0-255, higher numbers being further back
- *    - In the GIMP, if you set an image to indexed mode, scale it to 90x70
- *    pixels and export to a .h file, the header_data[] array will contain the
- *    Z-values. Setting to grayscale may be required.
- *    - The image should smoothly merge to 0's at the left/right edges, so that
- *    it works with the widescreen additions. In the GIMP, inverting an image
- *    could help with this.
- *    - Most photos/images will translate extremely poorly, because of the low
- *    resolution. The images below were very extensively modified before being
- *    exported, and most images just don't work.
- *
- * To add a new image (without messing up the credits):
- *    - Add the new data just BEFORE the first credit image (search for #C1)
- *    - Increment num_pics in src/matrix.c
- *
- *  If you make something cool, send a patch to <vincent@doublecreations.com>!
+ * Z values for each of the 90*70 on-screen characters; higher numbers are
+ * further back.
  */
-unsigned char pic[]={
-
-/* #1: Neo, Morp, Trin pose (redone by Vince) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,6,11,
-18,22,24,25,24,22,17,9,3,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,3,2,2,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,4,24,52,91,118,154,176,192,195,192,176,150,97,49,11,
-0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
-0,4,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,38,127,200,255,255,
-255,255,255,255,255,254,250,216,172,91,42,30,20,7,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,13,59,156,244,255,254,255,255,255,255,254,253,253,253,253,255,252,
-225,189,146,83,34,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,29,112,199,248,252,255,255,254,
-255,255,254,255,254,254,254,255,254,253,244,236,231,200,130,38,3,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,4,9,8,4,0,0,3,5,5,3,2,2,2,2,2,9,
-25,59,142,234,240,247,255,255,254,255,255,255,255,254,255,255,255,255,254,253,
-249,238,237,242,225,142,31,3,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,17,55,76,70,59,48,33,
-18,13,12,8,4,1,2,6,14,39,100,201,255,253,253,255,255,254,255,255,
-255,255,255,255,255,255,255,254,255,255,255,254,254,254,255,245,109,12,3,0,
-0,0,0,0,0,0,0,2,14,25,19,9,5,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,33,98,143,153,147,158,153,139,111,93,97,104,104,95,69,32,42,56,
-126,239,251,250,250,255,255,255,255,255,255,255,255,255,255,255,255,255,254,255,
-254,252,252,252,252,255,212,23,6,0,0,0,0,0,0,0,6,37,67,88,
-75,54,42,39,39,41,38,21,1,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,52,139,181,179,174,184,207,209,212,
-223,231,239,249,254,249,213,126,68,87,180,252,249,250,251,254,255,255,255,255,
-255,255,255,255,255,255,255,255,255,254,254,252,252,253,253,253,253,79,14,3,
-0,0,0,0,0,3,45,100,105,96,84,76,71,71,75,85,92,79,42,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-66,169,214,206,204,208,220,220,211,191,185,216,224,225,236,241,244,217,140,157,
-223,252,250,251,253,254,255,255,255,255,255,255,255,255,255,255,254,255,255,254,
-253,253,253,252,253,252,252,182,51,9,4,4,3,2,8,47,96,102,87,78,
-69,61,57,54,50,51,61,78,86,45,3,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,4,70,182,232,227,231,235,236,239,212,186,180,
-185,211,222,220,227,242,242,243,227,210,223,247,251,251,253,253,255,254,255,255,
-255,254,255,255,255,255,255,254,254,253,253,254,253,253,253,250,243,243,89,14,
-10,9,8,19,60,103,110,93,80,76,69,62,57,54,53,52,54,55,68,80,
-46,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,98,189,
-237,234,233,238,238,238,228,187,164,191,211,226,235,235,224,238,244,234,220,218,
-215,241,253,252,253,252,254,255,255,255,255,255,255,255,255,254,254,254,253,252,
-253,254,253,254,253,247,239,249,117,26,10,9,26,75,111,110,103,88,81,76,
-66,61,61,55,53,52,54,55,56,60,72,29,0,0,0,0,0,0,0,0,
-0,0,0,0,0,14,73,141,202,240,236,238,243,247,247,249,227,191,182,211,
-231,232,237,242,240,240,241,228,225,222,214,235,251,253,254,253,253,254,254,254,
-254,253,247,243,242,243,247,251,254,254,254,254,253,253,250,245,238,243,170,65,
-31,38,91,127,117,103,97,89,80,74,66,61,58,52,50,50,51,52,54,56,
-59,58,5,0,0,0,0,0,0,0,0,0,0,0,30,118,196,217,234,227,
-228,242,248,249,251,254,228,197,207,225,242,244,242,248,248,242,239,233,228,228,
-226,232,245,249,252,254,254,253,252,252,252,252,246,240,239,242,243,245,245,248,
-250,251,249,249,247,247,240,238,214,101,75,130,154,141,120,99,92,89,77,73,
-65,59,53,48,45,44,44,46,47,52,58,58,38,2,0,0,0,0,0,0,
-0,0,0,18,103,209,232,237,237,219,230,242,243,247,247,242,223,204,215,233,
-243,250,252,253,253,244,245,244,230,237,246,240,242,246,248,251,252,251,249,249,
-250,250,246,243,244,247,247,243,241,239,239,241,243,244,244,245,242,241,231,115,
-131,188,169,144,120,100,92,87,77,72,65,60,52,44,39,38,39,40,41,45,
-53,60,61,30,0,0,0,0,0,0,0,0,4,40,180,228,228,243,233,217,
-227,237,245,251,242,222,218,222,233,244,249,252,254,254,254,247,244,243,235,240,
-250,249,246,248,248,249,249,249,250,247,245,244,242,245,247,248,247,243,242,242,
-239,239,239,240,241,241,241,247,232,148,182,197,170,145,117,101,95,87,78,74,
-66,59,49,38,34,33,34,34,36,39,48,57,62,53,2,0,0,0,0,0,
-0,0,1,69,219,238,234,244,226,217,228,236,251,250,223,194,209,234,244,250,
-254,254,254,254,254,246,233,236,238,241,252,250,247,247,250,247,245,245,247,245,
-242,237,243,250,248,247,250,247,244,245,245,244,242,238,239,235,236,245,235,193,
-208,197,172,148,120,103,98,88,78,75,66,55,44,36,34,31,30,31,31,34,
-41,52,61,69,33,1,0,0,0,0,0,0,16,87,175,235,241,243,227,224,
-234,241,240,203,150,142,192,237,249,252,253,254,254,255,254,243,232,232,242,237,
-213,196,202,222,238,243,240,237,232,226,227,230,240,246,243,246,251,250,248,244,
-243,245,245,238,235,233,234,241,238,220,215,197,175,152,128,108,100,90,79,74,
-61,48,39,33,31,30,29,29,29,31,38,49,55,61,84,19,0,0,0,0,
-0,4,39,91,227,253,250,246,238,234,238,228,175,103,64,73,133,205,245,255,
-255,254,254,253,254,244,236,234,231,181,108,83,96,130,179,224,235,225,197,165,
-162,184,208,228,229,229,238,246,248,244,242,243,244,243,236,228,228,236,239,227,
-213,199,181,158,136,115,102,87,78,70,51,39,33,31,31,31,30,33,35,32,
-43,50,51,51,60,68,4,0,0,0,0,23,42,226,255,255,255,249,243,234,
-239,217,118,35,27,39,69,124,181,221,244,255,255,253,252,242,233,226,184,78,
-27,16,22,43,90,154,203,196,140,90,86,107,134,164,182,190,203,218,231,237,
-242,244,245,248,243,228,221,236,240,228,214,201,188,169,144,124,108,86,73,60,
-43,33,29,30,34,38,44,49,43,35,48,50,51,51,51,68,19,0,0,0,
-2,29,132,255,255,255,255,244,195,154,216,238,163,76,36,22,26,51,94,133,
-157,190,226,249,252,242,233,212,104,20,7,4,8,19,41,81,125,124,80,53,
-56,71,83,100,126,148,162,177,196,216,236,246,247,250,249,240,232,236,236,229,
-221,206,191,175,150,129,113,90,70,49,38,33,29,31,37,42,52,59,51,43,
-49,50,51,51,51,52,47,1,0,0,1,28,241,255,255,255,254,213,129,57,
-146,241,233,189,150,119,102,95,103,109,103,106,142,202,243,244,232,178,38,8,
-6,4,8,19,31,46,59,62,52,48,53,62,69,81,100,120,134,146,163,193,
-231,244,243,246,246,243,242,240,230,230,228,217,198,180,156,132,113,95,76,57,
-49,42,39,40,44,45,50,54,53,48,50,51,51,51,51,51,53,2,0,0,
-0,20,251,255,255,255,244,143,121,28,75,189,255,247,229,204,200,199,188,183,
-178,171,164,193,229,245,233,133,14,6,6,8,13,20,29,36,43,45,45,53,
-61,66,73,84,95,107,115,125,141,174,219,236,235,239,244,240,232,233,232,232,
-229,221,205,184,166,142,121,100,80,71,68,61,57,62,63,58,57,57,55,58,
-63,51,51,51,51,51,51,1,0,0,0,20,247,253,253,252,226,96,148,43,
-46,105,200,241,243,232,224,223,210,197,182,164,152,175,225,246,234,113,11,8,
-10,13,18,25,32,43,49,49,52,62,67,73,84,91,95,103,107,115,131,163,
-202,224,231,238,239,236,234,228,234,237,230,215,201,186,172,153,134,108,78,64,
-70,72,68,72,71,66,69,72,75,83,93,59,51,51,51,51,51,1,0,0,
-0,22,243,253,253,252,227,86,166,71,44,62,114,174,195,199,223,246,225,169,
-117,97,101,130,168,212,232,117,11,11,16,21,26,34,42,55,58,58,68,79,
-82,89,100,101,101,104,105,112,125,154,194,219,232,237,235,232,237,242,211,208,
-224,212,195,184,176,160,141,119,81,60,59,62,62,56,57,67,73,76,79,76,
-79,54,51,51,51,51,50,2,0,0,0,21,244,253,253,252,227,85,166,103,
-47,54,67,100,129,151,167,181,188,192,200,181,132,107,109,145,213,133,13,16,
-24,29,33,46,58,70,77,76,86,95,100,110,116,114,106,102,107,113,122,146,
-183,213,231,235,230,236,247,232,122,116,200,207,190,184,178,169,147,117,83,58,
-48,43,42,41,43,53,61,58,50,43,40,50,51,51,51,51,50,4,0,0,
-0,5,236,253,253,252,227,82,145,131,53,54,59,65,71,83,101,110,122,159,
-197,191,136,95,82,97,188,158,14,16,29,38,44,63,83,90,97,100,99,105,
-118,126,125,118,110,109,112,111,116,138,173,208,224,233,239,246,245,156,95,131,
-196,202,187,180,178,172,149,113,77,60,52,47,39,37,39,42,44,39,34,32,
-35,51,51,51,51,51,50,5,0,0,0,0,167,253,253,253,251,128,129,157,
-93,59,66,69,78,89,116,160,198,206,178,158,147,129,82,82,170,169,17,15,
-30,38,46,66,87,96,102,100,104,116,128,129,122,114,114,113,113,109,113,128,
-152,183,215,232,241,220,169,137,104,104,174,200,183,173,175,167,135,105,71,55,
-54,63,66,47,37,37,39,43,39,40,65,55,51,51,51,52,49,6,0,0,
-0,0,60,253,253,253,251,204,144,155,153,92,80,95,134,184,227,237,222,213,
-217,226,227,224,163,139,149,164,16,12,28,39,44,56,74,87,98,100,102,116,
-125,119,114,114,113,112,113,109,107,109,116,133,175,224,237,211,148,112,101,89,
-143,196,181,166,171,168,135,109,87,78,71,56,67,80,72,63,72,74,74,90,
-98,66,52,51,55,82,49,4,0,0,0,0,20,222,252,253,249,233,234,231,
-220,164,109,121,181,216,215,230,247,250,250,249,244,242,229,106,73,126,34,8,
-23,31,36,45,61,79,98,94,94,109,112,103,105,105,99,99,99,97,93,92,
-96,100,127,198,225,207,148,164,187,126,129,194,180,169,175,178,177,186,192,195,
-182,159,152,152,153,150,156,156,165,168,147,149,174,185,194,157,47,2,0,0,
-0,0,7,154,251,249,237,229,226,215,234,222,149,123,165,205,239,253,253,251,
-250,251,243,238,220,75,66,92,30,7,16,24,29,43,57,72,87,75,77,92,
-102,97,97,93,98,109,111,107,94,80,79,87,108,164,219,164,131,152,170,160,
-140,191,175,157,182,202,197,171,163,184,217,241,246,245,238,208,182,196,233,245,
-236,222,226,226,194,157,36,2,0,0,0,0,0,75,209,234,228,237,240,243,
-238,241,225,191,210,245,252,249,247,248,249,248,239,235,166,74,70,93,42,15,
-20,27,37,55,61,80,93,79,86,102,111,100,99,120,153,172,182,188,172,134,
-103,87,91,128,203,137,91,129,143,142,162,196,176,158,155,199,222,211,221,244,
-240,233,235,247,245,177,115,173,240,234,231,237,244,254,255,182,23,7,0,0,
-0,0,0,13,160,237,233,236,241,240,246,238,209,208,236,243,243,246,246,247,
-247,245,239,181,94,76,105,112,83,90,93,70,57,75,91,112,129,121,136,135,
-125,132,170,200,217,233,243,243,242,230,205,140,78,102,177,128,70,103,133,112,
-183,210,185,146,118,143,206,251,255,252,238,225,227,242,234,137,79,167,236,232,
-225,226,237,248,255,201,17,8,0,0,0,0,0,0,32,181,227,238,240,240,
-243,232,152,115,194,242,239,240,244,242,241,235,179,99,81,91,178,222,215,202,
-193,186,168,143,144,168,164,152,175,184,184,198,224,248,255,252,245,247,249,247,
-243,181,74,95,150,116,91,123,103,97,203,223,191,150,116,93,147,247,252,251,
-242,230,231,236,224,168,122,161,221,234,234,233,243,252,255,170,12,7,0,0,
-0,0,0,0,6,58,145,209,231,234,236,217,156,96,113,173,211,227,229,219,
-206,167,106,95,89,83,120,201,204,211,246,252,246,245,240,226,168,158,197,211,
-227,255,255,255,252,250,250,250,248,247,227,146,82,90,93,86,109,134,93,128,
-221,231,203,165,124,104,127,231,254,252,246,240,244,239,186,91,21,62,182,239,
-241,249,253,248,215,131,10,7,0,0,0,0,0,0,1,5,27,78,158,199,
-195,166,96,48,65,97,128,147,147,131,105,85,89,96,99,94,79,145,208,202,
-230,246,255,254,245,229,182,153,186,236,255,254,253,252,251,251,251,250,249,240,
-183,105,88,87,79,92,112,118,104,175,236,237,218,186,153,135,136,188,243,249,
-247,243,232,180,111,76,41,31,98,180,216,224,220,196,146,129,9,8,0,0,
-0,0,0,0,0,3,6,20,44,76,98,103,65,27,40,70,101,103,78,66,
-66,75,91,103,107,97,78,70,147,199,223,240,247,248,249,233,160,111,154,222,
-249,253,253,252,253,253,253,249,238,190,121,98,94,92,82,94,118,118,131,219,
-245,236,225,204,177,166,157,156,182,210,218,214,179,115,86,65,32,21,45,109,
-137,126,111,120,152,102,4,0,0,0,0,0,0,0,0,1,4,14,37,44,
-50,62,49,30,41,57,93,112,81,62,71,86,101,112,108,97,80,64,57,134,
-201,231,243,248,246,200,97,70,116,183,229,244,249,250,250,247,239,221,180,128,
-111,104,98,93,81,96,138,125,167,243,244,236,227,217,193,173,155,132,129,133,
-145,165,152,109,89,53,24,20,36,92,110,89,91,117,162,42,0,0,0,0,
-0,0,0,0,0,0,2,4,24,60,60,61,51,45,65,98,126,104,65,57,
-71,89,101,106,106,96,82,70,51,39,106,164,203,216,208,141,52,45,91,143,
-183,209,220,219,217,212,194,165,136,131,126,119,111,102,88,95,134,144,193,245,
-242,238,227,220,203,185,159,136,128,123,134,160,130,78,85,72,36,34,47,84,
-134,133,131,148,181,5,0,0,0,0,0,0,0,0,0,0,1,2,9,49,
-66,56,50,71,114,146,135,79,43,46,65,84,94,96,93,86,78,73,65,40,
-33,68,106,119,118,78,30,42,86,124,146,162,171,166,160,163,160,156,153,150,
-143,131,124,115,100,104,137,186,236,246,243,239,229,218,211,198,170,151,149,139,
-130,119,128,151,151,135,105,99,113,111,111,122,146,173,136,0,0,0,0,0,
-0,0,0,0,0,0,0,2,5,27,62,45,30,58,109,116,78,50,44,53,
-65,75,79,81,81,75,74,79,83,77,46,43,42,47,60,43,23,44,85,115,
-134,149,155,149,140,142,153,159,158,159,149,137,133,125,113,128,173,225,245,240,
-243,239,228,216,211,206,189,171,155,127,98,78,107,172,198,204,201,187,160,106,
-70,82,137,178,35,0,0,0,0,0,0,0,0,0,0,0,0,1,4,16,
-49,43,33,47,77,89,80,75,78,92,93,77,68,71,71,71,77,90,112,115,
-60,33,39,51,69,48,20,40,79,106,123,144,163,156,143,138,145,151,157,157,
-149,143,138,127,127,159,207,238,243,235,242,242,228,216,209,207,201,182,155,122,
-96,77,77,97,126,160,186,168,120,76,62,84,138,169,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,3,9,30,51,75,105,122,132,140,144,142,132,
-117,93,77,74,71,76,88,119,134,123,82,30,41,62,89,47,10,39,79,96,
-96,119,166,175,158,149,147,147,150,152,151,148,141,134,150,192,228,244,242,233,
-236,244,232,217,208,206,205,190,165,144,126,99,80,84,98,110,113,110,106,93,
-95,120,153,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
-14,50,97,143,158,159,156,159,152,128,113,97,88,84,81,89,120,149,131,118,
-99,43,33,70,98,43,14,58,98,108,104,116,155,183,178,162,151,146,146,150,
-152,148,147,157,185,218,240,244,241,235,231,242,238,221,208,203,204,199,179,169,
-166,154,147,161,170,167,156,156,166,171,169,163,175,59,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,9,39,70,109,139,147,145,141,126,107,
-95,85,89,95,101,123,157,149,124,117,106,63,27,66,81,43,37,99,148,166,
-173,166,156,165,182,175,158,149,146,151,154,155,165,186,217,236,245,244,240,237,
-231,233,241,231,210,203,204,203,190,180,186,198,205,196,176,168,168,157,161,180,
-182,172,185,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,26,53,67,95,110,111,103,87,74,73,77,93,111,139,164,167,141,125,119,
-110,76,38,53,49,30,44,111,180,205,206,188,162,152,168,180,170,155,149,157,
-166,173,189,216,240,247,247,244,240,237,232,227,235,241,220,208,206,205,198,183,
-176,176,178,169,150,142,144,140,141,146,147,163,160,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,9,33,46,52,53,53,52,52,57,
-72,91,119,151,176,177,159,135,123,121,114,90,56,43,35,28,43,93,170,193,
-185,169,164,167,168,178,179,164,157,167,178,190,213,238,250,250,248,245,242,237,
-233,227,226,238,237,218,206,207,207,190,173,163,164,168,172,174,178,174,167,160,
-157,169,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,7,26,45,52,49,57,73,87,107,134,167,190,187,172,151,130,122,115,
-105,93,66,42,39,35,38,73,141,152,154,153,160,178,192,190,181,170,165,176,
-186,208,236,250,251,248,246,246,244,239,235,232,226,227,237,234,211,205,210,200,
-186,184,184,179,184,193,196,187,172,177,181,172,169,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,6,30,71,97,112,128,143,
-161,178,193,194,181,164,146,130,114,112,141,148,105,53,71,93,100,134,160,164,
-185,197,207,211,216,212,190,175,176,184,198,229,249,252,251,247,245,245,244,240,
-237,235,230,225,230,245,228,207,204,201,193,192,189,180,165,154,153,158,162,174,
-179,178,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,8,50,105,136,156,168,169,174,184,182,172,158,144,127,135,192,
-226,220,183,118,88,88,110,178,208,219,232,235,225,213,205,202,197,187,186,194,
-219,247,253,252,250,246,245,243,241,240,237,234,232,234,239,246,244,228,211,203,
-191,184,173,153,134,128,128,129,141,158,167,198,177,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,24,86,126,139,149,
-140,148,162,167,162,156,138,149,218,228,165,113,103,107,77,47,65,107,148,177,
-189,193,196,193,183,184,195,193,193,207,239,253,251,250,247,244,243,241,239,240,
-237,236,239,246,246,244,245,246,235,216,195,180,170,155,150,157,157,149,154,159,
-189,218,155,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,13,71,117,124,121,109,123,141,150,154,148,165,219,216,122,
-61,41,39,52,50,45,60,94,142,167,179,191,196,189,182,189,200,200,204,228,
-251,253,249,248,246,243,241,239,239,238,237,245,249,250,248,249,244,243,248,242,
-222,200,189,187,184,181,184,190,189,192,228,234,150,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,63,110,119,105,
-89,103,126,138,143,165,224,224,101,49,41,38,37,38,40,36,65,126,187,211,
-215,218,210,195,191,196,198,203,223,247,254,253,248,245,243,240,239,237,237,241,
-247,252,252,251,250,250,247,242,244,251,248,238,229,226,225,225,227,231,226,226,
-244,247,175,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,12,59,102,113,98,76,88,112,125,154,221,218,103,40,40,
-43,41,40,39,43,71,57,82,139,175,186,194,194,187,189,193,197,219,245,253,
-252,250,245,242,240,238,237,236,243,250,252,253,253,252,251,251,249,245,242,245,
-252,252,249,249,249,239,233,241,237,236,245,252,222,63,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,50,92,109,101,
-80,83,92,139,203,167,70,29,33,39,43,42,40,44,111,169,81,39,67,106,
-136,158,165,172,183,194,213,241,253,252,249,244,242,239,236,233,236,242,251,250,
-249,250,250,251,250,247,246,242,239,238,244,252,252,251,246,233,236,245,236,234,
-243,251,251,203,79,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
-0,0,0,0,0,8,44,86,112,111,85,57,114,185,113,40,22,25,32,37,
-37,47,76,132,196,223,138,51,76,122,145,162,175,187,197,214,239,253,253,249,
-245,241,236,233,229,230,242,248,248,244,242,242,241,240,240,241,241,239,238,239,
-241,247,252,252,251,250,249,243,233,230,241,251,252,237,200,19,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,48,88,115,118,
-66,102,177,96,31,24,27,28,31,53,125,162,175,198,220,238,219,97,116,160,
-173,190,205,214,222,232,246,252,250,246,242,237,231,227,228,240,249,247,243,239,
-235,234,234,231,234,234,232,233,233,235,239,243,248,250,245,239,243,239,230,222,
-235,250,251,248,225,137,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,14,48,87,112,92,113,171,119,36,23,24,28,36,83,187,
-201,193,204,216,228,238,241,140,75,148,204,221,226,209,192,214,247,253,246,242,
-236,231,224,222,235,247,245,240,236,232,230,230,232,230,225,228,230,230,233,235,
-239,242,243,246,233,194,194,225,228,221,228,246,251,249,238,214,66,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,72,89,109,132,
-166,125,35,18,20,22,57,142,228,220,195,202,213,222,235,244,253,212,64,45,
-116,184,188,172,167,211,249,246,239,232,225,219,221,234,245,239,231,228,229,228,
-228,228,228,225,225,227,228,228,231,236,237,240,242,239,224,186,178,220,234,221,
-219,241,251,250,248,234,174,17,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,16,95,115,102,140,156,144,47,13,18,19,21,76,144,130,146,
-202,203,218,231,236,242,250,234,127,71,103,145,167,152,165,227,245,235,229,224,
-218,216,230,241,235,225,221,223,224,225,226,227,226,227,225,225,225,227,228,230,
-232,233,235,235,224,190,180,223,243,226,215,229,248,251,249,249,241,190,22,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,123,170,175,159,163,
-85,22,19,20,20,23,22,22,36,125,188,163,201,226,230,243,241,214,139,64,
-95,106,129,131,186,234,229,225,221,217,215,203,199,218,220,220,222,223,224,226,
-227,230,228,228,229,228,226,226,226,227,228,230,230,236,239,204,180,218,246,230,
-214,219,242,248,253,254,254,252,164,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,20,93,167,200,177,156,151,59,18,21,22,23,24,23,26,53,156,
-204,182,208,222,238,234,212,193,101,48,109,102,106,155,213,221,219,214,212,212,
-225,202,170,203,218,221,225,228,231,231,233,237,235,235,232,230,228,224,224,226,
-226,228,229,233,237,208,177,207,247,242,221,215,239,240,254,255,255,254,232,3,
-
-/* #2: Neo Guns (By Alex) */
-0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,9,23,29,29,29,29,29,30,29,28,
-28,27,28,28,29,29,28,27,27,27,27,28,28,28,28,28,28,28,28,28,
-28,28,28,28,28,27,29,28,28,29,30,29,29,28,29,30,30,30,29,10,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
-18,26,28,28,29,31,33,32,31,29,28,28,26,28,28,27,27,27,28,28,
-29,29,28,27,27,28,28,28,28,28,28,26,26,26,28,28,28,27,27,28,
-28,28,28,28,28,29,28,28,25,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,2,8,18,28,34,36,33,30,36,68,86,34,29,
-29,28,27,27,26,27,27,27,28,28,28,28,28,27,27,27,28,27,28,28,
-26,26,26,26,28,26,26,26,26,26,26,26,26,26,28,29,26,26,21,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,10,16,23,30,
-37,46,57,67,59,56,121,169,115,38,28,28,26,26,27,28,28,28,28,28,
-28,28,28,28,28,27,27,27,28,28,26,25,25,25,28,28,25,26,26,25,
-25,28,28,28,28,28,25,26,19,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,7,18,25,28,29,33,75,127,167,185,182,186,167,183,189,152,92,
-40,31,28,28,28,28,28,28,28,28,28,28,28,28,28,26,26,26,28,28,
-26,25,25,26,26,26,26,26,26,28,26,28,28,28,26,28,25,26,18,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,7,9,18,21,27,29,43,110,117,127,179,
-177,186,195,200,202,198,176,200,200,169,83,55,30,28,28,25,25,26,26,26,
-26,26,28,28,28,26,26,26,26,26,26,25,25,25,25,25,25,25,26,28,
-26,25,25,26,25,26,25,26,20,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,19,28,32,
-32,46,60,73,117,161,195,204,206,206,201,206,208,210,210,208,198,206,202,198,
-177,99,42,28,28,25,25,25,25,25,25,25,26,26,26,25,25,25,26,26,
-25,25,25,25,25,25,25,25,25,26,25,25,25,25,24,25,25,26,21,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,23,31,31,50,86,121,174,183,203,207,210,210,203,212,
-208,211,210,208,208,200,200,208,207,196,194,121,61,29,25,25,25,26,25,25,
-25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,26,25,25,26,
-25,25,25,25,25,25,25,25,23,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,31,31,41,97,
-137,174,206,210,211,213,212,211,211,211,212,211,211,210,210,200,194,210,207,191,
-196,132,55,33,24,25,28,24,24,24,24,24,24,24,24,24,24,24,24,24,
-24,25,25,25,25,25,26,25,25,26,25,25,25,24,28,24,25,25,24,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,21,31,33,38,96,186,208,210,212,213,212,212,215,215,215,
-215,215,212,212,212,202,203,210,204,194,152,144,97,73,30,41,28,22,23,24,
-25,24,24,23,23,23,23,23,24,24,24,24,24,25,26,26,26,26,25,25,
-25,24,24,24,26,26,25,25,24,4,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,28,31,38,91,182,
-204,210,210,210,211,212,215,215,215,215,215,215,212,212,212,200,204,212,206,198,
-136,133,99,108,71,45,33,26,24,23,25,24,23,23,23,23,23,23,24,24,
-24,24,24,24,25,25,25,25,25,25,25,24,24,24,25,25,25,26,25,8,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,9,27,30,58,171,206,207,211,211,212,215,211,211,215,215,215,
-215,215,212,212,211,211,212,211,211,194,172,124,137,175,119,90,68,37,25,22,
-23,23,23,23,23,23,23,23,24,24,24,24,24,24,25,25,24,24,25,25,
-25,24,24,23,25,25,25,25,25,14,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,2,20,29,42,101,198,210,
-211,211,212,212,215,215,212,215,215,215,215,215,215,212,211,211,212,213,212,206,
-185,172,169,194,172,174,107,53,31,23,23,23,23,23,23,24,23,23,23,25,
-24,24,24,25,26,26,25,25,25,25,25,25,24,24,24,24,24,24,24,20,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,5,26,29,48,163,207,211,211,212,212,215,215,212,215,215,215,215,
-215,215,215,215,211,211,212,212,213,207,201,194,189,198,206,194,128,67,33,33,
-23,23,23,23,23,24,23,23,23,23,24,24,24,24,25,25,24,24,24,24,
-24,24,23,23,24,24,24,24,24,22,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,19,28,31,89,206,211,211,
-212,212,215,215,213,213,215,213,213,213,213,215,213,213,211,211,210,210,210,207,
-206,201,176,206,210,195,152,112,56,36,23,23,22,22,22,23,23,23,23,23,
-23,24,23,23,24,24,23,24,23,23,23,23,23,23,24,23,24,24,24,24,
-9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,1,25,29,34,143,211,211,212,215,215,215,215,213,213,211,211,212,212,
-213,213,212,212,210,210,207,203,203,206,198,202,194,186,194,194,181,132,98,38,
-28,23,22,21,22,23,23,23,23,24,24,23,23,23,23,23,24,25,23,23,
-23,23,23,23,24,23,23,24,25,24,15,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,11,29,32,38,176,210,212,215,
-215,215,215,215,215,212,207,207,206,206,206,207,210,204,207,206,200,189,170,185,
-191,200,207,204,195,206,201,185,122,89,39,25,21,21,22,23,23,23,23,24,
-23,23,23,23,23,23,24,25,23,23,23,23,23,23,24,23,23,24,24,23,
-19,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,18,28,30,44,198,211,213,215,215,215,215,215,212,207,198,195,187,191,
-192,185,170,159,165,169,168,132,106,139,174,189,203,203,203,204,201,171,149,134,
-89,48,21,21,21,22,23,23,23,23,23,23,23,23,23,23,24,24,23,23,
-23,23,23,23,23,23,23,23,23,23,20,12,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,24,28,29,73,210,211,212,215,
-215,215,215,213,206,198,194,185,174,172,168,159,137,111,91,86,89,49,28,41,
-79,121,167,191,201,207,203,189,179,135,110,76,25,21,21,22,23,23,23,23,
-23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
-21,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,24,26,30,113,210,211,213,215,215,215,215,213,198,189,191,176,169,163,
-159,139,105,70,41,31,34,28,17,18,18,29,62,159,195,201,200,179,181,141,
-76,49,23,21,21,22,23,23,22,22,23,23,23,23,23,23,23,23,23,23,
-23,23,23,23,23,23,23,23,23,23,21,17,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,28,28,31,143,210,211,213,213,
-216,215,213,208,194,183,179,164,164,163,158,133,89,66,40,25,20,19,14,10,
-5,8,17,69,168,187,182,136,174,155,65,44,20,20,21,21,21,21,21,21,
-21,21,21,21,21,22,23,23,23,23,23,23,23,22,23,23,23,23,23,23,
-21,18,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,28,29,35,176,210,211,213,213,216,215,212,206,189,174,168,161,159,157,
-152,140,96,62,44,28,18,17,10,5,3,4,9,15,123,177,181,170,177,144,
-57,33,20,21,21,21,21,21,21,21,21,21,21,21,21,22,23,23,23,23,
-23,23,23,22,23,23,23,23,23,23,21,18,4,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,26,28,45,198,210,211,212,213,
-215,212,207,200,181,165,158,156,154,154,153,145,117,67,42,26,17,15,7,5,
-3,3,8,9,70,169,167,181,144,131,42,21,19,22,21,21,21,21,21,21,
-21,21,21,21,21,22,23,23,23,23,23,23,23,22,23,23,23,23,23,23,
-21,18,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,25,24,66,206,210,211,213,213,212,213,206,194,172,163,163,155,155,154,
-159,150,131,83,47,28,17,14,8,7,4,5,3,7,46,123,141,169,131,84,
-23,21,20,20,21,20,20,20,21,21,21,21,22,21,21,22,23,23,22,22,
-22,23,23,23,23,23,23,23,23,23,21,18,9,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,25,24,83,206,211,212,215,215,
-215,212,206,189,169,161,159,159,159,156,159,155,136,82,59,41,24,20,13,8,
-6,5,4,5,35,99,128,160,114,32,21,19,21,20,21,20,20,20,21,21,
-21,21,22,21,21,22,23,23,22,22,22,23,23,23,23,23,23,23,23,23,
-21,18,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,25,28,108,210,213,212,215,216,215,210,201,185,170,160,160,160,159,160,
-156,150,132,72,41,44,26,23,14,12,5,2,3,5,28,97,130,143,100,28,
-20,20,19,19,20,20,20,20,21,21,21,21,21,21,21,22,22,21,21,21,
-21,22,22,22,22,22,22,22,22,22,20,17,14,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,25,28,131,185,208,213,215,212,
-207,187,168,164,160,160,163,160,159,159,155,145,112,62,32,36,26,18,10,8,
-3,2,3,5,28,101,137,149,59,25,18,19,20,19,21,20,20,20,21,21,
-21,21,21,21,20,21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,
-19,16,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,24,28,149,168,179,208,215,213,191,158,152,152,156,159,163,161,161,160,
-153,139,90,58,28,24,31,20,8,3,2,2,3,5,32,126,116,106,47,21,
-20,18,20,20,22,20,20,20,21,21,21,21,21,21,20,21,22,21,21,21,
-21,20,20,20,20,20,20,20,20,20,18,16,13,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,23,28,164,156,168,186,210,210,
-185,152,154,158,163,171,174,168,168,163,158,134,83,63,35,21,33,23,8,4,
-2,2,5,5,41,135,69,44,25,17,19,18,20,20,20,20,20,20,21,21,
-21,20,21,20,20,21,21,21,20,20,20,20,20,20,20,20,20,20,20,20,
-17,15,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,23,41,161,163,167,185,210,206,172,176,179,203,210,213,213,210,204,194,
-168,131,121,109,46,23,28,22,12,5,2,2,5,7,65,149,42,23,20,18,
-19,19,20,20,20,20,20,20,21,21,21,20,21,21,21,21,21,21,20,20,
-20,20,20,20,20,20,20,20,20,20,17,15,13,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,2,22,54,168,195,196,177,206,196,
-154,163,206,212,213,215,216,212,213,213,203,140,140,147,75,57,36,41,18,10,
-3,2,6,6,101,140,25,20,20,18,18,18,19,19,19,20,20,20,21,21,
-21,20,21,22,23,22,21,21,21,21,21,21,21,21,21,21,20,20,20,20,
-17,15,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,4,23,71,189,203,186,160,202,185,150,159,206,213,215,216,216,216,215,215,
-213,211,195,170,113,64,51,97,49,59,68,75,71,67,131,78,18,21,20,19,
-18,18,19,20,19,22,21,20,21,20,22,24,24,34,53,30,21,21,21,21,
-21,21,21,21,21,21,19,20,22,21,17,16,14,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,5,23,82,189,186,172,152,191,169,
-147,156,200,215,216,218,217,217,216,216,217,218,213,192,169,83,117,177,189,198,
-198,192,174,152,167,90,19,22,20,20,23,30,25,24,23,25,25,24,25,26,
-31,38,58,109,133,63,23,19,19,19,19,20,20,20,20,20,19,20,23,22,
-18,15,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,5,23,60,165,187,169,146,172,159,146,155,175,210,213,217,217,217,217,215,
-219,218,212,207,177,157,181,198,192,211,208,202,191,156,159,121,25,21,20,21,
-39,105,92,89,73,77,64,59,69,84,95,119,160,186,181,136,39,19,19,18,
-19,19,20,19,19,20,19,23,23,23,19,16,13,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,6,22,37,149,179,182,150,152,149,
-146,150,168,189,210,213,216,217,218,217,217,217,210,189,121,89,169,210,210,211,
-208,201,194,152,149,81,20,19,28,66,121,174,179,179,185,174,158,158,165,172,
-182,194,204,202,182,153,50,20,20,20,20,20,20,20,20,21,20,23,26,35,
-25,16,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,5,23,24,119,163,176,155,150,152,149,152,165,169,185,206,215,217,218,217,
-216,213,198,159,81,25,122,200,210,210,201,192,171,137,123,31,19,21,52,175,
-200,198,195,195,200,194,189,194,194,200,203,206,210,210,177,112,44,28,26,28,
-23,23,23,21,22,23,23,28,50,104,74,26,12,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,7,22,21,69,158,168,153,152,156,
-155,158,161,164,168,174,187,200,210,208,206,196,168,145,86,22,61,174,207,207,
-201,189,158,110,35,17,20,29,114,206,213,211,210,206,204,204,206,207,206,207,
-211,210,207,196,176,116,50,107,106,99,59,61,54,44,49,58,66,88,140,177,
-148,52,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,8,21,21,24,144,169,153,147,152,153,159,165,168,168,168,170,169,172,176,
-175,168,155,144,86,18,26,112,165,176,167,132,65,24,13,16,18,47,169,201,
-212,213,212,208,210,210,210,211,211,211,215,212,207,183,159,121,113,179,179,181,
-179,175,163,149,159,168,175,183,201,195,174,87,15,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,13,21,23,26,124,158,149,145,150,
-156,163,171,170,169,168,168,168,164,169,174,168,157,139,91,15,8,20,28,34,
-22,12,6,8,15,19,18,68,185,200,212,216,216,211,216,215,215,213,213,212,
-212,216,211,194,149,164,200,189,189,200,208,200,194,196,196,200,206,208,211,200,
-175,112,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,12,20,23,28,105,150,140,149,155,161,172,175,174,170,169,168,168,168,175,
-177,169,164,144,96,16,14,18,7,5,7,8,5,7,18,19,23,88,176,181,
-203,216,212,210,216,212,211,211,213,212,213,218,208,198,168,200,211,210,208,210,
-211,210,208,208,210,210,211,210,207,200,173,114,25,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,9,18,21,26,90,153,143,147,155,
-163,179,176,174,169,168,169,168,174,183,179,161,159,143,101,16,22,31,12,4,
-6,9,6,10,16,17,30,137,179,183,210,213,211,211,212,212,215,216,215,206,
-182,164,145,111,144,212,217,216,215,215,213,212,213,213,213,212,211,210,206,193,
-167,98,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,10,18,21,24,75,155,146,152,159,168,177,179,169,167,167,169,171,179,186,
-179,181,189,159,110,22,20,44,19,8,10,8,7,21,39,48,64,152,175,191,
-208,212,213,217,216,215,215,212,207,137,55,40,35,36,122,211,215,215,216,215,
-215,215,216,215,213,212,211,210,208,193,138,59,15,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,11,20,23,24,46,139,150,156,161,
-169,176,176,171,167,165,168,172,174,176,181,196,189,169,110,76,88,59,26,12,
-10,8,23,84,136,152,155,167,169,175,194,206,216,217,216,213,213,210,144,49,
-24,21,22,28,111,206,210,213,215,213,215,215,215,212,216,215,212,211,210,188,
-132,43,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,11,21,22,22,40,156,159,165,169,172,174,172,171,164,165,171,171,170,172,
-182,185,172,134,45,30,23,38,23,8,5,14,62,143,159,158,161,163,167,169,
-185,202,212,215,217,215,213,200,71,24,23,23,23,30,143,201,204,210,213,213,
-212,212,212,212,212,207,201,194,185,157,83,25,12,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,11,22,22,25,57,152,163,169,176,
-174,179,175,171,164,169,174,175,179,185,186,181,130,50,18,12,10,16,16,6,
-9,32,107,156,165,164,161,160,165,171,185,200,208,210,203,206,213,200,72,23,
-24,23,23,36,159,206,211,217,216,215,213,213,211,212,211,201,123,68,59,45,
-25,14,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,11,23,28,73,181,176,159,174,179,179,179,176,169,165,169,179,189,192,186,
-185,167,73,45,26,13,8,8,12,8,12,76,144,163,170,174,174,172,176,183,
-192,202,206,204,198,206,213,200,77,23,22,32,72,115,186,210,217,216,215,213,
-213,210,208,210,206,149,39,13,18,19,16,14,11,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,13,31,106,172,207,176,163,176,186,
-181,181,174,169,168,175,189,201,196,195,196,179,128,70,48,23,10,7,10,8,
-37,127,160,172,177,181,186,194,200,204,207,210,208,206,200,210,212,194,71,23,
-24,112,191,202,210,211,213,213,215,208,185,159,149,198,195,82,17,8,15,17,
-15,15,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-4,12,82,132,198,213,172,161,169,187,191,185,176,172,174,185,198,204,208,203,
-195,170,146,144,145,117,40,14,10,14,91,152,163,177,187,185,185,194,201,210,
-215,212,206,206,206,212,213,202,94,22,40,172,200,200,206,213,213,212,186,145,
-110,63,50,164,181,52,17,6,12,16,15,13,7,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,6,19,126,195,216,212,170,168,169,179,
-194,187,172,174,179,187,189,186,189,185,165,97,50,48,59,54,48,26,9,51,
-140,168,174,183,185,182,182,185,189,198,206,213,216,213,211,206,194,194,103,24,
-41,175,196,200,207,215,210,189,116,70,69,44,33,141,171,52,15,5,15,15,
-14,11,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
-10,85,191,213,212,211,179,168,169,177,189,189,176,176,182,189,191,186,186,189,
-185,159,105,59,31,28,21,20,29,105,160,181,191,194,189,183,182,187,191,191,
-194,201,206,204,189,170,88,71,40,19,41,176,206,206,210,215,213,170,89,45,
-60,53,44,152,165,39,8,3,11,14,6,4,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,18,65,193,213,213,213,215,191,169,172,177,
-181,181,182,181,186,194,195,192,189,194,196,185,168,108,34,23,28,44,97,137,
-164,181,194,194,192,189,185,187,194,194,191,191,191,159,97,105,90,26,19,19,
-30,155,210,210,212,213,211,183,109,76,98,90,82,171,149,22,5,5,10,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,23,62,128,
-194,209,213,214,212,217,206,181,177,181,181,177,185,194,194,195,191,185,185,186,
-164,116,98,47,51,106,136,132,131,137,156,175,185,189,191,196,194,191,194,195,
-195,187,149,80,88,153,131,30,20,22,28,135,210,212,210,213,213,206,170,158,
-169,176,152,169,81,12,6,8,4,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,5,37,96,149,192,206,210,212,215,207,205,211,193,185,183,
-181,181,185,200,200,192,185,186,185,177,125,57,30,62,168,196,150,139,143,144,
-163,176,181,183,185,187,189,191,192,200,200,187,139,109,163,179,100,24,19,22,
-25,128,208,210,207,212,208,203,203,204,203,176,110,56,15,9,8,4,0,0,
-0,0,0,0,0,0,0,0,0,0,1,0,0,0,5,44,92,141,184,198,
-205,210,209,209,210,201,204,204,194,189,185,185,189,200,204,201,195,194,191,187,
-154,92,129,194,212,191,146,141,149,157,174,191,191,189,187,189,191,189,191,191,
-192,185,170,170,170,112,34,18,19,20,22,105,206,206,204,206,202,195,194,195,
-191,144,41,14,10,8,8,4,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,3,36,76,125,168,191,205,209,210,211,208,208,205,202,203,201,194,
-187,189,194,202,208,208,206,206,206,211,206,201,216,216,215,179,145,146,155,165,
-181,196,198,198,198,198,196,196,194,189,174,160,147,123,95,49,14,17,19,19,
-20,75,200,206,206,203,201,194,196,198,185,143,42,16,14,9,10,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,1,2,24,57,99,144,174,195,206,
-210,210,211,209,208,206,204,204,205,201,194,191,198,203,206,213,215,217,218,220,
-218,217,218,220,212,169,149,150,153,161,174,191,200,206,206,202,200,200,196,189,
-145,99,68,33,23,31,16,17,19,20,18,42,171,210,208,206,204,202,202,200,
-185,149,53,23,15,10,7,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,1,11,31,71,111,152,180,197,207,210,210,211,211,209,208,208,208,207,207,
-205,199,198,206,212,216,218,220,220,220,219,218,220,220,206,163,152,149,157,160,
-170,185,191,195,194,191,192,194,187,169,143,81,47,41,53,37,17,19,20,20,
-20,22,91,194,206,210,206,203,202,194,176,122,40,21,13,7,7,0,0,0,
-0,0,0,0,0,0,0,0,0,0,3,3,18,40,82,120,158,184,198,208,
-211,211,212,213,213,211,211,214,215,215,216,211,211,217,217,219,220,220,220,218,
-219,219,220,220,194,154,155,152,161,169,181,196,200,198,191,187,185,182,156,107,
-100,84,52,38,36,16,16,19,21,22,19,21,30,131,196,200,194,189,187,181,
-160,77,23,16,12,7,7,3,0,0,0,0,0,0,0,0,0,0,0,0,
-3,4,23,42,85,123,157,186,199,209,213,213,215,216,215,217,217,218,219,218,
-218,219,219,219,220,219,220,219,219,219,220,220,219,217,181,156,164,168,168,179,
-196,210,210,207,204,202,200,194,165,96,48,32,19,12,14,17,18,21,22,23,
-22,23,22,117,198,194,185,185,185,181,169,105,28,18,13,9,7,5,0,0,
-0,0,0,0,0,0,0,0,0,0,3,4,21,44,84,127,158,188,203,210,
-214,215,216,217,218,218,218,218,218,218,219,219,219,219,220,220,220,220,220,219,
-220,221,220,218,194,179,182,183,179,185,198,212,215,213,211,211,210,204,179,111,
-65,46,33,33,65,50,29,20,21,21,21,20,29,168,206,203,198,198,200,191,
-177,124,46,26,17,14,13,7,0,0,0,0,0,0,0,0,0,0,0,0,
-4,4,27,68,125,164,192,203,211,214,215,216,217,217,217,217,218,218,218,219,
-219,219,219,220,220,220,220,220,220,219,220,220,220,220,210,198,195,201,200,196,
-200,210,216,217,218,217,216,215,207,187,152,108,105,131,198,198,174,105,33,19,
-22,21,66,195,210,210,207,200,194,182,161,101,39,19,10,8,9,12,2,0,
-0,0,0,0,0,0,0,0,0,0,4,11,57,95,145,176,196,206,213,214,
-216,216,216,217,217,218,218,218,219,219,219,219,220,220,220,220,220,220,220,219,
-220,220,220,220,217,208,206,212,211,212,211,217,216,218,218,217,219,219,217,210,
-150,110,187,210,211,215,213,206,172,95,44,68,187,213,207,203,200,182,159,144,
-137,84,23,14,13,13,17,20,3,0,0,0,0,0,0,0,0,0,0,0,
-7,29,57,98,136,166,188,201,210,213,215,216,216,217,217,218,218,218,219,219,
-219,220,220,220,220,220,220,220,220,220,219,219,220,220,220,217,217,217,217,217,
-218,220,219,220,219,218,220,220,220,216,176,160,210,217,217,213,215,213,211,210,
-164,189,215,217,212,206,200,187,176,165,165,121,30,19,20,26,31,28,6,0,
-0,0,0,0,0,0,0,0,0,0,8,22,39,74,102,140,162,187,200,209,
-213,215,217,217,218,218,218,219,219,218,220,219,219,220,220,220,220,220,220,220,
-220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,
-219,219,220,218,216,206,204,208,211,212,212,220,220,218,216,211,206,206,198,191,
-185,140,47,26,23,32,23,15,8,0,0,0,0,0,0,0,0,0,0,0,
-10,18,31,62,83,129,146,181,193,208,213,215,217,217,218,218,219,219,219,220,
-220,219,219,219,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,
-220,220,220,220,220,220,220,220,220,220,220,216,219,217,212,211,215,215,215,217,
-220,220,216,219,217,216,216,213,212,208,198,158,109,61,30,58,14,15,13,0,
-0,0,0,0,0,0,0,0,0,0,11,19,33,63,85,129,146,178,191,206,
-211,214,216,217,217,218,218,219,219,219,220,219,219,219,220,220,220,220,220,220,
-220,220,220,220,220,220,220,221,221,220,220,220,220,220,220,220,220,220,222,220,
-220,215,220,210,212,220,220,220,220,220,217,220,219,219,219,217,218,216,216,213,
-198,170,168,111,102,150,26,18,16,0,0,0,0,0,0,0,0,0,0,0,
-12,19,31,58,81,118,142,170,188,202,210,212,215,217,217,218,218,219,218,218,
-219,219,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,
-220,220,220,219,220,220,220,220,220,220,220,212,217,216,219,220,220,220,220,220,
-220,220,220,219,219,218,216,215,215,206,181,130,67,145,194,185,55,18,17,0,
-0,0,0,0,0,0,0,0,0,0,11,18,28,49,75,103,135,159,183,196,
-205,208,212,214,215,216,216,217,217,218,218,219,219,220,220,220,220,220,220,220,
-220,220,220,220,220,220,220,220,220,220,220,220,220,219,216,217,220,220,220,220,
-220,215,220,220,220,220,220,220,220,220,220,220,220,219,219,218,217,215,213,201,
-155,107,130,208,198,202,93,20,17,1,0,0,0,0,0,0,0,0,0,0,
-12,16,26,42,67,94,125,151,173,190,195,204,208,211,213,214,215,216,216,217,
-217,217,218,219,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,
-220,220,219,212,217,220,220,219,220,220,220,220,219,220,220,219,219,220,220,220,
-220,220,220,219,219,219,218,217,216,206,189,202,216,208,203,204,126,21,17,3,
-0,0,0,0,0,0,0,0,0,0,13,14,24,35,55,82,108,137,159,171,
-180,191,196,205,207,212,213,216,217,217,219,216,217,219,220,220,220,220,220,220,
-220,220,220,220,220,220,220,220,220,220,220,220,217,220,220,220,220,217,220,220,
-220,220,220,220,220,220,220,220,220,220,220,220,220,219,219,219,219,216,217,216,
-216,215,215,210,213,208,146,25,19,9,0,0,0,0,0,0,0,0,0,0,
-
-/* #3: Trinity face shot (originally by Alex) */
-4,7,10,15,23,23,23,24,25,25,26,28,28,28,29,30,30,30,32,34,
-34,50,67,38,35,33,35,36,36,36,35,37,40,39,38,38,38,38,36,37,
-37,37,37,38,38,40,39,36,47,65,103,111,85,39,24,23,23,22,23,22,
-22,22,23,23,23,26,28,28,26,31,29,29,29,29,25,25,20,15,8,1,
-1,1,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,32,36,54,52,34,35,35,36,37,37,38,
-37,38,40,40,37,39,38,38,35,36,36,39,46,49,60,101,117,106,73,76,
-106,112,78,35,23,23,25,24,23,23,23,23,23,25,26,26,28,26,25,1,
-1,1,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,25,26,28,28,29,30,30,32,33,34,33,
-44,58,44,33,37,37,38,39,39,39,38,39,40,41,42,40,44,46,45,44,
-40,49,84,134,201,236,250,252,239,180,137,124,88,40,29,26,25,25,26,26,
-26,24,23,24,28,28,28,26,26,1,1,1,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,25,
-26,26,28,29,30,29,30,31,35,45,64,61,38,39,38,38,38,41,41,41,
-39,41,44,44,51,96,134,143,136,98,95,84,99,159,203,203,207,249,250,252,
-246,194,132,72,37,31,28,28,29,29,28,28,28,29,30,30,28,28,28,1,
-1,1,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,28,28,28,28,30,31,31,32,36,44,70,
-89,68,38,39,40,40,41,44,44,45,44,48,61,124,188,205,182,109,116,150,
-185,194,164,192,229,234,198,207,252,252,252,249,234,158,83,49,38,34,35,34,
-35,31,34,31,31,30,30,29,29,1,1,1,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,28,
-28,28,29,31,32,32,32,37,48,81,90,67,42,41,44,42,44,44,44,47,
-52,114,204,188,155,129,146,153,161,195,225,194,190,240,207,209,245,249,249,254,
-252,252,252,245,185,145,103,102,100,108,93,63,46,35,33,30,33,31,30,1,
-1,1,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,28,30,29,29,31,33,32,34,36,48,72,
-83,79,82,84,85,88,87,79,68,74,160,222,222,211,183,190,182,182,221,234,
-240,236,216,177,180,243,241,249,240,250,254,252,254,254,252,236,230,229,219,229,
-190,102,53,37,32,33,33,32,31,1,1,1,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,28,
-30,29,29,31,33,32,34,36,41,63,79,119,155,151,153,151,155,143,153,219,
-244,239,240,240,229,236,243,240,247,252,229,164,160,147,141,166,215,207,195,225,
-254,254,254,254,254,252,252,254,254,252,192,96,47,34,33,32,32,32,32,1,
-1,1,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,29,30,30,30,31,33,34,35,37,41,61,
-79,117,138,138,136,137,153,220,249,244,246,250,250,252,252,254,250,250,254,252,
-174,120,155,150,160,212,243,243,249,243,250,254,254,254,254,254,252,252,254,246,
-185,86,47,35,34,33,33,33,33,1,1,1,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,30,
-30,31,31,32,34,35,36,36,41,60,77,105,121,115,113,150,236,252,247,247,
-252,254,254,254,254,254,254,250,244,226,124,103,149,212,230,237,249,254,254,243,
-207,246,254,254,254,254,254,254,249,229,171,81,45,35,34,33,33,33,33,1,
-1,1,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,30,30,31,32,33,34,35,36,37,39,52,
-68,88,102,93,155,243,252,252,254,254,252,254,254,255,254,254,254,252,249,177,
-98,108,130,203,227,220,249,254,254,249,247,250,254,254,254,254,254,254,246,194,
-149,76,44,35,33,33,33,33,33,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,31,
-30,32,33,33,33,34,35,37,41,53,71,60,64,149,245,252,250,254,254,254,
-254,254,254,254,254,255,255,250,254,196,150,143,201,246,249,243,233,243,252,250,
-252,252,254,254,254,254,254,254,250,220,143,79,44,37,33,33,33,33,33,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,30,31,33,33,33,34,35,36,40,44,60,
-85,52,121,243,254,254,254,254,254,254,254,254,254,254,254,254,254,252,254,204,
-126,158,155,209,252,252,241,233,252,252,254,254,254,254,254,254,254,254,252,249,
-158,74,50,42,35,35,35,34,34,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,30,
-31,33,33,33,34,36,38,38,44,71,89,94,232,249,252,255,254,254,254,254,
-254,254,254,254,254,254,252,252,252,205,118,163,163,219,252,254,252,250,252,252,
-254,254,254,254,254,254,254,254,252,254,219,73,47,42,38,36,37,36,35,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,30,31,32,33,33,34,37,38,40,46,78,
-116,216,252,254,252,255,255,254,254,254,254,254,254,254,254,252,252,240,254,219,
-192,215,226,236,250,254,254,254,254,254,254,254,254,254,254,254,254,254,254,252,
-249,119,42,39,37,34,36,35,35,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,30,
-31,32,34,35,37,38,38,41,44,73,171,249,252,254,252,255,255,254,254,254,
-254,254,254,254,254,254,252,212,246,240,229,243,252,252,252,254,254,254,254,254,
-254,254,254,254,254,254,254,254,254,252,252,175,48,37,36,34,36,35,34,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,29,31,32,34,35,37,38,38,38,46,87,
-232,250,254,252,254,254,254,254,254,254,254,254,255,255,255,254,232,167,198,246,
-254,252,254,252,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
-252,241,106,33,34,34,36,35,32,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,28,
-31,32,33,35,35,36,36,39,47,125,246,254,254,254,254,254,254,254,254,254,
-254,254,254,255,254,245,190,134,196,240,255,255,254,254,254,254,254,254,254,254,
-254,254,254,254,254,254,254,254,254,254,252,250,177,42,33,34,36,35,31,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,28,31,32,33,35,34,35,37,40,52,177,
-254,254,254,255,254,254,254,254,254,254,254,254,254,254,234,158,120,118,171,231,
-255,255,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
-252,252,241,97,39,37,34,33,31,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,29,
-31,33,33,35,34,35,37,39,56,221,254,254,254,254,254,254,254,254,254,254,
-254,254,252,219,143,87,72,89,140,215,252,254,252,254,254,254,254,254,254,254,
-254,254,254,254,254,254,254,254,254,254,254,254,252,207,54,38,35,32,33,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,29,31,33,33,35,35,36,37,40,76,246,
-254,254,254,254,254,254,254,254,254,254,252,254,210,111,60,45,45,49,73,134,
-215,252,254,254,252,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
-254,254,250,244,108,39,35,35,33,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,30,
-31,33,33,35,36,37,38,42,122,254,254,254,254,254,254,254,254,254,254,254,
-252,252,145,49,41,39,37,41,49,73,113,177,237,252,254,255,255,254,254,254,
-254,254,254,254,254,254,254,254,254,254,254,254,252,247,217,58,37,34,33,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,31,32,33,33,36,37,39,40,40,171,254,
-254,255,254,255,252,254,252,240,227,247,252,250,167,52,38,35,36,36,41,50,
-65,96,124,174,209,239,252,252,254,254,254,254,254,254,254,254,254,254,254,254,
-254,254,254,254,252,136,38,34,33,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,33,
-34,35,34,37,36,38,39,42,209,252,254,255,254,254,252,252,247,146,74,219,
-252,252,239,119,50,42,40,38,39,46,54,68,78,92,99,108,159,220,249,252,
-254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,203,41,35,31,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,35,35,35,35,37,38,39,42,53,236,254,
-254,254,254,252,240,249,203,78,41,93,240,249,250,245,182,113,64,45,42,45,
-46,57,70,76,72,80,85,100,188,247,254,254,254,254,254,254,254,254,254,254,
-254,254,254,254,254,246,103,35,30,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,35,
-35,36,36,36,37,39,39,63,247,254,254,254,254,252,185,249,159,57,35,40,
-130,245,252,252,254,249,222,200,162,145,136,128,122,111,104,93,85,95,110,177,
-247,254,254,254,254,254,254,254,254,254,254,254,254,254,255,236,175,41,30,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,33,34,36,36,35,35,39,38,64,249,254,
-254,254,254,245,191,252,178,60,42,38,48,195,254,255,254,250,236,219,210,241,
-252,240,225,207,194,174,160,147,150,188,239,255,254,254,254,254,254,254,254,254,
-254,254,254,254,255,229,130,77,32,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,32,
-35,35,35,37,37,38,38,62,250,254,254,254,254,241,150,243,219,76,47,44,
-45,74,228,240,249,252,236,203,194,216,230,204,194,188,190,186,177,158,155,188,
-245,252,254,254,254,254,254,254,254,254,254,254,252,254,254,236,142,69,31,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,33,35,35,35,37,38,40,39,60,249,252,
-254,254,255,240,155,188,236,104,53,45,45,51,93,198,178,230,245,249,252,252,
-249,229,198,155,113,94,88,92,101,125,185,236,252,252,254,254,254,254,254,254,
-254,244,249,252,254,240,174,44,29,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,33,
-36,35,35,38,41,40,40,55,244,252,254,254,254,241,170,145,215,141,63,50,
-48,48,58,95,179,134,143,191,220,246,252,231,156,111,85,82,79,79,84,94,
-108,134,204,254,254,254,254,254,252,254,250,150,213,252,254,244,141,28,29,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,33,36,37,40,45,49,49,47,55,224,254,
-254,254,254,240,177,134,175,163,76,52,50,52,52,56,78,137,128,108,113,143,
-177,215,229,217,185,155,126,93,93,85,80,90,130,232,254,254,254,252,249,252,
-252,167,210,254,254,221,108,26,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,34,
-35,38,41,46,51,52,52,58,215,254,254,254,254,243,177,143,132,194,95,57,
-52,51,50,53,60,63,76,99,110,114,103,98,106,131,172,200,188,134,85,71,
-68,70,100,190,252,254,254,252,249,249,244,167,240,254,254,194,66,26,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,33,34,38,39,45,51,51,53,60,221,243,
-236,252,252,252,182,147,102,194,129,61,53,52,52,53,53,54,57,60,67,79,
-83,92,128,171,219,215,166,126,100,79,65,60,74,153,244,252,252,220,182,185,
-219,118,207,254,250,191,49,28,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,32,
-31,39,44,47,50,51,53,52,192,243,229,250,252,252,192,156,94,147,205,83,
-60,60,56,57,58,61,66,69,80,99,149,191,227,213,162,124,119,119,106,79,
-71,63,63,132,226,250,252,231,185,127,151,114,198,249,246,190,36,26,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,33,34,38,42,47,49,51,52,55,115,247,
-244,252,252,254,230,167,108,96,204,150,80,70,65,63,68,77,97,121,170,221,
-249,254,229,191,204,228,229,229,234,212,110,71,115,166,203,254,254,252,188,198,
-195,166,196,219,210,192,32,26,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,34,
-34,39,44,48,50,51,52,54,63,227,243,243,252,254,252,225,177,120,125,216,
-134,92,84,73,88,110,175,219,250,254,254,254,252,254,252,254,254,252,249,243,
-229,163,131,70,117,229,252,236,213,194,166,182,227,167,185,167,29,28,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,34,34,39,44,48,48,49,51,54,51,177,
-249,232,254,254,254,250,249,233,213,243,233,156,112,84,98,128,225,252,254,254,
-254,254,254,254,254,254,255,254,254,252,252,140,52,49,74,158,236,207,195,155,
-134,150,180,99,204,119,28,28,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,32,
-34,39,44,47,49,49,51,53,57,134,252,244,254,254,254,252,254,252,252,254,
-252,240,153,92,92,134,213,249,254,254,254,254,254,254,254,254,254,254,252,252,
-249,101,50,48,63,112,180,166,153,113,120,113,110,77,212,65,30,26,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,31,33,37,41,44,47,49,50,53,57,85,
-243,252,254,255,254,254,254,254,254,254,255,254,230,155,124,158,236,254,254,254,
-254,254,254,254,254,254,254,252,249,250,237,76,57,51,56,95,137,131,111,102,
-106,82,83,95,180,31,26,28,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,34,
-34,37,42,45,47,53,53,53,57,62,188,246,254,254,255,254,255,254,254,254,
-255,254,249,234,163,170,249,254,254,255,254,254,254,254,254,254,254,252,247,224,
-174,66,55,52,56,78,122,106,89,117,71,55,56,150,95,25,24,28,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,35,35,40,44,46,48,51,52,52,54,52,
-103,229,250,250,254,254,254,254,254,254,254,254,249,212,243,234,249,252,255,254,
-254,254,254,254,254,252,254,254,240,158,82,63,60,51,55,63,103,87,79,93,
-71,58,77,168,65,25,28,28,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,35,
-35,40,45,48,51,53,53,54,55,54,69,117,207,246,249,255,254,254,254,254,
-254,254,233,110,129,219,249,252,254,254,254,254,254,254,254,252,252,247,155,77,
-66,65,60,52,50,53,80,76,78,87,73,60,150,129,87,35,30,28,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,34,35,40,46,50,52,54,53,55,54,52,
-62,63,115,217,252,255,254,254,254,254,254,254,222,92,54,101,195,249,254,254,
-254,254,254,255,254,254,243,153,78,70,71,66,69,60,52,50,54,58,74,71,
-63,151,211,129,97,42,31,28,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,33,
-34,41,46,51,53,54,51,52,53,52,53,58,83,113,203,246,252,252,254,252,
-250,252,239,180,111,105,108,151,219,249,254,252,252,254,245,207,129,84,72,70,
-74,71,74,64,60,53,50,51,83,97,152,243,246,216,128,54,32,29,29,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,35,35,42,45,51,56,54,49,53,52,52,
-51,58,74,73,99,108,209,249,252,252,254,207,141,83,42,61,81,92,103,136,
-175,196,195,149,116,89,76,72,73,73,76,76,78,67,60,50,51,52,104,219,
-249,254,252,201,140,88,47,29,26,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,36,
-36,44,46,54,57,57,52,51,51,50,53,58,67,68,71,35,51,140,182,207,
-175,161,114,57,29,37,57,74,85,92,86,83,76,74,61,56,60,67,72,79,
-79,79,78,67,56,51,51,49,94,215,252,254,252,240,137,99,58,29,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,36,44,46,49,58,60,60,55,55,53,51,
-54,60,69,69,62,31,37,42,60,73,82,92,94,45,28,33,45,56,87,95,
-85,66,56,50,49,52,57,66,76,83,85,83,79,68,58,54,52,47,76,194,
-249,245,249,252,232,150,44,31,29,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,38,
-44,47,53,61,60,56,54,53,50,50,55,62,67,74,67,26,34,37,41,42,
-47,58,63,42,26,28,41,54,57,77,97,69,52,46,47,54,62,76,84,89,
-90,85,81,70,62,56,52,47,70,164,213,177,188,249,196,77,30,28,29,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,39,45,49,54,62,60,57,51,50,50,52,
-58,63,69,76,69,28,29,42,44,44,42,52,56,33,28,31,42,39,46,57,
-96,72,54,51,48,57,71,80,82,87,94,92,78,69,63,57,50,49,67,140,
-171,106,145,209,73,30,28,29,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,40,
-45,51,54,61,58,53,49,50,50,51,57,64,70,74,70,29,28,41,47,45,
-44,50,52,33,26,34,50,63,101,92,96,54,44,48,51,63,74,84,82,83,
-88,88,79,70,64,58,53,48,70,128,141,86,113,158,41,25,28,26,28,15,
-10,5,1,1,3,2,1,1,0,1,1,1,1,1,3,2,1,1,0,1,
-4,7,10,15,23,23,23,24,25,42,44,51,54,60,57,50,48,50,51,53,
-60,62,67,74,73,30,28,33,48,54,49,48,47,51,49,56,71,108,156,124,
-87,42,36,42,50,63,69,71,76,74,78,76,71,65,62,61,56,51,80,124,
-115,76,61,49,28,28,28,28,28,15,10,5,1,1,3,2,1,1,0,1,
-1,1,1,1,3,2,1,1,0,1,4,7,10,15,23,23,23,24,25,42,
-45,51,56,60,53,51,47,52,55,56,58,62,69,77,77,32,28,25,44,54,
-52,51,38,40,60,92,100,125,115,80,54,42,38,40,48,62,69,73,73,71,
-71,70,67,62,61,64,60,54,103,126,115,53,21,23,26,28,28,28,28,28,
-28,29,30,29,29,29,30,30,29,29,31,33,33,30,25,22,17,13,6,1,
-5,10,15,36,41,50,46,33,36,44,44,49,60,61,53,50,50,52,56,56,
-61,63,71,79,81,36,26,25,33,52,60,46,31,33,39,63,106,111,80,57,
-44,40,42,46,51,60,62,66,63,62,63,63,60,57,58,62,62,73,109,118,
-97,34,25,24,28,28,28,28,28,28,28,29,30,29,29,29,30,31,29,29,
-31,33,33,30,25,22,17,13,6,1,5,10,15,40,52,78,93,44,37,40,
-41,46,55,53,51,48,45,50,54,55,56,61,65,77,80,39,28,29,28,41,
-53,42,31,32,35,44,69,69,55,46,45,42,44,56,60,64,55,55,60,56,
-56,60,60,61,61,68,74,101,114,104,84,37,30,28,28,28,28,28,28,28,
-28,28,28,29,30,29,31,31,29,29,31,33,33,30,25,22,17,13,6,1,
-5,10,15,36,47,63,83,44,37,39,41,47,52,53,50,46,46,48,49,51,
-54,54,54,65,78,56,53,49,39,38,46,44,37,33,34,40,51,51,61,62,
-58,61,62,77,90,77,64,55,60,58,58,56,60,64,68,77,100,108,112,95,
-82,54,40,28,25,25,24,28,28,28,28,28,28,29,30,29,31,31,29,29,
-31,33,33,30,25,22,17,13,6,1,5,10,15,34,44,53,70,46,33,36,
-39,45,49,55,50,46,44,46,44,42,44,40,40,45,60,92,150,137,92,55,
-40,44,44,45,71,93,92,103,117,125,137,149,149,136,106,85,70,64,63,60,
-61,60,61,67,77,106,118,100,103,90,80,53,40,29,26,28,26,28,28,28,
-28,28,28,29,30,29,31,30,28,29,31,33,33,30,25,22,17,13,6,1,
-5,10,15,34,42,52,62,47,32,36,39,44,45,46,44,44,42,38,34,33,
-33,31,31,32,37,63,121,130,94,58,41,44,64,104,140,149,156,177,180,180,
-166,153,136,94,76,71,71,74,71,65,63,60,68,76,102,128,106,102,96,90,
-80,57,36,31,28,28,28,28,28,28,28,29,30,29,29,29,29,29,28,29,
-31,34,34,36,30,25,20,12,5,1,5,10,15,34,44,56,60,50,33,36,
-39,44,44,42,39,36,36,35,33,32,32,30,29,28,28,28,31,44,48,49,
-44,41,57,70,106,119,115,120,110,96,106,108,98,80,70,68,71,73,76,76,
-71,76,77,101,142,122,102,99,96,90,81,62,41,33,30,28,28,28,28,28,
-28,29,30,29,29,29,30,29,28,28,30,33,33,36,30,25,20,12,5,1,
-5,10,15,20,44,56,64,53,31,37,38,40,40,37,35,31,32,33,33,32,
-31,30,28,28,30,28,26,28,26,29,31,33,46,58,79,101,112,110,105,109,
-109,95,84,67,60,66,64,73,76,77,79,86,102,143,140,114,101,93,93,92,
-82,65,51,42,31,29,29,29,28,28,29,29,29,29,29,29,29,28,28,28,
-28,29,30,32,35,28,20,15,10,1,5,10,15,29,34,45,55,52,31,36,
-37,38,39,34,33,30,32,33,33,33,30,30,29,29,29,28,28,26,26,26,
-28,29,36,49,56,79,103,112,110,106,97,80,68,55,48,52,60,68,76,82,
-95,113,149,155,132,112,102,94,92,95,83,70,54,44,37,30,30,31,29,29,
-29,29,29,29,29,29,29,29,28,26,25,26,28,28,36,25,19,12,4,1,
-5,10,15,22,23,26,28,32,30,35,36,37,37,32,31,29,32,33,33,33,
-30,30,29,29,29,28,28,28,28,28,30,29,28,36,42,50,63,62,60,54,
-52,48,44,42,47,55,62,73,85,101,114,164,162,146,128,110,104,100,96,98,
-85,76,62,44,36,34,32,30,29,28,29,29,29,29,29,29,29,29,28,26,
-25,25,25,26,25,22,15,9,5,1,5,10,15,24,24,23,24,28,26,33,
-37,35,33,31,30,29,30,32,33,33,32,31,30,30,29,29,29,29,29,29,
-29,29,28,30,39,42,37,36,38,39,40,38,38,44,50,62,71,88,106,126,
-167,174,156,145,124,108,101,99,98,94,88,82,70,53,36,33,32,29,28,28,
-29,29,29,29,29,29,29,29,28,26,25,25,24,25,23,22,13,9,4,1,
-5,10,15,24,24,23,24,25,28,36,42,38,31,32,31,30,30,32,33,33,
-32,31,30,30,30,30,30,29,29,29,29,29,29,29,31,40,38,40,42,39,
-40,42,51,56,64,76,89,111,143,186,185,166,149,131,115,104,102,93,92,94,
-95,85,72,57,44,34,33,33,28,31,30,30,30,30,30,30,30,30,29,28,
-26,26,24,25,23,21,15,10,5,1,5,10,15,23,24,24,25,28,25,37,
-42,37,33,31,31,31,30,32,33,33,32,31,30,30,31,31,30,29,29,29,
-29,29,29,28,28,33,50,51,50,47,53,64,76,85,89,104,119,163,198,192,
-175,158,140,125,108,103,102,97,98,93,88,79,74,65,49,42,37,33,29,32,
-31,31,31,31,31,31,32,32,30,28,28,26,25,24,23,22,21,15,7,1,
-5,10,15,23,24,23,24,25,26,37,49,34,32,30,31,30,30,30,32,31,
-31,31,31,32,32,32,30,30,30,30,30,30,30,28,28,28,42,77,85,80,
-89,101,108,113,124,145,175,188,188,178,168,146,132,124,113,108,102,93,86,101,
-143,153,130,104,83,68,127,112,103,36,31,32,32,31,31,32,34,33,31,29,
-28,26,25,24,23,22,20,15,9,1,5,10,15,22,24,23,24,26,28,31,
-51,44,34,31,33,31,30,30,31,31,31,31,32,34,33,33,31,31,31,31,
-32,32,32,31,29,29,28,53,88,113,121,127,134,146,155,162,158,167,175,164,
-150,142,132,124,113,108,99,104,171,231,252,216,149,124,103,116,137,160,185,65,
-34,34,33,33,33,33,34,32,31,29,28,28,26,25,24,23,21,15,9,1,
-5,10,15,22,25,25,26,28,28,28,28,44,44,37,34,30,31,32,33,32,
-32,32,32,33,33,33,32,31,31,31,32,32,33,32,30,30,28,38,62,88,
-103,120,134,137,140,128,130,145,150,150,143,143,132,126,114,108,136,221,252,252,
-234,207,178,170,174,131,116,136,180,203,44,33,32,33,33,34,34,32,31,29,
-28,28,26,26,25,24,22,15,9,1,5,10,15,25,32,35,32,30,28,28,
-28,29,45,48,40,35,32,32,32,32,33,33,34,34,32,31,30,31,31,31,
-31,31,33,32,30,29,28,36,58,85,97,101,106,116,118,108,115,125,132,136,
-137,136,132,119,115,145,240,252,227,136,58,45,45,53,94,153,149,103,131,155,
-41,35,34,33,33,34,34,32,31,29,28,28,26,26,25,24,23,15,9,1,
-5,10,15,29,45,65,77,78,65,48,37,34,32,51,51,45,39,35,34,34,
-34,34,33,32,34,32,31,31,31,30,30,30,33,32,30,29,29,31,51,76,
-93,100,103,103,99,87,100,109,118,121,130,127,126,124,153,239,252,196,76,44,
-41,41,40,44,44,46,100,158,109,89,80,32,34,33,33,34,34,32,31,29,
-28,28,26,25,24,24,23,15,9,1,5,10,15,29,44,58,83,104,119,130,
-136,108,74,54,64,58,46,40,37,37,36,37,38,38,36,34,32,33,31,32,
-31,31,31,31,31,29,29,28,47,65,87,98,99,96,85,76,83,102,106,119,
-116,124,122,149,240,249,182,60,40,35,34,36,37,39,44,44,44,63,158,140,
-95,55,36,33,32,33,33,32,31,29,28,28,26,25,24,24,23,22,22,1,
-
-/* #4: Ghosts (originally by Alex) */
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,0,0,3,2,3,3,3,5,3,8,12,12,
-16,17,23,21,17,13,16,20,20,10,4,2,3,1,1,2,2,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,4,4,2,4,16,20,31,39,34,37,41,31,28,28,25,28,26,26,25,
-18,12,5,2,3,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,2,2,2,2,6,8,35,47,23,32,48,32,25,
-24,22,22,22,25,21,19,23,22,24,24,25,23,14,5,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,2,1,0,0,1,1,1,1,1,1,0,0,
-0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,3,2,
-5,12,41,57,29,70,60,22,23,28,24,24,25,21,26,21,19,23,21,22,
-24,31,32,31,16,2,1,2,1,0,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,2,
-3,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,2,2,14,50,48,46,79,55,25,38,33,30,
-26,25,25,21,20,17,12,14,12,16,19,19,22,34,33,18,4,2,2,2,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,2,3,5,3,1,1,2,2,2,1,2,2,
-2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,7,
-60,45,36,82,46,29,57,39,20,24,20,19,17,20,16,14,10,12,12,13,
-13,10,12,14,25,29,16,6,0,2,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,2,2,1,2,2,5,4,6,12,20,30,
-37,28,12,7,19,26,17,14,4,6,2,2,2,2,2,2,1,1,1,2,
-1,1,1,1,1,1,2,3,5,22,42,26,85,52,33,56,25,19,21,18,
-20,21,19,19,12,10,9,9,8,12,9,12,13,12,12,22,28,18,2,3,
-2,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
-2,2,4,3,9,29,53,58,52,49,46,34,33,32,41,53,53,39,35,19,
-5,3,5,3,2,2,1,1,2,2,2,1,1,1,1,2,3,4,7,36,
-23,60,71,33,56,16,25,46,22,17,16,19,18,14,12,12,9,9,9,9,
-7,7,7,12,12,13,19,22,8,3,1,0,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,2,2,2,3,1,12,42,53,54,50,44,41,
-42,38,34,35,39,46,44,36,47,52,36,12,3,4,2,2,1,1,2,2,
-2,1,1,1,1,2,3,6,41,56,62,48,61,44,18,22,15,26,20,17,
-16,15,12,9,8,12,12,9,9,9,9,8,7,12,12,12,12,17,16,5,
-0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,
-2,2,13,33,33,28,21,15,15,16,26,35,35,36,34,34,26,25,20,47,
-49,39,7,6,3,2,2,1,2,2,2,1,1,1,1,2,3,14,74,62,
-36,77,49,35,28,15,12,16,18,17,21,16,12,12,9,12,12,9,9,9,
-8,9,9,12,12,12,8,13,17,12,2,1,2,1,1,1,1,1,1,1,
-1,1,1,1,1,0,1,2,2,3,6,20,37,28,17,15,15,14,13,14,
-14,21,31,22,31,34,37,38,50,44,79,55,44,12,4,5,3,2,2,1,
-2,1,1,1,2,4,2,32,61,37,68,95,38,33,28,15,20,18,17,17,
-15,13,12,12,12,12,12,8,7,9,9,9,9,12,12,12,8,12,14,18,
-14,3,3,1,1,1,1,1,1,1,1,1,1,1,1,1,2,3,4,12,
-30,40,28,15,16,16,13,13,13,12,12,12,22,23,22,28,37,47,42,50,
-35,61,51,46,13,6,3,3,2,1,2,1,1,1,1,4,13,44,29,37,
-95,55,47,40,17,39,26,21,18,18,12,9,9,12,12,12,12,8,7,8,
-7,7,7,9,9,9,9,12,12,13,23,8,1,1,1,1,1,1,1,1,
-1,1,1,1,1,2,3,4,8,36,39,25,19,15,13,12,12,12,12,12,
-12,10,9,20,21,28,30,26,22,28,48,53,53,69,38,9,2,2,2,1,
-2,1,1,1,5,4,23,47,71,55,95,31,54,18,38,32,22,17,16,15,
-14,13,12,12,9,9,9,8,7,8,7,7,7,8,8,8,9,9,12,9,
-19,15,3,1,1,1,1,1,1,1,1,1,0,1,2,3,5,7,33,48,
-28,18,18,14,13,12,12,12,12,12,12,10,8,14,25,28,29,32,44,53,
-39,67,87,76,56,23,6,2,2,2,2,1,2,2,2,7,33,45,70,105,
-103,44,34,23,32,29,26,21,15,15,13,12,9,9,9,8,8,8,8,8,
-8,8,8,8,8,8,9,8,9,10,17,22,4,1,1,1,1,1,1,1,
-1,1,0,0,2,3,3,22,54,32,19,19,17,17,13,12,10,9,12,12,
-12,12,12,13,19,28,22,28,44,47,37,56,63,36,92,63,29,4,3,3,
-3,1,2,2,5,15,34,85,57,127,51,51,24,22,53,64,29,24,29,19,
-12,12,7,9,8,7,7,8,8,8,8,8,8,8,8,8,8,8,7,10,
-14,24,5,1,1,1,1,1,1,1,1,1,0,0,2,3,5,52,47,26,
-22,19,18,17,13,12,9,8,10,10,10,12,12,12,18,28,22,21,34,15,
-64,69,70,48,71,76,50,12,2,3,2,1,2,2,4,15,44,111,65,124,
-35,72,23,42,55,50,25,19,20,12,12,12,8,9,8,7,7,8,8,8,
-8,8,8,8,8,8,8,8,7,10,10,26,6,1,1,1,1,1,1,1,
-1,1,0,1,3,4,14,76,41,28,20,18,20,16,12,9,9,9,9,9,
-9,8,12,12,14,20,29,22,26,28,53,99,83,79,72,89,64,24,2,4,
-1,2,2,2,4,23,60,99,96,106,39,61,23,55,39,16,28,22,15,17,
-14,14,10,10,8,7,7,8,8,8,8,8,8,9,9,9,8,9,8,12,
-7,28,7,1,1,1,1,1,1,1,1,1,1,2,3,3,22,79,34,28,
-21,18,17,15,10,10,10,10,10,9,8,9,12,12,13,19,30,29,30,28,
-30,115,81,80,79,92,74,33,5,3,3,3,2,2,6,54,62,73,106,92,
-90,62,32,30,30,23,28,30,15,12,17,14,12,10,7,7,9,8,8,8,
-8,6,7,7,10,12,9,7,8,12,8,25,12,1,2,2,1,1,1,1,
-1,1,1,2,4,3,36,60,31,24,20,18,15,15,12,12,12,12,12,10,
-9,9,12,13,14,22,29,28,35,57,19,117,89,114,70,104,88,46,7,2,
-3,4,3,2,13,79,82,56,116,86,102,44,28,44,32,38,36,40,22,13,
-15,14,12,12,10,7,12,9,8,9,7,7,9,8,9,9,10,10,12,12,
-8,25,16,0,2,2,1,1,1,1,1,1,1,2,3,3,54,40,25,23,
-23,19,14,14,12,10,10,10,12,12,10,12,13,13,12,14,28,33,45,109,
-46,96,109,109,66,134,115,61,8,2,3,5,5,2,34,73,76,52,137,72,
-74,28,33,99,77,28,21,19,17,14,12,12,10,9,8,12,9,9,8,6,
-6,5,9,12,13,12,12,12,10,12,10,19,13,4,2,2,1,1,1,1,
-1,1,2,2,3,12,67,42,26,25,28,18,13,13,13,10,9,9,13,12,
-12,12,13,14,16,20,33,41,44,82,67,114,132,92,69,108,136,99,31,4,
-3,3,7,4,60,69,109,70,150,61,62,24,28,74,84,62,52,37,68,94,
-97,96,104,108,126,186,190,186,168,143,125,118,128,160,94,24,13,12,49,78,
-82,78,71,40,2,4,2,1,1,1,1,2,2,2,3,81,141,97,60,32,
-39,47,23,15,9,9,9,9,12,13,14,10,14,16,19,23,36,41,44,106,
-95,126,143,126,58,65,112,108,56,6,4,2,5,5,60,44,136,82,141,60,
-42,20,19,25,58,34,35,46,63,70,70,73,92,108,175,249,246,252,247,249,
-249,240,233,236,209,143,28,30,136,190,227,236,232,114,4,3,1,1,1,1,
-1,1,2,2,13,167,240,198,175,63,28,103,171,126,69,32,18,9,5,8,
-12,16,20,20,16,22,37,38,40,113,94,110,180,129,124,102,102,96,64,8,
-4,3,4,10,82,50,124,71,117,44,36,13,12,17,22,34,31,25,19,15,
-16,15,12,8,117,247,247,249,252,252,250,249,246,233,215,229,129,52,116,200,
-252,249,250,98,6,1,1,1,1,1,1,1,1,3,23,198,245,232,198,61,
-92,204,246,246,232,201,186,163,145,102,31,10,12,12,17,18,28,36,38,109,
-92,119,104,122,147,77,109,108,76,7,4,4,3,18,92,63,124,96,95,67,
-57,18,12,34,23,58,40,28,25,22,21,19,14,8,79,200,234,252,252,249,
-252,252,246,231,244,245,126,19,150,249,249,243,236,77,7,2,1,1,1,1,
-1,1,1,3,23,185,196,243,178,76,227,250,252,252,252,254,250,252,252,243,
-183,114,88,51,29,19,26,42,57,120,77,122,84,138,162,73,145,121,89,8,
-4,4,4,40,92,71,112,90,78,76,64,20,18,150,44,35,30,33,29,25,
-24,21,18,15,14,54,121,188,232,245,247,249,250,252,252,179,25,10,106,249,
-250,186,167,31,8,2,2,1,1,1,1,1,2,3,16,117,150,237,87,17,
-161,252,249,250,250,254,254,252,252,250,158,64,93,108,113,98,72,88,102,134,
-63,126,108,177,158,108,178,152,93,9,4,3,3,57,98,81,117,60,89,74,
-70,23,12,109,52,14,28,29,29,26,26,22,18,17,12,6,14,52,124,167,
-188,191,200,207,185,51,10,12,50,232,250,175,74,7,3,2,1,1,1,1,
-1,1,2,3,7,29,170,163,14,12,76,240,252,252,252,254,254,252,244,219,
-76,12,12,10,13,28,38,52,88,111,54,132,108,168,155,118,170,163,100,14,
-3,5,4,62,67,98,118,51,114,66,73,22,7,52,44,16,26,31,33,31,
-28,24,17,12,13,12,12,8,19,47,83,96,86,62,26,8,12,7,16,190,
-217,72,7,4,4,3,2,1,1,1,1,1,1,2,7,18,183,63,10,15,
-16,109,203,236,222,203,170,150,112,60,19,20,18,21,24,28,60,73,86,99,
-61,150,108,175,159,92,146,158,108,17,3,4,9,98,60,115,111,44,95,57,
-54,19,12,34,34,12,26,29,31,32,32,29,20,15,12,10,12,10,9,8,
-12,17,15,8,7,10,12,10,8,58,92,30,8,2,1,1,1,1,1,1,
-1,2,2,2,5,25,81,15,15,12,13,13,28,85,67,40,18,12,8,6,
-9,17,21,22,25,26,62,114,130,136,92,158,131,186,158,120,136,170,119,17,
-5,5,17,121,40,129,105,31,98,48,44,23,18,13,68,30,23,28,28,30,
-31,31,25,18,12,12,10,9,10,10,10,9,8,14,14,10,7,12,8,14,
-33,31,3,2,1,1,1,1,1,1,1,1,1,2,7,14,21,10,9,16,
-13,12,8,8,10,8,7,10,12,13,14,19,24,28,33,36,45,47,175,155,
-58,171,126,186,190,155,142,161,128,18,5,2,24,87,30,99,78,37,131,56,
-44,12,8,21,26,32,35,26,28,23,22,28,26,20,14,12,12,10,10,9,
-6,7,5,10,5,5,10,7,12,6,28,48,8,2,1,1,1,1,1,1,
-1,1,2,3,4,35,41,14,52,39,10,12,13,14,15,15,14,12,12,12,
-16,22,28,26,33,35,44,23,121,106,61,167,112,175,190,150,134,177,171,44,
-5,2,37,68,30,143,61,62,124,55,26,32,19,12,12,39,44,31,25,22,
-21,25,24,18,14,12,10,9,10,9,7,5,7,23,42,80,79,33,12,17,
-41,54,9,2,1,1,1,1,1,1,1,1,2,3,4,68,103,40,119,131,
-41,19,16,15,12,10,12,12,12,15,17,25,28,28,32,37,35,63,76,72,
-92,150,102,172,158,162,118,164,151,37,5,4,45,47,31,152,41,79,101,44,
-25,55,37,134,54,23,54,41,25,23,21,23,19,16,15,12,10,12,9,7,
-6,7,5,26,76,127,158,84,35,31,80,72,3,2,1,1,1,1,1,1,
-1,1,2,4,5,87,209,152,19,23,23,18,14,14,13,12,12,12,16,17,
-20,28,28,32,34,46,41,89,58,105,79,150,100,188,155,167,105,182,167,33,
-5,7,55,36,44,129,55,92,55,57,19,93,20,203,229,190,87,42,29,23,
-15,17,18,17,15,12,12,10,9,8,9,10,9,8,6,8,39,141,88,39,
-116,58,3,2,1,1,1,1,1,1,1,1,2,5,12,114,159,76,19,10,
-12,8,12,12,12,13,14,16,20,18,24,29,28,33,35,50,71,42,28,110,
-81,159,113,194,164,205,110,172,161,38,5,10,65,38,71,152,48,81,66,60,
-20,109,21,195,156,131,126,52,30,23,16,17,17,15,13,13,14,8,12,12,
-10,10,10,10,12,9,20,73,76,65,167,46,6,1,1,1,1,1,1,1,
-1,2,2,5,18,132,86,13,12,10,9,8,10,10,10,13,16,18,19,16,
-22,28,28,30,37,72,47,21,95,215,89,129,102,163,163,229,110,145,159,33,
-3,14,87,31,52,104,29,93,61,60,29,128,28,158,58,41,141,67,31,30,
-16,14,15,12,12,13,14,12,13,9,10,6,7,8,7,8,15,16,34,108,
-168,26,5,2,1,2,1,1,1,1,1,2,2,3,31,138,171,119,82,36,
-10,7,12,12,12,12,15,17,18,18,21,23,24,34,49,85,132,203,243,183,
-65,127,93,150,166,232,111,124,167,41,3,29,81,20,48,108,23,120,56,69,
-17,110,20,108,50,37,122,110,34,28,19,16,17,14,12,13,15,13,12,9,
-12,8,4,8,14,22,9,13,18,152,132,22,3,2,1,2,1,1,1,1,
-1,2,2,2,42,156,170,190,195,170,111,70,30,12,10,12,14,16,17,18,
-20,24,28,34,57,110,143,152,177,177,99,136,86,166,170,231,112,119,156,51,
-6,35,78,13,50,95,23,145,39,76,20,150,29,108,60,28,100,147,52,31,
-20,16,18,14,13,15,21,18,13,12,23,63,104,143,185,185,151,162,85,155,
-145,30,4,2,1,2,1,1,1,1,1,2,2,3,44,177,150,94,54,46,
-74,95,60,15,13,16,18,16,14,16,18,25,31,38,65,143,115,73,143,188,
-77,143,114,190,151,234,120,108,127,29,6,31,58,16,68,77,25,129,35,76,
-32,205,30,111,73,29,66,175,102,32,23,20,20,16,14,17,28,28,16,14,
-15,60,101,110,131,175,207,221,106,164,143,15,5,2,1,2,1,1,1,1,
-1,2,2,4,44,201,167,71,50,19,9,7,16,16,15,19,19,18,17,17,
-23,25,25,35,106,167,79,63,166,203,74,143,131,183,129,229,117,96,143,26,
-7,64,57,24,82,55,34,85,37,64,37,203,30,128,80,30,38,131,175,86,
-32,22,20,18,14,14,24,28,20,17,19,18,18,20,46,90,104,141,86,203,
-129,26,12,2,1,2,1,1,1,1,1,3,4,4,77,200,186,74,36,29,
-21,15,17,12,17,16,18,19,16,17,21,28,29,57,180,114,39,72,191,213,
-108,131,126,163,142,210,99,102,188,42,10,89,51,35,76,44,60,108,36,48,
-73,203,28,141,84,40,29,74,178,175,86,32,24,21,14,10,17,20,17,14,
-17,18,24,32,44,63,89,128,92,216,111,23,13,2,1,2,1,1,1,2,
-3,3,5,9,111,190,195,70,21,16,22,17,13,16,16,15,17,20,20,25,
-28,34,53,150,192,52,38,88,207,217,108,134,79,143,177,210,117,63,180,50,
-22,70,34,51,54,21,70,80,40,56,81,190,24,132,92,45,37,52,127,188,
-171,98,45,25,13,9,14,18,18,15,17,19,18,19,18,26,60,128,81,210,
-122,17,18,1,2,2,1,1,1,3,3,4,7,16,131,186,203,44,23,12,
-9,9,12,13,19,18,18,22,29,37,45,80,145,219,108,32,53,117,209,231,
-117,128,77,151,170,185,120,51,150,46,39,64,25,60,53,16,63,63,44,52,
-83,177,31,153,87,53,38,40,85,150,178,179,128,65,26,20,12,16,18,13,
-12,12,10,5,12,23,50,168,49,190,170,26,20,4,2,1,1,1,1,3,
-3,4,6,32,85,158,219,64,29,21,12,15,15,17,25,26,32,40,57,71,
-108,150,171,134,46,35,60,142,210,232,129,130,109,175,177,151,143,56,171,47,
-30,60,19,52,23,23,60,60,53,46,83,150,32,160,87,52,44,40,55,112,
-150,163,170,155,85,33,23,25,21,13,10,8,7,12,18,16,65,211,38,136,
-175,23,22,5,2,1,1,1,1,2,3,3,10,50,86,163,219,143,50,42,
-24,21,26,34,30,30,34,39,40,53,60,66,92,78,35,31,66,156,209,236,
-134,111,92,170,151,108,164,64,182,79,36,60,34,60,13,31,74,45,39,40,
-94,126,33,198,115,50,45,42,42,73,118,146,150,168,167,113,60,39,28,16,
-12,12,12,12,14,15,138,209,34,82,103,14,25,6,3,1,1,1,1,1,
-3,3,28,60,94,151,175,225,196,138,99,105,119,108,80,82,88,100,94,73,
-83,99,87,54,30,35,78,164,200,234,122,83,68,151,162,108,190,51,142,98,
-36,44,41,73,17,32,92,41,67,48,116,141,35,153,136,60,44,36,34,44,
-71,100,113,141,170,177,150,105,62,34,19,20,22,25,28,49,211,183,33,56,
-76,8,23,4,4,1,1,1,1,2,3,4,38,53,97,167,159,210,252,247,
-240,243,244,240,234,231,222,143,88,49,54,61,50,39,32,36,87,166,198,234,
-115,76,78,116,190,102,182,66,112,67,61,29,44,57,12,20,76,34,102,52,
-145,112,50,95,82,66,50,33,32,32,39,48,45,58,103,170,195,179,150,109,
-71,58,55,60,80,164,241,146,32,65,81,6,28,12,4,3,1,1,1,4,
-3,9,45,57,89,143,120,182,252,252,252,249,250,252,252,230,190,73,26,23,
-33,39,44,40,33,44,99,172,201,185,113,64,57,78,207,132,168,68,150,62,
-87,23,44,51,15,15,50,24,79,36,151,71,55,124,45,40,51,42,31,36,
-44,41,31,28,38,98,182,229,233,212,192,177,156,150,190,236,244,159,38,72,
-54,5,32,23,2,2,1,1,1,3,6,19,44,70,62,121,71,138,249,246,
-252,252,247,236,198,92,66,77,48,39,48,50,47,37,40,60,108,175,100,159,
-151,69,54,60,183,150,150,54,100,52,64,13,50,48,17,16,76,26,71,28,
-152,78,94,155,81,32,30,35,30,33,38,46,40,29,22,39,112,216,252,250,
-252,249,228,172,201,198,240,155,23,45,50,9,24,24,7,1,2,1,2,5,
-16,26,32,98,55,145,76,124,240,236,247,243,220,153,80,49,36,39,48,50,
-48,48,45,42,48,67,106,74,97,210,166,74,70,28,150,143,143,76,63,31,
-54,12,61,51,12,12,39,22,104,30,161,66,128,172,120,69,35,20,24,28,
-38,46,41,33,26,21,95,209,237,243,244,236,198,170,188,161,229,158,17,21,
-26,6,17,14,5,2,2,1,2,17,41,41,41,112,45,128,64,110,143,166,
-209,207,146,73,44,40,53,44,40,38,53,47,49,48,61,65,41,51,110,185,
-164,66,72,36,160,137,124,108,35,76,76,10,97,54,14,10,28,19,104,40,
-175,53,150,118,116,108,94,80,47,29,37,44,48,48,41,72,143,127,151,180,
-195,191,163,164,177,114,180,130,14,25,24,12,17,15,6,6,2,1,2,1,
-31,60,31,101,33,100,62,64,65,85,136,146,92,53,50,50,47,48,48,40,
-40,62,56,50,50,55,73,85,116,207,167,66,78,41,151,146,128,106,32,101,
-108,17,87,40,17,17,44,16,92,51,153,35,198,134,53,60,69,79,89,70,
-49,37,42,44,50,87,70,52,95,120,134,131,108,164,151,68,141,111,13,28,
-28,15,12,16,12,20,12,5,4,1,31,60,15,60,21,110,44,39,63,32,
-61,93,76,60,54,60,55,45,48,40,46,40,46,54,50,73,78,92,142,228,
-160,53,100,41,175,141,143,106,34,131,96,26,70,25,26,20,48,16,68,57,
-118,25,201,209,87,35,35,28,32,44,47,36,34,42,70,58,32,61,62,76,
-78,76,70,166,92,29,84,96,26,31,22,14,7,12,17,13,20,28,20,1,
-36,54,24,53,28,128,33,38,58,31,39,68,66,65,50,48,44,50,48,37,
-22,10,13,47,54,67,87,122,175,236,175,60,115,58,166,145,143,81,51,153,
-76,34,67,28,28,16,28,26,96,60,101,18,159,236,188,99,64,47,37,30,
-34,40,35,19,39,83,60,30,35,35,38,44,61,160,53,24,44,117,28,32,
-18,5,12,13,8,23,13,15,25,1,57,36,38,41,34,108,20,25,38,34,
-21,74,53,67,58,48,49,44,44,19,14,16,14,22,53,85,128,159,177,227,
-203,51,79,81,117,136,101,29,76,143,55,34,61,26,30,22,26,39,114,39,
-58,44,210,201,211,171,132,95,57,49,38,32,13,7,9,13,50,47,28,35,
-35,41,74,158,26,18,38,143,28,34,25,5,12,13,9,30,20,20,14,1,
-78,15,32,25,44,82,13,33,23,47,12,65,64,55,63,58,45,84,110,15,
-17,12,17,17,104,108,151,170,180,228,194,85,95,108,85,65,38,20,85,136,
-32,37,51,16,44,26,22,65,119,25,30,47,229,191,161,159,155,122,82,58,
-50,21,7,8,5,6,6,44,32,34,41,40,99,103,13,14,23,99,21,28,
-30,8,14,15,9,22,52,15,19,1,52,17,44,22,52,73,17,47,19,42,
-13,34,70,50,69,62,52,196,195,54,14,14,14,36,194,124,160,175,182,201,
-170,119,92,68,39,28,29,37,120,136,14,39,41,14,30,31,26,71,109,29,
-28,53,209,225,136,130,120,113,87,68,81,24,13,12,4,12,10,60,89,30,
-44,47,128,37,12,9,19,74,22,23,25,16,22,80,13,15,49,44,14,1,
-33,29,31,44,37,47,21,37,19,35,24,18,71,57,64,50,159,229,228,114,
-20,13,23,103,234,138,158,178,145,127,111,82,54,36,16,22,25,72,150,77,
-10,58,44,23,30,34,18,69,63,28,21,60,163,175,172,116,113,110,102,92,
-136,37,12,4,6,8,15,85,190,37,34,85,116,19,12,8,18,53,22,17,
-16,12,16,137,47,9,14,69,41,1,21,62,31,48,16,31,25,26,25,25,
-29,9,50,76,50,132,203,109,161,186,31,20,29,171,228,172,158,145,108,77,
-61,39,25,17,15,21,23,122,108,32,17,62,25,50,44,38,13,50,28,26,
-13,40,124,104,158,156,125,116,112,101,226,100,7,12,7,8,14,155,245,83,
-38,125,53,18,8,7,18,36,20,19,21,5,8,41,130,19,12,28,111,1,
-17,46,38,50,20,29,23,20,20,18,35,18,24,61,76,210,94,87,128,121,
-62,21,76,170,166,150,124,93,63,44,38,29,19,15,8,28,45,172,46,34,
-24,72,13,52,39,29,10,69,19,25,10,35,96,96,88,164,134,132,116,114,
-233,195,26,9,8,12,41,183,229,136,66,108,25,21,12,12,22,38,16,17,
-30,9,9,8,85,21,20,15,35,1,6,12,52,47,25,22,17,19,24,18,
-28,44,12,51,163,131,51,121,113,24,90,81,153,155,128,106,81,64,49,39,
-28,22,15,12,15,21,76,132,23,49,81,86,14,53,31,36,9,64,25,19,
-14,40,64,96,79,118,162,112,122,120,236,227,51,66,30,15,82,131,180,195,
-119,71,24,28,25,12,18,41,26,10,22,8,9,6,21,22,34,8,19,1,
-5,12,60,28,38,16,12,19,26,19,23,41,28,35,126,55,67,97,35,71,
-105,166,128,112,86,70,63,60,54,33,20,17,10,5,19,12,92,72,28,60,
-117,70,28,92,12,26,9,52,18,40,13,51,35,76,68,76,150,156,104,142,
-227,175,19,20,8,6,38,93,121,225,147,28,17,21,15,49,195,207,40,19,
-29,13,12,12,7,18,53,19,19,1,4,12,51,12,30,15,12,22,29,26,
-30,28,40,14,24,60,72,46,74,158,68,114,85,77,61,54,58,66,85,28,
-14,13,6,5,26,22,90,28,23,60,136,60,76,81,9,29,12,52,16,29,
-14,40,34,62,62,63,72,166,159,143,102,76,17,4,5,2,10,57,86,183,
-101,17,16,15,18,20,143,231,76,12,34,17,7,13,16,26,42,47,13,1,
-5,11,55,21,34,16,14,15,12,24,21,20,34,20,13,77,67,35,124,108,
-26,78,70,52,49,44,58,94,106,14,12,8,3,9,24,44,87,12,20,60,
-128,47,77,55,16,40,17,76,15,40,17,32,45,50,62,56,62,85,145,44,
-8,12,15,3,8,5,6,35,110,145,44,18,16,17,13,19,23,122,82,21,
-46,9,6,21,16,31,18,76,17,1,6,10,37,30,32,33,143,159,122,31,
-16,15,19,30,9,44,61,50,150,97,20,52,60,38,39,35,48,108,87,10,
-10,5,3,15,18,97,35,12,21,45,82,21,70,30,31,33,19,72,19,42,
-15,31,83,36,64,56,70,78,60,33,25,15,9,13,7,5,5,26,143,90,
-23,20,14,21,28,19,10,39,65,45,61,12,8,23,12,20,10,71,52,1,
-3,12,14,21,30,82,175,137,188,38,12,12,12,28,13,12,55,58,158,84,
-15,28,48,33,32,37,52,112,63,10,6,1,5,16,31,84,13,13,19,28,
-46,15,53,19,56,29,23,60,15,28,44,36,92,58,57,61,68,100,63,35,
-34,15,20,37,37,12,7,30,136,38,20,28,30,36,19,10,46,182,105,26,
-53,13,12,19,20,12,8,56,162,1,6,12,16,23,26,84,53,10,30,21,
-23,26,23,22,29,10,41,70,155,69,13,15,42,28,31,39,61,94,44,10,
-5,2,12,16,44,37,13,10,13,20,22,17,44,9,72,28,37,54,28,50,
-129,95,78,98,46,73,81,120,51,25,23,7,12,28,54,30,6,28,83,22,
-32,48,34,19,15,92,201,236,78,16,32,13,12,23,33,5,12,17,45,1,
-5,10,15,20,15,74,38,22,37,13,34,50,39,24,25,16,16,92,145,50,
-13,8,28,30,36,42,80,61,37,12,4,5,12,17,44,15,12,14,15,15,
-22,14,71,16,36,15,51,50,32,52,36,48,105,108,64,66,90,124,41,21,
-15,7,14,28,17,15,5,23,54,41,41,44,17,31,153,212,143,185,81,12,
-35,14,12,17,30,8,13,12,7,3,6,11,15,20,19,65,39,16,156,155,
-50,30,58,61,39,29,16,97,115,38,19,5,14,37,38,44,85,33,46,17,
-5,5,12,22,37,5,7,12,12,16,20,23,146,33,35,15,60,36,23,30,
-105,82,37,89,98,60,92,111,26,14,7,7,20,35,7,14,12,31,64,47,
-28,18,70,201,200,70,26,110,65,14,44,14,12,14,29,7,9,13,12,1,
-5,10,15,20,25,65,40,12,119,240,227,150,60,46,76,65,25,95,84,37,
-23,6,9,31,35,54,68,20,53,15,5,8,18,52,21,8,8,15,14,29,
-19,37,158,24,44,15,50,29,26,39,143,229,117,42,84,73,93,92,14,14,
-8,5,13,32,9,10,13,44,49,28,33,134,220,183,60,13,14,81,74,9,
-33,13,28,29,24,12,14,9,9,1,5,10,15,20,22,55,29,12,22,143,
-220,241,228,127,54,95,64,98,56,35,28,9,5,28,38,69,53,19,52,14,
-3,7,29,67,10,6,12,15,21,30,21,48,77,12,46,13,33,22,21,30,
-155,247,243,158,39,76,99,69,12,12,8,4,2,6,7,7,29,61,21,66,
-166,185,137,60,8,9,15,72,66,10,30,24,65,44,25,21,16,8,8,0,
-
-/* #5: Morp w/ submachine gun (originally by Alex) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,3,3,113,233,167,226,17,92,160,5,3,4,3,3,2,0,
-5,1,7,160,120,13,14,17,18,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,159,254,249,207,
-182,161,203,167,128,9,3,2,4,4,3,8,151,254,158,10,46,58,18,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,0,0,3,1,178,196,241,243,243,224,243,252,203,9,6,2,5,4,
-6,150,254,185,102,6,136,227,21,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,207,244,244,241,
-185,211,249,249,166,1,5,3,3,10,163,252,200,200,106,18,14,51,25,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,1,1,1,1,241,249,254,240,222,200,252,252,146,4,4,3,28,178,
-252,200,190,228,113,14,12,15,24,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,1,2,0,15,254,252,245,243,
-207,192,249,252,115,2,3,53,207,254,191,185,215,222,117,125,128,124,108,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
-2,106,232,145,100,73,254,250,249,130,183,200,252,252,87,12,117,241,254,191,
-170,203,215,232,128,19,24,42,56,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,1,4,136,239,120,212,122,252,249,247,79,
-60,71,195,233,112,188,252,244,177,171,192,211,236,150,15,62,67,71,28,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,
-3,156,245,103,215,120,252,250,250,252,195,185,155,177,227,252,227,159,175,180,
-203,236,155,17,18,22,25,15,6,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,1,7,170,234,143,236,158,252,252,254,231,
-145,240,222,252,246,178,146,177,180,196,228,146,14,19,22,15,14,1,2,0,
-0,0,0,0,0,0,2,3,5,4,4,4,3,5,4,5,4,3,4,3,
-2,2,2,5,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,
-14,212,232,217,228,175,254,254,246,240,166,249,244,194,134,163,156,177,188,227,
-115,7,17,18,18,9,3,1,0,0,0,0,0,0,0,0,1,1,1,2,
-3,4,19,41,62,71,72,68,57,40,23,9,7,3,3,3,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,3,14,200,231,207,195,203,252,254,236,229,
-174,240,158,143,153,170,163,188,219,92,12,17,28,28,4,2,1,0,0,0,
-0,0,0,0,0,0,2,1,4,4,25,73,101,110,105,102,100,102,102,98,
-94,83,52,14,2,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,
-4,114,247,194,203,227,254,254,232,229,145,233,145,150,155,162,191,203,50,15,
-10,15,9,3,8,1,0,0,0,0,0,0,0,0,0,0,4,4,19,76,
-113,110,108,97,96,97,92,86,83,93,103,109,105,103,64,17,4,3,2,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,3,12,153,234,188,221,229,254,254,201,231,
-147,227,134,142,155,203,147,18,16,10,7,3,2,2,1,1,0,0,0,0,
-0,0,1,1,3,3,5,44,101,121,108,100,93,92,85,78,76,74,76,77,
-85,95,106,112,118,110,51,4,3,5,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,2,3,2,4,
-33,207,252,215,229,236,255,254,180,229,149,222,131,182,232,231,31,12,14,5,
-1,3,0,0,0,0,0,0,0,0,0,0,1,1,1,12,69,116,125,116,
-102,92,80,74,70,70,66,66,69,70,76,79,84,102,111,119,121,54,5,3,
-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,2,1,4,4,2,49,217,254,239,229,234,252,252,225,170,
-166,232,240,254,254,220,7,5,2,2,1,1,0,0,0,0,0,0,0,0,
-0,0,4,3,14,86,122,127,121,108,95,85,76,61,53,47,50,48,52,57,
-64,69,76,83,96,112,120,127,57,3,2,1,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,5,2,4,3,
-68,231,212,240,232,237,250,252,240,246,247,254,249,252,254,130,7,5,2,1,
-0,1,0,0,0,0,0,0,0,0,0,0,4,5,76,136,130,119,115,108,
-90,74,68,54,41,32,29,34,44,47,55,62,68,81,89,97,118,120,128,32,
-3,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,3,58,136,90,113,92,246,249,239,231,244,250,243,143,167,
-177,207,254,252,254,207,18,6,1,1,0,0,0,0,0,0,0,0,0,0,
-1,3,2,54,127,129,132,119,122,100,81,60,48,37,28,25,29,29,33,36,
-44,55,60,72,83,95,111,124,132,109,2,2,4,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,7,162,178,192,217,
-166,245,244,240,237,247,252,222,215,142,194,246,252,241,243,219,55,4,1,1,
-2,0,0,0,0,0,0,0,0,0,0,2,12,113,141,137,134,112,113,95,
-73,50,42,31,28,28,28,29,33,32,33,38,46,56,67,87,94,111,130,159,
-24,2,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,2,7,207,147,151,213,145,243,252,229,236,252,252,236,229,209,
-183,227,249,229,236,233,63,7,2,1,1,1,0,0,0,0,0,0,0,0,
-0,0,42,149,146,145,136,113,108,90,76,55,34,35,29,29,28,26,32,34,
-33,36,41,54,65,83,90,108,131,163,89,4,2,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,5,183,146,167,252,
-236,175,247,203,234,252,254,236,219,217,185,126,217,252,167,205,121,46,7,3,
-1,3,0,0,0,0,0,0,0,0,0,0,93,155,151,146,136,118,102,84,
-77,60,36,32,28,25,29,28,34,37,36,38,41,54,61,81,96,114,141,168,
-142,2,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,3,16,194,190,158,229,229,182,136,201,249,254,250,237,227,234,
-172,175,131,234,211,243,137,49,15,2,2,3,0,0,0,0,0,0,0,1,
-3,6,130,170,166,146,150,124,101,84,74,62,44,37,37,25,26,29,34,34,
-37,44,51,56,65,78,95,120,141,164,170,8,5,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,14,88,155,175,190,
-209,200,220,207,254,252,229,245,237,226,170,233,175,194,204,233,121,71,32,2,
-3,3,0,0,0,0,0,0,0,1,1,12,146,170,177,162,147,126,111,92,
-76,66,56,47,42,35,40,40,44,44,46,44,52,57,60,76,95,127,155,146,
-174,16,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,3,9,142,207,207,219,194,207,246,244,254,254,221,240,240,215,
-178,249,247,185,183,192,108,81,63,2,2,2,0,0,0,0,0,0,0,1,
-1,15,150,149,182,170,162,143,116,100,81,63,47,48,40,41,37,46,45,44,
-42,48,46,51,57,76,94,117,156,158,155,22,3,2,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,7,12,140,225,212,241,
-198,190,239,249,252,255,217,240,236,212,191,236,252,227,132,147,145,76,88,4,
-1,2,0,0,0,0,0,0,0,1,1,13,136,124,185,178,161,150,127,103,
-80,71,56,36,30,34,33,36,31,34,42,48,42,41,69,101,98,97,146,152,
-143,28,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,4,18,205,226,255,249,192,185,249,252,252,254,213,240,229,200,
-211,241,249,240,34,23,153,82,94,7,2,4,0,0,0,0,0,0,0,0,
-0,0,112,116,185,185,166,136,108,80,69,74,73,39,42,34,54,82,67,79,
-92,97,137,182,166,122,143,164,147,147,146,35,2,3,2,2,2,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,23,211,236,247,234,
-179,175,240,244,250,255,211,236,222,190,220,243,236,241,56,38,146,62,82,9,
-5,3,0,0,0,0,0,0,0,0,0,0,120,124,186,182,156,131,125,100,
-101,79,97,92,104,71,78,125,116,179,162,188,207,175,53,48,73,109,175,138,
-142,50,16,28,3,3,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,4,45,204,237,252,240,207,194,239,243,245,254,213,237,222,182,
-236,243,233,227,115,119,188,42,69,16,1,3,0,0,0,0,0,0,0,0,
-0,0,104,130,180,167,170,188,161,156,178,170,192,195,158,81,45,79,71,131,
-203,228,232,249,210,132,30,48,150,150,129,118,53,143,14,3,0,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,6,65,194,221,222,150,
-227,219,222,243,254,246,211,232,219,172,232,239,241,209,120,145,190,39,56,42,
-2,2,0,0,0,0,0,0,0,0,0,0,77,141,171,177,183,126,178,225,
-229,205,203,229,237,190,55,49,37,191,230,240,244,246,243,249,233,170,167,145,
-110,147,89,209,12,5,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,4,12,57,72,42,72,207,188,212,243,254,250,239,228,224,163,
-233,172,172,211,129,150,182,58,51,74,2,4,0,0,0,0,0,0,0,3,
-25,14,37,143,164,190,151,203,254,249,245,240,243,249,252,204,101,69,60,159,
-236,243,252,246,247,246,249,249,219,79,115,150,145,141,10,4,2,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,2,3,3,62,
-147,124,143,240,254,247,241,229,215,177,239,180,141,185,129,158,182,80,55,109,
-5,4,1,0,0,0,0,0,0,14,142,115,95,158,147,182,203,254,252,254,
-249,244,245,250,249,229,80,41,35,145,246,247,249,252,252,252,252,246,194,57,
-89,142,137,82,29,3,2,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,0,0,1,4,3,3,3,68,236,254,237,249,230,216,192,
-241,244,227,188,127,174,153,66,53,136,2,4,1,0,0,0,0,0,0,24,
-200,177,116,150,143,138,196,252,250,252,254,252,250,254,249,166,77,39,46,35,
-190,252,252,254,252,254,249,250,177,92,92,142,155,50,47,3,2,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,4,
-5,2,92,246,254,226,220,198,205,201,244,247,249,170,124,170,134,42,38,106,
-3,4,1,0,0,0,0,0,0,10,120,180,177,156,134,102,119,250,252,252,
-252,252,249,254,245,97,62,35,40,42,80,234,255,254,252,252,250,219,145,84,
-96,143,158,49,45,4,2,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,4,2,2,4,118,241,252,194,145,166,195,228,
-247,252,252,190,155,200,134,37,30,101,2,4,1,0,0,0,0,0,0,7,
-61,82,175,160,138,102,124,236,250,252,252,252,246,253,156,68,47,41,48,35,
-47,95,185,247,252,252,212,102,78,72,112,158,160,70,46,3,1,2,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,
-3,5,149,237,252,185,166,141,155,99,191,195,175,233,200,196,175,39,44,87,
-2,5,0,0,0,0,0,0,0,6,62,78,160,160,159,122,134,210,249,254,
-252,252,209,122,149,111,42,29,34,50,68,80,28,30,66,61,45,56,66,98,
-115,170,182,96,71,5,2,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,1,6,4,180,245,252,216,31,9,23,124,
-200,241,231,146,52,46,74,60,60,97,2,4,0,0,0,0,0,0,0,4,
-44,69,99,153,171,146,132,147,182,180,147,92,26,72,101,108,38,17,17,52,
-65,53,53,31,37,44,50,45,69,101,128,185,195,92,56,3,2,2,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,5,
-7,96,226,252,254,166,26,22,39,112,207,151,56,47,64,35,33,95,112,96,
-2,3,0,0,0,0,0,0,0,5,23,64,61,136,180,155,138,106,89,66,
-46,50,33,98,90,127,73,67,70,112,77,62,71,35,29,47,55,67,96,103,
-129,195,207,161,28,5,3,2,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,1,50,178,230,254,252,117,36,24,41,88,
-112,45,39,34,36,34,52,88,78,108,3,3,0,0,0,0,0,0,0,3,
-7,112,108,136,185,166,153,106,98,78,57,48,51,138,212,230,196,185,190,231,
-244,219,88,21,32,42,66,77,94,100,129,196,204,166,6,4,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,1,
-34,140,236,252,240,79,35,28,42,68,52,46,17,23,54,63,87,70,56,76,
-54,5,3,4,4,2,0,0,0,3,1,74,122,145,194,182,155,145,113,96,
-77,57,50,119,210,201,209,222,190,93,85,96,55,38,36,53,72,83,101,103,
-155,190,204,63,2,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,3,2,86,136,249,250,190,81,51,56,81,56,
-39,19,51,82,64,35,53,88,81,79,94,60,16,3,3,4,0,0,0,2,
-2,9,146,158,194,198,177,164,151,105,95,62,60,73,92,92,57,57,52,44,
-58,67,65,58,52,58,79,81,103,122,171,183,203,17,3,6,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,1,6,
-118,150,252,254,151,94,68,111,82,54,49,65,41,45,55,40,44,74,67,92,
-104,103,106,24,4,4,0,0,0,5,2,3,79,179,175,207,186,170,152,124,
-101,63,79,90,97,78,57,53,55,55,54,65,70,74,78,77,87,97,115,137,
-156,177,200,18,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,3,4,6,96,146,252,243,142,108,124,138,96,69,
-70,38,25,21,28,44,54,48,41,55,96,100,94,92,8,4,0,0,0,0,
-0,3,12,48,172,209,194,194,170,143,130,102,106,112,87,92,89,89,95,102,
-104,88,61,73,78,94,102,114,137,155,149,182,194,8,3,1,1,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,3,
-30,170,249,229,131,136,152,155,136,113,55,36,14,8,18,22,28,40,40,47,
-64,72,77,57,48,7,1,0,0,0,0,3,6,10,145,196,192,190,188,158,
-138,118,111,121,132,150,203,195,195,188,188,203,164,97,84,100,122,134,152,160,
-158,175,177,7,2,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,2,4,79,200,249,198,126,114,66,115,145,56,
-50,30,39,56,30,13,8,23,26,29,71,86,67,56,77,28,2,1,0,0,
-0,3,5,5,105,195,190,180,190,177,162,132,112,194,215,158,78,46,44,32,
-31,73,155,150,103,102,129,151,155,155,158,190,166,17,5,4,3,1,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,4,
-69,222,250,145,101,103,73,87,163,68,62,79,101,73,18,9,12,12,19,28,
-70,115,110,68,92,31,2,2,1,0,0,3,4,2,56,200,191,177,186,185,
-172,143,122,143,115,92,86,92,108,113,89,99,105,104,101,108,131,170,161,162,
-160,201,237,243,122,18,3,4,3,2,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,2,2,20,230,186,85,89,143,182,158,198,103,
-111,45,90,85,55,38,28,33,36,55,84,98,126,113,99,33,1,2,2,0,
-0,1,1,3,16,177,195,188,182,196,172,149,125,141,142,146,155,142,145,131,
-122,121,87,112,93,120,136,170,166,160,188,233,240,237,221,175,60,4,4,5,
-3,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,
-13,200,134,50,30,63,142,221,196,158,155,88,69,79,74,156,145,163,177,158,
-145,134,121,109,106,80,1,2,2,0,0,1,4,3,3,105,207,195,188,200,
-178,155,145,132,118,126,104,102,110,115,93,92,106,124,117,136,155,171,175,183,
-213,245,252,232,200,215,192,109,10,5,2,3,1,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,3,1,1,22,104,58,49,30,65,188,145,152,
-215,237,159,166,215,195,185,221,209,237,209,194,132,108,145,92,1,2,2,0,
-0,1,2,6,4,30,200,203,188,209,198,175,166,156,152,140,90,109,129,120,
-92,97,143,145,145,152,172,180,175,195,240,252,254,239,233,196,207,200,145,23,
-3,6,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,2,1,
-2,70,147,79,42,26,33,90,128,174,240,249,252,245,216,220,254,252,236,243,
-168,86,87,130,177,47,1,1,1,0,0,1,4,5,3,87,194,209,203,196,
-204,183,182,171,160,126,83,63,55,53,70,79,108,116,138,146,172,182,188,227,
-249,252,252,250,239,211,225,185,194,160,22,5,3,1,0,1,0,0,0,0,
-0,0,0,0,0,0,0,0,2,4,7,68,58,105,53,38,29,33,145,241,
-249,247,243,224,224,252,252,254,228,243,130,39,36,134,170,8,0,0,0,2,
-2,5,3,12,119,246,245,229,207,194,196,194,172,168,151,129,76,58,60,53,
-48,66,92,115,136,149,177,190,213,249,250,252,254,246,236,244,213,188,194,168,
-143,22,4,2,2,1,0,0,0,1,0,0,0,0,0,0,0,0,2,3,
-12,68,10,106,70,52,35,33,113,230,246,243,236,222,243,254,255,254,241,159,
-112,89,39,172,82,1,1,0,0,5,4,4,12,119,225,240,252,247,234,205,
-201,198,172,177,160,116,93,76,72,85,77,74,99,124,136,175,213,224,246,252,
-247,254,254,249,239,236,215,216,195,177,177,119,19,3,2,5,1,0,0,0,
-0,0,0,0,0,0,0,0,1,0,2,37,83,125,92,57,49,42,81,200,
-243,240,234,231,254,254,255,252,233,58,16,23,93,190,7,4,1,0,0,2,
-6,14,138,203,209,230,250,254,249,226,215,216,178,179,167,147,134,124,119,103,
-100,124,134,143,168,216,237,243,252,249,250,254,254,252,240,230,204,225,164,175,
-186,162,125,26,7,4,1,0,0,0,0,0,0,0,0,0,0,0,0,2,
-3,2,2,71,124,80,57,40,48,101,160,241,236,243,254,255,254,249,188,21,
-50,62,201,99,4,3,1,0,0,4,23,145,191,205,209,211,254,254,252,249,
-234,234,219,185,168,162,162,161,147,161,160,180,174,190,224,245,252,254,254,252,
-254,252,254,249,244,243,210,183,170,194,168,158,185,131,29,7,2,1,0,0,
-0,0,0,0,0,0,0,0,1,1,3,4,7,29,146,92,57,44,40,51,
-84,211,244,249,252,255,254,236,71,23,30,101,207,23,3,2,1,0,0,1,
-132,183,198,167,198,236,244,255,252,254,249,240,246,229,209,196,200,200,210,225,
-233,232,233,245,254,254,255,252,252,254,252,252,252,252,252,249,224,210,203,143,
-188,170,160,168,138,46,3,3,0,2,1,0,0,1,0,0,0,0,0,0,
-1,2,4,6,147,101,74,62,51,44,73,134,241,249,252,250,240,115,19,20,
-52,152,152,2,2,3,0,0,0,1,185,207,195,149,191,244,252,254,252,254,
-255,252,249,250,247,247,249,250,254,254,252,252,254,254,254,254,254,252,255,252,
-252,252,252,254,252,250,220,185,201,194,179,163,170,178,183,140,55,2,9,5,
-1,1,1,1,0,0,0,0,0,0,1,1,1,3,92,150,114,84,60,61,
-78,72,180,249,179,220,114,12,18,38,109,186,66,2,3,2,0,0,0,1,
-231,192,134,143,175,221,255,252,254,252,254,255,255,250,250,254,252,252,252,253,
-254,255,255,254,252,249,252,252,252,249,249,250,249,254,254,246,236,180,150,194,
-195,158,203,178,170,182,175,86,8,4,0,1,1,0,0,0,0,0,0,0,
-0,0,2,2,12,186,152,86,74,76,74,49,101,195,126,46,12,20,41,76,
-150,177,16,3,1,2,0,0,0,1,210,128,136,203,246,229,252,254,254,252,
-252,252,254,254,254,254,254,254,254,255,255,255,254,254,254,254,252,252,243,247,
-252,250,252,252,249,252,250,177,177,201,191,209,178,203,198,179,180,182,100,18,
-1,3,3,1,0,0,0,0,0,0,0,0,1,5,4,31,180,131,95,70,
-86,55,65,48,24,28,33,53,64,108,163,111,2,3,2,1,0,0,0,1,
-153,103,233,194,241,240,254,254,254,252,254,252,254,254,255,255,255,255,255,255,
-255,255,254,254,252,250,249,244,243,246,250,249,249,245,244,254,245,209,171,209,
-217,191,190,185,185,198,194,190,194,141,40,1,4,5,5,3,3,4,2,1,
-2,2,3,2,1,1,57,191,141,108,95,56,40,34,36,52,57,69,113,166,
-209,44,3,2,3,1,0,0,0,1,118,186,198,249,237,234,255,254,254,250,
-252,252,254,254,254,255,254,252,252,254,254,254,254,252,245,245,246,243,246,252,
-246,252,247,244,243,249,243,198,221,207,234,196,196,191,194,200,210,209,209,213,
-200,129,69,25,12,9,2,6,7,2,5,4,1,3,4,0,2,76,230,164,
-124,70,52,58,82,103,109,145,188,211,201,9,1,1,3,1,0,0,0,1,
-106,179,236,239,244,239,254,254,254,249,249,249,252,252,252,250,247,244,245,243,
-246,243,243,245,240,239,241,243,247,250,249,250,244,249,245,245,250,243,174,203,
-219,191,188,207,188,209,219,225,226,220,213,230,198,127,56,29,31,22,9,5,
-3,4,2,2,1,3,1,3,145,229,192,121,90,86,92,132,198,213,225,228,
-192,15,3,1,2,1,0,0,0,1,110,190,233,236,252,252,252,252,254,249,
-243,243,246,249,249,249,249,245,249,249,241,243,240,239,231,234,241,245,249,245,
-241,249,239,245,246,239,250,245,211,217,224,180,203,219,221,211,217,222,236,234,
-232,231,243,240,167,128,76,70,68,63,52,35,12,1,3,1,3,2,42,232,
-232,203,160,140,129,152,185,220,227,194,171,110,5,3,3,0,0,0,0,1,
-111,228,230,246,254,252,249,252,252,249,240,239,241,246,243,155,104,102,119,182,
-224,233,229,227,222,227,243,245,243,241,243,240,243,237,246,237,250,249,224,219,
-229,225,179,205,220,243,233,243,246,243,236,215,204,204,166,136,145,149,138,145,
-225,240,212,170,129,54,2,4,48,239,229,239,229,228,219,185,152,166,172,158,
-143,194,50,3,7,4,0,0,0,1,179,213,232,249,247,247,246,250,254,252,
-243,243,241,237,216,98,62,68,73,97,228,217,220,219,219,224,240,241,239,241,
-241,245,239,240,233,236,247,252,247,229,216,230,213,194,175,191,229,217,205,203,
-216,244,254,254,246,230,240,219,234,116,219,243,241,243,249,252,219,132,188,245,
-237,240,237,227,205,215,215,194,171,153,155,211,209,51,6,2,0,0,0,1,
-166,220,245,241,232,236,244,247,252,250,244,241,243,231,250,207,85,62,96,120,
-224,236,212,215,219,222,239,243,237,240,249,245,231,241,219,237,252,252,249,252,
-243,237,215,198,215,198,201,233,254,254,252,254,252,254,246,237,219,213,230,94,
-146,237,246,234,245,243,244,216,236,252,236,237,249,243,209,172,174,179,178,167,
-166,236,205,161,6,3,0,0,0,1,177,236,234,225,228,233,243,246,252,252,
-244,249,233,252,254,252,136,76,124,150,250,252,236,205,219,224,234,239,236,244,
-247,239,240,228,220,240,254,252,252,247,252,244,243,215,222,249,254,254,252,252,
-252,254,254,252,234,212,231,236,230,115,159,236,243,236,234,231,243,227,232,255,
-243,229,231,239,220,151,158,150,170,175,210,230,200,227,30,2,0,0,0,1,
-205,231,222,216,224,229,241,245,252,250,250,245,243,254,254,252,215,57,110,162,
-252,252,254,227,211,227,229,231,233,249,247,236,239,221,222,243,250,252,252,252,
-254,247,201,170,24,45,126,158,198,194,228,247,254,254,236,203,231,240,195,101,
-190,212,246,230,237,236,244,246,229,233,249,215,216,209,194,120,93,124,143,174,
-219,231,194,252,162,9,1,3,1,1,226,225,211,213,219,219,240,245,250,252,
-252,240,249,252,249,252,227,141,79,162,240,232,227,252,229,224,231,231,240,247,
-241,236,226,224,222,245,250,252,249,250,247,249,217,170,151,143,119,132,141,149,
-150,120,124,153,145,166,126,177,192,151,192,201,244,229,219,236,243,244,244,226,
-231,221,198,186,198,115,80,89,112,156,209,225,213,254,245,48,2,2,4,1,
-229,213,213,211,215,215,243,240,247,252,247,247,243,236,237,245,174,104,71,69,
-158,219,220,236,227,220,215,231,243,245,234,232,215,222,228,252,246,246,245,249,
-246,252,183,140,53,94,117,182,131,125,194,220,145,162,134,134,111,111,124,150,
-137,209,243,224,201,243,240,249,240,249,249,243,229,215,207,190,160,145,149,151,
-198,227,215,252,237,102,1,3,1,1,212,207,207,204,209,204,245,230,243,252,
-243,252,239,229,240,241,158,112,81,60,103,222,234,225,220,236,211,229,244,241,
-233,219,215,217,229,252,245,249,246,252,249,250,226,198,77,102,39,44,209,207,
-156,194,240,227,211,162,149,192,180,211,166,190,236,204,236,200,234,247,249,239,
-244,252,252,252,254,254,252,252,249,227,186,229,222,243,200,177,5,2,1,0,
-
-/* #6: Trinity face pic? (originally by Alex) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,2,2,3,1,2,1,2,1,0,
-3,1,5,1,5,2,2,2,3,1,1,5,1,1,0,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,2,1,2,2,1,3,7,21,37,73,85,80,26,23,82,121,127,96,
-50,14,2,1,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,2,1,1,1,4,4,67,145,221,
-243,247,250,250,207,183,247,247,243,252,249,195,95,16,1,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,7,2,3,8,60,164,232,249,245,240,241,245,246,249,247,249,244,245,243,
-245,250,241,198,84,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,1,1,0,0,2,18,131,240,254,249,246,245,
-243,243,246,252,249,249,249,249,245,245,244,247,249,250,240,134,7,2,1,5,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,2,4,
-1,3,52,185,249,250,250,250,249,246,245,243,243,244,249,249,247,250,249,247,
-244,243,246,247,250,247,166,35,5,2,3,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,1,2,2,2,5,44,215,249,250,250,249,252,252,249,
-246,244,243,245,250,249,246,252,252,247,244,245,247,252,252,249,252,198,44,3,
-5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,6,
-55,212,252,254,250,252,250,252,252,252,249,244,240,241,246,249,244,247,254,250,
-249,243,245,245,250,254,252,252,216,69,4,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,2,2,1,2,25,192,249,252,249,252,252,252,252,252,252,
-250,245,240,240,244,252,243,243,252,254,252,249,243,249,247,250,254,254,252,210,
-63,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,18,156,
-252,252,252,252,249,254,254,254,252,254,250,244,243,246,245,249,249,243,249,252,
-252,252,252,250,249,252,252,252,254,254,216,38,4,2,2,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,3,8,124,246,254,252,252,252,252,252,252,254,252,254,
-247,243,243,249,250,252,252,243,249,249,245,246,252,254,254,254,252,252,254,254,
-254,167,13,4,4,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,66,236,252,
-252,252,252,252,252,252,252,254,250,252,249,245,245,237,240,240,233,225,210,207,
-191,215,239,252,254,254,254,254,254,254,254,239,87,2,2,4,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,2,31,200,252,254,252,252,252,252,252,252,252,252,252,255,
-247,230,215,186,153,126,104,113,87,94,108,131,171,220,249,250,254,254,254,254,
-254,254,203,12,3,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,131,249,252,250,
-254,252,252,252,252,252,254,254,250,236,200,158,119,93,68,51,53,49,57,65,
-74,92,116,166,228,252,254,254,254,254,254,254,249,61,2,6,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,70,233,254,250,254,252,254,254,254,252,252,254,249,229,179,
-120,90,70,55,39,37,32,38,44,48,55,70,86,108,161,231,254,254,254,254,
-254,252,254,166,9,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,1,2,6,166,252,252,252,254,
-254,254,254,254,252,254,252,229,177,120,86,68,55,44,35,29,26,28,32,37,
-41,58,69,86,115,182,243,254,252,254,255,254,254,215,40,3,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,1,2,62,250,252,252,252,254,254,254,254,252,252,253,221,162,117,82,
-71,60,48,39,28,20,24,23,25,31,36,50,61,71,88,120,195,241,254,252,
-254,254,254,250,76,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,3,13,162,254,252,252,252,252,
-254,254,254,249,254,234,159,103,95,78,70,60,48,38,26,21,23,25,28,31,
-34,46,57,68,85,102,143,186,241,254,252,254,252,254,109,4,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,0,53,220,254,252,252,254,252,252,252,254,252,245,177,110,90,81,74,
-71,63,50,42,28,24,23,26,30,33,34,46,57,69,83,97,116,132,196,246,
-254,254,254,254,159,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,2,3,116,254,249,252,252,254,254,
-254,254,254,249,215,121,93,78,79,72,68,62,52,45,29,24,25,28,31,35,
-38,46,57,68,79,92,99,119,149,207,252,254,254,254,215,3,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,2,4,182,254,252,250,252,252,254,254,254,254,237,167,106,86,83,80,72,
-66,62,53,41,32,26,30,31,31,34,37,44,50,66,77,83,100,109,126,162,
-232,254,252,254,232,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,2,60,241,254,252,250,252,252,252,
-254,254,247,194,126,100,80,77,73,72,64,60,51,40,29,26,33,37,35,39,
-44,42,55,67,76,88,94,103,117,134,196,252,254,252,234,9,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,3,127,249,254,252,252,252,252,252,254,254,222,162,115,101,84,76,76,66,
-65,62,54,47,39,39,42,44,40,44,48,49,60,71,80,89,102,118,119,122,
-174,250,252,252,230,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,19,185,254,254,254,254,252,252,254,
-254,250,185,140,115,103,106,142,142,136,104,96,71,60,54,56,55,53,50,56,
-60,55,76,124,166,196,219,234,220,156,145,244,249,252,229,3,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,47,241,252,254,255,254,252,252,254,254,243,163,134,118,149,191,212,217,229,
-230,225,215,196,142,87,72,66,63,71,71,106,192,234,246,243,236,217,216,215,
-132,241,252,249,230,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,97,255,252,252,254,254,254,252,252,
-254,225,158,136,136,198,174,112,111,128,163,209,234,241,221,140,90,79,76,85,
-88,155,226,243,213,166,127,108,137,180,143,236,250,252,227,2,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,174,254,254,254,254,237,241,252,254,252,200,134,127,155,155,105,89,92,92,
-88,92,143,196,210,177,116,80,69,93,140,215,222,182,127,121,141,160,164,150,
-124,213,254,249,195,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,15,211,254,254,252,254,236,232,252,254,
-252,183,114,115,145,137,128,151,182,207,194,200,190,152,175,204,141,72,51,78,
-174,222,191,198,220,237,245,244,229,172,119,172,249,243,170,3,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-51,227,252,252,252,239,228,244,246,254,243,156,100,98,116,142,182,239,252,252,
-228,243,231,240,155,182,151,60,39,72,194,188,229,232,236,240,244,247,243,204,
-118,136,247,247,126,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,83,241,250,254,252,233,174,213,239,250,
-236,143,104,88,95,136,203,245,249,231,221,220,100,186,164,104,130,72,41,72,
-138,117,164,155,205,216,143,231,240,183,124,121,245,254,92,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,3,
-125,249,254,249,254,241,127,178,221,243,226,146,100,84,70,83,88,177,219,180,
-162,127,102,94,57,60,97,72,35,60,102,53,64,93,132,182,201,209,178,143,
-113,116,231,254,87,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,2,0,6,150,250,249,246,249,249,134,145,215,243,
-226,145,100,87,68,60,68,87,114,109,111,87,60,44,48,68,90,70,39,54,
-104,70,57,67,92,113,115,111,124,115,103,108,226,254,79,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,1,12,
-177,250,247,245,249,249,177,103,188,207,217,151,106,92,74,58,49,54,44,44,
-46,40,39,44,54,76,86,77,47,58,102,96,66,56,66,74,84,92,96,99,
-104,112,228,254,74,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,0,1,0,14,201,249,246,245,249,246,221,89,119,143,
-213,171,121,95,83,69,57,53,51,39,36,38,40,48,69,81,87,81,51,60,
-92,111,89,65,63,68,72,77,92,100,105,118,234,249,70,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,20,
-226,249,245,243,247,250,241,120,96,150,196,188,134,101,92,76,64,64,57,44,
-40,39,42,46,70,83,89,74,50,50,82,110,100,73,61,62,68,74,92,108,
-117,134,237,240,63,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,25,247,249,246,243,247,249,249,227,137,85,
-180,203,155,117,93,81,73,73,68,54,41,40,41,44,62,97,105,70,45,38,
-76,120,104,77,66,71,76,85,102,115,124,132,241,219,46,2,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,
-250,249,249,244,247,250,250,225,188,161,179,212,166,125,99,84,78,73,65,54,
-44,42,37,46,72,108,102,73,44,36,65,112,103,76,65,73,80,93,110,125,
-125,149,243,198,28,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,0,0,0,50,250,252,252,246,249,252,247,252,185,113,
-124,203,168,132,106,89,83,76,70,61,55,52,53,58,87,108,117,119,71,65,
-101,136,105,83,77,80,90,101,119,132,124,185,249,188,22,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,64,
-250,250,252,247,249,250,246,249,243,177,112,180,174,138,112,99,89,83,76,69,
-62,56,58,70,82,156,215,224,166,158,207,212,131,92,84,89,98,109,130,130,
-124,226,254,174,18,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,72,252,250,250,249,249,249,247,250,249,252,
-212,226,185,143,131,113,102,90,81,71,67,65,71,65,47,129,210,219,219,228,
-240,229,127,98,93,95,108,115,132,130,151,246,254,159,12,3,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,90,
-252,252,252,250,250,246,247,250,246,252,255,254,207,160,146,132,114,95,87,82,
-69,64,61,52,47,55,92,122,185,209,209,166,97,81,92,110,128,136,146,132,
-174,252,254,143,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,2,3,103,254,250,252,252,252,249,247,247,243,249,
-254,255,221,170,155,145,131,110,97,86,76,71,56,54,60,56,54,49,83,95,
-119,110,87,79,92,108,136,146,149,138,190,255,254,120,3,2,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,113,
-254,252,252,252,252,250,252,249,245,249,254,254,236,182,166,155,146,129,110,92,
-81,77,74,76,57,55,68,71,61,68,106,115,95,92,99,116,145,156,155,146,
-216,254,254,70,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,2,0,124,254,254,252,252,250,250,252,250,247,250,
-254,255,244,194,163,149,146,136,117,95,92,97,87,83,100,134,124,127,145,168,
-166,182,168,111,100,129,150,161,150,145,241,254,254,29,2,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,132,
-254,252,252,252,252,252,252,252,250,252,254,255,253,212,166,140,134,134,115,90,
-89,98,138,195,226,212,210,225,227,229,222,216,237,209,130,136,145,151,140,158,
-252,254,237,6,2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,2,150,254,254,254,254,252,252,254,254,254,254,
-254,254,255,236,185,145,126,130,116,88,79,89,140,166,182,160,156,166,178,182,
-178,200,209,182,143,136,141,143,132,196,254,254,201,6,1,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,145,
-254,254,254,254,252,252,254,254,254,254,254,255,254,249,215,163,130,128,115,97,
-76,74,78,79,121,136,78,41,31,38,88,155,141,113,110,128,142,145,140,227,
-254,254,152,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,0,4,149,254,254,254,254,252,252,254,254,254,254,
-254,255,252,254,240,200,152,136,129,110,83,73,73,76,108,149,161,160,147,158,
-175,168,134,108,110,134,156,147,177,250,252,252,108,2,2,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,4,155,
-254,254,254,254,252,252,254,254,254,254,254,255,254,254,246,232,191,155,138,124,
-97,82,79,78,78,109,163,201,207,198,174,143,120,111,118,142,163,146,227,254,
-250,241,77,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,0,1,12,175,254,254,254,254,252,252,254,254,254,254,
-254,254,255,255,249,245,231,190,171,136,113,97,84,81,63,73,77,79,82,80,
-87,97,108,124,137,162,164,201,252,252,252,220,45,3,1,3,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,3,18,191,
-254,254,254,254,252,252,254,254,254,254,254,255,254,254,246,241,243,225,194,164,
-134,110,95,83,66,51,47,45,50,55,67,83,101,122,147,167,183,243,255,254,
-252,203,20,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,2,2,31,207,254,254,254,254,254,252,254,254,254,254,
-254,254,254,254,245,236,241,240,222,204,178,141,112,97,71,58,49,45,46,52,
-69,90,112,136,155,170,243,255,252,254,252,183,6,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,2,53,227,
-254,254,254,254,254,254,254,254,254,254,254,255,255,254,243,224,231,243,237,227,
-209,185,145,121,94,83,72,74,73,76,90,116,138,151,188,243,254,254,254,254,
-254,155,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,2,2,76,243,254,254,254,254,254,254,254,254,254,254,
-254,255,255,252,240,210,213,232,240,236,228,219,194,170,142,117,109,113,116,124,
-138,161,166,194,245,252,254,255,252,252,255,119,2,0,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,92,252,
-254,254,254,252,254,254,254,254,254,254,254,255,254,245,228,195,194,215,231,237,
-237,231,225,213,204,188,177,179,180,186,194,201,219,233,249,254,252,254,254,254,
-254,65,2,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,3,3,111,250,254,254,252,252,252,254,254,254,255,254,
-254,254,250,226,219,175,160,190,217,229,233,236,236,236,231,228,221,220,217,221,
-228,239,240,236,249,255,255,254,252,254,254,34,0,1,0,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,4,137,254,
-250,254,252,252,252,252,254,254,254,254,254,254,227,183,198,158,131,136,164,212,
-227,231,232,236,236,237,241,240,240,241,244,240,239,232,249,255,255,255,254,254,
-227,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,1,4,158,254,252,254,254,252,252,252,252,252,252,252,
-252,233,172,147,170,138,110,112,128,177,209,228,234,236,237,239,241,241,240,241,
-240,239,233,230,249,254,255,255,254,254,182,13,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,216,254,
-252,254,254,254,254,254,254,252,254,249,219,178,111,108,118,118,96,90,97,130,
-175,211,228,231,233,234,239,236,237,240,241,234,229,227,249,254,255,254,255,254,
-136,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,1,10,247,254,252,254,254,254,254,254,250,252,222,170,
-153,132,78,82,82,97,83,77,83,104,134,178,207,222,231,234,236,236,236,237,
-237,230,227,222,243,255,254,254,254,249,104,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,2,2,1,1,1,1,1,1,2,2,1,1,1,0,1,1,52,252,254,
-252,254,252,254,254,252,240,200,140,113,115,104,60,61,65,76,74,69,72,87,
-106,141,179,204,222,226,232,232,236,233,231,229,227,221,240,254,254,254,252,237,
-68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,2,1,2,5,3,1,1,1,1,
-1,1,0,1,1,3,4,120,252,254,255,254,254,236,209,158,104,96,98,95,
-103,88,49,47,53,63,66,64,68,70,82,108,149,185,207,215,224,230,232,230,
-229,222,224,215,236,254,254,254,254,221,23,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,2,2,2,3,2,2,1,1,4,3,2,2,3,2,3,21,180,255,255,
-252,203,164,131,77,83,86,82,87,93,89,77,37,38,44,49,58,61,63,64,
-73,92,125,164,188,200,210,225,226,222,222,220,219,210,225,252,254,254,254,194,
-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,2,2,1,2,5,12,19,26,29,
-32,28,29,29,37,30,52,122,112,93,96,83,87,83,70,87,77,79,86,82,
-83,70,31,37,38,40,48,55,56,58,63,77,104,134,168,177,190,205,210,217,
-219,217,207,207,209,243,252,252,254,119,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,2,7,20,37,44,52,60,64,63,64,61,65,69,86,74,85,97,84,71,
-84,78,86,71,77,87,81,77,78,85,80,69,32,38,36,36,40,46,53,60,
-65,78,98,119,143,151,167,179,190,209,213,207,194,190,192,220,252,254,249,65,
-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,4,30,54,67,65,58,58,61,67,69,
-71,66,72,76,80,72,89,92,83,73,79,76,84,76,85,79,83,83,82,76,
-76,65,32,37,34,34,36,41,44,52,57,70,87,108,120,129,143,151,166,198,
-198,190,175,161,164,188,219,254,215,37,2,2,2,1,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,
-39,67,67,60,54,50,49,52,60,62,60,66,72,86,76,81,87,84,71,72,
-76,71,78,76,84,83,83,81,80,80,74,66,37,36,37,36,36,38,42,52,
-56,70,79,94,106,109,108,118,140,177,168,160,158,141,142,170,147,186,156,14,
-2,2,2,3,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,5,8,12,25,37,30,28,25,26,31,48,
-49,68,72,87,68,83,80,77,72,78,72,66,70,71,81,84,83,79,80,80,
-76,79,49,35,38,36,40,39,45,52,51,62,74,78,87,83,82,90,122,158,
-145,127,141,125,120,137,143,85,88,30,5,2,1,3,3,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
-8,12,25,37,30,28,25,26,31,40,45,53,72,79,67,74,71,71,76,81,
-69,67,66,66,74,76,76,77,79,79,72,72,60,61,55,49,50,53,57,56,
-53,55,68,69,71,64,58,65,103,136,119,118,124,118,101,104,142,92,71,71,
-40,8,1,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,5,8,12,25,37,30,28,25,26,31,35,
-42,50,71,69,57,58,62,66,76,78,61,69,65,64,66,70,72,76,76,76,
-72,66,44,48,51,55,53,53,53,48,49,55,64,69,65,57,46,52,88,115,
-105,108,108,110,98,89,115,105,73,69,72,54,23,4,1,2,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-/* #7: Neo face pic (originally by Alex) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,9,19,33,14,2,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,0,1,1,2,2,3,13,20,43,55,64,114,150,149,71,31,6,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,1,7,4,3,5,4,4,2,2,4,30,70,128,
-191,200,197,214,237,226,209,203,185,131,79,11,2,0,1,1,2,2,1,2,
-2,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,4,
-5,2,2,3,6,5,47,133,145,222,228,241,251,253,253,253,245,254,242,230,
-204,123,73,46,11,6,3,3,2,3,5,2,3,1,3,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,3,2,4,3,2,4,11,5,39,153,184,225,251,
-250,249,253,251,251,252,251,253,253,251,253,248,229,197,126,97,45,6,4,2,
-5,3,1,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,9,81,
-115,96,97,122,86,142,191,224,248,250,253,251,248,251,251,250,251,248,253,253,
-250,252,253,244,222,221,190,132,92,19,3,3,2,0,1,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,2,2,3,3,54,200,224,215,224,247,240,221,223,248,252,252,
-247,242,253,253,251,251,251,253,250,254,253,254,248,252,253,250,240,240,242,151,
-34,2,2,1,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,0,0,2,3,4,4,7,94,201,
-204,227,241,251,252,245,242,244,245,249,244,242,253,254,253,252,249,253,253,254,
-254,254,250,252,250,250,254,252,251,242,154,27,1,1,0,1,1,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,4,29,157,245,238,248,250,248,252,251,249,246,244,248,
-244,241,252,253,253,252,252,254,253,253,252,253,252,254,254,252,252,251,248,250,
-248,130,9,1,4,1,0,0,1,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,3,15,137,235,253,
-251,252,250,243,245,252,246,249,249,250,246,244,251,254,253,251,253,253,251,251,
-253,252,252,252,254,254,252,254,251,250,248,231,85,5,3,2,1,0,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,2,3,2,3,69,233,251,250,251,253,251,246,244,244,240,243,246,251,
-246,242,243,250,251,250,250,253,252,252,251,251,250,249,252,254,252,252,251,250,
-240,241,168,20,1,3,1,1,1,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,3,1,25,184,251,246,252,
-252,250,253,249,251,243,238,242,238,245,245,242,242,243,239,223,194,192,202,238,
-243,252,253,251,252,254,254,252,253,250,245,246,227,78,3,1,2,3,1,0,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,1,3,3,92,240,250,250,252,253,253,253,252,245,237,212,183,167,196,
-212,223,229,229,193,134,78,62,77,146,190,234,252,252,254,254,253,251,253,251,
-253,244,248,146,3,3,2,3,1,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,0,1,14,151,249,250,253,254,
-253,253,251,250,228,176,119,80,58,78,99,124,143,151,99,45,22,18,30,63,
-107,163,207,224,245,254,251,251,250,250,252,252,252,214,17,2,1,1,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,2,39,201,244,251,253,250,254,252,234,190,130,89,60,52,46,36,
-32,34,37,50,40,25,21,23,23,23,28,48,88,118,176,227,248,251,249,247,
-252,252,252,253,64,2,0,2,1,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,1,1,1,1,51,222,249,253,252,252,
-250,231,190,138,95,79,61,48,46,37,34,29,26,28,25,19,16,19,20,14,
-16,22,40,57,79,159,235,249,250,248,251,251,251,251,105,2,2,2,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,2,1,46,211,252,252,254,251,234,209,164,123,92,76,59,48,44,33,
-34,27,21,21,21,13,10,15,15,16,21,19,22,28,40,88,174,227,244,246,
-249,249,252,252,160,13,1,1,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,2,2,49,216,254,254,254,233,
-204,200,166,129,98,79,56,46,40,32,33,25,24,26,13,7,7,7,6,10,
-17,20,20,21,34,38,76,152,220,243,248,249,251,251,216,54,2,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,1,0,76,237,254,251,249,220,188,189,161,133,107,82,58,46,39,34,
-31,24,23,24,13,7,7,7,5,8,11,18,22,24,29,31,40,92,188,243,
-251,251,250,251,240,89,3,1,1,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,94,244,252,251,249,218,
-189,193,165,138,119,97,70,51,38,32,33,29,24,24,16,9,7,5,4,7,
-10,16,21,25,27,30,33,61,149,235,246,253,252,253,249,126,8,2,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,0,92,245,250,251,247,223,198,200,176,149,129,109,79,53,44,41,
-39,34,32,31,23,15,12,9,8,9,12,16,21,24,26,28,35,46,106,212,
-237,248,252,252,251,175,18,2,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,1,2,106,249,249,251,247,228,
-206,201,181,152,133,123,99,67,52,45,43,39,37,36,26,18,16,16,15,14,
-14,16,21,24,26,28,37,46,82,187,236,244,250,251,251,209,26,1,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,1,124,252,250,251,246,232,210,195,177,150,131,129,112,78,61,49,
-45,41,37,36,26,19,20,22,21,18,15,15,20,24,29,33,38,46,75,166,
-234,250,251,251,253,235,47,2,1,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,2,1,2,138,252,254,251,243,235,
-214,188,172,145,127,126,113,79,62,49,46,43,39,39,31,24,25,24,19,17,
-12,14,19,24,32,36,39,47,79,158,221,252,250,252,252,249,76,2,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,1,1,3,176,252,253,251,241,237,212,184,169,153,128,121,103,78,55,44,
-41,44,43,43,26,26,20,19,16,13,11,19,19,28,30,37,40,48,76,169,
-221,249,251,253,249,253,105,2,1,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,1,4,210,255,251,249,243,234,
-215,182,154,141,121,115,89,61,48,38,30,36,41,40,20,16,11,14,9,13,
-17,23,29,34,31,38,40,52,82,176,227,249,247,253,253,254,122,2,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,1,7,213,251,254,249,243,235,219,181,139,126,116,106,79,53,45,35,
-30,28,36,33,18,12,11,16,11,14,16,20,28,30,34,39,42,56,95,190,
-235,248,251,253,249,252,136,0,0,0,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,0,1,2,181,242,248,245,239,238,
-208,160,121,97,100,107,91,67,57,40,36,30,41,39,27,19,13,14,9,12,
-10,15,23,27,35,42,48,57,96,202,247,246,251,253,252,254,152,1,1,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,0,0,3,163,252,244,233,238,242,223,196,178,158,144,129,111,102,97,66,
-59,53,64,56,46,44,23,22,24,41,51,72,82,78,58,53,47,47,75,177,
-242,251,251,252,250,252,170,1,1,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,2,4,156,247,244,237,248,251,
-252,252,253,254,245,230,206,183,152,94,87,76,82,74,65,101,111,143,170,199,
-221,235,238,236,210,186,145,85,55,141,234,251,251,252,250,252,178,1,1,1,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,2,3,6,123,242,251,248,253,253,254,255,254,254,254,255,254,251,237,183,
-129,91,88,100,133,216,239,250,255,255,254,254,255,255,253,251,240,214,134,102,
-218,251,252,251,251,251,188,6,3,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,3,1,5,4,69,193,245,252,249,254,
-254,252,254,255,254,254,253,253,254,245,197,141,114,140,229,253,253,254,254,254,
-254,254,254,254,252,249,246,243,238,193,208,245,253,252,251,251,206,18,2,1,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,2,6,43,181,242,254,254,254,254,254,254,254,252,254,254,252,245,250,
-205,122,80,127,247,250,250,254,254,254,254,254,254,254,253,254,252,240,242,216,
-171,229,250,247,253,252,184,4,1,0,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,2,2,3,49,210,253,250,252,254,
-254,254,254,254,254,254,254,253,250,251,205,97,33,96,249,248,253,254,254,254,
-254,254,254,254,254,252,252,244,241,205,152,239,247,251,248,250,178,8,1,2,
-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,2,4,111,243,250,253,254,254,254,254,254,254,254,254,254,254,252,250,
-181,61,16,62,245,252,254,253,254,254,254,254,254,254,253,254,252,247,242,202,
-139,237,250,246,252,235,127,4,3,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,1,2,3,116,241,248,251,252,253,
-253,254,254,255,252,252,255,255,252,246,176,61,21,35,208,252,254,253,254,254,
-254,254,254,255,255,254,251,249,248,140,107,232,250,250,204,102,50,9,2,2,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-1,1,1,2,91,225,243,237,251,253,253,253,254,253,252,254,254,252,247,236,
-150,54,19,25,120,243,252,250,248,250,251,253,252,252,251,252,251,246,169,48,
-77,219,253,244,64,67,126,28,2,2,3,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,2,0,0,3,89,234,234,227,244,251,
-254,255,252,250,253,251,252,240,224,221,145,54,24,31,66,189,247,247,252,251,
-251,251,254,253,251,250,244,197,90,37,55,199,247,186,48,130,182,53,2,2,
-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-2,0,2,3,93,243,233,234,245,243,248,250,251,254,249,248,232,173,171,218,
-143,56,20,30,39,89,208,245,241,247,249,250,252,250,247,236,204,124,54,44,
-48,184,222,86,48,51,134,61,3,2,3,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,1,0,2,2,119,238,218,232,244,242,
-238,234,228,220,220,210,152,106,174,227,135,49,17,21,41,28,65,151,209,213,
-207,196,185,169,140,106,70,43,40,48,51,178,195,66,30,21,50,47,3,2,
-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-1,0,1,5,173,236,213,233,236,220,201,171,138,112,104,97,83,111,189,218,
-136,47,17,21,39,37,22,15,44,62,52,34,28,23,19,17,21,33,36,54,
-58,180,166,69,132,61,31,28,3,2,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,2,2,2,13,226,240,208,225,224,201,
-170,141,117,94,74,73,78,137,205,212,122,46,13,23,39,39,23,9,7,6,
-9,17,13,16,18,16,25,32,44,54,64,194,131,110,212,123,39,19,3,2,
-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-2,2,2,65,244,240,202,211,221,190,170,145,110,92,82,69,79,156,204,199,
-100,35,12,22,42,43,35,17,13,12,9,15,21,26,31,34,40,44,54,69,
-80,170,69,53,116,128,68,15,3,2,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,1,3,85,245,236,212,202,223,206,
-183,147,113,96,82,73,92,151,138,165,103,40,18,27,36,35,41,29,14,17,
-12,15,24,31,38,43,48,58,71,79,85,88,34,19,20,65,66,10,3,2,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,2,1,65,237,235,219,195,220,217,207,174,135,115,89,80,102,167,150,190,
-142,68,56,62,43,28,42,44,21,14,14,18,27,36,47,57,67,75,86,90,
-80,58,28,22,6,22,31,10,1,2,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,3,8,144,240,235,187,217,216,
-218,199,155,127,88,80,115,186,189,212,184,128,128,158,135,86,54,51,43,21,
-21,23,31,40,58,71,84,87,94,87,70,49,26,12,13,31,41,11,2,1,
-2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,3,8,77,196,216,187,212,216,219,212,171,133,90,85,146,211,217,249,
-220,171,195,240,239,199,92,42,55,33,26,29,35,47,63,78,88,93,94,78,
-67,42,33,17,20,48,68,15,2,1,3,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,2,2,3,58,173,189,185,207,218,
-224,217,181,134,95,106,196,242,237,241,235,202,201,225,235,217,85,25,51,45,
-31,34,41,53,69,78,86,93,95,76,64,39,31,43,64,64,28,6,3,1,
-3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,2,2,25,163,231,196,201,218,228,220,186,138,106,146,229,247,249,248,
-246,221,152,111,120,95,23,14,31,51,32,35,45,53,67,81,94,102,96,77,
-62,57,30,30,44,33,7,2,3,0,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,2,5,6,61,145,151,196,220,
-228,219,188,143,131,168,220,234,244,246,221,154,76,43,36,22,19,16,21,44,
-38,38,45,56,65,80,101,105,92,79,62,112,113,42,28,14,5,2,1,2,
-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,2,5,5,15,59,187,218,226,218,188,161,163,182,205,211,219,199,
-138,102,83,35,23,27,23,29,28,37,46,46,47,58,72,88,103,101,91,81,
-70,171,172,48,9,4,5,3,2,0,2,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,1,1,2,4,3,5,3,46,189,219,
-224,217,192,188,191,190,194,183,164,120,67,56,62,31,15,16,28,42,45,41,
-52,53,48,60,84,103,108,96,90,75,82,198,141,20,5,3,3,1,1,0,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,1,1,2,1,5,2,34,177,220,223,216,200,207,203,194,186,179,182,172,
-132,86,103,115,91,63,38,52,59,59,57,52,46,60,85,103,100,88,85,79,
-94,198,98,6,4,2,2,1,0,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,1,2,2,4,1,5,18,160,221,
-220,212,207,215,204,200,196,209,221,218,220,214,216,217,217,207,170,114,112,110,
-74,63,60,70,88,103,94,87,86,89,83,141,46,6,3,3,1,2,1,0,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,2,10,129,227,216,209,207,204,198,210,232,236,230,210,
-207,193,157,142,156,174,204,217,211,186,108,64,63,79,96,108,96,91,96,94,
-71,94,17,1,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,3,2,4,85,225,
-211,208,204,199,222,238,235,205,163,120,102,81,56,48,54,64,79,111,152,205,
-141,76,69,86,103,110,101,99,97,98,71,60,4,1,3,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,1,1,1,2,31,185,207,200,200,206,221,219,205,204,192,172,
-163,155,142,129,109,100,89,72,52,93,115,84,82,105,110,108,115,116,113,106,
-78,38,2,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,7,116,
-197,197,200,205,210,202,199,207,208,210,218,220,216,199,163,128,85,62,58,64,
-95,86,98,116,115,119,135,139,143,119,73,26,2,1,1,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,0,1,2,2,44,142,188,201,205,210,202,194,193,200,199,
-199,208,213,199,149,113,89,78,87,83,98,106,123,122,121,138,156,168,177,102,
-79,19,2,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,3,6,
-59,164,204,217,212,204,191,181,168,136,129,133,124,105,99,89,90,92,90,88,
-101,124,138,130,141,168,192,206,191,80,101,19,3,3,1,2,1,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,2,2,5,11,111,206,216,216,209,190,163,126,85,
-57,44,36,24,35,49,65,79,82,86,98,123,133,138,168,192,216,219,146,150,
-151,50,4,2,2,3,2,2,1,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,4,
-5,54,174,211,217,215,192,145,110,89,67,52,42,25,26,39,50,62,71,77,
-94,120,137,172,206,227,235,214,182,181,157,104,18,3,2,2,3,1,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,1,0,1,3,4,45,135,160,223,220,199,164,125,102,
-81,76,62,48,48,48,57,68,72,81,113,148,193,229,236,240,224,217,210,186,
-167,153,60,5,3,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,1,
-2,33,157,119,178,227,209,191,146,116,100,88,83,83,77,72,78,81,82,112,
-160,202,237,250,235,225,215,216,202,191,168,162,99,11,2,2,1,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,1,1,1,2,3,20,155,152,107,184,216,206,180,154,
-152,142,133,130,119,109,111,117,137,188,223,244,248,242,232,230,218,218,210,195,
-183,175,134,28,3,3,2,3,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,
-3,12,124,204,137,126,168,193,201,199,205,204,201,196,196,188,185,198,217,244,
-251,252,244,233,228,229,211,215,209,193,186,180,146,48,4,2,2,4,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,2,2,4,5,4,87,213,196,160,141,163,203,214,
-220,226,227,228,233,233,235,243,248,252,251,246,235,225,226,224,218,217,210,190,
-181,173,164,103,4,3,2,2,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,2,3,
-1,20,124,211,219,217,200,191,204,215,222,225,227,229,236,243,246,250,253,253,
-248,236,229,225,229,230,221,219,205,194,185,189,187,163,20,2,3,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,0,0,1,2,2,85,233,235,226,227,224,223,212,213,
-213,216,226,233,242,249,252,253,252,247,241,232,231,231,234,230,218,210,200,190,
-189,201,191,178,66,4,7,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,4,
-5,106,252,242,233,230,229,225,224,212,214,227,240,248,253,255,254,252,250,245,
-240,236,235,235,232,224,215,208,200,194,195,201,185,172,104,11,4,1,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-/* #8 Agent Smith Face & Shoulders (by Vince) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,6,24,41,60,59,44,11,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,25,125,198,
-225,238,249,225,215,194,86,43,2,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,28,63,167,214,227,241,249,246,245,238,228,242,202,169,112,12,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,47,116,194,224,250,248,247,250,
-252,250,247,247,249,232,233,228,232,207,11,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-11,117,233,252,251,253,244,239,241,249,245,233,216,217,233,242,242,237,224,243,
-164,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,18,133,235,244,246,246,205,193,191,196,203,
-184,167,155,129,143,183,199,213,164,143,200,130,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,
-234,243,235,226,164,138,137,132,128,113,96,83,83,79,78,90,101,124,124,103,
-121,195,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,19,246,252,230,221,140,123,109,95,90,87,78,
-74,61,59,58,59,65,69,78,91,91,94,104,206,172,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,253,
-250,217,168,131,115,100,89,79,75,69,66,58,50,48,50,55,67,71,75,79,
-86,98,128,233,164,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,149,251,243,209,144,127,114,104,87,76,71,63,
-57,56,50,51,53,52,64,67,68,78,85,94,110,175,245,78,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,210,252,
-243,193,145,131,113,104,91,82,73,67,57,57,59,57,56,60,66,59,66,78,
-84,97,103,153,224,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,18,246,252,248,202,151,143,112,106,97,86,76,69,
-62,59,67,73,69,71,72,67,69,76,87,102,111,130,218,104,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,251,252,
-253,217,166,164,120,112,110,94,80,73,71,70,74,74,79,77,77,71,66,71,
-89,101,108,132,219,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,7,132,252,252,253,229,189,168,147,120,117,107,85,74,
-69,65,67,74,78,74,71,63,65,71,90,106,111,142,214,169,3,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,202,253,251,
-250,248,206,168,165,143,127,114,88,64,53,50,54,65,67,67,64,57,56,67,
-86,102,118,156,203,206,6,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,108,234,252,252,251,251,212,162,166,154,139,125,110,79,
-66,57,53,58,61,62,63,60,63,73,89,101,130,164,213,244,19,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,178,250,253,251,
-251,251,202,170,153,140,138,134,110,100,86,75,67,68,63,59,63,66,75,79,
-93,101,132,149,221,248,158,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,38,202,250,252,252,252,238,189,168,137,103,106,111,109,110,
-105,100,98,88,76,77,83,91,103,96,105,112,116,116,227,253,181,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,208,249,251,252,
-253,225,179,167,131,107,123,148,146,157,139,132,124,120,112,115,129,133,141,169,
-196,207,194,182,208,244,171,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,77,207,248,251,251,253,223,170,163,182,216,230,244,253,253,
-253,253,245,221,178,177,191,232,253,253,253,253,253,253,251,230,171,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,209,246,252,251,
-252,234,201,206,241,253,224,227,202,251,251,249,252,235,171,125,185,207,236,250,
-251,251,251,250,241,243,176,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,80,189,196,245,249,252,227,164,205,246,251,235,233,191,251,
-251,251,251,253,156,71,134,232,248,251,251,251,247,244,248,242,176,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,218,202,173,211,
-251,231,178,195,228,249,251,253,253,251,251,250,251,241,97,66,58,234,251,250,
-252,251,250,249,251,228,173,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,77,236,228,239,207,246,220,174,180,184,242,252,247,252,251,
-252,252,253,183,94,54,63,153,253,252,251,251,251,253,252,195,178,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,199,195,186,236,
-244,212,178,168,148,185,230,243,248,249,249,248,239,125,89,54,59,99,230,225,
-225,219,203,183,218,178,178,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,100,158,176,195,148,222,217,177,171,154,131,155,186,210,227,
-225,211,199,120,83,52,48,85,199,196,203,173,152,146,209,166,88,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,151,158,182,171,
-221,240,178,174,170,159,153,176,202,200,173,176,178,124,82,56,48,74,179,197,
-181,173,166,172,220,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,50,160,142,176,229,247,190,190,191,185,178,170,152,144,
-139,165,148,146,185,155,150,173,160,190,190,183,173,196,199,78,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,197,175,
-186,240,203,201,199,201,197,174,145,144,146,164,196,236,252,237,230,250,193,160,
-177,190,184,203,202,120,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,18,165,191,192,229,212,204,200,203,196,179,155,162,
-149,128,166,247,243,243,242,242,112,112,137,172,188,215,178,196,8,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,202,
-176,228,210,204,203,193,184,169,165,165,115,90,115,203,224,236,213,156,111,85,
-115,151,178,209,224,128,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,121,233,242,250,216,214,207,200,185,169,184,149,
-109,102,115,130,166,195,180,123,109,103,109,138,180,207,221,44,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,
-230,243,216,209,208,201,195,191,179,134,118,133,137,134,168,169,161,176,130,117,
-115,131,178,212,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,204,224,235,222,212,210,213,202,195,174,154,
-173,192,194,227,241,232,216,211,213,203,177,137,194,218,4,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,
-216,230,226,225,222,215,207,197,176,192,231,235,226,197,135,114,102,112,123,126,
-150,176,210,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,137,195,228,219,242,238,228,222,212,193,208,
-211,165,163,170,187,188,195,194,199,173,171,197,196,42,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,
-192,221,210,242,244,239,233,234,235,228,211,220,234,239,246,244,246,246,245,236,
-221,216,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,91,212,213,212,231,245,239,240,231,238,234,
-235,238,240,244,244,243,244,244,240,238,236,215,81,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,
-186,186,220,214,246,244,241,237,232,231,231,224,221,212,186,172,166,140,156,186,
-207,212,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,126,184,215,210,231,246,244,239,239,235,
-223,198,181,161,176,189,169,138,134,151,219,201,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-63,192,206,209,221,238,244,243,237,235,238,228,199,208,219,230,233,217,204,200,
-221,213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,89,224,207,204,208,224,237,244,241,232,
-235,234,233,233,230,223,225,227,226,224,214,172,141,5,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,
-224,238,164,198,194,209,225,239,241,240,235,230,229,230,231,228,227,225,231,214,
-216,107,179,82,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,2,141,220,245,244,128,105,187,196,209,231,240,240,
-237,238,238,235,233,237,235,237,217,202,203,99,191,116,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,207,228,237,
-245,239,115,124,99,164,196,212,226,238,239,237,236,233,237,236,233,231,209,193,
-177,105,175,201,130,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,120,232,233,230,247,247,236,142,114,117,106,123,178,222,229,
-235,234,238,239,240,234,232,225,207,203,119,123,149,211,193,169,74,14,5,3,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,7,183,235,231,223,240,247,
-247,236,176,102,112,114,122,108,129,214,227,240,240,240,238,242,233,222,213,119,
-101,113,134,211,196,183,182,171,186,219,137,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,75,211,227,210,208,232,242,245,245,241,225,101,104,106,109,108,110,117,
-172,222,234,239,241,238,226,213,145,97,103,102,147,212,201,198,181,180,182,169,
-172,134,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,54,188,218,212,212,212,228,237,244,246,
-246,240,243,150,91,101,102,103,103,107,121,141,201,241,238,232,215,124,106,96,
-92,99,138,210,198,200,187,176,179,193,186,177,166,128,25,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,50,113,205,
-220,206,212,220,216,207,234,236,241,243,243,240,235,236,89,103,109,107,103,96,
-100,112,130,174,211,206,209,111,82,84,90,96,133,217,203,196,193,185,174,174,
-190,190,184,179,174,164,155,165,84,5,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,30,129,191,210,212,209,207,206,212,220,208,224,229,237,240,242,
-240,239,232,237,163,97,101,103,105,98,95,92,81,191,249,248,245,236,81,79,
-84,96,126,223,204,202,198,188,180,168,166,191,192,185,186,184,184,176,167,133,
-25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,7,25,84,173,209,210,210,215,205,205,
-208,205,220,211,215,226,232,236,236,239,237,239,231,231,208,91,91,98,98,103,
-101,96,73,253,239,237,235,246,150,76,82,95,119,233,204,204,206,191,186,175,
-200,207,191,198,196,192,189,185,184,187,176,73,16,14,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,111,
-174,212,221,212,212,211,210,210,205,205,204,212,208,210,217,220,230,230,235,236,
-237,236,230,231,240,102,80,84,81,82,84,71,140,253,237,224,228,246,206,71,
-80,91,102,230,206,206,213,217,198,189,235,206,195,194,200,194,195,198,195,192,
-196,191,167,155,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,146,219,225,218,223,216,209,211,207,208,208,202,203,
-208,206,205,213,210,215,227,223,228,235,234,231,231,229,226,188,45,70,69,70,
-68,53,214,249,247,211,229,245,225,69,80,87,85,198,210,197,207,217,219,204,
-237,223,200,197,195,199,194,206,202,203,203,205,204,198,179,145,3,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,224,230,220,
-208,217,214,210,211,211,208,208,206,204,206,204,210,212,215,222,228,224,221,226,
-232,229,233,228,222,238,56,56,57,57,56,74,221,245,250,226,238,198,133,123,
-69,82,76,146,219,202,205,213,212,217,214,199,206,206,200,198,209,213,211,210,
-202,208,208,214,212,188,127,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,118,206,216,219,205,208,215,216,217,211,205,206,206,205,
-205,206,203,208,216,234,247,241,227,225,230,229,228,231,223,224,150,44,56,54,
-53,100,140,193,251,227,244,107,94,162,56,69,63,88,228,199,211,206,211,219,
-218,217,185,191,201,205,216,223,222,214,218,213,214,222,221,221,213,80,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,180,213,205,218,
-206,208,216,217,213,209,208,200,207,208,209,202,199,208,215,219,236,250,248,236,
-229,230,228,229,224,213,209,87,45,52,42,105,118,136,241,211,244,103,63,108,
-81,59,48,52,218,200,203,207,210,217,208,217,212,194,197,211,223,226,228,219,
-218,219,221,229,224,227,220,182,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,52,228,221,209,212,217,206,214,220,217,209,207,205,217,222,
-221,209,203,211,215,213,209,228,246,236,235,225,228,226,227,217,201,113,80,43,
-45,40,70,110,234,206,243,107,49,48,90,58,33,35,181,209,199,204,211,216,
-212,206,214,203,205,216,228,228,229,222,223,228,231,234,232,234,220,229,2,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,118,240,235,217,207,
-213,210,213,219,219,212,208,211,217,217,220,211,209,209,211,210,211,220,217,217,
-231,227,225,229,226,219,211,101,98,58,60,39,30,140,223,205,244,118,38,48,
-76,66,26,31,127,215,197,212,204,213,209,202,206,209,208,222,230,229,227,223,
-222,231,238,240,238,240,231,239,14,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,14,192,244,238,222,215,214,212,212,221,222,214,212,211,217,216,
-220,215,209,208,205,209,212,217,216,212,224,227,227,227,228,221,213,195,7,77,
-64,46,15,194,210,213,236,231,52,35,65,51,26,26,83,218,198,201,210,207,
-207,209,198,203,209,225,230,228,229,226,227,231,243,245,244,244,228,245,92,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,228,242,240,231,218,
-211,218,215,226,228,218,215,214,222,219,224,224,216,208,206,215,217,212,212,213,
-219,224,225,230,229,225,213,224,53,13,27,50,17,199,199,217,234,237,170,29,
-48,31,20,22,53,205,191,203,208,199,201,197,197,194,209,225,231,229,230,227,
-227,237,246,247,246,245,236,245,74,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,135,243,237,241,236,222,217,216,214,219,225,217,218,216,217,217,
-220,224,218,208,204,224,216,210,210,211,212,219,222,226,227,228,223,206,171,7,
-20,39,28,185,199,222,234,243,241,89,30,29,16,19,35,183,194,197,208,204,
-203,196,198,193,210,225,231,228,230,229,228,239,246,248,247,243,239,245,24,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,242,231,238,238,226,
-218,215,216,222,222,222,214,218,219,218,220,225,228,218,203,201,239,208,207,207,
-213,215,224,223,226,227,226,208,206,36,20,25,42,163,210,226,233,239,236,233,
-29,21,15,19,30,160,192,200,207,205,197,198,199,199,206,228,229,229,228,227,
-232,241,246,247,246,240,243,245,78,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,233,245,229,234,239,232,218,228,221,221,226,222,219,217,218,217,
-219,226,229,225,211,203,216,225,204,209,211,213,219,220,224,227,226,214,200,95,
-26,19,34,137,218,226,231,239,243,218,150,19,25,26,27,139,191,200,210,206,
-200,197,193,204,213,230,231,229,227,229,231,242,246,247,248,239,245,244,150,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,3,236,245,231,236,239,242,
-230,216,229,226,227,224,219,219,216,215,215,224,225,229,219,210,199,227,206,207,
-210,209,214,215,222,223,228,219,214,150,23,23,28,115,219,224,229,237,240,231,
-207,40,37,32,28,122,190,194,208,200,196,197,189,194,214,230,229,231,232,229,
-233,242,245,248,248,238,248,246,244,58,0,0,0,0,0,0,0,0,0,0,
-
-/* #9: Tank (by Vince) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,210,217,212,225,213,209,208,212,210,195,196,212,214,203,
-208,211,196,216,223,194,193,206,216,207,182,189,201,206,217,212,213,217,200,185,
-185,215,210,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,224,221,212,224,
-218,200,208,222,215,182,209,210,212,195,214,209,204,199,191,218,206,218,212,207,
-209,218,217,205,213,222,210,211,215,214,199,215,219,211,25,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,150,222,225,175,190,215,208,205,193,169,205,207,201,198,214,180,
-207,216,197,183,151,203,204,225,218,214,220,217,218,212,210,216,206,197,209,216,
-219,189,206,214,221,210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,222,208,210,166,215,
-193,173,209,218,213,193,199,176,215,207,208,200,207,221,211,223,193,180,212,192,
-202,186,217,220,217,199,208,195,177,208,218,209,214,214,213,209,221,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,224,217,221,209,182,195,205,200,208,199,211,211,212,223,175,160,208,
-218,193,178,220,210,222,203,194,220,207,209,212,155,163,211,182,195,216,202,204,
-186,194,181,210,220,217,200,224,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,211,217,221,225,209,216,214,217,
-210,210,181,199,219,223,220,215,186,182,181,209,185,171,225,224,150,223,223,225,
-220,205,223,207,218,224,215,212,211,216,202,214,203,205,219,222,219,212,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,219,200,217,56,210,214,180,220,201,184,184,203,224,218,206,180,180,222,222,
-216,220,223,223,216,213,191,200,210,222,223,203,216,224,225,224,225,198,211,206,
-210,208,214,204,185,206,211,218,205,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,224,217,188,201,210,193,212,221,217,217,
-212,206,183,217,200,184,211,222,210,220,203,224,224,150,224,188,189,218,210,204,
-212,213,211,225,218,217,209,213,210,207,196,211,216,208,186,212,212,215,202,215,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,
-218,210,220,217,214,213,210,222,216,224,222,210,217,205,222,220,179,212,222,202,
-199,212,210,218,203,205,222,223,180,208,204,217,218,212,210,210,178,211,222,216,
-210,194,221,183,194,212,191,218,194,216,224,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,220,216,180,214,221,221,220,215,219,211,217,
-218,221,210,215,221,223,224,205,210,222,216,215,215,210,221,222,225,219,212,223,
-219,225,213,193,191,212,197,218,217,213,218,184,210,213,206,194,183,222,220,217,
-208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,223,
-215,225,218,196,185,217,208,217,209,214,203,208,220,217,223,214,203,224,219,220,
-210,221,224,223,221,224,220,224,211,190,203,222,222,222,219,212,220,210,188,213,
-182,204,219,189,224,216,199,206,218,220,196,219,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,150,225,221,221,219,215,25,210,210,223,221,225,
-212,220,209,180,220,220,224,219,221,225,224,218,219,206,210,220,221,224,223,220,
-212,224,222,223,216,213,221,202,186,223,211,186,211,222,205,223,210,219,198,220,
-185,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,220,
-224,205,201,210,191,220,211,210,119,119,224,222,220,220,224,220,210,222,217,224,
-150,208,200,215,217,218,203,221,222,223,222,220,200,192,176,163,202,219,203,212,
-222,218,220,215,221,209,216,206,205,212,212,216,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,180,223,221,223,217,216,225,205,219,225,217,223,210,
-150,224,214,200,216,207,208,220,222,223,221,222,219,216,209,204,200,207,218,215,
-198,153,129,104,97,72,93,167,170,186,218,225,221,221,214,209,207,207,217,212,
-217,218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,223,217,220,
-223,197,188,221,216,223,224,217,215,212,217,224,180,218,211,213,212,221,215,195,
-213,220,215,199,182,133,127,111,138,121,107,97,78,75,55,43,54,82,106,134,
-191,222,219,223,201,206,205,213,220,197,206,208,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,222,221,225,221,216,224,211,220,224,220,218,218,214,
-213,218,215,203,211,197,204,205,188,194,168,204,193,141,100,68,66,50,43,48,
-58,58,62,48,39,41,40,65,81,99,153,165,211,221,186,200,207,176,211,209,
-202,201,217,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,210,225,
-223,210,223,217,218,222,222,199,203,170,173,179,157,158,161,181,173,203,167,185,
-155,171,148,93,53,30,31,21,16,19,25,28,41,44,37,38,42,54,57,101,
-145,164,148,189,214,213,192,169,203,204,213,206,88,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,222,219,223,221,223,223,209,212,225,207,207,189,148,
-113,108,98,89,99,122,137,150,156,152,111,77,64,17,13,16,15,13,14,14,
-17,25,27,35,36,36,39,49,56,97,156,174,202,169,166,180,214,195,214,217,
-217,213,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,221,215,
-211,210,224,188,192,197,197,207,171,117,84,83,75,66,70,72,77,93,123,90,
-50,22,10,7,5,7,9,8,11,16,16,22,28,33,35,34,39,52,57,81,
-188,155,208,185,200,212,222,209,217,214,216,214,207,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,221,211,222,223,217,194,197,224,208,207,198,149,84,
-73,70,71,62,51,50,48,47,52,47,31,14,4,3,6,6,6,8,11,14,
-16,20,29,33,34,41,44,57,63,87,145,204,214,218,216,221,210,215,214,219,
-215,218,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,220,223,
-224,220,220,214,223,225,213,192,132,80,72,71,68,53,45,36,33,28,27,23,
-21,11,7,6,5,6,7,6,9,14,15,19,27,31,32,40,42,60,69,98,
-167,191,217,215,216,214,211,206,216,212,216,220,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,56,220,221,213,210,225,221,219,219,217,206,124,76,
-72,69,67,53,50,38,29,23,22,19,20,14,9,8,8,8,10,9,10,13,
-18,21,25,31,37,42,57,72,73,91,173,196,177,164,211,202,208,206,212,215,
-214,214,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,221,215,
-223,225,225,222,199,221,199,188,129,88,71,70,64,53,47,38,30,26,20,22,
-20,17,11,11,8,7,10,8,11,12,13,18,24,33,40,46,65,72,68,88,
-135,199,195,207,211,215,215,211,213,212,214,214,25,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,219,224,218,216,218,211,218,221,204,195,143,100,
-76,70,62,57,56,45,33,27,24,30,21,17,12,12,9,8,8,8,8,8,
-7,12,24,31,43,57,64,67,73,73,97,159,196,212,217,216,217,214,211,215,
-208,198,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,217,225,
-223,222,222,225,223,210,206,205,155,100,79,75,73,61,52,48,38,33,29,23,
-23,18,12,10,7,7,6,3,4,4,5,12,23,30,48,53,51,58,67,69,
-86,121,179,203,215,217,218,211,212,210,207,193,199,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,224,223,210,222,225,223,225,212,220,221,183,114,
-91,84,72,64,50,44,38,31,25,19,18,15,11,11,8,8,6,5,2,3,
-5,12,19,21,27,34,37,48,47,71,83,99,144,187,211,214,213,215,209,198,
-209,193,210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,210,
-224,180,225,224,223,225,224,223,189,132,98,91,80,69,51,36,30,23,22,18,
-17,18,13,10,9,7,8,4,3,4,2,5,11,13,29,51,70,62,60,61,
-73,88,110,141,188,207,210,215,215,195,192,180,225,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,119,221,180,210,219,223,88,178,180,224,200,133,
-109,91,75,68,54,35,28,19,18,18,18,14,14,15,14,8,6,6,5,3,
-3,2,16,48,96,135,113,95,103,115,102,87,90,96,138,202,210,214,214,191,
-161,152,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,
-180,225,219,221,222,225,180,222,181,120,101,81,68,56,52,33,25,15,14,15,
-16,17,14,16,11,9,7,9,7,6,22,76,103,136,167,149,107,107,108,106,
-120,104,87,78,104,157,207,199,202,186,149,115,213,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,180,223,225,180,223,213,119,225,220,183,118,
-93,73,60,43,37,29,21,21,15,14,22,19,16,21,20,12,10,10,14,28,
-81,125,165,182,168,120,97,87,94,105,111,114,87,77,85,125,181,208,208,202,
-179,113,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-210,221,225,150,180,223,221,225,198,130,116,132,123,72,49,34,33,23,21,21,
-16,23,18,19,19,17,16,30,65,95,172,191,194,152,95,89,98,104,102,114,
-119,112,91,77,76,95,170,197,200,192,150,95,116,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,224,221,222,150,225,215,215,180,161,
-173,184,202,186,137,111,87,78,54,31,25,24,23,30,31,26,48,72,116,178,
-196,179,167,151,143,152,155,171,187,153,118,101,76,69,64,75,148,204,198,116,
-91,68,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,222,221,223,225,225,220,163,181,179,163,187,204,204,199,181,128,121,113,
-68,41,39,51,55,61,139,159,164,183,168,183,175,200,192,207,159,120,162,144,
-107,72,58,56,63,69,115,194,169,110,65,74,121,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,150,222,222,223,210,224,165,179,
-147,126,119,134,158,186,207,211,202,169,178,131,74,75,92,96,142,188,170,161,
-179,175,202,207,207,207,205,47,89,81,48,45,42,50,51,60,97,176,150,103,
-82,73,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,220,222,215,210,221,160,181,161,124,125,153,153,169,189,200,181,178,
-203,205,124,56,38,51,101,153,164,174,204,203,207,207,208,121,84,54,80,53,
-34,28,30,38,47,62,101,180,129,122,38,106,122,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,25,220,215,213,212,147,156,
-171,185,183,176,203,208,206,206,203,193,176,171,118,38,14,14,32,99,136,118,
-70,166,207,208,143,150,59,77,74,29,24,24,25,36,48,57,118,176,120,99,
-39,80,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,221,210,175,204,134,128,148,201,222,127,201,208,208,205,188,209,
-188,169,106,30,8,7,19,43,58,41,18,48,71,109,72,102,101,64,32,18,
-17,16,20,34,50,63,141,174,122,77,63,78,113,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,205,178,203,128,108,
-110,136,154,106,114,203,194,168,140,99,108,103,69,27,10,6,15,26,20,20,
-17,28,32,36,41,31,20,16,15,16,16,17,25,43,57,75,160,170,118,80,
-46,81,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,202,154,189,117,98,82,81,123,99,81,63,67,62,63,60,
-49,57,54,28,12,9,20,26,20,16,13,12,19,24,21,17,14,14,15,14,
-18,20,32,50,63,99,168,165,94,48,86,202,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,155,178,119,89,
-64,58,84,108,101,97,87,77,60,40,31,33,52,30,9,9,20,22,21,20,
-17,12,8,11,14,18,15,16,18,22,23,29,41,61,79,118,172,170,101,116,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,217,172,154,124,92,59,41,49,60,69,68,53,46,40,26,
-28,36,53,30,12,8,18,23,23,25,24,15,12,9,9,9,13,14,22,24,
-30,36,52,70,97,155,168,174,206,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,217,208,100,121,93,
-60,41,34,41,37,35,35,35,25,18,28,44,52,26,12,9,17,24,29,30,
-32,22,13,9,10,9,7,14,25,25,30,44,57,86,126,169,166,185,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,25,208,125,137,116,80,53,39,31,30,30,27,22,18,18,
-30,54,44,21,7,3,12,22,29,35,42,34,15,10,6,8,8,12,18,22,
-39,60,78,104,150,166,163,189,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,131,111,142,
-100,72,54,44,36,29,24,17,20,20,39,65,42,18,8,3,9,19,30,32,
-30,49,18,10,8,7,7,11,18,25,46,68,83,115,163,151,156,189,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,88,197,93,133,133,96,73,53,44,30,21,18,17,22,
-51,55,50,18,13,10,13,27,40,24,28,46,18,8,10,8,9,13,19,29,
-52,61,82,130,149,146,155,188,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,181,150,
-160,123,88,63,42,31,21,20,17,18,42,50,74,25,20,17,25,66,85,51,
-55,73,16,6,9,9,11,15,20,31,51,64,90,137,141,142,152,190,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,219,218,193,144,107,83,51,38,26,22,19,17,
-43,74,124,86,39,35,60,141,213,186,123,102,8,7,9,10,13,15,23,37,
-55,79,105,136,137,136,144,192,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,217,
-203,178,129,89,61,42,32,25,18,16,24,129,179,208,123,109,120,208,155,128,
-141,39,9,8,10,12,13,20,27,45,60,82,117,144,133,134,147,199,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,212,190,157,102,71,49,38,29,22,20,
-23,107,180,177,192,173,165,109,58,42,26,17,10,9,12,15,20,23,34,50,
-75,103,139,141,132,133,164,200,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-221,194,185,127,82,62,46,40,31,29,31,54,90,104,134,158,114,56,24,23,
-16,20,14,13,18,20,26,34,49,66,90,127,147,149,140,138,181,197,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,207,176,163,106,74,55,45,38,33,
-29,32,47,56,60,60,55,34,17,17,17,17,15,22,30,28,41,56,69,88,
-109,143,147,149,143,153,190,194,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,217,181,175,137,95,76,59,46,43,33,37,46,44,29,24,28,24,12,13,
-12,16,20,30,39,53,66,72,81,106,121,154,152,158,143,174,188,188,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,216,190,169,167,125,98,79,64,55,
-45,45,46,38,17,12,13,14,10,14,15,17,23,36,57,95,115,112,99,117,
-140,157,160,158,163,193,189,185,208,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,
-219,210,215,182,175,155,123,112,80,74,61,51,43,39,39,28,14,20,59,104,
-131,141,148,154,159,187,181,126,110,126,149,160,169,164,185,208,181,193,223,222,
-212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,225,219,224,210,150,119,197,179,177,139,134,111,119,
-95,73,105,149,153,147,133,133,161,170,195,193,194,191,176,162,100,108,121,133,
-152,169,162,181,210,195,178,197,220,218,210,207,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,221,218,221,210,
-150,180,150,211,193,184,165,135,131,159,181,184,189,189,194,193,188,192,171,106,
-40,32,60,63,75,115,76,97,110,138,167,174,174,206,212,191,181,199,219,219,
-219,219,201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,225,222,222,220,220,222,224,224,210,210,210,208,195,189,149,121,134,
-160,197,174,120,92,72,66,66,47,36,40,62,67,95,138,106,103,116,130,152,
-175,170,204,217,201,183,179,195,218,217,217,218,214,208,150,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,218,217,219,219,221,219,223,222,223,
-210,223,225,216,201,209,199,178,134,116,98,123,116,94,78,59,41,34,44,55,
-62,81,132,155,137,137,131,126,125,142,163,192,217,215,196,179,177,202,217,218,
-217,215,219,207,207,211,74,33,6,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,220,
-216,218,216,215,217,219,219,216,222,210,222,223,210,220,191,205,208,205,172,115,
-106,106,143,154,134,115,125,159,174,179,172,175,177,157,141,156,123,107,103,131,
-179,215,216,208,187,176,176,199,216,215,216,211,209,208,208,208,194,157,80,6,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,25,217,219,215,214,217,215,217,217,212,210,216,225,221,
-219,221,223,221,184,186,212,212,201,167,140,127,133,166,187,190,188,188,185,181,
-180,178,151,125,112,89,73,77,91,149,209,216,212,192,181,165,174,199,215,214,
-212,208,208,208,208,208,208,208,197,136,44,6,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,57,211,208,208,209,
-211,214,216,214,213,206,214,210,223,218,220,221,222,219,181,172,189,216,212,190,
-167,165,172,166,163,170,177,175,165,147,131,122,104,81,74,67,57,71,106,189,
-212,212,201,186,173,171,178,200,216,211,209,208,208,208,208,208,208,208,208,206,
-162,74,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,35,125,208,208,208,208,208,208,208,212,211,208,204,221,225,216,217,
-218,220,222,217,178,161,170,194,213,210,182,145,134,127,123,132,130,103,62,56,
-61,53,49,65,63,65,62,91,164,212,210,206,190,174,172,165,174,197,215,209,
-208,208,208,208,208,208,208,208,208,208,208,177,81,7,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,44,176,208,208,208,208,208,208,
-208,208,209,199,197,208,224,222,217,214,217,219,220,218,180,152,156,172,194,210,
-198,129,100,93,94,73,64,58,55,60,67,55,57,59,72,76,87,153,206,211,
-202,194,181,170,163,167,172,191,212,207,208,208,208,208,208,208,208,208,208,208,
-208,208,171,52,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,47,178,207,208,208,208,208,208,208,208,208,207,198,191,212,225,213,215,212,
-214,217,220,219,188,149,143,153,170,189,209,183,115,102,91,82,72,62,69,55,
-65,65,82,96,110,118,165,211,213,211,197,182,174,166,162,164,167,192,218,207,
-208,208,208,208,208,208,208,208,208,208,208,208,208,148,17,1,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,17,143,208,208,208,208,208,208,208,208,
-208,208,208,205,190,215,221,210,216,207,214,219,220,218,197,151,144,136,155,170,
-191,203,180,133,107,97,96,95,82,88,89,94,129,167,178,190,212,216,215,206,
-187,175,170,161,157,163,157,196,219,207,208,208,208,208,208,208,208,208,208,208,
-208,208,208,208,95,5,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
-87,208,208,208,208,208,208,208,208,208,208,208,208,207,196,220,211,210,212,207,
-214,215,219,215,211,136,135,140,138,155,175,188,205,196,170,161,146,125,121,135,
-158,180,194,196,204,211,213,215,211,195,182,174,166,158,154,155,151,209,210,210,
-208,208,208,208,208,208,208,208,208,208,208,208,208,208,166,29,0,0,0,0,
-0,0,0,0,0,0,0,0,0,17,141,208,208,208,208,208,208,208,208,208,
-208,208,208,207,192,221,210,205,214,204,213,216,215,214,180,133,129,127,133,140,
-148,172,191,206,204,200,191,189,182,184,190,191,194,200,205,208,212,210,202,190,
-177,169,163,161,153,149,165,217,205,206,208,208,208,208,208,208,208,208,208,208,
-208,208,208,208,208,68,0,0,0,0,0,0,0,0,0,0,0,0,0,35,
-208,208,208,208,208,208,208,208,208,208,208,208,207,203,193,217,208,201,211,202,
-209,214,215,214,220,158,124,123,129,136,143,152,175,193,203,202,198,193,192,186,
-188,191,197,199,205,209,208,205,193,183,178,164,163,163,157,162,191,210,206,203,
-208,207,208,208,208,208,208,208,208,208,208,208,208,208,208,100,0,0,0,0,
-0,0,0,0,0,0,0,0,0,35,208,208,208,208,208,208,208,208,208,208,
-208,208,206,205,200,212,206,194,210,204,207,208,213,211,211,198,122,118,121,129,
-136,147,162,177,189,199,198,199,196,192,188,187,199,204,204,204,205,193,188,178,
-175,167,164,158,155,150,202,211,205,204,210,205,208,208,208,208,208,208,208,208,
-208,208,208,208,208,120,0,0,0,0,0,0,0,0,0,0,0,0,0,33,
-189,208,208,208,208,208,208,208,208,208,208,207,193,208,193,209,199,198,207,202,
-201,208,207,209,204,217,143,118,120,128,133,143,154,168,183,195,196,198,200,197,
-184,188,206,202,202,198,196,188,180,175,173,167,164,152,145,146,207,206,206,208,
-211,211,206,208,208,208,208,208,208,208,208,208,208,208,208,110,0,0,0,255,
-
-/* #10 Dodge this! (by Chris_C) */
-0,0,0,0,0,0,0,0,0,6,15,44,55,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,181,181,181,175,169,99,4,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,181,180,
-173,170,164,163,139,106,57,5,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,181,181,181,181,181,181,179,172,165,162,157,
-136,130,124,96,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,181,181,181,181,179,179,179,181,171,158,158,150,135,127,125,121,
-116,71,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,73,71,69,60,34,18,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,
-181,181,181,178,179,181,181,174,156,149,144,139,134,131,127,126,120,98,69,
-17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,60,93,96,105,136,139,103,58,123,24,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,181,181,181,181,180,179,178,
-179,181,181,181,154,131,126,127,126,129,129,132,128,118,108,85,54,21,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,82,74,65,124,164,171,
-176,179,180,166,145,181,22,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,173,181,181,181,181,180,178,178,179,181,181,181,181,
-159,112,99,97,101,107,115,119,124,126,122,111,97,77,46,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,30,133,80,93,123,170,181,181,180,181,179,170,139,
-155,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,178,181,181,181,181,180,179,178,178,177,180,181,181,181,166,139,120,103,
-87,76,82,94,107,117,121,120,116,112,121,61,28,140,169,122,0,0,13,
-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,149,151,166,113,161,178,181,181,181,181,181,175,142,130,181,79,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,181,181,
-181,180,178,177,176,176,178,181,181,181,181,168,169,167,161,146,123,99,80,
-76,93,113,123,125,110,124,143,160,181,180,153,58,105,125,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,181,169,129,179,
-126,181,181,181,181,181,181,181,161,161,181,180,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,181,181,181,180,181,179,177,176,174,
-175,176,179,181,181,179,168,165,165,164,164,164,164,160,142,114,91,91,112,
-124,126,115,108,170,181,129,149,117,177,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,170,175,168,181,160,181,181,181,181,181,
-181,181,173,176,181,180,181,50,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,181,181,181,180,180,179,178,176,174,173,174,177,178,181,
-179,167,167,166,165,164,162,161,159,157,158,156,147,133,128,126,135,138,138,
-181,131,116,127,137,132,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,93,181,180,181,175,181,181,181,181,181,181,181,175,174,181,181,
-164,166,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-181,181,181,180,179,178,176,173,173,172,172,174,175,179,175,168,168,167,167,
-167,164,162,158,157,154,152,149,149,145,142,137,135,143,140,142,130,120,113,
-134,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,169,
-181,169,181,181,181,177,174,168,153,155,156,168,181,181,174,157,167,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,181,179,179,
-178,175,173,172,170,170,171,173,177,173,169,169,172,170,169,170,165,164,160,
-159,155,152,149,147,143,140,135,129,127,137,144,131,136,133,120,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,9,150,181,167,181,181,161,141,
-138,140,140,138,135,130,146,178,167,161,166,174,10,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,181,181,181,180,178,177,174,172,171,168,
-168,169,171,174,171,169,170,171,171,170,170,170,167,166,164,162,157,152,149,
-146,143,139,134,129,123,175,150,128,136,138,2,0,0,0,0,0,0,0,
-0,0,0,0,0,0,25,159,181,176,181,145,130,124,127,135,136,136,132,
-121,119,144,167,162,167,181,28,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,181,181,181,179,178,177,173,171,167,166,166,167,168,170,167,
-168,169,170,169,168,166,167,166,165,164,162,163,164,162,157,150,142,138,130,
-125,174,173,174,168,127,40,0,0,0,0,0,0,0,0,0,0,0,0,
-0,16,177,173,181,142,130,116,121,126,131,132,128,122,110,103,107,126,168,
-165,181,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,174,
-181,181,181,181,181,180,172,167,161,163,165,165,167,167,169,169,170,168,168,
-165,165,166,163,161,160,158,156,153,154,151,150,151,147,130,171,173,169,172,
-131,99,0,0,0,0,0,0,0,0,0,0,0,0,0,38,177,167,181,
-135,124,116,120,123,127,129,121,112,96,89,90,104,152,165,176,60,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,171,181,181,181,181,181,
-181,181,181,181,165,161,161,164,165,167,171,170,169,169,168,168,167,164,163,
-161,160,158,155,154,148,144,138,137,128,169,174,171,171,137,108,0,0,0,
-0,0,0,0,0,0,0,0,0,0,15,177,158,181,134,123,119,122,122,
-126,126,121,112,97,91,89,94,144,154,154,3,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,171,181,181,181,181,181,181,181,181,181,181,
-181,181,171,160,164,171,171,170,168,168,168,167,164,164,162,158,157,154,151,
-146,143,138,132,127,165,175,171,172,141,143,4,0,0,0,0,0,0,0,
-0,0,0,0,0,36,130,137,175,154,129,116,123,124,128,130,123,113,110,
-104,95,81,131,153,66,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,172,181,181,181,181,181,181,181,181,181,181,181,181,181,181,175,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,174,159,
-177,181,180,181,162,146,34,0,0,0,0,0,0,0,0,0,0,0,0,
-19,105,145,162,168,181,170,139,128,129,135,147,165,174,161,119,91,148,133,
-75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,173,181,
-181,181,181,181,178,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,178,181,181,170,175,181,181,153,181,150,156,
-170,27,0,0,0,0,0,0,0,0,0,0,0,0,0,88,150,161,181,
-181,181,171,138,138,155,180,181,181,181,163,105,141,152,33,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,173,181,179,178,175,172,172,
-176,179,179,179,178,181,181,180,179,179,178,179,178,176,175,173,173,172,169,
-168,165,164,161,169,161,153,161,181,181,136,181,155,148,181,52,0,0,0,
-0,0,0,0,0,0,0,0,0,0,73,119,156,173,177,145,181,160,155,
-181,181,181,181,181,109,77,127,126,5,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,172,181,174,174,173,172,171,170,172,177,175,176,
-181,181,174,176,175,175,173,173,172,173,174,172,175,170,174,173,175,166,166,
-150,155,172,181,172,165,181,177,135,169,73,0,0,0,0,0,0,0,0,
-0,0,0,0,0,64,53,139,158,139,169,178,136,160,181,181,181,180,154,
-161,132,99,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,177,181,174,173,171,170,170,168,169,173,175,173,181,181,172,174,178,
-180,179,181,175,180,178,175,174,170,174,167,165,161,160,166,156,181,170,180,
-181,163,147,131,137,102,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,71,106,126,134,159,117,118,112,143,180,181,167,155,108,82,96,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,174,
-173,170,168,167,166,169,172,173,173,181,181,173,175,181,178,176,174,171,170,
-169,165,165,165,162,163,161,161,153,176,170,181,156,181,181,181,140,130,128,
-135,76,3,0,0,0,0,0,0,0,0,0,0,0,0,58,97,109,118,
-114,99,115,110,88,126,148,138,103,88,72,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,181,181,172,171,169,170,167,166,
-166,167,170,171,175,181,176,171,173,170,169,168,169,169,168,167,166,166,165,
-165,163,163,161,178,181,181,153,180,181,181,177,137,132,104,0,8,47,0,
-0,0,0,0,0,0,0,0,0,0,72,81,103,114,112,103,114,103,97,
-132,120,113,93,88,40,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,179,181,170,170,170,167,167,166,166,166,166,165,166,
-181,179,170,171,170,169,169,169,167,167,166,166,166,165,163,161,181,181,159,
-181,181,153,181,181,177,153,142,143,101,0,14,20,3,0,0,0,0,0,
-0,0,0,0,0,56,74,98,111,111,106,105,93,108,120,111,101,87,89,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,177,181,171,167,167,165,164,163,161,161,160,157,158,181,181,171,171,171,
-169,168,169,169,168,166,166,166,165,165,163,181,178,165,181,181,162,181,181,
-181,160,148,167,142,5,8,30,47,0,0,0,0,0,0,0,0,0,0,
-0,90,96,101,106,112,135,118,106,102,98,90,87,50,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,173,165,
-161,158,156,155,153,157,161,165,173,181,181,170,172,170,170,168,169,168,167,
-166,166,164,164,163,163,181,170,164,181,181,167,181,181,181,163,165,181,151,
-36,11,39,89,0,0,0,0,0,0,0,0,0,0,0,68,89,114,125,
-143,144,142,116,114,99,84,93,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,181,181,165,155,152,152,153,156,163,
-168,173,178,181,181,181,169,171,174,175,176,176,178,178,180,181,181,181,181,
-181,105,181,181,181,181,181,181,181,181,165,181,181,151,51,37,57,89,0,
-0,0,0,0,0,0,0,0,0,0,11,83,103,104,147,164,164,120,104,
-97,95,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,181,181,156,152,158,161,167,174,178,181,181,181,181,181,
-181,180,181,181,181,181,181,181,181,181,181,181,181,181,72,30,181,180,181,
-181,181,181,181,181,168,181,181,162,136,119,74,94,0,0,0,0,0,0,
-0,0,0,0,0,60,97,95,116,120,132,121,105,99,87,84,18,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,181,170,167,174,179,181,181,181,181,180,178,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,140,37,102,181,181,181,181,181,181,181,181,
-174,181,181,171,168,155,99,90,0,0,0,0,0,0,0,0,0,0,50,
-108,113,105,106,130,136,128,103,92,84,90,73,64,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,179,181,
-181,181,180,174,165,145,162,181,181,181,178,176,174,170,172,179,181,180,170,
-167,165,168,127,61,143,181,181,181,181,181,181,181,181,181,181,181,175,169,
-163,117,73,0,0,0,0,0,0,0,0,15,87,168,153,114,122,118,122,
-125,112,107,89,84,86,95,105,121,52,25,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,179,173,161,154,75,0,
-23,181,181,181,166,165,159,152,146,91,44,100,151,181,166,166,167,126,82,
-155,181,181,181,181,181,181,181,181,181,181,176,174,171,161,122,48,0,0,
-0,0,0,0,16,80,117,122,142,99,159,129,136,136,112,96,127,94,86,
-91,103,130,142,134,27,40,66,82,45,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,181,151,104,
-40,27,3,0,0,0,0,132,170,181,164,163,126,99,153,173,168,181,181,
-181,181,181,181,181,181,175,171,165,156,121,16,0,0,0,0,3,49,100,
-131,133,136,125,144,140,176,144,146,123,87,117,113,89,100,134,164,150,158,
-157,109,90,78,85,81,4,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,15,31,0,0,0,0,0,0,0,
-0,0,104,172,181,168,161,103,119,149,168,175,161,181,181,181,181,181,181,
-181,176,173,158,142,111,33,8,0,0,10,19,10,11,33,76,113,115,133,
-148,174,181,163,143,90,123,134,104,119,129,141,171,156,176,149,115,110,105,
-112,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,181,181,
-181,151,78,138,151,166,173,150,181,181,181,181,181,181,172,175,172,156,125,
-107,57,52,51,19,12,23,40,53,58,49,41,62,86,149,150,181,181,181,
-138,122,149,143,128,132,165,181,159,165,178,127,114,112,109,100,89,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,181,181,181,111,98,134,158,
-167,168,160,153,181,181,181,181,181,168,156,133,152,110,104,67,65,64,57,
-21,8,22,64,83,53,36,19,82,178,175,176,181,181,181,181,181,166,147,
-174,181,180,178,163,176,170,107,108,103,91,90,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,164,181,181,113,91,136,161,165,170,166,129,181,
-181,181,181,181,170,152,137,126,111,103,82,76,79,74,63,34,19,35,98,
-107,108,106,121,181,180,181,180,181,181,181,181,179,181,181,181,181,181,164,
-173,181,148,102,101,88,87,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,146,181,181,131,53,142,162,169,171,174,134,178,181,181,181,181,169,
-155,133,113,113,97,91,88,86,84,83,71,41,26,70,110,102,100,125,181,
-181,181,181,181,181,181,181,172,181,181,181,176,181,172,169,179,180,118,96,
-90,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,181,181,
-152,35,124,165,152,142,172,147,150,181,181,181,181,165,157,130,113,109,93,
-93,92,87,85,90,90,83,58,54,114,106,97,155,181,181,181,181,181,181,
-178,181,181,181,181,181,171,181,181,161,176,181,159,99,93,44,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,69,181,181,178,46,89,162,154,
-143,164,154,136,181,181,181,181,170,157,126,113,99,92,94,93,94,92,94,
-94,92,94,81,110,115,107,181,181,181,181,181,173,181,181,177,181,181,181,
-181,181,181,181,167,175,181,169,133,90,38,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,43,181,181,181,60,85,141,153,153,164,152,129,181,
-181,181,181,170,157,104,112,94,92,92,94,94,96,95,93,94,95,91,109,
-119,150,181,181,181,181,181,180,181,181,181,181,181,181,181,181,181,181,181,
-174,179,171,134,98,33,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,24,181,181,181,111,80,149,159,153,169,143,131,179,170,175,181,181,154,
-111,104,99,99,94,94,95,95,95,95,92,96,91,121,143,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,178,174,127,105,
-13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,181,181,
-164,103,162,171,165,161,140,145,181,172,166,169,171,157,122,127,96,97,99,
-97,95,95,96,95,95,95,88,137,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,177,144,99,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,181,181,181,163,176,159,167,181,
-131,139,164,176,173,163,146,121,126,108,149,101,103,100,99,98,97,98,98,
-96,95,103,170,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,178,155,101,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,181,181,181,157,164,169,173,176,158,146,178,176,172,
-158,132,105,107,138,142,101,102,101,101,101,100,99,100,100,94,168,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,168,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,155,181,181,146,83,131,169,173,163,163,172,176,173,156,119,108,125,130,
-121,102,102,104,104,100,102,101,102,115,174,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,176,156,59,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,30,0,
-0,50,169,170,166,160,161,166,171,155,120,118,138,126,119,108,109,108,114,
-113,100,141,161,181,181,180,181,179,178,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,176,162,111,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,152,159,
-161,163,168,174,151,116,138,130,129,109,63,49,53,13,0,12,172,168,173,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,173,155,131,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,116,142,173,155,160,165,167,146,
-121,161,131,119,88,0,0,0,0,0,0,147,171,179,181,181,181,181,181,
-179,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-178,165,146,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,80,149,176,181,166,155,152,139,164,150,121,103,122,
-0,0,0,0,0,0,110,176,181,181,181,181,181,181,178,178,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,178,173,164,156,120,96,137,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,55,150,173,177,178,179,176,179,171,147,112,105,145,0,0,0,0,0,
-0,81,165,172,176,180,181,181,181,181,180,181,181,181,181,181,181,181,181,
-181,181,181,181,180,168,148,133,130,139,97,78,133,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,152,172,176,
-176,172,174,175,171,144,109,133,165,0,0,0,0,0,0,50,170,175,179,
-178,177,178,179,181,181,181,181,181,181,181,181,181,181,181,181,176,162,149,
-140,145,150,147,136,92,72,91,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,124,174,174,174,172,173,173,171,
-143,112,161,161,0,0,0,0,0,0,6,155,170,177,181,181,181,180,181,
-181,181,181,181,181,181,181,181,181,175,167,162,162,169,168,156,139,120,120,
-106,127,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,57,174,169,169,168,170,172,169,136,120,156,145,0,
-0,0,0,0,0,0,135,165,168,168,177,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,180,174,163,157,158,167,174,162,139,35,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,21,143,158,158,158,162,161,147,139,127,139,92,0,0,0,0,0,0,
-0,86,171,176,179,178,179,177,177,180,181,181,181,181,181,181,181,181,181,
-176,169,165,164,168,174,179,172,159,135,110,99,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,125,152,176,
-176,174,171,166,162,114,157,0,0,0,0,0,0,0,0,42,159,170,180,
-181,181,181,181,181,181,181,181,181,181,181,181,173,174,178,181,181,181,181,
-181,181,181,181,122,135,116,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,2,129,141,160,168,172,174,160,140,
-131,126,0,0,0,0,0,0,0,0,0,153,162,169,177,179,180,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-150,133,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,133,142,145,155,167,166,136,119,169,40,0,0,0,
-0,0,0,0,0,0,86,163,165,171,178,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,152,129,64,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,140,154,147,145,160,154,124,116,172,0,0,0,0,0,0,0,0,0,
-0,27,167,172,177,180,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,154,129,99,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,161,147,147,
-160,141,112,174,115,0,0,0,0,0,0,0,0,0,0,0,153,171,178,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,155,127,106,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,56,162,151,141,153,132,127,181,24,
-0,0,0,0,0,0,0,0,0,0,0,85,164,170,178,180,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,156,
-124,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,41,135,152,131,165,70,0,0,0,0,0,0,
-0,0,0,0,0,0,58,170,174,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,157,128,108,17,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,32,161,175,179,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,136,105,34,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,152,168,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,146,108,58,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,20,167,167,177,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,150,
-112,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,23,154,168,169,178,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,152,123,76,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-81,154,175,181,181,179,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,181,181,181,181,181,181,81,147,132,73,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,165,181,178,181,
-181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
-181,157,174,181,150,62,0,0,0,0,0,
 
-/* #11: Seraph (by Chris_C) */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,2,0,0,0,0,0,0,11,12,12,13,14,17,2,0,0,0,0,
-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,32,29,
-41,105,175,207,207,210,206,209,219,205,168,139,108,50,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,19,86,160,224,244,244,244,244,244,244,244,244,
-244,243,244,244,244,244,244,244,244,218,114,35,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,25,
-152,207,223,244,244,244,242,243,243,242,243,241,242,241,241,243,242,242,242,
-241,241,241,242,244,244,243,192,71,23,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,25,119,210,244,242,240,239,241,
-241,241,241,241,241,242,243,243,242,242,243,242,242,241,241,241,240,242,242,
-242,242,244,238,174,95,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,4,119,228,243,241,240,239,239,240,241,241,241,243,242,240,
-240,241,241,241,242,241,241,240,240,243,243,241,242,243,242,240,242,239,236,
-244,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,66,184,
-233,236,237,237,240,241,241,242,242,242,241,242,241,240,240,238,232,233,238,
-240,239,239,240,242,242,241,241,240,241,242,242,241,241,242,234,167,28,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,11,90,136,196,223,236,239,240,241,242,243,
-240,240,241,237,238,235,232,231,227,224,222,222,225,227,228,230,234,238,240,
-241,241,240,239,241,243,242,241,239,241,242,239,212,77,0,1,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,120,194,226,238,241,239,240,242,243,241,242,238,229,221,219,216,
-214,213,212,208,205,198,205,209,205,209,219,224,229,235,236,237,240,241,240,
-241,241,242,240,239,242,242,243,213,49,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,209,228,
-238,238,239,241,242,241,242,239,228,210,195,188,189,187,186,190,190,192,190,
-177,190,197,196,202,209,215,221,223,229,236,240,240,241,241,242,241,241,242,
-241,242,242,239,174,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,119,238,230,238,237,235,237,239,234,
-221,210,198,180,171,171,172,173,178,180,176,174,180,175,169,183,190,193,204,
-207,210,217,220,227,235,238,239,240,239,239,239,239,240,241,240,239,238,244,
-107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,21,220,224,231,238,240,235,217,203,185,164,159,160,160,161,
-161,163,168,171,171,170,174,175,174,176,187,189,191,201,206,208,215,219,224,
-233,237,239,241,240,239,238,239,241,240,239,240,238,240,229,40,0,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,76,
-224,226,231,239,235,192,160,155,151,148,150,152,153,154,157,158,164,168,173,
-178,184,187,188,192,197,195,195,201,204,206,213,219,224,230,235,238,240,241,
-239,237,240,240,239,239,239,238,240,237,132,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,2,0,123,238,230,235,233,188,
-144,141,146,146,145,145,144,146,152,154,156,164,170,181,190,194,196,196,197,
-198,197,198,201,204,204,212,219,223,228,234,239,241,241,242,240,240,241,241,
-241,240,240,240,244,214,54,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,9,192,238,231,236,189,136,130,139,141,141,138,
-137,139,144,151,155,159,165,172,182,188,193,198,199,198,197,197,199,204,206,
-205,211,216,220,227,234,239,241,241,241,242,243,242,242,242,242,242,241,242,
-244,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,40,212,238,239,209,135,119,124,129,133,133,134,136,138,140,149,158,
-162,166,170,178,187,190,192,194,197,200,198,201,206,206,206,209,212,215,224,
-231,236,240,241,242,243,243,243,243,242,242,241,241,242,244,168,10,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,211,241,
-233,154,109,115,115,121,123,123,125,129,135,137,145,154,161,162,166,174,181,
-185,190,194,198,204,204,204,203,205,207,208,209,212,217,223,232,237,240,243,
-243,244,243,243,242,242,241,242,241,240,229,34,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,15,193,244,198,118,107,101,96,
-110,118,120,125,128,133,139,142,147,156,164,169,176,184,185,186,186,189,197,
-199,200,204,206,207,211,210,208,212,219,226,233,237,242,242,242,243,242,242,
-242,242,242,242,240,239,38,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,3,0,171,244,167,108,102,87,95,113,120,126,131,131,
-131,136,137,142,155,169,177,183,186,185,182,182,185,192,194,195,201,205,205,
-209,212,210,212,217,222,227,231,238,241,241,243,242,242,244,244,243,241,239,
-244,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-3,0,164,233,139,106,100,88,109,121,121,133,142,137,123,122,129,143,161,
-173,183,189,190,196,205,209,215,216,211,211,212,211,209,210,211,210,212,217,
-219,223,230,235,240,239,241,243,243,243,243,243,244,239,244,53,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,163,216,127,
-110,106,99,110,115,123,137,148,141,114,109,123,143,156,164,185,205,215,225,
-232,228,226,226,224,223,220,217,215,213,212,211,213,216,220,223,227,232,238,
-241,243,243,244,243,243,243,244,239,244,75,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,3,0,163,209,119,108,106,101,101,104,
-115,132,150,149,115,98,114,140,171,185,213,231,233,230,217,202,205,208,211,
-215,216,216,216,215,214,214,215,217,218,220,224,230,239,243,243,242,240,242,
-240,240,242,243,244,181,5,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,3,0,149,204,113,108,112,102,93,92,101,121,139,149,137,
-116,127,159,193,204,214,207,189,177,171,163,160,186,213,214,219,220,217,214,
-212,213,216,218,215,216,224,233,238,240,244,223,199,239,244,241,238,224,202,
-224,128,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-0,91,198,114,107,116,86,64,72,93,111,124,147,151,145,150,170,200,205,
-186,193,221,207,174,153,116,130,199,221,221,195,206,224,220,221,224,223,221,
-222,226,232,238,241,242,242,240,243,243,239,226,214,216,223,209,48,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,55,190,116,117,
-141,136,138,143,152,153,141,152,157,160,172,189,198,170,207,238,244,128,56,
-70,59,152,194,162,224,219,224,230,225,219,220,221,221,222,223,217,215,227,
-237,243,243,241,239,234,232,232,234,230,238,143,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,32,185,117,156,197,214,209,188,179,
-183,174,156,149,154,178,206,175,172,240,237,240,205,153,141,169,221,217,188,
-229,232,225,216,215,213,212,213,215,217,218,218,221,219,229,240,241,238,234,
-233,235,237,236,235,226,223,45,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,31,192,163,190,177,158,143,148,152,166,169,144,119,108,
-158,208,170,197,244,239,239,244,243,235,235,243,206,174,227,227,223,214,210,
-210,209,208,211,212,213,213,217,222,229,239,243,239,235,233,234,237,237,235,
-231,232,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-30,209,199,155,124,160,200,212,203,173,168,176,120,125,149,181,136,195,244,
-239,239,238,234,231,236,243,188,188,233,229,220,212,207,205,205,206,208,209,
-212,213,214,220,226,235,241,239,236,235,236,238,238,236,231,229,218,2,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,215,156,153,200,
-225,238,221,184,140,105,149,147,159,149,174,191,194,235,244,242,241,236,232,
-244,224,171,210,229,220,206,200,200,202,206,208,209,210,214,214,215,220,226,
-233,240,238,232,231,236,241,240,237,232,231,208,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,49,186,146,204,227,237,219,142,63,75,
-112,164,177,144,116,163,194,194,192,227,244,243,240,235,214,177,194,211,201,
-188,186,191,197,201,205,206,209,214,216,218,220,224,227,233,239,239,233,229,
-233,241,242,234,229,227,211,2,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,155,188,171,212,219,222,200,215,198,208,229,168,170,111,115,
-171,191,210,203,185,188,200,201,194,201,207,197,188,176,176,183,190,196,200,
-204,206,210,215,218,222,223,224,227,230,236,236,231,231,236,240,238,235,226,
-224,178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,140,130,
-142,220,209,208,209,208,223,232,244,235,162,178,94,116,179,194,211,218,208,
-200,200,199,192,183,179,179,180,179,178,181,192,199,201,205,207,210,214,217,
-222,225,225,226,231,234,234,229,232,238,228,220,229,218,231,117,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,13,50,83,172,189,217,214,217,
-220,227,232,241,211,157,177,84,101,166,193,206,216,213,208,203,197,189,178,
-174,176,180,181,183,185,194,199,202,207,207,209,212,215,220,225,224,225,227,
-228,229,227,231,233,225,221,216,208,223,36,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,33,162,201,198,194,194,209,227,207,159,
-158,149,85,103,151,188,204,215,219,216,213,202,183,175,175,176,180,183,187,
-191,195,199,203,205,206,207,209,213,217,221,223,225,225,224,226,228,228,224,
-212,206,205,224,143,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,5,147,140,154,165,171,153,110,114,157,142,82,98,151,
-191,203,205,195,194,211,222,209,188,180,178,184,188,191,197,200,200,203,206,
-207,207,206,212,215,216,219,222,224,224,225,227,229,225,217,215,222,212,51,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
-0,53,104,72,58,64,89,85,84,112,92,77,84,136,182,201,205,194,183,
-198,220,230,215,187,185,190,192,196,199,203,204,205,207,205,205,206,210,212,
-215,218,220,223,225,223,222,223,226,224,224,239,207,34,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,116,82,66,
-62,85,80,107,111,78,77,88,128,176,198,198,202,211,203,196,220,222,193,
-189,190,192,196,202,205,205,205,205,205,205,207,208,208,212,215,217,224,226,
-225,224,216,226,230,224,243,215,39,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,7,91,94,83,66,73,81,106,111,
-79,77,112,137,175,195,215,229,224,209,194,208,209,196,190,192,195,198,201,
-204,205,206,207,205,205,205,205,205,207,210,217,225,225,226,222,211,226,234,
-224,242,202,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,72,105,94,86,83,85,100,108,91,132,194,192,174,
-182,209,199,197,206,208,204,203,200,197,196,197,200,205,209,210,210,208,208,
-208,207,206,206,207,209,215,219,223,224,220,214,225,233,229,244,176,0,7,
-4,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,47,126,95,98,94,90,98,104,97,148,208,164,107,107,131,135,181,195,
-202,206,208,206,204,204,204,205,206,211,216,214,210,210,210,208,208,206,205,
-207,210,216,221,222,219,215,225,233,230,241,177,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,111,104,
-107,104,98,93,72,64,88,75,74,120,131,113,175,196,202,206,209,212,213,
-211,206,202,201,203,207,209,211,211,209,206,206,207,204,203,206,212,219,221,
-220,216,221,230,233,227,222,186,178,208,216,219,109,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,0,87,115,109,109,103,87,73,
-67,73,84,86,123,172,106,131,200,207,207,206,204,206,209,205,199,195,197,
-203,209,213,209,207,205,204,205,203,201,204,208,214,218,217,218,226,232,233,
-228,212,206,209,208,197,190,191,48,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,24,119,107,110,112,96,77,74,82,91,80,91,
-135,136,170,211,211,209,209,213,217,221,216,206,195,194,196,201,207,207,206,
-200,202,204,203,201,202,206,211,213,215,221,229,233,233,231,214,211,222,206,
-189,187,187,176,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,46,116,107,109,103,93,88,91,95,86,124,170,193,219,224,221,
-222,229,233,228,221,211,205,200,196,195,198,204,206,201,200,202,203,202,199,
-200,205,207,208,217,224,232,237,235,231,223,206,193,187,185,183,178,182,187,
-16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,
-114,106,106,100,103,113,96,131,203,213,191,179,174,181,209,225,218,213,210,
-208,205,203,198,195,197,202,204,201,201,203,201,198,197,198,200,204,209,220,
-228,234,238,237,237,218,195,192,186,182,169,165,174,195,115,0,3,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,7,95,113,105,104,121,
-146,149,171,143,101,117,137,171,203,207,204,202,205,207,205,205,205,202,197,
-200,203,205,201,201,201,198,196,193,196,198,205,217,226,232,233,238,243,224,
-191,191,190,180,166,164,167,171,181,175,35,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,0,54,119,105,104,111,145,143,98,94,112,
-152,180,190,200,193,194,199,199,199,201,204,204,204,201,203,206,207,205,200,
-198,195,196,196,198,204,214,224,228,231,231,237,225,191,187,188,184,175,168,
-166,169,170,171,199,91,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,72,121,105,106,111,101,91,93,103,137,166,173,180,176,
-178,190,197,199,200,202,204,205,203,204,206,206,202,198,195,191,192,198,209,
-220,225,225,225,226,232,218,189,187,186,182,177,175,165,166,165,169,173,191,
-135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,76,118,108,107,100,96,94,96,114,137,145,146,155,165,178,185,192,199,
-200,200,203,204,203,202,200,197,193,192,192,199,211,219,225,222,220,222,225,
-212,183,182,181,179,175,176,168,165,166,168,171,180,165,179,161,27,0,1,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,120,109,
-106,101,98,99,108,115,117,123,135,152,172,184,193,200,201,200,200,199,197,
-196,193,190,189,192,200,213,223,224,223,219,218,217,197,183,182,178,174,176,
-174,170,164,161,163,166,175,160,184,201,178,175,39,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,6,101,119,107,99,93,97,101,
-96,94,109,127,152,181,190,197,201,198,196,194,194,191,188,187,186,190,201,
-214,225,226,223,219,217,213,196,181,181,177,172,174,172,167,167,164,159,163,
-164,156,184,213,178,156,182,158,18,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,22,120,121,110,96,88,91,86,86,111,139,158,
-182,194,199,198,195,191,187,187,186,185,187,191,201,216,226,229,223,219,216,
-211,195,180,176,176,172,169,169,171,165,161,161,160,163,156,169,202,175,151,
-163,159,165,149,49,7,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,13,102,134,112,94,88,91,105,132,154,171,187,194,196,193,188,
-183,180,181,183,186,192,202,216,226,230,223,213,211,202,188,180,176,172,168,
-168,170,169,166,163,158,163,162,154,168,201,191,147,147,144,146,151,147,165,
-138,63,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-59,135,112,99,105,122,147,169,178,184,186,186,184,181,179,181,183,188,195,
-206,217,222,225,215,202,199,198,187,170,166,167,169,169,169,171,164,159,155,
-162,161,148,160,192,198,155,143,140,144,160,145,144,146,146,158,132,81,55,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,101,114,127,
-149,177,197,195,184,177,178,178,180,182,182,187,194,206,214,217,215,204,193,
-189,187,176,167,165,163,165,167,168,167,164,159,154,158,159,153,154,175,194,
-154,135,139,140,158,145,137,150,147,141,143,144,153,158,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,11,26,35,38,36,51,103,
-154,165,184,184,186,190,195,202,210,208,202,195,186,173,169,170,165,159,159,
-162,162,164,165,166,161,157,158,151,148,156,170,185,157,135,140,131,152,156,
-132,137,149,145,136,141,142,136,136,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,127,147,143,158,
-191,197,194,187,171,153,130,111,123,154,160,159,161,160,159,160,160,158,158,
-151,153,143,131,141,174,169,144,125,138,136,123,154,136,108,124,141,142,132,
-127,123,127,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,4,87,98,91,128,177,172,160,155,150,
-122,87,114,155,160,157,159,158,156,156,157,151,150,141,134,109,113,136,155,
-140,116,101,91,132,98,107,145,91,70,112,131,128,115,108,112,126,131,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,61,139,87,95,128,164,161,160,164,146,105,118,155,162,160,
-153,147,143,139,146,143,144,137,140,103,83,142,159,111,91,106,63,91,119,
-69,114,126,57,67,105,120,128,123,111,112,110,112,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,145,
-166,122,88,126,171,179,165,154,122,122,158,158,153,143,141,138,129,140,136,
-141,137,133,101,95,131,157,98,61,118,86,59,118,87,81,133,86,44,79,
-109,131,140,131,113,103,97,95,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,0,56,137,161,167,152,114,123,178,
-183,155,139,119,150,162,153,141,132,123,130,138,131,135,129,135,87,70,137,
-142,87,61,102,132,70,93,116,70,103,124,62,48,89,119,138,140,134,113,
-93,83,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,101,162,166,160,169,160,119,149,172,152,133,123,159,
-152,144,137,127,123,135,127,129,125,130,89,79,117,123,77,56,78,129,118,
-63,109,94,79,126,102,43,59,103,132,138,141,141,103,71,72,81,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-48,138,171,171,168,172,188,158,112,133,141,129,118,154,151,137,124,113,123,
-112,125,117,128,91,79,124,99,81,65,68,107,138,91,77,105,74,97,126,
-64,39,71,119,138,138,139,122,78,62,76,86,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,131,176,177,175,
-176,191,195,131,111,130,124,111,150,154,137,119,109,116,119,108,115,101,80,
-114,80,67,91,60,95,139,125,68,96,97,71,107,101,44,45,86,126,140,
-142,132,92,63,69,78,82,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,16,106,167,175,176,184,188,202,177,113,
-110,117,111,135,154,132,108,112,119,101,103,117,85,82,73,59,74,69,76,
-126,137,87,71,111,78,81,112,79,37,50,101,138,143,144,102,61,63,68,
-70,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,0,52,140,167,175,180,185,188,191,161,108,119,114,105,149,
-144,119,118,104,96,109,95,72,67,69,73,63,65,110,142,115,57,89,105,
-69,89,98,64,39,58,115,141,144,119,70,56,60,75,103,107,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,25,116,160,177,180,183,191,208,140,100,119,106,110,140,134,125,102,96,
-77,70,71,75,80,64,50,91,133,136,80,63,106,87,68,90,78,58,42,
-67,128,140,137,95,55,72,104,138,129,82,
+#pragma once
 
+#include <rsAsset/rsAsset.h>
 
-/* #C1 KNOPPIX.RU credit (by Alex) */
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,178,151,252,255,252,158,155,246,186,151,240,255,255,185,160,255,
-255,255,195,143,153,215,255,255,255,152,151,158,174,190,249,255,255,178,151,155,
-170,185,234,255,255,255,175,151,151,151,151,252,255,175,151,231,255,255,205,151,
-200,255,255,255,255,255,255,255,255,255,178,151,153,171,195,240,255,255,200,151,
-229,255,255,153,172,255,255,255,255,255,255,255,255,255,64,0,244,252,84,4,
-166,255,86,0,102,255,255,78,21,255,255,94,0,16,8,3,142,255,255,0,
-3,14,3,0,32,207,255,64,0,15,5,0,12,163,255,255,67,12,0,3,
-8,247,255,190,2,70,254,236,24,24,231,255,255,255,255,255,255,255,255,255,
-64,0,12,0,0,14,207,255,119,0,191,255,255,2,50,255,255,255,255,255,
-255,255,255,255,64,0,240,84,6,175,255,255,86,0,1,195,255,78,21,255,
-167,0,98,255,240,44,4,219,255,0,52,255,255,153,0,84,255,64,0,244,
-255,211,5,21,255,255,255,188,0,124,255,255,255,255,131,0,146,82,3,191,
-255,255,255,255,255,255,255,255,255,255,64,0,244,234,134,0,106,255,119,0,
-191,255,255,2,50,255,255,255,255,255,255,255,255,255,64,0,76,0,177,255,
-255,255,86,20,31,41,249,78,21,255,92,0,213,255,255,146,0,155,255,0,
-52,255,255,200,0,78,255,64,0,244,255,243,19,14,255,255,255,188,0,124,
-255,255,255,255,254,72,3,0,136,255,255,255,255,255,255,255,255,255,255,255,
-64,0,243,230,145,0,109,255,119,0,191,255,255,2,50,255,255,255,255,255,
-255,255,255,255,64,0,6,0,124,255,255,255,86,12,174,0,129,78,21,255,
-60,0,240,255,255,174,0,127,255,0,12,54,28,0,8,188,255,64,0,53,
-37,4,0,134,255,255,255,188,0,124,255,255,255,255,255,194,0,14,243,255,
-255,255,255,255,255,255,255,255,255,255,64,0,4,0,1,68,233,255,119,0,
-191,255,255,2,50,255,255,255,255,255,255,255,255,255,64,0,194,83,2,190,
-255,255,86,12,255,78,7,60,21,255,82,0,221,255,255,153,0,155,255,0,
-24,124,142,159,226,255,255,64,0,116,136,153,203,255,255,255,255,188,0,124,
-255,255,255,255,241,38,23,4,88,255,255,255,255,255,255,255,255,255,255,255,
-64,0,143,25,46,222,255,255,125,0,186,255,252,1,57,255,255,255,255,255,
-255,255,255,255,64,0,244,234,21,25,234,255,86,12,255,228,13,1,21,255,
-140,0,125,255,252,62,5,220,255,0,52,255,255,255,255,255,255,64,0,244,
-255,255,255,255,255,255,255,188,0,124,255,255,255,255,82,2,191,129,0,145,
-255,255,255,255,239,232,255,255,255,255,64,0,244,204,9,35,236,255,159,0,
-134,255,209,0,90,255,255,255,255,255,255,255,255,255,64,0,244,255,174,0,
-74,254,86,12,255,255,145,0,21,255,246,47,0,56,37,1,137,255,255,0,
-52,255,255,255,255,255,255,64,0,244,255,255,255,255,255,255,86,29,0,23,
-48,249,255,138,0,118,255,252,58,5,196,255,255,255,71,4,255,255,255,255,
-64,0,244,255,155,0,70,254,243,28,6,58,22,3,196,255,255,255,255,255,
-255,255,255,255,155,120,250,255,255,146,120,219,166,126,255,255,254,129,131,255,
-255,249,151,101,114,191,255,255,255,120,149,255,255,255,255,255,255,155,120,250,
-255,255,255,255,255,255,150,120,120,120,120,252,244,124,126,249,255,255,222,120,
-146,255,255,255,158,122,255,255,255,255,155,120,250,255,255,143,120,213,255,237,
-137,102,124,209,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+/* data from pic.raw, 81900 bytes */
 
-/* #C2 Double Creations Credit (by Vince) */
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,0,0,0,0,255,255,255,255,255,255,255,255,255,255,255,
-255,255,0,0,255,255,255,255,0,0,255,255,255,255,255,255,255,255,255,255,
-255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,0,
-255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,255,0,
-255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,0,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,0,255,255,255,255,0,255,255,255,255,255,255,255,255,255,
-255,255,255,0,255,255,255,255,255,0,255,255,255,255,255,255,255,255,255,0,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,
-0,255,255,0,0,0,255,255,0,255,255,0,255,0,0,0,0,255,255,0,
-255,255,255,0,0,0,255,255,255,0,255,255,255,255,255,0,0,0,0,255,
-0,0,0,255,255,0,0,0,0,255,0,0,0,255,0,0,255,255,255,0,
-0,0,255,255,0,0,0,0,0,255,255,0,0,0,0,255,255,255,255,255,
-255,255,255,255,255,0,255,255,255,255,0,255,0,0,255,0,0,255,0,255,
-255,0,255,0,255,255,255,0,255,0,255,255,0,255,255,255,0,255,255,0,
-255,255,255,255,255,255,0,255,0,0,255,255,255,0,255,255,255,255,0,255,
-255,0,255,255,255,0,255,255,0,0,255,0,0,255,255,0,255,255,0,255,
-255,0,255,255,255,255,255,255,255,255,255,255,255,255,255,0,255,255,255,255,
-0,255,0,255,255,255,0,255,0,255,255,0,255,0,255,255,255,0,255,0,
-255,255,0,0,0,0,0,255,255,0,255,255,255,255,255,255,0,255,255,0,
-0,0,0,0,255,0,0,0,0,255,255,0,255,255,255,0,255,255,0,255,
-255,255,0,255,255,0,255,255,0,255,255,255,0,0,255,255,255,255,255,255,
-255,255,255,255,255,0,255,255,255,0,255,255,0,0,255,0,0,255,0,255,
-255,0,255,0,255,255,255,0,255,0,255,255,0,255,255,255,255,255,255,255,
-0,255,255,255,255,255,0,255,255,0,255,255,255,255,255,0,255,255,0,255,
-255,0,255,255,255,0,255,255,0,0,255,0,0,255,255,0,255,255,0,255,
-255,255,255,255,0,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,
-255,255,255,0,0,0,255,255,0,0,0,0,255,0,0,0,0,255,255,0,
-0,255,255,0,0,0,0,255,255,255,255,0,0,0,255,0,0,0,255,255,
-0,0,0,0,255,0,0,0,0,0,255,0,0,255,0,0,0,255,255,0,
-0,0,255,255,0,0,255,255,0,0,255,0,0,0,0,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+static const uint8_t pic_packed[] = {
+66,90,104,57,49,65,89,38,83,89,94,194,67,23,0,1,102,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,224,111,95,122,235,219,220,250,221,128,0,3,160,1,74,40,72,7,182,251,53,
+59,156,107,70,205,185,181,166,181,153,219,93,187,77,218,35,37,153,123,50,52,105,222,218,
+175,123,222,247,123,142,238,227,59,61,119,179,203,151,169,220,115,178,214,125,207,62,251,175,
+187,117,200,187,54,239,59,203,236,223,123,103,119,79,123,92,123,185,118,222,206,235,59,119,
+62,222,239,173,159,119,161,109,160,86,158,169,172,170,179,106,82,164,109,146,169,85,173,42,
+138,138,10,170,85,84,20,43,109,69,21,84,10,42,128,0,0,42,170,128,40,0,2,154,
+3,83,101,107,89,117,174,85,167,167,174,219,118,217,189,183,107,111,109,219,169,61,57,91,
+110,219,222,237,119,221,31,60,245,43,102,251,53,42,237,170,174,238,238,219,182,173,91,179,
+119,110,219,118,190,110,117,215,186,204,230,247,119,179,125,199,220,223,93,205,221,239,125,247,
+181,222,222,250,242,93,235,173,247,119,55,61,222,251,223,75,233,233,189,155,222,246,219,195,
+84,165,166,245,149,187,219,207,106,204,217,125,110,235,34,69,30,154,122,137,90,193,233,32,
+173,101,20,10,86,128,0,101,84,255,209,160,0,0,154,13,52,200,98,104,208,209,147,0,
+76,38,134,70,128,0,0,0,0,38,38,152,2,25,48,19,67,77,52,26,50,13,0,26,
+0,0,152,154,100,98,100,50,48,83,6,154,104,153,48,83,201,10,169,250,104,0,32,0,
+32,208,208,12,154,96,0,0,1,52,100,152,76,35,77,24,152,140,64,106,96,19,0,141,
+26,52,202,96,202,120,70,132,122,152,67,19,35,2,83,242,39,166,169,250,83,109,81,249,
+52,83,77,169,229,61,165,61,77,169,229,61,71,136,122,160,21,79,16,0,19,4,104,209,
+160,19,3,64,70,134,64,4,205,16,208,209,166,41,128,38,76,42,123,33,132,194,106,122,
+106,109,168,79,35,36,205,53,53,79,212,246,164,240,84,253,79,100,84,252,154,79,21,63,
+76,167,168,159,170,104,253,38,167,169,250,53,52,61,38,202,121,20,209,249,83,208,121,83,
+122,166,100,128,34,169,254,128,0,128,128,32,104,208,0,152,0,2,0,105,160,141,50,79,
+79,72,208,212,205,38,21,63,70,154,167,226,158,42,121,138,122,155,84,211,245,48,201,77,
+154,81,230,169,234,126,164,245,63,69,25,30,166,154,121,65,228,158,163,100,154,105,234,122,
+128,27,80,245,7,168,211,77,52,1,160,1,20,240,32,128,64,38,70,128,38,38,166,19,
+26,105,137,48,211,65,144,19,19,73,234,106,55,164,211,212,197,60,153,52,122,137,189,20,
+97,61,70,153,12,9,137,166,153,169,166,67,53,25,13,0,245,26,12,153,0,208,13,1,
+161,160,0,0,0,1,166,68,64,64,38,70,132,97,26,26,104,19,1,162,98,96,141,76,
+19,211,83,9,170,127,166,132,109,84,253,35,202,158,79,213,79,19,210,143,196,145,237,77,
+149,61,65,188,146,126,169,234,109,79,66,122,19,244,163,202,108,70,141,79,209,16,245,61,
+70,154,123,74,100,104,240,166,212,122,106,100,253,80,0,245,12,134,158,147,39,168,172,136,
+234,28,18,160,61,83,171,238,180,22,30,145,178,70,133,146,229,114,152,21,170,132,135,229,
+33,51,195,34,255,245,125,175,79,137,144,88,8,130,73,16,19,62,82,118,152,228,136,39,
+23,167,244,186,231,10,33,163,149,234,177,17,29,68,146,242,244,64,255,200,93,119,145,23,
+204,102,67,172,123,141,191,95,82,239,182,126,110,252,249,187,75,195,102,251,122,85,223,214,
+228,80,254,13,27,201,162,104,217,247,155,84,187,147,173,179,214,107,78,39,146,87,119,124,
+106,86,1,15,78,0,129,21,198,118,102,205,133,41,172,109,180,17,1,225,42,202,240,57,
+55,190,21,166,109,60,255,62,86,63,109,175,138,242,242,111,96,249,223,131,234,243,97,182,
+64,238,117,82,29,79,143,212,233,192,191,184,125,175,163,243,99,250,254,109,208,4,193,32,
+100,228,251,37,21,198,201,80,112,14,52,29,49,218,226,35,239,22,32,122,98,153,53,4,
+178,100,210,84,205,64,194,126,40,166,247,131,16,111,215,84,122,93,192,96,12,124,161,149,
+20,51,146,115,232,181,204,86,145,196,30,104,121,97,70,105,130,83,162,104,139,0,2,14,
+151,170,251,196,209,211,81,43,147,143,107,137,183,108,210,200,157,120,41,126,111,2,186,52,
+98,216,112,30,219,59,121,145,134,242,250,124,219,143,54,52,215,145,23,144,87,151,227,31,
+11,31,172,66,137,20,175,42,17,247,78,226,190,179,207,230,193,135,205,208,204,29,47,126,
+183,221,142,255,225,126,7,14,115,32,177,246,190,135,99,200,245,245,191,42,134,20,250,101,
+18,24,144,79,112,126,25,180,222,211,193,208,253,158,188,232,172,32,72,75,225,144,254,135,
+201,244,62,37,255,149,223,100,249,94,167,171,246,45,102,23,141,220,237,182,207,117,241,190,
+55,157,26,222,211,197,189,127,231,81,64,201,245,21,78,126,151,225,241,55,201,216,113,0,
+124,87,223,236,248,255,183,251,238,234,64,52,235,235,244,65,24,61,230,255,174,168,225,22,
+202,113,254,159,218,185,57,201,143,157,254,79,29,224,10,200,250,221,66,169,35,95,235,120,
+110,57,127,94,190,23,205,253,126,15,129,246,170,23,13,63,177,115,236,254,251,203,65,66,
+170,17,74,82,248,252,30,47,144,16,214,32,111,243,79,143,181,107,4,201,248,68,182,75,
+157,87,27,107,169,172,57,177,97,73,74,150,236,156,192,170,129,136,183,9,249,153,132,32,
+74,56,23,114,187,120,236,183,166,141,101,238,139,31,115,214,231,164,71,64,109,116,135,87,
+201,86,7,190,160,109,137,24,123,14,232,64,0,9,96,192,50,197,170,88,72,18,31,50,
+210,154,24,12,176,128,18,60,114,204,36,88,57,1,190,65,13,34,28,178,44,3,6,101,
+1,0,136,0,51,0,72,96,204,63,180,90,208,196,130,9,4,246,166,12,138,36,146,201,
+36,66,69,2,88,18,204,1,180,146,153,152,31,57,0,141,37,154,69,200,0,150,4,134,
+1,133,133,152,48,251,194,193,128,198,89,128,13,34,204,0,96,45,44,0,97,50,192,88,
+88,16,196,177,98,65,5,136,36,144,71,162,66,5,131,177,189,234,122,111,20,144,139,34,
+223,61,63,101,13,116,135,7,243,58,97,51,0,206,9,38,104,20,149,244,227,9,65,16,
+152,22,96,24,144,73,160,179,15,110,92,179,71,209,162,46,148,23,34,96,71,152,80,36,
+144,65,32,73,0,200,147,81,68,159,144,88,34,208,66,44,195,30,36,206,71,222,150,18,
+33,203,16,81,102,14,67,11,174,128,98,71,60,228,44,3,82,144,227,17,204,227,38,12,
+194,162,0,226,153,177,180,226,235,38,102,180,179,6,179,207,76,47,30,228,128,5,132,75,
+196,65,154,130,27,242,203,51,116,36,153,152,110,55,40,8,63,44,135,4,144,59,30,122,
+29,54,231,44,69,154,89,63,53,219,9,12,183,73,134,82,3,18,24,48,243,129,4,129,
+170,89,134,231,114,16,102,220,144,3,55,158,64,102,238,11,0,62,97,102,102,106,136,96,
+214,144,60,224,88,43,224,104,232,60,48,98,67,18,27,229,144,28,134,0,72,22,251,165,
+155,224,153,253,117,75,133,214,251,170,159,214,147,250,75,195,63,151,196,229,251,13,189,207,
+240,97,164,241,189,163,15,91,16,193,126,127,83,103,82,223,91,202,122,114,126,174,135,95,
+251,19,101,245,174,160,31,183,76,223,42,191,0,11,191,181,248,31,141,232,183,171,224,126,
+76,164,17,77,131,224,127,193,11,108,95,185,228,67,226,253,213,56,45,251,165,153,247,159,
+192,62,232,106,88,64,250,4,48,253,125,226,21,204,16,65,153,44,27,110,130,5,137,15,
+83,129,6,11,22,32,128,65,215,72,146,65,40,128,136,110,169,96,135,55,190,67,121,211,
+137,116,8,219,119,170,69,171,20,146,2,6,158,241,251,207,99,41,220,50,47,190,110,113,
+180,61,249,18,46,61,149,194,122,12,31,153,37,244,106,169,190,133,42,117,124,23,120,139,
+241,22,47,88,191,52,174,154,100,77,158,254,187,161,198,73,34,123,95,153,38,17,74,41,
+18,146,72,133,33,103,223,41,72,25,93,95,163,8,130,37,37,158,191,188,101,35,65,83,
+68,69,192,140,80,136,142,199,97,92,216,31,226,189,32,34,46,27,226,92,242,37,46,215,
+159,78,122,126,79,118,239,41,60,217,158,70,6,6,135,90,243,184,250,116,93,120,96,193,
+168,83,113,118,65,6,96,196,189,105,200,97,128,217,66,110,252,208,180,104,250,94,64,143,
+6,142,174,245,13,227,2,44,179,61,62,0,66,69,21,8,59,117,139,130,34,17,27,245,
+213,224,46,92,212,250,197,152,6,205,127,120,157,152,6,240,240,237,231,195,32,54,95,140,
+128,160,89,127,236,125,174,12,165,37,61,104,119,96,214,155,125,255,191,147,106,157,201,35,
+2,212,53,22,25,252,29,182,150,158,174,22,221,150,96,27,13,89,219,136,136,7,49,2,
+196,134,102,98,1,26,168,3,135,28,158,55,0,215,10,150,32,164,38,251,250,160,22,56,
+188,199,12,30,196,177,203,30,196,128,0,9,22,54,148,194,210,191,19,119,76,48,130,192,
+95,32,51,155,33,12,5,172,170,243,200,58,172,129,4,82,69,196,152,97,42,217,56,122,
+59,39,13,132,18,196,22,96,75,0,196,51,6,207,248,170,210,215,234,86,214,238,37,137,
+48,68,15,208,59,98,194,225,111,212,200,128,130,194,9,36,130,109,44,42,52,157,201,166,
+97,123,220,219,94,47,32,183,42,254,53,22,114,106,112,227,61,32,210,44,21,186,57,152,
+167,50,29,127,22,155,157,79,211,219,241,106,228,23,168,38,32,139,199,52,226,39,127,45,
+252,72,129,122,106,36,142,37,169,106,162,149,145,25,167,160,174,20,222,114,67,69,21,180,
+117,8,81,220,94,144,160,104,111,189,229,45,32,181,159,66,17,175,111,126,249,131,43,83,
+236,250,219,156,202,47,238,168,0,48,109,201,16,59,7,138,226,0,166,237,7,17,64,205,
+32,40,184,252,145,109,150,183,133,204,194,177,67,128,214,50,72,160,32,210,8,62,106,135,
+102,1,189,207,46,168,214,56,232,236,83,69,251,4,131,19,115,61,63,136,173,148,239,89,
+76,156,107,187,151,215,35,56,57,110,207,10,157,203,215,22,243,244,179,251,188,88,123,218,
+118,51,179,176,91,38,199,182,67,28,67,181,100,18,47,161,37,162,73,68,183,65,168,95,
+14,246,118,25,166,108,137,177,204,52,242,203,211,200,51,169,226,198,182,109,109,111,131,105,
+117,245,201,93,149,134,245,11,50,204,53,70,150,62,123,198,177,115,128,247,135,66,99,79,
+22,57,21,127,133,237,92,145,34,55,231,217,60,7,44,9,20,20,88,246,196,126,47,168,
+135,180,160,143,16,120,165,244,37,201,126,181,193,152,64,4,91,48,236,8,39,87,179,195,
+72,199,243,87,40,190,243,177,87,219,229,233,207,226,28,243,194,66,178,251,229,244,229,239,
+126,247,40,185,243,191,229,243,222,198,245,187,164,30,234,249,7,65,135,47,212,235,121,9,
+71,98,48,210,234,159,43,88,167,126,71,80,229,145,122,223,83,121,117,21,143,197,225,34,
+2,9,8,240,118,186,168,55,194,247,117,72,64,198,170,168,167,119,68,100,237,223,47,192,
+215,245,126,221,85,85,75,57,47,209,230,203,181,137,220,218,122,124,73,87,50,8,73,107,
+16,136,112,204,3,98,28,94,140,99,177,50,161,130,36,26,6,55,20,173,196,52,132,175,
+16,228,56,33,202,214,65,249,202,90,93,221,14,45,180,241,131,246,180,140,201,80,237,68,
+213,21,216,226,102,225,186,253,23,172,190,154,124,62,150,41,215,131,175,75,246,114,105,93,
+82,240,204,97,194,228,72,124,77,20,229,161,135,48,48,91,186,144,113,23,52,78,210,107,
+96,175,61,0,47,209,11,68,129,18,33,231,244,209,132,21,72,177,121,201,71,124,227,178,
+238,12,56,7,32,103,54,40,200,15,75,166,87,103,183,250,2,146,173,57,185,144,182,44,
+3,158,50,6,93,190,206,139,76,12,35,91,132,13,168,65,220,144,23,66,127,71,149,47,
+76,137,201,26,47,68,69,93,87,120,22,23,200,184,52,210,227,181,152,8,131,66,101,35,
+244,227,160,123,232,224,85,14,81,167,44,92,45,35,95,234,251,158,172,165,173,180,89,154,
+235,198,49,195,187,120,220,26,143,56,193,33,183,15,129,204,250,166,217,94,168,194,162,16,
+73,84,105,138,93,73,41,166,254,126,202,122,148,166,20,105,246,62,173,178,252,63,132,133,
+203,168,83,93,100,218,84,106,77,239,202,80,112,151,61,164,223,123,1,198,180,112,46,69,
+83,190,69,112,161,36,85,14,238,69,135,201,121,102,205,198,51,48,130,190,236,229,196,186,
+52,111,107,144,158,128,170,168,42,217,82,73,176,201,193,19,47,196,251,246,237,157,219,112,
+55,24,174,64,109,131,93,219,38,57,181,203,126,252,180,194,99,201,159,47,12,83,91,37,
+44,36,74,58,64,64,121,7,18,95,29,76,147,19,122,34,122,137,71,29,244,227,82,66,
+167,62,48,216,32,63,212,247,93,110,191,93,188,111,8,195,120,223,113,48,241,188,196,200,
+182,79,113,251,123,113,178,16,201,86,238,88,129,12,79,108,191,175,131,99,63,3,194,253,
+81,147,69,49,76,187,190,250,187,110,238,137,123,16,156,202,28,222,118,135,129,104,200,129,
+136,47,130,126,88,6,242,211,56,68,41,8,116,207,75,128,160,98,55,172,151,22,8,136,
+6,159,158,209,103,117,92,4,244,1,185,38,165,35,217,120,146,170,160,143,169,175,184,185,
+42,172,39,196,89,144,20,50,230,119,247,237,242,164,238,79,59,23,141,160,181,55,185,148,
+213,218,174,196,129,121,120,1,121,74,240,61,44,21,132,147,16,59,148,115,150,102,99,66,
+168,216,57,17,28,226,104,220,138,107,147,132,121,142,97,72,151,7,61,67,30,84,58,203,
+2,2,217,139,128,42,119,162,205,69,102,210,117,169,153,197,42,35,253,153,194,235,20,11,
+112,118,37,139,17,176,170,13,36,10,130,64,162,198,99,107,152,135,248,220,19,24,186,23,
+202,40,20,20,30,34,36,9,202,155,193,206,4,84,232,136,202,226,138,96,57,198,168,7,
+4,144,114,200,138,246,202,137,98,178,40,132,100,69,233,16,162,146,248,75,111,56,145,93,
+36,177,168,9,226,142,178,42,115,139,194,3,33,67,116,112,234,43,10,8,170,79,212,35,
+189,194,210,105,119,168,139,187,239,113,18,210,30,90,149,106,212,110,95,119,52,182,138,10,
+101,52,74,101,68,2,196,58,56,163,44,186,146,32,71,35,188,222,250,3,167,79,239,45,
+142,232,119,101,133,68,121,31,173,126,161,231,20,55,145,133,58,4,191,58,70,211,51,242,
+111,208,209,254,57,238,199,121,64,70,35,106,104,164,136,197,132,104,73,254,134,36,23,243,
+151,33,11,94,171,200,41,220,40,52,134,102,121,76,45,32,134,102,39,56,251,188,106,156,
+27,243,215,194,56,97,219,242,163,102,160,200,33,79,229,16,237,6,21,40,149,7,254,230,
+5,79,195,92,250,73,252,37,115,12,80,212,55,54,217,34,225,243,23,132,205,193,153,83,
+148,130,40,12,178,220,69,153,31,113,110,138,218,94,72,186,167,192,14,136,172,38,54,27,
+82,172,214,230,105,89,198,174,85,148,84,43,96,88,130,151,167,103,8,72,1,33,172,138,
+249,218,85,245,98,29,216,185,37,56,133,136,212,104,46,49,32,52,205,46,48,208,213,61,
+246,251,43,16,191,38,225,129,44,68,165,4,112,68,209,73,78,164,54,83,26,77,131,152,
+179,155,135,3,248,232,146,128,145,252,225,147,128,145,56,175,138,209,197,185,141,138,249,240,
+113,128,39,223,161,227,145,216,64,243,190,222,185,133,203,237,135,242,232,235,216,0,37,235,
+214,132,171,226,65,70,156,203,201,0,36,1,72,26,147,187,131,189,238,174,235,122,122,102,
+209,139,28,250,19,173,29,187,137,154,43,160,247,191,134,137,152,182,102,175,62,236,7,117,
+33,165,250,231,43,191,63,66,126,177,170,75,39,248,163,69,215,62,83,16,188,6,172,58,
+230,56,87,25,14,16,128,115,206,68,129,0,110,205,23,139,200,27,38,50,146,40,74,100,
+214,84,142,197,65,130,108,62,175,175,68,46,196,108,200,18,7,42,114,25,117,237,213,5,
+122,80,111,26,234,26,141,194,165,127,38,218,172,46,234,7,213,209,149,48,144,190,221,138,
+173,212,179,230,215,137,40,97,27,120,220,248,219,89,105,39,46,136,0,19,68,137,11,58,
+251,149,219,186,132,157,190,224,252,97,119,95,81,220,46,185,97,198,221,102,122,189,91,94,
+51,30,245,226,136,1,175,158,30,90,59,159,98,73,160,251,225,6,75,224,81,200,66,79,
+236,131,26,65,178,131,252,222,149,40,148,86,82,112,222,242,89,217,240,17,0,105,90,148,
+148,139,8,234,151,78,4,51,243,22,20,172,173,53,140,209,80,18,177,218,36,193,88,26,
+193,90,105,32,14,118,185,154,210,16,238,20,66,251,85,147,144,128,240,211,158,50,194,204,
+124,30,25,119,207,73,168,185,60,149,117,8,234,181,200,64,22,144,206,29,10,152,37,233,
+64,193,5,131,178,198,48,14,23,52,122,60,25,36,154,238,61,220,37,126,249,233,206,240,
+243,247,106,186,59,121,152,190,138,231,83,211,178,243,159,126,43,4,91,106,108,25,209,231,
+244,16,225,243,154,154,216,140,63,216,198,108,113,173,42,53,216,6,136,172,144,64,70,18,
+216,25,101,197,225,116,179,196,211,208,66,224,206,37,147,127,64,138,0,149,113,67,188,8,
+153,71,78,204,143,108,130,7,89,131,6,173,22,143,170,90,81,85,215,157,58,231,137,220,
+240,47,228,60,75,216,127,10,236,92,138,74,188,255,67,70,48,102,136,112,255,6,153,101,
+8,80,54,146,120,42,234,159,148,110,109,236,153,204,245,15,28,66,225,218,88,67,134,224,
+196,49,212,13,77,49,66,37,217,125,18,35,95,240,108,191,91,251,226,243,235,146,54,215,
+88,249,34,230,249,226,47,116,222,1,25,129,229,4,5,72,235,216,162,72,43,221,87,201,
+242,156,63,128,95,128,235,99,186,243,61,68,233,133,112,14,249,254,130,125,68,156,33,104,
+222,22,148,28,4,83,34,100,109,107,100,189,195,123,9,94,131,42,19,1,96,177,137,42,
+233,189,155,198,209,156,200,153,106,136,62,62,72,241,47,41,181,202,44,170,56,92,101,69,
+226,146,227,111,39,47,61,6,121,72,73,104,101,51,211,157,102,120,239,30,24,2,52,58,
+131,47,97,40,20,248,152,112,65,113,40,30,49,224,9,108,24,27,231,170,137,220,104,39,
+78,31,2,46,80,187,168,53,217,224,185,36,37,0,98,0,61,57,48,225,93,233,175,128,
+16,127,150,207,208,199,37,151,192,47,101,185,23,10,123,32,88,200,233,151,216,8,15,11,
+159,38,206,203,133,51,222,210,63,100,127,210,236,125,117,9,234,247,45,113,52,153,19,122,
+85,121,214,55,55,213,240,49,129,104,17,24,169,98,160,30,170,56,217,75,124,32,97,35,
+197,4,7,224,160,206,51,203,82,45,66,172,194,21,36,209,77,88,160,205,74,165,225,68,
+26,85,9,9,70,93,250,168,42,205,4,7,224,84,158,111,99,130,86,180,115,11,129,74,
+48,61,246,235,174,111,160,130,156,78,46,123,239,207,147,29,62,249,152,11,240,108,150,53,
+247,212,21,33,150,230,198,75,160,232,153,14,208,139,11,150,99,4,242,68,194,215,250,187,
+235,224,5,220,200,208,63,181,159,13,8,229,9,94,84,230,56,241,203,3,224,62,7,113,
+6,244,227,147,116,137,171,27,234,114,189,161,200,166,104,44,32,128,228,174,152,100,186,18,
+169,10,156,147,68,105,195,73,14,3,210,183,210,66,147,143,129,94,190,141,99,226,217,75,
+181,171,25,176,60,51,221,188,18,4,56,38,141,39,225,202,151,191,201,174,163,40,18,124,
+218,197,52,43,104,209,205,102,152,12,24,138,136,12,120,15,189,165,218,67,76,129,159,224,
+191,61,62,245,222,179,170,233,227,253,210,231,219,241,37,165,57,19,212,87,185,163,193,242,
+101,120,74,148,112,6,38,136,113,86,251,252,105,0,14,207,137,224,26,2,31,23,252,107,
+228,189,146,15,205,119,90,143,252,96,83,118,9,96,24,19,110,140,114,17,32,84,64,240,
+87,0,53,74,50,120,40,158,53,245,155,198,213,179,249,147,249,62,206,157,98,1,45,173,
+209,72,104,241,62,13,122,247,119,191,94,174,110,208,5,51,228,157,8,109,43,115,228,222,
+172,37,0,120,222,166,115,132,2,242,213,72,64,196,83,222,100,24,112,37,140,252,226,87,
+145,182,58,128,216,156,21,68,162,37,146,218,99,25,243,73,227,30,141,179,183,232,216,237,
+102,100,68,18,41,48,185,12,100,176,148,115,21,88,178,43,179,106,240,58,22,201,212,20,
+4,177,73,224,133,130,232,114,115,13,202,234,222,40,96,43,175,241,29,148,243,85,54,224,
+197,15,112,216,101,85,92,180,192,35,43,88,45,164,10,227,16,24,44,22,144,157,233,16,
+208,227,45,109,97,192,76,68,137,197,122,100,230,79,157,1,157,65,203,116,105,90,17,6,
+65,103,210,72,8,55,178,227,8,180,213,163,244,214,185,218,182,159,78,86,137,26,133,195,
+87,153,106,34,67,78,106,181,25,43,30,11,111,109,254,53,80,98,147,243,46,45,2,242,
+29,55,12,201,118,122,31,153,158,176,158,195,138,110,89,97,104,132,76,102,188,163,188,100,
+167,94,5,220,170,48,238,163,45,129,36,52,57,178,211,62,28,115,42,89,193,65,240,31,
+217,224,104,66,52,171,21,154,122,214,105,207,219,216,52,109,85,6,242,28,38,171,224,118,
+130,77,156,6,155,126,103,175,222,245,189,28,219,126,129,199,121,100,253,52,52,24,20,27,
+24,84,169,90,173,140,203,2,155,125,140,245,34,5,96,73,30,76,208,91,16,226,38,156,
+210,72,93,248,2,232,104,34,193,98,40,97,97,30,97,29,219,246,213,92,54,148,161,19,
+33,172,248,231,69,162,94,28,228,0,247,70,3,249,185,222,81,108,39,66,230,247,229,214,
+7,137,43,139,226,169,13,101,118,211,146,57,64,198,40,96,62,105,164,16,80,73,58,169,
+164,77,154,91,190,174,40,208,199,49,180,239,79,223,191,157,181,19,215,200,131,84,215,22,
+143,50,223,122,113,52,92,111,2,227,0,136,61,145,175,132,12,31,118,168,14,48,94,61,
+111,192,104,40,4,25,9,201,181,250,244,74,220,249,139,179,168,83,75,25,119,54,209,29,
+193,47,168,88,20,203,209,85,104,202,120,36,224,65,74,33,72,148,12,66,207,222,115,4,
+97,128,155,140,110,172,149,6,1,83,222,154,203,69,5,152,142,46,15,110,142,241,219,159,
+183,109,76,115,226,82,193,125,109,197,86,69,2,85,77,72,155,73,237,101,64,249,198,4,
+208,205,77,68,173,241,73,144,171,208,22,77,228,23,84,84,207,29,44,3,45,240,63,210,
+90,34,53,172,68,169,157,106,7,12,167,37,247,59,83,210,115,27,134,92,146,180,95,118,
+254,11,29,253,182,253,110,11,87,190,50,166,207,185,5,116,164,238,70,251,52,87,45,146,
+2,210,205,178,239,47,36,135,52,141,181,72,79,201,11,156,51,125,126,183,121,179,48,0,
+247,55,118,41,250,177,182,159,51,188,220,111,247,7,132,76,247,91,232,251,55,30,122,115,
+27,69,252,231,175,117,173,79,55,193,241,215,75,148,50,195,163,197,105,174,171,181,29,144,
+76,19,160,253,4,64,16,76,203,141,60,206,48,106,152,112,70,81,68,211,142,245,88,4,
+160,123,34,155,197,43,48,182,68,221,219,18,148,137,196,108,26,124,185,152,62,17,179,208,
+123,227,97,36,253,185,39,121,143,0,183,6,183,221,152,213,233,91,90,216,151,55,13,101,
+64,185,241,206,85,86,187,232,210,124,185,56,180,138,100,216,11,51,6,51,135,14,157,0,
+248,184,142,218,61,57,53,120,238,247,208,218,49,132,14,212,40,160,141,232,216,86,70,110,
+205,100,86,163,11,229,131,206,109,123,168,175,229,34,84,115,199,60,139,99,3,207,242,45,
+17,242,70,255,7,187,94,185,91,160,211,8,59,222,179,131,157,121,240,212,32,18,239,4,
+164,24,181,43,136,186,200,107,171,243,218,142,128,93,57,67,72,86,185,35,151,116,145,196,
+251,147,230,53,97,38,105,96,161,32,218,207,83,83,194,92,234,244,161,231,175,22,196,226,
+250,208,44,145,2,72,70,178,193,76,118,49,22,45,64,170,72,16,7,36,139,59,88,131,
+190,99,54,116,21,255,209,145,126,181,43,83,122,179,132,213,106,134,246,150,149,8,102,231,
+114,33,56,15,219,86,240,251,121,38,63,220,246,113,84,214,199,227,101,192,73,181,75,180,
+24,49,143,151,37,254,4,82,97,156,243,37,4,5,11,57,91,16,238,253,53,47,238,191,
+129,61,121,200,219,126,193,136,55,138,45,50,134,233,203,247,239,32,117,53,234,45,83,88,
+39,57,28,73,228,195,20,21,150,192,48,235,0,25,130,202,161,176,95,139,117,111,151,163,
+166,121,18,120,172,170,74,80,49,14,16,108,65,137,216,253,35,200,247,19,109,196,116,120,
+207,33,100,45,146,244,43,46,183,220,60,249,67,67,81,250,162,169,65,20,153,30,100,215,
+179,111,2,175,147,125,211,140,183,222,34,25,230,241,58,117,34,196,99,138,128,150,9,76,
+26,64,132,48,94,194,213,134,252,149,90,18,83,133,177,48,141,214,157,209,245,126,178,172,
+229,97,50,134,3,237,192,65,73,245,204,29,58,85,165,99,39,134,30,39,224,236,252,40,
+208,179,225,93,144,58,127,112,113,72,234,79,210,205,120,154,133,204,153,2,178,5,217,186,
+55,65,215,228,234,51,8,146,106,156,117,81,171,156,228,156,154,30,105,243,216,97,90,37,
+159,247,50,220,93,42,11,161,221,205,8,194,155,50,152,235,66,5,50,74,149,20,128,129,
+21,106,172,13,66,8,152,23,33,59,116,161,35,13,151,166,12,215,235,31,199,50,246,149,
+166,21,167,236,2,246,87,96,140,50,227,58,202,187,83,249,56,84,61,79,118,5,118,200,
+22,104,154,95,49,215,251,157,217,94,152,227,73,122,210,85,169,125,129,79,102,23,246,119,
+199,219,147,104,7,227,140,77,18,179,7,81,96,160,252,155,248,240,89,122,123,69,192,94,
+175,136,134,94,42,157,140,11,226,65,134,22,247,160,126,35,110,242,45,172,138,249,148,212,
+212,14,215,239,115,112,157,225,235,227,84,162,31,173,173,2,134,98,18,125,34,231,82,84,
+233,1,56,207,164,24,180,103,168,135,90,52,56,194,97,110,25,120,238,53,131,222,162,7,
+6,0,149,112,212,200,231,106,77,50,59,138,91,0,64,8,126,195,43,35,186,241,125,243,
+46,71,141,48,139,246,93,91,111,246,86,190,93,178,60,67,237,157,243,181,180,197,225,195,
+215,248,107,102,62,226,130,238,3,165,134,249,86,158,73,82,56,170,46,185,68,72,95,105,
+17,84,236,226,28,150,211,190,94,89,51,168,77,8,217,142,178,23,156,172,122,102,24,52,
+50,65,231,5,243,220,44,168,95,53,163,129,191,235,138,30,161,3,39,43,125,134,250,66,
+80,212,226,210,200,56,28,113,235,106,1,15,162,45,210,246,242,86,115,228,147,97,154,212,
+229,187,59,47,65,181,95,64,15,211,199,115,3,142,149,21,240,90,104,129,100,66,101,152,
+228,241,216,214,36,232,199,37,231,103,210,125,148,94,0,58,220,72,231,189,233,176,27,187,
+106,205,93,195,223,228,66,25,133,17,75,14,215,37,79,41,192,182,82,161,136,209,33,22,
+203,88,61,234,22,181,131,152,21,74,214,53,201,156,160,58,206,202,54,174,246,157,232,234,
+179,188,76,39,85,14,59,1,118,110,118,227,71,25,26,181,10,26,148,163,170,61,119,192,
+169,29,140,60,20,20,42,120,237,141,148,37,184,87,210,225,255,90,191,86,179,203,100,73,
+103,135,211,221,215,142,199,83,179,223,105,71,5,232,213,67,243,178,118,199,245,39,182,3,
+1,3,17,28,29,202,30,25,231,156,188,61,46,31,29,75,94,189,110,165,34,88,56,44,
+12,54,14,95,220,78,46,78,95,35,77,242,201,123,121,174,25,102,52,169,154,193,140,238,
+166,188,19,65,63,160,162,209,207,199,165,160,249,200,66,210,69,49,219,222,140,5,153,178,
+212,153,128,239,232,200,8,172,130,91,115,141,220,147,197,34,155,149,31,129,200,191,72,109,
+140,201,0,88,130,202,55,210,222,149,199,175,30,13,102,94,218,4,129,94,82,251,240,106,
+102,138,82,19,93,87,189,59,24,114,79,24,62,228,131,5,158,101,91,72,228,132,113,146,
+105,14,227,97,128,61,100,237,93,115,210,78,2,222,209,90,103,93,162,184,216,177,35,118,
+197,125,166,72,95,132,97,177,247,252,227,154,92,179,1,204,254,206,75,190,21,78,191,200,
+116,94,59,122,187,116,114,96,150,234,200,203,199,54,61,106,134,164,26,200,18,75,224,81,
+212,151,182,155,202,51,199,137,231,91,239,20,23,99,92,159,40,216,216,233,42,4,226,174,
+198,83,60,64,54,243,199,117,184,76,253,224,177,129,154,236,136,231,43,1,59,41,48,161,
+165,79,48,220,113,34,73,22,252,77,175,11,73,89,133,198,90,97,234,153,145,128,107,234,
+40,171,175,106,151,166,240,94,169,109,66,8,84,130,169,55,219,115,245,212,204,152,78,222,
+21,176,174,177,37,8,87,177,166,162,16,216,235,35,48,203,183,4,13,21,20,164,177,104,
+144,94,157,145,65,154,254,54,63,205,159,210,45,243,226,202,16,31,3,155,239,137,246,74,
+194,116,32,236,100,190,23,155,127,89,209,100,95,173,196,104,134,55,104,99,153,113,186,171,
+90,131,6,51,150,254,115,226,84,129,48,90,136,96,58,123,201,224,101,36,121,82,76,204,
+225,230,109,61,10,57,19,242,206,255,50,219,7,35,10,169,156,204,170,177,205,244,51,84,
+195,6,170,139,29,185,114,107,28,48,105,26,160,69,226,201,178,210,139,178,102,36,114,192,
+96,201,101,77,199,53,0,193,185,93,84,211,242,148,186,228,121,85,206,66,11,151,44,228,
+49,44,193,129,107,246,99,225,246,148,96,164,82,72,209,165,23,50,220,25,99,112,242,63,
+154,171,65,206,104,114,218,68,224,239,197,104,133,252,118,104,165,212,109,83,78,12,249,12,
+44,48,37,109,21,51,212,135,217,213,96,219,232,238,115,216,36,156,243,240,100,63,218,53,
+65,136,71,208,50,113,226,33,177,56,212,92,166,220,224,199,42,52,171,40,150,190,27,121,
+32,39,162,12,143,171,248,58,186,189,1,129,5,208,218,221,225,192,2,122,43,132,11,38,
+132,52,222,86,225,142,2,138,40,76,94,141,210,221,195,101,50,73,101,93,72,148,38,252,
+27,203,81,38,61,198,130,15,144,232,62,251,179,45,44,16,238,185,71,128,41,88,179,167,
+16,0,215,57,94,8,183,190,125,81,19,96,30,70,244,110,110,139,55,80,21,229,80,166,
+213,31,115,19,140,20,87,109,88,106,86,82,46,187,42,87,29,208,107,133,153,128,69,132,
+37,189,29,149,122,212,81,155,66,36,79,105,221,101,145,238,236,242,50,217,210,228,102,83,
+104,198,27,1,50,69,165,14,3,74,51,126,201,206,143,247,141,234,72,155,217,62,82,113,
+132,138,153,17,47,92,210,238,136,148,119,154,139,193,131,19,130,124,115,33,242,181,158,95,
+220,212,212,247,172,45,228,221,85,126,248,128,77,19,225,62,3,97,112,100,201,250,183,185,
+158,9,252,32,29,125,74,200,11,194,109,219,236,197,47,228,251,106,254,53,77,14,99,21,
+56,228,238,101,133,62,70,215,249,37,233,81,69,101,123,209,252,150,86,241,27,11,192,226,
+158,126,230,42,131,156,44,16,128,87,38,30,18,225,93,90,72,9,11,215,28,74,161,34,
+6,161,239,206,239,96,32,195,98,154,75,185,225,189,79,152,67,9,206,66,94,237,81,65,
+77,51,120,133,72,64,146,100,95,64,136,113,134,169,236,199,145,48,216,29,82,102,44,32,
+35,187,25,23,17,88,67,150,92,233,239,35,148,26,252,58,40,66,213,113,12,2,177,218,
+26,103,186,16,124,192,192,96,44,209,240,179,157,172,193,113,197,100,88,252,199,0,97,33,
+133,101,187,118,185,239,176,67,3,134,52,234,175,203,238,248,211,211,106,229,84,81,39,85,
+180,221,57,70,225,250,4,153,190,136,149,213,212,113,127,134,239,240,155,104,217,33,144,15,
+188,16,11,146,17,3,195,13,50,190,71,108,253,236,155,175,94,254,63,223,175,59,106,222,
+149,255,2,201,245,190,184,206,217,239,3,152,45,248,138,142,62,99,116,28,193,180,12,162,
+128,36,211,218,57,150,64,211,169,254,183,39,142,121,178,222,254,125,85,156,23,151,73,32,
+236,45,73,236,116,75,163,197,232,172,38,36,203,105,159,1,200,28,73,132,224,106,208,28,
+144,199,189,48,73,59,59,40,60,129,61,199,240,211,223,253,27,157,183,78,174,248,222,53,
+93,114,240,26,201,64,142,41,72,28,193,48,76,116,147,132,105,185,185,166,220,118,222,219,
+119,150,250,10,255,171,140,222,12,103,0,88,232,28,198,57,65,179,159,236,10,228,122,188,
+230,5,12,52,227,205,176,127,177,105,150,153,70,215,118,191,119,18,214,14,3,107,85,175,
+213,141,196,47,71,245,49,127,7,114,55,91,255,19,210,217,225,111,240,93,214,180,57,53,
+125,246,71,134,32,177,44,146,216,238,243,116,244,55,14,246,229,26,249,254,95,210,229,192,
+220,231,108,196,253,110,79,181,221,105,180,251,228,140,39,192,211,235,8,15,180,40,19,93,
+114,95,93,19,182,24,60,219,184,35,3,253,210,152,52,247,51,224,24,0,128,47,130,0,
+190,190,0,132,115,211,202,32,25,89,40,189,232,219,183,58,230,145,180,76,78,156,241,84,
+183,201,126,177,146,221,163,226,85,46,93,83,248,85,244,246,163,169,126,230,174,91,145,119,
+73,83,166,28,35,178,199,165,169,82,242,117,40,158,220,183,20,23,58,230,41,64,111,200,
+22,97,76,60,247,129,58,52,223,194,128,162,58,195,32,0,120,34,1,215,27,209,105,162,
+186,207,218,107,238,174,40,98,22,217,91,135,75,69,40,9,22,145,0,15,188,166,231,105,
+64,237,225,95,86,86,69,114,20,218,98,31,36,230,228,84,131,129,14,73,129,194,34,13,
+133,45,167,67,70,91,208,95,178,141,222,49,103,239,154,64,159,36,160,38,32,13,114,99,
+26,26,27,43,188,186,54,68,222,2,22,3,198,209,61,28,221,46,173,124,76,217,64,46,
+229,156,108,225,156,253,10,25,231,9,239,178,48,85,187,197,125,50,207,218,196,177,77,86,
+212,78,156,134,207,107,148,163,160,84,36,147,215,249,71,186,187,56,219,69,80,53,160,211,
+77,222,230,215,84,42,212,154,128,229,204,152,139,172,41,84,227,140,57,248,176,139,56,43,
+157,77,186,48,211,1,197,112,99,170,230,116,72,161,191,53,105,234,178,69,78,89,68,104,
+249,106,163,155,198,58,5,220,8,59,111,199,226,57,199,5,177,62,47,215,23,144,16,65,
+8,0,103,187,21,167,160,41,184,209,146,156,167,168,188,157,81,34,138,6,196,179,187,86,
+78,70,195,119,251,50,204,181,114,136,135,139,200,88,209,225,97,192,69,98,94,22,19,244,
+207,111,36,120,49,196,206,105,113,53,85,1,225,119,48,193,206,154,4,220,246,14,31,79,
+86,236,14,23,22,229,3,241,204,139,1,92,97,196,132,2,101,192,186,225,131,132,13,102,
+82,33,65,2,76,66,36,37,108,39,92,75,224,164,57,106,12,200,77,80,222,191,144,114,
+113,92,241,120,8,128,16,25,178,60,138,101,50,240,88,199,49,157,108,83,50,196,109,242,
+51,168,196,83,16,10,14,147,246,100,147,69,20,70,106,113,26,146,169,65,137,186,87,22,
+165,94,22,153,161,213,111,196,139,7,21,67,177,44,173,247,158,38,123,126,40,179,39,164,
+85,48,146,48,138,13,25,99,4,233,253,96,248,225,251,185,207,203,0,122,90,16,3,199,
+119,58,165,124,105,134,107,187,149,179,238,230,229,61,89,45,214,132,116,108,236,253,174,46,
+203,208,56,114,6,166,85,179,244,175,229,200,151,185,218,202,230,60,78,206,153,113,74,15,
+179,196,47,143,165,23,137,10,24,131,82,76,174,135,141,188,164,90,26,29,211,189,208,97,
+216,168,40,147,116,142,112,144,80,135,71,91,115,134,239,57,157,45,6,17,23,216,57,102,
+81,208,25,10,1,81,16,181,66,85,10,90,83,154,87,47,30,122,176,70,6,158,165,224,
+94,33,192,202,82,184,208,14,32,118,225,34,224,105,58,174,215,97,196,97,120,240,202,67,
+106,53,60,86,106,65,200,193,192,98,148,91,147,75,38,226,170,157,155,99,170,147,240,127,
+68,211,49,182,237,155,0,130,112,180,47,79,136,241,161,203,185,181,37,122,162,0,39,252,
+195,124,56,226,6,72,126,2,18,232,208,202,251,87,246,129,253,197,161,88,54,164,52,137,
+62,81,196,91,85,142,98,236,127,68,49,205,18,61,145,137,106,217,29,227,208,120,136,232,
+147,30,242,96,47,37,130,241,139,55,182,240,223,145,23,39,141,154,85,89,128,26,165,63,
+41,103,78,6,53,3,141,75,188,136,198,251,39,112,67,78,160,100,236,4,232,4,194,36,
+57,65,200,238,53,105,212,207,157,120,205,117,107,27,134,232,129,39,196,227,158,249,152,16,
+0,5,1,1,5,95,247,230,169,89,229,200,115,71,145,36,128,103,242,112,177,39,173,49,
+184,96,92,131,88,169,97,15,77,29,212,156,55,164,240,246,85,35,59,85,150,167,224,160,
+187,146,206,213,245,16,197,114,139,227,122,198,103,53,196,234,135,67,31,10,110,221,106,77,
+200,94,120,201,231,219,122,89,11,153,20,40,126,237,33,79,13,134,222,196,32,24,22,9,
+236,2,9,129,0,55,129,2,1,120,161,86,79,45,52,189,53,82,164,120,247,206,208,222,
+211,234,119,123,104,154,114,229,126,70,86,173,189,46,70,52,252,123,79,192,184,7,81,131,
+128,38,126,223,26,242,229,172,132,32,45,57,0,34,4,149,216,158,207,69,52,181,164,225,
+203,103,7,23,96,67,219,41,115,118,151,40,166,237,74,232,23,75,184,69,146,137,25,120,
+25,42,146,40,94,174,186,156,228,7,118,168,181,165,189,131,59,95,49,12,108,252,170,157,
+159,85,187,123,215,181,151,191,147,53,244,78,26,148,207,130,76,108,124,8,27,71,157,141,
+135,130,127,138,118,10,109,95,226,112,114,108,29,195,40,73,51,224,141,240,58,222,175,127,
+25,244,98,65,164,48,13,97,218,239,178,172,135,21,215,135,236,42,166,158,230,212,6,69,
+25,220,90,13,161,238,102,56,45,103,67,60,141,119,123,37,18,113,72,28,105,6,168,15,
+0,69,200,242,207,171,221,19,164,1,152,130,187,242,238,206,232,203,198,100,137,188,39,132,
+207,52,7,12,128,248,38,171,242,181,241,224,24,95,91,15,11,43,201,132,4,44,12,131,
+17,67,181,251,147,145,132,101,54,120,107,171,171,113,72,14,29,61,164,32,63,45,12,4,
+38,168,165,213,21,127,25,72,233,29,69,225,156,238,33,185,90,12,206,204,24,5,138,241,
+169,165,253,37,42,82,71,137,3,17,76,52,247,225,156,242,7,40,81,64,27,34,215,206,
+248,87,169,9,35,213,71,2,12,79,224,136,210,156,194,68,227,135,97,10,7,133,160,154,
+242,126,47,74,247,190,140,88,31,3,230,242,179,16,32,149,131,68,83,129,182,191,157,247,
+223,215,216,119,185,207,91,139,174,117,31,253,88,38,90,243,234,125,236,138,155,221,94,198,
+236,184,217,60,88,216,221,31,148,217,117,0,110,149,34,23,165,122,35,117,238,76,111,204,
+9,76,143,32,238,45,246,161,0,58,234,150,16,39,214,178,33,28,215,78,235,202,64,32,
+128,64,202,60,89,113,173,49,211,57,192,80,34,28,36,122,211,12,71,152,248,144,96,181,
+160,32,106,17,55,54,14,83,140,18,79,67,45,87,13,194,102,230,114,59,133,178,91,138,
+33,177,226,61,246,169,134,155,144,52,18,180,199,148,83,16,203,107,113,149,141,113,132,16,
+125,249,63,217,245,239,163,18,249,243,224,38,16,3,23,166,40,129,157,119,213,165,20,233,
+55,31,118,117,91,90,102,68,230,75,103,124,131,117,93,204,104,89,36,19,29,76,39,85,
+254,206,251,36,136,12,155,95,152,179,212,33,38,17,172,212,72,52,164,9,222,53,31,15,
+34,197,114,228,216,160,41,34,72,13,166,32,167,91,98,203,242,12,162,46,8,221,21,13,
+113,69,27,67,199,39,189,20,200,105,34,1,24,12,152,242,161,143,26,162,169,42,219,64,
+62,199,86,84,225,13,114,211,104,10,22,189,131,250,25,149,242,35,28,220,132,9,63,158,
+100,141,22,164,88,250,114,60,206,32,53,252,57,29,43,28,59,162,119,157,189,198,40,222,
+249,17,133,21,8,31,62,228,25,229,11,246,136,0,125,245,133,244,110,158,109,140,12,69,
+47,99,24,6,89,115,62,22,216,178,254,190,70,154,95,94,205,7,77,129,196,244,247,197,
+223,90,192,74,84,106,36,39,106,154,105,139,236,80,3,56,216,186,81,201,166,8,231,17,
+117,14,119,42,30,160,102,154,178,56,137,223,64,173,117,58,233,116,84,133,88,212,240,239,
+42,216,152,131,202,89,30,13,36,208,114,174,171,192,235,41,194,104,7,45,58,51,249,234,
+165,100,117,114,34,189,104,86,92,118,179,40,139,42,162,89,203,217,150,64,93,40,245,58,
+93,74,48,220,164,112,18,226,220,174,143,93,23,253,187,150,13,36,184,126,97,130,232,133,
+224,100,13,231,96,32,155,124,128,193,208,230,153,199,88,163,49,12,6,193,93,14,65,206,
+52,85,185,175,139,71,87,86,111,50,12,148,95,169,84,7,2,192,83,224,19,32,117,163,
+163,205,21,83,119,0,61,221,19,239,0,175,80,211,33,6,124,246,232,85,80,34,28,93,
+226,111,74,98,200,153,254,94,123,80,128,182,166,48,148,16,178,14,147,120,84,245,168,113,
+245,90,169,48,141,38,22,146,55,183,84,221,42,198,196,41,239,139,184,48,166,85,151,188,
+184,14,43,130,35,121,123,14,13,253,86,41,145,154,126,198,167,100,104,233,242,197,127,185,
+22,48,100,80,217,76,219,18,249,191,130,152,223,2,184,79,234,134,201,222,216,83,244,82,
+84,33,42,177,199,93,174,170,18,75,210,150,216,180,60,12,136,227,197,78,160,104,182,16,
+104,149,98,166,199,227,9,9,75,0,13,11,8,0,123,30,22,227,80,7,89,71,96,45,
+98,241,155,144,68,64,87,204,185,60,155,136,138,61,126,33,55,66,0,103,179,19,128,200,
+66,20,174,45,252,101,74,222,2,80,20,7,94,178,168,231,106,145,143,43,115,73,55,28,
+148,187,138,167,210,141,206,159,82,123,125,143,30,136,170,74,12,111,119,239,209,148,193,113,
+130,13,82,7,47,227,66,156,126,150,156,47,88,152,49,55,198,78,194,131,233,242,246,133,
+0,0,123,255,60,40,63,197,81,223,185,246,157,169,207,225,181,198,132,238,203,183,226,192,
+41,252,37,157,72,57,139,79,40,184,56,105,29,14,2,49,45,93,57,52,105,206,8,230,
+140,108,26,185,86,220,34,118,115,100,222,91,170,77,111,107,156,192,58,26,214,20,4,64,
+161,182,138,58,202,175,21,230,255,23,92,168,153,238,19,110,27,28,147,99,28,83,16,32,
+47,10,239,171,148,90,5,110,143,32,134,176,6,0,176,32,69,14,233,167,225,81,251,26,
+208,239,7,223,79,207,91,82,11,146,82,114,133,77,253,198,251,195,116,39,38,78,233,37,
+29,223,182,36,58,219,124,246,21,219,52,122,120,26,116,180,6,171,51,115,47,77,64,62,
+63,180,111,84,112,97,6,192,28,224,215,27,15,23,135,12,158,127,14,87,35,111,197,234,
+159,3,54,23,177,142,223,98,189,147,223,54,235,52,113,217,189,185,226,121,132,58,12,88,
+182,151,109,229,75,47,17,100,246,114,144,14,199,51,141,75,185,37,146,252,133,145,249,123,
+78,220,190,182,17,156,202,88,56,246,160,234,197,235,74,186,205,15,85,151,155,92,180,42,
+165,230,72,142,153,47,25,76,77,211,144,185,185,138,81,186,148,17,189,138,187,116,45,104,
+154,219,43,228,132,169,224,210,153,182,247,160,214,158,248,176,120,62,139,138,172,176,94,70,
+57,177,33,136,15,187,175,37,255,249,44,145,73,84,236,120,126,93,125,100,43,254,29,153,
+153,137,105,37,34,110,207,152,117,250,116,245,52,167,196,247,254,222,118,6,94,45,247,106,
+188,228,202,241,124,74,218,81,161,12,121,24,126,226,12,103,216,215,55,175,160,84,33,169,
+123,141,136,252,163,155,108,200,43,87,206,176,213,135,180,202,204,74,245,202,170,12,246,109,
+118,141,219,158,210,226,162,121,253,245,234,15,202,175,217,179,23,100,238,124,201,94,77,18,
+72,98,175,83,115,71,144,10,77,152,56,123,170,162,30,79,152,56,14,48,239,197,252,0,
+242,95,147,177,182,148,179,49,50,5,217,7,19,34,169,228,162,39,119,157,161,187,242,243,
+39,6,74,94,131,102,165,68,65,243,242,48,31,5,177,82,108,124,77,177,61,98,37,159,
+122,145,211,64,166,4,187,71,234,81,11,225,149,237,10,36,37,172,105,21,228,241,215,24,
+242,74,182,215,27,0,94,163,144,200,47,78,6,227,235,157,58,200,229,174,102,147,214,49,
+179,106,106,55,143,201,53,9,31,103,162,41,192,102,241,100,253,222,85,163,37,209,236,14,
+36,107,0,112,194,15,83,162,230,252,118,187,33,82,87,13,132,193,98,147,177,120,121,138,
+49,240,44,71,80,153,251,40,248,223,148,215,103,162,26,219,134,246,22,102,73,204,229,144,
+190,202,250,145,128,159,172,252,126,250,79,159,121,222,223,250,254,50,53,59,196,191,147,110,
+212,245,103,241,11,196,189,19,135,234,226,76,217,229,213,51,121,70,142,46,87,4,223,3,
+187,82,251,209,157,249,15,238,118,84,61,66,39,196,213,46,186,235,113,107,241,228,161,135,
+112,135,9,103,17,95,1,86,203,182,76,99,33,231,88,179,111,180,15,18,100,255,223,118,
+51,36,132,57,2,96,188,82,155,62,13,66,90,96,12,177,25,34,20,33,250,110,74,192,
+87,102,35,1,132,170,64,200,93,238,145,68,80,69,192,91,24,239,128,167,35,167,163,222,
+46,25,75,207,214,250,240,203,150,96,35,153,85,36,56,211,211,18,34,90,38,54,13,22,
+105,79,44,212,81,224,214,78,64,199,81,28,168,217,242,176,141,128,251,159,34,186,99,118,
+226,80,188,126,172,44,122,139,75,88,236,180,150,49,197,98,69,249,150,154,172,165,95,106,
+232,90,217,232,14,123,37,13,13,89,123,146,231,169,219,41,154,136,232,169,7,103,186,96,
+129,64,32,101,248,238,245,51,54,181,162,215,192,210,153,118,227,17,134,212,44,244,37,230,
+215,51,203,226,109,214,68,117,35,195,150,5,98,0,208,249,209,150,103,93,228,166,16,198,
+28,173,246,230,134,72,47,81,146,73,186,132,180,21,228,252,35,233,27,121,36,46,238,215,
+99,99,145,31,103,213,101,255,20,4,160,73,39,132,132,0,77,205,200,116,140,121,120,70,
+21,117,137,66,85,254,56,4,46,160,65,192,253,98,171,243,253,158,151,218,239,211,192,245,
+33,244,184,234,174,195,66,195,246,225,83,133,112,174,219,248,65,200,150,241,27,247,148,238,
+178,35,189,155,48,134,206,200,129,61,61,233,120,28,181,5,154,153,96,210,130,80,4,50,
+169,128,32,43,138,77,192,171,191,132,255,1,0,181,170,48,26,65,71,245,216,30,7,42,
+93,199,243,91,141,44,56,85,223,254,66,113,153,83,97,119,17,244,231,18,156,40,84,182,
+254,29,123,163,41,96,238,147,179,95,252,114,240,79,7,250,68,7,223,31,42,127,34,218,
+27,45,229,237,27,169,64,52,235,153,147,110,251,171,21,2,183,157,73,112,244,224,156,43,
+227,28,63,241,49,161,224,174,213,133,130,116,212,93,137,32,52,24,103,208,114,70,52,216,
+228,176,12,163,199,214,224,144,134,90,242,224,162,65,147,70,141,112,66,248,248,66,40,235,
+245,121,207,25,145,232,205,111,175,63,221,79,22,224,154,12,107,106,244,26,75,80,9,67,
+99,242,255,209,231,229,251,213,172,241,206,86,165,30,110,78,147,23,209,94,82,150,130,98,
+174,134,200,238,176,184,55,66,22,37,40,180,104,137,248,235,105,95,63,65,50,176,109,90,
+158,161,229,223,6,188,153,69,156,142,41,36,46,179,205,130,240,46,113,148,8,164,161,191,
+137,170,141,218,185,184,21,240,181,212,217,38,177,95,95,172,6,141,53,172,156,121,39,203,
+44,249,229,150,68,218,233,112,136,18,184,5,238,126,239,90,76,14,235,191,222,67,129,3,
+189,65,54,37,115,122,126,233,49,238,209,132,205,232,56,121,95,72,128,13,37,189,81,113,
+121,91,79,243,74,190,214,226,116,5,18,172,174,96,91,229,198,231,100,158,255,143,4,80,
+115,35,229,35,115,210,77,60,208,54,87,204,136,11,94,187,3,4,191,53,205,5,31,231,
+52,105,74,130,192,64,41,16,74,0,219,67,81,60,224,56,46,99,185,148,211,41,160,184,
+23,225,193,52,116,138,133,200,202,48,40,89,65,236,86,43,30,196,105,122,187,213,127,19,
+216,96,135,6,214,130,11,223,11,3,128,32,15,96,60,201,252,179,44,32,228,242,123,56,
+124,40,21,188,247,244,188,238,196,34,248,150,135,165,232,116,36,113,107,213,219,197,173,54,
+77,207,58,255,141,71,204,128,151,59,85,87,81,207,102,242,221,236,85,225,110,221,191,181,
+16,102,199,220,16,84,11,149,57,59,220,251,181,81,45,28,162,56,81,111,196,221,138,71,
+153,73,49,149,33,77,139,23,84,142,50,1,193,32,27,76,5,39,97,136,89,198,15,56,
+102,72,3,117,122,11,66,6,6,21,2,85,41,24,138,9,52,210,229,157,118,73,30,37,
+187,137,251,31,163,174,220,87,25,196,203,124,138,198,213,104,84,161,132,33,0,31,53,208,
+44,5,229,135,190,253,95,63,237,72,214,107,219,28,199,245,193,199,181,206,105,194,217,109,
+47,143,11,160,191,58,11,117,91,84,115,38,170,32,116,173,20,242,229,221,240,170,222,70,
+2,27,213,217,221,196,6,174,155,252,117,176,122,70,99,148,177,187,115,57,181,200,115,79,
+156,68,142,98,163,100,161,137,85,190,250,247,175,190,205,8,13,213,250,54,35,35,212,73,
+16,114,9,159,129,247,207,31,51,145,193,228,167,248,94,71,127,129,249,81,189,53,114,106,
+30,34,49,248,167,75,136,108,8,196,92,229,122,7,87,191,11,108,94,167,22,137,183,13,
+115,182,104,152,18,3,7,22,192,23,183,119,152,219,252,138,94,222,225,87,58,65,149,242,
+91,197,39,185,236,124,149,41,115,220,118,164,108,72,56,159,54,105,53,73,234,72,183,235,
+42,43,5,147,1,130,141,225,140,36,42,242,101,139,48,240,39,56,33,210,230,67,108,38,
+204,34,226,89,45,183,46,224,156,96,160,195,205,65,102,210,213,231,108,26,90,140,45,92,
+89,121,30,211,123,52,179,216,166,90,210,126,242,174,186,133,138,160,199,2,56,74,9,238,
+84,88,149,86,91,54,95,142,5,103,100,53,141,55,145,105,168,179,191,100,218,214,4,195,
+64,15,84,129,102,175,123,147,253,201,38,238,22,89,55,104,31,38,135,232,124,72,143,143,
+175,61,56,237,176,96,145,221,66,14,252,80,161,105,131,30,21,116,251,140,238,12,87,68,
+16,229,24,67,68,120,84,234,113,222,239,126,253,163,213,143,65,253,249,198,51,242,246,204,
+131,79,122,234,162,176,152,60,91,204,205,196,99,72,242,144,195,209,198,139,56,219,108,46,
+197,218,114,76,28,214,62,83,189,122,122,186,221,89,109,99,150,127,63,113,205,245,144,226,
+90,192,216,11,73,183,246,233,240,251,125,54,208,59,215,106,224,233,107,118,20,38,111,234,
+91,130,255,49,58,233,113,233,126,127,197,158,72,55,90,253,147,172,119,191,16,171,122,154,
+53,12,171,212,152,150,212,221,38,178,117,33,122,18,25,114,125,243,193,100,46,252,128,6,
+63,238,205,87,131,50,119,141,247,40,119,48,229,197,153,73,64,100,45,177,161,221,81,134,
+75,91,108,35,16,153,82,98,40,136,101,238,180,200,21,140,77,157,167,85,49,63,93,110,
+112,111,90,35,73,236,116,38,194,183,55,58,213,89,147,81,215,26,24,188,218,235,80,154,
+243,52,32,143,85,255,34,1,21,194,198,173,168,177,229,250,175,116,208,121,196,80,96,43,
+7,213,236,115,190,27,247,136,109,61,236,5,148,122,175,189,254,239,7,163,82,54,4,142,
+237,174,98,249,107,38,228,209,123,146,178,34,146,185,242,163,49,141,65,57,8,200,124,248,
+115,56,210,249,196,70,80,58,153,50,72,1,76,116,20,207,174,121,176,93,6,186,229,19,
+101,128,146,135,34,5,59,50,209,9,156,149,137,149,43,180,64,190,18,245,3,206,169,146,
+139,26,87,149,180,108,196,70,7,120,209,208,194,58,41,171,201,5,183,146,55,139,164,52,
+48,196,15,226,31,155,133,85,90,159,172,176,201,191,29,49,52,51,177,167,113,21,187,254,
+161,179,243,135,218,22,50,15,224,199,39,125,57,89,97,171,87,63,255,102,181,184,70,108,
+128,161,75,209,201,81,182,95,35,57,77,73,102,155,64,249,204,108,3,122,168,211,29,239,
+151,247,157,187,118,14,6,42,86,79,122,3,38,108,2,98,209,172,174,59,36,202,221,12,
+176,57,228,67,188,211,255,198,218,167,125,103,216,109,148,81,199,112,22,157,153,207,236,252,
+147,82,175,196,108,145,26,116,17,20,234,237,96,71,154,68,26,228,140,59,102,188,114,197,
+134,107,225,239,32,177,40,209,144,116,122,130,83,68,131,9,112,103,153,55,19,161,240,151,
+211,154,56,187,93,218,180,170,147,110,93,205,126,233,231,188,64,142,78,97,174,86,216,234,
+235,200,184,235,64,210,214,189,98,168,168,179,178,119,51,208,140,179,101,178,94,187,65,207,
+45,78,235,226,116,240,182,86,99,133,122,205,12,156,226,22,165,5,63,60,111,7,48,160,
+3,182,235,252,183,223,69,22,56,114,50,191,15,53,176,149,213,124,155,73,196,15,75,177,
+54,253,197,111,106,94,53,198,242,31,131,118,255,118,84,170,125,66,69,37,57,226,116,128,
+142,95,132,154,148,122,71,190,161,125,165,131,57,186,172,17,84,76,0,130,165,67,146,18,
+130,213,84,148,117,170,20,209,158,236,245,116,211,156,91,23,106,12,122,50,40,167,160,54,
+80,232,141,194,70,157,175,23,188,206,13,255,181,50,44,6,152,105,125,147,74,100,82,215,
+30,7,159,221,221,117,124,254,163,247,206,221,177,192,154,29,100,147,117,159,10,218,43,247,
+216,16,140,161,126,154,19,219,20,145,128,253,202,61,110,113,121,147,252,126,44,10,140,252,
+151,24,183,191,159,137,250,4,9,25,14,32,247,255,70,118,142,42,140,84,32,89,167,230,
+43,97,151,119,135,68,254,163,217,26,68,31,168,227,156,218,48,248,183,253,175,131,5,184,
+50,124,95,13,135,77,39,49,217,221,191,135,21,248,163,225,172,25,147,202,209,89,45,172,
+110,219,248,232,86,208,168,152,189,19,21,76,55,123,70,114,225,145,229,23,179,215,127,35,
+137,229,239,229,147,229,223,113,49,95,64,155,208,64,215,28,102,6,137,104,244,14,44,236,
+21,12,12,214,246,73,96,79,56,245,232,151,213,77,86,220,166,202,109,51,13,183,175,154,
+111,161,161,241,103,232,179,51,8,42,126,41,138,221,151,11,237,226,57,206,233,212,97,92,
+247,234,105,121,72,156,12,43,223,53,238,216,170,3,161,169,32,96,7,215,228,139,87,22,
+64,246,156,147,52,188,160,94,73,223,121,27,232,82,166,203,252,51,220,228,141,54,36,252,
+101,150,55,153,37,41,106,153,169,176,200,227,233,42,22,13,25,39,222,206,187,90,164,140,
+81,205,32,56,80,89,169,177,27,164,31,49,90,107,37,199,14,74,1,18,152,181,42,89,
+245,53,202,168,21,46,40,130,141,70,71,77,31,228,94,231,30,66,245,247,164,23,211,22,
+167,137,95,3,145,132,249,126,45,89,237,173,144,79,137,91,95,214,91,85,38,143,23,38,
+172,46,101,186,8,33,2,182,169,88,140,131,118,160,88,188,202,117,147,210,172,22,9,188,
+37,32,68,52,240,5,156,244,136,92,4,42,39,193,100,164,116,14,78,207,208,60,189,160,
+238,199,89,159,0,226,52,96,155,53,124,134,55,97,45,130,137,71,138,104,96,86,61,10,
+223,217,164,123,72,73,86,0,99,234,16,191,87,37,158,14,252,94,119,7,2,102,221,116,
+1,222,125,9,127,254,239,255,47,126,237,118,51,163,75,224,222,168,197,213,189,22,181,229,
+240,162,93,111,158,230,109,164,5,102,149,14,63,152,91,212,20,146,246,17,1,168,217,28,
+145,221,171,185,125,116,65,229,56,44,91,136,145,233,46,40,160,30,174,205,159,9,49,82,
+211,27,62,87,186,54,228,39,197,155,237,45,146,60,109,162,232,54,163,183,92,11,104,251,
+182,241,107,250,94,69,70,62,59,78,4,11,212,142,156,193,43,101,242,123,200,101,44,237,
+30,39,7,236,131,194,0,66,33,0,40,139,60,34,9,0,204,7,215,185,211,42,36,220,
+110,55,178,170,221,155,234,84,112,45,77,202,250,221,47,109,44,189,120,16,111,221,151,22,
+85,21,183,77,80,144,183,195,25,171,29,194,9,93,163,118,218,209,5,83,100,236,68,119,
+8,229,125,59,190,173,180,19,98,31,222,115,155,13,99,78,34,148,24,11,1,69,83,23,
+64,132,237,163,180,73,182,249,162,194,250,106,235,89,136,209,213,155,116,139,246,148,166,197,
+113,175,44,4,200,56,93,116,36,157,151,250,79,8,226,217,100,228,108,84,229,39,113,184,
+195,13,178,92,118,9,100,236,20,251,152,98,79,201,182,77,0,9,48,200,144,73,40,4,
+203,54,56,227,71,170,235,54,21,77,6,99,148,36,52,45,163,54,122,100,224,155,25,242,
+161,159,178,150,74,20,164,237,115,98,35,113,98,76,128,172,170,41,151,165,15,188,143,133,
+64,238,79,151,63,80,214,123,63,83,183,156,239,7,164,66,63,80,194,107,49,65,161,93,
+149,88,88,209,21,223,252,164,162,82,212,46,85,140,88,24,69,111,65,13,48,86,112,50,
+162,213,102,148,68,120,147,92,48,12,88,69,61,96,113,56,225,136,151,165,102,105,241,84,
+140,170,62,242,31,145,237,42,241,100,196,194,146,50,235,133,234,228,169,224,238,180,29,23,
+121,238,171,240,215,226,84,4,20,182,77,24,155,120,44,171,234,71,243,234,238,165,224,246,
+87,204,173,215,158,19,199,166,175,193,159,46,166,16,90,220,204,54,10,194,113,180,219,198,
+83,163,89,209,79,35,202,0,149,71,220,49,138,90,194,73,5,32,158,57,103,25,62,11,
+2,6,76,21,92,142,35,51,165,152,137,160,9,100,224,158,131,243,96,97,123,246,14,212,
+250,87,162,141,91,205,3,59,16,41,84,167,115,157,233,29,162,203,51,104,206,141,50,180,
+156,254,141,29,197,13,223,199,229,166,87,208,157,126,156,250,87,116,13,40,140,51,14,45,
+234,84,193,89,253,138,32,209,100,213,19,157,120,142,35,246,147,14,188,158,2,94,15,116,
+195,149,141,238,106,3,215,116,82,13,170,254,19,76,25,185,238,21,232,107,12,28,233,128,
+122,76,110,149,214,184,188,203,193,128,82,244,174,73,214,78,63,63,188,166,48,93,126,175,
+9,226,37,49,214,0,87,117,50,137,126,182,194,216,118,89,3,196,93,74,155,218,48,47,
+3,191,45,138,141,244,156,25,97,29,1,215,216,146,96,228,16,59,66,158,117,17,87,245,
+17,54,48,215,45,34,135,58,196,148,119,222,68,25,40,235,65,131,44,17,31,133,210,112,
+196,143,174,173,255,123,86,221,168,45,125,25,51,158,203,212,90,94,218,208,224,93,226,20,
+91,176,91,165,109,217,15,226,117,187,39,51,116,95,6,124,151,231,141,222,44,116,139,184,
+31,125,187,198,120,234,220,241,74,13,71,91,187,205,46,11,233,163,176,48,127,190,254,221,
+228,212,219,185,115,130,4,6,162,140,152,105,164,175,5,205,237,0,53,35,99,83,31,117,
+114,124,171,53,254,68,237,202,60,235,39,60,171,67,230,195,42,150,151,41,239,225,144,215,
+167,200,71,129,33,151,5,175,220,195,55,115,57,30,108,128,140,9,183,138,78,222,71,221,
+32,217,225,231,161,198,127,159,68,238,174,134,10,146,115,67,149,47,99,45,50,249,82,226,
+229,43,111,54,254,247,19,127,143,111,53,125,56,200,86,24,20,105,14,43,114,105,213,41,
+214,152,235,43,218,86,199,183,106,45,16,169,78,4,228,108,146,186,171,190,44,162,175,213,
+141,32,195,133,138,86,48,143,33,58,53,226,96,125,40,222,99,89,171,47,102,128,55,120,
+135,169,46,171,94,45,34,189,110,211,211,87,56,25,68,87,136,204,151,183,219,234,28,73,
+72,200,76,54,175,58,173,235,228,21,100,39,75,47,119,24,241,42,100,111,69,225,82,42,
+16,50,222,133,97,234,243,44,13,44,200,136,33,212,88,206,37,141,148,186,51,252,121,36,
+183,101,87,116,236,23,146,98,24,140,243,137,30,199,221,200,156,196,243,237,185,59,212,7,
+86,9,52,209,51,196,52,189,252,91,163,11,36,73,82,82,45,204,25,130,119,119,22,56,
+194,88,121,43,12,155,35,250,38,172,171,0,207,122,19,84,212,11,96,211,254,69,164,186,
+67,173,181,207,84,29,187,223,13,3,168,53,61,10,166,188,101,76,151,210,47,71,76,214,
+14,246,129,232,5,131,103,134,52,93,88,205,10,129,3,42,72,182,104,54,251,130,208,98,
+145,15,55,193,57,76,8,84,20,225,143,167,123,6,115,52,0,61,125,39,100,201,221,160,
+205,58,226,106,44,104,74,202,42,226,222,166,4,126,185,241,242,44,81,35,75,27,190,252,
+63,136,74,116,201,239,209,215,124,239,232,121,159,142,135,222,192,165,184,111,180,182,121,139,
+251,125,44,213,185,29,167,222,15,22,212,215,217,145,140,151,110,226,177,59,232,195,92,0,
+194,195,13,149,203,77,4,119,10,248,207,205,24,195,179,146,64,171,17,166,217,208,148,89,
+67,243,203,193,152,160,224,148,24,49,42,22,242,65,146,206,224,151,38,126,67,95,134,173,
+217,105,25,173,80,237,78,111,230,202,157,182,79,36,252,108,125,21,59,205,223,183,237,125,
+3,238,232,127,48,116,127,83,189,53,213,13,67,94,173,14,172,192,222,83,19,196,78,156,
+242,241,16,222,186,0,10,181,242,95,30,172,122,28,24,89,244,161,233,49,159,63,246,211,
+114,225,42,234,143,30,126,45,111,125,115,158,21,207,48,207,16,68,157,170,188,191,172,97,
+76,38,247,103,107,45,192,119,171,247,48,59,194,204,239,181,178,193,19,236,124,147,75,46,
+253,175,5,69,66,13,33,126,93,9,83,224,179,216,35,121,219,80,83,17,182,185,232,207,
+15,91,111,155,99,50,209,42,103,220,241,215,104,164,205,36,199,8,65,170,35,48,72,206,
+101,112,28,51,205,84,126,17,204,24,2,183,198,147,75,196,22,167,86,30,52,120,91,233,
+241,132,252,43,37,49,6,13,51,40,233,32,108,131,174,37,91,87,199,93,39,226,0,90,
+75,223,107,10,115,147,58,98,187,78,89,76,246,169,195,240,96,11,212,146,96,36,102,12,
+231,75,108,24,112,109,247,95,197,163,10,63,131,158,82,67,149,43,158,253,17,118,210,33,
+142,123,19,238,181,75,49,88,179,231,84,53,17,208,248,232,119,19,176,220,207,11,207,196,
+53,138,83,23,178,27,162,86,73,106,48,248,112,48,200,198,43,17,74,67,14,151,64,86,
+130,204,235,14,86,30,48,45,177,132,125,183,52,97,143,30,188,19,176,35,254,55,38,228,
+165,111,14,82,202,73,246,61,134,40,49,91,105,113,231,231,193,104,14,111,244,15,209,125,
+77,126,225,250,194,248,72,31,174,163,20,174,50,104,50,18,102,122,238,184,15,181,176,166,
+237,181,35,167,115,75,227,168,249,2,220,20,146,208,232,119,220,164,233,136,137,205,220,99,
+236,136,6,252,190,2,228,135,169,44,108,85,53,68,144,78,113,183,232,39,29,136,197,24,
+46,48,161,9,56,160,138,3,24,50,51,124,15,161,27,200,44,178,99,14,191,157,144,38,
+90,238,136,240,39,193,39,169,215,111,15,107,40,225,86,118,241,160,80,51,183,62,46,222,
+205,122,169,140,205,115,172,203,96,206,247,207,95,226,42,161,252,17,26,233,133,244,175,207,
+196,179,210,39,18,172,176,165,16,196,2,72,37,252,115,101,157,16,73,199,29,204,39,205,
+245,12,38,4,52,37,238,17,210,82,137,168,205,25,186,229,240,196,114,54,54,6,31,85,
+45,193,158,12,206,76,70,12,112,46,71,37,215,227,190,142,175,4,138,34,53,146,82,160,
+238,93,235,219,98,242,58,149,181,190,149,31,238,36,243,221,129,180,110,255,123,1,52,198,
+103,172,41,22,229,101,57,14,40,195,121,220,61,71,89,126,248,86,181,211,71,159,75,82,
+143,161,18,110,148,182,24,242,109,112,195,51,216,31,92,212,23,155,48,20,38,208,91,59,
+44,236,40,56,94,81,209,136,160,131,135,60,202,67,122,234,59,215,32,238,52,172,126,230,
+78,202,86,15,93,84,65,65,229,174,190,98,69,62,199,238,47,143,148,243,181,99,165,138,
+140,93,191,170,234,165,231,240,110,199,123,185,167,82,198,61,254,64,72,34,199,47,56,94,
+13,39,29,174,126,15,161,212,29,181,107,88,107,191,29,172,40,203,237,237,247,181,151,186,
+41,168,24,23,26,134,55,4,53,49,38,1,153,148,13,203,138,19,80,41,173,15,14,190,
+173,226,121,178,4,181,219,107,122,64,159,90,53,157,179,247,28,145,215,253,99,249,5,236,
+123,146,50,53,94,76,141,106,27,46,15,195,142,208,60,141,11,191,45,45,31,111,15,49,
+161,218,13,23,94,17,177,47,222,165,76,35,232,203,201,158,40,144,239,36,154,190,24,254,
+55,137,58,179,145,79,64,136,131,117,4,58,82,151,80,245,198,93,65,2,81,179,65,253,
+253,54,197,208,37,165,226,154,167,189,236,71,115,247,226,226,83,103,119,194,47,25,219,27,
+180,227,183,35,112,139,187,39,122,251,67,113,185,194,215,229,178,107,59,188,197,179,100,233,
+119,246,98,157,74,54,182,48,57,224,98,146,137,160,80,30,212,5,235,151,73,181,107,80,
+16,182,197,234,14,4,112,106,20,126,148,163,59,242,85,187,6,253,172,178,77,161,128,106,
+141,83,188,36,103,225,98,171,167,174,144,68,112,218,198,127,190,153,86,67,51,108,156,255,
+102,145,80,121,86,49,140,231,167,119,81,190,159,6,212,151,2,29,217,197,59,64,149,44,
+107,114,75,189,139,56,40,64,247,148,148,81,216,44,108,238,214,2,253,29,14,148,247,241,
+212,113,160,84,204,57,77,235,211,199,80,2,7,53,24,177,71,131,162,47,99,69,78,218,
+93,154,222,137,121,208,247,180,245,38,206,204,149,90,71,66,135,3,15,169,179,232,119,173,
+113,9,214,216,4,172,212,148,251,212,224,161,119,94,193,71,169,236,232,80,133,76,13,162,
+214,115,112,169,214,166,26,247,62,246,28,218,195,71,213,225,192,208,145,47,68,27,224,137,
+161,94,72,173,97,96,2,80,77,97,145,244,8,98,146,26,66,42,40,150,93,34,174,171,
+65,231,143,77,119,126,45,75,73,139,123,195,216,187,140,59,157,131,198,188,15,132,31,245,
+190,203,151,245,132,200,104,160,30,245,233,51,160,51,125,123,251,157,203,28,90,42,28,9,
+209,205,248,212,53,52,0,69,60,47,104,186,42,54,248,51,122,175,32,111,102,146,75,197,
+40,81,163,185,74,75,5,12,135,229,5,115,100,45,10,211,157,172,87,20,62,90,121,234,
+56,154,111,220,232,203,240,62,4,36,248,81,76,142,162,225,135,224,102,4,27,191,55,108,
+161,135,75,111,147,189,161,14,28,255,99,105,171,153,218,44,224,44,86,160,244,195,73,1,
+148,74,182,0,13,79,124,56,38,75,148,83,150,188,3,142,189,217,215,125,64,159,139,157,
+130,85,5,64,79,98,82,140,245,92,181,8,84,157,24,39,52,97,219,47,252,118,16,87,
+151,184,212,85,130,211,7,82,218,164,110,118,92,254,63,101,101,141,87,9,35,211,207,243,
+15,163,80,11,186,157,175,155,224,63,238,120,32,194,200,150,247,218,111,14,25,164,49,23,
+51,232,162,93,143,103,144,15,38,42,108,222,233,124,75,122,79,195,161,17,135,34,76,184,
+187,164,142,4,153,108,227,88,150,140,235,216,15,195,139,160,175,61,216,25,216,253,132,204,
+133,8,2,50,148,41,41,169,76,224,68,119,166,16,30,185,202,123,246,208,11,219,53,99,
+75,188,175,121,219,229,70,123,190,28,23,105,133,232,177,163,239,231,60,239,221,118,154,200,
+56,234,11,202,104,5,19,46,171,204,62,46,157,32,141,177,74,21,205,118,171,203,218,40,
+120,203,197,168,142,224,167,75,153,81,143,46,35,255,16,58,29,217,170,17,156,203,14,128,
+199,72,13,1,190,218,116,96,169,156,79,141,61,12,27,42,63,247,91,39,214,191,65,16,
+37,95,54,61,57,211,125,219,173,189,211,95,115,49,159,181,255,184,155,93,174,171,44,6,
+82,90,93,120,23,206,184,225,12,2,100,195,139,183,205,46,24,118,144,248,142,31,243,98,
+49,186,60,152,75,228,54,46,116,78,163,12,103,100,42,222,237,226,67,245,94,161,36,197,
+77,37,115,21,73,85,129,156,192,63,42,127,82,7,111,232,216,7,199,45,231,103,217,251,
+155,197,53,177,188,151,111,62,158,234,213,244,222,111,100,99,102,108,246,129,137,125,253,74,
+53,221,51,94,58,23,188,213,191,143,32,180,240,139,33,214,255,30,225,11,61,102,80,249,
+202,231,244,21,82,153,78,22,70,158,110,18,88,143,72,235,100,190,246,59,46,186,212,123,
+255,63,79,202,219,115,39,225,205,109,180,27,11,195,136,219,190,113,122,1,106,166,241,241,
+1,27,229,229,161,15,177,215,244,106,102,232,173,107,19,195,200,188,32,165,174,144,217,214,
+54,66,24,83,91,222,92,136,147,177,50,181,199,180,75,127,53,110,188,116,147,41,245,178,
+50,135,52,39,160,51,24,248,195,214,97,102,208,241,10,172,254,73,123,33,13,65,150,216,
+88,218,230,175,143,76,48,120,2,6,34,68,50,129,72,233,143,41,23,103,240,182,1,205,
+153,95,213,152,184,46,66,23,113,11,13,155,206,166,24,251,51,40,2,40,191,207,123,175,
+129,53,238,117,247,184,222,213,29,188,74,16,239,183,30,82,253,6,189,20,52,104,136,182,
+47,117,251,176,155,166,36,170,51,175,13,158,18,226,7,145,71,239,76,130,91,217,178,224,
+166,164,197,75,242,130,151,69,16,63,87,106,209,31,91,19,175,27,97,8,82,180,72,183,
+18,67,245,183,176,57,254,39,178,156,155,201,172,254,134,99,105,11,25,135,152,141,242,245,
+253,61,103,238,83,228,92,255,124,88,15,36,108,190,75,34,32,57,159,51,158,165,251,169,
+206,238,100,225,75,255,34,221,205,25,97,67,15,33,75,36,128,164,36,132,114,43,5,134,
+253,246,109,121,171,82,224,52,188,17,231,159,185,86,66,127,211,35,207,53,62,227,51,77,
+237,17,191,211,246,8,197,173,108,214,116,61,195,118,184,62,173,126,224,184,84,245,96,249,
+171,16,228,218,108,244,46,149,92,116,44,155,172,206,128,166,213,195,192,212,130,65,74,253,
+142,96,198,14,163,219,53,106,199,180,77,82,181,174,176,51,108,105,179,31,233,162,135,154,
+125,77,53,69,216,4,139,241,105,233,188,1,137,83,104,105,51,148,237,232,10,218,96,218,
+94,84,86,116,56,122,144,150,150,121,58,147,17,178,168,123,74,24,85,0,242,76,56,42,
+169,0,238,76,137,125,232,223,164,3,16,189,67,107,112,61,150,212,56,243,170,95,55,17,
+112,0,49,248,225,221,183,135,224,197,0,99,133,4,132,64,8,162,182,214,114,158,27,198,
+146,129,66,18,211,226,64,202,81,98,236,136,176,254,124,189,145,45,28,29,99,29,54,45,
+65,184,216,16,159,158,77,155,11,20,232,121,203,156,218,45,57,72,127,110,169,59,224,180,
+38,168,183,211,131,130,117,110,54,227,244,155,23,117,9,0,221,196,67,126,252,38,197,247,
+141,51,34,40,219,58,78,110,232,90,218,217,250,99,239,138,111,106,63,230,219,102,3,184,
+206,85,73,88,7,84,109,251,202,124,241,189,217,48,66,177,99,248,16,137,68,75,213,170,
+127,98,64,101,156,191,109,19,214,92,91,237,226,145,43,182,48,242,210,247,115,193,50,221,
+197,37,47,54,26,35,118,104,237,94,3,232,21,78,231,201,108,18,80,98,219,33,130,34,
+88,70,171,223,235,220,113,171,55,54,196,252,117,215,252,141,237,42,212,29,12,223,184,57,
+246,11,88,0,118,142,71,73,132,202,184,26,67,226,26,168,135,153,120,81,0,1,82,98,
+88,83,179,136,228,221,85,150,78,44,240,250,178,65,193,42,37,224,234,131,117,102,89,89,
+196,10,109,13,35,188,213,189,79,193,193,132,212,96,1,165,17,15,124,95,181,79,74,163,
+115,111,50,149,55,139,245,248,182,175,234,85,60,212,229,235,86,156,245,98,76,165,117,242,
+5,90,13,23,150,69,166,28,34,216,90,48,221,131,70,231,233,24,177,90,214,88,59,40,
+114,0,169,137,16,72,62,203,48,123,116,226,48,7,95,224,148,158,156,64,133,177,55,129,
+35,65,30,65,171,40,152,21,98,152,32,184,195,186,135,128,153,106,151,153,73,244,192,126,
+126,201,191,182,250,199,17,76,198,162,190,180,94,151,33,93,73,38,46,83,181,27,194,199,
+139,235,24,96,242,156,117,65,151,2,96,107,248,209,29,35,33,247,132,132,169,121,83,40,
+194,50,124,156,61,170,209,214,116,22,16,214,8,183,150,164,95,78,114,229,195,14,139,7,
+82,68,6,140,57,73,119,158,124,73,183,100,242,186,198,89,42,188,127,110,51,197,183,69,
+82,185,224,116,103,92,210,86,126,22,138,63,203,223,178,77,7,230,43,169,239,80,189,148,
+51,33,161,159,135,79,165,14,210,250,98,134,234,152,82,243,113,94,233,214,113,129,69,0,
+80,200,137,11,160,156,164,250,72,229,171,29,239,4,234,53,108,69,129,73,203,9,200,53,
+131,160,174,237,18,19,172,243,43,182,240,12,85,185,193,105,24,74,68,38,225,62,151,54,
+220,196,86,65,9,83,117,249,251,175,194,79,103,194,147,144,120,6,49,133,239,207,167,245,
+95,194,74,151,170,49,25,232,233,161,195,203,98,253,248,222,121,35,234,240,151,45,144,0,
+108,133,8,121,22,226,24,60,187,234,141,22,127,87,65,61,68,160,225,136,174,6,249,81,
+9,231,255,178,157,109,152,118,5,48,244,189,153,217,105,216,94,194,222,127,44,190,97,44,
+112,141,76,162,145,229,79,45,71,136,237,207,125,246,191,73,142,38,40,229,204,197,118,110,
+47,103,21,117,221,81,154,61,166,144,140,238,103,234,167,137,252,225,168,211,224,193,101,133,
+29,134,203,21,252,130,144,216,209,35,120,21,5,149,221,185,110,158,29,133,63,148,234,159,
+187,221,202,229,102,219,210,84,85,107,64,205,65,197,52,155,225,47,147,146,115,184,88,86,
+224,252,12,192,136,195,57,165,143,187,148,107,172,136,254,134,174,253,106,174,145,39,212,193,
+93,94,159,42,212,135,38,241,52,85,236,153,113,27,214,42,209,109,100,236,199,240,147,54,
+186,215,91,60,228,205,156,247,35,142,247,207,240,111,59,90,216,221,14,157,85,72,207,13,
+255,123,231,14,158,201,75,247,92,254,206,254,38,182,90,44,0,233,26,217,51,145,136,37,
+149,247,217,213,50,31,85,249,160,48,220,165,235,202,235,46,114,166,163,144,31,23,251,207,
+107,158,129,84,43,236,235,76,51,101,22,31,62,103,71,140,97,251,31,112,132,187,57,187,
+61,225,1,34,99,208,244,134,77,82,191,249,93,75,165,198,129,86,153,198,178,150,137,5,
+98,95,84,33,241,154,225,220,141,186,119,225,168,55,3,168,144,197,163,125,160,124,129,46,
+176,6,84,232,202,50,26,52,52,110,73,69,163,170,18,79,175,10,4,142,46,145,144,251,
+185,215,186,16,159,24,210,213,17,144,224,70,203,72,89,230,209,222,211,210,243,246,92,203,
+102,218,84,20,173,117,30,250,80,17,3,122,116,14,188,236,166,144,151,79,78,221,78,240,
+94,227,233,33,135,41,84,86,134,36,236,181,242,234,150,111,202,197,104,68,53,10,14,10,
+202,160,35,165,41,122,171,36,197,18,169,10,99,89,87,204,184,172,104,182,204,157,105,45,
+31,155,162,52,218,100,142,181,0,189,221,76,111,186,147,200,213,76,168,189,254,23,17,211,
+141,145,192,31,86,189,154,250,165,121,221,142,46,233,193,160,12,55,235,0,202,50,159,28,
+178,191,69,62,223,114,35,136,25,237,132,226,161,214,226,220,140,81,100,148,210,230,25,43,
+103,54,23,26,109,160,220,140,74,75,61,34,247,195,49,13,3,86,3,86,71,33,60,58,
+194,184,252,24,173,95,91,97,26,162,111,5,55,251,23,33,173,57,165,101,186,102,50,115,
+181,246,135,202,24,158,103,202,175,85,99,245,29,213,82,192,237,177,67,193,61,120,31,188,
+107,32,204,187,61,213,52,2,27,112,206,18,150,165,214,158,96,104,8,197,238,9,94,140,
+18,237,3,5,243,166,67,129,117,160,167,180,180,78,189,9,12,115,187,19,175,139,52,246,
+10,147,90,110,35,31,84,207,174,137,10,57,158,189,234,85,52,31,216,255,29,101,180,65,
+246,134,229,151,126,140,168,186,61,47,98,20,177,84,33,139,158,143,216,234,164,158,34,200,
+163,136,197,48,85,199,76,142,18,223,145,148,97,15,64,77,119,110,29,33,250,223,70,154,
+127,29,221,194,211,60,109,114,124,105,70,118,116,184,210,171,96,165,165,128,125,173,109,34,
+105,52,44,44,33,140,135,38,181,64,164,234,250,108,8,207,97,81,221,33,131,123,148,40,
+198,110,20,91,124,51,151,246,14,197,132,149,139,47,31,179,41,102,217,57,236,34,65,140,
+119,105,42,77,104,37,188,213,254,24,52,123,189,180,202,175,37,7,46,175,201,178,113,220,
+137,37,177,14,52,171,199,32,195,163,245,200,21,161,239,47,226,228,197,79,180,36,180,247,
+80,216,206,31,74,86,221,50,178,6,206,26,77,150,145,23,254,19,249,172,171,236,160,236,
+7,249,221,98,192,114,89,246,178,133,244,103,232,36,96,17,110,88,96,117,170,114,118,144,
+1,121,5,70,100,188,135,15,178,158,156,131,128,170,83,155,115,134,235,109,61,2,156,159,
+135,191,157,147,165,242,42,132,169,62,6,10,172,175,188,146,172,192,23,100,154,6,58,13,
+156,203,50,43,177,162,74,184,110,132,64,234,161,177,53,56,78,237,204,121,200,239,162,225,
+204,213,70,190,60,13,52,36,219,217,136,210,115,207,234,162,2,254,72,59,172,31,92,253,
+74,48,75,164,77,67,60,13,132,29,94,130,141,248,60,63,27,47,174,35,238,211,130,160,
+232,33,161,105,195,48,134,48,0,220,124,247,46,235,39,211,84,159,132,104,180,91,41,179,
+240,245,120,236,129,84,142,113,67,205,62,198,76,53,49,42,133,188,108,209,216,202,168,154,
+221,14,234,112,206,9,91,231,20,4,80,121,70,204,135,239,127,174,251,196,108,78,0,244,
+124,201,148,103,63,43,1,46,244,195,181,201,132,45,25,94,140,77,154,149,4,139,72,225,
+188,202,230,74,73,110,174,17,205,220,167,221,91,183,199,184,251,212,111,56,224,49,187,174,
+196,254,63,166,126,7,118,165,118,50,194,4,219,213,122,20,19,9,254,167,23,125,117,8,
+190,223,248,169,99,131,149,75,26,122,241,164,167,134,176,24,27,176,117,195,136,76,131,107,
+106,131,243,111,21,34,180,185,114,60,252,7,77,148,185,15,169,68,83,149,91,3,81,55,
+70,104,14,64,140,150,51,40,31,114,220,85,17,9,185,107,222,230,232,204,163,238,106,202,
+11,75,172,15,61,149,166,179,205,19,253,221,118,220,223,206,241,113,150,205,115,45,229,43,
+55,182,39,3,99,55,95,70,165,196,91,24,49,218,175,128,102,207,188,98,217,160,225,147,
+81,106,26,0,66,220,201,152,231,13,110,222,84,26,180,234,67,12,196,48,30,232,225,187,
+87,134,99,199,199,108,227,66,227,217,223,213,61,235,110,188,188,239,249,228,186,196,127,127,
+65,202,123,168,47,49,101,111,48,53,188,212,146,197,35,169,84,144,64,240,163,35,71,95,
+21,84,11,189,201,239,178,163,149,160,99,248,89,223,2,152,169,237,93,242,116,85,181,69,
+61,142,114,224,37,158,226,249,54,114,143,252,199,48,187,107,225,197,101,128,38,208,175,199,
+73,9,197,198,112,87,100,43,237,166,137,111,40,216,189,84,198,4,124,133,187,237,246,199,
+90,137,123,158,111,234,103,127,75,254,68,65,65,110,77,225,191,125,179,198,41,232,110,131,
+198,245,221,84,247,231,86,146,15,139,72,92,104,179,176,227,234,56,143,249,241,44,106,221,
+177,232,193,142,229,238,19,95,150,85,125,67,165,165,235,24,78,124,248,76,121,254,243,146,
+9,135,147,35,237,150,232,198,187,181,67,179,149,232,189,230,123,119,19,149,173,68,83,77,
+33,192,2,98,250,255,203,191,174,203,229,76,213,113,130,166,59,200,172,217,115,224,184,108,
+54,183,182,36,245,83,36,176,17,207,213,56,139,139,177,135,201,97,55,81,89,30,123,242,
+56,57,10,128,227,80,22,44,204,123,24,13,14,146,189,166,203,71,128,86,142,200,87,142,
+78,69,159,23,15,167,135,219,77,240,200,77,128,130,14,111,39,209,243,97,1,155,75,47,
+59,71,64,136,120,249,59,139,29,110,130,49,16,111,152,36,172,211,62,84,35,160,176,154,
+22,9,88,190,25,19,150,65,244,90,146,84,178,205,64,190,34,40,97,198,22,244,164,77,
+199,147,16,155,97,161,145,249,96,144,233,236,237,103,118,94,240,0,239,2,170,211,80,243,
+10,93,139,181,160,232,23,248,108,74,17,171,186,28,253,18,186,80,10,85,119,213,177,213,
+191,104,170,225,204,234,62,245,113,25,244,14,210,235,161,245,226,170,153,4,38,53,168,32,
+12,64,102,5,216,78,60,71,114,78,56,126,180,14,81,199,245,230,5,212,219,76,3,153,
+83,151,85,214,147,85,20,150,64,250,35,26,111,57,93,217,3,9,185,56,254,68,202,41,
+220,19,140,248,66,0,127,95,155,41,239,143,59,59,103,226,207,55,240,77,126,18,188,78,
+61,15,165,99,79,160,108,36,164,163,46,174,50,110,173,107,99,46,251,59,184,6,236,68,
+197,180,138,217,134,99,147,83,46,68,168,48,215,178,33,171,92,187,62,17,100,20,160,38,
+61,99,84,197,75,122,202,240,37,109,69,76,235,227,234,224,68,72,66,55,215,17,216,121,
+208,204,75,164,149,171,17,109,37,195,184,146,73,254,191,228,131,225,246,37,71,243,60,119,
+40,229,70,53,187,238,244,189,197,182,153,191,50,83,1,91,74,113,54,176,228,86,178,211,
+149,181,219,86,220,235,162,219,75,74,118,8,189,217,203,31,135,43,118,154,65,51,101,113,
+113,124,192,89,72,56,205,35,98,105,35,187,198,125,157,140,193,97,156,156,110,135,60,1,
+46,151,146,178,148,252,36,65,10,221,214,222,125,40,157,39,124,154,239,28,189,28,84,52,
+117,55,198,234,183,226,179,19,27,14,191,140,59,93,58,185,128,47,38,218,113,54,162,228,
+71,178,37,227,86,159,6,0,75,55,47,115,52,109,102,30,44,38,217,181,90,196,133,75,
+152,110,105,140,107,101,110,188,28,142,165,29,79,53,95,166,207,177,177,11,227,214,204,103,
+118,30,167,164,40,99,110,238,198,136,215,121,229,172,122,219,218,230,49,9,24,108,202,230,
+203,58,209,82,139,89,15,65,83,4,242,28,132,17,64,231,105,231,186,192,148,163,130,186,
+88,175,162,130,158,61,19,103,58,49,164,119,154,227,27,195,119,90,248,93,92,251,36,249,
+223,173,134,227,118,229,68,12,189,12,45,163,155,55,230,66,78,159,130,247,224,55,67,118,
+81,55,206,91,99,122,94,24,0,185,180,73,152,156,44,255,68,203,130,57,111,13,156,130,
+187,54,107,248,198,7,181,8,179,221,45,29,222,216,18,4,131,104,136,159,103,41,24,212,
+128,20,145,181,189,169,13,128,49,15,194,133,215,239,199,70,227,243,36,31,9,242,45,11,
+104,232,249,216,62,7,43,169,38,0,0,88,103,65,89,239,164,239,182,153,190,81,43,164,
+225,26,83,12,79,219,182,138,81,10,46,245,100,21,206,88,144,104,43,235,212,180,70,82,
+73,115,24,186,193,78,91,136,41,75,8,62,115,117,205,151,54,0,206,125,207,132,204,234,
+104,83,213,153,209,183,47,250,200,147,31,7,105,88,159,217,247,153,245,88,120,221,249,124,
+225,132,94,160,114,185,102,86,223,241,101,76,254,143,225,49,151,175,189,165,233,172,191,179,
+228,80,86,128,120,102,94,198,107,89,13,235,113,8,244,60,114,225,65,139,8,110,8,127,
+238,205,116,25,155,27,69,101,105,0,227,113,86,198,70,39,239,192,225,151,35,134,244,64,
+122,43,110,99,234,104,250,254,230,222,183,77,0,239,211,251,42,55,59,79,207,2,128,45,
+28,162,75,138,148,125,72,23,122,174,195,122,17,141,242,90,105,120,150,120,251,82,63,82,
+250,196,112,84,187,242,41,103,23,177,20,43,137,81,92,238,144,189,88,134,164,68,18,65,
+36,246,113,74,243,76,125,36,90,222,59,124,233,250,149,161,96,39,136,183,233,118,116,242,
+233,233,255,64,39,242,184,137,252,236,120,52,94,21,123,41,39,52,79,33,176,9,59,119,
+134,210,135,235,235,7,222,53,195,164,220,119,89,137,211,56,132,75,54,129,248,213,149,97,
+201,157,6,254,53,71,244,241,15,79,254,50,108,192,104,242,178,52,252,235,131,190,16,171,
+42,139,110,94,118,69,176,44,118,251,102,251,1,122,254,144,217,11,25,226,154,242,252,32,
+181,251,155,160,60,208,105,132,84,238,124,184,76,147,251,118,113,151,245,31,211,244,205,109,
+223,23,254,195,240,46,34,89,112,84,35,233,178,120,173,108,84,120,59,109,133,85,66,71,
+10,85,134,10,42,202,210,114,247,172,38,204,187,124,232,241,173,201,117,45,237,145,133,225,
+138,88,230,230,52,7,26,18,213,233,102,131,74,16,182,218,118,56,107,211,209,160,143,202,
+31,85,135,51,241,47,106,143,255,37,251,186,130,63,27,16,119,213,122,255,29,237,222,123,
+121,142,131,169,37,148,169,255,221,14,6,144,72,71,14,240,125,191,66,148,5,90,238,5,
+51,159,10,87,227,243,163,170,72,203,243,181,10,179,115,220,61,95,173,55,75,20,15,90,
+106,56,133,158,82,83,254,141,241,21,187,130,85,179,113,176,20,61,7,16,143,174,200,223,
+213,99,7,161,226,219,13,158,142,248,26,254,29,27,94,86,217,54,167,11,189,253,166,185,
+39,107,217,212,95,215,27,194,29,34,140,245,122,231,13,13,45,91,197,46,152,220,107,7,
+46,51,123,130,43,251,170,162,48,158,249,108,163,72,248,237,13,95,180,116,101,68,58,156,
+32,27,236,232,22,139,20,62,43,102,31,41,211,233,153,23,76,87,154,74,47,177,137,243,
+255,207,200,116,7,253,57,187,201,190,255,59,44,117,82,29,182,169,243,50,81,47,79,99,
+35,59,237,187,249,248,243,88,31,52,4,185,83,246,121,91,63,181,63,94,122,138,84,90,
+231,85,22,215,156,81,154,217,143,199,169,106,189,6,229,170,21,18,35,92,97,133,241,63,
+184,181,72,218,229,209,117,145,216,148,196,134,229,250,125,46,239,235,143,7,111,127,141,174,
+144,212,127,173,251,10,239,114,50,188,204,218,156,250,177,44,97,235,71,218,223,96,71,213,
+230,183,114,79,43,12,15,76,212,168,108,37,49,239,75,37,54,141,228,44,104,110,186,155,
+163,95,108,16,47,10,12,98,122,105,106,91,243,8,67,117,107,232,37,164,116,249,127,123,
+205,20,211,246,112,104,0,232,221,188,243,219,207,230,30,22,142,220,171,172,233,17,7,191,
+146,136,101,93,37,109,37,255,104,73,147,42,117,91,225,20,88,28,92,42,41,243,107,82,
+14,16,246,99,170,82,136,19,28,234,81,137,196,209,193,202,214,23,180,196,82,44,98,231,
+15,79,84,250,187,189,243,197,250,39,134,117,193,175,192,68,51,39,143,53,132,17,187,171,
+110,55,49,2,227,44,42,162,255,59,209,129,198,83,128,151,131,102,147,113,42,29,180,173,
+54,213,148,14,247,237,133,248,14,186,77,237,133,49,166,64,145,92,250,111,34,170,23,115,
+73,155,66,238,72,193,137,121,37,181,81,85,204,231,39,46,87,147,145,241,126,118,69,49,
+255,15,7,6,42,245,85,192,148,8,255,56,87,174,150,120,167,88,216,205,78,127,174,103,
+130,57,126,35,102,150,29,220,186,193,156,164,199,138,85,208,196,54,46,12,236,16,212,43,
+63,135,82,67,152,96,68,228,104,174,205,100,192,212,174,169,90,30,89,230,90,78,247,185,
+162,221,36,171,169,4,56,56,144,121,103,151,117,99,159,196,210,146,156,160,189,166,159,194,
+148,133,46,118,194,76,125,66,88,128,30,112,244,66,173,250,10,196,171,50,232,54,40,71,
+9,252,133,75,192,190,47,215,176,3,191,81,73,182,83,190,212,221,113,123,120,234,80,202,
+83,245,42,97,177,242,17,105,182,113,29,254,220,105,73,35,16,87,107,205,213,71,228,107,
+77,238,98,91,164,137,173,174,9,193,80,101,74,38,2,104,73,7,41,250,226,88,144,211,
+89,105,61,36,116,205,184,209,111,145,203,89,109,90,240,27,70,185,46,16,137,48,183,241,
+67,173,69,97,39,28,247,24,137,79,39,217,23,193,249,221,85,255,121,244,120,184,167,56,
+254,213,155,212,202,97,247,120,112,255,117,65,45,116,216,217,89,138,155,105,17,220,44,108,
+78,13,48,191,147,39,199,58,251,193,91,28,161,16,214,43,139,120,195,214,79,57,95,105,
+200,202,145,214,197,95,157,133,167,80,95,151,219,58,177,195,201,83,20,123,254,214,92,105,
+108,251,87,58,45,47,110,101,96,15,79,110,184,141,124,131,20,92,190,186,177,162,87,131,
+14,116,179,147,170,83,202,154,70,30,58,128,82,24,36,206,191,113,60,134,111,84,129,167,
+10,182,184,153,171,255,50,63,25,102,57,150,24,221,192,60,127,127,119,249,155,48,84,24,
+63,81,239,28,159,127,134,246,82,20,128,253,33,179,240,127,137,224,233,19,198,41,35,141,
+173,88,220,90,145,151,79,195,32,196,74,135,13,207,24,26,26,26,120,119,45,127,32,180,
+239,231,200,151,17,226,81,31,189,239,220,155,181,168,18,123,143,210,29,113,246,222,142,184,
+154,231,5,159,243,81,163,229,247,214,69,246,185,24,169,218,100,229,29,30,143,245,236,95,
+234,184,31,78,233,233,166,7,26,108,42,64,34,42,222,85,50,132,86,57,69,94,241,137,
+118,43,198,91,138,189,110,225,45,208,134,89,43,162,49,227,98,180,246,58,60,247,88,173,
+243,139,25,26,208,98,80,230,23,107,96,73,244,138,14,128,239,167,186,104,245,109,102,222,
+108,187,164,231,38,243,223,94,237,78,163,70,7,75,105,215,63,5,91,17,55,185,182,27,
+164,161,24,231,76,56,70,102,45,162,36,33,149,130,41,155,27,40,61,144,122,20,205,133,
+36,132,12,70,60,72,182,128,145,74,123,120,126,106,32,117,212,85,42,127,128,128,115,115,
+231,193,198,212,211,53,62,115,254,96,170,128,122,97,6,237,214,234,244,255,247,163,166,109,
+219,116,191,142,109,215,175,169,124,199,159,212,149,182,125,255,186,232,88,17,159,47,189,232,
+67,207,204,171,63,128,11,71,98,129,85,202,251,27,238,181,171,197,240,217,201,93,213,62,
+98,112,184,120,177,207,139,27,252,72,63,55,221,211,179,126,152,250,237,224,240,213,121,32,
+236,99,73,212,138,2,116,92,113,23,147,156,189,216,217,236,73,50,28,114,15,151,20,51,
+252,17,174,128,66,153,145,156,178,136,254,140,59,217,123,12,24,161,79,125,154,108,205,74,
+25,131,67,131,253,246,215,123,219,101,133,58,255,84,241,8,27,141,185,18,99,104,38,100,
+225,42,117,124,141,172,15,253,201,252,254,94,101,249,220,166,62,6,112,133,169,3,181,145,
+216,203,4,210,45,104,63,233,205,43,200,20,154,202,60,136,137,210,133,50,72,7,159,115,
+36,39,89,33,236,163,106,8,18,66,110,115,133,184,48,33,248,31,171,152,4,147,24,101,
+159,158,91,245,23,239,228,224,192,126,155,56,206,68,63,15,57,227,51,85,214,164,235,124,
+31,79,135,238,253,127,246,178,193,72,239,166,203,110,211,150,234,6,210,196,76,184,227,224,
+221,220,17,101,197,29,22,184,48,139,101,174,33,207,136,21,48,128,70,116,30,209,141,216,
+245,113,105,162,21,139,99,129,216,34,220,77,91,2,81,68,12,102,170,51,175,99,97,32,
+251,115,110,141,39,31,173,167,57,215,65,52,241,125,191,138,41,206,246,253,246,247,254,97,
+138,228,191,17,134,158,243,190,159,225,70,10,135,7,191,78,38,116,207,90,95,243,200,237,
+60,50,75,100,87,111,208,255,164,122,83,17,140,215,253,211,18,122,187,121,55,73,153,121,
+110,120,17,70,249,82,131,220,208,92,21,107,205,142,28,84,16,214,73,195,74,106,196,21,
+12,55,21,157,48,172,17,130,193,204,12,95,26,73,124,168,23,34,238,107,135,240,220,139,
+31,220,236,223,52,141,41,83,65,74,93,40,34,74,111,4,214,153,131,180,31,114,226,10,
+66,239,135,182,151,200,231,116,38,203,252,244,241,63,85,148,51,209,229,42,183,11,172,16,
+67,70,46,117,235,74,212,52,152,107,252,70,72,135,219,147,253,249,125,177,119,39,80,45,
+3,54,23,151,197,70,38,42,98,165,118,44,160,16,90,39,34,162,140,174,197,151,157,122,
+5,59,106,118,108,237,170,182,129,134,219,205,247,27,171,176,77,49,37,234,154,47,186,69,
+167,172,117,59,150,162,44,36,132,3,32,98,54,0,110,74,49,21,251,14,188,102,192,178,
+141,21,95,144,19,156,11,222,25,239,223,140,237,80,117,158,7,140,247,121,54,99,8,175,
+2,199,239,160,126,230,124,213,20,15,51,123,217,27,38,49,148,235,188,92,133,101,35,117,
+17,144,3,197,26,37,148,39,35,50,74,78,232,200,253,161,30,252,66,48,177,224,231,255,
+39,231,100,146,212,74,198,182,216,10,105,1,244,95,226,209,131,78,151,159,240,58,40,113,
+143,217,237,61,143,70,8,177,43,102,208,104,99,200,94,147,114,231,101,170,154,199,218,210,
+193,151,254,118,62,136,104,174,38,47,75,169,244,81,97,252,50,222,238,215,128,99,221,14,
+69,85,47,135,252,236,234,117,170,253,124,111,206,71,75,44,52,40,167,203,206,135,182,220,
+94,157,247,195,60,43,89,49,94,70,118,32,61,183,139,228,5,233,121,137,62,207,203,58,
+99,91,184,154,163,37,55,63,149,41,200,149,42,55,132,102,130,143,117,23,71,143,233,18,
+240,88,28,147,211,184,168,57,116,163,31,51,138,27,163,16,180,123,197,192,112,246,126,105,
+175,135,39,24,200,8,135,210,13,233,85,150,222,238,108,97,179,242,157,206,150,252,12,191,
+133,124,161,112,253,181,81,116,146,97,116,251,188,143,112,128,12,96,127,0,221,118,249,17,
+155,182,86,225,155,195,127,242,88,38,33,182,206,202,196,55,252,68,249,40,63,32,226,124,
+146,151,189,158,54,126,65,109,9,37,119,242,223,236,124,15,162,15,213,2,56,99,188,62,
+56,134,67,165,197,148,221,3,56,36,81,145,174,22,106,5,144,107,224,39,225,115,96,69,
+166,185,244,2,17,154,152,92,24,169,228,92,135,93,128,255,154,200,201,63,85,5,73,221,
+31,169,28,113,159,144,224,189,13,191,169,7,141,106,0,124,149,148,235,228,189,117,228,45,
+71,155,220,229,74,58,240,52,248,241,159,46,229,158,62,60,57,216,224,241,188,176,206,142,
+16,11,40,69,171,82,172,205,17,22,68,53,51,97,3,6,56,209,165,7,83,230,48,153,
+242,110,202,11,139,148,242,251,160,43,213,162,94,137,105,215,22,107,196,189,207,55,246,67,
+224,181,227,41,200,175,133,224,182,253,171,174,229,164,96,135,64,236,56,120,224,250,187,199,
+49,178,93,24,95,88,159,220,157,203,158,106,96,54,212,208,15,71,30,68,108,167,59,209,
+137,61,254,237,126,160,53,35,162,227,178,57,207,66,252,9,208,236,231,97,27,200,75,221,
+152,99,201,45,53,117,9,254,51,56,81,142,90,179,79,46,122,39,179,92,240,130,41,252,
+4,179,30,215,85,67,177,198,193,70,151,169,131,250,61,100,132,172,2,254,138,237,158,14,
+113,121,22,12,104,190,57,125,111,208,228,112,117,117,190,75,127,167,118,199,144,163,110,245,
+31,240,85,154,245,101,108,226,46,107,171,220,251,90,251,171,237,140,91,239,225,34,153,93,
+13,229,12,209,124,49,32,85,175,54,218,244,201,62,136,147,218,219,128,166,187,174,205,28,
+199,27,241,46,96,43,9,46,247,9,157,80,105,85,213,75,185,49,220,87,153,9,67,237,
+160,204,113,60,78,35,134,184,140,142,177,150,71,247,204,129,47,188,24,187,165,37,141,8,
+184,207,167,181,88,8,204,164,156,226,125,153,248,0,103,31,201,45,76,175,133,115,29,69,
+113,65,92,117,161,221,217,23,116,79,145,157,218,248,57,19,130,167,187,178,182,161,82,190,
+166,223,9,199,146,231,148,47,38,20,155,243,174,215,137,10,129,68,143,211,157,3,179,235,
+72,213,171,167,207,248,54,197,1,122,186,53,56,218,174,186,212,193,28,37,37,226,212,68,
+174,145,28,57,72,254,157,103,97,200,223,246,19,220,232,42,76,58,27,8,83,223,136,188,
+6,88,145,61,134,224,92,193,194,255,128,109,63,251,66,68,243,15,23,213,102,152,218,169,
+108,238,109,169,161,209,177,144,17,124,189,65,163,234,205,219,113,185,168,117,71,3,163,128,
+194,134,8,229,127,0,255,234,48,202,2,94,69,47,181,143,56,5,127,169,78,194,140,249,
+219,255,156,245,33,83,57,172,114,35,164,45,252,68,74,167,108,198,90,130,68,112,123,242,
+198,166,174,138,35,143,225,158,43,39,203,235,108,191,105,44,60,207,51,125,124,246,23,250,
+155,217,204,203,58,82,66,251,35,143,135,150,118,46,46,215,5,79,163,193,146,2,238,237,
+9,64,93,74,173,56,174,214,254,149,232,40,83,175,105,146,142,112,172,90,135,102,17,241,
+183,198,170,223,92,134,224,175,212,87,253,233,210,121,100,126,104,249,174,123,126,23,80,71,
+58,74,94,179,229,242,218,217,66,60,92,234,113,250,70,167,120,227,235,178,168,70,244,72,
+82,189,129,194,130,236,145,187,194,109,129,186,90,197,242,0,217,135,232,33,191,0,143,146,
+47,158,128,37,73,154,54,148,17,166,78,237,200,88,157,55,247,126,216,168,19,131,53,77,
+26,64,195,37,132,21,52,11,164,62,88,183,54,137,90,25,74,117,233,200,148,78,155,193,
+40,223,127,174,45,181,169,176,183,94,123,67,178,139,113,190,217,38,146,193,155,242,42,92,
+255,73,173,237,113,93,41,167,163,20,109,149,209,196,94,74,239,173,188,210,84,46,25,50,
+139,115,69,35,99,36,75,122,249,99,23,148,250,155,138,190,12,138,53,177,8,82,10,90,
+164,90,229,82,118,249,139,86,246,215,4,21,200,160,201,41,194,174,215,30,178,144,135,148,
+22,60,131,225,56,251,85,155,19,236,97,254,239,66,135,250,30,119,241,207,251,14,38,57,
+99,172,34,207,0,219,215,115,32,147,185,38,38,250,41,63,146,38,219,181,242,240,15,210,
+78,106,252,159,106,99,158,7,125,76,80,203,247,124,109,19,148,141,29,225,120,8,83,72,
+189,220,207,180,238,100,200,50,16,99,48,14,133,12,74,30,57,50,110,39,25,29,193,162,
+4,185,209,198,76,96,196,64,59,52,118,34,40,84,202,8,195,83,61,61,19,8,1,130,
+5,52,209,38,172,29,204,240,56,77,199,114,220,213,187,121,82,56,167,202,119,45,102,39,
+47,60,225,82,200,117,118,66,224,211,182,170,142,244,254,253,61,179,157,15,189,211,179,118,
+205,138,251,229,175,105,201,216,123,119,155,237,209,55,246,29,228,4,29,228,84,230,229,183,
+55,157,60,244,161,26,210,39,89,60,8,2,216,173,128,236,153,197,62,30,0,124,84,224,
+180,110,187,242,160,139,2,33,219,54,210,59,155,122,90,27,236,121,172,187,212,199,193,235,
+226,108,162,221,2,37,82,220,108,215,4,187,168,241,141,145,187,251,115,196,166,163,33,69,
+178,53,230,159,25,168,127,235,194,130,106,24,29,202,127,150,56,230,140,91,220,252,179,219,
+36,11,242,66,130,20,232,83,108,221,40,146,126,169,150,45,32,0,30,9,205,96,140,136,
+151,198,24,65,78,89,245,179,15,67,60,232,102,234,169,122,190,25,165,119,118,142,255,223,
+108,233,86,152,232,197,156,88,83,66,190,114,211,238,150,127,175,237,126,172,158,238,111,5,
+25,129,135,53,53,84,253,205,219,247,119,155,177,31,65,178,11,231,29,195,187,25,188,136,
+147,134,178,151,171,104,19,84,240,161,49,163,128,104,54,227,148,75,251,113,29,126,241,56,
+226,92,53,47,164,179,8,206,136,94,229,144,129,118,16,102,7,50,99,37,47,141,240,203,
+84,96,205,245,121,40,177,240,107,137,204,174,28,75,116,92,193,210,225,140,106,146,24,107,
+98,96,148,105,101,147,180,190,158,38,174,243,17,208,57,212,14,160,97,171,247,214,247,169,
+32,152,96,216,196,234,175,211,64,51,193,126,13,146,61,14,151,81,192,239,194,43,161,238,
+233,85,171,179,106,90,213,102,96,81,209,177,46,213,116,148,174,72,15,143,179,61,195,127,
+101,0,228,103,23,123,202,159,130,92,145,243,35,157,184,130,134,43,145,19,108,195,168,148,
+189,27,165,183,92,184,249,47,110,125,59,81,143,121,106,103,51,209,12,247,174,216,189,112,
+74,146,191,200,227,59,89,63,76,16,34,233,93,94,107,230,126,169,9,67,166,210,90,167,
+5,166,90,5,124,145,187,104,111,38,31,115,73,108,156,167,180,157,28,228,196,9,37,218,
+214,59,100,224,56,247,10,95,154,54,209,179,40,181,16,45,214,51,215,51,72,236,25,154,
+144,141,53,13,220,176,116,245,11,12,39,92,24,98,179,66,65,7,215,14,225,12,7,48,
+239,243,143,88,211,109,153,8,99,107,124,242,144,28,236,93,191,25,108,114,254,163,58,0,
+172,38,213,179,244,97,204,54,53,254,149,229,208,175,112,124,23,13,8,198,110,199,3,194,
+237,247,179,17,205,27,197,155,63,167,246,240,211,131,89,241,58,215,199,227,12,166,109,200,
+13,51,122,186,136,254,86,180,125,45,26,221,223,172,223,5,251,23,71,182,34,13,47,101,
+145,187,114,70,104,48,224,217,192,90,132,153,241,213,211,131,251,209,162,120,211,4,74,2,
+87,205,248,88,81,60,196,40,8,36,102,41,4,64,119,4,226,5,40,188,81,154,102,162,
+57,60,134,108,42,174,38,135,135,220,83,61,78,59,42,203,177,43,38,23,86,34,114,60,
+78,208,140,236,26,137,83,57,94,126,142,66,221,227,88,120,251,8,92,56,7,238,10,52,
+182,157,30,244,170,46,108,102,82,235,229,238,254,158,167,22,167,227,47,126,255,117,153,216,
+242,185,254,215,174,225,228,164,88,235,234,130,106,140,41,86,241,74,131,215,26,3,251,57,
+189,122,198,251,21,21,211,211,162,171,177,80,102,46,64,16,67,16,230,233,118,115,13,49,
+222,4,12,135,61,10,183,106,115,175,159,198,244,198,178,225,24,132,253,19,253,30,171,221,
+254,173,240,101,250,92,153,195,165,145,205,39,17,213,91,27,186,63,19,54,113,16,2,81,
+234,160,239,237,141,176,195,212,245,188,108,206,117,60,104,54,224,36,150,207,211,224,67,222,
+228,225,7,234,227,108,189,151,29,204,44,75,246,131,111,99,189,202,221,181,187,248,165,200,
+190,246,184,30,145,153,225,76,15,118,113,73,73,21,182,234,237,82,76,211,232,170,34,122,
+110,225,209,160,45,43,15,30,29,31,48,188,207,160,163,162,157,223,57,2,207,121,127,196,
+176,240,96,207,40,86,70,133,2,60,98,191,113,129,53,187,173,235,223,36,206,63,85,99,
+219,31,192,102,7,108,117,55,52,81,82,149,68,78,232,151,87,217,75,205,111,61,100,210,
+221,68,238,205,222,135,235,194,63,29,182,177,23,242,241,246,19,203,189,255,93,152,193,176,
+123,189,92,198,220,240,239,197,13,247,187,109,92,111,231,216,106,60,172,229,22,105,230,155,
+224,37,20,240,13,25,158,40,200,118,59,101,36,128,90,20,91,79,16,92,76,156,76,46,
+18,86,98,66,198,202,196,10,230,144,132,177,108,114,6,237,110,26,88,133,106,100,225,58,
+73,197,136,2,4,55,226,25,4,8,64,51,30,56,35,113,65,59,231,171,203,36,12,34,
+153,177,133,134,116,242,228,111,227,202,81,250,113,61,185,187,189,188,166,175,109,248,62,17,
+85,27,34,29,1,161,200,15,147,20,18,65,137,127,166,201,212,244,178,4,250,170,39,227,
+206,96,220,191,144,188,21,192,133,205,44,155,33,225,24,108,5,23,132,182,235,173,95,45,
+223,147,52,11,61,13,84,120,154,159,30,239,31,83,115,63,224,118,251,224,130,10,0,220,
+205,125,0,53,55,112,164,10,102,95,157,103,245,68,62,128,244,0,25,27,72,73,165,211,
+235,121,92,156,77,243,135,127,54,93,11,208,96,238,126,105,189,74,195,136,53,21,242,17,
+227,12,167,220,193,185,132,246,116,71,75,60,86,109,72,236,253,143,211,92,212,183,35,79,
+226,27,133,60,109,145,58,220,206,4,206,26,111,132,223,45,105,120,51,233,38,177,78,27,
+120,247,229,146,111,42,134,246,245,56,124,61,10,231,131,83,204,159,10,194,211,158,213,246,
+139,252,71,47,243,34,42,59,127,114,75,182,212,117,242,211,80,27,171,105,222,34,5,90,
+45,79,170,156,92,78,117,101,243,103,216,72,101,115,31,209,231,226,100,103,234,228,114,234,
+234,101,242,159,223,183,54,206,184,248,232,46,204,187,53,35,11,230,36,196,61,199,23,156,
+245,97,6,206,39,33,21,184,29,195,229,204,174,234,85,207,40,129,47,189,248,89,142,13,
+31,19,182,201,248,107,120,31,235,15,191,207,118,150,20,223,27,165,135,231,207,61,95,173,
+163,245,251,56,203,133,92,81,19,156,162,252,254,90,74,127,71,209,193,111,248,64,125,99,
+66,31,67,177,131,141,44,193,33,112,69,154,196,34,28,61,13,75,22,53,173,34,108,64,
+178,42,183,102,191,147,240,185,222,54,243,245,58,221,43,237,183,181,86,169,109,37,247,21,
+127,49,180,247,168,120,119,89,76,207,6,32,189,142,140,153,51,108,92,89,233,142,3,158,
+89,145,232,159,245,180,215,211,63,97,6,236,76,207,91,61,35,53,135,54,4,187,31,76,
+36,73,66,224,32,46,237,132,147,216,255,61,94,242,154,63,149,164,62,217,48,253,255,128,
+234,126,247,69,46,212,224,221,155,168,187,188,207,223,45,156,8,20,240,1,145,83,188,180,
+94,24,128,37,136,149,78,189,74,244,193,149,136,14,35,193,245,78,195,144,47,75,48,144,
+194,62,40,254,250,137,6,215,232,99,73,93,153,129,159,86,142,222,142,140,212,118,189,115,
+179,108,59,230,250,218,148,248,31,173,93,210,171,250,71,105,119,43,221,164,204,0,191,246,
+86,18,51,157,203,166,203,239,251,35,159,65,239,79,231,218,43,73,1,122,164,96,180,43,
+57,66,73,225,198,160,123,6,119,142,94,235,191,209,84,188,129,239,2,165,77,45,92,230,
+215,177,185,55,220,97,117,132,68,16,42,229,79,72,187,118,2,224,31,207,92,133,19,123,
+75,165,135,122,138,248,172,75,23,144,22,79,102,255,210,98,61,82,252,149,24,254,143,191,
+197,241,223,224,252,122,53,116,176,114,38,9,42,155,225,202,127,107,234,94,221,222,151,23,
+20,139,227,223,134,2,166,63,121,30,24,149,17,30,138,60,62,39,6,208,202,111,142,162,
+203,195,121,29,176,219,91,247,191,190,139,69,74,176,61,14,34,173,110,183,194,28,245,226,
+238,7,104,241,181,85,175,169,228,11,109,124,158,122,236,125,42,74,96,102,199,242,139,137,
+104,25,169,118,196,131,221,240,158,102,21,114,98,100,102,64,122,150,3,224,122,139,148,189,
+53,251,186,90,206,140,175,181,146,102,203,54,161,73,224,156,36,244,22,40,131,249,101,81,
+68,128,24,209,112,33,13,170,40,67,216,157,7,94,38,207,237,3,181,46,40,11,81,63,
+37,176,241,78,242,18,51,16,115,253,28,81,149,65,184,163,106,1,39,38,109,75,220,74,
+253,81,39,207,126,7,198,139,188,72,48,118,197,142,205,145,217,77,119,239,135,89,117,166,
+41,9,12,144,136,142,186,135,252,41,184,204,161,250,129,134,227,77,14,205,127,126,87,190,
+132,151,145,239,37,138,239,46,34,29,116,102,238,87,235,201,146,0,129,179,133,141,80,243,
+60,11,100,122,189,44,52,248,113,4,14,70,13,122,4,157,84,107,194,198,5,102,103,26,
+57,67,142,59,168,234,203,229,118,87,62,138,209,43,3,211,224,162,19,204,16,19,9,101,
+215,12,99,135,3,214,69,111,17,1,171,10,1,45,10,60,122,85,113,112,181,207,202,182,
+103,131,233,255,46,183,241,254,215,254,76,42,90,157,172,6,127,84,162,215,66,59,187,25,
+26,124,16,250,93,97,176,141,131,171,202,154,114,97,104,65,21,25,119,69,14,196,150,98,
+112,28,171,37,55,234,38,169,202,33,25,54,103,70,162,172,123,188,125,220,45,183,246,121,
+24,132,109,170,21,249,221,42,41,29,239,122,158,84,69,172,42,226,8,100,251,10,85,90,
+17,135,98,39,24,135,147,62,181,205,126,137,53,18,237,255,119,71,150,201,61,110,44,8,
+1,79,138,80,54,106,147,120,163,83,150,236,151,213,201,226,51,49,77,36,61,123,30,156,
+3,74,74,26,180,250,134,208,33,174,2,111,250,59,99,127,107,243,249,104,189,86,59,107,
+142,102,237,224,174,44,45,215,5,32,73,28,30,215,25,87,88,229,45,16,49,28,138,171,
+136,11,61,133,20,116,165,120,45,250,27,58,155,179,195,232,179,156,242,127,183,77,145,216,
+236,161,30,135,71,35,7,46,182,38,183,210,157,64,13,213,84,37,96,13,128,224,14,6,
+71,139,252,135,61,94,95,206,194,232,117,204,144,227,139,139,222,213,47,88,121,135,244,63,
+18,149,14,205,217,18,224,108,171,167,67,189,148,77,237,92,159,137,50,179,84,229,99,192,
+119,150,92,88,140,95,186,55,160,94,37,25,158,115,7,75,173,147,205,44,133,245,117,245,
+144,142,15,33,234,135,82,183,186,111,55,217,41,207,237,86,73,106,234,174,60,208,145,217,
+126,228,229,9,220,220,20,236,79,111,60,91,132,7,187,227,8,194,1,248,179,35,136,13,
+98,64,12,80,228,98,46,40,20,8,26,7,232,246,97,90,168,233,148,54,238,212,81,219,
+0,199,49,214,164,40,76,102,100,105,244,88,137,227,175,37,146,238,80,250,14,241,37,31,
+38,151,141,3,45,24,231,136,74,161,179,197,12,140,253,252,84,204,105,4,153,184,5,69,
+48,173,118,200,159,91,210,159,84,169,126,188,9,250,158,15,165,15,123,121,250,52,248,158,
+223,180,229,246,223,229,115,203,247,211,179,26,3,234,57,109,201,58,51,21,160,233,67,68,
+90,196,165,234,27,224,42,194,122,220,168,134,126,121,40,77,16,97,220,240,212,144,195,87,
+2,180,108,111,219,37,0,248,60,66,163,142,17,59,134,23,78,109,146,199,16,241,61,137,
+72,31,3,215,49,241,94,70,51,244,225,52,206,115,246,18,29,211,43,27,42,144,91,208,
+24,239,119,139,233,6,136,73,235,192,31,204,79,214,227,174,217,212,254,214,183,30,157,18,
+20,191,217,11,72,247,224,90,177,246,188,31,180,45,243,17,71,205,237,60,239,62,159,91,
+226,254,109,192,11,11,0,118,123,99,88,2,192,0,245,52,247,27,230,5,121,197,121,30,
+70,14,55,52,139,5,210,248,43,224,75,37,194,124,45,94,172,33,203,43,176,125,153,237,
+59,185,243,225,249,253,190,45,25,14,137,248,37,135,56,223,199,214,124,219,149,62,113,213,
+240,59,215,30,1,219,145,133,38,208,184,65,131,120,83,143,47,180,254,10,118,250,222,231,
+231,237,175,106,205,93,190,31,181,204,112,112,189,201,25,144,79,124,237,32,110,32,94,80,
+230,8,3,82,187,221,178,179,55,234,102,126,76,182,196,14,1,108,195,40,210,142,124,170,
+238,255,185,110,188,111,166,142,121,243,113,235,189,36,106,110,144,26,57,127,97,219,204,183,
+236,190,240,128,193,135,43,225,93,113,237,50,175,151,157,161,180,49,231,154,79,31,87,119,
+92,1,142,132,46,157,11,84,185,62,116,190,65,208,179,149,240,244,107,25,121,92,71,171,
+107,254,183,176,140,210,195,1,217,57,196,48,12,63,253,251,255,99,145,197,251,118,120,31,
+143,61,249,110,151,254,210,71,247,52,246,89,241,62,182,111,251,98,99,7,215,178,106,30,
+31,151,204,255,44,215,201,69,211,6,105,176,176,152,159,52,117,24,156,153,34,225,107,190,
+3,62,132,213,49,45,31,245,127,191,165,153,163,16,120,249,194,81,156,112,24,16,121,210,
+38,64,15,171,150,64,40,153,36,168,224,1,52,21,162,83,67,0,24,165,120,193,44,6,
+63,138,35,102,112,154,222,66,207,176,162,244,178,220,233,13,1,47,69,171,204,194,72,196,
+120,170,238,97,242,234,184,155,138,56,76,200,47,218,52,250,59,93,247,66,151,155,75,75,
+186,183,60,86,1,102,128,156,122,167,153,201,137,53,244,24,148,2,184,180,116,205,50,162,
+133,67,16,59,92,212,3,230,218,8,76,133,178,211,142,54,55,175,201,20,210,24,0,253,
+210,93,74,144,128,232,164,14,28,139,8,133,50,148,185,113,55,62,111,78,111,11,11,43,
+229,156,199,189,217,222,126,11,109,115,252,91,220,20,96,183,109,55,252,58,60,166,31,119,
+95,230,218,98,49,121,73,75,131,175,244,234,9,11,48,90,17,128,9,162,251,138,137,77,
+207,103,248,176,12,20,33,254,123,186,115,161,195,149,75,79,151,31,7,201,134,39,9,116,
+155,85,36,151,92,165,202,229,30,124,240,89,134,112,119,90,183,90,84,9,72,109,27,201,
+236,53,126,105,172,113,118,212,117,213,143,218,183,214,39,120,219,205,57,239,228,245,63,19,
+60,7,159,186,221,133,149,182,122,36,10,149,230,6,96,93,0,108,156,230,99,3,49,134,
+5,204,18,212,35,14,232,8,136,36,160,66,31,73,55,198,155,32,51,85,8,100,35,22,
+123,245,242,151,26,201,111,69,231,63,202,187,18,104,210,88,67,10,122,246,220,55,200,75,
+154,192,251,49,190,91,70,142,211,185,236,85,129,177,23,125,94,218,187,161,121,74,38,72,
+134,173,110,18,173,231,31,211,16,232,51,141,189,60,109,146,96,203,85,141,104,21,195,67,
+46,150,213,43,191,63,170,73,121,124,189,212,77,209,50,255,98,174,103,41,176,121,213,189,
+81,18,212,13,233,101,94,157,183,243,43,54,28,155,87,2,234,57,124,141,237,244,193,81,
+253,188,185,208,226,205,189,116,74,61,127,16,20,178,99,167,195,113,182,151,79,59,0,69,
+83,249,32,16,119,201,153,126,38,11,213,225,233,245,119,175,133,121,202,211,247,32,189,219,
+24,111,161,63,221,167,95,132,216,219,106,111,252,20,166,126,21,30,27,235,22,17,63,171,
+228,145,36,19,77,162,230,224,198,152,66,25,32,161,88,60,133,241,65,12,38,134,165,213,
+205,22,52,138,107,130,76,241,231,151,81,80,237,10,53,112,121,154,64,48,192,207,60,253,
+121,139,109,103,130,49,133,229,11,230,139,175,121,181,221,253,81,121,76,243,44,181,173,147,
+119,197,199,202,138,71,41,90,158,39,17,201,190,229,222,117,19,47,18,165,121,67,244,19,
+116,196,161,89,14,179,111,57,196,207,112,77,243,72,122,4,164,50,68,225,14,6,14,220,
+48,160,8,31,84,20,50,50,224,85,79,204,30,121,134,22,1,224,178,223,10,219,206,249,
+45,234,125,140,57,244,63,15,233,225,84,67,231,176,132,4,15,86,128,10,116,51,109,213,
+219,71,48,220,73,39,83,170,245,126,129,163,229,248,190,140,8,116,243,182,225,153,214,92,
+198,55,55,157,210,123,132,221,177,100,97,20,65,10,76,168,138,37,161,51,75,41,68,220,
+200,48,217,157,228,110,70,206,157,40,205,146,222,10,133,5,230,177,211,206,34,134,245,36,
+114,45,121,21,83,93,179,205,237,232,178,19,26,119,7,220,94,174,119,164,10,229,31,92,
+137,152,31,19,105,195,199,16,240,206,82,40,194,215,126,79,27,81,26,45,72,237,123,213,
+230,93,62,96,126,24,245,177,39,82,198,193,197,120,195,247,250,70,238,105,206,172,51,64,
+233,37,115,125,35,0,226,228,0,113,131,216,145,180,143,24,68,165,134,173,58,22,208,73,
+45,133,60,4,11,10,1,212,160,4,79,29,114,101,34,91,252,214,64,44,163,198,212,72,
+71,33,28,117,159,85,76,127,235,59,93,55,231,233,73,82,208,63,155,127,107,235,33,103,
+247,59,127,175,169,169,220,216,210,98,120,163,253,92,76,156,101,88,192,238,63,249,116,174,
+195,67,119,40,145,235,69,107,237,29,162,118,117,115,212,98,47,51,10,19,22,157,8,169,
+44,186,246,77,91,199,213,143,139,70,66,33,152,98,247,187,179,40,83,169,101,157,51,200,
+54,162,37,4,204,58,116,237,213,116,198,83,178,39,177,54,154,84,13,57,127,72,219,66,
+176,188,93,184,161,169,165,6,249,65,16,20,23,97,225,113,221,149,75,211,166,46,150,230,
+213,116,33,225,220,90,174,167,81,20,74,175,120,78,240,31,60,52,58,218,106,175,161,125,
+210,101,151,206,91,168,159,129,238,126,133,63,167,111,78,232,76,217,60,154,61,158,93,205,
+203,245,71,78,72,69,72,248,101,240,229,176,145,244,172,147,23,156,164,72,7,200,51,136,
+236,110,99,144,170,200,195,247,183,110,81,167,21,20,168,202,174,172,18,203,79,11,210,76,
+74,63,153,168,200,213,79,195,230,82,227,204,105,129,207,222,231,180,165,86,148,38,220,143,
+110,2,121,232,111,6,11,224,169,62,113,78,44,222,63,39,24,113,127,226,88,96,86,23,
+213,61,77,176,0,85,231,232,105,20,152,204,175,63,26,138,14,176,58,67,2,187,127,108,
+160,61,188,194,42,222,16,99,28,205,152,134,181,149,96,71,104,136,23,179,41,12,49,228,
+78,118,57,6,196,35,38,28,169,227,154,16,45,6,121,131,34,235,132,4,32,164,57,147,
+228,11,42,97,231,117,56,236,194,106,60,83,181,130,195,107,96,187,132,204,64,155,44,241,
+173,91,230,213,119,185,94,18,92,243,170,56,112,89,74,138,211,85,153,180,172,234,30,109,
+177,218,36,189,44,151,98,22,126,97,135,150,77,163,85,57,67,145,22,250,46,148,27,224,
+184,225,175,52,47,217,28,152,151,21,96,136,98,146,21,68,196,115,87,214,23,136,93,205,
+197,104,160,64,188,102,58,131,254,37,158,42,179,156,234,187,169,172,64,230,165,100,225,115,
+222,78,35,254,48,83,112,123,228,69,125,10,118,99,192,160,254,245,190,159,163,141,120,29,
+132,52,133,250,160,179,126,133,244,6,193,245,241,44,184,77,22,216,218,118,31,35,45,140,
+221,83,225,16,247,93,105,182,209,50,20,43,194,74,216,9,109,13,190,46,90,166,68,225,
+192,154,53,128,79,128,186,114,154,203,64,1,60,202,196,102,134,226,195,129,82,24,13,226,
+227,98,101,50,95,39,190,150,45,173,84,45,45,245,112,79,81,158,130,188,44,222,167,160,
+180,239,219,165,230,154,105,175,34,130,205,180,205,110,231,224,168,93,9,47,124,218,180,111,
+5,79,234,144,29,113,88,254,113,49,229,128,186,91,136,79,7,191,222,29,226,133,39,39,
+178,51,224,127,116,66,139,123,4,206,102,163,246,213,80,90,181,22,176,39,228,92,149,242,
+114,253,24,93,85,82,251,123,228,86,179,172,55,248,49,103,5,74,170,173,34,205,78,134,
+246,174,64,156,90,144,106,65,34,108,18,235,30,157,194,135,163,26,202,158,227,49,24,17,
+160,45,84,107,18,79,5,147,26,86,214,200,58,253,177,208,207,129,193,140,59,75,9,179,
+23,40,196,238,155,178,95,4,226,7,30,130,108,239,92,60,98,65,238,146,217,236,204,105,
+31,69,142,228,127,66,38,56,161,93,140,74,101,186,119,99,193,136,206,91,219,173,22,248,
+166,29,12,242,83,136,18,214,38,181,154,51,171,42,236,188,65,249,237,241,130,146,180,218,
+232,73,192,63,205,141,181,206,123,1,75,230,89,144,136,116,86,137,170,146,181,33,48,139,
+56,126,69,228,148,195,239,121,139,178,39,99,138,249,208,244,70,220,255,101,52,238,38,88,
+63,170,165,158,54,171,71,102,102,23,145,14,151,145,222,73,219,185,181,125,99,149,133,111,
+228,67,35,213,133,208,98,0,227,91,10,246,18,106,8,230,66,225,207,84,12,138,18,27,
+193,146,150,123,235,215,220,136,204,92,216,172,229,6,82,230,125,7,126,146,41,247,204,254,
+27,116,11,161,111,25,51,98,128,246,19,104,131,226,195,26,2,217,218,197,33,76,112,19,
+118,122,25,241,134,86,97,5,15,0,11,222,167,37,205,251,58,66,2,99,131,92,32,175,
+116,97,73,67,24,168,97,179,152,179,27,136,78,30,167,238,86,235,149,91,90,185,230,130,
+113,225,94,62,244,239,45,65,232,120,20,242,114,160,134,36,29,110,3,187,42,103,236,101,
+60,196,11,95,186,202,36,102,49,145,133,11,112,236,245,102,41,186,177,116,172,126,109,51,
+15,43,231,128,154,187,110,191,5,5,7,71,76,10,213,141,188,224,72,238,209,218,235,225,
+22,150,247,235,218,93,244,20,163,4,146,116,178,242,44,170,124,70,126,78,35,109,155,79,
+149,137,231,155,167,94,53,110,196,54,129,74,73,76,173,207,153,175,253,79,131,252,21,101,
+2,221,1,108,64,101,185,158,167,35,153,156,43,200,40,126,81,173,60,203,223,200,211,35,
+227,95,41,92,91,70,220,88,249,47,58,193,54,247,110,152,114,181,238,229,251,217,216,233,
+112,106,196,249,170,57,179,78,159,197,153,162,12,193,206,81,245,217,238,223,209,222,182,35,
+131,94,187,143,34,212,48,105,167,208,74,20,10,14,100,106,241,140,26,128,95,199,49,202,
+84,129,43,163,38,124,220,136,172,58,62,113,216,31,244,103,57,8,123,75,126,49,127,143,
+121,161,69,49,104,195,130,137,82,45,212,213,124,184,185,237,78,54,242,100,231,145,36,92,
+153,42,103,169,158,37,228,89,45,178,255,100,4,46,241,81,214,112,159,205,177,151,29,48,
+147,209,102,217,173,73,51,170,103,89,233,198,102,208,150,60,57,85,181,175,244,163,52,204,
+214,118,13,253,132,205,114,54,90,214,203,248,167,36,6,215,50,68,188,214,124,132,235,160,
+235,11,63,211,90,67,116,222,93,238,249,109,119,213,215,57,47,231,117,237,62,87,41,195,
+63,219,176,243,188,13,215,82,79,18,34,1,106,248,43,2,236,139,73,60,198,58,38,248,
+58,149,156,69,44,62,207,135,103,203,14,134,72,198,165,37,30,33,140,136,166,253,179,33,
+224,152,72,84,169,238,242,171,209,179,192,211,12,164,72,150,61,25,119,217,232,157,122,168,
+247,80,246,103,21,13,195,162,232,133,224,207,238,9,44,224,203,1,73,186,147,230,156,124,
+1,101,252,176,64,163,102,160,145,131,22,99,10,92,1,197,233,120,252,233,36,172,102,62,
+70,86,114,15,200,111,186,43,142,69,197,175,61,117,53,172,193,81,48,71,132,123,34,80,
+169,34,36,133,242,3,148,83,138,71,186,26,56,239,121,60,121,143,216,251,123,199,29,127,
+167,243,38,196,136,127,231,242,13,68,179,197,123,56,245,118,248,246,154,22,121,57,182,125,
+27,177,199,102,71,30,169,235,33,233,200,202,193,13,66,204,194,99,184,172,236,117,59,104,
+82,20,27,105,251,69,63,57,239,52,119,255,19,22,138,3,71,29,175,111,0,164,203,195,
+206,136,229,235,98,40,219,233,30,68,111,47,135,112,182,99,226,175,155,130,148,59,241,196,
+158,93,175,79,226,187,246,126,137,95,134,60,55,217,219,236,215,103,60,141,85,179,94,159,
+29,61,107,78,106,228,154,196,36,167,95,204,221,119,56,188,10,230,105,223,159,150,148,91,
+140,240,184,82,218,65,38,147,47,182,237,141,226,23,230,15,196,159,71,103,249,236,122,226,
+228,225,114,97,177,5,98,155,143,134,100,244,56,17,225,169,21,57,208,51,190,153,64,193,
+94,140,4,106,235,42,179,36,178,145,211,2,158,17,11,10,1,40,80,241,132,68,50,74,
+61,86,26,228,66,26,167,212,39,184,230,202,115,69,55,156,122,37,241,114,188,58,132,79,
+66,9,82,205,46,60,31,200,101,35,164,39,55,34,92,199,252,38,162,208,151,158,38,144,
+14,172,220,29,3,155,237,225,182,253,205,198,71,197,173,45,9,101,77,26,12,172,253,72,
+154,149,29,118,36,147,114,218,174,28,90,215,28,136,135,129,106,109,221,78,9,102,137,50,
+242,163,84,240,202,67,193,76,78,33,143,207,162,138,196,94,70,37,17,128,91,172,30,111,
+94,234,190,119,150,160,84,244,102,65,27,100,188,212,10,231,67,156,96,224,134,253,86,202,
+139,171,2,234,193,94,197,88,102,58,125,250,182,93,4,205,52,244,95,203,168,62,254,190,
+119,71,2,225,229,98,237,97,184,57,123,101,252,155,139,29,171,212,222,204,223,70,232,21,
+185,185,141,58,7,165,239,108,160,218,253,147,3,6,123,88,154,83,239,230,110,77,60,91,
+190,170,119,127,16,51,215,253,7,0,44,243,227,139,14,127,117,28,48,240,126,192,233,29,
+222,195,38,102,238,11,129,33,181,183,34,245,33,21,128,106,8,20,53,228,32,109,211,221,
+161,80,108,12,129,55,109,164,69,148,59,103,57,113,90,79,45,51,25,64,170,19,94,87,
+165,125,10,213,36,211,251,68,9,70,164,234,248,190,167,196,133,87,66,217,110,239,247,149,
+97,36,78,210,154,143,205,237,124,179,63,171,249,102,193,69,186,148,152,255,213,61,207,64,
+148,127,168,197,100,107,49,232,74,192,68,38,197,170,1,55,26,248,54,38,33,186,216,208,
+43,97,40,49,139,217,246,44,20,215,19,108,184,174,61,146,168,125,253,137,17,2,68,160,
+93,158,121,122,194,224,171,151,159,173,27,195,177,83,107,169,75,40,124,247,18,49,70,213,
+92,54,13,102,31,127,85,16,88,112,210,97,30,208,134,88,224,132,217,166,104,26,175,71,
+197,235,133,105,212,65,146,102,17,200,92,138,4,42,166,28,182,87,45,238,119,221,74,255,
+11,97,155,226,23,253,223,142,92,21,250,27,210,198,249,158,112,156,186,96,83,132,61,212,
+76,164,73,36,230,28,163,14,191,41,53,182,235,134,25,127,239,147,26,76,246,7,228,140,
+156,238,173,73,189,14,23,173,192,63,83,109,181,247,63,179,51,30,229,86,245,4,233,249,
+40,119,109,95,134,92,124,143,201,99,100,157,159,135,32,75,72,223,81,28,239,149,235,66,
+6,41,160,67,50,160,192,254,204,223,86,220,179,187,173,180,185,53,68,13,187,18,100,60,
+64,115,218,247,212,48,108,137,43,166,180,210,198,192,105,37,91,40,241,29,173,30,22,22,
+229,32,22,18,165,228,148,149,13,186,134,8,85,242,150,84,74,94,83,78,153,158,100,115,
+36,113,50,174,240,50,30,227,253,41,249,61,120,171,125,159,58,106,220,122,228,205,130,233,
+231,151,228,86,8,23,32,164,97,19,168,222,48,148,248,105,249,170,14,17,216,97,190,85,
+251,111,151,25,198,156,127,133,247,103,74,4,229,148,57,86,164,88,235,42,51,202,142,145,
+213,248,85,216,84,173,237,71,218,253,214,158,252,14,102,251,30,236,191,71,133,230,93,219,
+172,150,220,0,176,0,69,107,188,238,230,179,30,76,191,67,223,229,96,123,9,15,19,190,
+56,14,237,212,161,4,113,228,60,139,227,16,117,179,145,131,116,73,230,44,242,164,9,145,
+2,56,110,116,85,21,89,238,95,191,202,225,29,92,57,173,85,41,210,107,242,206,72,162,
+215,162,87,64,79,149,93,238,106,135,1,220,195,144,36,9,189,230,4,180,9,43,4,146,
+5,6,54,62,65,63,211,122,67,241,109,47,202,243,127,88,143,16,66,102,164,142,156,178,
+149,170,19,242,110,191,237,22,203,147,158,85,98,214,73,135,102,235,198,83,148,153,226,231,
+100,59,45,230,59,52,84,245,143,46,55,3,9,255,87,97,73,75,81,82,110,206,33,29,
+146,16,208,25,29,30,234,104,99,176,251,67,159,217,241,120,98,47,119,82,242,69,212,192,
+169,61,33,137,104,197,69,36,114,110,16,122,186,7,107,81,68,160,208,62,178,87,81,189,
+141,153,82,19,114,37,85,153,112,67,13,105,177,17,65,225,159,125,101,254,163,133,94,9,
+215,119,74,165,176,94,173,51,235,200,230,183,251,165,0,249,18,206,48,117,133,216,128,14,
+94,171,58,199,75,146,175,17,209,143,153,197,36,197,133,14,183,109,28,99,57,153,92,68,
+78,11,175,207,199,187,157,200,135,64,195,138,213,229,178,170,133,16,174,159,3,39,159,82,
+17,135,29,63,207,93,183,120,101,208,185,182,242,40,185,13,246,175,218,60,141,222,74,63,
+245,246,242,142,65,207,213,189,234,176,7,224,253,121,191,87,114,25,181,126,110,251,150,194,
+19,244,53,251,253,189,139,153,200,192,140,111,163,12,135,173,2,3,106,183,21,116,13,57,
+64,129,125,196,12,123,255,1,188,62,48,103,44,121,122,179,219,202,70,1,138,212,6,71,
+199,73,18,128,182,203,23,18,204,210,32,89,172,112,173,57,81,22,27,73,49,243,153,166,
+60,19,205,63,39,220,69,213,141,64,25,52,153,135,49,105,155,148,205,32,168,133,93,100,
+196,123,214,108,222,204,25,139,215,54,148,66,241,211,29,74,52,148,180,126,45,231,182,161,
+187,236,236,242,161,17,53,91,141,216,249,232,86,50,240,187,31,145,241,251,204,204,235,139,
+91,233,219,125,20,17,19,38,65,174,30,21,59,204,114,30,48,217,155,143,179,117,219,209,
+247,149,104,249,23,141,32,141,98,68,36,20,16,97,18,40,98,230,79,238,41,17,16,37,
+237,71,99,242,114,4,126,13,149,93,4,126,112,82,92,75,26,112,40,180,43,176,214,152,
+105,166,175,154,40,123,6,239,101,45,153,88,183,112,233,249,255,227,208,234,121,251,248,60,
+131,254,43,161,111,187,119,252,62,57,179,231,61,18,26,174,203,201,149,42,78,255,236,78,
+200,154,112,151,138,252,138,229,61,112,158,217,123,232,139,227,123,213,248,117,219,144,74,254,
+109,12,96,146,95,7,47,201,211,218,212,254,12,105,42,255,211,246,250,60,211,30,4,27,
+132,81,36,32,148,132,174,130,226,150,186,50,141,47,108,149,132,17,135,217,162,136,156,165,
+13,250,172,183,77,162,157,11,136,176,158,92,164,73,20,66,72,8,12,165,41,16,128,187,
+205,51,132,12,1,219,69,126,17,189,99,161,46,113,182,47,146,177,97,180,113,242,44,211,
+53,229,239,12,85,38,39,198,25,96,68,251,223,118,103,43,150,101,24,64,67,128,68,86,
+171,81,141,70,198,169,212,115,248,187,69,129,199,230,199,59,43,185,228,98,23,171,222,250,
+242,123,229,110,59,199,212,174,138,254,160,28,155,43,246,67,121,159,221,32,83,20,15,249,
+102,29,213,114,79,151,129,203,251,7,240,31,10,226,99,146,93,74,184,207,50,93,173,56,
+97,244,218,173,253,71,2,189,160,189,8,141,56,81,109,107,193,108,86,101,62,254,0,158,
+241,119,44,137,140,208,19,76,132,8,194,84,88,161,7,48,49,133,247,101,60,199,126,40,
+217,24,116,46,39,152,29,110,115,107,100,89,73,167,169,203,252,200,179,252,3,84,160,226,
+129,9,81,119,12,196,166,133,7,47,64,157,159,128,230,36,170,1,44,10,68,29,241,20,
+161,9,208,172,90,196,119,93,63,102,202,57,253,131,128,197,49,166,167,2,67,187,35,187,
+148,180,203,213,153,36,57,5,24,196,222,188,246,128,231,210,66,224,246,144,220,67,171,106,
+195,231,31,229,177,145,106,140,209,100,110,145,224,49,13,130,44,28,38,15,35,100,175,4,
+155,246,168,34,122,239,230,81,130,113,12,177,134,101,34,187,205,221,133,189,110,191,245,107,
+126,195,125,14,54,250,232,167,143,176,232,71,8,49,149,144,99,240,242,86,216,193,207,48,
+31,3,76,160,245,10,3,121,241,130,210,34,120,98,164,48,98,152,78,185,164,28,140,3,
+94,164,209,21,32,103,19,53,58,184,90,51,7,6,185,148,164,190,150,129,182,206,135,110,
+177,51,61,137,119,8,162,177,55,249,41,173,34,231,199,144,198,109,57,175,104,196,90,110,
+149,22,45,228,74,194,132,16,131,138,46,41,72,197,38,99,36,46,234,218,34,114,166,16,
+248,166,135,65,2,129,19,185,105,101,193,75,84,182,238,52,243,56,25,37,89,160,168,214,
+201,193,117,94,44,138,32,14,88,7,110,113,8,18,88,4,90,174,130,189,113,78,146,167,
+70,246,84,165,91,94,90,121,183,131,62,135,56,107,138,238,204,39,127,233,240,84,234,237,
+47,29,198,13,158,176,59,78,217,191,177,99,216,167,77,216,68,1,11,52,10,199,55,78,
+133,213,26,150,107,209,232,211,160,21,246,149,111,205,37,250,66,22,173,5,174,198,201,244,
+248,149,92,196,212,145,84,218,168,82,16,236,57,12,189,81,68,90,133,105,16,246,159,51,
+233,92,6,19,85,160,137,132,167,72,28,245,50,74,21,145,2,100,169,12,145,185,138,53,
+30,39,178,1,58,190,69,170,54,0,3,240,218,13,76,45,225,117,188,122,222,39,177,99,
+136,163,160,168,168,115,186,122,107,155,139,17,184,117,199,3,155,141,244,55,24,65,208,41,
+149,253,140,141,101,245,14,231,174,235,22,57,119,210,198,123,202,147,53,158,165,26,26,220,
+162,59,26,60,234,167,162,97,235,97,134,10,84,29,96,167,96,74,73,36,180,220,2,7,
+56,85,159,82,178,144,114,4,166,74,163,193,189,84,93,183,179,203,88,97,159,196,149,13,
+100,149,65,38,72,48,54,130,12,38,16,170,146,18,147,90,211,56,110,163,97,77,157,192,
+80,43,69,194,52,136,96,162,80,218,215,43,20,65,114,118,16,96,89,220,154,65,226,92,
+246,160,155,126,217,107,44,2,183,196,22,56,231,150,164,111,236,72,196,78,171,121,31,201,
+57,137,69,201,196,147,6,43,118,152,127,157,247,49,109,77,140,161,225,4,115,168,146,220,
+3,146,197,150,28,217,204,247,207,201,227,218,60,190,154,107,104,25,114,62,146,12,91,211,
+58,72,70,108,57,7,150,186,6,177,199,106,20,180,16,147,245,48,202,161,87,22,162,245,
+110,172,224,96,144,149,67,144,206,80,250,228,69,217,209,191,99,28,217,197,150,177,170,132,
+22,208,107,21,86,66,179,6,50,213,129,141,41,195,52,93,12,169,96,112,153,192,245,178,
+101,19,18,197,64,53,178,55,16,134,87,71,96,157,238,170,152,223,214,137,11,130,145,33,
+3,30,65,63,101,149,164,33,166,5,104,214,186,67,141,43,219,37,201,76,180,113,237,212,
+190,194,15,130,9,147,217,233,36,252,213,78,156,173,41,88,161,209,74,45,145,26,53,81,
+135,54,98,232,226,210,79,87,118,207,129,21,157,186,220,111,195,238,208,103,217,246,123,206,
+165,244,24,79,171,248,122,235,86,186,11,67,30,6,165,75,59,31,169,176,74,162,176,99,
+198,34,133,113,97,90,39,6,125,93,128,143,25,108,106,168,253,112,166,95,191,247,20,239,
+167,213,12,202,78,37,240,187,123,60,125,88,180,187,248,223,153,53,238,113,217,198,218,226,
+133,198,208,153,85,229,27,49,73,195,35,47,71,115,27,14,105,230,123,58,167,46,254,33,
+36,24,195,40,180,70,234,105,85,37,243,208,65,105,175,14,51,75,22,184,247,130,228,202,
+47,66,4,146,100,171,6,86,72,101,120,157,220,28,218,36,32,201,153,200,173,57,174,244,
+101,245,40,189,68,132,134,92,76,95,64,252,89,74,79,172,188,8,49,110,11,53,2,90,
+121,24,9,122,17,85,38,180,98,73,129,245,222,183,99,225,241,47,85,147,49,127,141,153,
+15,169,173,222,47,243,115,239,209,70,196,156,217,254,174,77,95,181,158,44,41,17,112,92,
+137,137,82,81,119,101,221,15,248,163,252,180,124,106,179,225,58,73,243,223,173,66,17,37,
+187,237,250,243,247,88,17,39,157,77,108,243,135,150,59,118,116,107,26,67,107,211,98,253,
+245,102,188,137,88,21,94,38,8,56,190,222,38,72,160,245,106,170,247,169,37,157,42,30,
+7,36,178,99,81,69,27,11,212,89,168,33,229,141,110,249,25,4,68,48,128,247,112,136,
+178,28,98,22,26,35,241,52,68,90,11,89,1,244,158,241,94,30,37,251,84,1,199,159,
+115,251,99,119,150,216,3,146,251,213,210,199,21,240,169,163,195,119,241,41,190,110,251,118,
+61,50,251,254,249,187,181,56,186,50,175,121,65,170,126,132,102,201,186,54,171,223,123,167,
+188,165,165,71,6,184,20,163,94,181,16,46,101,78,193,237,13,133,229,252,2,201,135,94,
+33,192,185,187,221,149,246,71,93,10,122,191,25,38,154,209,78,38,153,98,86,125,38,149,
+72,67,56,96,85,7,76,59,110,117,183,140,124,111,69,80,88,83,248,220,255,172,164,4,
+16,71,186,152,114,61,120,65,193,85,157,205,219,185,100,103,48,88,123,3,22,123,57,71,
+236,229,66,118,160,59,125,75,156,238,4,186,242,206,193,83,199,127,106,218,121,44,58,216,
+79,36,165,78,216,111,55,166,44,246,221,248,207,85,105,14,14,172,163,148,84,202,104,45,
+161,75,196,22,223,91,169,118,73,171,107,62,116,80,121,141,231,27,229,203,77,211,252,145,
+186,223,210,174,227,22,11,103,64,176,176,158,27,0,3,15,21,95,71,209,196,81,223,100,
+225,176,119,159,103,137,202,119,5,63,58,169,137,107,219,155,17,104,156,69,128,108,4,169,
+97,167,57,35,239,225,49,223,45,209,128,14,177,99,59,117,231,44,246,73,137,171,5,38,
+9,238,151,176,28,195,179,72,188,103,125,223,69,240,197,47,249,59,147,35,88,198,242,50,
+116,113,18,183,236,172,54,28,67,175,186,39,83,65,81,57,108,139,32,129,3,24,153,128,
+24,173,213,148,211,58,14,3,73,33,211,51,10,92,18,28,152,234,57,36,139,154,138,68,
+52,213,138,42,253,19,129,232,117,255,237,26,49,6,59,194,181,252,52,147,37,168,80,87,
+130,67,246,103,170,91,5,30,226,220,49,153,86,44,103,33,25,44,34,197,4,128,43,116,
+142,239,43,51,116,149,189,39,37,38,172,222,125,1,183,234,200,112,91,44,88,250,32,4,
+154,252,25,124,104,174,84,3,53,202,159,82,3,193,85,42,142,218,67,201,96,218,182,65,
+202,13,223,61,124,111,233,125,117,116,57,66,45,220,235,139,104,225,158,188,171,17,136,15,
+195,213,164,174,22,32,124,192,151,227,96,122,52,245,35,165,28,208,51,6,20,159,68,178,
+89,100,114,163,157,12,49,191,89,102,57,61,162,35,207,71,130,157,98,13,120,68,6,90,
+106,186,61,233,40,0,208,12,64,120,165,24,188,72,160,82,130,79,104,159,248,252,31,167,
+202,41,137,150,210,33,199,165,243,115,160,117,244,60,27,255,191,193,250,54,122,148,51,252,
+142,45,141,14,2,14,157,219,129,113,189,76,223,156,234,140,172,99,108,56,110,231,74,77,
+203,183,198,60,21,184,29,132,136,174,196,229,6,250,79,150,56,232,243,151,217,18,98,200,
+157,173,97,183,171,85,163,3,39,27,249,75,102,17,80,92,85,195,196,8,29,166,62,62,
+225,174,177,154,97,77,150,58,152,199,126,30,116,188,195,169,5,249,243,54,188,75,21,89,
+190,7,4,177,119,20,70,150,207,199,4,193,51,142,225,75,49,147,240,191,105,205,188,109,
+129,76,213,206,234,85,141,99,238,120,207,83,129,174,62,162,5,120,75,182,168,153,96,255,
+219,177,103,189,187,248,250,73,203,67,135,188,173,25,41,146,246,83,123,187,19,109,121,181,
+173,40,143,221,51,209,143,26,213,84,232,75,98,177,40,12,98,7,44,118,39,23,47,148,
+211,200,28,250,117,139,33,163,37,40,246,69,8,38,26,37,72,16,141,222,178,83,5,140,
+203,151,86,177,84,147,241,140,176,115,52,95,66,162,172,193,174,195,98,32,160,249,104,81,
+73,99,35,34,140,249,244,184,139,62,83,191,4,29,219,124,70,101,229,76,134,188,66,160,
+93,41,18,246,147,210,206,1,85,101,10,167,53,196,197,145,190,150,183,252,185,148,174,179,
+32,83,49,217,173,166,107,43,248,245,100,81,233,37,144,113,76,63,193,103,205,169,65,130,
+159,191,62,81,69,126,152,48,6,135,60,66,224,188,165,104,247,202,184,124,78,233,86,13,
+93,120,142,181,117,48,131,105,123,187,217,21,141,111,206,125,137,75,34,88,46,138,51,124,
+206,70,62,45,198,45,125,137,130,252,255,148,116,139,162,124,3,40,82,164,80,193,161,157,
+16,235,115,142,81,10,210,76,112,108,233,134,101,26,223,51,98,110,94,218,200,135,57,45,
+205,214,242,35,149,31,237,130,166,121,189,163,76,10,87,224,244,181,250,5,69,86,39,74,
+92,149,32,213,214,81,4,76,11,242,75,222,211,99,232,190,104,166,180,67,75,5,250,0,
+58,62,51,199,220,44,229,81,53,0,80,62,59,164,96,32,140,227,242,73,197,75,129,97,
+181,85,214,196,184,203,40,99,67,95,194,96,236,37,71,202,182,153,170,20,212,188,68,219,
+37,240,228,162,139,118,134,90,202,174,77,169,208,49,167,35,24,184,200,250,124,58,117,227,
+93,156,111,6,91,87,51,12,220,52,166,109,145,63,33,221,61,211,180,90,200,247,190,7,
+91,243,248,239,127,4,47,207,153,8,12,160,196,114,253,157,217,49,108,90,22,147,81,242,
+224,162,114,79,10,56,126,108,171,208,34,20,130,20,9,187,46,103,209,199,196,118,110,168,
+36,219,133,210,67,222,215,177,156,102,232,44,115,20,100,108,105,8,103,88,114,44,18,164,
+11,43,139,51,95,74,16,94,0,97,67,157,75,189,39,251,122,102,42,220,239,254,158,247,
+86,155,38,38,14,249,18,244,110,68,127,170,200,64,221,171,160,201,129,171,134,12,4,246,
+69,248,151,240,109,111,188,152,91,217,195,81,187,134,245,50,253,164,90,61,166,87,56,137,
+228,15,156,125,136,99,184,25,209,160,142,21,15,70,22,206,0,145,124,49,246,227,158,128,
+157,0,34,2,190,149,115,0,196,135,80,147,80,219,219,39,222,185,36,236,191,55,142,43,
+212,239,121,237,175,189,79,240,59,160,221,21,82,239,113,126,131,119,119,90,183,238,166,0,
+42,158,43,83,28,188,209,150,210,162,127,205,68,251,176,64,70,2,233,124,141,26,247,116,
+232,100,3,32,162,172,94,22,205,176,76,15,52,210,183,47,132,86,7,194,157,227,117,48,
+240,8,218,194,135,77,148,253,133,111,177,12,79,12,194,138,90,93,227,18,169,178,121,72,
+140,75,30,33,233,154,131,49,139,44,144,18,35,112,175,247,232,16,137,111,190,52,135,140,
+243,136,37,80,210,237,230,68,140,104,13,160,70,70,244,184,48,118,239,246,233,245,98,198,
+238,136,169,158,174,253,137,79,67,126,165,12,160,200,83,175,252,46,39,72,23,181,125,15,
+51,96,78,183,12,187,149,106,249,54,17,170,92,25,68,14,85,174,51,215,94,228,174,224,
+190,236,214,48,235,32,150,222,116,223,220,182,201,176,251,75,250,50,94,79,2,30,149,252,
+117,171,152,177,157,28,21,8,199,173,38,57,70,27,104,72,47,166,178,122,240,82,38,89,
+12,111,131,84,183,5,1,238,110,150,241,219,172,138,92,50,94,143,88,35,225,106,218,174,
+232,52,216,120,115,221,165,155,88,222,203,83,150,118,59,198,1,3,207,12,114,13,87,30,
+192,82,67,51,61,45,198,187,237,197,252,208,219,208,137,216,70,23,38,81,215,187,80,232,
+119,6,103,25,99,38,165,178,93,251,48,60,250,250,218,83,175,7,51,43,14,108,108,93,
+52,137,79,254,100,234,200,244,104,31,48,186,84,24,142,204,38,123,123,118,18,106,130,200,
+108,160,147,242,170,74,32,119,194,38,186,195,81,203,81,220,52,210,109,155,1,176,166,178,
+144,252,233,5,194,223,254,102,124,4,43,134,54,192,184,176,245,121,31,189,145,166,101,65,
+242,168,85,116,91,134,178,220,215,168,229,14,225,124,168,10,125,66,136,90,145,171,139,141,
+66,48,79,78,44,180,240,6,69,43,180,198,100,135,49,212,247,17,68,201,126,60,57,35,
+158,136,69,4,44,238,193,210,143,49,141,206,159,140,220,7,205,70,36,77,146,82,218,209,
+72,74,145,11,174,11,10,96,82,202,128,163,248,71,40,154,203,41,67,181,202,178,227,120,
+43,100,118,222,254,197,76,130,127,93,224,52,230,161,142,186,95,140,119,170,67,58,214,41,
+12,68,44,80,166,138,115,22,13,86,100,39,164,36,100,130,90,120,172,225,79,168,202,200,
+181,74,129,193,60,243,200,10,203,169,221,214,18,19,142,151,179,57,224,180,40,210,142,195,
+176,12,185,213,85,21,114,215,153,198,165,108,91,51,126,142,150,49,113,134,78,197,183,233,
+245,91,169,252,172,111,180,71,182,111,247,255,189,242,49,185,175,125,163,3,4,193,131,121,
+81,80,156,165,19,227,249,12,73,16,218,145,164,100,17,12,5,100,239,168,190,50,186,229,
+144,4,134,24,134,46,69,57,185,196,49,245,243,26,17,220,46,86,150,1,246,157,172,242,
+189,104,74,4,167,214,113,114,232,85,135,11,125,180,174,103,132,225,152,255,90,181,73,167,
+42,120,19,36,137,167,66,50,22,177,13,144,106,229,93,70,244,196,223,52,181,172,107,18,
+26,127,167,233,200,215,238,125,79,22,230,15,237,119,122,52,155,139,191,63,95,167,181,42,
+77,74,176,147,253,53,4,84,157,118,191,207,127,203,132,34,63,156,91,167,189,210,181,228,
+203,151,5,153,19,251,105,180,39,61,64,228,79,167,234,111,232,54,149,14,224,240,55,237,
+41,168,235,9,88,88,98,61,228,153,62,107,48,248,51,60,195,59,38,209,42,147,181,177,
+112,181,152,50,204,101,196,249,240,205,53,95,202,124,5,78,48,234,135,111,120,53,63,173,
+125,31,135,220,104,175,31,19,129,251,255,227,39,185,251,21,41,205,21,9,227,160,56,125,
+147,221,169,103,158,96,44,48,155,140,4,196,218,123,48,151,136,72,224,230,77,8,164,158,
+152,182,50,11,13,147,166,115,6,84,197,192,142,132,172,154,71,36,242,45,43,16,198,172,
+170,14,10,43,78,238,18,204,159,95,240,102,63,236,28,183,125,82,126,71,223,223,7,115,
+111,161,210,209,70,254,23,110,39,185,26,141,80,38,105,164,173,24,154,40,109,141,48,150,
+175,8,239,155,42,117,169,176,30,1,158,105,80,231,23,52,106,158,129,237,182,240,203,100,
+133,242,234,204,244,255,85,211,100,240,3,179,77,141,240,29,203,85,81,204,252,232,205,10,
+249,229,116,12,79,205,35,231,203,171,117,46,79,3,36,208,183,142,104,26,29,193,170,189,
+47,173,55,209,211,74,123,141,55,250,104,252,90,239,106,33,13,138,109,157,54,53,140,236,
+23,170,221,199,212,94,42,2,119,54,149,203,177,1,66,10,247,229,203,118,221,133,185,24,
+57,193,216,19,194,129,46,98,57,74,205,6,79,117,228,39,240,247,7,94,201,255,183,28,
+218,9,156,230,92,209,172,94,222,200,72,102,83,78,184,239,56,170,121,106,151,80,157,119,
+127,29,136,215,143,239,35,199,114,37,146,7,161,88,248,8,212,45,38,121,139,208,90,19,
+74,0,178,95,26,148,234,195,247,143,12,7,0,92,167,94,242,22,35,219,82,162,131,238,
+89,40,51,202,17,95,90,184,247,129,202,20,137,21,17,81,144,146,84,114,85,10,42,215,
+106,49,241,227,164,90,34,205,64,223,21,72,35,99,47,190,188,160,134,220,206,159,209,62,
+2,59,57,248,90,223,27,56,246,219,90,132,228,23,147,41,82,96,113,92,50,110,108,116,
+70,136,93,34,120,167,182,66,97,216,126,212,162,156,160,32,22,185,18,216,134,81,115,209,
+146,67,18,181,146,207,94,15,75,48,113,241,110,206,151,182,13,104,188,16,65,102,34,18,
+82,54,219,19,96,32,150,162,98,242,104,109,197,41,147,209,59,59,172,121,114,180,218,186,
+182,219,47,226,66,83,13,5,206,125,138,175,111,49,180,229,108,106,186,135,129,68,136,154,
+146,185,155,247,140,105,110,75,133,12,66,134,131,31,96,213,20,188,106,244,37,16,10,85,
+130,210,174,37,29,99,62,162,38,112,24,164,34,137,9,129,76,20,20,72,77,46,184,33,
+136,172,108,224,136,172,53,243,104,201,181,17,149,1,224,134,16,16,41,122,104,16,11,166,
+38,42,228,253,177,72,158,3,135,216,74,11,112,132,252,13,153,7,223,133,158,188,216,214,
+61,206,28,43,113,158,196,234,193,220,177,145,38,124,252,133,169,0,128,104,12,186,93,134,
+93,25,215,104,152,13,169,229,41,46,226,164,185,124,42,107,189,66,58,7,243,229,154,7,
+176,158,25,20,75,171,62,116,45,43,66,145,90,190,69,107,59,108,41,80,79,14,252,191,
+132,139,253,228,165,236,232,107,86,13,238,195,89,167,68,90,46,1,68,191,36,183,202,53,
+147,85,75,79,236,123,14,66,92,81,4,40,138,20,14,204,181,141,107,33,83,100,45,165,
+229,21,79,33,2,82,103,22,37,84,54,216,226,38,220,135,111,25,148,66,128,82,66,57,
+82,54,75,45,211,136,185,226,182,0,105,104,57,14,243,69,150,98,60,51,135,61,45,233,
+121,112,20,41,86,183,184,97,92,18,27,206,44,134,104,33,244,138,201,78,254,114,170,216,
+215,74,47,119,201,216,91,122,115,110,204,230,159,188,36,136,244,32,167,104,35,181,47,162,
+100,178,2,25,83,219,50,244,111,215,216,39,235,77,33,217,148,159,188,227,241,83,228,88,
+160,66,166,240,59,65,194,140,123,140,69,40,36,59,252,55,29,68,108,29,238,245,26,217,
+100,156,151,14,115,134,73,192,145,76,72,156,162,53,16,40,137,243,211,131,41,148,29,58,
+41,2,83,167,41,16,106,135,23,42,121,64,32,135,116,234,198,42,69,239,136,49,237,234,
+83,93,252,152,190,113,12,218,206,129,5,62,250,151,13,173,103,113,114,85,176,45,239,122,
+121,19,174,77,93,184,219,254,155,82,75,179,141,213,159,5,199,254,103,163,115,99,224,126,
+29,117,150,127,206,125,144,190,139,79,107,151,93,167,229,12,146,151,25,38,47,124,236,83,
+38,179,53,162,10,183,116,51,113,94,76,76,161,212,28,52,172,26,162,208,47,57,88,125,
+9,170,53,9,93,34,131,8,41,8,2,200,65,32,18,65,4,178,224,240,225,204,168,121,
+198,123,184,5,225,10,179,115,44,138,9,106,40,116,81,30,115,10,114,40,49,147,34,3,
+23,124,140,123,173,215,116,166,173,31,209,60,105,174,160,208,248,35,219,249,80,91,41,14,
+189,194,101,78,149,121,23,235,25,8,40,134,98,183,210,140,134,56,242,205,229,162,107,2,
+205,51,120,92,199,84,158,81,178,52,86,28,121,139,112,145,103,112,36,98,21,99,47,92,
+153,19,105,191,4,154,145,36,23,29,49,39,100,152,167,107,181,66,125,150,224,177,225,130,
+8,230,62,25,169,26,212,150,74,115,245,47,88,244,202,54,45,148,201,7,131,57,77,76,
+181,176,154,73,175,185,117,46,44,35,7,3,108,56,16,93,15,124,170,130,10,65,89,72,
+82,1,8,37,16,202,45,3,91,48,186,53,85,22,3,0,86,82,164,176,117,22,203,122,
+205,88,184,253,236,157,24,65,4,7,71,204,146,67,166,217,32,68,174,88,22,137,252,84,
+82,132,3,4,70,46,120,25,9,182,101,71,4,244,182,75,55,36,94,107,83,15,5,115,
+198,170,100,55,5,74,171,177,233,151,25,26,184,137,178,98,40,243,80,214,215,246,92,96,
+30,49,95,253,94,95,1,197,244,250,165,63,241,59,241,252,78,130,242,72,36,119,34,143,
+140,205,10,31,185,24,133,239,240,22,24,124,235,164,57,241,206,116,147,112,82,244,4,120,
+41,23,72,218,140,147,171,57,232,70,54,37,239,197,207,120,64,42,184,225,10,185,72,222,
+150,180,67,169,250,155,44,236,59,3,209,29,98,209,17,10,149,109,144,42,104,95,79,51,
+173,114,151,187,97,229,234,47,97,48,20,87,73,134,46,150,107,120,133,73,128,89,44,184,
+40,104,10,1,47,20,252,83,64,36,32,115,81,178,45,51,91,104,90,44,3,97,225,58,
+155,10,157,53,249,234,84,110,208,147,140,99,59,171,212,101,173,175,67,91,50,188,42,205,
+91,181,68,106,206,43,205,228,70,142,215,67,213,119,225,199,138,151,13,201,10,0,12,248,
+212,6,4,235,18,239,113,145,116,73,183,147,147,69,38,101,136,196,194,248,99,28,179,80,
+42,194,39,198,199,156,125,21,18,131,96,102,114,218,221,36,123,166,145,188,155,211,0,207,
+247,170,84,200,142,78,154,86,130,78,52,119,130,238,18,110,11,85,184,171,213,78,145,75,
+156,33,20,130,8,167,97,74,138,142,249,67,23,17,160,78,54,81,213,131,41,80,145,130,
+30,202,80,70,175,97,32,83,119,197,76,224,151,60,188,51,113,62,236,8,188,153,163,2,
+121,188,221,35,187,173,95,154,173,251,234,157,154,254,247,252,57,23,58,23,183,24,104,76,
+41,190,11,206,212,77,165,144,31,194,105,114,62,142,5,220,50,211,210,48,155,138,54,237,
+68,223,135,142,114,65,69,66,40,85,19,251,196,74,169,132,13,29,21,164,239,165,47,208,
+138,47,88,103,226,203,171,159,28,186,239,67,38,153,53,147,164,173,111,85,17,49,202,203,
+101,245,15,52,201,165,68,188,60,144,223,18,69,165,81,151,84,170,204,232,185,52,211,176,
+232,171,81,92,16,172,137,221,25,70,146,148,77,142,39,66,50,255,102,18,53,117,165,160,
+93,63,239,32,120,56,99,24,29,160,178,7,83,229,192,98,95,59,47,25,189,167,203,108,
+181,97,36,4,208,35,191,203,169,249,195,209,58,170,142,81,54,74,57,23,68,176,17,24,
+40,97,161,128,132,104,64,153,67,84,235,46,195,90,226,2,6,66,11,249,206,48,116,68,
+141,75,72,3,55,248,112,18,56,40,56,134,120,136,31,185,241,173,210,236,71,208,95,4,
+236,42,26,30,112,251,43,68,84,248,186,128,190,158,249,217,51,203,1,194,176,9,152,66,
+249,148,80,69,245,253,219,148,40,212,217,124,250,246,11,28,187,217,219,228,212,157,95,155,
+61,1,34,55,165,232,126,145,234,195,255,84,62,31,115,209,206,253,186,144,115,123,11,54,
+78,32,145,2,65,45,179,5,10,174,38,170,66,89,123,182,74,47,64,228,202,174,148,130,
+88,2,34,11,226,42,226,23,189,201,189,198,203,119,17,187,153,242,177,251,137,91,21,119,
+122,114,133,118,177,26,179,14,139,247,55,255,132,79,64,176,82,253,52,207,55,99,33,247,
+212,171,56,155,43,182,201,131,176,93,49,239,39,187,66,120,70,77,86,89,181,15,21,242,
+46,178,101,141,252,199,232,103,100,203,127,113,9,70,189,133,33,206,173,166,206,8,130,65,
+113,21,3,228,169,242,168,235,59,173,180,226,116,21,67,180,83,12,232,44,209,47,2,156,
+217,36,182,153,157,39,194,100,105,39,64,181,19,55,64,211,11,32,119,244,136,10,228,15,
+227,42,190,206,182,19,155,102,162,166,93,65,172,80,68,146,223,9,13,103,198,125,143,186,
+112,101,90,72,200,49,74,189,105,83,88,84,216,33,72,131,48,202,149,18,163,188,228,72,
+171,47,40,194,136,208,243,20,7,233,152,63,211,204,90,67,81,96,73,124,94,232,166,186,
+154,206,167,194,217,220,47,197,67,30,177,36,243,13,122,113,142,75,2,194,224,124,189,201,
+140,12,10,49,216,25,34,76,100,236,219,139,131,76,75,149,199,68,121,48,251,252,18,48,
+231,195,104,254,16,31,186,153,33,221,31,161,93,78,19,122,193,213,97,169,42,75,44,63,
+119,207,200,220,190,192,233,251,152,191,63,220,238,239,173,86,148,146,129,132,195,150,38,40,
+11,104,169,220,33,174,224,171,146,57,168,98,86,138,252,25,76,14,21,17,40,185,55,48,
+61,193,43,191,49,103,55,192,34,234,149,134,132,2,38,34,41,231,4,64,137,26,143,41,
+17,4,71,117,20,146,216,188,48,116,94,241,117,51,86,80,156,74,47,1,238,117,220,239,
+236,198,99,128,9,102,24,79,129,66,83,17,77,167,40,170,136,128,230,139,66,114,161,57,
+110,133,182,186,50,53,92,59,169,110,155,184,171,189,102,128,206,64,253,183,112,177,20,239,
+185,201,103,18,165,178,202,19,226,173,175,120,79,98,252,57,66,30,130,131,111,26,230,229,
+59,79,41,26,251,2,74,169,235,10,246,217,54,59,159,133,116,91,133,43,206,204,238,60,
+147,204,117,249,219,215,150,157,156,186,209,206,9,174,156,253,1,176,103,166,6,152,55,106,
+118,80,128,242,236,222,119,24,178,26,41,38,172,135,203,148,170,132,69,20,122,49,43,102,
+117,13,102,227,222,156,126,108,184,209,92,118,23,154,92,137,153,2,11,99,65,90,81,47,
+84,68,251,196,16,30,30,232,128,48,57,195,101,11,56,128,168,104,84,160,166,111,50,233,
+33,133,18,154,179,128,237,19,171,75,100,72,8,238,217,187,250,183,212,228,36,135,115,18,
+170,118,77,35,142,81,77,155,249,240,169,163,152,162,187,197,253,47,109,162,24,48,181,152,
+18,192,17,36,42,205,63,113,59,72,245,95,195,122,221,44,169,156,98,197,119,14,230,83,
+39,50,117,109,111,79,127,250,11,8,214,177,254,129,65,63,104,71,214,208,61,134,240,204,
+18,139,38,249,106,81,147,63,127,30,8,188,97,4,168,148,46,132,93,52,205,38,59,137,
+205,237,69,250,236,212,8,117,224,105,17,112,12,200,233,48,51,175,164,143,193,9,49,198,
+154,45,119,222,98,244,150,57,104,21,203,224,173,56,237,136,62,245,74,52,57,33,102,233,
+151,54,212,18,206,149,88,21,6,79,47,141,94,60,22,229,102,111,22,197,57,236,175,114,
+128,65,227,248,112,169,30,56,69,4,64,102,64,164,255,172,108,49,74,62,33,121,215,97,
+242,124,103,80,54,4,34,34,5,68,201,107,219,172,200,225,3,198,100,125,3,59,134,192,
+204,201,48,255,125,91,38,239,91,218,160,33,236,188,10,156,129,56,251,234,237,124,55,161,
+233,177,249,115,90,239,14,44,56,137,46,133,25,144,185,242,112,24,103,209,103,251,158,209,
+165,43,40,137,147,204,136,103,216,213,96,181,150,220,225,76,188,127,12,244,133,45,181,104,
+84,102,173,209,53,202,39,56,68,71,16,66,206,122,103,72,82,164,136,149,141,164,160,192,
+82,129,32,23,129,59,219,225,142,154,201,172,33,15,108,127,250,45,55,198,42,91,128,64,
+144,198,67,26,69,128,80,139,119,92,19,232,215,52,108,101,224,247,232,104,178,130,121,190,
+4,223,17,59,247,225,58,15,170,101,134,219,251,108,82,115,134,180,5,253,172,169,177,75,
+1,84,129,4,102,198,196,45,210,84,130,49,146,94,231,35,86,207,90,245,217,181,3,134,
+149,85,151,146,164,175,23,218,203,23,141,235,211,78,232,236,22,15,155,252,213,180,219,93,
+201,222,210,48,208,143,184,240,220,50,73,80,159,182,16,250,67,198,111,69,137,126,26,188,
+248,184,84,120,52,214,122,163,56,0,252,194,146,3,163,30,27,221,219,210,113,227,92,76,
+28,29,157,71,216,135,126,223,113,21,94,66,211,226,241,240,69,82,59,255,194,78,1,33,
+187,147,198,116,56,6,135,91,66,51,237,139,177,50,236,66,76,242,218,191,71,152,180,143,
+51,37,113,196,179,204,187,137,250,164,81,88,226,86,3,196,234,237,35,55,85,13,12,40,
+47,207,255,182,230,46,202,225,57,239,109,217,74,38,18,47,154,71,161,40,6,247,13,250,
+115,8,95,99,122,67,27,178,96,131,48,151,128,247,163,194,147,48,8,138,217,108,46,21,
+63,176,105,101,138,139,93,16,136,162,26,3,128,76,205,211,139,57,9,197,30,200,139,189,
+166,126,214,155,65,170,242,2,152,142,175,152,238,105,92,41,216,244,154,142,238,155,212,100,
+162,102,75,121,189,88,37,152,105,162,167,19,5,73,65,50,135,18,0,48,108,205,126,95,
+248,252,77,26,197,234,138,37,170,221,104,184,122,164,185,187,77,251,140,4,80,211,38,196,
+251,130,23,41,0,172,75,17,206,165,2,76,7,246,206,224,64,26,123,9,200,152,147,217,
+66,168,136,19,195,203,166,30,52,156,59,234,208,200,22,55,74,132,175,206,175,157,91,204,
+72,169,171,249,232,115,108,148,140,124,157,87,172,193,201,168,133,146,191,188,163,125,58,159,
+122,232,126,146,254,207,105,22,30,26,90,30,233,81,145,4,13,233,184,113,130,72,184,232,
+23,4,156,248,71,224,150,112,168,200,130,24,97,128,77,50,250,100,17,73,200,177,68,28,
+32,171,242,250,46,101,83,151,164,245,65,41,2,69,95,161,201,15,131,178,119,224,29,82,
+237,124,132,109,52,217,3,183,155,219,180,232,211,20,34,72,212,73,170,201,70,77,188,204,
+73,194,19,47,40,14,105,82,14,193,128,107,21,122,177,73,205,233,112,222,40,151,39,119,
+203,149,78,117,138,212,208,137,28,101,236,73,20,25,74,67,23,136,45,55,22,187,68,12,
+38,50,23,72,128,179,222,6,190,18,22,23,246,52,50,122,93,29,210,76,68,200,84,220,
+41,131,0,206,217,8,126,86,87,125,174,12,215,115,94,50,152,32,210,141,188,242,116,122,
+137,230,50,186,82,241,245,126,31,207,246,252,157,155,250,110,223,200,208,30,12,223,112,217,
+35,121,56,130,211,45,162,163,56,179,201,34,197,46,140,147,19,16,153,203,140,113,75,209,
+47,30,238,235,197,156,227,45,148,133,36,196,18,196,159,52,237,240,241,238,135,97,23,87,
+242,173,170,91,105,206,210,35,53,35,52,110,185,62,121,216,146,4,2,9,18,180,170,140,
+29,105,119,242,148,253,201,202,90,152,84,90,154,67,97,4,73,4,146,65,37,130,40,177,
+4,2,9,5,189,13,94,145,126,57,96,194,68,2,197,129,32,150,32,22,1,128,252,141,
+62,195,253,191,219,77,247,249,21,7,199,35,174,92,254,231,149,199,183,28,134,117,8,48,
+218,157,211,202,32,35,148,129,172,91,191,62,238,122,185,41,166,120,189,230,175,67,169,251,
+212,89,217,212,226,255,195,214,143,0,129,208,33,131,15,205,252,239,75,12,98,179,93,243,
+75,147,35,245,72,221,224,223,63,12,208,61,215,144,159,74,183,202,66,132,116,60,30,19,
+220,45,43,79,101,186,134,115,98,8,153,180,118,174,34,132,21,154,197,195,130,187,103,1,
+216,150,34,188,41,178,1,97,100,196,16,73,98,73,45,244,189,154,96,206,64,44,88,146,
+196,146,0,32,180,16,128,110,120,4,6,97,181,247,168,127,151,160,179,142,220,251,179,177,
+177,187,78,59,26,125,71,229,156,169,1,37,205,136,244,206,219,63,106,225,131,15,123,230,
+105,60,182,159,134,238,101,162,246,17,29,19,72,123,183,99,12,75,139,26,134,189,32,152,
+18,25,136,102,33,152,55,128,123,254,150,171,142,167,190,215,211,243,123,63,157,195,215,168,
+48,97,221,117,116,180,56,57,195,49,155,149,44,193,236,122,189,243,245,141,45,72,100,144,
+221,13,109,63,2,31,248,211,15,232,237,203,125,175,197,254,78,218,154,105,109,84,135,39,
+235,255,73,192,139,200,54,212,0,7,220,72,48,243,127,254,46,228,138,112,161,32,189,132,
+134,46
 };
 
-#endif /* MATRIX_IMAGES_H */
+static rsAsset pic(pic_packed, 37442, 81900);
@@ -40,7 +40,8 @@ bool CScreensaverMatrixView::Start()
   /* Allocations for dynamic width */
   m_text_x = ceil(text_y * ((float)Width()/Height()));
 
-  /* Start at rand pic */
+  /* Start at rand pic, the images are used for every frame from here on */
+  m_pic = pic.acquire();
   m_pic_offset=(rtext_x*text_y)*(rand()%m_num_pics);
 
   /* Initializations */
@@ -78,20 +79,24 @@ bool CScreensaverMatrixView::Start()
   }
 
   /* Create texture mipmaps */
+  const unsigned char* fontData = font.acquire();
+  if (fontData)
   {
     gli::texture Texture(gli::TARGET_2D, gli::FORMAT_R8_UNORM_PACK8, gli::texture::extent_type(512, 256, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), font, Texture.size());
+    std::memcpy(Texture.data(), fontData, Texture.size());
     m_texture1 = kodi::gui::gl::Load(Texture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, m_color == MATRIX_COLOR_RED ? GL_RED : GL_ZERO);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, m_color == MATRIX_COLOR_GREEN ? GL_RED : GL_ZERO);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, m_color == MATRIX_COLOR_BLUE ? GL_RED : GL_ZERO);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_ALPHA);
   }
+  if (fontData)
   {
     gli::texture Texture(gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8, gli::texture::extent_type(512, 256, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), font, Texture.size());
+    std::memcpy(Texture.data(), fontData, Texture.size());
     m_texture2 = kodi::gui::gl::Load(Texture);
   }
+  font.release();
   {
     unsigned char flare[16]= { 0, 0, 0, 0, 0, 180, 0}; /* Node flare texture */
     gli::texture Texture(gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1, 1);
@@ -137,6 +142,9 @@ void CScreensaverMatrixView::Stop()
 
   free(m_speeds);
   free(m_glyphs);
+
+  pic.release();
+  m_pic = nullptr;
 }
 
 void CScreensaverMatrixView::Render()
@@ -258,9 +266,9 @@ void CScreensaverMatrixView::draw_text1()
          int depth = 0;
 
          /* If the coordinate is in the range of the 3D picture, set depth */
-         if (x >= -rtext_x/2 && x<rtext_x/2)
+         if (m_pic && x >= -rtext_x/2 && x<rtext_x/2)
          {
-            depth = glm::clamp(pic[b+m_pic_offset]+(m_pic_fade-255), 0, 255);
+            depth = glm::clamp(m_pic[b+m_pic_offset]+(m_pic_fade-255), 0, 255);
             b++;
 
             /* Make far-back pixels darker */
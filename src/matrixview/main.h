@@ -60,6 +60,7 @@ private:
   void make_change();
 
   int m_pic_offset;      /* Which image to show */
+  const unsigned char* m_pic = nullptr; /* Decompressed image data */
 
   struct glyph {
     unsigned char num;   /* Character number (0-59) */
@@ -43,6 +43,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 #include <rsMath/rsMath.h>
@@ -70,6 +71,7 @@ bool CScreensaverMicrocosm::Start()
   glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
   glGenBuffers(1, &m_indexVBO);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexVBO);
+  chooseVertexFormat();
 
   srand((unsigned)time(nullptr));
 
@@ -189,6 +191,12 @@ bool CScreensaverMicrocosm::Start()
   m_volSurface1[1] = new impSurface;
   m_volSurface2[0] = new impSurface;
   m_volSurface2[1] = new impSurface;
+  for (int i = 0; i < 2; ++i)
+  {
+    m_volSurface0[i]->setVertexFormat(m_vertexFormat);
+    m_volSurface1[i]->setVertexFormat(m_vertexFormat);
+    m_volSurface2[i]->setVertexFormat(m_vertexFormat);
+  }
   // Pointers to surfaces that can be used for drawing
   m_drawSurface0 = m_volSurface0[0];
   m_drawSurface1 = m_volSurface1[0];
@@ -199,7 +207,13 @@ bool CScreensaverMicrocosm::Start()
   m_volume0->init(m_settings.dResolution, m_settings.dResolution, m_settings.dResolution, 1.0f / float(m_settings.dResolution));
   m_volume0->useFastNormals(false);
   m_volume0->setCrawlFromSides(true);
+  // Crawled surfaces only touch a small part of the volume
+  m_volume0->useSparseStorage(true);
   m_volume0->setSurface(m_volSurface0[0]);
+  // Shapes moving less than half a cube are not recomputed, and contributions
+  // below 5% of the surface value are left out of their bounds.
+  m_volume0->setShapeTolerance(0.5f / float(m_settings.dResolution));
+  m_volume0->setShapeCutoff(0.025f);
 
   int v1res = m_settings.dResolution * 2 / 3;
   if (v1res < 18)
@@ -208,6 +222,7 @@ bool CScreensaverMicrocosm::Start()
   m_volume1->init(v1res, v1res, v1res, 1.0f / float(v1res));
   m_volume1->useFastNormals(false);
   m_volume1->setCrawlFromSides(true);
+  m_volume1->useSparseStorage(true);
   m_volume1->setSurface(m_volSurface1[0]);
 
   int v2res = m_settings.dResolution / 3;
@@ -217,6 +232,7 @@ bool CScreensaverMicrocosm::Start()
   m_volume2->init(v2res, v2res, v2res, 1.0f / float(v2res));
   m_volume2->useFastNormals(false);
   m_volume2->setCrawlFromSides(true);
+  m_volume2->useSparseStorage(true);
   m_volume2->setSurface(m_volSurface2[0]);
 
   m_tex1d = new Texture1D(this);
@@ -358,9 +374,8 @@ void CScreensaverMicrocosm::Render()
   glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexVBO);
 
-  glVertexAttribPointer(m_hVertex, 4, GL_FLOAT, GL_TRUE, sizeof(sLight), BUFFER_OFFSET(offsetof(sLight, vertex)));
+  setVertexAttribPointers();
   glEnableVertexAttribArray(m_hVertex);
-  glVertexAttribPointer(m_hNormal, 4, GL_FLOAT, GL_TRUE, sizeof(sLight), BUFFER_OFFSET(offsetof(sLight, normal)));
   glEnableVertexAttribArray(m_hNormal);
 
   // Set GL to addon needed parts
@@ -552,24 +567,42 @@ void CScreensaverMicrocosm::Render()
   if (m_mode == 0)
   {
     if (m_modeTransition < 1.0f)
+    {
       m_volume0->function = surfaceFunctionTransition0;
+      m_volume0->batchfunction = surfaceBatchFunctionTransition0;
+      m_volume0->setShapes(nullptr, 0);
+    }
     else
+    {
       m_volume0->function = surfaceFunction0;
+      m_volume0->batchfunction = surfaceBatchFunction0;
+      // The field is just the sum of the Gizmo's shapes, so only the parts of
+      // the surface near shapes that moved have to be recomputed.
+      m_volume0->setShapes(m_shapes.data(), m_numShapes);
+    }
     // m_volume1 and m_volume2 are not used in mode 0
   }
   else
   {
+    // The eye hole in the field of mode 1 moves with the camera.
+    m_volume0->setShapes(nullptr, 0);
     if (m_modeTransition < 1.0f)
     {
       m_volume0->function = surfaceFunctionTransition1;
       m_volume1->function = surfaceFunctionTransition1;
       m_volume2->function = surfaceFunctionTransition1;
+      m_volume0->batchfunction = surfaceBatchFunctionTransition1;
+      m_volume1->batchfunction = surfaceBatchFunctionTransition1;
+      m_volume2->batchfunction = surfaceBatchFunctionTransition1;
     }
     else
     {
       m_volume0->function = surfaceFunction1;
       m_volume1->function = surfaceFunction1;
       m_volume2->function = surfaceFunction1;
+      m_volume0->batchfunction = surfaceBatchFunction1;
+      m_volume1->batchfunction = surfaceBatchFunction1;
+      m_volume2->batchfunction = surfaceBatchFunction1;
     }
   }
 
@@ -587,6 +620,11 @@ void CScreensaverMicrocosm::Render()
     m_volume0->setSurface(m_volSurface0[whichsurface]);
     m_volume1->setSurface(m_volSurface1[whichsurface]);
     m_volume2->setSurface(m_volSurface2[whichsurface]);
+    // Make each compute surface as big as the largest geometry its partner
+    // has held, so neither buffer of a pair reallocates in steady state.
+    m_volSurface0[whichsurface]->reserve(m_drawSurface0->getPeakNumVertices(), m_drawSurface0->getPeakNumIndices());
+    m_volSurface1[whichsurface]->reserve(m_drawSurface1->getPeakNumVertices(), m_drawSurface1->getPeakNumIndices());
+    m_volSurface2[whichsurface]->reserve(m_drawSurface2->getPeakNumVertices(), m_drawSurface2->getPeakNumIndices());
 
     // Block until thread0 is ready to be signaled again, then signal it.
     m_t0StartMutex.lock();
@@ -670,11 +708,7 @@ void CScreensaverMicrocosm::Render()
                              cam0Background[8], cam0Background[9], cam0Background[10], cam0Background[11],
                              cam0Background[12], cam0Background[13], cam0Background[14], cam0Background[15]);
 
-      m_drawSurface0->draw([&](bool compile, const float* vertices, unsigned int vertex_offset,
-                              const unsigned int* indices, unsigned int index_offset)
-      {
-        Draw(vertices, vertex_offset, indices, index_offset);
-      });
+      Draw(m_drawSurface0);
 
       m_modelMat = modelMatOld;
       m_projMat = projMatOld;
@@ -683,11 +717,7 @@ void CScreensaverMicrocosm::Render()
 
     // render gizmo normally
     m_dimLightUsed = false;
-    m_drawSurface0->draw([&](bool compile, const float* vertices, unsigned int vertex_offset,
-                             const unsigned int* indices, unsigned int index_offset)
-    {
-      Draw(vertices, vertex_offset, indices, index_offset);
-    });
+    Draw(m_drawSurface0);
   }
   else
   {
@@ -770,32 +800,111 @@ void CScreensaverMicrocosm::Render()
   glDisableVertexAttribArray(m_hVertex);
 }
 
-void CScreensaverMicrocosm::Draw(const float* vertices, unsigned int vertex_offset, const unsigned int* indices, unsigned int index_offset)
+void CScreensaverMicrocosm::Draw(impSurface* surface)
 {
+  const unsigned int numIndices = surface->getNumIndices();
+  if (numIndices == 0)
+    return;
+
   m_normalMat = glm::transpose(glm::inverse(glm::mat3(m_modelMat)));
 
-  int length = vertex_offset/6;
-  m_surface.resize(length);
-  for (int i = 0; i < length; ++i)
+  const unsigned int length = surface->getNumVertices();
+
+  EnableShader();
+  if (m_vertexFormat == IMP_VERTEX_FLOAT)
   {
-    m_surface[i].normal.x = vertices[i*6+0];
-    m_surface[i].normal.y = vertices[i*6+1];
-    m_surface[i].normal.z = vertices[i*6+2];
+    const float* vertices = surface->getVertices();
+    m_surface.resize(length);
+    for (unsigned int i = 0; i < length; ++i)
+    {
+      m_surface[i].normal.x = vertices[i*6+0];
+      m_surface[i].normal.y = vertices[i*6+1];
+      m_surface[i].normal.z = vertices[i*6+2];
 
-    m_surface[i].vertex.x = vertices[i*6+3];
-    m_surface[i].vertex.y = vertices[i*6+4];
-    m_surface[i].vertex.z = vertices[i*6+5];
+      m_surface[i].vertex.x = vertices[i*6+3];
+      m_surface[i].vertex.y = vertices[i*6+4];
+      m_surface[i].vertex.z = vertices[i*6+5];
+    }
+    glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*length, m_surface.data(), GL_DYNAMIC_DRAW);
+  }
+  else
+  {
+    // packed vertices go up as they are
+    glBufferData(GL_ARRAY_BUFFER, surface->getVertexSize()*length, surface->getFormattedVertices(), GL_DYNAMIC_DRAW);
   }
 
-  EnableShader();
-  glBufferData(GL_ARRAY_BUFFER, sizeof(sLight)*length, m_surface.data(), GL_DYNAMIC_DRAW);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexVBO);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_offset * sizeof(GLuint), &(indices[0]), GL_DYNAMIC_DRAW);
-  glDrawElements(GL_TRIANGLES, index_offset, GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+  const unsigned short* shortIndices = surface->getShortIndices();
+  if (shortIndices)
+  {
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, numIndices * sizeof(GLushort), shortIndices, GL_DYNAMIC_DRAW);
+    glDrawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_SHORT, BUFFER_OFFSET(0));
+  }
+  else
+  {
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, numIndices * sizeof(GLuint), surface->getIndices(), GL_DYNAMIC_DRAW);
+    glDrawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+  }
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
   DisableShader();
 }
 
+void CScreensaverMicrocosm::chooseVertexFormat()
+{
+  // Packed normals need GL 3.3 or GLES 3.0, half float normals GL 3.0.
+  // Otherwise stay with the float layout.
+  int major = 0;
+  int minor = 0;
+  const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+#if defined(HAS_GLES)
+  if (version)
+    sscanf(version, "OpenGL ES %d.%d", &major, &minor);
+#else
+  if (version)
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+  m_vertexFormat = IMP_VERTEX_FLOAT;
+#if defined(GL_INT_2_10_10_10_REV)
+#if defined(HAS_GLES)
+  if (major >= 3)
+#else
+  if (major > 3 || (major == 3 && minor >= 3))
+#endif
+  {
+    m_vertexFormat = IMP_VERTEX_PACKED_10_10_10_2;
+    return;
+  }
+#endif
+#if defined(GL_HALF_FLOAT) && !defined(HAS_GLES)
+  if (major >= 3)
+    m_vertexFormat = IMP_VERTEX_PACKED_HALF;
+#endif
+}
+
+void CScreensaverMicrocosm::setVertexAttribPointers()
+{
+  switch (m_vertexFormat)
+  {
+#if defined(GL_INT_2_10_10_10_REV)
+    case IMP_VERTEX_PACKED_10_10_10_2:
+      glVertexAttribPointer(m_hVertex, 3, GL_FLOAT, GL_FALSE, 16, BUFFER_OFFSET(0));
+      glVertexAttribPointer(m_hNormal, 4, GL_INT_2_10_10_10_REV, GL_TRUE, 16, BUFFER_OFFSET(12));
+      break;
+#endif
+#if defined(GL_HALF_FLOAT) && !defined(HAS_GLES)
+    case IMP_VERTEX_PACKED_HALF:
+      glVertexAttribPointer(m_hVertex, 3, GL_FLOAT, GL_FALSE, 20, BUFFER_OFFSET(0));
+      glVertexAttribPointer(m_hNormal, 3, GL_HALF_FLOAT, GL_FALSE, 20, BUFFER_OFFSET(12));
+      break;
+#endif
+    default:
+      glVertexAttribPointer(m_hVertex, 4, GL_FLOAT, GL_TRUE, sizeof(sLight), BUFFER_OFFSET(offsetof(sLight, vertex)));
+      glVertexAttribPointer(m_hNormal, 4, GL_FLOAT, GL_TRUE, sizeof(sLight), BUFFER_OFFSET(offsetof(sLight, normal)));
+      break;
+  }
+}
+
 void CScreensaverMicrocosm::OnCompiledAndLinked()
 {
   // Variables passed directly to the Vertex shader
@@ -975,6 +1084,76 @@ float CScreensaverMicrocosm::surfaceFunctionTransition1(void* main, float* posit
   return value;
 }
 
+void CScreensaverMicrocosm::addShapeValues(CScreensaverMicrocosm* base, const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+  for (unsigned int i = 0; i < n; ++i)
+    values[i] = 0.0f;
+
+  for (unsigned int i = 0; i < base->m_numShapes; ++i)
+    base->m_shapes[i]->addValues(xs, ys, zs, values, n);
+}
+
+void CScreensaverMicrocosm::surfaceBatchFunction0(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+  addShapeValues(static_cast<CScreensaverMicrocosm*>(main), xs, ys, zs, values, n);
+}
+
+void CScreensaverMicrocosm::surfaceBatchFunctionTransition0(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+  CScreensaverMicrocosm* base = static_cast<CScreensaverMicrocosm*>(main);
+
+  addShapeValues(base, xs, ys, zs, values, n);
+
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    // transition
+    float trans(((base->m_modeTransition - 0.5f) * 1.5f + xs[i]) * 10.0f);
+    trans = trans * trans * trans;
+    if (trans <= -50.0f)
+      values[i] = 0.0f;
+    else
+      values[i] += (trans < 0.0f) ? trans : 0.0f;
+  }
+}
+
+void CScreensaverMicrocosm::surfaceBatchFunction1(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+  CScreensaverMicrocosm* base = static_cast<CScreensaverMicrocosm*>(main);
+
+  addShapeValues(base, xs, ys, zs, values, n);
+
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    // bubble around viewpoint
+    const float x(10.0f * (base->m_sfEyeX - xs[i]));
+    const float y(10.0f * (base->m_sfEyeY - ys[i]));
+    const float z(10.0f * (base->m_sfEyeZ - zs[i]));
+    const float hole((1.0f / (x * x + y * y + z * z)) - 1.0f);
+    float hole_capped = hole;
+    if (hole < 0.0f)
+      hole_capped = 0.0f;
+    values[i] -= hole_capped * hole_capped;
+  }
+}
+
+void CScreensaverMicrocosm::surfaceBatchFunctionTransition1(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n)
+{
+  CScreensaverMicrocosm* base = static_cast<CScreensaverMicrocosm*>(main);
+
+  surfaceBatchFunction1(main, xs, ys, zs, values, n);
+
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    // transition
+    float trans(((base->m_modeTransition - 0.5f) * 1.5f + xs[i]) * 10.0f);
+    trans = trans * trans * trans;
+    if (trans <= -50.0f)
+      values[i] = 0.0f;
+    else
+      values[i] += (trans < 0.0f) ? trans : 0.0f;
+  }
+}
+
 void CScreensaverMicrocosm::threadFunction0()
 {
   // Conditional variables require their associated mutexes to start out locked
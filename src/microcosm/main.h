@@ -174,15 +174,23 @@ public:
   ATTR_FORCEINLINE glm::mat4& ProjMatrix() { return m_projMat; }
   ATTR_FORCEINLINE glm::mat4& ModelMatrix() { return m_modelMat; }
 
-  void Draw(const float* vertices, unsigned int vertex_offset, const unsigned int* indices, unsigned int index_offset);
+  void Draw(impSurface* surface);
 
 private:
   void chooseGizmo(int index = -1);
+  void chooseVertexFormat();
+  void setVertexAttribPointers();
 
   static float surfaceFunction0(void* main, float* position); // function for mode 0: single gizmo
   static float surfaceFunctionTransition0(void* main, float* position); // ... and with transition
   static float surfaceFunction1(void* main, float* position); // function for mode 1: kaleidoscope
   static float surfaceFunctionTransition1(void* main, float* position); // ... and with transition
+  // batched versions of the above for impCubeVolume::batchfunction
+  static void surfaceBatchFunction0(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+  static void surfaceBatchFunctionTransition0(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+  static void surfaceBatchFunction1(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+  static void surfaceBatchFunctionTransition1(void* main, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
+  static void addShapeValues(CScreensaverMicrocosm* base, const float* xs, const float* ys, const float* zs, float* values, unsigned int n);
 
   void threadFunction0();
   void threadFunction1();
@@ -212,6 +220,7 @@ private:
 
   GLuint m_vertexVBO = 0;
   GLuint m_indexVBO = 0;
+  impVertexFormat m_vertexFormat = IMP_VERTEX_FLOAT;
 
   rsCamera m_camera;
   MirrorBox m_mirrorbox;
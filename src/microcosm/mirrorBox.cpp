@@ -207,27 +207,15 @@ void MirrorBox::drawSubBox(const float& eyex, const float& eyey, const float& ey
   const float dist_sq(eyex * eyex + eyey * eyey + eyez * eyez);
   if(dist_sq < 16.0f)
   {
-    m_base->DrawSurface0()->draw([&](bool compile, const float* vertices, unsigned int vertex_offset,
-                                     const unsigned int* indices, unsigned int index_offset)
-    {
-      m_base->Draw(vertices, vertex_offset, indices, index_offset);
-    });
+    m_base->Draw(m_base->DrawSurface0());
   }
   else if(dist_sq < 36.0f)
   {
-    m_base->DrawSurface1()->draw([&](bool compile, const float* vertices, unsigned int vertex_offset,
-                                     const unsigned int* indices, unsigned int index_offset)
-    {
-      m_base->Draw(vertices, vertex_offset, indices, index_offset);
-    });
+    m_base->Draw(m_base->DrawSurface1());
   }
   else
   {
-    m_base->DrawSurface2()->draw([&](bool compile, const float* vertices, unsigned int vertex_offset,
-                                     const unsigned int* indices, unsigned int index_offset)
-    {
-      m_base->Draw(vertices, vertex_offset, indices, index_offset);
-    });
+    m_base->Draw(m_base->DrawSurface2());
   }
 
 /*  srand(0);
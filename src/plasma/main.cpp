@@ -22,9 +22,55 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 #include <rsMath/rsMath.h>
+#include <rsThreads/rsWorkerPool.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define PIx2 6.28318530718f
 
+namespace
+{
+
+// Keep value within maxdiff of old, so the colors don't change too much
+inline float Limit(float value, float old, float maxdiff)
+{
+  const float diff = value - old;
+  if (diff > maxdiff)
+    return old + maxdiff;
+  if (diff < -maxdiff)
+    return old - maxdiff;
+  return value;
+}
+
+inline uint32_t Quantize(float value)
+{
+  return uint32_t(fabstrunc(value) * 255.0f + 0.5f);
+}
+
+#if defined(__SSE2__)
+inline __m128 Limit(__m128 value, __m128 old, __m128 maxdiff)
+{
+  const __m128 diff = _mm_sub_ps(value, old);
+  const __m128 high = _mm_cmpgt_ps(diff, maxdiff);
+  const __m128 low = _mm_cmplt_ps(diff, _mm_sub_ps(_mm_setzero_ps(), maxdiff));
+  value = _mm_or_ps(_mm_and_ps(high, _mm_add_ps(old, maxdiff)), _mm_andnot_ps(high, value));
+  return _mm_or_ps(_mm_and_ps(low, _mm_sub_ps(old, maxdiff)), _mm_andnot_ps(low, value));
+}
+
+// fabstrunc() and the scaling to a byte, four at once.  A NaN ends up as
+// 255 like in fabstrunc(), because _mm_min_ps() then returns the 1.0.
+inline __m128i Quantize(__m128 value)
+{
+  const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+  value = _mm_min_ps(_mm_and_ps(value, absMask), _mm_set1_ps(1.0f));
+  return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+}
+#endif
+
+} // namespace
+
 bool CScreensaverPlasma::Start()
 {
   int speed = kodi::addon::GetSettingInt("speed");
@@ -53,6 +99,19 @@ bool CScreensaverPlasma::Start()
 
   SetPlasmaSize();
 
+  // The plasma is uploaded as RGBA8, which unlike float textures every
+  // GLES device can do.  Pixel unpack buffers need GL 3.0 or GLES 3.0.
+  glGenTextures(1, &m_tex);
+  glBindTexture(GL_TEXTURE_2D, m_tex);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, TEXSIZE, TEXSIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  m_pixelRing.Create(m_plasmamap.size() * sizeof(uint32_t));
+
   return true;
 }
 
@@ -60,19 +119,18 @@ void CScreensaverPlasma::Stop()
 {
   glDeleteBuffers(1, &m_vertexVBO);
   m_vertexVBO = 0;
+  glDeleteTextures(1, &m_tex);
+  m_tex = 0;
+
+  m_pixelRing.Destroy();
 }
 
 void CScreensaverPlasma::Render()
 {
   glDisable(GL_BLEND);
 
-  int i, j;
-  float rgb[3];
-  float temp;
-  int index;
-
   //Update constants
-  for (i = 0; i < NUMCONSTS; i++)
+  for (int i = 0; i < NUMCONSTS; i++)
   {
     m_ct[i] += m_cv[i];
     if(m_ct[i] > PIx2)
@@ -80,88 +138,26 @@ void CScreensaverPlasma::Render()
     m_c[i] = sinf(m_ct[i]) * m_focus;
   }
 
-  // Update colors
-  for(i = 0; i < m_plasmasize; i++)
-  {
-    for(j = 0; j < int(float(m_plasmasize) / m_aspectRatio); j++)
-    {
-      // Calculate vertex colors
-      rgb[0] = m_plasma[i][j][0];
-      rgb[1] = m_plasma[i][j][1];
-      rgb[2] = m_plasma[i][j][2];
-      m_plasma[i][j][0] = 0.7f
-              * (m_c[0] * m_position[i][j][0] + m_c[1] * m_position[i][j][1]
-              + m_c[2] * (m_position[i][j][0] * m_position[i][j][0] + 1.0f)
-              + m_c[3] * m_position[i][j][0] * m_position[i][j][1]
-              + m_c[4] * rgb[1] + m_c[5] * rgb[2]);
-      m_plasma[i][j][1] = 0.7f
-              * (m_c[6] * m_position[i][j][0] + m_c[7] * m_position[i][j][1]
-              + m_c[8] * m_position[i][j][0] * m_position[i][j][0]
-              + m_c[9] * (m_position[i][j][1] * m_position[i][j][1] - 1.0f)
-              + m_c[10] * rgb[0] + m_c[11] * rgb[2]);
-      m_plasma[i][j][2] = 0.7f
-              * (m_c[12] * m_position[i][j][0] + m_c[13] * m_position[i][j][1]
-              + m_c[14] * (1.0f - m_position[i][j][0] * m_position[i][j][1])
-              + m_c[15] * m_position[i][j][1] * m_position[i][j][1]
-              + m_c[16] * rgb[0] + m_c[17] * rgb[1]);
-
-      // Don't let the colors change too much
-      temp = m_plasma[i][j][0] - rgb[0];
-      if(temp > m_maxdiff)
-        m_plasma[i][j][0] = rgb[0] + m_maxdiff;
-      if(temp < -m_maxdiff)
-        m_plasma[i][j][0] = rgb[0] - m_maxdiff;
-      temp = m_plasma[i][j][1] - rgb[1];
-      if(temp > m_maxdiff)
-        m_plasma[i][j][1] = rgb[1] + m_maxdiff;
-      if(temp < -m_maxdiff)
-        m_plasma[i][j][1] = rgb[1] - m_maxdiff;
-      temp = m_plasma[i][j][2] - rgb[2];
-      if(temp > m_maxdiff)
-        m_plasma[i][j][2] = rgb[2] + m_maxdiff;
-      if(temp < -m_maxdiff)
-        m_plasma[i][j][2] = rgb[2] - m_maxdiff;
-
-      // Put colors into texture
-      index = (i * TEXSIZE + j) * 3;
-      m_plasmamap[index] = fabstrunc(m_plasma[i][j][0]);
-      m_plasmamap[index+1] = fabstrunc(m_plasma[i][j][1]);
-      m_plasmamap[index+2] = fabstrunc(m_plasma[i][j][2]);
-    }
-  }
+  // Update colors, straight into the next pixel buffer of the ring if
+  // there are any
+  uint32_t* texels = static_cast<uint32_t*>(m_pixelRing.Map());
+  if (!texels)
+    texels = m_plasmamap.data();
+
+  rsWorkerPool::shared().parallelFor(m_plasmasize, [&](unsigned int i) {
+    UpdateRow(i, &texels[i * m_plasmaColumns]);
+  });
 
   // Update texture
-  if (!glIsTexture(m_tex))
-  {
-    glGenTextures(1, &m_tex);
-    glBindTexture(GL_TEXTURE_2D, m_tex);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, TEXSIZE);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, TEXSIZE, TEXSIZE, 0, GL_RGB, GL_FLOAT, m_plasmamap);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-  }
-  else
-  {
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, m_tex);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, TEXSIZE);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, int(float(m_plasmasize) / m_aspectRatio), m_plasmasize, GL_RGB, GL_FLOAT, m_plasmamap);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-  }
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_tex);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  m_pixelRing.Upload(m_plasmaColumns, m_plasmasize, texels);
 
   // Draw it
   // The "- 1" cuts off right and top edges to get rid of blending to black
   float texright = float(m_plasmasize - 1) / float(TEXSIZE);
-  float textop = float(int(float(m_plasmasize) / m_aspectRatio) - 1) / float(TEXSIZE);
+  float textop = float(m_plasmaColumns - 1) / float(TEXSIZE);
 
   struct PackedVertex
   {
@@ -235,19 +231,108 @@ void CScreensaverPlasma::SetPlasmaSize()
   else
     m_plasmasize = int(float(m_resolution * TEXSIZE) * m_aspectRatio * 0.01f);
 
+  m_plasmaColumns = int(float(m_plasmasize) / m_aspectRatio);
+
+  const size_t size = size_t(m_plasmasize) * m_plasmaColumns;
+  m_positionX.resize(size);
+  m_positionY.resize(size);
+  m_plasmaR.assign(size, 0.0f);
+  m_plasmaG.assign(size, 0.0f);
+  m_plasmaB.assign(size, 0.0f);
+  m_plasmamap.resize(size);
+
   for (int i=0; i<m_plasmasize; i++)
   {
-    for (int j=0; j<int(float(m_plasmasize) / m_aspectRatio); j++)
+    for (int j=0; j<m_plasmaColumns; j++)
     {
-      m_plasma[i][j][0] = 0.0f;
-      m_plasma[i][j][1] = 0.0f;
-      m_plasma[i][j][2] = 0.0f;
-      m_position[i][j][0] = float(i * m_width) / float(m_plasmasize - 1) - (m_width * 0.5f);
-      m_position[i][j][1] = float(j * m_height) / (float(m_plasmasize) / m_aspectRatio - 1.0f) - (m_height * 0.5f);
+      m_positionX[i * m_plasmaColumns + j] = float(i * m_width) / float(m_plasmasize - 1) - (m_width * 0.5f);
+      m_positionY[i * m_plasmaColumns + j] = float(j * m_height) / (float(m_plasmasize) / m_aspectRatio - 1.0f) - (m_height * 0.5f);
     }
   }
 }
 
+void CScreensaverPlasma::UpdateRow(int row, uint32_t* texels)
+{
+  const int offset = row * m_plasmaColumns;
+  const float* px = &m_positionX[offset];
+  const float* py = &m_positionY[offset];
+  float* r = &m_plasmaR[offset];
+  float* g = &m_plasmaG[offset];
+  float* b = &m_plasmaB[offset];
+  const float* c = m_c;
+  int j = 0;
+
+#if defined(__SSE2__)
+  // Same operations in the same order as the loop below, four cells at once
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 factor = _mm_set1_ps(0.7f);
+  const __m128 maxdiff = _mm_set1_ps(m_maxdiff);
+  __m128 cs[NUMCONSTS];
+  for (int k = 0; k < NUMCONSTS; k++)
+    cs[k] = _mm_set1_ps(c[k]);
+
+  for (; j + 4 <= m_plasmaColumns; j += 4)
+  {
+    const __m128 x = _mm_loadu_ps(px + j);
+    const __m128 y = _mm_loadu_ps(py + j);
+    const __m128 r0 = _mm_loadu_ps(r + j);
+    const __m128 g0 = _mm_loadu_ps(g + j);
+    const __m128 b0 = _mm_loadu_ps(b + j);
+    const __m128 xx = _mm_mul_ps(x, x);
+    const __m128 yy = _mm_mul_ps(y, y);
+    const __m128 xy = _mm_mul_ps(x, y);
+
+    __m128 sum = _mm_add_ps(_mm_mul_ps(cs[0], x), _mm_mul_ps(cs[1], y));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[2], _mm_add_ps(xx, one)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_mul_ps(cs[3], x), y));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[4], g0));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[5], b0));
+    const __m128 r1 = Limit(_mm_mul_ps(factor, sum), r0, maxdiff);
+
+    sum = _mm_add_ps(_mm_mul_ps(cs[6], x), _mm_mul_ps(cs[7], y));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_mul_ps(cs[8], x), x));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[9], _mm_sub_ps(yy, one)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[10], r0));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[11], b0));
+    const __m128 g1 = Limit(_mm_mul_ps(factor, sum), g0, maxdiff);
+
+    sum = _mm_add_ps(_mm_mul_ps(cs[12], x), _mm_mul_ps(cs[13], y));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[14], _mm_sub_ps(one, xy)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_mul_ps(cs[15], y), y));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[16], r0));
+    sum = _mm_add_ps(sum, _mm_mul_ps(cs[17], g0));
+    const __m128 b1 = Limit(_mm_mul_ps(factor, sum), b0, maxdiff);
+
+    _mm_storeu_ps(r + j, r1);
+    _mm_storeu_ps(g + j, g1);
+    _mm_storeu_ps(b + j, b1);
+
+    const __m128i rgba = _mm_or_si128(_mm_or_si128(Quantize(r1), _mm_slli_epi32(Quantize(g1), 8)),
+                                      _mm_or_si128(_mm_slli_epi32(Quantize(b1), 16),
+                                                   _mm_set1_epi32(0xff000000)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(texels + j), rgba);
+  }
+#endif
+
+  for (; j < m_plasmaColumns; j++)
+  {
+    const float x = px[j];
+    const float y = py[j];
+    const float r0 = r[j];
+    const float g0 = g[j];
+    const float b0 = b[j];
+
+    r[j] = Limit(0.7f * (c[0] * x + c[1] * y + c[2] * (x * x + 1.0f) + c[3] * x * y
+                         + c[4] * g0 + c[5] * b0), r0, m_maxdiff);
+    g[j] = Limit(0.7f * (c[6] * x + c[7] * y + c[8] * x * x + c[9] * (y * y - 1.0f)
+                         + c[10] * r0 + c[11] * b0), g0, m_maxdiff);
+    b[j] = Limit(0.7f * (c[12] * x + c[13] * y + c[14] * (1.0f - x * y) + c[15] * y * y
+                         + c[16] * r0 + c[17] * g0), b0, m_maxdiff);
+
+    texels[j] = 0xff000000 | (Quantize(b[j]) << 16) | (Quantize(g[j]) << 8) | Quantize(r[j]);
+  }
+}
+
 void CScreensaverPlasma::OnCompiledAndLinked()
 {
   // Variables passed directly to the Vertex shader
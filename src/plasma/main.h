@@ -19,8 +19,10 @@
 #include <kodi/addon-instance/Screensaver.h>
 #include <math.h>
 #include <kodi/gui/gl/GL.h>
+#include <kodi/gui/gl/PixelUnpackRing.h>
 #include <kodi/gui/gl/Shader.h>
 #include <glm/glm.hpp>
+#include <vector>
 
 #define TEXSIZE 1024
 #define NUMCONSTS 18
@@ -53,6 +55,7 @@ public:
 
 private:
   void SetPlasmaSize();
+  void UpdateRow(int row, uint32_t* texels);
 
   GLint m_hPos = -1;
   GLint m_hCord = -1;
@@ -61,6 +64,7 @@ private:
   GLuint m_tex = 0;
 
   int m_plasmasize = 64;
+  int m_plasmaColumns = 36;
   float m_aspectRatio = 16.0f / 9.0f;
   float m_focus = 30.0f / 50.0f + 0.3f;
   int m_zoom = 10;
@@ -69,9 +73,21 @@ private:
 
   float m_width;
   float m_height;
-  float m_position[TEXSIZE][TEXSIZE][2];
-  float m_plasma[TEXSIZE][TEXSIZE][3];
-  float m_plasmamap[TEXSIZE * TEXSIZE * 3];
+
+  // One plane per component, m_plasmasize rows of m_plasmaColumns each
+  std::vector<float> m_positionX;
+  std::vector<float> m_positionY;
+  std::vector<float> m_plasmaR;
+  std::vector<float> m_plasmaG;
+  std::vector<float> m_plasmaB;
+
+  // RGBA8 texels for the upload, used when there are no pixel buffers
+  std::vector<uint32_t> m_plasmamap;
+
+  // Pixel buffers the texture is streamed through, so the one being
+  // written is never still in use by an earlier upload
+  kodi::gui::gl::CPixelUnpackRing m_pixelRing;
+
   float m_c[NUMCONSTS];  // constant
   float m_ct[NUMCONSTS];  // temporary value of constant
   float m_cv[NUMCONSTS];  // velocity of constant
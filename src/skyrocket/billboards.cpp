@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "billboards.h"
+#include "main.h"
+
+#include <algorithm>
+
+CBillboards::~CBillboards()
+{
+  glDeleteBuffers(1, &m_indexVBO);
+}
+
+void CBillboards::Init()
+{
+  // Two triangles per quad, in the order of the triangle strips the quads
+  // were drawn with before so that they face the same way
+  std::vector<GLushort> indices(BILLBOARDQUADS * 6);
+  for (unsigned int i = 0; i < BILLBOARDQUADS; ++i)
+  {
+    const GLushort v(i * 4);
+    indices[i * 6 + 0] = v;
+    indices[i * 6 + 1] = v + 1;
+    indices[i * 6 + 2] = v + 2;
+    indices[i * 6 + 3] = v + 1;
+    indices[i * 6 + 4] = v + 3;
+    indices[i * 6 + 5] = v + 2;
+  }
+
+  glGenBuffers(1, &m_indexVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexVBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * indices.size(), indices.data(), GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void CBillboards::Begin(const glm::mat4& billboardMat)
+{
+  m_right = glm::vec3(billboardMat[0]);
+  m_up = glm::vec3(billboardMat[1]);
+
+  // keep the groups and their capacity from the last frame
+  for (auto& group : m_groups)
+    group.vertices.clear();
+}
+
+void CBillboards::Add(GLuint texture, bool translucent, const sLight* quad,
+                      const float* pos, float size, const sColor& color)
+{
+  sGroup* group = nullptr;
+  for (auto& g : m_groups)
+  {
+    if (g.texture == texture && g.translucent == translucent)
+    {
+      group = &g;
+      break;
+    }
+  }
+  if (!group)
+  {
+    m_groups.push_back(sGroup{texture, translucent, {}});
+    group = &m_groups.back();
+  }
+
+  for (int i = 0; i < 4; ++i)
+  {
+    const glm::vec3 corner(m_right * (quad[i].vertex.x * size) + m_up * (quad[i].vertex.y * size));
+    sLight vertex;
+    vertex.vertex = sPosition(pos[0] + corner.x, pos[1] + corner.y, pos[2] + corner.z);
+    vertex.color = color;
+    vertex.coord = quad[i].coord;
+    group->vertices.push_back(vertex);
+  }
+}
+
+void CBillboards::Draw()
+{
+  // Uses the vertex buffer and attribute setup of CScreensaverSkyRocket::DrawEntry
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexVBO);
+  glEnable(GL_BLEND);
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    const bool translucent(pass == 0);
+    if (translucent)
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    else
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+
+    for (const auto& group : m_groups)
+    {
+      if (group.translucent != translucent || group.vertices.empty())
+        continue;
+
+      m_base->BindTexture(GL_TEXTURE_2D, group.texture);
+      m_base->EnableShader();
+      const unsigned int quads(group.vertices.size() / 4);
+      for (unsigned int first = 0; first < quads; first += BILLBOARDQUADS)
+      {
+        const unsigned int count(std::min(quads - first, (unsigned int)BILLBOARDQUADS));
+        glBufferData(GL_ARRAY_BUFFER, sizeof(sLight) * count * 4, &group.vertices[first * 4], GL_STREAM_DRAW);
+        glDrawElements(GL_TRIANGLES, count * 6, GL_UNSIGNED_SHORT, 0);
+      }
+      m_base->DisableShader();
+    }
+  }
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
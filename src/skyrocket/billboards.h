@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include <kodi/AddonBase.h>
+#include <kodi/gui/gl/GL.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+#include "light.h"
+
+// Largest number of quads per draw, limited by 16 bit indices
+#define BILLBOARDQUADS 16384
+
+class CScreensaverSkyRocket;
+
+// Collects the camera facing quads of all particles during a frame so that
+// they are uploaded together and drawn with one call per texture, instead of
+// one upload and draw for every flare and smoke puff.
+class ATTR_DLL_LOCAL CBillboards
+{
+public:
+  CBillboards(CScreensaverSkyRocket* base) : m_base(base) { }
+  ~CBillboards();
+
+  void Init();
+
+  // Start collecting quads, turned towards the camera by billboardMat
+  void Begin(const glm::mat4& billboardMat);
+
+  // Add the 4 vertices of quad, scaled by size and moved to pos.
+  // Translucent quads are alpha blended, the others are additive.
+  void Add(GLuint texture, bool translucent, const sLight* quad,
+           const float* pos, float size, const sColor& color);
+
+  // Draw the translucent quads first, then the additive ones
+  void Draw();
+
+private:
+  struct sGroup
+  {
+    GLuint texture;
+    bool translucent;
+    std::vector<sLight> vertices;
+  };
+
+  std::vector<sGroup> m_groups;
+  glm::vec3 m_right, m_up;
+  GLuint m_indexVBO = 0;
+  CScreensaverSkyRocket* m_base;
+};
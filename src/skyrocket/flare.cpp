@@ -265,3 +265,8 @@ void CFlare::Draw(flareType type, const sColor& color)
   m_base->BindTexture(GL_TEXTURE_2D, m_flares[type].texture);
   m_base->DrawEntry(GL_TRIANGLE_STRIP, m_flares[type].light, 4);
 }
+
+void CFlare::Add(flareType type, const float* pos, float size, const sColor& color)
+{
+  m_base->Billboards().Add(m_flares[type].texture, false, m_flares[type].light, pos, size, color);
+}
@@ -60,6 +60,9 @@ public:
   // alpha = 0.0 for lowest intensity; alpha = 1.0 for highest intensity
   void Flare(float x, float y, float red, float green, float blue, float alpha);
   void Draw(flareType type, const sColor& color);
+
+  // Queue a camera facing flare at pos for the particle billboards
+  void Add(flareType type, const float* pos, float size, const sColor& color);
   inline sFlare* Flares() { return m_flares; }
 
   struct data
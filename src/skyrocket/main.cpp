@@ -66,8 +66,13 @@ bool CScreensaverSkyRocket::Start()
     m_smoke.Init();
   m_world.Init();
   m_shockwave.Init();
-  if (m_settings.dSound)
-    m_soundengine = new CSoundEngine(float(m_settings.dSound) * 0.01f);
+  m_billboards.Init();
+  if (m_settings.dSoundEnabled && m_settings.dSound)
+  {
+    // SKYROCKET_SOUND_WAV names a file to render the sound to instead of playing it
+    const char* wavFile = getenv("SKYROCKET_SOUND_WAV");
+    m_soundengine = new CSoundEngine(float(m_settings.dSound) * 0.01f, wavFile ? wavFile : "");
+  }
 
   glGenBuffers(1, &m_vertexVBO);
   glBindBuffer(GL_ARRAY_BUFFER, m_vertexVBO);
@@ -107,8 +112,8 @@ void CScreensaverSkyRocket::Stop()
   m_particles.clear();
 
   // clean up sound data structures
-  if (m_settings.dSound)
-    delete m_soundengine;
+  delete m_soundengine;
+  m_soundengine = nullptr;
 }
 
 void CScreensaverSkyRocket::Render()
@@ -212,6 +217,8 @@ void CScreensaverSkyRocket::Render()
     m_lookAt[0] = m_lookAt[2] + ((m_lookAt[1] - m_lookAt[2]) * cameraStep);
     // update variables used for sound and lens flares
     m_cameraVel = m_lookFrom[0] - m_cameraPos;
+    if (m_frameTime > 0.0f)
+      m_cameraVel *= 1.0f / m_frameTime;  // feet per second for Doppler shift
     m_cameraPos = m_lookFrom[0];
     // find heading and pitch
     FindHeadingAndPitch(m_lookFrom[0], m_lookAt[0], m_headings, m_pitch);
@@ -473,61 +480,19 @@ void CScreensaverSkyRocket::Render()
       }
     }
 
-    // update particles
+    // update particles, including those spawned while updating the others
     m_numRockets = 0;
-    for (unsigned int i = 0; i < m_lastParticle; i++)
+    unsigned int first = 0;
+    while (first < m_lastParticle)
     {
-      CParticle* curpart(&(m_particles[i]));
-      m_particles[i].update();
-      if (curpart->GetType() == ROCKET)
-        m_numRockets++;
-        curpart->findDepth();
-      if (curpart->GetLifeRemaining() <= 0.0f || curpart->GetXYZ()[1] < 0.0f)
-      {
-        switch(curpart->GetType())
-        {
-        case ROCKET:
-          if (curpart->GetXYZ()[1] <= 0.0f)
-          {
-            // move above ground for explosion so new particles aren't removed
-            curpart->GetXYZ()[1] = 0.1f;
-            curpart->GetVelocityVector()[1] *= -0.7f;
-          }
-          if (curpart->GetExplosionType() == 18)
-            curpart->initSpinner();
-          else
-            curpart->initExplosion();
-          break;
-        case POPPER:
-          switch(curpart->GetExplosionType())
-          {
-          case STAR:
-            curpart->GetExplosionType() = 100;
-            curpart->initExplosion();
-            break;
-          case STREAMER:
-            curpart->GetExplosionType() = 101;
-            curpart->initExplosion();
-            break;
-          case METEOR:
-            curpart->GetExplosionType() = 102;
-            curpart->initExplosion();
-            break;
-          case POPPER:
-            curpart->GetType() = STAR;
-            curpart->GetRGB().set(1.0f, 0.8f, 0.6f);
-            curpart->GetTimeTotal() = m_particles[i].GetTimeRemaining() = m_particles[i].GetLifeRemaining() = 0.2f;
-          }
-          break;
-        case SUCKER:
-          curpart->initShockwave();
-          break;
-        case STRETCHER:
-          curpart->initBigmama();
-        }
-      }
+      const unsigned int last = m_lastParticle;
+      UpdateParticles(first, last);
+      first = last;
     }
 
+    // light, pull, push and stretch other particles now that all have moved
+    ApplyParticleEffects();
+
     // remove particles from list
     for (unsigned int i = 0; i < m_lastParticle; i++)
     {
@@ -549,10 +514,12 @@ void CScreensaverSkyRocket::Render()
   // the world
   m_world.draw();
 
-  // draw particles
+  // draw particles, collecting their flares and smoke into one batch
   glEnable(GL_BLEND);
+  m_billboards.Begin(m_billboardMat);
   for (unsigned int i = 0; i < m_lastParticle; i++)
     m_particles[i].draw();
+  m_billboards.Draw();
 
   // draw lens flares
   if (m_settings.dFlare)
@@ -604,6 +571,165 @@ void CScreensaverSkyRocket::Reshape()
   }
 }
 
+void CScreensaverSkyRocket::UpdateParticles(unsigned int first, unsigned int last)
+{
+  unsigned int i;
+
+  // group the batch by type so that each special case is its own pass
+  for (auto& particles : m_typeParticles)
+    particles.clear();
+  for (i = first; i < last; ++i)
+    m_typeParticles[m_particles[i].GetType()].push_back(i);
+
+  // rockets and bees steer themselves
+  for (unsigned int p : m_typeParticles[ROCKET])
+    m_particles[p].accelerate();
+  for (unsigned int p : m_typeParticles[BEE])
+    m_particles[p].accelerate();
+
+  // gravity, air resistance, movement and wind for the whole batch at once
+  const unsigned int count = last - first;
+  if (m_motion.Size() < count)
+    m_motion.Resize(m_particles.size());
+  for (i = 0; i < count; ++i)
+    m_particles[first + i].storeMotion(m_motion, i);
+  m_motion.Integrate(count, m_frameTime, float(m_settings.dWind));
+  for (i = 0; i < count; ++i)
+    m_particles[first + i].loadMotion(m_motion, i);
+
+  // life, brightness, trails and effects on other particles, type by type
+  for (const auto& particles : m_typeParticles)
+  {
+    for (unsigned int p : particles)
+      m_particles[p].update();
+  }
+  for (i = first; i < last; ++i)
+    m_particles[i].findDepth();
+
+  // rockets explode when they burn out or hit the ground
+  m_numRockets += int(m_typeParticles[ROCKET].size());
+  for (unsigned int p : m_typeParticles[ROCKET])
+  {
+    CParticle* curpart(&(m_particles[p]));
+    if (curpart->GetLifeRemaining() <= 0.0f || curpart->GetXYZ()[1] < 0.0f)
+    {
+      if (curpart->GetXYZ()[1] <= 0.0f)
+      {
+        // move above ground for explosion so new particles aren't removed
+        curpart->GetXYZ()[1] = 0.1f;
+        curpart->GetVelocityVector()[1] *= -0.7f;
+      }
+      if (curpart->GetExplosionType() == 18)
+        curpart->initSpinner();
+      else
+        curpart->initExplosion();
+    }
+  }
+
+  // poppers pop into whatever they were carrying
+  for (unsigned int p : m_typeParticles[POPPER])
+  {
+    CParticle* curpart(&(m_particles[p]));
+    if (curpart->GetLifeRemaining() <= 0.0f || curpart->GetXYZ()[1] < 0.0f)
+    {
+      switch(curpart->GetExplosionType())
+      {
+      case STAR:
+        curpart->GetExplosionType() = 100;
+        curpart->initExplosion();
+        break;
+      case STREAMER:
+        curpart->GetExplosionType() = 101;
+        curpart->initExplosion();
+        break;
+      case METEOR:
+        curpart->GetExplosionType() = 102;
+        curpart->initExplosion();
+        break;
+      case POPPER:
+        curpart->GetType() = STAR;
+        curpart->GetRGB().set(1.0f, 0.8f, 0.6f);
+        curpart->GetTimeTotal() = curpart->GetTimeRemaining() = curpart->GetLifeRemaining() = 0.2f;
+      }
+    }
+  }
+
+  // the easter egg explosions turn into their big follow-ups
+  for (unsigned int p : m_typeParticles[SUCKER])
+  {
+    CParticle* curpart(&(m_particles[p]));
+    if (curpart->GetLifeRemaining() <= 0.0f || curpart->GetXYZ()[1] < 0.0f)
+      curpart->initShockwave();
+  }
+  for (unsigned int p : m_typeParticles[STRETCHER])
+  {
+    CParticle* curpart(&(m_particles[p]));
+    if (curpart->GetLifeRemaining() <= 0.0f || curpart->GetXYZ()[1] < 0.0f)
+      curpart->initBigmama();
+  }
+}
+
+void CScreensaverSkyRocket::ApplyParticleEffects()
+{
+  bool lights = false;
+  bool forces = false;
+
+  m_smokeGrid.Clear();
+  m_particleGrid.Clear();
+  for (unsigned int i = 0; i < m_lastParticle; ++i)
+  {
+    switch(m_particles[i].GetType())
+    {
+    case SMOKE:
+      m_smokeGrid.Add(i, m_particles[i].GetXYZ().v);
+      break;
+    case ROCKET:
+    case FOUNTAIN:
+    case EXPLOSION:
+      lights = true;
+      break;
+    case SUCKER:
+    case SHOCKWAVE:
+    case STRETCHER:
+      forces = true;
+    }
+  }
+
+  // smoke and cloud illumination from rockets and explosions
+  if (lights && m_settings.dIllumination)
+  {
+    m_smokeGrid.Build();
+    for (unsigned int i = 0; i < m_lastParticle; ++i)
+    {
+      const unsigned int type(m_particles[i].GetType());
+      if (type == ROCKET || type == FOUNTAIN || type == EXPLOSION)
+        Illuminate(&(m_particles[i]));
+    }
+  }
+
+  // pulling, pushing and stretching of particles by the big explosions
+  if (forces)
+  {
+    for (unsigned int i = 0; i < m_lastParticle; ++i)
+      m_particleGrid.Add(i, m_particles[i].GetXYZ().v);
+    m_particleGrid.Build();
+    for (unsigned int i = 0; i < m_lastParticle; ++i)
+    {
+      switch(m_particles[i].GetType())
+      {
+      case SUCKER:
+        Pulling(&(m_particles[i]));
+        break;
+      case SHOCKWAVE:
+        Pushing(&(m_particles[i]));
+        break;
+      case STRETCHER:
+        Stretching(&(m_particles[i]));
+      }
+    }
+  }
+}
+
 CParticle* CScreensaverSkyRocket::AddParticle()
 {
   // Advance to new particle if there is another in the vector.
@@ -643,59 +769,49 @@ void CScreensaverSkyRocket::Illuminate(CParticle* ill)
   // Smoke illumination
   if ((ill->GetType() == ROCKET) || (ill->GetType() == FOUNTAIN))
   {
-    float distsquared;
-    for (unsigned int i = 0; i < m_lastParticle; ++i)
-    {
+    m_smokeGrid.ForEachNear(ill->GetXYZ().v, 200.0f, [&](unsigned int i) {
       CParticle* smk(&(m_particles[i]));
-      if (smk->GetType() == SMOKE)
+      float distsquared = (ill->GetXYZ()[0] - smk->GetXYZ()[0]) * (ill->GetXYZ()[0] - smk->GetXYZ()[0])
+        + (ill->GetXYZ()[1] - smk->GetXYZ()[1]) * (ill->GetXYZ()[1] - smk->GetXYZ()[1])
+        + (ill->GetXYZ()[2] - smk->GetXYZ()[2]) * (ill->GetXYZ()[2] - smk->GetXYZ()[2]);
+      if (distsquared < 40000.0f)
       {
-        distsquared = (ill->GetXYZ()[0] - smk->GetXYZ()[0]) * (ill->GetXYZ()[0] - smk->GetXYZ()[0])
-          + (ill->GetXYZ()[1] - smk->GetXYZ()[1]) * (ill->GetXYZ()[1] - smk->GetXYZ()[1])
-          + (ill->GetXYZ()[2] - smk->GetXYZ()[2]) * (ill->GetXYZ()[2] - smk->GetXYZ()[2]);
-        if (distsquared < 40000.0f)
-        {
-          temp = (40000.0f - distsquared) * 0.000025f;
-          temp = temp * temp * ill->GetBright();
-          smk->GetRGB()[0] += temp * newrgb.r;
-          if (smk->GetRGB()[0] > 1.0f)
-            smk->GetRGB()[0] = 1.0f;
-          smk->GetRGB()[1] += temp * newrgb.g;
-          if (smk->GetRGB()[1] > 1.0f)
-            smk->GetRGB()[1] = 1.0f;
-          smk->GetRGB()[2] += temp * newrgb.b;
-          if (smk->GetRGB()[2] > 1.0f)
-            smk->GetRGB()[2] = 1.0f;
-        }
+        temp = (40000.0f - distsquared) * 0.000025f;
+        temp = temp * temp * ill->GetBright();
+        smk->GetRGB()[0] += temp * newrgb.r;
+        if (smk->GetRGB()[0] > 1.0f)
+          smk->GetRGB()[0] = 1.0f;
+        smk->GetRGB()[1] += temp * newrgb.g;
+        if (smk->GetRGB()[1] > 1.0f)
+          smk->GetRGB()[1] = 1.0f;
+        smk->GetRGB()[2] += temp * newrgb.b;
+        if (smk->GetRGB()[2] > 1.0f)
+          smk->GetRGB()[2] = 1.0f;
       }
-    }
+    });
   }
   if (ill->GetType() == EXPLOSION)
   {
-    float distsquared;
-    for (unsigned int i = 0; i < m_lastParticle; ++i)
-    {
+    m_smokeGrid.ForEachNear(ill->GetXYZ().v, 800.0f, [&](unsigned int i) {
       CParticle* smk(&(m_particles[i]));
-      if (smk->GetType() == SMOKE)
+      float distsquared = (ill->GetXYZ()[0] - smk->GetXYZ()[0]) * (ill->GetXYZ()[0] - smk->GetXYZ()[0])
+        + (ill->GetXYZ()[1] - smk->GetXYZ()[1]) * (ill->GetXYZ()[1] - smk->GetXYZ()[1])
+        + (ill->GetXYZ()[2] - smk->GetXYZ()[2]) * (ill->GetXYZ()[2] - smk->GetXYZ()[2]);
+      if (distsquared < 640000.0f)
       {
-        distsquared = (ill->GetXYZ()[0] - smk->GetXYZ()[0]) * (ill->GetXYZ()[0] - smk->GetXYZ()[0])
-          + (ill->GetXYZ()[1] - smk->GetXYZ()[1]) * (ill->GetXYZ()[1] - smk->GetXYZ()[1])
-          + (ill->GetXYZ()[2] - smk->GetXYZ()[2]) * (ill->GetXYZ()[2] - smk->GetXYZ()[2]);
-        if (distsquared < 640000.0f)
-        {
-          temp = (640000.0f - distsquared) * 0.0000015625f;
-          temp = temp * temp * ill->GetBright();
-          smk->GetRGB()[0] += temp * newrgb.r;
-          if (smk->GetRGB()[0] > 1.0f)
-            smk->GetRGB()[0] = 1.0f;
-          smk->GetRGB()[1] += temp * newrgb.g;
-          if (smk->GetRGB()[1] > 1.0f)
-            smk->GetRGB()[1] = 1.0f;
-          smk->GetRGB()[2] += temp * newrgb.b;
-          if (smk->GetRGB()[2] > 1.0f)
-            smk->GetRGB()[2] = 1.0f;
-        }
+        temp = (640000.0f - distsquared) * 0.0000015625f;
+        temp = temp * temp * ill->GetBright();
+        smk->GetRGB()[0] += temp * newrgb.r;
+        if (smk->GetRGB()[0] > 1.0f)
+          smk->GetRGB()[0] = 1.0f;
+        smk->GetRGB()[1] += temp * newrgb.g;
+        if (smk->GetRGB()[1] > 1.0f)
+          smk->GetRGB()[1] = 1.0f;
+        smk->GetRGB()[2] += temp * newrgb.b;
+        if (smk->GetRGB()[2] > 1.0f)
+          smk->GetRGB()[2] = 1.0f;
       }
-    }
+    });
   }
 
   // cloud illumination
@@ -749,8 +865,7 @@ void CScreensaverSkyRocket::Pulling(CParticle* suck)
   float pulldistsquared;
   float pullconst = (1.0f - suck->GetLifeRemaining()) * 0.01f * m_frameTime;
 
-  for (unsigned int i = 0; i < m_lastParticle; ++i)
-  {
+  m_particleGrid.ForEachNear(suck->GetXYZ().v, 500.0f, [&](unsigned int i) {
     CParticle* puller(&(m_particles[i]));
     diff = suck->GetXYZ() - puller->GetXYZ();
     pulldistsquared = diff[0]*diff[0] + diff[1]*diff[1] + diff[2]*diff[2];
@@ -763,7 +878,7 @@ void CScreensaverSkyRocket::Pulling(CParticle* suck)
         puller->GetVelocityVector() += diff * ((250000.0f - pulldistsquared) * pullconst);
       }
     }
-  }
+  });
 }
 
 // pushing of other particles
@@ -773,8 +888,7 @@ void CScreensaverSkyRocket::Pushing(CParticle* shock)
   float pushdistsquared;
   float pushconst = (1.0f - shock->GetLifeRemaining()) * 0.002f * m_frameTime;
 
-  for (unsigned int i = 0; i < m_lastParticle; ++i)
-  {
+  m_particleGrid.ForEachNear(shock->GetXYZ().v, 800.0f, [&](unsigned int i) {
     CParticle* pusher(&(m_particles[i]));
     diff = pusher->GetXYZ() - shock->GetXYZ();
     pushdistsquared = diff[0]*diff[0] + diff[1]*diff[1] + diff[2]*diff[2];
@@ -787,7 +901,7 @@ void CScreensaverSkyRocket::Pushing(CParticle* shock)
         pusher->GetVelocityVector() += diff * ((640000.0f - pushdistsquared) * pushconst);
       }
     }
-  }
+  });
 }
 
 // vertical stretching of other particles (x, z sucking; y pushing)
@@ -797,8 +911,7 @@ void CScreensaverSkyRocket::Stretching(CParticle* stretch)
   float stretchdistsquared, temp;
   float stretchconst = (1.0f - stretch->GetLifeRemaining()) * 0.002f * m_frameTime;
 
-  for (unsigned int i = 0; i < m_lastParticle; ++i)
-  {
+  m_particleGrid.ForEachNear(stretch->GetXYZ().v, 800.0f, [&](unsigned int i) {
     CParticle* stretcher(&(m_particles[i]));
     diff = stretch->GetXYZ() - stretcher->GetXYZ();
     stretchdistsquared = diff[0]*diff[0] + diff[1]*diff[1] + diff[2]*diff[2];
@@ -810,7 +923,7 @@ void CScreensaverSkyRocket::Stretching(CParticle* stretch)
       stretcher->GetVelocityVector()[1] -= diff[1] * temp;
       stretcher->GetVelocityVector()[2] += diff[2] * temp * 5.0f;
     }
-  }
+  });
 }
 
 // Makes list of lens flares.  Must be a called even when action is paused
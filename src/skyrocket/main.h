@@ -22,8 +22,10 @@
 #include <rsMath/rsVec.h>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "billboards.h"
 #include "flare.h"
 #include "particle.h"
+#include "particleGrid.h"
 #include "shockwave.h"
 #include "smoke.h"
 #include "world.h"
@@ -91,6 +93,10 @@ struct sSkyRocketSettings
   int userDefinedExplosion = -1;
 };
 
+// Cell size of the particle grids, between the 200 to 800 feet reach of the
+// particles that affect others
+#define PARTICLEGRIDCELL 400.0f
+
 class CSoundEngine;
 
 class ATTR_DLL_LOCAL CScreensaverSkyRocket
@@ -103,7 +109,10 @@ public:
     : m_flare(this),
       m_shockwave(this),
       m_smoke(this),
-      m_world(this)
+      m_world(this),
+      m_billboards(this),
+      m_smokeGrid(PARTICLEGRIDCELL),
+      m_particleGrid(PARTICLEGRIDCELL)
   { }
 
   bool Start() override;
@@ -136,6 +145,7 @@ public:
   ATTR_FORCEINLINE CShockwave& Shockwave() { return m_shockwave; }
   ATTR_FORCEINLINE CSmoke& Smoke() { return m_smoke; }
   ATTR_FORCEINLINE CWorld& World() { return m_world; }
+  ATTR_FORCEINLINE CBillboards& Billboards() { return m_billboards; }
   ATTR_FORCEINLINE CSoundEngine* SoundEngine() { return m_soundengine; }
 
   ATTR_FORCEINLINE int XSize() { return m_xsize; }
@@ -150,6 +160,8 @@ public:
 
 private:
   void Reshape();
+  void UpdateParticles(unsigned int first, unsigned int last);
+  void ApplyParticleEffects();
   void RemoveParticle(unsigned int rempart);
   void SortParticles();
   void MakeFlareList();
@@ -183,6 +195,7 @@ private:
   CShockwave m_shockwave;
   CSmoke m_smoke;
   CWorld m_world;  // the world
+  CBillboards m_billboards;  // particle flares and smoke, drawn together
   CSoundEngine* m_soundengine = nullptr;  // the sound engine
 
   std::vector<CFlare::data> m_lensFlares;
@@ -209,6 +222,10 @@ private:
 
   std::vector<CParticle> m_particles;
   unsigned int m_lastParticle = 0;
+  CParticleMotion m_motion;  // batch for the motion shared by all particles
+  std::vector<unsigned int> m_typeParticles[BIGMAMA + 1];  // indices of each type in the batch
+  CParticleGrid m_smokeGrid;  // smoke positions for illumination
+  CParticleGrid m_particleGrid;  // all positions for suckers, shockwaves and stretchers
   #define ZOOMROCKETINACTIVE 1000000000
   unsigned int m_zoomRocket = ZOOMROCKETINACTIVE;
   int m_numRockets = 0;
@@ -5,190 +5,168 @@
  *  See LICENSE.md for more information.
  */
 
+#pragma once
 
-#ifndef MOONTEX_H
-#define MOONTEX_H
-
-
+#include <rsAsset/rsAsset.h>
 
 #define MOONTEXSIZE 64
 
+/* data from moonmap.raw, 8192 bytes */
 
-
-unsigned char moonmap[MOONTEXSIZE][MOONTEXSIZE][2] = {
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,6,0,20,0,45,0,84,0,137,0,184,0,220,0,242,0,255,0,255,0,255,
-0,255,0,255,0,255,0,255,0,242,0,218,0,183,0,135,0,83,0,44,0,19,0,6,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,0,13,0,42,0,97,0,165,0,228,0,255,1,255,1,255,0,255,0,255,1,255,0,255,1,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,0,255,
-0,255,0,227,0,163,0,96,0,40,0,13,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,13,0,51,0,126,0,215,0,255,1,255,5,255,
-9,255,15,255,19,255,5,255,13,255,15,255,13,255,13,255,10,255,3,255,6,255,5,255,0,255,0,255,1,255,0,255,0,255,0,255,0,255,0,255,0,213,0,125,0,50,0,12,
-0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,44,0,120,1,217,4,255,9,255,22,255,35,255,42,255,42,255,45,255,59,255,37,255,42,255,53,255,66,255,38,255,
-40,255,51,255,38,255,30,255,13,255,6,255,6,255,1,255,1,255,0,255,0,255,0,255,0,255,0,255,0,216,0,120,0,43,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,24,0,91,
-1,198,6,255,15,255,31,255,53,255,64,255,99,255,76,255,71,255,76,255,92,255,96,255,69,255,71,255,84,255,74,255,66,255,77,255,79,255,50,255,40,255,28,255,23,255,17,255,
-1,255,0,255,1,255,1,255,2,255,0,255,0,255,0,255,0,196,0,90,0,22,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,46,1,141,13,244,47,255,71,255,77,255,80,255,110,255,137,255,138,255,119,255,
-92,255,136,255,138,255,150,255,158,255,158,255,147,255,147,255,112,255,102,255,98,255,87,255,73,255,59,255,46,255,40,255,27,255,15,255,13,255,12,255,14,255,9,255,0,255,0,255,
-0,255,0,243,0,138,0,45,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,8,5,70,20,189,38,255,106,255,143,255,126,255,132,255,152,255,160,255,161,255,173,255,182,255,177,255,198,255,181,255,153,255,187,255,199,255,193,255,170,255,
-152,255,106,255,105,255,116,255,100,255,107,255,54,255,45,255,50,255,48,255,40,255,25,255,11,255,12,255,5,255,0,255,0,255,0,255,0,255,0,185,0,67,0,8,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,7,90,52,213,126,255,157,255,184,255,
-173,255,158,255,164,255,166,255,193,255,202,255,211,255,208,255,216,255,201,255,178,255,189,255,201,255,213,255,206,255,160,255,165,255,115,255,112,255,125,255,100,255,84,255,87,255,85,255,
-71,255,48,255,40,255,46,255,34,255,22,255,17,255,8,255,2,255,0,255,0,255,0,255,0,209,0,86,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,9,92,86,221,180,255,194,255,193,255,192,255,196,255,189,255,199,255,217,255,225,255,224,255,225,255,224,255,
-186,255,151,255,199,255,201,255,177,255,177,255,193,255,175,255,160,255,140,255,149,255,123,255,107,255,108,255,96,255,92,255,104,255,92,255,74,255,67,255,56,255,40,255,33,255,22,255,
-11,255,5,255,1,255,0,255,0,255,0,218,0,89,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,9,27,90,80,221,166,255,202,255,202,255,208,255,209,255,215,255,208,255,217,255,212,255,218,255,225,255,204,255,163,255,176,255,191,255,211,255,201,255,194,255,167,255,164,255,156,255,
-169,255,182,255,169,255,164,255,152,255,138,255,130,255,120,255,115,255,129,255,134,255,121,255,80,255,60,255,47,255,32,255,35,255,30,255,10,255,2,255,0,255,0,255,0,218,0,86,
-0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,43,71,182,213,208,255,203,255,216,255,217,255,213,255,224,255,
-226,255,215,255,211,255,198,255,211,255,224,255,196,255,171,255,198,255,216,255,212,255,206,255,217,255,229,255,213,255,186,255,189,255,203,255,199,255,199,255,191,255,147,255,147,255,139,255,
-116,255,102,255,125,255,139,255,127,255,95,255,66,255,54,255,50,255,35,255,28,255,10,255,2,255,0,255,0,255,0,210,0,67,0,5,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,1,44,48,161,191,227,255,230,255,212,255,203,255,217,255,233,255,230,255,224,255,206,255,203,255,199,255,203,255,216,255,215,255,202,255,
-199,255,209,255,222,255,220,255,227,255,229,255,224,255,217,255,198,255,184,255,201,255,213,255,207,255,197,255,163,255,158,255,154,255,131,255,143,255,142,255,137,255,130,255,93,255,75,255,
-81,255,65,255,40,255,19,255,8,255,2,255,0,255,0,255,0,186,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,25,211,144,
-244,255,218,255,231,255,231,255,218,255,230,255,239,255,222,255,216,255,201,255,203,255,199,255,201,255,217,255,224,255,208,255,194,255,197,255,226,255,242,255,235,255,226,255,220,255,208,255,
-203,255,186,255,206,255,216,255,212,255,206,255,194,255,176,255,199,255,199,255,158,255,143,255,149,255,147,255,126,255,111,255,103,255,102,255,72,255,58,255,35,255,16,255,3,255,0,255,
-0,255,0,139,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,9,158,94,255,238,235,255,255,255,237,255,239,255,230,255,218,255,215,255,216,255,
-204,255,201,255,206,255,194,255,187,255,196,255,209,255,213,255,216,255,216,255,212,255,222,255,229,255,216,255,221,255,199,255,197,255,201,255,204,255,201,255,187,255,192,255,196,255,196,255,
-197,255,182,255,163,255,165,255,144,255,138,255,151,255,137,255,108,255,117,255,108,255,79,255,63,255,47,255,22,255,3,255,1,255,0,237,0,90,0,8,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,65,47,251,201,243,255,239,255,247,255,240,255,225,255,213,255,197,255,196,255,218,255,201,255,192,255,199,255,207,255,222,255,207,255,206,255,215,255,
-226,255,235,255,238,255,226,255,220,255,207,255,211,255,212,255,208,255,197,255,176,255,181,255,182,255,194,255,191,255,197,255,198,255,176,255,170,255,164,255,151,255,135,255,157,255,161,255,
-122,255,108,255,128,255,122,255,83,255,68,255,54,255,23,255,5,255,0,255,0,197,0,43,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,15,215,124,255,255,244,255,
-254,255,246,255,235,255,209,255,196,255,202,255,213,255,217,255,206,255,198,255,209,255,216,255,238,255,231,255,217,255,213,255,217,255,233,255,244,255,238,255,227,255,208,255,202,255,212,255,
-218,255,207,255,184,255,183,255,172,255,188,255,184,255,193,255,204,255,201,255,182,255,167,255,152,255,154,255,167,255,169,255,134,255,130,255,159,255,159,255,130,255,90,255,73,255,48,255,
-18,255,1,255,0,255,0,119,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,2,98,55,255,219,248,255,252,255,255,255,246,255,218,255,202,255,197,255,203,255,208,255,215,255,
-216,255,209,255,225,255,218,255,204,255,206,255,203,255,211,255,192,255,201,255,231,255,239,255,207,255,207,255,220,255,221,255,225,255,225,255,213,255,204,255,178,255,188,255,204,255,203,255,
-211,255,213,255,204,255,192,255,175,255,157,255,136,255,145,255,139,255,154,255,161,255,160,255,156,255,117,255,103,255,66,255,43,255,19,255,0,255,0,216,0,50,0,2,0,0,0,0,
-0,0,0,0,0,0,17,15,220,131,255,255,250,255,252,255,255,255,247,255,221,255,186,255,183,255,212,255,198,255,209,255,221,255,215,255,220,255,222,255,206,255,180,255,193,255,196,255,
-175,255,175,255,212,255,239,255,206,255,212,255,218,255,227,255,225,255,237,255,216,255,221,255,202,255,201,255,206,255,206,255,204,255,206,255,221,255,238,255,220,255,178,255,134,255,125,255,
-146,255,173,255,165,255,153,255,158,255,130,255,122,255,84,255,64,255,46,255,5,255,0,255,0,124,0,13,0,0,0,0,0,0,0,0,0,1,79,45,255,219,252,255,252,255,254,255,
-254,255,244,255,222,255,211,255,212,255,224,255,226,255,218,255,211,255,216,255,216,255,201,255,198,255,186,255,175,255,184,255,180,255,175,255,196,255,216,255,233,255,230,255,215,255,213,255,
-230,255,224,255,206,255,225,255,237,255,216,255,201,255,202,255,213,255,225,255,233,255,247,255,237,255,207,255,175,255,147,255,156,255,181,255,169,255,140,255,135,255,137,255,118,255,108,255,
-91,255,65,255,24,255,2,255,0,213,0,40,0,1,0,0,0,0,0,0,12,8,202,100,255,255,248,255,252,255,250,255,251,255,240,255,237,255,239,255,213,255,212,255,242,255,229,255,
-220,255,221,255,220,255,172,255,160,255,183,255,189,255,211,255,206,255,181,255,199,255,213,255,230,255,234,255,220,255,212,255,213,255,221,255,227,255,225,255,239,255,234,255,209,255,203,255,
-231,255,239,255,238,255,230,255,221,255,194,255,182,255,183,255,188,255,181,255,167,255,143,255,134,255,138,255,129,255,116,255,116,255,78,255,56,255,18,255,1,254,0,95,0,6,0,0,
-0,0,0,0,85,22,255,168,255,255,254,255,250,255,243,255,246,255,237,255,237,255,227,255,186,255,213,255,246,255,233,255,226,255,237,255,202,255,145,255,137,255,167,255,206,255,230,255,
-222,255,199,255,193,255,180,255,187,255,194,255,192,255,218,255,209,255,230,255,243,255,238,255,235,255,244,255,233,255,221,255,233,255,242,255,240,255,230,255,208,255,202,255,188,255,187,255,
-189,255,182,255,182,255,163,255,171,255,156,255,132,255,123,255,127,255,92,255,68,255,63,255,12,255,0,162,0,20,0,0,0,0,1,2,165,49,255,232,252,255,252,255,244,255,244,255,
-250,255,250,255,244,255,225,255,213,255,240,255,251,255,242,255,246,255,243,255,188,255,128,255,129,255,186,255,227,255,233,255,221,255,157,255,125,255,114,255,165,255,171,255,182,255,212,255,
-213,255,233,255,250,255,242,255,246,255,248,255,242,255,237,255,244,255,238,255,218,255,218,255,225,255,206,255,197,255,194,255,187,255,188,255,181,255,151,255,153,255,159,255,134,255,143,255,
-129,255,107,255,92,255,88,255,41,255,0,228,0,45,0,0,0,0,1,6,215,88,255,255,251,255,250,255,250,255,242,255,244,255,255,255,255,255,243,255,240,255,255,255,246,255,240,255,
-255,255,218,255,167,255,134,255,134,255,167,255,196,255,207,255,218,255,146,255,104,255,100,255,126,255,157,255,209,255,202,255,217,255,239,255,246,255,243,255,247,255,240,255,234,255,239,255,
-243,255,225,255,215,255,217,255,231,255,215,255,208,255,206,255,192,255,199,255,178,255,143,255,149,255,147,255,129,255,144,255,143,255,139,255,118,255,88,255,86,255,22,254,0,82,0,0,
-0,0,40,12,250,140,255,255,248,255,246,255,255,255,248,255,237,255,244,255,255,255,250,255,240,255,229,255,234,255,235,255,225,255,211,255,161,255,117,255,140,255,197,255,192,255,186,255,
-170,255,135,255,117,255,102,255,110,255,164,255,193,255,224,255,192,255,212,255,242,255,227,255,240,255,240,255,247,255,248,255,239,255,239,255,224,255,209,255,216,255,222,255,215,255,202,255,
-192,255,166,255,144,255,150,255,158,255,166,255,164,255,164,255,146,255,170,255,135,255,129,255,96,255,48,255,0,135,0,0,0,0,103,24,255,187,251,255,247,255,244,255,248,255,255,255,
-246,255,250,255,255,255,254,255,246,255,237,255,243,255,235,255,213,255,176,255,128,255,117,255,158,255,191,255,194,255,194,255,157,255,123,255,116,255,108,255,114,255,151,255,176,255,196,255,
-154,255,191,255,230,255,234,255,244,255,244,255,248,255,247,255,235,255,239,255,237,255,217,255,222,255,230,255,221,255,221,255,188,255,136,255,131,255,163,255,166,255,170,255,165,255,171,255,
-166,255,175,255,143,255,134,255,118,255,71,255,0,183,0,0,0,0,156,41,255,222,250,255,254,255,252,255,252,255,254,255,250,255,254,255,255,255,255,255,254,255,252,255,254,255,221,255,
-170,255,140,255,121,255,147,255,187,255,160,255,176,255,217,255,202,255,159,255,154,255,159,255,151,255,138,255,158,255,149,255,165,255,211,255,230,255,234,255,244,255,251,255,243,255,238,255,
-240,255,235,255,230,255,230,255,242,255,224,255,206,255,218,255,184,255,144,255,156,255,161,255,146,255,144,255,140,255,156,255,150,255,147,255,153,255,147,255,137,255,118,255,14,219,0,0,
-0,0,183,59,255,244,255,255,255,255,255,255,254,255,254,255,248,255,244,255,255,255,255,255,254,255,251,255,255,255,207,255,138,255,150,255,135,255,144,255,204,255,192,255,199,255,233,255,
-229,255,187,255,161,255,129,255,151,255,171,255,166,255,143,255,144,255,208,255,240,255,239,255,240,255,251,255,252,255,252,255,240,255,225,255,227,255,216,255,220,255,222,255,208,255,212,255,
-215,255,197,255,177,255,159,255,149,255,142,255,126,255,140,255,164,255,184,255,181,255,146,255,117,255,166,255,51,242,0,0,0,0,197,75,235,254,255,255,255,255,252,255,252,255,255,255,
-251,255,248,255,255,255,255,255,255,255,251,255,247,255,235,255,212,255,202,255,194,255,177,255,204,255,230,255,238,255,238,255,237,255,213,255,171,255,142,255,143,255,172,255,184,255,159,255,
-186,255,224,255,240,255,235,255,227,255,242,255,240,255,255,255,243,255,224,255,224,255,211,255,215,255,218,255,216,255,237,255,237,255,193,255,160,255,160,255,165,255,160,255,137,255,140,255,
-167,255,176,255,199,255,167,255,146,255,191,255,55,254,0,0,0,0,222,89,240,255,248,255,248,255,254,255,251,255,242,255,251,255,252,255,254,255,255,255,255,255,255,255,251,255,242,255,
-244,255,217,255,192,255,220,255,225,255,225,255,247,255,254,255,250,255,234,255,201,255,180,255,186,255,176,255,173,255,204,255,240,255,238,255,244,255,247,255,239,255,231,255,225,255,244,255,
-238,255,209,255,203,255,207,255,218,255,235,255,240,255,233,255,226,255,180,255,146,255,177,255,189,255,170,255,160,255,177,255,181,255,177,255,191,255,186,255,171,255,194,255,118,255,0,0,
-0,0,247,98,251,255,251,255,254,255,254,255,247,255,244,255,252,255,255,255,254,255,254,255,255,255,255,255,250,255,237,255,235,255,211,255,177,255,226,255,254,255,242,255,247,255,254,255,
-246,255,242,255,212,255,187,255,216,255,212,255,225,255,221,255,240,255,243,255,240,255,248,255,251,255,235,255,239,255,240,255,242,255,231,255,230,255,233,255,222,255,233,255,255,255,244,255,
-226,255,192,255,182,255,188,255,193,255,165,255,175,255,188,255,177,255,177,255,176,255,170,255,176,255,204,255,196,255,0,0,0,0,255,100,248,255,247,255,255,255,254,255,243,255,246,255,
-248,255,255,255,255,255,252,255,254,255,252,255,248,255,238,255,211,255,176,255,211,255,252,255,251,255,244,255,250,255,255,255,225,255,217,255,224,255,209,255,227,255,221,255,221,255,212,255,
-231,255,231,255,239,255,239,255,218,255,229,255,231,255,237,255,247,255,247,255,247,255,244,255,247,255,254,255,254,255,247,255,235,255,209,255,201,255,199,255,177,255,161,255,188,255,187,255,
-157,255,130,255,180,255,169,255,188,255,215,255,221,255,0,0,0,0,255,98,250,255,248,255,246,255,254,255,242,255,250,255,251,255,251,255,251,255,243,255,246,255,247,255,244,255,244,255,
-212,255,215,255,243,255,240,255,239,255,237,255,242,255,243,255,247,255,233,255,207,255,220,255,242,255,242,255,238,255,225,255,235,255,230,255,231,255,225,255,230,255,217,255,221,255,243,255,
-254,255,238,255,224,255,226,255,235,255,239,255,220,255,216,255,234,255,234,255,226,255,201,255,165,255,172,255,198,255,196,255,159,255,138,255,181,255,222,255,196,255,196,255,218,255,0,0,
-0,0,255,90,252,255,251,255,251,255,250,255,244,255,248,255,255,255,254,255,250,255,255,255,252,255,250,255,248,255,251,255,254,255,248,255,233,255,229,255,242,255,243,255,239,255,222,255,
-218,255,215,255,217,255,218,255,217,255,222,255,233,255,213,255,221,255,239,255,237,255,231,255,234,255,230,255,238,255,238,255,242,255,243,255,227,255,225,255,221,255,211,255,215,255,220,255,
-239,255,243,255,234,255,192,255,171,255,187,255,197,255,213,255,199,255,186,255,178,255,216,255,186,255,209,255,242,255,0,0,0,0,251,76,255,255,248,255,238,255,242,255,231,255,242,255,
-255,255,252,255,244,255,250,255,244,255,237,255,218,255,229,255,254,255,255,255,243,255,239,255,237,255,215,255,220,255,247,255,217,255,181,255,209,255,217,255,204,255,218,255,235,255,230,255,
-230,255,248,255,234,255,226,255,222,255,239,255,234,255,230,255,225,255,233,255,237,255,233,255,226,255,218,255,216,255,218,255,233,255,240,255,235,255,226,255,218,255,196,255,183,255,188,255,
-197,255,159,255,140,255,215,255,235,255,230,255,250,254,0,0,0,0,193,59,255,245,242,255,225,255,251,255,246,255,244,255,246,255,251,255,246,255,244,255,231,255,221,255,220,255,231,255,
-242,255,244,255,251,255,235,255,203,255,188,255,180,255,238,255,230,255,187,255,225,255,226,255,220,255,234,255,230,255,226,255,231,255,239,255,239,255,229,255,221,255,231,255,246,255,234,255,
-231,255,235,255,224,255,225,255,213,255,212,255,216,255,215,255,226,255,240,255,242,255,221,255,224,255,213,255,184,255,163,255,154,255,152,255,146,255,215,255,246,255,255,255,211,242,0,0,
-0,0,170,42,255,223,247,255,255,255,254,255,247,255,237,255,231,255,254,255,254,255,238,255,197,255,189,255,189,255,161,255,172,255,206,255,208,255,225,255,233,255,182,255,153,255,206,255,
-231,255,231,255,229,255,209,255,220,255,211,255,204,255,226,255,244,255,225,255,237,255,237,255,226,255,217,255,215,255,217,255,218,255,226,255,221,255,222,255,225,255,234,255,227,255,221,255,
-227,255,238,255,242,255,239,255,238,255,224,255,216,255,199,255,181,255,147,255,183,255,251,255,254,255,255,255,120,219,0,0,0,0,131,24,255,188,224,255,240,255,247,255,251,255,239,255,
-227,255,244,255,252,255,227,255,207,255,169,255,128,255,114,255,129,255,193,255,229,255,244,255,202,255,152,255,157,255,176,255,208,255,237,255,207,255,199,255,226,255,215,255,204,255,217,255,
-230,255,229,255,234,255,235,255,227,255,211,255,196,255,203,255,218,255,218,255,221,255,221,255,222,255,231,255,231,255,231,255,231,255,238,255,234,255,240,255,226,255,206,255,233,255,226,255,
-204,255,208,255,238,255,252,255,252,255,255,255,88,184,0,0,0,0,90,12,255,142,227,255,240,255,247,255,255,255,251,255,235,255,237,255,248,255,237,255,222,255,147,255,107,255,117,255,
-146,255,212,255,255,255,246,255,222,255,149,255,157,255,198,255,206,255,194,255,184,255,212,255,221,255,212,255,220,255,221,255,220,255,240,255,238,255,229,255,224,255,212,255,207,255,215,255,
-221,255,215,255,221,255,238,255,251,255,248,255,250,255,246,255,243,255,239,255,235,255,235,255,212,255,211,255,238,255,242,255,208,255,215,255,235,255,247,255,254,255,247,255,17,137,0,0,
-0,0,28,6,247,90,250,255,242,255,254,255,254,255,254,255,252,255,255,255,247,255,215,255,183,255,142,255,118,255,116,255,123,255,164,255,230,255,238,255,240,255,217,255,170,255,170,255,
-197,255,175,255,172,255,224,255,225,255,203,255,218,255,237,255,238,255,240,255,233,255,234,255,224,255,227,255,220,255,216,255,209,255,221,255,222,255,227,255,250,255,250,255,250,255,252,255,
-251,255,239,255,237,255,233,255,222,255,217,255,225,255,239,255,220,255,206,255,244,255,251,255,255,255,209,255,3,84,0,0,0,0,1,2,194,51,255,233,250,255,239,255,251,255,254,255,
-252,255,254,255,255,255,229,255,169,255,142,255,123,255,114,255,107,255,107,255,153,255,224,255,222,255,198,255,220,255,231,255,188,255,134,255,163,255,202,255,234,255,217,255,211,255,230,255,
-247,255,242,255,239,255,242,255,231,255,233,255,217,255,216,255,231,255,233,255,231,255,224,255,240,255,254,255,251,255,255,255,248,255,242,255,242,255,238,255,230,255,233,255,234,255,244,255,
-244,255,247,255,255,255,254,255,255,255,158,231,1,45,0,0,0,0,0,0,112,23,255,168,246,255,235,255,255,255,254,255,255,255,254,255,250,255,224,255,169,255,152,255,142,255,125,255,
-122,255,116,255,120,255,193,255,208,255,177,255,221,255,251,255,233,255,188,255,183,255,187,255,226,255,222,255,206,255,229,255,240,255,242,255,240,255,235,255,215,255,209,255,208,255,221,255,
-234,255,238,255,231,255,235,255,247,255,252,255,244,255,248,255,252,255,248,255,242,255,234,255,230,255,237,255,237,255,248,255,252,255,251,255,254,255,255,255,255,255,86,164,0,19,0,0,
-0,0,0,0,26,8,243,102,255,255,251,255,254,255,254,255,255,255,250,255,238,255,226,255,184,255,161,255,143,255,134,255,140,255,130,255,125,255,186,255,226,255,240,255,243,255,240,255,
-218,255,192,255,189,255,188,255,187,255,181,255,206,255,251,255,255,255,246,255,230,255,222,255,209,255,193,255,198,255,224,255,221,255,225,255,239,255,252,255,254,255,252,255,240,255,244,255,
-254,255,247,255,243,255,229,255,229,255,238,255,242,255,248,255,250,255,243,255,252,255,255,255,234,254,15,96,0,6,0,0,0,0,0,0,0,2,154,46,255,220,255,255,250,255,252,255,
-255,255,250,255,238,255,240,255,203,255,163,255,150,255,130,255,132,255,138,255,138,255,181,255,240,255,251,255,246,255,239,255,201,255,170,255,176,255,160,255,159,255,150,255,189,255,255,255,
-255,255,255,255,239,255,225,255,220,255,201,255,203,255,229,255,234,255,238,255,247,255,252,255,255,255,254,255,251,255,255,255,255,255,243,255,247,255,239,255,230,255,234,255,237,255,246,255,
-250,255,247,255,254,255,255,255,119,215,0,41,0,0,0,0,0,0,0,0,0,0,48,15,255,132,255,255,251,255,252,255,255,255,252,255,251,255,248,255,222,255,171,255,158,255,144,255,
-130,255,139,255,125,255,154,255,230,255,242,255,247,255,254,255,170,255,131,255,163,255,152,255,158,255,146,255,160,255,231,255,255,255,250,255,211,255,217,255,242,255,222,255,222,255,242,255,
-252,255,254,255,247,255,251,255,254,255,254,255,255,255,255,255,255,255,254,255,251,255,242,255,234,255,238,255,233,255,239,255,243,255,252,255,255,255,238,255,22,126,0,14,0,0,0,0,
-0,0,0,0,0,0,6,2,197,57,255,222,251,255,254,255,255,255,254,255,252,255,243,255,227,255,187,255,161,255,156,255,145,255,144,255,134,255,171,255,229,255,235,255,242,255,255,255,
-175,255,102,255,111,255,144,255,161,255,166,255,153,255,186,255,230,255,222,255,188,255,196,255,212,255,213,255,208,255,247,255,255,255,248,255,243,255,250,255,255,255,255,255,255,255,255,255,
-255,255,255,255,250,255,240,255,238,255,248,255,243,255,242,255,244,255,252,255,255,255,143,218,1,51,0,3,0,0,0,0,0,0,0,0,0,0,1,0,73,16,255,126,244,255,255,255,
-255,255,255,255,251,255,239,255,234,255,222,255,201,255,198,255,182,255,166,255,192,255,235,255,252,255,251,255,255,255,234,255,150,255,96,255,109,255,135,255,152,255,166,255,164,255,173,255,
-196,255,193,255,184,255,178,255,172,255,184,255,199,255,237,255,243,255,239,255,243,255,248,255,254,255,255,255,255,255,255,255,255,255,255,255,254,255,248,255,250,255,252,255,248,255,248,255,
-252,255,255,255,240,255,37,121,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,1,186,48,240,205,229,255,252,255,255,255,254,255,243,255,243,255,251,255,251,255,244,255,
-226,255,220,255,244,255,255,255,255,255,255,255,240,255,166,255,104,255,99,255,117,255,125,255,131,255,149,255,158,255,167,255,184,255,188,255,186,255,176,255,173,255,186,255,202,255,198,255,
-208,255,234,255,246,255,251,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,254,255,254,255,255,255,255,255,95,200,0,44,0,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,43,9,244,96,212,240,234,255,255,255,255,255,248,255,234,255,243,255,255,255,255,255,252,255,255,255,255,255,255,255,255,255,242,255,186,255,125,255,
-99,255,119,255,126,255,118,255,118,255,131,255,145,255,156,255,167,255,178,255,192,255,203,255,215,255,194,255,184,255,175,255,202,255,230,255,251,255,254,255,255,255,255,255,255,255,255,255,
-254,255,251,255,252,255,255,255,255,255,255,255,255,255,255,255,255,255,180,238,5,91,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,140,25,250,147,
-222,255,247,255,255,255,252,255,238,255,235,255,252,255,255,255,254,255,252,255,246,255,252,255,237,255,191,255,159,255,142,255,122,255,138,255,129,255,107,255,128,255,123,255,114,255,126,255,
-154,255,153,255,177,255,233,255,250,255,202,255,175,255,188,255,231,255,239,255,251,255,254,255,254,255,255,255,252,255,254,255,251,255,247,255,250,255,254,255,255,255,255,255,255,255,255,255,
-242,255,43,142,0,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,207,49,247,194,243,255,255,255,255,255,252,255,248,255,255,255,252,255,
-244,255,244,255,247,255,233,255,192,255,171,255,198,255,183,255,152,255,144,255,132,255,128,255,145,255,136,255,130,255,132,255,150,255,160,255,194,255,242,255,250,255,207,255,198,255,212,255,
-231,255,250,255,248,255,252,255,254,255,251,255,251,255,252,255,252,255,251,255,252,255,252,255,255,255,255,255,255,255,255,255,128,189,2,45,0,1,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,6,201,73,248,215,251,255,255,255,252,255,231,255,218,255,226,255,242,255,254,255,201,255,173,255,198,255,191,255,216,255,203,255,
-157,255,131,255,144,255,165,255,152,255,145,255,147,255,146,255,159,255,170,255,202,255,237,255,230,255,233,255,226,255,213,255,225,255,242,255,252,255,254,255,254,255,251,255,252,255,254,255,
-252,255,251,255,254,255,252,255,252,255,255,255,255,255,153,213,17,69,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-80,9,221,93,206,223,216,255,251,255,231,255,188,255,175,255,180,255,209,255,149,255,127,255,206,255,201,255,187,255,193,255,181,255,137,255,142,255,160,255,145,255,145,255,146,255,164,255,
-186,255,164,255,203,255,235,255,226,255,216,255,227,255,233,255,246,255,250,255,255,255,254,255,254,255,250,255,251,255,254,255,252,255,252,255,252,255,248,255,251,255,255,255,175,220,21,90,
-0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,60,12,166,96,170,224,182,255,243,255,233,255,171,255,
-143,255,139,255,119,255,109,255,143,255,159,255,156,255,164,255,187,255,196,255,161,255,144,255,161,255,189,255,163,255,176,255,224,255,218,255,229,255,242,255,248,255,233,255,237,255,222,255,
-215,255,230,255,251,255,247,255,252,255,252,255,250,255,248,255,251,255,252,255,243,255,248,255,255,255,166,221,25,92,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,57,12,164,94,175,215,167,255,193,255,201,255,178,255,142,255,115,255,108,255,116,255,121,255,136,255,135,255,
-138,255,182,255,206,255,191,255,211,255,208,255,198,255,212,255,248,255,255,255,252,255,251,255,250,255,242,255,207,255,216,255,234,255,238,255,250,255,250,255,251,255,251,255,250,255,244,255,
-248,255,251,255,255,255,255,255,175,212,26,90,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,0,37,10,143,74,176,192,136,255,154,255,158,255,129,255,111,255,105,255,108,255,108,255,129,255,145,255,119,255,149,255,224,255,238,255,233,255,227,255,233,255,250,255,
-251,255,246,255,209,255,225,255,212,255,186,255,172,255,222,255,255,255,248,255,254,255,254,255,252,255,247,255,246,255,242,255,244,255,255,255,248,255,119,189,18,71,0,9,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,6,134,49,177,146,150,246,
-132,255,127,255,131,255,115,255,100,255,102,255,110,255,134,255,152,255,209,255,250,255,250,255,240,255,242,255,254,255,255,255,243,255,197,255,177,255,182,255,186,255,178,255,184,255,225,255,
-248,255,248,255,254,255,255,255,254,255,251,255,247,255,246,255,255,255,255,245,120,143,7,48,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,1,83,25,166,97,153,202,123,255,117,255,122,255,116,255,112,255,114,255,118,255,
-157,255,203,255,235,255,251,255,247,255,244,255,255,255,254,255,218,255,194,255,203,255,183,255,184,255,194,255,233,255,247,255,250,255,251,255,255,255,254,255,250,255,250,255,255,255,255,255,
-233,199,72,95,6,25,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,3,0,27,10,107,48,181,126,142,221,104,255,107,255,109,255,109,255,114,255,128,255,134,255,152,255,158,255,204,255,235,255,226,255,225,255,
-221,255,243,255,244,255,227,255,227,255,242,255,254,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,218,137,124,31,46,2,9,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-6,1,48,15,145,56,184,131,145,219,112,255,116,255,120,255,122,255,129,255,140,255,166,255,182,255,194,255,183,255,218,255,243,255,251,255,255,255,254,255,254,255,255,255,255,255,255,255,
-254,255,252,255,255,255,255,255,251,217,136,130,42,56,7,15,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,5,2,38,15,107,46,173,102,209,169,186,233,
-164,255,160,255,160,255,230,255,250,255,234,255,234,255,250,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,231,246,168,120,100,20,44,3,16,0,3,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,12,8,99,23,167,50,218,89,255,142,255,187,255,222,255,244,255,255,255,255,255,255,
-255,255,255,255,255,255,255,255,255,243,255,221,254,187,215,140,158,89,89,49,17,23,2,8,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,3,6,60,13,105,25,163,42,183,59,189,75,208,90,237,98,248,101,201,98,172,89,177,75,128,59,95,40,31,25,1,12,
-1,6,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+static const uint8_t moonmap_packed[] = {
+66,90,104,57,49,65,89,38,83,89,1,23,84,134,0,0,35,127,255,255,255,255,253,251,
+127,255,252,255,255,255,255,255,255,223,255,253,255,251,247,255,254,247,254,247,255,254,255,255,
+251,223,221,224,11,59,236,138,5,0,0,8,57,208,20,20,5,10,129,234,3,208,138,100,
+211,84,120,167,130,6,164,122,104,19,212,104,0,0,211,209,52,0,0,208,0,211,53,52,
+211,64,0,25,1,160,26,50,104,0,26,13,15,68,26,104,13,26,50,26,15,73,147,194,
+128,27,68,0,0,25,84,255,8,192,26,35,8,193,26,100,158,76,130,96,16,52,50,2,
+106,109,79,64,38,32,0,0,0,0,0,0,0,0,49,12,128,52,0,122,131,64,208,109,
+76,131,16,26,26,0,10,167,166,77,52,167,141,3,73,233,164,209,147,73,141,83,211,36,
+244,147,106,50,105,160,61,168,129,166,77,0,208,1,136,98,104,6,134,128,208,0,200,200,
+201,166,64,1,160,0,52,105,160,1,160,208,12,77,13,13,0,52,196,85,63,193,8,208,
+76,138,105,180,213,61,76,71,161,52,192,19,32,52,49,52,96,70,140,17,132,100,194,12,
+67,77,13,12,16,49,0,209,161,161,147,70,0,64,3,2,98,98,104,105,137,132,209,163,
+64,209,130,104,25,0,0,104,104,0,208,0,0,6,131,64,0,26,0,0,0,0,208,6,
+128,0,104,0,0,208,0,0,0,6,76,141,0,0,0,0,52,0,2,68,137,53,26,106,
+121,10,109,38,132,204,6,132,100,26,122,38,68,253,77,168,201,61,79,20,122,105,160,212,
+122,122,36,216,130,121,166,80,202,105,154,153,169,144,242,17,250,161,232,17,234,121,76,154,
+96,104,16,25,161,25,148,12,67,38,106,102,70,128,6,80,108,160,249,92,13,22,87,203,
+209,124,254,102,221,77,194,129,255,232,1,154,13,72,251,65,137,234,79,225,12,5,4,41,
+154,179,10,196,2,18,155,97,160,37,5,58,245,10,39,5,106,238,41,15,2,80,2,3,
+41,117,149,194,88,200,227,49,181,236,215,43,133,182,36,28,182,62,51,185,252,36,152,229,
+165,99,225,218,20,2,79,40,138,242,132,145,41,146,142,96,206,102,118,183,83,171,136,98,
+7,77,8,202,8,174,76,49,12,157,75,114,121,12,178,8,192,92,79,26,140,30,138,47,
+185,178,169,206,70,22,183,179,189,144,35,33,63,157,72,211,24,136,225,61,237,12,8,39,
+18,22,191,51,225,124,188,80,88,120,58,76,156,243,118,248,232,196,102,40,150,115,63,192,
+150,58,136,247,59,9,41,91,198,130,68,49,244,16,28,131,15,161,160,162,71,236,102,245,
+146,26,64,168,105,92,188,148,193,107,46,239,238,47,110,117,248,226,200,207,60,255,67,239,
+211,195,228,185,199,108,116,172,140,231,41,33,10,208,48,250,143,173,107,208,85,232,249,123,
+35,9,231,198,141,220,217,150,245,210,153,206,105,34,174,78,132,142,127,216,161,23,159,37,
+9,18,0,68,81,178,163,208,166,48,199,196,141,105,108,82,11,194,24,241,26,43,25,16,
+0,103,164,114,112,44,80,41,133,16,156,229,201,175,146,24,5,67,47,127,37,32,214,66,
+139,121,213,37,94,234,166,145,173,29,9,98,181,85,54,245,17,64,205,94,123,168,200,107,
+10,2,49,52,200,216,90,99,117,185,250,2,167,31,4,13,53,130,249,55,155,100,197,178,
+138,248,51,54,147,35,103,223,215,201,209,190,238,52,247,126,29,90,152,189,246,190,87,116,
+64,198,204,105,129,4,155,212,194,32,101,147,56,137,6,98,73,64,252,152,219,233,166,183,
+51,50,216,105,146,86,143,144,109,214,106,102,206,48,251,105,173,199,222,131,253,113,244,213,
+173,201,89,223,217,6,191,199,246,116,53,75,125,213,42,180,200,55,121,136,23,117,61,95,
+237,153,35,235,199,233,214,64,247,116,23,19,134,21,152,160,107,40,227,71,145,143,157,52,
+127,151,47,90,13,3,63,191,29,107,37,194,101,47,8,205,118,26,20,201,198,106,80,178,
+14,9,236,164,45,92,226,170,124,117,217,131,179,56,225,133,163,23,3,246,144,54,40,242,
+177,195,3,47,98,218,170,94,68,251,66,238,142,171,186,16,0,211,108,54,41,163,150,20,
+184,149,251,71,179,193,245,36,46,198,180,35,11,174,128,181,232,97,33,88,102,209,128,138,
+88,153,180,249,100,29,43,18,174,202,62,214,66,36,131,242,70,242,66,232,218,54,248,200,
+72,63,147,17,83,99,9,105,223,5,163,151,104,84,13,46,181,163,219,188,159,37,48,33,
+130,108,78,214,4,112,177,247,157,164,210,49,156,92,9,124,45,11,17,169,132,28,195,5,
+85,137,31,213,130,88,53,160,12,99,65,97,130,53,23,80,9,24,13,10,102,90,4,119,
+122,88,15,248,208,80,89,192,137,212,132,44,150,198,16,97,217,79,25,7,110,192,150,214,
+16,46,121,129,217,52,173,247,16,146,253,76,3,231,245,112,2,184,98,176,203,134,37,179,
+105,47,146,185,164,114,72,220,70,198,72,8,43,239,100,132,108,24,8,210,247,250,124,236,
+210,55,172,70,249,136,42,176,12,78,114,18,9,48,67,147,128,10,204,65,139,98,70,183,
+43,251,239,102,129,103,189,120,66,75,133,231,66,18,180,104,11,198,151,48,196,165,185,128,
+20,100,160,5,237,100,97,36,166,85,242,61,217,136,92,77,22,217,127,122,174,138,145,37,
+80,105,37,191,195,220,73,9,77,116,255,139,45,48,65,121,181,192,145,77,106,242,16,180,
+156,143,143,219,221,208,36,22,77,0,111,30,253,246,12,18,248,88,8,40,98,95,19,69,
+155,9,12,17,191,104,17,210,119,144,132,27,14,34,0,65,144,199,192,128,239,29,158,182,
+16,131,227,96,133,174,105,37,153,193,137,48,3,52,192,209,120,54,100,180,195,22,165,164,
+34,87,80,119,108,74,249,171,118,147,104,62,203,213,98,161,123,77,9,23,174,171,247,60,
+24,74,249,128,174,168,208,200,18,57,55,207,109,161,22,24,150,217,128,96,52,139,172,204,
+37,67,57,167,110,195,20,192,170,193,31,97,160,175,186,178,144,177,45,54,33,221,194,2,
+150,128,165,129,122,210,69,70,149,155,71,253,104,176,237,24,20,52,144,222,159,249,245,19,
+249,111,106,9,29,123,74,213,162,230,164,36,54,73,134,133,165,124,196,184,45,35,125,250,
+240,45,60,155,99,40,248,205,68,10,179,23,137,98,10,196,90,200,27,95,193,138,217,210,
+198,199,68,4,12,49,21,32,38,49,56,112,219,165,11,5,148,197,20,80,219,225,177,240,
+73,211,218,101,53,165,17,125,66,89,159,153,82,65,125,127,113,91,148,180,194,154,194,228,
+121,22,24,98,24,243,232,250,112,101,90,218,62,162,135,20,82,32,131,118,19,103,54,98,
+143,134,88,107,171,158,111,50,165,6,11,27,118,164,229,170,237,175,24,240,96,33,81,194,
+32,70,245,78,93,178,198,104,241,53,105,174,129,240,166,169,48,180,204,227,132,90,18,173,
+146,182,110,174,139,12,180,114,20,52,185,164,104,147,172,161,90,94,154,171,134,138,186,3,
+211,168,172,167,122,58,93,140,224,117,221,53,143,166,121,110,242,109,36,223,44,134,218,157,
+188,56,189,143,252,239,199,170,173,2,231,210,184,231,84,192,170,188,149,66,149,222,139,83,
+86,211,208,69,175,68,249,132,91,70,164,252,130,129,12,72,199,118,10,233,226,142,2,151,
+119,70,251,126,55,244,25,215,251,149,223,18,29,56,129,188,89,159,90,202,216,181,241,113,
+113,14,5,54,160,213,73,38,13,132,139,164,226,105,56,14,231,209,105,1,22,139,38,56,
+72,95,91,225,71,179,178,90,51,189,187,63,40,4,73,115,219,216,84,221,144,126,188,106,
+178,66,52,61,154,3,70,188,148,202,63,144,99,254,123,194,245,210,134,138,83,199,198,63,
+167,126,13,137,50,104,182,74,17,182,126,123,174,236,74,29,227,101,249,1,210,130,49,114,
+153,47,244,124,146,166,91,207,215,179,47,23,112,36,247,252,178,41,147,92,23,122,24,177,
+191,196,223,80,192,132,237,230,129,167,0,135,81,144,253,176,215,203,228,162,86,181,140,23,
+63,127,129,139,249,207,123,3,238,58,27,76,238,58,176,77,184,5,207,106,57,179,27,74,
+184,58,215,62,177,74,86,154,63,177,91,59,122,36,116,112,84,142,78,78,142,172,104,94,
+21,21,242,178,86,39,227,205,60,215,21,30,166,213,250,238,30,2,181,212,77,157,28,125,
+180,239,85,135,204,243,9,154,22,120,133,23,203,223,56,11,87,254,29,6,2,57,66,242,
+182,91,171,12,7,13,241,107,140,32,38,93,205,180,61,123,20,46,182,250,21,65,8,146,
+200,192,38,146,57,249,75,25,131,73,93,20,27,26,52,239,169,190,217,52,25,83,81,178,
+244,63,122,76,161,30,174,96,152,140,215,220,164,66,243,216,175,160,25,182,135,84,182,126,
+203,239,154,82,16,218,202,197,197,160,189,203,205,54,234,108,125,161,238,89,220,172,49,254,
+246,144,116,36,91,21,74,27,162,164,139,5,194,153,174,40,127,193,55,234,37,111,11,2,
+16,236,42,150,155,19,88,157,20,232,138,117,205,163,151,181,169,247,117,182,240,167,0,34,
+38,202,218,59,182,134,194,120,117,204,151,167,215,247,219,251,134,255,122,7,23,166,208,118,
+243,30,84,22,160,250,93,22,242,230,219,224,111,81,157,138,19,200,7,126,215,213,141,192,
+105,200,158,78,62,12,145,163,207,76,74,97,72,117,21,240,99,240,199,131,41,180,17,93,
+157,230,41,33,24,203,19,176,139,137,123,120,88,184,108,63,72,138,212,197,146,227,95,123,
+57,75,12,52,131,226,12,226,255,114,132,86,78,14,58,34,85,129,82,14,232,123,11,240,
+56,89,161,94,175,36,176,101,99,214,96,233,208,202,55,19,106,98,153,138,2,132,214,143,
+211,93,205,110,132,49,91,153,86,165,224,43,151,28,155,30,21,178,152,210,104,16,93,137,
+19,240,210,117,141,238,247,23,87,193,88,218,29,47,32,129,100,7,68,36,84,25,242,147,
+213,127,141,29,247,110,21,13,197,44,15,93,202,25,21,177,155,203,33,251,38,142,69,147,
+95,181,88,154,165,235,46,195,247,151,157,47,15,14,247,74,175,16,190,54,4,124,28,5,
+75,158,62,66,183,200,93,186,157,53,85,12,214,8,167,197,91,41,238,118,181,170,228,164,
+155,20,167,221,25,128,197,69,12,60,182,144,198,106,108,210,90,108,136,113,3,166,203,46,
+180,83,119,177,84,22,238,98,82,108,143,233,234,88,199,93,233,96,152,7,220,118,1,22,
+181,146,81,216,107,42,161,108,74,70,97,210,178,20,136,153,19,136,193,205,12,34,94,224,
+183,151,71,111,15,113,196,54,251,216,252,88,34,185,20,4,184,16,101,171,20,239,186,103,
+177,219,107,255,166,173,202,207,239,162,151,32,218,75,131,93,24,205,45,57,58,218,36,237,
+164,149,40,182,4,97,101,201,85,15,244,162,176,168,141,64,46,22,130,164,37,101,164,96,
+105,183,170,221,172,124,17,45,170,174,10,9,25,206,97,50,140,91,85,42,207,48,130,3,
+6,22,106,181,108,106,243,171,179,38,176,165,160,73,250,135,239,227,228,195,120,145,18,243,
+145,50,109,128,26,121,17,40,53,50,6,97,144,182,57,181,2,163,119,8,229,224,144,123,
+122,81,41,179,248,137,21,215,248,72,212,64,139,18,145,199,151,104,70,239,36,144,12,52,
+32,79,91,81,247,35,189,156,148,229,130,58,112,205,169,90,101,199,164,33,2,151,78,52,
+49,83,185,132,80,187,245,84,99,78,87,12,51,111,130,92,90,245,82,74,37,113,5,176,
+253,40,164,209,207,120,103,214,39,78,114,66,185,57,176,208,57,38,131,147,137,8,211,15,
+6,97,136,181,157,40,97,204,34,138,207,134,100,193,243,22,58,51,162,169,78,105,236,46,
+180,40,73,38,46,68,184,100,82,136,11,75,56,160,30,88,39,35,130,115,175,75,149,130,
+75,8,78,105,117,172,18,190,138,60,91,224,76,165,17,52,68,65,180,109,40,72,99,44,
+45,41,107,12,219,43,42,101,109,198,194,144,19,58,48,78,187,104,118,142,100,59,18,109,
+182,209,20,88,66,244,248,85,49,85,109,150,86,128,118,198,117,238,83,9,96,170,226,197,
+221,214,171,104,176,189,114,115,226,160,19,185,123,127,221,231,250,196,238,32,35,145,148,148,
+32,208,48,91,169,134,180,149,130,101,33,3,138,107,149,114,252,171,139,101,85,140,112,102,
+0,53,27,4,34,89,135,46,20,45,129,213,74,107,142,196,158,9,225,20,205,147,34,54,
+125,168,170,81,4,178,36,72,118,89,200,81,97,89,146,40,159,28,209,13,28,164,174,203,
+154,89,76,10,0,240,35,172,240,98,12,64,165,146,194,101,196,74,244,162,132,106,225,55,
+245,15,111,254,64,212,13,108,3,151,34,51,64,161,26,34,166,175,50,83,131,179,40,98,
+34,199,32,0,101,124,13,76,46,30,61,0,203,36,184,139,27,16,244,202,170,60,213,130,
+58,40,81,145,130,51,190,93,94,176,114,231,79,27,50,194,55,25,62,253,127,248,157,233,
+224,178,134,96,29,251,209,70,48,93,86,120,210,106,203,94,154,37,238,82,101,192,105,146,
+119,126,204,47,47,136,18,71,206,92,181,160,146,32,179,164,84,182,195,102,20,76,64,16,
+210,132,31,19,85,82,128,209,169,129,25,26,243,184,165,155,47,24,115,77,69,48,179,100,
+12,209,88,74,165,45,54,80,99,156,149,169,106,7,2,139,47,22,113,59,116,98,4,176,
+219,75,118,128,101,8,138,38,41,175,13,251,135,101,152,8,102,192,27,41,74,224,168,170,
+225,29,56,215,52,112,34,69,213,177,27,116,147,81,239,210,250,244,5,13,86,134,195,247,
+196,111,135,88,135,111,30,23,43,83,164,128,24,39,87,24,253,149,171,58,200,67,4,145,
+93,113,163,211,133,215,71,92,36,148,11,14,114,0,173,13,180,178,3,132,131,27,179,175,
+53,181,18,185,165,132,10,187,73,130,178,101,136,38,99,27,173,226,151,102,40,236,38,153,
+5,11,200,49,111,173,98,48,172,143,147,26,211,234,177,74,73,64,38,9,81,15,168,208,
+6,148,149,244,172,68,74,196,135,121,241,133,234,229,95,4,68,154,99,174,235,178,182,105,
+128,138,144,195,150,29,24,29,34,235,170,214,8,97,61,146,120,78,24,98,149,212,237,48,
+44,54,90,150,135,196,218,201,229,138,91,11,41,210,230,235,41,80,1,116,181,202,65,2,
+153,17,197,65,215,99,17,92,132,70,26,144,235,101,145,70,87,161,98,84,194,21,85,81,
+134,31,140,128,88,97,49,80,115,192,245,64,180,98,190,18,189,35,107,205,22,66,177,37,
+55,192,99,24,156,181,111,66,101,67,173,162,7,82,91,5,158,10,218,43,73,241,62,121,
+86,97,152,167,57,133,210,147,217,37,8,163,114,56,24,208,116,73,32,24,209,5,103,58,
+82,62,133,41,33,144,16,170,162,96,177,98,56,20,14,7,133,59,42,178,186,140,16,185,
+231,34,82,141,36,4,72,74,64,89,170,115,252,227,96,134,24,224,125,88,182,96,85,88,
+236,53,174,10,182,209,140,161,2,25,158,130,217,34,98,164,238,38,53,106,53,133,66,250,
+177,186,9,146,200,111,145,135,59,98,33,114,4,102,113,18,85,54,5,4,51,180,152,34,
+172,238,71,18,132,226,67,50,185,211,49,21,134,113,200,13,5,140,21,149,241,71,2,180,
+88,176,196,138,250,250,10,9,1,56,12,140,155,1,34,136,18,20,98,64,116,140,196,12,
+129,146,8,31,52,142,70,27,153,26,130,136,176,137,137,43,1,26,192,48,129,164,4,115,
+166,162,66,92,6,131,106,205,23,223,132,117,151,48,119,93,142,206,66,94,235,73,34,214,
+212,110,189,139,12,195,88,39,99,86,153,1,168,215,157,157,139,10,5,56,86,178,209,90,
+246,181,73,132,233,36,83,107,77,138,40,214,18,136,168,162,200,246,85,42,177,197,102,85,
+174,132,88,131,134,16,36,16,81,17,1,114,25,59,152,46,228,138,112,161,32,2,46,169,
+12
 };
 
-
-
-#endif
+static rsAsset moonmap(moonmap_packed, 3649, 8192);
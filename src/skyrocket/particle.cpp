@@ -1109,20 +1109,16 @@ void CParticle::findDepth()
 //******************************************
 //  Update particles
 //******************************************
-void CParticle::update()
+void CParticle::accelerate()
 {
-  int i;
-  float temp;
-  rsVec dir, crossvec;
-  rsQuat spinquat;
-  rsMatrix spinmat;
-  CParticle *newp;
-  rsVec rocketEjection;
   float frameTime = m_base->FrameTime();
 
   // update velocities
   if (type == ROCKET && life > endthrust)
   {
+    rsVec dir, crossvec;
+    rsQuat spinquat;
+    rsMatrix spinmat;
     dir = vel;
     dir.normalize();
     crossvec.cross(dir, tiltvec);  // correct sidevec
@@ -1140,23 +1136,42 @@ void CParticle::update()
     vel[1] += 500.0f * (cosf(tiltvec[1]) - 0.2f) * frameTime;
     vel[2] += 500.0f * cosf(tiltvec[2]) * frameTime;
   }
-  if (type != SMOKE)
-    vel[1] -= frameTime * 32.0f;  // gravity
-  // apply air resistance
-  temp = 1.0f / (1.0f + drag * frameTime);
-  vel *= temp * temp;
-
-  // update position
-  // (Fountains don't move)
+}
+
+void CParticle::storeMotion(CParticleMotion& motion, unsigned int i) const
+{
+  motion.m_x[i] = xyz[0];
+  motion.m_y[i] = xyz[1];
+  motion.m_z[i] = xyz[2];
+  motion.m_vx[i] = vel[0];
+  motion.m_vy[i] = vel[1];
+  motion.m_vz[i] = vel[2];
+  motion.m_drag[i] = drag;
+  motion.m_gravity[i] = type == SMOKE ? 0.0f : 32.0f;
+}
+
+void CParticle::loadMotion(const CParticleMotion& motion, unsigned int i)
+{
+  vel.set(motion.m_vx[i], motion.m_vy[i], motion.m_vz[i]);
+
+  // Fountains don't move
   if (type != FOUNTAIN)
   {
     lastxyz = xyz;
-    xyz += vel * frameTime;
-    // Wind:  1/10 wind on ground; -1/2 wind at 500 feet; full wind at 2000 feet;
-    // This value is calculated to coincide with movement of the clouds in world.h
-    // Here's the polynomial wind equation that simulates windshear:
-    xyz[0] += (0.1f - 0.00175f * xyz[1] + 0.0000011f * xyz[1] * xyz[1]) * m_base->Settings().dWind * frameTime;
+    xyz.set(motion.m_x[i], motion.m_y[i], motion.m_z[i]);
   }
+}
+
+void CParticle::update()
+{
+  int i;
+  float temp;
+  rsVec dir, crossvec;
+  rsQuat spinquat;
+  rsMatrix spinmat;
+  CParticle *newp;
+  rsVec rocketEjection;
+  float frameTime = m_base->FrameTime();
 
   // brightness and life
   tr -= frameTime;
@@ -1454,22 +1469,6 @@ void CParticle::update()
     sparkTrailLength -= float(sparks) * 10.0f;
   }
 
-  // smoke and cloud illumination from rockets and explosions
-  if (m_base->Settings().dIllumination && ((type == ROCKET) || (type == FOUNTAIN) || (type == EXPLOSION)))
-     m_base->Illuminate(this);
-
-  // pulling of particles by suckers
-  if (type == SUCKER)
-     m_base->Pulling(this);
-
-  // pushing of particles by shockwaves
-  if (type == SHOCKWAVE)
-     m_base->Pushing(this);
-
-  // stretching of particles by stretchers
-  if (type == STRETCHER)
-     m_base->Stretching(this);
-
   // thrust sound from rockets
   //if ((type == ROCKET) && dSound)
   //  insertSoundNode(THRUSTSOUND, xyz, m_base->CameraPos());
@@ -1489,55 +1488,32 @@ void CParticle::draw()
   if (type == POPPER)
     return;
 
-  glm::mat4& billboardMat = m_base->BillboardMatrix();
-  glm::mat4& modelMat = m_base->ModelMatrix();
-  glm::mat4 modelMatOld = modelMat;
-  modelMat = glm::translate(modelMat, glm::vec3(xyz[0], xyz[1], xyz[2]));
-
   switch(type)
   {
   case SHOCKWAVE:
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
-    modelMat = glm::scale(modelMat, glm::vec3(size, size, size));
-    m_base->Shockwave().Draw(life, float(sqrt(size)) * 0.05f);
-
-    modelMat = modelMatOld;
-    modelMat *= billboardMat;
-    modelMat = glm::scale(modelMat, glm::vec3(size * 0.1f, size * 0.1f, size * 0.1f));
-    m_base->Flare().Draw(FLARE_BASIC_SPHERE, sColor(0.5f, 1.0f, 0.5f, bright));
-
-    modelMat = glm::scale(modelMat, glm::vec3(0.35f, 0.35f, 0.35f));
-    m_base->Flare().Draw(FLARE_BASIC_SPHERE, sColor(1.0f, 1.0f, 1.0f, bright));
-
-    if (life > 0.7f)  // Big torus just for fun
     {
-      //modelMat *= billboardMat;
-      modelMat = glm::scale(modelMat, glm::vec3(100.0f, 100.0f, 100.0f));
-      m_base->Flare().Draw(FLARE_TORUS, sColor(1.0f, life, 1.0f, (life - 0.7f) * 3.333f));
+      glm::mat4& modelMat = m_base->ModelMatrix();
+      glm::mat4 modelMatOld = modelMat;
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+      modelMat = glm::translate(modelMat, glm::vec3(xyz[0], xyz[1], xyz[2]));
+      modelMat = glm::scale(modelMat, glm::vec3(size, size, size));
+      m_base->Shockwave().Draw(life, float(sqrt(size)) * 0.05f);
+      modelMat = modelMatOld;
     }
+
+    m_base->Flare().Add(FLARE_BASIC_SPHERE, xyz.v, size * 0.1f, sColor(0.5f, 1.0f, 0.5f, bright));
+    m_base->Flare().Add(FLARE_BASIC_SPHERE, xyz.v, size * 0.035f, sColor(1.0f, 1.0f, 1.0f, bright));
+    if (life > 0.7f)  // Big torus just for fun
+      m_base->Flare().Add(FLARE_TORUS, xyz.v, size * 3.5f, sColor(1.0f, life, 1.0f, (life - 0.7f) * 3.333f));
     break;
   case SMOKE:
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    modelMat *= billboardMat;
-    modelMat = glm::scale(modelMat, glm::vec3(size, size, size));
-    m_base->Smoke().Draw(m_displayList, sColor(rgb[0], rgb[1], rgb[2], bright));
+    m_base->Smoke().Add(m_displayList, xyz.v, size, sColor(rgb[0], rgb[1], rgb[2], bright));
     break;
   case EXPLOSION:
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
-    modelMat *= billboardMat;
-    modelMat = glm::scale(modelMat, glm::vec3(size, size, size));
-    modelMat = glm::scale(modelMat, glm::vec3(bright, bright, bright));
-    m_base->Flare().Draw(m_displayList, sColor(1.0f, 1.0f, 1.0f, bright));
+    m_base->Flare().Add(m_displayList, xyz.v, size * bright, sColor(1.0f, 1.0f, 1.0f, bright));
     break;
   default:
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
-    modelMat *= billboardMat;
-    modelMat = glm::scale(modelMat, glm::vec3(size, size, size));
-    m_base->Flare().Draw(m_displayList, sColor(rgb[0], rgb[1], rgb[2], bright));
-
-    modelMat = glm::scale(modelMat, glm::vec3(0.35f, 0.35f, 0.35f));
-    m_base->Flare().Draw(m_displayList, sColor(1.0f, 1.0f, 1.0f, bright));
+    m_base->Flare().Add(m_displayList, xyz.v, size, sColor(rgb[0], rgb[1], rgb[2], bright));
+    m_base->Flare().Add(m_displayList, xyz.v, size * 0.35f, sColor(1.0f, 1.0f, 1.0f, bright));
   }
-
-  modelMat = modelMatOld;
 }
@@ -22,6 +22,7 @@
 #include <rsMath/rsMath.h>
 
 #include "flare.h"
+#include "particleMotion.h"
 #include "smoke.h"
 #include "shockwave.h"
 #include "soundEngine.h"
@@ -98,7 +99,15 @@ public:
   // Can be used for sorting and culling.
   void findDepth();
 
-  // Update a particle according to frameTime
+  // Steering of rockets (thrust and tilt) and bees, applied before the
+  // motion shared by all particles
+  void accelerate();
+
+  // Copy position and velocity to and from slot i of a motion batch
+  void storeMotion(CParticleMotion& motion, unsigned int i) const;
+  void loadMotion(const CParticleMotion& motion, unsigned int i);
+
+  // Update a particle according to frameTime once it has been moved
   void update();
 
   // Draw a particle
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "particleGrid.h"
+
+void CParticleGrid::Clear()
+{
+  m_added.clear();
+  m_addedX.clear();
+  m_addedY.clear();
+  m_addedZ.clear();
+  m_index.clear();
+}
+
+void CParticleGrid::Add(unsigned int index, const float* pos)
+{
+  m_added.push_back(index);
+  m_addedX.push_back(Cell(pos[0]));
+  m_addedY.push_back(Cell(pos[1]));
+  m_addedZ.push_back(Cell(pos[2]));
+}
+
+void CParticleGrid::Build()
+{
+  const unsigned int count(m_added.size());
+
+  // about one bucket per particle
+  unsigned int buckets = 64;
+  while (buckets < count)
+    buckets <<= 1;
+  m_mask = buckets - 1;
+
+  // count the particles in each bucket, then turn the counts into offsets
+  m_start.assign(buckets + 1, 0);
+  for (unsigned int i = 0; i < count; ++i)
+    ++m_start[Hash(m_addedX[i], m_addedY[i], m_addedZ[i]) + 1];
+  for (unsigned int b = 0; b < buckets; ++b)
+    m_start[b + 1] += m_start[b];
+
+  m_index.resize(count);
+  m_cellX.resize(count);
+  m_cellY.resize(count);
+  m_cellZ.resize(count);
+  m_fill.assign(m_start.begin(), m_start.end() - 1);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    const unsigned int slot(m_fill[Hash(m_addedX[i], m_addedY[i], m_addedZ[i])]++);
+    m_index[slot] = m_added[i];
+    m_cellX[slot] = m_addedX[i];
+    m_cellY[slot] = m_addedY[i];
+    m_cellZ[slot] = m_addedZ[i];
+  }
+}
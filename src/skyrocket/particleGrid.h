@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include <kodi/AddonBase.h>
+
+#include <math.h>
+#include <vector>
+
+// Uniform grid over particle positions, rebuilt every frame, so that effects
+// with a limited reach (illumination, pulling, pushing) only visit the
+// particles in the cells around them instead of every particle.  Cells are
+// hashed into a table sized for the number of particles, which keeps the
+// grid unbounded while the storage only depends on how many were added.
+class ATTR_DLL_LOCAL CParticleGrid
+{
+public:
+  explicit CParticleGrid(float cellSize) : m_invCellSize(1.0f / cellSize) { }
+
+  void Clear();
+  void Add(unsigned int index, const float* pos);
+  void Build();
+  bool Empty() const { return m_index.empty(); }
+
+  // Call func(index) for each particle added within the cells that a sphere
+  // of the given radius overlaps.  Callers still test the actual distance.
+  template<class F>
+  void ForEachNear(const float* center, float radius, F func) const
+  {
+    if (m_index.empty())
+      return;
+
+    const int x0(Cell(center[0] - radius)), x1(Cell(center[0] + radius));
+    const int y0(Cell(center[1] - radius)), y1(Cell(center[1] + radius));
+    const int z0(Cell(center[2] - radius)), z1(Cell(center[2] + radius));
+    for (int x = x0; x <= x1; ++x)
+    {
+      for (int y = y0; y <= y1; ++y)
+      {
+        for (int z = z0; z <= z1; ++z)
+        {
+          const unsigned int bucket(Hash(x, y, z));
+          for (unsigned int i = m_start[bucket]; i < m_start[bucket + 1]; ++i)
+          {
+            // several cells can share a bucket, so skip the other cells' particles
+            if (m_cellX[i] == x && m_cellY[i] == y && m_cellZ[i] == z)
+              func(m_index[i]);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  int Cell(float v) const { return int(floorf(v * m_invCellSize)); }
+  unsigned int Hash(int x, int y, int z) const
+  {
+    return (unsigned(x) * 73856093u ^ unsigned(y) * 19349663u ^ unsigned(z) * 83492791u) & m_mask;
+  }
+
+  float m_invCellSize;
+  unsigned int m_mask = 0;
+
+  // particles as added
+  std::vector<unsigned int> m_added;
+  std::vector<int> m_addedX, m_addedY, m_addedZ;
+
+  // particles sorted by bucket
+  std::vector<unsigned int> m_start;
+  std::vector<unsigned int> m_fill;
+  std::vector<unsigned int> m_index;
+  std::vector<int> m_cellX, m_cellY, m_cellZ;
+};
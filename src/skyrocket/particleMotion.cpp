@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "particleMotion.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+void CParticleMotion::Resize(unsigned int size)
+{
+  m_x.resize(size);
+  m_y.resize(size);
+  m_z.resize(size);
+  m_vx.resize(size);
+  m_vy.resize(size);
+  m_vz.resize(size);
+  m_drag.resize(size);
+  m_gravity.resize(size);
+}
+
+void CParticleMotion::Integrate(unsigned int count, float frameTime, float wind)
+{
+  float* x = m_x.data();
+  float* y = m_y.data();
+  float* z = m_z.data();
+  float* vx = m_vx.data();
+  float* vy = m_vy.data();
+  float* vz = m_vz.data();
+  const float* drag = m_drag.data();
+  const float* gravity = m_gravity.data();
+
+  const float windFrameTime = wind * frameTime;
+  unsigned int i = 0;
+
+#if defined(__SSE2__)
+  const __m128 ft = _mm_set1_ps(frameTime);
+  const __m128 windft = _mm_set1_ps(windFrameTime);
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 shear0 = _mm_set1_ps(0.1f);
+  const __m128 shear1 = _mm_set1_ps(0.00175f);
+  const __m128 shear2 = _mm_set1_ps(0.0000011f);
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 velx = _mm_loadu_ps(vx + i);
+    __m128 vely = _mm_loadu_ps(vy + i);
+    __m128 velz = _mm_loadu_ps(vz + i);
+
+    // gravity
+    vely = _mm_sub_ps(vely, _mm_mul_ps(ft, _mm_loadu_ps(gravity + i)));
+
+    // air resistance
+    __m128 temp = _mm_div_ps(one, _mm_add_ps(one, _mm_mul_ps(_mm_loadu_ps(drag + i), ft)));
+    temp = _mm_mul_ps(temp, temp);
+    velx = _mm_mul_ps(velx, temp);
+    vely = _mm_mul_ps(vely, temp);
+    velz = _mm_mul_ps(velz, temp);
+    _mm_storeu_ps(vx + i, velx);
+    _mm_storeu_ps(vy + i, vely);
+    _mm_storeu_ps(vz + i, velz);
+
+    // movement
+    __m128 posx = _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(velx, ft));
+    const __m128 posy = _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(vely, ft));
+    const __m128 posz = _mm_add_ps(_mm_loadu_ps(z + i), _mm_mul_ps(velz, ft));
+
+    // wind shear, see below
+    const __m128 shear = _mm_add_ps(_mm_sub_ps(shear0, _mm_mul_ps(shear1, posy)),
+                                    _mm_mul_ps(_mm_mul_ps(shear2, posy), posy));
+    posx = _mm_add_ps(posx, _mm_mul_ps(shear, windft));
+    _mm_storeu_ps(x + i, posx);
+    _mm_storeu_ps(y + i, posy);
+    _mm_storeu_ps(z + i, posz);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    vy[i] -= frameTime * gravity[i];
+    float temp = 1.0f / (1.0f + drag[i] * frameTime);
+    temp *= temp;
+    vx[i] *= temp;
+    vy[i] *= temp;
+    vz[i] *= temp;
+
+    x[i] += vx[i] * frameTime;
+    y[i] += vy[i] * frameTime;
+    z[i] += vz[i] * frameTime;
+    // Wind:  1/10 wind on ground; -1/2 wind at 500 feet; full wind at 2000 feet;
+    // This value is calculated to coincide with movement of the clouds in world.h
+    // Here's the polynomial wind equation that simulates windshear:
+    x[i] += (0.1f - 0.00175f * y[i] + 0.0000011f * y[i] * y[i]) * windFrameTime;
+  }
+}
@@ -0,0 +1,31 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include <kodi/AddonBase.h>
+
+#include <vector>
+
+// Positions, velocities and air resistance of a batch of particles, kept as
+// one array per component so that the motion shared by every particle type
+// (gravity, air resistance, movement and wind) can be integrated several
+// particles at a time.
+class ATTR_DLL_LOCAL CParticleMotion
+{
+public:
+  void Resize(unsigned int size);
+  unsigned int Size() const { return static_cast<unsigned int>(m_x.size()); }
+
+  // Integrate the first count particles over frameTime
+  void Integrate(unsigned int count, float frameTime, float wind);
+
+  std::vector<float> m_x, m_y, m_z;
+  std::vector<float> m_vx, m_vy, m_vz;
+  std::vector<float> m_drag;
+  std::vector<float> m_gravity;  // 0 for particles that float (smoke)
+};
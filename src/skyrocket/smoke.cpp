@@ -31,53 +31,25 @@ void CSmoke::Init()
 {
   int i, j;
 
-  unsigned char smoke1[SMOKETEXSIZE][SMOKETEXSIZE][2];
-  unsigned char smoke2[SMOKETEXSIZE][SMOKETEXSIZE][2];
-  unsigned char smoke3[SMOKETEXSIZE][SMOKETEXSIZE][2];
-  unsigned char smoke4[SMOKETEXSIZE][SMOKETEXSIZE][2];
-  unsigned char smoke5[SMOKETEXSIZE][SMOKETEXSIZE][2];
+  rsAsset* presmoke[5] = {&presmoke1, &presmoke2, &presmoke3, &presmoke4, &presmoke5};
+  unsigned char smoke[SMOKETEXSIZE][SMOKETEXSIZE][2];
 
-  for (i = 0; i < SMOKETEXSIZE; i++)
+  for (int t = 0; t < 5; t++)
   {
-    for (j=0; j < SMOKETEXSIZE; j++)
+    const unsigned char* alpha = presmoke[t]->acquire();
+    for (i = 0; i < SMOKETEXSIZE; i++)
     {
-      smoke1[i][j][0] = 255;
-      smoke2[i][j][0] = 255;
-      smoke3[i][j][0] = 255;
-      smoke4[i][j][0] = 255;
-      smoke5[i][j][0] = 255;
-      smoke1[i][j][1] = presmoke1[i][j];
-      smoke2[i][j][1] = presmoke2[i][j];
-      smoke3[i][j][1] = presmoke3[i][j];
-      smoke4[i][j][1] = presmoke4[i][j];
-      smoke5[i][j][1] = presmoke5[i][j];
+      for (j=0; j < SMOKETEXSIZE; j++)
+      {
+        smoke[i][j][0] = 255;
+        smoke[i][j][1] = alpha ? alpha[i * SMOKETEXSIZE + j] : 0;
+      }
     }
-  }
+    presmoke[t]->release();
 
-  {
-    gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(SMOKETEXSIZE, SMOKETEXSIZE, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), smoke1, Texture.size());
-    m_smoketex[0] = kodi::gui::gl::Load(Texture);
-  }
-  {
     gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(SMOKETEXSIZE, SMOKETEXSIZE, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), smoke2, Texture.size());
-    m_smoketex[1] = kodi::gui::gl::Load(Texture);
-  }
-  {
-    gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(SMOKETEXSIZE, SMOKETEXSIZE, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), smoke3, Texture.size());
-    m_smoketex[2] = kodi::gui::gl::Load(Texture);
-  }
-  {
-    gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(SMOKETEXSIZE, SMOKETEXSIZE, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), smoke4, Texture.size());
-    m_smoketex[3] = kodi::gui::gl::Load(Texture);
-  }
-  {
-    gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(SMOKETEXSIZE, SMOKETEXSIZE, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), smoke5, Texture.size());
-    m_smoketex[4] = kodi::gui::gl::Load(Texture);
+    std::memcpy(Texture.data(), smoke, Texture.size());
+    m_smoketex[t] = kodi::gui::gl::Load(Texture);
   }
 
   for (i = 0; i < 5; i++)
@@ -129,3 +101,8 @@ void CSmoke::Draw(unsigned int entry, const sColor& color)
   m_base->BindTexture(GL_TEXTURE_2D, m_smoketex[entry]);
   m_base->DrawEntry(GL_TRIANGLE_STRIP, m_smokelist[entry], 4);
 }
+
+void CSmoke::Add(unsigned int entry, const float* pos, float size, const sColor& color)
+{
+  m_base->Billboards().Add(m_smoketex[entry], true, m_smokelist[entry], pos, size, color);
+}
@@ -37,6 +37,9 @@ public:
   void Init();
   void Draw(unsigned int entry, const sColor& color);
 
+  // Queue a camera facing smoke puff at pos for the particle billboards
+  void Add(unsigned int entry, const float* pos, float size, const sColor& color);
+
   ATTR_FORCEINLINE int WhichSmoke(unsigned int which) const { return m_whichSmoke[which]; }
   ATTR_FORCEINLINE int SmokeTime(unsigned int which) const { return m_smokeTime[which]; }
 
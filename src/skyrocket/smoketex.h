@@ -5,460 +5,673 @@
  *  See LICENSE.md for more information.
  */
 
+#pragma once
 
-#ifndef SMOKETEX_H
-#define SMOKETEX_H
-
-
+#include <rsAsset/rsAsset.h>
 
 #define SMOKETEXSIZE 64
 
+/* data from presmoke1.raw, 4096 bytes */
 
-
-unsigned char presmoke1[SMOKETEXSIZE][SMOKETEXSIZE] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,3,6,5,4,
-9,9,5,3,2,2,2,3,3,3,3,2,3,3,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,0,0,9,7,6,6,5,6,6,6,5,5,5,5,5,4,4,
-4,4,4,4,3,3,4,4,5,5,5,6,9,14,17,19,25,33,26,11,4,5,7,13,17,11,4,4,9,10,9,7,7,7,6,6,6,6,5,4,4,4,3,3,3,4,2,0,
-0,9,9,8,9,7,7,7,6,6,5,6,7,7,8,8,8,8,7,7,6,6,6,7,9,11,15,19,20,27,37,44,51,54,40,22,10,12,15,27,32,23,9,11,19,17,13,13,
-11,11,10,9,9,9,7,6,7,6,5,4,4,5,4,0,0,10,9,7,6,5,5,5,4,4,5,6,7,9,11,13,14,13,12,11,10,11,13,17,19,23,31,39,46,50,52,71,
-86,74,54,30,17,26,39,46,46,44,31,27,34,23,17,16,15,13,11,9,9,9,7,7,7,7,5,4,4,6,5,0,0,11,9,6,5,4,4,4,4,4,5,7,9,13,20,24,
-25,25,23,20,20,24,32,38,42,46,51,69,84,84,81,88,100,89,69,50,33,48,69,79,69,57,51,44,39,31,23,17,17,15,11,10,8,7,7,7,9,8,6,4,4,6,5,0,
-0,12,9,6,5,4,3,4,4,5,6,9,15,23,33,44,50,42,37,39,46,57,64,69,72,74,84,105,122,125,118,109,105,109,100,91,81,81,95,95,79,61,55,52,48,37,28,23,
-17,17,13,9,8,7,7,7,9,8,7,4,4,5,5,0,0,14,9,7,4,4,4,5,6,9,12,19,28,50,63,72,64,51,48,60,88,103,111,105,109,120,129,136,144,151,154,134,
-123,127,131,145,136,118,107,95,72,66,64,57,50,39,33,27,23,19,14,9,7,7,7,7,8,9,6,4,4,5,5,0,0,13,11,7,5,5,5,7,9,17,27,43,55,74,93,77,
-63,46,51,69,105,136,138,138,147,160,172,172,177,187,182,153,131,142,172,193,182,160,127,105,84,74,64,52,50,43,37,32,23,19,13,9,7,6,6,7,7,8,6,4,3,4,5,0,
-0,14,13,9,6,7,7,10,17,29,52,79,89,96,98,84,58,39,34,52,105,142,149,165,191,200,211,211,216,221,215,175,144,163,206,215,210,191,168,136,103,84,61,50,51,44,42,31,
-25,19,13,10,6,4,5,5,6,7,6,4,3,3,4,0,0,12,14,11,9,8,9,15,28,51,86,114,120,111,103,95,66,44,34,52,105,149,173,194,216,227,235,238,236,240,235,206,
-180,187,215,228,226,207,178,147,118,88,58,46,48,46,34,27,23,17,14,8,4,3,4,5,6,6,6,3,2,3,4,0,0,9,13,12,11,10,12,21,42,72,112,138,140,134,122,122,
-107,64,58,82,149,200,215,223,233,243,246,244,244,247,244,225,200,196,216,226,223,200,175,145,122,88,63,50,43,38,29,20,17,13,11,7,4,3,4,6,7,7,6,4,3,4,4,0,
-0,7,13,14,13,13,14,23,48,84,114,129,154,153,147,151,134,102,109,154,209,233,241,241,244,249,249,246,246,246,243,230,210,200,212,221,212,194,165,122,98,77,61,50,38,32,21,13,
-10,11,10,7,5,5,7,8,8,7,7,6,6,7,5,0,0,7,13,13,13,12,15,23,42,72,111,140,156,168,175,165,153,149,168,206,230,243,247,249,249,249,249,246,244,241,229,217,
-219,216,215,220,212,191,144,96,84,89,84,66,46,30,18,10,8,10,13,11,7,8,10,11,10,9,8,9,8,9,5,0,0,6,13,13,11,12,15,20,34,63,98,129,154,175,178,161,
-153,168,191,219,235,246,249,251,251,249,249,246,238,223,211,209,223,227,223,219,212,188,140,105,103,122,122,102,69,42,22,11,10,13,17,15,12,12,14,16,14,11,9,10,9,9,5,0,
-0,5,11,11,11,12,14,19,29,46,74,111,134,154,161,154,156,180,212,224,232,245,251,252,253,250,244,238,225,199,187,199,220,232,235,224,214,199,165,131,129,144,156,125,84,51,26,17,
-15,20,20,19,15,17,21,22,20,17,14,12,11,9,4,0,0,3,8,9,10,10,12,15,21,33,55,81,109,129,153,160,168,197,224,233,239,246,249,250,249,246,238,228,217,196,177,190,
-220,233,236,226,216,207,180,138,136,153,149,122,74,36,21,18,23,29,27,26,24,24,31,32,32,27,19,14,12,9,5,0,0,3,5,7,7,9,9,11,14,23,37,61,79,109,144,178,
-194,210,222,241,248,247,246,242,238,232,226,223,221,211,197,202,215,223,222,217,203,190,160,129,125,134,118,91,50,23,17,22,33,43,40,44,40,40,44,46,42,33,23,17,13,9,5,0,
-0,2,5,6,7,8,9,10,13,17,27,46,64,103,138,178,199,212,231,246,249,245,239,223,207,211,207,202,210,216,214,214,216,211,200,177,163,151,122,111,129,136,120,89,51,25,20,29,
-51,63,54,61,64,63,58,63,52,43,29,20,13,9,5,0,0,2,5,7,9,9,11,11,14,19,27,43,71,109,140,161,180,202,231,246,242,231,222,199,183,191,200,202,211,220,211,216,
-216,196,170,136,127,127,116,127,163,170,153,111,61,32,29,44,72,81,71,74,77,77,86,88,77,58,39,23,15,11,6,0,0,3,5,7,10,13,13,15,19,24,33,51,86,120,134,131,
-144,175,210,228,214,191,185,185,180,180,200,214,222,214,191,185,175,142,114,111,136,165,183,196,214,217,196,145,82,46,38,51,68,82,77,82,79,89,109,114,109,84,50,33,23,16,9,0,
-0,3,7,7,10,16,19,21,22,33,47,71,95,118,118,109,105,134,168,185,175,161,177,191,187,187,206,223,222,197,167,123,100,74,57,91,168,216,238,244,246,242,224,183,120,72,51,52,
-60,64,66,63,69,96,127,131,129,111,79,55,38,27,13,0,0,4,7,9,12,21,31,30,36,50,71,86,105,118,114,95,86,102,129,153,151,161,185,202,199,197,214,226,214,177,131,84,
-52,42,46,93,185,236,249,252,252,248,235,209,153,98,76,61,58,64,66,69,86,118,138,147,145,134,114,89,63,39,16,0,0,4,9,11,15,25,38,46,58,81,95,103,112,120,120,102,
-93,93,103,118,125,145,173,187,197,210,216,216,191,142,100,61,42,46,76,125,190,231,246,251,251,247,238,210,158,111,96,88,81,79,96,112,129,153,163,163,160,154,138,109,79,55,21,0,
-0,5,11,19,23,29,43,55,74,105,125,134,136,140,138,129,114,105,102,98,102,116,142,161,180,197,209,200,156,120,91,63,54,69,102,158,187,216,238,247,249,243,222,188,149,118,116,112,
-98,98,122,153,177,185,183,180,177,170,160,129,93,66,32,0,0,7,17,23,34,33,39,61,86,109,145,168,177,178,178,165,151,136,120,105,93,93,100,129,163,182,182,156,114,88,71,61,
-58,69,96,144,178,199,224,239,241,232,210,188,161,147,147,133,114,114,129,161,187,199,197,194,188,183,168,134,102,74,39,0,0,9,20,33,43,46,43,61,79,118,161,199,217,217,211,203,
-187,170,153,131,125,109,95,109,136,161,145,111,74,63,61,50,46,47,60,105,147,178,206,219,222,210,193,194,187,180,183,168,160,154,163,170,196,207,210,197,191,180,156,120,93,71,43,0,
-0,9,23,39,55,55,55,66,88,134,180,206,227,231,233,225,204,190,183,173,168,145,120,105,109,127,114,82,60,57,55,40,37,32,36,71,118,158,178,187,183,170,178,204,209,200,202,209,
-206,197,185,188,204,220,217,197,183,165,145,112,96,71,39,0,0,10,29,48,64,72,74,93,105,145,187,212,226,233,238,235,217,209,204,197,187,170,151,114,95,100,102,76,63,55,46,33,
-27,30,43,71,105,133,154,161,147,131,153,191,196,197,204,206,211,202,193,197,197,212,216,199,175,153,125,109,93,69,31,0,0,11,27,55,81,86,96,118,136,154,178,204,219,222,229,231,
-224,224,216,199,187,178,156,122,91,100,105,84,72,60,37,24,23,36,60,86,100,114,129,136,129,123,133,145,156,165,172,178,188,193,199,188,180,185,185,180,168,145,120,105,79,63,31,0,
-0,14,31,64,93,93,109,144,153,161,178,197,210,207,202,210,219,223,217,203,188,182,170,133,100,109,129,125,109,91,54,33,34,47,66,82,89,103,118,123,129,120,107,103,122,144,156,161,
-161,172,172,163,160,156,161,165,156,145,120,96,72,55,31,0,0,17,38,58,84,96,111,140,163,172,193,200,194,185,172,177,197,204,209,214,199,194,178,144,122,133,156,165,149,133,88,57,
-52,58,61,66,81,89,111,125,133,125,105,93,105,138,156,160,151,147,136,129,129,138,144,140,136,125,103,86,63,44,21,0,0,19,44,61,74,95,105,134,154,172,191,193,185,172,156,165,
-188,202,212,216,211,203,199,177,163,165,178,177,158,131,96,69,60,63,61,61,74,86,98,112,123,129,112,105,102,107,118,138,136,123,120,114,111,131,136,114,112,109,93,71,48,33,17,0,
-0,19,38,57,71,95,118,134,140,153,168,172,165,160,175,200,219,226,227,227,226,219,219,209,202,193,183,175,145,112,77,58,58,58,58,64,71,81,96,109,112,109,103,105,89,64,64,82,
-107,107,105,120,127,127,122,105,111,109,84,52,34,23,13,0,0,19,34,52,71,95,120,127,114,111,134,151,144,153,194,231,244,248,245,242,238,231,227,216,206,193,178,168,151,112,72,55,
-55,55,57,63,72,77,84,93,93,96,109,109,77,47,40,52,93,120,129,151,151,138,120,105,102,95,69,39,25,19,10,0,0,19,38,52,69,95,118,120,95,81,105,134,138,154,200,235,
-250,253,253,251,244,236,222,204,187,175,163,163,160,134,109,77,63,69,69,69,81,81,71,69,79,103,123,125,89,58,52,63,98,123,153,177,172,151,136,112,95,77,57,31,20,12,7,0,
-0,16,27,43,64,86,109,102,81,66,89,112,122,147,191,233,251,254,253,251,242,229,211,185,172,163,153,153,154,154,144,114,103,96,95,88,86,84,74,57,69,102,125,138,118,91,74,72,
-89,112,144,170,175,163,140,105,84,63,44,27,16,9,5,0,0,11,17,31,50,64,79,88,74,69,86,98,109,138,183,231,250,253,249,243,235,220,193,177,165,163,160,153,145,147,160,165,
-161,129,102,93,84,81,66,55,61,84,112,133,129,111,74,61,64,86,118,138,160,154,125,93,69,50,33,23,15,8,5,0,0,9,15,23,34,44,48,51,55,63,79,103,131,153,185,229,
-246,250,246,238,224,207,172,147,144,156,156,136,127,140,172,197,188,154,118,105,89,77,64,63,66,72,89,112,114,95,77,58,60,84,103,122,138,129,111,84,58,42,31,20,13,7,5,0,
-0,7,11,16,23,31,37,38,39,55,89,120,153,170,193,220,243,251,246,233,206,172,144,120,125,134,127,118,105,136,185,210,204,180,156,134,103,77,69,64,71,79,89,82,79,86,89,76,
-81,96,109,123,129,120,93,71,58,46,29,20,12,7,5,0,0,7,10,13,15,19,25,31,37,61,93,131,163,188,202,219,241,250,246,229,196,161,142,125,120,118,114,112,111,138,193,216,
-211,191,168,144,112,81,69,64,71,84,93,71,72,89,96,96,98,96,114,129,122,105,74,63,63,46,31,20,12,7,5,0,0,7,11,12,12,15,19,29,43,64,95,144,180,210,228,233,
-245,249,242,220,190,178,160,149,136,127,131,145,153,178,204,219,214,187,154,134,112,103,96,77,79,89,95,95,96,98,91,96,111,107,118,131,120,95,66,63,57,50,33,20,13,8,5,0,
-0,7,10,11,12,15,20,31,50,84,114,156,200,231,241,246,249,249,243,221,191,177,172,167,158,154,163,178,193,206,210,211,206,177,151,131,105,114,125,111,103,109,98,103,112,114,105,109,
-125,125,131,131,109,84,66,66,64,55,34,21,13,9,6,0,0,7,11,11,12,17,21,31,51,102,140,178,220,240,245,243,245,247,242,229,204,177,168,175,178,191,196,193,202,212,207,194,
-183,172,160,138,118,112,125,138,144,129,111,109,118,127,129,131,144,140,131,105,84,77,74,84,79,63,39,25,17,11,7,0,0,7,12,11,13,16,23,33,52,111,163,202,223,240,237,227,
-229,230,225,223,215,199,182,168,170,194,206,204,202,207,199,183,168,168,165,151,136,127,131,151,156,136,122,118,118,129,144,153,136,134,122,103,93,88,89,89,86,66,44,29,17,12,9,0,
-0,7,13,13,13,17,24,39,72,127,175,211,232,235,224,202,194,187,197,210,220,209,183,151,140,163,185,199,206,206,199,183,168,161,168,165,161,147,145,153,145,129,114,118,125,129,131,125,
-111,109,103,109,103,98,96,103,96,69,46,28,19,14,9,0,0,7,14,15,17,23,32,57,93,134,175,210,231,235,224,194,168,160,180,214,227,214,173,125,103,112,144,183,199,197,197,178,
-175,165,172,188,187,163,140,134,127,118,112,114,118,120,111,96,88,79,77,84,93,89,88,88,93,72,48,29,21,16,11,0,0,7,15,19,24,33,52,84,109,136,170,193,220,227,210,180,
-151,149,177,215,225,217,180,122,79,76,107,153,175,183,183,170,170,175,187,200,188,163,131,112,109,111,120,111,102,93,84,81,61,46,46,50,63,71,63,64,72,79,58,38,25,19,13,0,
-0,7,16,21,32,48,66,95,118,134,160,180,196,197,170,138,122,138,170,191,206,207,187,145,100,81,100,131,161,178,175,160,160,175,188,191,178,156,134,105,95,103,103,103,96,71,63,58,
-38,23,23,27,38,44,46,52,64,72,63,43,31,23,15,0,0,7,17,23,33,52,71,93,118,136,153,151,147,140,112,86,91,123,154,161,160,163,173,163,120,96,103,129,158,177,165,145,
-151,163,175,168,156,151,134,103,89,86,81,95,88,71,55,39,25,16,15,17,21,24,32,39,51,64,58,38,29,20,15,0,0,7,19,27,37,50,63,81,105,123,122,100,91,88,68,55,
-79,127,145,133,131,138,158,156,129,107,109,123,149,165,147,136,144,154,156,136,125,122,118,111,86,71,77,89,79,71,51,32,19,13,10,9,11,14,19,27,31,37,34,32,24,20,17,0,
-0,6,17,27,37,44,58,76,89,91,72,52,52,68,58,55,77,122,129,120,122,136,153,142,129,127,112,105,114,129,136,140,147,154,138,111,102,95,98,102,84,69,74,89,81,69,46,25,
-13,9,7,7,6,7,9,12,14,17,19,19,19,19,17,0,0,5,15,21,29,36,43,44,47,46,33,29,38,55,60,55,77,109,112,98,102,134,151,134,138,127,100,79,77,105,129,145,
-153,140,118,96,79,74,84,84,69,58,64,79,86,72,42,21,13,8,7,5,4,4,5,5,6,7,9,9,10,13,13,0,0,4,10,15,23,28,32,26,22,18,18,20,32,47,47,52,
-60,84,98,93,102,125,138,136,131,111,77,58,69,95,118,122,114,111,98,89,81,71,72,61,52,43,46,71,79,58,32,19,11,7,5,5,4,3,3,3,3,3,3,4,4,6,8,0,
-0,3,7,11,13,19,21,19,15,11,11,15,25,29,32,40,46,58,74,81,88,103,118,133,122,95,52,38,54,77,89,82,76,81,88,88,86,66,50,42,33,34,48,61,66,46,23,13,
-9,7,5,5,4,3,3,2,2,2,2,1,2,3,4,0,0,3,7,9,9,10,11,15,13,11,11,14,19,22,25,31,34,39,50,57,74,84,95,114,114,82,48,37,46,51,58,60,
-58,57,74,82,74,52,33,23,23,37,55,55,50,32,17,9,7,7,7,6,5,4,3,2,1,1,1,1,1,1,2,0,0,2,5,7,6,6,7,9,10,10,11,13,17,16,17,21,
-24,28,32,43,55,66,79,96,98,71,50,39,34,33,39,38,40,46,57,60,57,39,24,16,19,33,52,57,42,23,14,9,6,7,8,7,5,5,3,2,1,1,0,0,0,1,1,0,
-0,2,5,5,5,5,6,6,6,7,9,11,13,13,11,13,15,19,25,29,33,46,64,84,81,61,40,31,28,27,24,21,25,39,46,37,33,25,24,23,23,27,42,46,38,20,12,7,
-6,7,9,7,6,5,4,2,1,1,0,0,0,0,1,0,0,2,4,4,4,4,4,4,5,5,6,8,10,10,9,9,10,13,17,19,23,28,39,52,58,51,39,29,24,22,17,13,
-19,36,40,24,19,23,29,38,33,29,34,37,33,19,12,9,6,6,7,7,5,4,3,2,1,1,0,0,0,0,1,0,0,3,4,4,3,4,3,4,4,5,6,7,9,9,9,8,
-8,7,9,11,17,17,24,33,39,37,37,32,31,19,11,9,13,29,40,25,17,21,31,44,43,34,27,25,27,19,11,9,5,3,4,5,4,3,3,2,1,1,0,0,0,0,1,0,
-0,3,5,5,4,4,4,4,5,7,8,9,9,9,9,7,7,5,6,9,11,13,14,19,28,31,28,29,25,17,9,7,9,22,28,25,20,19,28,38,39,28,17,19,19,15,10,7,
-4,3,3,4,3,2,2,2,2,1,1,0,0,0,1,0,0,3,6,6,5,5,5,5,6,8,9,9,8,8,7,6,6,5,7,8,9,10,9,14,23,26,26,21,20,19,10,7,
-7,11,13,17,19,22,23,20,20,17,13,12,12,12,9,5,3,2,1,2,3,2,1,2,2,1,1,1,1,1,1,0,0,1,3,3,4,4,4,4,5,6,6,6,6,6,6,5,
-5,5,6,7,8,9,7,9,12,15,13,12,13,13,8,6,5,4,5,8,10,9,8,7,7,6,5,5,5,6,5,4,2,2,1,1,1,1,1,1,1,1,1,0,1,0,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+static const uint8_t presmoke1_packed[] = {
+66,90,104,57,49,65,89,38,83,89,49,32,62,219,0,0,3,255,255,255,255,255,255,247,
+221,221,182,214,214,181,106,213,170,213,90,171,85,106,181,106,214,181,173,182,221,189,239,255,
+239,255,255,96,9,191,0,0,12,210,129,74,82,42,36,82,72,20,161,98,170,167,254,16,
+52,13,26,6,68,209,166,17,166,145,166,41,169,163,212,0,208,105,160,3,64,6,128,3,
+64,6,128,52,3,67,64,200,100,104,208,13,13,26,61,64,21,83,253,17,163,67,35,70,
+77,52,208,212,200,100,69,60,70,42,126,133,61,38,106,6,134,128,208,52,97,0,50,0,
+13,0,208,0,0,208,0,0,208,208,6,154,4,1,166,141,3,38,153,26,104,50,0,100,
+52,96,64,13,50,26,12,154,6,129,160,200,52,194,26,12,152,35,65,166,17,136,6,70,
+38,152,38,131,65,147,64,128,52,209,160,100,211,35,77,6,64,12,134,140,8,1,166,67,
+65,147,64,208,52,25,6,152,67,65,147,4,104,52,194,49,0,200,196,211,4,208,104,50,
+104,16,6,154,52,12,154,100,105,160,200,1,144,209,129,0,52,200,104,50,104,26,6,131,
+32,211,8,104,50,96,141,6,152,70,32,25,24,154,96,154,13,6,77,0,212,242,16,41,
+166,144,212,202,98,105,163,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,12,140,142,250,164,129,148,153,9,162,129,162,189,110,113,209,52,212,206,137,22,35,
+19,106,157,10,231,216,25,227,69,183,110,44,152,108,139,25,44,134,218,120,230,206,51,144,
+43,130,37,180,212,128,26,89,48,13,42,2,52,181,74,82,148,17,32,53,134,82,223,63,
+156,146,98,9,32,28,36,137,65,74,228,32,76,164,8,96,174,67,144,232,131,128,8,152,
+214,48,135,6,16,96,12,154,19,179,179,163,150,20,153,26,107,26,108,156,41,160,193,212,
+138,146,52,105,52,152,81,5,41,144,210,131,32,248,186,130,132,202,96,129,8,201,83,42,
+78,235,24,120,18,38,66,17,22,164,53,20,49,51,73,227,86,240,76,156,162,3,66,12,
+110,201,11,200,94,192,93,89,205,5,33,0,242,103,19,41,194,162,65,211,48,112,210,121,
+85,0,247,50,49,14,137,100,196,51,205,145,135,68,194,69,166,211,155,213,226,98,114,189,
+171,43,11,177,210,160,123,24,6,44,168,9,18,69,72,136,8,217,9,144,242,116,168,89,
+193,14,67,2,83,195,200,17,108,176,46,213,188,12,247,163,136,152,163,193,114,146,38,12,
+149,141,90,81,98,166,67,40,96,100,16,112,194,121,26,174,157,36,13,139,3,5,217,1,
+51,76,144,21,145,152,32,209,72,49,18,157,53,184,106,235,102,37,67,28,18,5,138,74,
+165,26,161,114,215,118,166,183,28,41,142,1,219,9,179,68,67,177,105,131,90,224,213,58,
+150,135,163,61,4,78,98,11,89,44,200,57,177,120,164,16,196,77,221,140,72,148,48,155,
+52,206,188,136,53,53,106,23,172,34,117,47,163,86,58,232,194,174,141,234,206,66,86,120,
+133,175,104,120,12,134,86,21,209,205,176,197,97,137,26,74,154,78,91,53,14,90,12,212,
+206,249,91,53,89,235,10,36,170,240,76,65,44,81,99,144,213,105,237,32,99,141,227,22,
+192,94,22,92,21,31,7,41,12,176,83,133,177,123,234,101,13,174,197,150,49,61,140,208,
+133,150,248,220,145,108,38,239,24,190,175,52,104,11,81,157,202,5,139,36,9,100,167,96,
+112,199,5,147,77,67,216,94,98,182,147,179,51,69,180,13,141,145,189,44,237,131,219,33,
+19,161,25,206,92,161,80,21,180,225,159,75,11,231,55,216,227,134,58,67,75,109,217,94,
+16,219,60,209,9,109,128,144,69,108,3,1,77,181,48,112,5,173,3,217,25,41,20,177,
+230,235,72,196,86,90,94,213,208,182,91,182,216,84,16,216,66,198,99,32,149,0,46,150,
+18,192,116,67,40,132,16,88,2,51,97,36,117,200,28,21,56,56,65,99,3,129,102,55,
+133,20,14,5,162,29,69,35,72,181,245,117,110,153,220,172,209,40,130,3,178,145,129,3,
+30,171,74,175,11,0,49,72,116,114,153,173,216,2,212,92,97,230,52,55,219,133,50,106,
+120,152,171,192,77,5,192,4,1,198,88,171,128,117,89,69,14,163,169,107,220,129,142,116,
+136,28,121,0,224,187,27,207,61,136,74,144,208,16,232,44,116,170,54,85,59,208,91,164,
+160,106,36,238,191,19,68,108,2,72,197,84,82,34,50,129,102,36,16,130,209,215,207,8,
+52,181,3,17,0,233,24,170,19,114,7,28,113,107,153,78,237,251,27,165,235,197,163,22,
+59,53,178,183,89,61,99,8,42,80,246,118,119,117,180,124,185,103,59,58,96,184,41,22,
+133,162,138,117,197,71,3,59,4,173,174,168,53,69,61,66,206,116,36,136,46,184,70,9,
+212,150,33,245,83,25,235,30,209,30,29,73,238,96,143,171,29,221,151,33,26,236,74,104,
+6,212,35,4,194,128,186,133,88,76,212,225,57,211,54,18,169,166,30,182,119,25,209,157,
+36,211,94,215,172,81,234,18,120,218,203,216,215,28,218,246,245,91,162,233,126,82,31,183,
+238,108,181,134,212,209,99,34,49,94,231,145,242,24,86,86,16,211,53,104,24,244,28,130,
+225,132,49,96,60,117,55,4,60,91,17,37,162,104,209,125,249,231,167,156,117,11,133,247,
+28,144,36,199,50,202,11,85,135,81,133,230,140,234,145,100,153,63,10,202,107,227,60,178,
+99,232,29,175,14,232,47,37,15,66,92,81,37,193,165,248,106,14,221,214,232,119,15,61,
+51,213,56,147,82,48,60,147,101,54,224,49,68,147,25,134,223,191,68,38,75,241,49,130,
+17,88,48,10,7,205,80,141,231,147,72,221,73,84,188,35,174,14,9,31,54,112,0,186,
+150,119,91,213,38,226,219,66,182,247,112,222,128,109,51,222,77,196,182,96,153,26,132,228,
+81,154,211,40,163,96,22,103,42,1,213,152,78,167,87,126,244,74,113,15,118,237,189,192,
+189,79,119,233,66,165,56,211,110,47,41,167,3,134,74,113,88,138,134,221,1,119,164,121,
+215,233,114,139,97,182,44,49,84,17,140,170,98,5,48,138,140,135,42,192,71,168,116,172,
+158,148,108,200,17,131,10,154,180,193,28,163,39,164,191,168,92,9,178,3,49,165,34,28,
+109,6,100,234,169,211,163,188,139,211,64,237,116,65,121,104,182,146,207,140,8,213,90,110,
+144,48,210,41,233,23,121,77,100,8,13,72,160,7,92,174,4,60,29,56,240,5,203,151,
+176,196,230,230,84,184,245,249,70,48,220,164,179,114,128,203,216,211,172,119,51,107,3,114,
+59,240,185,84,214,97,22,76,146,100,24,197,86,117,85,195,52,165,239,112,75,198,185,114,
+44,157,237,119,229,58,42,173,156,80,44,83,79,12,84,90,123,40,69,235,187,42,66,106,
+116,131,46,25,182,188,75,163,129,233,190,49,173,50,98,110,105,46,70,185,114,84,85,211,
+108,190,23,173,20,212,245,129,179,218,135,248,33,236,51,203,109,44,171,36,228,64,64,102,
+236,2,163,154,169,78,2,63,174,1,85,78,157,7,61,48,227,108,132,108,150,84,243,142,
+208,88,77,165,97,139,117,218,221,107,21,59,121,32,58,143,65,49,6,248,105,209,83,88,
+45,108,73,69,66,123,9,167,121,236,138,220,28,161,56,206,27,147,142,38,199,0,30,150,
+28,219,166,16,81,6,19,199,144,17,144,8,29,8,3,161,34,194,170,218,205,172,118,221,
+111,149,199,69,42,11,13,129,116,49,195,76,52,178,186,183,8,53,5,137,227,72,210,15,
+240,184,132,74,182,2,151,121,175,80,183,212,98,228,161,27,220,220,39,66,187,162,125,217,
+69,35,32,107,64,59,238,231,186,215,177,115,53,6,179,81,198,175,119,115,6,138,233,106,
+24,64,178,146,178,208,244,17,79,109,198,52,72,235,157,185,36,172,101,6,34,9,113,76,
+52,191,126,83,134,105,103,135,107,244,86,133,77,131,101,146,50,200,33,60,177,93,77,88,
+112,243,240,146,228,62,171,185,67,160,116,64,148,115,236,95,23,65,219,225,180,173,112,173,
+11,178,184,112,21,34,200,142,30,200,99,37,67,22,55,92,253,175,195,98,91,200,238,38,
+12,75,195,222,90,55,3,156,202,200,107,237,213,32,182,6,29,50,107,247,85,115,110,202,
+63,1,203,13,115,132,64,159,133,1,22,1,189,65,212,85,98,238,219,132,176,64,98,26,
+52,151,76,69,171,59,5,195,60,88,133,28,1,43,116,248,80,225,191,187,85,250,88,136,
+139,55,22,238,37,66,96,204,32,160,183,13,64,91,17,35,6,76,158,137,232,4,213,183,
+139,199,80,226,172,113,23,145,93,123,114,46,218,220,219,43,210,239,147,69,121,252,42,31,
+174,140,73,189,139,110,81,171,153,151,67,112,91,219,120,146,26,25,10,227,164,102,236,214,
+173,38,248,214,27,163,102,64,222,88,209,59,118,73,101,124,98,92,93,54,248,145,202,103,
+218,32,65,13,199,100,28,28,92,252,243,124,59,220,212,229,40,243,24,157,114,21,53,196,
+185,119,68,42,236,101,23,65,113,238,143,28,135,209,242,58,253,27,207,87,86,138,223,130,
+232,162,157,85,107,91,146,127,93,252,249,183,132,113,185,40,162,122,55,146,86,16,211,168,
+185,83,49,6,42,68,187,46,83,40,6,48,87,106,120,158,135,17,57,206,54,89,9,11,
+100,87,162,248,69,13,133,72,182,212,17,176,85,181,20,30,84,203,23,53,183,17,48,208,
+100,87,4,184,38,156,190,98,235,222,120,70,145,34,51,2,242,127,206,241,123,99,171,145,
+101,199,15,23,229,40,161,77,180,164,132,173,175,76,194,250,54,9,236,111,98,95,86,200,
+0,57,18,235,131,88,196,38,169,169,150,55,22,136,161,146,69,0,221,118,144,168,165,82,
+227,212,210,69,155,219,73,118,61,7,155,28,46,128,188,201,12,230,165,235,167,36,155,247,
+168,14,245,101,49,133,155,70,96,181,11,66,92,51,223,211,206,225,169,21,8,218,168,209,
+163,186,169,232,142,124,237,156,221,36,141,123,52,111,213,195,68,72,66,82,156,175,217,28,
+193,69,45,215,132,157,127,183,159,106,86,116,244,51,63,165,162,25,89,36,5,134,237,89,
+100,22,91,140,99,234,100,210,109,156,130,156,81,76,124,209,201,126,54,219,218,113,140,115,
+162,67,132,74,54,166,115,185,35,163,116,143,109,107,246,247,217,218,229,147,44,175,203,3,
+228,93,101,97,152,101,223,48,214,192,50,222,117,149,30,11,134,21,146,184,245,212,146,7,
+246,203,213,5,17,133,150,209,140,88,146,225,216,223,252,5,247,88,13,229,137,28,4,82,
+192,85,107,85,124,98,106,84,177,242,19,105,94,21,36,76,4,101,209,198,169,192,155,249,
+31,75,46,187,180,223,252,88,220,180,194,154,153,196,156,84,33,140,246,190,233,108,166,163,
+184,188,242,175,96,167,130,254,122,248,48,235,195,53,85,133,26,48,216,253,1,176,250,138,
+47,150,122,217,71,209,204,208,71,21,3,197,170,166,79,125,106,95,192,175,1,132,99,40,
+43,116,143,64,140,212,237,240,101,145,126,5,17,60,238,71,116,145,213,81,46,120,50,240,
+120,102,199,156,175,183,153,183,168,150,101,184,81,199,208,252,239,154,142,28,208,94,3,15,
+189,131,17,244,213,160,250,204,112,170,124,70,39,38,230,73,132,190,71,238,199,138,107,35,
+147,123,57,255,94,3,86,224,141,199,209,71,142,204,152,213,137,88,153,244,47,132,71,141,
+248,175,103,97,51,64,167,17,229,218,142,246,35,106,40,45,28,72,200,86,84,156,8,143,
+99,83,107,176,179,54,27,6,25,0,23,109,190,28,206,150,160,6,199,239,66,105,217,64,
+66,6,190,242,254,24,23,95,69,115,30,40,27,189,13,105,226,184,222,165,47,201,109,48,
+230,67,252,89,202,50,225,227,125,191,142,92,182,248,250,33,103,24,6,59,238,13,45,235,
+4,106,29,167,110,246,178,121,155,4,208,80,17,79,171,109,143,145,158,62,58,43,151,35,
+186,225,160,145,119,214,206,114,2,167,14,124,102,81,48,133,0,61,235,27,202,196,146,194,
+156,87,239,96,50,184,148,130,81,157,57,38,227,182,164,118,46,147,115,119,15,246,122,246,
+1,143,141,249,197,41,4,236,95,174,172,234,82,162,96,180,40,66,0,80,214,244,22,161,
+95,223,67,57,171,142,67,167,90,39,44,88,210,175,39,29,12,204,119,133,252,32,28,130,
+219,166,140,141,44,38,86,45,186,148,69,139,97,214,50,34,147,160,114,18,180,223,187,145,
+178,210,25,160,17,209,29,117,175,59,59,48,1,80,206,5,173,164,27,49,19,20,72,46,
+85,38,134,184,54,76,247,246,41,194,1,0,12,220,71,138,47,42,49,50,115,162,107,153,
+114,46,150,104,134,18,72,115,253,201,6,88,78,166,239,130,101,76,154,102,255,31,38,20,
+57,191,220,205,162,66,194,173,55,26,218,89,163,29,8,25,110,39,60,53,88,180,98,223,
+245,153,255,241,119,36,83,133,9,3,18,3,237,176
 };
 
+static rsAsset presmoke1(presmoke1_packed, 2966, 4096);
 
-unsigned char presmoke2[SMOKETEXSIZE][SMOKETEXSIZE] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,1,0,0,0,0,0,1,2,3,4,5,6,7,8,12,19,28,38,39,35,23,14,10,8,6,6,7,8,8,
-7,6,5,5,4,4,4,4,3,2,2,3,3,4,5,5,4,4,3,3,3,4,3,2,1,1,1,1,1,2,2,0,0,2,1,0,0,0,0,0,1,3,5,8,11,13,14,17,
-23,33,52,76,89,89,76,56,34,23,17,13,8,7,7,7,6,8,13,15,17,19,17,16,11,8,7,7,9,13,16,15,11,7,6,7,7,6,4,3,2,2,1,1,1,1,3,0,
-0,1,0,0,0,0,0,1,3,5,9,12,15,18,23,33,42,57,82,99,113,115,103,85,63,44,35,29,16,9,8,7,6,7,14,27,41,52,53,46,33,19,14,16,22,31,31,20,
-12,8,7,8,8,7,5,4,3,2,2,2,2,2,2,0,0,1,0,0,0,0,1,1,4,6,9,11,14,22,33,48,68,87,101,106,118,129,118,101,77,63,54,56,35,20,12,11,
-8,12,22,42,63,87,84,68,53,36,30,36,52,56,45,23,13,10,9,10,10,10,7,5,4,4,3,3,2,3,3,0,0,0,0,0,0,0,1,2,4,6,7,9,12,21,36,63,
-89,103,108,111,115,120,115,99,82,72,76,66,54,34,20,14,13,20,40,62,79,103,104,71,59,56,57,76,82,82,54,31,19,14,14,16,16,14,10,8,7,6,5,4,4,4,4,0,
-0,0,0,0,0,0,1,1,3,5,7,8,10,18,31,57,84,94,99,106,101,99,103,89,79,76,79,74,68,50,28,17,18,35,66,85,103,118,106,74,60,69,87,111,109,87,65,46,
-29,21,23,27,29,24,16,13,10,8,7,6,5,4,4,0,0,0,0,0,0,0,1,2,3,5,7,9,11,15,23,42,60,72,85,89,85,84,85,76,72,82,79,82,74,62,42,27,
-30,52,77,106,120,117,103,77,71,85,115,127,131,103,76,54,44,30,34,45,46,34,23,17,13,11,9,7,6,5,4,0,0,0,0,0,1,1,1,2,4,6,7,9,10,13,19,30,
-42,54,66,74,66,63,60,57,60,63,71,71,71,63,56,46,50,62,79,103,108,101,99,96,92,115,132,141,131,109,79,60,48,41,39,53,53,44,34,23,19,16,11,9,7,6,3,0,
-0,0,1,1,1,1,2,3,4,6,7,9,10,11,16,22,34,45,50,56,53,44,39,42,42,41,48,56,57,56,57,66,74,77,74,77,81,87,96,106,120,139,145,141,131,103,76,57,
-45,42,45,50,53,52,41,39,28,20,15,12,9,7,4,0,0,1,1,1,1,2,3,4,5,7,8,10,10,11,14,22,29,36,41,45,39,34,34,31,31,31,36,42,44,53,66,82,
-89,82,66,69,76,74,82,103,124,134,131,120,108,82,66,48,38,36,39,42,50,54,56,60,45,27,18,15,11,8,5,0,0,1,1,1,1,2,4,6,6,7,9,11,11,13,17,21,
-24,30,33,34,30,31,27,21,23,29,33,34,38,57,77,94,94,77,72,81,82,68,68,87,104,106,96,77,66,66,60,46,39,39,38,39,57,66,84,82,65,36,23,17,14,11,5,0,
-0,1,1,1,2,3,4,7,8,9,11,13,17,18,20,21,24,27,27,23,25,27,22,16,18,27,31,29,38,65,85,96,96,94,89,87,82,62,54,76,87,74,63,46,44,46,50,46,
-42,42,39,45,65,82,106,101,76,46,29,22,16,13,7,0,0,0,1,1,2,3,5,8,10,12,14,17,20,23,23,24,28,27,23,21,19,23,20,15,17,27,31,27,34,66,99,106,
-106,111,104,94,92,71,63,69,66,52,44,38,33,38,41,44,46,48,48,56,77,103,120,101,79,57,36,24,20,14,7,0,0,0,1,1,2,4,7,10,14,17,20,22,23,25,28,28,
-28,24,22,18,17,17,17,17,21,29,39,36,46,77,113,129,127,115,104,109,111,97,82,72,56,45,35,32,33,34,40,46,50,50,52,60,77,99,101,91,66,54,40,30,24,18,7,0,
-0,1,1,2,3,6,11,17,23,23,25,29,30,29,31,35,28,23,19,19,20,18,21,22,24,35,48,57,71,91,118,145,139,106,94,111,124,127,106,71,50,41,34,35,33,38,50,60,
-60,52,50,52,66,87,92,69,50,35,31,31,27,23,8,0,0,1,2,3,5,10,17,30,34,38,35,39,44,42,39,38,31,24,23,24,23,23,28,28,28,39,53,72,79,91,124,152,
-150,117,92,113,131,132,115,74,52,42,40,41,46,53,66,72,63,52,45,45,57,84,82,53,33,20,20,19,23,23,7,0,0,3,4,6,10,14,25,41,46,52,62,63,62,57,52,41,
-38,35,36,31,30,29,33,39,39,41,48,74,85,97,125,136,134,125,113,117,127,131,117,81,54,42,38,53,71,77,82,77,62,50,44,44,57,77,79,50,25,17,14,13,15,14,6,0,
-0,5,8,11,16,22,34,48,60,65,82,84,77,77,65,52,56,65,62,52,48,46,48,52,53,52,56,72,91,106,108,108,109,125,132,138,129,118,106,84,54,40,44,66,99,103,89,74,
-60,48,45,48,65,77,81,57,34,23,16,14,11,8,5,0,0,8,12,18,24,29,38,56,66,76,96,101,103,91,82,79,82,94,94,87,77,66,71,82,84,82,82,91,106,103,96,84,
-82,111,136,141,124,97,84,81,63,49,59,81,103,109,94,66,53,45,48,60,76,85,99,92,72,52,34,22,13,7,4,0,0,11,13,17,28,38,44,60,71,87,97,111,115,109,101,111,
-113,109,111,113,103,91,103,118,120,113,113,124,132,122,111,89,82,109,136,134,113,91,82,79,76,76,82,94,108,115,89,62,50,53,57,74,91,109,124,129,115,94,66,40,22,10,4,0,
-0,10,12,15,29,42,60,71,74,85,97,111,120,115,115,132,145,132,125,138,132,125,132,145,148,145,143,157,164,157,134,115,115,132,145,132,115,103,94,85,82,89,92,96,106,99,84,68,
-63,63,65,77,103,129,138,143,132,125,97,60,39,13,4,0,0,8,10,13,22,38,60,76,84,85,99,109,118,120,134,158,165,153,146,153,160,160,155,162,170,173,180,192,202,181,155,152,
-157,162,145,129,122,111,108,103,97,101,96,94,87,79,77,77,68,62,62,72,97,120,146,158,148,131,106,79,45,17,4,0,0,9,10,16,23,33,48,71,91,99,101,89,97,124,153,173,
-177,177,172,170,178,189,188,185,198,212,219,225,224,198,180,183,183,177,165,145,129,120,109,113,118,113,106,89,79,66,72,82,66,60,60,63,76,101,145,158,158,136,106,81,48,17,4,0,
-0,9,10,15,24,34,44,65,91,103,97,84,106,138,162,178,191,195,199,193,199,212,216,216,223,232,236,234,231,216,196,196,189,181,181,169,148,132,132,138,129,120,106,85,71,62,68,76,
-74,57,50,46,56,94,131,148,155,129,99,68,42,19,4,0,0,9,11,13,22,33,48,65,84,94,103,108,131,155,173,193,201,205,207,203,205,225,231,239,241,239,237,236,232,224,210,202,
-201,193,185,178,169,160,165,169,148,120,97,82,63,56,62,72,71,42,34,45,63,84,108,131,136,120,96,62,38,15,4,0,0,11,14,17,21,30,50,63,85,106,115,129,145,165,188,195,
-191,193,199,198,211,229,240,246,247,243,240,237,229,223,218,212,213,208,195,183,185,181,181,181,162,131,101,76,63,54,52,65,60,39,34,41,54,68,87,113,120,113,89,56,31,14,3,0,
-0,8,14,22,23,27,39,62,91,111,122,129,148,167,173,170,158,157,167,183,202,229,241,244,245,243,240,235,228,220,218,221,221,212,208,203,195,191,189,183,169,146,111,72,50,50,52,56,
-53,46,34,25,33,53,79,91,108,108,82,45,25,14,4,0,0,8,17,29,31,30,39,63,94,108,122,125,145,157,150,129,118,118,129,146,178,220,237,237,240,241,240,235,232,226,224,224,
-225,218,213,213,207,198,191,183,172,150,122,84,57,53,54,60,56,50,30,19,25,45,68,77,89,91,66,35,21,13,5,0,0,10,23,33,39,41,52,68,89,101,111,124,131,124,109,94,
-85,96,103,115,153,195,220,227,232,237,240,239,237,236,230,227,226,220,213,208,205,198,191,188,178,155,125,97,76,57,54,63,60,39,27,23,27,31,42,68,74,59,42,27,20,13,4,0,
-0,13,27,35,41,45,57,76,84,85,96,106,101,89,85,82,77,77,89,108,136,169,188,191,208,223,235,242,243,243,239,232,223,211,203,195,195,198,188,185,178,158,132,118,94,66,54,53,
-45,30,23,29,31,24,31,53,54,35,23,20,17,12,4,0,0,14,29,36,36,41,50,68,72,72,76,71,66,72,87,85,82,82,89,115,141,155,157,150,162,199,230,244,248,247,245,240,
-224,199,183,178,185,188,191,180,160,155,146,132,108,91,72,45,27,24,23,28,34,24,25,42,40,23,16,14,14,12,4,0,0,15,25,33,34,39,45,53,65,68,63,50,50,63,77,91,
-91,97,106,136,167,167,153,141,148,183,225,242,250,248,248,243,224,195,177,160,167,178,177,169,153,145,141,134,120,96,74,50,29,23,25,29,30,21,21,28,25,16,12,13,13,12,4,0,
-0,15,23,27,30,39,44,46,53,56,53,52,53,65,77,89,99,108,129,162,188,193,185,162,157,181,212,236,246,246,246,242,230,207,183,162,158,158,150,145,138,131,122,120,99,77,60,52,
-44,39,38,34,25,17,17,21,17,11,9,11,12,8,3,0,0,16,25,28,30,38,35,33,33,38,44,54,62,60,68,87,106,134,150,181,207,218,217,192,178,178,201,220,237,243,243,241,
-239,224,193,169,153,134,129,120,113,111,108,103,84,65,54,48,53,60,52,41,27,17,17,17,13,8,7,7,6,4,2,0,0,16,27,35,35,29,22,20,19,20,30,48,63,65,77,99,
-125,155,173,192,216,234,234,218,199,192,193,208,225,237,243,242,240,232,211,177,148,129,111,111,111,106,96,87,77,60,50,48,53,65,68,52,36,30,26,21,14,9,6,6,4,3,1,0,
-0,14,23,33,30,24,17,14,14,17,25,44,62,66,89,122,148,172,193,203,220,239,243,237,226,212,202,203,217,235,244,246,244,239,225,191,145,122,106,106,99,96,82,74,63,56,53,53,
-57,76,87,71,65,68,53,42,32,21,14,9,6,4,2,0,0,13,17,23,23,23,19,15,15,22,30,42,57,71,101,141,167,188,203,224,234,240,246,246,240,231,212,202,213,234,245,249,
-250,246,231,185,136,111,106,103,87,77,68,62,62,60,60,60,74,87,99,96,99,99,84,72,65,57,46,27,16,10,3,0,0,10,14,15,17,24,24,17,18,27,33,42,62,91,118,157,
-181,199,210,227,239,242,246,247,244,236,219,202,210,234,246,251,252,248,230,180,132,108,89,85,79,60,50,50,53,60,71,76,84,101,120,118,111,115,109,89,87,84,76,45,30,17,5,0,
-0,10,11,12,15,27,30,24,23,29,34,45,72,103,134,160,188,210,218,224,235,241,241,239,236,234,218,207,218,236,248,252,252,249,236,198,146,108,85,74,60,53,45,46,53,62,74,79,
-99,124,141,134,118,122,124,111,101,89,63,35,20,12,4,0,0,9,10,11,15,19,24,33,34,31,35,50,68,96,129,148,173,199,211,218,226,235,235,229,224,228,225,223,231,241,250,253,
-253,251,242,218,177,138,109,77,63,56,54,53,62,76,82,91,115,136,150,150,141,131,132,129,108,77,45,22,13,8,3,0,0,7,7,9,11,14,23,41,46,39,45,57,68,79,97,125,
-146,160,181,205,225,228,225,221,218,226,232,234,239,246,251,254,255,253,245,232,212,188,157,120,96,79,74,71,72,85,97,120,134,138,146,153,150,150,148,131,101,72,44,21,11,7,3,0,
-0,5,5,6,9,12,20,38,52,53,52,56,65,65,72,96,108,125,153,183,206,205,195,191,196,212,225,231,240,247,251,254,255,253,249,242,235,229,210,172,138,125,103,85,77,84,97,131,
-141,125,124,138,148,150,153,136,111,82,52,29,16,10,4,0,0,4,4,5,8,14,18,36,52,54,56,53,45,53,65,74,85,111,136,157,170,165,152,146,153,172,198,220,237,246,251,253,
-253,251,251,249,247,246,239,221,191,162,129,94,74,76,91,113,122,113,101,108,129,131,138,146,132,99,74,46,29,19,9,0,0,3,3,5,7,13,23,39,53,60,57,48,41,46,62,66,
-77,94,113,138,143,132,117,115,122,145,178,207,232,243,247,249,249,249,249,251,253,251,248,239,224,193,155,118,94,84,89,103,103,96,89,84,87,109,131,153,145,118,91,65,45,30,14,0,
-0,3,3,4,7,13,25,39,53,56,53,53,54,57,54,57,71,74,89,122,132,124,113,124,139,162,189,206,218,234,239,242,243,246,249,251,251,253,251,244,232,210,180,146,122,101,89,91,
-91,85,77,71,74,85,111,145,141,125,99,76,56,39,16,0,0,3,4,5,10,18,33,45,50,46,50,54,60,60,52,54,65,71,84,111,127,127,129,150,173,186,191,196,196,207,217,227,
-234,240,243,244,246,249,249,245,235,217,198,170,143,111,91,84,72,66,54,50,62,76,99,122,125,108,89,84,66,38,16,0,0,4,5,7,13,23,41,56,62,52,53,57,54,48,50,62,
-68,76,85,104,117,117,127,153,177,188,180,169,165,177,188,199,213,225,225,225,227,236,237,239,237,223,207,173,145,120,96,65,46,34,28,30,44,60,76,89,94,82,72,79,71,42,14,0,
-0,4,6,10,17,29,48,65,68,66,66,60,53,45,46,56,60,65,74,89,103,96,106,134,157,170,167,158,164,164,162,173,192,196,191,193,199,208,220,228,229,221,203,173,146,124,91,54,
-31,18,16,17,24,36,50,54,56,53,52,62,59,32,13,0,0,4,7,11,19,30,48,62,76,84,84,66,62,60,48,44,44,50,65,76,92,89,96,109,129,152,157,169,173,158,152,165,
-173,162,158,165,167,178,195,212,213,203,191,178,158,131,94,48,23,14,10,11,13,19,27,31,33,31,33,41,44,20,10,0,0,4,7,10,18,35,48,63,79,87,82,68,60,62,54,41,
-34,44,56,71,84,89,99,108,132,152,164,189,180,155,148,145,136,125,124,132,136,148,165,183,195,192,183,169,148,131,87,44,20,11,8,7,9,11,16,20,20,20,23,31,29,18,10,0,
-0,3,6,10,15,29,42,53,63,63,54,57,53,46,42,38,33,38,46,68,84,94,108,118,139,157,172,192,189,148,129,118,106,101,96,97,108,118,136,160,177,177,169,158,141,111,77,39,
-18,11,8,7,8,10,14,16,15,16,18,18,18,17,13,0,0,3,6,8,11,19,31,42,50,44,35,30,30,29,30,33,33,34,46,76,85,96,111,127,145,160,170,180,170,143,113,97,
-87,74,74,82,87,94,108,134,155,155,153,143,125,97,66,39,22,13,9,8,10,12,17,17,14,15,14,14,16,18,16,0,0,4,6,6,9,13,19,27,29,30,21,14,13,20,27,31,
-35,45,63,79,97,108,113,124,150,162,162,157,145,125,103,87,72,60,54,65,74,74,87,113,134,136,136,125,108,82,62,38,23,16,11,11,13,17,22,22,17,14,14,13,13,15,14,0,
-0,5,7,6,7,9,13,17,19,18,13,8,9,14,23,33,48,62,74,99,122,122,125,136,150,155,150,131,120,111,97,74,62,48,41,45,53,60,71,87,108,124,122,101,89,77,56,38,
-25,17,15,15,20,20,23,23,18,13,10,9,9,10,10,0,0,5,6,5,6,7,9,13,14,13,9,8,9,12,20,39,63,76,91,113,129,122,124,134,145,143,143,120,108,94,77,65,
-52,39,34,33,35,45,57,71,89,99,103,85,79,66,56,39,23,16,14,15,19,18,19,18,15,10,7,6,6,6,7,0,0,7,7,6,5,6,7,9,11,10,8,8,9,13,23,46,
-72,84,97,115,124,115,111,125,136,132,120,97,94,79,63,46,36,29,23,20,24,31,39,46,56,74,79,79,79,66,54,33,19,13,11,13,14,13,14,14,11,8,5,4,4,4,5,0,
-0,7,7,5,5,5,6,7,7,8,7,7,9,15,27,48,72,85,91,101,108,101,108,120,122,108,94,82,71,65,50,31,23,18,15,14,16,19,24,33,42,57,65,76,76,66,50,30,
-17,11,10,10,10,11,11,10,8,7,5,4,3,3,4,0,0,8,8,7,5,5,5,5,6,7,7,7,10,17,28,36,56,71,76,85,84,89,97,103,103,94,77,66,57,53,38,23,
-14,10,8,8,9,12,17,24,38,46,57,72,77,66,50,29,17,11,9,9,9,9,9,8,7,5,4,3,3,3,3,0,0,8,10,7,7,5,5,5,6,6,6,7,10,14,23,28,
-36,46,56,63,65,66,74,84,85,77,66,62,53,36,27,16,9,4,3,3,5,8,12,21,33,42,50,65,77,66,45,26,16,11,8,8,8,9,7,7,5,4,4,3,3,3,3,0,
-0,4,9,9,7,6,5,6,6,6,6,6,8,11,16,21,23,31,38,42,42,45,50,57,63,57,57,48,36,25,18,10,4,1,0,1,1,3,7,15,25,36,46,56,65,54,38,20,
-12,9,9,9,9,8,7,6,5,4,4,4,4,4,3,0,0,1,4,7,7,7,6,6,6,5,5,6,7,7,10,13,15,19,23,23,24,24,27,33,38,39,38,36,28,18,11,6,
-3,0,0,0,0,1,3,7,14,24,34,41,41,32,18,11,8,8,10,11,11,10,9,7,5,5,5,5,5,4,3,0,0,0,1,3,5,5,4,4,3,4,3,4,3,3,3,4,
-4,5,6,7,7,7,8,10,11,12,14,14,14,11,8,4,1,0,0,0,0,0,0,1,3,7,10,10,9,8,6,4,5,7,9,12,11,10,8,7,6,7,6,5,5,4,2,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-
+/* data from presmoke2.raw, 4096 bytes */
 
-unsigned char presmoke3[SMOKETEXSIZE][SMOKETEXSIZE] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,2,2,3,5,7,7,6,5,4,4,4,6,6,6,10,17,23,22,20,17,14,
-10,8,6,4,3,2,1,1,1,2,2,3,3,3,3,3,3,3,3,3,3,3,3,3,2,2,2,2,2,2,3,0,0,0,0,0,0,1,1,2,3,3,4,4,5,6,8,9,
-9,8,7,6,7,9,14,19,23,36,50,59,68,73,68,59,50,31,17,12,9,7,5,4,3,3,3,4,4,4,4,4,3,3,3,4,4,4,4,4,3,2,2,2,2,2,3,0,
-0,0,0,0,0,2,4,7,9,9,9,9,9,11,12,12,12,11,9,10,11,14,19,29,38,53,74,105,125,132,123,123,101,76,52,39,24,17,12,11,7,7,6,6,6,5,5,5,
-5,5,5,5,7,8,7,7,5,4,2,2,2,2,4,0,0,0,0,0,2,4,12,22,29,27,23,18,18,17,17,18,16,15,17,18,17,17,24,31,44,53,81,132,163,168,177,163,
-149,132,112,91,67,41,31,24,18,14,11,9,8,7,6,6,6,7,8,9,12,12,11,11,7,5,3,3,2,3,5,0,0,0,1,2,5,13,26,52,60,45,44,36,30,26,23,22,
-22,23,26,29,31,29,25,27,38,52,84,132,168,172,180,173,172,162,149,130,101,83,60,50,35,25,18,13,11,9,7,7,7,11,12,11,11,11,14,16,11,6,4,4,5,5,8,0,
-0,2,3,8,19,35,56,81,84,65,67,62,49,34,25,23,23,27,32,35,36,38,32,25,31,53,86,116,142,155,163,177,185,177,162,141,128,116,91,67,49,38,25,16,13,11,9,10,
-12,13,15,17,16,15,16,16,14,7,5,5,7,7,10,0,0,5,9,22,32,67,84,93,93,83,91,93,70,53,35,20,16,26,35,31,33,45,41,32,43,60,83,114,130,135,158,173,
-185,194,173,141,128,128,107,83,65,46,27,19,18,14,14,17,20,20,23,27,33,31,23,20,13,8,7,8,7,8,8,0,0,9,17,27,46,68,84,91,95,93,101,96,83,68,43,25,
-22,40,49,33,38,52,52,46,52,73,86,112,139,149,163,185,188,202,189,144,114,123,125,107,84,58,38,31,28,22,20,24,31,40,49,52,56,49,31,24,17,12,12,11,11,9,7,0,
-0,8,20,31,44,53,62,70,78,86,83,81,78,70,52,43,50,67,73,56,43,53,58,67,67,81,107,132,162,170,192,216,222,212,192,141,132,141,153,133,103,86,73,62,55,32,21,27,
-45,63,84,98,79,58,34,21,21,18,19,18,17,13,7,0,0,7,13,19,23,26,32,39,43,58,58,65,74,86,86,74,78,84,78,73,62,68,70,88,100,112,155,177,212,222,227,240,
-240,228,192,160,153,160,167,163,142,123,110,101,78,40,22,28,46,84,117,116,89,59,43,35,30,36,35,29,23,16,8,0,0,5,7,7,9,14,14,19,24,36,45,60,81,110,123,101,
-91,107,101,74,67,91,112,128,144,156,177,208,234,247,249,247,240,219,194,189,177,170,173,180,173,149,139,139,105,56,25,21,41,83,119,116,84,68,68,76,58,53,50,39,25,16,9,0,
-0,3,3,3,5,6,7,10,15,25,35,58,84,114,125,114,107,116,116,93,78,105,148,155,170,191,178,191,224,244,251,246,234,205,182,173,177,178,178,186,186,168,151,148,123,78,36,24,
-39,91,125,114,81,91,121,125,103,88,65,45,27,15,8,0,0,2,1,2,3,4,5,8,11,18,29,46,70,96,110,121,130,132,112,116,128,135,149,173,195,194,160,148,173,219,238,230,
-216,189,149,132,144,168,172,160,162,167,158,155,144,123,76,50,60,121,144,119,96,116,155,173,153,112,83,50,32,16,8,0,0,1,1,2,3,3,5,6,8,11,17,30,49,84,112,128,
-149,153,144,148,155,163,167,186,201,186,156,137,142,173,192,183,156,135,107,84,101,135,153,139,141,160,170,162,160,160,132,116,123,149,168,149,123,133,185,206,177,125,88,59,31,14,7,0,
-0,1,1,2,4,4,5,6,6,7,10,18,35,76,123,144,162,167,178,185,188,194,192,194,205,209,195,165,151,155,139,117,84,76,79,73,73,84,114,144,142,142,151,162,172,170,162,172,
-192,183,172,175,156,173,216,230,197,130,93,58,30,16,7,0,0,1,2,3,4,4,5,5,6,6,8,14,29,65,114,142,172,186,195,209,213,215,215,209,218,230,225,205,195,170,107,70,
-50,48,67,68,63,52,70,121,133,130,132,144,170,173,185,206,216,198,191,205,206,219,236,231,205,153,93,59,33,16,7,0,0,2,3,4,4,4,5,7,8,7,8,14,27,53,95,135,
-177,204,216,212,213,222,237,237,231,224,220,225,222,197,139,73,46,38,49,71,65,56,60,86,123,132,121,123,148,172,208,228,225,216,215,219,224,236,235,219,197,151,105,65,38,18,8,0,
-0,3,4,5,6,6,8,11,12,11,11,15,27,50,86,139,185,215,221,201,212,227,237,242,236,224,213,216,206,194,177,119,68,40,45,63,59,63,83,83,96,103,103,96,119,170,212,229,
-231,224,221,213,210,230,225,204,182,155,114,76,44,23,9,0,0,3,4,6,8,12,14,13,14,13,14,18,26,50,93,168,205,204,198,197,210,230,236,236,232,231,218,189,170,175,188,162,
-101,50,38,39,44,58,74,74,67,65,76,81,103,153,192,215,232,229,213,177,155,177,185,173,173,160,114,74,49,25,9,0,0,7,7,8,13,19,23,17,14,17,19,20,24,39,103,189,
-212,192,188,209,227,230,230,228,222,223,208,170,148,158,185,160,105,58,31,30,44,63,59,60,58,45,59,86,114,139,160,197,216,210,182,144,123,135,149,135,135,128,107,74,44,25,11,0,
-0,10,12,13,19,29,29,25,19,17,14,13,15,38,105,170,204,216,227,237,238,232,223,208,201,201,194,180,153,135,132,114,81,46,29,35,50,55,43,36,43,43,73,110,123,121,141,180,
-185,158,125,121,130,123,119,96,95,101,86,59,36,23,11,0,0,14,21,22,29,36,38,31,21,19,14,13,13,31,86,149,201,229,242,241,236,236,223,195,192,201,198,198,177,155,135,88,
-52,39,38,40,44,41,39,31,36,56,100,139,135,121,133,163,167,128,107,101,100,100,91,70,78,84,70,41,25,20,11,0,0,14,26,38,45,46,44,39,33,35,30,20,17,32,73,126,
-185,225,234,231,227,230,224,216,201,197,208,212,204,195,167,93,40,31,41,35,34,45,50,44,58,96,135,173,167,151,153,153,158,141,103,76,68,62,62,62,65,70,58,33,23,17,9,0,
-0,12,30,44,56,62,62,52,52,56,45,28,25,30,40,70,130,191,220,216,204,215,224,224,212,204,209,210,205,192,148,76,35,28,30,30,29,53,79,74,88,123,149,180,188,172,158,153,
-139,112,84,68,53,45,45,56,59,52,38,23,18,15,9,0,0,7,30,46,60,86,96,68,65,86,76,44,29,24,21,34,81,117,151,178,185,197,215,229,227,218,198,178,158,133,98,56,
-29,25,24,27,41,81,105,93,100,123,144,170,173,170,151,142,112,73,60,67,52,38,44,45,39,30,24,20,17,14,7,0,0,5,21,45,73,110,130,110,103,116,105,76,55,36,24,30,
-52,68,93,149,189,195,204,227,229,219,192,177,155,112,73,49,25,20,22,27,49,84,107,132,135,133,151,177,170,168,167,148,107,67,53,50,41,32,31,31,29,22,20,17,14,11,5,0,
-0,4,18,58,100,130,149,167,163,144,132,126,126,86,48,46,59,73,93,155,200,201,191,202,218,223,218,202,178,142,88,36,18,11,13,22,30,67,112,153,173,170,178,192,192,186,168,153,
-114,83,60,39,29,30,27,22,21,21,18,16,12,9,2,0,0,4,23,74,128,160,180,209,205,173,158,178,170,121,79,78,93,81,105,158,202,204,185,188,206,209,201,180,163,130,67,29,
-16,12,18,28,38,65,116,160,192,182,182,195,186,178,167,149,128,112,76,45,33,26,24,20,18,19,19,13,10,7,1,0,0,6,32,95,155,201,218,230,230,204,185,177,144,105,84,98,
-116,103,112,163,205,191,163,178,198,172,144,141,116,70,32,24,22,21,30,46,62,74,123,189,205,189,172,160,149,149,153,151,141,116,78,62,44,27,26,22,23,23,18,13,10,5,1,0,
-0,8,45,123,195,225,240,243,239,224,202,162,114,74,68,96,135,146,149,189,215,185,146,160,160,146,128,107,68,45,29,26,32,35,49,62,74,76,107,185,213,201,173,144,125,125,141,139,
-123,96,70,78,68,50,38,32,30,27,21,13,9,4,1,0,0,12,73,158,209,236,244,248,245,228,214,185,107,56,58,103,170,209,230,234,223,183,156,153,153,156,135,93,67,67,60,45,
-36,41,73,96,84,68,96,162,204,201,186,172,139,119,112,107,96,78,70,88,91,62,50,50,41,29,23,17,9,5,1,0,0,17,93,167,209,239,246,244,236,223,208,178,116,70,86,149,
-220,246,251,248,234,200,189,185,183,177,148,119,91,74,93,88,73,65,76,96,96,81,112,162,185,197,194,173,151,144,125,112,96,88,91,91,84,73,67,62,44,33,24,17,12,6,1,0,
-0,17,81,151,201,233,242,238,222,216,205,167,123,114,142,198,237,251,252,248,243,234,232,231,218,192,162,149,132,101,107,141,130,91,68,70,81,93,133,177,185,188,177,153,153,160,163,149,
-135,128,107,96,86,76,67,50,43,35,27,20,16,7,1,0,0,14,68,135,195,213,216,212,212,210,194,162,135,162,197,223,237,246,249,247,246,249,248,244,239,230,210,197,186,172,173,178,
-151,114,74,62,62,84,139,177,180,185,180,168,168,177,172,158,141,132,128,116,103,83,68,60,45,31,25,22,15,8,2,0,0,12,58,135,178,189,177,167,185,195,172,144,146,185,216,229,
-236,233,237,244,247,254,255,251,251,248,242,227,219,221,221,201,172,132,81,58,58,67,96,144,177,194,194,186,186,189,178,149,128,130,135,142,135,119,95,84,52,31,23,18,14,9,2,0,
-0,11,49,114,168,172,153,155,155,162,151,142,149,188,209,213,212,205,223,239,245,252,254,255,254,252,249,245,240,236,227,215,197,141,93,74,73,73,84,119,148,155,170,204,213,194,170,135,
-130,141,158,167,173,153,130,112,76,45,23,18,14,9,3,0,0,9,40,89,135,158,163,153,148,139,133,142,160,178,182,167,162,173,209,237,241,245,248,250,251,253,253,251,245,241,235,222,
-205,167,139,121,112,100,93,95,103,101,125,180,208,189,155,141,133,155,189,197,195,178,162,141,105,67,36,23,13,9,4,0,0,8,28,63,105,141,149,135,132,116,119,135,162,153,133,119,
-128,160,192,227,232,236,238,237,245,246,246,245,235,228,229,227,208,182,168,167,149,101,74,53,56,58,88,139,163,155,151,155,167,180,209,209,204,208,194,162,125,83,46,24,13,9,4,0,
-0,7,28,62,98,110,112,105,107,107,116,130,121,105,103,119,132,139,168,213,227,227,225,222,222,215,222,229,221,204,204,229,218,189,194,204,168,95,53,29,30,44,70,114,123,123,144,160,
-172,189,213,208,210,221,213,170,125,84,43,23,15,8,4,0,0,6,23,46,70,76,74,74,78,84,95,100,91,78,93,112,132,133,168,216,230,224,227,228,212,197,197,198,204,210,212,221,
-225,215,219,224,197,123,53,31,43,65,81,86,91,114,130,130,151,173,195,204,213,227,216,178,128,91,52,22,11,8,5,0,0,4,13,31,44,50,44,41,39,53,70,76,78,67,78,88,
-119,162,182,209,234,229,228,236,236,213,195,188,198,230,234,218,219,227,235,236,216,158,93,86,73,76,78,83,100,110,110,95,110,163,168,178,205,222,210,168,125,96,65,29,14,9,6,0,
-0,2,8,20,31,40,35,23,18,30,45,52,52,49,50,84,125,153,192,216,222,225,230,228,228,225,221,205,210,228,225,215,212,224,236,230,197,153,130,133,119,105,100,107,132,130,116,81,
-83,125,144,141,153,188,182,135,107,101,65,35,19,11,7,0,0,1,5,14,21,29,23,13,12,16,22,33,44,45,56,74,107,141,186,222,223,218,216,209,210,230,237,228,215,205,188,186,
-208,223,221,202,180,155,151,155,160,153,151,155,155,132,116,93,93,121,119,91,107,141,128,101,84,73,56,41,24,14,7,0,0,1,3,7,12,14,14,12,10,11,17,35,44,46,68,83,
-107,135,153,194,205,202,197,188,204,216,228,223,192,158,153,149,170,202,202,173,167,170,168,162,172,172,182,198,173,135,114,101,107,119,93,65,70,78,83,59,53,56,56,49,27,12,7,0,
-0,0,2,3,5,6,8,10,11,9,17,39,56,60,78,110,128,121,130,144,163,177,180,182,194,195,180,170,144,119,114,96,96,132,168,170,151,168,170,155,170,182,186,195,172,163,141,103,
-96,81,73,60,43,41,38,36,50,56,50,44,24,14,6,0,0,0,1,2,2,2,4,8,12,14,21,49,81,88,110,139,132,123,116,114,142,172,173,162,158,155,119,96,96,83,83,81,
-83,96,141,170,170,170,173,162,172,186,185,173,168,177,160,132,112,65,50,45,31,32,32,38,43,45,44,36,25,14,5,0,0,0,1,1,1,1,2,6,11,22,43,60,105,132,153,163,
-141,112,100,103,121,156,160,130,105,112,88,62,65,56,65,93,96,114,149,173,194,182,177,170,167,172,158,142,155,177,172,153,125,67,35,30,29,28,30,36,39,43,43,35,26,14,4,0,
-0,0,0,0,0,0,2,5,13,31,65,83,121,158,178,172,141,114,100,101,100,116,125,117,93,73,65,60,58,53,58,81,91,95,121,167,194,189,189,189,180,177,170,139,132,158,162,144,
-93,44,22,17,19,22,28,35,39,41,38,33,22,13,4,0,0,0,0,0,0,1,2,7,18,44,93,119,133,168,170,155,135,128,125,130,108,84,88,116,108,86,78,68,53,56,50,50,
-65,67,84,128,153,189,212,208,212,208,194,167,142,139,123,103,56,31,17,12,14,23,28,35,41,36,35,25,16,8,3,0,0,0,0,0,1,1,3,10,27,68,116,151,167,168,163,128,
-112,139,156,153,110,70,84,139,163,135,114,103,86,68,65,43,43,65,68,88,128,178,225,225,227,227,198,160,119,100,88,68,49,39,23,13,13,18,25,38,50,41,30,19,11,6,2,0,
-0,0,0,0,1,2,4,12,35,83,123,155,172,178,172,139,130,173,183,160,119,86,116,156,188,173,144,133,121,100,74,39,32,45,60,74,116,178,225,230,234,225,185,121,67,52,65,53,
-45,36,24,18,15,18,24,32,43,38,29,15,7,3,2,0,0,0,0,0,0,1,3,11,35,95,149,163,173,192,185,153,160,194,200,158,103,91,126,158,175,185,172,162,144,123,88,49,
-40,40,50,65,95,158,210,219,224,204,142,88,45,43,56,50,44,43,35,21,15,16,19,24,24,29,23,10,4,2,1,0,0,0,0,0,0,1,2,9,36,95,148,168,178,182,186,185,
-188,206,212,163,98,74,93,110,132,155,167,170,155,116,83,65,53,44,41,56,67,103,151,182,182,163,128,88,60,59,52,45,52,53,45,24,14,13,16,14,14,14,12,6,2,1,0,0,
-0,0,0,0,0,0,2,9,33,88,132,148,160,173,178,192,202,209,206,183,135,91,63,59,76,107,135,153,142,108,83,65,45,38,41,48,53,68,103,135,139,121,107,84,78,96,74,67,
-68,73,58,32,16,14,16,13,8,7,5,3,1,0,0,0,0,0,0,0,0,0,2,8,30,70,101,116,133,155,168,180,180,182,191,195,173,119,63,45,52,79,110,114,114,95,73,50,
-31,31,41,49,45,43,59,81,105,93,81,74,88,112,107,95,78,93,79,44,27,22,23,15,8,4,3,2,1,0,0,0,0,0,0,0,0,0,2,7,23,53,74,91,110,128,155,168,
-162,182,195,201,186,123,73,53,49,79,95,91,93,84,62,41,27,29,41,49,46,36,45,60,65,59,59,83,101,114,125,112,103,100,88,56,40,34,27,15,8,4,2,1,0,0,0,0,
-0,0,0,0,0,0,1,4,14,32,49,60,76,95,128,149,163,186,201,186,168,105,68,58,65,81,89,76,62,58,48,35,25,25,34,49,52,59,73,78,52,43,52,81,101,101,107,119,
-119,101,78,50,38,28,22,14,7,3,1,1,0,0,0,0,0,0,0,0,0,0,1,3,9,19,32,39,52,74,95,128,158,163,172,168,139,76,49,45,55,71,65,53,39,32,26,17,
-16,21,32,48,60,74,81,83,70,50,46,62,76,86,88,100,95,74,45,26,22,19,14,8,5,2,1,0,0,0,0,0,0,0,0,0,0,0,1,2,7,14,20,24,33,46,67,91,
-123,130,132,137,100,65,40,34,36,40,35,30,22,17,12,8,9,13,18,33,49,73,70,73,70,49,41,50,53,68,78,62,43,29,19,11,9,7,5,3,2,1,0,0,0,0,0,0,
-0,0,0,0,0,0,0,2,4,9,13,17,22,32,45,53,76,88,88,83,65,45,29,26,24,21,18,14,9,7,5,4,5,7,10,16,30,52,56,49,41,29,29,35,41,52,49,32,
-17,12,7,4,3,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,5,7,9,14,20,25,36,43,50,44,33,27,24,17,16,14,11,8,7,4,3,2,2,
-2,3,4,6,12,27,33,24,16,12,13,20,29,28,21,12,7,4,3,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,4,5,7,9,13,18,
-20,16,12,8,7,5,5,4,4,3,2,2,1,1,1,0,0,0,1,2,3,6,10,9,5,5,6,10,12,9,5,3,2,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+static const uint8_t presmoke2_packed[] = {
+66,90,104,57,49,65,89,38,83,89,172,84,62,123,0,0,7,127,255,255,255,255,255,253,
+247,119,111,182,214,182,173,106,214,171,86,173,90,181,107,86,182,54,182,237,187,222,126,255,
+222,255,255,224,9,223,0,0,212,13,2,128,10,1,69,73,0,10,98,170,126,19,35,38,
+141,50,0,152,19,67,72,212,143,68,0,0,0,13,13,0,0,0,0,0,218,70,134,64,
+52,50,6,128,200,104,100,211,65,160,208,34,169,254,66,9,140,152,4,1,2,38,41,146,
+61,70,158,160,245,0,50,13,26,1,160,1,160,52,0,12,134,128,0,0,0,0,0,0,
+0,64,0,208,26,52,209,160,52,196,24,64,50,50,26,13,13,48,131,4,196,208,104,1,
+160,0,24,38,129,130,100,24,70,131,33,166,152,76,152,128,26,16,0,52,6,141,52,104,
+13,49,6,16,12,140,134,131,67,76,32,193,49,52,26,0,104,0,6,9,160,96,153,6,
+17,160,200,105,166,19,38,32,6,132,0,13,1,163,77,26,3,76,65,132,3,35,33,160,
+208,211,8,48,76,77,6,128,26,0,1,130,104,24,38,65,132,104,50,26,105,132,201,136,
+1,160,106,121,16,154,26,10,106,101,30,160,0,0,0,1,160,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,208,179,133,6,4,166,125,245,56,176,24,35,0,65,14,162,
+211,36,136,144,40,68,100,128,198,236,231,150,23,56,147,60,232,207,133,244,141,38,93,148,
+2,41,33,113,192,193,218,48,132,28,194,4,3,7,48,0,68,194,242,0,134,145,31,201,
+152,50,176,216,4,26,14,18,36,130,72,37,200,10,8,162,17,118,80,116,172,42,203,101,
+32,65,115,52,165,147,176,48,44,224,192,19,9,57,146,14,247,101,92,20,229,3,3,58,
+16,196,24,2,19,6,96,65,12,24,146,172,9,20,138,96,84,30,243,75,39,141,186,89,
+13,57,79,89,57,66,152,73,93,136,169,169,103,4,178,205,48,98,8,6,4,2,178,72,
+145,22,102,201,146,19,76,147,48,70,154,201,44,171,104,180,227,4,66,8,152,160,165,68,
+194,32,16,168,10,137,5,4,205,16,73,33,20,65,206,54,206,165,141,8,130,34,137,200,
+102,37,60,209,46,30,132,49,112,82,78,198,133,221,211,147,109,186,122,178,190,249,95,12,
+175,78,129,32,168,72,166,14,210,189,60,99,87,154,136,171,188,25,216,51,4,158,110,233,
+224,25,49,96,196,212,197,146,14,11,185,186,236,239,2,251,238,205,34,42,147,204,74,182,
+32,166,84,230,18,99,51,57,59,26,197,216,53,13,238,237,99,167,26,38,53,51,21,173,
+4,111,105,84,56,200,137,206,76,109,168,32,135,163,85,192,171,177,96,18,11,61,122,202,
+141,87,109,73,229,126,73,18,34,195,5,114,118,145,35,9,180,67,185,147,38,44,42,228,
+165,131,150,140,238,213,189,137,24,62,41,100,177,212,25,62,41,178,13,34,132,177,105,10,
+197,146,64,144,232,229,138,190,218,86,215,192,139,111,123,153,32,168,8,36,211,104,219,172,
+206,154,4,134,149,76,115,69,16,181,212,38,210,19,146,173,66,4,65,194,66,100,1,19,
+64,226,141,221,47,225,169,61,224,199,8,55,22,35,50,90,50,119,140,116,180,81,134,113,
+51,15,22,150,149,146,208,24,71,61,13,161,203,237,250,117,56,220,42,50,147,50,17,50,
+72,213,168,42,43,10,201,210,114,138,149,191,136,138,248,49,240,191,132,15,200,231,133,98,
+249,201,224,34,12,120,39,181,235,100,204,10,251,39,87,35,18,195,153,164,18,24,80,135,
+79,204,243,60,40,34,16,121,30,21,24,208,155,18,13,142,174,187,244,91,69,132,172,218,
+225,52,206,123,28,131,175,144,93,163,58,150,10,66,96,178,163,89,101,194,112,178,233,5,
+163,112,117,131,165,90,148,48,233,193,96,187,150,245,176,206,121,8,208,202,90,4,203,111,
+219,13,148,149,82,114,147,60,182,146,131,171,13,186,85,84,110,53,53,231,96,201,81,49,
+1,41,181,166,24,110,22,53,164,29,90,115,19,103,150,199,216,103,78,243,24,160,7,4,
+70,115,70,40,65,230,141,243,155,97,31,110,5,125,151,152,108,20,213,80,185,137,114,208,
+130,66,167,6,248,224,113,128,82,152,128,76,254,190,103,214,248,34,8,14,64,196,234,221,
+121,44,70,174,169,47,102,64,178,92,69,177,150,44,182,42,228,73,19,158,183,185,14,170,
+46,86,44,190,194,118,194,41,24,24,193,69,29,122,215,46,67,164,241,10,194,234,234,34,
+17,102,22,214,182,133,23,5,97,136,23,29,21,106,166,169,112,50,107,227,68,54,83,22,
+28,177,108,221,183,108,20,59,106,152,121,228,41,66,90,217,230,124,196,115,208,229,160,180,
+236,110,221,91,51,240,213,86,201,134,165,105,206,198,45,230,26,103,170,169,84,106,26,79,
+1,11,23,183,177,123,178,201,102,6,52,119,133,209,55,35,14,114,61,183,66,115,59,196,
+171,179,83,100,203,135,77,238,109,100,2,154,25,121,15,102,93,26,83,118,6,182,40,29,
+213,99,148,20,172,81,167,102,251,212,108,54,97,153,108,211,3,70,203,204,44,19,44,131,
+134,199,211,169,118,85,228,92,70,86,26,155,10,42,113,153,149,164,39,199,40,178,122,96,
+172,177,202,245,178,162,51,210,16,165,168,221,185,161,131,17,97,117,132,98,160,192,143,70,
+101,137,13,243,60,198,22,220,73,217,66,85,8,145,99,109,205,24,162,25,98,66,36,210,
+219,54,30,87,200,49,220,249,180,12,156,79,75,143,6,63,3,19,162,124,188,159,30,61,
+199,14,88,116,246,239,157,189,164,82,142,72,228,243,140,240,152,121,141,180,166,59,202,174,
+221,74,217,72,155,22,86,124,79,130,198,227,186,115,236,33,222,11,155,20,14,230,77,220,
+121,135,96,206,99,16,97,183,112,138,82,236,18,204,183,1,249,78,126,78,138,47,225,208,
+221,71,29,60,167,71,11,160,171,174,226,114,84,130,249,232,54,91,40,64,105,134,39,159,
+13,180,75,30,85,221,6,187,133,247,158,48,42,220,227,209,9,133,181,156,8,92,243,108,
+202,13,169,140,29,152,108,72,48,215,12,246,17,128,119,136,115,211,53,168,154,116,52,230,
+194,106,239,152,225,66,48,141,46,238,92,176,76,75,203,67,143,81,211,77,136,196,151,0,
+42,167,19,44,200,148,48,79,114,155,186,73,84,234,170,147,66,20,66,128,193,93,100,97,
+108,196,20,6,26,184,199,216,49,226,201,37,123,162,245,222,226,166,246,211,11,207,158,148,
+11,80,218,167,65,62,51,31,85,179,135,151,238,153,27,33,42,105,208,214,148,0,243,104,
+249,170,137,182,77,71,12,10,201,77,91,235,136,148,241,157,25,120,208,238,184,108,7,112,
+138,153,100,239,168,235,115,128,249,91,132,107,162,14,17,63,106,58,73,190,103,24,239,94,
+91,175,139,39,52,179,149,207,125,112,133,117,222,241,130,55,1,71,132,214,243,117,245,169,
+192,158,89,106,96,91,103,21,195,104,153,210,112,76,122,1,15,62,253,173,183,135,130,108,
+7,62,169,246,154,136,156,243,104,20,22,205,75,67,147,77,44,146,75,53,134,38,187,17,
+35,213,216,168,240,5,74,0,134,17,213,140,224,165,236,42,142,184,150,125,141,179,150,124,
+91,45,150,122,156,119,46,227,215,125,119,188,181,213,101,132,200,9,162,33,231,119,247,107,
+90,235,208,51,197,18,168,150,170,31,146,215,4,57,201,207,94,167,162,173,157,92,115,111,
+60,137,90,129,149,212,60,24,205,20,135,62,146,132,198,53,212,97,167,160,125,196,227,167,
+32,140,186,19,16,74,104,18,93,161,145,82,126,94,83,187,133,113,168,219,251,184,229,44,
+227,232,116,210,203,205,126,237,129,49,178,67,51,198,201,86,140,41,188,245,62,120,201,26,
+141,248,237,166,49,177,172,43,165,157,208,61,211,196,224,254,20,148,81,152,47,209,179,10,
+11,177,166,168,176,202,222,115,80,180,117,225,62,226,115,211,30,122,134,70,78,91,163,181,
+13,9,235,29,211,80,221,146,244,220,14,120,56,45,43,31,93,166,114,151,105,5,102,99,
+233,102,47,133,41,202,151,66,232,3,207,104,139,237,42,172,5,30,131,177,2,70,121,36,
+224,159,87,170,44,21,194,179,138,111,168,147,100,176,74,163,200,75,230,49,253,47,71,11,
+108,43,205,94,184,56,102,205,242,150,72,164,221,163,78,233,140,214,148,143,73,227,234,61,
+59,234,92,94,253,102,172,173,126,147,171,28,151,203,16,69,38,70,219,247,206,254,90,113,
+217,92,221,204,204,118,241,160,173,24,167,6,172,208,216,0,134,198,99,107,71,111,164,48,
+198,145,132,86,187,80,135,40,242,6,169,243,113,248,250,160,222,41,46,52,113,57,81,199,
+106,236,174,2,153,202,99,231,222,42,189,96,250,74,22,37,82,87,52,217,17,130,156,121,
+112,117,59,210,59,89,135,74,5,161,192,220,5,207,121,242,224,236,121,154,176,229,163,12,
+109,21,16,99,102,179,32,172,85,44,52,128,114,232,126,84,97,144,237,175,11,237,163,188,
+206,94,180,180,135,175,232,169,114,89,81,122,27,180,197,58,176,125,45,27,236,201,77,80,
+248,66,202,1,170,132,172,16,64,118,147,80,66,96,169,67,100,6,17,107,239,241,61,81,
+176,21,20,194,134,45,80,98,151,177,210,93,237,93,75,111,108,246,209,89,242,162,253,113,
+96,183,4,71,24,67,80,119,123,6,45,66,128,187,86,57,111,147,205,183,92,88,238,44,
+201,57,47,124,14,176,163,194,136,233,126,128,46,251,177,248,142,170,245,189,225,147,199,136,
+225,3,102,16,231,134,10,101,4,0,189,37,242,60,103,237,117,48,220,33,40,79,73,68,
+25,87,136,164,20,212,225,12,171,75,207,222,233,4,199,149,74,194,156,14,106,230,162,140,
+6,206,49,160,141,96,226,250,165,146,185,225,157,121,146,45,166,218,167,48,146,213,116,103,
+222,253,76,62,237,149,235,78,46,54,100,247,140,129,119,170,151,115,178,19,217,238,133,136,
+145,132,147,109,171,182,109,144,151,50,79,167,194,29,99,155,115,76,8,162,154,18,217,68,
+250,66,121,25,33,0,188,182,227,188,89,27,8,235,97,182,170,60,15,72,28,88,216,194,
+14,215,213,180,214,108,8,110,26,223,76,72,52,73,36,43,105,176,187,97,71,19,51,235,
+2,146,82,2,128,91,77,181,90,217,158,5,175,178,158,57,18,148,212,47,10,47,246,253,
+76,33,143,64,94,214,177,40,114,253,184,163,184,72,196,237,183,29,97,211,127,45,103,74,
+66,226,230,21,230,69,22,16,228,196,134,59,181,42,200,230,141,35,211,54,95,103,214,103,
+171,99,254,187,240,206,84,65,236,109,179,216,229,90,147,10,148,225,166,228,32,53,19,139,
+54,135,141,82,5,44,87,35,51,106,75,154,39,189,221,126,222,10,166,159,62,105,218,59,
+82,208,201,134,9,9,29,178,78,105,72,108,174,221,8,195,38,55,193,85,77,163,64,230,
+32,40,206,246,233,40,42,173,220,252,18,50,54,163,161,250,192,125,223,199,184,84,176,1,
+145,37,252,249,50,1,123,132,49,100,77,152,125,244,113,142,164,245,193,186,199,164,104,43,
+139,16,171,106,36,197,185,186,137,165,158,173,246,73,2,124,67,143,230,122,185,151,38,59,
+32,44,19,71,167,241,58,167,55,191,102,12,128,19,1,198,254,65,181,245,11,82,169,106,
+14,244,6,221,192,2,180,102,27,233,83,159,69,67,74,21,114,209,245,180,48,239,216,243,
+153,18,187,22,93,83,94,12,241,138,42,116,199,20,58,51,111,3,61,155,202,118,18,58,
+235,219,194,216,187,29,212,251,118,15,83,107,115,200,212,33,170,213,254,31,141,113,22,50,
+40,120,15,125,175,197,116,6,51,24,181,135,124,99,60,134,176,184,187,251,41,225,112,1,
+23,22,211,217,98,201,145,173,10,155,129,62,107,179,82,206,13,207,174,78,13,173,18,135,
+91,7,234,78,17,160,200,226,93,112,139,6,140,104,6,112,70,254,133,240,148,144,104,175,
+96,139,47,20,13,14,4,10,220,223,206,91,179,240,233,193,224,97,252,19,135,83,143,90,
+105,185,234,152,56,95,132,210,214,244,169,202,37,78,172,63,179,111,7,41,90,172,252,108,
+32,205,244,83,35,133,216,127,116,212,83,212,92,85,10,56,165,68,167,108,39,1,65,152,
+228,106,7,102,41,127,180,70,225,91,2,214,34,63,253,9,245,5,225,66,146,165,73,114,
+254,34,141,28,63,224,206,2,60,41,68,249,16,218,150,216,24,233,92,226,45,163,188,150,
+202,248,140,19,133,248,70,53,48,218,70,47,22,246,80,177,169,93,112,177,193,170,134,184,
+127,226,238,72,167,10,18,21,138,135,207,96
 };
 
+static rsAsset presmoke2(presmoke2_packed, 2892, 4096);
 
-unsigned char presmoke4[SMOKETEXSIZE][SMOKETEXSIZE] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,3,3,4,5,5,3,3,2,2,1,2,2,3,3,5,7,9,10,10,11,12,13,15,12,10,12,12,10,
-10,10,9,8,7,6,7,6,6,5,4,3,4,5,6,6,4,2,1,1,2,2,2,2,2,3,2,1,1,0,0,0,0,2,2,3,3,4,5,5,5,3,3,2,2,2,2,3,
-4,6,9,13,16,18,19,18,20,19,19,16,16,20,20,16,13,15,12,12,12,13,13,13,12,10,9,6,7,8,8,9,6,3,2,2,2,2,3,3,4,3,2,1,1,0,0,0,
-0,3,3,3,4,4,5,6,5,4,3,3,2,3,3,5,7,10,18,27,32,35,40,34,30,25,20,18,20,22,24,21,20,21,18,20,20,27,32,31,22,17,12,9,11,12,12,11,
-7,4,3,2,2,2,3,5,5,3,2,1,1,0,0,0,0,4,4,5,5,5,5,5,5,3,3,3,3,4,5,7,13,21,34,50,54,66,75,57,40,27,18,16,16,20,24,34,
-34,37,33,32,40,60,75,60,47,40,23,17,20,18,17,15,9,6,4,3,2,2,3,5,5,3,2,2,2,1,0,0,0,5,5,5,5,5,6,6,4,3,3,3,4,5,8,13,
-25,45,55,77,85,90,98,80,55,35,24,23,24,25,31,47,57,58,63,60,69,95,121,107,91,88,64,35,25,26,23,15,10,7,4,3,2,3,3,4,3,3,2,2,2,1,1,0,
-0,6,5,5,5,6,6,6,5,3,3,3,5,6,12,25,45,64,88,95,108,117,112,101,73,47,40,35,34,40,39,47,69,75,86,77,88,121,148,152,143,136,114,73,49,45,30,18,
-12,8,5,3,3,3,3,3,3,3,3,2,2,2,1,0,0,6,4,4,5,5,5,5,5,4,3,3,5,8,18,39,64,85,86,95,128,136,129,110,95,78,51,37,30,40,46,47,
-57,58,75,85,105,140,164,186,175,159,142,124,100,66,39,22,16,10,6,4,3,3,3,3,3,3,3,2,2,1,1,0,0,5,4,3,3,3,4,5,5,4,3,3,4,8,20,47,
-69,78,78,105,133,140,135,119,101,101,58,23,20,39,46,37,35,42,66,78,105,128,167,202,193,177,145,147,135,86,50,30,20,11,7,5,4,4,3,3,3,3,3,2,2,2,2,0,
-0,5,4,4,4,4,5,6,5,3,3,2,4,7,16,40,63,67,88,121,145,157,136,108,95,88,64,26,16,22,33,33,28,39,51,69,108,131,159,203,211,186,162,148,129,91,58,34,
-19,11,8,7,6,5,5,5,4,4,3,2,2,2,1,0,0,5,5,5,6,6,7,6,6,4,3,3,3,6,13,28,54,77,107,140,155,145,121,95,85,70,45,27,19,19,23,27,
-37,47,58,73,105,140,157,177,198,185,164,152,110,70,47,30,16,10,9,9,10,9,8,7,6,5,3,3,2,2,1,0,0,5,5,7,8,10,12,10,8,6,5,4,5,7,12,20,
-42,85,133,174,164,131,105,96,83,64,46,34,24,20,15,21,37,57,73,58,80,136,164,165,180,175,155,145,114,66,32,20,15,10,10,13,16,17,17,15,10,8,6,4,3,2,1,0,
-0,5,6,9,12,15,17,13,10,10,8,6,7,11,15,18,35,73,135,169,157,131,107,100,95,86,86,64,40,25,17,26,35,55,70,75,96,117,147,169,174,159,148,145,108,50,20,10,
-10,16,17,20,25,35,37,31,20,15,10,6,4,2,1,0,0,5,8,15,20,19,19,17,16,16,13,10,12,17,21,23,28,49,98,131,133,129,129,131,129,129,124,108,75,40,31,39,
-49,63,88,114,121,110,136,177,183,157,140,114,64,33,15,6,9,20,30,40,57,73,69,58,41,31,18,10,5,3,1,0,0,6,10,18,28,27,31,34,34,26,21,20,22,27,27,22,
-27,49,73,108,133,143,157,159,164,177,167,136,98,66,63,77,78,86,114,131,124,128,148,170,175,145,114,86,49,26,12,9,11,19,37,66,91,98,98,100,83,54,26,13,7,3,1,0,
-0,6,12,19,31,46,58,85,86,67,51,47,46,42,32,24,26,47,86,121,147,154,175,195,202,207,186,133,101,90,105,129,119,117,124,135,143,147,162,159,133,101,80,78,58,25,15,19,
-19,20,35,83,114,108,114,117,107,75,35,16,6,3,1,0,0,7,12,21,33,58,101,133,136,128,98,77,66,45,37,24,22,46,98,147,165,175,196,212,211,191,169,129,110,110,124,145,
-143,135,140,157,162,154,165,148,122,101,60,67,69,33,26,37,41,35,45,107,136,124,135,148,124,85,42,17,8,3,2,0,0,8,13,24,45,86,140,140,148,169,142,91,63,40,34,31,
-30,45,88,142,175,186,203,218,202,157,143,124,112,121,112,117,128,117,129,170,174,140,129,142,143,112,80,86,78,66,73,91,88,70,77,121,154,159,174,186,159,96,54,28,13,5,2,0,
-0,8,13,31,70,119,175,180,175,178,148,96,49,32,25,27,27,42,95,133,164,180,193,188,154,124,122,128,114,114,101,91,108,96,119,154,159,136,110,129,135,108,108,112,110,124,124,145,
-145,117,119,147,165,178,180,186,164,114,70,39,18,7,3,0,0,9,16,37,91,155,206,225,218,188,131,75,39,21,16,19,27,46,91,147,157,157,155,124,91,95,112,119,100,95,90,91,
-119,133,136,148,135,140,142,105,95,95,110,142,164,177,164,164,177,170,162,164,165,154,147,142,140,119,90,51,23,10,4,0,0,15,31,55,105,185,223,235,231,195,143,85,37,21,20,18,
-24,42,86,131,152,136,114,80,67,75,95,96,85,80,73,83,128,162,155,145,140,129,122,105,86,90,98,136,178,185,178,178,189,195,196,195,162,147,129,105,107,112,105,60,33,13,6,0,
-0,22,47,73,117,186,218,221,221,196,175,133,85,67,50,40,37,39,69,100,124,133,96,66,55,60,83,100,100,83,73,80,114,155,155,135,114,78,73,91,88,86,90,114,143,169,180,178,
-196,212,218,212,177,145,114,108,101,90,77,63,45,19,8,0,0,35,69,98,143,185,205,188,186,189,189,178,148,121,85,66,55,46,58,98,105,101,80,64,57,57,64,86,107,95,88,98,
-108,121,128,112,88,60,54,66,70,73,78,85,112,159,178,183,195,206,212,206,189,148,121,108,105,80,69,64,45,23,10,0,0,37,88,124,162,188,189,162,143,167,188,196,185,155,107,64,
-58,64,69,98,98,77,70,75,63,49,55,80,108,110,100,117,114,85,83,90,90,80,63,54,54,64,83,86,100,128,164,188,191,175,170,183,180,164,145,110,91,86,67,51,40,24,13,0,
-0,39,86,135,167,178,152,119,117,142,177,188,191,165,119,95,73,58,63,86,96,70,60,60,50,49,67,85,107,121,110,117,114,86,75,77,78,78,66,42,32,46,80,95,100,110,145,180,
-186,165,167,183,175,155,128,88,67,58,51,49,34,19,12,0,0,40,78,122,143,133,117,95,107,131,157,162,159,133,114,105,69,58,57,64,67,54,49,34,28,51,66,73,100,142,124,91,
-110,142,135,100,75,77,60,21,15,32,55,75,114,140,157,193,198,196,205,196,162,105,66,64,51,26,22,35,32,15,8,0,0,35,70,100,114,124,114,91,96,117,131,112,107,114,101,73,
-69,78,57,40,34,32,46,26,17,40,54,64,95,124,124,96,114,155,157,122,100,80,54,21,17,31,55,90,135,175,188,203,218,222,212,177,124,63,32,40,35,12,9,20,20,12,9,0,
-0,27,47,66,96,121,110,88,85,100,91,78,86,107,108,75,75,85,57,35,32,31,31,23,16,24,33,60,88,100,112,129,140,136,140,135,124,88,55,34,28,45,85,122,145,170,191,218,
-228,223,205,136,83,54,35,30,20,10,4,8,12,12,15,0,0,20,32,54,75,91,95,77,77,91,80,66,73,101,121,107,83,75,69,63,41,30,23,20,21,21,28,58,78,105,129,148,
-165,157,145,152,136,105,77,41,32,47,86,121,140,162,185,212,219,207,183,112,66,41,40,31,13,7,3,4,8,12,16,0,0,12,23,37,55,63,64,63,64,83,85,73,75,107,131,140,
-114,70,69,73,57,40,21,19,28,37,45,50,69,124,174,188,189,186,165,164,154,131,98,57,37,63,78,83,108,162,175,165,159,164,157,114,64,33,27,32,18,6,3,4,7,9,10,0,
-0,6,13,23,34,40,41,47,54,69,83,96,112,129,145,162,131,80,67,85,77,50,32,31,28,40,50,54,90,142,183,193,191,195,178,162,148,140,121,98,75,86,77,66,96,128,155,128,
-101,122,131,98,67,46,30,33,22,10,7,6,6,6,7,0,0,2,6,13,20,26,31,45,49,57,70,107,143,148,157,162,133,90,73,90,80,50,37,33,22,23,46,70,107,140,167,183,
-189,188,185,175,159,140,140,148,133,100,77,77,96,117,117,101,100,105,96,85,77,57,41,41,27,19,12,7,6,6,6,0,0,1,3,9,15,22,32,46,63,63,75,112,143,155,167,169,
-140,108,101,91,57,35,31,32,30,27,40,77,119,128,155,188,199,195,191,186,170,142,148,177,175,145,101,95,101,117,107,85,98,98,78,78,69,50,51,54,43,33,18,11,6,5,6,0,
-0,1,3,7,13,25,42,67,85,86,100,119,131,148,165,175,159,145,117,73,37,20,20,20,27,39,55,107,142,143,162,188,203,202,188,177,178,155,162,193,202,193,164,124,95,91,105,95,
-91,98,88,66,45,41,55,70,64,43,26,18,9,5,4,0,0,1,3,7,18,39,69,101,122,128,128,108,121,143,165,180,165,148,90,39,21,17,18,15,23,42,73,124,140,143,145,165,
-193,195,180,183,189,196,205,212,220,216,195,147,114,117,110,110,107,86,64,49,47,49,69,98,83,49,35,27,12,6,4,0,0,1,3,10,28,70,119,148,165,157,133,119,131,142,169,174,
-155,128,77,33,18,21,25,25,37,49,70,119,142,129,129,145,177,196,198,186,191,223,227,220,227,216,203,186,164,155,142,131,117,69,39,31,41,60,83,96,88,66,37,27,16,7,5,0,
-0,2,5,13,41,101,159,188,196,186,157,147,142,135,143,155,167,122,69,41,25,27,32,40,46,51,90,122,140,133,128,131,162,198,206,189,193,221,227,222,226,221,216,219,202,175,148,124,
-101,60,40,31,34,51,75,90,85,66,42,25,16,9,6,0,0,3,7,17,49,101,165,202,213,208,196,170,142,129,128,140,145,101,57,47,37,30,42,46,42,67,100,133,143,133,122,135,
-152,170,193,199,207,219,227,223,232,238,233,232,208,165,135,105,75,35,28,31,40,50,66,64,67,57,41,27,15,8,6,0,0,5,12,27,60,119,155,202,219,216,205,196,164,136,121,129,
-112,83,67,55,50,60,60,50,75,101,124,170,170,152,121,112,128,135,169,206,223,228,234,241,245,245,236,226,188,145,110,67,46,35,39,35,37,47,63,54,49,40,26,17,10,7,5,0,
-0,9,20,47,90,155,186,205,212,207,206,203,195,165,136,119,88,63,54,60,67,73,78,78,114,164,199,203,178,142,112,91,110,135,155,198,220,238,250,255,255,247,223,188,147,133,108,51,
-47,69,80,54,41,46,51,49,33,25,15,9,6,5,3,0,0,17,34,66,122,174,202,214,208,214,219,203,195,180,157,117,75,57,46,63,75,77,96,110,147,193,214,203,167,135,129,133,
-129,140,154,189,222,237,253,255,255,239,205,165,142,142,119,70,64,75,69,51,47,49,47,37,21,16,10,6,5,3,2,0,0,30,46,88,147,177,195,198,213,219,216,199,189,165,119,90,
-78,77,83,70,83,114,140,147,169,177,159,169,167,157,167,178,167,142,147,195,225,228,238,251,250,232,186,157,154,142,140,107,86,70,47,40,42,40,34,22,15,10,8,5,3,2,1,0,
-0,41,67,117,162,193,185,178,193,199,191,186,180,148,114,86,78,100,117,101,107,140,167,185,195,180,142,124,143,165,178,191,191,169,157,177,203,211,219,239,243,231,186,155,148,148,155,135,
-117,85,50,46,37,31,21,13,10,7,6,4,3,1,1,0,0,46,90,142,175,193,189,165,142,147,152,164,174,155,135,114,101,101,105,114,133,140,162,206,222,203,164,124,121,135,159,186,
-189,188,185,159,159,186,211,223,223,216,186,148,140,164,169,148,129,98,80,67,41,27,15,11,9,7,6,4,2,1,0,0,0,41,77,133,164,170,167,135,110,98,108,122,143,133,112,107,
-96,78,80,95,128,152,180,227,236,219,177,136,133,140,165,191,193,183,170,155,155,191,213,212,207,191,170,133,121,145,157,143,135,124,112,78,49,32,16,13,10,7,5,3,2,0,0,0,
-0,26,40,83,121,124,117,101,95,85,77,96,95,78,75,77,64,54,58,78,119,162,208,239,242,228,196,169,167,189,205,220,223,188,152,142,148,189,220,221,207,183,145,107,88,88,96,101,
-117,121,108,85,67,55,25,12,9,7,6,3,2,0,0,0,0,17,27,46,63,69,75,91,77,51,51,58,47,42,50,63,54,46,47,63,108,170,222,237,243,238,221,211,213,228,230,228,
-223,183,140,112,129,177,211,216,205,169,121,83,50,39,50,70,90,95,100,110,91,69,34,15,9,9,6,5,3,1,0,0,0,15,20,25,30,45,64,83,69,31,27,30,24,28,42,57,
-58,66,55,47,86,167,220,237,245,244,233,232,233,237,233,216,195,167,142,100,110,165,191,193,175,145,110,63,34,22,32,60,86,80,90,133,124,86,57,27,15,10,8,6,3,2,1,0,
-0,12,13,15,16,27,47,55,50,24,15,15,16,18,31,49,67,73,58,45,77,157,208,231,242,245,242,238,231,231,231,211,185,165,143,110,108,159,178,178,162,133,95,54,31,23,35,70,
-88,95,108,142,143,112,70,40,23,13,10,7,5,3,2,0,0,9,9,11,11,12,18,25,26,18,12,16,18,20,28,40,64,63,46,42,83,177,207,205,221,241,244,231,214,218,220,206,
-193,174,147,135,136,164,167,159,154,112,80,70,41,37,57,75,98,135,155,152,155,133,88,57,37,27,15,8,5,4,2,0,0,7,8,10,10,7,7,10,13,16,20,23,32,40,42,49,
-55,49,45,57,90,152,195,199,205,227,227,189,177,185,191,188,185,167,157,152,157,165,159,148,136,112,75,73,75,70,83,110,136,167,180,167,162,148,108,69,47,33,16,8,5,3,3,0,
-0,9,10,10,7,5,4,6,10,16,21,32,51,77,75,67,58,47,49,80,96,119,165,202,211,207,180,145,142,143,145,152,140,133,145,159,169,164,147,129,119,108,90,80,88,107,135,169,
-174,177,185,177,164,148,117,80,49,22,12,9,6,4,3,0,0,10,10,10,9,6,4,8,12,16,27,45,70,101,121,124,101,88,83,95,100,122,159,170,186,178,147,121,121,117,108,96,
-96,117,136,159,154,143,135,112,107,95,110,122,128,147,174,186,189,177,177,175,167,129,98,77,37,16,10,8,6,3,3,0,0,6,9,8,9,9,7,10,13,17,33,64,100,124,159,167,
-164,174,154,131,117,140,152,133,136,140,122,96,100,107,88,73,80,110,133,136,117,105,112,117,107,95,108,170,193,185,185,174,175,177,169,143,107,98,73,49,26,13,8,6,4,3,3,0,
-0,6,7,9,9,9,8,9,13,23,47,98,145,154,183,198,207,214,205,174,152,167,143,91,88,110,95,73,57,55,54,47,54,73,83,90,90,85,101,124,108,110,142,183,199,196,186,159,
-147,154,142,100,69,67,50,25,16,9,6,4,3,3,3,0,0,7,8,9,7,6,8,9,13,23,55,112,159,164,180,216,228,223,220,213,191,162,122,85,75,85,73,50,31,31,26,26,
-33,37,45,49,63,83,112,143,140,152,169,169,183,196,178,148,129,129,112,80,51,41,27,13,8,5,3,3,2,3,3,0,0,6,7,6,6,6,8,10,12,22,47,98,148,154,165,208,
-223,218,216,222,202,152,119,90,77,67,54,32,22,18,15,19,19,21,24,24,34,66,114,138,160,177,175,157,170,177,165,136,117,101,88,60,42,30,17,9,5,3,2,2,2,2,3,0,
-0,5,5,6,6,6,8,8,10,19,39,86,133,157,174,178,198,198,196,196,178,159,133,114,85,51,26,19,15,13,18,16,13,12,13,13,25,49,88,122,135,136,142,162,164,145,128,117,
-105,85,63,45,31,20,12,7,3,2,2,2,2,2,3,0,0,4,4,4,5,6,7,8,10,15,26,50,85,122,142,136,148,165,157,143,122,114,117,129,101,41,15,12,10,10,12,10,
-8,7,6,8,18,39,72,95,93,88,105,122,117,110,96,86,80,75,55,35,23,15,9,5,3,2,1,1,2,2,3,0,0,3,3,3,3,4,6,7,10,12,16,26,41,60,85,105,
-114,117,105,69,55,67,83,105,80,34,16,15,10,7,7,5,3,3,3,5,10,28,50,60,66,69,83,80,64,73,66,51,55,54,45,26,16,12,7,4,3,2,2,1,1,2,3,0,
-0,2,3,3,3,3,5,6,8,9,12,16,20,26,37,60,73,70,57,35,34,42,50,54,51,32,18,13,10,7,5,4,3,2,2,3,5,12,26,45,53,47,50,54,45,34,25,24,
-27,28,20,15,10,8,5,3,2,2,1,1,2,2,3,0,0,2,2,3,3,3,5,6,7,7,8,12,13,13,17,24,34,37,35,30,26,27,28,26,23,21,13,9,7,6,6,4,
-3,1,1,1,2,5,13,28,35,36,33,40,26,13,11,11,11,11,10,7,6,6,4,2,1,1,1,1,1,2,2,0,0,2,2,3,3,4,5,5,6,6,6,8,9,9,10,11,
-15,16,19,21,16,17,16,15,13,12,10,7,5,5,5,3,2,2,1,1,2,4,8,14,18,20,20,21,13,7,5,6,5,5,4,4,4,4,2,1,1,1,1,2,2,2,3,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+/* data from presmoke3.raw, 4096 bytes */
+
+static const uint8_t presmoke3_packed[] = {
+66,90,104,57,49,65,89,38,83,89,62,62,56,184,0,0,9,127,255,255,255,255,255,253,
+239,118,221,173,181,173,106,214,173,86,171,86,171,86,173,90,214,181,182,219,119,119,223,239,
+255,255,255,224,9,159,0,60,7,0,58,66,145,2,82,149,4,136,12,226,170,123,64,38,
+155,67,32,70,4,6,140,131,77,53,26,97,67,2,98,141,26,61,38,129,166,128,208,104,
+104,208,244,128,0,104,12,65,163,65,160,208,0,0,0,21,85,79,255,64,26,52,209,166,
+134,128,26,1,52,9,163,38,145,61,41,182,148,122,67,212,104,0,0,0,0,3,35,16,
+245,13,0,0,0,1,160,209,166,128,0,64,0,208,12,153,6,131,76,152,134,64,12,64,
+25,13,52,96,32,104,26,6,128,0,98,12,154,104,201,163,77,12,134,76,134,16,24,154,
+12,76,64,193,21,63,65,9,129,233,53,50,100,208,167,164,245,13,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,25,0,16,0,52,3,38,65,160,211,38,33,144,
+3,16,6,67,77,24,8,26,6,129,160,0,24,131,38,154,50,104,211,67,33,147,33,132,
+6,38,131,19,16,48,52,200,136,26,147,210,166,128,200,1,160,196,98,26,0,98,13,13,
+6,19,38,154,24,70,134,76,134,77,50,24,16,104,26,50,52,26,52,194,104,105,166,140,
+67,64,3,71,120,70,29,221,216,12,169,156,197,78,156,176,172,134,107,18,4,177,5,16,
+17,82,86,185,82,22,161,23,84,226,219,21,113,9,40,137,221,71,178,179,55,128,153,51,
+48,37,131,144,204,1,105,58,98,5,118,216,174,120,156,217,2,106,236,221,56,73,144,37,
+138,43,10,86,171,36,214,135,182,112,158,229,106,20,149,82,146,162,2,13,64,34,81,104,
+85,56,85,132,72,145,100,17,9,221,58,33,8,64,68,33,52,102,245,212,170,149,130,104,
+130,68,26,235,138,165,40,147,65,37,136,41,18,17,36,74,73,211,70,26,91,107,88,49,
+30,218,149,194,147,82,64,145,115,35,20,80,192,144,161,220,135,97,85,8,186,44,193,117,
+30,98,129,205,196,26,36,74,164,66,104,177,16,140,211,138,20,93,197,21,43,194,227,2,
+162,186,128,139,85,204,67,164,65,46,168,234,145,96,178,236,81,181,43,240,95,21,75,21,
+88,188,85,101,232,60,220,38,196,148,171,113,43,230,230,248,88,144,240,146,69,74,119,177,
+24,48,85,203,61,176,139,83,5,235,14,28,35,17,203,94,97,53,9,32,12,68,64,34,
+252,179,20,111,188,166,231,154,9,204,37,72,80,28,198,6,130,17,35,129,212,115,12,230,
+208,228,42,4,36,159,7,33,109,215,142,102,154,3,139,138,110,70,27,146,128,147,180,146,
+116,64,116,153,102,156,145,120,168,209,75,2,131,10,148,252,110,212,52,202,48,207,50,69,
+249,206,0,196,115,164,24,118,1,73,34,72,31,48,130,216,77,10,113,170,132,98,194,1,
+115,150,32,176,128,73,73,5,203,8,179,13,73,85,96,52,34,82,214,21,133,32,131,44,
+18,79,49,61,40,101,149,168,236,176,210,76,152,78,74,108,12,176,89,160,149,81,24,72,
+163,35,30,82,69,133,122,85,219,164,17,161,185,9,9,122,71,91,51,85,128,209,184,79,
+3,205,46,99,128,182,204,233,153,75,148,216,7,78,77,139,239,38,104,158,19,72,22,54,
+48,68,33,42,161,57,142,226,20,100,161,215,212,37,17,50,133,85,167,53,140,197,70,5,
+212,88,44,30,5,83,19,12,181,90,134,123,46,68,48,58,144,216,137,86,221,11,131,5,
+227,109,167,129,56,176,21,33,76,203,146,181,119,33,197,77,170,195,200,179,237,168,146,174,
+69,22,117,67,28,147,66,90,138,84,0,57,234,117,56,130,233,167,215,124,85,40,83,180,
+240,68,35,206,158,55,93,178,29,133,48,33,121,240,197,91,224,138,215,96,173,115,69,130,
+75,40,151,33,83,145,217,82,25,151,222,89,241,89,112,222,251,249,186,85,213,140,231,141,
+170,66,20,84,43,76,39,168,113,176,72,216,210,137,203,194,106,47,166,211,155,49,209,57,
+138,163,3,137,43,115,235,139,146,182,202,81,193,9,16,187,192,37,114,92,205,187,240,106,
+150,87,180,226,151,157,178,128,120,224,53,24,197,32,162,200,22,29,49,217,140,208,87,199,
+158,132,109,199,68,104,84,165,150,54,150,60,168,46,209,89,165,85,102,76,2,109,222,61,
+47,12,37,29,151,190,27,136,180,172,209,114,116,237,161,194,185,140,161,73,163,8,164,179,
+112,150,152,19,202,254,154,51,91,69,29,10,3,189,82,213,181,171,77,21,105,5,245,38,
+146,11,22,158,110,250,199,17,135,85,160,119,107,147,165,189,136,29,221,102,60,183,223,102,
+203,237,105,24,5,55,192,28,157,165,148,60,91,116,30,221,239,50,62,145,147,71,85,11,
+208,103,229,11,24,206,10,188,215,52,244,137,246,186,182,171,170,235,5,203,217,145,160,228,
+25,5,13,183,200,7,149,168,75,170,253,123,187,232,93,89,178,105,211,77,133,149,199,195,
+88,15,10,193,98,97,196,25,247,59,103,151,50,129,80,64,209,90,119,132,182,222,22,117,
+97,156,16,76,154,42,52,193,78,210,68,243,203,53,209,75,81,179,143,28,170,187,172,242,
+52,147,150,3,74,167,94,190,77,134,54,27,237,140,157,15,2,72,202,231,12,249,160,243,
+28,209,9,14,160,14,159,29,150,216,182,214,238,11,44,214,230,86,30,212,71,47,29,176,
+89,135,44,62,117,169,92,74,51,232,66,86,225,48,40,82,99,228,10,28,157,188,36,232,
+238,111,149,241,88,244,106,216,240,79,12,1,76,148,132,137,151,119,4,168,46,150,251,132,
+179,160,17,80,214,145,66,215,142,137,181,31,190,181,245,135,124,252,53,28,129,35,246,250,
+109,186,172,129,187,69,1,5,237,231,112,18,93,193,149,92,200,227,198,53,33,199,29,230,
+219,8,241,67,89,128,144,42,182,94,48,233,184,77,30,157,35,133,61,59,160,126,11,165,
+175,27,232,59,70,68,76,57,37,144,66,48,202,168,104,136,176,168,246,0,40,9,160,163,
+2,36,50,242,161,57,245,84,1,153,58,212,96,32,153,9,220,12,81,117,8,170,230,119,
+85,193,11,225,86,22,28,117,227,107,68,249,230,151,50,143,163,134,125,190,195,134,211,192,
+174,78,30,120,199,150,16,27,36,203,147,29,76,43,139,16,244,229,81,16,221,33,132,171,
+64,238,187,216,61,106,229,86,147,2,27,162,18,189,110,255,213,40,82,178,195,244,77,77,
+34,24,66,45,194,18,69,163,78,250,250,155,83,90,226,95,213,213,164,248,178,157,10,212,
+235,32,126,232,91,170,168,214,128,12,7,121,62,59,153,180,108,183,195,200,80,162,44,182,
+101,187,17,16,158,55,218,146,77,90,69,204,130,90,220,85,133,92,17,68,198,26,250,71,
+235,217,5,136,142,235,229,78,249,59,78,186,1,19,116,238,59,61,79,40,168,91,0,116,
+162,170,151,65,131,88,161,235,103,101,94,193,230,120,20,48,93,56,131,120,161,108,148,106,
+25,204,239,112,222,123,177,142,226,35,119,173,214,118,242,178,217,148,237,153,53,71,13,240,
+69,54,75,193,131,205,169,9,93,114,11,253,114,108,194,244,202,65,169,100,1,26,58,225,
+239,89,182,237,126,188,181,128,245,207,20,6,203,25,171,42,48,236,169,7,108,222,212,27,
+187,93,24,184,145,54,99,119,8,147,84,130,195,51,182,27,59,117,163,63,76,98,92,135,
+108,145,194,174,31,45,225,167,93,1,218,100,208,239,220,220,226,171,198,160,186,211,119,44,
+59,49,85,14,227,145,131,233,93,69,179,168,109,36,213,75,184,228,228,100,22,38,180,152,
+94,49,111,140,184,73,184,57,182,105,224,181,51,131,137,88,202,166,101,214,86,41,187,147,
+52,98,84,31,192,125,226,251,173,199,178,149,198,215,74,141,91,68,157,165,203,141,99,77,
+92,154,219,148,184,229,61,18,179,232,172,106,71,142,241,20,216,28,12,210,75,12,200,191,
+103,9,168,58,58,200,180,241,42,214,97,252,125,22,231,126,172,233,229,68,21,44,146,174,
+29,61,155,232,117,126,86,254,223,132,80,33,79,72,64,48,57,66,245,121,36,4,54,149,
+158,74,7,50,102,187,110,106,89,184,98,123,253,228,106,99,125,80,205,161,123,15,32,98,
+112,119,29,62,24,99,11,73,218,57,103,214,202,41,105,181,53,251,248,155,77,102,108,172,
+188,64,53,142,27,112,134,44,98,191,188,193,107,187,242,120,97,178,23,251,116,182,116,180,
+78,130,106,88,21,235,78,40,56,153,40,118,101,68,119,124,111,15,14,92,201,113,166,177,
+121,251,194,41,99,42,75,166,146,206,125,251,216,176,96,102,172,36,202,220,142,126,47,193,
+187,231,119,99,160,47,50,52,185,187,133,92,208,202,5,226,210,73,44,151,108,84,133,139,
+125,100,249,245,99,221,208,76,67,25,66,211,50,174,74,235,91,155,110,157,28,219,220,153,
+60,89,4,85,106,151,88,72,89,53,77,208,13,15,46,149,92,168,108,89,181,204,113,88,
+233,41,160,52,242,45,10,176,45,126,89,237,241,30,120,42,177,192,42,56,193,110,131,132,
+225,20,138,54,156,151,198,211,28,121,234,202,65,4,135,100,211,58,163,211,240,132,253,223,
+16,29,222,189,188,8,73,89,220,66,196,86,54,27,86,196,174,131,174,57,156,244,46,109,
+111,4,221,221,6,72,196,109,75,13,51,44,185,150,243,201,72,11,246,238,46,28,171,201,
+94,96,187,159,105,10,224,146,254,44,155,118,144,87,81,110,182,184,125,56,222,125,8,109,
+74,249,13,190,112,121,192,199,211,226,150,233,21,229,28,229,13,19,182,148,28,155,129,61,
+9,6,126,121,123,82,162,115,148,106,163,113,199,184,142,53,176,54,72,8,231,14,195,74,
+201,244,143,4,228,35,14,208,46,198,44,178,2,69,209,109,129,180,215,154,117,128,39,26,
+35,183,177,143,47,47,18,138,70,18,64,78,76,174,2,26,165,134,173,27,86,199,31,148,
+87,60,55,146,232,117,186,214,201,158,165,68,221,208,172,16,40,80,177,207,89,84,118,150,
+214,6,40,96,144,47,142,110,116,246,245,37,135,147,50,124,238,84,55,210,173,157,159,20,
+174,85,114,192,119,178,13,237,13,122,75,28,215,42,228,23,1,234,177,101,150,113,24,216,
+24,120,149,219,124,163,161,245,57,138,2,1,220,16,22,27,237,219,100,144,199,132,227,171,
+23,150,74,25,185,179,29,129,177,210,72,12,13,131,175,176,190,177,186,13,27,203,44,11,
+243,1,147,64,167,215,3,238,196,217,18,124,71,62,178,6,50,43,249,250,154,28,215,196,
+88,40,208,120,43,64,235,196,212,120,198,6,220,129,76,144,164,243,158,211,212,214,230,136,
+76,20,7,233,30,97,87,155,3,5,149,153,18,2,7,67,139,119,39,179,11,32,207,108,
+75,148,57,85,51,18,199,190,48,78,158,34,34,217,199,82,13,74,11,60,186,207,23,68,
+145,140,78,224,194,201,114,164,93,179,200,118,173,224,179,78,160,51,143,140,141,50,204,63,
+104,147,199,194,108,169,88,53,197,17,83,161,89,161,205,68,179,202,147,171,159,98,182,218,
+45,215,203,48,112,177,251,224,196,188,213,185,19,28,122,44,54,116,153,151,225,21,38,216,
+28,123,49,69,119,54,251,164,171,100,51,226,172,207,1,141,48,7,53,255,25,195,79,157,
+241,123,166,37,99,90,39,89,40,216,2,75,6,156,39,6,117,211,55,215,244,245,162,206,
+160,48,236,90,113,212,224,64,179,21,29,104,155,111,3,250,53,194,161,74,148,11,100,147,
+5,175,121,22,89,102,166,193,69,156,148,251,59,161,211,54,141,199,94,208,204,182,185,247,
+186,10,243,231,182,161,78,35,65,135,194,65,148,137,148,231,43,52,16,206,210,137,173,106,
+41,92,82,21,152,231,224,117,106,249,72,173,21,223,33,101,9,12,213,254,63,151,161,198,
+52,231,210,86,144,89,240,86,94,127,209,116,11,97,174,113,52,143,45,63,236,217,250,106,
+179,69,64,111,144,110,95,152,154,219,229,108,162,5,141,150,190,150,243,102,46,197,205,216,
+42,199,26,148,57,36,58,211,42,146,120,203,104,21,58,49,235,104,130,30,168,210,54,48,
+102,50,62,4,207,180,25,244,66,202,153,102,158,141,243,139,121,26,172,45,186,237,18,165,
+78,187,249,119,161,151,239,32,216,212,88,162,88,205,89,193,140,152,73,65,184,11,99,135,
+100,53,248,198,253,200,109,87,192,236,196,98,247,216,177,34,97,0,76,228,34,62,162,181,
+52,133,253,108,143,96,146,105,198,192,144,7,83,250,163,11,184,131,86,18,208,191,145,227,
+177,34,2,99,147,92,124,168,93,225,196,210,252,80,161,48,174,143,224,173,155,21,97,202,
+165,90,209,7,199,58,122,45,35,222,64,95,103,4,0,137,58,180,174,168,7,100,8,48,
+167,113,223,74,253,10,208,244,105,121,42,50,161,178,131,13,16,81,19,216,55,253,60,147,
+175,117,81,169,116,22,21,161,175,77,14,143,64,100,29,119,180,171,215,45,50,74,241,145,
+69,128,34,130,58,4,242,152,59,134,47,189,153,78,125,251,41,90,178,153,195,204,54,117,
+234,218,107,38,35,213,112,164,81,164,180,64,129,179,165,115,168,162,158,81,173,151,62,244,
+35,126,67,58,229,33,42,39,106,145,147,4,135,71,227,244,196,181,206,41,121,37,113,104,
+43,69,60,63,104,59,71,170,193,79,246,111,95,38,159,243,242,110,173,231,109,211,31,248,
+187,146,41,194,132,129,241,241,197,192
 };
 
+static rsAsset presmoke3(presmoke3_packed, 3082, 4096);
+
+/* data from presmoke4.raw, 4096 bytes */
 
-unsigned char presmoke5[SMOKETEXSIZE][SMOKETEXSIZE] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,3,4,7,9,9,8,7,7,7,8,7,7,7,8,10,12,18,24,24,23,22,17,14,14,18,18,14,
-12,12,12,11,11,8,7,7,8,9,11,11,9,8,6,5,5,4,3,4,5,6,8,9,9,6,4,3,3,2,2,0,0,1,1,2,2,4,5,7,10,10,9,11,11,11,11,11,
-12,13,13,12,18,33,53,53,46,45,30,20,20,33,34,27,21,18,17,13,11,9,9,13,15,20,20,19,17,12,9,8,6,5,4,4,5,6,7,8,9,7,5,3,3,2,2,0,
-0,2,2,2,3,4,7,10,14,16,16,15,14,17,20,22,20,17,16,15,21,51,90,109,107,85,48,31,35,51,59,45,37,31,22,15,13,11,13,22,31,41,46,43,37,27,17,11,
-8,7,6,6,6,7,9,10,9,8,6,4,3,2,2,0,0,4,3,3,5,7,11,17,24,25,25,22,22,31,43,43,34,25,18,18,22,48,97,132,141,120,78,61,75,91,100,71,
-52,37,25,22,19,21,28,41,59,64,68,70,61,48,27,15,11,11,9,8,8,8,9,11,12,10,8,5,4,3,3,0,0,6,5,5,7,11,19,30,38,43,45,46,56,59,73,83,
-70,43,27,24,24,37,64,97,116,129,139,138,166,182,174,130,75,43,29,31,35,45,64,83,91,88,78,68,59,45,31,23,19,15,13,14,12,10,9,9,11,11,9,7,4,3,3,0,
-0,8,6,7,12,19,39,53,68,71,65,86,112,112,105,121,93,55,32,22,20,24,31,45,75,125,167,196,219,223,219,182,116,73,56,53,68,81,105,127,132,129,98,70,53,41,30,29,
-27,21,18,19,15,11,8,8,8,8,8,6,4,3,3,0,0,13,8,10,17,30,53,95,114,114,118,143,152,154,155,148,116,64,33,24,21,21,20,23,43,91,154,182,214,233,230,213,
-169,132,118,100,102,114,139,161,167,159,112,75,53,33,25,25,23,20,17,19,14,9,8,9,8,7,6,4,3,3,3,0,0,17,13,18,27,45,73,109,152,169,179,198,199,192,196,184,
-152,98,51,31,24,23,22,24,31,65,130,179,220,238,239,223,209,195,182,159,145,161,174,193,192,166,116,64,48,32,24,19,17,16,15,13,12,9,9,10,10,8,6,5,4,3,4,0,
-0,18,19,20,24,45,78,104,143,179,202,215,228,232,227,223,187,145,90,41,29,32,39,43,53,95,145,193,224,230,231,231,231,224,210,193,181,198,207,196,177,150,112,83,45,31,18,12,
-12,12,11,9,8,11,11,14,16,13,9,8,6,5,3,0,0,15,13,15,20,38,59,91,138,174,206,214,222,237,230,228,216,185,141,78,58,65,68,59,81,114,154,184,205,217,222,226,
-227,228,213,190,181,195,215,185,157,136,102,83,48,24,16,11,10,9,9,8,9,12,16,20,22,18,13,10,7,5,3,0,0,10,9,11,15,25,40,81,141,192,207,206,213,217,219,219,
-219,202,167,127,109,112,97,73,76,114,143,159,187,219,220,217,220,225,216,177,159,157,171,177,150,125,91,51,37,23,17,14,11,11,11,11,12,16,20,24,32,29,20,12,7,5,4,0,
-0,8,7,8,13,24,45,90,157,196,205,202,209,217,222,227,231,214,182,155,145,138,105,75,78,111,132,150,181,214,223,223,219,219,206,166,143,130,139,143,118,97,70,37,24,17,16,15,
-13,14,14,14,16,24,35,41,59,56,33,16,9,6,4,0,0,8,7,8,13,32,73,123,166,196,217,215,222,226,234,244,239,220,193,169,154,136,109,83,78,90,120,152,174,198,214,230,
-231,220,195,161,130,125,132,123,95,59,39,29,17,12,13,13,15,20,23,20,25,45,65,91,112,102,68,28,13,7,4,0,0,9,9,11,19,46,105,145,172,210,231,237,235,236,242,248,
-246,219,195,192,166,132,111,97,83,81,97,143,177,185,202,226,237,227,199,171,138,118,105,98,78,49,28,19,17,17,16,20,24,39,43,32,45,75,109,157,174,145,97,46,17,8,4,0,
-0,12,13,18,35,68,123,167,205,231,241,246,246,243,244,243,240,219,195,193,182,141,116,114,98,86,97,157,198,195,196,207,215,223,213,172,132,97,65,65,65,59,37,22,18,28,40,51,
-59,73,75,70,81,104,152,192,199,174,120,59,21,9,5,0,0,14,18,28,56,104,143,182,207,227,239,245,248,244,243,238,223,202,182,172,169,147,129,129,109,91,104,152,192,207,195,179,
-184,205,210,182,114,68,58,56,52,51,45,30,32,59,75,86,100,112,116,120,130,150,172,205,217,192,120,68,27,12,6,0,0,16,24,41,64,118,157,167,190,223,236,239,240,238,236,222,
-198,192,181,155,141,132,129,136,118,105,123,147,161,181,184,161,172,192,192,164,111,76,70,53,43,35,32,43,62,88,112,118,127,145,155,145,154,177,179,193,199,185,136,73,33,15,8,0,
-0,16,23,43,78,111,143,155,177,203,217,217,226,233,219,190,179,182,169,152,139,129,132,141,138,143,152,157,161,172,167,174,177,187,195,166,138,109,78,53,39,30,29,43,61,91,138,157,
-166,167,167,157,145,159,167,171,177,181,143,73,32,16,8,0,0,11,17,39,83,97,114,145,154,166,164,172,207,223,214,174,164,166,147,141,138,154,166,169,174,179,177,171,174,184,177,169,
-172,177,202,202,167,139,102,62,40,30,28,28,45,100,155,172,192,179,155,152,141,123,120,123,130,150,118,64,32,14,7,0,0,8,12,24,45,58,83,104,111,111,111,132,171,190,182,155,
-143,147,139,130,145,177,187,181,187,193,193,190,182,181,161,136,141,164,179,190,187,155,112,75,46,37,37,39,75,130,174,199,192,172,157,157,150,118,102,90,90,118,97,61,32,13,8,0,
-0,8,8,12,17,24,45,56,65,73,81,91,116,150,143,125,116,112,125,143,172,195,195,161,159,190,198,195,177,174,147,95,90,120,141,159,159,132,97,70,49,48,52,88,147,174,193,198,
-185,179,184,174,152,123,102,73,78,111,97,64,32,15,9,0,0,8,8,8,9,13,24,29,43,61,71,73,81,111,102,71,62,81,127,172,198,206,192,155,147,174,193,202,190,174,150,83,
-53,78,125,127,105,90,71,53,56,73,97,157,196,203,207,207,195,198,198,184,152,118,91,65,62,76,78,59,35,18,9,0,0,9,9,8,8,12,18,24,30,41,49,48,59,76,59,25,
-32,85,152,198,207,205,196,172,169,181,190,216,227,206,155,95,75,88,111,102,71,61,52,37,58,112,157,196,210,210,220,227,217,205,196,166,150,111,78,59,39,43,59,43,33,19,8,0,
-0,10,12,12,13,17,21,29,33,30,32,38,46,59,43,28,39,109,169,193,199,190,172,161,172,187,206,230,236,216,169,114,85,78,76,78,65,56,52,53,73,143,185,202,213,223,233,233,
-227,210,196,155,123,98,64,35,21,24,31,35,25,16,8,0,0,13,18,23,30,41,40,40,38,28,28,35,46,45,39,59,75,125,157,171,171,164,136,111,141,182,223,237,231,207,166,109,
-83,70,61,65,71,78,83,102,130,147,167,207,231,240,241,231,224,224,205,143,86,73,45,19,12,13,16,20,19,12,8,0,0,16,30,43,59,81,78,64,51,37,25,32,39,32,40,65,
-91,116,141,169,159,138,116,97,129,182,224,242,237,209,167,147,118,88,83,71,76,105,136,152,161,154,161,206,231,244,241,234,228,223,192,123,61,40,22,11,8,7,8,12,15,11,7,0,
-0,18,38,53,95,130,132,112,83,56,37,32,33,48,61,68,86,91,129,174,164,125,109,102,130,177,220,242,238,216,205,199,169,132,95,81,97,116,159,182,184,177,171,192,210,224,236,237,
-231,209,159,102,46,20,10,7,6,5,7,9,12,11,8,0,0,24,48,90,150,192,184,164,138,102,83,59,52,70,78,81,85,90,129,171,169,150,120,97,118,172,210,231,237,233,232,222,
-209,185,136,104,105,138,169,190,192,179,169,171,177,185,216,225,215,174,125,86,43,15,6,4,5,5,8,11,12,9,7,0,0,24,65,141,199,224,227,224,205,172,147,129,88,81,88,81,
-83,91,130,152,159,159,132,97,102,164,210,226,239,249,246,238,232,230,206,154,145,169,179,169,159,152,147,157,154,169,192,184,177,130,85,71,39,15,7,6,7,8,13,15,12,8,5,0,
-0,28,81,157,210,233,240,241,237,214,172,154,138,111,85,65,70,88,109,125,139,143,120,98,116,159,203,222,237,251,252,249,248,247,234,198,184,181,171,143,120,127,125,147,159,177,177,132,
-100,65,51,53,38,21,15,15,16,19,24,24,15,7,4,0,0,29,75,141,192,222,236,237,231,207,161,147,143,132,112,61,46,70,86,90,100,104,100,127,167,172,185,207,227,249,255,254,
-250,246,236,220,199,181,166,145,105,105,120,152,179,192,167,95,48,35,32,30,28,30,30,29,37,39,41,32,17,7,4,0,0,25,64,123,177,216,235,236,234,220,185,166,152,139,104,70,
-58,61,73,85,98,90,105,157,177,181,196,198,226,246,253,255,251,245,237,230,217,185,147,125,91,86,136,169,179,181,154,95,53,39,28,24,28,33,40,45,53,48,43,37,17,7,4,0,
-0,18,44,100,181,213,231,241,239,234,222,206,181,120,78,88,86,59,51,71,104,116,138,164,161,182,203,206,225,237,247,253,252,246,241,236,219,169,114,91,90,111,152,174,171,147,139,123,
-90,64,40,38,38,37,33,31,38,41,40,29,15,8,4,0,0,11,24,68,139,179,209,228,228,228,227,219,167,98,71,78,75,58,48,61,97,132,139,136,130,164,196,205,219,233,240,248,
-246,237,239,239,225,169,114,90,90,104,125,138,143,125,123,136,138,118,88,68,52,35,27,26,37,48,48,28,15,8,5,0,0,8,14,30,64,112,154,161,185,213,213,184,120,83,61,51,
-48,49,58,73,98,139,130,97,98,138,181,199,213,225,230,234,226,214,220,231,222,190,150,97,76,88,85,95,123,127,123,136,159,172,147,109,88,52,35,43,59,71,52,31,18,11,6,0,
-0,8,9,12,27,59,102,116,132,166,166,138,100,78,48,32,31,43,62,76,102,118,123,91,85,112,139,167,193,207,207,198,184,179,182,187,179,159,130,90,78,91,88,85,112,147,172,182,
-193,202,174,121,86,61,55,58,75,75,51,38,21,14,8,0,0,8,7,9,15,32,68,97,114,116,104,97,88,64,43,27,27,53,73,76,98,100,104,88,73,95,98,114,159,174,166,141,
-129,154,157,138,120,95,78,76,81,90,98,102,129,193,222,231,238,221,174,114,81,71,70,71,78,65,48,40,26,17,12,0,0,8,8,9,14,19,31,62,76,70,65,70,65,52,35,23,
-21,37,52,78,95,83,75,75,75,85,91,98,120,132,123,100,102,123,127,112,98,62,51,61,71,91,105,114,164,223,241,244,245,230,190,148,123,120,105,118,121,80,52,37,31,21,14,0,
-0,12,12,12,14,12,16,32,38,37,48,64,68,46,32,24,17,19,41,95,102,64,51,53,71,86,95,100,90,104,114,111,104,105,104,98,95,59,41,56,64,88,102,120,181,225,242,238,
-231,232,230,219,199,181,167,190,189,120,61,39,29,24,16,0,0,10,13,15,13,16,17,19,27,37,49,73,78,51,35,35,28,31,68,112,102,61,40,43,51,61,71,83,76,88,114,111,
-104,97,91,109,104,64,38,41,49,81,100,129,182,219,233,230,226,228,235,239,232,223,213,221,211,136,68,49,31,19,13,0,0,8,11,17,24,32,31,25,38,49,58,76,75,62,58,52,
-59,81,114,111,88,58,39,31,28,31,45,68,73,83,86,88,104,95,97,130,109,70,37,25,31,61,104,139,179,209,222,237,239,232,233,235,235,234,224,215,203,143,88,81,53,24,13,0,
-0,7,13,24,37,56,51,48,48,58,62,73,76,86,98,97,116,154,157,130,91,59,35,24,22,24,40,70,86,86,86,114,132,120,116,112,78,65,51,30,37,58,102,161,184,187,195,214,
-227,232,233,226,230,219,203,182,155,139,138,105,68,37,20,0,0,11,15,29,61,88,81,56,41,46,53,53,75,120,150,147,182,193,174,147,97,68,46,31,29,31,56,95,105,127,138,152,
-155,132,114,95,75,71,62,43,49,65,98,155,177,169,166,159,174,207,225,225,210,182,139,104,102,141,155,127,81,38,23,0,0,20,21,38,73,90,73,39,25,31,49,53,76,130,174,196,
-207,213,185,161,127,102,76,52,49,59,86,118,145,172,167,161,145,127,116,100,83,65,58,48,49,52,75,118,145,136,125,123,132,184,214,215,185,152,98,64,86,120,130,118,76,39,22,0,
-0,20,26,40,64,62,45,27,23,31,52,70,95,127,159,196,205,205,203,193,169,129,109,97,86,100,129,152,179,184,164,136,129,130,125,116,90,70,52,37,31,35,41,78,95,88,97,100,
-102,141,177,187,169,123,86,75,73,86,102,76,49,29,17,0,0,14,23,35,48,49,32,20,19,30,55,102,129,123,130,159,179,174,198,216,199,166,145,143,139,145,164,172,190,190,154,104,
-105,116,118,130,123,102,68,38,25,25,38,53,68,71,73,73,75,91,125,132,130,109,75,62,53,58,62,48,32,24,17,0,0,11,16,22,29,28,23,13,14,29,68,123,152,147,143,130,
-150,157,182,207,203,193,185,202,195,185,187,185,190,193,159,102,90,102,111,129,130,114,88,49,29,31,45,53,68,75,58,51,45,52,64,75,86,73,51,38,32,35,28,25,21,19,13,0,
-0,10,13,15,17,15,13,10,12,26,71,130,159,159,145,120,127,143,166,185,192,185,192,216,215,209,215,207,187,182,159,112,85,81,95,111,125,129,104,68,46,49,58,61,68,62,53,39,
-30,29,38,52,52,53,39,25,21,21,15,12,12,12,12,0,0,10,13,13,11,10,8,9,13,22,44,114,143,138,138,143,141,147,159,171,177,179,174,177,193,206,217,215,192,159,136,114,
-85,58,62,97,130,150,116,95,81,76,73,75,78,64,46,31,22,20,24,32,35,37,29,22,17,14,10,7,7,9,9,0,0,8,10,8,7,7,7,10,17,26,46,95,127,127,147,172,
-179,179,164,159,166,171,161,154,166,185,190,179,147,120,100,100,90,65,58,78,118,138,138,141,136,118,112,118,111,86,59,25,16,13,13,15,16,16,13,13,11,8,6,6,5,6,8,0,
-0,7,7,7,5,5,7,14,23,35,61,78,105,143,184,205,206,187,147,136,157,177,171,159,157,157,143,114,91,86,76,86,104,75,68,71,91,138,164,187,199,179,169,164,143,116,62,28,
-12,8,7,7,8,8,8,8,7,5,5,5,4,5,5,0,0,6,6,6,6,6,10,18,29,46,61,62,85,152,206,222,215,185,147,147,161,172,171,155,143,125,102,75,59,59,65,81,
-95,73,64,76,97,139,187,209,222,203,196,192,157,120,62,24,9,5,4,4,5,5,7,6,5,4,4,3,3,3,3,0,0,7,7,7,8,10,16,23,32,61,68,58,81,141,182,213,
-213,196,193,205,190,161,155,147,138,112,76,53,45,48,58,68,76,78,83,102,129,164,203,209,213,214,209,203,177,139,68,19,7,5,3,3,3,5,6,7,6,4,3,3,2,2,2,0,
-0,6,6,7,9,12,15,20,27,43,64,62,86,129,164,196,206,206,222,237,227,199,169,139,132,97,55,35,38,45,52,59,86,91,111,132,157,202,213,193,205,216,219,213,192,147,76,24,
-9,5,4,3,4,5,6,7,6,4,3,2,2,2,2,0,0,6,6,6,8,11,13,13,16,27,52,75,86,125,157,192,215,228,235,242,239,226,192,141,102,68,40,35,43,46,52,75,
-105,105,127,161,192,224,215,192,203,226,231,219,198,152,78,29,10,6,4,4,4,5,5,5,5,3,2,1,1,1,2,0,0,5,5,5,6,8,9,9,12,22,41,59,90,116,150,184,
-210,232,239,236,238,230,195,154,88,48,29,38,53,56,61,86,112,104,121,155,182,209,209,206,217,231,238,228,195,147,83,32,13,6,4,4,4,4,5,4,3,2,1,1,1,1,1,0,
-0,5,5,5,5,5,6,7,12,17,29,40,64,102,127,155,185,206,225,217,207,209,192,164,100,37,23,40,70,83,88,83,102,86,81,107,121,159,198,223,233,235,225,203,174,136,78,30,
-12,6,4,4,4,4,4,3,2,1,1,1,1,1,1,0,0,5,5,5,4,5,6,7,11,13,15,28,49,75,90,104,132,155,185,196,192,198,195,164,100,45,25,33,56,73,85,81,
-81,58,49,53,68,112,161,203,220,210,192,166,136,104,51,22,9,6,5,4,4,4,3,2,1,1,0,0,0,1,1,0,0,5,5,4,4,6,6,8,9,9,11,17,27,35,48,56,
-75,98,139,177,196,195,152,98,55,34,26,25,43,45,52,62,56,41,32,27,41,76,120,145,157,147,127,118,85,48,27,15,8,6,5,4,3,3,2,1,0,0,0,0,1,1,1,0,
-0,4,4,4,4,5,6,7,7,6,6,8,12,15,23,37,52,59,83,130,150,129,81,35,26,21,20,23,30,32,34,46,43,30,20,22,30,53,75,81,76,64,59,49,33,20,14,9,
-6,4,4,3,3,2,1,1,0,0,0,0,0,0,1,0,0,3,3,3,3,5,6,6,5,3,3,4,6,8,12,23,33,35,37,58,62,46,29,18,13,15,17,19,22,22,25,28,
-28,21,16,15,20,27,30,32,31,19,15,15,12,11,8,6,5,4,3,2,2,1,1,0,0,0,0,0,0,0,1,0,0,2,3,2,3,4,5,4,3,2,2,3,3,5,8,11,
-15,17,18,21,22,16,12,9,8,9,11,12,13,12,12,11,12,11,11,10,11,12,11,9,9,6,5,5,5,5,5,4,3,3,2,2,1,1,0,1,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+static const uint8_t presmoke4_packed[] = {
+66,90,104,57,49,65,89,38,83,89,186,84,215,126,0,0,5,255,255,255,255,255,253,254,
+251,187,182,219,107,75,90,214,45,82,180,106,213,172,90,214,177,180,182,173,155,207,95,189,
+255,190,154,224,9,223,0,0,240,14,167,18,170,86,64,214,74,25,105,182,169,45,21,84,
+255,38,137,166,152,52,24,128,2,48,4,152,166,211,72,68,245,54,160,7,168,105,229,6,
+67,212,49,160,70,71,168,61,13,2,122,155,81,144,61,64,61,79,80,6,35,77,2,170,
+159,232,105,26,101,60,52,202,122,76,70,50,38,152,149,63,77,67,104,77,4,194,52,105,
+161,136,96,4,24,140,0,0,0,2,0,105,129,24,140,77,48,152,129,161,163,77,52,50,
+100,104,200,104,105,128,154,1,130,100,209,161,147,38,70,153,24,153,26,0,0,194,97,12,
+76,70,70,153,0,97,52,24,67,0,42,170,127,224,128,96,8,19,4,13,76,16,53,39,
+138,0,0,0,0,26,0,0,0,0,0,0,6,154,0,0,0,32,104,104,211,77,12,153,
+26,50,26,26,96,38,128,96,153,52,104,100,201,145,166,70,38,70,128,0,48,152,67,19,
+17,145,166,64,24,77,6,16,192,6,152,144,147,41,225,74,52,52,0,0,0,1,161,160,
+0,0,0,0,0,0,208,0,0,0,0,0,0,0,97,5,1,241,138,28,132,9,22,169,
+53,116,86,185,77,82,177,5,24,100,40,35,5,102,97,11,23,175,109,70,117,245,60,117,
+98,48,211,77,107,18,35,4,132,88,130,12,96,8,137,72,8,26,17,16,41,20,146,140,
+2,161,4,12,4,130,4,34,160,16,140,35,4,48,50,18,24,170,100,48,25,9,37,0,
+137,97,50,34,134,2,36,144,8,130,25,65,160,12,232,230,68,162,18,96,132,85,101,178,
+1,48,100,48,192,73,192,210,213,112,67,202,68,169,196,137,106,205,10,2,138,41,41,85,
+152,68,139,148,186,16,9,44,130,74,129,55,22,204,169,98,100,41,153,68,144,89,8,36,
+32,18,233,87,64,68,19,106,24,181,113,184,54,5,72,6,233,46,82,150,164,162,13,75,
+4,16,69,164,210,76,16,73,50,217,40,221,114,171,87,10,12,77,5,100,43,231,36,130,
+77,132,137,153,105,234,162,44,182,220,92,77,232,153,49,45,154,20,164,180,153,114,100,10,
+41,9,144,225,168,55,137,173,215,95,165,238,78,215,164,227,112,171,85,100,203,24,56,116,
+190,132,213,58,233,71,39,50,200,100,130,145,128,168,238,43,59,170,38,168,209,211,92,176,
+243,90,91,45,51,39,44,244,49,137,100,83,48,179,5,106,23,53,50,91,39,1,138,212,
+114,105,217,179,67,141,72,216,105,176,188,103,150,84,19,12,141,108,202,203,44,212,176,74,
+4,188,81,25,230,82,20,88,97,142,153,95,74,61,101,172,167,28,173,74,12,21,165,101,
+71,147,148,144,212,45,66,70,149,153,84,216,141,183,44,50,7,60,163,44,21,251,26,208,
+197,141,89,39,5,43,43,164,93,90,27,97,73,124,69,68,4,32,192,33,28,97,26,210,
+164,195,27,12,80,72,96,24,97,48,222,170,4,142,49,171,3,42,198,115,0,41,72,2,
+52,140,108,8,74,71,17,69,56,160,24,94,115,0,56,6,224,87,102,36,225,186,129,138,
+140,10,28,164,43,156,48,184,0,16,84,224,144,37,83,2,80,56,97,121,133,24,131,2,
+177,40,10,68,248,240,17,88,6,251,226,22,100,1,234,233,109,69,72,143,66,234,52,196,
+156,148,195,90,166,140,13,122,252,181,211,41,211,77,0,156,145,74,192,174,96,18,34,4,
+133,146,145,129,249,107,206,167,216,241,145,34,2,131,8,200,108,239,12,82,33,185,135,116,
+235,25,86,152,168,157,43,216,73,9,32,151,56,9,45,76,14,156,0,50,206,10,36,4,
+32,41,34,8,2,115,88,119,109,134,104,195,146,124,36,158,169,20,171,83,113,1,0,30,
+180,98,40,31,134,161,190,7,161,181,209,58,146,190,69,239,162,11,129,194,127,100,173,168,
+139,129,45,90,152,219,183,109,83,40,41,193,108,15,198,149,80,123,181,203,123,232,29,187,
+228,138,105,85,44,38,85,228,4,152,152,76,9,142,201,240,178,100,214,202,211,189,84,247,
+157,35,4,114,192,220,161,182,130,54,192,96,199,32,89,185,150,150,70,66,210,12,41,94,
+140,173,30,24,19,69,194,20,246,158,144,57,65,19,133,54,92,141,137,76,106,215,99,249,
+7,44,109,151,40,166,68,214,62,9,38,182,20,40,236,192,173,2,131,16,247,242,208,108,
+176,57,97,73,145,19,97,132,118,162,95,25,80,44,171,193,207,167,140,22,153,105,112,69,
+68,144,57,12,104,129,121,216,155,48,144,8,170,142,186,89,145,164,115,75,98,19,196,49,
+95,165,20,232,233,65,81,89,181,44,69,152,213,23,22,210,224,98,235,244,208,254,58,170,
+230,163,96,65,138,64,176,136,216,205,209,80,5,208,132,229,214,96,166,27,172,185,203,211,
+166,28,10,27,245,30,126,142,158,148,109,95,130,41,147,9,128,35,18,163,224,155,206,208,
+100,217,200,251,58,50,252,66,220,188,45,214,103,28,142,64,129,150,72,203,240,105,127,74,
+71,200,220,78,220,150,149,92,152,2,67,32,148,215,12,113,162,241,100,233,198,118,60,34,
+181,149,178,69,58,120,79,97,153,32,55,93,158,91,133,157,240,197,19,242,93,94,160,209,
+134,43,197,129,36,158,157,68,220,1,159,3,204,214,34,75,194,54,68,52,68,224,102,192,
+105,200,249,78,145,112,176,51,194,155,146,11,12,55,95,90,76,34,130,112,42,150,152,110,
+176,52,72,0,167,105,11,184,67,152,70,22,115,224,38,159,227,92,14,124,33,18,241,209,
+52,215,129,179,81,152,230,21,117,235,249,171,214,82,100,119,81,199,77,75,151,27,150,100,
+104,24,217,230,227,86,8,100,101,160,144,180,207,102,222,60,133,25,174,172,86,95,71,200,
+226,106,47,3,50,164,170,73,134,200,108,193,0,173,129,183,83,91,83,137,155,32,190,178,
+173,224,21,81,95,196,195,218,45,4,87,215,242,116,235,119,167,113,171,46,164,56,209,153,
+251,195,100,14,63,48,76,162,237,192,180,68,2,26,6,192,151,12,103,21,224,101,151,86,
+211,198,152,9,63,48,4,189,211,61,44,225,149,172,222,32,108,126,123,112,22,88,108,187,
+13,70,68,14,215,34,96,45,198,165,48,232,83,170,0,215,19,120,32,163,132,234,50,197,
+41,48,150,138,210,150,244,198,132,132,39,83,171,13,205,35,88,217,217,141,178,218,198,140,
+10,134,50,200,206,208,36,173,83,18,80,102,165,9,197,168,205,82,21,117,4,131,152,87,
+169,149,159,63,233,113,192,196,82,132,75,158,244,45,214,72,20,68,82,27,21,32,58,39,
+157,187,135,145,187,177,236,22,26,20,69,169,6,216,105,193,124,217,25,47,75,138,161,189,
+86,251,66,172,129,78,87,19,205,73,75,60,188,144,214,16,107,62,172,98,219,119,211,193,
+85,33,117,170,94,110,171,84,193,203,112,134,19,207,54,200,107,181,120,115,170,77,28,56,
+234,62,224,83,140,37,88,196,171,220,244,142,52,52,198,240,155,188,221,123,88,15,70,19,
+152,58,10,211,54,9,247,26,41,158,143,29,134,0,89,78,51,174,148,36,154,113,32,141,
+203,28,85,42,17,196,61,181,105,182,80,52,252,54,118,148,173,91,232,218,113,129,181,113,
+185,16,218,213,50,222,41,115,225,227,112,162,107,102,149,254,182,186,210,171,123,145,162,29,
+19,64,140,113,66,196,11,37,6,187,206,183,214,61,107,93,56,146,84,24,9,198,29,129,
+188,243,133,227,56,13,160,111,112,29,65,200,176,175,123,38,110,237,200,60,159,34,8,18,
+194,168,126,180,9,189,44,250,249,199,217,215,41,220,16,48,170,221,34,156,14,22,141,74,
+7,144,187,153,228,225,165,63,175,227,206,77,240,33,65,65,185,43,49,47,40,86,185,23,
+219,149,40,215,142,145,93,185,87,38,112,90,216,251,2,112,145,208,167,29,224,208,6,201,
+195,29,42,108,179,205,121,21,8,13,7,102,99,114,17,1,152,77,62,100,218,144,28,254,
+120,89,139,86,238,104,35,66,21,195,136,145,229,112,187,26,83,61,245,4,215,240,146,21,
+234,35,181,199,84,114,129,87,118,112,53,41,59,90,28,221,113,245,215,57,114,215,107,248,
+165,106,1,68,121,194,242,118,19,112,204,149,217,160,60,186,41,137,191,198,105,20,200,81,
+90,188,122,102,187,21,103,95,154,106,2,8,5,147,189,175,124,52,110,153,149,27,18,128,
+28,109,142,193,173,54,166,249,118,84,103,4,205,187,175,201,204,41,44,218,159,75,86,213,
+53,36,237,55,135,10,7,61,130,231,20,29,250,50,142,204,238,98,164,188,133,134,76,111,
+79,44,234,124,79,198,141,192,249,167,138,131,248,36,21,27,43,177,183,104,70,118,44,226,
+82,238,118,108,185,201,225,89,226,14,133,133,109,120,59,9,117,240,62,250,39,116,190,30,
+238,57,182,158,228,33,159,94,76,26,237,78,9,154,218,14,243,71,58,34,202,185,94,28,
+9,214,217,51,226,162,106,164,6,209,22,252,53,51,61,255,108,10,154,192,15,99,206,99,
+177,240,179,210,144,72,118,36,124,143,226,162,41,221,11,141,75,114,149,76,253,22,161,115,
+200,9,254,199,35,181,185,31,22,43,51,96,85,94,253,100,148,84,101,229,162,11,248,252,
+250,210,39,171,106,160,109,197,135,141,203,46,218,239,187,101,47,41,234,83,192,208,66,29,
+212,235,210,113,79,157,115,145,3,187,101,141,81,21,65,90,214,240,93,161,167,88,223,207,
+11,136,14,104,74,138,98,71,58,232,118,173,149,233,173,204,186,52,104,225,148,0,196,87,
+207,217,165,144,80,255,193,237,69,114,0,11,157,145,113,67,43,146,93,180,178,189,166,163,
+232,127,109,219,29,151,121,46,118,46,102,128,9,13,41,194,56,148,10,51,158,210,113,83,
+76,125,198,34,154,114,16,101,184,54,42,130,187,68,108,4,107,185,70,80,26,132,178,232,
+57,96,220,213,183,209,144,196,70,135,228,106,99,180,96,26,28,239,167,102,105,215,108,98,
+72,7,215,42,222,145,238,115,181,150,54,207,108,75,10,172,79,35,170,13,136,227,96,249,
+117,70,21,58,75,62,187,192,186,2,2,18,166,54,242,107,91,57,66,162,194,152,249,18,
+211,99,21,83,165,147,142,132,241,231,34,130,12,237,1,91,53,50,224,29,153,71,210,138,
+42,76,211,174,96,102,227,229,111,68,216,234,154,28,19,145,121,72,72,10,135,170,141,18,
+102,212,146,214,186,143,32,167,51,180,24,217,228,185,83,148,14,251,4,193,41,83,12,203,
+146,92,167,77,246,49,50,140,230,78,18,212,233,233,67,233,71,169,20,117,167,105,132,137,
+47,67,37,109,213,48,103,172,19,160,239,187,41,241,23,13,19,106,21,131,18,182,194,244,
+4,57,164,129,55,238,69,128,240,86,23,195,106,124,193,179,30,141,50,141,188,178,46,89,
+45,196,148,213,114,189,234,246,255,10,171,155,94,231,76,52,108,156,89,96,220,135,167,117,
+110,35,122,253,190,228,230,191,77,83,211,74,146,141,45,32,94,184,108,121,60,17,18,81,
+107,154,143,101,148,104,68,233,105,103,6,106,95,112,192,78,232,16,5,114,157,160,245,49,
+51,20,74,82,211,112,168,110,205,182,47,188,121,74,3,88,143,65,101,217,44,114,142,84,
+130,246,229,185,224,161,3,129,252,56,53,152,218,184,19,61,171,199,180,208,201,170,105,24,
+16,232,184,82,71,50,120,157,109,85,182,187,58,43,26,92,6,254,57,173,146,48,217,159,
+242,247,66,67,176,251,97,144,50,254,54,178,229,181,196,9,21,50,131,165,171,42,211,13,
+217,208,45,173,178,95,53,66,99,195,37,205,131,223,56,178,63,24,81,81,99,118,0,105,
+143,138,22,91,37,161,85,81,155,16,205,31,181,249,196,112,173,157,96,9,92,172,233,19,
+187,223,95,249,70,38,28,158,113,97,3,194,78,135,77,38,241,244,63,103,122,80,65,177,
+149,131,199,74,43,93,103,67,201,226,51,136,141,31,90,10,61,33,127,24,205,175,99,139,
+5,178,228,30,164,230,147,100,11,118,21,212,195,8,51,23,20,242,199,186,103,159,215,70,
+108,249,179,8,237,27,93,6,29,165,172,217,1,246,115,31,81,83,88,36,175,81,130,115,
+76,72,10,146,75,28,49,149,37,145,169,33,255,27,248,28,117,165,32,46,91,63,120,172,
+82,171,55,151,82,24,127,148,212,157,244,51,10,27,23,231,69,223,25,98,222,92,29,159,
+13,5,10,171,110,201,216,177,99,9,212,85,101,134,105,40,149,123,96,4,66,129,92,10,
+125,49,34,221,179,231,254,145,109,80,70,102,239,221,61,49,217,73,27,249,94,87,233,107,
+146,121,30,190,134,105,165,179,126,156,17,213,10,237,36,123,198,225,127,82,9,86,137,148,
+71,20,137,95,130,81,46,185,100,118,79,63,144,182,98,89,4,255,191,217,253,1,137,255,
+85,0,177,232,21,108,43,136,222,170,246,173,5,162,172,162,222,198,168,167,251,224,51,68,
+207,240,128,48,199,23,250,224,16,96,255,166,255,197,220,145,78,20,36,46,149,53,223,128
 };
 
+static rsAsset presmoke4(presmoke4_packed, 3000, 4096);
 
+/* data from presmoke5.raw, 4096 bytes */
+
+static const uint8_t presmoke5_packed[] = {
+66,90,104,57,49,65,89,38,83,89,212,222,157,225,0,0,2,127,255,255,255,255,255,251,
+239,110,219,101,173,107,90,181,106,213,106,180,90,173,90,165,173,43,107,109,155,187,239,253,
+255,255,255,224,9,223,0,3,207,11,198,133,236,66,150,198,154,200,1,68,1,194,170,167,
+254,33,26,96,76,208,153,50,98,96,76,152,153,0,154,154,106,122,154,121,67,64,0,0,
+104,208,13,6,128,0,0,208,0,0,0,0,0,5,85,79,243,32,104,12,128,104,104,8,
+194,4,208,67,17,15,68,211,64,0,0,0,0,0,3,64,0,0,0,13,3,67,65,160,
+0,170,167,248,33,52,122,167,233,132,212,48,136,105,166,77,67,212,30,161,233,49,13,0,
+104,0,0,0,0,0,52,13,0,0,0,0,0,0,0,5,85,63,244,70,153,50,49,76,
+154,158,148,209,234,98,24,128,52,52,1,160,104,50,3,70,32,0,209,132,104,0,0,0,
+26,100,24,17,166,8,100,200,26,61,67,212,65,132,196,6,76,154,6,38,129,147,67,38,
+134,131,76,35,70,128,98,25,50,12,38,65,166,35,65,144,208,98,6,134,70,64,1,147,
+77,50,98,98,26,0,13,50,16,137,136,132,26,154,6,128,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,36,142,12,132,207,24,184,14,76,34,136,36,197,97,
+239,89,77,194,48,185,102,122,97,123,214,213,187,74,218,221,73,174,153,179,223,46,248,21,
+56,29,93,89,136,177,196,105,22,103,44,228,11,36,5,8,12,218,194,193,134,157,66,52,
+116,1,98,229,36,16,39,128,65,203,10,218,199,11,172,5,1,186,197,18,88,150,36,18,
+17,78,233,221,4,212,36,136,34,194,93,195,130,8,148,152,130,210,66,36,195,135,120,36,
+132,129,103,173,247,8,77,64,38,73,33,210,117,98,21,161,144,14,147,20,228,59,181,10,
+14,233,213,157,51,219,76,166,186,164,19,101,89,66,148,65,20,208,89,74,97,69,16,132,
+59,194,131,84,132,25,9,67,177,191,82,109,117,217,157,3,167,77,110,186,182,45,90,160,
+113,136,56,74,136,40,226,158,64,40,44,212,65,201,19,169,141,216,234,12,31,19,171,159,
+62,124,6,89,89,69,198,105,0,151,32,137,45,5,157,16,178,122,152,79,16,224,138,37,
+150,57,181,195,54,25,240,15,156,198,89,197,33,220,62,41,28,162,144,37,172,4,189,34,
+1,10,14,44,161,196,85,194,129,132,229,83,50,244,5,221,141,244,213,217,54,3,60,105,
+107,214,141,24,232,209,17,18,141,97,62,82,150,86,161,151,51,52,15,36,20,28,58,36,
+178,218,110,216,95,125,171,117,198,34,248,190,94,151,38,135,39,93,35,70,149,226,218,201,
+207,41,164,72,208,236,248,9,78,50,140,192,229,41,241,186,175,25,9,119,119,74,152,109,
+27,29,45,126,91,28,43,163,39,209,141,112,130,72,18,116,233,47,177,183,32,67,205,20,
+36,36,0,142,146,67,163,120,133,32,154,28,147,138,129,128,235,24,196,168,6,37,13,180,
+144,96,198,197,45,69,112,14,162,21,192,49,1,8,27,101,18,221,20,111,132,44,56,144,
+242,7,3,73,81,20,10,80,40,202,205,46,218,140,50,224,98,86,57,47,49,112,205,108,
+41,108,67,104,109,133,129,191,21,209,8,67,24,86,131,80,64,204,199,74,112,8,194,49,
+101,8,38,1,13,45,230,194,208,90,148,170,111,85,93,171,237,66,234,227,10,90,149,26,
+134,65,133,242,165,43,2,150,33,8,86,212,192,100,34,91,179,4,164,148,198,0,100,56,
+98,17,176,83,129,85,78,99,25,132,105,81,149,230,223,11,237,165,4,36,80,177,14,158,
+76,152,166,208,97,76,50,44,18,10,16,194,235,141,1,208,215,102,1,208,178,120,35,158,
+81,65,4,243,169,227,158,127,65,157,99,210,140,105,213,14,83,143,52,85,199,25,167,201,
+44,112,199,27,239,36,241,36,67,52,111,39,40,41,196,52,230,175,77,163,68,90,240,172,
+128,41,113,50,196,82,204,252,34,49,99,65,52,30,77,112,164,36,161,18,116,2,182,233,
+213,106,151,230,3,111,156,137,166,5,177,66,177,235,41,42,33,35,74,8,49,204,7,20,
+59,151,174,128,198,121,195,57,219,110,151,28,216,59,134,114,41,109,4,130,157,87,201,80,
+102,12,188,156,206,55,124,103,11,148,180,161,54,28,76,16,29,208,144,183,58,237,13,60,
+235,67,40,31,154,252,67,194,177,22,206,107,229,85,121,16,34,16,68,67,17,4,51,86,
+48,160,224,112,138,110,197,68,18,8,92,125,123,160,93,192,187,151,146,18,59,105,18,34,
+120,56,133,40,72,88,86,157,39,234,206,169,119,170,58,246,163,36,202,196,114,90,202,241,
+157,45,12,212,142,28,0,165,12,163,172,67,94,81,220,52,92,37,193,68,172,101,35,92,
+222,226,232,5,50,138,244,37,175,20,178,234,136,164,209,3,22,48,22,232,153,248,196,196,
+161,140,235,176,148,238,129,9,40,38,255,96,150,33,62,8,131,113,137,33,69,60,211,165,
+169,96,237,205,173,52,134,18,119,171,89,156,168,178,114,208,103,182,170,106,10,33,53,77,
+233,98,209,77,194,201,18,220,28,142,7,41,103,73,210,62,212,231,92,1,124,192,84,207,
+24,23,197,139,49,158,191,214,96,6,198,62,38,150,244,64,91,6,149,8,160,143,47,153,
+68,86,160,142,226,146,142,84,146,162,227,167,74,140,55,132,180,202,141,69,54,185,190,26,
+181,60,182,65,106,26,4,30,67,45,96,149,11,20,190,116,148,182,51,160,148,120,52,188,
+156,70,243,172,243,170,115,142,71,73,228,215,172,106,31,57,43,139,121,188,86,73,67,206,
+76,201,219,144,168,150,74,249,6,231,212,162,196,233,219,151,27,55,71,67,192,118,226,92,
+219,241,45,187,10,112,186,219,206,110,217,75,40,86,163,157,183,88,233,204,169,13,41,234,
+182,34,97,9,131,69,57,44,29,109,32,222,35,84,86,24,207,98,41,239,144,97,98,44,
+14,155,110,209,231,86,240,161,21,75,227,206,51,203,10,19,170,165,219,188,33,74,246,80,
+4,35,191,14,5,241,245,26,250,76,43,84,195,37,18,114,17,128,13,188,172,235,50,212,
+234,116,202,38,233,224,173,199,176,4,171,152,80,54,187,131,51,167,109,20,52,238,228,96,
+176,169,139,81,235,202,182,106,17,191,65,185,230,224,164,13,200,69,34,206,100,11,55,237,
+89,129,53,157,34,149,63,192,167,175,145,238,144,32,187,28,92,72,250,149,111,222,21,173,
+64,152,130,104,37,212,65,209,74,247,122,135,196,252,152,215,168,197,74,118,114,60,10,204,
+42,24,36,69,211,66,134,192,178,148,138,32,85,224,153,103,11,139,10,57,193,155,101,226,
+51,151,109,39,41,97,83,77,82,162,51,179,25,82,226,196,151,19,104,208,230,97,203,160,
+186,24,140,221,76,37,161,176,231,134,225,201,26,208,165,10,3,84,59,236,253,166,246,0,
+70,166,29,101,104,192,140,178,160,72,235,106,241,86,176,139,90,221,172,180,208,100,29,148,
+36,211,2,232,222,50,81,215,21,101,148,106,244,194,188,49,170,158,227,205,113,56,188,82,
+1,125,134,173,19,6,66,22,18,176,187,75,208,212,146,91,60,17,45,171,127,27,243,246,
+162,22,25,78,145,117,98,30,50,213,198,229,70,182,5,86,167,139,70,77,116,89,125,138,
+152,22,226,59,169,187,53,197,118,210,220,37,166,134,172,72,191,100,218,215,174,119,131,159,
+6,7,66,176,57,220,73,84,77,79,112,220,195,199,85,169,138,110,133,20,174,5,173,202,
+219,73,212,241,87,81,210,134,205,135,19,149,207,101,140,101,145,89,46,181,229,189,68,70,
+197,17,195,70,106,112,201,10,242,2,241,131,185,5,162,106,155,143,50,151,207,187,198,203,
+135,182,92,26,40,132,156,13,211,246,219,229,105,24,39,65,251,4,136,197,163,104,184,46,
+130,45,22,180,65,153,181,90,106,124,209,227,205,107,6,13,208,47,0,180,71,158,60,44,
+154,125,119,85,179,34,117,100,238,192,225,156,102,180,28,116,76,32,226,87,84,11,89,248,
+221,211,156,210,34,63,123,16,5,172,237,237,245,229,34,10,47,180,236,227,155,160,53,144,
+210,209,156,9,92,74,243,60,163,51,197,112,147,14,208,218,123,125,50,32,207,181,179,102,
+51,130,121,227,221,100,76,55,62,210,131,198,42,84,107,100,147,91,206,11,188,118,53,60,
+9,85,184,187,217,24,222,201,173,27,217,150,178,225,10,3,16,95,221,182,161,75,141,83,
+184,57,18,197,116,178,155,99,98,19,225,12,236,48,126,144,87,85,207,15,192,95,190,140,
+59,225,33,206,161,131,6,87,136,246,185,203,55,61,9,119,148,45,62,24,31,78,162,246,
+142,194,116,191,64,20,136,4,216,69,96,124,22,45,199,227,113,169,231,11,207,14,117,70,
+85,157,69,116,56,219,254,68,60,91,228,169,249,151,114,194,59,119,136,227,81,172,38,154,
+165,113,191,206,47,143,114,210,153,131,12,19,54,141,24,181,204,12,74,100,214,25,23,125,
+247,181,40,44,97,159,81,84,224,221,232,37,88,208,155,198,131,131,134,14,163,36,178,1,
+26,153,58,73,108,236,72,59,26,167,24,210,52,216,213,202,198,40,214,192,233,106,138,206,
+30,222,179,41,178,83,25,19,155,26,172,173,54,226,67,38,226,80,233,176,124,172,204,240,
+223,4,27,109,228,185,93,170,221,182,144,194,3,87,149,8,67,123,213,242,32,129,81,239,
+214,193,233,80,83,71,195,68,227,157,11,86,173,140,251,71,193,227,167,137,221,141,5,75,
+225,149,160,166,65,108,130,189,123,138,136,177,67,84,120,36,81,89,51,92,143,84,177,108,
+186,141,215,211,190,82,169,81,59,237,143,70,48,213,87,7,145,200,147,28,64,196,174,178,
+44,64,59,65,70,78,37,11,158,7,95,4,219,126,94,84,170,202,138,69,32,36,30,98,
+218,245,154,140,250,229,243,147,6,154,252,202,17,42,197,213,122,118,40,102,224,179,224,195,
+165,102,242,239,163,24,124,214,2,150,147,64,186,195,29,120,68,12,163,220,244,55,221,188,
+36,80,61,34,71,127,24,82,209,202,82,174,192,210,14,24,20,206,210,113,250,80,180,115,
+209,101,32,158,31,6,203,147,122,51,33,182,166,49,2,225,245,101,171,123,147,127,167,199,
+146,221,185,194,190,84,5,100,184,9,127,70,98,229,197,163,49,122,243,66,37,183,61,78,
+65,29,192,144,25,152,69,9,253,80,177,102,219,141,222,155,64,204,166,41,98,140,168,242,
+77,123,212,186,74,204,219,153,57,182,151,27,28,42,21,140,79,30,29,137,28,7,112,210,
+90,46,60,86,12,224,77,230,81,228,173,164,118,102,253,53,243,58,170,243,182,41,72,40,
+182,93,246,253,80,81,30,40,88,62,1,172,148,85,163,31,181,240,167,181,91,126,200,80,
+154,194,229,152,22,4,43,79,102,75,143,61,169,22,101,48,227,147,162,249,65,113,216,162,
+45,130,249,111,106,60,172,68,220,194,63,8,17,28,252,33,79,139,104,190,1,254,243,148,
+251,137,240,218,102,85,181,56,205,248,216,149,167,153,190,13,86,140,20,166,158,149,220,7,
+82,233,132,56,89,198,166,8,39,74,57,79,120,53,112,103,75,210,219,160,178,86,40,157,
+101,132,214,124,218,240,218,17,169,3,160,38,194,68,114,194,129,170,8,125,211,97,123,118,
+109,239,115,56,76,136,217,79,101,89,236,49,210,177,58,72,220,130,41,39,16,107,159,151,
+204,134,16,135,20,5,129,20,12,61,204,208,235,171,221,179,146,187,239,32,227,120,2,173,
+231,212,144,109,172,63,130,119,198,200,118,235,112,116,86,118,72,238,124,191,8,182,59,50,
+20,185,166,244,122,146,205,109,34,23,3,63,25,237,79,20,143,167,13,138,46,173,232,230,
+93,114,204,71,74,65,169,156,150,199,26,25,113,202,162,165,19,83,50,16,60,168,74,107,
+231,211,179,244,167,121,28,153,180,51,81,117,192,161,36,147,182,43,192,43,12,120,32,86,
+112,95,148,6,116,90,146,58,86,254,202,51,22,161,175,84,68,198,224,10,125,88,248,128,
+102,89,223,40,6,251,54,165,58,121,208,60,205,64,23,208,195,127,90,234,77,45,209,82,
+206,18,71,196,1,116,175,48,217,67,88,9,208,136,108,190,151,93,88,234,49,59,16,85,
+166,75,236,139,234,1,227,97,164,38,68,42,179,27,128,136,138,181,11,60,87,218,171,110,
+5,155,45,143,214,8,235,182,147,193,152,216,163,5,88,247,44,131,60,90,49,190,41,227,
+54,37,147,215,203,64,169,25,55,75,41,158,230,102,178,196,173,156,5,200,24,94,155,138,
+188,109,125,233,88,109,58,135,22,33,195,139,9,109,81,247,148,88,179,241,120,252,106,156,
+196,130,18,32,162,249,75,75,155,28,101,219,125,113,230,175,57,142,97,142,54,127,19,49,
+168,134,181,34,105,82,77,91,111,46,198,39,204,187,182,86,109,54,183,19,208,163,158,25,
+86,119,141,109,86,203,3,168,229,85,172,184,239,158,145,100,33,180,1,197,92,170,137,51,
+175,59,224,172,229,116,96,178,193,161,199,85,150,200,138,97,11,45,200,97,114,13,168,217,
+104,252,208,11,48,129,248,224,155,6,139,52,67,97,193,48,227,234,191,107,214,129,37,5,
+251,94,58,224,133,150,68,132,236,148,10,41,161,213,99,149,130,139,245,85,54,142,138,220,
+9,193,17,50,198,118,191,0,82,22,146,123,242,197,149,112,179,34,52,100,160,81,213,24,
+148,250,198,212,1,38,68,44,124,226,62,88,216,239,192,89,139,110,96,76,254,32,208,183,
+20,236,168,142,135,99,255,77,60,213,208,45,182,157,255,139,185,34,156,40,72,106,111,78,
+240,128
+};
 
-#endif  // SMOKETEX_H
+static rsAsset presmoke5(presmoke5_packed, 3122, 4096);
@@ -22,7 +22,12 @@
 #include "nukesound.h"
 #include "whistlesound.h"
 
-// #include <kodi/AudioEngine.h>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <kodi/AddonBase.h>
+#include <kodi/AudioEngine.h>
+#include <string.h>
 
 // sound is about halfway attenuated at reference distance
 static float reference_distance[NUM_BUFFERS] =
@@ -39,62 +44,128 @@ static float reference_distance[NUM_BUFFERS] =
   700.0f  // whistle
 };
 
+// raw little endian 16 bit mono, 44100 Hz
+static rsAsset* sounds[NUM_BUFFERS] =
+{
+  &launch1Sound,
+  &launch2Sound,
+  &boom1Sound,
+  &boom2Sound,
+  &boom3Sound,
+  &boom4Sound,
+  &popperSound,
+  &suckSound,
+  &nukeSound,
+  &whistleSound
+};
+
 
-CSoundEngine::CSoundEngine(/*HWND hwnd,*/ float volume)
+CSoundEngine::CSoundEngine(float volume, const std::string& wavFile)
+  : m_mixer(volume)
 {
-//   AudioEngineFormat format;
-//   format.m_dataFormat = AE_FMT_S16BE;
-//   format.m_sampleRate = 44100;
-//   format.m_channelCount = 1;
-//   format.m_channels[0] = AE_CH_FL;
-//   m_stream1 = new kodi::audioengine::CAddonAEStream(format);
-//   // Open device
-//   device = alcOpenDevice((ALCchar*)"Generic Software");  // might work if NULL doesn't due to sound driver problems
-//    //device = alcOpenDevice(NULL);  // default device
-//   if(device == NULL)
-//     return;
-//   // Create context
-//   context = alcCreateContext(device, NULL);
-//   if(context == NULL)
-//     return;
-//   // Set active context
-//   alcMakeContextCurrent(context);
-//
-//   alDistanceModel(AL_INVERSE_DISTANCE);
-//   alDopplerVelocity(1130.0f);  // Sound travels at 1130 feet/sec
-//   alListenerf(AL_GAIN, volume);  // Volume
-//
-//   // Initialize sound data
-//   alGenBuffers(NUM_BUFFERS, buffers);
-//   alBufferData(buffers[LAUNCH1SOUND], AL_FORMAT_MONO16, launch1SoundData, launch1SoundSize, 44100);
-//   alBufferData(buffers[LAUNCH2SOUND], AL_FORMAT_MONO16, launch2SoundData, launch2SoundSize, 44100);
-//   alBufferData(buffers[BOOM1SOUND], AL_FORMAT_MONO16, boom1SoundData, boom1SoundSize, 44100);
-//   alBufferData(buffers[BOOM2SOUND], AL_FORMAT_MONO16, boom2SoundData, boom2SoundSize, 44100);
-//   alBufferData(buffers[BOOM3SOUND], AL_FORMAT_MONO16, boom3SoundData, boom3SoundSize, 44100);
-//   alBufferData(buffers[BOOM4SOUND], AL_FORMAT_MONO16, boom4SoundData, boom4SoundSize, 44100);
-//   alBufferData(buffers[POPPERSOUND], AL_FORMAT_MONO16, popperSoundData, popperSoundSize, 44100);
-//   alBufferData(buffers[SUCKSOUND], AL_FORMAT_MONO16, suckSoundData, suckSoundSize, 44100);
-//   alBufferData(buffers[NUKESOUND], AL_FORMAT_MONO16, nukeSoundData, nukeSoundSize, 44100);
-//   alBufferData(buffers[WHISTLESOUND], AL_FORMAT_MONO16, whistleSoundData, whistleSoundSize, 44100);
-//
-//   alGenSources(NUM_SOURCES, sources);
-//   for(int i=0; i<NUM_SOURCES; ++i){
-//     alSourcef(sources[i], AL_GAIN, 1.0f);
-//     alSourcef(sources[i], AL_ROLLOFF_FACTOR, 1.0f);
-//     alSourcei(sources[i], AL_LOOPING, AL_FALSE);
-//   }
+  // decompressed here and kept for as long as the engine may play them
+  for (int i = 0; i < NUM_BUFFERS; ++i)
+    m_mixer.SetSound(i, sounds[i]->acquire(), sounds[i]->size(), reference_distance[i]);
+
+  if (!wavFile.empty())
+  {
+    m_wavFile = fopen(wavFile.c_str(), "wb");
+    if (m_wavFile)
+    {
+      // header is written when the file is closed and the size is known
+      char header[44] = {0};
+      fwrite(header, 1, sizeof(header), m_wavFile);
+    }
+    return;
+  }
+
+  kodi::audioengine::AudioEngineFormat format;
+  format.SetDataFormat(AUDIOENGINE_FMT_FLOAT);
+  format.SetChannelLayout({AUDIOENGINE_CH_FL, AUDIOENGINE_CH_FR});
+  format.SetSampleRate(SOUNDMIXER_RATE);
+  // Kodi throws if it can't open a stream, e.g. without an audio sink or
+  // while passthrough holds the device.  Then the screensaver runs silent.
+  try
+  {
+    m_stream = new kodi::audioengine::CAEStream(format, AUDIO_STREAM_AUTOSTART);
+  }
+  catch (const std::exception& e)
+  {
+    kodi::Log(ADDON_LOG_WARNING, "Failed to open audio stream, sounds disabled: %s", e.what());
+    m_stream = nullptr;
+    return;
+  }
+
+  m_running = true;
+  m_thread = std::thread(&CSoundEngine::OutputProcess, this);
 }
 
 
 CSoundEngine::~CSoundEngine()
 {
-//   delete m_stream1;
-//   alDeleteBuffers(NUM_BUFFERS, buffers);
-//   alDeleteSources(NUM_SOURCES, sources);
-//   //Release context
-//   alcDestroyContext(context);
-//   //Close device
-//   alcCloseDevice(device);
+  m_running = false;
+  if (m_thread.joinable())
+    m_thread.join();
+  delete m_stream;
+
+  CloseWav();
+
+  for (int i = 0; i < NUM_BUFFERS; ++i)
+    sounds[i]->release();
+}
+
+
+// Audio side of the ring: hands mixed frames to Kodi as it has room for them
+void CSoundEngine::OutputProcess()
+{
+  float buffer[SOUNDMIXER_BLOCK * SOUNDMIXER_CHANNELS];
+  const unsigned int frameSize(sizeof(float) * SOUNDMIXER_CHANNELS);
+
+  if (!m_stream)
+    return;
+
+  while (m_running)
+  {
+    const unsigned int space(m_stream->GetSpace() / frameSize);
+    const unsigned int frames(m_ring.Read(buffer, std::min(space, (unsigned int)SOUNDMIXER_BLOCK)));
+    if (frames)
+    {
+      uint8_t* data = reinterpret_cast<uint8_t*>(buffer);
+      m_stream->AddData(&data, 0, frames);
+    }
+    else
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+}
+
+
+void CSoundEngine::CloseWav()
+{
+  if (!m_wavFile)
+    return;
+
+  auto put16 = [](unsigned char* p, unsigned int v) { p[0] = v & 0xff; p[1] = (v >> 8) & 0xff; };
+  auto put32 = [&](unsigned char* p, unsigned int v) { put16(p, v & 0xffff); put16(p + 2, v >> 16); };
+
+  const unsigned int dataSize(m_wavFrames * SOUNDMIXER_CHANNELS * 2);
+  unsigned char header[44];
+  memcpy(header, "RIFF", 4);
+  put32(header + 4, 36 + dataSize);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  put32(header + 16, 16);
+  put16(header + 20, 1);  // PCM
+  put16(header + 22, SOUNDMIXER_CHANNELS);
+  put32(header + 24, SOUNDMIXER_RATE);
+  put32(header + 28, SOUNDMIXER_RATE * SOUNDMIXER_CHANNELS * 2);
+  put16(header + 32, SOUNDMIXER_CHANNELS * 2);
+  put16(header + 34, 16);
+  memcpy(header + 36, "data", 4);
+  put32(header + 40, dataSize);
+
+  fseek(m_wavFile, 0, SEEK_SET);
+  fwrite(header, 1, sizeof(header), m_wavFile);
+  fclose(m_wavFile);
+  m_wavFile = nullptr;
 }
 
 
@@ -131,17 +202,6 @@ void CSoundEngine::insertSoundNode(int sound, rsVec source, rsVec observer)
 
 void CSoundEngine::update(float* listenerPos, float* listenerVel, float* listenerOri, float frameTime, bool slowMotion)
 {
-//     unsigned int AddData(uint8_t* const *data, unsigned int offset, unsigned int frames,
-//                          double pts = 0, bool hasDownmix = false, double centerMixLevel = 1.0)
-
-//   if(device == NULL || context == NULL)
-//     return;
-//
-//   // Set current listener attributes
-//   alListenerfv(AL_POSITION, listenerPos);
-//   alListenerfv(AL_VELOCITY, listenerVel);
-//   alListenerfv(AL_ORIENTATION, listenerOri);
-//
   for(int i=0; i<NUM_SOUNDNODES; ++i)
   {
     if(soundnodes[i].active == true)
@@ -149,30 +209,40 @@ void CSoundEngine::update(float* listenerPos, float* listenerVel, float* listene
       soundnodes[i].time -= frameTime;
       if(soundnodes[i].time <= 0.0f)
       {
-        // find an available source
-//         ALint value;
-//         int src_index = -1;
-//         int si = 0;
-//         while(si < NUM_SOURCES && src_index == -1){
-//           alGetSourcei(sources[si], AL_SOURCE_STATE, &value);
-//           if(value != AL_PLAYING)
-//             src_index = si;
-//           ++si;
-//         }
-//         // play sound if a source is available
-//         if(src_index > -1){
-//           alSourcei(sources[src_index], AL_BUFFER, buffers[soundnodes[i].sound]);
-//           alSourcef(sources[src_index], AL_REFERENCE_DISTANCE, reference_distance[soundnodes[i].sound]);
-//           alSourcefv(sources[src_index], AL_POSITION, soundnodes[i].pos);
-//           if(slowMotion)  // Slow down the sound
-//             alSourcef(sources[src_index], AL_PITCH, 0.5f);
-//           else  // Sound at regular speed
-//             alSourcef(sources[src_index], AL_PITCH, 1.0f);
-//           alSourcePlay(sources[src_index]);
-//         }
-//         // deactivate the SoundNode
-//         soundnodes[i].active = false;
+        // Slow down the sound in slow motion
+        m_mixer.Play(soundnodes[i].sound, soundnodes[i].pos, slowMotion ? 0.5f : 1.0f);
+        // deactivate the SoundNode
+        soundnodes[i].active = false;
       }
     }
   }
+
+  if (m_wavFile)
+  {
+    // exactly the frames of this update, written out right away
+    m_wavTime += frameTime * float(SOUNDMIXER_RATE);
+    unsigned int frames(static_cast<unsigned int>(m_wavTime));
+    m_wavTime -= float(frames);
+    float buffer[SOUNDMIXER_BLOCK * SOUNDMIXER_CHANNELS];
+    short samples[SOUNDMIXER_BLOCK * SOUNDMIXER_CHANNELS];
+    while (frames)
+    {
+      const unsigned int count(m_mixer.Mix(m_ring, std::min(frames, (unsigned int)SOUNDMIXER_BLOCK),
+                                           listenerPos, listenerVel, listenerOri));
+      m_ring.Read(buffer, count);
+      for (unsigned int j = 0; j < count * SOUNDMIXER_CHANNELS; ++j)
+        samples[j] = short(buffer[j] * 32767.0f);
+      fwrite(samples, sizeof(short), count * SOUNDMIXER_CHANNELS, m_wavFile);
+      m_wavFrames += count;
+      frames -= count;
+    }
+  }
+  else if (m_stream)
+  {
+    // keep about a tenth of a second mixed ahead of the output
+    const unsigned int lead(SOUNDMIXER_RATE / 10);
+    const unsigned int available(m_ring.Available());
+    if (available < lead)
+      m_mixer.Mix(m_ring, lead - available, listenerPos, listenerVel, listenerOri);
+  }
 }
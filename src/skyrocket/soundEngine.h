@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include "soundMixer.h"
+
 #include <rsMath/rsMath.h>
+#include <atomic>
 #include <math.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
 
 
 #define NUM_SOUNDNODES 100
-#define NUM_SOURCES 16  // 16 is the maximum that works on my computer
 #define NUM_BUFFERS 10
 
 #define LAUNCH1SOUND 0
@@ -39,18 +44,18 @@ namespace kodi
 {
   namespace audioengine
   {
-    class CAddonAEStream;
+    class CAEStream;
   }
 }
 
+// Plays the sounds through CSoundMixer.  The mixer runs on the render thread
+// in update() and keeps a short lead of mixed frames in a ring, which a
+// separate thread hands to Kodi's audio engine.  Given a WAV file name the
+// engine instead writes exactly the frames of each update to that file,
+// which makes the mix reproducible for testing.
 class CSoundEngine
 {
 public:
-// 	ALCcontext* context;
-// 	ALCdevice* device;
-// 	ALuint buffers[NUM_BUFFERS];
-// 	ALuint sources[NUM_SOURCES];
-
   class SoundNode
   {
   public:
@@ -65,11 +70,25 @@ public:
   };
   SoundNode soundnodes[NUM_SOUNDNODES];
 
-  CSoundEngine(/*HWND hwnd,*/ float volume);
+  CSoundEngine(float volume, const std::string& wavFile = "");
   ~CSoundEngine();
   void insertSoundNode(int sound, rsVec source, rsVec observer);
   void update(float* listenerPos, float* listenerVel, float* listenerOri, float frameTime, bool slowMotion);
 
 private:
-  kodi::audioengine::CAddonAEStream* m_stream1;
+  void OutputProcess();
+  void CloseWav();
+
+  CSoundMixer m_mixer;
+  CSoundRing m_ring;
+
+  // real time output
+  kodi::audioengine::CAEStream* m_stream = nullptr;
+  std::thread m_thread;
+  std::atomic<bool> m_running{false};
+
+  // offline output
+  FILE* m_wavFile = nullptr;
+  unsigned int m_wavFrames = 0;
+  float m_wavTime = 0.0f;  // time not yet covered by whole frames
 };
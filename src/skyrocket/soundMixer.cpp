@@ -0,0 +1,170 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#include "soundMixer.h"
+
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SOUNDRING_MASK (SOUNDRING_FRAMES - 1)
+
+// Sound travels at 1130 feet/sec
+#define SPEED_OF_SOUND 1130.0f
+
+unsigned int CSoundRing::Available() const
+{
+  return m_write.load(std::memory_order_acquire) - m_read.load(std::memory_order_acquire);
+}
+
+unsigned int CSoundRing::Space() const
+{
+  return SOUNDRING_FRAMES - Available();
+}
+
+unsigned int CSoundRing::Write(const float* frames, unsigned int count)
+{
+  const unsigned int write(m_write.load(std::memory_order_relaxed));
+  const unsigned int read(m_read.load(std::memory_order_acquire));
+  count = std::min(count, SOUNDRING_FRAMES - (write - read));
+
+  // copy in up to two pieces when wrapping around the end
+  const unsigned int start(write & SOUNDRING_MASK);
+  const unsigned int first(std::min(count, SOUNDRING_FRAMES - start));
+  memcpy(&m_data[start * SOUNDMIXER_CHANNELS], frames, first * SOUNDMIXER_CHANNELS * sizeof(float));
+  memcpy(m_data, &frames[first * SOUNDMIXER_CHANNELS], (count - first) * SOUNDMIXER_CHANNELS * sizeof(float));
+
+  m_write.store(write + count, std::memory_order_release);
+  return count;
+}
+
+unsigned int CSoundRing::Read(float* frames, unsigned int count)
+{
+  const unsigned int read(m_read.load(std::memory_order_relaxed));
+  const unsigned int write(m_write.load(std::memory_order_acquire));
+  count = std::min(count, write - read);
+
+  const unsigned int start(read & SOUNDRING_MASK);
+  const unsigned int first(std::min(count, SOUNDRING_FRAMES - start));
+  memcpy(frames, &m_data[start * SOUNDMIXER_CHANNELS], first * SOUNDMIXER_CHANNELS * sizeof(float));
+  memcpy(&frames[first * SOUNDMIXER_CHANNELS], m_data, (count - first) * SOUNDMIXER_CHANNELS * sizeof(float));
+
+  m_read.store(read + count, std::memory_order_release);
+  return count;
+}
+
+void CSoundMixer::SetSound(int sound, const unsigned char* data, unsigned int bytes, float referenceDistance)
+{
+  if (sound < 0 || sound >= SOUNDMIXER_SOUNDS)
+    return;
+
+  m_sounds[sound].data = data;
+  m_sounds[sound].frames = bytes / 2;
+  m_sounds[sound].referenceDistance = referenceDistance;
+}
+
+void CSoundMixer::Play(int sound, const float* pos, float pitch)
+{
+  if (sound < 0 || sound >= SOUNDMIXER_SOUNDS || !m_sounds[sound].data)
+    return;
+
+  for (auto& voice : m_voices)
+  {
+    if (!voice.playing)
+    {
+      voice.sound = sound;
+      voice.pos[0] = pos[0];
+      voice.pos[1] = pos[1];
+      voice.pos[2] = pos[2];
+      voice.pitch = pitch;
+      voice.position = 0.0;
+      voice.playing = true;
+      return;
+    }
+  }
+}
+
+unsigned int CSoundMixer::Mix(CSoundRing& ring, unsigned int frames,
+                              const float* listenerPos, const float* listenerVel, const float* listenerOri)
+{
+  frames = std::min(frames, ring.Space());
+
+  // listener's right hand side for panning
+  const float right[3] = {listenerOri[1] * listenerOri[5] - listenerOri[2] * listenerOri[4],
+                          listenerOri[2] * listenerOri[3] - listenerOri[0] * listenerOri[5],
+                          listenerOri[0] * listenerOri[4] - listenerOri[1] * listenerOri[3]};
+  const float rightLength(sqrtf(right[0] * right[0] + right[1] * right[1] + right[2] * right[2]));
+
+  unsigned int mixed = 0;
+  while (mixed < frames)
+  {
+    const unsigned int count(std::min(frames - mixed, (unsigned int)SOUNDMIXER_BLOCK));
+    std::fill(m_block, m_block + count * SOUNDMIXER_CHANNELS, 0.0f);
+
+    for (auto& voice : m_voices)
+    {
+      if (!voice.playing)
+        continue;
+
+      const sSound& sound(m_sounds[voice.sound]);
+      const float dir[3] = {voice.pos[0] - listenerPos[0],
+                            voice.pos[1] - listenerPos[1],
+                            voice.pos[2] - listenerPos[2]};
+      const float dist(sqrtf(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]));
+
+      // Inverse distance attenuation like OpenAL's AL_INVERSE_DISTANCE_CLAMPED:
+      // sound is halfway attenuated at twice the reference distance
+      float gain(m_volume * sound.referenceDistance / std::max(dist, sound.referenceDistance));
+
+      // Equal power panning and Doppler shift from the listener's velocity
+      // towards the sound (the sounds themselves don't move)
+      float side(0.0f);
+      float step(voice.pitch);
+      if (dist > 0.0f)
+      {
+        if (rightLength > 0.0f)
+          side = (dir[0] * right[0] + dir[1] * right[1] + dir[2] * right[2]) / (dist * rightLength);
+        float approach((dir[0] * listenerVel[0] + dir[1] * listenerVel[1] + dir[2] * listenerVel[2]) / dist);
+        approach = std::min(approach, SPEED_OF_SOUND * 0.5f);
+        approach = std::max(approach, -SPEED_OF_SOUND * 0.5f);
+        step *= (SPEED_OF_SOUND + approach) / SPEED_OF_SOUND;
+      }
+      const float angle((side + 1.0f) * 0.25f * 3.14159265f);
+      const float left(gain * cosf(angle));
+      const float rightGain(gain * sinf(angle));
+
+      float* out = m_block;
+      for (unsigned int i = 0; i < count; ++i)
+      {
+        const unsigned int index(static_cast<unsigned int>(voice.position));
+        if (index + 1 >= sound.frames)
+        {
+          voice.playing = false;
+          break;
+        }
+
+        const unsigned char* sample = sound.data + index * 2;
+        const float s0(float(int16_t(sample[0] | (sample[1] << 8))));
+        const float s1(float(int16_t(sample[2] | (sample[3] << 8))));
+        const float frac(float(voice.position - double(index)));
+        const float value((s0 + (s1 - s0) * frac) * (1.0f / 32768.0f));
+        out[0] += value * left;
+        out[1] += value * rightGain;
+        out += SOUNDMIXER_CHANNELS;
+        voice.position += step;
+      }
+    }
+
+    for (unsigned int i = 0; i < count * SOUNDMIXER_CHANNELS; ++i)
+      m_block[i] = std::min(1.0f, std::max(-1.0f, m_block[i]));
+    ring.Write(m_block, count);
+    mixed += count;
+  }
+
+  return mixed;
+}
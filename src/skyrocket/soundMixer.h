@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2005-2021 Team Kodi (https://kodi.tv)
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSE.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#define SOUNDMIXER_RATE 44100
+#define SOUNDMIXER_CHANNELS 2  // interleaved left, right
+#define SOUNDMIXER_SOUNDS 16
+#define SOUNDMIXER_VOICES 16  // sounds playing at the same time
+#define SOUNDMIXER_BLOCK 512  // frames mixed at once
+#define SOUNDRING_FRAMES 16384  // must be a power of two
+
+// Ring of mixed frames with one writer (the mixer on the render thread) and
+// one reader (the audio output).  Neither side ever waits for or allocates
+// anything; a full ring drops the newest frames, an empty one returns less.
+class CSoundRing
+{
+public:
+  unsigned int Available() const;
+  unsigned int Space() const;
+  unsigned int Write(const float* frames, unsigned int count);
+  unsigned int Read(float* frames, unsigned int count);
+
+private:
+  float m_data[SOUNDRING_FRAMES * SOUNDMIXER_CHANNELS];
+  // Positions only ever grow and wrap around together with unsigned int
+  std::atomic<unsigned int> m_read{0};
+  std::atomic<unsigned int> m_write{0};
+};
+
+// Software replacement for the OpenAL sources Skyrocket was written for.
+// Mono 16 bit sounds are played from fixed positions with inverse distance
+// attenuation, panning and Doppler shift relative to the listener, all
+// recomputed for every block so that they follow the moving camera.
+class CSoundMixer
+{
+public:
+  CSoundMixer(float volume) : m_volume(volume) { }
+
+  // Register raw little endian 16 bit mono samples as sound number sound
+  void SetSound(int sound, const unsigned char* data, unsigned int bytes, float referenceDistance);
+
+  // Start a sound at pos; dropped if all voices are busy
+  void Play(int sound, const float* pos, float pitch);
+
+  // Mix up to frames frames into ring as heard by the listener.
+  // listenerOri holds the "at" and "up" vectors.
+  unsigned int Mix(CSoundRing& ring, unsigned int frames,
+                   const float* listenerPos, const float* listenerVel, const float* listenerOri);
+
+private:
+  struct sSound
+  {
+    const unsigned char* data = nullptr;
+    unsigned int frames = 0;
+    float referenceDistance = 1.0f;
+  };
+
+  struct sVoice
+  {
+    int sound;
+    float pos[3];
+    float pitch;
+    double position;  // in frames of the sound
+    bool playing = false;
+  };
+
+  float m_volume;
+  sSound m_sounds[SOUNDMIXER_SOUNDS];
+  sVoice m_voices[SOUNDMIXER_VOICES];
+  float m_block[SOUNDMIXER_BLOCK * SOUNDMIXER_CHANNELS];
+};
@@ -47,8 +47,11 @@ void CWorld::Init()
 
   // Initialize cloud texture object even if clouds are not turned on.
   // Sunsets and shockwaves can also use cloud texture.
+  // The cloud map stays decompressed until the sunset texture is made from it.
+  const uint8_t (*clouds)[CLOUDTEXSIZE][2] = reinterpret_cast<const uint8_t (*)[CLOUDTEXSIZE][2]>(cloudmap.acquire());
   gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(CLOUDTEXSIZE, CLOUDTEXSIZE, 1), 1, 1, 1);
-  std::memcpy(Texture.data(), cloudmap, Texture.size());
+  if (clouds)
+    std::memcpy(Texture.data(), clouds, Texture.size());
   m_cloudtex = kodi::gui::gl::Load(Texture);
 
   // initialize star texture
@@ -213,7 +216,9 @@ void CWorld::Init()
   if (m_base->Settings().dMoon)
   {
     gli::texture Texture(gli::TARGET_2D, gli::FORMAT_LA8_UNORM_PACK8, gli::texture::extent_type(MOONTEXSIZE, MOONTEXSIZE, 1), 1, 1, 1);
-    std::memcpy(Texture.data(), moonmap, Texture.size());
+    if (const unsigned char* data = moonmap.acquire())
+      std::memcpy(Texture.data(), data, Texture.size());
+    moonmap.release();
     m_moontex = kodi::gui::gl::Load(Texture);
   }
 
@@ -296,7 +301,7 @@ void CWorld::Init()
       }
     }
     // clouds in sunset
-    if (rsRandi(3))
+    if (rsRandi(3) && clouds)
     {
       float cloudinf;  // influence of clouds
       int xoffset = rsRandi(CLOUDTEXSIZE);
@@ -308,11 +313,11 @@ void CWorld::Init()
         {
           x = (i + xoffset) % CLOUDTEXSIZE;
           y = (j + yoffset) % CLOUDTEXSIZE;
-          cloudinf = float(cloudmap[x][y][1]) / 256.0f;
+          cloudinf = float(clouds[x][y][1]) / 256.0f;
           temp = float(sunsetmap[i][j][0]) / 256.0f;
           temp *= cloudinf;
           sunsetmap[i][j][0] = (uint8_t)(temp * 256.0f);
-          cloudinf *= float(cloudmap[x][y][0]) / 256.0f;
+          cloudinf *= float(clouds[x][y][0]) / 256.0f;
           temp = float(sunsetmap[i][j][1]) / 256.0f;
           temp *= cloudinf;
           sunsetmap[i][j][1] = (uint8_t)(temp * 256.0f);
@@ -351,6 +356,7 @@ void CWorld::Init()
 
     delete[] sunsetmap;
   }
+  cloudmap.release();
 
   //initialize earth texture
   if (m_base->Settings().dEarth)